@@ -0,0 +1,254 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "batched_sweep.hpp"
+#include "device_init.h"
+#include "flops.h"
+#include "hipblas.hpp"
+#include <algorithm>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace
+{
+    const int SWEEP_N[]     = {2, 4, 8, 16, 32, 64, 128, 256};
+    const int SWEEP_BATCH[] = {1, 10, 100, 1000, 10000, 100000, 1000000};
+
+    enum sweep_function
+    {
+        SWEEP_GEMM,
+        SWEEP_TRSM,
+        SWEEP_GETRF,
+        SWEEP_GETRS,
+        SWEEP_GEQRF
+    };
+
+    const char* sweep_name(sweep_function f)
+    {
+        switch(f)
+        {
+        case SWEEP_GEMM:
+            return "gemm_strided_batched";
+        case SWEEP_TRSM:
+            return "trsm_strided_batched";
+        case SWEEP_GETRF:
+            return "getrf_strided_batched";
+        case SWEEP_GETRS:
+            return "getrs_strided_batched";
+        case SWEEP_GEQRF:
+            return "geqrf_strided_batched";
+        }
+        return "";
+    }
+
+    template <typename T>
+    double sweep_gflop(sweep_function f, int n)
+    {
+        switch(f)
+        {
+        case SWEEP_GEMM:
+            return gemm_gflop_count<T>(n, n, n);
+        case SWEEP_TRSM:
+            return trsm_gflop_count<T>(n, n, n);
+        case SWEEP_GETRF:
+            return getrf_gflop_count<T>(n);
+        case SWEEP_GETRS:
+            return getrs_gflop_count<T>(n, 1);
+        case SWEEP_GEQRF:
+            return geqrf_gflop_count<T>(n, n);
+        }
+        return 0;
+    }
+
+    // every n x n matrix of the batch the identity: trsm, getrf and getrs leave it as it is, so
+    // repeated in-place launches keep seeing the same well-conditioned data. One matrix is
+    // uploaded and then doubled in place
+    template <typename T>
+    hipError_t set_identity_batch(T* dA, int n, size_t batch_count)
+    {
+        std::vector<T> identity(size_t(n) * n, T(0));
+        for(int i = 0; i < n; i++)
+            identity[i * (n + 1)] = T(1);
+
+        size_t     bytes = identity.size() * sizeof(T);
+        hipError_t err   = hipMemcpy(dA, identity.data(), bytes, hipMemcpyHostToDevice);
+        for(size_t done = 1; done < batch_count && err == hipSuccess; done *= 2)
+            err = hipMemcpy(dA + done * identity.size(),
+                            dA,
+                            std::min(done, batch_count - done) * bytes,
+                            hipMemcpyDeviceToDevice);
+        return err;
+    }
+
+    // GFLOP/s of one cell, or a negative value where it was skipped. B is n x n for gemm and
+    // trsm, the right-hand side of getrs and the scalars of geqrf
+    template <typename T>
+    double sweep_cell(
+        hipblasHandle_t handle, const Arguments& arg, sweep_function f, int n, int batch)
+    {
+        int    stride   = n * n;
+        int    stride_b = f == SWEEP_GEMM || f == SWEEP_TRSM ? stride : n;
+        bool   use_b    = f != SWEEP_GETRF;
+        size_t bytes    = (stride * (f == SWEEP_GEMM ? 2 : 1) + (use_b ? stride_b : 0)) * sizeof(T)
+                       + (n + 1) * sizeof(int);
+        bytes *= size_t(batch);
+
+        size_t free_bytes = 0, total_bytes = 0;
+        if(hipMemGetInfo(&free_bytes, &total_bytes) != hipSuccess || bytes > free_bytes / 2)
+            return -1;
+
+        T *  dA = nullptr, *dB = nullptr, *dC = nullptr;
+        int *dipiv = nullptr, *dinfo = nullptr;
+        bool ok    = hipMalloc(&dA, size_t(stride) * batch * sizeof(T)) == hipSuccess
+                  && hipMalloc(&dipiv, size_t(n) * batch * sizeof(int)) == hipSuccess
+                  && hipMalloc(&dinfo, size_t(batch) * sizeof(int)) == hipSuccess;
+        if(ok && use_b)
+            ok = hipMalloc(&dB, size_t(stride_b) * batch * sizeof(T)) == hipSuccess
+                 && hipblas_init_device<T>(dB, stride_b, 1, stride_b, stride_b, batch)
+                        == hipSuccess;
+        if(ok && f == SWEEP_GEMM)
+            ok = hipMalloc(&dC, size_t(stride) * batch * sizeof(T)) == hipSuccess;
+
+        // gemm and geqrf run on random data; repeated in-place QR only applies orthogonal
+        // updates, so it stays bounded
+        if(ok && (f == SWEEP_GEMM || f == SWEEP_GEQRF))
+            ok = hipblas_init_device<T>(dA, n, n, n, stride, batch) == hipSuccess;
+        else if(ok)
+            ok = set_identity_batch(dA, n, batch) == hipSuccess;
+
+        // getrs solves with the pivots of a factorization made before timing
+        if(ok && f == SWEEP_GETRS)
+            ok = hipblasGetrfStridedBatched<T>(handle, n, dA, n, stride, dipiv, n, dinfo, batch)
+                 == HIPBLAS_STATUS_SUCCESS;
+
+        T              alpha = T(1), beta = T(0);
+        hipblas_timing timing;
+        if(ok)
+            ok = hipblas_time_launches(handle, arg, timing, [&] {
+                     switch(f)
+                     {
+                     case SWEEP_GEMM:
+                         return hipblasGemmStridedBatched<T>(handle,
+                                                             HIPBLAS_OP_N,
+                                                             HIPBLAS_OP_N,
+                                                             n,
+                                                             n,
+                                                             n,
+                                                             &alpha,
+                                                             dA,
+                                                             n,
+                                                             stride,
+                                                             dB,
+                                                             n,
+                                                             stride,
+                                                             &beta,
+                                                             dC,
+                                                             n,
+                                                             stride,
+                                                             batch);
+                     case SWEEP_TRSM:
+                         return hipblasTrsmStridedBatched<T>(handle,
+                                                             HIPBLAS_SIDE_LEFT,
+                                                             HIPBLAS_FILL_MODE_LOWER,
+                                                             HIPBLAS_OP_N,
+                                                             HIPBLAS_DIAG_NON_UNIT,
+                                                             n,
+                                                             n,
+                                                             &alpha,
+                                                             dA,
+                                                             n,
+                                                             stride,
+                                                             dB,
+                                                             n,
+                                                             stride,
+                                                             batch);
+                     case SWEEP_GETRF:
+                         return hipblasGetrfStridedBatched<T>(
+                             handle, n, dA, n, stride, dipiv, n, dinfo, batch);
+                     case SWEEP_GETRS:
+                     {
+                         int info = 0;
+                         return hipblasGetrsStridedBatched<T>(handle,
+                                                              HIPBLAS_OP_N,
+                                                              n,
+                                                              1,
+                                                              dA,
+                                                              n,
+                                                              stride,
+                                                              dipiv,
+                                                              n,
+                                                              dB,
+                                                              n,
+                                                              stride_b,
+                                                              &info,
+                                                              batch);
+                     }
+                     case SWEEP_GEQRF:
+                     {
+                         int info = 0;
+                         return hipblasGeqrfStridedBatched<T>(
+                             handle, n, n, dA, n, stride, dB, n, &info, batch);
+                     }
+                     }
+                     return HIPBLAS_STATUS_NOT_SUPPORTED;
+                 })
+                 == HIPBLAS_STATUS_SUCCESS;
+
+        hipFree(dA);
+        hipFree(dB);
+        hipFree(dC);
+        hipFree(dipiv);
+        hipFree(dinfo);
+
+        if(!ok || timing.median_us <= 0)
+            return -1;
+        return sweep_gflop<T>(f, n) * batch / timing.median_us * 1e6;
+    }
+}
+
+template <typename T>
+hipblasStatus_t bench_batched_sweep(const Arguments& arg)
+{
+    hipblasHandle_t handle;
+    hipblasStatus_t status = hipblasCreate(&handle);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    std::vector<sweep_function> functions = {SWEEP_GEMM, SWEEP_TRSM};
+#ifdef __HIP_PLATFORM_SOLVER__
+    functions.insert(functions.end(), {SWEEP_GETRF, SWEEP_GETRS, SWEEP_GEQRF});
+#endif
+
+    for(sweep_function f : functions)
+    {
+        std::cout << sweep_name(f) << " GFLOP/s n\\batch_count";
+        for(int batch : SWEEP_BATCH)
+            std::cout << ',' << batch;
+        std::cout << std::endl;
+
+        for(int n : SWEEP_N)
+        {
+            std::cout << n;
+            for(int batch : SWEEP_BATCH)
+            {
+                double gflops = sweep_cell<T>(handle, arg, f, n, batch);
+                std::cout << ',';
+                if(gflops >= 0)
+                    std::cout << gflops;
+            }
+            std::cout << std::endl;
+        }
+        std::cout << std::endl;
+    }
+
+    hipblasDestroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+// clang-format off
+template hipblasStatus_t bench_batched_sweep<float>(const Arguments&);
+template hipblasStatus_t bench_batched_sweep<double>(const Arguments&);
+// clang-format on
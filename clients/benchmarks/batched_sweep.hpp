@@ -0,0 +1,23 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef _BATCHED_SWEEP_HPP_
+#define _BATCHED_SWEEP_HPP_
+
+#include "utility.h"
+
+/*! \brief  Achieved GFLOP/s of gemmStridedBatched, trsmStridedBatched, getrfStridedBatched,
+ *          getrsStridedBatched and geqrfStridedBatched on square n x n matrices, for n from 2 to
+ *          256 in powers of 2 and batch counts from 1 to 1M in powers of 10.
+ *
+ *  Writes one CSV table per function with a row per n and a column per batch count. A cell is
+ *  empty where the batch needs more than half the free device memory or the call fails; the
+ *  solvers are left out of builds without them. Each cell is timed like any other run, with
+ *  arg.cold_iters and arg.hot_iters. Precision is float or double. */
+template <typename T>
+hipblasStatus_t bench_batched_sweep(const Arguments& arg);
+
+#endif
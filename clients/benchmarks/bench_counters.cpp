@@ -0,0 +1,240 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "bench_counters.hpp"
+#include <sstream>
+
+#ifdef HIPBLAS_BENCH_COUNTERS
+#include <algorithm>
+#include <hsa/hsa_ext_amd.h>
+#include <memory>
+#include <rocprofiler.h>
+#include <vector>
+#endif
+
+namespace
+{
+#ifdef HIPBLAS_BENCH_COUNTERS
+    // derived metrics of rocprofiler's metrics.xml; FETCH_SIZE and WRITE_SIZE are in KiB
+    enum metric
+    {
+        occupancy,
+        l2_hit,
+        fetch_kib,
+        write_kib,
+        mfma_util,
+        valu_util,
+        metric_count
+    };
+
+    const char* const metric_names[metric_count] = {"MeanOccupancyPerCU",
+                                                    "L2CacheHit",
+                                                    "FETCH_SIZE",
+                                                    "WRITE_SIZE",
+                                                    "MfmaUtil",
+                                                    "VALUUtilization"};
+
+    // the HSA agent at a PCI address, as HSA_AMD_AGENT_INFO_BDFID packs bus, device and function
+    struct agent_search
+    {
+        uint32_t    domain;
+        uint32_t    bdfid;
+        bool        found = false;
+        hsa_agent_t agent = {};
+    };
+
+    hsa_status_t find_agent(hsa_agent_t agent, void* data)
+    {
+        agent_search*     search = static_cast<agent_search*>(data);
+        hsa_device_type_t type;
+        uint32_t          domain, bdfid;
+        if(hsa_agent_get_info(agent, HSA_AGENT_INFO_DEVICE, &type) != HSA_STATUS_SUCCESS
+           || type != HSA_DEVICE_TYPE_GPU)
+            return HSA_STATUS_SUCCESS;
+        if(hsa_agent_get_info(agent, hsa_agent_info_t(HSA_AMD_AGENT_INFO_DOMAIN), &domain)
+               != HSA_STATUS_SUCCESS
+           || hsa_agent_get_info(agent, hsa_agent_info_t(HSA_AMD_AGENT_INFO_BDFID), &bdfid)
+                  != HSA_STATUS_SUCCESS
+           || domain != search->domain || bdfid != search->bdfid)
+            return HSA_STATUS_SUCCESS;
+
+        search->found = true;
+        search->agent = agent;
+        return HSA_STATUS_INFO_BREAK;
+    }
+
+    // Standalone mode counts the whole device between start and read, with the start and read
+    // packets on a queue of the profiler's own; a single group has every metric in one pass
+    hsa_status_t open_context(hsa_agent_t                         agent,
+                              std::vector<rocprofiler_feature_t>& features,
+                              rocprofiler_t**                     context)
+    {
+        rocprofiler_properties_t properties = {};
+        properties.queue_depth              = 128;
+        return rocprofiler_open(agent,
+                                features.data(),
+                                uint32_t(features.size()),
+                                context,
+                                ROCPROFILER_MODE_STANDALONE | ROCPROFILER_MODE_CREATEQUEUE
+                                    | ROCPROFILER_MODE_SINGLEGROUP,
+                                &properties);
+    }
+
+    struct profiler_observer : hipblas_timing_observer
+    {
+        rocprofiler_t*                     context = nullptr;
+        std::vector<rocprofiler_feature_t> features; // rocprofiler writes the values in place
+        std::vector<metric>                metrics; // of each feature
+        double                             waves_per_cu = 0;
+        bool                               started      = false;
+
+        void begin(hipStream_t stream) override
+        {
+            // the untimed calls are queued and must finish before counting starts
+            started = hipStreamSynchronize(stream) == hipSuccess
+                      && rocprofiler_reset(context, 0) == HSA_STATUS_SUCCESS
+                      && rocprofiler_start(context, 0) == HSA_STATUS_SUCCESS;
+        }
+
+        void end(hipStream_t, int launches, hipblas_counters& counters) override
+        {
+            if(!started)
+                return;
+            bool read = rocprofiler_read(context, 0) == HSA_STATUS_SUCCESS
+                        && rocprofiler_get_data(context, 0) == HSA_STATUS_SUCCESS
+                        && rocprofiler_get_metrics(context) == HSA_STATUS_SUCCESS;
+            rocprofiler_stop(context, 0);
+            started = false;
+            if(!read)
+                return;
+
+            double value[metric_count];
+            std::fill(value, value + metric_count, -1.0);
+            for(size_t i = 0; i < features.size(); i++)
+            {
+                const rocprofiler_data_t& data = features[i].data;
+                if(data.kind == ROCPROFILER_DATA_KIND_DOUBLE)
+                    value[metrics[i]] = data.result_double;
+                else if(data.kind == ROCPROFILER_DATA_KIND_INT64)
+                    value[metrics[i]] = double(data.result_int64);
+            }
+
+            counters.collected = true;
+            counters.occupancy_percent
+                = value[occupancy] < 0 ? -1 : 100.0 * value[occupancy] / waves_per_cu;
+            counters.l2_hit_percent = value[l2_hit];
+            counters.hbm_bytes      = value[fetch_kib] < 0 || value[write_kib] < 0
+                                          ? -1
+                                          : (value[fetch_kib] + value[write_kib]) * 1024 / launches;
+            counters.matrix_percent = value[mfma_util];
+            counters.valu_percent   = value[valu_util];
+        }
+    };
+
+    profiler_observer* observer = nullptr;
+#endif
+}
+
+bool bench_counters_enable(int device, std::string& error)
+{
+#ifdef HIPBLAS_BENCH_COUNTERS
+    hipDeviceProp_t props;
+    if(hipGetDeviceProperties(&props, device) != hipSuccess)
+    {
+        error = "cannot read the device properties";
+        return false;
+    }
+    if(hsa_init() != HSA_STATUS_SUCCESS)
+    {
+        error = "cannot initialize HSA";
+        return false;
+    }
+
+    agent_search search;
+    search.domain = uint32_t(props.pciDomainID);
+    search.bdfid  = uint32_t(props.pciBusID << 8 | props.pciDeviceID << 3);
+    hsa_iterate_agents(find_agent, &search);
+
+    std::unique_ptr<profiler_observer> o(new profiler_observer);
+    o->waves_per_cu = double(props.maxThreadsPerMultiProcessor) / props.warpSize;
+
+    // each metric the device has, as long as it still fits the pass of those before it
+    for(int m = 0; m < metric_count && search.found; m++)
+    {
+        rocprofiler_feature_t feature = {};
+        feature.kind                  = ROCPROFILER_FEATURE_KIND_METRIC;
+        feature.name                  = metric_names[m];
+        o->features.push_back(feature);
+
+        rocprofiler_t* probe = nullptr;
+        if(open_context(search.agent, o->features, &probe) == HSA_STATUS_SUCCESS)
+        {
+            rocprofiler_close(probe);
+            o->metrics.push_back(metric(m));
+        }
+        else
+            o->features.pop_back();
+    }
+
+    if(!search.found)
+        error = "no HSA agent has the PCI address of the device";
+    else if(o->features.empty())
+        error = "rocprofiler counts none of the metrics here; ROCP_METRICS may have to name its "
+                "metrics.xml";
+    else if(open_context(search.agent, o->features, &o->context) != HSA_STATUS_SUCCESS)
+        error = "cannot open a rocprofiler context";
+    if(!o->context)
+    {
+        hsa_shut_down();
+        return false;
+    }
+
+    observer = o.release();
+    hipblas_set_timing_observer(observer);
+    return true;
+#else
+    error = "built without counters; configure with BUILD_WITH_COUNTERS on ROCm";
+    return false;
+#endif
+}
+
+void bench_counters_disable()
+{
+#ifdef HIPBLAS_BENCH_COUNTERS
+    if(!observer)
+        return;
+    hipblas_set_timing_observer(nullptr);
+    rocprofiler_close(observer->context);
+    delete observer;
+    observer = nullptr;
+    hsa_shut_down();
+#endif
+}
+
+void bench_print_counters(std::ostream&                out,
+                          const std::string&           function,
+                          const hipblas_timing_result& result)
+{
+    const hipblas_counters& c    = result.timing.counters;
+    double                  rate = c.hbm_bytes < 0 || result.timing.median_us <= 0
+                                       ? -1
+                                       : c.hbm_bytes / result.timing.median_us / 1e3;
+
+    out << "counters,occupancy-%,l2-hit-%,hbm-bytes,hbm-GB/s,matrix-core-%,valu-%" << std::endl;
+    out << function << ',' << c.occupancy_percent << ',' << c.l2_hit_percent << ','
+        << c.hbm_bytes << ',' << rate << ',' << c.matrix_percent << ',' << c.valu_percent
+        << std::endl;
+}
+
+std::string bench_counters_json(const hipblas_counters& counters)
+{
+    std::ostringstream json;
+    json << "{\"occupancy_percent\": " << counters.occupancy_percent
+         << ", \"l2_hit_percent\": " << counters.l2_hit_percent
+         << ", \"hbm_bytes\": " << counters.hbm_bytes
+         << ", \"matrix_percent\": " << counters.matrix_percent
+         << ", \"valu_percent\": " << counters.valu_percent << "}";
+    return json.str();
+}
@@ -0,0 +1,41 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef _BENCH_COUNTERS_HPP_
+#define _BENCH_COUNTERS_HPP_
+
+#include "utility.h"
+#include <ostream>
+#include <string>
+
+/*!\file
+ * \brief Hardware counters over the timed launches of each case, for hipblas-bench --counters:
+ *        occupancy, L2 hit rate, memory traffic and matrix core and VALU use, so a case that got
+ *        slower can be told memory bound from compute bound without another run under a
+ *        profiler.
+ *
+ * They are read through rocprofiler in standalone mode, which counts everything the device runs
+ * between the start and end of the timed launches, in builds configured with
+ * BUILD_WITH_COUNTERS on ROCm. Metrics the device lacks, or cannot count in the same pass as
+ * those before them, stay at -1.
+ */
+
+/*! \brief  Count the timed runs of the calling thread on device from now on; false, with the
+ *          reason in error, if the counters cannot be read */
+bool bench_counters_enable(int device, std::string& error);
+
+/*! \brief  Stop counting and release the profiler */
+void bench_counters_disable();
+
+/*! \brief  A CSV header line and a row of the counters of a run of function */
+void bench_print_counters(std::ostream&                out,
+                          const std::string&           function,
+                          const hipblas_timing_result& result);
+
+/*! \brief  The counters as a JSON object on one line */
+std::string bench_counters_json(const hipblas_counters& counters);
+
+#endif
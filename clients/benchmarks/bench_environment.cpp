@@ -0,0 +1,194 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "bench_environment.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <dirent.h>
+#include <sstream>
+
+#ifdef __HIP_PLATFORM_NVCC__
+#include <dlfcn.h>
+#endif
+
+namespace
+{
+#ifdef __HIP_PLATFORM_NVCC__
+    // the few NVML entry points used, by the signatures of nvml.h with nvmlDevice_t as void*
+    typedef int (*nvml_init_t)();
+    typedef int (*nvml_handle_t)(const char*, void**);
+    typedef int (*nvml_clock_t)(void*, int, unsigned*);
+    typedef int (*nvml_value_t)(void*, unsigned*);
+    typedef int (*nvml_temperature_t)(void*, int, unsigned*);
+
+    constexpr int NVML_CLOCK_SM        = 1;
+    constexpr int NVML_CLOCK_MEM       = 2;
+    constexpr int NVML_TEMPERATURE_GPU = 0;
+
+    void read_nvml(int device, bench_environment& env)
+    {
+        static void* nvml = dlopen("libnvidia-ml.so.1", RTLD_NOW);
+        if(!nvml)
+            return;
+
+        auto init        = (nvml_init_t)dlsym(nvml, "nvmlInit_v2");
+        auto handle      = (nvml_handle_t)dlsym(nvml, "nvmlDeviceGetHandleByPciBusId_v2");
+        auto clock       = (nvml_clock_t)dlsym(nvml, "nvmlDeviceGetClockInfo");
+        auto max_clock   = (nvml_clock_t)dlsym(nvml, "nvmlDeviceGetMaxClockInfo");
+        auto power       = (nvml_value_t)dlsym(nvml, "nvmlDeviceGetPowerUsage");
+        auto power_cap   = (nvml_value_t)dlsym(nvml, "nvmlDeviceGetEnforcedPowerLimit");
+        auto temperature = (nvml_temperature_t)dlsym(nvml, "nvmlDeviceGetTemperature");
+
+        char  bus_id[64];
+        void* dev = nullptr;
+        if(!init || !handle || init() != 0
+           || hipDeviceGetPCIBusId(bus_id, sizeof(bus_id), device) != hipSuccess
+           || handle(bus_id, &dev) != 0)
+            return;
+
+        unsigned value;
+        if(clock && clock(dev, NVML_CLOCK_SM, &value) == 0)
+            env.sclk_mhz = value;
+        if(max_clock && max_clock(dev, NVML_CLOCK_SM, &value) == 0)
+            env.sclk_max_mhz = value;
+        if(clock && clock(dev, NVML_CLOCK_MEM, &value) == 0)
+            env.mclk_mhz = value;
+        if(max_clock && max_clock(dev, NVML_CLOCK_MEM, &value) == 0)
+            env.mclk_max_mhz = value;
+        if(power && power(dev, &value) == 0)
+            env.power_w = value / 1e3;
+        if(power_cap && power_cap(dev, &value) == 0)
+            env.power_cap_w = value / 1e3;
+        if(temperature && temperature(dev, NVML_TEMPERATURE_GPU, &value) == 0)
+            env.temperature_c = value;
+    }
+#else
+    // a pp_dpm_* file lists one level per line, as "1: 1900Mhz *" with * on the current one
+    void read_dpm(const std::string& path, double& current, double& highest)
+    {
+        FILE* f = fopen(path.c_str(), "r");
+        if(!f)
+            return;
+
+        char line[256];
+        while(fgets(line, sizeof(line), f))
+        {
+            int    level;
+            double mhz;
+            if(sscanf(line, "%d: %lfMhz", &level, &mhz) != 2)
+                continue;
+            highest = std::max(highest, mhz);
+            if(strchr(line, '*'))
+                current = mhz;
+        }
+        fclose(f);
+    }
+
+    double read_number(const std::string& path)
+    {
+        FILE*  f     = fopen(path.c_str(), "r");
+        double value = -1;
+        if(f)
+        {
+            if(fscanf(f, "%lf", &value) != 1)
+                value = -1;
+            fclose(f);
+        }
+        return value;
+    }
+
+    // hwmon reports power in microwatts and temperature in millidegrees
+    void read_sysfs(int device, bench_environment& env)
+    {
+        std::string pci = bench_pci_path(device);
+        if(pci.empty())
+            return;
+
+        read_dpm(pci + "/pp_dpm_sclk", env.sclk_mhz, env.sclk_max_mhz);
+        read_dpm(pci + "/pp_dpm_mclk", env.mclk_mhz, env.mclk_max_mhz);
+
+        DIR* dir = opendir((pci + "/hwmon").c_str());
+        if(!dir)
+            return;
+        std::string hwmon;
+        while(dirent* entry = readdir(dir))
+            if(!strncmp(entry->d_name, "hwmon", 5))
+                hwmon = pci + "/hwmon/" + entry->d_name;
+        closedir(dir);
+        if(hwmon.empty())
+            return;
+
+        double power = read_number(hwmon + "/power1_average");
+        if(power < 0)
+            power = read_number(hwmon + "/power1_input");
+        double cap         = read_number(hwmon + "/power1_cap");
+        double temperature = read_number(hwmon + "/temp1_input");
+        env.power_w        = power < 0 ? -1 : power / 1e6;
+        env.power_cap_w    = cap < 0 ? -1 : cap / 1e6;
+        env.temperature_c  = temperature < 0 ? -1 : temperature / 1e3;
+    }
+#endif
+}
+
+std::string bench_pci_path(int device)
+{
+    char bus_id[64];
+    if(hipDeviceGetPCIBusId(bus_id, sizeof(bus_id), device) != hipSuccess)
+        return "";
+
+    std::string path = std::string("/sys/bus/pci/devices/") + bus_id;
+    std::transform(path.begin(), path.end(), path.begin(), ::tolower);
+    return path;
+}
+
+bench_environment bench_read_environment(int device)
+{
+    bench_environment env;
+#ifdef __HIP_PLATFORM_NVCC__
+    read_nvml(device, env);
+#else
+    read_sysfs(device, env);
+#endif
+    return env;
+}
+
+void bench_print_environment(std::ostream& out, const char* when, const bench_environment& env)
+{
+    out << "environment,sclk-mhz,sclk-max-mhz,mclk-mhz,mclk-max-mhz,power-w,power-cap-w,"
+           "temperature-c"
+        << std::endl;
+    out << when << ',' << env.sclk_mhz << ',' << env.sclk_max_mhz << ',' << env.mclk_mhz << ','
+        << env.mclk_max_mhz << ',' << env.power_w << ',' << env.power_cap_w << ','
+        << env.temperature_c << std::endl;
+}
+
+std::string bench_environment_json(const bench_environment& env)
+{
+    std::ostringstream json;
+    json << "{\"sclk_mhz\": " << env.sclk_mhz << ", \"sclk_max_mhz\": " << env.sclk_max_mhz
+         << ", \"mclk_mhz\": " << env.mclk_mhz << ", \"mclk_max_mhz\": " << env.mclk_max_mhz
+         << ", \"power_w\": " << env.power_w << ", \"power_cap_w\": " << env.power_cap_w
+         << ", \"temperature_c\": " << env.temperature_c << "}";
+    return json.str();
+}
+
+std::string bench_device_properties_json(const hipDeviceProp_t& props)
+{
+    std::ostringstream json;
+    json << "{\"compute_units\": " << props.multiProcessorCount
+         << ", \"clock_khz\": " << props.clockRate
+         << ", \"memory_clock_khz\": " << props.memoryClockRate
+         << ", \"memory_bus_width\": " << props.memoryBusWidth
+         << ", \"l2_cache_bytes\": " << props.l2CacheSize
+         << ", \"global_memory_bytes\": " << props.totalGlobalMem << ", \"compute_capability\": \""
+         << props.major << '.' << props.minor << "\"";
+#ifndef __HIP_PLATFORM_NVCC__
+    json << ", \"gcn_arch\": \"" << props.gcnArchName << "\"";
+#endif
+    json << "}";
+    return json.str();
+}
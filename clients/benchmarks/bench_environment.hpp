@@ -0,0 +1,48 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef _BENCH_ENVIRONMENT_HPP_
+#define _BENCH_ENVIRONMENT_HPP_
+
+#include <hip/hip_runtime_api.h>
+#include <ostream>
+#include <string>
+
+/*!\file
+ * \brief Clocks, power and temperature of a device, sampled at the start and end of a benchmark
+ *        run so throttling shows up next to the numbers it affects.
+ *
+ * On AMD devices they are read from the amdgpu sysfs files that rocm-smi reads; on NVIDIA
+ * devices from NVML, loaded at run time so the benchmark does not depend on it.
+ */
+
+struct bench_environment
+{
+    // -1 where the system does not report it
+    double sclk_mhz      = -1;
+    double sclk_max_mhz  = -1;
+    double mclk_mhz      = -1;
+    double mclk_max_mhz  = -1;
+    double power_w       = -1;
+    double power_cap_w   = -1;
+    double temperature_c = -1;
+};
+
+/*! \brief  The sysfs directory of the PCI function of device, or "" if it cannot be told */
+std::string bench_pci_path(int device);
+
+bench_environment bench_read_environment(int device);
+
+/*! \brief  A CSV header line and then one row per call, the row named by when */
+void bench_print_environment(std::ostream& out, const char* when, const bench_environment& env);
+
+/*! \brief  The sample as a JSON object on one line */
+std::string bench_environment_json(const bench_environment& env);
+
+/*! \brief  The hipDeviceProp_t fields that shape performance as a JSON object on one line */
+std::string bench_device_properties_json(const hipDeviceProp_t& props);
+
+#endif
@@ -0,0 +1,196 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "bench_results.hpp"
+#include "bench_counters.hpp"
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+
+namespace
+{
+    // scaled by 1.4826, a median absolute deviation estimates the standard deviation of
+    // normally distributed launch times
+    constexpr double MAD_TO_SIGMA = 1.4826;
+    constexpr double NOISE_SIGMAS = 3.0;
+
+    std::string json_string(const std::string& s)
+    {
+        std::string out = "\"";
+        for(char c : s)
+        {
+            if(c == '"' || c == '\\')
+                out += '\\';
+            out += c;
+        }
+        return out + "\"";
+    }
+
+    // the value of "name": in a line written by bench_write_results, or "" if absent
+    std::string json_field(const std::string& line, const std::string& name)
+    {
+        size_t at = line.find("\"" + name + "\":");
+        if(at == std::string::npos)
+            return "";
+
+        at += name.size() + 3;
+        while(at < line.size() && line[at] == ' ')
+            at++;
+        if(at < line.size() && line[at] == '"')
+        {
+            std::string value;
+            for(at++; at < line.size() && line[at] != '"'; at++)
+                value += line[at] == '\\' && at + 1 < line.size() ? line[++at] : line[at];
+            return value;
+        }
+        size_t end = line.find_first_of(",}", at);
+        return line.substr(at, end == std::string::npos ? std::string::npos : end - at);
+    }
+
+    bool read_results(const std::string& path, std::map<std::string, hipblas_timing_result>& out)
+    {
+        std::ifstream file(path);
+        if(!file)
+        {
+            std::cerr << "hipblas-bench: cannot read " << path << std::endl;
+            return false;
+        }
+
+        std::string line;
+        while(std::getline(file, line))
+        {
+            std::string key = json_field(line, "case");
+            if(key.empty())
+                continue;
+
+            hipblas_timing_result& r = out[key];
+            r.timing.median_us       = atof(json_field(line, "median_us").c_str());
+            r.timing.min_us          = atof(json_field(line, "min_us").c_str());
+            r.timing.mad_us          = atof(json_field(line, "mad_us").c_str());
+            r.timing.launches        = atoi(json_field(line, "launches").c_str());
+            r.gflops                 = atof(json_field(line, "gflops").c_str());
+            r.gbytes                 = atof(json_field(line, "gbytes").c_str());
+        }
+        return true;
+    }
+}
+
+std::string bench_result_key(const std::string& function, char precision, const Arguments& arg)
+{
+    std::ostringstream key;
+    key << function << ' ' << precision << " M=" << arg.M << " N=" << arg.N << " K=" << arg.K
+        << " lda=" << arg.lda << " ldb=" << arg.ldb << " ldc=" << arg.ldc << " incx=" << arg.incx
+        << " incy=" << arg.incy << " transA=" << arg.transA_option
+        << " transB=" << arg.transB_option << " side=" << arg.side_option
+        << " uplo=" << arg.uplo_option << " diag=" << arg.diag_option
+        << " batch_count=" << arg.batch_count << " stride_scale=" << arg.stride_scale
+        << " alpha=" << arg.alpha << ',' << arg.alphai << " beta=" << arg.beta << ','
+        << arg.betai << " device_init=" << arg.device_init << " flush=" << arg.flush;
+
+    // only when set, so the keys of earlier --json files still match
+    if(arg.algo)
+        key << " algo=" << arg.algo;
+    if(arg.group_size != 128)
+        key << " group_size=" << arg.group_size;
+    if(arg.autotune)
+        key << " autotune=" << arg.autotune;
+    if(arg.pivot_option != 'V')
+        key << " pivot=" << arg.pivot_option;
+    if(arg.direct_option != 'F')
+        key << " direct=" << arg.direct_option;
+    return key.str();
+}
+
+bool bench_write_results(const std::string&               path,
+                         const std::vector<bench_result>& results,
+                         const bench_environment&         start,
+                         const bench_environment&         end)
+{
+    std::ofstream file(path);
+    if(!file)
+        return false;
+
+    int             device = 0, driver = 0, runtime = 0;
+    hipDeviceProp_t props  = {};
+    hipGetDevice(&device);
+    hipGetDeviceProperties(&props, device);
+    hipDriverGetVersion(&driver);
+    hipRuntimeGetVersion(&runtime);
+
+    // hipblas-version.h spells the minor version hipblaseVersionMinor
+    std::ostringstream hipblas_version;
+    hipblas_version << hipblasVersionMajor << '.' << hipblaseVersionMinor << '.'
+                    << hipblasVersionPatch << '.' << hipblasVersionTweak;
+
+    file << std::setprecision(9);
+    file << "{\n";
+    file << "  \"device\": " << json_string(props.name) << ",\n";
+    file << "  \"device_properties\": " << bench_device_properties_json(props) << ",\n";
+    file << "  \"driver_version\": " << driver << ",\n";
+    file << "  \"runtime_version\": " << runtime << ",\n";
+    file << "  \"hipblas_version\": " << json_string(hipblas_version.str()) << ",\n";
+    file << "  \"environment_start\": " << bench_environment_json(start) << ",\n";
+    file << "  \"environment_end\": " << bench_environment_json(end) << ",\n";
+    file << "  \"results\": [";
+    for(size_t i = 0; i < results.size(); i++)
+    {
+        const hipblas_timing_result& r = results[i].result;
+        file << (i ? ",\n" : "\n") << "    {\"case\": " << json_string(results[i].key)
+             << ", \"median_us\": " << r.timing.median_us << ", \"min_us\": " << r.timing.min_us
+             << ", \"mad_us\": " << r.timing.mad_us << ", \"launches\": " << r.timing.launches
+             << ", \"gflops\": " << r.gflops << ", \"gbytes\": " << r.gbytes;
+        if(r.timing.counters.collected)
+            file << ", \"counters\": " << bench_counters_json(r.timing.counters);
+        file << "}";
+    }
+    file << "\n  ]\n}\n";
+    return bool(file);
+}
+
+int bench_compare_results(const std::string& baseline_path,
+                          const std::string& current_path,
+                          double             threshold_percent)
+{
+    std::map<std::string, hipblas_timing_result> baseline, current;
+    if(!read_results(baseline_path, baseline) || !read_results(current_path, current))
+        return -1;
+
+    int regressions = 0;
+    std::cout << "case,baseline-median-us,current-median-us,change-%,noise-us,result" << std::endl;
+    for(const auto& base : baseline)
+    {
+        auto now = current.find(base.first);
+        if(now == current.end())
+        {
+            std::cout << json_string(base.first) << ',' << base.second.timing.median_us
+                      << ",,,,missing" << std::endl;
+            continue;
+        }
+
+        const hipblas_timing& b = base.second.timing;
+        const hipblas_timing& c = now->second.timing;
+
+        double change = b.median_us > 0 ? 100.0 * (c.median_us - b.median_us) / b.median_us : 0;
+        double noise  = NOISE_SIGMAS * MAD_TO_SIGMA * std::hypot(b.mad_us, c.mad_us);
+        bool   slower = change > threshold_percent && c.median_us - b.median_us > noise;
+        regressions += slower;
+
+        const char* verdict = slower ? "REGRESSION" : change < -threshold_percent ? "faster" : "ok";
+        std::cout << json_string(base.first) << ',' << b.median_us << ',' << c.median_us << ','
+                  << change << ',' << noise << ',' << verdict << std::endl;
+    }
+    for(const auto& now : current)
+        if(!baseline.count(now.first))
+            std::cout << json_string(now.first) << ",," << now.second.timing.median_us
+                      << ",,,new" << std::endl;
+
+    std::cout << regressions << " of " << baseline.size() << " cases regressed by more than "
+              << threshold_percent << "%" << std::endl;
+    return regressions;
+}
@@ -0,0 +1,51 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef _BENCH_RESULTS_HPP_
+#define _BENCH_RESULTS_HPP_
+
+#include "bench_environment.hpp"
+#include "utility.h"
+#include <string>
+#include <vector>
+
+/*!\file
+ * \brief Benchmark results as JSON, and the comparison of two result files that hipblas-bench
+ *        --compare runs as a performance regression gate.
+ *
+ * A result file holds the device, its properties, driver, runtime and hipBLAS versions and the
+ * environment sampled at the start and end of the run, then one object per timed run on a line
+ * of its own, with the hardware counters of the run when hipblas-bench --counters read them.
+ * Runs are matched across files by their "case" string.
+ */
+
+struct bench_result
+{
+    std::string           key; // function, precision and every argument that shapes the run
+    hipblas_timing_result result;
+};
+
+/*! \brief  The key of a run of function at precision with arguments arg */
+std::string bench_result_key(const std::string& function, char precision, const Arguments& arg);
+
+/*! \brief  Write results with the environment of the current device; false if path cannot be
+ *          written */
+bool bench_write_results(const std::string&               path,
+                         const std::vector<bench_result>& results,
+                         const bench_environment&         start,
+                         const bench_environment&         end);
+
+/*! \brief  Print every case of baseline and current side by side and return the number of
+ *          regressions, or -1 if a file cannot be read.
+ *
+ *  A case regresses when its median time grew by more than threshold_percent and the growth
+ *  is also over three standard deviations of the noise, estimated from the median absolute
+ *  deviations of both runs, so a noisy case needs a larger slowdown to fail. */
+int bench_compare_results(const std::string& baseline_path,
+                          const std::string& current_path,
+                          double             threshold_percent);
+
+#endif
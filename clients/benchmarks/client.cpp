@@ -0,0 +1,402 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <boost/program_options.hpp>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "hipblas.hpp"
+#include "utility.h"
+
+#include "batched_sweep.hpp"
+#include "bench_counters.hpp"
+#include "bench_results.hpp"
+#include "concurrency_scaling.hpp"
+#include "ld_sweep.hpp"
+#include "multi_device.hpp"
+#include "testing_dispatch.hpp"
+#include "transfer_bandwidth.hpp"
+#include "wrapper_overhead.hpp"
+#include "yaml_cases.h"
+
+namespace po = boost::program_options;
+
+/* ============================================================================================ */
+/*  benchmarks beyond the testing_* templates */
+
+// Host time per call of back-to-back axpy calls with n = 0, which return before any launch, so
+// what is left is the cost of the hipblas and backend entry layers themselves
+template <typename T>
+hipblasStatus_t bench_api_overhead(const Arguments& arg)
+{
+    hipblasHandle_t handle;
+    hipblasStatus_t status = hipblasCreate(&handle);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    T alpha = arg.alpha;
+    for(int iter = 0; iter < arg.cold_iters && status == HIPBLAS_STATUS_SUCCESS; iter++)
+        status = hipblasAxpy<T>(handle, 0, &alpha, nullptr, 1, nullptr, 1);
+
+    double start = get_time_us();
+    for(int iter = 0; iter < arg.hot_iters && status == HIPBLAS_STATUS_SUCCESS; iter++)
+        status = hipblasAxpy<T>(handle, 0, &alpha, nullptr, 1, nullptr, 1);
+    double elapsed = get_time_us() - start;
+
+    hipblasDestroy(handle);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    std::cout << "calls,ns-per-call" << std::endl;
+    std::cout << arg.hot_iters << ',' << elapsed * 1000.0 / arg.hot_iters << std::endl;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+// bytes of an element of the precision, or 0 for an unknown one
+static int precision_size(char precision)
+{
+    switch(precision)
+    {
+    case 'h':
+        return sizeof(hipblasHalf);
+    case 's':
+        return sizeof(float);
+    case 'd':
+        return sizeof(double);
+    case 'c':
+        return sizeof(hipblasComplex);
+    case 'z':
+        return sizeof(hipblasDoubleComplex);
+    }
+    return 0;
+}
+
+// --threads and --gemv_percent of function concurrency, which the YAML lists do not set
+static concurrency_options concurrency;
+
+hipblasStatus_t run_bench(const std::string& function, char precision, const Arguments& arg)
+{
+    if(function == "wrapper_overhead")
+        return precision == 's' ? bench_wrapper_overhead(arg) : HIPBLAS_STATUS_NOT_SUPPORTED;
+    else if(function == "transfer_bandwidth")
+        return precision_size(precision) ? bench_transfer_bandwidth(arg, precision_size(precision))
+                                         : HIPBLAS_STATUS_NOT_SUPPORTED;
+    else if(function == "concurrency")
+        return precision == 's' ? bench_concurrency_scaling(arg, concurrency)
+                                : HIPBLAS_STATUS_NOT_SUPPORTED;
+    else if(function == "batched_sweep")
+        return precision == 's'   ? bench_batched_sweep<float>(arg)
+               : precision == 'd' ? bench_batched_sweep<double>(arg)
+                                  : HIPBLAS_STATUS_NOT_SUPPORTED;
+    else if(function == "ld_sweep")
+        return precision == 's'   ? bench_ld_sweep<float>(arg)
+               : precision == 'd' ? bench_ld_sweep<double>(arg)
+                                  : HIPBLAS_STATUS_NOT_SUPPORTED;
+    else if(function != "api_overhead")
+        return testing_dispatch(function, precision, arg);
+
+    switch(precision)
+    {
+    case 's':
+        return bench_api_overhead<float>(arg);
+    case 'd':
+        return bench_api_overhead<double>(arg);
+    case 'c':
+        return bench_api_overhead<hipblasComplex>(arg);
+    case 'z':
+        return bench_api_overhead<hipblasDoubleComplex>(arg);
+    }
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+/* ============================================================================================ */
+/*  options of the command line, which every entry of a --yaml list starts from */
+
+static po::options_description
+    bench_options(Arguments& arg, std::string& function, char& precision)
+{
+    po::options_description desc("hipblas-bench command line options");
+
+    // clang-format off
+    desc.add_options()
+        ("function,f", po::value<std::string>(&function)->default_value("gemm"),
+         "BLAS function to benchmark: axpy, dot, scal, gemv, gemm, gemm_batched, "
+         "gemm_strided_batched; gemm_batch_reduce and gemm_strided_batch_reduce summing the "
+         "batches into one C; ger_accumulate of k rank-1 updates, gerc_accumulate in c and z; "
+         "lacpy, symmetrize, hermitize, transpose and lasr and their "
+         "_batched and _strided_batched forms; "
+         "axpy_vbatched_ex, axpby_vbatched_ex, scal_vbatched_ex and copy_vbatched_ex over "
+         "batch_count vectors up to n long; "
+         "gemm_quantized and gemm_quantized_strided_batched on a weight-only quantized B; "
+         "sparse_gemm24 for prune, compress and the gemm of a 2:4 sparse A, timing the gemm; "
+         "gemm_requant for the int8 gemm requantized to int8 C, under precision s; "
+         "gemm_autotune for gemm_ex in s or d once --autotune trials have tuned it; "
+         "gemm_strassen for gemm and gemm_ex in s or d through --strassen_levels of "
+         "Strassen-Winograd recursion; "
+         "gemm_abft and its _batched and _strided_batched forms in s or d, checked in the "
+         "--abft_mode; "
+         "trsm_mixed_ex and trmm_mixed_ex and their _batched_ex and _strided_batched_ex "
+         "forms on h or s data with fp32 compute; "
+         "gemm_jit for a gemm plan of a run-time compiled kernel in h or s, with the "
+         "epilogue of --algo; "
+         "with the solvers getrf, getrs, geqrf, potrf, their "
+         "_strided_batched forms, getri_strided_batched and tsqr; "
+         "api_overhead for the host cost of an empty axpy call, or "
+         "wrapper_overhead for the host cost hipBLAS adds to tiny calls over the backend, or "
+         "batched_sweep for GFLOP/s tables of small strided batched problems, or "
+         "ld_sweep for gemm GFLOP/s over padded leading dimensions, or "
+         "transfer_bandwidth for the GB/s of the Set/Get Vector and Matrix calls, or "
+         "concurrency for the scaling of small gemm and gemv calls over host threads")
+        ("precision,r", po::value<char>(&precision)->default_value('s'),
+         "Precision: h, s, d, c or z (h only for axpy, dot, the quantized gemms, "
+         "sparse_gemm24, the mixed trsm and trmm and gemm_jit, s and d only for the solvers, the "
+         "vbatched Ex routines, gemm_autotune, gemm_strassen and the gemm_abft routines, c and "
+         "z only for hermitize and gerc_accumulate)")
+        ("sizem,m", po::value<int>(&arg.M)->default_value(128), "Rows of A and C")
+        ("sizen,n", po::value<int>(&arg.N)->default_value(128), "Columns of B and C, length of x")
+        ("sizek,k", po::value<int>(&arg.K)->default_value(128), "Inner dimension")
+        ("lda", po::value<int>(&arg.lda)->default_value(0), "Leading dimension of A (0: minimum)")
+        ("ldb", po::value<int>(&arg.ldb)->default_value(0), "Leading dimension of B (0: minimum)")
+        ("ldc", po::value<int>(&arg.ldc)->default_value(0), "Leading dimension of C (0: minimum)")
+        ("incx", po::value<int>(&arg.incx)->default_value(1), "Increment between values in x")
+        ("incy", po::value<int>(&arg.incy)->default_value(1), "Increment between values in y")
+        ("stride_scale", po::value<double>(&arg.stride_scale)->default_value(1.0),
+         "Scale applied to the minimum batch stride, for templates that take one")
+        ("alpha", po::value<double>(&arg.alpha)->default_value(1.0), "Real part of alpha")
+        ("alphai", po::value<double>(&arg.alphai)->default_value(0.0), "Imaginary part of alpha")
+        ("beta", po::value<double>(&arg.beta)->default_value(0.0), "Real part of beta")
+        ("betai", po::value<double>(&arg.betai)->default_value(0.0), "Imaginary part of beta")
+        ("transposeA", po::value<char>(&arg.transA_option)->default_value('N'), "N, T or C")
+        ("transposeB", po::value<char>(&arg.transB_option)->default_value('N'), "N, T or C")
+        ("side", po::value<char>(&arg.side_option)->default_value('L'), "L or R")
+        ("uplo", po::value<char>(&arg.uplo_option)->default_value('U'), "U or L, or F for lacpy")
+        ("diag", po::value<char>(&arg.diag_option)->default_value('N'), "U or N")
+        ("norm", po::value<char>(&arg.norm_option)->default_value('O'), "M, O, I or F")
+        ("pivot", po::value<char>(&arg.pivot_option)->default_value('V'), "V, T or B, for lasr")
+        ("direct", po::value<char>(&arg.direct_option)->default_value('F'), "F or B, for lasr")
+        ("batch_count", po::value<int>(&arg.batch_count)->default_value(1),
+         "Number of matrices in batched functions")
+        ("algo", po::value<int>(&arg.algo)->default_value(0),
+         "Algorithm or variant of the functions that have several (0: default); the "
+         "hipblasWeightFormat_t of gemm_quantized, the hipblasRequantMode_t of gemm_requant, "
+         "the epilogue of gemm_jit (1: relu, 2: adds i - 2 j)")
+        ("group_size", po::value<int>(&arg.group_size)->default_value(128),
+         "Rows of B per scale in gemm_quantized")
+        ("autotune", po::value<int>(&arg.autotune)->default_value(0),
+         "Trials of hipblasSetGemmAutotune for gemm_autotune (0: off)")
+        ("strassen_levels", po::value<int>(&arg.strassen_levels)->default_value(0),
+         "Levels of hipblasSetGemmStrassen for gemm_strassen (0: off)")
+        ("strassen_cutoff", po::value<int>(&arg.strassen_cutoff)->default_value(0),
+         "Smallest m, n and k a level of gemm_strassen applies to (0: the default)")
+        ("abft_mode", po::value<int>(&arg.abft_mode)->default_value(0),
+         "hipblasAbftMode_t of hipblasSetAbftMode for gemm_abft (0: off, 1: detect, 2: correct)")
+        ("cold_iters,j", po::value<int>(&arg.cold_iters)->default_value(2),
+         "Untimed warm-up calls before timing")
+        ("iters,i", po::value<int>(&arg.hot_iters)->default_value(10), "Timed calls")
+        ("verify,v", po::value<int>(&arg.unit_check)->default_value(0),
+         "Also check the result against CBLAS: 0 = no, 1 = yes")
+        ("device_init", po::value<int>(&arg.device_init)->default_value(0),
+         "Fill gemm inputs on the device, with no host copies, when verify is 0: 0 = no, 1 = yes")
+        ("flush", po::value<int>(&arg.flush)->default_value(0),
+         "Flush the device caches before every timed call, so each runs cold: 0 = no, 1 = yes");
+    // clang-format on
+
+    return desc;
+}
+
+// Runs of every case so far, for --json
+static std::vector<bench_result> bench_results;
+
+// --all_devices runs each case on every device at once; --slow_percent flags the slow ones
+static bool   all_devices  = false;
+static double slow_percent = 10.0;
+
+// --counters reads hardware counters over the timed launches of each case
+static bool counters = false;
+
+static int run_one(const std::string& function, char precision, Arguments arg)
+{
+    if(arg.hot_iters < 1 || arg.cold_iters < 0)
+    {
+        std::cerr << "hipblas-bench: iters must be at least 1 and cold_iters non-negative"
+                  << std::endl;
+        return -1;
+    }
+
+    if(counters && (all_devices || arg.flush))
+    {
+        std::cerr << "hipblas-bench: --counters cannot be used with --all_devices, which counts "
+                     "every device's threads at once, or with flush, whose writes it would count"
+                  << std::endl;
+        return -1;
+    }
+
+    hipblas_fill_leading_dimensions(arg);
+    arg.timing = 1;
+
+    std::string key = bench_result_key(function, precision, arg);
+    if(all_devices)
+    {
+        std::vector<hipblas_timing_result> results;
+        int                                flagged = bench_all_devices(
+            [&] { return run_bench(function, precision, arg); }, slow_percent, results);
+        for(const auto& result : results)
+            bench_results.push_back({key + " device=" + std::to_string(result.device), result});
+        return flagged ? -1 : 0;
+    }
+
+    hipblasStatus_t status = run_bench(function, precision, arg);
+
+    for(const auto& result : hipblas_take_timing_results())
+    {
+        if(result.timing.counters.collected)
+            bench_print_counters(std::cout, function, result);
+        bench_results.push_back({key, result});
+    }
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        std::cerr << "hipblas-bench: " << function << " precision " << precision
+                  << " failed with status " << status << std::endl;
+        return -1;
+    }
+    return 0;
+}
+
+/* =====================================================================
+      Main function:
+=================================================================== */
+
+int main(int argc, char* argv[])
+{
+    Arguments   arg;
+    std::string function;
+    char        precision;
+    std::string yaml;
+    std::string suites;
+    std::string json;
+    double      threshold;
+    int         device_id;
+
+    std::vector<std::string> compare;
+
+    po::options_description desc = bench_options(arg, function, precision);
+
+    // clang-format off
+    desc.add_options()
+        ("yaml", po::value<std::string>(&yaml), "Run every entry of a YAML case list; "
+         "entries override the command line")
+        ("suite", po::value<std::string>(&suites),
+         "Comma separated suites of the --yaml list to run, for example perf_production; "
+         "all when not given")
+        ("json", po::value<std::string>(&json),
+         "Also write the timed runs, with the device and library versions, to this JSON file")
+        ("compare", po::value<std::vector<std::string>>(&compare)->multitoken(),
+         "BASELINE CURRENT: compare two --json files instead of running anything, and fail "
+         "if a case got slower by more than the threshold and the noise")
+        ("threshold", po::value<double>(&threshold)->default_value(5.0),
+         "Slowdown in percent of the median time that --compare fails on")
+        ("device", po::value<int>(&device_id)->default_value(0), "Device to run on")
+        ("all_devices", po::bool_switch(&all_devices),
+         "Run each case on every visible device at once, one thread each, and report each "
+         "device and their sum")
+        ("slow_percent", po::value<double>(&slow_percent)->default_value(10.0),
+         "With --all_devices, flag and fail devices this many percent below the median")
+        ("counters", po::bool_switch(&counters),
+         "Also read occupancy, L2 hit rate, memory bytes and matrix core and VALU use over the "
+         "timed launches of each case, into the output and --json; needs a build configured "
+         "with BUILD_WITH_COUNTERS on ROCm")
+        ("threads", po::value<int>(&concurrency.max_threads)->default_value(16),
+         "Most host threads of function concurrency")
+        ("gemv_percent", po::value<int>(&concurrency.gemv_percent)->default_value(50),
+         "Share of gemv among the calls of function concurrency")
+        ("help,h", "produces this help message");
+    // clang-format on
+
+    po::variables_map vm;
+    try
+    {
+        po::store(po::parse_command_line(argc, argv, desc), vm);
+        po::notify(vm);
+    }
+    catch(const std::exception& e)
+    {
+        std::cerr << "hipblas-bench: " << e.what() << std::endl;
+        return -1;
+    }
+
+    if(vm.count("help"))
+    {
+        std::cout << desc << std::endl;
+        return 0;
+    }
+
+    if(!compare.empty())
+    {
+        if(compare.size() != 2)
+        {
+            std::cerr << "hipblas-bench: --compare takes a baseline and a current file"
+                      << std::endl;
+            return -1;
+        }
+        int regressions = bench_compare_results(compare[0], compare[1], threshold);
+        return regressions < 0 ? -1 : regressions > 0;
+    }
+
+    if(query_device_property() <= device_id)
+    {
+        std::cerr << "hipblas-bench: invalid device ID " << device_id << std::endl;
+        return -1;
+    }
+    set_device(device_id);
+
+    std::string counters_error;
+    if(counters && !bench_counters_enable(device_id, counters_error))
+    {
+        std::cerr << "hipblas-bench: --counters: " << counters_error << std::endl;
+        return -1;
+    }
+
+    // clocks, power and temperature before and after, so throttling shows up in the output
+    bench_environment env_start = bench_read_environment(device_id);
+    bench_print_environment(std::cout, "start", env_start);
+
+    int failures = 0;
+    if(yaml.empty())
+        failures = run_one(function, precision, arg) != 0;
+    else
+    {
+        // The command line provides the defaults for every entry
+        std::vector<hipblas_yaml_case> cases;
+        try
+        {
+            cases = hipblas_read_yaml_cases(yaml, suites, {"", function, precision, arg});
+        }
+        catch(const std::exception& e)
+        {
+            std::cerr << "hipblas-bench: " << e.what() << std::endl;
+            bench_counters_disable();
+            return -1;
+        }
+
+        for(const auto& c : cases)
+            failures += run_one(c.function, c.precision, c.arg) != 0;
+    }
+
+    bench_counters_disable();
+
+    bench_environment env_end = bench_read_environment(device_id);
+    bench_print_environment(std::cout, "end", env_end);
+
+    if(!json.empty() && !bench_write_results(json, bench_results, env_start, env_end))
+    {
+        std::cerr << "hipblas-bench: cannot write " << json << std::endl;
+        return -1;
+    }
+
+    return failures ? -1 : 0;
+}
@@ -0,0 +1,245 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "concurrency_scaling.hpp"
+#include "hipblas.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    typedef std::chrono::steady_clock clock_type;
+
+    // released once every thread has warmed up
+    struct start_gate
+    {
+        std::mutex              mutex;
+        std::condition_variable released;
+        int                     waiting;
+        clock_type::time_point  start;
+
+        explicit start_gate(int threads)
+            : waiting(threads)
+        {
+        }
+
+        void arrive_and_wait()
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            if(--waiting == 0)
+            {
+                start = clock_type::now();
+                released.notify_all();
+            }
+            else
+                released.wait(lock, [&] { return waiting == 0; });
+        }
+    };
+
+    // a thread's device buffers; gemm reads A and B and writes C, gemv reads A and x and writes y
+    struct thread_buffers
+    {
+        float *A = nullptr, *B = nullptr, *C = nullptr, *x = nullptr, *y = nullptr;
+
+        bool allocate(const Arguments& arg)
+        {
+            return hipMalloc(&A, size_t(arg.M) * arg.N * sizeof(float)) == hipSuccess
+                   && hipMalloc(&B, size_t(arg.N) * arg.K * sizeof(float)) == hipSuccess
+                   && hipMalloc(&C, size_t(arg.M) * arg.K * sizeof(float)) == hipSuccess
+                   && hipMalloc(&x, size_t(arg.N) * sizeof(float)) == hipSuccess
+                   && hipMalloc(&y, size_t(arg.M) * sizeof(float)) == hipSuccess
+                   && hipMemset(A, 0, size_t(arg.M) * arg.N * sizeof(float)) == hipSuccess
+                   && hipMemset(B, 0, size_t(arg.N) * arg.K * sizeof(float)) == hipSuccess
+                   && hipMemset(x, 0, size_t(arg.N) * sizeof(float)) == hipSuccess;
+        }
+
+        ~thread_buffers()
+        {
+            hipFree(A);
+            hipFree(B);
+            hipFree(C);
+            hipFree(x);
+            hipFree(y);
+        }
+    };
+
+    // call i of a thread is a gemv when the running share of gemv calls steps up at i
+    bool is_gemv(int i, int gemv_percent)
+    {
+        return (i + 1) * gemv_percent / 100 != i * gemv_percent / 100;
+    }
+
+    struct thread_result
+    {
+        hipblasStatus_t        status = HIPBLAS_STATUS_SUCCESS;
+        std::vector<double>    latency_us;
+        clock_type::time_point end;
+    };
+
+    void run_thread(const Arguments&           arg,
+                    const concurrency_options& options,
+                    int                        device,
+                    hipblasHandle_t            shared,
+                    start_gate&                gate,
+                    thread_result&             result)
+    {
+        hipStream_t     stream = nullptr;
+        hipblasHandle_t handle = shared;
+        thread_buffers  buffers;
+
+        hipblasStatus_t& status = result.status;
+        if(hipSetDevice(device) != hipSuccess || hipStreamCreate(&stream) != hipSuccess
+           || !buffers.allocate(arg))
+            status = HIPBLAS_STATUS_ALLOC_FAILED;
+        if(status == HIPBLAS_STATUS_SUCCESS && !shared)
+            status = hipblasCreate(&handle);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblasSetStream(handle, stream);
+
+        float alpha = 1.0f, beta = 0.0f;
+        auto  call  = [&](int i) {
+            if(is_gemv(i, options.gemv_percent))
+                return hipblasSgemv(handle,
+                                    HIPBLAS_OP_N,
+                                    arg.M,
+                                    arg.N,
+                                    &alpha,
+                                    buffers.A,
+                                    arg.M,
+                                    buffers.x,
+                                    1,
+                                    &beta,
+                                    buffers.y,
+                                    1);
+            return hipblasSgemm(handle,
+                                HIPBLAS_OP_N,
+                                HIPBLAS_OP_N,
+                                arg.M,
+                                arg.K,
+                                arg.N,
+                                &alpha,
+                                buffers.A,
+                                arg.M,
+                                buffers.B,
+                                arg.N,
+                                &beta,
+                                buffers.C,
+                                arg.M);
+        };
+        auto wait = [&] {
+            return hipStreamSynchronize(stream) == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                                              : HIPBLAS_STATUS_EXECUTION_FAILED;
+        };
+
+        for(int i = 0; i < arg.cold_iters && status == HIPBLAS_STATUS_SUCCESS; i++)
+            if((status = call(i)) == HIPBLAS_STATUS_SUCCESS)
+                status = wait();
+
+        // a thread that failed to set up still arrives, or the others would wait for it forever
+        gate.arrive_and_wait();
+
+        result.latency_us.reserve(arg.hot_iters);
+        for(int i = 0; i < arg.hot_iters && status == HIPBLAS_STATUS_SUCCESS; i++)
+        {
+            auto issue = clock_type::now();
+            if((status = call(i)) == HIPBLAS_STATUS_SUCCESS)
+                status = wait();
+            result.latency_us.push_back(
+                std::chrono::duration<double, std::micro>(clock_type::now() - issue).count());
+        }
+        result.end = clock_type::now();
+
+        if(!shared && handle)
+            hipblasDestroy(handle);
+        if(stream)
+            hipStreamDestroy(stream);
+    }
+
+    double percentile(std::vector<double>& sorted, double p)
+    {
+        size_t index = size_t(p * (sorted.size() - 1) + 0.5);
+        return sorted[std::min(index, sorted.size() - 1)];
+    }
+}
+
+hipblasStatus_t bench_concurrency_scaling(const Arguments& arg, const concurrency_options& options)
+{
+    if(arg.M < 1 || arg.N < 1 || arg.K < 1 || arg.hot_iters < 1 || arg.cold_iters < 0
+       || options.max_threads < 1 || options.gemv_percent < 0 || options.gemv_percent > 100)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    int device;
+    CHECK_HIP_ERROR(hipGetDevice(&device));
+
+    std::vector<int> thread_counts;
+    for(int k = 1; k < options.max_threads; k *= 2)
+        thread_counts.push_back(k);
+    thread_counts.push_back(options.max_threads);
+
+    std::cout << "mode,threads,M,N,K,gemv-percent,calls,calls-per-s,p50-us,p99-us" << std::endl;
+
+    for(int threads : thread_counts)
+    {
+        for(bool share : {false, true})
+        {
+            hipblasHandle_t shared = nullptr;
+            if(share)
+            {
+                hipblasStatus_t status = hipblasCreate(&shared);
+                if(status == HIPBLAS_STATUS_SUCCESS)
+                    status = hipblasSetThreadMode(shared, HIPBLAS_THREAD_MODE_PER_THREAD);
+                if(status != HIPBLAS_STATUS_SUCCESS)
+                {
+                    if(shared)
+                        hipblasDestroy(shared);
+                    return status;
+                }
+            }
+
+            start_gate                 gate(threads);
+            std::vector<thread_result> results(threads);
+            std::vector<std::thread>   pool;
+            for(int t = 0; t < threads; t++)
+                pool.emplace_back(run_thread,
+                                  std::cref(arg),
+                                  std::cref(options),
+                                  device,
+                                  shared,
+                                  std::ref(gate),
+                                  std::ref(results[t]));
+            for(auto& thread : pool)
+                thread.join();
+
+            if(shared)
+                hipblasDestroy(shared);
+
+            std::vector<double>    latency_us;
+            clock_type::time_point end = gate.start;
+            for(auto& result : results)
+            {
+                if(result.status != HIPBLAS_STATUS_SUCCESS)
+                    return result.status;
+                latency_us.insert(
+                    latency_us.end(), result.latency_us.begin(), result.latency_us.end());
+                end = std::max(end, result.end);
+            }
+            std::sort(latency_us.begin(), latency_us.end());
+
+            double seconds = std::chrono::duration<double>(end - gate.start).count();
+            std::cout << (share ? "shared" : "own") << ',' << threads << ',' << arg.M << ','
+                      << arg.N << ',' << arg.K << ',' << options.gemv_percent << ','
+                      << latency_us.size() << ',' << (seconds > 0 ? latency_us.size() / seconds : 0)
+                      << ',' << percentile(latency_us, 0.5) << ',' << percentile(latency_us, 0.99)
+                      << std::endl;
+        }
+    }
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,30 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef _CONCURRENCY_SCALING_HPP_
+#define _CONCURRENCY_SCALING_HPP_
+
+#include "utility.h"
+
+struct concurrency_options
+{
+    int max_threads  = 16; // K runs through the powers of 2 up to this, and this itself
+    int gemv_percent = 50; // share of the calls that are gemv rather than gemm
+};
+
+/*! \brief  Throughput and latency of K host threads making small float calls on one device,
+ *          for growing K.
+ *
+ *  Each thread runs its own stream and either its own handle or, in mode shared, one handle
+ *  set to HIPBLAS_THREAD_MODE_PER_THREAD. It makes arg.cold_iters untimed calls, waits for
+ *  every other thread, then makes arg.hot_iters timed calls: an M x N by N x K gemm or an
+ *  M x N gemv, mixed in the given share. Each call is waited for before the next, so its latency
+ *  runs from issue to completion. Writes one CSV row per K and mode with the calls per second
+ *  of all threads together and the p50 and p99 latency of a call; arg.hot_iters should be in
+ *  the hundreds for p99 to mean anything. */
+hipblasStatus_t bench_concurrency_scaling(const Arguments& arg, const concurrency_options& options);
+
+#endif
@@ -0,0 +1,109 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "ld_sweep.hpp"
+#include "device_init.h"
+#include "flops.h"
+#include "hipblas.hpp"
+#include <algorithm>
+#include <iostream>
+#include <vector>
+
+namespace
+{
+    const int SWEEP_STEP_BYTES = 16;
+    const int SWEEP_PAD_BYTES  = 1024;
+
+    // GFLOP/s of the gemm at leading dimension ld, or a negative value where it failed
+    template <typename T>
+    double ld_cell(hipblasHandle_t handle, const Arguments& arg, int ld)
+    {
+        int M = arg.M, N = arg.N, K = arg.K;
+
+        T *  dA = nullptr, *dB = nullptr, *dC = nullptr;
+        bool ok = hipMalloc(&dA, size_t(ld) * K * sizeof(T)) == hipSuccess
+                  && hipMalloc(&dB, size_t(ld) * N * sizeof(T)) == hipSuccess
+                  && hipMalloc(&dC, size_t(ld) * N * sizeof(T)) == hipSuccess
+                  && hipblas_init_device<T>(dA, M, K, ld) == hipSuccess
+                  && hipblas_init_device<T>(dB, K, N, ld) == hipSuccess;
+
+        T              alpha = T(1), beta = T(0);
+        hipblas_timing timing;
+        if(ok)
+            ok = hipblas_time_launches(handle, arg, timing, [&] {
+                     return hipblasGemm<T>(handle,
+                                           HIPBLAS_OP_N,
+                                           HIPBLAS_OP_N,
+                                           M,
+                                           N,
+                                           K,
+                                           &alpha,
+                                           dA,
+                                           ld,
+                                           dB,
+                                           ld,
+                                           &beta,
+                                           dC,
+                                           ld);
+                 })
+                 == HIPBLAS_STATUS_SUCCESS;
+
+        hipFree(dA);
+        hipFree(dB);
+        hipFree(dC);
+
+        if(!ok || timing.median_us <= 0)
+            return -1;
+        return gemm_gflop_count<T>(M, N, K) / timing.median_us * 1e6;
+    }
+}
+
+template <typename T>
+hipblasStatus_t bench_ld_sweep(const Arguments& arg)
+{
+    if(arg.M < 1 || arg.N < 1 || arg.K < 1)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipblasHandle_t handle;
+    hipblasStatus_t status = hipblasCreate(&handle);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    int rows    = std::max(arg.M, arg.K);
+    int advised = rows;
+    status      = hipblasGetOptimalLeadingDimension(handle, rows, sizeof(T), &advised);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblasDestroy(handle);
+        return status;
+    }
+
+    // Steps of whole elements, at least one
+    int              size = sizeof(T);
+    int              step = std::max(1, SWEEP_STEP_BYTES / size);
+    std::vector<int> lds;
+    for(int pad = 0; pad <= SWEEP_PAD_BYTES / size; pad += step)
+        lds.push_back(rows + pad);
+    if(std::find(lds.begin(), lds.end(), advised) == lds.end())
+        lds.push_back(advised);
+
+    std::cout << "ld,pad-bytes,advised,gemm GFLOP/s" << std::endl;
+    for(int ld : lds)
+    {
+        double gflops = ld_cell<T>(handle, arg, ld);
+        std::cout << ld << ',' << (ld - rows) * size << ',' << (ld == advised ? 1 : 0) << ',';
+        if(gflops >= 0)
+            std::cout << gflops;
+        std::cout << std::endl;
+    }
+
+    hipblasDestroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+// clang-format off
+template hipblasStatus_t bench_ld_sweep<float>(const Arguments&);
+template hipblasStatus_t bench_ld_sweep<double>(const Arguments&);
+// clang-format on
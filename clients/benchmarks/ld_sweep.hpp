@@ -0,0 +1,24 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef _LD_SWEEP_HPP_
+#define _LD_SWEEP_HPP_
+
+#include "utility.h"
+
+/*! \brief  Achieved GFLOP/s of an arg.M x arg.N x arg.K gemm with lda, ldb and ldc all set to
+ *          one leading dimension, swept from max(M, K) up by 16 bytes at a time to 1 KiB of
+ *          padding.
+ *
+ *  Writes a CSV row per leading dimension, marking the one hipblasGetOptimalLeadingDimension
+ *  advises for max(M, K) rows, which is timed too when it lies outside the sweep; falls far below
+ *  their neighbours are the memory-channel conflicts of that leading dimension. A cell is empty
+ *  where the call fails. Each row is timed like any other run, with arg.cold_iters and
+ *  arg.hot_iters. Precision is float or double. */
+template <typename T>
+hipblasStatus_t bench_ld_sweep(const Arguments& arg);
+
+#endif
@@ -0,0 +1,108 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "multi_device.hpp"
+#include <algorithm>
+#include <iostream>
+#include <streambuf>
+#include <thread>
+
+namespace
+{
+    // drops everything written to it, holding no state the threads could race on
+    struct null_buffer : std::streambuf
+    {
+        int overflow(int c) override
+        {
+            return traits_type::not_eof(c);
+        }
+    };
+
+    double median_of(std::vector<double> values)
+    {
+        if(values.empty())
+            return 0.0;
+        std::sort(values.begin(), values.end());
+        size_t mid = values.size() / 2;
+        return values.size() % 2 ? values[mid] : (values[mid - 1] + values[mid]) / 2;
+    }
+}
+
+int bench_all_devices(const std::function<hipblasStatus_t()>& run,
+                      double                                  slow_percent,
+                      std::vector<hipblas_timing_result>&     results)
+{
+    int devices = 0;
+    if(hipGetDeviceCount(&devices) != hipSuccess || devices < 1)
+    {
+        std::cerr << "hipblas-bench: no devices to run on" << std::endl;
+        return 1;
+    }
+
+    // runs already waiting to be taken are not any device's
+    hipblas_take_timing_results();
+
+    std::vector<hipblasStatus_t> status(devices, HIPBLAS_STATUS_SUCCESS);
+    {
+        null_buffer     discard;
+        std::streambuf* out = std::cout.rdbuf(&discard);
+
+        std::vector<std::thread> threads;
+        for(int d = 0; d < devices; d++)
+            threads.emplace_back([&, d] {
+                status[d] = hipSetDevice(d) == hipSuccess ? run() : HIPBLAS_STATUS_NOT_INITIALIZED;
+            });
+        for(auto& thread : threads)
+            thread.join();
+
+        std::cout.rdbuf(out);
+    }
+
+    std::vector<hipblas_timing_result> taken = hipblas_take_timing_results();
+    std::vector<double>                gflops(devices, 0.0), median_us(devices, 0.0);
+    std::vector<int>                   runs(devices, 0);
+    for(const auto& result : taken)
+    {
+        if(result.device < 0 || result.device >= devices)
+            continue;
+        gflops[result.device] += result.gflops;
+        median_us[result.device] += result.timing.median_us;
+        runs[result.device]++;
+    }
+
+    std::vector<double> finished;
+    for(int d = 0; d < devices; d++)
+    {
+        if(runs[d])
+        {
+            gflops[d] /= runs[d];
+            median_us[d] /= runs[d];
+        }
+        if(status[d] == HIPBLAS_STATUS_SUCCESS)
+            finished.push_back(gflops[d]);
+    }
+    double median = median_of(finished);
+
+    int    flagged = 0;
+    double total   = 0.0;
+    std::cout << "device,status,hipblas-Gflops,median-us,vs-median-%,flag" << std::endl;
+    for(int d = 0; d < devices; d++)
+    {
+        bool        failed = status[d] != HIPBLAS_STATUS_SUCCESS;
+        double      vs     = median > 0 ? 100.0 * (gflops[d] - median) / median : 0.0;
+        const char* flag   = failed ? "failed" : vs < -slow_percent ? "slow" : "";
+        flagged += *flag != '\0';
+        total += failed ? 0.0 : gflops[d];
+        std::cout << d << ',' << status[d] << ',' << gflops[d] << ',' << median_us[d] << ',' << vs
+                  << ',' << flag << std::endl;
+    }
+    std::cout << "all,," << total << ",,,";
+    if(flagged)
+        std::cout << flagged << " flagged";
+    std::cout << std::endl;
+
+    results.insert(results.end(), taken.begin(), taken.end());
+    return flagged;
+}
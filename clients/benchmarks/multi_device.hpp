@@ -0,0 +1,25 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef _MULTI_DEVICE_HPP_
+#define _MULTI_DEVICE_HPP_
+
+#include "utility.h"
+#include <functional>
+#include <vector>
+
+/*! \brief  Runs run on every visible device at once, one host thread each with the device made
+ *          current, and writes a CSV row per device and one for all of them together.
+ *
+ *  A device's GFLOP/s is the mean over the runs it timed. A device that fails, or whose GFLOP/s
+ *  is more than slow_percent below the median of the devices, is flagged in its row. What the
+ *  runs print themselves is discarded, since the threads would interleave it. The timed runs
+ *  are appended to results, and the number of flagged devices is returned. */
+int bench_all_devices(const std::function<hipblasStatus_t()>& run,
+                      double                                  slow_percent,
+                      std::vector<hipblas_timing_result>&     results);
+
+#endif
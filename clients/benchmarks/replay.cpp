@@ -0,0 +1,588 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <boost/program_options.hpp>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "hipblas.hpp"
+#include "utility.h"
+
+namespace po = boost::program_options;
+
+/* ============================================================================================ */
+/*  hipblas-replay: re-issue the calls of a trace recorded with HIPBLAS_LAYER=16 on synthetic
+ *  buffers of the recorded sizes. Each recorded handle and stream gets its own, calls wait for
+ *  the streams their recorded dependencies ran on, and with --timing the recorded host gaps
+ *  between calls are kept. The format is described in the library's call_record.cpp. */
+
+struct replay_arg
+{
+    uint8_t           kind; // INTEGER, REAL, POINTER or NAME, as in the library
+    int64_t           i       = 0;
+    double            d       = 0;
+    uint64_t          address = 0;
+    uint64_t          base    = 0;
+    uint64_t          size    = 0;
+    std::vector<char> payload;
+};
+
+struct replay_call
+{
+    uint32_t                function;
+    uint64_t                handle;
+    uint64_t                stream;
+    double                  host_us;
+    uint64_t                after;
+    std::vector<replay_arg> args;
+};
+
+enum : uint8_t
+{
+    REPLAY_INTEGER,
+    REPLAY_REAL,
+    REPLAY_POINTER,
+    REPLAY_NAME
+};
+
+template <typename T>
+static T read_value(std::istream& in)
+{
+    T value;
+    if(!in.read(reinterpret_cast<char*>(&value), sizeof(T)))
+        throw std::runtime_error("truncated trace");
+    return value;
+}
+
+// The whole trace; payloads are kept only when keep_data is set
+static void read_trace(const std::string&        path,
+                       bool                      keep_data,
+                       std::vector<std::string>& functions,
+                       std::vector<replay_call>& calls)
+{
+    std::ifstream in(path, std::ios::binary);
+    if(!in)
+        throw std::invalid_argument("cannot open " + path);
+
+    char magic[4];
+    if(!in.read(magic, 4) || std::memcmp(magic, "HBRC", 4) != 0)
+        throw std::invalid_argument(path + " is not a hipBLAS call trace");
+    if(read_value<uint32_t>(in) != 1)
+        throw std::invalid_argument(path + " has an unsupported version");
+
+    char tag;
+    while(in.get(tag))
+    {
+        if(tag == 'F')
+        {
+            uint32_t    id     = read_value<uint32_t>(in);
+            uint16_t    length = read_value<uint16_t>(in);
+            std::string name(length, '\0');
+            if(!in.read(&name[0], length))
+                throw std::runtime_error("truncated trace");
+            if(id >= functions.size())
+                functions.resize(id + 1);
+            functions[id] = name;
+            continue;
+        }
+        if(tag != 'C')
+            throw std::runtime_error("corrupt trace");
+
+        replay_call c;
+        c.function = read_value<uint32_t>(in);
+        (void)read_value<uint64_t>(in); // sequence, implied by the position
+        c.handle  = read_value<uint64_t>(in);
+        c.stream  = read_value<uint64_t>(in);
+        c.host_us = read_value<double>(in);
+        c.after   = read_value<uint64_t>(in);
+        c.args.resize(read_value<uint8_t>(in));
+        for(replay_arg& a : c.args)
+        {
+            a.kind = read_value<uint8_t>(in);
+            if(a.kind == REPLAY_REAL)
+                a.d = read_value<double>(in);
+            else if(a.kind != REPLAY_POINTER)
+                a.i = read_value<int64_t>(in);
+            else
+            {
+                a.address      = read_value<uint64_t>(in);
+                a.base         = read_value<uint64_t>(in);
+                a.size         = read_value<uint64_t>(in);
+                uint32_t bytes = read_value<uint32_t>(in);
+                if(keep_data || !a.base)
+                {
+                    a.payload.resize(bytes);
+                    if(!in.read(a.payload.data(), bytes))
+                        throw std::runtime_error("truncated trace");
+
+                    // Room for a scalar of any type when its size was recorded short
+                    if(!a.base && bytes && bytes < 16)
+                        a.payload.resize(16, 0);
+                }
+                else
+                    in.seekg(bytes, std::ios::cur);
+            }
+        }
+        calls.push_back(std::move(c));
+    }
+}
+
+/* ============================================================================================ */
+/*  The functions hipblas-replay can issue, by recorded name */
+
+// The arguments of one call with its pointers moved to the replay's buffers
+struct replay_args
+{
+    const std::vector<replay_arg>* args;
+    std::vector<void*>             pointers;
+
+    int i(int k) const
+    {
+        return int((*args)[k].i);
+    }
+
+    hipblasOperation_t op(int k) const
+    {
+        return hipblasOperation_t((*args)[k].i);
+    }
+
+    hipblasDatatype_t type(int k) const
+    {
+        return hipblasDatatype_t((*args)[k].i);
+    }
+
+    template <typename T = void>
+    T* p(int k) const
+    {
+        return static_cast<T*>(pointers[k]);
+    }
+};
+
+template <typename T>
+static hipblasStatus_t replay_axpy(hipblasHandle_t handle, const replay_args& a)
+{
+    return hipblasAxpy<T>(handle, a.i(1), a.p<T>(2), a.p<T>(3), a.i(4), a.p<T>(5), a.i(6));
+}
+
+template <typename T>
+static hipblasStatus_t replay_scal(hipblasHandle_t handle, const replay_args& a)
+{
+    return hipblasScal<T>(handle, a.i(1), a.p<T>(2), a.p<T>(3), a.i(4));
+}
+
+template <typename T>
+static hipblasStatus_t replay_dot(hipblasHandle_t handle, const replay_args& a)
+{
+    return hipblasDot<T>(handle, a.i(1), a.p<T>(2), a.i(3), a.p<T>(4), a.i(5), a.p<T>(6));
+}
+
+template <typename T>
+static hipblasStatus_t replay_dotc(hipblasHandle_t handle, const replay_args& a)
+{
+    return hipblasDotc<T>(handle, a.i(1), a.p<T>(2), a.i(3), a.p<T>(4), a.i(5), a.p<T>(6));
+}
+
+template <typename T>
+static hipblasStatus_t replay_gemv(hipblasHandle_t handle, const replay_args& a)
+{
+    return hipblasGemv<T>(handle,
+                          a.op(1),
+                          a.i(2),
+                          a.i(3),
+                          a.p<T>(4),
+                          a.p<T>(5),
+                          a.i(6),
+                          a.p<T>(7),
+                          a.i(8),
+                          a.p<T>(9),
+                          a.p<T>(10),
+                          a.i(11));
+}
+
+template <typename T>
+static hipblasStatus_t replay_gemm(hipblasHandle_t handle, const replay_args& a)
+{
+    return hipblasGemm<T>(handle,
+                          a.op(1),
+                          a.op(2),
+                          a.i(3),
+                          a.i(4),
+                          a.i(5),
+                          a.p<T>(6),
+                          a.p<T>(7),
+                          a.i(8),
+                          a.p<T>(9),
+                          a.i(10),
+                          a.p<T>(11),
+                          a.p<T>(12),
+                          a.i(13));
+}
+
+template <typename T>
+static hipblasStatus_t replay_gemm_strided_batched(hipblasHandle_t handle, const replay_args& a)
+{
+    return hipblasGemmStridedBatched<T>(handle,
+                                        a.op(1),
+                                        a.op(2),
+                                        a.i(3),
+                                        a.i(4),
+                                        a.i(5),
+                                        a.p<T>(6),
+                                        a.p<T>(7),
+                                        a.i(8),
+                                        a.i(9),
+                                        a.p<T>(10),
+                                        a.i(11),
+                                        a.i(12),
+                                        a.p<T>(13),
+                                        a.p<T>(14),
+                                        a.i(15),
+                                        a.i(16),
+                                        a.i(17));
+}
+
+static hipblasStatus_t replay_gemm_ex(hipblasHandle_t handle, const replay_args& a)
+{
+    return hipblasGemmEx(handle,
+                         a.op(1),
+                         a.op(2),
+                         a.i(3),
+                         a.i(4),
+                         a.i(5),
+                         a.p(6),
+                         a.p(7),
+                         a.type(8),
+                         a.i(9),
+                         a.p(10),
+                         a.type(11),
+                         a.i(12),
+                         a.p(13),
+                         a.p(14),
+                         a.type(15),
+                         a.i(16),
+                         a.type(17),
+                         hipblasGemmAlgo_t(a.i(18)));
+}
+
+static hipblasStatus_t replay_gemm_strided_batched_ex(hipblasHandle_t handle, const replay_args& a)
+{
+    return hipblasGemmStridedBatchedEx(handle,
+                                       a.op(1),
+                                       a.op(2),
+                                       a.i(3),
+                                       a.i(4),
+                                       a.i(5),
+                                       a.p(6),
+                                       a.p(7),
+                                       a.type(8),
+                                       a.i(9),
+                                       (*a.args)[10].i,
+                                       a.p(11),
+                                       a.type(12),
+                                       a.i(13),
+                                       (*a.args)[14].i,
+                                       a.p(15),
+                                       a.p(16),
+                                       a.type(17),
+                                       a.i(18),
+                                       (*a.args)[19].i,
+                                       a.i(20),
+                                       a.type(21),
+                                       hipblasGemmAlgo_t(a.i(22)));
+}
+
+struct replay_function
+{
+    const char* name;
+    size_t      count; // arguments, the handle included
+    hipblasStatus_t (*run)(hipblasHandle_t, const replay_args&);
+};
+
+// clang-format off
+static const replay_function replay_functions[] = {
+    {"hipblasSaxpy", 7, replay_axpy<float>},
+    {"hipblasDaxpy", 7, replay_axpy<double>},
+    {"hipblasCaxpy", 7, replay_axpy<hipblasComplex>},
+    {"hipblasZaxpy", 7, replay_axpy<hipblasDoubleComplex>},
+    {"hipblasSscal", 5, replay_scal<float>},
+    {"hipblasDscal", 5, replay_scal<double>},
+    {"hipblasCscal", 5, replay_scal<hipblasComplex>},
+    {"hipblasZscal", 5, replay_scal<hipblasDoubleComplex>},
+    {"hipblasSdot", 7, replay_dot<float>},
+    {"hipblasDdot", 7, replay_dot<double>},
+    {"hipblasCdotu", 7, replay_dot<hipblasComplex>},
+    {"hipblasZdotu", 7, replay_dot<hipblasDoubleComplex>},
+    {"hipblasCdotc", 7, replay_dotc<hipblasComplex>},
+    {"hipblasZdotc", 7, replay_dotc<hipblasDoubleComplex>},
+    {"hipblasSgemv", 12, replay_gemv<float>},
+    {"hipblasDgemv", 12, replay_gemv<double>},
+    {"hipblasCgemv", 12, replay_gemv<hipblasComplex>},
+    {"hipblasZgemv", 12, replay_gemv<hipblasDoubleComplex>},
+    {"hipblasSgemm", 14, replay_gemm<float>},
+    {"hipblasDgemm", 14, replay_gemm<double>},
+    {"hipblasCgemm", 14, replay_gemm<hipblasComplex>},
+    {"hipblasZgemm", 14, replay_gemm<hipblasDoubleComplex>},
+    {"hipblasSgemmStridedBatched", 18, replay_gemm_strided_batched<float>},
+    {"hipblasDgemmStridedBatched", 18, replay_gemm_strided_batched<double>},
+    {"hipblasCgemmStridedBatched", 18, replay_gemm_strided_batched<hipblasComplex>},
+    {"hipblasZgemmStridedBatched", 18, replay_gemm_strided_batched<hipblasDoubleComplex>},
+    {"hipblasGemmEx", 19, replay_gemm_ex},
+    {"hipblasGemmStridedBatchedEx", 23, replay_gemm_strided_batched_ex}};
+// clang-format on
+
+static const replay_function* find_function(const std::string& name)
+{
+    for(const replay_function& f : replay_functions)
+        if(name == f.name)
+            return &f;
+    return nullptr;
+}
+
+/* ============================================================================================ */
+/*  Handles, streams and buffers standing in for the recorded ones */
+
+class replay_state
+{
+public:
+    ~replay_state()
+    {
+        for(auto& it : handles)
+            hipblasDestroy(it.second);
+        for(auto& it : streams)
+        {
+            if(it.second.done)
+                (void)hipEventDestroy(it.second.done);
+            if(it.second.stream)
+                (void)hipStreamDestroy(it.second.stream);
+        }
+        for(auto& it : buffers)
+            (void)hipFree(it.second);
+    }
+
+    hipblasHandle_t handle(uint64_t recorded)
+    {
+        auto it = handles.find(recorded);
+        if(it != handles.end())
+            return it->second;
+
+        hipblasHandle_t h = nullptr;
+        if(hipblasCreate(&h) != HIPBLAS_STATUS_SUCCESS)
+            throw std::runtime_error("cannot create a handle");
+        handles[recorded] = h;
+        return h;
+    }
+
+    // The null stream stands for itself; the event is recorded after every call on the stream
+    struct lane
+    {
+        hipStream_t stream = nullptr;
+        hipEvent_t  done   = nullptr;
+        bool        used   = false;
+    };
+
+    lane& stream(uint64_t recorded)
+    {
+        auto it = streams.find(recorded);
+        if(it != streams.end())
+            return it->second;
+
+        lane l;
+        if((recorded && hipStreamCreateWithFlags(&l.stream, hipStreamNonBlocking) != hipSuccess)
+           || hipEventCreateWithFlags(&l.done, hipEventDisableTiming) != hipSuccess)
+            throw std::runtime_error("cannot create a stream");
+        return streams[recorded] = l;
+    }
+
+    // A zeroed buffer per recorded allocation
+    char* buffer(uint64_t base, uint64_t size)
+    {
+        auto it = buffers.find(base);
+        if(it != buffers.end())
+            return it->second;
+
+        void* p = nullptr;
+        if(hipMalloc(&p, size ? size : 1) != hipSuccess || hipMemset(p, 0, size) != hipSuccess)
+            throw std::runtime_error("cannot allocate " + std::to_string(size) + " bytes");
+        return buffers[base] = static_cast<char*>(p);
+    }
+
+private:
+    std::map<uint64_t, hipblasHandle_t> handles;
+    std::map<uint64_t, lane>            streams;
+    std::map<uint64_t, char*>           buffers;
+};
+
+// Issues one call; false when it cannot be replayed
+static bool replay_one(replay_state&                   state,
+                       const std::vector<replay_call>& calls,
+                       size_t                          index,
+                       const replay_function&          f,
+                       bool                            upload)
+{
+    const replay_call& c = calls[index];
+    if(c.args.size() != f.count)
+        return false;
+
+    hipblasHandle_t      handle = state.handle(c.handle);
+    replay_state::lane&  lane   = state.stream(c.stream);
+    replay_args          a;
+    hipblasPointerMode_t mode = HIPBLAS_POINTER_MODE_DEVICE;
+    a.args                    = &c.args;
+    a.pointers.resize(c.args.size(), nullptr);
+    for(size_t k = 1; k < c.args.size(); k++)
+    {
+        const replay_arg& arg = c.args[k];
+        if(arg.kind != REPLAY_POINTER || !arg.address)
+            continue;
+        if(arg.base)
+        {
+            a.pointers[k] = state.buffer(arg.base, arg.size) + (arg.address - arg.base);
+            continue;
+        }
+
+        // Host memory other than a scalar was not recorded
+        if(arg.payload.empty())
+            return false;
+        a.pointers[k] = const_cast<char*>(arg.payload.data());
+        mode          = HIPBLAS_POINTER_MODE_HOST;
+    }
+
+    if(hipblasSetStream(handle, lane.stream) != HIPBLAS_STATUS_SUCCESS
+       || hipblasSetPointerMode(handle, mode) != HIPBLAS_STATUS_SUCCESS)
+        return false;
+
+    if(c.after)
+    {
+        const replay_state::lane& before = state.stream(calls[c.after - 1].stream);
+        if(&before != &lane && before.used)
+            CHECK_HIP_ERROR(hipStreamWaitEvent(lane.stream, before.done, 0));
+    }
+
+    // The recorded contents, uploaded once the stream is idle so no earlier call still reads them
+    if(upload)
+    {
+        CHECK_HIP_ERROR(hipStreamSynchronize(lane.stream));
+        for(size_t k = 1; k < c.args.size(); k++)
+            if(c.args[k].base && !c.args[k].payload.empty())
+                CHECK_HIP_ERROR(hipMemcpy(a.pointers[k],
+                                          c.args[k].payload.data(),
+                                          c.args[k].payload.size(),
+                                          hipMemcpyHostToDevice));
+    }
+
+    if(f.run(handle, a) != HIPBLAS_STATUS_SUCCESS)
+        return false;
+    CHECK_HIP_ERROR(hipEventRecord(lane.done, lane.stream));
+    lane.used = true;
+    return true;
+}
+
+int main(int argc, char* argv[])
+{
+    std::string trace;
+    int         iters, device_id;
+    bool        timing = false, upload = false;
+
+    po::options_description desc("hipblas-replay command line options");
+
+    // clang-format off
+    desc.add_options()
+        ("trace", po::value<std::string>(&trace), "Trace written with HIPBLAS_LAYER=16")
+        ("timing", po::bool_switch(&timing),
+         "Keep the recorded host time between calls rather than issuing them back to back")
+        ("data", po::bool_switch(&upload),
+         "Upload the device memory recorded with HIPBLAS_LOG_RECORD_DATA=1 before each call; "
+         "reproduces results, not timings")
+        ("iters,i", po::value<int>(&iters)->default_value(1), "Times the trace is replayed")
+        ("device", po::value<int>(&device_id)->default_value(0), "Device to run on")
+        ("help,h", "produces this help message");
+    // clang-format on
+
+    po::positional_options_description positional;
+    positional.add("trace", 1);
+
+    std::vector<std::string> functions;
+    std::vector<replay_call> calls;
+    try
+    {
+        po::variables_map vm;
+        po::store(
+            po::command_line_parser(argc, argv).options(desc).positional(positional).run(), vm);
+        po::notify(vm);
+
+        if(vm.count("help") || trace.empty())
+        {
+            std::cout << desc << std::endl;
+            return trace.empty() && !vm.count("help") ? -1 : 0;
+        }
+        if(iters < 1)
+            throw std::invalid_argument("iters must be at least 1");
+
+        read_trace(trace, upload, functions, calls);
+    }
+    catch(const std::exception& e)
+    {
+        std::cerr << "hipblas-replay: " << e.what() << std::endl;
+        return -1;
+    }
+
+    if(query_device_property() <= device_id)
+    {
+        std::cerr << "hipblas-replay: invalid device ID " << device_id << std::endl;
+        return -1;
+    }
+    set_device(device_id);
+
+    std::map<std::string, size_t> skipped;
+    size_t                        replayed = 0;
+    double                        seconds  = 0;
+    try
+    {
+        replay_state state;
+        for(int iter = 0; iter < iters; iter++)
+        {
+            CHECK_HIP_ERROR(hipDeviceSynchronize());
+            auto start = std::chrono::steady_clock::now();
+            for(size_t index = 0; index < calls.size(); index++)
+            {
+                const replay_call& c    = calls[index];
+                const std::string& name = functions.at(c.function);
+                if(timing)
+                    std::this_thread::sleep_until(
+                        start + std::chrono::duration<double, std::micro>(c.host_us));
+
+                const replay_function* f = find_function(name);
+                if(f && replay_one(state, calls, index, *f, upload))
+                    replayed++;
+                else if(iter == 0)
+                    skipped[name]++;
+            }
+            CHECK_HIP_ERROR(hipDeviceSynchronize());
+            std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+            seconds += elapsed.count();
+        }
+    }
+    catch(const std::exception& e)
+    {
+        std::cerr << "hipblas-replay: " << e.what() << std::endl;
+        return -1;
+    }
+
+    std::cout << std::fixed << std::setprecision(3) << "calls: " << calls.size()
+              << ", replayed: " << replayed / iters << ", mean_ms: " << seconds * 1e3 / iters
+              << std::endl;
+    for(const auto& it : skipped)
+        std::cout << "skipped: " << it.first << " x" << it.second << std::endl;
+    return 0;
+}
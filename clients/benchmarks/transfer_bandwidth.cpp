@@ -0,0 +1,275 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "transfer_bandwidth.hpp"
+#include "bench_environment.hpp"
+#include "hipblas.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace
+{
+    const size_t VECTOR_BYTES[] = {size_t(4) << 10,
+                                   size_t(64) << 10,
+                                   size_t(1) << 20,
+                                   size_t(16) << 20,
+                                   size_t(64) << 20};
+    const int    VECTOR_INC[]   = {1, 2};
+    const int    MATRIX_N[]     = {64, 256, 1024, 4096};
+    const int    MATRIX_PAD[]   = {0, 32};
+    const int    BATCH_N[]      = {16, 64};
+    const size_t BATCH_BYTES    = size_t(16) << 20;
+
+    // theoretical rate of the PCIe link of the current device in GB/s, from sysfs, or 0 where it
+    // is not reported. Links of 8 GT/s and up encode 128 bits in 130, slower ones 8 in 10
+    double link_peak_gbyte_rate()
+    {
+        int device;
+        if(hipGetDevice(&device) != hipSuccess)
+            return 0.0;
+
+        std::string path = bench_pci_path(device);
+        if(path.empty())
+            return 0.0;
+        path += "/current_link_";
+
+        double gts   = 0.0;
+        int    width = 0;
+        FILE*  f     = fopen((path + "speed").c_str(), "r");
+        if(f)
+        {
+            if(fscanf(f, "%lf", &gts) != 1)
+                gts = 0.0;
+            fclose(f);
+        }
+        f = fopen((path + "width").c_str(), "r");
+        if(f)
+        {
+            if(fscanf(f, "%d", &width) != 1)
+                width = 0;
+            fclose(f);
+        }
+
+        double encoding = gts >= 8.0 ? 128.0 / 130.0 : 0.8;
+        return gts * width * encoding / 8.0;
+    }
+
+    // host memory of the sweep, pinned or pageable, zeroed so pageable pages are faulted in
+    // before any timing
+    struct host_buffer
+    {
+        bool  pinned;
+        char* data = nullptr;
+
+        host_buffer(size_t bytes, bool pinned)
+            : pinned(pinned)
+        {
+            if(pinned)
+            {
+                CHECK_HIP_ERROR(hipHostMalloc((void**)&data, bytes));
+            }
+            else
+                data = new char[bytes];
+            memset(data, 0, bytes);
+        }
+
+        ~host_buffer()
+        {
+            if(pinned)
+            {
+                CHECK_HIP_ERROR(hipHostFree(data));
+            }
+            else
+                delete[] data;
+        }
+    };
+
+    // median host time of one call in microseconds, or a negative value if a call failed
+    template <typename F>
+    double median_call_us(const Arguments& arg, F call)
+    {
+        for(int iter = 0; iter < arg.cold_iters; iter++)
+            if(call() != HIPBLAS_STATUS_SUCCESS)
+                return -1.0;
+
+        std::vector<double> times(arg.hot_iters);
+        for(auto& t : times)
+        {
+            double start = get_time_us();
+            if(call() != HIPBLAS_STATUS_SUCCESS)
+                return -1.0;
+            t = get_time_us() - start;
+        }
+        std::sort(times.begin(), times.end());
+        size_t mid = times.size() / 2;
+        return times.size() % 2 ? times[mid] : (times[mid - 1] + times[mid]) / 2;
+    }
+
+    struct transfer_row
+    {
+        const char* call;
+        bool        pinned;
+        int         rows;
+        int         cols;
+        int         batch_count;
+        int         host_ld; // incx of a vector, lda of a matrix
+    };
+
+    // returns false if the call failed
+    template <typename F>
+    bool print_row(
+        const Arguments& arg, const transfer_row& row, int elem_size, double peak, F call)
+    {
+        double us = median_call_us(arg, call);
+        if(us < 0)
+            return false;
+
+        double bytes  = double(row.rows) * row.cols * row.batch_count * elem_size;
+        double gbytes = us > 0 ? bytes / us / 1e3 : 0.0;
+        std::cout << row.call << ',' << (row.pinned ? "pinned" : "pageable") << ',' << row.rows
+                  << ',' << row.cols << ',' << row.batch_count << ',' << row.host_ld << ','
+                  << size_t(bytes) << ',' << us << ',' << gbytes << ','
+                  << (peak > 0 ? 100.0 * gbytes / peak : 0.0) << std::endl;
+        return true;
+    }
+}
+
+hipblasStatus_t bench_transfer_bandwidth(const Arguments& arg, int elem_size)
+{
+    if(elem_size < 1 || arg.hot_iters < 1 || arg.cold_iters < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipblasHandle_t handle;
+    hipblasStatus_t status = hipblasCreate(&handle);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    hipStream_t stream;
+    hipblasGetStream(handle, &stream);
+
+    double peak = link_peak_gbyte_rate();
+    bool   ok   = true;
+    std::cout << "call,host-memory,rows,cols,batch_count,host-inc-or-ld,bytes,median-us,GB/s,"
+                 "%link-peak"
+              << std::endl;
+
+    for(bool pinned : {true, false})
+    {
+        for(size_t vector_bytes : VECTOR_BYTES)
+        {
+            int   n = int(vector_bytes / elem_size);
+            void* dx;
+            CHECK_HIP_ERROR(hipMalloc(&dx, vector_bytes));
+            for(int incx : VECTOR_INC)
+            {
+                host_buffer hx(vector_bytes * incx, pinned);
+                ok &= print_row(arg, {"set_vector", pinned, n, 1, 1, incx}, elem_size, peak, [&] {
+                    return hipblasSetVector(n, elem_size, hx.data, incx, dx, 1);
+                });
+                ok &= print_row(arg, {"get_vector", pinned, n, 1, 1, incx}, elem_size, peak, [&] {
+                    return hipblasGetVector(n, elem_size, dx, 1, hx.data, incx);
+                });
+                ok &= print_row(
+                    arg, {"set_vector_async", pinned, n, 1, 1, incx}, elem_size, peak, [&] {
+                        return hipblasSetVectorAsync(n, elem_size, hx.data, incx, dx, 1, stream);
+                    });
+                ok &= print_row(
+                    arg, {"get_vector_async", pinned, n, 1, 1, incx}, elem_size, peak, [&] {
+                        return hipblasGetVectorAsync(n, elem_size, dx, 1, hx.data, incx, stream);
+                    });
+            }
+            CHECK_HIP_ERROR(hipFree(dx));
+        }
+
+        for(int n : MATRIX_N)
+        {
+            void* dA;
+            CHECK_HIP_ERROR(hipMalloc(&dA, size_t(n) * n * elem_size));
+            for(int pad : MATRIX_PAD)
+            {
+                int         lda = n + pad;
+                host_buffer hA(size_t(lda) * n * elem_size, pinned);
+                ok &= print_row(arg, {"set_matrix", pinned, n, n, 1, lda}, elem_size, peak, [&] {
+                    return hipblasSetMatrix(n, n, elem_size, hA.data, lda, dA, n);
+                });
+                ok &= print_row(arg, {"get_matrix", pinned, n, n, 1, lda}, elem_size, peak, [&] {
+                    return hipblasGetMatrix(n, n, elem_size, dA, n, hA.data, lda);
+                });
+                ok &= print_row(
+                    arg, {"set_matrix_async", pinned, n, n, 1, lda}, elem_size, peak, [&] {
+                        return hipblasSetMatrixAsync(
+                            n, n, elem_size, hA.data, lda, dA, n, stream);
+                    });
+                ok &= print_row(
+                    arg, {"get_matrix_async", pinned, n, n, 1, lda}, elem_size, peak, [&] {
+                        return hipblasGetMatrixAsync(
+                            n, n, elem_size, dA, n, hA.data, lda, stream);
+                    });
+            }
+            CHECK_HIP_ERROR(hipFree(dA));
+        }
+
+        for(int n : BATCH_N)
+        {
+            size_t      stride      = size_t(n) * n;
+            int         batch_count = int(BATCH_BYTES / (stride * elem_size));
+            char*       dA;
+            host_buffer hA(BATCH_BYTES, pinned);
+            CHECK_HIP_ERROR(hipMalloc(&dA, BATCH_BYTES));
+
+            std::vector<const void*> host_ptrs(batch_count), device_cptrs(batch_count);
+            std::vector<void*>       host_out(batch_count), device_ptrs(batch_count);
+            for(int b = 0; b < batch_count; b++)
+            {
+                host_out[b]     = hA.data + b * stride * elem_size;
+                device_ptrs[b]  = dA + b * stride * elem_size;
+                host_ptrs[b]    = host_out[b];
+                device_cptrs[b] = device_ptrs[b];
+            }
+
+            transfer_row row = {"set_matrix_strided_batched", pinned, n, n, batch_count, n};
+            ok &= print_row(arg, row, elem_size, peak, [&] {
+                return hipblasSetMatrixStridedBatched(
+                    handle, n, n, elem_size, hA.data, n, stride, dA, n, stride, batch_count);
+            });
+            row.call = "get_matrix_strided_batched";
+            ok &= print_row(arg, row, elem_size, peak, [&] {
+                return hipblasGetMatrixStridedBatched(
+                    handle, n, n, elem_size, dA, n, stride, hA.data, n, stride, batch_count);
+            });
+            row.call = "set_matrix_batched";
+            ok &= print_row(arg, row, elem_size, peak, [&] {
+                return hipblasSetMatrixBatched(handle,
+                                               n,
+                                               n,
+                                               elem_size,
+                                               host_ptrs.data(),
+                                               n,
+                                               device_ptrs.data(),
+                                               n,
+                                               batch_count);
+            });
+            row.call = "get_matrix_batched";
+            ok &= print_row(arg, row, elem_size, peak, [&] {
+                return hipblasGetMatrixBatched(handle,
+                                               n,
+                                               n,
+                                               elem_size,
+                                               device_cptrs.data(),
+                                               n,
+                                               host_out.data(),
+                                               n,
+                                               batch_count);
+            });
+            CHECK_HIP_ERROR(hipFree(dA));
+        }
+    }
+
+    hipblasDestroy(handle);
+    return ok ? HIPBLAS_STATUS_SUCCESS : HIPBLAS_STATUS_EXECUTION_FAILED;
+}
@@ -0,0 +1,25 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef _TRANSFER_BANDWIDTH_HPP_
+#define _TRANSFER_BANDWIDTH_HPP_
+
+#include "utility.h"
+
+/*! \brief  Achieved host to device and device to host rates of hipblasSet/GetVector,
+ *          hipblasSet/GetMatrix, their Async forms and hipblasSet/GetMatrix(Strided)Batched, from
+ *          pinned and from pageable host memory.
+ *
+ *  Vectors sweep 4 KiB to 64 MiB with incx 1 and 2 on the host; matrices sweep square orders 64
+ *  to 4096 with lda equal to the rows and padded by 32; the batched forms move 16 MiB of 16 x 16
+ *  and 64 x 64 matrices. The device side is always contiguous. Each row is the median of
+ *  arg.hot_iters calls after arg.cold_iters untimed ones, each call timed from issue until the
+ *  device is idle. GB/s counts the bytes of the elements moved, not of the strides skipped, and
+ *  is compared with the PCIe link of the device where the system reports it. elem_size is the
+ *  size in bytes of an element. */
+hipblasStatus_t bench_transfer_bandwidth(const Arguments& arg, int elem_size);
+
+#endif
@@ -0,0 +1,471 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <algorithm>
+#include <boost/program_options.hpp>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "hipblas.hpp"
+#include "hipblas_vector.hpp"
+#include "utility.h"
+
+namespace po = boost::program_options;
+
+/* ============================================================================================ */
+/*  hipblas-tune: time every candidate algo and solution of hipblasGemmExWithSolution for a list
+ *  of problems and write the fastest one per problem in the format hipblasCreate loads from
+ *  HIPBLAS_GEMM_TUNING_FILE. */
+
+struct tune_type
+{
+    const char*       name;
+    hipblasDatatype_t type;
+    size_t            size; // bytes per element, both parts for complex types
+    bool              complex;
+    double            tolerance; // relative to the largest magnitude of the reference result
+};
+
+static const tune_type tune_types[] = {{"f16_r", HIPBLAS_R_16F, 2, false, 1e-2},
+                                       {"f32_r", HIPBLAS_R_32F, 4, false, 1e-5},
+                                       {"f64_r", HIPBLAS_R_64F, 8, false, 1e-12},
+                                       {"f16_c", HIPBLAS_C_16F, 4, true, 1e-2},
+                                       {"f32_c", HIPBLAS_C_32F, 8, true, 1e-5},
+                                       {"f64_c", HIPBLAS_C_64F, 16, true, 1e-12},
+                                       {"bf16_r", HIPBLAS_R_16B, 2, false, 1e-2},
+                                       {"bf16_c", HIPBLAS_C_16B, 4, true, 1e-2},
+                                       {"i8_r", HIPBLAS_R_8I, 1, false, 0},
+                                       {"u8_r", HIPBLAS_R_8U, 1, false, 0},
+                                       {"i32_r", HIPBLAS_R_32I, 4, false, 0},
+                                       {"u32_r", HIPBLAS_R_32U, 4, false, 0}};
+
+static const tune_type& find_type(const std::string& name)
+{
+    for(const tune_type& t : tune_types)
+        if(name == t.name)
+            return t;
+    throw std::invalid_argument("unknown type " + name);
+}
+
+static const tune_type& find_type(hipblasDatatype_t type)
+{
+    for(const tune_type& t : tune_types)
+        if(type == t.type)
+            return t;
+    throw std::invalid_argument("unknown type");
+}
+
+// Element i of a buffer of type t, one real part at a time
+static void store_value(const tune_type& t, void* data, size_t i, double v)
+{
+    switch(t.type)
+    {
+    case HIPBLAS_R_16F:
+    case HIPBLAS_C_16F:
+        static_cast<hipblasHalf*>(data)[i] = float_to_half(float(v));
+        break;
+    case HIPBLAS_R_16B:
+    case HIPBLAS_C_16B:
+    {
+        float    f = float(v);
+        uint32_t bits;
+        std::memcpy(&bits, &f, sizeof(bits));
+        static_cast<uint16_t*>(data)[i] = uint16_t(bits >> 16);
+        break;
+    }
+    case HIPBLAS_R_32F:
+    case HIPBLAS_C_32F:
+        static_cast<float*>(data)[i] = float(v);
+        break;
+    case HIPBLAS_R_64F:
+    case HIPBLAS_C_64F:
+        static_cast<double*>(data)[i] = v;
+        break;
+    case HIPBLAS_R_8I:
+        static_cast<int8_t*>(data)[i] = int8_t(v);
+        break;
+    case HIPBLAS_R_8U:
+        static_cast<uint8_t*>(data)[i] = uint8_t(v);
+        break;
+    case HIPBLAS_R_32I:
+        static_cast<int32_t*>(data)[i] = int32_t(v);
+        break;
+    default:
+        static_cast<uint32_t*>(data)[i] = uint32_t(v);
+        break;
+    }
+}
+
+static double load_value(const tune_type& t, const void* data, size_t i)
+{
+    switch(t.type)
+    {
+    case HIPBLAS_R_16F:
+    case HIPBLAS_C_16F:
+        return half_to_float(static_cast<const hipblasHalf*>(data)[i]);
+    case HIPBLAS_R_16B:
+    case HIPBLAS_C_16B:
+    {
+        uint32_t bits = uint32_t(static_cast<const uint16_t*>(data)[i]) << 16;
+        float    f;
+        std::memcpy(&f, &bits, sizeof(f));
+        return f;
+    }
+    case HIPBLAS_R_32F:
+    case HIPBLAS_C_32F:
+        return static_cast<const float*>(data)[i];
+    case HIPBLAS_R_64F:
+    case HIPBLAS_C_64F:
+        return static_cast<const double*>(data)[i];
+    case HIPBLAS_R_8I:
+        return static_cast<const int8_t*>(data)[i];
+    case HIPBLAS_R_8U:
+        return static_cast<const uint8_t*>(data)[i];
+    case HIPBLAS_R_32I:
+        return static_cast<const int32_t*>(data)[i];
+    default:
+        return static_cast<const uint32_t*>(data)[i];
+    }
+}
+
+struct tune_problem
+{
+    char              transA, transB;
+    int               M, N, K;
+    hipblasDatatype_t a_type, b_type, c_type, compute_type;
+};
+
+struct tune_candidate
+{
+    hipblasGemmAlgo_t algo;
+    int32_t           solution_index;
+};
+
+static std::string algo_name(hipblasGemmAlgo_t algo)
+{
+    if(algo == HIPBLAS_GEMM_DEFAULT)
+        return "default";
+    if(algo == HIPBLAS_GEMM_DEFAULT_TENSOR_OP)
+        return "default_tensor_op";
+    if(algo >= HIPBLAS_GEMM_ALGO0_TENSOR_OP)
+        return "algo" + std::to_string(algo - HIPBLAS_GEMM_ALGO0_TENSOR_OP) + "_tensor_op";
+    return "algo" + std::to_string(algo - HIPBLAS_GEMM_ALGO0);
+}
+
+// cuBLAS selects kernels through algo and rocBLAS through the solution index; index 0 and the
+// default algo are the backend heuristic every other candidate is checked against
+static std::vector<tune_candidate> tune_candidates(int solutions)
+{
+    std::vector<tune_candidate> candidates = {{HIPBLAS_GEMM_DEFAULT, 0}};
+#ifdef __HIP_PLATFORM_NVCC__
+    candidates.push_back({HIPBLAS_GEMM_DEFAULT_TENSOR_OP, 0});
+    for(int i = HIPBLAS_GEMM_ALGO0; i <= HIPBLAS_GEMM_ALGO23; i++)
+        candidates.push_back({hipblasGemmAlgo_t(i), 0});
+    for(int i = HIPBLAS_GEMM_ALGO0_TENSOR_OP; i <= HIPBLAS_GEMM_ALGO15_TENSOR_OP; i++)
+        candidates.push_back({hipblasGemmAlgo_t(i), 0});
+#else
+    for(int i = 1; i <= solutions; i++)
+        candidates.push_back({HIPBLAS_GEMM_DEFAULT, i});
+#endif
+    return candidates;
+}
+
+static std::string tune_row(const tune_problem& p, const tune_candidate& c)
+{
+    std::ostringstream row;
+    row << p.transA << ',' << p.transB << ',' << p.M << ',' << p.N << ',' << p.K << ','
+        << find_type(p.a_type).name << ',' << find_type(p.b_type).name << ','
+        << find_type(p.c_type).name << ',' << find_type(p.compute_type).name << ','
+        << algo_name(c.algo) << ',' << c.solution_index;
+    return row.str();
+}
+
+/* ============================================================================================ */
+/*  one problem: A and B hold small integers, exact in every type, and C = A * B (alpha 1,
+ *  beta 0) so repeated launches leave C unchanged */
+
+static hipblasStatus_t tune_one(hipblasHandle_t                    handle,
+                                const tune_problem&                p,
+                                const std::vector<tune_candidate>& candidates,
+                                const Arguments&                   timing_arg,
+                                tune_candidate&                    best)
+{
+    hipblasOperation_t transA = char2hipblas_operation(p.transA);
+    hipblasOperation_t transB = char2hipblas_operation(p.transB);
+
+    int lda = std::max(1, transA == HIPBLAS_OP_N ? p.M : p.K);
+    int ldb = std::max(1, transB == HIPBLAS_OP_N ? p.K : p.N);
+    int ldc = std::max(1, p.M);
+
+    const tune_type& ta = find_type(p.a_type);
+    const tune_type& tb = find_type(p.b_type);
+    const tune_type& tc = find_type(p.c_type);
+    const tune_type& ts = find_type(p.compute_type);
+
+    size_t parts  = tc.complex ? 2 : 1;
+    size_t size_A = size_t(lda) * (transA == HIPBLAS_OP_N ? p.K : p.M) * parts;
+    size_t size_B = size_t(ldb) * (transB == HIPBLAS_OP_N ? p.N : p.K) * parts;
+    size_t size_C = size_t(ldc) * p.N * parts;
+
+    std::vector<char> hA(size_A * ta.size / parts), hB(size_B * tb.size / parts);
+    std::vector<char> hC_ref(size_C * tc.size / parts), hC(size_C * tc.size / parts);
+    std::vector<char> alpha(ts.size), beta(ts.size);
+
+    bool unsigned_data = p.a_type == HIPBLAS_R_8U || p.a_type == HIPBLAS_R_32U;
+    srand(1);
+    for(size_t i = 0; i < size_A; i++)
+        store_value(ta, hA.data(), i, unsigned_data ? rand() % 3 : rand() % 5 - 2);
+    for(size_t i = 0; i < size_B; i++)
+        store_value(tb, hB.data(), i, unsigned_data ? rand() % 3 : rand() % 5 - 2);
+    for(size_t i = 0; i < (ts.complex ? 2 : 1); i++)
+    {
+        store_value(ts, alpha.data(), i, i == 0 ? 1 : 0);
+        store_value(ts, beta.data(), i, 0);
+    }
+
+    device_vector<char> dA(hA.size()), dB(hB.size()), dC(hC.size());
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), hA.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB.data(), hB.size(), hipMemcpyHostToDevice));
+
+    auto run = [&](const tune_candidate& c) {
+        return hipblasGemmExWithSolution(handle,
+                                         transA,
+                                         transB,
+                                         p.M,
+                                         p.N,
+                                         p.K,
+                                         alpha.data(),
+                                         dA,
+                                         p.a_type,
+                                         lda,
+                                         dB,
+                                         p.b_type,
+                                         ldb,
+                                         beta.data(),
+                                         dC,
+                                         p.c_type,
+                                         ldc,
+                                         p.compute_type,
+                                         c.algo,
+                                         c.solution_index,
+                                         HIPBLAS_GEMM_FLAGS_NONE,
+                                         0,
+                                         nullptr);
+    };
+
+    double best_us = -1, ref_max = 0;
+    for(size_t c = 0; c < candidates.size(); c++)
+    {
+        // candidates this backend does not have for the problem are skipped
+        CHECK_HIP_ERROR(hipMemset(dC, 0, hC.size()));
+        if(run(candidates[c]) != HIPBLAS_STATUS_SUCCESS)
+        {
+            if(c == 0)
+                return HIPBLAS_STATUS_INVALID_VALUE;
+            continue;
+        }
+
+        CHECK_HIP_ERROR(hipMemcpy(hC.data(), dC, hC.size(), hipMemcpyDeviceToHost));
+        if(c == 0)
+        {
+            hC_ref = hC;
+            for(size_t i = 0; i < size_C; i++)
+                ref_max = std::max(ref_max, std::abs(load_value(tc, hC_ref.data(), i)));
+        }
+        else
+        {
+            // a solution that computes a different result for this shape is never chosen
+            double err = 0;
+            for(size_t i = 0; i < size_C; i++)
+                err = std::max(err,
+                               std::abs(load_value(tc, hC.data(), i)
+                                        - load_value(tc, hC_ref.data(), i)));
+            if(err > tc.tolerance * std::max(ref_max, 1.0))
+                continue;
+        }
+
+        hipblas_timing  timing;
+        hipblasStatus_t status
+            = hipblas_time_launches(handle, timing_arg, timing, [&] { return run(candidates[c]); });
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            continue;
+
+        if(best_us < 0 || timing.median_us < best_us)
+        {
+            best_us = timing.median_us;
+            best    = candidates[c];
+        }
+    }
+
+    std::cout << tune_row(p, best) << "  # " << best_us << " us" << std::endl;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+// transA,transB,m,n,k,a_type,b_type,c_type,compute_type; '#' starts a comment
+static bool parse_problem(const std::string& text, tune_problem& p)
+{
+    std::string line = text.substr(0, text.find('#'));
+    if(line.find_first_not_of(" \t\r") == std::string::npos)
+        return false;
+
+    std::vector<std::string> fields;
+    std::stringstream        stream(line);
+    std::string              field;
+    while(std::getline(stream, field, ','))
+    {
+        size_t b = field.find_first_not_of(" \t\r");
+        size_t e = field.find_last_not_of(" \t\r");
+        fields.push_back(b == std::string::npos ? std::string() : field.substr(b, e - b + 1));
+    }
+    if(fields.size() != 9 || fields[0].size() != 1 || fields[1].size() != 1)
+        throw std::invalid_argument("expected transA,transB,m,n,k,a_type,b_type,c_type,"
+                                    "compute_type: "
+                                    + text);
+
+    p.transA       = fields[0][0];
+    p.transB       = fields[1][0];
+    p.M            = std::stoi(fields[2]);
+    p.N            = std::stoi(fields[3]);
+    p.K            = std::stoi(fields[4]);
+    p.a_type       = find_type(fields[5]).type;
+    p.b_type       = find_type(fields[6]).type;
+    p.c_type       = find_type(fields[7]).type;
+    p.compute_type = find_type(fields[8]).type;
+    return true;
+}
+
+/* =====================================================================
+      Main function:
+=================================================================== */
+
+int main(int argc, char* argv[])
+{
+    Arguments   arg;
+    std::string problems, output, a_type, b_type, c_type, compute_type;
+    int         solutions, device_id;
+
+    tune_problem p;
+
+    po::options_description desc("hipblas-tune command line options");
+
+    // clang-format off
+    desc.add_options()
+        ("problems", po::value<std::string>(&problems),
+         "File with one transA,transB,m,n,k,a_type,b_type,c_type,compute_type per line; "
+         "overrides the single problem options")
+        ("sizem,m", po::value<int>(&p.M)->default_value(128), "Rows of A and C")
+        ("sizen,n", po::value<int>(&p.N)->default_value(128), "Columns of B and C")
+        ("sizek,k", po::value<int>(&p.K)->default_value(128), "Inner dimension")
+        ("transposeA", po::value<char>(&p.transA)->default_value('N'), "N, T or C")
+        ("transposeB", po::value<char>(&p.transB)->default_value('N'), "N, T or C")
+        ("a_type", po::value<std::string>(&a_type)->default_value("f32_r"), "Type of A")
+        ("b_type", po::value<std::string>(&b_type)->default_value("f32_r"), "Type of B")
+        ("c_type", po::value<std::string>(&c_type)->default_value("f32_r"), "Type of C")
+        ("compute_type", po::value<std::string>(&compute_type)->default_value("f32_r"),
+         "Type the products are accumulated in")
+        ("solutions", po::value<int>(&solutions)->default_value(64),
+         "rocBLAS solution indices 1 to solutions are tried after the heuristic")
+        ("output,o", po::value<std::string>(&output)->default_value("hipblas_gemm_tuning.csv"),
+         "Tuning file to write")
+        ("cold_iters,j", po::value<int>(&arg.cold_iters)->default_value(2),
+         "Untimed warm-up calls before timing each candidate")
+        ("iters,i", po::value<int>(&arg.hot_iters)->default_value(10), "Timed calls")
+        ("device", po::value<int>(&device_id)->default_value(0), "Device to run on")
+        ("help,h", "produces this help message");
+    // clang-format on
+
+    std::vector<tune_problem> list;
+    po::variables_map         vm;
+    try
+    {
+        po::store(po::parse_command_line(argc, argv, desc), vm);
+        po::notify(vm);
+
+        if(vm.count("help"))
+        {
+            std::cout << desc << std::endl;
+            return 0;
+        }
+
+        if(problems.empty())
+        {
+            p.a_type       = find_type(a_type).type;
+            p.b_type       = find_type(b_type).type;
+            p.c_type       = find_type(c_type).type;
+            p.compute_type = find_type(compute_type).type;
+            list.push_back(p);
+        }
+        else
+        {
+            std::ifstream file(problems);
+            if(!file)
+                throw std::invalid_argument("cannot open " + problems);
+            std::string line;
+            while(std::getline(file, line))
+                if(parse_problem(line, p))
+                    list.push_back(p);
+        }
+    }
+    catch(const std::exception& e)
+    {
+        std::cerr << "hipblas-tune: " << e.what() << std::endl;
+        return -1;
+    }
+
+    if(arg.hot_iters < 1 || arg.cold_iters < 0 || solutions < 0)
+    {
+        std::cerr << "hipblas-tune: iters must be at least 1, cold_iters and solutions "
+                     "non-negative"
+                  << std::endl;
+        return -1;
+    }
+
+    if(query_device_property() <= device_id)
+    {
+        std::cerr << "hipblas-tune: invalid device ID " << device_id << std::endl;
+        return -1;
+    }
+    set_device(device_id);
+
+    hipblasHandle_t handle;
+    hipblasCreate(&handle);
+
+    // the measurement must not be steered by a table loaded from the environment
+    hipblasSetGemmTuningFile(handle, nullptr);
+
+    std::vector<tune_candidate> candidates = tune_candidates(solutions);
+    std::vector<std::string>    rows;
+    int                         failures = 0;
+    for(const tune_problem& problem : list)
+    {
+        tune_candidate best = candidates[0];
+        if(tune_one(handle, problem, candidates, arg, best) != HIPBLAS_STATUS_SUCCESS)
+        {
+            std::cerr << "hipblas-tune: gemm_ex rejects " << tune_row(problem, best) << std::endl;
+            failures++;
+            continue;
+        }
+        rows.push_back(tune_row(problem, best));
+    }
+    hipblasDestroy(handle);
+
+    std::ofstream file(output);
+    if(!file)
+    {
+        std::cerr << "hipblas-tune: cannot write " << output << std::endl;
+        return -1;
+    }
+    file << "# transA,transB,m,n,k,a_type,b_type,c_type,compute_type,algo,solution_index\n";
+    for(const std::string& row : rows)
+        file << row << '\n';
+
+    return failures ? -1 : 0;
+}
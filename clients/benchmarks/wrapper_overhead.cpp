@@ -0,0 +1,276 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "wrapper_overhead.hpp"
+#include "hipblas.h"
+#include <iostream>
+#include <string>
+
+#ifdef __HIP_PLATFORM_NVCC__
+#include <cublas_v2.h>
+#else
+#include "rocblas.h"
+#ifdef __HIP_PLATFORM_SOLVER__
+#include "rocsolver.h"
+#endif
+#endif
+
+namespace
+{
+    constexpr int GEMM_N  = 4;
+    constexpr int GETRF_N = 4;
+
+#ifdef __HIP_PLATFORM_NVCC__
+    typedef cublasHandle_t backend_handle;
+
+    bool backend_create(backend_handle* handle, hipStream_t stream)
+    {
+        return cublasCreate(handle) == CUBLAS_STATUS_SUCCESS
+               && cublasSetStream(*handle, stream) == CUBLAS_STATUS_SUCCESS;
+    }
+
+    void backend_destroy(backend_handle handle)
+    {
+        cublasDestroy(handle);
+    }
+
+    bool backend_axpy(backend_handle handle, const float* alpha, const float* x, float* y)
+    {
+        return cublasSaxpy(handle, 1, alpha, x, 1, y, 1) == CUBLAS_STATUS_SUCCESS;
+    }
+
+    bool backend_gemm(backend_handle handle,
+                      const float*   alpha,
+                      const float*   A,
+                      const float*   B,
+                      const float*   beta,
+                      float*         C)
+    {
+        return cublasSgemm(handle,
+                           CUBLAS_OP_N,
+                           CUBLAS_OP_N,
+                           GEMM_N,
+                           GEMM_N,
+                           GEMM_N,
+                           alpha,
+                           A,
+                           GEMM_N,
+                           B,
+                           GEMM_N,
+                           beta,
+                           C,
+                           GEMM_N)
+               == CUBLAS_STATUS_SUCCESS;
+    }
+
+    // hipBLAS has no getrf on the cuBLAS backend
+    constexpr bool backend_has_getrf = false;
+
+    bool backend_getrf(backend_handle, float*, int*, int*)
+    {
+        return false;
+    }
+#else
+    typedef rocblas_handle backend_handle;
+
+    bool backend_create(backend_handle* handle, hipStream_t stream)
+    {
+        return rocblas_create_handle(handle) == rocblas_status_success
+               && rocblas_set_stream(*handle, stream) == rocblas_status_success;
+    }
+
+    void backend_destroy(backend_handle handle)
+    {
+        rocblas_destroy_handle(handle);
+    }
+
+    bool backend_axpy(backend_handle handle, const float* alpha, const float* x, float* y)
+    {
+        return rocblas_saxpy(handle, 1, alpha, x, 1, y, 1) == rocblas_status_success;
+    }
+
+    bool backend_gemm(backend_handle handle,
+                      const float*   alpha,
+                      const float*   A,
+                      const float*   B,
+                      const float*   beta,
+                      float*         C)
+    {
+        return rocblas_sgemm(handle,
+                             rocblas_operation_none,
+                             rocblas_operation_none,
+                             GEMM_N,
+                             GEMM_N,
+                             GEMM_N,
+                             alpha,
+                             A,
+                             GEMM_N,
+                             B,
+                             GEMM_N,
+                             beta,
+                             C,
+                             GEMM_N)
+               == rocblas_status_success;
+    }
+
+#ifdef __HIP_PLATFORM_SOLVER__
+    constexpr bool backend_has_getrf = true;
+
+    // hipblasSgetrf runs rocsolver in device pointer mode, so the direct call does too
+    bool backend_getrf(backend_handle handle, float* A, int* ipiv, int* info)
+    {
+        rocblas_set_pointer_mode(handle, rocblas_pointer_mode_device);
+        bool ok = rocsolver_sgetrf(handle, GETRF_N, GETRF_N, A, GETRF_N, ipiv, info)
+                  == rocblas_status_success;
+        rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host);
+        return ok;
+    }
+#else
+    constexpr bool backend_has_getrf = false;
+
+    bool backend_getrf(backend_handle, float*, int*, int*)
+    {
+        return false;
+    }
+#endif
+#endif
+
+    // host microseconds of hot calls of call after cold untimed ones, or -1 if a call failed;
+    // the device is idle before timing starts and is waited for after it ends
+    template <typename F>
+    double time_calls(const Arguments& arg, hipStream_t stream, F call)
+    {
+        for(int iter = 0; iter < arg.cold_iters; iter++)
+            if(!call())
+                return -1;
+        hipStreamSynchronize(stream);
+
+        bool   ok    = true;
+        double start = get_time_us();
+        for(int iter = 0; iter < arg.hot_iters && ok; iter++)
+            ok = call();
+        double elapsed = get_time_us() - start;
+
+        hipStreamSynchronize(stream);
+        return ok ? elapsed : -1;
+    }
+
+    void print_row(const char* call, const Arguments& arg, double hipblas_us, double backend_us)
+    {
+        double hipblas_ns = hipblas_us * 1000.0 / arg.hot_iters;
+        double backend_ns = backend_us * 1000.0 / arg.hot_iters;
+        std::cout << call << ',' << arg.hot_iters << ',' << hipblas_ns << ',' << backend_ns << ','
+                  << hipblas_ns - backend_ns << std::endl;
+    }
+}
+
+hipblasStatus_t bench_wrapper_overhead(const Arguments& arg)
+{
+    // both libraries issue to a stream of their own
+    hipStream_t stream;
+    CHECK_HIP_ERROR(hipStreamCreate(&stream));
+
+    hipblasHandle_t handle;
+    hipblasStatus_t status = hipblasCreate(&handle);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasSetStream(handle, stream);
+
+    backend_handle backend;
+    if(status == HIPBLAS_STATUS_SUCCESS && !backend_create(&backend, stream))
+        status = HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        CHECK_HIP_ERROR(hipStreamDestroy(stream));
+        return status;
+    }
+
+    // the identity, so getrf needs no pivoting and repeated factorizations leave it unchanged
+    float identity[GETRF_N * GETRF_N] = {};
+    for(int i = 0; i < GETRF_N; i++)
+        identity[i * GETRF_N + i] = 1.0f;
+
+    float *dx, *dy, *dA, *dB, *dC, *dLU;
+    int *  dipiv, *dinfo;
+    CHECK_HIP_ERROR(hipMalloc(&dx, sizeof(float)));
+    CHECK_HIP_ERROR(hipMalloc(&dy, sizeof(float)));
+    CHECK_HIP_ERROR(hipMalloc(&dA, GEMM_N * GEMM_N * sizeof(float)));
+    CHECK_HIP_ERROR(hipMalloc(&dB, GEMM_N * GEMM_N * sizeof(float)));
+    CHECK_HIP_ERROR(hipMalloc(&dC, GEMM_N * GEMM_N * sizeof(float)));
+    CHECK_HIP_ERROR(hipMalloc(&dLU, sizeof(identity)));
+    CHECK_HIP_ERROR(hipMalloc(&dipiv, GETRF_N * sizeof(int)));
+    CHECK_HIP_ERROR(hipMalloc(&dinfo, sizeof(int)));
+    CHECK_HIP_ERROR(hipMemset(dx, 0, sizeof(float)));
+    CHECK_HIP_ERROR(hipMemset(dy, 0, sizeof(float)));
+    CHECK_HIP_ERROR(hipMemset(dA, 0, GEMM_N * GEMM_N * sizeof(float)));
+    CHECK_HIP_ERROR(hipMemset(dB, 0, GEMM_N * GEMM_N * sizeof(float)));
+    CHECK_HIP_ERROR(hipMemcpy(dLU, identity, sizeof(identity), hipMemcpyHostToDevice));
+
+    float alpha = 1.0f, beta = 0.0f;
+
+    std::cout << "call,calls,hipblas-ns-per-call,backend-ns-per-call,overhead-ns-per-call"
+              << std::endl;
+
+    double hipblas_us = time_calls(arg, stream, [&] {
+        return hipblasSaxpy(handle, 1, &alpha, dx, 1, dy, 1) == HIPBLAS_STATUS_SUCCESS;
+    });
+    double backend_us
+        = time_calls(arg, stream, [&] { return backend_axpy(backend, &alpha, dx, dy); });
+    if(hipblas_us < 0 || backend_us < 0)
+        status = HIPBLAS_STATUS_EXECUTION_FAILED;
+    else
+        print_row("axpy_n1", arg, hipblas_us, backend_us);
+
+    hipblas_us = time_calls(arg, stream, [&] {
+        return hipblasSgemm(handle,
+                            HIPBLAS_OP_N,
+                            HIPBLAS_OP_N,
+                            GEMM_N,
+                            GEMM_N,
+                            GEMM_N,
+                            &alpha,
+                            dA,
+                            GEMM_N,
+                            dB,
+                            GEMM_N,
+                            &beta,
+                            dC,
+                            GEMM_N)
+               == HIPBLAS_STATUS_SUCCESS;
+    });
+    backend_us = time_calls(
+        arg, stream, [&] { return backend_gemm(backend, &alpha, dA, dB, &beta, dC); });
+    if(hipblas_us < 0 || backend_us < 0)
+        status = HIPBLAS_STATUS_EXECUTION_FAILED;
+    else
+        print_row("gemm_4x4", arg, hipblas_us, backend_us);
+
+    if(backend_has_getrf)
+    {
+        hipblas_us = time_calls(arg, stream, [&] {
+            return hipblasSgetrf(handle, GETRF_N, dLU, GETRF_N, dipiv, dinfo)
+                   == HIPBLAS_STATUS_SUCCESS;
+        });
+        backend_us = time_calls(
+            arg, stream, [&] { return backend_getrf(backend, dLU, dipiv, dinfo); });
+        if(hipblas_us < 0 || backend_us < 0)
+            status = HIPBLAS_STATUS_EXECUTION_FAILED;
+        else
+            print_row("getrf_4x4", arg, hipblas_us, backend_us);
+    }
+
+    CHECK_HIP_ERROR(hipFree(dx));
+    CHECK_HIP_ERROR(hipFree(dy));
+    CHECK_HIP_ERROR(hipFree(dA));
+    CHECK_HIP_ERROR(hipFree(dB));
+    CHECK_HIP_ERROR(hipFree(dC));
+    CHECK_HIP_ERROR(hipFree(dLU));
+    CHECK_HIP_ERROR(hipFree(dipiv));
+    CHECK_HIP_ERROR(hipFree(dinfo));
+
+    backend_destroy(backend);
+    hipblasDestroy(handle);
+    CHECK_HIP_ERROR(hipStreamDestroy(stream));
+    return status;
+}
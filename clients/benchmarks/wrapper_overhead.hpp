@@ -0,0 +1,23 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef _WRAPPER_OVERHEAD_HPP_
+#define _WRAPPER_OVERHEAD_HPP_
+
+#include "utility.h"
+
+/*! \brief  Host time per call of tiny float calls, an n = 1 axpy, a 4 x 4 gemm and, where the
+ *          backend has a solver, a 4 x 4 getrf, made through hipBLAS and straight through the
+ *          backend library from the same process.
+ *
+ *  Each call is made arg.cold_iters times untimed and then arg.hot_iters times back to back,
+ *  and only the host time of issuing them is measured, so the difference per call is what the
+ *  hipBLAS layer adds: argument and enum conversion, pointer mode switching and status
+ *  mapping. hot_iters should stay below the depth of the device queue, or issuing waits for
+ *  the device and the host times grow alike. Writes one CSV row per call. */
+hipblasStatus_t bench_wrapper_overhead(const Arguments& arg);
+
+#endif
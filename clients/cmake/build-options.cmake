@@ -13,3 +13,12 @@ if( NOT BUILD_CLIENTS_TESTS )
   option( BUILD_CLIENTS_TESTS "Build hipBLAS unit tests" OFF )
 endif( )
 
+
+if( NOT BUILD_CLIENTS_BENCHMARKS )
+  option( BUILD_CLIENTS_BENCHMARKS "Build hipBLAS benchmarks" OFF )
+endif( )
+
+# CPU BLAS the tests and benchmarks check against: the netlib cblas and lapack built by
+# deps/external-lapack.cmake, or a faster OpenBLAS, BLIS or MKL installed on the system
+set( HIPBLAS_REFERENCE_BLAS "lapack" CACHE STRING "Reference BLAS for the clients: lapack, openblas, blis or mkl" )
+set_property( CACHE HIPBLAS_REFERENCE_BLAS PROPERTY STRINGS lapack openblas blis mkl )
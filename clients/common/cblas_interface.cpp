@@ -4,10 +4,17 @@
  * ************************************************************************/
 
 #include "cblas_interface.h"
+// MKL names its cblas header differently; the other reference BLAS all ship cblas.h
+#ifdef HIPBLAS_REFERENCE_MKL
+#include "mkl_cblas.h"
+#else
 #include "cblas.h"
+#endif
 #include "hipblas.h"
 #include "utility.h"
 #include <cmath>
+#include <cstring>
+#include <immintrin.h>
 #include <memory>
 #include <typeinfo>
 
@@ -53,6 +60,23 @@ void zgetrs_(char*                 trans,
              int*                  ldb,
              int*                  info);
 
+void sgetri_(int* n, float* A, int* lda, int* ipiv, float* work, int* lwork, int* info);
+void dgetri_(int* n, double* A, int* lda, int* ipiv, double* work, int* lwork, int* info);
+void cgetri_(int*            n,
+             hipblasComplex* A,
+             int*            lda,
+             int*            ipiv,
+             hipblasComplex* work,
+             int*            lwork,
+             int*            info);
+void zgetri_(int*                  n,
+             hipblasDoubleComplex* A,
+             int*                  lda,
+             int*                  ipiv,
+             hipblasDoubleComplex* work,
+             int*                  lwork,
+             int*                  info);
+
 void sgeqrf_(int* m, int* n, float* A, int* lda, float* tau, float* work, int* lwork, int* info);
 void dgeqrf_(int* m, int* n, double* A, int* lda, double* tau, double* work, int* lwork, int* info);
 void cgeqrf_(int*            m,
@@ -77,6 +101,25 @@ void dpotrf_(char* uplo, int* m, double* A, int* lda, int* info);
 void cpotrf_(char* uplo, int* m, hipblasComplex* A, int* lda, int* info);
 void zpotrf_(char* uplo, int* m, hipblasDoubleComplex* A, int* lda, int* info);
 
+void spotrs_(char* uplo, int* n, int* nrhs, float* A, int* lda, float* B, int* ldb, int* info);
+void dpotrs_(char* uplo, int* n, int* nrhs, double* A, int* lda, double* B, int* ldb, int* info);
+void cpotrs_(char*           uplo,
+             int*            n,
+             int*            nrhs,
+             hipblasComplex* A,
+             int*            lda,
+             hipblasComplex* B,
+             int*            ldb,
+             int*            info);
+void zpotrs_(char*                 uplo,
+             int*                  n,
+             int*                  nrhs,
+             hipblasDoubleComplex* A,
+             int*                  lda,
+             hipblasDoubleComplex* B,
+             int*                  ldb,
+             int*                  info);
+
 void cspr_(
     char* uplo, int* n, hipblasComplex* alpha, hipblasComplex* x, int* incx, hipblasComplex* A);
 
@@ -124,40 +167,164 @@ void zsymv_(char*                 uplo,
             hipblasDoubleComplex* y,
             int*                  incy);
 
+void slasr_(
+    char* side, char* pivot, char* direct, int* m, int* n, float* c, float* s, float* A, int* lda);
+void dlasr_(char*   side,
+            char*   pivot,
+            char*   direct,
+            int*    m,
+            int*    n,
+            double* c,
+            double* s,
+            double* A,
+            int*    lda);
+void clasr_(char*           side,
+            char*           pivot,
+            char*           direct,
+            int*            m,
+            int*            n,
+            float*          c,
+            float*          s,
+            hipblasComplex* A,
+            int*            lda);
+void zlasr_(char*                 side,
+            char*                 pivot,
+            char*                 direct,
+            int*                  m,
+            int*                  n,
+            double*               c,
+            double*               s,
+            hipblasDoubleComplex* A,
+            int*                  lda);
+
 #ifdef __cplusplus
 }
 #endif
 
 /*
  * ===========================================================================
- *    level 1 BLAS
+ *    16 bit reference helpers
  * ===========================================================================
  */
 
-// axpy
-template <>
-void cblas_axpy<hipblasHalf>(
-    int n, const hipblasHalf alpha, const hipblasHalf* x, int incx, hipblasHalf* y, int incy)
+// The 16 bit references run in float. Their operands are widened into per-thread scratch that is
+// kept between calls, and contiguous runs convert eight elements at a time with F16C
+namespace
 {
-    size_t        abs_incx = incx >= 0 ? incx : -incx;
-    size_t        abs_incy = incy >= 0 ? incy : -incy;
-    vector<float> x_float(n * abs_incx);
-    vector<float> y_float(n * abs_incy);
+    enum scratch_slot
+    {
+        SCRATCH_A,
+        SCRATCH_B,
+        SCRATCH_C,
+        SCRATCH_SLOTS
+    };
+
+    float* float_scratch(scratch_slot slot, size_t size)
+    {
+        thread_local vector<float> scratch[SCRATCH_SLOTS];
+        if(scratch[slot].size() < size)
+            scratch[slot].resize(size);
+        return scratch[slot].data();
+    }
+
+    // elements of a vector of n with increment inc, which a float copy must hold
+    size_t strided_span(int n, int inc)
+    {
+        return n > 0 ? size_t(n - 1) * (inc >= 0 ? inc : -inc) + 1 : 0;
+    }
+
+    void to_float(const hipblasHalf* src, float* dst, size_t size)
+    {
+        size_t i = 0;
+#ifdef __F16C__
+        for(; i + 8 <= size; i += 8)
+            _mm256_storeu_ps(dst + i,
+                             _mm256_cvtph_ps(_mm_loadu_si128((const __m128i*)(src + i))));
+#endif
+        for(; i < size; i++)
+            dst[i] = half_to_float(src[i]);
+    }
+
+    void from_float(const float* src, hipblasHalf* dst, size_t size)
+    {
+        size_t i = 0;
+#ifdef __F16C__
+        for(; i + 8 <= size; i += 8)
+            _mm_storeu_si128((__m128i*)(dst + i),
+                             _mm256_cvtps_ph(_mm256_loadu_ps(src + i), _MM_FROUND_TO_NEAREST_INT));
+#endif
+        for(; i < size; i++)
+            dst[i] = float_to_half(src[i]);
+    }
+
+    // bfloat16 is the top half of a float. These loops are branch free so the compiler
+    // vectorizes them, and they round exactly as bfloat16_to_float and float_to_bfloat16 do
+    void to_float(const hipblasBfloat16* src, float* dst, size_t size)
+    {
+        for(size_t i = 0; i < size; i++)
+        {
+            uint32_t u = uint32_t(src[i].data) << 16;
+            std::memcpy(dst + i, &u, sizeof(u));
+        }
+    }
 
-    for(size_t i = 0; i < n; i++)
+    void from_float(const float* src, hipblasBfloat16* dst, size_t size)
     {
-        x_float[i * abs_incx] = half_to_float(x[i * abs_incx]);
-        y_float[i * abs_incy] = half_to_float(y[i * abs_incy]);
+        for(size_t i = 0; i < size; i++)
+        {
+            uint32_t u;
+            std::memcpy(&u, src + i, sizeof(u));
+            uint32_t rounded = u + 0x7fff + ((u >> 16) & 1);
+            uint32_t nan     = u | ((u & 0xffff) ? 0x10000 : 0);
+            dst[i].data      = uint16_t(((~u & 0x7f800000) ? rounded : nan) >> 16);
+        }
     }
 
-    cblas_saxpy(n, half_to_float(alpha), x_float.data(), incx, y_float.data(), incy);
+    // the float copy of a strided 16 bit vector, laid out like the original
+    template <typename T>
+    float* to_float_scratch(scratch_slot slot, const T* x, int n, int inc)
+    {
+        size_t span    = strided_span(n, inc);
+        float* x_float = float_scratch(slot, span);
+        if(inc == 1 || inc == -1)
+            to_float(x, x_float, span);
+        else
+            for(size_t i = 0; i < span; i += (inc >= 0 ? inc : -inc))
+                to_float(x + i, x_float + i, 1);
+        return x_float;
+    }
 
-    for(size_t i = 0; i < n; i++)
+    template <typename T>
+    void from_float_strided(const float* x_float, T* x, int n, int inc)
     {
-        y[i * abs_incx] = float_to_half(y_float[i * abs_incx]);
+        size_t span = strided_span(n, inc);
+        if(inc == 1 || inc == -1)
+            from_float(x_float, x, span);
+        else
+            for(size_t i = 0; i < span; i += (inc >= 0 ? inc : -inc))
+                from_float(x_float + i, x + i, 1);
     }
 }
 
+/*
+ * ===========================================================================
+ *    level 1 BLAS
+ * ===========================================================================
+ */
+
+// axpy
+template <>
+void cblas_axpy<hipblasHalf>(
+    int n, const hipblasHalf alpha, const hipblasHalf* x, int incx, hipblasHalf* y, int incy)
+{
+    float* x_float = to_float_scratch(SCRATCH_A, x, n, incx);
+    float* y_float = to_float_scratch(SCRATCH_B, y, n, incy);
+
+    cblas_saxpy(n, half_to_float(alpha), x_float, incx, y_float, incy);
+
+    from_float_strided(y_float, y, n, incy);
+}
+
 template <>
 void cblas_axpy<float>(int n, const float alpha, const float* x, int incx, float* y, int incy)
 {
@@ -292,17 +459,9 @@ template <>
 void cblas_dot<hipblasHalf>(
     int n, const hipblasHalf* x, int incx, const hipblasHalf* y, int incy, hipblasHalf* result)
 {
-    size_t        abs_incx = incx >= 0 ? incx : -incx;
-    size_t        abs_incy = incy >= 0 ? incy : -incy;
-    vector<float> x_float(n * abs_incx);
-    vector<float> y_float(n * abs_incy);
-
-    for(size_t i = 0; i < n; i++)
-    {
-        x_float[i * abs_incx] = half_to_float(x[i * abs_incx]);
-        y_float[i * abs_incy] = half_to_float(y[i * abs_incy]);
-    }
-    *result = float_to_half(cblas_sdot(n, x_float.data(), incx, y_float.data(), incy));
+    float* x_float = to_float_scratch(SCRATCH_A, x, n, incx);
+    float* y_float = to_float_scratch(SCRATCH_B, y, n, incy);
+    *result        = float_to_half(cblas_sdot(n, x_float, incx, y_float, incy));
 }
 
 template <>
@@ -313,17 +472,9 @@ void cblas_dot<hipblasBfloat16>(int                    n,
                                 int                    incy,
                                 hipblasBfloat16*       result)
 {
-    size_t        abs_incx = incx >= 0 ? incx : -incx;
-    size_t        abs_incy = incy >= 0 ? incy : -incy;
-    vector<float> x_float(n * abs_incx);
-    vector<float> y_float(n * abs_incy);
-
-    for(size_t i = 0; i < n; i++)
-    {
-        x_float[i * abs_incx] = bfloat16_to_float(x[i * abs_incx]);
-        y_float[i * abs_incy] = bfloat16_to_float(y[i * abs_incy]);
-    }
-    *result = float_to_bfloat16(cblas_sdot(n, x_float.data(), incx, y_float.data(), incy));
+    float* x_float = to_float_scratch(SCRATCH_A, x, n, incx);
+    float* y_float = to_float_scratch(SCRATCH_B, y, n, incy);
+    *result        = float_to_bfloat16(cblas_sdot(n, x_float, incx, y_float, incy));
 }
 
 template <>
@@ -1455,6 +1606,41 @@ int cblas_potrf(char uplo, int m, hipblasDoubleComplex* A, int lda)
     return info;
 }
 
+// potrs
+template <>
+int cblas_potrs(char uplo, int n, int nrhs, float* A, int lda, float* B, int ldb)
+{
+    int info;
+    spotrs_(&uplo, &n, &nrhs, A, &lda, B, &ldb, &info);
+    return info;
+}
+
+template <>
+int cblas_potrs(char uplo, int n, int nrhs, double* A, int lda, double* B, int ldb)
+{
+    int info;
+    dpotrs_(&uplo, &n, &nrhs, A, &lda, B, &ldb, &info);
+    return info;
+}
+
+template <>
+int cblas_potrs(
+    char uplo, int n, int nrhs, hipblasComplex* A, int lda, hipblasComplex* B, int ldb)
+{
+    int info;
+    cpotrs_(&uplo, &n, &nrhs, A, &lda, B, &ldb, &info);
+    return info;
+}
+
+template <>
+int cblas_potrs(
+    char uplo, int n, int nrhs, hipblasDoubleComplex* A, int lda, hipblasDoubleComplex* B, int ldb)
+{
+    int info;
+    zpotrs_(&uplo, &n, &nrhs, A, &lda, B, &ldb, &info);
+    return info;
+}
+
 // tbmv
 template <>
 void cblas_tbmv<float>(hipblasFillMode_t  uplo,
@@ -1859,22 +2045,12 @@ void cblas_gemm<hipblasHalf>(hipblasOperation_t transA,
     int sizeB = transB == HIPBLAS_OP_N ? n * ldb : k * ldb;
     int sizeC = n * ldc;
 
-    std::unique_ptr<float[]> A_float(new float[sizeA]());
-    std::unique_ptr<float[]> B_float(new float[sizeB]());
-    std::unique_ptr<float[]> C_float(new float[sizeC]());
-
-    for(int i = 0; i < sizeA; i++)
-    {
-        A_float[i] = half_to_float(A[i]);
-    }
-    for(int i = 0; i < sizeB; i++)
-    {
-        B_float[i] = half_to_float(B[i]);
-    }
-    for(int i = 0; i < sizeC; i++)
-    {
-        C_float[i] = half_to_float(C[i]);
-    }
+    float* A_float = float_scratch(SCRATCH_A, sizeA);
+    float* B_float = float_scratch(SCRATCH_B, sizeB);
+    float* C_float = float_scratch(SCRATCH_C, sizeC);
+    to_float(A, A_float, sizeA);
+    to_float(B, B_float, sizeB);
+    to_float(C, C_float, sizeC);
 
     // just directly cast, since transA, transB are integers in the enum
     // printf("transA: rocblas =%d, cblas=%d\n", transA, (CBLAS_TRANSPOSE)transA );
@@ -1885,18 +2061,15 @@ void cblas_gemm<hipblasHalf>(hipblasOperation_t transA,
                 n,
                 k,
                 alpha_float,
-                const_cast<const float*>(A_float.get()),
+                A_float,
                 lda,
-                const_cast<const float*>(B_float.get()),
+                B_float,
                 ldb,
                 beta_float,
-                static_cast<float*>(C_float.get()),
+                C_float,
                 ldc);
 
-    for(int i = 0; i < sizeC; i++)
-    {
-        C[i] = float_to_half(C_float[i]);
-    }
+    from_float(C_float, C, sizeC);
 }
 
 template <>
@@ -2026,6 +2199,65 @@ void cblas_gemm<hipblasDoubleComplex>(hipblasOperation_t    transA,
                 ldc);
 }
 
+// hemm
+template <>
+void cblas_hemm(hipblasSideMode_t side,
+                hipblasFillMode_t uplo,
+                int               m,
+                int               n,
+                hipblasComplex    alpha,
+                hipblasComplex*   A,
+                int               lda,
+                hipblasComplex*   B,
+                int               ldb,
+                hipblasComplex    beta,
+                hipblasComplex*   C,
+                int               ldc)
+{
+    cblas_chemm(CblasColMajor,
+                (CBLAS_SIDE)side,
+                (CBLAS_UPLO)uplo,
+                m,
+                n,
+                &alpha,
+                A,
+                lda,
+                B,
+                ldb,
+                &beta,
+                C,
+                ldc);
+}
+
+template <>
+void cblas_hemm(hipblasSideMode_t     side,
+                hipblasFillMode_t     uplo,
+                int                   m,
+                int                   n,
+                hipblasDoubleComplex  alpha,
+                hipblasDoubleComplex* A,
+                int                   lda,
+                hipblasDoubleComplex* B,
+                int                   ldb,
+                hipblasDoubleComplex  beta,
+                hipblasDoubleComplex* C,
+                int                   ldc)
+{
+    cblas_zhemm(CblasColMajor,
+                (CBLAS_SIDE)side,
+                (CBLAS_UPLO)uplo,
+                m,
+                n,
+                &alpha,
+                A,
+                lda,
+                B,
+                ldb,
+                &beta,
+                C,
+                ldc);
+}
+
 // herk
 template <>
 void cblas_herk(hipblasFillMode_t  uplo,
@@ -2280,6 +2512,123 @@ void cblas_her2k(hipblasFillMode_t     uplo,
                  ldc);
 }
 
+// symm
+template <>
+void cblas_symm(hipblasSideMode_t side,
+                hipblasFillMode_t uplo,
+                int               m,
+                int               n,
+                float             alpha,
+                float*            A,
+                int               lda,
+                float*            B,
+                int               ldb,
+                float             beta,
+                float*            C,
+                int               ldc)
+{
+    cblas_ssymm(CblasColMajor,
+                (CBLAS_SIDE)side,
+                (CBLAS_UPLO)uplo,
+                m,
+                n,
+                alpha,
+                A,
+                lda,
+                B,
+                ldb,
+                beta,
+                C,
+                ldc);
+}
+
+template <>
+void cblas_symm(hipblasSideMode_t side,
+                hipblasFillMode_t uplo,
+                int               m,
+                int               n,
+                double            alpha,
+                double*           A,
+                int               lda,
+                double*           B,
+                int               ldb,
+                double            beta,
+                double*           C,
+                int               ldc)
+{
+    cblas_dsymm(CblasColMajor,
+                (CBLAS_SIDE)side,
+                (CBLAS_UPLO)uplo,
+                m,
+                n,
+                alpha,
+                A,
+                lda,
+                B,
+                ldb,
+                beta,
+                C,
+                ldc);
+}
+
+template <>
+void cblas_symm(hipblasSideMode_t side,
+                hipblasFillMode_t uplo,
+                int               m,
+                int               n,
+                hipblasComplex    alpha,
+                hipblasComplex*   A,
+                int               lda,
+                hipblasComplex*   B,
+                int               ldb,
+                hipblasComplex    beta,
+                hipblasComplex*   C,
+                int               ldc)
+{
+    cblas_csymm(CblasColMajor,
+                (CBLAS_SIDE)side,
+                (CBLAS_UPLO)uplo,
+                m,
+                n,
+                &alpha,
+                A,
+                lda,
+                B,
+                ldb,
+                &beta,
+                C,
+                ldc);
+}
+
+template <>
+void cblas_symm(hipblasSideMode_t     side,
+                hipblasFillMode_t     uplo,
+                int                   m,
+                int                   n,
+                hipblasDoubleComplex  alpha,
+                hipblasDoubleComplex* A,
+                int                   lda,
+                hipblasDoubleComplex* B,
+                int                   ldb,
+                hipblasDoubleComplex  beta,
+                hipblasDoubleComplex* C,
+                int                   ldc)
+{
+    cblas_zsymm(CblasColMajor,
+                (CBLAS_SIDE)side,
+                (CBLAS_UPLO)uplo,
+                m,
+                n,
+                &alpha,
+                A,
+                lda,
+                B,
+                ldb,
+                &beta,
+                C,
+                ldc);
+}
+
 // syrk
 template <>
 void cblas_syrk(hipblasFillMode_t  uplo,
@@ -2819,6 +3168,41 @@ int cblas_getrs<hipblasDoubleComplex>(char                  trans,
     return info;
 }
 
+// getri
+template <>
+int cblas_getri<float>(int n, float* A, int lda, int* ipiv, float* work, int lwork)
+{
+    int info;
+    sgetri_(&n, A, &lda, ipiv, work, &lwork, &info);
+    return info;
+}
+
+template <>
+int cblas_getri<double>(int n, double* A, int lda, int* ipiv, double* work, int lwork)
+{
+    int info;
+    dgetri_(&n, A, &lda, ipiv, work, &lwork, &info);
+    return info;
+}
+
+template <>
+int cblas_getri<hipblasComplex>(
+    int n, hipblasComplex* A, int lda, int* ipiv, hipblasComplex* work, int lwork)
+{
+    int info;
+    cgetri_(&n, A, &lda, ipiv, work, &lwork, &info);
+    return info;
+}
+
+template <>
+int cblas_getri<hipblasDoubleComplex>(
+    int n, hipblasDoubleComplex* A, int lda, int* ipiv, hipblasDoubleComplex* work, int lwork)
+{
+    int info;
+    zgetri_(&n, A, &lda, ipiv, work, &lwork, &info);
+    return info;
+}
+
 // geqrf
 template <>
 int cblas_geqrf<float>(int m, int n, float* A, int lda, float* tau, float* work, int lwork)
@@ -2857,3 +3241,46 @@ int cblas_geqrf<hipblasDoubleComplex>(int                   m,
     zgeqrf_(&m, &n, A, &lda, tau, work, &lwork, &info);
     return info;
 }
+
+// lasr
+template <>
+void cblas_lasr<float, float>(
+    char side, char pivot, char direct, int m, int n, float* c, float* s, float* A, int lda)
+{
+    slasr_(&side, &pivot, &direct, &m, &n, c, s, A, &lda);
+}
+
+template <>
+void cblas_lasr<double, double>(
+    char side, char pivot, char direct, int m, int n, double* c, double* s, double* A, int lda)
+{
+    dlasr_(&side, &pivot, &direct, &m, &n, c, s, A, &lda);
+}
+
+template <>
+void cblas_lasr<hipblasComplex, float>(char            side,
+                                       char            pivot,
+                                       char            direct,
+                                       int             m,
+                                       int             n,
+                                       float*          c,
+                                       float*          s,
+                                       hipblasComplex* A,
+                                       int             lda)
+{
+    clasr_(&side, &pivot, &direct, &m, &n, c, s, A, &lda);
+}
+
+template <>
+void cblas_lasr<hipblasDoubleComplex, double>(char                  side,
+                                              char                  pivot,
+                                              char                  direct,
+                                              int                   m,
+                                              int                   n,
+                                              double*               c,
+                                              double*               s,
+                                              hipblasDoubleComplex* A,
+                                              int                   lda)
+{
+    zlasr_(&side, &pivot, &direct, &m, &n, c, s, A, &lda);
+}
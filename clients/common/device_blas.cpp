@@ -0,0 +1,128 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "device_blas.h"
+#include "hipblas_device.hpp"
+#include <hip/hip_runtime.h>
+
+namespace
+{
+    constexpr int BLOCK_DIM = 64;
+
+    template <int SIZE, typename T>
+    __device__ void stage(T* dst, const T* src)
+    {
+        for(int i = threadIdx.x; i < SIZE; i += blockDim.x)
+            dst[i] = src[i];
+        __syncthreads();
+    }
+
+    template <int SIZE, typename T>
+    __device__ void unstage(T* dst, const T* src)
+    {
+        for(int i = threadIdx.x; i < SIZE; i += blockDim.x)
+            dst[i] = src[i];
+    }
+
+    template <hipblasOrder_t Order>
+    __global__ void
+        gemm_kernel(float alpha, const float* A, const float* B, float beta, float* C)
+    {
+        constexpr int M = DEVICE_GEMM_M, N = DEVICE_GEMM_N, K = DEVICE_GEMM_K;
+
+        constexpr bool row = Order == HIPBLAS_ORDER_ROW_MAJOR;
+
+        __shared__ float sA[M * K], sB[N * K], sC[M * N];
+        stage<M * K>(sA, A);
+        stage<N * K>(sB, B);
+        stage<M * N>(sC, C);
+        hipblas::device::gemm<M, N, K, HIPBLAS_OP_N, HIPBLAS_OP_T, Order, float>::run(
+            alpha, sA, row ? K : M, sB, row ? K : N, beta, sC, row ? N : M);
+        unstage<M * N>(C, sC);
+    }
+
+    template <hipblasSideMode_t Side, hipblasOperation_t Trans>
+    __global__ void trsm_kernel(double alpha, const double* A, double* B)
+    {
+        constexpr int M = DEVICE_TRSM_M, N = DEVICE_TRSM_N;
+        constexpr int D = Side == HIPBLAS_SIDE_LEFT ? M : N;
+
+        __shared__ double sA[D * D], sB[M * N];
+        stage<D * D>(sA, A);
+        stage<M * N>(sB, B);
+        hipblas::device::trsm<M,
+                              N,
+                              Side,
+                              HIPBLAS_FILL_MODE_LOWER,
+                              Trans,
+                              HIPBLAS_DIAG_NON_UNIT,
+                              HIPBLAS_ORDER_COLUMN_MAJOR,
+                              double>::run(alpha, sA, D, sB, M);
+        unstage<M * N>(B, sB);
+    }
+
+    __global__ void getrf_kernel(hipblasDoubleComplex* A, int* ipiv, int* info)
+    {
+        constexpr int N = DEVICE_GETRF_N;
+
+        __shared__ hipblasDoubleComplex sA[N * N];
+        stage<N * N>(sA, A);
+        hipblas::device::getrf<N, HIPBLAS_ORDER_COLUMN_MAJOR, hipblasDoubleComplex>::run(
+            sA, N, ipiv, info);
+        unstage<N * N>(A, sA);
+    }
+
+    hipError_t finish()
+    {
+        hipError_t err = hipGetLastError();
+        return err == hipSuccess ? hipDeviceSynchronize() : err;
+    }
+}
+
+hipError_t hipblas_device_gemm(
+    hipblasOrder_t order, float alpha, const float* A, const float* B, float beta, float* C)
+{
+    if(order == HIPBLAS_ORDER_ROW_MAJOR)
+        hipLaunchKernelGGL(gemm_kernel<HIPBLAS_ORDER_ROW_MAJOR>,
+                           dim3(1),
+                           dim3(BLOCK_DIM),
+                           0,
+                           0,
+                           alpha,
+                           A,
+                           B,
+                           beta,
+                           C);
+    else
+        hipLaunchKernelGGL(gemm_kernel<HIPBLAS_ORDER_COLUMN_MAJOR>,
+                           dim3(1),
+                           dim3(BLOCK_DIM),
+                           0,
+                           0,
+                           alpha,
+                           A,
+                           B,
+                           beta,
+                           C);
+    return finish();
+}
+
+hipError_t hipblas_device_trsm(
+    hipblasSideMode_t side, hipblasOperation_t trans, double alpha, const double* A, double* B)
+{
+    auto kernel = side == HIPBLAS_SIDE_LEFT
+                      ? (trans == HIPBLAS_OP_N ? trsm_kernel<HIPBLAS_SIDE_LEFT, HIPBLAS_OP_N>
+                                               : trsm_kernel<HIPBLAS_SIDE_LEFT, HIPBLAS_OP_T>)
+                      : (trans == HIPBLAS_OP_N ? trsm_kernel<HIPBLAS_SIDE_RIGHT, HIPBLAS_OP_N>
+                                               : trsm_kernel<HIPBLAS_SIDE_RIGHT, HIPBLAS_OP_T>);
+    hipLaunchKernelGGL(kernel, dim3(1), dim3(BLOCK_DIM), 0, 0, alpha, A, B);
+    return finish();
+}
+
+hipError_t hipblas_device_getrf(hipblasDoubleComplex* A, int* ipiv, int* info)
+{
+    hipLaunchKernelGGL(getrf_kernel, dim3(1), dim3(BLOCK_DIM), 0, 0, A, ipiv, info);
+    return finish();
+}
@@ -0,0 +1,273 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "device_compare.h"
+#include <algorithm>
+#include <cstring>
+#include <hip/hip_runtime.h>
+
+namespace
+{
+    constexpr int COMPARE_DIM_X = 256;
+
+    constexpr int MAX_GRID_X     = 1024;
+    constexpr int MAX_GRID_BATCH = 65535;
+
+    // the errors are non-negative, so their doubles order like their bit patterns and the
+    // maxima reduce with integer atomics
+    struct device_summary
+    {
+        unsigned long long abs_bits;
+        unsigned long long rel_bits;
+        unsigned long long mismatches;
+        unsigned long long nan_mismatches;
+        unsigned long long first;
+    };
+
+    __device__ float half_bits_to_float(uint16_t h)
+    {
+        uint32_t sign = uint32_t(h & 0x8000) << 16;
+        uint32_t exp  = (h >> 10) & 0x1f;
+        uint32_t man  = h & 0x3ff;
+        if(exp == 0)
+        {
+            float v = float(man) * (1.0f / 16777216.0f);
+            return sign ? -v : v;
+        }
+        uint32_t bits = sign | (exp == 0x1f ? 0x7f800000 : (exp + 112) << 23) | man << 13;
+        return __uint_as_float(bits);
+    }
+
+    // each element as its parts, 2 for complex types
+    template <typename T>
+    struct parts
+    {
+        static constexpr int count = 1;
+        __device__ static double get(const T* A, int)
+        {
+            return *A;
+        }
+    };
+
+    template <>
+    struct parts<hipblasHalf>
+    {
+        static constexpr int count = 1;
+        __device__ static double get(const hipblasHalf* A, int)
+        {
+            return half_bits_to_float(*A);
+        }
+    };
+
+    template <>
+    struct parts<hipblasBfloat16>
+    {
+        static constexpr int count = 1;
+        __device__ static double get(const hipblasBfloat16* A, int)
+        {
+            return __uint_as_float(uint32_t(A->data) << 16);
+        }
+    };
+
+    template <typename R>
+    struct parts<hip_complex_number<R>>
+    {
+        static constexpr int count = 2;
+        __device__ static double get(const hip_complex_number<R>* A, int part)
+        {
+            return reinterpret_cast<const R*>(A)[part];
+        }
+    };
+
+    template <typename T>
+    __device__ const T* batch_matrix(const T* A, int64_t stride, int b)
+    {
+        return A + b * stride;
+    }
+
+    template <typename T>
+    __device__ const T* batch_matrix(const T* const* A, int64_t, int b)
+    {
+        return A[b];
+    }
+
+    // the threads of a block fold their elements, then the block folds into the summary
+    template <typename T, typename U>
+    __global__ void compare_kernel(
+        int M, int N, int batch_count, int lda, int64_t stride, U ref, U res, device_summary* out)
+    {
+        __shared__ double             s_abs[COMPARE_DIM_X];
+        __shared__ double             s_rel[COMPARE_DIM_X];
+        __shared__ unsigned long long s_mismatches[COMPARE_DIM_X];
+        __shared__ unsigned long long s_nan[COMPARE_DIM_X];
+        __shared__ unsigned long long s_first[COMPARE_DIM_X];
+
+        double             abs_error = 0, rel_error = 0;
+        unsigned long long mismatches = 0, nan_mismatches = 0, first = ~0ull;
+
+        size_t count = size_t(M) * N;
+        for(int b = blockIdx.y; b < batch_count; b += gridDim.y)
+        {
+            const T* A = batch_matrix(ref, stride, b);
+            const T* B = batch_matrix(res, stride, b);
+            for(size_t e = blockIdx.x * size_t(blockDim.x) + threadIdx.x; e < count;
+                e += size_t(gridDim.x) * blockDim.x)
+            {
+                size_t i = e % M, j = e / M;
+                bool   differs = false, nan_differs = false;
+                for(int p = 0; p < parts<T>::count; p++)
+                {
+                    double a = parts<T>::get(A + i + j * lda, p);
+                    double r = parts<T>::get(B + i + j * lda, p);
+                    if(isnan(a) || isnan(r))
+                    {
+                        nan_differs |= isnan(a) != isnan(r);
+                        continue;
+                    }
+                    double err = fabs(a - r);
+                    differs |= a != r;
+                    abs_error = fmax(abs_error, err);
+                    rel_error = fmax(rel_error, a != 0 ? err / fabs(a) : err);
+                }
+                if(differs || nan_differs)
+                {
+                    mismatches++;
+                    nan_mismatches += nan_differs;
+                    unsigned long long index = b * count + e;
+                    first                    = index < first ? index : first;
+                }
+            }
+        }
+
+        int t           = threadIdx.x;
+        s_abs[t]        = abs_error;
+        s_rel[t]        = rel_error;
+        s_mismatches[t] = mismatches;
+        s_nan[t]        = nan_mismatches;
+        s_first[t]      = first;
+        __syncthreads();
+
+        for(int half = COMPARE_DIM_X / 2; half > 0; half /= 2)
+        {
+            if(t < half)
+            {
+                s_abs[t] = fmax(s_abs[t], s_abs[t + half]);
+                s_rel[t] = fmax(s_rel[t], s_rel[t + half]);
+                s_mismatches[t] += s_mismatches[t + half];
+                s_nan[t] += s_nan[t + half];
+                if(s_first[t + half] < s_first[t])
+                    s_first[t] = s_first[t + half];
+            }
+            __syncthreads();
+        }
+
+        if(t == 0 && s_mismatches[0] != 0)
+        {
+            atomicMax(&out->abs_bits, (unsigned long long)__double_as_longlong(s_abs[0]));
+            atomicMax(&out->rel_bits, (unsigned long long)__double_as_longlong(s_rel[0]));
+            atomicAdd(&out->mismatches, s_mismatches[0]);
+            atomicAdd(&out->nan_mismatches, s_nan[0]);
+            atomicMin(&out->first, s_first[0]);
+        }
+    }
+
+    template <typename T, typename U>
+    hipError_t compare_device(int                      M,
+                              int                      N,
+                              int                      batch_count,
+                              int                      lda,
+                              int64_t                  stride,
+                              U                        ref,
+                              U                        res,
+                              hipblas_compare_summary* summary)
+    {
+        if(!summary)
+            return hipErrorInvalidValue;
+
+        *summary = {0, 0, 0, 0, -1};
+        if(M <= 0 || N <= 0 || batch_count <= 0)
+            return hipSuccess;
+
+        device_summary  init = {0, 0, 0, 0, ~0ull}, result;
+        device_summary* d_summary;
+        hipError_t      err = hipMalloc(&d_summary, sizeof(device_summary));
+        if(err != hipSuccess)
+            return err;
+
+        size_t blocks = (size_t(M) * N - 1) / COMPARE_DIM_X + 1;
+        err           = hipMemcpy(d_summary, &init, sizeof(init), hipMemcpyHostToDevice);
+        if(err == hipSuccess)
+        {
+            hipLaunchKernelGGL((compare_kernel<T, U>),
+                               dim3(std::min(blocks, size_t(MAX_GRID_X)),
+                                    std::min(batch_count, MAX_GRID_BATCH)),
+                               dim3(COMPARE_DIM_X),
+                               0,
+                               0,
+                               M,
+                               N,
+                               batch_count,
+                               lda,
+                               stride,
+                               ref,
+                               res,
+                               d_summary);
+            err = hipGetLastError();
+        }
+        if(err == hipSuccess)
+            err = hipMemcpy(&result, d_summary, sizeof(result), hipMemcpyDeviceToHost);
+        hipFree(d_summary);
+        if(err != hipSuccess)
+            return err;
+
+        // a block folds its maxima in only when it found a mismatch, which any nonzero error is
+        std::memcpy(&summary->max_abs_error, &result.abs_bits, sizeof(double));
+        std::memcpy(&summary->max_rel_error, &result.rel_bits, sizeof(double));
+        summary->mismatches     = result.mismatches;
+        summary->nan_mismatches = result.nan_mismatches;
+        summary->first_mismatch = result.mismatches ? int64_t(result.first) : -1;
+        return hipSuccess;
+    }
+}
+
+template <typename T>
+hipError_t hipblas_compare_device(int                      M,
+                                  int                      N,
+                                  int                      batch_count,
+                                  int                      lda,
+                                  int64_t                  stride,
+                                  const T*                 dRef,
+                                  const T*                 dResult,
+                                  hipblas_compare_summary* summary)
+{
+    return compare_device<T>(M, N, batch_count, lda, stride, dRef, dResult, summary);
+}
+
+template <typename T>
+hipError_t hipblas_compare_device_batched(int                      M,
+                                          int                      N,
+                                          int                      batch_count,
+                                          int                      lda,
+                                          const T* const           dRef[],
+                                          const T* const           dResult[],
+                                          hipblas_compare_summary* summary)
+{
+    return compare_device<T>(M, N, batch_count, lda, 0, dRef, dResult, summary);
+}
+
+// clang-format off
+template hipError_t hipblas_compare_device<hipblasHalf>(int, int, int, int, int64_t, const hipblasHalf*, const hipblasHalf*, hipblas_compare_summary*);
+template hipError_t hipblas_compare_device<hipblasBfloat16>(int, int, int, int, int64_t, const hipblasBfloat16*, const hipblasBfloat16*, hipblas_compare_summary*);
+template hipError_t hipblas_compare_device<float>(int, int, int, int, int64_t, const float*, const float*, hipblas_compare_summary*);
+template hipError_t hipblas_compare_device<double>(int, int, int, int, int64_t, const double*, const double*, hipblas_compare_summary*);
+template hipError_t hipblas_compare_device<hipblasComplex>(int, int, int, int, int64_t, const hipblasComplex*, const hipblasComplex*, hipblas_compare_summary*);
+template hipError_t hipblas_compare_device<hipblasDoubleComplex>(int, int, int, int, int64_t, const hipblasDoubleComplex*, const hipblasDoubleComplex*, hipblas_compare_summary*);
+template hipError_t hipblas_compare_device_batched<hipblasHalf>(int, int, int, int, const hipblasHalf* const[], const hipblasHalf* const[], hipblas_compare_summary*);
+template hipError_t hipblas_compare_device_batched<hipblasBfloat16>(int, int, int, int, const hipblasBfloat16* const[], const hipblasBfloat16* const[], hipblas_compare_summary*);
+template hipError_t hipblas_compare_device_batched<float>(int, int, int, int, const float* const[], const float* const[], hipblas_compare_summary*);
+template hipError_t hipblas_compare_device_batched<double>(int, int, int, int, const double* const[], const double* const[], hipblas_compare_summary*);
+template hipError_t hipblas_compare_device_batched<hipblasComplex>(int, int, int, int, const hipblasComplex* const[], const hipblasComplex* const[], hipblas_compare_summary*);
+template hipError_t hipblas_compare_device_batched<hipblasDoubleComplex>(int, int, int, int, const hipblasDoubleComplex* const[], const hipblasDoubleComplex* const[], hipblas_compare_summary*);
+// clang-format on
@@ -0,0 +1,147 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "device_guard.h"
+#include "device_pool.h"
+#include <algorithm>
+#include <cstdlib>
+#include <hip/hip_runtime.h>
+
+namespace
+{
+    constexpr int GUARD_DIM_X = 256;
+
+    constexpr size_t MAX_GRID_GUARDS = 65535;
+
+    // one block per guard, so that each corrupted guard counts once
+    __global__ void fill_guards_kernel(
+        unsigned char* guards, size_t stride, size_t count, const unsigned char* ref, size_t bytes)
+    {
+        for(size_t g = blockIdx.x; g < count; g += gridDim.x)
+            for(size_t i = threadIdx.x; i < bytes; i += blockDim.x)
+                guards[g * stride + i] = ref[i];
+    }
+
+    __global__ void check_guards_kernel(const unsigned char* guards,
+                                        size_t               stride,
+                                        size_t               count,
+                                        const unsigned char* ref,
+                                        size_t               bytes,
+                                        unsigned long long*  corrupted)
+    {
+        __shared__ int s_differs;
+        for(size_t g = blockIdx.x; g < count; g += gridDim.x)
+        {
+            if(threadIdx.x == 0)
+                s_differs = 0;
+            __syncthreads();
+
+            bool differs = false;
+            for(size_t i = threadIdx.x; i < bytes; i += blockDim.x)
+                differs |= guards[g * stride + i] != ref[i];
+            if(differs)
+                s_differs = 1;
+            __syncthreads();
+
+            if(threadIdx.x == 0 && s_differs)
+                atomicAdd(corrupted, 1ull);
+            __syncthreads();
+        }
+    }
+
+    // the reference in device memory, followed by the corrupted count when check is set
+    hipError_t upload(const void* reference, size_t guard_bytes, bool check, unsigned char*& d_ref)
+    {
+        size_t     count_offset = (guard_bytes + 7) / 8 * 8;
+        size_t     bytes        = check ? count_offset + sizeof(unsigned long long) : guard_bytes;
+        hipError_t err          = hipblas_pool_malloc((void**)&d_ref, bytes);
+        if(err != hipSuccess)
+            return err;
+        err = hipMemcpy(d_ref, reference, guard_bytes, hipMemcpyHostToDevice);
+        if(err == hipSuccess && check)
+            err = hipMemset(d_ref + count_offset, 0, sizeof(unsigned long long));
+        if(err != hipSuccess)
+            hipblas_pool_free(d_ref);
+        return err;
+    }
+}
+
+size_t hipblas_client_guard(size_t pad)
+{
+    static const char* env = getenv("HIPBLAS_CLIENT_GUARD");
+    if(!env || !*env)
+        return pad;
+    return std::min(pad, size_t(strtoull(env, nullptr, 10)));
+}
+
+hipError_t hipblas_device_fill_guards(
+    void* guards, size_t stride_bytes, size_t count, const void* reference, size_t guard_bytes)
+{
+    if(count == 0 || guard_bytes == 0)
+        return hipSuccess;
+    if(!guards || !reference)
+        return hipErrorInvalidValue;
+
+    unsigned char* d_ref;
+    hipError_t     err = upload(reference, guard_bytes, false, d_ref);
+    if(err != hipSuccess)
+        return err;
+    hipLaunchKernelGGL(fill_guards_kernel,
+                       dim3(std::min(count, MAX_GRID_GUARDS)),
+                       dim3(GUARD_DIM_X),
+                       0,
+                       0,
+                       (unsigned char*)guards,
+                       stride_bytes,
+                       count,
+                       d_ref,
+                       guard_bytes);
+    err = hipGetLastError();
+    if(err == hipSuccess)
+        err = hipStreamSynchronize(0);
+    hipblas_pool_free(d_ref);
+    return err;
+}
+
+hipError_t hipblas_device_check_guards(const void* guards,
+                                       size_t      stride_bytes,
+                                       size_t      count,
+                                       const void* reference,
+                                       size_t      guard_bytes,
+                                       size_t*     corrupted)
+{
+    if(!corrupted)
+        return hipErrorInvalidValue;
+    *corrupted = 0;
+    if(count == 0 || guard_bytes == 0)
+        return hipSuccess;
+    if(!guards || !reference)
+        return hipErrorInvalidValue;
+
+    unsigned char* d_ref;
+    hipError_t     err = upload(reference, guard_bytes, true, d_ref);
+    if(err != hipSuccess)
+        return err;
+    unsigned long long* d_count = (unsigned long long*)(d_ref + (guard_bytes + 7) / 8 * 8);
+    hipLaunchKernelGGL(check_guards_kernel,
+                       dim3(std::min(count, MAX_GRID_GUARDS)),
+                       dim3(GUARD_DIM_X),
+                       0,
+                       0,
+                       (const unsigned char*)guards,
+                       stride_bytes,
+                       count,
+                       d_ref,
+                       guard_bytes,
+                       d_count);
+    err = hipGetLastError();
+
+    unsigned long long result = 0;
+    if(err == hipSuccess)
+        err = hipMemcpy(&result, d_count, sizeof(result), hipMemcpyDeviceToHost);
+    hipblas_pool_free(d_ref);
+    *corrupted = size_t(result);
+    return err;
+}
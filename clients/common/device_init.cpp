@@ -0,0 +1,178 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "device_init.h"
+#include <algorithm>
+#include <hip/hip_runtime.h>
+#include <stdlib.h>
+
+namespace
+{
+    constexpr int MATRIX_DIM_X = 32;
+    constexpr int MATRIX_DIM_Y = 8;
+
+    constexpr int MAX_GRID_BATCH = 65535;
+
+    enum class init_mode
+    {
+        plain,
+        alternating_sign,
+        symmetric,
+        hermitian
+    };
+
+    // hipblas_counter_hash in utility.h, which the host initializers use
+    __device__ uint64_t counter_hash(uint64_t seed, uint64_t index)
+    {
+        uint64_t z = seed + (index + 1) * 0x9e3779b97f4a7c15ull;
+        z          = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+        z          = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+        return z ^ (z >> 31);
+    }
+
+    // Each store writes the value random_counter_generator makes from hash h, negated when
+    // negative is set; real_only zeroes the imaginary part
+    __device__ void store(float* A, uint64_t h, bool negative, bool)
+    {
+        float v = float(h % 10 + 1);
+        *A      = negative ? -v : v;
+    }
+
+    __device__ void store(double* A, uint64_t h, bool negative, bool)
+    {
+        double v = double(h % 10 + 1);
+        *A       = negative ? -v : v;
+    }
+
+    // 1, 2 and 3 are exact in both 16 bit formats, so their bit patterns are written directly
+    __device__ void store(hipblasHalf* A, uint64_t h, bool negative, bool)
+    {
+        const uint16_t bits[] = {0x3C00, 0x4000, 0x4200};
+        *A                    = bits[h % 3] | (negative ? 0x8000 : 0);
+    }
+
+    __device__ void store(hipblasBfloat16* A, uint64_t h, bool negative, bool)
+    {
+        const uint16_t bits[] = {0x3F80, 0x4000, 0x4040};
+        A->data               = bits[h % 3] | (negative ? 0x8000 : 0);
+    }
+
+    // hipblasComplex has no device constructors, so the parts are written as a real pair
+    template <typename R>
+    __device__ void store(hip_complex_number<R>* A, uint64_t h, bool negative, bool real_only)
+    {
+        R* parts = reinterpret_cast<R*>(A);
+        R  re    = R(h % 10 + 1);
+        R  im    = real_only ? R(0) : R((h >> 32) % 10 + 1);
+        parts[0] = negative ? -re : re;
+        parts[1] = negative ? -im : im;
+    }
+
+    // Element (i, j) of batch b takes number (b * N + j) * M + i of the stream, as in
+    // hipblas_init; the symmetric modes number the pair (i, j), (j, i) by its lower element
+    template <typename T>
+    __global__ void init_kernel(T*        A,
+                                int       M,
+                                int       N,
+                                int64_t   lda,
+                                int64_t   stride,
+                                int       batch_count,
+                                uint64_t  seed,
+                                init_mode mode)
+    {
+        int i = blockIdx.x * blockDim.x + threadIdx.x;
+        int j = blockIdx.y * blockDim.y + threadIdx.y;
+        if(i >= M || j >= N)
+            return;
+
+        bool paired    = mode == init_mode::symmetric || mode == init_mode::hermitian;
+        int  row       = paired ? max(i, j) : i;
+        int  col       = paired ? min(i, j) : j;
+        bool negative  = mode == init_mode::alternating_sign && !(j % 2 ^ i % 2);
+        bool real_only = mode == init_mode::hermitian && i == j;
+
+        for(int b = blockIdx.z; b < batch_count; b += gridDim.z)
+        {
+            uint64_t index = (uint64_t(b) * N + col) * M + row;
+            store(A + b * stride + i + j * lda, counter_hash(seed, index), negative, real_only);
+        }
+    }
+
+    template <typename T>
+    hipError_t
+        init_device(T* A, int M, int N, int lda, int stride, int batch_count, init_mode mode)
+    {
+        if(M <= 0 || N <= 0 || batch_count <= 0)
+            return hipSuccess;
+
+        // the seed is drawn the way hipblas_init draws it, so the values follow srand()
+        uint64_t seed = uint64_t(rand()) << 32 | uint64_t(rand());
+        hipLaunchKernelGGL(init_kernel<T>,
+                           dim3((M - 1) / MATRIX_DIM_X + 1,
+                                (N - 1) / MATRIX_DIM_Y + 1,
+                                std::min(batch_count, MAX_GRID_BATCH)),
+                           dim3(MATRIX_DIM_X, MATRIX_DIM_Y),
+                           0,
+                           0,
+                           A,
+                           M,
+                           N,
+                           lda,
+                           stride,
+                           batch_count,
+                           seed,
+                           mode);
+        hipError_t err = hipGetLastError();
+        return err != hipSuccess ? err : hipStreamSynchronize(0);
+    }
+}
+
+template <typename T>
+hipError_t hipblas_init_device(T* A, int M, int N, int lda, int stride, int batch_count)
+{
+    return init_device(A, M, N, lda, stride, batch_count, init_mode::plain);
+}
+
+template <typename T>
+hipError_t
+    hipblas_init_alternating_sign_device(T* A, int M, int N, int lda, int stride, int batch_count)
+{
+    return init_device(A, M, N, lda, stride, batch_count, init_mode::alternating_sign);
+}
+
+template <typename T>
+hipError_t hipblas_init_symmetric_device(T* A, int N, int lda, int stride, int batch_count)
+{
+    return init_device(A, N, N, lda, stride, batch_count, init_mode::symmetric);
+}
+
+template <typename T>
+hipError_t hipblas_init_hermitian_device(T* A, int N, int lda, int stride, int batch_count)
+{
+    return init_device(A, N, N, lda, stride, batch_count, init_mode::hermitian);
+}
+
+// clang-format off
+template hipError_t hipblas_init_device<hipblasHalf>(hipblasHalf*, int, int, int, int, int);
+template hipError_t hipblas_init_device<hipblasBfloat16>(hipblasBfloat16*, int, int, int, int, int);
+template hipError_t hipblas_init_device<float>(float*, int, int, int, int, int);
+template hipError_t hipblas_init_device<double>(double*, int, int, int, int, int);
+template hipError_t hipblas_init_device<hipblasComplex>(hipblasComplex*, int, int, int, int, int);
+template hipError_t hipblas_init_device<hipblasDoubleComplex>(hipblasDoubleComplex*, int, int, int, int, int);
+template hipError_t hipblas_init_alternating_sign_device<hipblasHalf>(hipblasHalf*, int, int, int, int, int);
+template hipError_t hipblas_init_alternating_sign_device<hipblasBfloat16>(hipblasBfloat16*, int, int, int, int, int);
+template hipError_t hipblas_init_alternating_sign_device<float>(float*, int, int, int, int, int);
+template hipError_t hipblas_init_alternating_sign_device<double>(double*, int, int, int, int, int);
+template hipError_t hipblas_init_alternating_sign_device<hipblasComplex>(hipblasComplex*, int, int, int, int, int);
+template hipError_t hipblas_init_alternating_sign_device<hipblasDoubleComplex>(hipblasDoubleComplex*, int, int, int, int, int);
+template hipError_t hipblas_init_symmetric_device<hipblasHalf>(hipblasHalf*, int, int, int, int);
+template hipError_t hipblas_init_symmetric_device<hipblasBfloat16>(hipblasBfloat16*, int, int, int, int);
+template hipError_t hipblas_init_symmetric_device<float>(float*, int, int, int, int);
+template hipError_t hipblas_init_symmetric_device<double>(double*, int, int, int, int);
+template hipError_t hipblas_init_symmetric_device<hipblasComplex>(hipblasComplex*, int, int, int, int);
+template hipError_t hipblas_init_symmetric_device<hipblasDoubleComplex>(hipblasDoubleComplex*, int, int, int, int);
+template hipError_t hipblas_init_hermitian_device<hipblasComplex>(hipblasComplex*, int, int, int, int);
+template hipError_t hipblas_init_hermitian_device<hipblasDoubleComplex>(hipblasDoubleComplex*, int, int, int, int);
+// clang-format on
@@ -0,0 +1,166 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "device_pool.h"
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    constexpr size_t MIN_CLASS_BYTES = 256;
+
+    // four classes per power of two, so a block wastes under a quarter of itself
+    size_t size_class(size_t bytes)
+    {
+        if(bytes <= MIN_CLASS_BYTES)
+            return MIN_CLASS_BYTES;
+        size_t top = MIN_CLASS_BYTES;
+        while(top < bytes / 2)
+            top *= 2;
+        size_t step = top / 4;
+        return (bytes + step - 1) / step * step;
+    }
+
+    class device_pool
+    {
+    public:
+        device_pool()
+        {
+            const char* env = getenv("HIPBLAS_CLIENT_POOL");
+            enabled         = !(env && !strcmp(env, "0"));
+        }
+
+        ~device_pool()
+        {
+            release();
+        }
+
+        hipError_t malloc(void** ptr, size_t bytes)
+        {
+            if(!enabled)
+                return (hipMalloc)(ptr, bytes);
+
+            int device = 0;
+            hipGetDevice(&device);
+            size_t                      size = size_class(bytes);
+            std::lock_guard<std::mutex> lock(mutex);
+
+            auto& cached = free_lists[{device, size}];
+            if(!cached.empty())
+            {
+                *ptr = cached.back();
+                cached.pop_back();
+            }
+            else
+            {
+                hipError_t err = (hipMalloc)(ptr, size);
+                if(err != hipSuccess)
+                {
+                    release_locked();
+                    err = (hipMalloc)(ptr, size);
+                }
+                if(err != hipSuccess)
+                {
+                    *ptr = nullptr;
+                    return err;
+                }
+            }
+
+            live[*ptr] = {device, size};
+            in_use += size;
+            peak = std::max(peak, in_use);
+            return hipSuccess;
+        }
+
+        hipError_t free(void* ptr)
+        {
+            if(!enabled)
+                return (hipFree)(ptr);
+            if(!ptr)
+                return hipSuccess;
+
+            std::lock_guard<std::mutex> lock(mutex);
+            auto                        block = live.find(ptr);
+            if(block == live.end())
+                return hipErrorInvalidValue;
+
+            free_lists[block->second].push_back(ptr);
+            in_use -= block->second.second;
+            live.erase(block);
+            return hipSuccess;
+        }
+
+        void release()
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            release_locked();
+        }
+
+        size_t peak_bytes()
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            return enabled ? peak : 0;
+        }
+
+    private:
+        // (device, class bytes)
+        typedef std::pair<int, size_t> pool_key;
+
+        void release_locked()
+        {
+            int device = 0;
+            hipGetDevice(&device);
+            for(auto& cached : free_lists)
+            {
+                if(cached.second.empty())
+                    continue;
+                hipSetDevice(cached.first.first);
+                for(void* ptr : cached.second)
+                    (hipFree)(ptr);
+                cached.second.clear();
+            }
+            hipSetDevice(device);
+        }
+
+        bool                                   enabled;
+        std::mutex                             mutex;
+        std::map<pool_key, std::vector<void*>> free_lists;
+        std::unordered_map<void*, pool_key>    live;
+        size_t                                 in_use = 0;
+        size_t                                 peak   = 0;
+    };
+
+    device_pool& pool()
+    {
+        static device_pool instance;
+        return instance;
+    }
+}
+
+hipError_t hipblas_pool_malloc(void** ptr, size_t bytes)
+{
+    return pool().malloc(ptr, bytes);
+}
+
+hipError_t hipblas_pool_free(void* ptr)
+{
+    return pool().free(ptr);
+}
+
+void hipblas_pool_release()
+{
+    pool().release();
+}
+
+size_t hipblas_pool_peak_bytes()
+{
+    return pool().peak_bytes();
+}
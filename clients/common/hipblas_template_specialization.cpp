@@ -73,6 +73,55 @@ hipblasStatus_t hipblasAxpy<hipblasDoubleComplex>(hipblasHandle_t             ha
     return hipblasZaxpy(handle, n, alpha, x, incx, y, incy);
 }
 
+// axpy_64
+template <>
+hipblasStatus_t hipblasAxpy_64<float>(hipblasHandle_t handle,
+                                      int64_t         n,
+                                      const float*    alpha,
+                                      const float*    x,
+                                      int64_t         incx,
+                                      float*          y,
+                                      int64_t         incy)
+{
+    return hipblasSaxpy_64(handle, n, alpha, x, incx, y, incy);
+}
+
+template <>
+hipblasStatus_t hipblasAxpy_64<double>(hipblasHandle_t handle,
+                                       int64_t         n,
+                                       const double*   alpha,
+                                       const double*   x,
+                                       int64_t         incx,
+                                       double*         y,
+                                       int64_t         incy)
+{
+    return hipblasDaxpy_64(handle, n, alpha, x, incx, y, incy);
+}
+
+template <>
+hipblasStatus_t hipblasAxpy_64<hipblasComplex>(hipblasHandle_t       handle,
+                                               int64_t               n,
+                                               const hipblasComplex* alpha,
+                                               const hipblasComplex* x,
+                                               int64_t               incx,
+                                               hipblasComplex*       y,
+                                               int64_t               incy)
+{
+    return hipblasCaxpy_64(handle, n, alpha, x, incx, y, incy);
+}
+
+template <>
+hipblasStatus_t hipblasAxpy_64<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                     int64_t                     n,
+                                                     const hipblasDoubleComplex* alpha,
+                                                     const hipblasDoubleComplex* x,
+                                                     int64_t                     incx,
+                                                     hipblasDoubleComplex*       y,
+                                                     int64_t                     incy)
+{
+    return hipblasZaxpy_64(handle, n, alpha, x, incx, y, incy);
+}
+
 // axpy_batched
 template <>
 hipblasStatus_t hipblasAxpyBatched<hipblasHalf>(hipblasHandle_t          handle,
@@ -767,6 +816,79 @@ hipblasStatus_t hipblasDotc<hipblasDoubleComplex>(hipblasHandle_t             ha
     return hipblasZdotc(handle, n, x, incx, y, incy, result);
 }
 
+// dot_64
+template <>
+hipblasStatus_t hipblasDot_64<float>(hipblasHandle_t handle,
+                                     int64_t         n,
+                                     const float*    x,
+                                     int64_t         incx,
+                                     const float*    y,
+                                     int64_t         incy,
+                                     float*          result)
+{
+    return hipblasSdot_64(handle, n, x, incx, y, incy, result);
+}
+
+template <>
+hipblasStatus_t hipblasDot_64<double>(hipblasHandle_t handle,
+                                      int64_t         n,
+                                      const double*   x,
+                                      int64_t         incx,
+                                      const double*   y,
+                                      int64_t         incy,
+                                      double*         result)
+{
+    return hipblasDdot_64(handle, n, x, incx, y, incy, result);
+}
+
+template <>
+hipblasStatus_t hipblasDot_64<hipblasComplex>(hipblasHandle_t       handle,
+                                              int64_t               n,
+                                              const hipblasComplex* x,
+                                              int64_t               incx,
+                                              const hipblasComplex* y,
+                                              int64_t               incy,
+                                              hipblasComplex*       result)
+{
+    return hipblasCdotu_64(handle, n, x, incx, y, incy, result);
+}
+
+template <>
+hipblasStatus_t hipblasDot_64<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                    int64_t                     n,
+                                                    const hipblasDoubleComplex* x,
+                                                    int64_t                     incx,
+                                                    const hipblasDoubleComplex* y,
+                                                    int64_t                     incy,
+                                                    hipblasDoubleComplex*       result)
+{
+    return hipblasZdotu_64(handle, n, x, incx, y, incy, result);
+}
+
+template <>
+hipblasStatus_t hipblasDotc_64<hipblasComplex>(hipblasHandle_t       handle,
+                                               int64_t               n,
+                                               const hipblasComplex* x,
+                                               int64_t               incx,
+                                               const hipblasComplex* y,
+                                               int64_t               incy,
+                                               hipblasComplex*       result)
+{
+    return hipblasCdotc_64(handle, n, x, incx, y, incy, result);
+}
+
+template <>
+hipblasStatus_t hipblasDotc_64<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                     int64_t                     n,
+                                                     const hipblasDoubleComplex* x,
+                                                     int64_t                     incx,
+                                                     const hipblasDoubleComplex* y,
+                                                     int64_t                     incy,
+                                                     hipblasDoubleComplex*       result)
+{
+    return hipblasZdotc_64(handle, n, x, incx, y, incy, result);
+}
+
 // dot_batched
 template <>
 hipblasStatus_t hipblasDotBatched<hipblasHalf>(hipblasHandle_t          handle,
@@ -1996,6 +2118,64 @@ hipblasStatus_t hipblasIamin<hipblasDoubleComplex>(
     return hipblasIzamin(handle, n, x, incx, result);
 }
 
+// amax_64
+template <>
+hipblasStatus_t hipblasIamax_64<float>(
+    hipblasHandle_t handle, int64_t n, const float* x, int64_t incx, int64_t* result)
+{
+    return hipblasIsamax_64(handle, n, x, incx, result);
+}
+
+template <>
+hipblasStatus_t hipblasIamax_64<double>(
+    hipblasHandle_t handle, int64_t n, const double* x, int64_t incx, int64_t* result)
+{
+    return hipblasIdamax_64(handle, n, x, incx, result);
+}
+
+template <>
+hipblasStatus_t hipblasIamax_64<hipblasComplex>(
+    hipblasHandle_t handle, int64_t n, const hipblasComplex* x, int64_t incx, int64_t* result)
+{
+    return hipblasIcamax_64(handle, n, x, incx, result);
+}
+
+template <>
+hipblasStatus_t hipblasIamax_64<hipblasDoubleComplex>(
+    hipblasHandle_t handle, int64_t n, const hipblasDoubleComplex* x, int64_t incx, int64_t* result)
+{
+    return hipblasIzamax_64(handle, n, x, incx, result);
+}
+
+// amin_64
+template <>
+hipblasStatus_t hipblasIamin_64<float>(
+    hipblasHandle_t handle, int64_t n, const float* x, int64_t incx, int64_t* result)
+{
+    return hipblasIsamin_64(handle, n, x, incx, result);
+}
+
+template <>
+hipblasStatus_t hipblasIamin_64<double>(
+    hipblasHandle_t handle, int64_t n, const double* x, int64_t incx, int64_t* result)
+{
+    return hipblasIdamin_64(handle, n, x, incx, result);
+}
+
+template <>
+hipblasStatus_t hipblasIamin_64<hipblasComplex>(
+    hipblasHandle_t handle, int64_t n, const hipblasComplex* x, int64_t incx, int64_t* result)
+{
+    return hipblasIcamin_64(handle, n, x, incx, result);
+}
+
+template <>
+hipblasStatus_t hipblasIamin_64<hipblasDoubleComplex>(
+    hipblasHandle_t handle, int64_t n, const hipblasDoubleComplex* x, int64_t incx, int64_t* result)
+{
+    return hipblasIzamin_64(handle, n, x, incx, result);
+}
+
 // amin_batched
 template <>
 hipblasStatus_t hipblasIaminBatched<float>(
@@ -3032,6 +3212,111 @@ hipblasStatus_t
         handle, m, n, alpha, x, incx, stridex, y, incy, stridey, A, lda, strideA, batch_count);
 }
 
+// ger_accumulate
+template <>
+hipblasStatus_t hipblasGerAccumulate<float, false>(hipblasHandle_t    handle,
+                                                   int                m,
+                                                   int                n,
+                                                   int                k,
+                                                   const float*       alpha,
+                                                   const float* const x[],
+                                                   int                incx,
+                                                   const float* const y[],
+                                                   int                incy,
+                                                   float*             A,
+                                                   int                lda)
+{
+
+    return hipblasSgerAccumulate(handle, m, n, k, alpha, x, incx, y, incy, A, lda);
+}
+
+template <>
+hipblasStatus_t hipblasGerAccumulate<double, false>(hipblasHandle_t     handle,
+                                                    int                 m,
+                                                    int                 n,
+                                                    int                 k,
+                                                    const double*       alpha,
+                                                    const double* const x[],
+                                                    int                 incx,
+                                                    const double* const y[],
+                                                    int                 incy,
+                                                    double*             A,
+                                                    int                 lda)
+{
+
+    return hipblasDgerAccumulate(handle, m, n, k, alpha, x, incx, y, incy, A, lda);
+}
+
+template <>
+hipblasStatus_t hipblasGerAccumulate<hipblasComplex, false>(hipblasHandle_t             handle,
+                                                            int                         m,
+                                                            int                         n,
+                                                            int                         k,
+                                                            const hipblasComplex*       alpha,
+                                                            const hipblasComplex* const x[],
+                                                            int                         incx,
+                                                            const hipblasComplex* const y[],
+                                                            int                         incy,
+                                                            hipblasComplex*             A,
+                                                            int                         lda)
+{
+
+    return hipblasCgeruAccumulate(handle, m, n, k, alpha, x, incx, y, incy, A, lda);
+}
+
+template <>
+hipblasStatus_t hipblasGerAccumulate<hipblasComplex, true>(hipblasHandle_t             handle,
+                                                           int                         m,
+                                                           int                         n,
+                                                           int                         k,
+                                                           const hipblasComplex*       alpha,
+                                                           const hipblasComplex* const x[],
+                                                           int                         incx,
+                                                           const hipblasComplex* const y[],
+                                                           int                         incy,
+                                                           hipblasComplex*             A,
+                                                           int                         lda)
+{
+
+    return hipblasCgercAccumulate(handle, m, n, k, alpha, x, incx, y, incy, A, lda);
+}
+
+template <>
+hipblasStatus_t
+    hipblasGerAccumulate<hipblasDoubleComplex, false>(hipblasHandle_t                   handle,
+                                                      int                               m,
+                                                      int                               n,
+                                                      int                               k,
+                                                      const hipblasDoubleComplex*       alpha,
+                                                      const hipblasDoubleComplex* const x[],
+                                                      int                               incx,
+                                                      const hipblasDoubleComplex* const y[],
+                                                      int                               incy,
+                                                      hipblasDoubleComplex*             A,
+                                                      int                               lda)
+{
+
+    return hipblasZgeruAccumulate(handle, m, n, k, alpha, x, incx, y, incy, A, lda);
+}
+
+template <>
+hipblasStatus_t
+    hipblasGerAccumulate<hipblasDoubleComplex, true>(hipblasHandle_t                   handle,
+                                                     int                               m,
+                                                     int                               n,
+                                                     int                               k,
+                                                     const hipblasDoubleComplex*       alpha,
+                                                     const hipblasDoubleComplex* const x[],
+                                                     int                               incx,
+                                                     const hipblasDoubleComplex* const y[],
+                                                     int                               incy,
+                                                     hipblasDoubleComplex*             A,
+                                                     int                               lda)
+{
+
+    return hipblasZgercAccumulate(handle, m, n, k, alpha, x, incx, y, incy, A, lda);
+}
+
 // hbmv
 template <>
 hipblasStatus_t hipblasHbmv<hipblasComplex>(hipblasHandle_t       handle,
@@ -5177,58 +5462,6 @@ hipblasStatus_t hipblasTrsvStridedBatched<hipblasDoubleComplex>(hipblasHandle_t
  * ===========================================================================
  */
 
-//
-
-/*
-    template<>
-    hipblasStatus_t
-    hipblasTrtri<float>(hipblasHandle_t handle,
-        hipblasFillMode_t uplo,
-        hipblasDiagType_t diag,
-        int n,
-        float *A, int lda,
-        float *invA, int ldinvA){
-        return hipblasStrtri(handle, uplo, diag, n, A, lda, invA, ldinvA);
-    }
-
-    template<>
-    hipblasStatus_t
-    hipblasTrtri<double>(hipblasHandle_t handle,
-        hipblasFillMode_t uplo,
-        hipblasDiagType_t diag,
-        int n,
-        double *A, int lda,
-        double *invA, int ldinvA){
-        return hipblasDtrtri(handle, uplo, diag, n, A, lda, invA, ldinvA);
-    }
-
-    template<>
-    hipblasStatus_t
-    hipblasTrtri_batched<float>(hipblasHandle_t handle,
-        hipblasFillMode_t uplo,
-        hipblasDiagType_t diag,
-        int n,
-        float *A, int lda, int bsa,
-        float *invA, int ldinvA, int bsinvA,
-        int batch_count){
-        return hipblasStrtri_batched(handle, uplo, diag, n, A, lda, bsa, invA, ldinvA, bsinvA,
-   batch_count);
-    }
-
-    template<>
-    hipblasStatus_t
-    hipblasTrtri_batched<double>(hipblasHandle_t handle,
-        hipblasFillMode_t uplo,
-        hipblasDiagType_t diag,
-        int n,
-        double *A, int lda, int bsa,
-        double *invA, int ldinvA, int bsinvA,
-        int batch_count){
-        return hipblasDtrtri_batched(handle, uplo, diag, n, A, lda, bsa, invA, ldinvA, bsinvA,
-   batch_count);
-    }
-*/
-
 // gemm
 template <>
 hipblasStatus_t hipblasGemm<hipblasHalf>(hipblasHandle_t    handle,
@@ -5325,6 +5558,83 @@ hipblasStatus_t hipblasGemm<hipblasDoubleComplex>(hipblasHandle_t             ha
     return hipblasZgemm(handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
 }
 
+// gemm_xt
+template <>
+hipblasStatus_t hipblasXtGemm<float>(hipblasHandle_t    handle,
+                                     hipblasOperation_t transA,
+                                     hipblasOperation_t transB,
+                                     int64_t            m,
+                                     int64_t            n,
+                                     int64_t            k,
+                                     const float*       alpha,
+                                     const float*       A,
+                                     int64_t            lda,
+                                     const float*       B,
+                                     int64_t            ldb,
+                                     const float*       beta,
+                                     float*             C,
+                                     int64_t            ldc)
+{
+    return hipblasXtSgemm(handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+template <>
+hipblasStatus_t hipblasXtGemm<double>(hipblasHandle_t    handle,
+                                      hipblasOperation_t transA,
+                                      hipblasOperation_t transB,
+                                      int64_t            m,
+                                      int64_t            n,
+                                      int64_t            k,
+                                      const double*      alpha,
+                                      const double*      A,
+                                      int64_t            lda,
+                                      const double*      B,
+                                      int64_t            ldb,
+                                      const double*      beta,
+                                      double*            C,
+                                      int64_t            ldc)
+{
+    return hipblasXtDgemm(handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+template <>
+hipblasStatus_t hipblasXtGemm<hipblasComplex>(hipblasHandle_t       handle,
+                                              hipblasOperation_t    transA,
+                                              hipblasOperation_t    transB,
+                                              int64_t               m,
+                                              int64_t               n,
+                                              int64_t               k,
+                                              const hipblasComplex* alpha,
+                                              const hipblasComplex* A,
+                                              int64_t               lda,
+                                              const hipblasComplex* B,
+                                              int64_t               ldb,
+                                              const hipblasComplex* beta,
+                                              hipblasComplex*       C,
+                                              int64_t               ldc)
+{
+    return hipblasXtCgemm(handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+template <>
+hipblasStatus_t hipblasXtGemm<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                    hipblasOperation_t          transA,
+                                                    hipblasOperation_t          transB,
+                                                    int64_t                     m,
+                                                    int64_t                     n,
+                                                    int64_t                     k,
+                                                    const hipblasDoubleComplex* alpha,
+                                                    const hipblasDoubleComplex* A,
+                                                    int64_t                     lda,
+                                                    const hipblasDoubleComplex* B,
+                                                    int64_t                     ldb,
+                                                    const hipblasDoubleComplex* beta,
+                                                    hipblasDoubleComplex*       C,
+                                                    int64_t                     ldc)
+{
+    return hipblasXtZgemm(handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
 // gemm_batched
 template <>
 hipblasStatus_t hipblasGemmBatched<hipblasHalf>(hipblasHandle_t          handle,
@@ -5637,97 +5947,893 @@ hipblasStatus_t hipblasGemmStridedBatched<hipblasDoubleComplex>(hipblasHandle_t
                                       batch_count);
 }
 
-// herk
+// gemm3m
 template <>
-hipblasStatus_t hipblasHerk(hipblasHandle_t       handle,
-                            hipblasFillMode_t     uplo,
-                            hipblasOperation_t    transA,
+hipblasStatus_t hipblasGemm3m<hipblasComplex>(hipblasHandle_t       handle,
+                                              hipblasOperation_t    transA,
+                                              hipblasOperation_t    transB,
+                                              int                   m,
+                                              int                   n,
+                                              int                   k,
+                                              const hipblasComplex* alpha,
+                                              const hipblasComplex* A,
+                                              int                   lda,
+                                              const hipblasComplex* B,
+                                              int                   ldb,
+                                              const hipblasComplex* beta,
+                                              hipblasComplex*       C,
+                                              int                   ldc)
+{
+    return hipblasCgemm3m(handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+template <>
+hipblasStatus_t hipblasGemm3m<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                    hipblasOperation_t          transA,
+                                                    hipblasOperation_t          transB,
+                                                    int                         m,
+                                                    int                         n,
+                                                    int                         k,
+                                                    const hipblasDoubleComplex* alpha,
+                                                    const hipblasDoubleComplex* A,
+                                                    int                         lda,
+                                                    const hipblasDoubleComplex* B,
+                                                    int                         ldb,
+                                                    const hipblasDoubleComplex* beta,
+                                                    hipblasDoubleComplex*       C,
+                                                    int                         ldc)
+{
+    return hipblasZgemm3m(handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+// gemm3m_strided_batched
+template <>
+hipblasStatus_t hipblasGemm3mStridedBatched<hipblasComplex>(hipblasHandle_t       handle,
+                                                            hipblasOperation_t    transA,
+                                                            hipblasOperation_t    transB,
+                                                            int                   m,
+                                                            int                   n,
+                                                            int                   k,
+                                                            const hipblasComplex* alpha,
+                                                            const hipblasComplex* A,
+                                                            int                   lda,
+                                                            int                   bsa,
+                                                            const hipblasComplex* B,
+                                                            int                   ldb,
+                                                            int                   bsb,
+                                                            const hipblasComplex* beta,
+                                                            hipblasComplex*       C,
+                                                            int                   ldc,
+                                                            int                   bsc,
+                                                            int                   batch_count)
+{
+    return hipblasCgemm3mStridedBatched(handle,
+                                        transA,
+                                        transB,
+                                        m,
+                                        n,
+                                        k,
+                                        alpha,
+                                        A,
+                                        lda,
+                                        bsa,
+                                        B,
+                                        ldb,
+                                        bsb,
+                                        beta,
+                                        C,
+                                        ldc,
+                                        bsc,
+                                        batch_count);
+}
+
+template <>
+hipblasStatus_t
+    hipblasGemm3mStridedBatched<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                      hipblasOperation_t          transA,
+                                                      hipblasOperation_t          transB,
+                                                      int                         m,
+                                                      int                         n,
+                                                      int                         k,
+                                                      const hipblasDoubleComplex* alpha,
+                                                      const hipblasDoubleComplex* A,
+                                                      int                         lda,
+                                                      int                         bsa,
+                                                      const hipblasDoubleComplex* B,
+                                                      int                         ldb,
+                                                      int                         bsb,
+                                                      const hipblasDoubleComplex* beta,
+                                                      hipblasDoubleComplex*       C,
+                                                      int                         ldc,
+                                                      int                         bsc,
+                                                      int                         batch_count)
+{
+    return hipblasZgemm3mStridedBatched(handle,
+                                        transA,
+                                        transB,
+                                        m,
+                                        n,
+                                        k,
+                                        alpha,
+                                        A,
+                                        lda,
+                                        bsa,
+                                        B,
+                                        ldb,
+                                        bsb,
+                                        beta,
+                                        C,
+                                        ldc,
+                                        bsc,
+                                        batch_count);
+}
+
+// gemm_grouped_batched
+template <>
+hipblasStatus_t hipblasGemmGroupedBatched<float>(hipblasHandle_t          handle,
+                                                 const hipblasOperation_t transa_array[],
+                                                 const hipblasOperation_t transb_array[],
+                                                 const int                m_array[],
+                                                 const int                n_array[],
+                                                 const int                k_array[],
+                                                 const float              alpha_array[],
+                                                 const float* const       A_array[],
+                                                 const int                lda_array[],
+                                                 const float* const       B_array[],
+                                                 const int                ldb_array[],
+                                                 const float              beta_array[],
+                                                 float* const             C_array[],
+                                                 const int                ldc_array[],
+                                                 int                      group_count,
+                                                 const int                group_size[])
+{
+    return hipblasSgemmGroupedBatched(handle,
+                                      transa_array,
+                                      transb_array,
+                                      m_array,
+                                      n_array,
+                                      k_array,
+                                      alpha_array,
+                                      A_array,
+                                      lda_array,
+                                      B_array,
+                                      ldb_array,
+                                      beta_array,
+                                      C_array,
+                                      ldc_array,
+                                      group_count,
+                                      group_size);
+}
+
+template <>
+hipblasStatus_t hipblasGemmGroupedBatched<double>(hipblasHandle_t          handle,
+                                                  const hipblasOperation_t transa_array[],
+                                                  const hipblasOperation_t transb_array[],
+                                                  const int                m_array[],
+                                                  const int                n_array[],
+                                                  const int                k_array[],
+                                                  const double             alpha_array[],
+                                                  const double* const      A_array[],
+                                                  const int                lda_array[],
+                                                  const double* const      B_array[],
+                                                  const int                ldb_array[],
+                                                  const double             beta_array[],
+                                                  double* const            C_array[],
+                                                  const int                ldc_array[],
+                                                  int                      group_count,
+                                                  const int                group_size[])
+{
+    return hipblasDgemmGroupedBatched(handle,
+                                      transa_array,
+                                      transb_array,
+                                      m_array,
+                                      n_array,
+                                      k_array,
+                                      alpha_array,
+                                      A_array,
+                                      lda_array,
+                                      B_array,
+                                      ldb_array,
+                                      beta_array,
+                                      C_array,
+                                      ldc_array,
+                                      group_count,
+                                      group_size);
+}
+
+// gemm_batch_reduce
+template <>
+hipblasStatus_t hipblasGemmBatchReduce<float>(hipblasHandle_t    handle,
+                                              hipblasOperation_t transa,
+                                              hipblasOperation_t transb,
+                                              int                m,
+                                              int                n,
+                                              int                k,
+                                              const float*       alpha,
+                                              const float* const A[],
+                                              int                lda,
+                                              const float* const B[],
+                                              int                ldb,
+                                              const float*       beta,
+                                              float*             C,
+                                              int                ldc,
+                                              int                batch_count)
+{
+    return hipblasSgemmBatchReduce(
+        handle, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasGemmBatchReduce<double>(hipblasHandle_t     handle,
+                                               hipblasOperation_t  transa,
+                                               hipblasOperation_t  transb,
+                                               int                 m,
+                                               int                 n,
+                                               int                 k,
+                                               const double*       alpha,
+                                               const double* const A[],
+                                               int                 lda,
+                                               const double* const B[],
+                                               int                 ldb,
+                                               const double*       beta,
+                                               double*             C,
+                                               int                 ldc,
+                                               int                 batch_count)
+{
+    return hipblasDgemmBatchReduce(
+        handle, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasGemmBatchReduce<hipblasComplex>(hipblasHandle_t             handle,
+                                                       hipblasOperation_t          transa,
+                                                       hipblasOperation_t          transb,
+                                                       int                         m,
+                                                       int                         n,
+                                                       int                         k,
+                                                       const hipblasComplex*       alpha,
+                                                       const hipblasComplex* const A[],
+                                                       int                         lda,
+                                                       const hipblasComplex* const B[],
+                                                       int                         ldb,
+                                                       const hipblasComplex*       beta,
+                                                       hipblasComplex*             C,
+                                                       int                         ldc,
+                                                       int                         batch_count)
+{
+    return hipblasCgemmBatchReduce(
+        handle, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasGemmBatchReduce<hipblasDoubleComplex>(
+    hipblasHandle_t                   handle,
+    hipblasOperation_t                transa,
+    hipblasOperation_t                transb,
+    int                               m,
+    int                               n,
+    int                               k,
+    const hipblasDoubleComplex*       alpha,
+    const hipblasDoubleComplex* const A[],
+    int                               lda,
+    const hipblasDoubleComplex* const B[],
+    int                               ldb,
+    const hipblasDoubleComplex*       beta,
+    hipblasDoubleComplex*             C,
+    int                               ldc,
+    int                               batch_count)
+{
+    return hipblasZgemmBatchReduce(
+        handle, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batch_count);
+}
+
+// gemm_strided_batch_reduce
+template <>
+hipblasStatus_t hipblasGemmStridedBatchReduce<float>(hipblasHandle_t    handle,
+                                                     hipblasOperation_t transa,
+                                                     hipblasOperation_t transb,
+                                                     int                m,
+                                                     int                n,
+                                                     int                k,
+                                                     const float*       alpha,
+                                                     const float*       A,
+                                                     int                lda,
+                                                     long long          strideA,
+                                                     const float*       B,
+                                                     int                ldb,
+                                                     long long          strideB,
+                                                     const float*       beta,
+                                                     float*             C,
+                                                     int                ldc,
+                                                     int                batch_count)
+{
+    return hipblasSgemmStridedBatchReduce(handle,
+                                          transa,
+                                          transb,
+                                          m,
+                                          n,
+                                          k,
+                                          alpha,
+                                          A,
+                                          lda,
+                                          strideA,
+                                          B,
+                                          ldb,
+                                          strideB,
+                                          beta,
+                                          C,
+                                          ldc,
+                                          batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasGemmStridedBatchReduce<double>(hipblasHandle_t    handle,
+                                                      hipblasOperation_t transa,
+                                                      hipblasOperation_t transb,
+                                                      int                m,
+                                                      int                n,
+                                                      int                k,
+                                                      const double*      alpha,
+                                                      const double*      A,
+                                                      int                lda,
+                                                      long long          strideA,
+                                                      const double*      B,
+                                                      int                ldb,
+                                                      long long          strideB,
+                                                      const double*      beta,
+                                                      double*            C,
+                                                      int                ldc,
+                                                      int                batch_count)
+{
+    return hipblasDgemmStridedBatchReduce(handle,
+                                          transa,
+                                          transb,
+                                          m,
+                                          n,
+                                          k,
+                                          alpha,
+                                          A,
+                                          lda,
+                                          strideA,
+                                          B,
+                                          ldb,
+                                          strideB,
+                                          beta,
+                                          C,
+                                          ldc,
+                                          batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasGemmStridedBatchReduce<hipblasComplex>(hipblasHandle_t       handle,
+                                                              hipblasOperation_t    transa,
+                                                              hipblasOperation_t    transb,
+                                                              int                   m,
+                                                              int                   n,
+                                                              int                   k,
+                                                              const hipblasComplex* alpha,
+                                                              const hipblasComplex* A,
+                                                              int                   lda,
+                                                              long long             strideA,
+                                                              const hipblasComplex* B,
+                                                              int                   ldb,
+                                                              long long             strideB,
+                                                              const hipblasComplex* beta,
+                                                              hipblasComplex*       C,
+                                                              int                   ldc,
+                                                              int                   batch_count)
+{
+    return hipblasCgemmStridedBatchReduce(handle,
+                                          transa,
+                                          transb,
+                                          m,
+                                          n,
+                                          k,
+                                          alpha,
+                                          A,
+                                          lda,
+                                          strideA,
+                                          B,
+                                          ldb,
+                                          strideB,
+                                          beta,
+                                          C,
+                                          ldc,
+                                          batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasGemmStridedBatchReduce<hipblasDoubleComplex>(
+    hipblasHandle_t             handle,
+    hipblasOperation_t          transa,
+    hipblasOperation_t          transb,
+    int                         m,
+    int                         n,
+    int                         k,
+    const hipblasDoubleComplex* alpha,
+    const hipblasDoubleComplex* A,
+    int                         lda,
+    long long                   strideA,
+    const hipblasDoubleComplex* B,
+    int                         ldb,
+    long long                   strideB,
+    const hipblasDoubleComplex* beta,
+    hipblasDoubleComplex*       C,
+    int                         ldc,
+    int                         batch_count)
+{
+    return hipblasZgemmStridedBatchReduce(handle,
+                                          transa,
+                                          transb,
+                                          m,
+                                          n,
+                                          k,
+                                          alpha,
+                                          A,
+                                          lda,
+                                          strideA,
+                                          B,
+                                          ldb,
+                                          strideB,
+                                          beta,
+                                          C,
+                                          ldc,
+                                          batch_count);
+}
+
+// dgmm
+template <>
+hipblasStatus_t hipblasDgmm(hipblasHandle_t   handle,
+                            hipblasSideMode_t side,
+                            int               m,
+                            int               n,
+                            const float*      A,
+                            int               lda,
+                            const float*      x,
+                            int               incx,
+                            float*            C,
+                            int               ldc)
+{
+    return hipblasSdgmm(handle, side, m, n, A, lda, x, incx, C, ldc);
+}
+
+template <>
+hipblasStatus_t hipblasDgmm(hipblasHandle_t   handle,
+                            hipblasSideMode_t side,
+                            int               m,
+                            int               n,
+                            const double*     A,
+                            int               lda,
+                            const double*     x,
+                            int               incx,
+                            double*           C,
+                            int               ldc)
+{
+    return hipblasDdgmm(handle, side, m, n, A, lda, x, incx, C, ldc);
+}
+
+template <>
+hipblasStatus_t hipblasDgmm(hipblasHandle_t       handle,
+                            hipblasSideMode_t     side,
+                            int                   m,
                             int                   n,
-                            int                   k,
-                            const float*          alpha,
                             const hipblasComplex* A,
                             int                   lda,
-                            const float*          beta,
+                            const hipblasComplex* x,
+                            int                   incx,
                             hipblasComplex*       C,
                             int                   ldc)
 {
-    return hipblasCherk(handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc);
+    return hipblasCdgmm(handle, side, m, n, A, lda, x, incx, C, ldc);
 }
 
 template <>
-hipblasStatus_t hipblasHerk(hipblasHandle_t             handle,
-                            hipblasFillMode_t           uplo,
-                            hipblasOperation_t          transA,
+hipblasStatus_t hipblasDgmm(hipblasHandle_t             handle,
+                            hipblasSideMode_t           side,
+                            int                         m,
                             int                         n,
-                            int                         k,
-                            const double*               alpha,
                             const hipblasDoubleComplex* A,
                             int                         lda,
-                            const double*               beta,
+                            const hipblasDoubleComplex* x,
+                            int                         incx,
                             hipblasDoubleComplex*       C,
                             int                         ldc)
 {
-    return hipblasZherk(handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc);
+    return hipblasZdgmm(handle, side, m, n, A, lda, x, incx, C, ldc);
 }
 
-// herk_batched
+// dgmm_batched
 template <>
-hipblasStatus_t hipblasHerkBatched(hipblasHandle_t             handle,
-                                   hipblasFillMode_t           uplo,
-                                   hipblasOperation_t          transA,
+hipblasStatus_t hipblasDgmmBatched(hipblasHandle_t    handle,
+                                   hipblasSideMode_t  side,
+                                   int                m,
+                                   int                n,
+                                   const float* const A[],
+                                   int                lda,
+                                   const float* const x[],
+                                   int                incx,
+                                   float* const       C[],
+                                   int                ldc,
+                                   int                batchCount)
+{
+    return hipblasSdgmmBatched(handle, side, m, n, A, lda, x, incx, C, ldc, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasDgmmBatched(hipblasHandle_t     handle,
+                                   hipblasSideMode_t   side,
+                                   int                 m,
+                                   int                 n,
+                                   const double* const A[],
+                                   int                 lda,
+                                   const double* const x[],
+                                   int                 incx,
+                                   double* const       C[],
+                                   int                 ldc,
+                                   int                 batchCount)
+{
+    return hipblasDdgmmBatched(handle, side, m, n, A, lda, x, incx, C, ldc, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasDgmmBatched(hipblasHandle_t             handle,
+                                   hipblasSideMode_t           side,
+                                   int                         m,
                                    int                         n,
-                                   int                         k,
-                                   const float*                alpha,
                                    const hipblasComplex* const A[],
                                    int                         lda,
-                                   const float*                beta,
+                                   const hipblasComplex* const x[],
+                                   int                         incx,
                                    hipblasComplex* const       C[],
                                    int                         ldc,
                                    int                         batchCount)
 {
-    return hipblasCherkBatched(handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc, batchCount);
+    return hipblasCdgmmBatched(handle, side, m, n, A, lda, x, incx, C, ldc, batchCount);
 }
 
 template <>
-hipblasStatus_t hipblasHerkBatched(hipblasHandle_t                   handle,
-                                   hipblasFillMode_t                 uplo,
-                                   hipblasOperation_t                transA,
+hipblasStatus_t hipblasDgmmBatched(hipblasHandle_t                   handle,
+                                   hipblasSideMode_t                 side,
+                                   int                               m,
                                    int                               n,
-                                   int                               k,
-                                   const double*                     alpha,
                                    const hipblasDoubleComplex* const A[],
                                    int                               lda,
-                                   const double*                     beta,
+                                   const hipblasDoubleComplex* const x[],
+                                   int                               incx,
                                    hipblasDoubleComplex* const       C[],
                                    int                               ldc,
                                    int                               batchCount)
 {
-    return hipblasZherkBatched(handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc, batchCount);
+    return hipblasZdgmmBatched(handle, side, m, n, A, lda, x, incx, C, ldc, batchCount);
 }
 
-// herk_strided_batched
+// dgmm_strided_batched
 template <>
-hipblasStatus_t hipblasHerkStridedBatched(hipblasHandle_t       handle,
-                                          hipblasFillMode_t     uplo,
-                                          hipblasOperation_t    transA,
+hipblasStatus_t hipblasDgmmStridedBatched(hipblasHandle_t   handle,
+                                          hipblasSideMode_t side,
+                                          int               m,
+                                          int               n,
+                                          const float*      A,
+                                          int               lda,
+                                          int               strideA,
+                                          const float*      x,
+                                          int               incx,
+                                          int               stridex,
+                                          float*            C,
+                                          int               ldc,
+                                          int               strideC,
+                                          int               batchCount)
+{
+    return hipblasSdgmmStridedBatched(
+        handle, side, m, n, A, lda, strideA, x, incx, stridex, C, ldc, strideC, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasDgmmStridedBatched(hipblasHandle_t   handle,
+                                          hipblasSideMode_t side,
+                                          int               m,
+                                          int               n,
+                                          const double*     A,
+                                          int               lda,
+                                          int               strideA,
+                                          const double*     x,
+                                          int               incx,
+                                          int               stridex,
+                                          double*           C,
+                                          int               ldc,
+                                          int               strideC,
+                                          int               batchCount)
+{
+    return hipblasDdgmmStridedBatched(
+        handle, side, m, n, A, lda, strideA, x, incx, stridex, C, ldc, strideC, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasDgmmStridedBatched(hipblasHandle_t       handle,
+                                          hipblasSideMode_t     side,
+                                          int                   m,
                                           int                   n,
-                                          int                   k,
-                                          const float*          alpha,
                                           const hipblasComplex* A,
                                           int                   lda,
                                           int                   strideA,
-                                          const float*          beta,
+                                          const hipblasComplex* x,
+                                          int                   incx,
+                                          int                   stridex,
                                           hipblasComplex*       C,
                                           int                   ldc,
                                           int                   strideC,
                                           int                   batchCount)
 {
-    return hipblasCherkStridedBatched(
-        handle, uplo, transA, n, k, alpha, A, lda, strideA, beta, C, ldc, strideC, batchCount);
+    return hipblasCdgmmStridedBatched(
+        handle, side, m, n, A, lda, strideA, x, incx, stridex, C, ldc, strideC, batchCount);
 }
 
 template <>
-hipblasStatus_t hipblasHerkStridedBatched(hipblasHandle_t             handle,
+hipblasStatus_t hipblasDgmmStridedBatched(hipblasHandle_t             handle,
+                                          hipblasSideMode_t           side,
+                                          int                         m,
+                                          int                         n,
+                                          const hipblasDoubleComplex* A,
+                                          int                         lda,
+                                          int                         strideA,
+                                          const hipblasDoubleComplex* x,
+                                          int                         incx,
+                                          int                         stridex,
+                                          hipblasDoubleComplex*       C,
+                                          int                         ldc,
+                                          int                         strideC,
+                                          int                         batchCount)
+{
+    return hipblasZdgmmStridedBatched(
+        handle, side, m, n, A, lda, strideA, x, incx, stridex, C, ldc, strideC, batchCount);
+}
+
+// hemm
+template <>
+hipblasStatus_t hipblasHemm(hipblasHandle_t       handle,
+                            hipblasSideMode_t     side,
+                            hipblasFillMode_t     uplo,
+                            int                   m,
+                            int                   n,
+                            const hipblasComplex* alpha,
+                            const hipblasComplex* A,
+                            int                   lda,
+                            const hipblasComplex* B,
+                            int                   ldb,
+                            const hipblasComplex* beta,
+                            hipblasComplex*       C,
+                            int                   ldc)
+{
+    return hipblasChemm(handle, side, uplo, m, n, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+template <>
+hipblasStatus_t hipblasHemm(hipblasHandle_t             handle,
+                            hipblasSideMode_t           side,
+                            hipblasFillMode_t           uplo,
+                            int                         m,
+                            int                         n,
+                            const hipblasDoubleComplex* alpha,
+                            const hipblasDoubleComplex* A,
+                            int                         lda,
+                            const hipblasDoubleComplex* B,
+                            int                         ldb,
+                            const hipblasDoubleComplex* beta,
+                            hipblasDoubleComplex*       C,
+                            int                         ldc)
+{
+    return hipblasZhemm(handle, side, uplo, m, n, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+// hemm_batched
+template <>
+hipblasStatus_t hipblasHemmBatched(hipblasHandle_t             handle,
+                                   hipblasSideMode_t           side,
+                                   hipblasFillMode_t           uplo,
+                                   int                         m,
+                                   int                         n,
+                                   const hipblasComplex*       alpha,
+                                   const hipblasComplex* const A[],
+                                   int                         lda,
+                                   const hipblasComplex* const B[],
+                                   int                         ldb,
+                                   const hipblasComplex*       beta,
+                                   hipblasComplex* const       C[],
+                                   int                         ldc,
+                                   int                         batchCount)
+{
+    return hipblasChemmBatched(
+        handle, side, uplo, m, n, alpha, A, lda, B, ldb, beta, C, ldc, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasHemmBatched(hipblasHandle_t                   handle,
+                                   hipblasSideMode_t                 side,
+                                   hipblasFillMode_t                 uplo,
+                                   int                               m,
+                                   int                               n,
+                                   const hipblasDoubleComplex*       alpha,
+                                   const hipblasDoubleComplex* const A[],
+                                   int                               lda,
+                                   const hipblasDoubleComplex* const B[],
+                                   int                               ldb,
+                                   const hipblasDoubleComplex*       beta,
+                                   hipblasDoubleComplex* const       C[],
+                                   int                               ldc,
+                                   int                               batchCount)
+{
+    return hipblasZhemmBatched(
+        handle, side, uplo, m, n, alpha, A, lda, B, ldb, beta, C, ldc, batchCount);
+}
+
+// hemm_strided_batched
+template <>
+hipblasStatus_t hipblasHemmStridedBatched(hipblasHandle_t       handle,
+                                          hipblasSideMode_t     side,
+                                          hipblasFillMode_t     uplo,
+                                          int                   m,
+                                          int                   n,
+                                          const hipblasComplex* alpha,
+                                          const hipblasComplex* A,
+                                          int                   lda,
+                                          int                   strideA,
+                                          const hipblasComplex* B,
+                                          int                   ldb,
+                                          int                   strideB,
+                                          const hipblasComplex* beta,
+                                          hipblasComplex*       C,
+                                          int                   ldc,
+                                          int                   strideC,
+                                          int                   batchCount)
+{
+    return hipblasChemmStridedBatched(handle,
+                                      side,
+                                      uplo,
+                                      m,
+                                      n,
+                                      alpha,
+                                      A,
+                                      lda,
+                                      strideA,
+                                      B,
+                                      ldb,
+                                      strideB,
+                                      beta,
+                                      C,
+                                      ldc,
+                                      strideC,
+                                      batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasHemmStridedBatched(hipblasHandle_t             handle,
+                                          hipblasSideMode_t           side,
+                                          hipblasFillMode_t           uplo,
+                                          int                         m,
+                                          int                         n,
+                                          const hipblasDoubleComplex* alpha,
+                                          const hipblasDoubleComplex* A,
+                                          int                         lda,
+                                          int                         strideA,
+                                          const hipblasDoubleComplex* B,
+                                          int                         ldb,
+                                          int                         strideB,
+                                          const hipblasDoubleComplex* beta,
+                                          hipblasDoubleComplex*       C,
+                                          int                         ldc,
+                                          int                         strideC,
+                                          int                         batchCount)
+{
+    return hipblasZhemmStridedBatched(handle,
+                                      side,
+                                      uplo,
+                                      m,
+                                      n,
+                                      alpha,
+                                      A,
+                                      lda,
+                                      strideA,
+                                      B,
+                                      ldb,
+                                      strideB,
+                                      beta,
+                                      C,
+                                      ldc,
+                                      strideC,
+                                      batchCount);
+}
+
+// herk
+template <>
+hipblasStatus_t hipblasHerk(hipblasHandle_t       handle,
+                            hipblasFillMode_t     uplo,
+                            hipblasOperation_t    transA,
+                            int                   n,
+                            int                   k,
+                            const float*          alpha,
+                            const hipblasComplex* A,
+                            int                   lda,
+                            const float*          beta,
+                            hipblasComplex*       C,
+                            int                   ldc)
+{
+    return hipblasCherk(handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc);
+}
+
+template <>
+hipblasStatus_t hipblasHerk(hipblasHandle_t             handle,
+                            hipblasFillMode_t           uplo,
+                            hipblasOperation_t          transA,
+                            int                         n,
+                            int                         k,
+                            const double*               alpha,
+                            const hipblasDoubleComplex* A,
+                            int                         lda,
+                            const double*               beta,
+                            hipblasDoubleComplex*       C,
+                            int                         ldc)
+{
+    return hipblasZherk(handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc);
+}
+
+// herk_batched
+template <>
+hipblasStatus_t hipblasHerkBatched(hipblasHandle_t             handle,
+                                   hipblasFillMode_t           uplo,
+                                   hipblasOperation_t          transA,
+                                   int                         n,
+                                   int                         k,
+                                   const float*                alpha,
+                                   const hipblasComplex* const A[],
+                                   int                         lda,
+                                   const float*                beta,
+                                   hipblasComplex* const       C[],
+                                   int                         ldc,
+                                   int                         batchCount)
+{
+    return hipblasCherkBatched(handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasHerkBatched(hipblasHandle_t                   handle,
+                                   hipblasFillMode_t                 uplo,
+                                   hipblasOperation_t                transA,
+                                   int                               n,
+                                   int                               k,
+                                   const double*                     alpha,
+                                   const hipblasDoubleComplex* const A[],
+                                   int                               lda,
+                                   const double*                     beta,
+                                   hipblasDoubleComplex* const       C[],
+                                   int                               ldc,
+                                   int                               batchCount)
+{
+    return hipblasZherkBatched(handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc, batchCount);
+}
+
+// herk_strided_batched
+template <>
+hipblasStatus_t hipblasHerkStridedBatched(hipblasHandle_t       handle,
+                                          hipblasFillMode_t     uplo,
+                                          hipblasOperation_t    transA,
+                                          int                   n,
+                                          int                   k,
+                                          const float*          alpha,
+                                          const hipblasComplex* A,
+                                          int                   lda,
+                                          int                   strideA,
+                                          const float*          beta,
+                                          hipblasComplex*       C,
+                                          int                   ldc,
+                                          int                   strideC,
+                                          int                   batchCount)
+{
+    return hipblasCherkStridedBatched(
+        handle, uplo, transA, n, k, alpha, A, lda, strideA, beta, C, ldc, strideC, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasHerkStridedBatched(hipblasHandle_t             handle,
                                           hipblasFillMode_t           uplo,
                                           hipblasOperation_t          transA,
                                           int                         n,
@@ -6056,290 +7162,662 @@ hipblasStatus_t hipblasHerkxStridedBatched(hipblasHandle_t             handle,
                                        batchCount);
 }
 
-// syrk
+// symm
 template <>
-hipblasStatus_t hipblasSyrk(hipblasHandle_t    handle,
-                            hipblasFillMode_t  uplo,
-                            hipblasOperation_t transA,
-                            int                n,
-                            int                k,
-                            const float*       alpha,
-                            const float*       A,
-                            int                lda,
-                            const float*       beta,
-                            float*             C,
-                            int                ldc)
+hipblasStatus_t hipblasSymm(hipblasHandle_t   handle,
+                            hipblasSideMode_t side,
+                            hipblasFillMode_t uplo,
+                            int               m,
+                            int               n,
+                            const float*      alpha,
+                            const float*      A,
+                            int               lda,
+                            const float*      B,
+                            int               ldb,
+                            const float*      beta,
+                            float*            C,
+                            int               ldc)
 {
-    return hipblasSsyrk(handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc);
+    return hipblasSsymm(handle, side, uplo, m, n, alpha, A, lda, B, ldb, beta, C, ldc);
 }
 
 template <>
-hipblasStatus_t hipblasSyrk(hipblasHandle_t    handle,
-                            hipblasFillMode_t  uplo,
-                            hipblasOperation_t transA,
-                            int                n,
-                            int                k,
-                            const double*      alpha,
-                            const double*      A,
-                            int                lda,
-                            const double*      beta,
-                            double*            C,
-                            int                ldc)
-{
-    return hipblasDsyrk(handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc);
-}
-
+hipblasStatus_t hipblasSymm(hipblasHandle_t   handle,
+                            hipblasSideMode_t side,
+                            hipblasFillMode_t uplo,
+                            int               m,
+                            int               n,
+                            const double*     alpha,
+                            const double*     A,
+                            int               lda,
+                            const double*     B,
+                            int               ldb,
+                            const double*     beta,
+                            double*           C,
+                            int               ldc)
+{
+    return hipblasDsymm(handle, side, uplo, m, n, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
 template <>
-hipblasStatus_t hipblasSyrk(hipblasHandle_t       handle,
+hipblasStatus_t hipblasSymm(hipblasHandle_t       handle,
+                            hipblasSideMode_t     side,
                             hipblasFillMode_t     uplo,
-                            hipblasOperation_t    transA,
+                            int                   m,
                             int                   n,
-                            int                   k,
                             const hipblasComplex* alpha,
                             const hipblasComplex* A,
                             int                   lda,
+                            const hipblasComplex* B,
+                            int                   ldb,
                             const hipblasComplex* beta,
                             hipblasComplex*       C,
                             int                   ldc)
 {
-    return hipblasCsyrk(handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc);
+    return hipblasCsymm(handle, side, uplo, m, n, alpha, A, lda, B, ldb, beta, C, ldc);
 }
 
 template <>
-hipblasStatus_t hipblasSyrk(hipblasHandle_t             handle,
+hipblasStatus_t hipblasSymm(hipblasHandle_t             handle,
+                            hipblasSideMode_t           side,
                             hipblasFillMode_t           uplo,
-                            hipblasOperation_t          transA,
+                            int                         m,
                             int                         n,
-                            int                         k,
                             const hipblasDoubleComplex* alpha,
                             const hipblasDoubleComplex* A,
                             int                         lda,
+                            const hipblasDoubleComplex* B,
+                            int                         ldb,
                             const hipblasDoubleComplex* beta,
                             hipblasDoubleComplex*       C,
                             int                         ldc)
 {
-    return hipblasZsyrk(handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc);
+    return hipblasZsymm(handle, side, uplo, m, n, alpha, A, lda, B, ldb, beta, C, ldc);
 }
 
-// syrk_batched
+// symm_batched
 template <>
-hipblasStatus_t hipblasSyrkBatched(hipblasHandle_t    handle,
+hipblasStatus_t hipblasSymmBatched(hipblasHandle_t    handle,
+                                   hipblasSideMode_t  side,
                                    hipblasFillMode_t  uplo,
-                                   hipblasOperation_t transA,
+                                   int                m,
                                    int                n,
-                                   int                k,
                                    const float*       alpha,
                                    const float* const A[],
                                    int                lda,
+                                   const float* const B[],
+                                   int                ldb,
                                    const float*       beta,
                                    float* const       C[],
                                    int                ldc,
                                    int                batchCount)
 {
-    return hipblasSsyrkBatched(handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc, batchCount);
+    return hipblasSsymmBatched(
+        handle, side, uplo, m, n, alpha, A, lda, B, ldb, beta, C, ldc, batchCount);
 }
 
 template <>
-hipblasStatus_t hipblasSyrkBatched(hipblasHandle_t     handle,
+hipblasStatus_t hipblasSymmBatched(hipblasHandle_t     handle,
+                                   hipblasSideMode_t   side,
                                    hipblasFillMode_t   uplo,
-                                   hipblasOperation_t  transA,
+                                   int                 m,
                                    int                 n,
-                                   int                 k,
                                    const double*       alpha,
                                    const double* const A[],
                                    int                 lda,
+                                   const double* const B[],
+                                   int                 ldb,
                                    const double*       beta,
                                    double* const       C[],
                                    int                 ldc,
                                    int                 batchCount)
 {
-    return hipblasDsyrkBatched(handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc, batchCount);
+    return hipblasDsymmBatched(
+        handle, side, uplo, m, n, alpha, A, lda, B, ldb, beta, C, ldc, batchCount);
 }
 
 template <>
-hipblasStatus_t hipblasSyrkBatched(hipblasHandle_t             handle,
+hipblasStatus_t hipblasSymmBatched(hipblasHandle_t             handle,
+                                   hipblasSideMode_t           side,
                                    hipblasFillMode_t           uplo,
-                                   hipblasOperation_t          transA,
+                                   int                         m,
                                    int                         n,
-                                   int                         k,
                                    const hipblasComplex*       alpha,
                                    const hipblasComplex* const A[],
                                    int                         lda,
+                                   const hipblasComplex* const B[],
+                                   int                         ldb,
                                    const hipblasComplex*       beta,
                                    hipblasComplex* const       C[],
                                    int                         ldc,
                                    int                         batchCount)
 {
-    return hipblasCsyrkBatched(handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc, batchCount);
+    return hipblasCsymmBatched(
+        handle, side, uplo, m, n, alpha, A, lda, B, ldb, beta, C, ldc, batchCount);
 }
 
 template <>
-hipblasStatus_t hipblasSyrkBatched(hipblasHandle_t                   handle,
+hipblasStatus_t hipblasSymmBatched(hipblasHandle_t                   handle,
+                                   hipblasSideMode_t                 side,
                                    hipblasFillMode_t                 uplo,
-                                   hipblasOperation_t                transA,
+                                   int                               m,
                                    int                               n,
-                                   int                               k,
                                    const hipblasDoubleComplex*       alpha,
                                    const hipblasDoubleComplex* const A[],
                                    int                               lda,
+                                   const hipblasDoubleComplex* const B[],
+                                   int                               ldb,
                                    const hipblasDoubleComplex*       beta,
                                    hipblasDoubleComplex* const       C[],
                                    int                               ldc,
                                    int                               batchCount)
 {
-    return hipblasZsyrkBatched(handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc, batchCount);
+    return hipblasZsymmBatched(
+        handle, side, uplo, m, n, alpha, A, lda, B, ldb, beta, C, ldc, batchCount);
 }
 
-// syrk_strided_batched
+// symm_strided_batched
 template <>
-hipblasStatus_t hipblasSyrkStridedBatched(hipblasHandle_t    handle,
-                                          hipblasFillMode_t  uplo,
-                                          hipblasOperation_t transA,
-                                          int                n,
-                                          int                k,
-                                          const float*       alpha,
-                                          const float*       A,
-                                          int                lda,
-                                          int                strideA,
-                                          const float*       beta,
-                                          float*             C,
-                                          int                ldc,
-                                          int                strideC,
-                                          int                batchCount)
+hipblasStatus_t hipblasSymmStridedBatched(hipblasHandle_t   handle,
+                                          hipblasSideMode_t side,
+                                          hipblasFillMode_t uplo,
+                                          int               m,
+                                          int               n,
+                                          const float*      alpha,
+                                          const float*      A,
+                                          int               lda,
+                                          int               strideA,
+                                          const float*      B,
+                                          int               ldb,
+                                          int               strideB,
+                                          const float*      beta,
+                                          float*            C,
+                                          int               ldc,
+                                          int               strideC,
+                                          int               batchCount)
 {
-    return hipblasSsyrkStridedBatched(
-        handle, uplo, transA, n, k, alpha, A, lda, strideA, beta, C, ldc, strideC, batchCount);
+    return hipblasSsymmStridedBatched(handle,
+                                      side,
+                                      uplo,
+                                      m,
+                                      n,
+                                      alpha,
+                                      A,
+                                      lda,
+                                      strideA,
+                                      B,
+                                      ldb,
+                                      strideB,
+                                      beta,
+                                      C,
+                                      ldc,
+                                      strideC,
+                                      batchCount);
 }
 
 template <>
-hipblasStatus_t hipblasSyrkStridedBatched(hipblasHandle_t    handle,
-                                          hipblasFillMode_t  uplo,
-                                          hipblasOperation_t transA,
-                                          int                n,
-                                          int                k,
-                                          const double*      alpha,
-                                          const double*      A,
-                                          int                lda,
-                                          int                strideA,
-                                          const double*      beta,
-                                          double*            C,
-                                          int                ldc,
-                                          int                strideC,
-                                          int                batchCount)
+hipblasStatus_t hipblasSymmStridedBatched(hipblasHandle_t   handle,
+                                          hipblasSideMode_t side,
+                                          hipblasFillMode_t uplo,
+                                          int               m,
+                                          int               n,
+                                          const double*     alpha,
+                                          const double*     A,
+                                          int               lda,
+                                          int               strideA,
+                                          const double*     B,
+                                          int               ldb,
+                                          int               strideB,
+                                          const double*     beta,
+                                          double*           C,
+                                          int               ldc,
+                                          int               strideC,
+                                          int               batchCount)
 {
-    return hipblasDsyrkStridedBatched(
-        handle, uplo, transA, n, k, alpha, A, lda, strideA, beta, C, ldc, strideC, batchCount);
+    return hipblasDsymmStridedBatched(handle,
+                                      side,
+                                      uplo,
+                                      m,
+                                      n,
+                                      alpha,
+                                      A,
+                                      lda,
+                                      strideA,
+                                      B,
+                                      ldb,
+                                      strideB,
+                                      beta,
+                                      C,
+                                      ldc,
+                                      strideC,
+                                      batchCount);
 }
 
 template <>
-hipblasStatus_t hipblasSyrkStridedBatched(hipblasHandle_t       handle,
+hipblasStatus_t hipblasSymmStridedBatched(hipblasHandle_t       handle,
+                                          hipblasSideMode_t     side,
                                           hipblasFillMode_t     uplo,
-                                          hipblasOperation_t    transA,
+                                          int                   m,
                                           int                   n,
-                                          int                   k,
                                           const hipblasComplex* alpha,
                                           const hipblasComplex* A,
                                           int                   lda,
                                           int                   strideA,
+                                          const hipblasComplex* B,
+                                          int                   ldb,
+                                          int                   strideB,
                                           const hipblasComplex* beta,
                                           hipblasComplex*       C,
                                           int                   ldc,
                                           int                   strideC,
                                           int                   batchCount)
 {
-    return hipblasCsyrkStridedBatched(
-        handle, uplo, transA, n, k, alpha, A, lda, strideA, beta, C, ldc, strideC, batchCount);
+    return hipblasCsymmStridedBatched(handle,
+                                      side,
+                                      uplo,
+                                      m,
+                                      n,
+                                      alpha,
+                                      A,
+                                      lda,
+                                      strideA,
+                                      B,
+                                      ldb,
+                                      strideB,
+                                      beta,
+                                      C,
+                                      ldc,
+                                      strideC,
+                                      batchCount);
 }
 
 template <>
-hipblasStatus_t hipblasSyrkStridedBatched(hipblasHandle_t             handle,
+hipblasStatus_t hipblasSymmStridedBatched(hipblasHandle_t             handle,
+                                          hipblasSideMode_t           side,
                                           hipblasFillMode_t           uplo,
-                                          hipblasOperation_t          transA,
+                                          int                         m,
                                           int                         n,
-                                          int                         k,
                                           const hipblasDoubleComplex* alpha,
                                           const hipblasDoubleComplex* A,
                                           int                         lda,
                                           int                         strideA,
+                                          const hipblasDoubleComplex* B,
+                                          int                         ldb,
+                                          int                         strideB,
                                           const hipblasDoubleComplex* beta,
                                           hipblasDoubleComplex*       C,
                                           int                         ldc,
                                           int                         strideC,
                                           int                         batchCount)
 {
-    return hipblasZsyrkStridedBatched(
-        handle, uplo, transA, n, k, alpha, A, lda, strideA, beta, C, ldc, strideC, batchCount);
+    return hipblasZsymmStridedBatched(handle,
+                                      side,
+                                      uplo,
+                                      m,
+                                      n,
+                                      alpha,
+                                      A,
+                                      lda,
+                                      strideA,
+                                      B,
+                                      ldb,
+                                      strideB,
+                                      beta,
+                                      C,
+                                      ldc,
+                                      strideC,
+                                      batchCount);
 }
 
-// syr2k
+// syrk
 template <>
-hipblasStatus_t hipblasSyr2k(hipblasHandle_t    handle,
-                             hipblasFillMode_t  uplo,
-                             hipblasOperation_t transA,
-                             int                n,
-                             int                k,
-                             const float*       alpha,
-                             const float*       A,
-                             int                lda,
-                             const float*       B,
-                             int                ldb,
-                             const float*       beta,
-                             float*             C,
-                             int                ldc)
+hipblasStatus_t hipblasSyrk(hipblasHandle_t    handle,
+                            hipblasFillMode_t  uplo,
+                            hipblasOperation_t transA,
+                            int                n,
+                            int                k,
+                            const float*       alpha,
+                            const float*       A,
+                            int                lda,
+                            const float*       beta,
+                            float*             C,
+                            int                ldc)
 {
-    return hipblasSsyr2k(handle, uplo, transA, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+    return hipblasSsyrk(handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc);
 }
 
 template <>
-hipblasStatus_t hipblasSyr2k(hipblasHandle_t    handle,
-                             hipblasFillMode_t  uplo,
-                             hipblasOperation_t transA,
-                             int                n,
-                             int                k,
-                             const double*      alpha,
-                             const double*      A,
-                             int                lda,
-                             const double*      B,
-                             int                ldb,
-                             const double*      beta,
-                             double*            C,
-                             int                ldc)
+hipblasStatus_t hipblasSyrk(hipblasHandle_t    handle,
+                            hipblasFillMode_t  uplo,
+                            hipblasOperation_t transA,
+                            int                n,
+                            int                k,
+                            const double*      alpha,
+                            const double*      A,
+                            int                lda,
+                            const double*      beta,
+                            double*            C,
+                            int                ldc)
 {
-    return hipblasDsyr2k(handle, uplo, transA, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+    return hipblasDsyrk(handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc);
 }
 
 template <>
-hipblasStatus_t hipblasSyr2k(hipblasHandle_t       handle,
-                             hipblasFillMode_t     uplo,
-                             hipblasOperation_t    transA,
-                             int                   n,
-                             int                   k,
-                             const hipblasComplex* alpha,
-                             const hipblasComplex* A,
-                             int                   lda,
-                             const hipblasComplex* B,
-                             int                   ldb,
-                             const hipblasComplex* beta,
-                             hipblasComplex*       C,
-                             int                   ldc)
+hipblasStatus_t hipblasSyrk(hipblasHandle_t       handle,
+                            hipblasFillMode_t     uplo,
+                            hipblasOperation_t    transA,
+                            int                   n,
+                            int                   k,
+                            const hipblasComplex* alpha,
+                            const hipblasComplex* A,
+                            int                   lda,
+                            const hipblasComplex* beta,
+                            hipblasComplex*       C,
+                            int                   ldc)
 {
-    return hipblasCsyr2k(handle, uplo, transA, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+    return hipblasCsyrk(handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc);
 }
 
 template <>
-hipblasStatus_t hipblasSyr2k(hipblasHandle_t             handle,
-                             hipblasFillMode_t           uplo,
-                             hipblasOperation_t          transA,
-                             int                         n,
-                             int                         k,
-                             const hipblasDoubleComplex* alpha,
-                             const hipblasDoubleComplex* A,
-                             int                         lda,
-                             const hipblasDoubleComplex* B,
-                             int                         ldb,
-                             const hipblasDoubleComplex* beta,
-                             hipblasDoubleComplex*       C,
-                             int                         ldc)
+hipblasStatus_t hipblasSyrk(hipblasHandle_t             handle,
+                            hipblasFillMode_t           uplo,
+                            hipblasOperation_t          transA,
+                            int                         n,
+                            int                         k,
+                            const hipblasDoubleComplex* alpha,
+                            const hipblasDoubleComplex* A,
+                            int                         lda,
+                            const hipblasDoubleComplex* beta,
+                            hipblasDoubleComplex*       C,
+                            int                         ldc)
+{
+    return hipblasZsyrk(handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc);
+}
+
+// syrk_xt
+template <>
+hipblasStatus_t hipblasXtSyrk<float>(hipblasHandle_t    handle,
+                                     hipblasFillMode_t  uplo,
+                                     hipblasOperation_t transA,
+                                     int64_t            n,
+                                     int64_t            k,
+                                     const float*       alpha,
+                                     const float*       A,
+                                     int64_t            lda,
+                                     const float*       beta,
+                                     float*             C,
+                                     int64_t            ldc)
+{
+    return hipblasXtSsyrk(handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc);
+}
+
+template <>
+hipblasStatus_t hipblasXtSyrk<double>(hipblasHandle_t    handle,
+                                      hipblasFillMode_t  uplo,
+                                      hipblasOperation_t transA,
+                                      int64_t            n,
+                                      int64_t            k,
+                                      const double*      alpha,
+                                      const double*      A,
+                                      int64_t            lda,
+                                      const double*      beta,
+                                      double*            C,
+                                      int64_t            ldc)
+{
+    return hipblasXtDsyrk(handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc);
+}
+
+template <>
+hipblasStatus_t hipblasXtSyrk<hipblasComplex>(hipblasHandle_t       handle,
+                                              hipblasFillMode_t     uplo,
+                                              hipblasOperation_t    transA,
+                                              int64_t               n,
+                                              int64_t               k,
+                                              const hipblasComplex* alpha,
+                                              const hipblasComplex* A,
+                                              int64_t               lda,
+                                              const hipblasComplex* beta,
+                                              hipblasComplex*       C,
+                                              int64_t               ldc)
+{
+    return hipblasXtCsyrk(handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc);
+}
+
+template <>
+hipblasStatus_t hipblasXtSyrk<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                    hipblasFillMode_t           uplo,
+                                                    hipblasOperation_t          transA,
+                                                    int64_t                     n,
+                                                    int64_t                     k,
+                                                    const hipblasDoubleComplex* alpha,
+                                                    const hipblasDoubleComplex* A,
+                                                    int64_t                     lda,
+                                                    const hipblasDoubleComplex* beta,
+                                                    hipblasDoubleComplex*       C,
+                                                    int64_t                     ldc)
+{
+    return hipblasXtZsyrk(handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc);
+}
+
+// syrk_batched
+template <>
+hipblasStatus_t hipblasSyrkBatched(hipblasHandle_t    handle,
+                                   hipblasFillMode_t  uplo,
+                                   hipblasOperation_t transA,
+                                   int                n,
+                                   int                k,
+                                   const float*       alpha,
+                                   const float* const A[],
+                                   int                lda,
+                                   const float*       beta,
+                                   float* const       C[],
+                                   int                ldc,
+                                   int                batchCount)
+{
+    return hipblasSsyrkBatched(handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasSyrkBatched(hipblasHandle_t     handle,
+                                   hipblasFillMode_t   uplo,
+                                   hipblasOperation_t  transA,
+                                   int                 n,
+                                   int                 k,
+                                   const double*       alpha,
+                                   const double* const A[],
+                                   int                 lda,
+                                   const double*       beta,
+                                   double* const       C[],
+                                   int                 ldc,
+                                   int                 batchCount)
+{
+    return hipblasDsyrkBatched(handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasSyrkBatched(hipblasHandle_t             handle,
+                                   hipblasFillMode_t           uplo,
+                                   hipblasOperation_t          transA,
+                                   int                         n,
+                                   int                         k,
+                                   const hipblasComplex*       alpha,
+                                   const hipblasComplex* const A[],
+                                   int                         lda,
+                                   const hipblasComplex*       beta,
+                                   hipblasComplex* const       C[],
+                                   int                         ldc,
+                                   int                         batchCount)
+{
+    return hipblasCsyrkBatched(handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasSyrkBatched(hipblasHandle_t                   handle,
+                                   hipblasFillMode_t                 uplo,
+                                   hipblasOperation_t                transA,
+                                   int                               n,
+                                   int                               k,
+                                   const hipblasDoubleComplex*       alpha,
+                                   const hipblasDoubleComplex* const A[],
+                                   int                               lda,
+                                   const hipblasDoubleComplex*       beta,
+                                   hipblasDoubleComplex* const       C[],
+                                   int                               ldc,
+                                   int                               batchCount)
+{
+    return hipblasZsyrkBatched(handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc, batchCount);
+}
+
+// syrk_strided_batched
+template <>
+hipblasStatus_t hipblasSyrkStridedBatched(hipblasHandle_t    handle,
+                                          hipblasFillMode_t  uplo,
+                                          hipblasOperation_t transA,
+                                          int                n,
+                                          int                k,
+                                          const float*       alpha,
+                                          const float*       A,
+                                          int                lda,
+                                          int                strideA,
+                                          const float*       beta,
+                                          float*             C,
+                                          int                ldc,
+                                          int                strideC,
+                                          int                batchCount)
+{
+    return hipblasSsyrkStridedBatched(
+        handle, uplo, transA, n, k, alpha, A, lda, strideA, beta, C, ldc, strideC, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasSyrkStridedBatched(hipblasHandle_t    handle,
+                                          hipblasFillMode_t  uplo,
+                                          hipblasOperation_t transA,
+                                          int                n,
+                                          int                k,
+                                          const double*      alpha,
+                                          const double*      A,
+                                          int                lda,
+                                          int                strideA,
+                                          const double*      beta,
+                                          double*            C,
+                                          int                ldc,
+                                          int                strideC,
+                                          int                batchCount)
+{
+    return hipblasDsyrkStridedBatched(
+        handle, uplo, transA, n, k, alpha, A, lda, strideA, beta, C, ldc, strideC, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasSyrkStridedBatched(hipblasHandle_t       handle,
+                                          hipblasFillMode_t     uplo,
+                                          hipblasOperation_t    transA,
+                                          int                   n,
+                                          int                   k,
+                                          const hipblasComplex* alpha,
+                                          const hipblasComplex* A,
+                                          int                   lda,
+                                          int                   strideA,
+                                          const hipblasComplex* beta,
+                                          hipblasComplex*       C,
+                                          int                   ldc,
+                                          int                   strideC,
+                                          int                   batchCount)
+{
+    return hipblasCsyrkStridedBatched(
+        handle, uplo, transA, n, k, alpha, A, lda, strideA, beta, C, ldc, strideC, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasSyrkStridedBatched(hipblasHandle_t             handle,
+                                          hipblasFillMode_t           uplo,
+                                          hipblasOperation_t          transA,
+                                          int                         n,
+                                          int                         k,
+                                          const hipblasDoubleComplex* alpha,
+                                          const hipblasDoubleComplex* A,
+                                          int                         lda,
+                                          int                         strideA,
+                                          const hipblasDoubleComplex* beta,
+                                          hipblasDoubleComplex*       C,
+                                          int                         ldc,
+                                          int                         strideC,
+                                          int                         batchCount)
+{
+    return hipblasZsyrkStridedBatched(
+        handle, uplo, transA, n, k, alpha, A, lda, strideA, beta, C, ldc, strideC, batchCount);
+}
+
+// syr2k
+template <>
+hipblasStatus_t hipblasSyr2k(hipblasHandle_t    handle,
+                             hipblasFillMode_t  uplo,
+                             hipblasOperation_t transA,
+                             int                n,
+                             int                k,
+                             const float*       alpha,
+                             const float*       A,
+                             int                lda,
+                             const float*       B,
+                             int                ldb,
+                             const float*       beta,
+                             float*             C,
+                             int                ldc)
+{
+    return hipblasSsyr2k(handle, uplo, transA, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+template <>
+hipblasStatus_t hipblasSyr2k(hipblasHandle_t    handle,
+                             hipblasFillMode_t  uplo,
+                             hipblasOperation_t transA,
+                             int                n,
+                             int                k,
+                             const double*      alpha,
+                             const double*      A,
+                             int                lda,
+                             const double*      B,
+                             int                ldb,
+                             const double*      beta,
+                             double*            C,
+                             int                ldc)
+{
+    return hipblasDsyr2k(handle, uplo, transA, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+template <>
+hipblasStatus_t hipblasSyr2k(hipblasHandle_t       handle,
+                             hipblasFillMode_t     uplo,
+                             hipblasOperation_t    transA,
+                             int                   n,
+                             int                   k,
+                             const hipblasComplex* alpha,
+                             const hipblasComplex* A,
+                             int                   lda,
+                             const hipblasComplex* B,
+                             int                   ldb,
+                             const hipblasComplex* beta,
+                             hipblasComplex*       C,
+                             int                   ldc)
+{
+    return hipblasCsyr2k(handle, uplo, transA, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+template <>
+hipblasStatus_t hipblasSyr2k(hipblasHandle_t             handle,
+                             hipblasFillMode_t           uplo,
+                             hipblasOperation_t          transA,
+                             int                         n,
+                             int                         k,
+                             const hipblasDoubleComplex* alpha,
+                             const hipblasDoubleComplex* A,
+                             int                         lda,
+                             const hipblasDoubleComplex* B,
+                             int                         ldb,
+                             const hipblasDoubleComplex* beta,
+                             hipblasDoubleComplex*       C,
+                             int                         ldc)
 {
     return hipblasZsyr2k(handle, uplo, transA, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
 }
@@ -7371,13 +8849,216 @@ hipblasStatus_t hipblasTbmvStridedBatched<hipblasDoubleComplex>(hipblasHandle_t
         handle, uplo, transA, diag, m, k, A, lda, stride_a, x, incx, stride_x, batch_count);
 }
 
-// tpmv
+// tbsv
 template <>
-hipblasStatus_t hipblasTpmv(hipblasHandle_t    handle,
-                            hipblasFillMode_t  uplo,
-                            hipblasOperation_t transA,
-                            hipblasDiagType_t  diag,
-                            int                m,
+hipblasStatus_t hipblasTbsv<float>(hipblasHandle_t    handle,
+                                   hipblasFillMode_t  uplo,
+                                   hipblasOperation_t transA,
+                                   hipblasDiagType_t  diag,
+                                   int                n,
+                                   int                k,
+                                   const float*       A,
+                                   int                lda,
+                                   float*             x,
+                                   int                incx)
+{
+    return hipblasStbsv(handle, uplo, transA, diag, n, k, A, lda, x, incx);
+}
+
+template <>
+hipblasStatus_t hipblasTbsv<double>(hipblasHandle_t    handle,
+                                    hipblasFillMode_t  uplo,
+                                    hipblasOperation_t transA,
+                                    hipblasDiagType_t  diag,
+                                    int                n,
+                                    int                k,
+                                    const double*      A,
+                                    int                lda,
+                                    double*            x,
+                                    int                incx)
+{
+    return hipblasDtbsv(handle, uplo, transA, diag, n, k, A, lda, x, incx);
+}
+
+template <>
+hipblasStatus_t hipblasTbsv<hipblasComplex>(hipblasHandle_t       handle,
+                                            hipblasFillMode_t     uplo,
+                                            hipblasOperation_t    transA,
+                                            hipblasDiagType_t     diag,
+                                            int                   n,
+                                            int                   k,
+                                            const hipblasComplex* A,
+                                            int                   lda,
+                                            hipblasComplex*       x,
+                                            int                   incx)
+{
+    return hipblasCtbsv(handle, uplo, transA, diag, n, k, A, lda, x, incx);
+}
+
+template <>
+hipblasStatus_t hipblasTbsv<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                  hipblasFillMode_t           uplo,
+                                                  hipblasOperation_t          transA,
+                                                  hipblasDiagType_t           diag,
+                                                  int                         n,
+                                                  int                         k,
+                                                  const hipblasDoubleComplex* A,
+                                                  int                         lda,
+                                                  hipblasDoubleComplex*       x,
+                                                  int                         incx)
+{
+    return hipblasZtbsv(handle, uplo, transA, diag, n, k, A, lda, x, incx);
+}
+
+// tbsv_batched
+template <>
+hipblasStatus_t hipblasTbsvBatched<float>(hipblasHandle_t    handle,
+                                          hipblasFillMode_t  uplo,
+                                          hipblasOperation_t transA,
+                                          hipblasDiagType_t  diag,
+                                          int                n,
+                                          int                k,
+                                          const float* const A[],
+                                          int                lda,
+                                          float* const       x[],
+                                          int                incx,
+                                          int                batch_count)
+{
+    return hipblasStbsvBatched(handle, uplo, transA, diag, n, k, A, lda, x, incx, batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasTbsvBatched<double>(hipblasHandle_t     handle,
+                                           hipblasFillMode_t   uplo,
+                                           hipblasOperation_t  transA,
+                                           hipblasDiagType_t   diag,
+                                           int                 n,
+                                           int                 k,
+                                           const double* const A[],
+                                           int                 lda,
+                                           double* const       x[],
+                                           int                 incx,
+                                           int                 batch_count)
+{
+    return hipblasDtbsvBatched(handle, uplo, transA, diag, n, k, A, lda, x, incx, batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasTbsvBatched<hipblasComplex>(hipblasHandle_t             handle,
+                                                   hipblasFillMode_t           uplo,
+                                                   hipblasOperation_t          transA,
+                                                   hipblasDiagType_t           diag,
+                                                   int                         n,
+                                                   int                         k,
+                                                   const hipblasComplex* const A[],
+                                                   int                         lda,
+                                                   hipblasComplex* const       x[],
+                                                   int                         incx,
+                                                   int                         batch_count)
+{
+    return hipblasCtbsvBatched(handle, uplo, transA, diag, n, k, A, lda, x, incx, batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasTbsvBatched<hipblasDoubleComplex>(hipblasHandle_t                   handle,
+                                                         hipblasFillMode_t                 uplo,
+                                                         hipblasOperation_t                transA,
+                                                         hipblasDiagType_t                 diag,
+                                                         int                               n,
+                                                         int                               k,
+                                                         const hipblasDoubleComplex* const A[],
+                                                         int                               lda,
+                                                         hipblasDoubleComplex* const       x[],
+                                                         int                               incx,
+                                                         int batch_count)
+{
+    return hipblasZtbsvBatched(handle, uplo, transA, diag, n, k, A, lda, x, incx, batch_count);
+}
+
+// tbsv_strided_batched
+template <>
+hipblasStatus_t hipblasTbsvStridedBatched<float>(hipblasHandle_t    handle,
+                                                 hipblasFillMode_t  uplo,
+                                                 hipblasOperation_t transA,
+                                                 hipblasDiagType_t  diag,
+                                                 int                n,
+                                                 int                k,
+                                                 const float*       A,
+                                                 int                lda,
+                                                 int                stride_a,
+                                                 float*             x,
+                                                 int                incx,
+                                                 int                stride_x,
+                                                 int                batch_count)
+{
+    return hipblasStbsvStridedBatched(
+        handle, uplo, transA, diag, n, k, A, lda, stride_a, x, incx, stride_x, batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasTbsvStridedBatched<double>(hipblasHandle_t    handle,
+                                                  hipblasFillMode_t  uplo,
+                                                  hipblasOperation_t transA,
+                                                  hipblasDiagType_t  diag,
+                                                  int                n,
+                                                  int                k,
+                                                  const double*      A,
+                                                  int                lda,
+                                                  int                stride_a,
+                                                  double*            x,
+                                                  int                incx,
+                                                  int                stride_x,
+                                                  int                batch_count)
+{
+    return hipblasDtbsvStridedBatched(
+        handle, uplo, transA, diag, n, k, A, lda, stride_a, x, incx, stride_x, batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasTbsvStridedBatched<hipblasComplex>(hipblasHandle_t       handle,
+                                                          hipblasFillMode_t     uplo,
+                                                          hipblasOperation_t    transA,
+                                                          hipblasDiagType_t     diag,
+                                                          int                   n,
+                                                          int                   k,
+                                                          const hipblasComplex* A,
+                                                          int                   lda,
+                                                          int                   stride_a,
+                                                          hipblasComplex*       x,
+                                                          int                   incx,
+                                                          int                   stride_x,
+                                                          int                   batch_count)
+{
+    return hipblasCtbsvStridedBatched(
+        handle, uplo, transA, diag, n, k, A, lda, stride_a, x, incx, stride_x, batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasTbsvStridedBatched<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                                hipblasFillMode_t           uplo,
+                                                                hipblasOperation_t          transA,
+                                                                hipblasDiagType_t           diag,
+                                                                int                         n,
+                                                                int                         k,
+                                                                const hipblasDoubleComplex* A,
+                                                                int                         lda,
+                                                                int                   stride_a,
+                                                                hipblasDoubleComplex* x,
+                                                                int                   incx,
+                                                                int                   stride_x,
+                                                                int                   batch_count)
+{
+    return hipblasZtbsvStridedBatched(
+        handle, uplo, transA, diag, n, k, A, lda, stride_a, x, incx, stride_x, batch_count);
+}
+
+// tpmv
+template <>
+hipblasStatus_t hipblasTpmv(hipblasHandle_t    handle,
+                            hipblasFillMode_t  uplo,
+                            hipblasOperation_t transA,
+                            hipblasDiagType_t  diag,
+                            int                m,
                             const float*       AP,
                             float*             x,
                             int                incx)
@@ -7920,6 +9601,298 @@ hipblasStatus_t hipblasTrmvStridedBatched<hipblasDoubleComplex>(hipblasHandle_t
         handle, uplo, transA, diag, m, A, lda, stride_a, x, incx, stride_x, batch_count);
 }
 
+// trmm_outofplace
+template <>
+hipblasStatus_t hipblasTrmmOutOfPlace<float>(hipblasHandle_t    handle,
+                                             hipblasSideMode_t  side,
+                                             hipblasFillMode_t  uplo,
+                                             hipblasOperation_t transA,
+                                             hipblasDiagType_t  diag,
+                                             int                m,
+                                             int                n,
+                                             const float*       alpha,
+                                             const float*       A,
+                                             int                lda,
+                                             const float*       B,
+                                             int                ldb,
+                                             float*             C,
+                                             int                ldc)
+{
+    return hipblasStrmmOutOfPlace(handle,
+                                  side,
+                                  uplo,
+                                  transA,
+                                  diag,
+                                  m,
+                                  n,
+                                  alpha,
+                                  A,
+                                  lda,
+                                  B,
+                                  ldb,
+                                  C,
+                                  ldc);
+}
+
+template <>
+hipblasStatus_t hipblasTrmmOutOfPlace<double>(hipblasHandle_t    handle,
+                                              hipblasSideMode_t  side,
+                                              hipblasFillMode_t  uplo,
+                                              hipblasOperation_t transA,
+                                              hipblasDiagType_t  diag,
+                                              int                m,
+                                              int                n,
+                                              const double*      alpha,
+                                              const double*      A,
+                                              int                lda,
+                                              const double*      B,
+                                              int                ldb,
+                                              double*            C,
+                                              int                ldc)
+{
+    return hipblasDtrmmOutOfPlace(handle,
+                                  side,
+                                  uplo,
+                                  transA,
+                                  diag,
+                                  m,
+                                  n,
+                                  alpha,
+                                  A,
+                                  lda,
+                                  B,
+                                  ldb,
+                                  C,
+                                  ldc);
+}
+
+template <>
+hipblasStatus_t hipblasTrmmOutOfPlace<hipblasComplex>(hipblasHandle_t       handle,
+                                                      hipblasSideMode_t     side,
+                                                      hipblasFillMode_t     uplo,
+                                                      hipblasOperation_t    transA,
+                                                      hipblasDiagType_t     diag,
+                                                      int                   m,
+                                                      int                   n,
+                                                      const hipblasComplex* alpha,
+                                                      const hipblasComplex* A,
+                                                      int                   lda,
+                                                      const hipblasComplex* B,
+                                                      int                   ldb,
+                                                      hipblasComplex*       C,
+                                                      int                   ldc)
+{
+    return hipblasCtrmmOutOfPlace(handle,
+                                  side,
+                                  uplo,
+                                  transA,
+                                  diag,
+                                  m,
+                                  n,
+                                  alpha,
+                                  A,
+                                  lda,
+                                  B,
+                                  ldb,
+                                  C,
+                                  ldc);
+}
+
+template <>
+hipblasStatus_t hipblasTrmmOutOfPlace<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                            hipblasSideMode_t           side,
+                                                            hipblasFillMode_t           uplo,
+                                                            hipblasOperation_t          transA,
+                                                            hipblasDiagType_t           diag,
+                                                            int                         m,
+                                                            int                         n,
+                                                            const hipblasDoubleComplex* alpha,
+                                                            const hipblasDoubleComplex* A,
+                                                            int                         lda,
+                                                            const hipblasDoubleComplex* B,
+                                                            int                         ldb,
+                                                            hipblasDoubleComplex*       C,
+                                                            int                         ldc)
+{
+    return hipblasZtrmmOutOfPlace(handle,
+                                  side,
+                                  uplo,
+                                  transA,
+                                  diag,
+                                  m,
+                                  n,
+                                  alpha,
+                                  A,
+                                  lda,
+                                  B,
+                                  ldb,
+                                  C,
+                                  ldc);
+}
+
+// trmm_outofplace_strided_batched
+template <>
+hipblasStatus_t hipblasTrmmOutOfPlaceStridedBatched<float>(hipblasHandle_t    handle,
+                                                           hipblasSideMode_t  side,
+                                                           hipblasFillMode_t  uplo,
+                                                           hipblasOperation_t transA,
+                                                           hipblasDiagType_t  diag,
+                                                           int                m,
+                                                           int                n,
+                                                           const float*       alpha,
+                                                           const float*       A,
+                                                           int                lda,
+                                                           int                strideA,
+                                                           const float*       B,
+                                                           int                ldb,
+                                                           int                strideB,
+                                                           float*             C,
+                                                           int                ldc,
+                                                           int                strideC,
+                                                           int                batchCount)
+{
+    return hipblasStrmmOutOfPlaceStridedBatched(handle,
+                                                side,
+                                                uplo,
+                                                transA,
+                                                diag,
+                                                m,
+                                                n,
+                                                alpha,
+                                                A,
+                                                lda,
+                                                strideA,
+                                                B,
+                                                ldb,
+                                                strideB,
+                                                C,
+                                                ldc,
+                                                strideC,
+                                                batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasTrmmOutOfPlaceStridedBatched<double>(hipblasHandle_t    handle,
+                                                            hipblasSideMode_t  side,
+                                                            hipblasFillMode_t  uplo,
+                                                            hipblasOperation_t transA,
+                                                            hipblasDiagType_t  diag,
+                                                            int                m,
+                                                            int                n,
+                                                            const double*      alpha,
+                                                            const double*      A,
+                                                            int                lda,
+                                                            int                strideA,
+                                                            const double*      B,
+                                                            int                ldb,
+                                                            int                strideB,
+                                                            double*            C,
+                                                            int                ldc,
+                                                            int                strideC,
+                                                            int                batchCount)
+{
+    return hipblasDtrmmOutOfPlaceStridedBatched(handle,
+                                                side,
+                                                uplo,
+                                                transA,
+                                                diag,
+                                                m,
+                                                n,
+                                                alpha,
+                                                A,
+                                                lda,
+                                                strideA,
+                                                B,
+                                                ldb,
+                                                strideB,
+                                                C,
+                                                ldc,
+                                                strideC,
+                                                batchCount);
+}
+
+template <>
+hipblasStatus_t
+    hipblasTrmmOutOfPlaceStridedBatched<hipblasComplex>(hipblasHandle_t       handle,
+                                                        hipblasSideMode_t     side,
+                                                        hipblasFillMode_t     uplo,
+                                                        hipblasOperation_t    transA,
+                                                        hipblasDiagType_t     diag,
+                                                        int                   m,
+                                                        int                   n,
+                                                        const hipblasComplex* alpha,
+                                                        const hipblasComplex* A,
+                                                        int                   lda,
+                                                        int                   strideA,
+                                                        const hipblasComplex* B,
+                                                        int                   ldb,
+                                                        int                   strideB,
+                                                        hipblasComplex*       C,
+                                                        int                   ldc,
+                                                        int                   strideC,
+                                                        int                   batchCount)
+{
+    return hipblasCtrmmOutOfPlaceStridedBatched(handle,
+                                                side,
+                                                uplo,
+                                                transA,
+                                                diag,
+                                                m,
+                                                n,
+                                                alpha,
+                                                A,
+                                                lda,
+                                                strideA,
+                                                B,
+                                                ldb,
+                                                strideB,
+                                                C,
+                                                ldc,
+                                                strideC,
+                                                batchCount);
+}
+
+template <>
+hipblasStatus_t
+    hipblasTrmmOutOfPlaceStridedBatched<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                              hipblasSideMode_t           side,
+                                                              hipblasFillMode_t           uplo,
+                                                              hipblasOperation_t          transA,
+                                                              hipblasDiagType_t           diag,
+                                                              int                         m,
+                                                              int                         n,
+                                                              const hipblasDoubleComplex* alpha,
+                                                              const hipblasDoubleComplex* A,
+                                                              int                         lda,
+                                                              int                         strideA,
+                                                              const hipblasDoubleComplex* B,
+                                                              int                         ldb,
+                                                              int                         strideB,
+                                                              hipblasDoubleComplex*       C,
+                                                              int                         ldc,
+                                                              int                         strideC,
+                                                              int                         batchCount)
+{
+    return hipblasZtrmmOutOfPlaceStridedBatched(handle,
+                                                side,
+                                                uplo,
+                                                transA,
+                                                diag,
+                                                m,
+                                                n,
+                                                alpha,
+                                                A,
+                                                lda,
+                                                strideA,
+                                                B,
+                                                ldb,
+                                                strideB,
+                                                C,
+                                                ldc,
+                                                strideC,
+                                                batchCount);
+}
+
 // trsm
 template <>
 hipblasStatus_t hipblasTrsm<float>(hipblasHandle_t    handle,
@@ -7989,6 +9962,75 @@ hipblasStatus_t hipblasTrsm<hipblasDoubleComplex>(hipblasHandle_t             ha
     return hipblasZtrsm(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
 }
 
+// trsm_xt
+template <>
+hipblasStatus_t hipblasXtTrsm<float>(hipblasHandle_t    handle,
+                                     hipblasSideMode_t  side,
+                                     hipblasFillMode_t  uplo,
+                                     hipblasOperation_t transA,
+                                     hipblasDiagType_t  diag,
+                                     int64_t            m,
+                                     int64_t            n,
+                                     const float*       alpha,
+                                     const float*       A,
+                                     int64_t            lda,
+                                     float*             B,
+                                     int64_t            ldb)
+{
+    return hipblasXtStrsm(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
+}
+
+template <>
+hipblasStatus_t hipblasXtTrsm<double>(hipblasHandle_t    handle,
+                                      hipblasSideMode_t  side,
+                                      hipblasFillMode_t  uplo,
+                                      hipblasOperation_t transA,
+                                      hipblasDiagType_t  diag,
+                                      int64_t            m,
+                                      int64_t            n,
+                                      const double*      alpha,
+                                      const double*      A,
+                                      int64_t            lda,
+                                      double*            B,
+                                      int64_t            ldb)
+{
+    return hipblasXtDtrsm(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
+}
+
+template <>
+hipblasStatus_t hipblasXtTrsm<hipblasComplex>(hipblasHandle_t       handle,
+                                              hipblasSideMode_t     side,
+                                              hipblasFillMode_t     uplo,
+                                              hipblasOperation_t    transA,
+                                              hipblasDiagType_t     diag,
+                                              int64_t               m,
+                                              int64_t               n,
+                                              const hipblasComplex* alpha,
+                                              const hipblasComplex* A,
+                                              int64_t               lda,
+                                              hipblasComplex*       B,
+                                              int64_t               ldb)
+{
+    return hipblasXtCtrsm(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
+}
+
+template <>
+hipblasStatus_t hipblasXtTrsm<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                    hipblasSideMode_t           side,
+                                                    hipblasFillMode_t           uplo,
+                                                    hipblasOperation_t          transA,
+                                                    hipblasDiagType_t           diag,
+                                                    int64_t                     m,
+                                                    int64_t                     n,
+                                                    const hipblasDoubleComplex* alpha,
+                                                    const hipblasDoubleComplex* A,
+                                                    int64_t                     lda,
+                                                    hipblasDoubleComplex*       B,
+                                                    int64_t                     ldb)
+{
+    return hipblasXtZtrsm(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
+}
+
 // trsm_batched
 template <>
 hipblasStatus_t hipblasTrsmBatched<float>(hipblasHandle_t    handle,
@@ -8240,519 +10282,5553 @@ hipblasStatus_t hipblasGeam<double>(hipblasHandle_t    handle,
     return hipblasDgeam(handle, transA, transB, m, n, alpha, A, lda, beta, B, ldb, C, ldc);
 }
 
-#ifdef __HIP_PLATFORM_SOLVER__
-
-// getrf
 template <>
-hipblasStatus_t hipblasGetrf<float>(
-    hipblasHandle_t handle, const int n, float* A, const int lda, int* ipiv, int* info)
+hipblasStatus_t hipblasGeam<hipblasComplex>(hipblasHandle_t       handle,
+                                            hipblasOperation_t    transA,
+                                            hipblasOperation_t    transB,
+                                            int                   m,
+                                            int                   n,
+                                            const hipblasComplex* alpha,
+                                            const hipblasComplex* A,
+                                            int                   lda,
+                                            const hipblasComplex* beta,
+                                            const hipblasComplex* B,
+                                            int                   ldb,
+                                            hipblasComplex*       C,
+                                            int                   ldc)
 {
-    return hipblasSgetrf(handle, n, A, lda, ipiv, info);
+    return hipblasCgeam(handle, transA, transB, m, n, alpha, A, lda, beta, B, ldb, C, ldc);
 }
 
 template <>
-hipblasStatus_t hipblasGetrf<double>(
-    hipblasHandle_t handle, const int n, double* A, const int lda, int* ipiv, int* info)
+hipblasStatus_t hipblasGeam<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                  hipblasOperation_t          transA,
+                                                  hipblasOperation_t          transB,
+                                                  int                         m,
+                                                  int                         n,
+                                                  const hipblasDoubleComplex* alpha,
+                                                  const hipblasDoubleComplex* A,
+                                                  int                         lda,
+                                                  const hipblasDoubleComplex* beta,
+                                                  const hipblasDoubleComplex* B,
+                                                  int                         ldb,
+                                                  hipblasDoubleComplex*       C,
+                                                  int                         ldc)
 {
-    return hipblasDgetrf(handle, n, A, lda, ipiv, info);
+    return hipblasZgeam(handle, transA, transB, m, n, alpha, A, lda, beta, B, ldb, C, ldc);
 }
 
+// geam_batched
 template <>
-hipblasStatus_t hipblasGetrf<hipblasComplex>(
-    hipblasHandle_t handle, const int n, hipblasComplex* A, const int lda, int* ipiv, int* info)
+hipblasStatus_t hipblasGeamBatched(hipblasHandle_t    handle,
+                                   hipblasOperation_t transA,
+                                   hipblasOperation_t transB,
+                                   int                m,
+                                   int                n,
+                                   const float*       alpha,
+                                   const float* const A[],
+                                   int                lda,
+                                   const float*       beta,
+                                   const float* const B[],
+                                   int                ldb,
+                                   float* const       C[],
+                                   int                ldc,
+                                   int                batchCount)
+{
+    return hipblasSgeamBatched(
+        handle, transA, transB, m, n, alpha, A, lda, beta, B, ldb, C, ldc, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGeamBatched(hipblasHandle_t     handle,
+                                   hipblasOperation_t  transA,
+                                   hipblasOperation_t  transB,
+                                   int                 m,
+                                   int                 n,
+                                   const double*       alpha,
+                                   const double* const A[],
+                                   int                 lda,
+                                   const double*       beta,
+                                   const double* const B[],
+                                   int                 ldb,
+                                   double* const       C[],
+                                   int                 ldc,
+                                   int                 batchCount)
+{
+    return hipblasDgeamBatched(
+        handle, transA, transB, m, n, alpha, A, lda, beta, B, ldb, C, ldc, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGeamBatched(hipblasHandle_t             handle,
+                                   hipblasOperation_t          transA,
+                                   hipblasOperation_t          transB,
+                                   int                         m,
+                                   int                         n,
+                                   const hipblasComplex*       alpha,
+                                   const hipblasComplex* const A[],
+                                   int                         lda,
+                                   const hipblasComplex*       beta,
+                                   const hipblasComplex* const B[],
+                                   int                         ldb,
+                                   hipblasComplex* const       C[],
+                                   int                         ldc,
+                                   int                         batchCount)
+{
+    return hipblasCgeamBatched(
+        handle, transA, transB, m, n, alpha, A, lda, beta, B, ldb, C, ldc, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGeamBatched(hipblasHandle_t                   handle,
+                                   hipblasOperation_t                transA,
+                                   hipblasOperation_t                transB,
+                                   int                               m,
+                                   int                               n,
+                                   const hipblasDoubleComplex*       alpha,
+                                   const hipblasDoubleComplex* const A[],
+                                   int                               lda,
+                                   const hipblasDoubleComplex*       beta,
+                                   const hipblasDoubleComplex* const B[],
+                                   int                               ldb,
+                                   hipblasDoubleComplex* const       C[],
+                                   int                               ldc,
+                                   int                               batchCount)
+{
+    return hipblasZgeamBatched(
+        handle, transA, transB, m, n, alpha, A, lda, beta, B, ldb, C, ldc, batchCount);
+}
+
+// geam_strided_batched
+template <>
+hipblasStatus_t hipblasGeamStridedBatched(hipblasHandle_t    handle,
+                                          hipblasOperation_t transA,
+                                          hipblasOperation_t transB,
+                                          int                m,
+                                          int                n,
+                                          const float*       alpha,
+                                          const float*       A,
+                                          int                lda,
+                                          int                strideA,
+                                          const float*       beta,
+                                          const float*       B,
+                                          int                ldb,
+                                          int                strideB,
+                                          float*             C,
+                                          int                ldc,
+                                          int                strideC,
+                                          int                batchCount)
+{
+    return hipblasSgeamStridedBatched(handle,
+                                      transA,
+                                      transB,
+                                      m,
+                                      n,
+                                      alpha,
+                                      A,
+                                      lda,
+                                      strideA,
+                                      beta,
+                                      B,
+                                      ldb,
+                                      strideB,
+                                      C,
+                                      ldc,
+                                      strideC,
+                                      batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGeamStridedBatched(hipblasHandle_t    handle,
+                                          hipblasOperation_t transA,
+                                          hipblasOperation_t transB,
+                                          int                m,
+                                          int                n,
+                                          const double*      alpha,
+                                          const double*      A,
+                                          int                lda,
+                                          int                strideA,
+                                          const double*      beta,
+                                          const double*      B,
+                                          int                ldb,
+                                          int                strideB,
+                                          double*            C,
+                                          int                ldc,
+                                          int                strideC,
+                                          int                batchCount)
+{
+    return hipblasDgeamStridedBatched(handle,
+                                      transA,
+                                      transB,
+                                      m,
+                                      n,
+                                      alpha,
+                                      A,
+                                      lda,
+                                      strideA,
+                                      beta,
+                                      B,
+                                      ldb,
+                                      strideB,
+                                      C,
+                                      ldc,
+                                      strideC,
+                                      batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGeamStridedBatched(hipblasHandle_t       handle,
+                                          hipblasOperation_t    transA,
+                                          hipblasOperation_t    transB,
+                                          int                   m,
+                                          int                   n,
+                                          const hipblasComplex* alpha,
+                                          const hipblasComplex* A,
+                                          int                   lda,
+                                          int                   strideA,
+                                          const hipblasComplex* beta,
+                                          const hipblasComplex* B,
+                                          int                   ldb,
+                                          int                   strideB,
+                                          hipblasComplex*       C,
+                                          int                   ldc,
+                                          int                   strideC,
+                                          int                   batchCount)
+{
+    return hipblasCgeamStridedBatched(handle,
+                                      transA,
+                                      transB,
+                                      m,
+                                      n,
+                                      alpha,
+                                      A,
+                                      lda,
+                                      strideA,
+                                      beta,
+                                      B,
+                                      ldb,
+                                      strideB,
+                                      C,
+                                      ldc,
+                                      strideC,
+                                      batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGeamStridedBatched(hipblasHandle_t             handle,
+                                          hipblasOperation_t          transA,
+                                          hipblasOperation_t          transB,
+                                          int                         m,
+                                          int                         n,
+                                          const hipblasDoubleComplex* alpha,
+                                          const hipblasDoubleComplex* A,
+                                          int                         lda,
+                                          int                         strideA,
+                                          const hipblasDoubleComplex* beta,
+                                          const hipblasDoubleComplex* B,
+                                          int                         ldb,
+                                          int                         strideB,
+                                          hipblasDoubleComplex*       C,
+                                          int                         ldc,
+                                          int                         strideC,
+                                          int                         batchCount)
+{
+    return hipblasZgeamStridedBatched(handle,
+                                      transA,
+                                      transB,
+                                      m,
+                                      n,
+                                      alpha,
+                                      A,
+                                      lda,
+                                      strideA,
+                                      beta,
+                                      B,
+                                      ldb,
+                                      strideB,
+                                      C,
+                                      ldc,
+                                      strideC,
+                                      batchCount);
+}
+
+// trtri
+template <>
+hipblasStatus_t hipblasTrtri<float>(hipblasHandle_t   handle,
+                                    hipblasFillMode_t uplo,
+                                    hipblasDiagType_t diag,
+                                    int               n,
+                                    const float*      A,
+                                    int               lda,
+                                    float*            invA,
+                                    int               ldinvA)
+{
+    return hipblasStrtri(handle, uplo, diag, n, A, lda, invA, ldinvA);
+}
+
+template <>
+hipblasStatus_t hipblasTrtri<double>(hipblasHandle_t   handle,
+                                     hipblasFillMode_t uplo,
+                                     hipblasDiagType_t diag,
+                                     int               n,
+                                     const double*     A,
+                                     int               lda,
+                                     double*           invA,
+                                     int               ldinvA)
+{
+    return hipblasDtrtri(handle, uplo, diag, n, A, lda, invA, ldinvA);
+}
+
+template <>
+hipblasStatus_t hipblasTrtri<hipblasComplex>(hipblasHandle_t       handle,
+                                             hipblasFillMode_t     uplo,
+                                             hipblasDiagType_t     diag,
+                                             int                   n,
+                                             const hipblasComplex* A,
+                                             int                   lda,
+                                             hipblasComplex*       invA,
+                                             int                   ldinvA)
+{
+    return hipblasCtrtri(handle, uplo, diag, n, A, lda, invA, ldinvA);
+}
+
+template <>
+hipblasStatus_t hipblasTrtri<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                   hipblasFillMode_t           uplo,
+                                                   hipblasDiagType_t           diag,
+                                                   int                         n,
+                                                   const hipblasDoubleComplex* A,
+                                                   int                         lda,
+                                                   hipblasDoubleComplex*       invA,
+                                                   int                         ldinvA)
+{
+    return hipblasZtrtri(handle, uplo, diag, n, A, lda, invA, ldinvA);
+}
+
+// trtri_batched
+template <>
+hipblasStatus_t hipblasTrtriBatched<float>(hipblasHandle_t    handle,
+                                           hipblasFillMode_t  uplo,
+                                           hipblasDiagType_t  diag,
+                                           int                n,
+                                           const float* const A[],
+                                           int                lda,
+                                           float* const       invA[],
+                                           int                ldinvA,
+                                           int                batchCount)
+{
+    return hipblasStrtriBatched(handle, uplo, diag, n, A, lda, invA, ldinvA, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasTrtriBatched<double>(hipblasHandle_t     handle,
+                                            hipblasFillMode_t   uplo,
+                                            hipblasDiagType_t   diag,
+                                            int                 n,
+                                            const double* const A[],
+                                            int                 lda,
+                                            double* const       invA[],
+                                            int                 ldinvA,
+                                            int                 batchCount)
+{
+    return hipblasDtrtriBatched(handle, uplo, diag, n, A, lda, invA, ldinvA, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasTrtriBatched<hipblasComplex>(hipblasHandle_t             handle,
+                                                    hipblasFillMode_t           uplo,
+                                                    hipblasDiagType_t           diag,
+                                                    int                         n,
+                                                    const hipblasComplex* const A[],
+                                                    int                         lda,
+                                                    hipblasComplex* const       invA[],
+                                                    int                         ldinvA,
+                                                    int                         batchCount)
+{
+    return hipblasCtrtriBatched(handle, uplo, diag, n, A, lda, invA, ldinvA, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasTrtriBatched<hipblasDoubleComplex>(hipblasHandle_t                   handle,
+                                                          hipblasFillMode_t                 uplo,
+                                                          hipblasDiagType_t                 diag,
+                                                          int                               n,
+                                                          const hipblasDoubleComplex* const A[],
+                                                          int                               lda,
+                                                          hipblasDoubleComplex* const       invA[],
+                                                          int                               ldinvA,
+                                                          int                               batchCount)
+{
+    return hipblasZtrtriBatched(handle, uplo, diag, n, A, lda, invA, ldinvA, batchCount);
+}
+
+// trtri_strided_batched
+template <>
+hipblasStatus_t hipblasTrtriStridedBatched<float>(hipblasHandle_t   handle,
+                                                  hipblasFillMode_t uplo,
+                                                  hipblasDiagType_t diag,
+                                                  int               n,
+                                                  const float*      A,
+                                                  int               lda,
+                                                  int               strideA,
+                                                  float*            invA,
+                                                  int               ldinvA,
+                                                  int               strideInvA,
+                                                  int               batchCount)
+{
+    return hipblasStrtriStridedBatched(
+        handle, uplo, diag, n, A, lda, strideA, invA, ldinvA, strideInvA, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasTrtriStridedBatched<double>(hipblasHandle_t   handle,
+                                                   hipblasFillMode_t uplo,
+                                                   hipblasDiagType_t diag,
+                                                   int               n,
+                                                   const double*     A,
+                                                   int               lda,
+                                                   int               strideA,
+                                                   double*           invA,
+                                                   int               ldinvA,
+                                                   int               strideInvA,
+                                                   int               batchCount)
+{
+    return hipblasDtrtriStridedBatched(
+        handle, uplo, diag, n, A, lda, strideA, invA, ldinvA, strideInvA, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasTrtriStridedBatched<hipblasComplex>(hipblasHandle_t       handle,
+                                                           hipblasFillMode_t     uplo,
+                                                           hipblasDiagType_t     diag,
+                                                           int                   n,
+                                                           const hipblasComplex* A,
+                                                           int                   lda,
+                                                           int                   strideA,
+                                                           hipblasComplex*       invA,
+                                                           int                   ldinvA,
+                                                           int                   strideInvA,
+                                                           int                   batchCount)
+{
+    return hipblasCtrtriStridedBatched(
+        handle, uplo, diag, n, A, lda, strideA, invA, ldinvA, strideInvA, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasTrtriStridedBatched<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                                 hipblasFillMode_t           uplo,
+                                                                 hipblasDiagType_t           diag,
+                                                                 int                         n,
+                                                                 const hipblasDoubleComplex* A,
+                                                                 int                         lda,
+                                                                 int                         strideA,
+                                                                 hipblasDoubleComplex*       invA,
+                                                                 int                         ldinvA,
+                                                                 int                         strideInvA,
+                                                                 int                         batchCount)
+{
+    return hipblasZtrtriStridedBatched(
+        handle, uplo, diag, n, A, lda, strideA, invA, ldinvA, strideInvA, batchCount);
+}
+
+// gtsv_strided_batched
+template <>
+hipblasStatus_t hipblasGtsvStridedBatched<float>(hipblasHandle_t handle,
+                                                 const int       m,
+                                                 const float*    dl,
+                                                 const float*    d,
+                                                 const float*    du,
+                                                 float*          x,
+                                                 const int       stride,
+                                                 const int       batchCount)
+{
+    return hipblasSgtsvStridedBatched(handle, m, dl, d, du, x, stride, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGtsvStridedBatched<double>(hipblasHandle_t handle,
+                                                  const int       m,
+                                                  const double*   dl,
+                                                  const double*   d,
+                                                  const double*   du,
+                                                  double*         x,
+                                                  const int       stride,
+                                                  const int       batchCount)
+{
+    return hipblasDgtsvStridedBatched(handle, m, dl, d, du, x, stride, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGtsvStridedBatched<hipblasComplex>(hipblasHandle_t       handle,
+                                                          const int             m,
+                                                          const hipblasComplex* dl,
+                                                          const hipblasComplex* d,
+                                                          const hipblasComplex* du,
+                                                          hipblasComplex*       x,
+                                                          const int             stride,
+                                                          const int             batchCount)
+{
+    return hipblasCgtsvStridedBatched(handle, m, dl, d, du, x, stride, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGtsvStridedBatched<hipblasDoubleComplex>(
+    hipblasHandle_t             handle,
+    const int                   m,
+    const hipblasDoubleComplex* dl,
+    const hipblasDoubleComplex* d,
+    const hipblasDoubleComplex* du,
+    hipblasDoubleComplex*       x,
+    const int                   stride,
+    const int                   batchCount)
+{
+    return hipblasZgtsvStridedBatched(handle, m, dl, d, du, x, stride, batchCount);
+}
+
+// gtsv_interleaved_batched
+template <>
+hipblasStatus_t hipblasGtsvInterleavedBatched<float>(hipblasHandle_t handle,
+                                                     const int       m,
+                                                     const float*    dl,
+                                                     const float*    d,
+                                                     const float*    du,
+                                                     float*          x,
+                                                     const int       batchCount)
+{
+    return hipblasSgtsvInterleavedBatched(handle, m, dl, d, du, x, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGtsvInterleavedBatched<double>(hipblasHandle_t handle,
+                                                      const int       m,
+                                                      const double*   dl,
+                                                      const double*   d,
+                                                      const double*   du,
+                                                      double*         x,
+                                                      const int       batchCount)
+{
+    return hipblasDgtsvInterleavedBatched(handle, m, dl, d, du, x, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGtsvInterleavedBatched<hipblasComplex>(hipblasHandle_t       handle,
+                                                              const int             m,
+                                                              const hipblasComplex* dl,
+                                                              const hipblasComplex* d,
+                                                              const hipblasComplex* du,
+                                                              hipblasComplex*       x,
+                                                              const int             batchCount)
+{
+    return hipblasCgtsvInterleavedBatched(handle, m, dl, d, du, x, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGtsvInterleavedBatched<hipblasDoubleComplex>(
+    hipblasHandle_t             handle,
+    const int                   m,
+    const hipblasDoubleComplex* dl,
+    const hipblasDoubleComplex* d,
+    const hipblasDoubleComplex* du,
+    hipblasDoubleComplex*       x,
+    const int                   batchCount)
+{
+    return hipblasZgtsvInterleavedBatched(handle, m, dl, d, du, x, batchCount);
+}
+
+// pack_compact
+template <>
+hipblasStatus_t hipblasPackCompact<float>(hipblasHandle_t handle,
+                                          const int       m,
+                                          const int       n,
+                                          const float*    A,
+                                          const int       lda,
+                                          const int       strideA,
+                                          float*          Ac,
+                                          const int       ldac,
+                                          const int       batchCount)
+{
+    return hipblasSpackCompact(handle, m, n, A, lda, strideA, Ac, ldac, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasPackCompact<double>(hipblasHandle_t handle,
+                                           const int       m,
+                                           const int       n,
+                                           const double*   A,
+                                           const int       lda,
+                                           const int       strideA,
+                                           double*         Ac,
+                                           const int       ldac,
+                                           const int       batchCount)
+{
+    return hipblasDpackCompact(handle, m, n, A, lda, strideA, Ac, ldac, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasPackCompact<hipblasComplex>(hipblasHandle_t       handle,
+                                                   const int             m,
+                                                   const int             n,
+                                                   const hipblasComplex* A,
+                                                   const int             lda,
+                                                   const int             strideA,
+                                                   hipblasComplex*       Ac,
+                                                   const int             ldac,
+                                                   const int             batchCount)
+{
+    return hipblasCpackCompact(handle, m, n, A, lda, strideA, Ac, ldac, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasPackCompact<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                         const int                   m,
+                                                         const int                   n,
+                                                         const hipblasDoubleComplex* A,
+                                                         const int                   lda,
+                                                         const int                   strideA,
+                                                         hipblasDoubleComplex*       Ac,
+                                                         const int                   ldac,
+                                                         const int                   batchCount)
+{
+    return hipblasZpackCompact(handle, m, n, A, lda, strideA, Ac, ldac, batchCount);
+}
+
+// unpack_compact
+template <>
+hipblasStatus_t hipblasUnpackCompact<float>(hipblasHandle_t handle,
+                                            const int       m,
+                                            const int       n,
+                                            const float*    Ac,
+                                            const int       ldac,
+                                            float*          A,
+                                            const int       lda,
+                                            const int       strideA,
+                                            const int       batchCount)
+{
+    return hipblasSunpackCompact(handle, m, n, Ac, ldac, A, lda, strideA, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasUnpackCompact<double>(hipblasHandle_t handle,
+                                             const int       m,
+                                             const int       n,
+                                             const double*   Ac,
+                                             const int       ldac,
+                                             double*         A,
+                                             const int       lda,
+                                             const int       strideA,
+                                             const int       batchCount)
+{
+    return hipblasDunpackCompact(handle, m, n, Ac, ldac, A, lda, strideA, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasUnpackCompact<hipblasComplex>(hipblasHandle_t       handle,
+                                                     const int             m,
+                                                     const int             n,
+                                                     const hipblasComplex* Ac,
+                                                     const int             ldac,
+                                                     hipblasComplex*       A,
+                                                     const int             lda,
+                                                     const int             strideA,
+                                                     const int             batchCount)
+{
+    return hipblasCunpackCompact(handle, m, n, Ac, ldac, A, lda, strideA, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasUnpackCompact<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                           const int                   m,
+                                                           const int                   n,
+                                                           const hipblasDoubleComplex* Ac,
+                                                           const int                   ldac,
+                                                           hipblasDoubleComplex*       A,
+                                                           const int                   lda,
+                                                           const int                   strideA,
+                                                           const int                   batchCount)
+{
+    return hipblasZunpackCompact(handle, m, n, Ac, ldac, A, lda, strideA, batchCount);
+}
+
+// gemm_compact
+template <>
+hipblasStatus_t hipblasGemmCompact<float>(hipblasHandle_t    handle,
+                                          hipblasOperation_t transA,
+                                          hipblasOperation_t transB,
+                                          const int          m,
+                                          const int          n,
+                                          const int          k,
+                                          const float*       alpha,
+                                          const float*       A,
+                                          const int          lda,
+                                          const float*       B,
+                                          const int          ldb,
+                                          const float*       beta,
+                                          float*             C,
+                                          const int          ldc,
+                                          const int          batchCount)
+{
+    return hipblasSgemmCompact(handle,
+                               transA,
+                               transB,
+                               m,
+                               n,
+                               k,
+                               alpha,
+                               A,
+                               lda,
+                               B,
+                               ldb,
+                               beta,
+                               C,
+                               ldc,
+                               batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGemmCompact<double>(hipblasHandle_t    handle,
+                                           hipblasOperation_t transA,
+                                           hipblasOperation_t transB,
+                                           const int          m,
+                                           const int          n,
+                                           const int          k,
+                                           const double*      alpha,
+                                           const double*      A,
+                                           const int          lda,
+                                           const double*      B,
+                                           const int          ldb,
+                                           const double*      beta,
+                                           double*            C,
+                                           const int          ldc,
+                                           const int          batchCount)
+{
+    return hipblasDgemmCompact(handle,
+                               transA,
+                               transB,
+                               m,
+                               n,
+                               k,
+                               alpha,
+                               A,
+                               lda,
+                               B,
+                               ldb,
+                               beta,
+                               C,
+                               ldc,
+                               batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGemmCompact<hipblasComplex>(hipblasHandle_t       handle,
+                                                   hipblasOperation_t    transA,
+                                                   hipblasOperation_t    transB,
+                                                   const int             m,
+                                                   const int             n,
+                                                   const int             k,
+                                                   const hipblasComplex* alpha,
+                                                   const hipblasComplex* A,
+                                                   const int             lda,
+                                                   const hipblasComplex* B,
+                                                   const int             ldb,
+                                                   const hipblasComplex* beta,
+                                                   hipblasComplex*       C,
+                                                   const int             ldc,
+                                                   const int             batchCount)
+{
+    return hipblasCgemmCompact(handle,
+                               transA,
+                               transB,
+                               m,
+                               n,
+                               k,
+                               alpha,
+                               A,
+                               lda,
+                               B,
+                               ldb,
+                               beta,
+                               C,
+                               ldc,
+                               batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGemmCompact<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                         hipblasOperation_t          transA,
+                                                         hipblasOperation_t          transB,
+                                                         const int                   m,
+                                                         const int                   n,
+                                                         const int                   k,
+                                                         const hipblasDoubleComplex* alpha,
+                                                         const hipblasDoubleComplex* A,
+                                                         const int                   lda,
+                                                         const hipblasDoubleComplex* B,
+                                                         const int                   ldb,
+                                                         const hipblasDoubleComplex* beta,
+                                                         hipblasDoubleComplex*       C,
+                                                         const int                   ldc,
+                                                         const int                   batchCount)
+{
+    return hipblasZgemmCompact(handle,
+                               transA,
+                               transB,
+                               m,
+                               n,
+                               k,
+                               alpha,
+                               A,
+                               lda,
+                               B,
+                               ldb,
+                               beta,
+                               C,
+                               ldc,
+                               batchCount);
+}
+
+// trsm_compact
+template <>
+hipblasStatus_t hipblasTrsmCompact<float>(hipblasHandle_t    handle,
+                                          hipblasSideMode_t  side,
+                                          hipblasFillMode_t  uplo,
+                                          hipblasOperation_t transA,
+                                          hipblasDiagType_t  diag,
+                                          const int          m,
+                                          const int          n,
+                                          const float*       alpha,
+                                          const float*       A,
+                                          const int          lda,
+                                          float*             B,
+                                          const int          ldb,
+                                          const int          batchCount)
+{
+    return hipblasStrsmCompact(handle,
+                               side,
+                               uplo,
+                               transA,
+                               diag,
+                               m,
+                               n,
+                               alpha,
+                               A,
+                               lda,
+                               B,
+                               ldb,
+                               batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasTrsmCompact<double>(hipblasHandle_t    handle,
+                                           hipblasSideMode_t  side,
+                                           hipblasFillMode_t  uplo,
+                                           hipblasOperation_t transA,
+                                           hipblasDiagType_t  diag,
+                                           const int          m,
+                                           const int          n,
+                                           const double*      alpha,
+                                           const double*      A,
+                                           const int          lda,
+                                           double*            B,
+                                           const int          ldb,
+                                           const int          batchCount)
+{
+    return hipblasDtrsmCompact(handle,
+                               side,
+                               uplo,
+                               transA,
+                               diag,
+                               m,
+                               n,
+                               alpha,
+                               A,
+                               lda,
+                               B,
+                               ldb,
+                               batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasTrsmCompact<hipblasComplex>(hipblasHandle_t       handle,
+                                                   hipblasSideMode_t     side,
+                                                   hipblasFillMode_t     uplo,
+                                                   hipblasOperation_t    transA,
+                                                   hipblasDiagType_t     diag,
+                                                   const int             m,
+                                                   const int             n,
+                                                   const hipblasComplex* alpha,
+                                                   const hipblasComplex* A,
+                                                   const int             lda,
+                                                   hipblasComplex*       B,
+                                                   const int             ldb,
+                                                   const int             batchCount)
+{
+    return hipblasCtrsmCompact(handle,
+                               side,
+                               uplo,
+                               transA,
+                               diag,
+                               m,
+                               n,
+                               alpha,
+                               A,
+                               lda,
+                               B,
+                               ldb,
+                               batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasTrsmCompact<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                         hipblasSideMode_t           side,
+                                                         hipblasFillMode_t           uplo,
+                                                         hipblasOperation_t          transA,
+                                                         hipblasDiagType_t           diag,
+                                                         const int                   m,
+                                                         const int                   n,
+                                                         const hipblasDoubleComplex* alpha,
+                                                         const hipblasDoubleComplex* A,
+                                                         const int                   lda,
+                                                         hipblasDoubleComplex*       B,
+                                                         const int                   ldb,
+                                                         const int                   batchCount)
+{
+    return hipblasZtrsmCompact(handle,
+                               side,
+                               uplo,
+                               transA,
+                               diag,
+                               m,
+                               n,
+                               alpha,
+                               A,
+                               lda,
+                               B,
+                               ldb,
+                               batchCount);
+}
+
+// getrf_compact
+template <>
+hipblasStatus_t hipblasGetrfCompact<float>(hipblasHandle_t handle,
+                                           const int       n,
+                                           float*          A,
+                                           const int       lda,
+                                           int*            ipiv,
+                                           int*            info,
+                                           const int       batchCount)
+{
+    return hipblasSgetrfCompact(handle, n, A, lda, ipiv, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGetrfCompact<double>(hipblasHandle_t handle,
+                                            const int       n,
+                                            double*         A,
+                                            const int       lda,
+                                            int*            ipiv,
+                                            int*            info,
+                                            const int       batchCount)
+{
+    return hipblasDgetrfCompact(handle, n, A, lda, ipiv, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGetrfCompact<hipblasComplex>(hipblasHandle_t handle,
+                                                    const int       n,
+                                                    hipblasComplex* A,
+                                                    const int       lda,
+                                                    int*            ipiv,
+                                                    int*            info,
+                                                    const int       batchCount)
+{
+    return hipblasCgetrfCompact(handle, n, A, lda, ipiv, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGetrfCompact<hipblasDoubleComplex>(hipblasHandle_t       handle,
+                                                          const int             n,
+                                                          hipblasDoubleComplex* A,
+                                                          const int             lda,
+                                                          int*                  ipiv,
+                                                          int*                  info,
+                                                          const int             batchCount)
+{
+    return hipblasZgetrfCompact(handle, n, A, lda, ipiv, info, batchCount);
+}
+
+// getrs_compact
+template <>
+hipblasStatus_t hipblasGetrsCompact<float>(hipblasHandle_t          handle,
+                                           const hipblasOperation_t trans,
+                                           const int                n,
+                                           const int                nrhs,
+                                           const float*             A,
+                                           const int                lda,
+                                           const int*               ipiv,
+                                           float*                   B,
+                                           const int                ldb,
+                                           const int                batchCount)
+{
+    return hipblasSgetrsCompact(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGetrsCompact<double>(hipblasHandle_t          handle,
+                                            const hipblasOperation_t trans,
+                                            const int                n,
+                                            const int                nrhs,
+                                            const double*            A,
+                                            const int                lda,
+                                            const int*               ipiv,
+                                            double*                  B,
+                                            const int                ldb,
+                                            const int                batchCount)
+{
+    return hipblasDgetrsCompact(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGetrsCompact<hipblasComplex>(hipblasHandle_t          handle,
+                                                    const hipblasOperation_t trans,
+                                                    const int                n,
+                                                    const int                nrhs,
+                                                    const hipblasComplex*    A,
+                                                    const int                lda,
+                                                    const int*               ipiv,
+                                                    hipblasComplex*          B,
+                                                    const int                ldb,
+                                                    const int                batchCount)
+{
+    return hipblasCgetrsCompact(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGetrsCompact<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                          const hipblasOperation_t    trans,
+                                                          const int                   n,
+                                                          const int                   nrhs,
+                                                          const hipblasDoubleComplex* A,
+                                                          const int                   lda,
+                                                          const int*                  ipiv,
+                                                          hipblasDoubleComplex*       B,
+                                                          const int                   ldb,
+                                                          const int                   batchCount)
+{
+    return hipblasZgetrsCompact(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, batchCount);
+}
+
+// gemv_vbatched
+template <>
+hipblasStatus_t hipblasGemvVbatched<float>(hipblasHandle_t    handle,
+                                           hipblasOperation_t trans,
+                                           const int          m[],
+                                           const int          n[],
+                                           const float*       alpha,
+                                           const float* const A[],
+                                           const int          lda[],
+                                           const float* const x[],
+                                           const int          incx[],
+                                           const float*       beta,
+                                           float* const       y[],
+                                           const int          incy[],
+                                           int                batchCount)
+{
+    return hipblasSgemvVbatched(handle,
+                                trans,
+                                m,
+                                n,
+                                alpha,
+                                A,
+                                lda,
+                                x,
+                                incx,
+                                beta,
+                                y,
+                                incy,
+                                batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGemvVbatched<double>(hipblasHandle_t     handle,
+                                            hipblasOperation_t  trans,
+                                            const int           m[],
+                                            const int           n[],
+                                            const double*       alpha,
+                                            const double* const A[],
+                                            const int           lda[],
+                                            const double* const x[],
+                                            const int           incx[],
+                                            const double*       beta,
+                                            double* const       y[],
+                                            const int           incy[],
+                                            int                 batchCount)
+{
+    return hipblasDgemvVbatched(handle,
+                                trans,
+                                m,
+                                n,
+                                alpha,
+                                A,
+                                lda,
+                                x,
+                                incx,
+                                beta,
+                                y,
+                                incy,
+                                batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGemvVbatched<hipblasComplex>(hipblasHandle_t             handle,
+                                                    hipblasOperation_t          trans,
+                                                    const int                   m[],
+                                                    const int                   n[],
+                                                    const hipblasComplex*       alpha,
+                                                    const hipblasComplex* const A[],
+                                                    const int                   lda[],
+                                                    const hipblasComplex* const x[],
+                                                    const int                   incx[],
+                                                    const hipblasComplex*       beta,
+                                                    hipblasComplex* const       y[],
+                                                    const int                   incy[],
+                                                    int                         batchCount)
+{
+    return hipblasCgemvVbatched(handle,
+                                trans,
+                                m,
+                                n,
+                                alpha,
+                                A,
+                                lda,
+                                x,
+                                incx,
+                                beta,
+                                y,
+                                incy,
+                                batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGemvVbatched<hipblasDoubleComplex>(
+    hipblasHandle_t                   handle,
+    hipblasOperation_t                trans,
+    const int                         m[],
+    const int                         n[],
+    const hipblasDoubleComplex*       alpha,
+    const hipblasDoubleComplex* const A[],
+    const int                         lda[],
+    const hipblasDoubleComplex* const x[],
+    const int                         incx[],
+    const hipblasDoubleComplex*       beta,
+    hipblasDoubleComplex* const       y[],
+    const int                         incy[],
+    int                               batchCount)
+{
+    return hipblasZgemvVbatched(handle,
+                                trans,
+                                m,
+                                n,
+                                alpha,
+                                A,
+                                lda,
+                                x,
+                                incx,
+                                beta,
+                                y,
+                                incy,
+                                batchCount);
+}
+
+// trsv_vbatched
+template <>
+hipblasStatus_t hipblasTrsvVbatched<float>(hipblasHandle_t    handle,
+                                           hipblasFillMode_t  uplo,
+                                           hipblasOperation_t transA,
+                                           hipblasDiagType_t  diag,
+                                           const int          n[],
+                                           const float* const A[],
+                                           const int          lda[],
+                                           float* const       x[],
+                                           const int          incx[],
+                                           int                batchCount)
+{
+    return hipblasStrsvVbatched(handle, uplo, transA, diag, n, A, lda, x, incx, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasTrsvVbatched<double>(hipblasHandle_t     handle,
+                                            hipblasFillMode_t   uplo,
+                                            hipblasOperation_t  transA,
+                                            hipblasDiagType_t   diag,
+                                            const int           n[],
+                                            const double* const A[],
+                                            const int           lda[],
+                                            double* const       x[],
+                                            const int           incx[],
+                                            int                 batchCount)
+{
+    return hipblasDtrsvVbatched(handle, uplo, transA, diag, n, A, lda, x, incx, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasTrsvVbatched<hipblasComplex>(hipblasHandle_t             handle,
+                                                    hipblasFillMode_t           uplo,
+                                                    hipblasOperation_t          transA,
+                                                    hipblasDiagType_t           diag,
+                                                    const int                   n[],
+                                                    const hipblasComplex* const A[],
+                                                    const int                   lda[],
+                                                    hipblasComplex* const       x[],
+                                                    const int                   incx[],
+                                                    int                         batchCount)
+{
+    return hipblasCtrsvVbatched(handle, uplo, transA, diag, n, A, lda, x, incx, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasTrsvVbatched<hipblasDoubleComplex>(
+    hipblasHandle_t                   handle,
+    hipblasFillMode_t                 uplo,
+    hipblasOperation_t                transA,
+    hipblasDiagType_t                 diag,
+    const int                         n[],
+    const hipblasDoubleComplex* const A[],
+    const int                         lda[],
+    hipblasDoubleComplex* const       x[],
+    const int                         incx[],
+    int                               batchCount)
+{
+    return hipblasZtrsvVbatched(handle, uplo, transA, diag, n, A, lda, x, incx, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGetrfVbatched<float>(hipblasHandle_t handle,
+                                            const int       n[],
+                                            float* const    A[],
+                                            const int       lda[],
+                                            int* const      ipiv[],
+                                            int             info[],
+                                            int             batchCount)
+{
+    return hipblasSgetrfVbatched(handle, n, A, lda, ipiv, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGetrfVbatched<double>(hipblasHandle_t handle,
+                                             const int       n[],
+                                             double* const   A[],
+                                             const int       lda[],
+                                             int* const      ipiv[],
+                                             int             info[],
+                                             int             batchCount)
+{
+    return hipblasDgetrfVbatched(handle, n, A, lda, ipiv, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGetrfVbatched<hipblasComplex>(hipblasHandle_t       handle,
+                                                     const int             n[],
+                                                     hipblasComplex* const A[],
+                                                     const int             lda[],
+                                                     int* const            ipiv[],
+                                                     int                   info[],
+                                                     int                   batchCount)
+{
+    return hipblasCgetrfVbatched(handle, n, A, lda, ipiv, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGetrfVbatched<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                           const int                   n[],
+                                                           hipblasDoubleComplex* const A[],
+                                                           const int                   lda[],
+                                                           int* const                  ipiv[],
+                                                           int                         info[],
+                                                           int                         batchCount)
+{
+    return hipblasZgetrfVbatched(handle, n, A, lda, ipiv, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGetrsVbatched<float>(hipblasHandle_t    handle,
+                                            hipblasOperation_t trans,
+                                            const int          n[],
+                                            const int          nrhs[],
+                                            const float* const A[],
+                                            const int          lda[],
+                                            const int* const   ipiv[],
+                                            float* const       B[],
+                                            const int          ldb[],
+                                            int*               info,
+                                            int                batchCount)
+{
+    return hipblasSgetrsVbatched(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGetrsVbatched<double>(hipblasHandle_t     handle,
+                                             hipblasOperation_t  trans,
+                                             const int           n[],
+                                             const int           nrhs[],
+                                             const double* const A[],
+                                             const int           lda[],
+                                             const int* const    ipiv[],
+                                             double* const       B[],
+                                             const int           ldb[],
+                                             int*                info,
+                                             int                 batchCount)
+{
+    return hipblasDgetrsVbatched(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGetrsVbatched<hipblasComplex>(hipblasHandle_t             handle,
+                                                     hipblasOperation_t          trans,
+                                                     const int                   n[],
+                                                     const int                   nrhs[],
+                                                     const hipblasComplex* const A[],
+                                                     const int                   lda[],
+                                                     const int* const            ipiv[],
+                                                     hipblasComplex* const       B[],
+                                                     const int                   ldb[],
+                                                     int*                        info,
+                                                     int                         batchCount)
+{
+    return hipblasCgetrsVbatched(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGetrsVbatched<hipblasDoubleComplex>(
+    hipblasHandle_t                   handle,
+    hipblasOperation_t                trans,
+    const int                         n[],
+    const int                         nrhs[],
+    const hipblasDoubleComplex* const A[],
+    const int                         lda[],
+    const int* const                  ipiv[],
+    hipblasDoubleComplex* const       B[],
+    const int                         ldb[],
+    int*                              info,
+    int                               batchCount)
+{
+    return hipblasZgetrsVbatched(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasTrsmVbatched<float>(hipblasHandle_t    handle,
+                                           hipblasSideMode_t  side,
+                                           hipblasFillMode_t  uplo,
+                                           hipblasOperation_t transA,
+                                           hipblasDiagType_t  diag,
+                                           const int          m[],
+                                           const int          n[],
+                                           const float*       alpha,
+                                           const float* const A[],
+                                           const int          lda[],
+                                           float* const       B[],
+                                           const int          ldb[],
+                                           int                batchCount)
+{
+    return hipblasStrsmVbatched(handle,
+                                side,
+                                uplo,
+                                transA,
+                                diag,
+                                m,
+                                n,
+                                alpha,
+                                A,
+                                lda,
+                                B,
+                                ldb,
+                                batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasTrsmVbatched<double>(hipblasHandle_t     handle,
+                                            hipblasSideMode_t   side,
+                                            hipblasFillMode_t   uplo,
+                                            hipblasOperation_t  transA,
+                                            hipblasDiagType_t   diag,
+                                            const int           m[],
+                                            const int           n[],
+                                            const double*       alpha,
+                                            const double* const A[],
+                                            const int           lda[],
+                                            double* const       B[],
+                                            const int           ldb[],
+                                            int                 batchCount)
+{
+    return hipblasDtrsmVbatched(handle,
+                                side,
+                                uplo,
+                                transA,
+                                diag,
+                                m,
+                                n,
+                                alpha,
+                                A,
+                                lda,
+                                B,
+                                ldb,
+                                batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasTrsmVbatched<hipblasComplex>(hipblasHandle_t             handle,
+                                                    hipblasSideMode_t           side,
+                                                    hipblasFillMode_t           uplo,
+                                                    hipblasOperation_t          transA,
+                                                    hipblasDiagType_t           diag,
+                                                    const int                   m[],
+                                                    const int                   n[],
+                                                    const hipblasComplex*       alpha,
+                                                    const hipblasComplex* const A[],
+                                                    const int                   lda[],
+                                                    hipblasComplex* const       B[],
+                                                    const int                   ldb[],
+                                                    int                         batchCount)
+{
+    return hipblasCtrsmVbatched(handle,
+                                side,
+                                uplo,
+                                transA,
+                                diag,
+                                m,
+                                n,
+                                alpha,
+                                A,
+                                lda,
+                                B,
+                                ldb,
+                                batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasTrsmVbatched<hipblasDoubleComplex>(
+    hipblasHandle_t                   handle,
+    hipblasSideMode_t                 side,
+    hipblasFillMode_t                 uplo,
+    hipblasOperation_t                transA,
+    hipblasDiagType_t                 diag,
+    const int                         m[],
+    const int                         n[],
+    const hipblasDoubleComplex*       alpha,
+    const hipblasDoubleComplex* const A[],
+    const int                         lda[],
+    hipblasDoubleComplex* const       B[],
+    const int                         ldb[],
+    int                               batchCount)
+{
+    return hipblasZtrsmVbatched(handle,
+                                side,
+                                uplo,
+                                transA,
+                                diag,
+                                m,
+                                n,
+                                alpha,
+                                A,
+                                lda,
+                                B,
+                                ldb,
+                                batchCount);
+}
+
+// nrm2_vbatched
+template <>
+hipblasStatus_t hipblasNrm2Vbatched<float, float>(hipblasHandle_t    handle,
+                                                  const int          n[],
+                                                  const float* const x[],
+                                                  const int          incx[],
+                                                  int                batchCount,
+                                                  float*             norms,
+                                                  float*             result)
+{
+    return hipblasSnrm2Vbatched(handle, n, x, incx, batchCount, norms, result);
+}
+
+template <>
+hipblasStatus_t hipblasNrm2Vbatched<double, double>(hipblasHandle_t     handle,
+                                                    const int           n[],
+                                                    const double* const x[],
+                                                    const int           incx[],
+                                                    int                 batchCount,
+                                                    double*             norms,
+                                                    double*             result)
+{
+    return hipblasDnrm2Vbatched(handle, n, x, incx, batchCount, norms, result);
+}
+
+template <>
+hipblasStatus_t hipblasNrm2Vbatched<hipblasComplex, float>(hipblasHandle_t             handle,
+                                                           const int                   n[],
+                                                           const hipblasComplex* const x[],
+                                                           const int                   incx[],
+                                                           int                         batchCount,
+                                                           float*                      norms,
+                                                           float*                      result)
+{
+    return hipblasScnrm2Vbatched(handle, n, x, incx, batchCount, norms, result);
+}
+
+template <>
+hipblasStatus_t hipblasNrm2Vbatched<hipblasDoubleComplex, double>(
+    hipblasHandle_t                   handle,
+    const int                         n[],
+    const hipblasDoubleComplex* const x[],
+    const int                         incx[],
+    int                               batchCount,
+    double*                           norms,
+    double*                           result)
+{
+    return hipblasDznrm2Vbatched(handle, n, x, incx, batchCount, norms, result);
+}
+
+// trttp
+template <>
+hipblasStatus_t hipblasTrttp<float>(hipblasHandle_t         handle,
+                                    const hipblasFillMode_t uplo,
+                                    const int               n,
+                                    const float*            A,
+                                    const int               lda,
+                                    float*                  AP)
+{
+    return hipblasStrttp(handle, uplo, n, A, lda, AP);
+}
+
+template <>
+hipblasStatus_t hipblasTrttp<double>(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     const double*           A,
+                                     const int               lda,
+                                     double*                 AP)
+{
+    return hipblasDtrttp(handle, uplo, n, A, lda, AP);
+}
+
+template <>
+hipblasStatus_t hipblasTrttp<hipblasComplex>(hipblasHandle_t         handle,
+                                             const hipblasFillMode_t uplo,
+                                             const int               n,
+                                             const hipblasComplex*   A,
+                                             const int               lda,
+                                             hipblasComplex*         AP)
+{
+    return hipblasCtrttp(handle, uplo, n, A, lda, AP);
+}
+
+template <>
+hipblasStatus_t hipblasTrttp<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                   const hipblasFillMode_t     uplo,
+                                                   const int                   n,
+                                                   const hipblasDoubleComplex* A,
+                                                   const int                   lda,
+                                                   hipblasDoubleComplex*       AP)
+{
+    return hipblasZtrttp(handle, uplo, n, A, lda, AP);
+}
+
+// trttp_batched
+template <>
+hipblasStatus_t hipblasTrttpBatched<float>(hipblasHandle_t         handle,
+                                           const hipblasFillMode_t uplo,
+                                           const int               n,
+                                           const float* const      A[],
+                                           const int               lda,
+                                           float* const            AP[],
+                                           const int               batchCount)
+{
+    return hipblasStrttpBatched(handle, uplo, n, A, lda, AP, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasTrttpBatched<double>(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            const double* const     A[],
+                                            const int               lda,
+                                            double* const           AP[],
+                                            const int               batchCount)
+{
+    return hipblasDtrttpBatched(handle, uplo, n, A, lda, AP, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasTrttpBatched<hipblasComplex>(hipblasHandle_t             handle,
+                                                    const hipblasFillMode_t     uplo,
+                                                    const int                   n,
+                                                    const hipblasComplex* const A[],
+                                                    const int                   lda,
+                                                    hipblasComplex* const       AP[],
+                                                    const int                   batchCount)
+{
+    return hipblasCtrttpBatched(handle, uplo, n, A, lda, AP, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasTrttpBatched<hipblasDoubleComplex>(
+    hipblasHandle_t                   handle,
+    const hipblasFillMode_t           uplo,
+    const int                         n,
+    const hipblasDoubleComplex* const A[],
+    const int                         lda,
+    hipblasDoubleComplex* const       AP[],
+    const int                         batchCount)
+{
+    return hipblasZtrttpBatched(handle, uplo, n, A, lda, AP, batchCount);
+}
+
+// trttp_strided_batched
+template <>
+hipblasStatus_t hipblasTrttpStridedBatched<float>(hipblasHandle_t         handle,
+                                                  const hipblasFillMode_t uplo,
+                                                  const int               n,
+                                                  const float*            A,
+                                                  const int               lda,
+                                                  const int               strideA,
+                                                  float*                  AP,
+                                                  const int               strideAP,
+                                                  const int               batchCount)
+{
+    return hipblasStrttpStridedBatched(handle, uplo, n, A, lda, strideA, AP, strideAP, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasTrttpStridedBatched<double>(hipblasHandle_t         handle,
+                                                   const hipblasFillMode_t uplo,
+                                                   const int               n,
+                                                   const double*           A,
+                                                   const int               lda,
+                                                   const int               strideA,
+                                                   double*                 AP,
+                                                   const int               strideAP,
+                                                   const int               batchCount)
+{
+    return hipblasDtrttpStridedBatched(handle, uplo, n, A, lda, strideA, AP, strideAP, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasTrttpStridedBatched<hipblasComplex>(hipblasHandle_t         handle,
+                                                           const hipblasFillMode_t uplo,
+                                                           const int               n,
+                                                           const hipblasComplex*   A,
+                                                           const int               lda,
+                                                           const int               strideA,
+                                                           hipblasComplex*         AP,
+                                                           const int               strideAP,
+                                                           const int               batchCount)
+{
+    return hipblasCtrttpStridedBatched(handle, uplo, n, A, lda, strideA, AP, strideAP, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasTrttpStridedBatched<hipblasDoubleComplex>(
+    hipblasHandle_t             handle,
+    const hipblasFillMode_t     uplo,
+    const int                   n,
+    const hipblasDoubleComplex* A,
+    const int                   lda,
+    const int                   strideA,
+    hipblasDoubleComplex*       AP,
+    const int                   strideAP,
+    const int                   batchCount)
+{
+    return hipblasZtrttpStridedBatched(handle, uplo, n, A, lda, strideA, AP, strideAP, batchCount);
+}
+
+// tpttr
+template <>
+hipblasStatus_t hipblasTpttr<float>(hipblasHandle_t         handle,
+                                    const hipblasFillMode_t uplo,
+                                    const int               n,
+                                    const float*            AP,
+                                    float*                  A,
+                                    const int               lda)
+{
+    return hipblasStpttr(handle, uplo, n, AP, A, lda);
+}
+
+template <>
+hipblasStatus_t hipblasTpttr<double>(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     const double*           AP,
+                                     double*                 A,
+                                     const int               lda)
+{
+    return hipblasDtpttr(handle, uplo, n, AP, A, lda);
+}
+
+template <>
+hipblasStatus_t hipblasTpttr<hipblasComplex>(hipblasHandle_t         handle,
+                                             const hipblasFillMode_t uplo,
+                                             const int               n,
+                                             const hipblasComplex*   AP,
+                                             hipblasComplex*         A,
+                                             const int               lda)
+{
+    return hipblasCtpttr(handle, uplo, n, AP, A, lda);
+}
+
+template <>
+hipblasStatus_t hipblasTpttr<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                   const hipblasFillMode_t     uplo,
+                                                   const int                   n,
+                                                   const hipblasDoubleComplex* AP,
+                                                   hipblasDoubleComplex*       A,
+                                                   const int                   lda)
+{
+    return hipblasZtpttr(handle, uplo, n, AP, A, lda);
+}
+
+// tpttr_batched
+template <>
+hipblasStatus_t hipblasTpttrBatched<float>(hipblasHandle_t         handle,
+                                           const hipblasFillMode_t uplo,
+                                           const int               n,
+                                           const float* const      AP[],
+                                           float* const            A[],
+                                           const int               lda,
+                                           const int               batchCount)
+{
+    return hipblasStpttrBatched(handle, uplo, n, AP, A, lda, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasTpttrBatched<double>(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            const double* const     AP[],
+                                            double* const           A[],
+                                            const int               lda,
+                                            const int               batchCount)
+{
+    return hipblasDtpttrBatched(handle, uplo, n, AP, A, lda, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasTpttrBatched<hipblasComplex>(hipblasHandle_t             handle,
+                                                    const hipblasFillMode_t     uplo,
+                                                    const int                   n,
+                                                    const hipblasComplex* const AP[],
+                                                    hipblasComplex* const       A[],
+                                                    const int                   lda,
+                                                    const int                   batchCount)
+{
+    return hipblasCtpttrBatched(handle, uplo, n, AP, A, lda, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasTpttrBatched<hipblasDoubleComplex>(
+    hipblasHandle_t                   handle,
+    const hipblasFillMode_t           uplo,
+    const int                         n,
+    const hipblasDoubleComplex* const AP[],
+    hipblasDoubleComplex* const       A[],
+    const int                         lda,
+    const int                         batchCount)
+{
+    return hipblasZtpttrBatched(handle, uplo, n, AP, A, lda, batchCount);
+}
+
+// tpttr_strided_batched
+template <>
+hipblasStatus_t hipblasTpttrStridedBatched<float>(hipblasHandle_t         handle,
+                                                  const hipblasFillMode_t uplo,
+                                                  const int               n,
+                                                  const float*            AP,
+                                                  const int               strideAP,
+                                                  float*                  A,
+                                                  const int               lda,
+                                                  const int               strideA,
+                                                  const int               batchCount)
+{
+    return hipblasStpttrStridedBatched(handle, uplo, n, AP, strideAP, A, lda, strideA, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasTpttrStridedBatched<double>(hipblasHandle_t         handle,
+                                                   const hipblasFillMode_t uplo,
+                                                   const int               n,
+                                                   const double*           AP,
+                                                   const int               strideAP,
+                                                   double*                 A,
+                                                   const int               lda,
+                                                   const int               strideA,
+                                                   const int               batchCount)
+{
+    return hipblasDtpttrStridedBatched(handle, uplo, n, AP, strideAP, A, lda, strideA, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasTpttrStridedBatched<hipblasComplex>(hipblasHandle_t         handle,
+                                                           const hipblasFillMode_t uplo,
+                                                           const int               n,
+                                                           const hipblasComplex*   AP,
+                                                           const int               strideAP,
+                                                           hipblasComplex*         A,
+                                                           const int               lda,
+                                                           const int               strideA,
+                                                           const int               batchCount)
+{
+    return hipblasCtpttrStridedBatched(handle, uplo, n, AP, strideAP, A, lda, strideA, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasTpttrStridedBatched<hipblasDoubleComplex>(
+    hipblasHandle_t             handle,
+    const hipblasFillMode_t     uplo,
+    const int                   n,
+    const hipblasDoubleComplex* AP,
+    const int                   strideAP,
+    hipblasDoubleComplex*       A,
+    const int                   lda,
+    const int                   strideA,
+    const int                   batchCount)
+{
+    return hipblasZtpttrStridedBatched(handle, uplo, n, AP, strideAP, A, lda, strideA, batchCount);
+}
+
+// lacpy
+template <>
+hipblasStatus_t hipblasLacpy<float>(hipblasHandle_t   handle,
+                                    hipblasFillMode_t uplo,
+                                    int               m,
+                                    int               n,
+                                    const float*      A,
+                                    int               lda,
+                                    float*            B,
+                                    int               ldb)
+{
+    return hipblasSlacpy(handle, uplo, m, n, A, lda, B, ldb);
+}
+
+template <>
+hipblasStatus_t hipblasLacpy<double>(hipblasHandle_t   handle,
+                                     hipblasFillMode_t uplo,
+                                     int               m,
+                                     int               n,
+                                     const double*     A,
+                                     int               lda,
+                                     double*           B,
+                                     int               ldb)
+{
+    return hipblasDlacpy(handle, uplo, m, n, A, lda, B, ldb);
+}
+
+template <>
+hipblasStatus_t hipblasLacpy<hipblasComplex>(hipblasHandle_t       handle,
+                                             hipblasFillMode_t     uplo,
+                                             int                   m,
+                                             int                   n,
+                                             const hipblasComplex* A,
+                                             int                   lda,
+                                             hipblasComplex*       B,
+                                             int                   ldb)
+{
+    return hipblasClacpy(handle, uplo, m, n, A, lda, B, ldb);
+}
+
+template <>
+hipblasStatus_t hipblasLacpy<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                   hipblasFillMode_t           uplo,
+                                                   int                         m,
+                                                   int                         n,
+                                                   const hipblasDoubleComplex* A,
+                                                   int                         lda,
+                                                   hipblasDoubleComplex*       B,
+                                                   int                         ldb)
+{
+    return hipblasZlacpy(handle, uplo, m, n, A, lda, B, ldb);
+}
+
+template <>
+hipblasStatus_t hipblasLacpyBatched<float>(hipblasHandle_t    handle,
+                                           hipblasFillMode_t  uplo,
+                                           int                m,
+                                           int                n,
+                                           const float* const A[],
+                                           int                lda,
+                                           float* const       B[],
+                                           int                ldb,
+                                           int                batch_count)
+{
+    return hipblasSlacpyBatched(handle, uplo, m, n, A, lda, B, ldb, batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasLacpyBatched<double>(hipblasHandle_t     handle,
+                                            hipblasFillMode_t   uplo,
+                                            int                 m,
+                                            int                 n,
+                                            const double* const A[],
+                                            int                 lda,
+                                            double* const       B[],
+                                            int                 ldb,
+                                            int                 batch_count)
+{
+    return hipblasDlacpyBatched(handle, uplo, m, n, A, lda, B, ldb, batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasLacpyBatched<hipblasComplex>(hipblasHandle_t             handle,
+                                                    hipblasFillMode_t           uplo,
+                                                    int                         m,
+                                                    int                         n,
+                                                    const hipblasComplex* const A[],
+                                                    int                         lda,
+                                                    hipblasComplex* const       B[],
+                                                    int                         ldb,
+                                                    int                         batch_count)
+{
+    return hipblasClacpyBatched(handle, uplo, m, n, A, lda, B, ldb, batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasLacpyBatched<hipblasDoubleComplex>(
+    hipblasHandle_t                   handle,
+    hipblasFillMode_t                 uplo,
+    int                               m,
+    int                               n,
+    const hipblasDoubleComplex* const A[],
+    int                               lda,
+    hipblasDoubleComplex* const       B[],
+    int                               ldb,
+    int                               batch_count)
+{
+    return hipblasZlacpyBatched(handle, uplo, m, n, A, lda, B, ldb, batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasLacpyStridedBatched<float>(hipblasHandle_t   handle,
+                                                  hipblasFillMode_t uplo,
+                                                  int               m,
+                                                  int               n,
+                                                  const float*      A,
+                                                  int               lda,
+                                                  long long         strideA,
+                                                  float*            B,
+                                                  int               ldb,
+                                                  long long         strideB,
+                                                  int               batch_count)
+{
+    return hipblasSlacpyStridedBatched(
+        handle, uplo, m, n, A, lda, strideA, B, ldb, strideB, batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasLacpyStridedBatched<double>(hipblasHandle_t   handle,
+                                                   hipblasFillMode_t uplo,
+                                                   int               m,
+                                                   int               n,
+                                                   const double*     A,
+                                                   int               lda,
+                                                   long long         strideA,
+                                                   double*           B,
+                                                   int               ldb,
+                                                   long long         strideB,
+                                                   int               batch_count)
+{
+    return hipblasDlacpyStridedBatched(
+        handle, uplo, m, n, A, lda, strideA, B, ldb, strideB, batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasLacpyStridedBatched<hipblasComplex>(hipblasHandle_t       handle,
+                                                           hipblasFillMode_t     uplo,
+                                                           int                   m,
+                                                           int                   n,
+                                                           const hipblasComplex* A,
+                                                           int                   lda,
+                                                           long long             strideA,
+                                                           hipblasComplex*       B,
+                                                           int                   ldb,
+                                                           long long             strideB,
+                                                           int                   batch_count)
+{
+    return hipblasClacpyStridedBatched(
+        handle, uplo, m, n, A, lda, strideA, B, ldb, strideB, batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasLacpyStridedBatched<hipblasDoubleComplex>(
+    hipblasHandle_t             handle,
+    hipblasFillMode_t           uplo,
+    int                         m,
+    int                         n,
+    const hipblasDoubleComplex* A,
+    int                         lda,
+    long long                   strideA,
+    hipblasDoubleComplex*       B,
+    int                         ldb,
+    long long                   strideB,
+    int                         batch_count)
+{
+    return hipblasZlacpyStridedBatched(
+        handle, uplo, m, n, A, lda, strideA, B, ldb, strideB, batch_count);
+}
+
+// symmetrize
+template <>
+hipblasStatus_t hipblasSymmetrize<float>(hipblasHandle_t   handle,
+                                         hipblasFillMode_t uplo,
+                                         int               n,
+                                         float*            A,
+                                         int               lda)
+{
+    return hipblasSsymmetrize(handle, uplo, n, A, lda);
+}
+
+template <>
+hipblasStatus_t hipblasSymmetrize<double>(hipblasHandle_t   handle,
+                                          hipblasFillMode_t uplo,
+                                          int               n,
+                                          double*           A,
+                                          int               lda)
+{
+    return hipblasDsymmetrize(handle, uplo, n, A, lda);
+}
+
+template <>
+hipblasStatus_t hipblasSymmetrize<hipblasComplex>(hipblasHandle_t   handle,
+                                                  hipblasFillMode_t uplo,
+                                                  int               n,
+                                                  hipblasComplex*   A,
+                                                  int               lda)
+{
+    return hipblasCsymmetrize(handle, uplo, n, A, lda);
+}
+
+template <>
+hipblasStatus_t hipblasSymmetrize<hipblasDoubleComplex>(hipblasHandle_t       handle,
+                                                        hipblasFillMode_t     uplo,
+                                                        int                   n,
+                                                        hipblasDoubleComplex* A,
+                                                        int                   lda)
+{
+    return hipblasZsymmetrize(handle, uplo, n, A, lda);
+}
+
+template <>
+hipblasStatus_t hipblasSymmetrizeBatched<float>(hipblasHandle_t   handle,
+                                                hipblasFillMode_t uplo,
+                                                int               n,
+                                                float* const      A[],
+                                                int               lda,
+                                                int               batch_count)
+{
+    return hipblasSsymmetrizeBatched(handle, uplo, n, A, lda, batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasSymmetrizeBatched<double>(hipblasHandle_t   handle,
+                                                 hipblasFillMode_t uplo,
+                                                 int               n,
+                                                 double* const     A[],
+                                                 int               lda,
+                                                 int               batch_count)
+{
+    return hipblasDsymmetrizeBatched(handle, uplo, n, A, lda, batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasSymmetrizeBatched<hipblasComplex>(hipblasHandle_t       handle,
+                                                         hipblasFillMode_t     uplo,
+                                                         int                   n,
+                                                         hipblasComplex* const A[],
+                                                         int                   lda,
+                                                         int                   batch_count)
+{
+    return hipblasCsymmetrizeBatched(handle, uplo, n, A, lda, batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasSymmetrizeBatched<hipblasDoubleComplex>(
+    hipblasHandle_t             handle,
+    hipblasFillMode_t           uplo,
+    int                         n,
+    hipblasDoubleComplex* const A[],
+    int                         lda,
+    int                         batch_count)
+{
+    return hipblasZsymmetrizeBatched(handle, uplo, n, A, lda, batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasSymmetrizeStridedBatched<float>(hipblasHandle_t   handle,
+                                                       hipblasFillMode_t uplo,
+                                                       int               n,
+                                                       float*            A,
+                                                       int               lda,
+                                                       long long         strideA,
+                                                       int               batch_count)
+{
+    return hipblasSsymmetrizeStridedBatched(handle, uplo, n, A, lda, strideA, batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasSymmetrizeStridedBatched<double>(hipblasHandle_t   handle,
+                                                        hipblasFillMode_t uplo,
+                                                        int               n,
+                                                        double*           A,
+                                                        int               lda,
+                                                        long long         strideA,
+                                                        int               batch_count)
+{
+    return hipblasDsymmetrizeStridedBatched(handle, uplo, n, A, lda, strideA, batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasSymmetrizeStridedBatched<hipblasComplex>(hipblasHandle_t   handle,
+                                                                hipblasFillMode_t uplo,
+                                                                int               n,
+                                                                hipblasComplex*   A,
+                                                                int               lda,
+                                                                long long         strideA,
+                                                                int               batch_count)
+{
+    return hipblasCsymmetrizeStridedBatched(handle, uplo, n, A, lda, strideA, batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasSymmetrizeStridedBatched<hipblasDoubleComplex>(
+    hipblasHandle_t       handle,
+    hipblasFillMode_t     uplo,
+    int                   n,
+    hipblasDoubleComplex* A,
+    int                   lda,
+    long long             strideA,
+    int                   batch_count)
+{
+    return hipblasZsymmetrizeStridedBatched(handle, uplo, n, A, lda, strideA, batch_count);
+}
+
+// hermitize
+template <>
+hipblasStatus_t hipblasHermitize<hipblasComplex>(hipblasHandle_t   handle,
+                                                 hipblasFillMode_t uplo,
+                                                 int               n,
+                                                 hipblasComplex*   A,
+                                                 int               lda)
+{
+    return hipblasChermitize(handle, uplo, n, A, lda);
+}
+
+template <>
+hipblasStatus_t hipblasHermitize<hipblasDoubleComplex>(hipblasHandle_t       handle,
+                                                       hipblasFillMode_t     uplo,
+                                                       int                   n,
+                                                       hipblasDoubleComplex* A,
+                                                       int                   lda)
+{
+    return hipblasZhermitize(handle, uplo, n, A, lda);
+}
+
+template <>
+hipblasStatus_t hipblasHermitizeBatched<hipblasComplex>(hipblasHandle_t       handle,
+                                                        hipblasFillMode_t     uplo,
+                                                        int                   n,
+                                                        hipblasComplex* const A[],
+                                                        int                   lda,
+                                                        int                   batch_count)
+{
+    return hipblasChermitizeBatched(handle, uplo, n, A, lda, batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasHermitizeBatched<hipblasDoubleComplex>(
+    hipblasHandle_t             handle,
+    hipblasFillMode_t           uplo,
+    int                         n,
+    hipblasDoubleComplex* const A[],
+    int                         lda,
+    int                         batch_count)
+{
+    return hipblasZhermitizeBatched(handle, uplo, n, A, lda, batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasHermitizeStridedBatched<hipblasComplex>(hipblasHandle_t   handle,
+                                                               hipblasFillMode_t uplo,
+                                                               int               n,
+                                                               hipblasComplex*   A,
+                                                               int               lda,
+                                                               long long         strideA,
+                                                               int               batch_count)
+{
+    return hipblasChermitizeStridedBatched(handle, uplo, n, A, lda, strideA, batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasHermitizeStridedBatched<hipblasDoubleComplex>(
+    hipblasHandle_t       handle,
+    hipblasFillMode_t     uplo,
+    int                   n,
+    hipblasDoubleComplex* A,
+    int                   lda,
+    long long             strideA,
+    int                   batch_count)
+{
+    return hipblasZhermitizeStridedBatched(handle, uplo, n, A, lda, strideA, batch_count);
+}
+
+// transpose
+template <>
+hipblasStatus_t hipblasTranspose<float>(hipblasHandle_t    handle,
+                                        hipblasOperation_t trans,
+                                        int                n,
+                                        float*             A,
+                                        int                lda)
+{
+    return hipblasStranspose(handle, trans, n, A, lda);
+}
+
+template <>
+hipblasStatus_t hipblasTranspose<double>(hipblasHandle_t    handle,
+                                         hipblasOperation_t trans,
+                                         int                n,
+                                         double*            A,
+                                         int                lda)
+{
+    return hipblasDtranspose(handle, trans, n, A, lda);
+}
+
+template <>
+hipblasStatus_t hipblasTranspose<hipblasComplex>(hipblasHandle_t    handle,
+                                                 hipblasOperation_t trans,
+                                                 int                n,
+                                                 hipblasComplex*    A,
+                                                 int                lda)
+{
+    return hipblasCtranspose(handle, trans, n, A, lda);
+}
+
+template <>
+hipblasStatus_t hipblasTranspose<hipblasDoubleComplex>(hipblasHandle_t       handle,
+                                                       hipblasOperation_t    trans,
+                                                       int                   n,
+                                                       hipblasDoubleComplex* A,
+                                                       int                   lda)
+{
+    return hipblasZtranspose(handle, trans, n, A, lda);
+}
+
+template <>
+hipblasStatus_t hipblasTransposeBatched<float>(hipblasHandle_t    handle,
+                                               hipblasOperation_t trans,
+                                               int                n,
+                                               float* const       A[],
+                                               int                lda,
+                                               int                batch_count)
+{
+    return hipblasStransposeBatched(handle, trans, n, A, lda, batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasTransposeBatched<double>(hipblasHandle_t    handle,
+                                                hipblasOperation_t trans,
+                                                int                n,
+                                                double* const      A[],
+                                                int                lda,
+                                                int                batch_count)
+{
+    return hipblasDtransposeBatched(handle, trans, n, A, lda, batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasTransposeBatched<hipblasComplex>(hipblasHandle_t       handle,
+                                                        hipblasOperation_t    trans,
+                                                        int                   n,
+                                                        hipblasComplex* const A[],
+                                                        int                   lda,
+                                                        int                   batch_count)
+{
+    return hipblasCtransposeBatched(handle, trans, n, A, lda, batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasTransposeBatched<hipblasDoubleComplex>(
+    hipblasHandle_t             handle,
+    hipblasOperation_t          trans,
+    int                         n,
+    hipblasDoubleComplex* const A[],
+    int                         lda,
+    int                         batch_count)
+{
+    return hipblasZtransposeBatched(handle, trans, n, A, lda, batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasTransposeStridedBatched<float>(hipblasHandle_t    handle,
+                                                      hipblasOperation_t trans,
+                                                      int                n,
+                                                      float*             A,
+                                                      int                lda,
+                                                      long long          strideA,
+                                                      int                batch_count)
+{
+    return hipblasStransposeStridedBatched(handle, trans, n, A, lda, strideA, batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasTransposeStridedBatched<double>(hipblasHandle_t    handle,
+                                                       hipblasOperation_t trans,
+                                                       int                n,
+                                                       double*            A,
+                                                       int                lda,
+                                                       long long          strideA,
+                                                       int                batch_count)
+{
+    return hipblasDtransposeStridedBatched(handle, trans, n, A, lda, strideA, batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasTransposeStridedBatched<hipblasComplex>(hipblasHandle_t    handle,
+                                                               hipblasOperation_t trans,
+                                                               int                n,
+                                                               hipblasComplex*    A,
+                                                               int                lda,
+                                                               long long          strideA,
+                                                               int                batch_count)
+{
+    return hipblasCtransposeStridedBatched(handle, trans, n, A, lda, strideA, batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasTransposeStridedBatched<hipblasDoubleComplex>(
+    hipblasHandle_t       handle,
+    hipblasOperation_t    trans,
+    int                   n,
+    hipblasDoubleComplex* A,
+    int                   lda,
+    long long             strideA,
+    int                   batch_count)
+{
+    return hipblasZtransposeStridedBatched(handle, trans, n, A, lda, strideA, batch_count);
+}
+
+// lasr
+template <>
+hipblasStatus_t hipblasLasr<float, float>(hipblasHandle_t   handle,
+                                          hipblasSideMode_t side,
+                                          hipblasPivot_t    pivot,
+                                          hipblasDirect_t   direct,
+                                          int               m,
+                                          int               n,
+                                          const float*      c,
+                                          const float*      s,
+                                          float*            A,
+                                          int               lda)
+{
+    return hipblasSlasr(handle, side, pivot, direct, m, n, c, s, A, lda);
+}
+
+template <>
+hipblasStatus_t hipblasLasr<double, double>(hipblasHandle_t   handle,
+                                            hipblasSideMode_t side,
+                                            hipblasPivot_t    pivot,
+                                            hipblasDirect_t   direct,
+                                            int               m,
+                                            int               n,
+                                            const double*     c,
+                                            const double*     s,
+                                            double*           A,
+                                            int               lda)
+{
+    return hipblasDlasr(handle, side, pivot, direct, m, n, c, s, A, lda);
+}
+
+template <>
+hipblasStatus_t hipblasLasr<hipblasComplex, float>(hipblasHandle_t   handle,
+                                                   hipblasSideMode_t side,
+                                                   hipblasPivot_t    pivot,
+                                                   hipblasDirect_t   direct,
+                                                   int               m,
+                                                   int               n,
+                                                   const float*      c,
+                                                   const float*      s,
+                                                   hipblasComplex*   A,
+                                                   int               lda)
+{
+    return hipblasClasr(handle, side, pivot, direct, m, n, c, s, A, lda);
+}
+
+template <>
+hipblasStatus_t hipblasLasr<hipblasDoubleComplex, double>(hipblasHandle_t       handle,
+                                                          hipblasSideMode_t     side,
+                                                          hipblasPivot_t        pivot,
+                                                          hipblasDirect_t       direct,
+                                                          int                   m,
+                                                          int                   n,
+                                                          const double*         c,
+                                                          const double*         s,
+                                                          hipblasDoubleComplex* A,
+                                                          int                   lda)
+{
+    return hipblasZlasr(handle, side, pivot, direct, m, n, c, s, A, lda);
+}
+
+// lasr_batched
+template <>
+hipblasStatus_t hipblasLasrBatched<float, float>(hipblasHandle_t    handle,
+                                                 hipblasSideMode_t  side,
+                                                 hipblasPivot_t     pivot,
+                                                 hipblasDirect_t    direct,
+                                                 int                m,
+                                                 int                n,
+                                                 const float* const c[],
+                                                 const float* const s[],
+                                                 float* const       A[],
+                                                 int                lda,
+                                                 int                batch_count)
+{
+    return hipblasSlasrBatched(handle, side, pivot, direct, m, n, c, s, A, lda, batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasLasrBatched<double, double>(hipblasHandle_t     handle,
+                                                   hipblasSideMode_t   side,
+                                                   hipblasPivot_t      pivot,
+                                                   hipblasDirect_t     direct,
+                                                   int                 m,
+                                                   int                 n,
+                                                   const double* const c[],
+                                                   const double* const s[],
+                                                   double* const       A[],
+                                                   int                 lda,
+                                                   int                 batch_count)
+{
+    return hipblasDlasrBatched(handle, side, pivot, direct, m, n, c, s, A, lda, batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasLasrBatched<hipblasComplex, float>(hipblasHandle_t       handle,
+                                                          hipblasSideMode_t     side,
+                                                          hipblasPivot_t        pivot,
+                                                          hipblasDirect_t       direct,
+                                                          int                   m,
+                                                          int                   n,
+                                                          const float* const    c[],
+                                                          const float* const    s[],
+                                                          hipblasComplex* const A[],
+                                                          int                   lda,
+                                                          int                   batch_count)
+{
+    return hipblasClasrBatched(handle, side, pivot, direct, m, n, c, s, A, lda, batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasLasrBatched<hipblasDoubleComplex, double>(
+    hipblasHandle_t             handle,
+    hipblasSideMode_t           side,
+    hipblasPivot_t              pivot,
+    hipblasDirect_t             direct,
+    int                         m,
+    int                         n,
+    const double* const         c[],
+    const double* const         s[],
+    hipblasDoubleComplex* const A[],
+    int                         lda,
+    int                         batch_count)
+{
+    return hipblasZlasrBatched(handle, side, pivot, direct, m, n, c, s, A, lda, batch_count);
+}
+
+// lasr_strided_batched
+template <>
+hipblasStatus_t hipblasLasrStridedBatched<float, float>(hipblasHandle_t   handle,
+                                                        hipblasSideMode_t side,
+                                                        hipblasPivot_t    pivot,
+                                                        hipblasDirect_t   direct,
+                                                        int               m,
+                                                        int               n,
+                                                        const float*      c,
+                                                        const float*      s,
+                                                        long long         stridecs,
+                                                        float*            A,
+                                                        int               lda,
+                                                        long long         strideA,
+                                                        int               batch_count)
+{
+    return hipblasSlasrStridedBatched(
+        handle, side, pivot, direct, m, n, c, s, stridecs, A, lda, strideA, batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasLasrStridedBatched<double, double>(hipblasHandle_t   handle,
+                                                          hipblasSideMode_t side,
+                                                          hipblasPivot_t    pivot,
+                                                          hipblasDirect_t   direct,
+                                                          int               m,
+                                                          int               n,
+                                                          const double*     c,
+                                                          const double*     s,
+                                                          long long         stridecs,
+                                                          double*           A,
+                                                          int               lda,
+                                                          long long         strideA,
+                                                          int               batch_count)
+{
+    return hipblasDlasrStridedBatched(
+        handle, side, pivot, direct, m, n, c, s, stridecs, A, lda, strideA, batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasLasrStridedBatched<hipblasComplex, float>(hipblasHandle_t   handle,
+                                                                 hipblasSideMode_t side,
+                                                                 hipblasPivot_t    pivot,
+                                                                 hipblasDirect_t   direct,
+                                                                 int               m,
+                                                                 int               n,
+                                                                 const float*      c,
+                                                                 const float*      s,
+                                                                 long long         stridecs,
+                                                                 hipblasComplex*   A,
+                                                                 int               lda,
+                                                                 long long         strideA,
+                                                                 int               batch_count)
+{
+    return hipblasClasrStridedBatched(
+        handle, side, pivot, direct, m, n, c, s, stridecs, A, lda, strideA, batch_count);
+}
+
+template <>
+hipblasStatus_t hipblasLasrStridedBatched<hipblasDoubleComplex, double>(
+    hipblasHandle_t       handle,
+    hipblasSideMode_t     side,
+    hipblasPivot_t        pivot,
+    hipblasDirect_t       direct,
+    int                   m,
+    int                   n,
+    const double*         c,
+    const double*         s,
+    long long             stridecs,
+    hipblasDoubleComplex* A,
+    int                   lda,
+    long long             strideA,
+    int                   batch_count)
+{
+    return hipblasZlasrStridedBatched(
+        handle, side, pivot, direct, m, n, c, s, stridecs, A, lda, strideA, batch_count);
+}
+
+// ge2gb
+template <>
+hipblasStatus_t hipblasGe2gb<float>(hipblasHandle_t handle,
+                                    const int       m,
+                                    const int       n,
+                                    const int       kl,
+                                    const int       ku,
+                                    const float*    A,
+                                    const int       lda,
+                                    float*          AB,
+                                    const int       ldab)
+{
+    return hipblasSge2gb(handle, m, n, kl, ku, A, lda, AB, ldab);
+}
+
+template <>
+hipblasStatus_t hipblasGe2gb<double>(hipblasHandle_t handle,
+                                     const int       m,
+                                     const int       n,
+                                     const int       kl,
+                                     const int       ku,
+                                     const double*   A,
+                                     const int       lda,
+                                     double*         AB,
+                                     const int       ldab)
+{
+    return hipblasDge2gb(handle, m, n, kl, ku, A, lda, AB, ldab);
+}
+
+template <>
+hipblasStatus_t hipblasGe2gb<hipblasComplex>(hipblasHandle_t       handle,
+                                             const int             m,
+                                             const int             n,
+                                             const int             kl,
+                                             const int             ku,
+                                             const hipblasComplex* A,
+                                             const int             lda,
+                                             hipblasComplex*       AB,
+                                             const int             ldab)
+{
+    return hipblasCge2gb(handle, m, n, kl, ku, A, lda, AB, ldab);
+}
+
+template <>
+hipblasStatus_t hipblasGe2gb<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                   const int                   m,
+                                                   const int                   n,
+                                                   const int                   kl,
+                                                   const int                   ku,
+                                                   const hipblasDoubleComplex* A,
+                                                   const int                   lda,
+                                                   hipblasDoubleComplex*       AB,
+                                                   const int                   ldab)
+{
+    return hipblasZge2gb(handle, m, n, kl, ku, A, lda, AB, ldab);
+}
+
+// ge2gb_batched
+template <>
+hipblasStatus_t hipblasGe2gbBatched<float>(hipblasHandle_t    handle,
+                                           const int          m,
+                                           const int          n,
+                                           const int          kl,
+                                           const int          ku,
+                                           const float* const A[],
+                                           const int          lda,
+                                           float* const       AB[],
+                                           const int          ldab,
+                                           const int          batchCount)
+{
+    return hipblasSge2gbBatched(handle, m, n, kl, ku, A, lda, AB, ldab, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGe2gbBatched<double>(hipblasHandle_t     handle,
+                                            const int           m,
+                                            const int           n,
+                                            const int           kl,
+                                            const int           ku,
+                                            const double* const A[],
+                                            const int           lda,
+                                            double* const       AB[],
+                                            const int           ldab,
+                                            const int           batchCount)
+{
+    return hipblasDge2gbBatched(handle, m, n, kl, ku, A, lda, AB, ldab, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGe2gbBatched<hipblasComplex>(hipblasHandle_t             handle,
+                                                    const int                   m,
+                                                    const int                   n,
+                                                    const int                   kl,
+                                                    const int                   ku,
+                                                    const hipblasComplex* const A[],
+                                                    const int                   lda,
+                                                    hipblasComplex* const       AB[],
+                                                    const int                   ldab,
+                                                    const int                   batchCount)
+{
+    return hipblasCge2gbBatched(handle, m, n, kl, ku, A, lda, AB, ldab, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGe2gbBatched<hipblasDoubleComplex>(
+    hipblasHandle_t                   handle,
+    const int                         m,
+    const int                         n,
+    const int                         kl,
+    const int                         ku,
+    const hipblasDoubleComplex* const A[],
+    const int                         lda,
+    hipblasDoubleComplex* const       AB[],
+    const int                         ldab,
+    const int                         batchCount)
+{
+    return hipblasZge2gbBatched(handle, m, n, kl, ku, A, lda, AB, ldab, batchCount);
+}
+
+// ge2gb_strided_batched
+template <>
+hipblasStatus_t hipblasGe2gbStridedBatched<float>(hipblasHandle_t handle,
+                                                  const int       m,
+                                                  const int       n,
+                                                  const int       kl,
+                                                  const int       ku,
+                                                  const float*    A,
+                                                  const int       lda,
+                                                  const int       strideA,
+                                                  float*          AB,
+                                                  const int       ldab,
+                                                  const int       strideAB,
+                                                  const int       batchCount)
+{
+    return hipblasSge2gbStridedBatched(
+        handle, m, n, kl, ku, A, lda, strideA, AB, ldab, strideAB, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGe2gbStridedBatched<double>(hipblasHandle_t handle,
+                                                   const int       m,
+                                                   const int       n,
+                                                   const int       kl,
+                                                   const int       ku,
+                                                   const double*   A,
+                                                   const int       lda,
+                                                   const int       strideA,
+                                                   double*         AB,
+                                                   const int       ldab,
+                                                   const int       strideAB,
+                                                   const int       batchCount)
+{
+    return hipblasDge2gbStridedBatched(
+        handle, m, n, kl, ku, A, lda, strideA, AB, ldab, strideAB, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGe2gbStridedBatched<hipblasComplex>(hipblasHandle_t       handle,
+                                                           const int             m,
+                                                           const int             n,
+                                                           const int             kl,
+                                                           const int             ku,
+                                                           const hipblasComplex* A,
+                                                           const int             lda,
+                                                           const int             strideA,
+                                                           hipblasComplex*       AB,
+                                                           const int             ldab,
+                                                           const int             strideAB,
+                                                           const int             batchCount)
+{
+    return hipblasCge2gbStridedBatched(
+        handle, m, n, kl, ku, A, lda, strideA, AB, ldab, strideAB, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGe2gbStridedBatched<hipblasDoubleComplex>(
+    hipblasHandle_t             handle,
+    const int                   m,
+    const int                   n,
+    const int                   kl,
+    const int                   ku,
+    const hipblasDoubleComplex* A,
+    const int                   lda,
+    const int                   strideA,
+    hipblasDoubleComplex*       AB,
+    const int                   ldab,
+    const int                   strideAB,
+    const int                   batchCount)
+{
+    return hipblasZge2gbStridedBatched(
+        handle, m, n, kl, ku, A, lda, strideA, AB, ldab, strideAB, batchCount);
+}
+
+// gb2ge
+template <>
+hipblasStatus_t hipblasGb2ge<float>(hipblasHandle_t handle,
+                                    const int       m,
+                                    const int       n,
+                                    const int       kl,
+                                    const int       ku,
+                                    const float*    AB,
+                                    const int       ldab,
+                                    float*          A,
+                                    const int       lda)
+{
+    return hipblasSgb2ge(handle, m, n, kl, ku, AB, ldab, A, lda);
+}
+
+template <>
+hipblasStatus_t hipblasGb2ge<double>(hipblasHandle_t handle,
+                                     const int       m,
+                                     const int       n,
+                                     const int       kl,
+                                     const int       ku,
+                                     const double*   AB,
+                                     const int       ldab,
+                                     double*         A,
+                                     const int       lda)
+{
+    return hipblasDgb2ge(handle, m, n, kl, ku, AB, ldab, A, lda);
+}
+
+template <>
+hipblasStatus_t hipblasGb2ge<hipblasComplex>(hipblasHandle_t       handle,
+                                             const int             m,
+                                             const int             n,
+                                             const int             kl,
+                                             const int             ku,
+                                             const hipblasComplex* AB,
+                                             const int             ldab,
+                                             hipblasComplex*       A,
+                                             const int             lda)
+{
+    return hipblasCgb2ge(handle, m, n, kl, ku, AB, ldab, A, lda);
+}
+
+template <>
+hipblasStatus_t hipblasGb2ge<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                   const int                   m,
+                                                   const int                   n,
+                                                   const int                   kl,
+                                                   const int                   ku,
+                                                   const hipblasDoubleComplex* AB,
+                                                   const int                   ldab,
+                                                   hipblasDoubleComplex*       A,
+                                                   const int                   lda)
+{
+    return hipblasZgb2ge(handle, m, n, kl, ku, AB, ldab, A, lda);
+}
+
+// gb2ge_batched
+template <>
+hipblasStatus_t hipblasGb2geBatched<float>(hipblasHandle_t    handle,
+                                           const int          m,
+                                           const int          n,
+                                           const int          kl,
+                                           const int          ku,
+                                           const float* const AB[],
+                                           const int          ldab,
+                                           float* const       A[],
+                                           const int          lda,
+                                           const int          batchCount)
+{
+    return hipblasSgb2geBatched(handle, m, n, kl, ku, AB, ldab, A, lda, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGb2geBatched<double>(hipblasHandle_t     handle,
+                                            const int           m,
+                                            const int           n,
+                                            const int           kl,
+                                            const int           ku,
+                                            const double* const AB[],
+                                            const int           ldab,
+                                            double* const       A[],
+                                            const int           lda,
+                                            const int           batchCount)
+{
+    return hipblasDgb2geBatched(handle, m, n, kl, ku, AB, ldab, A, lda, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGb2geBatched<hipblasComplex>(hipblasHandle_t             handle,
+                                                    const int                   m,
+                                                    const int                   n,
+                                                    const int                   kl,
+                                                    const int                   ku,
+                                                    const hipblasComplex* const AB[],
+                                                    const int                   ldab,
+                                                    hipblasComplex* const       A[],
+                                                    const int                   lda,
+                                                    const int                   batchCount)
+{
+    return hipblasCgb2geBatched(handle, m, n, kl, ku, AB, ldab, A, lda, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGb2geBatched<hipblasDoubleComplex>(
+    hipblasHandle_t                   handle,
+    const int                         m,
+    const int                         n,
+    const int                         kl,
+    const int                         ku,
+    const hipblasDoubleComplex* const AB[],
+    const int                         ldab,
+    hipblasDoubleComplex* const       A[],
+    const int                         lda,
+    const int                         batchCount)
+{
+    return hipblasZgb2geBatched(handle, m, n, kl, ku, AB, ldab, A, lda, batchCount);
+}
+
+// gb2ge_strided_batched
+template <>
+hipblasStatus_t hipblasGb2geStridedBatched<float>(hipblasHandle_t handle,
+                                                  const int       m,
+                                                  const int       n,
+                                                  const int       kl,
+                                                  const int       ku,
+                                                  const float*    AB,
+                                                  const int       ldab,
+                                                  const int       strideAB,
+                                                  float*          A,
+                                                  const int       lda,
+                                                  const int       strideA,
+                                                  const int       batchCount)
+{
+    return hipblasSgb2geStridedBatched(
+        handle, m, n, kl, ku, AB, ldab, strideAB, A, lda, strideA, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGb2geStridedBatched<double>(hipblasHandle_t handle,
+                                                   const int       m,
+                                                   const int       n,
+                                                   const int       kl,
+                                                   const int       ku,
+                                                   const double*   AB,
+                                                   const int       ldab,
+                                                   const int       strideAB,
+                                                   double*         A,
+                                                   const int       lda,
+                                                   const int       strideA,
+                                                   const int       batchCount)
+{
+    return hipblasDgb2geStridedBatched(
+        handle, m, n, kl, ku, AB, ldab, strideAB, A, lda, strideA, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGb2geStridedBatched<hipblasComplex>(hipblasHandle_t       handle,
+                                                           const int             m,
+                                                           const int             n,
+                                                           const int             kl,
+                                                           const int             ku,
+                                                           const hipblasComplex* AB,
+                                                           const int             ldab,
+                                                           const int             strideAB,
+                                                           hipblasComplex*       A,
+                                                           const int             lda,
+                                                           const int             strideA,
+                                                           const int             batchCount)
+{
+    return hipblasCgb2geStridedBatched(
+        handle, m, n, kl, ku, AB, ldab, strideAB, A, lda, strideA, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGb2geStridedBatched<hipblasDoubleComplex>(
+    hipblasHandle_t             handle,
+    const int                   m,
+    const int                   n,
+    const int                   kl,
+    const int                   ku,
+    const hipblasDoubleComplex* AB,
+    const int                   ldab,
+    const int                   strideAB,
+    hipblasDoubleComplex*       A,
+    const int                   lda,
+    const int                   strideA,
+    const int                   batchCount)
+{
+    return hipblasZgb2geStridedBatched(
+        handle, m, n, kl, ku, AB, ldab, strideAB, A, lda, strideA, batchCount);
+}
+
+// lange
+template <>
+hipblasStatus_t hipblasLange<float, float>(hipblasHandle_t         handle,
+                                           const hipblasNormType_t norm,
+                                           const int               m,
+                                           const int               n,
+                                           const float*            A,
+                                           const int               lda,
+                                           float*                  result)
+{
+    return hipblasSlange(handle, norm, m, n, A, lda, result);
+}
+
+template <>
+hipblasStatus_t hipblasLange<double, double>(hipblasHandle_t         handle,
+                                             const hipblasNormType_t norm,
+                                             const int               m,
+                                             const int               n,
+                                             const double*           A,
+                                             const int               lda,
+                                             double*                 result)
+{
+    return hipblasDlange(handle, norm, m, n, A, lda, result);
+}
+
+template <>
+hipblasStatus_t hipblasLange<hipblasComplex, float>(hipblasHandle_t         handle,
+                                                    const hipblasNormType_t norm,
+                                                    const int               m,
+                                                    const int               n,
+                                                    const hipblasComplex*   A,
+                                                    const int               lda,
+                                                    float*                  result)
+{
+    return hipblasClange(handle, norm, m, n, A, lda, result);
+}
+
+template <>
+hipblasStatus_t hipblasLange<hipblasDoubleComplex, double>(hipblasHandle_t             handle,
+                                                           const hipblasNormType_t     norm,
+                                                           const int                   m,
+                                                           const int                   n,
+                                                           const hipblasDoubleComplex* A,
+                                                           const int                   lda,
+                                                           double*                     result)
+{
+    return hipblasZlange(handle, norm, m, n, A, lda, result);
+}
+
+template <>
+hipblasStatus_t hipblasLangeStridedBatched<float, float>(hipblasHandle_t         handle,
+                                                         const hipblasNormType_t norm,
+                                                         const int               m,
+                                                         const int               n,
+                                                         const float*            A,
+                                                         const int               lda,
+                                                         const int               strideA,
+                                                         const int               batchCount,
+                                                         float*                  result)
+{
+    return hipblasSlangeStridedBatched(
+        handle, norm, m, n, A, lda, strideA, batchCount, result);
+}
+
+template <>
+hipblasStatus_t hipblasLangeStridedBatched<double, double>(hipblasHandle_t         handle,
+                                                           const hipblasNormType_t norm,
+                                                           const int               m,
+                                                           const int               n,
+                                                           const double*           A,
+                                                           const int               lda,
+                                                           const int               strideA,
+                                                           const int               batchCount,
+                                                           double*                 result)
+{
+    return hipblasDlangeStridedBatched(
+        handle, norm, m, n, A, lda, strideA, batchCount, result);
+}
+
+template <>
+hipblasStatus_t hipblasLangeStridedBatched<hipblasComplex, float>(
+    hipblasHandle_t         handle,
+    const hipblasNormType_t norm,
+    const int               m,
+    const int               n,
+    const hipblasComplex*   A,
+    const int               lda,
+    const int               strideA,
+    const int               batchCount,
+    float*                  result)
+{
+    return hipblasClangeStridedBatched(
+        handle, norm, m, n, A, lda, strideA, batchCount, result);
+}
+
+template <>
+hipblasStatus_t hipblasLangeStridedBatched<hipblasDoubleComplex, double>(
+    hipblasHandle_t             handle,
+    const hipblasNormType_t     norm,
+    const int                   m,
+    const int                   n,
+    const hipblasDoubleComplex* A,
+    const int                   lda,
+    const int                   strideA,
+    const int                   batchCount,
+    double*                     result)
+{
+    return hipblasZlangeStridedBatched(
+        handle, norm, m, n, A, lda, strideA, batchCount, result);
+}
+
+#ifdef __HIP_PLATFORM_SOLVER__
+
+// getrf
+template <>
+hipblasStatus_t hipblasGetrf<float>(
+    hipblasHandle_t handle, const int n, float* A, const int lda, int* ipiv, int* info)
+{
+    return hipblasSgetrf(handle, n, A, lda, ipiv, info);
+}
+
+template <>
+hipblasStatus_t hipblasGetrf<double>(
+    hipblasHandle_t handle, const int n, double* A, const int lda, int* ipiv, int* info)
+{
+    return hipblasDgetrf(handle, n, A, lda, ipiv, info);
+}
+
+template <>
+hipblasStatus_t hipblasGetrf<hipblasComplex>(
+    hipblasHandle_t handle, const int n, hipblasComplex* A, const int lda, int* ipiv, int* info)
 {
     return hipblasCgetrf(handle, n, A, lda, ipiv, info);
 }
 
 template <>
-hipblasStatus_t hipblasGetrf<hipblasDoubleComplex>(hipblasHandle_t       handle,
+hipblasStatus_t hipblasGetrf<hipblasDoubleComplex>(hipblasHandle_t       handle,
+                                                   const int             n,
+                                                   hipblasDoubleComplex* A,
+                                                   const int             lda,
+                                                   int*                  ipiv,
+                                                   int*                  info)
+{
+    return hipblasZgetrf(handle, n, A, lda, ipiv, info);
+}
+
+// getrf_batched
+template <>
+hipblasStatus_t hipblasGetrfBatched<float>(hipblasHandle_t handle,
+                                           const int       n,
+                                           float* const    A[],
+                                           const int       lda,
+                                           int*            ipiv,
+                                           const int       strideP,
+                                           int*            info,
+                                           const int       batchCount)
+{
+    return hipblasSgetrfBatched(handle, n, A, lda, ipiv, strideP, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGetrfBatched<double>(hipblasHandle_t handle,
+                                            const int       n,
+                                            double* const   A[],
+                                            const int       lda,
+                                            int*            ipiv,
+                                            const int       strideP,
+                                            int*            info,
+                                            const int       batchCount)
+{
+    return hipblasDgetrfBatched(handle, n, A, lda, ipiv, strideP, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGetrfBatched<hipblasComplex>(hipblasHandle_t       handle,
+                                                    const int             n,
+                                                    hipblasComplex* const A[],
+                                                    const int             lda,
+                                                    int*                  ipiv,
+                                                    const int             strideP,
+                                                    int*                  info,
+                                                    const int             batchCount)
+{
+    return hipblasCgetrfBatched(handle, n, A, lda, ipiv, strideP, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGetrfBatched<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                          const int                   n,
+                                                          hipblasDoubleComplex* const A[],
+                                                          const int                   lda,
+                                                          int*                        ipiv,
+                                                          const int                   strideP,
+                                                          int*                        info,
+                                                          const int                   batchCount)
+{
+    return hipblasZgetrfBatched(handle, n, A, lda, ipiv, strideP, info, batchCount);
+}
+
+// getrf_strided_batched
+template <>
+hipblasStatus_t hipblasGetrfStridedBatched<float>(hipblasHandle_t handle,
+                                                  const int       n,
+                                                  float*          A,
+                                                  const int       lda,
+                                                  const int       strideA,
+                                                  int*            ipiv,
+                                                  const int       strideP,
+                                                  int*            info,
+                                                  const int       batchCount)
+{
+    return hipblasSgetrfStridedBatched(handle, n, A, lda, strideA, ipiv, strideP, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGetrfStridedBatched<double>(hipblasHandle_t handle,
+                                                   const int       n,
+                                                   double*         A,
+                                                   const int       lda,
+                                                   const int       strideA,
+                                                   int*            ipiv,
+                                                   const int       strideP,
+                                                   int*            info,
+                                                   const int       batchCount)
+{
+    return hipblasDgetrfStridedBatched(handle, n, A, lda, strideA, ipiv, strideP, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGetrfStridedBatched<hipblasComplex>(hipblasHandle_t handle,
+                                                           const int       n,
+                                                           hipblasComplex* A,
+                                                           const int       lda,
+                                                           const int       strideA,
+                                                           int*            ipiv,
+                                                           const int       strideP,
+                                                           int*            info,
+                                                           const int       batchCount)
+{
+    return hipblasCgetrfStridedBatched(handle, n, A, lda, strideA, ipiv, strideP, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGetrfStridedBatched<hipblasDoubleComplex>(hipblasHandle_t       handle,
+                                                                 const int             n,
+                                                                 hipblasDoubleComplex* A,
+                                                                 const int             lda,
+                                                                 const int             strideA,
+                                                                 int*                  ipiv,
+                                                                 const int             strideP,
+                                                                 int*                  info,
+                                                                 const int             batchCount)
+{
+    return hipblasZgetrfStridedBatched(handle, n, A, lda, strideA, ipiv, strideP, info, batchCount);
+}
+
+// getrs
+template <>
+hipblasStatus_t hipblasGetrs<float>(hipblasHandle_t          handle,
+                                    const hipblasOperation_t trans,
+                                    const int                n,
+                                    const int                nrhs,
+                                    float*                   A,
+                                    const int                lda,
+                                    const int*               ipiv,
+                                    float*                   B,
+                                    const int                ldb,
+                                    int*                     info)
+{
+    return hipblasSgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, info);
+}
+
+template <>
+hipblasStatus_t hipblasGetrs<double>(hipblasHandle_t          handle,
+                                     const hipblasOperation_t trans,
+                                     const int                n,
+                                     const int                nrhs,
+                                     double*                  A,
+                                     const int                lda,
+                                     const int*               ipiv,
+                                     double*                  B,
+                                     const int                ldb,
+                                     int*                     info)
+{
+    return hipblasDgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, info);
+}
+
+template <>
+hipblasStatus_t hipblasGetrs<hipblasComplex>(hipblasHandle_t          handle,
+                                             const hipblasOperation_t trans,
+                                             const int                n,
+                                             const int                nrhs,
+                                             hipblasComplex*          A,
+                                             const int                lda,
+                                             const int*               ipiv,
+                                             hipblasComplex*          B,
+                                             const int                ldb,
+                                             int*                     info)
+{
+    return hipblasCgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, info);
+}
+
+template <>
+hipblasStatus_t hipblasGetrs<hipblasDoubleComplex>(hipblasHandle_t          handle,
+                                                   const hipblasOperation_t trans,
+                                                   const int                n,
+                                                   const int                nrhs,
+                                                   hipblasDoubleComplex*    A,
+                                                   const int                lda,
+                                                   const int*               ipiv,
+                                                   hipblasDoubleComplex*    B,
+                                                   const int                ldb,
+                                                   int*                     info)
+{
+    return hipblasZgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, info);
+}
+
+// getrs_batched
+template <>
+hipblasStatus_t hipblasGetrsBatched<float>(hipblasHandle_t          handle,
+                                           const hipblasOperation_t trans,
+                                           const int                n,
+                                           const int                nrhs,
+                                           float* const             A[],
+                                           const int                lda,
+                                           const int*               ipiv,
+                                           const int                strideP,
+                                           float* const             B[],
+                                           const int                ldb,
+                                           int*                     info,
+                                           const int                batchCount)
+{
+    return hipblasSgetrsBatched(
+        handle, trans, n, nrhs, A, lda, ipiv, strideP, B, ldb, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGetrsBatched<double>(hipblasHandle_t          handle,
+                                            const hipblasOperation_t trans,
+                                            const int                n,
+                                            const int                nrhs,
+                                            double* const            A[],
+                                            const int                lda,
+                                            const int*               ipiv,
+                                            const int                strideP,
+                                            double* const            B[],
+                                            const int                ldb,
+                                            int*                     info,
+                                            const int                batchCount)
+{
+    return hipblasDgetrsBatched(
+        handle, trans, n, nrhs, A, lda, ipiv, strideP, B, ldb, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGetrsBatched<hipblasComplex>(hipblasHandle_t          handle,
+                                                    const hipblasOperation_t trans,
+                                                    const int                n,
+                                                    const int                nrhs,
+                                                    hipblasComplex* const    A[],
+                                                    const int                lda,
+                                                    const int*               ipiv,
+                                                    const int                strideP,
+                                                    hipblasComplex* const    B[],
+                                                    const int                ldb,
+                                                    int*                     info,
+                                                    const int                batchCount)
+{
+    return hipblasCgetrsBatched(
+        handle, trans, n, nrhs, A, lda, ipiv, strideP, B, ldb, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGetrsBatched<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                          const hipblasOperation_t    trans,
+                                                          const int                   n,
+                                                          const int                   nrhs,
+                                                          hipblasDoubleComplex* const A[],
+                                                          const int                   lda,
+                                                          const int*                  ipiv,
+                                                          const int                   strideP,
+                                                          hipblasDoubleComplex* const B[],
+                                                          const int                   ldb,
+                                                          int*                        info,
+                                                          const int                   batchCount)
+{
+    return hipblasZgetrsBatched(
+        handle, trans, n, nrhs, A, lda, ipiv, strideP, B, ldb, info, batchCount);
+}
+
+// getrs_strided_batched
+template <>
+hipblasStatus_t hipblasGetrsStridedBatched<float>(hipblasHandle_t          handle,
+                                                  const hipblasOperation_t trans,
+                                                  const int                n,
+                                                  const int                nrhs,
+                                                  float*                   A,
+                                                  const int                lda,
+                                                  const int                strideA,
+                                                  const int*               ipiv,
+                                                  const int                strideP,
+                                                  float*                   B,
+                                                  const int                ldb,
+                                                  const int                strideB,
+                                                  int*                     info,
+                                                  const int                batchCount)
+{
+    return hipblasSgetrsStridedBatched(
+        handle, trans, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb, strideB, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGetrsStridedBatched<double>(hipblasHandle_t          handle,
+                                                   const hipblasOperation_t trans,
+                                                   const int                n,
+                                                   const int                nrhs,
+                                                   double*                  A,
+                                                   const int                lda,
+                                                   const int                strideA,
+                                                   const int*               ipiv,
+                                                   const int                strideP,
+                                                   double*                  B,
+                                                   const int                ldb,
+                                                   const int                strideB,
+                                                   int*                     info,
+                                                   const int                batchCount)
+{
+    return hipblasDgetrsStridedBatched(
+        handle, trans, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb, strideB, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGetrsStridedBatched<hipblasComplex>(hipblasHandle_t          handle,
+                                                           const hipblasOperation_t trans,
+                                                           const int                n,
+                                                           const int                nrhs,
+                                                           hipblasComplex*          A,
+                                                           const int                lda,
+                                                           const int                strideA,
+                                                           const int*               ipiv,
+                                                           const int                strideP,
+                                                           hipblasComplex*          B,
+                                                           const int                ldb,
+                                                           const int                strideB,
+                                                           int*                     info,
+                                                           const int                batchCount)
+{
+    return hipblasCgetrsStridedBatched(
+        handle, trans, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb, strideB, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGetrsStridedBatched<hipblasDoubleComplex>(hipblasHandle_t          handle,
+                                                                 const hipblasOperation_t trans,
+                                                                 const int                n,
+                                                                 const int                nrhs,
+                                                                 hipblasDoubleComplex*    A,
+                                                                 const int                lda,
+                                                                 const int                strideA,
+                                                                 const int*               ipiv,
+                                                                 const int                strideP,
+                                                                 hipblasDoubleComplex*    B,
+                                                                 const int                ldb,
+                                                                 const int                strideB,
+                                                                 int*                     info,
+                                                                 const int batchCount)
+{
+    return hipblasZgetrsStridedBatched(
+        handle, trans, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb, strideB, info, batchCount);
+}
+
+// getri_batched
+template <>
+hipblasStatus_t hipblasGetriBatched<float>(hipblasHandle_t handle,
+                                           const int       n,
+                                           float* const    A[],
+                                           const int       lda,
+                                           int*            ipiv,
+                                           const int       strideP,
+                                           float* const    C[],
+                                           const int       ldc,
+                                           int*            info,
+                                           const int       batchCount)
+{
+    return hipblasSgetriBatched(handle, n, A, lda, ipiv, strideP, C, ldc, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGetriBatched<double>(hipblasHandle_t handle,
+                                            const int       n,
+                                            double* const   A[],
+                                            const int       lda,
+                                            int*            ipiv,
+                                            const int       strideP,
+                                            double* const   C[],
+                                            const int       ldc,
+                                            int*            info,
+                                            const int       batchCount)
+{
+    return hipblasDgetriBatched(handle, n, A, lda, ipiv, strideP, C, ldc, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGetriBatched<hipblasComplex>(hipblasHandle_t       handle,
+                                                    const int             n,
+                                                    hipblasComplex* const A[],
+                                                    const int             lda,
+                                                    int*                  ipiv,
+                                                    const int             strideP,
+                                                    hipblasComplex* const C[],
+                                                    const int             ldc,
+                                                    int*                  info,
+                                                    const int             batchCount)
+{
+    return hipblasCgetriBatched(handle, n, A, lda, ipiv, strideP, C, ldc, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGetriBatched<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                          const int                   n,
+                                                          hipblasDoubleComplex* const A[],
+                                                          const int                   lda,
+                                                          int*                        ipiv,
+                                                          const int                   strideP,
+                                                          hipblasDoubleComplex* const C[],
+                                                          const int                   ldc,
+                                                          int*                        info,
+                                                          const int                   batchCount)
+{
+    return hipblasZgetriBatched(handle, n, A, lda, ipiv, strideP, C, ldc, info, batchCount);
+}
+
+// getri_strided_batched
+template <>
+hipblasStatus_t hipblasGetriStridedBatched<float>(hipblasHandle_t handle,
+                                                  const int       n,
+                                                  float*          A,
+                                                  const int       lda,
+                                                  const int       strideA,
+                                                  int*            ipiv,
+                                                  const int       strideP,
+                                                  float*          C,
+                                                  const int       ldc,
+                                                  const int       strideC,
+                                                  int*            info,
+                                                  const int       batchCount)
+{
+    return hipblasSgetriStridedBatched(
+        handle, n, A, lda, strideA, ipiv, strideP, C, ldc, strideC, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGetriStridedBatched<double>(hipblasHandle_t handle,
+                                                   const int       n,
+                                                   double*         A,
+                                                   const int       lda,
+                                                   const int       strideA,
+                                                   int*            ipiv,
+                                                   const int       strideP,
+                                                   double*         C,
+                                                   const int       ldc,
+                                                   const int       strideC,
+                                                   int*            info,
+                                                   const int       batchCount)
+{
+    return hipblasDgetriStridedBatched(
+        handle, n, A, lda, strideA, ipiv, strideP, C, ldc, strideC, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGetriStridedBatched<hipblasComplex>(hipblasHandle_t handle,
+                                                           const int       n,
+                                                           hipblasComplex* A,
+                                                           const int       lda,
+                                                           const int       strideA,
+                                                           int*            ipiv,
+                                                           const int       strideP,
+                                                           hipblasComplex* C,
+                                                           const int       ldc,
+                                                           const int       strideC,
+                                                           int*            info,
+                                                           const int       batchCount)
+{
+    return hipblasCgetriStridedBatched(
+        handle, n, A, lda, strideA, ipiv, strideP, C, ldc, strideC, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGetriStridedBatched<hipblasDoubleComplex>(hipblasHandle_t       handle,
+                                                                 const int             n,
+                                                                 hipblasDoubleComplex* A,
+                                                                 const int             lda,
+                                                                 const int             strideA,
+                                                                 int*                  ipiv,
+                                                                 const int             strideP,
+                                                                 hipblasDoubleComplex* C,
+                                                                 const int             ldc,
+                                                                 const int             strideC,
+                                                                 int*                  info,
+                                                                 const int             batchCount)
+{
+    return hipblasZgetriStridedBatched(
+        handle, n, A, lda, strideA, ipiv, strideP, C, ldc, strideC, info, batchCount);
+}
+
+// matinv_batched
+template <>
+hipblasStatus_t hipblasMatinvBatched<float>(hipblasHandle_t    handle,
+                                            const int          n,
+                                            const float* const A[],
+                                            const int          lda,
+                                            float* const       Ainv[],
+                                            const int          lda_inv,
+                                            int*               info,
+                                            const int          batchCount)
+{
+    return hipblasSmatinvBatched(handle, n, A, lda, Ainv, lda_inv, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasMatinvBatched<double>(hipblasHandle_t     handle,
+                                             const int           n,
+                                             const double* const A[],
+                                             const int           lda,
+                                             double* const       Ainv[],
+                                             const int           lda_inv,
+                                             int*                info,
+                                             const int           batchCount)
+{
+    return hipblasDmatinvBatched(handle, n, A, lda, Ainv, lda_inv, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasMatinvBatched<hipblasComplex>(hipblasHandle_t             handle,
+                                                     const int                   n,
+                                                     const hipblasComplex* const A[],
+                                                     const int                   lda,
+                                                     hipblasComplex* const       Ainv[],
+                                                     const int                   lda_inv,
+                                                     int*                        info,
+                                                     const int                   batchCount)
+{
+    return hipblasCmatinvBatched(handle, n, A, lda, Ainv, lda_inv, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasMatinvBatched<hipblasDoubleComplex>(hipblasHandle_t                   handle,
+                                                           const int                         n,
+                                                           const hipblasDoubleComplex* const A[],
+                                                           const int                         lda,
+                                                           hipblasDoubleComplex* const       Ainv[],
+                                                           const int                         lda_inv,
+                                                           int*                              info,
+                                                           const int                         batchCount)
+{
+    return hipblasZmatinvBatched(handle, n, A, lda, Ainv, lda_inv, info, batchCount);
+}
+
+// potrf
+template <>
+hipblasStatus_t hipblasPotrf<float>(hipblasHandle_t         handle,
+                                    const hipblasFillMode_t uplo,
+                                    const int               n,
+                                    float*                  A,
+                                    const int               lda,
+                                    int*                    info)
+{
+    return hipblasSpotrf(handle, uplo, n, A, lda, info);
+}
+
+template <>
+hipblasStatus_t hipblasPotrf<double>(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     double*                 A,
+                                     const int               lda,
+                                     int*                    info)
+{
+    return hipblasDpotrf(handle, uplo, n, A, lda, info);
+}
+
+template <>
+hipblasStatus_t hipblasPotrf<hipblasComplex>(hipblasHandle_t         handle,
+                                             const hipblasFillMode_t uplo,
+                                             const int               n,
+                                             hipblasComplex*         A,
+                                             const int               lda,
+                                             int*                    info)
+{
+    return hipblasCpotrf(handle, uplo, n, A, lda, info);
+}
+
+template <>
+hipblasStatus_t hipblasPotrf<hipblasDoubleComplex>(hipblasHandle_t         handle,
+                                                   const hipblasFillMode_t uplo,
+                                                   const int               n,
+                                                   hipblasDoubleComplex*   A,
+                                                   const int               lda,
+                                                   int*                    info)
+{
+    return hipblasZpotrf(handle, uplo, n, A, lda, info);
+}
+
+// potrf_batched
+template <>
+hipblasStatus_t hipblasPotrfBatched<float>(hipblasHandle_t         handle,
+                                           const hipblasFillMode_t uplo,
+                                           const int               n,
+                                           float* const            A[],
+                                           const int               lda,
+                                           int*                    info,
+                                           const int               batchCount)
+{
+    return hipblasSpotrfBatched(handle, uplo, n, A, lda, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasPotrfBatched<double>(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            double* const           A[],
+                                            const int               lda,
+                                            int*                    info,
+                                            const int               batchCount)
+{
+    return hipblasDpotrfBatched(handle, uplo, n, A, lda, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasPotrfBatched<hipblasComplex>(hipblasHandle_t         handle,
+                                                    const hipblasFillMode_t uplo,
+                                                    const int               n,
+                                                    hipblasComplex* const   A[],
+                                                    const int               lda,
+                                                    int*                    info,
+                                                    const int               batchCount)
+{
+    return hipblasCpotrfBatched(handle, uplo, n, A, lda, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasPotrfBatched<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                          const hipblasFillMode_t     uplo,
+                                                          const int                   n,
+                                                          hipblasDoubleComplex* const A[],
+                                                          const int                   lda,
+                                                          int*                        info,
+                                                          const int                   batchCount)
+{
+    return hipblasZpotrfBatched(handle, uplo, n, A, lda, info, batchCount);
+}
+
+// potrf_strided_batched
+template <>
+hipblasStatus_t hipblasPotrfStridedBatched<float>(hipblasHandle_t         handle,
+                                                  const hipblasFillMode_t uplo,
+                                                  const int               n,
+                                                  float*                  A,
+                                                  const int               lda,
+                                                  const int               strideA,
+                                                  int*                    info,
+                                                  const int               batchCount)
+{
+    return hipblasSpotrfStridedBatched(handle, uplo, n, A, lda, strideA, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasPotrfStridedBatched<double>(hipblasHandle_t         handle,
+                                                   const hipblasFillMode_t uplo,
+                                                   const int               n,
+                                                   double*                 A,
+                                                   const int               lda,
+                                                   const int               strideA,
+                                                   int*                    info,
+                                                   const int               batchCount)
+{
+    return hipblasDpotrfStridedBatched(handle, uplo, n, A, lda, strideA, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasPotrfStridedBatched<hipblasComplex>(hipblasHandle_t         handle,
+                                                           const hipblasFillMode_t uplo,
+                                                           const int               n,
+                                                           hipblasComplex*         A,
+                                                           const int               lda,
+                                                           const int               strideA,
+                                                           int*                    info,
+                                                           const int               batchCount)
+{
+    return hipblasCpotrfStridedBatched(handle, uplo, n, A, lda, strideA, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasPotrfStridedBatched<hipblasDoubleComplex>(hipblasHandle_t         handle,
+                                                                 const hipblasFillMode_t uplo,
+                                                                 const int               n,
+                                                                 hipblasDoubleComplex*   A,
+                                                                 const int               lda,
+                                                                 const int               strideA,
+                                                                 int*                    info,
+                                                                 const int               batchCount)
+{
+    return hipblasZpotrfStridedBatched(handle, uplo, n, A, lda, strideA, info, batchCount);
+}
+
+// potrs
+template <>
+hipblasStatus_t hipblasPotrs<float>(hipblasHandle_t         handle,
+                                    const hipblasFillMode_t uplo,
+                                    const int               n,
+                                    const int               nrhs,
+                                    float*                  A,
+                                    const int               lda,
+                                    float*                  B,
+                                    const int               ldb,
+                                    int*                    info)
+{
+    return hipblasSpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, info);
+}
+
+template <>
+hipblasStatus_t hipblasPotrs<double>(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     const int               nrhs,
+                                     double*                 A,
+                                     const int               lda,
+                                     double*                 B,
+                                     const int               ldb,
+                                     int*                    info)
+{
+    return hipblasDpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, info);
+}
+
+template <>
+hipblasStatus_t hipblasPotrs<hipblasComplex>(hipblasHandle_t         handle,
+                                             const hipblasFillMode_t uplo,
+                                             const int               n,
+                                             const int               nrhs,
+                                             hipblasComplex*         A,
+                                             const int               lda,
+                                             hipblasComplex*         B,
+                                             const int               ldb,
+                                             int*                    info)
+{
+    return hipblasCpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, info);
+}
+
+template <>
+hipblasStatus_t hipblasPotrs<hipblasDoubleComplex>(hipblasHandle_t         handle,
+                                                   const hipblasFillMode_t uplo,
+                                                   const int               n,
+                                                   const int               nrhs,
+                                                   hipblasDoubleComplex*   A,
+                                                   const int               lda,
+                                                   hipblasDoubleComplex*   B,
+                                                   const int               ldb,
+                                                   int*                    info)
+{
+    return hipblasZpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, info);
+}
+
+// potrs_batched
+template <>
+hipblasStatus_t hipblasPotrsBatched<float>(hipblasHandle_t         handle,
+                                           const hipblasFillMode_t uplo,
+                                           const int               n,
+                                           const int               nrhs,
+                                           float* const            A[],
+                                           const int               lda,
+                                           float* const            B[],
+                                           const int               ldb,
+                                           int*                    info,
+                                           const int               batchCount)
+{
+    return hipblasSpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasPotrsBatched<double>(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            const int               nrhs,
+                                            double* const           A[],
+                                            const int               lda,
+                                            double* const           B[],
+                                            const int               ldb,
+                                            int*                    info,
+                                            const int               batchCount)
+{
+    return hipblasDpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasPotrsBatched<hipblasComplex>(hipblasHandle_t         handle,
+                                                    const hipblasFillMode_t uplo,
+                                                    const int               n,
+                                                    const int               nrhs,
+                                                    hipblasComplex* const   A[],
+                                                    const int               lda,
+                                                    hipblasComplex* const   B[],
+                                                    const int               ldb,
+                                                    int*                    info,
+                                                    const int               batchCount)
+{
+    return hipblasCpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasPotrsBatched<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                          const hipblasFillMode_t     uplo,
+                                                          const int                   n,
+                                                          const int                   nrhs,
+                                                          hipblasDoubleComplex* const A[],
+                                                          const int                   lda,
+                                                          hipblasDoubleComplex* const B[],
+                                                          const int                   ldb,
+                                                          int*                        info,
+                                                          const int                   batchCount)
+{
+    return hipblasZpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, info, batchCount);
+}
+
+// potrs_strided_batched
+template <>
+hipblasStatus_t hipblasPotrsStridedBatched<float>(hipblasHandle_t         handle,
+                                                  const hipblasFillMode_t uplo,
+                                                  const int               n,
+                                                  const int               nrhs,
+                                                  float*                  A,
+                                                  const int               lda,
+                                                  const int               strideA,
+                                                  float*                  B,
+                                                  const int               ldb,
+                                                  const int               strideB,
+                                                  int*                    info,
+                                                  const int               batchCount)
+{
+    return hipblasSpotrsStridedBatched(
+        handle, uplo, n, nrhs, A, lda, strideA, B, ldb, strideB, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasPotrsStridedBatched<double>(hipblasHandle_t         handle,
+                                                   const hipblasFillMode_t uplo,
+                                                   const int               n,
+                                                   const int               nrhs,
+                                                   double*                 A,
+                                                   const int               lda,
+                                                   const int               strideA,
+                                                   double*                 B,
+                                                   const int               ldb,
+                                                   const int               strideB,
+                                                   int*                    info,
+                                                   const int               batchCount)
+{
+    return hipblasDpotrsStridedBatched(
+        handle, uplo, n, nrhs, A, lda, strideA, B, ldb, strideB, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasPotrsStridedBatched<hipblasComplex>(hipblasHandle_t         handle,
+                                                           const hipblasFillMode_t uplo,
+                                                           const int               n,
+                                                           const int               nrhs,
+                                                           hipblasComplex*         A,
+                                                           const int               lda,
+                                                           const int               strideA,
+                                                           hipblasComplex*         B,
+                                                           const int               ldb,
+                                                           const int               strideB,
+                                                           int*                    info,
+                                                           const int               batchCount)
+{
+    return hipblasCpotrsStridedBatched(
+        handle, uplo, n, nrhs, A, lda, strideA, B, ldb, strideB, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasPotrsStridedBatched<hipblasDoubleComplex>(hipblasHandle_t         handle,
+                                                                 const hipblasFillMode_t uplo,
+                                                                 const int               n,
+                                                                 const int               nrhs,
+                                                                 hipblasDoubleComplex*   A,
+                                                                 const int               lda,
+                                                                 const int               strideA,
+                                                                 hipblasDoubleComplex*   B,
+                                                                 const int               ldb,
+                                                                 const int               strideB,
+                                                                 int*                    info,
+                                                                 const int               batchCount)
+{
+    return hipblasZpotrsStridedBatched(
+        handle, uplo, n, nrhs, A, lda, strideA, B, ldb, strideB, info, batchCount);
+}
+
+// getrf_npvt_batched
+template <>
+hipblasStatus_t hipblasGetrfNpvtBatched<float>(hipblasHandle_t handle,
+                                               const int       n,
+                                               float* const    A[],
+                                               const int       lda,
+                                               int*            info,
+                                               const int       batchCount)
+{
+    return hipblasSgetrfNpvtBatched(handle, n, A, lda, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGetrfNpvtBatched<double>(hipblasHandle_t handle,
+                                                const int       n,
+                                                double* const   A[],
+                                                const int       lda,
+                                                int*            info,
+                                                const int       batchCount)
+{
+    return hipblasDgetrfNpvtBatched(handle, n, A, lda, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGetrfNpvtBatched<hipblasComplex>(hipblasHandle_t       handle,
+                                                        const int             n,
+                                                        hipblasComplex* const A[],
+                                                        const int             lda,
+                                                        int*                  info,
+                                                        const int             batchCount)
+{
+    return hipblasCgetrfNpvtBatched(handle, n, A, lda, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGetrfNpvtBatched<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                              const int                   n,
+                                                              hipblasDoubleComplex* const A[],
+                                                              const int                   lda,
+                                                              int*                        info,
+                                                              const int                   batchCount)
+{
+    return hipblasZgetrfNpvtBatched(handle, n, A, lda, info, batchCount);
+}
+
+// getrf_npvt_strided_batched
+template <>
+hipblasStatus_t hipblasGetrfNpvtStridedBatched<float>(hipblasHandle_t handle,
+                                                      const int       n,
+                                                      float*          A,
+                                                      const int       lda,
+                                                      const int       strideA,
+                                                      int*            info,
+                                                      const int       batchCount)
+{
+    return hipblasSgetrfNpvtStridedBatched(handle, n, A, lda, strideA, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGetrfNpvtStridedBatched<double>(hipblasHandle_t handle,
+                                                       const int       n,
+                                                       double*         A,
+                                                       const int       lda,
+                                                       const int       strideA,
+                                                       int*            info,
+                                                       const int       batchCount)
+{
+    return hipblasDgetrfNpvtStridedBatched(handle, n, A, lda, strideA, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGetrfNpvtStridedBatched<hipblasComplex>(hipblasHandle_t handle,
+                                                               const int       n,
+                                                               hipblasComplex* A,
+                                                               const int       lda,
+                                                               const int       strideA,
+                                                               int*            info,
+                                                               const int       batchCount)
+{
+    return hipblasCgetrfNpvtStridedBatched(handle, n, A, lda, strideA, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGetrfNpvtStridedBatched<hipblasDoubleComplex>(hipblasHandle_t       handle,
+                                                                     const int             n,
+                                                                     hipblasDoubleComplex* A,
+                                                                     const int             lda,
+                                                                     const int             strideA,
+                                                                     int*                  info,
+                                                                     const int             batchCount)
+{
+    return hipblasZgetrfNpvtStridedBatched(handle, n, A, lda, strideA, info, batchCount);
+}
+
+// getrs_npvt_batched
+template <>
+hipblasStatus_t hipblasGetrsNpvtBatched<float>(hipblasHandle_t          handle,
+                                               const hipblasOperation_t trans,
+                                               const int                n,
+                                               const int                nrhs,
+                                               float* const             A[],
+                                               const int                lda,
+                                               float* const             B[],
+                                               const int                ldb,
+                                               int*                     info,
+                                               const int                batchCount)
+{
+    return hipblasSgetrsNpvtBatched(handle, trans, n, nrhs, A, lda, B, ldb, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGetrsNpvtBatched<double>(hipblasHandle_t          handle,
+                                                const hipblasOperation_t trans,
+                                                const int                n,
+                                                const int                nrhs,
+                                                double* const            A[],
+                                                const int                lda,
+                                                double* const            B[],
+                                                const int                ldb,
+                                                int*                     info,
+                                                const int                batchCount)
+{
+    return hipblasDgetrsNpvtBatched(handle, trans, n, nrhs, A, lda, B, ldb, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGetrsNpvtBatched<hipblasComplex>(hipblasHandle_t          handle,
+                                                        const hipblasOperation_t trans,
+                                                        const int                n,
+                                                        const int                nrhs,
+                                                        hipblasComplex* const    A[],
+                                                        const int                lda,
+                                                        hipblasComplex* const    B[],
+                                                        const int                ldb,
+                                                        int*                     info,
+                                                        const int                batchCount)
+{
+    return hipblasCgetrsNpvtBatched(handle, trans, n, nrhs, A, lda, B, ldb, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGetrsNpvtBatched<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                              const hipblasOperation_t    trans,
+                                                              const int                   n,
+                                                              const int                   nrhs,
+                                                              hipblasDoubleComplex* const A[],
+                                                              const int                   lda,
+                                                              hipblasDoubleComplex* const B[],
+                                                              const int                   ldb,
+                                                              int*                        info,
+                                                              const int                   batchCount)
+{
+    return hipblasZgetrsNpvtBatched(handle, trans, n, nrhs, A, lda, B, ldb, info, batchCount);
+}
+
+// getrs_npvt_strided_batched
+template <>
+hipblasStatus_t hipblasGetrsNpvtStridedBatched<float>(hipblasHandle_t          handle,
+                                                      const hipblasOperation_t trans,
+                                                      const int                n,
+                                                      const int                nrhs,
+                                                      float*                   A,
+                                                      const int                lda,
+                                                      const int                strideA,
+                                                      float*                   B,
+                                                      const int                ldb,
+                                                      const int                strideB,
+                                                      int*                     info,
+                                                      const int                batchCount)
+{
+    return hipblasSgetrsNpvtStridedBatched(
+        handle, trans, n, nrhs, A, lda, strideA, B, ldb, strideB, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGetrsNpvtStridedBatched<double>(hipblasHandle_t          handle,
+                                                       const hipblasOperation_t trans,
+                                                       const int                n,
+                                                       const int                nrhs,
+                                                       double*                  A,
+                                                       const int                lda,
+                                                       const int                strideA,
+                                                       double*                  B,
+                                                       const int                ldb,
+                                                       const int                strideB,
+                                                       int*                     info,
+                                                       const int                batchCount)
+{
+    return hipblasDgetrsNpvtStridedBatched(
+        handle, trans, n, nrhs, A, lda, strideA, B, ldb, strideB, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGetrsNpvtStridedBatched<hipblasComplex>(hipblasHandle_t          handle,
+                                                               const hipblasOperation_t trans,
+                                                               const int                n,
+                                                               const int                nrhs,
+                                                               hipblasComplex*          A,
+                                                               const int                lda,
+                                                               const int                strideA,
+                                                               hipblasComplex*          B,
+                                                               const int                ldb,
+                                                               const int                strideB,
+                                                               int*                     info,
+                                                               const int                batchCount)
+{
+    return hipblasCgetrsNpvtStridedBatched(
+        handle, trans, n, nrhs, A, lda, strideA, B, ldb, strideB, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGetrsNpvtStridedBatched<hipblasDoubleComplex>(hipblasHandle_t          handle,
+                                                                     const hipblasOperation_t trans,
+                                                                     const int                n,
+                                                                     const int                nrhs,
+                                                                     hipblasDoubleComplex*    A,
+                                                                     const int                lda,
+                                                                     const int                strideA,
+                                                                     hipblasDoubleComplex*    B,
+                                                                     const int                ldb,
+                                                                     const int                strideB,
+                                                                     int*                     info,
+                                                                     const int                batchCount)
+{
+    return hipblasZgetrsNpvtStridedBatched(
+        handle, trans, n, nrhs, A, lda, strideA, B, ldb, strideB, info, batchCount);
+}
+
+// gesv_batched
+template <>
+hipblasStatus_t hipblasGesvBatched<float>(hipblasHandle_t handle,
+                                          const int       n,
+                                          const int       nrhs,
+                                          float* const    A[],
+                                          const int       lda,
+                                          int*            ipiv,
+                                          const int       strideP,
+                                          float* const    B[],
+                                          const int       ldb,
+                                          int*            info,
+                                          const int       batchCount)
+{
+    return hipblasSgesvBatched(
+        handle, n, nrhs, A, lda, ipiv, strideP, B, ldb, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGesvBatched<double>(hipblasHandle_t handle,
+                                           const int       n,
+                                           const int       nrhs,
+                                           double* const   A[],
+                                           const int       lda,
+                                           int*            ipiv,
+                                           const int       strideP,
+                                           double* const   B[],
+                                           const int       ldb,
+                                           int*            info,
+                                           const int       batchCount)
+{
+    return hipblasDgesvBatched(
+        handle, n, nrhs, A, lda, ipiv, strideP, B, ldb, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGesvBatched<hipblasComplex>(hipblasHandle_t       handle,
+                                                   const int             n,
+                                                   const int             nrhs,
+                                                   hipblasComplex* const A[],
+                                                   const int             lda,
+                                                   int*                  ipiv,
+                                                   const int             strideP,
+                                                   hipblasComplex* const B[],
+                                                   const int             ldb,
+                                                   int*                  info,
+                                                   const int             batchCount)
+{
+    return hipblasCgesvBatched(
+        handle, n, nrhs, A, lda, ipiv, strideP, B, ldb, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGesvBatched<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                         const int                   n,
+                                                         const int                   nrhs,
+                                                         hipblasDoubleComplex* const A[],
+                                                         const int                   lda,
+                                                         int*                        ipiv,
+                                                         const int                   strideP,
+                                                         hipblasDoubleComplex* const B[],
+                                                         const int                   ldb,
+                                                         int*                        info,
+                                                         const int                   batchCount)
+{
+    return hipblasZgesvBatched(
+        handle, n, nrhs, A, lda, ipiv, strideP, B, ldb, info, batchCount);
+}
+
+// gesv_strided_batched
+template <>
+hipblasStatus_t hipblasGesvStridedBatched<float>(hipblasHandle_t handle,
+                                                 const int       n,
+                                                 const int       nrhs,
+                                                 float*          A,
+                                                 const int       lda,
+                                                 const int       strideA,
+                                                 int*            ipiv,
+                                                 const int       strideP,
+                                                 float*          B,
+                                                 const int       ldb,
+                                                 const int       strideB,
+                                                 int*            info,
+                                                 const int       batchCount)
+{
+    return hipblasSgesvStridedBatched(
+        handle, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb, strideB, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGesvStridedBatched<double>(hipblasHandle_t handle,
+                                                  const int       n,
+                                                  const int       nrhs,
+                                                  double*         A,
+                                                  const int       lda,
+                                                  const int       strideA,
+                                                  int*            ipiv,
+                                                  const int       strideP,
+                                                  double*         B,
+                                                  const int       ldb,
+                                                  const int       strideB,
+                                                  int*            info,
+                                                  const int       batchCount)
+{
+    return hipblasDgesvStridedBatched(
+        handle, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb, strideB, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGesvStridedBatched<hipblasComplex>(hipblasHandle_t handle,
+                                                          const int       n,
+                                                          const int       nrhs,
+                                                          hipblasComplex* A,
+                                                          const int       lda,
+                                                          const int       strideA,
+                                                          int*            ipiv,
+                                                          const int       strideP,
+                                                          hipblasComplex* B,
+                                                          const int       ldb,
+                                                          const int       strideB,
+                                                          int*            info,
+                                                          const int       batchCount)
+{
+    return hipblasCgesvStridedBatched(
+        handle, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb, strideB, info, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGesvStridedBatched<hipblasDoubleComplex>(hipblasHandle_t       handle,
+                                                                const int             n,
+                                                                const int             nrhs,
+                                                                hipblasDoubleComplex* A,
+                                                                const int             lda,
+                                                                const int             strideA,
+                                                                int*                  ipiv,
+                                                                const int             strideP,
+                                                                hipblasDoubleComplex* B,
+                                                                const int             ldb,
+                                                                const int             strideB,
+                                                                int*                  info,
+                                                                const int             batchCount)
+{
+    return hipblasZgesvStridedBatched(
+        handle, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb, strideB, info, batchCount);
+}
+
+// gesv_mixed_strided_batched
+template <>
+hipblasStatus_t hipblasGesvMixedStridedBatched<double>(hipblasHandle_t handle,
+                                                       const int       n,
+                                                       const int       nrhs,
+                                                       double*         A,
+                                                       const int       lda,
+                                                       const int       strideA,
+                                                       int*            ipiv,
+                                                       const int       strideP,
+                                                       const double*   B,
+                                                       const int       ldb,
+                                                       const int       strideB,
+                                                       double*         X,
+                                                       const int       ldx,
+                                                       const int       strideX,
+                                                       int*            iter,
+                                                       int*            info,
+                                                       const int       batchCount)
+{
+    return hipblasDSgesvStridedBatched(handle,
+                                       n,
+                                       nrhs,
+                                       A,
+                                       lda,
+                                       strideA,
+                                       ipiv,
+                                       strideP,
+                                       B,
+                                       ldb,
+                                       strideB,
+                                       X,
+                                       ldx,
+                                       strideX,
+                                       iter,
+                                       info,
+                                       batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGesvMixedStridedBatched<hipblasDoubleComplex>(
+    hipblasHandle_t             handle,
+    const int                   n,
+    const int                   nrhs,
+    hipblasDoubleComplex*       A,
+    const int                   lda,
+    const int                   strideA,
+    int*                        ipiv,
+    const int                   strideP,
+    const hipblasDoubleComplex* B,
+    const int                   ldb,
+    const int                   strideB,
+    hipblasDoubleComplex*       X,
+    const int                   ldx,
+    const int                   strideX,
+    int*                        iter,
+    int*                        info,
+    const int                   batchCount)
+{
+    return hipblasZCgesvStridedBatched(handle,
+                                       n,
+                                       nrhs,
+                                       A,
+                                       lda,
+                                       strideA,
+                                       ipiv,
+                                       strideP,
+                                       B,
+                                       ldb,
+                                       strideB,
+                                       X,
+                                       ldx,
+                                       strideX,
+                                       iter,
+                                       info,
+                                       batchCount);
+}
+
+// geqrf
+template <>
+hipblasStatus_t hipblasGeqrf<float>(hipblasHandle_t handle,
+                                    const int       m,
+                                    const int       n,
+                                    float*          A,
+                                    const int       lda,
+                                    float*          ipiv,
+                                    int*            info)
+{
+    return hipblasSgeqrf(handle, m, n, A, lda, ipiv, info);
+}
+
+template <>
+hipblasStatus_t hipblasGeqrf<double>(hipblasHandle_t handle,
+                                     const int       m,
+                                     const int       n,
+                                     double*         A,
+                                     const int       lda,
+                                     double*         ipiv,
+                                     int*            info)
+{
+    return hipblasDgeqrf(handle, m, n, A, lda, ipiv, info);
+}
+
+template <>
+hipblasStatus_t hipblasGeqrf<hipblasComplex>(hipblasHandle_t handle,
+                                             const int       m,
+                                             const int       n,
+                                             hipblasComplex* A,
+                                             const int       lda,
+                                             hipblasComplex* ipiv,
+                                             int*            info)
+{
+    return hipblasCgeqrf(handle, m, n, A, lda, ipiv, info);
+}
+
+template <>
+hipblasStatus_t hipblasGeqrf<hipblasDoubleComplex>(hipblasHandle_t       handle,
+                                                   const int             m,
                                                    const int             n,
                                                    hipblasDoubleComplex* A,
                                                    const int             lda,
-                                                   int*                  ipiv,
+                                                   hipblasDoubleComplex* ipiv,
                                                    int*                  info)
 {
-    return hipblasZgetrf(handle, n, A, lda, ipiv, info);
+    return hipblasZgeqrf(handle, m, n, A, lda, ipiv, info);
 }
 
-// getrf_batched
+// geqrf_batched
 template <>
-hipblasStatus_t hipblasGetrfBatched<float>(hipblasHandle_t handle,
+hipblasStatus_t hipblasGeqrfBatched<float>(hipblasHandle_t handle,
+                                           const int       m,
                                            const int       n,
                                            float* const    A[],
                                            const int       lda,
-                                           int*            ipiv,
+                                           float* const    ipiv[],
                                            int*            info,
                                            const int       batchCount)
 {
-    return hipblasSgetrfBatched(handle, n, A, lda, ipiv, info, batchCount);
+    return hipblasSgeqrfBatched(handle, m, n, A, lda, ipiv, info, batchCount);
 }
 
 template <>
-hipblasStatus_t hipblasGetrfBatched<double>(hipblasHandle_t handle,
+hipblasStatus_t hipblasGeqrfBatched<double>(hipblasHandle_t handle,
+                                            const int       m,
                                             const int       n,
                                             double* const   A[],
                                             const int       lda,
-                                            int*            ipiv,
+                                            double* const   ipiv[],
                                             int*            info,
                                             const int       batchCount)
 {
-    return hipblasDgetrfBatched(handle, n, A, lda, ipiv, info, batchCount);
+    return hipblasDgeqrfBatched(handle, m, n, A, lda, ipiv, info, batchCount);
 }
 
 template <>
-hipblasStatus_t hipblasGetrfBatched<hipblasComplex>(hipblasHandle_t       handle,
+hipblasStatus_t hipblasGeqrfBatched<hipblasComplex>(hipblasHandle_t       handle,
+                                                    const int             m,
                                                     const int             n,
                                                     hipblasComplex* const A[],
                                                     const int             lda,
-                                                    int*                  ipiv,
+                                                    hipblasComplex* const ipiv[],
                                                     int*                  info,
                                                     const int             batchCount)
 {
-    return hipblasCgetrfBatched(handle, n, A, lda, ipiv, info, batchCount);
+    return hipblasCgeqrfBatched(handle, m, n, A, lda, ipiv, info, batchCount);
 }
 
 template <>
-hipblasStatus_t hipblasGetrfBatched<hipblasDoubleComplex>(hipblasHandle_t             handle,
+hipblasStatus_t hipblasGeqrfBatched<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                          const int                   m,
                                                           const int                   n,
                                                           hipblasDoubleComplex* const A[],
                                                           const int                   lda,
-                                                          int*                        ipiv,
+                                                          hipblasDoubleComplex* const ipiv[],
                                                           int*                        info,
                                                           const int                   batchCount)
 {
-    return hipblasZgetrfBatched(handle, n, A, lda, ipiv, info, batchCount);
+    return hipblasZgeqrfBatched(handle, m, n, A, lda, ipiv, info, batchCount);
 }
 
-// getrf_strided_batched
+// geqrf_strided_batched
 template <>
-hipblasStatus_t hipblasGetrfStridedBatched<float>(hipblasHandle_t handle,
+hipblasStatus_t hipblasGeqrfStridedBatched<float>(hipblasHandle_t handle,
+                                                  const int       m,
                                                   const int       n,
                                                   float*          A,
                                                   const int       lda,
                                                   const int       strideA,
-                                                  int*            ipiv,
+                                                  float*          ipiv,
                                                   const int       strideP,
                                                   int*            info,
                                                   const int       batchCount)
 {
-    return hipblasSgetrfStridedBatched(handle, n, A, lda, strideA, ipiv, strideP, info, batchCount);
+    return hipblasSgeqrfStridedBatched(
+        handle, m, n, A, lda, strideA, ipiv, strideP, info, batchCount);
 }
 
 template <>
-hipblasStatus_t hipblasGetrfStridedBatched<double>(hipblasHandle_t handle,
+hipblasStatus_t hipblasGeqrfStridedBatched<double>(hipblasHandle_t handle,
+                                                   const int       m,
                                                    const int       n,
                                                    double*         A,
                                                    const int       lda,
                                                    const int       strideA,
-                                                   int*            ipiv,
+                                                   double*         ipiv,
                                                    const int       strideP,
                                                    int*            info,
                                                    const int       batchCount)
 {
-    return hipblasDgetrfStridedBatched(handle, n, A, lda, strideA, ipiv, strideP, info, batchCount);
+    return hipblasDgeqrfStridedBatched(
+        handle, m, n, A, lda, strideA, ipiv, strideP, info, batchCount);
 }
 
 template <>
-hipblasStatus_t hipblasGetrfStridedBatched<hipblasComplex>(hipblasHandle_t handle,
+hipblasStatus_t hipblasGeqrfStridedBatched<hipblasComplex>(hipblasHandle_t handle,
+                                                           const int       m,
                                                            const int       n,
                                                            hipblasComplex* A,
                                                            const int       lda,
                                                            const int       strideA,
-                                                           int*            ipiv,
+                                                           hipblasComplex* ipiv,
                                                            const int       strideP,
                                                            int*            info,
                                                            const int       batchCount)
 {
-    return hipblasCgetrfStridedBatched(handle, n, A, lda, strideA, ipiv, strideP, info, batchCount);
+    return hipblasCgeqrfStridedBatched(
+        handle, m, n, A, lda, strideA, ipiv, strideP, info, batchCount);
 }
 
 template <>
-hipblasStatus_t hipblasGetrfStridedBatched<hipblasDoubleComplex>(hipblasHandle_t       handle,
+hipblasStatus_t hipblasGeqrfStridedBatched<hipblasDoubleComplex>(hipblasHandle_t       handle,
+                                                                 const int             m,
                                                                  const int             n,
                                                                  hipblasDoubleComplex* A,
                                                                  const int             lda,
                                                                  const int             strideA,
-                                                                 int*                  ipiv,
+                                                                 hipblasDoubleComplex* ipiv,
                                                                  const int             strideP,
                                                                  int*                  info,
                                                                  const int             batchCount)
 {
-    return hipblasZgetrfStridedBatched(handle, n, A, lda, strideA, ipiv, strideP, info, batchCount);
+    return hipblasZgeqrfStridedBatched(
+        handle, m, n, A, lda, strideA, ipiv, strideP, info, batchCount);
 }
 
-// getrs
+// ormqr
 template <>
-hipblasStatus_t hipblasGetrs<float>(hipblasHandle_t          handle,
+hipblasStatus_t hipblasOrmqr<float>(hipblasHandle_t          handle,
+                                    const hipblasSideMode_t  side,
                                     const hipblasOperation_t trans,
+                                    const int                m,
                                     const int                n,
-                                    const int                nrhs,
+                                    const int                k,
                                     float*                   A,
                                     const int                lda,
-                                    const int*               ipiv,
-                                    float*                   B,
-                                    const int                ldb,
+                                    float*                   tau,
+                                    float*                   C,
+                                    const int                ldc,
                                     int*                     info)
 {
-    return hipblasSgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, info);
+    return hipblasSormqr(handle, side, trans, m, n, k, A, lda, tau, C, ldc, info);
 }
 
 template <>
-hipblasStatus_t hipblasGetrs<double>(hipblasHandle_t          handle,
+hipblasStatus_t hipblasOrmqr<double>(hipblasHandle_t          handle,
+                                     const hipblasSideMode_t  side,
                                      const hipblasOperation_t trans,
+                                     const int                m,
                                      const int                n,
-                                     const int                nrhs,
+                                     const int                k,
                                      double*                  A,
                                      const int                lda,
-                                     const int*               ipiv,
-                                     double*                  B,
-                                     const int                ldb,
+                                     double*                  tau,
+                                     double*                  C,
+                                     const int                ldc,
                                      int*                     info)
 {
-    return hipblasDgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, info);
+    return hipblasDormqr(handle, side, trans, m, n, k, A, lda, tau, C, ldc, info);
 }
 
 template <>
-hipblasStatus_t hipblasGetrs<hipblasComplex>(hipblasHandle_t          handle,
+hipblasStatus_t hipblasOrmqr<hipblasComplex>(hipblasHandle_t          handle,
+                                             const hipblasSideMode_t  side,
                                              const hipblasOperation_t trans,
+                                             const int                m,
                                              const int                n,
-                                             const int                nrhs,
+                                             const int                k,
                                              hipblasComplex*          A,
                                              const int                lda,
-                                             const int*               ipiv,
-                                             hipblasComplex*          B,
-                                             const int                ldb,
+                                             hipblasComplex*          tau,
+                                             hipblasComplex*          C,
+                                             const int                ldc,
                                              int*                     info)
 {
-    return hipblasCgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, info);
+    return hipblasCunmqr(handle, side, trans, m, n, k, A, lda, tau, C, ldc, info);
 }
 
 template <>
-hipblasStatus_t hipblasGetrs<hipblasDoubleComplex>(hipblasHandle_t          handle,
+hipblasStatus_t hipblasOrmqr<hipblasDoubleComplex>(hipblasHandle_t          handle,
+                                                   const hipblasSideMode_t  side,
                                                    const hipblasOperation_t trans,
+                                                   const int                m,
                                                    const int                n,
-                                                   const int                nrhs,
+                                                   const int                k,
                                                    hipblasDoubleComplex*    A,
                                                    const int                lda,
-                                                   const int*               ipiv,
-                                                   hipblasDoubleComplex*    B,
-                                                   const int                ldb,
+                                                   hipblasDoubleComplex*    tau,
+                                                   hipblasDoubleComplex*    C,
+                                                   const int                ldc,
                                                    int*                     info)
 {
-    return hipblasZgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, info);
-}
-
-// getrs_batched
-template <>
-hipblasStatus_t hipblasGetrsBatched<float>(hipblasHandle_t          handle,
-                                           const hipblasOperation_t trans,
-                                           const int                n,
-                                           const int                nrhs,
-                                           float* const             A[],
-                                           const int                lda,
-                                           const int*               ipiv,
-                                           float* const             B[],
-                                           const int                ldb,
-                                           int*                     info,
-                                           const int                batchCount)
-{
-    return hipblasSgetrsBatched(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, info, batchCount);
-}
-
-template <>
-hipblasStatus_t hipblasGetrsBatched<double>(hipblasHandle_t          handle,
-                                            const hipblasOperation_t trans,
-                                            const int                n,
-                                            const int                nrhs,
-                                            double* const            A[],
-                                            const int                lda,
-                                            const int*               ipiv,
-                                            double* const            B[],
-                                            const int                ldb,
-                                            int*                     info,
-                                            const int                batchCount)
-{
-    return hipblasDgetrsBatched(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, info, batchCount);
-}
-
-template <>
-hipblasStatus_t hipblasGetrsBatched<hipblasComplex>(hipblasHandle_t          handle,
-                                                    const hipblasOperation_t trans,
-                                                    const int                n,
-                                                    const int                nrhs,
-                                                    hipblasComplex* const    A[],
-                                                    const int                lda,
-                                                    const int*               ipiv,
-                                                    hipblasComplex* const    B[],
-                                                    const int                ldb,
-                                                    int*                     info,
-                                                    const int                batchCount)
-{
-    return hipblasCgetrsBatched(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, info, batchCount);
-}
-
-template <>
-hipblasStatus_t hipblasGetrsBatched<hipblasDoubleComplex>(hipblasHandle_t             handle,
-                                                          const hipblasOperation_t    trans,
-                                                          const int                   n,
-                                                          const int                   nrhs,
-                                                          hipblasDoubleComplex* const A[],
-                                                          const int                   lda,
-                                                          const int*                  ipiv,
-                                                          hipblasDoubleComplex* const B[],
-                                                          const int                   ldb,
-                                                          int*                        info,
-                                                          const int                   batchCount)
-{
-    return hipblasZgetrsBatched(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, info, batchCount);
-}
-
-// getrs_strided_batched
-template <>
-hipblasStatus_t hipblasGetrsStridedBatched<float>(hipblasHandle_t          handle,
-                                                  const hipblasOperation_t trans,
-                                                  const int                n,
-                                                  const int                nrhs,
-                                                  float*                   A,
-                                                  const int                lda,
-                                                  const int                strideA,
-                                                  const int*               ipiv,
-                                                  const int                strideP,
-                                                  float*                   B,
-                                                  const int                ldb,
-                                                  const int                strideB,
-                                                  int*                     info,
-                                                  const int                batchCount)
-{
-    return hipblasSgetrsStridedBatched(
-        handle, trans, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb, strideB, info, batchCount);
-}
-
-template <>
-hipblasStatus_t hipblasGetrsStridedBatched<double>(hipblasHandle_t          handle,
-                                                   const hipblasOperation_t trans,
-                                                   const int                n,
-                                                   const int                nrhs,
-                                                   double*                  A,
-                                                   const int                lda,
-                                                   const int                strideA,
-                                                   const int*               ipiv,
-                                                   const int                strideP,
-                                                   double*                  B,
-                                                   const int                ldb,
-                                                   const int                strideB,
-                                                   int*                     info,
-                                                   const int                batchCount)
-{
-    return hipblasDgetrsStridedBatched(
-        handle, trans, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb, strideB, info, batchCount);
-}
-
-template <>
-hipblasStatus_t hipblasGetrsStridedBatched<hipblasComplex>(hipblasHandle_t          handle,
-                                                           const hipblasOperation_t trans,
-                                                           const int                n,
-                                                           const int                nrhs,
-                                                           hipblasComplex*          A,
-                                                           const int                lda,
-                                                           const int                strideA,
-                                                           const int*               ipiv,
-                                                           const int                strideP,
-                                                           hipblasComplex*          B,
-                                                           const int                ldb,
-                                                           const int                strideB,
-                                                           int*                     info,
-                                                           const int                batchCount)
-{
-    return hipblasCgetrsStridedBatched(
-        handle, trans, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb, strideB, info, batchCount);
-}
-
-template <>
-hipblasStatus_t hipblasGetrsStridedBatched<hipblasDoubleComplex>(hipblasHandle_t          handle,
-                                                                 const hipblasOperation_t trans,
-                                                                 const int                n,
-                                                                 const int                nrhs,
-                                                                 hipblasDoubleComplex*    A,
-                                                                 const int                lda,
-                                                                 const int                strideA,
-                                                                 const int*               ipiv,
-                                                                 const int                strideP,
-                                                                 hipblasDoubleComplex*    B,
-                                                                 const int                ldb,
-                                                                 const int                strideB,
-                                                                 int*                     info,
-                                                                 const int batchCount)
-{
-    return hipblasZgetrsStridedBatched(
-        handle, trans, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb, strideB, info, batchCount);
+    return hipblasZunmqr(handle, side, trans, m, n, k, A, lda, tau, C, ldc, info);
 }
 
-// geqrf
+// orgqr
 template <>
-hipblasStatus_t hipblasGeqrf<float>(hipblasHandle_t handle,
+hipblasStatus_t hipblasOrgqr<float>(hipblasHandle_t handle,
                                     const int       m,
                                     const int       n,
+                                    const int       k,
                                     float*          A,
                                     const int       lda,
-                                    float*          ipiv,
+                                    float*          tau,
                                     int*            info)
 {
-    return hipblasSgeqrf(handle, m, n, A, lda, ipiv, info);
+    return hipblasSorgqr(handle, m, n, k, A, lda, tau, info);
 }
 
 template <>
-hipblasStatus_t hipblasGeqrf<double>(hipblasHandle_t handle,
+hipblasStatus_t hipblasOrgqr<double>(hipblasHandle_t handle,
                                      const int       m,
                                      const int       n,
+                                     const int       k,
                                      double*         A,
                                      const int       lda,
-                                     double*         ipiv,
+                                     double*         tau,
                                      int*            info)
 {
-    return hipblasDgeqrf(handle, m, n, A, lda, ipiv, info);
+    return hipblasDorgqr(handle, m, n, k, A, lda, tau, info);
 }
 
 template <>
-hipblasStatus_t hipblasGeqrf<hipblasComplex>(hipblasHandle_t handle,
+hipblasStatus_t hipblasOrgqr<hipblasComplex>(hipblasHandle_t handle,
                                              const int       m,
                                              const int       n,
+                                             const int       k,
                                              hipblasComplex* A,
                                              const int       lda,
-                                             hipblasComplex* ipiv,
+                                             hipblasComplex* tau,
                                              int*            info)
 {
-    return hipblasCgeqrf(handle, m, n, A, lda, ipiv, info);
+    return hipblasCungqr(handle, m, n, k, A, lda, tau, info);
 }
 
 template <>
-hipblasStatus_t hipblasGeqrf<hipblasDoubleComplex>(hipblasHandle_t       handle,
+hipblasStatus_t hipblasOrgqr<hipblasDoubleComplex>(hipblasHandle_t       handle,
                                                    const int             m,
                                                    const int             n,
+                                                   const int             k,
                                                    hipblasDoubleComplex* A,
                                                    const int             lda,
-                                                   hipblasDoubleComplex* ipiv,
+                                                   hipblasDoubleComplex* tau,
                                                    int*                  info)
 {
-    return hipblasZgeqrf(handle, m, n, A, lda, ipiv, info);
+    return hipblasZungqr(handle, m, n, k, A, lda, tau, info);
 }
 
-// geqrf_batched
+// gels_batched
 template <>
-hipblasStatus_t hipblasGeqrfBatched<float>(hipblasHandle_t handle,
-                                           const int       m,
-                                           const int       n,
-                                           float* const    A[],
-                                           const int       lda,
-                                           float* const    ipiv[],
-                                           int*            info,
-                                           const int       batchCount)
+hipblasStatus_t hipblasGelsBatched<float>(hipblasHandle_t          handle,
+                                          const hipblasOperation_t trans,
+                                          const int                m,
+                                          const int                n,
+                                          const int                nrhs,
+                                          float* const             A[],
+                                          const int                lda,
+                                          float* const             B[],
+                                          const int                ldb,
+                                          int*                     info,
+                                          int*                     deviceInfo,
+                                          const int                batchCount)
 {
-    return hipblasSgeqrfBatched(handle, m, n, A, lda, ipiv, info, batchCount);
+    return hipblasSgelsBatched(
+        handle, trans, m, n, nrhs, A, lda, B, ldb, info, deviceInfo, batchCount);
 }
 
 template <>
-hipblasStatus_t hipblasGeqrfBatched<double>(hipblasHandle_t handle,
-                                            const int       m,
-                                            const int       n,
-                                            double* const   A[],
-                                            const int       lda,
-                                            double* const   ipiv[],
-                                            int*            info,
-                                            const int       batchCount)
+hipblasStatus_t hipblasGelsBatched<double>(hipblasHandle_t          handle,
+                                           const hipblasOperation_t trans,
+                                           const int                m,
+                                           const int                n,
+                                           const int                nrhs,
+                                           double* const            A[],
+                                           const int                lda,
+                                           double* const            B[],
+                                           const int                ldb,
+                                           int*                     info,
+                                           int*                     deviceInfo,
+                                           const int                batchCount)
 {
-    return hipblasDgeqrfBatched(handle, m, n, A, lda, ipiv, info, batchCount);
+    return hipblasDgelsBatched(
+        handle, trans, m, n, nrhs, A, lda, B, ldb, info, deviceInfo, batchCount);
 }
 
 template <>
-hipblasStatus_t hipblasGeqrfBatched<hipblasComplex>(hipblasHandle_t       handle,
-                                                    const int             m,
-                                                    const int             n,
-                                                    hipblasComplex* const A[],
-                                                    const int             lda,
-                                                    hipblasComplex* const ipiv[],
-                                                    int*                  info,
-                                                    const int             batchCount)
+hipblasStatus_t hipblasGelsBatched<hipblasComplex>(hipblasHandle_t          handle,
+                                                   const hipblasOperation_t trans,
+                                                   const int                m,
+                                                   const int                n,
+                                                   const int                nrhs,
+                                                   hipblasComplex* const    A[],
+                                                   const int                lda,
+                                                   hipblasComplex* const    B[],
+                                                   const int                ldb,
+                                                   int*                     info,
+                                                   int*                     deviceInfo,
+                                                   const int                batchCount)
 {
-    return hipblasCgeqrfBatched(handle, m, n, A, lda, ipiv, info, batchCount);
+    return hipblasCgelsBatched(
+        handle, trans, m, n, nrhs, A, lda, B, ldb, info, deviceInfo, batchCount);
 }
 
 template <>
-hipblasStatus_t hipblasGeqrfBatched<hipblasDoubleComplex>(hipblasHandle_t             handle,
-                                                          const int                   m,
-                                                          const int                   n,
-                                                          hipblasDoubleComplex* const A[],
-                                                          const int                   lda,
-                                                          hipblasDoubleComplex* const ipiv[],
-                                                          int*                        info,
-                                                          const int                   batchCount)
+hipblasStatus_t hipblasGelsBatched<hipblasDoubleComplex>(hipblasHandle_t             handle,
+                                                         const hipblasOperation_t    trans,
+                                                         const int                   m,
+                                                         const int                   n,
+                                                         const int                   nrhs,
+                                                         hipblasDoubleComplex* const A[],
+                                                         const int                   lda,
+                                                         hipblasDoubleComplex* const B[],
+                                                         const int                   ldb,
+                                                         int*                        info,
+                                                         int*                        deviceInfo,
+                                                         const int                   batchCount)
 {
-    return hipblasZgeqrfBatched(handle, m, n, A, lda, ipiv, info, batchCount);
+    return hipblasZgelsBatched(
+        handle, trans, m, n, nrhs, A, lda, B, ldb, info, deviceInfo, batchCount);
 }
 
-// geqrf_strided_batched
+// gels_strided_batched
 template <>
-hipblasStatus_t hipblasGeqrfStridedBatched<float>(hipblasHandle_t handle,
-                                                  const int       m,
-                                                  const int       n,
-                                                  float*          A,
-                                                  const int       lda,
-                                                  const int       strideA,
-                                                  float*          ipiv,
-                                                  const int       strideP,
-                                                  int*            info,
-                                                  const int       batchCount)
+hipblasStatus_t hipblasGelsStridedBatched<float>(hipblasHandle_t          handle,
+                                                 const hipblasOperation_t trans,
+                                                 const int                m,
+                                                 const int                n,
+                                                 const int                nrhs,
+                                                 float*                   A,
+                                                 const int                lda,
+                                                 const int                strideA,
+                                                 float*                   B,
+                                                 const int                ldb,
+                                                 const int                strideB,
+                                                 int*                     info,
+                                                 int*                     deviceInfo,
+                                                 const int                batchCount)
 {
-    return hipblasSgeqrfStridedBatched(
-        handle, m, n, A, lda, strideA, ipiv, strideP, info, batchCount);
+    return hipblasSgelsStridedBatched(
+        handle, trans, m, n, nrhs, A, lda, strideA, B, ldb, strideB, info, deviceInfo, batchCount);
 }
 
 template <>
-hipblasStatus_t hipblasGeqrfStridedBatched<double>(hipblasHandle_t handle,
-                                                   const int       m,
-                                                   const int       n,
-                                                   double*         A,
-                                                   const int       lda,
-                                                   const int       strideA,
-                                                   double*         ipiv,
-                                                   const int       strideP,
-                                                   int*            info,
-                                                   const int       batchCount)
+hipblasStatus_t hipblasGelsStridedBatched<double>(hipblasHandle_t          handle,
+                                                  const hipblasOperation_t trans,
+                                                  const int                m,
+                                                  const int                n,
+                                                  const int                nrhs,
+                                                  double*                  A,
+                                                  const int                lda,
+                                                  const int                strideA,
+                                                  double*                  B,
+                                                  const int                ldb,
+                                                  const int                strideB,
+                                                  int*                     info,
+                                                  int*                     deviceInfo,
+                                                  const int                batchCount)
 {
-    return hipblasDgeqrfStridedBatched(
-        handle, m, n, A, lda, strideA, ipiv, strideP, info, batchCount);
+    return hipblasDgelsStridedBatched(
+        handle, trans, m, n, nrhs, A, lda, strideA, B, ldb, strideB, info, deviceInfo, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGelsStridedBatched<hipblasComplex>(hipblasHandle_t          handle,
+                                                          const hipblasOperation_t trans,
+                                                          const int                m,
+                                                          const int                n,
+                                                          const int                nrhs,
+                                                          hipblasComplex*          A,
+                                                          const int                lda,
+                                                          const int                strideA,
+                                                          hipblasComplex*          B,
+                                                          const int                ldb,
+                                                          const int                strideB,
+                                                          int*                     info,
+                                                          int*                     deviceInfo,
+                                                          const int                batchCount)
+{
+    return hipblasCgelsStridedBatched(
+        handle, trans, m, n, nrhs, A, lda, strideA, B, ldb, strideB, info, deviceInfo, batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGelsStridedBatched<hipblasDoubleComplex>(hipblasHandle_t          handle,
+                                                                const hipblasOperation_t trans,
+                                                                const int                m,
+                                                                const int                n,
+                                                                const int                nrhs,
+                                                                hipblasDoubleComplex*    A,
+                                                                const int                lda,
+                                                                const int                strideA,
+                                                                hipblasDoubleComplex*    B,
+                                                                const int                ldb,
+                                                                const int                strideB,
+                                                                int*                     info,
+                                                                int*                     deviceInfo,
+                                                                const int                batchCount)
+{
+    return hipblasZgelsStridedBatched(
+        handle, trans, m, n, nrhs, A, lda, strideA, B, ldb, strideB, info, deviceInfo, batchCount);
+}
+
+// syevj_batched
+template <>
+hipblasStatus_t hipblasSyevjBatched<float, float>(hipblasHandle_t         handle,
+                                                  const hipblasEvect_t    evect,
+                                                  const hipblasFillMode_t uplo,
+                                                  const int               n,
+                                                  float* const            A[],
+                                                  const int               lda,
+                                                  const float             abstol,
+                                                  float*                  residual,
+                                                  const int               max_sweeps,
+                                                  int*                    n_sweeps,
+                                                  float*                  W,
+                                                  const int               strideW,
+                                                  int*                    info,
+                                                  const int               batchCount)
+{
+    return hipblasSsyevjBatched(handle,
+                                evect,
+                                uplo,
+                                n,
+                                A,
+                                lda,
+                                abstol,
+                                residual,
+                                max_sweeps,
+                                n_sweeps,
+                                W,
+                                strideW,
+                                info,
+                                batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasSyevjBatched<double, double>(hipblasHandle_t         handle,
+                                                    const hipblasEvect_t    evect,
+                                                    const hipblasFillMode_t uplo,
+                                                    const int               n,
+                                                    double* const           A[],
+                                                    const int               lda,
+                                                    const double            abstol,
+                                                    double*                 residual,
+                                                    const int               max_sweeps,
+                                                    int*                    n_sweeps,
+                                                    double*                 W,
+                                                    const int               strideW,
+                                                    int*                    info,
+                                                    const int               batchCount)
+{
+    return hipblasDsyevjBatched(handle,
+                                evect,
+                                uplo,
+                                n,
+                                A,
+                                lda,
+                                abstol,
+                                residual,
+                                max_sweeps,
+                                n_sweeps,
+                                W,
+                                strideW,
+                                info,
+                                batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasSyevjBatched<hipblasComplex, float>(hipblasHandle_t         handle,
+                                                           const hipblasEvect_t    evect,
+                                                           const hipblasFillMode_t uplo,
+                                                           const int               n,
+                                                           hipblasComplex* const   A[],
+                                                           const int               lda,
+                                                           const float             abstol,
+                                                           float*                  residual,
+                                                           const int               max_sweeps,
+                                                           int*                    n_sweeps,
+                                                           float*                  W,
+                                                           const int               strideW,
+                                                           int*                    info,
+                                                           const int               batchCount)
+{
+    return hipblasCheevjBatched(handle,
+                                evect,
+                                uplo,
+                                n,
+                                A,
+                                lda,
+                                abstol,
+                                residual,
+                                max_sweeps,
+                                n_sweeps,
+                                W,
+                                strideW,
+                                info,
+                                batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasSyevjBatched<hipblasDoubleComplex, double>(
+    hipblasHandle_t             handle,
+    const hipblasEvect_t        evect,
+    const hipblasFillMode_t     uplo,
+    const int                   n,
+    hipblasDoubleComplex* const A[],
+    const int                   lda,
+    const double                abstol,
+    double*                     residual,
+    const int                   max_sweeps,
+    int*                        n_sweeps,
+    double*                     W,
+    const int                   strideW,
+    int*                        info,
+    const int                   batchCount)
+{
+    return hipblasZheevjBatched(handle,
+                                evect,
+                                uplo,
+                                n,
+                                A,
+                                lda,
+                                abstol,
+                                residual,
+                                max_sweeps,
+                                n_sweeps,
+                                W,
+                                strideW,
+                                info,
+                                batchCount);
+}
+
+// syevj_strided_batched
+template <>
+hipblasStatus_t hipblasSyevjStridedBatched<float, float>(hipblasHandle_t         handle,
+                                                         const hipblasEvect_t    evect,
+                                                         const hipblasFillMode_t uplo,
+                                                         const int               n,
+                                                         float*                  A,
+                                                         const int               lda,
+                                                         const int               strideA,
+                                                         const float             abstol,
+                                                         float*                  residual,
+                                                         const int               max_sweeps,
+                                                         int*                    n_sweeps,
+                                                         float*                  W,
+                                                         const int               strideW,
+                                                         int*                    info,
+                                                         const int               batchCount)
+{
+    return hipblasSsyevjStridedBatched(handle,
+                                       evect,
+                                       uplo,
+                                       n,
+                                       A,
+                                       lda,
+                                       strideA,
+                                       abstol,
+                                       residual,
+                                       max_sweeps,
+                                       n_sweeps,
+                                       W,
+                                       strideW,
+                                       info,
+                                       batchCount);
 }
 
 template <>
-hipblasStatus_t hipblasGeqrfStridedBatched<hipblasComplex>(hipblasHandle_t handle,
-                                                           const int       m,
-                                                           const int       n,
-                                                           hipblasComplex* A,
-                                                           const int       lda,
-                                                           const int       strideA,
-                                                           hipblasComplex* ipiv,
-                                                           const int       strideP,
-                                                           int*            info,
-                                                           const int       batchCount)
+hipblasStatus_t hipblasSyevjStridedBatched<double, double>(hipblasHandle_t         handle,
+                                                           const hipblasEvect_t    evect,
+                                                           const hipblasFillMode_t uplo,
+                                                           const int               n,
+                                                           double*                 A,
+                                                           const int               lda,
+                                                           const int               strideA,
+                                                           const double            abstol,
+                                                           double*                 residual,
+                                                           const int               max_sweeps,
+                                                           int*                    n_sweeps,
+                                                           double*                 W,
+                                                           const int               strideW,
+                                                           int*                    info,
+                                                           const int               batchCount)
+{
+    return hipblasDsyevjStridedBatched(handle,
+                                       evect,
+                                       uplo,
+                                       n,
+                                       A,
+                                       lda,
+                                       strideA,
+                                       abstol,
+                                       residual,
+                                       max_sweeps,
+                                       n_sweeps,
+                                       W,
+                                       strideW,
+                                       info,
+                                       batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasSyevjStridedBatched<hipblasComplex, float>(
+    hipblasHandle_t         handle,
+    const hipblasEvect_t    evect,
+    const hipblasFillMode_t uplo,
+    const int               n,
+    hipblasComplex*         A,
+    const int               lda,
+    const int               strideA,
+    const float             abstol,
+    float*                  residual,
+    const int               max_sweeps,
+    int*                    n_sweeps,
+    float*                  W,
+    const int               strideW,
+    int*                    info,
+    const int               batchCount)
+{
+    return hipblasCheevjStridedBatched(handle,
+                                       evect,
+                                       uplo,
+                                       n,
+                                       A,
+                                       lda,
+                                       strideA,
+                                       abstol,
+                                       residual,
+                                       max_sweeps,
+                                       n_sweeps,
+                                       W,
+                                       strideW,
+                                       info,
+                                       batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasSyevjStridedBatched<hipblasDoubleComplex, double>(
+    hipblasHandle_t         handle,
+    const hipblasEvect_t    evect,
+    const hipblasFillMode_t uplo,
+    const int               n,
+    hipblasDoubleComplex*   A,
+    const int               lda,
+    const int               strideA,
+    const double            abstol,
+    double*                 residual,
+    const int               max_sweeps,
+    int*                    n_sweeps,
+    double*                 W,
+    const int               strideW,
+    int*                    info,
+    const int               batchCount)
+{
+    return hipblasZheevjStridedBatched(handle,
+                                       evect,
+                                       uplo,
+                                       n,
+                                       A,
+                                       lda,
+                                       strideA,
+                                       abstol,
+                                       residual,
+                                       max_sweeps,
+                                       n_sweeps,
+                                       W,
+                                       strideW,
+                                       info,
+                                       batchCount);
+}
+
+// gesvdj_strided_batched
+template <>
+hipblasStatus_t hipblasGesvdjStridedBatched<float, float>(hipblasHandle_t      handle,
+                                                          const hipblasSvect_t left_svect,
+                                                          const hipblasSvect_t right_svect,
+                                                          const int            m,
+                                                          const int            n,
+                                                          float*               A,
+                                                          const int            lda,
+                                                          const int            strideA,
+                                                          const float          abstol,
+                                                          float*               residual,
+                                                          const int            max_sweeps,
+                                                          int*                 n_sweeps,
+                                                          float*               S,
+                                                          const int            strideS,
+                                                          float*               U,
+                                                          const int            ldu,
+                                                          const int            strideU,
+                                                          float*               V,
+                                                          const int            ldv,
+                                                          const int            strideV,
+                                                          int*                 info,
+                                                          const int            batchCount)
+{
+    return hipblasSgesvdjStridedBatched(handle,
+                                        left_svect,
+                                        right_svect,
+                                        m,
+                                        n,
+                                        A,
+                                        lda,
+                                        strideA,
+                                        abstol,
+                                        residual,
+                                        max_sweeps,
+                                        n_sweeps,
+                                        S,
+                                        strideS,
+                                        U,
+                                        ldu,
+                                        strideU,
+                                        V,
+                                        ldv,
+                                        strideV,
+                                        info,
+                                        batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGesvdjStridedBatched<double, double>(hipblasHandle_t      handle,
+                                                            const hipblasSvect_t left_svect,
+                                                            const hipblasSvect_t right_svect,
+                                                            const int            m,
+                                                            const int            n,
+                                                            double*              A,
+                                                            const int            lda,
+                                                            const int            strideA,
+                                                            const double         abstol,
+                                                            double*              residual,
+                                                            const int            max_sweeps,
+                                                            int*                 n_sweeps,
+                                                            double*              S,
+                                                            const int            strideS,
+                                                            double*              U,
+                                                            const int            ldu,
+                                                            const int            strideU,
+                                                            double*              V,
+                                                            const int            ldv,
+                                                            const int            strideV,
+                                                            int*                 info,
+                                                            const int            batchCount)
+{
+    return hipblasDgesvdjStridedBatched(handle,
+                                        left_svect,
+                                        right_svect,
+                                        m,
+                                        n,
+                                        A,
+                                        lda,
+                                        strideA,
+                                        abstol,
+                                        residual,
+                                        max_sweeps,
+                                        n_sweeps,
+                                        S,
+                                        strideS,
+                                        U,
+                                        ldu,
+                                        strideU,
+                                        V,
+                                        ldv,
+                                        strideV,
+                                        info,
+                                        batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGesvdjStridedBatched<hipblasComplex, float>(hipblasHandle_t      handle,
+                                                                   const hipblasSvect_t left_svect,
+                                                                   const hipblasSvect_t right_svect,
+                                                                   const int            m,
+                                                                   const int            n,
+                                                                   hipblasComplex*      A,
+                                                                   const int            lda,
+                                                                   const int            strideA,
+                                                                   const float          abstol,
+                                                                   float*               residual,
+                                                                   const int            max_sweeps,
+                                                                   int*                 n_sweeps,
+                                                                   float*               S,
+                                                                   const int            strideS,
+                                                                   hipblasComplex*      U,
+                                                                   const int            ldu,
+                                                                   const int            strideU,
+                                                                   hipblasComplex*      V,
+                                                                   const int            ldv,
+                                                                   const int            strideV,
+                                                                   int*                 info,
+                                                                   const int            batchCount)
+{
+    return hipblasCgesvdjStridedBatched(handle,
+                                        left_svect,
+                                        right_svect,
+                                        m,
+                                        n,
+                                        A,
+                                        lda,
+                                        strideA,
+                                        abstol,
+                                        residual,
+                                        max_sweeps,
+                                        n_sweeps,
+                                        S,
+                                        strideS,
+                                        U,
+                                        ldu,
+                                        strideU,
+                                        V,
+                                        ldv,
+                                        strideV,
+                                        info,
+                                        batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasGesvdjStridedBatched<hipblasDoubleComplex, double>(
+    hipblasHandle_t       handle,
+    const hipblasSvect_t  left_svect,
+    const hipblasSvect_t  right_svect,
+    const int             m,
+    const int             n,
+    hipblasDoubleComplex* A,
+    const int             lda,
+    const int             strideA,
+    const double          abstol,
+    double*               residual,
+    const int             max_sweeps,
+    int*                  n_sweeps,
+    double*               S,
+    const int             strideS,
+    hipblasDoubleComplex* U,
+    const int             ldu,
+    const int             strideU,
+    hipblasDoubleComplex* V,
+    const int             ldv,
+    const int             strideV,
+    int*                  info,
+    const int             batchCount)
+{
+    return hipblasZgesvdjStridedBatched(handle,
+                                        left_svect,
+                                        right_svect,
+                                        m,
+                                        n,
+                                        A,
+                                        lda,
+                                        strideA,
+                                        abstol,
+                                        residual,
+                                        max_sweeps,
+                                        n_sweeps,
+                                        S,
+                                        strideS,
+                                        U,
+                                        ldu,
+                                        strideU,
+                                        V,
+                                        ldv,
+                                        strideV,
+                                        info,
+                                        batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasSytrfStridedBatched<float>(hipblasHandle_t         handle,
+                                                  const hipblasFillMode_t uplo,
+                                                  const int               n,
+                                                  float*                  A,
+                                                  const int               lda,
+                                                  const int               strideA,
+                                                  int*                    ipiv,
+                                                  const int               strideP,
+                                                  int*                    info,
+                                                  const int               batchCount)
+{
+    return hipblasSsytrfStridedBatched(handle,
+                                       uplo,
+                                       n,
+                                       A,
+                                       lda,
+                                       strideA,
+                                       ipiv,
+                                       strideP,
+                                       info,
+                                       batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasSytrfStridedBatched<double>(hipblasHandle_t         handle,
+                                                   const hipblasFillMode_t uplo,
+                                                   const int               n,
+                                                   double*                 A,
+                                                   const int               lda,
+                                                   const int               strideA,
+                                                   int*                    ipiv,
+                                                   const int               strideP,
+                                                   int*                    info,
+                                                   const int               batchCount)
 {
-    return hipblasCgeqrfStridedBatched(
-        handle, m, n, A, lda, strideA, ipiv, strideP, info, batchCount);
+    return hipblasDsytrfStridedBatched(handle,
+                                       uplo,
+                                       n,
+                                       A,
+                                       lda,
+                                       strideA,
+                                       ipiv,
+                                       strideP,
+                                       info,
+                                       batchCount);
 }
 
 template <>
-hipblasStatus_t hipblasGeqrfStridedBatched<hipblasDoubleComplex>(hipblasHandle_t       handle,
-                                                                 const int             m,
-                                                                 const int             n,
-                                                                 hipblasDoubleComplex* A,
-                                                                 const int             lda,
-                                                                 const int             strideA,
-                                                                 hipblasDoubleComplex* ipiv,
-                                                                 const int             strideP,
-                                                                 int*                  info,
-                                                                 const int             batchCount)
+hipblasStatus_t hipblasSytrfStridedBatched<hipblasComplex>(hipblasHandle_t         handle,
+                                                           const hipblasFillMode_t uplo,
+                                                           const int               n,
+                                                           hipblasComplex*         A,
+                                                           const int               lda,
+                                                           const int               strideA,
+                                                           int*                    ipiv,
+                                                           const int               strideP,
+                                                           int*                    info,
+                                                           const int               batchCount)
 {
-    return hipblasZgeqrfStridedBatched(
-        handle, m, n, A, lda, strideA, ipiv, strideP, info, batchCount);
+    return hipblasCsytrfStridedBatched(handle,
+                                       uplo,
+                                       n,
+                                       A,
+                                       lda,
+                                       strideA,
+                                       ipiv,
+                                       strideP,
+                                       info,
+                                       batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasSytrfStridedBatched<hipblasDoubleComplex>(hipblasHandle_t         handle,
+                                                                 const hipblasFillMode_t uplo,
+                                                                 const int               n,
+                                                                 hipblasDoubleComplex*   A,
+                                                                 const int               lda,
+                                                                 const int               strideA,
+                                                                 int*                    ipiv,
+                                                                 const int               strideP,
+                                                                 int*                    info,
+                                                                 const int               batchCount)
+{
+    return hipblasZsytrfStridedBatched(handle,
+                                       uplo,
+                                       n,
+                                       A,
+                                       lda,
+                                       strideA,
+                                       ipiv,
+                                       strideP,
+                                       info,
+                                       batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasSytrsStridedBatched<float>(hipblasHandle_t         handle,
+                                                  const hipblasFillMode_t uplo,
+                                                  const int               n,
+                                                  const int               nrhs,
+                                                  float*                  A,
+                                                  const int               lda,
+                                                  const int               strideA,
+                                                  const int*              ipiv,
+                                                  const int               strideP,
+                                                  float*                  B,
+                                                  const int               ldb,
+                                                  const int               strideB,
+                                                  int*                    info,
+                                                  const int               batchCount)
+{
+    return hipblasSsytrsStridedBatched(handle,
+                                       uplo,
+                                       n,
+                                       nrhs,
+                                       A,
+                                       lda,
+                                       strideA,
+                                       ipiv,
+                                       strideP,
+                                       B,
+                                       ldb,
+                                       strideB,
+                                       info,
+                                       batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasSytrsStridedBatched<double>(hipblasHandle_t         handle,
+                                                   const hipblasFillMode_t uplo,
+                                                   const int               n,
+                                                   const int               nrhs,
+                                                   double*                 A,
+                                                   const int               lda,
+                                                   const int               strideA,
+                                                   const int*              ipiv,
+                                                   const int               strideP,
+                                                   double*                 B,
+                                                   const int               ldb,
+                                                   const int               strideB,
+                                                   int*                    info,
+                                                   const int               batchCount)
+{
+    return hipblasDsytrsStridedBatched(handle,
+                                       uplo,
+                                       n,
+                                       nrhs,
+                                       A,
+                                       lda,
+                                       strideA,
+                                       ipiv,
+                                       strideP,
+                                       B,
+                                       ldb,
+                                       strideB,
+                                       info,
+                                       batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasSytrsStridedBatched<hipblasComplex>(hipblasHandle_t         handle,
+                                                           const hipblasFillMode_t uplo,
+                                                           const int               n,
+                                                           const int               nrhs,
+                                                           hipblasComplex*         A,
+                                                           const int               lda,
+                                                           const int               strideA,
+                                                           const int*              ipiv,
+                                                           const int               strideP,
+                                                           hipblasComplex*         B,
+                                                           const int               ldb,
+                                                           const int               strideB,
+                                                           int*                    info,
+                                                           const int               batchCount)
+{
+    return hipblasCsytrsStridedBatched(handle,
+                                       uplo,
+                                       n,
+                                       nrhs,
+                                       A,
+                                       lda,
+                                       strideA,
+                                       ipiv,
+                                       strideP,
+                                       B,
+                                       ldb,
+                                       strideB,
+                                       info,
+                                       batchCount);
+}
+
+template <>
+hipblasStatus_t hipblasSytrsStridedBatched<hipblasDoubleComplex>(hipblasHandle_t         handle,
+                                                                 const hipblasFillMode_t uplo,
+                                                                 const int               n,
+                                                                 const int               nrhs,
+                                                                 hipblasDoubleComplex*   A,
+                                                                 const int               lda,
+                                                                 const int               strideA,
+                                                                 const int*              ipiv,
+                                                                 const int               strideP,
+                                                                 hipblasDoubleComplex*   B,
+                                                                 const int               ldb,
+                                                                 const int               strideB,
+                                                                 int*                    info,
+                                                                 const int               batchCount)
+{
+    return hipblasZsytrsStridedBatched(handle,
+                                       uplo,
+                                       n,
+                                       nrhs,
+                                       A,
+                                       lda,
+                                       strideA,
+                                       ipiv,
+                                       strideP,
+                                       B,
+                                       ldb,
+                                       strideB,
+                                       info,
+                                       batchCount);
+}
+
+// tsqr
+template <>
+hipblasStatus_t hipblasTsqr<float>(hipblasHandle_t   handle,
+                                   hipblasTsqrAlgo_t algo,
+                                   int               m,
+                                   int               n,
+                                   float*            A,
+                                   int               lda,
+                                   float*            R,
+                                   int               ldr)
+{
+    return hipblasStsqr(handle, algo, m, n, A, lda, R, ldr);
+}
+
+template <>
+hipblasStatus_t hipblasTsqr<double>(hipblasHandle_t   handle,
+                                    hipblasTsqrAlgo_t algo,
+                                    int               m,
+                                    int               n,
+                                    double*           A,
+                                    int               lda,
+                                    double*           R,
+                                    int               ldr)
+{
+    return hipblasDtsqr(handle, algo, m, n, A, lda, R, ldr);
+}
+
+template <>
+hipblasStatus_t hipblasTsqr<hipblasComplex>(hipblasHandle_t   handle,
+                                            hipblasTsqrAlgo_t algo,
+                                            int               m,
+                                            int               n,
+                                            hipblasComplex*   A,
+                                            int               lda,
+                                            hipblasComplex*   R,
+                                            int               ldr)
+{
+    return hipblasCtsqr(handle, algo, m, n, A, lda, R, ldr);
+}
+
+template <>
+hipblasStatus_t hipblasTsqr<hipblasDoubleComplex>(hipblasHandle_t       handle,
+                                                  hipblasTsqrAlgo_t     algo,
+                                                  int                   m,
+                                                  int                   n,
+                                                  hipblasDoubleComplex* A,
+                                                  int                   lda,
+                                                  hipblasDoubleComplex* R,
+                                                  int                   ldr)
+{
+    return hipblasZtsqr(handle, algo, m, n, A, lda, R, ldr);
 }
 
 #endif
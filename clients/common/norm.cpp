@@ -4,47 +4,148 @@
  * ************************************************************************ */
 
 #include "norm.h"
-#include "cblas.h"
 #include "hipblas.h"
+#include "hipblas.hpp"
+#include "utility.h"
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <hip/hip_runtime_api.h>
+#include <mutex>
 #include <stdio.h>
 
 /* =====================================================================
      README: Norm check: norm(A-B)/norm(A), evaluate relative error
              Numerically, it is recommended by lapack.
 
-    Call lapack fortran routines that do not exsit in cblas library.
-    No special header is required. But need to declare
-    function prototype
-
-    All the functions are fortran and should append underscore (_) while declaring prototype and
-   calling.
-    xlange and xaxpy prototype are like following
+    Both norms come from one sweep over the two matrices, with the columns split over host
+    threads; the norm types are those of lapack xlange and xlansy: 'M' for the largest element,
+    'O' or '1' for the largest column sum, 'I' for the largest row sum and 'F' or 'E' for the
+    Frobenius norm. Neither matrix is modified
     =================================================================== */
 
-#ifdef __cplusplus
-extern "C" {
-#endif
-
-float  slange_(char* norm_type, int* m, int* n, float* A, int* lda, float* work);
-double dlange_(char* norm_type, int* m, int* n, double* A, int* lda, double* work);
-float  clange_(char* norm_type, int* m, int* n, hipblasComplex* A, int* lda, float* work);
-double zlange_(char* norm_type, int* m, int* n, hipblasDoubleComplex* A, int* lda, double* work);
-
-float  slansy_(char* norm_type, char* uplo, int* n, float* A, int* lda, float* work);
-double dlansy_(char* norm_type, char* uplo, int* n, double* A, int* lda, double* work);
-//  float  clanhe_(char* norm_type, char* uplo, int* n, hipblasComplex* A, int* lda, float* work);
-//  double zlanhe_(char* norm_type, char* uplo, int* n, hipblasDoubleComplex* A, int* lda, double*
-//  work);
-
-void saxpy_(int* n, float* alpha, float* x, int* incx, float* y, int* incy);
-void daxpy_(int* n, double* alpha, double* x, int* incx, double* y, int* incy);
-void caxpy_(int* n, float* alpha, hipblasComplex* x, int* incx, hipblasComplex* y, int* incy);
-void zaxpy_(
-    int* n, double* alpha, hipblasDoubleComplex* x, int* incx, hipblasDoubleComplex* y, int* incy);
-
-#ifdef __cplusplus
+namespace
+{
+    // lange takes the modulus of complex elements
+    inline double norm_abs(double a)
+    {
+        return std::abs(a);
+    }
+
+    template <typename T>
+    inline double norm_abs(const hip_complex_number<T>& z)
+    {
+        return std::hypot(double(z.x), double(z.y));
+    }
+
+    inline double norm_abs_diff(double a, double b)
+    {
+        return std::abs(a - b);
+    }
+
+    template <typename T>
+    inline double norm_abs_diff(const hip_complex_number<T>& a, const hip_complex_number<T>& b)
+    {
+        return std::hypot(double(a.x) - double(b.x), double(a.y) - double(b.y));
+    }
+
+    // index 0 measures hCPU and index 1 hCPU - hGPU
+    struct norm_sums
+    {
+        double         max[2]     = {0, 0};
+        double         max_col[2] = {0, 0};
+        double         ss[2]      = {0, 0};
+        vector<double> row[2];
+
+        void merge(const norm_sums& p)
+        {
+            for(int s = 0; s < 2; s++)
+            {
+                max[s]     = std::max(max[s], p.max[s]);
+                max_col[s] = std::max(max_col[s], p.max_col[s]);
+                ss[s] += p.ss[s];
+                for(size_t i = 0; i < row[s].size(); i++)
+                    row[s][i] += p.row[s][i];
+            }
+        }
+
+        double norm(char norm_type, bool symmetric, int s) const
+        {
+            switch(norm_type)
+            {
+            case 'M':
+                return max[s];
+            case 'O':
+            case '1':
+                if(!symmetric)
+                    return max_col[s];
+            // the column sums of a symmetric matrix are its row sums
+            case 'I':
+                return row[s].empty() ? 0 : *std::max_element(row[s].begin(), row[s].end());
+            default:
+                return std::sqrt(ss[s]);
+            }
+        }
+    };
+
+    // uplo 'U' or 'L' names the triangle a symmetric matrix is stored in; a general M x N matrix
+    // passes uplo 0
+    template <typename T>
+    double norm_error(
+        char norm_type, char uplo, int M, int N, int lda, const T* hCPU, const T* hGPU)
+    {
+        if(M <= 0 || N <= 0)
+            return 0;
+
+        norm_type      = char(std::toupper(norm_type));
+        bool symmetric = uplo != 0;
+        bool upper     = std::toupper(uplo) == 'U';
+        bool rows      = norm_type == 'I' || (symmetric && (norm_type == 'O' || norm_type == '1'));
+
+        norm_sums  total;
+        std::mutex mutex;
+        for(int s = 0; s < 2 && rows; s++)
+            total.row[s].assign(M, 0);
+
+        hipblas_parallel_for(N, (size_t(1) << 20) / M + 1, [&](size_t first, size_t last) {
+            norm_sums part;
+            for(int s = 0; s < 2 && rows; s++)
+                part.row[s].assign(M, 0);
+
+            for(size_t j = first; j < last; j++)
+            {
+                size_t   begin  = symmetric && !upper ? j : 0;
+                size_t   end    = symmetric && upper ? j + 1 : M;
+                double   col[2] = {0, 0};
+                const T* a      = hCPU + j * lda;
+                const T* b      = hGPU + j * lda;
+                for(size_t i = begin; i < end; i++)
+                {
+                    double v[2]   = {norm_abs(a[i]), norm_abs_diff(a[i], b[i])};
+                    double mirror = symmetric && i != j;
+                    for(int s = 0; s < 2; s++)
+                    {
+                        part.max[s] = std::max(part.max[s], v[s]);
+                        part.ss[s] += (1 + mirror) * v[s] * v[s];
+                        col[s] += v[s];
+                        if(rows)
+                        {
+                            part.row[s][i] += v[s];
+                            part.row[s][j] += mirror * v[s];
+                        }
+                    }
+                }
+                for(int s = 0; s < 2; s++)
+                    part.max_col[s] = std::max(part.max_col[s], col[s]);
+            }
+
+            std::lock_guard<std::mutex> lock(mutex);
+            total.merge(part);
+        });
+
+        return total.norm(norm_type, symmetric, 1) / total.norm(norm_type, symmetric, 0);
+    }
 }
-#endif
 
 /* ============================Norm Check for General Matrix: float/double/complex template
  * speciliazation ======================================= */
@@ -53,77 +154,86 @@ void zaxpy_(
 template <>
 double norm_check_general<float>(char norm_type, int M, int N, int lda, float* hCPU, float* hGPU)
 {
-    // norm type can be M', 'I', 'F', 'l': 'F' (Frobenius norm) is used mostly
-
-    float work;
-    int   incx  = 1;
-    float alpha = -1.0f;
-    int   size  = lda * N;
-
-    float cpu_norm = slange_(&norm_type, &M, &N, hCPU, &lda, &work);
-    saxpy_(&size, &alpha, hCPU, &incx, hGPU, &incx);
-
-    float error = slange_(&norm_type, &M, &N, hGPU, &lda, &work) / cpu_norm;
-
-    return (double)error;
+    return norm_error(norm_type, 0, M, N, lda, hCPU, hGPU);
 }
 
 template <>
 double norm_check_general<double>(char norm_type, int M, int N, int lda, double* hCPU, double* hGPU)
 {
-    // norm type can be M', 'I', 'F', 'l': 'F' (Frobenius norm) is used mostly
-
-    double work[1];
-    int    incx  = 1;
-    double alpha = -1.0;
-    int    size  = lda * N;
-
-    double cpu_norm = dlange_(&norm_type, &M, &N, hCPU, &lda, work);
-    daxpy_(&size, &alpha, hCPU, &incx, hGPU, &incx);
-
-    double error = dlange_(&norm_type, &M, &N, hGPU, &lda, work) / cpu_norm;
-
-    return error;
+    return norm_error(norm_type, 0, M, N, lda, hCPU, hGPU);
 }
 
 template <>
 double norm_check_general<hipblasComplex>(
     char norm_type, int M, int N, int lda, hipblasComplex* hCPU, hipblasComplex* hGPU)
 {
-    //norm type can be M', 'I', 'F', 'l': 'F' (Frobenius norm) is used mostly
-
-    float work[1];
-    int   incx  = 1;
-    float alpha = -1.0f;
-    int   size  = lda * N;
-
-    float cpu_norm = clange_(&norm_type, &M, &N, hCPU, &lda, work);
-    caxpy_(&size, &alpha, hCPU, &incx, hGPU, &incx);
-
-    float error = clange_(&norm_type, &M, &N, hGPU, &lda, work) / cpu_norm;
-
-    return (double)error;
+    return norm_error(norm_type, 0, M, N, lda, hCPU, hGPU);
 }
 
 template <>
 double norm_check_general<hipblasDoubleComplex>(
     char norm_type, int M, int N, int lda, hipblasDoubleComplex* hCPU, hipblasDoubleComplex* hGPU)
 {
-    //norm type can be M', 'I', 'F', 'l': 'F' (Frobenius norm) is used mostly
-
-    double work[1];
-    int    incx  = 1;
-    double alpha = -1.0;
-    int    size  = lda * N;
-
-    double cpu_norm = zlange_(&norm_type, &M, &N, hCPU, &lda, work);
-    zaxpy_(&size, &alpha, hCPU, &incx, hGPU, &incx);
-
-    double error = zlange_(&norm_type, &M, &N, hGPU, &lda, work) / cpu_norm;
+    return norm_error(norm_type, 0, M, N, lda, hCPU, hGPU);
+}
 
-    return error;
+/*! \brief compare the norm error of two matrices dCPU & dGPU in device memory */
+template <typename T>
+double norm_check_general_device(
+    hipblasHandle_t handle, char norm_type, int M, int N, int lda, const T* dCPU, const T* dGPU)
+{
+    using R = real_t<T>;
+    if(M <= 0 || N <= 0)
+        return 0;
+
+    hipblasPointerMode_t mode;
+    if(hipblasGetPointerMode(handle, &mode) != HIPBLAS_STATUS_SUCCESS)
+        return -1;
+
+    // dD = dCPU - dGPU, packed with leading dimension M
+    T* dD = nullptr;
+    if(hipMalloc(&dD, sizeof(T) * size_t(M) * N) != hipSuccess)
+        return -1;
+
+    hipblasNormType_t norm      = char2hipblas_norm(char(std::toupper(norm_type)));
+    T                 one       = 1;
+    T                 minus_one = -1;
+    R                 ref       = 0;
+    R                 err       = 0;
+
+    hipblasStatus_t status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasGeam<T>(handle,
+                                HIPBLAS_OP_N,
+                                HIPBLAS_OP_N,
+                                M,
+                                N,
+                                &one,
+                                dCPU,
+                                lda,
+                                &minus_one,
+                                dGPU,
+                                lda,
+                                dD,
+                                M);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasLange<T, R>(handle, norm, M, N, dCPU, lda, &ref);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasLange<T, R>(handle, norm, M, N, dD, M, &err);
+
+    // lange has synchronized the stream before returning its host result
+    hipblasSetPointerMode(handle, mode);
+    hipFree(dD);
+    return status == HIPBLAS_STATUS_SUCCESS ? double(err) / double(ref) : -1;
 }
 
+// clang-format off
+template double norm_check_general_device<float>(hipblasHandle_t, char, int, int, int, const float*, const float*);
+template double norm_check_general_device<double>(hipblasHandle_t, char, int, int, int, const double*, const double*);
+template double norm_check_general_device<hipblasComplex>(hipblasHandle_t, char, int, int, int, const hipblasComplex*, const hipblasComplex*);
+template double norm_check_general_device<hipblasDoubleComplex>(hipblasHandle_t, char, int, int, int, const hipblasDoubleComplex*, const hipblasDoubleComplex*);
+// clang-format on
+
 /* ============================Norm Check for Symmetric Matrix: float/double/complex template
  * speciliazation ======================================= */
 
@@ -133,74 +243,12 @@ template <>
 double
     norm_check_symmetric<float>(char norm_type, char uplo, int N, int lda, float* hCPU, float* hGPU)
 {
-    // norm type can be M', 'I', 'F', 'l': 'F' (Frobenius norm) is used mostly
-
-    float work[1];
-    int   incx  = 1;
-    float alpha = -1.0f;
-    int   size  = lda * N;
-
-    float cpu_norm = slansy_(&norm_type, &uplo, &N, hCPU, &lda, work);
-    saxpy_(&size, &alpha, hCPU, &incx, hGPU, &incx);
-
-    float error = slansy_(&norm_type, &uplo, &N, hGPU, &lda, work) / cpu_norm;
-
-    return (double)error;
+    return norm_error(norm_type, uplo, N, N, lda, hCPU, hGPU);
 }
 
 template <>
 double norm_check_symmetric<double>(
     char norm_type, char uplo, int N, int lda, double* hCPU, double* hGPU)
 {
-    // norm type can be M', 'I', 'F', 'l': 'F' (Frobenius norm) is used mostly
-
-    double work[1];
-    int    incx  = 1;
-    double alpha = -1.0;
-    int    size  = lda * N;
-
-    double cpu_norm = dlansy_(&norm_type, &uplo, &N, hCPU, &lda, work);
-    daxpy_(&size, &alpha, hCPU, &incx, hGPU, &incx);
-
-    double error = dlansy_(&norm_type, &uplo, &N, hGPU, &lda, work) / cpu_norm;
-
-    return error;
+    return norm_error(norm_type, uplo, N, N, lda, hCPU, hGPU);
 }
-
-// template<>
-// double norm_check_symmetric<hipblasComplex>(char norm_type, char uplo, int N, int lda, hipblasComplex
-// *hCPU, hipblasComplex *hGPU)
-//{
-////norm type can be M', 'I', 'F', 'l': 'F' (Frobenius norm) is used mostly
-//
-//    float work[1];
-//    int incx = 1;
-//    float alpha = -1.0f;
-//    int size = lda * N;
-//
-//    float cpu_norm = clanhe_(&norm_type, &uplo, &N, hCPU, &lda, work);
-//    caxpy_(&size, &alpha, hCPU, &incx, hGPU, &incx);
-//
-//     float error = clanhe_(&norm_type, &uplo, &N, hGPU, &lda, work)/cpu_norm;
-//
-//    return (double)error;
-//}
-//
-// template<>
-// double norm_check_symmetric<hipblasDoubleComplex>(char norm_type, char uplo, int N, int lda,
-// hipblasDoubleComplex *hCPU, hipblasDoubleComplex *hGPU)
-//{
-////norm type can be M', 'I', 'F', 'l': 'F' (Frobenius norm) is used mostly
-//
-//    double work[1];
-//    int incx = 1;
-//    double alpha = -1.0;
-//    int size = lda * N;
-//
-//    double cpu_norm = zlanhe_(&norm_type, &uplo, &N, hCPU, &lda, work);
-//    zaxpy_(&size, &alpha, hCPU, &incx, hGPU, &incx);
-//
-//     double error = zlanhe_(&norm_type, &uplo, &N, hGPU, &lda, work)/cpu_norm;
-//
-//    return error;
-//}
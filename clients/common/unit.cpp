@@ -4,9 +4,12 @@
  * ************************************************************************ */
 
 #include "unit.h"
+#include "device_compare.h"
 #include "hipblas.h"
 #include "hipblas_vector.hpp"
 #include "utility.h"
+#include <cmath>
+#include <mutex>
 
 /* ========================================Gtest Unit Check
  * ==================================================== */
@@ -20,36 +23,118 @@
 #define UNIT_CHECK(M, N, batch_count, lda, strideA, hCPU, hGPU, UNIT_ASSERT_EQ)
 #define UNIT_CHECK_B(M, N, batch_count, lda, hCPU, hGPU, UNIT_ASSERT_EQ)
 #else
-#define UNIT_CHECK(M, N, batch_count, lda, strideA, hCPU, hGPU, UNIT_ASSERT_EQ)      \
-    do                                                                               \
-    {                                                                                \
-        for(size_t k = 0; k < batch_count; k++)                                      \
-            for(size_t j = 0; j < N; j++)                                            \
-                for(size_t i = 0; i < M; i++)                                        \
-                    if(hipblas_isnan(hCPU[i + j * lda + k * strideA]))               \
-                    {                                                                \
-                        ASSERT_TRUE(hipblas_isnan(hGPU[i + j * lda + k * strideA])); \
-                    }                                                                \
-                    else                                                             \
-                    {                                                                \
-                        UNIT_ASSERT_EQ(hCPU[i + j * lda + k * strideA],              \
-                                       hGPU[i + j * lda + k * strideA]);             \
-                    }                                                                \
+// The elements are screened over host threads with the predicate the assertions apply, and only
+// the first failing element, in the order the serial loops took, is asserted on
+template <typename T>
+using unit_float = testing::internal::FloatingPoint<T>;
+
+inline bool unit_passes(float a, float b)
+{
+    return std::isnan(a) ? std::isnan(b) : unit_float<float>(a).AlmostEquals(unit_float<float>(b));
+}
+
+inline bool unit_passes(double a, double b)
+{
+    return std::isnan(a) ? std::isnan(b)
+                         : unit_float<double>(a).AlmostEquals(unit_float<double>(b));
+}
+
+inline bool unit_passes(hipblasHalf a, hipblasHalf b)
+{
+    return hipblas_isnan(a) ? hipblas_isnan(b) : unit_passes(half_to_float(a), half_to_float(b));
+}
+
+inline bool unit_passes(hipblasBfloat16 a, hipblasBfloat16 b)
+{
+    return unit_passes(bfloat16_to_float(a), bfloat16_to_float(b));
+}
+
+inline bool unit_passes(int a, int b)
+{
+    return a == b;
+}
+
+inline bool unit_passes(int64_t a, int64_t b)
+{
+    return a == b;
+}
+
+template <typename T>
+inline bool unit_passes(hip_complex_number<T> a, hip_complex_number<T> b)
+{
+    return hipblas_isnan(a) ? hipblas_isnan(b) : unit_passes(a.x, b.x) && unit_passes(a.y, b.y);
+}
+
+// index (k * N + j) * M + i of the first element (i, j) of batch k that fails, or -1
+template <typename F>
+int64_t unit_first_failure(size_t M, size_t N, size_t batch_count, F passes)
+{
+    std::mutex mutex;
+    int64_t    first   = -1;
+    size_t     columns = N * batch_count;
+    if(!M || !columns)
+        return first;
+
+    hipblas_parallel_for(columns, (size_t(1) << 20) / M + 1, [&](size_t begin, size_t end) {
+        for(size_t c = begin; c < end; c++)
+        {
+            // the whole column is tested before any search, which lets the loop vectorize
+            size_t j = c % N, k = c / N;
+            bool   pass = true;
+            for(size_t i = 0; i < M; i++)
+                pass &= passes(i, j, k);
+            if(pass)
+                continue;
+
+            size_t i = 0;
+            while(passes(i, j, k))
+                i++;
+            std::lock_guard<std::mutex> lock(mutex);
+            if(first < 0 || int64_t(c * M + i) < first)
+                first = c * M + i;
+            return;
+        }
+    });
+    return first;
+}
+
+#define UNIT_CHECK(M, N, batch_count, lda, strideA, hCPU, hGPU, UNIT_ASSERT_EQ)                   \
+    do                                                                                            \
+    {                                                                                             \
+        int64_t e = unit_first_failure(M, N, batch_count, [&](size_t i, size_t j, size_t k) {     \
+            return unit_passes(hCPU[i + j * lda + k * strideA], hGPU[i + j * lda + k * strideA]); \
+        });                                                                                       \
+        if(e >= 0)                                                                                \
+        {                                                                                         \
+            size_t i = e % (M), j = e / (M) % (N), k = e / (M) / (N);                             \
+            if(hipblas_isnan(hCPU[i + j * lda + k * strideA]))                                    \
+            {                                                                                     \
+                ASSERT_TRUE(hipblas_isnan(hGPU[i + j * lda + k * strideA]));                      \
+            }                                                                                     \
+            else                                                                                  \
+            {                                                                                     \
+                UNIT_ASSERT_EQ(hCPU[i + j * lda + k * strideA], hGPU[i + j * lda + k * strideA]); \
+            }                                                                                     \
+        }                                                                                         \
     } while(0)
-#define UNIT_CHECK_B(M, N, batch_count, lda, hCPU, hGPU, UNIT_ASSERT_EQ)            \
-    do                                                                              \
-    {                                                                               \
-        for(size_t k = 0; k < batch_count; k++)                                     \
-            for(size_t j = 0; j < N; j++)                                           \
-                for(size_t i = 0; i < M; i++)                                       \
-                    if(hipblas_isnan(hCPU[k][i + j * lda]))                         \
-                    {                                                               \
-                        ASSERT_TRUE(hipblas_isnan(hGPU[k][i + j * lda]));           \
-                    }                                                               \
-                    else                                                            \
-                    {                                                               \
-                        UNIT_ASSERT_EQ(hCPU[k][i + j * lda], hGPU[k][i + j * lda]); \
-                    }                                                               \
+#define UNIT_CHECK_B(M, N, batch_count, lda, hCPU, hGPU, UNIT_ASSERT_EQ)                      \
+    do                                                                                        \
+    {                                                                                         \
+        int64_t e = unit_first_failure(M, N, batch_count, [&](size_t i, size_t j, size_t k) { \
+            return unit_passes(hCPU[k][i + j * lda], hGPU[k][i + j * lda]);                   \
+        });                                                                                   \
+        if(e >= 0)                                                                            \
+        {                                                                                     \
+            size_t i = e % (M), j = e / (M) % (N), k = e / (M) / (N);                         \
+            if(hipblas_isnan(hCPU[k][i + j * lda]))                                           \
+            {                                                                                 \
+                ASSERT_TRUE(hipblas_isnan(hGPU[k][i + j * lda]));                             \
+            }                                                                                 \
+            else                                                                              \
+            {                                                                                 \
+                UNIT_ASSERT_EQ(hCPU[k][i + j * lda], hGPU[k][i + j * lda]);                   \
+            }                                                                                 \
+        }                                                                                     \
     } while(0)
 #endif
 
@@ -97,36 +182,20 @@ void unit_check_general(int M, int N, int lda, double* hCPU, double* hGPU)
 template <>
 void unit_check_general(int M, int N, int lda, hipblasComplex* hCPU, hipblasComplex* hGPU)
 {
-#pragma unroll
-    for(int j = 0; j < N; j++)
-    {
-#pragma unroll
-        for(int i = 0; i < M; i++)
-        {
-#ifdef GOOGLE_TEST
-            ASSERT_FLOAT_EQ(hCPU[i + j * lda].x, hGPU[i + j * lda].x);
-            ASSERT_FLOAT_EQ(hCPU[i + j * lda].y, hGPU[i + j * lda].y);
-#endif
-        }
-    }
+    UNIT_CHECK(M, N, 1, lda, 0, hCPU, hGPU, ASSERT_FLOAT_COMPLEX_EQ);
 }
 
 template <>
 void unit_check_general(
     int M, int N, int lda, hipblasDoubleComplex* hCPU, hipblasDoubleComplex* hGPU)
 {
-#pragma unroll
-    for(int j = 0; j < N; j++)
-    {
-#pragma unroll
-        for(int i = 0; i < M; i++)
-        {
-#ifdef GOOGLE_TEST
-            ASSERT_DOUBLE_EQ(hCPU[i + j * lda].x, hGPU[i + j * lda].x);
-            ASSERT_DOUBLE_EQ(hCPU[i + j * lda].y, hGPU[i + j * lda].y);
-#endif
-        }
-    }
+    UNIT_CHECK(M, N, 1, lda, 0, hCPU, hGPU, ASSERT_DOUBLE_COMPLEX_EQ);
+}
+
+template <>
+void unit_check_general(int M, int N, int lda, int8_t* hCPU, int8_t* hGPU)
+{
+    UNIT_CHECK(M, N, 1, lda, 0, hCPU, hGPU, ASSERT_EQ);
 }
 
 template <>
@@ -135,6 +204,12 @@ void unit_check_general(int M, int N, int lda, int* hCPU, int* hGPU)
     UNIT_CHECK(M, N, 1, lda, 0, hCPU, hGPU, ASSERT_EQ);
 }
 
+template <>
+void unit_check_general(int M, int N, int lda, int64_t* hCPU, int64_t* hGPU)
+{
+    UNIT_CHECK(M, N, 1, lda, 0, hCPU, hGPU, ASSERT_EQ);
+}
+
 // batched checks
 template <>
 void unit_check_general(
@@ -310,3 +385,46 @@ void unit_check_general(int M, int N, int batch_count, int lda, int strideA, int
 {
     UNIT_CHECK(M, N, batch_count, lda, strideA, hCPU, hGPU, ASSERT_EQ);
 }
+
+// relative error unit_check_device allows: 4 ulp, as ASSERT_FLOAT_EQ, or none for 16 bit types
+template <typename T>
+static double unit_device_tolerance()
+{
+    return 4 * std::numeric_limits<real_t<T>>::epsilon();
+}
+
+template <>
+double unit_device_tolerance<hipblasHalf>()
+{
+    return 0;
+}
+
+template <>
+double unit_device_tolerance<hipblasBfloat16>()
+{
+    return 0;
+}
+
+template <typename T>
+void unit_check_device(
+    int M, int N, int batch_count, int lda, int64_t stride_A, const T* dCPU, const T* dGPU)
+{
+    hipblas_compare_summary summary;
+    hipError_t              err
+        = hipblas_compare_device(M, N, batch_count, lda, stride_A, dCPU, dGPU, &summary);
+#ifdef GOOGLE_TEST
+    ASSERT_EQ(hipSuccess, err);
+    ASSERT_EQ(0, summary.nan_mismatches) << "first mismatch at " << summary.first_mismatch;
+    ASSERT_LE(summary.max_rel_error, unit_device_tolerance<T>())
+        << "first mismatch at " << summary.first_mismatch;
+#endif
+}
+
+// clang-format off
+template void unit_check_device<hipblasHalf>(int, int, int, int, int64_t, const hipblasHalf*, const hipblasHalf*);
+template void unit_check_device<hipblasBfloat16>(int, int, int, int, int64_t, const hipblasBfloat16*, const hipblasBfloat16*);
+template void unit_check_device<float>(int, int, int, int, int64_t, const float*, const float*);
+template void unit_check_device<double>(int, int, int, int, int64_t, const double*, const double*);
+template void unit_check_device<hipblasComplex>(int, int, int, int, int64_t, const hipblasComplex*, const hipblasComplex*);
+template void unit_check_device<hipblasDoubleComplex>(int, int, int, int, int64_t, const hipblasDoubleComplex*, const hipblasDoubleComplex*);
+// clang-format on
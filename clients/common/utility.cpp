@@ -5,7 +5,12 @@
 
 #include "utility.h"
 #include "hipblas.h"
+#include <cstdlib>
+#include <map>
+#include <mutex>
 #include <sys/time.h>
+#include <system_error>
+#include <thread>
 
 hipblas_rng_t hipblas_rng(69069);
 hipblas_rng_t hipblas_seed(hipblas_rng);
@@ -208,6 +213,10 @@ hipblasFillMode_t char2hipblas_fill(char value)
         return HIPBLAS_FILL_MODE_UPPER;
     case 'l':
         return HIPBLAS_FILL_MODE_LOWER;
+    case 'F':
+        return HIPBLAS_FILL_MODE_FULL;
+    case 'f':
+        return HIPBLAS_FILL_MODE_FULL;
     }
     return HIPBLAS_FILL_MODE_LOWER;
 }
@@ -244,6 +253,311 @@ hipblasSideMode_t char2hipblas_side(char value)
     return HIPBLAS_SIDE_LEFT;
 }
 
+// the norm arguments of lapack xlange
+hipblasNormType_t char2hipblas_norm(char value)
+{
+    switch(value)
+    {
+    case 'M':
+    case 'm':
+        return HIPBLAS_NORM_MAX;
+    case 'O':
+    case 'o':
+    case '1':
+        return HIPBLAS_NORM_ONE;
+    case 'I':
+    case 'i':
+        return HIPBLAS_NORM_INF;
+    }
+    return HIPBLAS_NORM_FROBENIUS;
+}
+
+// the pivot and direct arguments of lapack xlasr
+hipblasPivot_t char2hipblas_pivot(char value)
+{
+    switch(value)
+    {
+    case 'T':
+    case 't':
+        return HIPBLAS_PIVOT_TOP;
+    case 'B':
+    case 'b':
+        return HIPBLAS_PIVOT_BOTTOM;
+    }
+    return HIPBLAS_PIVOT_VARIABLE;
+}
+
+hipblasDirect_t char2hipblas_direct(char value)
+{
+    switch(value)
+    {
+    case 'B':
+    case 'b':
+        return HIPBLAS_BACKWARD_DIRECTION;
+    }
+    return HIPBLAS_FORWARD_DIRECTION;
+}
+
 #ifdef __cplusplus
 }
 #endif
+
+/* ============================================================================================ */
+/*  achieved rates of timed runs */
+
+namespace
+{
+    std::mutex                    timing_results_mutex;
+    vector<hipblas_timing_result> timing_results;
+
+    thread_local hipblas_timing_observer* timing_observer = nullptr;
+}
+
+void hipblas_set_timing_observer(hipblas_timing_observer* observer)
+{
+    timing_observer = observer;
+}
+
+hipblas_timing_observer* hipblas_get_timing_observer()
+{
+    return timing_observer;
+}
+
+double hipblas_peak_gbyte_rate()
+{
+    int             device;
+    hipDeviceProp_t props;
+    if(hipGetDevice(&device) != hipSuccess || hipGetDeviceProperties(&props, device) != hipSuccess)
+        return 0.0;
+
+    // memoryClockRate is in kHz and memory transfers on both clock edges
+    return 2.0 * props.memoryClockRate * 1e3 * (props.memoryBusWidth / 8.0) / 1e9;
+}
+
+void hipblas_print_timing(std::ostream&         out,
+                          const hipblas_timing& timing,
+                          double                gflop,
+                          double                gbyte)
+{
+    double gflops = timing.median_us > 0 ? gflop / timing.median_us * 1e6 : 0.0;
+    double gbytes = timing.median_us > 0 ? gbyte / timing.median_us * 1e6 : 0.0;
+    double peak   = hipblas_peak_gbyte_rate();
+
+    out << gflops << ',' << gbytes << ',' << (peak > 0 ? 100.0 * gbytes / peak : 0.0) << ','
+        << timing.median_us << ',' << timing.min_us << std::endl;
+
+    int device = 0;
+    hipGetDevice(&device);
+
+    std::lock_guard<std::mutex> lock(timing_results_mutex);
+    timing_results.push_back({timing, gflops, gbytes, device});
+}
+
+hipblasStatus_t
+    hipblas_restore_input(hipblasHandle_t handle, void* dst, const void* src, size_t bytes)
+{
+    hipStream_t     stream;
+    hipblasStatus_t status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    return hipMemcpyAsync(dst, src, bytes, hipMemcpyDeviceToDevice, stream) == hipSuccess
+               ? HIPBLAS_STATUS_SUCCESS
+               : HIPBLAS_STATUS_INTERNAL_ERROR;
+}
+
+namespace
+{
+    std::mutex                              flush_buffers_mutex;
+    std::map<int, std::pair<void*, size_t>> flush_buffers;
+}
+
+hipblasStatus_t hipblas_flush_cache(hipStream_t stream)
+{
+    int device;
+    if(hipGetDevice(&device) != hipSuccess)
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+    std::lock_guard<std::mutex> lock(flush_buffers_mutex);
+    auto&                       buffer = flush_buffers[device];
+    if(!buffer.first)
+    {
+        hipDeviceProp_t props;
+        if(hipGetDeviceProperties(&props, device) != hipSuccess)
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+        const char* env   = getenv("HIPBLAS_CLIENT_FLUSH_BYTES");
+        size_t      bytes = std::max(size_t(4) * props.l2CacheSize, size_t(512) << 20);
+        if(env && strtoull(env, nullptr, 10) > 0)
+            bytes = strtoull(env, nullptr, 10);
+        if(hipMalloc(&buffer.first, bytes) != hipSuccess)
+        {
+            buffer.first = nullptr;
+            return HIPBLAS_STATUS_ALLOC_FAILED;
+        }
+        buffer.second = bytes;
+    }
+
+    // the value changes every time, so the writes cannot be skipped as redundant
+    static int value = 0;
+    return hipMemsetAsync(buffer.first, ++value & 0xff, buffer.second, stream) == hipSuccess
+               ? HIPBLAS_STATUS_SUCCESS
+               : HIPBLAS_STATUS_INTERNAL_ERROR;
+}
+
+vector<hipblas_timing_result> hipblas_take_timing_results()
+{
+    std::lock_guard<std::mutex>   lock(timing_results_mutex);
+    vector<hipblas_timing_result> taken;
+    taken.swap(timing_results);
+    return taken;
+}
+
+/* ============================================================================================ */
+/*  CPU reference overlapped with the hipBLAS call */
+
+hipblas_host_reference::hipblas_host_reference(std::function<void()> reference)
+    : reference(std::move(reference))
+{
+    static const bool overlap = [] {
+        const char* env = getenv("HIPBLAS_CLIENT_OVERLAP");
+        return !env || strtol(env, nullptr, 10) != 0;
+    }();
+
+    // without a thread to spare the reference runs at wait(), as it would without overlap
+    if(overlap)
+    {
+        try
+        {
+            worker = std::thread([this] {
+                this->reference();
+                this->reference = nullptr;
+            });
+        }
+        catch(const std::system_error&)
+        {
+        }
+    }
+}
+
+hipblas_host_reference::~hipblas_host_reference()
+{
+    wait();
+}
+
+void hipblas_host_reference::wait()
+{
+    if(worker.joinable())
+        worker.join();
+    if(reference)
+    {
+        reference();
+        reference = nullptr;
+    }
+}
+
+/* ============================================================================================ */
+/*  handles shared by the testing_* functions */
+
+namespace
+{
+    struct shared_handle
+    {
+        hipblasHandle_t handle;
+        bool            in_use;
+    };
+
+    std::mutex                   shared_handles_mutex;
+    std::map<int, shared_handle> shared_handles;
+    bool                         sharing_handles = false;
+    std::thread::id              sharing_thread;
+
+    // Undoes what the testing_* functions may change on a shared handle, as a handle pool does
+    // when a handle returns to it, so the next test sees a handle as hipblasCreate made it
+    void reset_shared_handle(hipblasHandle_t handle)
+    {
+        hipblasSetThreadMode(handle, HIPBLAS_THREAD_MODE_SHARED);
+        hipblasSetCaptureMode(handle, HIPBLAS_CAPTURE_MODE_DEFAULT);
+        hipblasSetResultMode(handle, HIPBLAS_RESULT_MODE_BLOCKING);
+        hipblasSetIndependentStreams(handle, 0);
+        hipblasSetStreamPriority(handle, HIPBLAS_STREAM_PRIORITY_DEFAULT);
+        hipblasSetCUMask(handle, 0, nullptr);
+        hipblasSetStream(handle, 0);
+        hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST);
+        hipblasSetPointerArrayMode(handle, HIPBLAS_POINTER_ARRAY_DEVICE);
+        hipblasSetScalarStride(handle, 0);
+        hipblasSetMathMode(handle, HIPBLAS_DEFAULT_MATH);
+        hipblasSetEmulationSlices(handle, 7);
+        hipblasSetGemmBackend(handle, HIPBLAS_GEMM_BACKEND_DEFAULT);
+        hipblasSetGemmSplitK(handle, 1);
+        hipblasSetGemmStrassen(handle, 0, 0);
+        hipblasSetGemmTinyLimit(handle, 16);
+        hipblasSetGemmAutotune(handle, 0);
+        hipblasSetAbftMode(handle, HIPBLAS_ABFT_OFF);
+        hipblasResetAbftReport(handle);
+        hipblasSetManagedMemoryMode(handle, HIPBLAS_MANAGED_MEMORY_DEFAULT);
+        hipblasSetHostDispatchMode(handle, HIPBLAS_HOST_DISPATCH_OFF);
+        hipblasSetShapeDispatchMode(handle, HIPBLAS_SHAPE_DISPATCH_ON);
+        hipblasSetStatsMode(handle, HIPBLAS_STATS_MODE_OFF);
+        hipblasResetHandleStats(handle);
+        hipblasSetTimingMode(handle, HIPBLAS_TIMING_MODE_OFF, 1);
+        hipblasSetWorkspaceLimit(handle, 0);
+        hipblasResetWorkspaceHighWaterMark(handle);
+    }
+}
+
+void hipblas_client_share_handles(bool share)
+{
+    std::lock_guard<std::mutex> lock(shared_handles_mutex);
+    if(!share)
+    {
+        for(auto& shared : shared_handles)
+            hipblasDestroy(shared.second.handle);
+        shared_handles.clear();
+    }
+    sharing_handles = share;
+    sharing_thread  = std::this_thread::get_id();
+}
+
+hipblasStatus_t hipblas_client_create(hipblasHandle_t* handle)
+{
+    int device = 0;
+    if(!handle || hipGetDevice(&device) != hipSuccess)
+        return hipblasCreate(handle);
+
+    std::lock_guard<std::mutex> lock(shared_handles_mutex);
+    if(!sharing_handles || std::this_thread::get_id() != sharing_thread)
+        return hipblasCreate(handle);
+
+    auto shared = shared_handles.find(device);
+    if(shared == shared_handles.end())
+    {
+        hipblasHandle_t created;
+        hipblasStatus_t status = hipblasCreate(&created);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        shared = shared_handles.insert({device, {created, false}}).first;
+    }
+    if(shared->second.in_use)
+        return hipblasCreate(handle);
+
+    shared->second.in_use = true;
+    *handle               = shared->second.handle;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblas_client_destroy(hipblasHandle_t handle)
+{
+    {
+        std::lock_guard<std::mutex> lock(shared_handles_mutex);
+        for(auto& shared : shared_handles)
+        {
+            if(shared.second.handle != handle || !shared.second.in_use)
+                continue;
+
+            reset_shared_handle(handle);
+            shared.second.in_use = false;
+            return HIPBLAS_STATUS_SUCCESS;
+        }
+    }
+    return hipblasDestroy(handle);
+}
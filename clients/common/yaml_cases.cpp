@@ -0,0 +1,192 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "yaml_cases.h"
+#include <algorithm>
+#include <cctype>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+namespace
+{
+    std::string trim(const std::string& s, const char* space = " \t\r")
+    {
+        size_t b = s.find_first_not_of(space);
+        size_t e = s.find_last_not_of(space);
+        return b == std::string::npos ? std::string() : s.substr(b, e - b + 1);
+    }
+
+    template <typename T>
+    T parse_value(const std::string& value);
+
+    template <>
+    int parse_value<int>(const std::string& value)
+    {
+        size_t used;
+        int    v = std::stoi(value, &used);
+        if(used != value.size())
+            throw std::invalid_argument("not an integer");
+        return v;
+    }
+
+    template <>
+    double parse_value<double>(const std::string& value)
+    {
+        size_t used;
+        double v = std::stod(value, &used);
+        if(used != value.size())
+            throw std::invalid_argument("not a number");
+        return v;
+    }
+
+    template <>
+    char parse_value<char>(const std::string& value)
+    {
+        if(value.size() != 1)
+            throw std::invalid_argument("not a single character");
+        return value[0];
+    }
+
+    void apply(hipblas_yaml_case& c, std::string key, const std::string& value)
+    {
+        if(key == "M" || key == "N" || key == "K")
+            key = std::string("size") + char(std::tolower(key[0]));
+
+        Arguments& a = c.arg;
+        // clang-format off
+        if(key == "function")          c.function        = value;
+        else if(key == "precision")    c.precision       = parse_value<char>(value);
+        else if(key == "sizem")        a.M               = parse_value<int>(value);
+        else if(key == "sizen")        a.N               = parse_value<int>(value);
+        else if(key == "sizek")        a.K               = parse_value<int>(value);
+        else if(key == "lda")          a.lda             = parse_value<int>(value);
+        else if(key == "ldb")          a.ldb             = parse_value<int>(value);
+        else if(key == "ldc")          a.ldc             = parse_value<int>(value);
+        else if(key == "incx")         a.incx            = parse_value<int>(value);
+        else if(key == "incy")         a.incy            = parse_value<int>(value);
+        else if(key == "stride_scale") a.stride_scale    = parse_value<double>(value);
+        else if(key == "alpha")        a.alpha           = parse_value<double>(value);
+        else if(key == "alphai")       a.alphai          = parse_value<double>(value);
+        else if(key == "beta")         a.beta            = parse_value<double>(value);
+        else if(key == "betai")        a.betai           = parse_value<double>(value);
+        else if(key == "transposeA")   a.transA_option   = parse_value<char>(value);
+        else if(key == "transposeB")   a.transB_option   = parse_value<char>(value);
+        else if(key == "side")         a.side_option     = parse_value<char>(value);
+        else if(key == "uplo")         a.uplo_option     = parse_value<char>(value);
+        else if(key == "diag")         a.diag_option     = parse_value<char>(value);
+        else if(key == "norm")         a.norm_option     = parse_value<char>(value);
+        else if(key == "pivot")        a.pivot_option    = parse_value<char>(value);
+        else if(key == "direct")       a.direct_option   = parse_value<char>(value);
+        else if(key == "batch_count")  a.batch_count     = parse_value<int>(value);
+        else if(key == "algo")         a.algo            = parse_value<int>(value);
+        else if(key == "group_size")   a.group_size      = parse_value<int>(value);
+        else if(key == "autotune")     a.autotune        = parse_value<int>(value);
+        else if(key == "cold_iters")   a.cold_iters      = parse_value<int>(value);
+        else if(key == "iters")        a.hot_iters       = parse_value<int>(value);
+        else if(key == "verify")       a.unit_check      = parse_value<int>(value);
+        else if(key == "device_init")  a.device_init     = parse_value<int>(value);
+        else if(key == "flush")        a.flush           = parse_value<int>(value);
+        else throw std::invalid_argument("unknown key " + key);
+        // clang-format on
+    }
+
+    void parse_entry(const std::string& line, hipblas_yaml_case& c)
+    {
+        size_t open  = line.find('{');
+        size_t close = line.rfind('}');
+        if(open == std::string::npos || close == std::string::npos || close < open)
+            throw std::invalid_argument("expected - { key: value, ... }");
+
+        std::stringstream body(line.substr(open + 1, close - open - 1));
+        std::string       item;
+        while(std::getline(body, item, ','))
+        {
+            size_t colon = item.find(':');
+            if(colon == std::string::npos)
+                throw std::invalid_argument("expected key: value");
+
+            std::string value = trim(item.substr(colon + 1), " \t'\"");
+            apply(c, trim(item.substr(0, colon)), value);
+        }
+    }
+}
+
+std::vector<hipblas_yaml_case> hipblas_read_yaml_cases(const std::string&       path,
+                                                       const std::string&       suites,
+                                                       const hipblas_yaml_case& defaults)
+{
+    std::ifstream file(path);
+    if(!file)
+        throw std::invalid_argument("cannot open " + path);
+
+    std::vector<std::string> wanted;
+    std::stringstream        list(suites);
+    std::string              name;
+    while(std::getline(list, name, ','))
+        if(!trim(name).empty())
+            wanted.push_back(trim(name));
+
+    std::vector<hipblas_yaml_case> cases;
+    std::string                    suite, line;
+    for(int number = 1; std::getline(file, line); number++)
+    {
+        std::string text = trim(line);
+        if(text.empty() || text[0] == '#')
+            continue;
+
+        try
+        {
+            if(line[0] != ' ' && line[0] != '\t' && line[0] != '-')
+            {
+                if(text.back() != ':')
+                    throw std::invalid_argument("expected a suite name and a colon");
+                suite = trim(text.substr(0, text.size() - 1));
+                continue;
+            }
+
+            hipblas_yaml_case c = defaults;
+            c.suite             = suite;
+            parse_entry(text, c);
+            if(wanted.empty() || suite.empty()
+               || std::find(wanted.begin(), wanted.end(), suite) != wanted.end())
+                cases.push_back(c);
+        }
+        catch(const std::exception& e)
+        {
+            throw std::invalid_argument(path + ":" + std::to_string(number) + ": " + e.what());
+        }
+    }
+    return cases;
+}
+
+void hipblas_fill_leading_dimensions(Arguments& arg)
+{
+    if(arg.lda <= 0)
+        arg.lda = std::max(1, std::max(arg.M, arg.K));
+    if(arg.ldb <= 0)
+        arg.ldb = std::max(1, std::max(arg.K, arg.N));
+    if(arg.ldc <= 0)
+        arg.ldc = std::max(1, arg.M);
+}
+
+namespace
+{
+    std::vector<hipblas_yaml_case>& yaml_cases()
+    {
+        static std::vector<hipblas_yaml_case> cases;
+        return cases;
+    }
+}
+
+void hipblas_set_yaml_cases(std::vector<hipblas_yaml_case> cases)
+{
+    yaml_cases() = std::move(cases);
+}
+
+const std::vector<hipblas_yaml_case>& hipblas_yaml_cases()
+{
+    return yaml_cases();
+}
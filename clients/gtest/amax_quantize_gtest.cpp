@@ -0,0 +1,81 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_amax_quantize.hpp"
+#include "utility.h"
+#include <gtest/gtest.h>
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, int> amax_quantize_tuple;
+
+// vector of vector, each vector is a {M, N, lda, ldq}
+const vector<vector<int>> matrix_size_range
+    = {{-1, -1, 1, 1}, {10, 10, 2, 10}, {1, 1, 1, 1}, {33, 65, 40, 33}, {300, 600, 300, 310}};
+
+const vector<int> batch_count_range = {-1, 0, 1, 5};
+
+Arguments setup_amax_quantize_arguments(amax_quantize_tuple tup)
+{
+    vector<int> matrix_size = std::get<0>(tup);
+    int         batch_count = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.M   = matrix_size[0];
+    arg.N   = matrix_size[1];
+    arg.lda = matrix_size[2];
+    arg.ldb = matrix_size[3];
+
+    arg.timing      = 0;
+    arg.batch_count = batch_count;
+
+    return arg;
+}
+
+class amax_quantize_gtest : public ::TestWithParam<amax_quantize_tuple>
+{
+protected:
+    amax_quantize_gtest() {}
+    virtual ~amax_quantize_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_P(amax_quantize_gtest, amax_quantize_gtest_float)
+{
+    // GetParam returns a tuple. The setup routine unpacks the tuple
+    // and initializes arg(Arguments), which will be passed to testing routine.
+
+    Arguments arg = setup_amax_quantize_arguments(GetParam());
+
+    hipblasStatus_t status = testing_amax_quantize(arg);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.M < 0 || arg.N < 0 || arg.lda < arg.M || arg.ldb < arg.M || arg.batch_count < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+        }
+    }
+}
+
+// ValuesIn takes each element of the ranges, combines them, and feeds them to test_p
+// The combinations are  { {M, N, lda, ldq}, batch_count }
+
+INSTANTIATE_TEST_CASE_P(hipblasAmaxQuantize,
+                        amax_quantize_gtest,
+                        Combine(ValuesIn(matrix_size_range), ValuesIn(batch_count_range)));
@@ -0,0 +1,224 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+// clients/include has a hipblas.hpp of its own, so the installed headers are named by path
+#include "../../library/include/hipblas_async.hpp"
+#include <atomic>
+#include <gtest/gtest.h>
+#include <hip/hip_runtime_api.h>
+#include <vector>
+
+using namespace std;
+
+/* =====================================================================
+     BLAS async:
+=================================================================== */
+
+namespace
+{
+    // C = A * B for count handles at once, each on a stream of its own, every call waited for
+    // through the queue. Small integers keep the products exact
+    void run_case(int count, bool futures)
+    {
+        const int m = 96, n = 80, k = 64;
+
+        vector<float> hA(m * k), hB(k * n), gold(m * n, 0.0f);
+        for(int i = 0; i < m * k; i++)
+            hA[i] = float(i % 7 - 3);
+        for(int i = 0; i < k * n; i++)
+            hB[i] = float(i % 5 - 2);
+        for(int j = 0; j < n; j++)
+            for(int l = 0; l < k; l++)
+                for(int i = 0; i < m; i++)
+                    gold[i + j * m] += hA[i + l * m] * hB[l + j * k];
+
+        hipblas::completion_queue queue(0);
+        ASSERT_EQ(queue.status(), HIPBLAS_STATUS_SUCCESS);
+
+        vector<hipblasHandle_t> handles(count);
+        vector<hipStream_t>     streams(count);
+        vector<float*>          dC(count);
+
+        float *dA, *dB;
+        ASSERT_EQ(hipMalloc(&dA, hA.size() * sizeof(float)), hipSuccess);
+        ASSERT_EQ(hipMalloc(&dB, hB.size() * sizeof(float)), hipSuccess);
+        EXPECT_EQ(hipMemcpy(dA, hA.data(), hA.size() * sizeof(float), hipMemcpyHostToDevice),
+                  hipSuccess);
+        EXPECT_EQ(hipMemcpy(dB, hB.data(), hB.size() * sizeof(float), hipMemcpyHostToDevice),
+                  hipSuccess);
+        for(int i = 0; i < count; i++)
+        {
+            EXPECT_EQ(hipblasCreate(&handles[i]), HIPBLAS_STATUS_SUCCESS);
+            EXPECT_EQ(hipStreamCreate(&streams[i]), hipSuccess);
+            EXPECT_EQ(hipblasSetStream(handles[i], streams[i]), HIPBLAS_STATUS_SUCCESS);
+            ASSERT_EQ(hipMalloc(&dC[i], gold.size() * sizeof(float)), hipSuccess);
+        }
+
+        const float                     one = 1, zero = 0;
+        const hipblasOperation_t        N   = HIPBLAS_OP_N;
+        vector<hipblas::async_status>   calls;
+        vector<future<hipblasStatus_t>> results;
+        for(int i = 0; i < count; i++)
+        {
+            hipblasHandle_t h = handles[i];
+            float*          C = dC[i];
+            if(futures)
+                results.push_back(hipblas::async_future(queue, h, [&] {
+                    return hipblas::gemm(h, N, N, m, n, k, &one, dA, m, dB, k, &zero, C, m);
+                }));
+            else
+                calls.push_back(hipblas::gemm_async(
+                    queue, h, N, N, m, n, k, &one, dA, m, dB, k, &zero, C, m));
+        }
+        for(auto& call : calls)
+            EXPECT_EQ(call.get(), HIPBLAS_STATUS_SUCCESS);
+        for(auto& result : results)
+            EXPECT_EQ(result.get(), HIPBLAS_STATUS_SUCCESS);
+
+        // Completed work is readable without synchronizing the streams
+        vector<float> hC(gold.size());
+        for(int i = 0; i < count; i++)
+        {
+            EXPECT_EQ(hipMemcpy(hC.data(), dC[i], hC.size() * sizeof(float), hipMemcpyDeviceToHost),
+                      hipSuccess);
+            EXPECT_EQ(gold, hC) << "handle " << i;
+            EXPECT_EQ(hipblasDestroy(handles[i]), HIPBLAS_STATUS_SUCCESS);
+            EXPECT_EQ(hipStreamDestroy(streams[i]), hipSuccess);
+            EXPECT_EQ(hipFree(dC[i]), hipSuccess);
+        }
+        EXPECT_EQ(hipFree(dA), hipSuccess);
+        EXPECT_EQ(hipFree(dB), hipSuccess);
+    }
+
+    void count_completion(void* user_data, hipblasStatus_t status)
+    {
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            ++*static_cast<atomic<int>*>(user_data);
+    }
+
+#ifdef HIPBLAS_ASYNC_COROUTINES
+    // A coroutine that starts at once and is never resumed by anyone but the awaited work
+    struct detached
+    {
+        struct promise_type
+        {
+            detached get_return_object()
+            {
+                return {};
+            }
+            std::suspend_never initial_suspend()
+            {
+                return {};
+            }
+            std::suspend_never final_suspend() noexcept
+            {
+                return {};
+            }
+            void return_void() {}
+            void unhandled_exception() {}
+        };
+    };
+
+    detached await_scal(hipblas::completion_queue& queue,
+                        hipblasHandle_t            handle,
+                        float*                     x,
+                        const float*               alpha,
+                        atomic<int>&               done)
+    {
+        hipblasStatus_t status = co_await hipblas::scal_async(queue, handle, 64, alpha, x, 1);
+        done = status == HIPBLAS_STATUS_SUCCESS ? 1 : -1;
+    }
+#endif
+}
+
+TEST(hipblas_async, gemm_async)
+{
+    run_case(1, false);
+    run_case(4, false);
+}
+
+TEST(hipblas_async, futures)
+{
+    run_case(3, true);
+}
+
+// Every callback runs once, and Destroy waits for those still pending
+TEST(hipblas_async, notify)
+{
+    hipblasHandle_t handle;
+    hipblasCreate(&handle);
+
+    atomic<int>              completed(0);
+    hipblasCompletionQueue_t queue;
+    ASSERT_EQ(hipblasCompletionQueueCreate(&queue, 10), HIPBLAS_STATUS_SUCCESS);
+    for(int i = 0; i < 100; i++)
+        EXPECT_EQ(hipblasCompletionQueueNotify(queue, handle, count_completion, &completed),
+                  HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasCompletionQueueDestroy(queue), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(completed.load(), 100);
+
+    hipblasDestroy(handle);
+}
+
+// A call that fails, or whose completion is refused, is complete at once with its status
+TEST(hipblas_async, failed_call)
+{
+    hipblas::completion_queue queue;
+    float                     alpha = 1, x = 0;
+    hipblas::async_status     call = hipblas::scal_async(queue, nullptr, 1, &alpha, &x, 1);
+    EXPECT_TRUE(call.ready());
+    EXPECT_EQ(call.get(), HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_EQ(hipblas::async_future(queue, nullptr, [] { return HIPBLAS_STATUS_SUCCESS; }).get(),
+              HIPBLAS_STATUS_NOT_INITIALIZED);
+}
+
+#ifdef HIPBLAS_ASYNC_COROUTINES
+TEST(hipblas_async, co_await)
+{
+    hipblasHandle_t handle;
+    hipblasCreate(&handle);
+
+    float* x;
+    ASSERT_EQ(hipMalloc(&x, 64 * sizeof(float)), hipSuccess);
+    EXPECT_EQ(hipMemset(x, 0, 64 * sizeof(float)), hipSuccess);
+    float       alpha = 2;
+    atomic<int> done(0);
+    {
+        hipblas::completion_queue queue;
+        await_scal(queue, handle, x, &alpha, done);
+    }
+    EXPECT_EQ(done.load(), 1);
+
+    EXPECT_EQ(hipFree(x), hipSuccess);
+    hipblasDestroy(handle);
+}
+#endif
+
+TEST(hipblas_async, bad_arg)
+{
+    hipblasHandle_t handle;
+    hipblasCreate(&handle);
+
+    atomic<int>              completed(0);
+    hipblasCompletionQueue_t queue;
+    EXPECT_EQ(hipblasCompletionQueueCreate(nullptr, 0), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasCompletionQueueCreate(&queue, -1), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasCompletionQueueDestroy(nullptr), HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_EQ(hipblasCompletionQueueNotify(nullptr, handle, count_completion, &completed),
+              HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    ASSERT_EQ(hipblasCompletionQueueCreate(&queue, 0), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasCompletionQueueNotify(queue, nullptr, count_completion, &completed),
+              HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_EQ(hipblasCompletionQueueNotify(queue, handle, nullptr, &completed),
+              HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasSetCaptureMode(handle, HIPBLAS_CAPTURE_MODE_SAFE), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasCompletionQueueNotify(queue, handle, count_completion, &completed),
+              HIPBLAS_STATUS_NOT_SUPPORTED);
+    EXPECT_EQ(hipblasCompletionQueueDestroy(queue), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(completed.load(), 0);
+
+    hipblasDestroy(handle);
+}
@@ -0,0 +1,315 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include <gtest/gtest.h>
+#include <hip/hip_runtime.h>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+/* =====================================================================
+     BLAS batcher:
+=================================================================== */
+
+namespace
+{
+    struct batcher_case
+    {
+        bool gemv;
+        bool contiguous; // every call's operands in one allocation, evenly spaced
+        int  threads, calls; // calls per thread
+        int  window_us, max_batch;
+    };
+
+    hipblasStatus_t submit(hipblasBatcher_t batcher,
+                           bool             gemv,
+                           int              m,
+                           int              n,
+                           int              k,
+                           const float*     alpha,
+                           const float*     A,
+                           const float*     B,
+                           const float*     beta,
+                           float*           C,
+                           uint64_t*        ticket)
+    {
+        if(gemv)
+            return hipblasBatcherSgemv(
+                batcher, HIPBLAS_OP_N, m, n, alpha, A, m, B, 1, beta, C, 1, ticket);
+        return hipblasBatcherSgemm(
+            batcher, HIPBLAS_OP_N, HIPBLAS_OP_T, m, n, k, alpha, A, m, B, n, beta, C, m, ticket);
+    }
+
+    hipblasStatus_t submit(hipblasBatcher_t batcher,
+                           bool             gemv,
+                           int              m,
+                           int              n,
+                           int              k,
+                           const double*    alpha,
+                           const double*    A,
+                           const double*    B,
+                           const double*    beta,
+                           double*          C,
+                           uint64_t*        ticket)
+    {
+        if(gemv)
+            return hipblasBatcherDgemv(
+                batcher, HIPBLAS_OP_N, m, n, alpha, A, m, B, 1, beta, C, 1, ticket);
+        return hipblasBatcherDgemm(
+            batcher, HIPBLAS_OP_N, HIPBLAS_OP_T, m, n, k, alpha, A, m, B, n, beta, C, m, ticket);
+    }
+
+    // Every thread submits its own calls, alternating between two alphas so that each window
+    // holds two groups, and waits for them; small integers keep the results exact
+    template <typename T>
+    void run_case(const batcher_case& t)
+    {
+        const int m = 7, n = 5, k = t.gemv ? 1 : 6;
+        int       calls = t.threads * t.calls;
+
+        size_t a_size = size_t(m) * (t.gemv ? n : k);
+        size_t b_size = size_t(t.gemv ? 1 : n) * (t.gemv ? n : k);
+        size_t c_size = size_t(m) * (t.gemv ? 1 : n);
+
+        srand(1);
+        vector<T> hA(a_size * calls), hB(b_size * calls), hC(c_size * calls);
+        for(T& v : hA)
+            v = T(rand() % 5 - 2);
+        for(T& v : hB)
+            v = T(rand() % 5 - 2);
+        for(T& v : hC)
+            v = T(rand() % 5 - 2);
+
+        T alphas[2] = {1, 3};
+        T beta      = 2;
+
+        vector<T> ref(hC);
+        for(int c = 0; c < calls; c++)
+        {
+            const T* A = hA.data() + c * a_size;
+            const T* B = hB.data() + c * b_size;
+            T*       C = ref.data() + c * c_size;
+            for(int j = 0; j < (t.gemv ? 1 : n); j++)
+                for(int i = 0; i < m; i++)
+                {
+                    T sum = 0;
+                    if(t.gemv)
+                        for(int l = 0; l < n; l++)
+                            sum += A[i + l * m] * B[l];
+                    else
+                        for(int l = 0; l < k; l++)
+                            sum += A[i + l * m] * B[j + l * n];
+                    C[i + j * m] = alphas[c % 2] * sum + beta * C[i + j * m];
+                }
+        }
+
+        // Contiguous operands are evenly spaced in call order, apart operands are not
+        vector<T*> dA(calls), dB(calls), dC(calls);
+        if(t.contiguous)
+        {
+            T *A, *B, *C;
+            ASSERT_EQ(hipMalloc(&A, hA.size() * sizeof(T)), hipSuccess);
+            ASSERT_EQ(hipMalloc(&B, hB.size() * sizeof(T)), hipSuccess);
+            ASSERT_EQ(hipMalloc(&C, hC.size() * sizeof(T)), hipSuccess);
+            for(int c = 0; c < calls; c++)
+            {
+                dA[c] = A + c * a_size;
+                dB[c] = B + c * b_size;
+                dC[c] = C + c * c_size;
+            }
+        }
+        else
+        {
+            for(int c = 0; c < calls; c++)
+            {
+                ASSERT_EQ(hipMalloc(&dA[c], a_size * sizeof(T)), hipSuccess);
+                ASSERT_EQ(hipMalloc(&dB[c], b_size * sizeof(T)), hipSuccess);
+                ASSERT_EQ(hipMalloc(&dC[c], c_size * sizeof(T)), hipSuccess);
+            }
+        }
+        for(int c = 0; c < calls; c++)
+        {
+            EXPECT_EQ(hipMemcpy(dA[c],
+                                hA.data() + c * a_size,
+                                a_size * sizeof(T),
+                                hipMemcpyHostToDevice),
+                      hipSuccess);
+            EXPECT_EQ(hipMemcpy(dB[c],
+                                hB.data() + c * b_size,
+                                b_size * sizeof(T),
+                                hipMemcpyHostToDevice),
+                      hipSuccess);
+            EXPECT_EQ(hipMemcpy(dC[c],
+                                hC.data() + c * c_size,
+                                c_size * sizeof(T),
+                                hipMemcpyHostToDevice),
+                      hipSuccess);
+        }
+
+        hipblasBatcher_t batcher;
+        ASSERT_EQ(hipblasBatcherCreate(&batcher, nullptr, t.window_us, t.max_batch),
+                  HIPBLAS_STATUS_SUCCESS);
+
+        vector<hipblasStatus_t> submitted(calls), waited(calls);
+        vector<thread>          threads;
+        for(int i = 0; i < t.threads; i++)
+            threads.emplace_back([&, i] {
+                vector<uint64_t> tickets(t.calls);
+                for(int j = 0; j < t.calls; j++)
+                {
+                    int c        = i * t.calls + j;
+                    submitted[c] = submit(batcher,
+                                          t.gemv,
+                                          m,
+                                          n,
+                                          k,
+                                          &alphas[c % 2],
+                                          dA[c],
+                                          dB[c],
+                                          &beta,
+                                          dC[c],
+                                          &tickets[j]);
+                }
+                for(int j = 0; j < t.calls; j++)
+                    waited[i * t.calls + j] = hipblasBatcherWait(batcher, tickets[j]);
+            });
+        for(thread& th : threads)
+            th.join();
+        EXPECT_EQ(hipblasBatcherDestroy(batcher), HIPBLAS_STATUS_SUCCESS);
+
+        vector<T> result(hC.size());
+        for(int c = 0; c < calls; c++)
+        {
+            EXPECT_EQ(submitted[c], HIPBLAS_STATUS_SUCCESS);
+            EXPECT_EQ(waited[c], HIPBLAS_STATUS_SUCCESS);
+            EXPECT_EQ(hipMemcpy(result.data() + c * c_size,
+                                dC[c],
+                                c_size * sizeof(T),
+                                hipMemcpyDeviceToHost),
+                      hipSuccess);
+        }
+        EXPECT_EQ(ref, result);
+
+        if(t.contiguous)
+        {
+            EXPECT_EQ(hipFree(dA[0]), hipSuccess);
+            EXPECT_EQ(hipFree(dB[0]), hipSuccess);
+            EXPECT_EQ(hipFree(dC[0]), hipSuccess);
+        }
+        else
+        {
+            for(int c = 0; c < calls; c++)
+            {
+                EXPECT_EQ(hipFree(dA[c]), hipSuccess);
+                EXPECT_EQ(hipFree(dB[c]), hipSuccess);
+                EXPECT_EQ(hipFree(dC[c]), hipSuccess);
+            }
+        }
+    }
+}
+
+TEST(hipblas_batcher, gemm)
+{
+    run_case<float>({false, false, 8, 16, 200, 64});
+    run_case<float>({false, true, 1, 32, 1000, 64});
+    run_case<float>({false, false, 4, 10, 0, 1});
+    run_case<double>({false, false, 3, 12, 100, 8});
+}
+
+TEST(hipblas_batcher, gemv)
+{
+    run_case<float>({true, false, 8, 16, 200, 64});
+    run_case<float>({true, true, 1, 32, 1000, 64});
+    run_case<double>({true, false, 2, 5, 50, 3});
+}
+
+TEST(hipblas_batcher, flush)
+{
+    hipblasBatcher_t batcher;
+    ASSERT_EQ(hipblasBatcherCreate(&batcher, nullptr, 100000000, 1024), HIPBLAS_STATUS_SUCCESS);
+
+    float  alpha = 2, beta = 0, A = 3, B = 4, *C;
+    float *dA, *dB;
+    ASSERT_EQ(hipMalloc(&dA, sizeof(float)), hipSuccess);
+    ASSERT_EQ(hipMalloc(&dB, sizeof(float)), hipSuccess);
+    ASSERT_EQ(hipMalloc(&C, sizeof(float)), hipSuccess);
+    EXPECT_EQ(hipMemcpy(dA, &A, sizeof(float), hipMemcpyHostToDevice), hipSuccess);
+    EXPECT_EQ(hipMemcpy(dB, &B, sizeof(float), hipMemcpyHostToDevice), hipSuccess);
+
+    // A window of 100 s would outlast the test unless Flush ends it
+    uint64_t ticket;
+    EXPECT_EQ(hipblasBatcherSgemm(batcher,
+                                  HIPBLAS_OP_N,
+                                  HIPBLAS_OP_N,
+                                  1,
+                                  1,
+                                  1,
+                                  &alpha,
+                                  dA,
+                                  1,
+                                  dB,
+                                  1,
+                                  &beta,
+                                  C,
+                                  1,
+                                  &ticket),
+              HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasBatcherFlush(batcher), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasBatcherWait(batcher, ticket), HIPBLAS_STATUS_SUCCESS);
+
+    float result = 0;
+    EXPECT_EQ(hipMemcpy(&result, C, sizeof(float), hipMemcpyDeviceToHost), hipSuccess);
+    EXPECT_EQ(result, 24.0f);
+
+    EXPECT_EQ(hipblasBatcherDestroy(batcher), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipFree(dA), hipSuccess);
+    EXPECT_EQ(hipFree(dB), hipSuccess);
+    EXPECT_EQ(hipFree(C), hipSuccess);
+}
+
+TEST(hipblas_batcher, bad_arg)
+{
+    hipblasBatcher_t batcher;
+    EXPECT_EQ(hipblasBatcherCreate(nullptr, nullptr, 10, 8), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasBatcherCreate(&batcher, nullptr, -1, 8), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasBatcherCreate(&batcher, nullptr, 10, 0), HIPBLAS_STATUS_INVALID_VALUE);
+    ASSERT_EQ(hipblasBatcherCreate(&batcher, nullptr, 10, 8), HIPBLAS_STATUS_SUCCESS);
+
+    float      x = 1;
+    float*     p = &x;
+    uint64_t   ticket;
+    const auto N = HIPBLAS_OP_N;
+
+    EXPECT_EQ(hipblasBatcherSgemm(nullptr, N, N, 2, 2, 2, p, p, 2, p, 2, p, p, 2, &ticket),
+              HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_EQ(hipblasBatcherSgemm(
+                  batcher, hipblasOperation_t(0), N, 2, 2, 2, p, p, 2, p, 2, p, p, 2, &ticket),
+              HIPBLAS_STATUS_INVALID_ENUM);
+    EXPECT_EQ(hipblasBatcherSgemm(batcher, N, N, 2, 2, 2, p, p, 1, p, 2, p, p, 2, &ticket),
+              HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasBatcherSgemm(batcher, N, N, 2, 2, 2, p, nullptr, 2, p, 2, p, p, 2, &ticket),
+              HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasBatcherSgemm(batcher, N, N, 2, 2, 2, p, p, 2, p, 2, p, p, 2, nullptr),
+              HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasBatcherSgemv(batcher, N, 2, 2, p, p, 2, p, 0, p, p, 1, &ticket),
+              HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasBatcherSgemv(batcher, N, 2, 2, nullptr, p, 2, p, 1, p, p, 1, &ticket),
+              HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasBatcherWait(batcher, 0), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasBatcherWait(batcher, 1), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasBatcherWait(nullptr, 1), HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_EQ(hipblasBatcherFlush(nullptr), HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    // Empty calls are accepted and complete like any other
+    EXPECT_EQ(hipblasBatcherSgemm(
+                  batcher, N, N, 0, 2, 2, p, nullptr, 1, nullptr, 2, p, nullptr, 1, &ticket),
+              HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasBatcherWait(batcher, ticket), HIPBLAS_STATUS_SUCCESS);
+
+    EXPECT_EQ(hipblasBatcherDestroy(batcher), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasBatcherDestroy(nullptr), HIPBLAS_STATUS_NOT_INITIALIZED);
+}
@@ -0,0 +1,114 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include <gtest/gtest.h>
+#include <hip/hip_runtime_api.h>
+#include <vector>
+
+using namespace std;
+
+/* =====================================================================
+     BLAS begin-end_capture:
+=================================================================== */
+
+TEST(hipblas_begin_capture, hipblas_end_capture_arguments)
+{
+    hipGraphExec_t graph = nullptr;
+
+    hipblasHandle_t handle;
+    hipblasCreate(&handle);
+
+    // the null stream cannot be captured, and nothing was begun
+    EXPECT_EQ(hipblasBeginCapture(handle), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasEndCapture(handle, &graph), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasBeginCapture(nullptr), HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_EQ(hipblasEndCapture(nullptr, &graph), HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    hipStream_t stream;
+    ASSERT_EQ(hipStreamCreate(&stream), hipSuccess);
+    EXPECT_EQ(hipblasSetStream(handle, stream), HIPBLAS_STATUS_SUCCESS);
+
+    // the handle is capture-safe only while capturing
+    hipblasCaptureMode_t mode;
+    EXPECT_EQ(hipblasBeginCapture(handle), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasBeginCapture(handle), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasGetCaptureMode(handle, &mode), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(HIPBLAS_CAPTURE_MODE_SAFE, mode);
+    EXPECT_EQ(hipblasEndCapture(handle, nullptr), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasGetCaptureMode(handle, &mode), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(HIPBLAS_CAPTURE_MODE_DEFAULT, mode);
+
+    hipblasDestroy(handle);
+    EXPECT_EQ(hipStreamDestroy(stream), hipSuccess);
+}
+
+TEST(hipblas_begin_capture, hipblas_update_capture_rebinds)
+{
+    const int     n = 256;
+    vector<float> hx(n), hy(n, 1.0f), hz(n, 2.0f);
+    for(int i = 0; i < n; i++)
+        hx[i] = float(i);
+
+    float *dx, *dy, *dz;
+    ASSERT_EQ(hipMalloc(&dx, n * sizeof(float)), hipSuccess);
+    ASSERT_EQ(hipMalloc(&dy, n * sizeof(float)), hipSuccess);
+    ASSERT_EQ(hipMalloc(&dz, n * sizeof(float)), hipSuccess);
+    ASSERT_EQ(hipMemcpy(dx, hx.data(), n * sizeof(float), hipMemcpyHostToDevice), hipSuccess);
+    ASSERT_EQ(hipMemcpy(dy, hy.data(), n * sizeof(float), hipMemcpyHostToDevice), hipSuccess);
+    ASSERT_EQ(hipMemcpy(dz, hz.data(), n * sizeof(float), hipMemcpyHostToDevice), hipSuccess);
+
+    hipblasHandle_t handle;
+    hipblasCreate(&handle);
+    hipStream_t stream;
+    ASSERT_EQ(hipStreamCreate(&stream), hipSuccess);
+    EXPECT_EQ(hipblasSetStream(handle, stream), HIPBLAS_STATUS_SUCCESS);
+
+    // y += 2 x, twice through one graph
+    float          alpha = 2.0f;
+    hipGraphExec_t graph = nullptr;
+    EXPECT_EQ(hipblasBeginCapture(handle), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasSaxpy(handle, n, &alpha, dx, 1, dy, 1), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasSaxpy(handle, n, &alpha, dx, 1, dy, 1), HIPBLAS_STATUS_SUCCESS);
+    ASSERT_EQ(hipblasEndCapture(handle, &graph), HIPBLAS_STATUS_SUCCESS);
+    ASSERT_NE(graph, nullptr);
+
+    ASSERT_EQ(hipGraphLaunch(graph, stream), hipSuccess);
+    ASSERT_EQ(hipMemcpyAsync(hy.data(), dy, n * sizeof(float), hipMemcpyDeviceToHost, stream),
+              hipSuccess);
+    ASSERT_EQ(hipStreamSynchronize(stream), hipSuccess);
+    for(int i = 0; i < n; i++)
+        EXPECT_EQ(1.0f + 4.0f * i, hy[i]);
+
+    // the same sequence on z with a new host scalar updates the graph in place
+    alpha = 3.0f;
+    EXPECT_EQ(hipblasBeginCapture(handle), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasSaxpy(handle, n, &alpha, dx, 1, dz, 1), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasSaxpy(handle, n, &alpha, dx, 1, dz, 1), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasUpdateCapture(handle, graph), HIPBLAS_STATUS_SUCCESS);
+
+    ASSERT_EQ(hipGraphLaunch(graph, stream), hipSuccess);
+    ASSERT_EQ(hipMemcpyAsync(hz.data(), dz, n * sizeof(float), hipMemcpyDeviceToHost, stream),
+              hipSuccess);
+    ASSERT_EQ(hipStreamSynchronize(stream), hipSuccess);
+    for(int i = 0; i < n; i++)
+        EXPECT_EQ(2.0f + 6.0f * i, hz[i]);
+
+    // a different sequence is refused and leaves the graph usable
+    EXPECT_EQ(hipblasBeginCapture(handle), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasSaxpy(handle, n, &alpha, dx, 1, dz, 1), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasSscal(handle, n, &alpha, dz, 1), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasSscal(handle, n, &alpha, dz, 1), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasUpdateCapture(handle, graph), HIPBLAS_STATUS_INVALID_VALUE);
+    ASSERT_EQ(hipGraphLaunch(graph, stream), hipSuccess);
+    ASSERT_EQ(hipStreamSynchronize(stream), hipSuccess);
+
+    EXPECT_EQ(hipGraphExecDestroy(graph), hipSuccess);
+    hipblasDestroy(handle);
+    EXPECT_EQ(hipStreamDestroy(stream), hipSuccess);
+    EXPECT_EQ(hipFree(dx), hipSuccess);
+    EXPECT_EQ(hipFree(dy), hipSuccess);
+    EXPECT_EQ(hipFree(dz), hipSuccess);
+}
@@ -0,0 +1,114 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_compact.hpp"
+#include "utility.h"
+#include <gtest/gtest.h>
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, vector<char>, int> compact_tuple;
+
+// vector of vector, each vector is a {M, N, K}; getrs solves N x N systems with K right-hand sides
+const vector<vector<int>> matrix_size_range
+    = {{-1, -1, -1}, {1, 1, 1}, {2, 3, 2}, {8, 8, 8}, {16, 5, 16}};
+
+// vector of vector, each vector is a {transA, transB}
+const vector<vector<char>> transA_transB_range = {{'N', 'N'}, {'T', 'N'}, {'N', 'T'}, {'T', 'T'}};
+
+const vector<int> batch_count_range = {-1, 0, 1, 7, 1000};
+
+Arguments setup_compact_arguments(compact_tuple tup)
+{
+    vector<int>  matrix_size   = std::get<0>(tup);
+    vector<char> transA_transB = std::get<1>(tup);
+    int          batch_count   = std::get<2>(tup);
+
+    Arguments arg;
+
+    arg.M = matrix_size[0];
+    arg.N = matrix_size[1];
+    arg.K = matrix_size[2];
+
+    arg.transA_option = transA_transB[0];
+    arg.transB_option = transA_transB[1];
+
+    arg.alpha = 2.0;
+    arg.beta  = -1.0;
+
+    arg.timing      = 0;
+    arg.batch_count = batch_count;
+
+    return arg;
+}
+
+class compact_gtest : public ::TestWithParam<compact_tuple>
+{
+protected:
+    compact_gtest() {}
+    virtual ~compact_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_P(compact_gtest, gemm_compact_gtest_float)
+{
+    // GetParam returns a tuple. The setup routine unpacks the tuple
+    // and initializes arg(Arguments), which will be passed to testing routine.
+
+    Arguments arg = setup_compact_arguments(GetParam());
+
+    hipblasStatus_t status = testing_gemm_compact<float>(arg);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.M < 0 || arg.N < 0 || arg.K < 0 || arg.batch_count < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+        }
+    }
+}
+
+TEST_P(compact_gtest, getrs_compact_gtest_double)
+{
+    // GetParam returns a tuple. The setup routine unpacks the tuple
+    // and initializes arg(Arguments), which will be passed to testing routine.
+
+    Arguments arg = setup_compact_arguments(GetParam());
+
+    hipblasStatus_t status = testing_getrs_compact<double>(arg);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.N < 0 || arg.K < 0 || arg.batch_count < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+        }
+    }
+}
+
+// ValuesIn takes each element of the ranges, combines them, and feeds them to test_p
+// The combinations are  { {M, N, K}, {transA, transB}, batch_count }
+
+INSTANTIATE_TEST_CASE_P(hipblasCompact,
+                        compact_gtest,
+                        Combine(ValuesIn(matrix_size_range),
+                                ValuesIn(transA_transB_range),
+                                ValuesIn(batch_count_range)));
@@ -0,0 +1,114 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+// clients/include has a hipblas.hpp of its own, the templated client interface, so the
+// installed one is named by path
+#include "../../library/include/hipblas.hpp"
+#include <cmath>
+#include <gtest/gtest.h>
+#include <hip/hip_runtime_api.h>
+#include <vector>
+
+using namespace std;
+
+/* =====================================================================
+     BLAS cxx_api:
+=================================================================== */
+
+namespace
+{
+    // y = alpha * A * x + y and C = A * A^T through the overloads, for any real T
+    template <typename T>
+    void run_generic(double tol)
+    {
+        const int m = 13, n = 9;
+        vector<T> hA(m * n), hx(n), hy(m), hC(m * m, T(0));
+        for(int i = 0; i < m * n; i++)
+            hA[i] = T(std::sin(double(i)));
+        for(int i = 0; i < n; i++)
+            hx[i] = T(std::cos(double(i)));
+        for(int i = 0; i < m; i++)
+            hy[i] = T(i);
+
+        T *dA, *dx, *dy, *dC;
+        ASSERT_EQ(hipMalloc(&dA, hA.size() * sizeof(T)), hipSuccess);
+        ASSERT_EQ(hipMalloc(&dx, hx.size() * sizeof(T)), hipSuccess);
+        ASSERT_EQ(hipMalloc(&dy, hy.size() * sizeof(T)), hipSuccess);
+        ASSERT_EQ(hipMalloc(&dC, hC.size() * sizeof(T)), hipSuccess);
+        EXPECT_EQ(hipMemcpy(dA, hA.data(), hA.size() * sizeof(T), hipMemcpyHostToDevice),
+                  hipSuccess);
+        EXPECT_EQ(hipMemcpy(dx, hx.data(), hx.size() * sizeof(T), hipMemcpyHostToDevice),
+                  hipSuccess);
+        EXPECT_EQ(hipMemcpy(dy, hy.data(), hy.size() * sizeof(T), hipMemcpyHostToDevice),
+                  hipSuccess);
+
+        hipblasHandle_t handle;
+        hipblasCreate(&handle);
+
+        const T one = 1, zero = 0, alpha = 2;
+        EXPECT_EQ(hipblas::gemv(handle, HIPBLAS_OP_N, m, n, &alpha, dA, m, dx, 1, &one, dy, 1),
+                  HIPBLAS_STATUS_SUCCESS);
+        EXPECT_EQ(
+            hipblas::gemm(
+                handle, HIPBLAS_OP_N, HIPBLAS_OP_T, m, m, n, &one, dA, m, dA, m, &zero, dC, m),
+            HIPBLAS_STATUS_SUCCESS);
+
+        T norm = 0;
+        EXPECT_EQ(hipblas::nrm2(handle, n, dx, 1, &norm), HIPBLAS_STATUS_SUCCESS);
+
+        vector<T> ry(m), rC(m * m);
+        EXPECT_EQ(hipMemcpy(ry.data(), dy, ry.size() * sizeof(T), hipMemcpyDeviceToHost),
+                  hipSuccess);
+        EXPECT_EQ(hipMemcpy(rC.data(), dC, rC.size() * sizeof(T), hipMemcpyDeviceToHost),
+                  hipSuccess);
+
+        double ss = 0;
+        for(int j = 0; j < n; j++)
+            ss += double(hx[j]) * hx[j];
+        EXPECT_NEAR(std::sqrt(ss), norm, tol);
+        for(int i = 0; i < m; i++)
+        {
+            double s = 0;
+            for(int j = 0; j < n; j++)
+                s += double(hA[i + j * m]) * hx[j];
+            EXPECT_NEAR(2 * s + hy[i], ry[i], tol);
+        }
+        for(int j = 0; j < m; j++)
+            for(int i = 0; i < m; i++)
+            {
+                double s = 0;
+                for(int l = 0; l < n; l++)
+                    s += double(hA[i + l * m]) * hA[j + l * m];
+                EXPECT_NEAR(s, rC[i + j * m], tol);
+            }
+
+        hipblasDestroy(handle);
+        EXPECT_EQ(hipFree(dA), hipSuccess);
+        EXPECT_EQ(hipFree(dx), hipSuccess);
+        EXPECT_EQ(hipFree(dy), hipSuccess);
+        EXPECT_EQ(hipFree(dC), hipSuccess);
+    }
+}
+
+TEST(hipblas_cxx_api, float_overloads)
+{
+    run_generic<float>(1e-4);
+}
+
+TEST(hipblas_cxx_api, double_overloads)
+{
+    run_generic<double>(1e-12);
+}
+
+TEST(hipblas_cxx_api, datatype)
+{
+    static_assert(hipblas::datatype<hipblasHalf>::value == HIPBLAS_R_16F, "");
+    static_assert(hipblas::datatype<float>::value == HIPBLAS_R_32F, "");
+    static_assert(hipblas::datatype<hipblasDoubleComplex>::value == HIPBLAS_C_64F, "");
+
+    // the status comes straight from the C routine
+    float x = 0, result;
+    EXPECT_EQ(hipblas::asum(nullptr, 1, &x, 1, &result), HIPBLAS_STATUS_NOT_INITIALIZED);
+}
@@ -0,0 +1,170 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "cblas_interface.h"
+#include "device_blas.h"
+#include "utility.h"
+#include <cmath>
+#include <gtest/gtest.h>
+#include <hip/hip_runtime_api.h>
+#include <vector>
+
+using namespace std;
+
+/* =====================================================================
+     hipblas_device.hpp, through the single block kernels of device_blas.h:
+=================================================================== */
+
+namespace
+{
+    // A device copy of h, downloaded back into h by get()
+    template <typename T>
+    struct device_copy
+    {
+        vector<T>& h;
+        T*         d;
+
+        explicit device_copy(vector<T>& h)
+            : h(h)
+        {
+            EXPECT_EQ(hipMalloc(&d, h.size() * sizeof(T)), hipSuccess);
+            EXPECT_EQ(hipMemcpy(d, h.data(), h.size() * sizeof(T), hipMemcpyHostToDevice),
+                      hipSuccess);
+        }
+
+        ~device_copy()
+        {
+            EXPECT_EQ(hipFree(d), hipSuccess);
+        }
+
+        void get()
+        {
+            EXPECT_EQ(hipMemcpy(h.data(), d, h.size() * sizeof(T), hipMemcpyDeviceToHost),
+                      hipSuccess);
+        }
+    };
+
+    // Small integers, so sums of products of them are exact
+    void fill(vector<float>& v)
+    {
+        for(float& x : v)
+            x = rand() % 9 - 4;
+    }
+}
+
+TEST(hipblas_device, gemm)
+{
+    const int M = DEVICE_GEMM_M, N = DEVICE_GEMM_N, K = DEVICE_GEMM_K;
+    srand(1);
+    for(hipblasOrder_t order : {HIPBLAS_ORDER_COLUMN_MAJOR, HIPBLAS_ORDER_ROW_MAJOR})
+    {
+        vector<float> A(M * K), B(N * K), C(M * N);
+        fill(A);
+        fill(B);
+        fill(C);
+
+        // A row-major matrix is the column-major transpose, so the reference computes
+        // C^T = B A^T there
+        vector<float> ref = C;
+        if(order == HIPBLAS_ORDER_COLUMN_MAJOR)
+            cblas_gemm<float>(HIPBLAS_OP_N,
+                              HIPBLAS_OP_T,
+                              M,
+                              N,
+                              K,
+                              2,
+                              A.data(),
+                              M,
+                              B.data(),
+                              N,
+                              -1,
+                              ref.data(),
+                              M);
+        else
+            cblas_gemm<float>(HIPBLAS_OP_T,
+                              HIPBLAS_OP_N,
+                              N,
+                              M,
+                              K,
+                              2,
+                              B.data(),
+                              K,
+                              A.data(),
+                              K,
+                              -1,
+                              ref.data(),
+                              N);
+
+        device_copy<float> dA(A), dB(B), dC(C);
+        EXPECT_EQ(hipblas_device_gemm(order, 2, dA.d, dB.d, -1, dC.d), hipSuccess);
+        dC.get();
+        EXPECT_EQ(ref, C);
+    }
+}
+
+TEST(hipblas_device, trsm)
+{
+    const int M = DEVICE_TRSM_M, N = DEVICE_TRSM_N;
+    srand(1);
+    for(hipblasSideMode_t side : {HIPBLAS_SIDE_LEFT, HIPBLAS_SIDE_RIGHT})
+        for(hipblasOperation_t trans : {HIPBLAS_OP_N, HIPBLAS_OP_T})
+        {
+            // A well-conditioned lower triangle, with garbage above it that must not be read
+            int            D = side == HIPBLAS_SIDE_LEFT ? M : N;
+            vector<double> A(D * D), B(M * N);
+            for(int j = 0; j < D; j++)
+                for(int i = 0; i < D; i++)
+                    A[i + j * D] = i < j ? 1e30 : i == j ? 4 + i : (rand() % 9 - 4) / 8.0;
+            for(double& x : B)
+                x = rand() % 9 - 4;
+
+            vector<double> ref = B;
+            cblas_trsm<double>(side,
+                               HIPBLAS_FILL_MODE_LOWER,
+                               trans,
+                               HIPBLAS_DIAG_NON_UNIT,
+                               M,
+                               N,
+                               0.5,
+                               A.data(),
+                               D,
+                               ref.data(),
+                               M);
+
+            device_copy<double> dA(A), dB(B);
+            EXPECT_EQ(hipblas_device_trsm(side, trans, 0.5, dA.d, dB.d), hipSuccess);
+            dB.get();
+            for(int i = 0; i < M * N; i++)
+                EXPECT_NEAR(ref[i], B[i], 1e-12 * (1 + std::abs(ref[i])));
+        }
+}
+
+TEST(hipblas_device, getrf)
+{
+    const int N = DEVICE_GETRF_N;
+    srand(1);
+    vector<hipblasDoubleComplex> A(N * N);
+    for(hipblasDoubleComplex& x : A)
+        x = hipblasDoubleComplex(rand() % 9 - 4, rand() % 9 - 4);
+
+    vector<hipblasDoubleComplex> ref = A;
+    vector<int>                  ref_ipiv(N), ipiv(N), info(1, -1);
+    cblas_getrf<hipblasDoubleComplex>(N, N, ref.data(), N, ref_ipiv.data());
+
+    device_copy<hipblasDoubleComplex> dA(A);
+    device_copy<int>                  dipiv(ipiv), dinfo(info);
+    EXPECT_EQ(hipblas_device_getrf(dA.d, dipiv.d, dinfo.d), hipSuccess);
+    dA.get();
+    dipiv.get();
+    dinfo.get();
+
+    EXPECT_EQ(0, info[0]);
+    EXPECT_EQ(ref_ipiv, ipiv);
+    for(int i = 0; i < N * N; i++)
+    {
+        EXPECT_NEAR(ref[i].x, A[i].x, 1e-12 * (1 + std::abs(ref[i].x)));
+        EXPECT_NEAR(ref[i].y, A[i].y, 1e-12 * (1 + std::abs(ref[i].y)));
+    }
+}
@@ -0,0 +1,119 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "device_compare.h"
+#include "unit.h"
+#include "utility.h"
+#include <cmath>
+#include <gtest/gtest.h>
+#include <hip/hip_runtime_api.h>
+#include <limits>
+#include <vector>
+
+using namespace std;
+
+/* =====================================================================
+     client device_compare:
+=================================================================== */
+
+namespace
+{
+    struct device_pair
+    {
+        size_t size;
+        float* ref;
+        float* res;
+
+        device_pair(const vector<float>& href, const vector<float>& hres)
+            : size(href.size() * sizeof(float))
+        {
+            EXPECT_EQ(hipMalloc(&ref, size), hipSuccess);
+            EXPECT_EQ(hipMalloc(&res, size), hipSuccess);
+            EXPECT_EQ(hipMemcpy(ref, href.data(), size, hipMemcpyHostToDevice), hipSuccess);
+            EXPECT_EQ(hipMemcpy(res, hres.data(), size, hipMemcpyHostToDevice), hipSuccess);
+        }
+
+        ~device_pair()
+        {
+            EXPECT_EQ(hipFree(ref), hipSuccess);
+            EXPECT_EQ(hipFree(res), hipSuccess);
+        }
+    };
+}
+
+TEST(hipblas_client_device_compare, summary)
+{
+    const int     M = 300, N = 70, lda = 305, batch_count = 4;
+    const int64_t stride = int64_t(lda) * N + 3;
+    vector<float> href(stride * batch_count), hres;
+    for(size_t i = 0; i < href.size(); i++)
+        href[i] = float(i % 13) - 6.0f;
+
+    // padding between columns and batches is never compared
+    hres = href;
+    for(size_t i = M; i < size_t(lda); i++)
+        hres[i] = 1e30f;
+    {
+        device_pair             d(href, hres);
+        hipblas_compare_summary s;
+        EXPECT_EQ(hipblas_compare_device(M, N, batch_count, lda, stride, d.ref, d.res, &s),
+                  hipSuccess);
+        EXPECT_EQ(0, s.mismatches);
+        EXPECT_EQ(-1, s.first_mismatch);
+        EXPECT_EQ(0.0, s.max_abs_error);
+        unit_check_device(M, N, batch_count, lda, stride, d.ref, d.res);
+    }
+
+    // (5, 9) of batch 2 is off by 0.5 and (1, 3) of batch 3 is NaN
+    hres = href;
+    size_t off = 5 + 9 * lda + 2 * stride;
+    hres[off] += 0.5f;
+    hres[1 + 3 * lda + 3 * stride] = std::numeric_limits<float>::quiet_NaN();
+    {
+        device_pair             d(href, hres);
+        hipblas_compare_summary s;
+        EXPECT_EQ(hipblas_compare_device(M, N, batch_count, lda, stride, d.ref, d.res, &s),
+                  hipSuccess);
+        EXPECT_EQ(2, s.mismatches);
+        EXPECT_EQ(1, s.nan_mismatches);
+        EXPECT_EQ((2 * N + 9) * M + 5, s.first_mismatch);
+        EXPECT_EQ(0.5, s.max_abs_error);
+        EXPECT_DOUBLE_EQ(0.5 / std::abs(href[off]), s.max_rel_error);
+    }
+}
+
+TEST(hipblas_client_device_compare, batched)
+{
+    const int     n = 17, batch_count = 3;
+    vector<float> href(n * n * batch_count, 2.0f), hres = href;
+    hres[n * n + 4] = 2.5f;
+    device_pair          d(href, hres);
+    vector<const float*> refs, ress;
+    for(int b = 0; b < batch_count; b++)
+    {
+        refs.push_back(d.ref + b * n * n);
+        ress.push_back(d.res + b * n * n);
+    }
+
+    const float **drefs, **dress;
+    ASSERT_EQ(hipMalloc(&drefs, batch_count * sizeof(float*)), hipSuccess);
+    ASSERT_EQ(hipMalloc(&dress, batch_count * sizeof(float*)), hipSuccess);
+    EXPECT_EQ(hipMemcpy(drefs, refs.data(), batch_count * sizeof(float*), hipMemcpyHostToDevice),
+              hipSuccess);
+    EXPECT_EQ(hipMemcpy(dress, ress.data(), batch_count * sizeof(float*), hipMemcpyHostToDevice),
+              hipSuccess);
+
+    hipblas_compare_summary s;
+    EXPECT_EQ(hipblas_compare_device_batched<float>(n, n, batch_count, n, drefs, dress, &s),
+              hipSuccess);
+    EXPECT_EQ(1, s.mismatches);
+    EXPECT_EQ(n * n + 4, s.first_mismatch);
+    EXPECT_EQ(0.25, s.max_rel_error);
+
+    EXPECT_EQ(hipblas_compare_device<float>(n, n, 1, n, 0, d.ref, d.res, nullptr),
+              hipErrorInvalidValue);
+    EXPECT_EQ(hipFree(drefs), hipSuccess);
+    EXPECT_EQ(hipFree(dress), hipSuccess);
+}
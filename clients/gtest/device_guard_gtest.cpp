@@ -0,0 +1,96 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "device_guard.h"
+#include <gtest/gtest.h>
+#include <hip/hip_runtime_api.h>
+#include <vector>
+
+using namespace std;
+
+/* =====================================================================
+     client device_guard:
+=================================================================== */
+
+namespace
+{
+    // count guards of guard_bytes, stride_bytes apart, with the gaps between them left alone
+    void run_case(size_t count, size_t stride_bytes, size_t guard_bytes)
+    {
+        vector<unsigned char> reference(guard_bytes);
+        for(size_t i = 0; i < guard_bytes; i++)
+            reference[i] = (unsigned char)(i * 37 + 11);
+
+        size_t         bytes = (count - 1) * stride_bytes + guard_bytes;
+        unsigned char* d;
+        ASSERT_EQ(hipMalloc(&d, bytes), hipSuccess);
+        EXPECT_EQ(hipMemset(d, 0, bytes), hipSuccess);
+        EXPECT_EQ(hipblas_device_fill_guards(d, stride_bytes, count, reference.data(), guard_bytes),
+                  hipSuccess);
+
+        size_t corrupted = 1;
+        EXPECT_EQ(hipblas_device_check_guards(
+                      d, stride_bytes, count, reference.data(), guard_bytes, &corrupted),
+                  hipSuccess);
+        EXPECT_EQ(corrupted, size_t(0));
+
+        // the gaps were not written
+        vector<unsigned char> host(bytes);
+        EXPECT_EQ(hipMemcpy(host.data(), d, bytes, hipMemcpyDeviceToHost), hipSuccess);
+        for(size_t g = 0; g + 1 < count; g++)
+            for(size_t i = guard_bytes; i < stride_bytes; i++)
+                ASSERT_EQ(host[g * stride_bytes + i], 0) << "guard " << g << " byte " << i;
+
+        // one changed byte in each of two guards, two in a third
+        size_t last = (count - 1) * stride_bytes;
+        EXPECT_EQ(hipMemset(d, 0xff ^ reference[0], 1), hipSuccess);
+        EXPECT_EQ(hipMemset(d + last + guard_bytes - 1, 0xff ^ reference[guard_bytes - 1], 1),
+                  hipSuccess);
+        if(count > 2)
+            EXPECT_EQ(hipMemset(d + stride_bytes, 0xff ^ reference[0], 2), hipSuccess);
+        EXPECT_EQ(hipblas_device_check_guards(
+                      d, stride_bytes, count, reference.data(), guard_bytes, &corrupted),
+                  hipSuccess);
+        EXPECT_EQ(corrupted, size_t(count > 2 ? 3 : 2));
+
+        EXPECT_EQ(hipFree(d), hipSuccess);
+    }
+}
+
+TEST(hipblas_client_device_guard, vector)
+{
+    run_case(2, 4096 * 4 + 1000, 4096 * 4);
+    run_case(2, 7, 3);
+}
+
+// more guards than one grid holds
+TEST(hipblas_client_device_guard, batched)
+{
+    run_case(11, 4096 * 8 + 24, 4096 * 8);
+    run_case(70000, 16, 8);
+}
+
+TEST(hipblas_client_device_guard, size)
+{
+    EXPECT_EQ(hipblas_client_guard(0), size_t(0));
+    EXPECT_LE(hipblas_client_guard(4096), size_t(4096));
+}
+
+TEST(hipblas_client_device_guard, bad_arg)
+{
+    unsigned char reference[4] = {1, 2, 3, 4};
+    size_t        corrupted;
+    EXPECT_EQ(hipblas_device_fill_guards(nullptr, 8, 2, reference, 4), hipErrorInvalidValue);
+    EXPECT_EQ(hipblas_device_check_guards(nullptr, 8, 2, reference, 4, &corrupted),
+              hipErrorInvalidValue);
+    EXPECT_EQ(hipblas_device_check_guards(reference, 8, 2, reference, 4, nullptr),
+              hipErrorInvalidValue);
+
+    // nothing to do
+    EXPECT_EQ(hipblas_device_fill_guards(nullptr, 8, 0, nullptr, 4), hipSuccess);
+    corrupted = 1;
+    EXPECT_EQ(hipblas_device_check_guards(nullptr, 8, 2, nullptr, 0, &corrupted), hipSuccess);
+    EXPECT_EQ(corrupted, size_t(0));
+}
@@ -0,0 +1,109 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "device_init.h"
+#include "utility.h"
+#include <cmath>
+#include <cstring>
+#include <gtest/gtest.h>
+#include <hip/hip_runtime_api.h>
+#include <vector>
+
+using namespace std;
+
+/* =====================================================================
+     client device_init:
+=================================================================== */
+
+namespace
+{
+    template <typename T>
+    vector<T> fill_device(int size, hipError_t (*init)(T*, int, int, int, int), int n, int lda)
+    {
+        vector<T> h(size);
+        T*        d;
+        EXPECT_EQ(hipMalloc(&d, size * sizeof(T)), hipSuccess);
+        EXPECT_EQ(hipMemset(d, 0, size * sizeof(T)), hipSuccess);
+        srand(1);
+        EXPECT_EQ(init(d, n, lda, 0, 1), hipSuccess);
+        EXPECT_EQ(hipMemcpy(h.data(), d, size * sizeof(T), hipMemcpyDeviceToHost), hipSuccess);
+        EXPECT_EQ(hipFree(d), hipSuccess);
+        return h;
+    }
+
+    // after the same srand() the device fill is the host fill, padding and batches included
+    template <typename T>
+    void check_matches_host()
+    {
+        const int M = 37, N = 23, lda = 41, stride = lda * N + 5, batch_count = 3;
+        const int size = stride * batch_count;
+
+        vector<T> hA(size), rA(size);
+        srand(7);
+        hipblas_init<T>(hA, M, N, lda, stride, batch_count);
+
+        T* dA;
+        ASSERT_EQ(hipMalloc(&dA, size * sizeof(T)), hipSuccess);
+        EXPECT_EQ(hipMemset(dA, 0, size * sizeof(T)), hipSuccess);
+        srand(7);
+        EXPECT_EQ(hipblas_init_device<T>(dA, M, N, lda, stride, batch_count), hipSuccess);
+        EXPECT_EQ(hipMemcpy(rA.data(), dA, size * sizeof(T), hipMemcpyDeviceToHost), hipSuccess);
+        EXPECT_EQ(hipFree(dA), hipSuccess);
+
+        EXPECT_EQ(0, memcmp(hA.data(), rA.data(), size * sizeof(T)));
+    }
+}
+
+TEST(hipblas_client_device_init, matches_host)
+{
+    check_matches_host<float>();
+    check_matches_host<double>();
+    check_matches_host<hipblasHalf>();
+    check_matches_host<hipblasBfloat16>();
+    check_matches_host<hipblasComplex>();
+    check_matches_host<hipblasDoubleComplex>();
+}
+
+TEST(hipblas_client_device_init, alternating_sign)
+{
+    const int     M = 19, N = 11, lda = 20;
+    vector<float> hA(lda * N);
+    float*        dA;
+    ASSERT_EQ(hipMalloc(&dA, hA.size() * sizeof(float)), hipSuccess);
+    EXPECT_EQ(hipblas_init_alternating_sign_device<float>(dA, M, N, lda), hipSuccess);
+    EXPECT_EQ(hipMemcpy(hA.data(), dA, hA.size() * sizeof(float), hipMemcpyDeviceToHost),
+              hipSuccess);
+    EXPECT_EQ(hipFree(dA), hipSuccess);
+
+    for(int j = 0; j < N; j++)
+        for(int i = 0; i < M; i++)
+        {
+            float v = hA[i + j * lda];
+            EXPECT_EQ((i + j) % 2 == 0, v < 0);
+            EXPECT_TRUE(std::abs(v) >= 1 && std::abs(v) <= 10 && v == int(v));
+        }
+}
+
+TEST(hipblas_client_device_init, symmetric_hermitian)
+{
+    const int N = 29, lda = 31;
+
+    auto sA = fill_device<double>(lda * N, hipblas_init_symmetric_device<double>, N, lda);
+    for(int j = 0; j < N; j++)
+        for(int i = 0; i < N; i++)
+            EXPECT_EQ(sA[i + j * lda], sA[j + i * lda]);
+
+    auto hA = fill_device<hipblasComplex>(
+        lda * N, hipblas_init_hermitian_device<hipblasComplex>, N, lda);
+    for(int j = 0; j < N; j++)
+        for(int i = 0; i < N; i++)
+        {
+            EXPECT_EQ(hA[i + j * lda].x, hA[j + i * lda].x);
+            if(i == j)
+                EXPECT_EQ(0.0f, hA[i + j * lda].y);
+            else
+                EXPECT_EQ(hA[i + j * lda].y, hA[j + i * lda].y);
+        }
+}
@@ -0,0 +1,47 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "device_pool.h"
+#include <gtest/gtest.h>
+#include <hip/hip_runtime_api.h>
+
+/* =====================================================================
+     client device_pool:
+=================================================================== */
+
+TEST(hipblas_client_device_pool, reuse)
+{
+    void *a, *b, *c;
+    ASSERT_EQ(hipblas_pool_malloc(&a, 1000000), hipSuccess);
+    ASSERT_NE(a, nullptr);
+
+    // HIPBLAS_CLIENT_POOL=0 leaves nothing to check
+    if(!hipblas_pool_peak_bytes())
+    {
+        EXPECT_EQ(hipblas_pool_free(a), hipSuccess);
+        return;
+    }
+
+    size_t peak = hipblas_pool_peak_bytes();
+    EXPECT_GE(peak, size_t(1000000));
+    EXPECT_EQ(hipblas_pool_free(a), hipSuccess);
+
+    // a request of the same size class gets the cached block back
+    ASSERT_EQ(hipblas_pool_malloc(&b, 1000001), hipSuccess);
+    EXPECT_EQ(a, b);
+    EXPECT_EQ(hipMemset(b, 0, 1000001), hipSuccess);
+    EXPECT_EQ(peak, hipblas_pool_peak_bytes());
+
+    // two live blocks add up in the peak
+    ASSERT_EQ(hipblas_pool_malloc(&c, 1000000), hipSuccess);
+    EXPECT_NE(b, c);
+    EXPECT_GE(hipblas_pool_peak_bytes(), peak + 1000000);
+    EXPECT_EQ(hipblas_pool_free(b), hipSuccess);
+    EXPECT_EQ(hipblas_pool_free(c), hipSuccess);
+
+    EXPECT_EQ(hipblas_pool_free(nullptr), hipSuccess);
+    EXPECT_EQ(hipblas_pool_free(c), hipErrorInvalidValue);
+    hipblas_pool_release();
+}
@@ -0,0 +1,249 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_dgmm.hpp"
+#include "testing_dgmm_batched.hpp"
+#include "testing_dgmm_strided_batched.hpp"
+#include "utility.h"
+#include <gtest/gtest.h>
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+// only GCC/VS 2010 comes with std::tr1::tuple, but it is unnecessary,  std::tuple is good enough;
+
+typedef std::tuple<vector<int>, int, char, double, int> dgmm_tuple;
+
+/* =====================================================================
+README: This file contains testers to verify the correctness of
+        BLAS routines with google test
+
+        It is supposed to be played/used by advance / expert users
+        Normal users only need to get the library routines without testers
+     =================================================================== */
+
+/* =====================================================================
+Advance users only: BrainStorm the parameters but do not make artificial one which invalidates the
+matrix.
+like lda pairs with M, and "lda must >= M". case "lda < M" will be guarded by argument-checkers
+inside API of course.
+Yet, the goal of this file is to verify result correctness not argument-checkers.
+
+Representative sampling is sufficient, endless brute-force sampling is not necessary
+=================================================================== */
+
+// vector of vector, each vector is a {M, N, lda, ldc};
+// add/delete as a group
+const vector<vector<int>> matrix_size_range
+    = {{-1, -1, -1, -1}, {11, 6, 11, 11}, {16, 15, 20, 16}, {32, 12, 32, 40}, {65, 4, 65, 65}};
+
+const vector<int> incx_range = {1, 2};
+
+const vector<char> side_range = {'L', 'R'};
+
+const vector<double> stride_scale_range = {1.0, 2.5};
+const vector<int>    batch_count_range  = {-1, 0, 1, 2, 10};
+
+/* ===============Google Unit Test==================================================== */
+
+/* =====================================================================
+     BLAS-3 dgmm:
+=================================================================== */
+
+/* ============================Setup Arguments======================================= */
+
+// Please use "class Arguments" (see utility.hpp) to pass parameters to templated testers;
+// Some routines may not touch/use certain "members" of objects "argus".
+// like BLAS-1 Scal does not have lda, BLAS-2 GEMV does not have ldb, ldc;
+// That is fine. These testers & routines will leave untouched members alone.
+// Do not use std::tuple to directly pass parameters to testers
+// by std:tuple, you have unpack it with extreme care for each one by like "std::get<0>" which is
+// not intuitive and error-prone
+
+Arguments setup_dgmm_arguments(dgmm_tuple tup)
+{
+
+    vector<int> matrix_size  = std::get<0>(tup);
+    int         incx         = std::get<1>(tup);
+    char        side         = std::get<2>(tup);
+    double      stride_scale = std::get<3>(tup);
+    int         batch_count  = std::get<4>(tup);
+
+    Arguments arg;
+
+    // see the comments about matrix_size_range above
+    arg.M   = matrix_size[0];
+    arg.N   = matrix_size[1];
+    arg.lda = matrix_size[2];
+    arg.ldc = matrix_size[3];
+
+    arg.incx = incx;
+
+    arg.timing = 0;
+
+    arg.side_option = side;
+
+    arg.stride_scale = stride_scale;
+    arg.batch_count  = batch_count;
+
+    return arg;
+}
+
+// the argument checks shared by the testers
+bool dgmm_arguments_invalid(const Arguments& arg)
+{
+    return arg.M < 0 || arg.N < 0 || arg.lda < arg.M || arg.ldc < arg.M || arg.incx <= 0;
+}
+
+class blas3_dgmm_gtest : public ::TestWithParam<dgmm_tuple>
+{
+protected:
+    blas3_dgmm_gtest() {}
+    virtual ~blas3_dgmm_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+// dgmm
+TEST_P(blas3_dgmm_gtest, dgmm_gtest_float)
+{
+    Arguments arg = setup_dgmm_arguments(GetParam());
+
+    hipblasStatus_t status = testing_dgmm<float>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(dgmm_arguments_invalid(arg))
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
+
+TEST_P(blas3_dgmm_gtest, dgmm_gtest_double_complex)
+{
+    Arguments arg = setup_dgmm_arguments(GetParam());
+
+    hipblasStatus_t status = testing_dgmm<hipblasDoubleComplex>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(dgmm_arguments_invalid(arg))
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
+
+// dgmm_batched
+TEST_P(blas3_dgmm_gtest, dgmm_batched_gtest_float)
+{
+    Arguments arg = setup_dgmm_arguments(GetParam());
+
+    hipblasStatus_t status = testing_dgmm_batched<float>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(dgmm_arguments_invalid(arg) || arg.batch_count < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_NOT_SUPPORTED, status); // for cuda
+        }
+    }
+}
+
+TEST_P(blas3_dgmm_gtest, dgmm_batched_gtest_double_complex)
+{
+    Arguments arg = setup_dgmm_arguments(GetParam());
+
+    hipblasStatus_t status = testing_dgmm_batched<hipblasDoubleComplex>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(dgmm_arguments_invalid(arg) || arg.batch_count < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_NOT_SUPPORTED, status); // for cuda
+        }
+    }
+}
+
+// dgmm_strided_batched
+TEST_P(blas3_dgmm_gtest, dgmm_strided_batched_gtest_float)
+{
+    Arguments arg = setup_dgmm_arguments(GetParam());
+
+    hipblasStatus_t status = testing_dgmm_strided_batched<float>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(dgmm_arguments_invalid(arg) || arg.batch_count < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_NOT_SUPPORTED, status); // for cuda
+        }
+    }
+}
+
+TEST_P(blas3_dgmm_gtest, dgmm_strided_batched_gtest_double_complex)
+{
+    Arguments arg = setup_dgmm_arguments(GetParam());
+
+    hipblasStatus_t status = testing_dgmm_strided_batched<hipblasDoubleComplex>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(dgmm_arguments_invalid(arg) || arg.batch_count < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_NOT_SUPPORTED, status); // for cuda
+        }
+    }
+}
+
+// notice we are using vector of vector
+// so each elment in xxx_range is a avector,
+// ValuesIn take each element (a vector) and combine them and feed them to test_p
+// The combinations are  { {M, N, lda, ldc}, incx, side, stride_scale, batch_count }
+
+INSTANTIATE_TEST_CASE_P(hipblasDgmm,
+                        blas3_dgmm_gtest,
+                        Combine(ValuesIn(matrix_size_range),
+                                ValuesIn(incx_range),
+                                ValuesIn(side_range),
+                                ValuesIn(stride_scale_range),
+                                ValuesIn(batch_count_range)));
@@ -0,0 +1,85 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_dist_gemm.hpp"
+#include "utility.h"
+#include <gtest/gtest.h>
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, vector<double>> dist_gemm_tuple;
+
+// {M, N, K, block, lda, ldc}; blocks smaller than K give several SUMMA steps, the last partial
+const vector<vector<int>> matrix_size_range = {{-1, 1, 1, 8, 1, 1},
+                                               {10, 10, 10, 16, 10, 10},
+                                               {64, 96, 100, 32, 70, 64},
+                                               {130, 70, 200, 48, 135, 130}};
+
+// {alpha, beta}
+const vector<vector<double>> alpha_beta_range = {{1.0, 0.0}, {-0.5, 2.0}, {0.0, 1.5}};
+
+Arguments setup_dist_gemm_arguments(dist_gemm_tuple tup)
+{
+    vector<int>    matrix_size = std::get<0>(tup);
+    vector<double> alpha_beta  = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.M   = matrix_size[0];
+    arg.N   = matrix_size[1];
+    arg.K   = matrix_size[2];
+    arg.ldb = matrix_size[3];
+    arg.lda = matrix_size[4];
+    arg.ldc = matrix_size[5];
+
+    arg.alpha = alpha_beta[0];
+    arg.beta  = alpha_beta[1];
+
+    return arg;
+}
+
+class dist_gemm_gtest : public ::TestWithParam<dist_gemm_tuple>
+{
+protected:
+    dist_gemm_gtest() {}
+    virtual ~dist_gemm_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_P(dist_gemm_gtest, dist_gemm_gtest_double)
+{
+    // GetParam returns a tuple. The setup routine unpacks the tuple
+    // and initializes arg(Arguments), which will be passed to testing routine.
+
+    Arguments arg = setup_dist_gemm_arguments(GetParam());
+
+    hipblasStatus_t status = testing_dist_gemm(arg);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.M < 0 || arg.N < 0 || arg.K < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+        }
+    }
+}
+
+// The combinations are  { {M, N, K, block, lda, ldc}, {alpha, beta} }
+
+INSTANTIATE_TEST_CASE_P(hipblasDistGemm,
+                        dist_gemm_gtest,
+                        Combine(ValuesIn(matrix_size_range), ValuesIn(alpha_beta_range)));
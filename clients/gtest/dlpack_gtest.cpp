@@ -0,0 +1,290 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "hipblas_dlpack.h"
+#include <gtest/gtest.h>
+#include <hip/hip_runtime.h>
+#include <vector>
+
+using namespace std;
+
+/* =====================================================================
+     BLAS routines on DLPack tensors:
+=================================================================== */
+
+namespace
+{
+    // A float tensor over device memory with the given shape and element strides, as a
+    // framework would export it
+    struct dlpack_tensor
+    {
+        vector<int64_t> shape;
+        vector<int64_t> strides;
+        DLManagedTensor managed = {};
+
+        dlpack_tensor(void* data, vector<int64_t> shape_, vector<int64_t> strides_, int device)
+            : shape(shape_)
+            , strides(strides_)
+        {
+            managed.dl_tensor.data               = data;
+            managed.dl_tensor.device.device_type = kDLROCM;
+            managed.dl_tensor.device.device_id   = device;
+            managed.dl_tensor.ndim               = int(shape.size());
+            managed.dl_tensor.dtype              = {kDLFloat, 32, 1};
+            managed.dl_tensor.shape              = shape.data();
+            managed.dl_tensor.strides            = strides.empty() ? nullptr : strides.data();
+            managed.dl_tensor.byte_offset        = 0;
+        }
+    };
+
+    // C = A B on the host for matrices whose element (i, j) is at i * rs + j * cs
+    void host_gemm(int          m,
+                   int          n,
+                   int          k,
+                   const float* a,
+                   int64_t      a_rs,
+                   int64_t      a_cs,
+                   const float* b,
+                   int64_t      b_rs,
+                   int64_t      b_cs,
+                   float*       c,
+                   int64_t      c_rs,
+                   int64_t      c_cs)
+    {
+        for(int i = 0; i < m; i++)
+            for(int j = 0; j < n; j++)
+            {
+                float sum = 0;
+                for(int l = 0; l < k; l++)
+                    sum += a[i * a_rs + l * a_cs] * b[l * b_rs + j * b_cs];
+                c[i * c_rs + j * c_cs] = sum;
+            }
+    }
+}
+
+// Every mix of row-major and column-major operands gives the product of the logical tensors
+TEST(hipblas_dlpack, hipblas_dlpack_gemm)
+{
+    const int m = 5, n = 4, k = 3, pad = 2;
+
+    int device;
+    ASSERT_EQ(hipGetDevice(&device), hipSuccess);
+    hipblasHandle_t handle;
+    ASSERT_EQ(hipblasCreate(&handle), HIPBLAS_STATUS_SUCCESS);
+
+    // Room for every layout below, padded
+    const int     size = (m + pad) * (k + pad) + (k + pad) * (n + pad) + (m + pad) * (n + pad);
+    vector<float> host(size);
+    for(int i = 0; i < size; i++)
+        host[i] = float(i % 7) - 3;
+    float* dA = nullptr;
+    ASSERT_EQ(hipMalloc(&dA, size * sizeof(float)), hipSuccess);
+    ASSERT_EQ(hipMemcpy(dA, host.data(), size * sizeof(float), hipMemcpyHostToDevice), hipSuccess);
+    float* dB = dA + (m + pad) * (k + pad);
+    float* dC = dB + (k + pad) * (n + pad);
+
+    float alpha = 1, beta = 0;
+    for(bool a_rows : {true, false})
+        for(bool b_rows : {true, false})
+            for(bool c_rows : {true, false})
+            {
+                // Row-major with a padded row, or column-major with a padded column
+                int64_t a_rs = a_rows ? k + pad : 1, a_cs = a_rows ? 1 : m + pad;
+                int64_t b_rs = b_rows ? n + pad : 1, b_cs = b_rows ? 1 : k + pad;
+                int64_t c_rs = c_rows ? n + pad : 1, c_cs = c_rows ? 1 : m + pad;
+
+                dlpack_tensor A(dA, {m, k}, {a_rs, a_cs}, device);
+                dlpack_tensor B(dB, {k, n}, {b_rs, b_cs}, device);
+                dlpack_tensor C(dC, {m, n}, {c_rs, c_cs}, device);
+                EXPECT_EQ(
+                    hipblasDLPackGemm(handle, &alpha, &A.managed, &B.managed, &beta, &C.managed),
+                    HIPBLAS_STATUS_SUCCESS);
+
+                vector<float> result(size), expected(host);
+                ASSERT_EQ(
+                    hipMemcpy(result.data(), dA, size * sizeof(float), hipMemcpyDeviceToHost),
+                    hipSuccess);
+                host_gemm(m,
+                          n,
+                          k,
+                          host.data(),
+                          a_rs,
+                          a_cs,
+                          host.data() + (dB - dA),
+                          b_rs,
+                          b_cs,
+                          expected.data() + (dC - dA),
+                          c_rs,
+                          c_cs);
+                for(int i = 0; i < m; i++)
+                    for(int j = 0; j < n; j++)
+                    {
+                        size_t at = (dC - dA) + i * c_rs + j * c_cs;
+                        EXPECT_EQ(expected[at], result[at]) << a_rows << b_rows << c_rows;
+                    }
+            }
+
+    EXPECT_EQ(hipFree(dA), hipSuccess);
+    EXPECT_EQ(hipblasDestroy(handle), HIPBLAS_STATUS_SUCCESS);
+}
+
+// A batch of matrices times one shared matrix, all compact row-major tensors
+TEST(hipblas_dlpack, hipblas_dlpack_gemm_batched)
+{
+    const int batch = 3, m = 4, n = 2, k = 3;
+
+    int device;
+    ASSERT_EQ(hipGetDevice(&device), hipSuccess);
+    hipblasHandle_t handle;
+    ASSERT_EQ(hipblasCreate(&handle), HIPBLAS_STATUS_SUCCESS);
+
+    vector<float> ha(batch * m * k), hb(k * n), hc(batch * m * n), expected(batch * m * n);
+    for(size_t i = 0; i < ha.size(); i++)
+        ha[i] = float(i % 5) - 2;
+    for(size_t i = 0; i < hb.size(); i++)
+        hb[i] = float(i % 3) + 1;
+    for(int p = 0; p < batch; p++)
+        host_gemm(m, n, k, &ha[p * m * k], k, 1, hb.data(), n, 1, &expected[p * m * n], n, 1);
+
+    float *dA, *dB, *dC;
+    ASSERT_EQ(hipMalloc(&dA, ha.size() * sizeof(float)), hipSuccess);
+    ASSERT_EQ(hipMalloc(&dB, hb.size() * sizeof(float)), hipSuccess);
+    ASSERT_EQ(hipMalloc(&dC, hc.size() * sizeof(float)), hipSuccess);
+    ASSERT_EQ(hipMemcpy(dA, ha.data(), ha.size() * sizeof(float), hipMemcpyHostToDevice),
+              hipSuccess);
+    ASSERT_EQ(hipMemcpy(dB, hb.data(), hb.size() * sizeof(float), hipMemcpyHostToDevice),
+              hipSuccess);
+
+    dlpack_tensor A(dA, {batch, m, k}, {}, device);
+    dlpack_tensor B(dB, {k, n}, {}, device);
+    dlpack_tensor C(dC, {batch, m, n}, {}, device);
+
+    float alpha = 1, beta = 0;
+    EXPECT_EQ(hipblasDLPackGemm(handle, &alpha, &A.managed, &B.managed, &beta, &C.managed),
+              HIPBLAS_STATUS_SUCCESS);
+    ASSERT_EQ(hipMemcpy(hc.data(), dC, hc.size() * sizeof(float), hipMemcpyDeviceToHost),
+              hipSuccess);
+    for(size_t i = 0; i < hc.size(); i++)
+        EXPECT_EQ(expected[i], hc[i]);
+
+    // Shapes that do not multiply, and a C with fewer matrices than A
+    dlpack_tensor C2(dC, {m, n}, {}, device);
+    dlpack_tensor B2(dB, {n, k}, {}, device);
+    EXPECT_EQ(hipblasDLPackGemm(handle, &alpha, &A.managed, &B.managed, &beta, &C2.managed),
+              HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasDLPackGemm(handle, &alpha, &A.managed, &B2.managed, &beta, &C.managed),
+              HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_EQ(hipFree(dA), hipSuccess);
+    EXPECT_EQ(hipFree(dB), hipSuccess);
+    EXPECT_EQ(hipFree(dC), hipSuccess);
+    EXPECT_EQ(hipblasDestroy(handle), HIPBLAS_STATUS_SUCCESS);
+}
+
+TEST(hipblas_dlpack, hipblas_dlpack_get_matrix)
+{
+    int device;
+    ASSERT_EQ(hipGetDevice(&device), hipSuccess);
+    hipblasHandle_t handle;
+    ASSERT_EQ(hipblasCreate(&handle), HIPBLAS_STATUS_SUCCESS);
+
+    float                 storage = 0;
+    hipblasDLPackMatrix_t matrix;
+
+    // Compact row-major is the transpose of a column-major matrix with ld = cols
+    dlpack_tensor row_major(&storage, {6, 4}, {}, device);
+    EXPECT_EQ(hipblasDLPackGetMatrix(handle, &row_major.managed, &matrix), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(HIPBLAS_OP_T, matrix.op);
+    EXPECT_EQ(6, matrix.rows);
+    EXPECT_EQ(4, matrix.cols);
+    EXPECT_EQ(4, matrix.ld);
+    EXPECT_EQ(HIPBLAS_R_32F, matrix.type);
+
+    dlpack_tensor col_major(&storage, {2, 6, 4}, {40, 1, 8}, device);
+    EXPECT_EQ(hipblasDLPackGetMatrix(handle, &col_major.managed, &matrix), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(HIPBLAS_OP_N, matrix.op);
+    EXPECT_EQ(8, matrix.ld);
+    EXPECT_EQ(40, matrix.stride);
+    EXPECT_EQ(2, matrix.batch_count);
+
+    // Neither dimension contiguous, or on another device, or of an unknown type
+    dlpack_tensor strided(&storage, {6, 4}, {8, 2}, device);
+    EXPECT_EQ(hipblasDLPackGetMatrix(handle, &strided.managed, &matrix),
+              HIPBLAS_STATUS_NOT_SUPPORTED);
+    dlpack_tensor elsewhere(&storage, {6, 4}, {}, device + 1);
+    EXPECT_EQ(hipblasDLPackGetMatrix(handle, &elsewhere.managed, &matrix),
+              HIPBLAS_STATUS_INVALID_VALUE);
+    dlpack_tensor unsigned_type(&storage, {6, 4}, {}, device);
+    unsigned_type.managed.dl_tensor.dtype = {kDLUInt, 16, 1};
+    EXPECT_EQ(hipblasDLPackGetMatrix(handle, &unsigned_type.managed, &matrix),
+              HIPBLAS_STATUS_NOT_SUPPORTED);
+
+    EXPECT_EQ(hipblasDLPackGetMatrix(handle, nullptr, &matrix), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasDLPackGetMatrix(handle, &row_major.managed, nullptr),
+              HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasDLPackGetMatrix(nullptr, &row_major.managed, &matrix),
+              HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    EXPECT_EQ(hipblasDestroy(handle), HIPBLAS_STATUS_SUCCESS);
+}
+
+// A reversed view, as x[::-1] exports it, is walked from its first logical element
+TEST(hipblas_dlpack, hipblas_dlpack_level1)
+{
+    const int n = 6;
+
+    int device;
+    ASSERT_EQ(hipGetDevice(&device), hipSuccess);
+    hipblasHandle_t handle;
+    ASSERT_EQ(hipblasCreate(&handle), HIPBLAS_STATUS_SUCCESS);
+
+    vector<float> hx(n), hy(n);
+    for(int i = 0; i < n; i++)
+    {
+        hx[i] = float(i + 1);
+        hy[i] = float(10 * (i + 1));
+    }
+    float *dx, *dy;
+    ASSERT_EQ(hipMalloc(&dx, n * sizeof(float)), hipSuccess);
+    ASSERT_EQ(hipMalloc(&dy, n * sizeof(float)), hipSuccess);
+    ASSERT_EQ(hipMemcpy(dx, hx.data(), n * sizeof(float), hipMemcpyHostToDevice), hipSuccess);
+    ASSERT_EQ(hipMemcpy(dy, hy.data(), n * sizeof(float), hipMemcpyHostToDevice), hipSuccess);
+
+    dlpack_tensor x(dx, {n}, {}, device);
+    dlpack_tensor y(dy, {n}, {}, device);
+    dlpack_tensor x_reversed(dx + n - 1, {n}, {-1}, device);
+
+    // y . x[::-1]
+    float result   = 0;
+    float expected = 0;
+    for(int i = 0; i < n; i++)
+        expected += hy[i] * hx[n - 1 - i];
+    EXPECT_EQ(hipblasDLPackDot(handle, &y.managed, &x_reversed.managed, &result),
+              HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(expected, result);
+
+    // y += 2 x[::-1], then x *= 3
+    float alpha = 2, scale = 3;
+    EXPECT_EQ(hipblasDLPackAxpy(handle, &alpha, &x_reversed.managed, &y.managed),
+              HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasDLPackScal(handle, &scale, &x.managed), HIPBLAS_STATUS_SUCCESS);
+
+    vector<float> rx(n), ry(n);
+    ASSERT_EQ(hipMemcpy(rx.data(), dx, n * sizeof(float), hipMemcpyDeviceToHost), hipSuccess);
+    ASSERT_EQ(hipMemcpy(ry.data(), dy, n * sizeof(float), hipMemcpyDeviceToHost), hipSuccess);
+    for(int i = 0; i < n; i++)
+    {
+        EXPECT_EQ(hy[i] + 2 * hx[n - 1 - i], ry[i]);
+        EXPECT_EQ(3 * hx[i], rx[i]);
+    }
+
+    dlpack_tensor short_y(dy, {n - 1}, {}, device);
+    EXPECT_EQ(hipblasDLPackDot(handle, &x.managed, &short_y.managed, &result),
+              HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_EQ(hipFree(dx), hipSuccess);
+    EXPECT_EQ(hipFree(dy), hipSuccess);
+    EXPECT_EQ(hipblasDestroy(handle), HIPBLAS_STATUS_SUCCESS);
+}
@@ -0,0 +1,94 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_copy_ex_flush_denorm.hpp"
+#include "utility.h"
+#include <gtest/gtest.h>
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+/* =====================================================================
+     BLAS HIPBLAS_FLUSH_DENORM_MATH:
+=================================================================== */
+
+typedef std::tuple<int, vector<int>> flush_denorm_tuple;
+
+const vector<int> N_range = {-1, 0, 4, 11, 100, 1000};
+
+// {incx, incy}
+const vector<vector<int>> incx_incy_range = {{1, 1}, {2, 3}, {-1, 2}, {0, 1}};
+
+Arguments setup_flush_denorm_arguments(flush_denorm_tuple tup)
+{
+    vector<int> incx_incy = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.N    = std::get<0>(tup);
+    arg.incx = incx_incy[0];
+    arg.incy = incx_incy[1];
+
+    return arg;
+}
+
+class flush_denorm_gtest : public ::TestWithParam<flush_denorm_tuple>
+{
+protected:
+    flush_denorm_gtest() {}
+    virtual ~flush_denorm_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+static void check_flush_denorm_status(const Arguments& arg, hipblasStatus_t status)
+{
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.N < 0 || !arg.incx || !arg.incy)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+        }
+    }
+}
+
+// fp16 subnormals read as zeros of their sign; 2^-14, the smallest normal, and 1 go through
+TEST_P(flush_denorm_gtest, half_inputs)
+{
+    Arguments arg = setup_flush_denorm_arguments(GetParam());
+
+    check_flush_denorm_status(arg, testing_copy_ex_flush_denorm<hipblasHalf, float>(arg));
+}
+
+// results subnormal in fp16 are written as zeros, and so are fp32 subnormal inputs
+TEST_P(flush_denorm_gtest, half_results)
+{
+    Arguments arg = setup_flush_denorm_arguments(GetParam());
+
+    check_flush_denorm_status(arg, testing_copy_ex_flush_denorm<float, hipblasHalf>(arg));
+}
+
+TEST_P(flush_denorm_gtest, single)
+{
+    Arguments arg = setup_flush_denorm_arguments(GetParam());
+
+    check_flush_denorm_status(arg, testing_copy_ex_flush_denorm<float, float>(arg));
+}
+
+// The combinations are  { N, {incx, incy} }
+
+INSTANTIATE_TEST_CASE_P(hipblasFlushDenorm,
+                        flush_denorm_gtest,
+                        Combine(ValuesIn(N_range), ValuesIn(incx_incy_range)));
@@ -0,0 +1,154 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_ge2gb.hpp"
+#include "utility.h"
+#include <gtest/gtest.h>
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, vector<int>> ge2gb_tuple;
+
+// {M, N, lda, ldab}
+const vector<vector<int>> matrix_size_range
+    = {{-1, 1, 1, 1}, {10, 10, 10, 2}, {10, 10, 11, 6}, {20, 13, 25, 9}, {600, 500, 600, 200}};
+
+// {KL, KU}
+const vector<vector<int>> band_range = {{-1, 0}, {0, 0}, {1, 2}, {4, 0}, {0, 5}};
+
+Arguments setup_ge2gb_arguments(ge2gb_tuple tup)
+{
+    vector<int> matrix_size = std::get<0>(tup);
+    vector<int> band        = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.M   = matrix_size[0];
+    arg.N   = matrix_size[1];
+    arg.lda = matrix_size[2];
+    arg.ldb = matrix_size[3];
+
+    arg.KL = band[0];
+    arg.KU = band[1];
+
+    return arg;
+}
+
+class ge2gb_gtest : public ::TestWithParam<ge2gb_tuple>
+{
+protected:
+    ge2gb_gtest() {}
+    virtual ~ge2gb_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_P(ge2gb_gtest, ge2gb_gtest_float)
+{
+    // GetParam returns a tuple. The setup routine unpacks the tuple
+    // and initializes arg(Arguments), which will be passed to testing routine.
+
+    Arguments arg = setup_ge2gb_arguments(GetParam());
+
+    hipblasStatus_t status = testing_ge2gb<float>(arg);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.M < 0 || arg.N < 0 || arg.KL < 0 || arg.KU < 0 || arg.lda < max(1, arg.M)
+           || arg.ldb < arg.KL + arg.KU + 1)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+        }
+    }
+}
+
+TEST_P(ge2gb_gtest, ge2gb_gtest_double)
+{
+    // GetParam returns a tuple. The setup routine unpacks the tuple
+    // and initializes arg(Arguments), which will be passed to testing routine.
+
+    Arguments arg = setup_ge2gb_arguments(GetParam());
+
+    hipblasStatus_t status = testing_ge2gb<double>(arg);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.M < 0 || arg.N < 0 || arg.KL < 0 || arg.KU < 0 || arg.lda < max(1, arg.M)
+           || arg.ldb < arg.KL + arg.KU + 1)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+        }
+    }
+}
+
+TEST_P(ge2gb_gtest, ge2gb_gtest_float_complex)
+{
+    // GetParam returns a tuple. The setup routine unpacks the tuple
+    // and initializes arg(Arguments), which will be passed to testing routine.
+
+    Arguments arg = setup_ge2gb_arguments(GetParam());
+
+    hipblasStatus_t status = testing_ge2gb<hipblasComplex>(arg);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.M < 0 || arg.N < 0 || arg.KL < 0 || arg.KU < 0 || arg.lda < max(1, arg.M)
+           || arg.ldb < arg.KL + arg.KU + 1)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+        }
+    }
+}
+
+TEST_P(ge2gb_gtest, ge2gb_gtest_double_complex)
+{
+    // GetParam returns a tuple. The setup routine unpacks the tuple
+    // and initializes arg(Arguments), which will be passed to testing routine.
+
+    Arguments arg = setup_ge2gb_arguments(GetParam());
+
+    hipblasStatus_t status = testing_ge2gb<hipblasDoubleComplex>(arg);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.M < 0 || arg.N < 0 || arg.KL < 0 || arg.KU < 0 || arg.lda < max(1, arg.M)
+           || arg.ldb < arg.KL + arg.KU + 1)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+        }
+    }
+}
+
+// notice we are using vector of vector
+// so each elment in xxx_range is a vector,
+// ValuesIn takes each element (a vector), combines them, and feeds them to test_p
+// The combinations are  { {M, N, lda, ldab}, {KL, KU} }
+
+INSTANTIATE_TEST_CASE_P(hipblasGe2gb,
+                        ge2gb_gtest,
+                        Combine(ValuesIn(matrix_size_range), ValuesIn(band_range)));
@@ -3,6 +3,9 @@
  * ************************************************************************ */
 
 #include "testing_geam.hpp"
+#include "testing_geam_batched.hpp"
+#include "testing_geam_ex_strided_batched.hpp"
+#include "testing_geam_strided_batched.hpp"
 #include "utility.h"
 #include <gtest/gtest.h>
 #include <math.h>
@@ -18,6 +21,7 @@ using namespace std;
 // only GCC/VS 2010 comes with std::tr1::tuple, but it is unnecessary,  std::tuple is good enough;
 
 typedef std::tuple<vector<int>, vector<double>, vector<char>> geam_tuple;
+typedef std::tuple<vector<int>, vector<double>, vector<char>, double, int> geam_batched_tuple;
 
 /* =====================================================================
 README: This file contains testers to verify the correctness of
@@ -53,6 +57,9 @@ const vector<vector<double>> alpha_beta_range = {
 // sgeam/dgeam,
 const vector<vector<char>> transA_transB_range = {{'N', 'N'}, {'N', 'T'}, {'C', 'N'}, {'T', 'C'}};
 
+const vector<double> stride_scale_range = {1.0, 2.5};
+const vector<int>    batch_count_range  = {-1, 0, 1, 2, 10};
+
 /* ===============Google Unit Test==================================================== */
 
 /* =====================================================================
@@ -180,6 +187,172 @@ TEST_P(geam_gtest, geam_gtest_double)
     }
 }
 
+TEST_P(geam_gtest, geam_gtest_float_complex)
+{
+    // GetParam return a tuple. Tee setup routine unpack the tuple
+    // and initializes arg(Arguments) which will be passed to testing routine
+    // The Arguments data struture have physical meaning associated.
+    // while the tuple is non-intuitive.
+
+    Arguments arg = setup_geam_arguments(GetParam());
+
+    hipblasStatus_t status = testing_geam<hipblasComplex>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.M < 0 || arg.N < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else if(arg.transA_option == 'N' ? arg.lda < arg.M : arg.lda < arg.K)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else if(arg.transB_option == 'N' ? arg.ldb < arg.K : arg.ldb < arg.N)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else if(arg.ldc < arg.M)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
+
+Arguments setup_geam_batched_arguments(geam_batched_tuple tup)
+{
+    Arguments arg = setup_geam_arguments(
+        geam_tuple(std::get<0>(tup), std::get<1>(tup), std::get<2>(tup)));
+
+    arg.stride_scale = std::get<3>(tup);
+    arg.batch_count  = std::get<4>(tup);
+
+    return arg;
+}
+
+// the argument checks shared by the batched testers
+bool geam_batched_arguments_invalid(const Arguments& arg)
+{
+    int A_row = arg.transA_option == 'N' ? arg.M : arg.N;
+    int B_row = arg.transB_option == 'N' ? arg.M : arg.N;
+    return arg.M < 0 || arg.N < 0 || arg.lda < A_row || arg.ldb < B_row || arg.ldc < arg.M
+           || arg.batch_count < 0;
+}
+
+class geam_batched_gtest : public ::TestWithParam<geam_batched_tuple>
+{
+protected:
+    geam_batched_gtest() {}
+    virtual ~geam_batched_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_P(geam_batched_gtest, geam_batched_gtest_float)
+{
+    Arguments arg = setup_geam_batched_arguments(GetParam());
+
+    hipblasStatus_t status = testing_geam_batched<float>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(geam_batched_arguments_invalid(arg))
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_NOT_SUPPORTED, status); // for cuda
+        }
+    }
+}
+
+TEST_P(geam_batched_gtest, geam_batched_gtest_double_complex)
+{
+    Arguments arg = setup_geam_batched_arguments(GetParam());
+
+    hipblasStatus_t status = testing_geam_batched<hipblasDoubleComplex>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(geam_batched_arguments_invalid(arg))
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_NOT_SUPPORTED, status); // for cuda
+        }
+    }
+}
+
+TEST_P(geam_batched_gtest, geam_strided_batched_gtest_float)
+{
+    Arguments arg = setup_geam_batched_arguments(GetParam());
+
+    hipblasStatus_t status = testing_geam_strided_batched<float>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(geam_batched_arguments_invalid(arg))
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_NOT_SUPPORTED, status); // for cuda
+        }
+    }
+}
+
+TEST_P(geam_batched_gtest, geam_strided_batched_gtest_double_complex)
+{
+    Arguments arg = setup_geam_batched_arguments(GetParam());
+
+    hipblasStatus_t status = testing_geam_strided_batched<hipblasDoubleComplex>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(geam_batched_arguments_invalid(arg))
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_NOT_SUPPORTED, status); // for cuda
+        }
+    }
+}
+
+// geamEx to half, then transposeEx and copyEx back to float
+TEST_P(geam_batched_gtest, geam_strided_batched_ex_gtest_float_half)
+{
+    Arguments arg = setup_geam_batched_arguments(GetParam());
+
+    hipblasStatus_t status = testing_geam_ex_strided_batched(arg);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(geam_batched_arguments_invalid(arg))
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+        }
+    }
+}
+
 // THis function mainly test the scope of alpha_beta, transA_transB,.the scope of matrix_size_range
 // is small
 
@@ -188,3 +361,11 @@ INSTANTIATE_TEST_CASE_P(hipblasGeam_scalar_transpose,
                         Combine(ValuesIn(matrix_size_range),
                                 ValuesIn(alpha_beta_range),
                                 ValuesIn(transA_transB_range)));
+
+INSTANTIATE_TEST_CASE_P(hipblasGeam_batched,
+                        geam_batched_gtest,
+                        Combine(ValuesIn(matrix_size_range),
+                                ValuesIn(alpha_beta_range),
+                                ValuesIn(transA_transB_range),
+                                ValuesIn(stride_scale_range),
+                                ValuesIn(batch_count_range)));
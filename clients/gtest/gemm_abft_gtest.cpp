@@ -0,0 +1,245 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_gemm_abft.hpp"
+#include "testing_gemm_abft_batched.hpp"
+#include "testing_gemm_abft_strided_batched.hpp"
+#include "utility.h"
+#include <gtest/gtest.h>
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+/* =====================================================================
+     BLAS gemm checked against checksums:
+=================================================================== */
+
+typedef std::tuple<vector<int>, vector<char>, int, double> gemm_abft_tuple;
+typedef std::tuple<vector<int>, vector<char>, int, double, int> gemm_abft_batched_tuple;
+
+// {M, N, K}: C of several 256 x 256 tiles, one a row past a tile, and ones within a tile
+const vector<vector<int>> matrix_size_range
+    = {{-1, 4, 4}, {300, 260, 70}, {257, 40, 33}, {70, 50, 30}, {45, 290, 20}, {64, 65, 66}};
+
+// {transA, transB}
+const vector<vector<char>> transpose_range = {{'N', 'N'}, {'N', 'T'}, {'T', 'N'}, {'T', 'T'}};
+
+// HIPBLAS_ABFT_DETECT and HIPBLAS_ABFT_CORRECT
+const vector<int> abft_mode_range = {1, 2};
+
+// beta 0, where C is not read
+const vector<double> beta_range = {-1.0, 0.0};
+
+const vector<int> batch_count_range = {-1, 0, 3};
+
+Arguments setup_gemm_abft_arguments(gemm_abft_tuple tup)
+{
+    vector<int>  matrix_size = std::get<0>(tup);
+    vector<char> transpose   = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.M             = matrix_size[0];
+    arg.N             = matrix_size[1];
+    arg.K             = matrix_size[2];
+    arg.transA_option = transpose[0];
+    arg.transB_option = transpose[1];
+    arg.abft_mode     = std::get<2>(tup);
+    arg.beta          = std::get<3>(tup);
+    arg.alpha         = 2;
+
+    // padded operands, and a C whose extra rows must keep their values
+    arg.lda = max(1, (arg.transA_option == 'N' ? arg.M : arg.K) + 1);
+    arg.ldb = max(1, (arg.transB_option == 'N' ? arg.K : arg.N) + 2);
+    arg.ldc = max(1, arg.M + 3);
+
+    return arg;
+}
+
+Arguments setup_gemm_abft_batched_arguments(gemm_abft_batched_tuple tup)
+{
+    Arguments arg = setup_gemm_abft_arguments(
+        gemm_abft_tuple(std::get<0>(tup), std::get<1>(tup), std::get<2>(tup), std::get<3>(tup)));
+
+    // room between the batches too, for the strided batched form
+    arg.stride_scale = 1.5;
+    arg.batch_count  = std::get<4>(tup);
+
+    return arg;
+}
+
+// the testers reject invalid sizes before the call
+static void check_gemm_abft_status(const Arguments& arg, hipblasStatus_t status)
+{
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.M < 0 || arg.N < 0 || arg.K < 0 || arg.batch_count < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+        }
+    }
+}
+
+class gemm_abft_gtest : public ::TestWithParam<gemm_abft_tuple>
+{
+protected:
+    gemm_abft_gtest() {}
+    virtual ~gemm_abft_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_P(gemm_abft_gtest, gemm_abft_float)
+{
+    // GetParam returns a tuple. The setup routine unpacks the tuple
+    // and initializes arg(Arguments), which will be passed to testing routine.
+
+    Arguments arg = setup_gemm_abft_arguments(GetParam());
+
+    check_gemm_abft_status(arg, testing_gemm_abft<float>(arg));
+}
+
+TEST_P(gemm_abft_gtest, gemm_abft_double)
+{
+    Arguments arg = setup_gemm_abft_arguments(GetParam());
+
+    check_gemm_abft_status(arg, testing_gemm_abft<double>(arg));
+}
+
+class gemm_abft_batched_gtest : public ::TestWithParam<gemm_abft_batched_tuple>
+{
+protected:
+    gemm_abft_batched_gtest() {}
+    virtual ~gemm_abft_batched_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_P(gemm_abft_batched_gtest, gemm_abft_batched_float)
+{
+    Arguments arg = setup_gemm_abft_batched_arguments(GetParam());
+
+    check_gemm_abft_status(arg, testing_gemm_abft_batched<float>(arg));
+}
+
+TEST_P(gemm_abft_batched_gtest, gemm_abft_strided_batched_float)
+{
+    Arguments arg = setup_gemm_abft_batched_arguments(GetParam());
+
+    check_gemm_abft_status(arg, testing_gemm_abft_strided_batched<float>(arg));
+}
+
+TEST_P(gemm_abft_batched_gtest, gemm_abft_strided_batched_double)
+{
+    Arguments arg = setup_gemm_abft_batched_arguments(GetParam());
+
+    check_gemm_abft_status(arg, testing_gemm_abft_strided_batched<double>(arg));
+}
+
+// The combinations are  { {M, N, K}, {transA, transB}, abft_mode, beta } and
+// { {M, N, K}, {transA, transB}, abft_mode, beta, batch_count }
+
+INSTANTIATE_TEST_CASE_P(hipblasGemmAbft,
+                        gemm_abft_gtest,
+                        Combine(ValuesIn(matrix_size_range),
+                                ValuesIn(transpose_range),
+                                ValuesIn(abft_mode_range),
+                                ValuesIn(beta_range)));
+
+INSTANTIATE_TEST_CASE_P(hipblasGemmAbft_batched,
+                        gemm_abft_batched_gtest,
+                        Combine(ValuesIn(matrix_size_range),
+                                ValuesIn(transpose_range),
+                                ValuesIn(abft_mode_range),
+                                ValuesIn(beta_range),
+                                ValuesIn(batch_count_range)));
+
+TEST(hipblas_gemm_abft, set_get)
+{
+    hipblasHandle_t handle;
+    ASSERT_EQ(hipblas_client_create(&handle), HIPBLAS_STATUS_SUCCESS);
+
+    hipblasAbftMode_t mode = HIPBLAS_ABFT_CORRECT;
+    EXPECT_EQ(hipblasGetAbftMode(handle, &mode), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(HIPBLAS_ABFT_OFF, mode);
+    EXPECT_EQ(hipblasSetAbftMode(handle, HIPBLAS_ABFT_DETECT), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasGetAbftMode(handle, &mode), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(HIPBLAS_ABFT_DETECT, mode);
+
+    hipblasAbftReport_t report{1, 1, 1, 1, 1};
+    EXPECT_EQ(hipblasGetAbftReport(handle, &report), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(report.calls, 0u);
+    EXPECT_EQ(report.tiles, 0u);
+    EXPECT_EQ(report.failed_tiles, 0u);
+
+    EXPECT_EQ(hipblas_client_destroy(handle), HIPBLAS_STATUS_SUCCESS);
+}
+
+// Checking off leaves the report untouched, and resetting clears it
+TEST(hipblas_gemm_abft, report_reset)
+{
+    hipblasHandle_t handle;
+    ASSERT_EQ(hipblas_client_create(&handle), HIPBLAS_STATUS_SUCCESS);
+
+    device_vector<float> A(64 * 64);
+    device_vector<float> C(64 * 64);
+    EXPECT_EQ(hipMemset(A, 0, sizeof(float) * 64 * 64), hipSuccess);
+    float               alpha = 1, beta = 0;
+    hipblasOperation_t  N     = HIPBLAS_OP_N;
+    hipblasAbftReport_t report{};
+    EXPECT_EQ(hipblasSgemm(handle, N, N, 64, 64, 64, &alpha, A, 64, A, 64, &beta, C, 64),
+              HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasGetAbftReport(handle, &report), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(report.calls, 0u);
+
+    EXPECT_EQ(hipblasSetAbftMode(handle, HIPBLAS_ABFT_DETECT), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasSgemm(handle, N, N, 64, 64, 64, &alpha, A, 64, A, 64, &beta, C, 64),
+              HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasGetAbftReport(handle, &report), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(report.calls, 1u);
+    EXPECT_EQ(report.tiles, 1u);
+    EXPECT_EQ(hipblasResetAbftReport(handle), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasGetAbftReport(handle, &report), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(report.calls, 0u);
+    EXPECT_EQ(report.tiles, 0u);
+
+    EXPECT_EQ(hipblas_client_destroy(handle), HIPBLAS_STATUS_SUCCESS);
+}
+
+TEST(hipblas_gemm_abft, bad_arg)
+{
+    hipblasHandle_t handle;
+    ASSERT_EQ(hipblas_client_create(&handle), HIPBLAS_STATUS_SUCCESS);
+
+    hipblasAbftMode_t   mode;
+    hipblasAbftReport_t report;
+    EXPECT_EQ(hipblasSetAbftMode(nullptr, HIPBLAS_ABFT_DETECT), HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_EQ(hipblasGetAbftMode(nullptr, &mode), HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_EQ(hipblasGetAbftReport(nullptr, &report), HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_EQ(hipblasResetAbftReport(nullptr), HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_EQ(hipblasSetAbftMode(handle, hipblasAbftMode_t(3)), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasGetAbftMode(handle, nullptr), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasGetAbftReport(handle, nullptr), HIPBLAS_STATUS_INVALID_VALUE);
+
+    // Argument errors still come from the backend
+    EXPECT_EQ(hipblasSetAbftMode(handle, HIPBLAS_ABFT_CORRECT), HIPBLAS_STATUS_SUCCESS);
+    device_vector<float> A(16);
+    float                alpha = 1, beta = 0;
+    EXPECT_EQ(
+        hipblasSgemm(handle, HIPBLAS_OP_N, HIPBLAS_OP_N, 4, 4, 4, &alpha, A, 3, A, 4, &beta, A, 4),
+        HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_EQ(hipblas_client_destroy(handle), HIPBLAS_STATUS_SUCCESS);
+}
@@ -0,0 +1,166 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_gemm_autotune.hpp"
+#include "utility.h"
+#include <cstdio>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <math.h>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+/* =====================================================================
+     BLAS gemm_ex online tuning:
+=================================================================== */
+
+typedef std::tuple<vector<int>, vector<int>, char> gemm_autotune_tuple;
+
+// {M, N, K}: square problems as the tuner keys them, and one of odd sizes
+const vector<vector<int>> matrix_size_range
+    = {{-1, 4, 4}, {48, 48, 48}, {40, 40, 40}, {33, 17, 65}};
+
+// {trials, calls}: tuning to the end, partway, and off
+const vector<vector<int>> tune_range = {{6, 10}, {2, 6}, {0, 3}};
+
+const vector<char> transA_range = {'N', 'T'};
+
+Arguments setup_gemm_autotune_arguments(gemm_autotune_tuple tup)
+{
+    vector<int> matrix_size = std::get<0>(tup);
+    vector<int> tune        = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.M             = matrix_size[0];
+    arg.N             = matrix_size[1];
+    arg.K             = matrix_size[2];
+    arg.autotune      = tune[0];
+    arg.apiCallCount  = tune[1];
+    arg.transA_option = std::get<2>(tup);
+
+    arg.lda = max(1, arg.transA_option == 'N' ? arg.M : arg.K);
+    arg.ldb = max(1, arg.K);
+    arg.ldc = max(1, arg.M);
+
+    // small integers, so every candidate gives the exact product
+    arg.alpha = 1;
+    arg.beta  = 0;
+
+    return arg;
+}
+
+// the tester rejects invalid sizes before the call
+static void check_gemm_autotune_status(const Arguments& arg, hipblasStatus_t status)
+{
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.M < 0 || arg.N < 0 || arg.K < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+        }
+    }
+}
+
+class gemm_autotune_gtest : public ::TestWithParam<gemm_autotune_tuple>
+{
+protected:
+    gemm_autotune_gtest() {}
+    virtual ~gemm_autotune_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_P(gemm_autotune_gtest, gemm_autotune_float)
+{
+    // GetParam returns a tuple. The setup routine unpacks the tuple
+    // and initializes arg(Arguments), which will be passed to testing routine.
+
+    Arguments arg = setup_gemm_autotune_arguments(GetParam());
+
+    check_gemm_autotune_status(arg, testing_gemm_autotune<float>(arg));
+}
+
+TEST_P(gemm_autotune_gtest, gemm_autotune_double)
+{
+    Arguments arg = setup_gemm_autotune_arguments(GetParam());
+
+    check_gemm_autotune_status(arg, testing_gemm_autotune<double>(arg));
+}
+
+// The combinations are  { {M, N, K}, {trials, calls}, transA }
+
+INSTANTIATE_TEST_CASE_P(hipblasGemmAutotune,
+                        gemm_autotune_gtest,
+                        Combine(ValuesIn(matrix_size_range),
+                                ValuesIn(tune_range),
+                                ValuesIn(transA_range)));
+
+TEST(hipblas_gemm_autotune, set_get)
+{
+    hipblasHandle_t handle;
+    ASSERT_EQ(hipblas_client_create(&handle), HIPBLAS_STATUS_SUCCESS);
+
+    int trials = -1;
+    EXPECT_EQ(hipblasGetGemmAutotune(handle, &trials), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(0, trials);
+    EXPECT_EQ(hipblasSetGemmAutotune(handle, 16), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasGetGemmAutotune(handle, &trials), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(16, trials);
+
+    EXPECT_EQ(hipblas_client_destroy(handle), HIPBLAS_STATUS_SUCCESS);
+}
+
+// Each call copies C back, so the timed trials have been read by the next call. A candidate the
+// backend rejects costs a call without counting, so there are calls to spare
+TEST(hipblas_gemm_autotune, save)
+{
+    Arguments arg = setup_gemm_autotune_arguments(
+        gemm_autotune_tuple(vector<int>{56, 56, 56}, vector<int>{4, 72}, 'N'));
+    ASSERT_EQ(testing_gemm_autotune<float>(arg), HIPBLAS_STATUS_SUCCESS);
+
+    string path = string(testing::TempDir()) + "hipblas_autotune.csv";
+    ASSERT_EQ(hipblasSaveGemmAutotune(path.c_str()), HIPBLAS_STATUS_SUCCESS);
+
+    stringstream contents;
+    contents << ifstream(path).rdbuf();
+    EXPECT_NE(string::npos, contents.str().find("\nN,N,56,56,56,f32_r,f32_r,f32_r,f32_r,"));
+
+    // the saved choices load as a tuning table
+    hipblasHandle_t handle;
+    ASSERT_EQ(hipblas_client_create(&handle), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasSetGemmTuningFile(handle, path.c_str()), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblas_client_destroy(handle), HIPBLAS_STATUS_SUCCESS);
+    remove(path.c_str());
+}
+
+TEST(hipblas_gemm_autotune, bad_arg)
+{
+    hipblasHandle_t handle;
+    ASSERT_EQ(hipblas_client_create(&handle), HIPBLAS_STATUS_SUCCESS);
+
+    int trials;
+    EXPECT_EQ(hipblasSetGemmAutotune(handle, -1), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasGetGemmAutotune(handle, nullptr), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasSetGemmAutotune(nullptr, 4), HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_EQ(hipblasGetGemmAutotune(nullptr, &trials), HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_EQ(hipblasSaveGemmAutotune(nullptr), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasSaveGemmAutotune("/nonexistent/hipblas_autotune.csv"),
+              HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_EQ(hipblas_client_destroy(handle), HIPBLAS_STATUS_SUCCESS);
+}
@@ -0,0 +1,238 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_gemm_batch_reduce.hpp"
+#include "testing_gemm_strided_batch_reduce.hpp"
+#include "utility.h"
+#include <gtest/gtest.h>
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+/* =====================================================================
+     BLAS gemm with the batches reduced into one C:
+=================================================================== */
+
+typedef std::tuple<vector<int>, vector<char>, int, vector<double>> gemm_batch_reduce_tuple;
+typedef std::tuple<vector<int>, vector<char>, int, vector<double>, double>
+    gemm_strided_batch_reduce_tuple;
+
+// {M, N, K}: square and odd sizes, a k deeper than a tile, and K 0, which only scales C by beta
+const vector<vector<int>> matrix_size_range
+    = {{-1, 4, 4}, {24, 20, 8}, {33, 17, 37}, {16, 16, 16}, {12, 10, 0}};
+
+// {transA, transB}
+const vector<vector<char>> transpose_range = {{'N', 'N'}, {'N', 'T'}, {'T', 'N'}, {'T', 'T'}};
+
+// no batches scales C by beta too
+const vector<int> batch_count_range = {-1, 0, 5};
+
+// {alpha, beta}
+const vector<vector<double>> alpha_beta_range = {{2.0, -1.0}, {1.0, 0.0}};
+
+// 1 lays the batches one after another along k, 1.5 leaves room between them
+const vector<double> stride_scale_range = {1.0, 1.5};
+
+Arguments setup_gemm_batch_reduce_arguments(gemm_batch_reduce_tuple tup)
+{
+    vector<int>    matrix_size = std::get<0>(tup);
+    vector<char>   transpose   = std::get<1>(tup);
+    vector<double> alpha_beta  = std::get<3>(tup);
+
+    Arguments arg;
+
+    arg.M             = matrix_size[0];
+    arg.N             = matrix_size[1];
+    arg.K             = matrix_size[2];
+    arg.transA_option = transpose[0];
+    arg.transB_option = transpose[1];
+    arg.batch_count   = std::get<2>(tup);
+    arg.alpha         = alpha_beta[0];
+    arg.beta          = alpha_beta[1];
+
+    // padded operands, and a C whose extra rows must keep their values
+    arg.lda = max(1, (arg.transA_option == 'N' ? arg.M : arg.K) + 1);
+    arg.ldb = max(1, (arg.transB_option == 'N' ? arg.K : arg.N) + 1);
+    arg.ldc = max(1, arg.M + 2);
+
+    return arg;
+}
+
+Arguments setup_gemm_strided_batch_reduce_arguments(gemm_strided_batch_reduce_tuple tup)
+{
+    Arguments arg = setup_gemm_batch_reduce_arguments(gemm_batch_reduce_tuple(
+        std::get<0>(tup), std::get<1>(tup), std::get<2>(tup), std::get<3>(tup)));
+
+    arg.stride_scale = std::get<4>(tup);
+
+    // the k rows of all the batches of a transposed A or plain B are the rows of one matrix, so
+    // with a stride_scale of 1 the batches make one matrix k * batch_count deep
+    int batches = max(1, arg.batch_count);
+    int k_span  = int(arg.stride_scale * arg.K) * (batches - 1) + arg.K;
+
+    arg.lda = max(1, arg.transA_option == 'N' ? arg.M : k_span);
+    arg.ldb = max(1, arg.transB_option == 'N' ? k_span : arg.N);
+
+    return arg;
+}
+
+// the testers reject invalid sizes before the call
+static void check_gemm_batch_reduce_status(const Arguments& arg, hipblasStatus_t status)
+{
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.M < 0 || arg.N < 0 || arg.K < 0 || arg.batch_count < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+        }
+    }
+}
+
+class gemm_batch_reduce_gtest : public ::TestWithParam<gemm_batch_reduce_tuple>
+{
+protected:
+    gemm_batch_reduce_gtest() {}
+    virtual ~gemm_batch_reduce_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_P(gemm_batch_reduce_gtest, gemm_batch_reduce_float)
+{
+    // GetParam returns a tuple. The setup routine unpacks the tuple
+    // and initializes arg(Arguments), which will be passed to testing routine.
+
+    Arguments arg = setup_gemm_batch_reduce_arguments(GetParam());
+
+    check_gemm_batch_reduce_status(arg, testing_gemm_batch_reduce<float>(arg));
+}
+
+TEST_P(gemm_batch_reduce_gtest, gemm_batch_reduce_double_complex)
+{
+    Arguments arg = setup_gemm_batch_reduce_arguments(GetParam());
+
+    check_gemm_batch_reduce_status(arg, testing_gemm_batch_reduce<hipblasDoubleComplex>(arg));
+}
+
+class gemm_strided_batch_reduce_gtest : public ::TestWithParam<gemm_strided_batch_reduce_tuple>
+{
+protected:
+    gemm_strided_batch_reduce_gtest() {}
+    virtual ~gemm_strided_batch_reduce_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_P(gemm_strided_batch_reduce_gtest, gemm_strided_batch_reduce_float)
+{
+    Arguments arg = setup_gemm_strided_batch_reduce_arguments(GetParam());
+
+    check_gemm_batch_reduce_status(arg, testing_gemm_strided_batch_reduce<float>(arg));
+}
+
+TEST_P(gemm_strided_batch_reduce_gtest, gemm_strided_batch_reduce_double)
+{
+    Arguments arg = setup_gemm_strided_batch_reduce_arguments(GetParam());
+
+    check_gemm_batch_reduce_status(arg, testing_gemm_strided_batch_reduce<double>(arg));
+}
+
+TEST_P(gemm_strided_batch_reduce_gtest, gemm_strided_batch_reduce_float_complex)
+{
+    Arguments arg = setup_gemm_strided_batch_reduce_arguments(GetParam());
+
+    check_gemm_batch_reduce_status(arg, testing_gemm_strided_batch_reduce<hipblasComplex>(arg));
+}
+
+// The combinations are  { {M, N, K}, {transA, transB}, batch_count, {alpha, beta} } and
+// { {M, N, K}, {transA, transB}, batch_count, {alpha, beta}, stride_scale }
+
+INSTANTIATE_TEST_CASE_P(hipblasGemmBatchReduce,
+                        gemm_batch_reduce_gtest,
+                        Combine(ValuesIn(matrix_size_range),
+                                ValuesIn(transpose_range),
+                                ValuesIn(batch_count_range),
+                                ValuesIn(alpha_beta_range)));
+
+INSTANTIATE_TEST_CASE_P(hipblasGemmStridedBatchReduce,
+                        gemm_strided_batch_reduce_gtest,
+                        Combine(ValuesIn(matrix_size_range),
+                                ValuesIn(transpose_range),
+                                ValuesIn(batch_count_range),
+                                ValuesIn(alpha_beta_range),
+                                ValuesIn(stride_scale_range)));
+
+TEST(hipblas_gemm_batch_reduce, bad_arg)
+{
+    hipblasHandle_t handle;
+    ASSERT_EQ(hipblas_client_create(&handle), HIPBLAS_STATUS_SUCCESS);
+
+    float alpha = 1, beta = 0;
+
+    device_vector<float> dA(16);
+    device_vector<float> dC(16);
+
+    auto call = [&](hipblasHandle_t    h,
+                    hipblasOperation_t trans,
+                    int                m,
+                    int                lda,
+                    const float*       A,
+                    float*             C,
+                    int                batch_count) {
+        return hipblasSgemmStridedBatchReduce(h,
+                                              trans,
+                                              HIPBLAS_OP_N,
+                                              m,
+                                              4,
+                                              4,
+                                              &alpha,
+                                              A,
+                                              lda,
+                                              16,
+                                              A,
+                                              4,
+                                              16,
+                                              &beta,
+                                              C,
+                                              4,
+                                              batch_count);
+    };
+    EXPECT_EQ(call(nullptr, HIPBLAS_OP_N, 4, 4, dA, dC, 1), HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_EQ(call(handle, hipblasOperation_t(-1), 4, 4, dA, dC, 1), HIPBLAS_STATUS_INVALID_ENUM);
+    EXPECT_EQ(call(handle, HIPBLAS_OP_N, -1, 4, dA, dC, 1), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(call(handle, HIPBLAS_OP_N, 4, 3, dA, dC, 1), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(call(handle, HIPBLAS_OP_N, 4, 4, dA, dC, -1), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(call(handle, HIPBLAS_OP_N, 4, 4, nullptr, dC, 1), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(call(handle, HIPBLAS_OP_N, 4, 4, dA, nullptr, 1), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(call(handle, HIPBLAS_OP_N, 0, 4, nullptr, nullptr, 1), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasSgemmBatchReduce(handle,
+                                      HIPBLAS_OP_N,
+                                      HIPBLAS_OP_N,
+                                      4,
+                                      4,
+                                      4,
+                                      &alpha,
+                                      nullptr,
+                                      4,
+                                      nullptr,
+                                      4,
+                                      &beta,
+                                      dC,
+                                      4,
+                                      2),
+              HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_EQ(hipblas_client_destroy(handle), HIPBLAS_STATUS_SUCCESS);
+}
@@ -4,6 +4,7 @@
  * ************************************************************************ */
 
 #include "testing_gemm_batched.hpp"
+#include "testing_gemm_grouped_batched.hpp"
 #include "utility.h"
 #include <gtest/gtest.h>
 #include <math.h>
@@ -294,6 +295,46 @@ TEST_P(gemm_batched_gtest, hipblasDoubleComplex)
     }
 }
 
+TEST_P(gemm_batched_gtest, grouped_float)
+{
+    Arguments arg = setup_gemm_batched_arguments(GetParam());
+
+    hipblasStatus_t status = testing_gemm_grouped_batched<float>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.M < 0 || arg.N < 0 || arg.K < 0 || arg.batch_count < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
+
+TEST_P(gemm_batched_gtest, grouped_double)
+{
+    Arguments arg = setup_gemm_batched_arguments(GetParam());
+
+    hipblasStatus_t status = testing_gemm_grouped_batched<double>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.M < 0 || arg.N < 0 || arg.K < 0 || arg.batch_count < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
+
 // notice we are using vector of vector
 // so each elment in xxx_range is a avector,
 // ValuesIn take each element (a vector) and combine them and feed them to test_p
@@ -199,6 +199,12 @@ const vector<vector<hipblasDatatype_t>> precision_double = {{ HIPBLAS_R_64F,
                                                               HIPBLAS_R_64F,
                                                               HIPBLAS_R_64F  }};
 
+const vector<vector<hipblasDatatype_t>> precision_int8 = {{ HIPBLAS_R_8I,
+                                                            HIPBLAS_R_8I,
+                                                            HIPBLAS_R_32I,
+                                                            HIPBLAS_R_32I,
+                                                            HIPBLAS_R_32I  }};
+
 const vector<vector<hipblasDatatype_t>> precision_type_range = {{HIPBLAS_R_16F,
                                                                  HIPBLAS_R_16F,
                                                                  HIPBLAS_R_16F,
@@ -399,6 +405,13 @@ INSTANTIATE_TEST_CASE_P(quick_blas_ex_small_double,
                                 ValuesIn(alpha_beta_range),
                                 ValuesIn(transA_transB_range),
                                 ValuesIn(precision_double)));
+
+INSTANTIATE_TEST_CASE_P(quick_blas_ex_small_int8,
+                        parameterized_gemm_ex,
+                        Combine(ValuesIn(small_matrix_size_range),
+                                ValuesIn(alpha_beta_range),
+                                ValuesIn(transA_transB_range),
+                                ValuesIn(precision_int8)));
 //----medium
 INSTANTIATE_TEST_CASE_P(pre_checkin_blas_ex_medium_hpa_half,
                         parameterized_gemm_ex,
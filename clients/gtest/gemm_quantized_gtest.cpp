@@ -0,0 +1,252 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_gemm_quantized.hpp"
+#include "testing_gemm_quantized_strided_batched.hpp"
+#include "utility.h"
+#include <gtest/gtest.h>
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+/* =====================================================================
+     BLAS weight-only quantized gemm:
+=================================================================== */
+
+typedef std::tuple<vector<int>, char, vector<int>> gemm_quantized_tuple;
+typedef std::tuple<vector<int>, char, vector<int>, double, int> gemm_quantized_batched_tuple;
+
+// {M, N, K}: decode-sized M against a K that neither the 64-deep tile nor the groups divide
+const vector<vector<int>> matrix_size_range
+    = {{-1, 4, 64}, {1, 37, 150}, {5, 40, 150}, {17, 19, 64}, {4, 33, 130}, {3, 20, 96}};
+
+const vector<vector<int>> batched_matrix_size_range = {{-1, 4, 64}, {2, 24, 70}, {9, 16, 128}};
+
+const vector<char> transA_range = {'N', 'T'};
+
+// {hipblasWeightFormat_t, group_size}; a group_size of k gives one scale per column
+const vector<vector<int>> quant_range = {{HIPBLAS_WEIGHT_INT4, 32},
+                                         {HIPBLAS_WEIGHT_UINT4, 32},
+                                         {HIPBLAS_WEIGHT_INT4, 64},
+                                         {HIPBLAS_WEIGHT_INT8, 130},
+                                         {HIPBLAS_WEIGHT_UINT8, 16}};
+
+// 1.5 leaves room between the batches of A and C, which must keep its values
+const vector<double> stride_scale_range = {1.0, 1.5};
+
+const vector<int> batch_count_range = {-1, 0, 1, 3};
+
+Arguments setup_gemm_quantized_arguments(gemm_quantized_tuple tup)
+{
+    vector<int> matrix_size = std::get<0>(tup);
+    vector<int> quant       = std::get<2>(tup);
+
+    Arguments arg;
+
+    arg.M             = matrix_size[0];
+    arg.N             = matrix_size[1];
+    arg.K             = matrix_size[2];
+    arg.transA_option = std::get<1>(tup);
+    arg.algo          = quant[0];
+    arg.group_size    = quant[1];
+
+    // A as op(A) needs it, an even ldb for the 4-bit formats and a padded C
+    arg.lda = max(1, arg.transA_option == 'N' ? arg.M : arg.K);
+    arg.ldb = max(2, (arg.K + 1) & ~1);
+    arg.ldc = max(1, arg.M + 1);
+
+    // small integers, so the results are exact
+    arg.alpha = 2;
+    arg.beta  = -1;
+
+    return arg;
+}
+
+Arguments setup_gemm_quantized_batched_arguments(gemm_quantized_batched_tuple tup)
+{
+    Arguments arg = setup_gemm_quantized_arguments(
+        gemm_quantized_tuple(std::get<0>(tup), std::get<1>(tup), std::get<2>(tup)));
+
+    arg.stride_scale = std::get<3>(tup);
+    arg.batch_count  = std::get<4>(tup);
+
+    return arg;
+}
+
+// the testers reject invalid sizes before the call
+static void check_gemm_quantized_status(const Arguments& arg, hipblasStatus_t status)
+{
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.M < 0 || arg.N < 0 || arg.K < 0 || arg.batch_count < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+        }
+    }
+}
+
+class gemm_quantized_gtest : public ::TestWithParam<gemm_quantized_tuple>
+{
+protected:
+    gemm_quantized_gtest() {}
+    virtual ~gemm_quantized_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_P(gemm_quantized_gtest, gemm_quantized_half)
+{
+    // GetParam returns a tuple. The setup routine unpacks the tuple
+    // and initializes arg(Arguments), which will be passed to testing routine.
+
+    Arguments arg = setup_gemm_quantized_arguments(GetParam());
+
+    check_gemm_quantized_status(arg, testing_gemm_quantized<hipblasHalf>(arg));
+}
+
+TEST_P(gemm_quantized_gtest, gemm_quantized_bf16)
+{
+    Arguments arg = setup_gemm_quantized_arguments(GetParam());
+
+    check_gemm_quantized_status(arg, testing_gemm_quantized<hipblasBfloat16>(arg));
+}
+
+TEST_P(gemm_quantized_gtest, gemm_quantized_float)
+{
+    Arguments arg = setup_gemm_quantized_arguments(GetParam());
+
+    check_gemm_quantized_status(arg, testing_gemm_quantized<float>(arg));
+}
+
+class gemm_quantized_batched_gtest : public ::TestWithParam<gemm_quantized_batched_tuple>
+{
+protected:
+    gemm_quantized_batched_gtest() {}
+    virtual ~gemm_quantized_batched_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_P(gemm_quantized_batched_gtest, gemm_quantized_strided_batched_half)
+{
+    Arguments arg = setup_gemm_quantized_batched_arguments(GetParam());
+
+    check_gemm_quantized_status(arg, testing_gemm_quantized_strided_batched<hipblasHalf>(arg));
+}
+
+TEST_P(gemm_quantized_batched_gtest, gemm_quantized_strided_batched_float)
+{
+    Arguments arg = setup_gemm_quantized_batched_arguments(GetParam());
+
+    check_gemm_quantized_status(arg, testing_gemm_quantized_strided_batched<float>(arg));
+}
+
+// The combinations are  { {M, N, K}, transA, {format, group_size} } and
+// { {M, N, K}, transA, {format, group_size}, stride_scale, batch_count }
+
+INSTANTIATE_TEST_CASE_P(hipblasGemmQuantized,
+                        gemm_quantized_gtest,
+                        Combine(ValuesIn(matrix_size_range),
+                                ValuesIn(transA_range),
+                                ValuesIn(quant_range)));
+
+INSTANTIATE_TEST_CASE_P(hipblasGemmQuantized_batched,
+                        gemm_quantized_batched_gtest,
+                        Combine(ValuesIn(batched_matrix_size_range),
+                                ValuesIn(transA_range),
+                                ValuesIn(quant_range),
+                                ValuesIn(stride_scale_range),
+                                ValuesIn(batch_count_range)));
+
+TEST(hipblas_gemm_quantized, bad_arg)
+{
+    hipblasHandle_t handle;
+    ASSERT_EQ(hipblas_client_create(&handle), HIPBLAS_STATUS_SUCCESS);
+
+    float                       alpha = 1, beta = 0;
+    void*                       p     = &alpha;
+    hipblasWeightQuantization_t quant = {HIPBLAS_WEIGHT_INT4, 32, p, nullptr, HIPBLAS_R_16F, 2};
+
+    auto call = [&](hipblasHandle_t    h,
+                    hipblasOperation_t trans_a,
+                    int                k,
+                    int                ldb,
+                    hipblasDatatype_t  a_type,
+                    hipblasDatatype_t  c_type) {
+        return hipblasGemmQuantizedEx(h,
+                                      trans_a,
+                                      4,
+                                      4,
+                                      k,
+                                      &alpha,
+                                      p,
+                                      a_type,
+                                      64,
+                                      p,
+                                      ldb,
+                                      &quant,
+                                      &beta,
+                                      p,
+                                      c_type,
+                                      4,
+                                      HIPBLAS_R_32F);
+    };
+
+    EXPECT_EQ(call(nullptr, HIPBLAS_OP_N, 64, 64, HIPBLAS_R_16F, HIPBLAS_R_16F),
+              HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_EQ(call(handle, hipblasOperation_t(-1), 64, 64, HIPBLAS_R_16F, HIPBLAS_R_16F),
+              HIPBLAS_STATUS_INVALID_ENUM);
+
+    // An odd ldb splits a 4-bit column across a byte; two groups do not cover k = 65
+    EXPECT_EQ(call(handle, HIPBLAS_OP_N, 63, 63, HIPBLAS_R_16F, HIPBLAS_R_16F),
+              HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(call(handle, HIPBLAS_OP_N, 65, 66, HIPBLAS_R_16B, HIPBLAS_R_32F),
+              HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(call(handle, HIPBLAS_OP_N, 64, 32, HIPBLAS_R_16F, HIPBLAS_R_16F),
+              HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_EQ(call(handle, HIPBLAS_OP_N, 64, 64, HIPBLAS_R_64F, HIPBLAS_R_64F),
+              HIPBLAS_STATUS_NOT_SUPPORTED);
+    EXPECT_EQ(call(handle, HIPBLAS_OP_N, 64, 64, HIPBLAS_R_16F, HIPBLAS_R_16B),
+              HIPBLAS_STATUS_NOT_SUPPORTED);
+    quant.scale_type = HIPBLAS_R_16B;
+    EXPECT_EQ(call(handle, HIPBLAS_OP_N, 64, 64, HIPBLAS_R_16F, HIPBLAS_R_16F),
+              HIPBLAS_STATUS_NOT_SUPPORTED);
+    quant.scale_type = HIPBLAS_R_16F;
+    quant.group_size = 0;
+    EXPECT_EQ(call(handle, HIPBLAS_OP_N, 64, 64, HIPBLAS_R_16F, HIPBLAS_R_16F),
+              HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_EQ(hipblasGemmQuantizedEx(handle,
+                                     HIPBLAS_OP_N,
+                                     4,
+                                     4,
+                                     64,
+                                     &alpha,
+                                     p,
+                                     HIPBLAS_R_16F,
+                                     4,
+                                     p,
+                                     64,
+                                     nullptr,
+                                     &beta,
+                                     p,
+                                     HIPBLAS_R_16F,
+                                     4,
+                                     HIPBLAS_R_32F),
+              HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_EQ(hipblas_client_destroy(handle), HIPBLAS_STATUS_SUCCESS);
+}
@@ -0,0 +1,124 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_gemm_requant.hpp"
+#include "utility.h"
+#include <gtest/gtest.h>
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+/* =====================================================================
+     BLAS int8 gemm with fused requantization:
+=================================================================== */
+
+typedef std::tuple<vector<int>, char, char, int> gemm_requant_tuple;
+
+// {M, N, K}: K that the 64-deep tile does not divide, and M or N of 1
+const vector<vector<int>> matrix_size_range
+    = {{-1, 4, 64}, {17, 19, 64}, {5, 40, 200}, {33, 3, 65}, {8, 24, 130}, {1, 37, 96}};
+
+const vector<char> transA_range = {'N', 'T'};
+const vector<char> transB_range = {'N', 'T'};
+
+const vector<int> mode_range
+    = {HIPBLAS_REQUANT_PER_TENSOR, HIPBLAS_REQUANT_PER_ROW, HIPBLAS_REQUANT_PER_COLUMN};
+
+Arguments setup_gemm_requant_arguments(gemm_requant_tuple tup)
+{
+    vector<int> matrix_size = std::get<0>(tup);
+
+    Arguments arg;
+
+    arg.M             = matrix_size[0];
+    arg.N             = matrix_size[1];
+    arg.K             = matrix_size[2];
+    arg.transA_option = std::get<1>(tup);
+    arg.transB_option = std::get<2>(tup);
+    arg.algo          = std::get<3>(tup);
+
+    // A and B as op(A) and op(B) need them, and a padded C
+    arg.lda = max(1, arg.transA_option == 'N' ? arg.M : arg.K);
+    arg.ldb = max(1, arg.transB_option == 'N' ? arg.K : arg.N);
+    arg.ldc = max(1, arg.M + 1);
+
+    return arg;
+}
+
+// the tester rejects invalid sizes before the call
+static void check_gemm_requant_status(const Arguments& arg, hipblasStatus_t status)
+{
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.M < 0 || arg.N < 0 || arg.K < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+        }
+    }
+}
+
+class gemm_requant_gtest : public ::TestWithParam<gemm_requant_tuple>
+{
+protected:
+    gemm_requant_gtest() {}
+    virtual ~gemm_requant_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_P(gemm_requant_gtest, gemm_requant_int8)
+{
+    // GetParam returns a tuple. The setup routine unpacks the tuple
+    // and initializes arg(Arguments), which will be passed to testing routine.
+
+    Arguments arg = setup_gemm_requant_arguments(GetParam());
+
+    check_gemm_requant_status(arg, testing_gemm_requant(arg));
+}
+
+// The combinations are  { {M, N, K}, transA, transB, mode }
+
+INSTANTIATE_TEST_CASE_P(hipblasGemmRequant,
+                        gemm_requant_gtest,
+                        Combine(ValuesIn(matrix_size_range),
+                                ValuesIn(transA_range),
+                                ValuesIn(transB_range),
+                                ValuesIn(mode_range)));
+
+TEST(hipblas_gemm_requant, bad_arg)
+{
+    hipblasHandle_t handle;
+    ASSERT_EQ(hipblas_client_create(&handle), HIPBLAS_STATUS_SUCCESS);
+
+    float                   scale   = 1;
+    void*                   p       = &scale;
+    hipblasRequantization_t requant = {HIPBLAS_REQUANT_PER_ROW, &scale, nullptr, 0};
+
+    auto call = [&](hipblasHandle_t h, int lda, const hipblasRequantization_t* r) {
+        return hipblasGemmExWithRequantization(
+            h, HIPBLAS_OP_N, HIPBLAS_OP_N, 4, 4, 4, p, lda, p, 4, p, 4, r);
+    };
+
+    EXPECT_EQ(call(nullptr, 4, &requant), HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_EQ(call(handle, 4, nullptr), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(call(handle, 3, &requant), HIPBLAS_STATUS_INVALID_VALUE);
+    requant.mode = hipblasRequantMode_t(7);
+    EXPECT_EQ(call(handle, 4, &requant), HIPBLAS_STATUS_INVALID_ENUM);
+    requant.mode  = HIPBLAS_REQUANT_PER_TENSOR;
+    requant.scale = nullptr;
+    EXPECT_EQ(call(handle, 4, &requant), HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_EQ(hipblas_client_destroy(handle), HIPBLAS_STATUS_SUCCESS);
+}
@@ -0,0 +1,157 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_gemm_strassen.hpp"
+#include "utility.h"
+#include <gtest/gtest.h>
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+/* =====================================================================
+     BLAS gemm through Strassen-Winograd recursion:
+=================================================================== */
+
+typedef std::tuple<vector<int>, vector<char>, int, double> gemm_strassen_tuple;
+
+// {M, N, K}: even sizes, odd ones that peel off a row, a column and a rank-1 term at each level,
+// and an n below the cutoff, which runs the plain gemm and takes no workspace
+const vector<vector<int>> matrix_size_range
+    = {{-1, 4, 4}, {64, 48, 32}, {131, 97, 75}, {65, 66, 67}, {40, 41, 42}, {64, 15, 64}};
+
+// {transA, transB}
+const vector<vector<char>> transpose_range = {{'N', 'N'}, {'N', 'T'}, {'T', 'N'}, {'T', 'T'}};
+
+// the levels of recursion
+const vector<int> levels_range = {1, 2};
+
+// beta 0 starts C as NaN, which must not be read
+const vector<double> beta_range = {-1.0, 0.0};
+
+Arguments setup_gemm_strassen_arguments(gemm_strassen_tuple tup)
+{
+    vector<int>  matrix_size = std::get<0>(tup);
+    vector<char> transpose   = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.M               = matrix_size[0];
+    arg.N               = matrix_size[1];
+    arg.K               = matrix_size[2];
+    arg.transA_option   = transpose[0];
+    arg.transB_option   = transpose[1];
+    arg.strassen_levels = std::get<2>(tup);
+    arg.beta            = std::get<3>(tup);
+    arg.alpha           = 2;
+
+    // a cutoff the sizes above recurse past
+    arg.strassen_cutoff = 16;
+
+    // padded operands, and a C whose extra rows must keep their values
+    arg.lda = max(1, (arg.transA_option == 'N' ? arg.M : arg.K) + 1);
+    arg.ldb = max(1, (arg.transB_option == 'N' ? arg.K : arg.N) + 2);
+    arg.ldc = max(1, arg.M + 3);
+
+    return arg;
+}
+
+// the tester rejects invalid sizes before the call
+static void check_gemm_strassen_status(const Arguments& arg, hipblasStatus_t status)
+{
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.M < 0 || arg.N < 0 || arg.K < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+        }
+    }
+}
+
+class gemm_strassen_gtest : public ::TestWithParam<gemm_strassen_tuple>
+{
+protected:
+    gemm_strassen_gtest() {}
+    virtual ~gemm_strassen_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_P(gemm_strassen_gtest, gemm_strassen_float)
+{
+    // GetParam returns a tuple. The setup routine unpacks the tuple
+    // and initializes arg(Arguments), which will be passed to testing routine.
+
+    Arguments arg = setup_gemm_strassen_arguments(GetParam());
+
+    check_gemm_strassen_status(arg, testing_gemm_strassen<float>(arg));
+}
+
+TEST_P(gemm_strassen_gtest, gemm_strassen_double)
+{
+    Arguments arg = setup_gemm_strassen_arguments(GetParam());
+
+    check_gemm_strassen_status(arg, testing_gemm_strassen<double>(arg));
+}
+
+// The combinations are  { {M, N, K}, {transA, transB}, levels, beta }
+
+INSTANTIATE_TEST_CASE_P(hipblasGemmStrassen,
+                        gemm_strassen_gtest,
+                        Combine(ValuesIn(matrix_size_range),
+                                ValuesIn(transpose_range),
+                                ValuesIn(levels_range),
+                                ValuesIn(beta_range)));
+
+TEST(hipblas_gemm_strassen, set_get)
+{
+    hipblasHandle_t handle;
+    ASSERT_EQ(hipblas_client_create(&handle), HIPBLAS_STATUS_SUCCESS);
+
+    int levels = -1, cutoff = -1;
+    EXPECT_EQ(hipblasGetGemmStrassen(handle, &levels, &cutoff), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(0, levels);
+    EXPECT_EQ(0, cutoff);
+    EXPECT_EQ(hipblasSetGemmStrassen(handle, 2, 4096), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasGetGemmStrassen(handle, &levels, &cutoff), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(2, levels);
+    EXPECT_EQ(4096, cutoff);
+
+    EXPECT_EQ(hipblas_client_destroy(handle), HIPBLAS_STATUS_SUCCESS);
+}
+
+TEST(hipblas_gemm_strassen, bad_arg)
+{
+    hipblasHandle_t handle;
+    ASSERT_EQ(hipblas_client_create(&handle), HIPBLAS_STATUS_SUCCESS);
+
+    int levels, cutoff;
+    EXPECT_EQ(hipblasSetGemmStrassen(nullptr, 1, 0), HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_EQ(hipblasGetGemmStrassen(nullptr, &levels, &cutoff), HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_EQ(hipblasSetGemmStrassen(handle, -1, 0), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasSetGemmStrassen(handle, 3, 0), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasSetGemmStrassen(handle, 1, -1), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasGetGemmStrassen(handle, nullptr, &cutoff), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasGetGemmStrassen(handle, &levels, nullptr), HIPBLAS_STATUS_INVALID_VALUE);
+
+    // Argument errors still come from the backend
+    EXPECT_EQ(hipblasSetGemmStrassen(handle, 1, 2), HIPBLAS_STATUS_SUCCESS);
+    device_vector<float> A(16);
+    float                alpha = 1, beta = 0;
+    EXPECT_EQ(
+        hipblasSgemm(handle, HIPBLAS_OP_N, HIPBLAS_OP_N, 4, 4, 4, &alpha, A, 3, A, 4, &beta, A, 4),
+        HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_EQ(hipblas_client_destroy(handle), HIPBLAS_STATUS_SUCCESS);
+}
@@ -0,0 +1,116 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include <cstdio>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <hip/hip_runtime_api.h>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+/* =====================================================================
+     BLAS gemm_ex tuning file:
+=================================================================== */
+
+static string write_tuning_file(const char* name, const char* contents)
+{
+    string path = string(testing::TempDir()) + name;
+    ofstream(path) << contents;
+    return path;
+}
+
+TEST(hipblas_gemm_tuning, hipblas_set_gemm_tuning_file)
+{
+    hipblasHandle_t handle;
+    hipblasCreate(&handle);
+
+    string good = write_tuning_file("hipblas_tuning_good.csv",
+                                    "# transA,transB,m,n,k,a_type,b_type,c_type,compute_type,"
+                                    "algo,solution_index\n"
+                                    "N,T,64,32,16,f16_r,f16_r,f16_r,f32_r,default,12\n"
+                                    "t,n,8,8,8,f64_r,f64_r,f64_r,f64_r,algo3_tensor_op,0 # x\n");
+    string bad  = write_tuning_file("hipblas_tuning_bad.csv",
+                                   "N,T,64,32,16,f16_r,f16_r,f16_r,f32_r,default,12\n"
+                                   "N,T,64,32,16,f99_r,f16_r,f16_r,f32_r,default,12\n");
+
+    EXPECT_EQ(hipblasSetGemmTuningFile(handle, good.c_str()), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasSetGemmTuningFile(handle, bad.c_str()), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasSetGemmTuningFile(handle, "/nonexistent/hipblas_tuning.csv"),
+              HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasSetGemmTuningFile(handle, nullptr), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasSetGemmTuningFile(nullptr, good.c_str()), HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    hipblasDestroy(handle);
+    remove(good.c_str());
+    remove(bad.c_str());
+}
+
+// A tuned solution the backend does not have falls back to the heuristic with the same result
+TEST(hipblas_gemm_tuning, hipblas_gemm_ex_tuned)
+{
+    const int n = 64;
+    string    path
+        = write_tuning_file("hipblas_tuning_gemm.csv",
+                            "N,N,64,64,64,f32_r,f32_r,f32_r,f32_r,default,2147483647\n");
+
+    vector<float> hA(n * n), hB(n * n), hC(n * n), hC_tuned(n * n);
+    for(int i = 0; i < n * n; i++)
+    {
+        hA[i] = float(i % 7 - 3);
+        hB[i] = float(i % 5 - 2);
+    }
+
+    float *dA, *dB, *dC;
+    ASSERT_EQ(hipMalloc(&dA, sizeof(float) * n * n), hipSuccess);
+    ASSERT_EQ(hipMalloc(&dB, sizeof(float) * n * n), hipSuccess);
+    ASSERT_EQ(hipMalloc(&dC, sizeof(float) * n * n), hipSuccess);
+    ASSERT_EQ(hipMemcpy(dA, hA.data(), sizeof(float) * n * n, hipMemcpyHostToDevice), hipSuccess);
+    ASSERT_EQ(hipMemcpy(dB, hB.data(), sizeof(float) * n * n, hipMemcpyHostToDevice), hipSuccess);
+
+    hipblasHandle_t handle;
+    hipblasCreate(&handle);
+
+    float alpha = 1, beta = 0;
+    auto  gemm  = [&] {
+        return hipblasGemmEx(handle,
+                             HIPBLAS_OP_N,
+                             HIPBLAS_OP_N,
+                             n,
+                             n,
+                             n,
+                             &alpha,
+                             dA,
+                             HIPBLAS_R_32F,
+                             n,
+                             dB,
+                             HIPBLAS_R_32F,
+                             n,
+                             &beta,
+                             dC,
+                             HIPBLAS_R_32F,
+                             n,
+                             HIPBLAS_R_32F,
+                             HIPBLAS_GEMM_DEFAULT);
+    };
+
+    EXPECT_EQ(gemm(), HIPBLAS_STATUS_SUCCESS);
+    ASSERT_EQ(hipMemcpy(hC.data(), dC, sizeof(float) * n * n, hipMemcpyDeviceToHost), hipSuccess);
+
+    EXPECT_EQ(hipblasSetGemmTuningFile(handle, path.c_str()), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipMemset(dC, 0, sizeof(float) * n * n), hipSuccess);
+    EXPECT_EQ(gemm(), HIPBLAS_STATUS_SUCCESS);
+    ASSERT_EQ(hipMemcpy(hC_tuned.data(), dC, sizeof(float) * n * n, hipMemcpyDeviceToHost),
+              hipSuccess);
+    EXPECT_EQ(hC, hC_tuned);
+
+    hipblasDestroy(handle);
+    EXPECT_EQ(hipFree(dA), hipSuccess);
+    EXPECT_EQ(hipFree(dB), hipSuccess);
+    EXPECT_EQ(hipFree(dC), hipSuccess);
+    remove(path.c_str());
+}
@@ -0,0 +1,120 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_gemm_xt.hpp"
+#include "utility.h"
+#include <gtest/gtest.h>
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, vector<double>, vector<char>> gemm_xt_tuple;
+
+// {M, N, K, lda, ldb, ldc}; the tests use 64 x 64 tiles, so the larger sizes leave partial tiles
+// and several k steps
+const vector<vector<int>> matrix_size_range = {{-1, 1, 1, 1, 1, 1},
+                                               {10, 10, 10, 10, 10, 10},
+                                               {64, 128, 1, 130, 130, 70},
+                                               {130, 70, 200, 200, 200, 135}};
+
+// {alpha, beta}
+const vector<vector<double>> alpha_beta_range = {{1.0, 0.0}, {-0.5, 2.0}, {0.0, 1.5}};
+
+// {transA, transB}
+const vector<vector<char>> transA_transB_range = {{'N', 'N'}, {'N', 'T'}, {'T', 'N'}, {'T', 'T'}};
+
+Arguments setup_gemm_xt_arguments(gemm_xt_tuple tup)
+{
+    vector<int>    matrix_size   = std::get<0>(tup);
+    vector<double> alpha_beta    = std::get<1>(tup);
+    vector<char>   transA_transB = std::get<2>(tup);
+
+    Arguments arg;
+
+    arg.M   = matrix_size[0];
+    arg.N   = matrix_size[1];
+    arg.K   = matrix_size[2];
+    arg.lda = matrix_size[3];
+    arg.ldb = matrix_size[4];
+    arg.ldc = matrix_size[5];
+
+    arg.alpha = alpha_beta[0];
+    arg.beta  = alpha_beta[1];
+
+    arg.transA_option = transA_transB[0];
+    arg.transB_option = transA_transB[1];
+
+    return arg;
+}
+
+class gemm_xt_gtest : public ::TestWithParam<gemm_xt_tuple>
+{
+protected:
+    gemm_xt_gtest() {}
+    virtual ~gemm_xt_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_P(gemm_xt_gtest, gemm_xt_gtest_float)
+{
+    // GetParam returns a tuple. The setup routine unpacks the tuple
+    // and initializes arg(Arguments), which will be passed to testing routine.
+
+    Arguments arg = setup_gemm_xt_arguments(GetParam());
+
+    hipblasStatus_t status = testing_gemm_xt<float>(arg);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.M < 0 || arg.N < 0 || arg.K < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+        }
+    }
+}
+
+TEST_P(gemm_xt_gtest, gemm_xt_gtest_double)
+{
+    // GetParam returns a tuple. The setup routine unpacks the tuple
+    // and initializes arg(Arguments), which will be passed to testing routine.
+
+    Arguments arg = setup_gemm_xt_arguments(GetParam());
+
+    hipblasStatus_t status = testing_gemm_xt<double>(arg);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.M < 0 || arg.N < 0 || arg.K < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+        }
+    }
+}
+
+// notice we are using vector of vector
+// so each elment in xxx_range is a vector,
+// ValuesIn takes each element (a vector), combines them, and feeds them to test_p
+// The combinations are  { {M, N, K, lda, ldb, ldc}, {alpha, beta}, {transA, transB} }
+
+INSTANTIATE_TEST_CASE_P(hipblasXtGemm,
+                        gemm_xt_gtest,
+                        Combine(ValuesIn(matrix_size_range),
+                                ValuesIn(alpha_beta_range),
+                                ValuesIn(transA_transB_range)));
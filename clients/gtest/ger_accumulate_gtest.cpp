@@ -0,0 +1,147 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_ger_accumulate.hpp"
+#include "utility.h"
+#include <gtest/gtest.h>
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+/* =====================================================================
+     BLAS ger accumulate:
+=================================================================== */
+
+typedef std::tuple<vector<int>, vector<int>> ger_accumulate_tuple;
+
+// {M, N, K}: K rank-1 updates of an M x N A, a single one among them
+const vector<vector<int>> matrix_size_range
+    = {{-1, 4, 2}, {33, 17, 40}, {8, 65, 3}, {1, 1, 1}, {20, 9, 12}};
+
+// {incx, incy}: negative increments store the vectors from their last element
+const vector<vector<int>> incx_incy_range = {{1, 1}, {2, -1}, {-3, 4}, {0, 1}};
+
+Arguments setup_ger_accumulate_arguments(ger_accumulate_tuple tup)
+{
+    vector<int> matrix_size = std::get<0>(tup);
+    vector<int> incx_incy   = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.M    = matrix_size[0];
+    arg.N    = matrix_size[1];
+    arg.K    = matrix_size[2];
+    arg.incx = incx_incy[0];
+    arg.incy = incx_incy[1];
+
+    // a padded A
+    arg.lda = max(1, arg.M + 2);
+
+    // small integers, so the results are exact
+    arg.alpha  = 3;
+    arg.alphai = -1;
+
+    return arg;
+}
+
+// the tester rejects invalid sizes before the call
+static void check_ger_accumulate_status(const Arguments& arg, hipblasStatus_t status)
+{
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.M < 0 || arg.N < 0 || arg.K < 0 || arg.incx == 0 || arg.incy == 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+        }
+    }
+}
+
+class ger_accumulate_gtest : public ::TestWithParam<ger_accumulate_tuple>
+{
+protected:
+    ger_accumulate_gtest() {}
+    virtual ~ger_accumulate_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_P(ger_accumulate_gtest, ger_accumulate_float)
+{
+    // GetParam returns a tuple. The setup routine unpacks the tuple
+    // and initializes arg(Arguments), which will be passed to testing routine.
+
+    Arguments arg = setup_ger_accumulate_arguments(GetParam());
+
+    check_ger_accumulate_status(arg, testing_ger_accumulate<float, false>(arg));
+}
+
+TEST_P(ger_accumulate_gtest, ger_accumulate_double)
+{
+    Arguments arg = setup_ger_accumulate_arguments(GetParam());
+
+    check_ger_accumulate_status(arg, testing_ger_accumulate<double, false>(arg));
+}
+
+TEST_P(ger_accumulate_gtest, geru_accumulate_float_complex)
+{
+    Arguments arg = setup_ger_accumulate_arguments(GetParam());
+
+    check_ger_accumulate_status(arg, testing_ger_accumulate<hipblasComplex, false>(arg));
+}
+
+TEST_P(ger_accumulate_gtest, gerc_accumulate_float_complex)
+{
+    Arguments arg = setup_ger_accumulate_arguments(GetParam());
+
+    check_ger_accumulate_status(arg, testing_ger_accumulate<hipblasComplex, true>(arg));
+}
+
+TEST_P(ger_accumulate_gtest, gerc_accumulate_double_complex)
+{
+    Arguments arg = setup_ger_accumulate_arguments(GetParam());
+
+    check_ger_accumulate_status(arg, testing_ger_accumulate<hipblasDoubleComplex, true>(arg));
+}
+
+// The combinations are  { {M, N, K}, {incx, incy} }
+
+INSTANTIATE_TEST_CASE_P(hipblasGerAccumulate,
+                        ger_accumulate_gtest,
+                        Combine(ValuesIn(matrix_size_range), ValuesIn(incx_incy_range)));
+
+TEST(hipblas_ger_accumulate, bad_arg)
+{
+    hipblasHandle_t handle;
+    ASSERT_EQ(hipblas_client_create(&handle), HIPBLAS_STATUS_SUCCESS);
+
+    float        alpha = 1;
+    float*       p     = &alpha;
+    const float* v[1]  = {p};
+
+    EXPECT_EQ(hipblasSgerAccumulate(nullptr, 4, 4, 1, p, v, 1, v, 1, p, 4),
+              HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_EQ(hipblasSgerAccumulate(handle, 4, 4, -1, p, v, 1, v, 1, p, 4),
+              HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasSgerAccumulate(handle, 4, 4, 1, p, v, 0, v, 1, p, 4),
+              HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasSgerAccumulate(handle, 4, 4, 1, p, v, 1, v, 1, p, 3),
+              HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasSgerAccumulate(handle, 4, 4, 1, nullptr, v, 1, v, 1, p, 4),
+              HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasSgerAccumulate(handle, 4, 4, 0, nullptr, nullptr, 1, nullptr, 1, nullptr, 4),
+              HIPBLAS_STATUS_SUCCESS);
+
+    EXPECT_EQ(hipblas_client_destroy(handle), HIPBLAS_STATUS_SUCCESS);
+}
@@ -0,0 +1,117 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_gesvdj_strided_batched.hpp"
+#include "utility.h"
+#include <gtest/gtest.h>
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, double, int> gesvdj_strided_batched_tuple;
+
+// {M, N, lda}; a shorter side up to 64 runs in the one-sided Jacobi kernel, longer ones in
+// rocSOLVER
+const vector<vector<int>> matrix_size_range = {{-1, 1, 1},
+                                               {3, 3, 2},
+                                               {1, 1, 1},
+                                               {16, 16, 16},
+                                               {20, 7, 25},
+                                               {7, 20, 10},
+                                               {128, 64, 128},
+                                               {64, 128, 64},
+                                               {100, 80, 100}};
+
+const vector<double> stride_scale_range = {2.5};
+
+const vector<int> batch_count_range = {-1, 0, 1, 3};
+
+Arguments setup_gesvdj_strided_batched_arguments(gesvdj_strided_batched_tuple tup)
+{
+    vector<int> matrix_size  = std::get<0>(tup);
+    double      stride_scale = std::get<1>(tup);
+    int         batch_count  = std::get<2>(tup);
+
+    Arguments arg;
+
+    arg.M   = matrix_size[0];
+    arg.N   = matrix_size[1];
+    arg.lda = matrix_size[2];
+
+    arg.stride_scale = stride_scale;
+    arg.batch_count  = batch_count;
+
+    return arg;
+}
+
+class gesvdj_strided_batched_gtest : public ::TestWithParam<gesvdj_strided_batched_tuple>
+{
+protected:
+    gesvdj_strided_batched_gtest() {}
+    virtual ~gesvdj_strided_batched_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_P(gesvdj_strided_batched_gtest, gesvdj_strided_batched_gtest_float)
+{
+    // GetParam returns a tuple. The setup routine unpacks the tuple
+    // and initializes arg(Arguments), which will be passed to testing routine.
+
+    Arguments arg = setup_gesvdj_strided_batched_arguments(GetParam());
+
+    hipblasStatus_t status = testing_gesvdj_strided_batched<float>(arg);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.M < 0 || arg.N < 0 || arg.lda < max(1, arg.M) || arg.batch_count < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_NOT_SUPPORTED, status); // for cuda
+        }
+    }
+}
+
+TEST_P(gesvdj_strided_batched_gtest, gesvdj_strided_batched_gtest_double)
+{
+    // GetParam returns a tuple. The setup routine unpacks the tuple
+    // and initializes arg(Arguments), which will be passed to testing routine.
+
+    Arguments arg = setup_gesvdj_strided_batched_arguments(GetParam());
+
+    hipblasStatus_t status = testing_gesvdj_strided_batched<double>(arg);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.M < 0 || arg.N < 0 || arg.lda < max(1, arg.M) || arg.batch_count < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_NOT_SUPPORTED, status); // for cuda
+        }
+    }
+}
+
+// notice we are using vector of vector
+// so each elment in xxx_range is a vector,
+// ValuesIn takes each element (a vector), combines them, and feeds them to test_p
+// The combinations are  { {M, N, lda}, stride_scale, batch_count }
+
+INSTANTIATE_TEST_CASE_P(hipblasGesvdjStridedBatched,
+                        gesvdj_strided_batched_gtest,
+                        Combine(ValuesIn(matrix_size_range),
+                                ValuesIn(stride_scale_range),
+                                ValuesIn(batch_count_range)));
@@ -0,0 +1,103 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_gtsv_strided_batched.hpp"
+#include "utility.h"
+#include <gtest/gtest.h>
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<int, double, int> gtsv_strided_batched_tuple;
+
+const vector<int> matrix_size_range = {-1, 1, 2, 10, 600};
+
+const vector<double> stride_scale_range = {2.5};
+
+const vector<int> batch_count_range = {-1, 0, 1, 5, 1000};
+
+Arguments setup_gtsv_strided_batched_arguments(gtsv_strided_batched_tuple tup)
+{
+    int    M            = std::get<0>(tup);
+    double stride_scale = std::get<1>(tup);
+    int    batch_count  = std::get<2>(tup);
+
+    Arguments arg;
+
+    arg.M = M;
+
+    arg.stride_scale = stride_scale;
+    arg.batch_count  = batch_count;
+
+    return arg;
+}
+
+class gtsv_strided_batched_gtest : public ::TestWithParam<gtsv_strided_batched_tuple>
+{
+protected:
+    gtsv_strided_batched_gtest() {}
+    virtual ~gtsv_strided_batched_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_P(gtsv_strided_batched_gtest, gtsv_strided_batched_gtest_float)
+{
+    // GetParam returns a tuple. The setup routine unpacks the tuple
+    // and initializes arg(Arguments), which will be passed to testing routine.
+
+    Arguments arg = setup_gtsv_strided_batched_arguments(GetParam());
+
+    hipblasStatus_t status = testing_gtsv_strided_batched<float>(arg);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.M < 0 || arg.batch_count < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+        }
+    }
+}
+
+TEST_P(gtsv_strided_batched_gtest, gtsv_strided_batched_gtest_double)
+{
+    // GetParam returns a tuple. The setup routine unpacks the tuple
+    // and initializes arg(Arguments), which will be passed to testing routine.
+
+    Arguments arg = setup_gtsv_strided_batched_arguments(GetParam());
+
+    hipblasStatus_t status = testing_gtsv_strided_batched<double>(arg);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.M < 0 || arg.batch_count < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+        }
+    }
+}
+
+// ValuesIn takes each element of the ranges, combines them, and feeds them to test_p
+// The combinations are  { M, stride_scale, batch_count }
+
+INSTANTIATE_TEST_CASE_P(hipblasGtsvStridedBatched,
+                        gtsv_strided_batched_gtest,
+                        Combine(ValuesIn(matrix_size_range),
+                                ValuesIn(stride_scale_range),
+                                ValuesIn(batch_count_range)));
@@ -0,0 +1,97 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include <gtest/gtest.h>
+#include <hip/hip_runtime_api.h>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+/* =====================================================================
+     BLAS handle pool:
+=================================================================== */
+
+TEST(hipblas_handle_pool, hipblas_handle_pool_reuse)
+{
+    hipblasHandlePool_t pool;
+    ASSERT_EQ(hipblasHandlePoolCreate(&pool), HIPBLAS_STATUS_SUCCESS);
+
+    hipblasHandle_t handle;
+    ASSERT_EQ(hipblasHandlePoolAcquire(pool, &handle), HIPBLAS_STATUS_SUCCESS);
+
+    hipStream_t stream;
+    ASSERT_EQ(hipStreamCreate(&stream), hipSuccess);
+    EXPECT_EQ(hipblasSetStream(handle, stream), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasSetCaptureMode(handle, HIPBLAS_CAPTURE_MODE_SAFE), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasSetMathMode(handle, HIPBLAS_TF32_TENSOR_OP_MATH), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasHandlePoolRelease(pool, handle), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipStreamDestroy(stream), hipSuccess);
+
+    // The idle handle comes back with the state hipblasCreate gives
+    hipblasHandle_t reused;
+    ASSERT_EQ(hipblasHandlePoolAcquire(pool, &reused), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(reused, handle);
+
+    hipblasPointerMode_t pointer_mode;
+    hipblasCaptureMode_t capture_mode;
+    hipblasMath_t        math_mode;
+    EXPECT_EQ(hipblasGetStream(reused, &stream), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(stream, nullptr);
+    EXPECT_EQ(hipblasGetPointerMode(reused, &pointer_mode), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(pointer_mode, HIPBLAS_POINTER_MODE_HOST);
+    EXPECT_EQ(hipblasGetCaptureMode(reused, &capture_mode), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(capture_mode, HIPBLAS_CAPTURE_MODE_DEFAULT);
+    EXPECT_EQ(hipblasGetMathMode(reused, &math_mode), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(math_mode, HIPBLAS_DEFAULT_MATH);
+
+    // A second concurrent handle is a different one
+    hipblasHandle_t other;
+    ASSERT_EQ(hipblasHandlePoolAcquire(pool, &other), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_NE(other, reused);
+
+    EXPECT_EQ(hipblasHandlePoolRelease(pool, reused), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasHandlePoolRelease(pool, other), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasHandlePoolDestroy(pool), HIPBLAS_STATUS_SUCCESS);
+}
+
+TEST(hipblas_handle_pool, hipblas_handle_pool_threads)
+{
+    hipblasHandlePool_t pool;
+    ASSERT_EQ(hipblasHandlePoolCreate(&pool), HIPBLAS_STATUS_SUCCESS);
+
+    vector<thread> threads;
+    for(int t = 0; t < 4; t++)
+        threads.emplace_back([pool] {
+            for(int i = 0; i < 16; i++)
+            {
+                hipblasHandle_t handle;
+                EXPECT_EQ(hipblasHandlePoolAcquire(pool, &handle), HIPBLAS_STATUS_SUCCESS);
+                EXPECT_EQ(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE),
+                          HIPBLAS_STATUS_SUCCESS);
+                EXPECT_EQ(hipblasHandlePoolRelease(pool, handle), HIPBLAS_STATUS_SUCCESS);
+            }
+        });
+    for(thread& t : threads)
+        t.join();
+
+    EXPECT_EQ(hipblasHandlePoolDestroy(pool), HIPBLAS_STATUS_SUCCESS);
+}
+
+TEST(hipblas_handle_pool, hipblas_handle_pool_bad_arg)
+{
+    hipblasHandlePool_t pool;
+    hipblasHandle_t     handle;
+    EXPECT_EQ(hipblasHandlePoolCreate(nullptr), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasHandlePoolAcquire(nullptr, &handle), HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_EQ(hipblasHandlePoolDestroy(nullptr), HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    ASSERT_EQ(hipblasHandlePoolCreate(&pool), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasHandlePoolAcquire(pool, nullptr), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasHandlePoolRelease(pool, nullptr), HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_EQ(hipblasHandlePoolDestroy(pool), HIPBLAS_STATUS_SUCCESS);
+}
@@ -0,0 +1,178 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include <gtest/gtest.h>
+#include <hip/hip_runtime_api.h>
+#include <vector>
+
+using namespace std;
+
+/* =====================================================================
+     BLAS per-handle stats and call timings:
+=================================================================== */
+
+TEST(hipblas_handle_stats, hipblas_set_get_stats_mode)
+{
+    hipblasHandle_t handle;
+    hipblasCreate(&handle);
+
+    hipblasStatsMode_t mode;
+    EXPECT_EQ(hipblasGetStatsMode(handle, &mode), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(mode, HIPBLAS_STATS_MODE_OFF);
+    EXPECT_EQ(hipblasSetStatsMode(handle, HIPBLAS_STATS_MODE_ON), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasGetStatsMode(handle, &mode), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(mode, HIPBLAS_STATS_MODE_ON);
+
+    EXPECT_EQ(hipblasSetStatsMode(handle, hipblasStatsMode_t(7)), HIPBLAS_STATUS_INVALID_ENUM);
+    EXPECT_EQ(hipblasGetStatsMode(handle, nullptr), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasGetHandleStats(handle, nullptr), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasSetStatsMode(nullptr, HIPBLAS_STATS_MODE_ON), HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_EQ(hipblasGetStatsMode(nullptr, &mode), HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_EQ(hipblasResetHandleStats(nullptr), HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    hipblasDestroy(handle);
+}
+
+TEST(hipblas_handle_stats, hipblas_handle_stats_sgemm)
+{
+    const int     n = 32;
+    vector<float> hA(n * n, 1.0f);
+
+    float *dA, *dB, *dC;
+    ASSERT_EQ(hipMalloc(&dA, sizeof(float) * n * n), hipSuccess);
+    ASSERT_EQ(hipMalloc(&dB, sizeof(float) * n * n), hipSuccess);
+    ASSERT_EQ(hipMalloc(&dC, sizeof(float) * n * n), hipSuccess);
+    ASSERT_EQ(hipMemcpy(dA, hA.data(), sizeof(float) * n * n, hipMemcpyHostToDevice), hipSuccess);
+    ASSERT_EQ(hipMemcpy(dB, hA.data(), sizeof(float) * n * n, hipMemcpyHostToDevice), hipSuccess);
+
+    hipblasHandle_t handle;
+    hipblasCreate(&handle);
+
+    float alpha = 1, beta = 0;
+    auto  gemm  = [&] {
+        return hipblasSgemm(
+            handle, HIPBLAS_OP_N, HIPBLAS_OP_N, n, n, n, &alpha, dA, n, dB, n, &beta, dC, n);
+    };
+
+    hipblasHandleStats_t stats;
+    EXPECT_EQ(hipblasSetStatsMode(handle, HIPBLAS_STATS_MODE_ON), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(gemm(), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(gemm(), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasGetHandleStats(handle, &stats), HIPBLAS_STATUS_SUCCESS);
+
+    const hipblasRoutineStats_t& level3 = stats.family[HIPBLAS_FAMILY_LEVEL3];
+    EXPECT_EQ(level3.calls, 2u);
+    EXPECT_EQ(level3.flops, 2ull * 2 * n * n * n);
+    EXPECT_GT(level3.bytes, 0u);
+    EXPECT_GT(level3.host_ns, 0u);
+    EXPECT_EQ(stats.family[HIPBLAS_FAMILY_LEVEL1].calls, 0u);
+
+    // Reset zeroes the counters; with the mode off calls are no longer counted
+    EXPECT_EQ(hipblasResetHandleStats(handle), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasGetHandleStats(handle, &stats), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(stats.family[HIPBLAS_FAMILY_LEVEL3].calls, 0u);
+    EXPECT_EQ(stats.family[HIPBLAS_FAMILY_LEVEL3].flops, 0u);
+
+    EXPECT_EQ(hipblasSetStatsMode(handle, HIPBLAS_STATS_MODE_OFF), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(gemm(), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasGetHandleStats(handle, &stats), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(stats.family[HIPBLAS_FAMILY_LEVEL3].calls, 0u);
+
+    hipblasDestroy(handle);
+    EXPECT_EQ(hipFree(dA), hipSuccess);
+    EXPECT_EQ(hipFree(dB), hipSuccess);
+    EXPECT_EQ(hipFree(dC), hipSuccess);
+}
+
+TEST(hipblas_handle_stats, hipblas_set_get_timing_mode)
+{
+    hipblasHandle_t handle;
+    hipblasCreate(&handle);
+
+    hipblasTimingMode_t mode;
+    int                 every;
+    EXPECT_EQ(hipblasGetTimingMode(handle, &mode, &every), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(mode, HIPBLAS_TIMING_MODE_OFF);
+    EXPECT_EQ(every, 1);
+    EXPECT_EQ(hipblasSetTimingMode(handle, HIPBLAS_TIMING_MODE_ON, 4), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasGetTimingMode(handle, &mode, &every), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(mode, HIPBLAS_TIMING_MODE_ON);
+    EXPECT_EQ(every, 4);
+
+    int count;
+    EXPECT_EQ(hipblasSetTimingMode(handle, hipblasTimingMode_t(7), 1), HIPBLAS_STATUS_INVALID_ENUM);
+    EXPECT_EQ(hipblasSetTimingMode(handle, HIPBLAS_TIMING_MODE_ON, 0),
+              HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasGetTimingMode(handle, nullptr, &every), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasDrainTimings(handle, nullptr, 1, &count, nullptr),
+              HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasDrainTimings(handle, nullptr, 0, nullptr, nullptr),
+              HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasSetTimingMode(nullptr, HIPBLAS_TIMING_MODE_ON, 1),
+              HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_EQ(hipblasDrainTimings(nullptr, nullptr, 0, &count, nullptr),
+              HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    hipblasDestroy(handle);
+}
+
+TEST(hipblas_handle_stats, hipblas_drain_timings_sgemm)
+{
+    const int     n = 32;
+    vector<float> hA(n * n, 1.0f);
+
+    float *dA, *dB, *dC;
+    ASSERT_EQ(hipMalloc(&dA, sizeof(float) * n * n), hipSuccess);
+    ASSERT_EQ(hipMalloc(&dB, sizeof(float) * n * n), hipSuccess);
+    ASSERT_EQ(hipMalloc(&dC, sizeof(float) * n * n), hipSuccess);
+    ASSERT_EQ(hipMemcpy(dA, hA.data(), sizeof(float) * n * n, hipMemcpyHostToDevice), hipSuccess);
+    ASSERT_EQ(hipMemcpy(dB, hA.data(), sizeof(float) * n * n, hipMemcpyHostToDevice), hipSuccess);
+
+    hipblasHandle_t handle;
+    hipblasCreate(&handle);
+
+    float alpha = 1, beta = 0;
+    auto  gemm  = [&] {
+        return hipblasSgemm(
+            handle, HIPBLAS_OP_N, HIPBLAS_OP_N, n, n, n, &alpha, dA, n, dB, n, &beta, dC, n);
+    };
+
+    // Every second call is timed, from the first
+    EXPECT_EQ(hipblasSetTimingMode(handle, HIPBLAS_TIMING_MODE_ON, 2), HIPBLAS_STATUS_SUCCESS);
+    for(int i = 0; i < 4; i++)
+        EXPECT_EQ(gemm(), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipDeviceSynchronize(), hipSuccess);
+
+    hipblasCallTiming_t records[4];
+    int                 count;
+    unsigned long long  dropped;
+    EXPECT_EQ(hipblasDrainTimings(handle, records, 4, &count, &dropped), HIPBLAS_STATUS_SUCCESS);
+    ASSERT_EQ(count, 2);
+    EXPECT_EQ(dropped, 0u);
+    for(int i = 0; i < count; i++)
+    {
+        EXPECT_STREQ(records[i].function, "hipblasSgemm");
+        EXPECT_EQ(records[i].family, HIPBLAS_FAMILY_LEVEL3);
+        EXPECT_EQ(records[i].m, n);
+        EXPECT_EQ(records[i].n, n);
+        EXPECT_EQ(records[i].k, n);
+        EXPECT_EQ(records[i].batch_count, 1);
+        EXPECT_EQ(records[i].sequence, 2u * i);
+        EXPECT_GE(records[i].gpu_ms, 0.0f);
+    }
+
+    // Drained records are gone; with the mode off calls are no longer timed
+    EXPECT_EQ(hipblasSetTimingMode(handle, HIPBLAS_TIMING_MODE_OFF, 1), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(gemm(), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipDeviceSynchronize(), hipSuccess);
+    EXPECT_EQ(hipblasDrainTimings(handle, records, 4, &count, nullptr), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(count, 0);
+
+    hipblasDestroy(handle);
+    EXPECT_EQ(hipFree(dA), hipSuccess);
+    EXPECT_EQ(hipFree(dB), hipSuccess);
+    EXPECT_EQ(hipFree(dC), hipSuccess);
+}
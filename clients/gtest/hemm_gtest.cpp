@@ -0,0 +1,264 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_hemm.hpp"
+#include "testing_hemm_batched.hpp"
+#include "testing_hemm_strided_batched.hpp"
+#include "utility.h"
+#include <gtest/gtest.h>
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+// only GCC/VS 2010 comes with std::tr1::tuple, but it is unnecessary,  std::tuple is good enough;
+
+typedef std::tuple<vector<int>, vector<double>, char, char, double, int> hemm_tuple;
+
+/* =====================================================================
+README: This file contains testers to verify the correctness of
+        BLAS routines with google test
+
+        It is supposed to be played/used by advance / expert users
+        Normal users only need to get the library routines without testers
+     =================================================================== */
+
+/* =====================================================================
+Advance users only: BrainStorm the parameters but do not make artificial one which invalidates the
+matrix.
+like lda pairs with M, and "lda must >= M". case "lda < M" will be guarded by argument-checkers
+inside API of course.
+Yet, the goal of this file is to verify result correctness not argument-checkers.
+
+Representative sampling is sufficient, endless brute-force sampling is not necessary
+=================================================================== */
+
+// vector of vector, each vector is a {M, N, lda, ldb, ldc};
+// add/delete as a group
+const vector<vector<int>> matrix_size_range = {{-1, -1, -1, -1, -1},
+                                               {11, 6, 11, 11, 11},
+                                               {16, 15, 16, 16, 16},
+                                               {32, 12, 32, 32, 32},
+                                               {65, 4, 65, 65, 65}};
+
+// vector, each entry is  {alpha, alphai, beta, betai};
+// add/delete single values, like {2.0}
+const vector<vector<double>> alpha_beta_range
+    = {{-0.5, 1.5, 2.0, 1.5}, {2.0, 1.0, 2.0, 1.0}, {0.0, 0.0, 0.0, 0.0}};
+
+const vector<char> side_range = {'L', 'R'};
+const vector<char> uplo_range = {'L', 'U'};
+
+const vector<double> stride_scale_range = {1.0, 2.5};
+const vector<int>    batch_count_range  = {-1, 0, 1, 2, 10};
+
+/* ===============Google Unit Test==================================================== */
+
+/* =====================================================================
+     BLAS-3 hemm:
+=================================================================== */
+
+/* ============================Setup Arguments======================================= */
+
+// Please use "class Arguments" (see utility.hpp) to pass parameters to templated testers;
+// Some routines may not touch/use certain "members" of objects "argus".
+// like BLAS-1 Scal does not have lda, BLAS-2 GEMV does not have ldb, ldc;
+// That is fine. These testers & routines will leave untouched members alone.
+// Do not use std::tuple to directly pass parameters to testers
+// by std:tuple, you have unpack it with extreme care for each one by like "std::get<0>" which is
+// not intuitive and error-prone
+
+Arguments setup_hemm_arguments(hemm_tuple tup)
+{
+
+    vector<int>    matrix_size  = std::get<0>(tup);
+    vector<double> alpha_beta   = std::get<1>(tup);
+    char           side         = std::get<2>(tup);
+    char           uplo         = std::get<3>(tup);
+    double         stride_scale = std::get<4>(tup);
+    int            batch_count  = std::get<5>(tup);
+
+    Arguments arg;
+
+    // see the comments about matrix_size_range above
+    arg.M   = matrix_size[0];
+    arg.N   = matrix_size[1];
+    arg.lda = matrix_size[2];
+    arg.ldb = matrix_size[3];
+    arg.ldc = matrix_size[4];
+
+    arg.alpha  = alpha_beta[0];
+    arg.alphai = alpha_beta[1];
+    arg.beta   = alpha_beta[2];
+    arg.betai  = alpha_beta[3];
+
+    arg.timing = 0;
+
+    arg.side_option = side;
+    arg.uplo_option = uplo;
+
+    arg.stride_scale = stride_scale;
+    arg.batch_count  = batch_count;
+
+    return arg;
+}
+
+// the argument checks shared by the testers
+bool hemm_arguments_invalid(const Arguments& arg)
+{
+    int K = arg.side_option == 'L' ? arg.M : arg.N;
+    return arg.M < 0 || arg.N < 0 || arg.lda < K || arg.ldb < arg.M || arg.ldc < arg.M;
+}
+
+class blas3_hemm_gtest : public ::TestWithParam<hemm_tuple>
+{
+protected:
+    blas3_hemm_gtest() {}
+    virtual ~blas3_hemm_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+// hemm
+TEST_P(blas3_hemm_gtest, hemm_gtest_float_complex)
+{
+    Arguments arg = setup_hemm_arguments(GetParam());
+
+    hipblasStatus_t status = testing_hemm<hipblasComplex>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(hemm_arguments_invalid(arg))
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
+
+TEST_P(blas3_hemm_gtest, hemm_gtest_double_complex)
+{
+    Arguments arg = setup_hemm_arguments(GetParam());
+
+    hipblasStatus_t status = testing_hemm<hipblasDoubleComplex>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(hemm_arguments_invalid(arg))
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
+
+// hemm_batched
+TEST_P(blas3_hemm_gtest, hemm_batched_gtest_float_complex)
+{
+    Arguments arg = setup_hemm_arguments(GetParam());
+
+    hipblasStatus_t status = testing_hemm_batched<hipblasComplex>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(hemm_arguments_invalid(arg) || arg.batch_count < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_NOT_SUPPORTED, status); // for cuda
+        }
+    }
+}
+
+TEST_P(blas3_hemm_gtest, hemm_batched_gtest_double_complex)
+{
+    Arguments arg = setup_hemm_arguments(GetParam());
+
+    hipblasStatus_t status = testing_hemm_batched<hipblasDoubleComplex>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(hemm_arguments_invalid(arg) || arg.batch_count < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_NOT_SUPPORTED, status); // for cuda
+        }
+    }
+}
+
+// hemm_strided_batched
+TEST_P(blas3_hemm_gtest, hemm_strided_batched_gtest_float_complex)
+{
+    Arguments arg = setup_hemm_arguments(GetParam());
+
+    hipblasStatus_t status = testing_hemm_strided_batched<hipblasComplex>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(hemm_arguments_invalid(arg) || arg.batch_count < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_NOT_SUPPORTED, status); // for cuda
+        }
+    }
+}
+
+TEST_P(blas3_hemm_gtest, hemm_strided_batched_gtest_double_complex)
+{
+    Arguments arg = setup_hemm_arguments(GetParam());
+
+    hipblasStatus_t status = testing_hemm_strided_batched<hipblasDoubleComplex>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(hemm_arguments_invalid(arg) || arg.batch_count < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_NOT_SUPPORTED, status); // for cuda
+        }
+    }
+}
+
+// notice we are using vector of vector
+// so each elment in xxx_range is a avector,
+// ValuesIn take each element (a vector) and combine them and feed them to test_p
+// The combinations are  { {M, N, lda, ldb, ldc}, {alpha, beta}, side, uplo, ... }
+
+INSTANTIATE_TEST_CASE_P(hipblasHemm,
+                        blas3_hemm_gtest,
+                        Combine(ValuesIn(matrix_size_range),
+                                ValuesIn(alpha_beta_range),
+                                ValuesIn(side_range),
+                                ValuesIn(uplo_range),
+                                ValuesIn(stride_scale_range),
+                                ValuesIn(batch_count_range)));
@@ -3,17 +3,243 @@
  *
  * ************************************************************************ */
 
+#include "device_pool.h"
+#include "utility.h"
+#include "yaml_cases.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
 #include <gtest/gtest.h>
 #include <stdexcept>
-// #include "utility.h"
+#include <string>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <vector>
 
 /* =====================================================================
       Main function:
 =================================================================== */
 
+// the testing_* functions share one handle per device for the whole run rather than create
+// one per test
+class hipblas_handle_environment : public ::testing::Environment
+{
+public:
+    void SetUp() override
+    {
+        hipblas_client_share_handles(true);
+    }
+
+    void TearDown() override
+    {
+        hipblas_client_share_handles(false);
+    }
+};
+
+namespace
+{
+    struct shard
+    {
+        pid_t       pid;
+        std::string log;
+        int         status;
+    };
+
+    // --parallel uses every visible device and --devices N the first N; both are removed
+    // from argv. Returns 0 when neither is given
+    int parse_devices(int& argc, char** argv)
+    {
+        int devices = 0, kept = 1;
+        for(int i = 1; i < argc; i++)
+        {
+            if(!strcmp(argv[i], "--parallel"))
+                devices = -1;
+            else if(!strcmp(argv[i], "--devices") && i + 1 < argc)
+                devices = atoi(argv[++i]);
+            else
+                argv[kept++] = argv[i];
+        }
+        argv[argc = kept] = nullptr;
+        return devices;
+    }
+
+    // --yaml FILE and --suite LIST select the cases of the yaml gtests; both are removed from argv
+    bool load_yaml_cases(int& argc, char** argv)
+    {
+        std::string yaml, suites;
+        int         kept = 1;
+        for(int i = 1; i < argc; i++)
+        {
+            if(!strcmp(argv[i], "--yaml") && i + 1 < argc)
+                yaml = argv[++i];
+            else if(!strcmp(argv[i], "--suite") && i + 1 < argc)
+                suites = argv[++i];
+            else
+                argv[kept++] = argv[i];
+        }
+        argv[argc = kept] = nullptr;
+        if(yaml.empty())
+            return true;
+
+        // sizes an entry leaves out are set by hipblas_fill_leading_dimensions
+        hipblas_yaml_case defaults{"", "gemm", 's', Arguments()};
+        defaults.arg.lda = defaults.arg.ldb = defaults.arg.ldc = 0;
+        try
+        {
+            hipblas_set_yaml_cases(hipblas_read_yaml_cases(yaml, suites, defaults));
+        }
+        catch(const std::exception& e)
+        {
+            fprintf(stderr, "hipblas-test: %s\n", e.what());
+            return false;
+        }
+        return true;
+    }
+
+    // test output ends with "[  PASSED  ] N tests." and, when something failed,
+    // "[  FAILED  ] N tests, listed below:" followed by one "[  FAILED  ] name" line per test
+    void merge_log(const std::string& log, int& passed, std::vector<std::string>& failed)
+    {
+        FILE* f = fopen(log.c_str(), "r");
+        if(!f)
+            return;
+
+        char line[4096];
+        bool listing = false;
+        while(fgets(line, sizeof(line), f))
+        {
+            fputs(line, stdout);
+            int count;
+            if(sscanf(line, "[  PASSED  ] %d test", &count) == 1)
+                passed += count;
+            else if(sscanf(line, "[  FAILED  ] %d test", &count) == 1)
+                listing = true;
+            else if(listing && !strncmp(line, "[  FAILED  ] ", 13))
+                failed.push_back(line + 13);
+            else
+                listing = false;
+        }
+        fclose(f);
+    }
+
+    // the runtime's name for device i of this process, honouring a device list already set
+    std::string visible_device(const char* var, int i)
+    {
+        const char* list = getenv(var);
+        if(!list || !*list)
+            return std::to_string(i);
+
+        std::string devices(list);
+        size_t      begin = 0;
+        for(int skip = 0; skip < i && begin != std::string::npos; skip++)
+        {
+            begin = devices.find(',', begin);
+            begin = begin == std::string::npos ? begin : begin + 1;
+        }
+        if(begin == std::string::npos)
+            return std::to_string(i);
+        return devices.substr(begin, devices.find(',', begin) - begin);
+    }
+
+    // re-runs this executable once per device, each child seeing only its own device and running
+    // its gtest shard of the tests; the children's output is printed in device order followed by
+    // the merged result
+    int run_shards(int devices, char** argv)
+    {
+        std::vector<shard> shards(devices);
+        for(int i = 0; i < devices; i++)
+        {
+            char log[] = "/tmp/hipblas-test-shard-XXXXXX";
+            int  fd    = mkstemp(log);
+            if(fd < 0)
+            {
+                perror("hipblas-test: mkstemp");
+                return EXIT_FAILURE;
+            }
+            shards[i].log = log;
+
+            fflush(nullptr);
+            shards[i].pid = fork();
+            if(shards[i].pid == 0)
+            {
+                std::string index = std::to_string(i), total = std::to_string(devices);
+                std::string hip_device  = visible_device("HIP_VISIBLE_DEVICES", i);
+                std::string cuda_device = visible_device("CUDA_VISIBLE_DEVICES", i);
+                setenv("HIP_VISIBLE_DEVICES", hip_device.c_str(), 1);
+                setenv("CUDA_VISIBLE_DEVICES", cuda_device.c_str(), 1);
+                setenv("GTEST_SHARD_INDEX", index.c_str(), 1);
+                setenv("GTEST_TOTAL_SHARDS", total.c_str(), 1);
+                dup2(fd, STDOUT_FILENO);
+                dup2(fd, STDERR_FILENO);
+                execv("/proc/self/exe", argv);
+                perror("hipblas-test: execv");
+                _exit(127);
+            }
+            close(fd);
+            if(shards[i].pid < 0)
+            {
+                perror("hipblas-test: fork");
+                return EXIT_FAILURE;
+            }
+        }
+
+        int                      passed = 0, crashed = 0;
+        std::vector<std::string> failed;
+        for(int i = 0; i < devices; i++)
+        {
+            waitpid(shards[i].pid, &shards[i].status, 0);
+            printf("[ device %d ] ------------------------------------------------------------\n",
+                   i);
+            size_t failed_before = failed.size();
+            merge_log(shards[i].log, passed, failed);
+            unlink(shards[i].log.c_str());
+
+            // a shard that fails without naming a failed test crashed or never started
+            bool exited = WIFEXITED(shards[i].status);
+            if(!exited || (WEXITSTATUS(shards[i].status) != 0 && failed.size() == failed_before))
+            {
+                printf("[ device %d ] shard did not finish cleanly\n", i);
+                crashed++;
+            }
+        }
+
+        printf("[==========] %d devices\n", devices);
+        printf("[  PASSED  ] %d tests.\n", passed);
+        if(!failed.empty())
+        {
+            printf("[  FAILED  ] %zu tests, listed below:\n", failed.size());
+            for(const auto& name : failed)
+                printf("[  FAILED  ] %s", name.c_str());
+        }
+        return failed.empty() && !crashed ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+}
+
 int main(int argc, char** argv)
 {
+    int devices = parse_devices(argc, argv);
+    if(devices != 0)
+    {
+        int visible = 0;
+        if(hipGetDeviceCount(&visible) != hipSuccess || visible < 1)
+        {
+            fprintf(stderr, "hipblas-test: no devices to run on\n");
+            return EXIT_FAILURE;
+        }
+        devices = devices < 0 ? visible : std::min(devices, visible);
+        if(devices > 1)
+            return run_shards(devices, argv);
+    }
+
+    if(!load_yaml_cases(argc, argv))
+        return EXIT_FAILURE;
+
     ::testing::InitGoogleTest(&argc, argv);
+    ::testing::AddGlobalTestEnvironment(new hipblas_handle_environment);
+
+    int status = RUN_ALL_TESTS();
 
-    return RUN_ALL_TESTS();
+    printf("device memory pool peak: %zu bytes\n", hipblas_pool_peak_bytes());
+    return status;
 }
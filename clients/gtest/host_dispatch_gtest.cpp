@@ -0,0 +1,166 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <hip/hip_runtime_api.h>
+#include <vector>
+
+using namespace std;
+
+/* =====================================================================
+     BLAS gemm and axpy on pinned host operands:
+=================================================================== */
+
+namespace
+{
+    // Small integers, so the result is exact wherever the call runs
+    void run_gemm(hipblasOperation_t transa, int m, int n, int k, hipblasHostDispatchMode_t mode)
+    {
+        int    lda    = (transa == HIPBLAS_OP_N ? m : k) + 1;
+        int    ldb    = k + 2;
+        int    ldc    = m + 3;
+        size_t size_a = size_t(lda) * (transa == HIPBLAS_OP_N ? k : m);
+        size_t size_b = size_t(ldb) * n;
+        size_t size_c = size_t(ldc) * n;
+
+        float *A, *B, *C;
+        ASSERT_EQ(hipHostMalloc(&A, sizeof(float) * max(size_a, size_t(1))), hipSuccess);
+        ASSERT_EQ(hipHostMalloc(&B, sizeof(float) * max(size_b, size_t(1))), hipSuccess);
+        ASSERT_EQ(hipHostMalloc(&C, sizeof(float) * size_c), hipSuccess);
+        for(size_t i = 0; i < size_a; i++)
+            A[i] = float(int(i % 7) - 3);
+        for(size_t i = 0; i < size_b; i++)
+            B[i] = float(int(i % 5) - 2);
+        for(size_t i = 0; i < size_c; i++)
+            C[i] = float(int(i % 3) - 1);
+
+        float         alpha = 2, beta = -1;
+        vector<float> C_gold(C, C + size_c);
+        for(int j = 0; j < n; j++)
+            for(int i = 0; i < m; i++)
+            {
+                float sum = 0;
+                for(int l = 0; l < k; l++)
+                    sum += (transa == HIPBLAS_OP_N ? A[i + l * lda] : A[l + i * lda])
+                           * B[l + j * ldb];
+                C_gold[i + j * ldc] = alpha * sum + beta * C_gold[i + j * ldc];
+            }
+
+        hipblasHandle_t handle;
+        ASSERT_EQ(hipblasCreate(&handle), HIPBLAS_STATUS_SUCCESS);
+        EXPECT_EQ(hipblasSetHostDispatchMode(handle, mode), HIPBLAS_STATUS_SUCCESS);
+        EXPECT_EQ(
+            hipblasSgemm(
+                handle, transa, HIPBLAS_OP_N, m, n, k, &alpha, A, lda, B, ldb, &beta, C, ldc),
+            HIPBLAS_STATUS_SUCCESS);
+        EXPECT_EQ(hipDeviceSynchronize(), hipSuccess);
+        EXPECT_EQ(C_gold, vector<float>(C, C + size_c));
+
+        EXPECT_EQ(hipblasDestroy(handle), HIPBLAS_STATUS_SUCCESS);
+        EXPECT_EQ(hipHostFree(A), hipSuccess);
+        EXPECT_EQ(hipHostFree(B), hipSuccess);
+        EXPECT_EQ(hipHostFree(C), hipSuccess);
+    }
+
+    void run_axpy(int n, int incx, int incy, hipblasHostDispatchMode_t mode)
+    {
+        size_t size_x = size_t(n) * incx;
+        size_t size_y = size_t(n) * incy;
+
+        hipblasComplex *x, *y;
+        ASSERT_EQ(hipHostMalloc(&x, sizeof(hipblasComplex) * size_x), hipSuccess);
+        ASSERT_EQ(hipHostMalloc(&y, sizeof(hipblasComplex) * size_y), hipSuccess);
+        for(size_t i = 0; i < size_x; i++)
+            x[i] = hipblasComplex(int(i % 7) - 3, int(i % 3) - 1);
+        for(size_t i = 0; i < size_y; i++)
+            y[i] = hipblasComplex(int(i % 5) - 2, 1);
+
+        hipblasComplex         alpha(2, -1);
+        vector<hipblasComplex> y_gold(y, y + size_y);
+        for(int i = 0; i < n; i++)
+            y_gold[size_t(i) * incy] += alpha * x[size_t(i) * incx];
+
+        hipblasHandle_t handle;
+        ASSERT_EQ(hipblasCreate(&handle), HIPBLAS_STATUS_SUCCESS);
+        EXPECT_EQ(hipblasSetHostDispatchMode(handle, mode), HIPBLAS_STATUS_SUCCESS);
+        EXPECT_EQ(hipblasCaxpy(handle, n, &alpha, x, incx, y, incy), HIPBLAS_STATUS_SUCCESS);
+        EXPECT_EQ(hipDeviceSynchronize(), hipSuccess);
+        EXPECT_EQ(y_gold, vector<hipblasComplex>(y, y + size_y));
+
+        EXPECT_EQ(hipblasDestroy(handle), HIPBLAS_STATUS_SUCCESS);
+        EXPECT_EQ(hipHostFree(x), hipSuccess);
+        EXPECT_EQ(hipHostFree(y), hipSuccess);
+    }
+}
+
+TEST(hipblas_host_dispatch, set_get)
+{
+    hipblasHandle_t handle;
+    hipblasCreate(&handle);
+
+    hipblasHostDispatchMode_t mode = HIPBLAS_HOST_DISPATCH_ON;
+    EXPECT_EQ(hipblasGetHostDispatchMode(handle, &mode), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(HIPBLAS_HOST_DISPATCH_OFF, mode);
+    EXPECT_EQ(hipblasSetHostDispatchMode(handle, HIPBLAS_HOST_DISPATCH_ON), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasGetHostDispatchMode(handle, &mode), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(HIPBLAS_HOST_DISPATCH_ON, mode);
+
+    hipblasDestroy(handle);
+}
+
+// Tiny gemms run on the host and large ones on staged copies; both give the same C
+TEST(hipblas_host_dispatch, gemm)
+{
+    run_gemm(HIPBLAS_OP_N, 7, 5, 3, HIPBLAS_HOST_DISPATCH_ON);
+    run_gemm(HIPBLAS_OP_T, 16, 12, 9, HIPBLAS_HOST_DISPATCH_ON);
+    run_gemm(HIPBLAS_OP_N, 160, 96, 128, HIPBLAS_HOST_DISPATCH_ON);
+}
+
+TEST(hipblas_host_dispatch, gemm_no_k)
+{
+    run_gemm(HIPBLAS_OP_N, 9, 4, 0, HIPBLAS_HOST_DISPATCH_ON);
+}
+
+TEST(hipblas_host_dispatch, axpy)
+{
+    run_axpy(100, 1, 1, HIPBLAS_HOST_DISPATCH_ON);
+    run_axpy(300, 2, 3, HIPBLAS_HOST_DISPATCH_ON);
+    run_axpy(1 << 20, 1, 2, HIPBLAS_HOST_DISPATCH_ON);
+}
+
+// Pinned memory is mapped, so the device reads it in place
+TEST(hipblas_host_dispatch, off)
+{
+    run_gemm(HIPBLAS_OP_N, 7, 5, 3, HIPBLAS_HOST_DISPATCH_OFF);
+    run_axpy(100, 1, 1, HIPBLAS_HOST_DISPATCH_OFF);
+}
+
+TEST(hipblas_host_dispatch, bad_arg)
+{
+    hipblasHandle_t handle;
+    hipblasCreate(&handle);
+
+    hipblasHostDispatchMode_t mode;
+    EXPECT_EQ(hipblasSetHostDispatchMode(handle, hipblasHostDispatchMode_t(2)),
+              HIPBLAS_STATUS_INVALID_ENUM);
+    EXPECT_EQ(hipblasGetHostDispatchMode(handle, nullptr), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasSetHostDispatchMode(nullptr, HIPBLAS_HOST_DISPATCH_ON),
+              HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_EQ(hipblasGetHostDispatchMode(nullptr, &mode), HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    // Argument errors still come from the backend
+    EXPECT_EQ(hipblasSetHostDispatchMode(handle, HIPBLAS_HOST_DISPATCH_ON), HIPBLAS_STATUS_SUCCESS);
+    float* A;
+    ASSERT_EQ(hipHostMalloc(&A, sizeof(float) * 16), hipSuccess);
+    float alpha = 1, beta = 0;
+    EXPECT_EQ(
+        hipblasSgemm(handle, HIPBLAS_OP_N, HIPBLAS_OP_N, 4, 4, 4, &alpha, A, 3, A, 4, &beta, A, 4),
+        HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipHostFree(A), hipSuccess);
+
+    hipblasDestroy(handle);
+}
@@ -0,0 +1,112 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include <gtest/gtest.h>
+#include <hip/hip_runtime_api.h>
+#include <vector>
+
+using namespace std;
+
+/* =====================================================================
+     BLAS independent streams:
+=================================================================== */
+
+TEST(hipblas_independent_streams, hipblas_get_independent_handle)
+{
+    int             count = -1;
+    hipblasHandle_t independent;
+
+    hipblasHandle_t handle;
+    hipblasCreate(&handle);
+
+    // without streams the handle hands out itself
+    EXPECT_EQ(hipblasGetIndependentStreams(handle, &count), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(0, count);
+    EXPECT_EQ(hipblasGetIndependentHandle(handle, &independent), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(handle, independent);
+
+    EXPECT_EQ(hipblasSetIndependentStreams(handle, 3), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasGetIndependentStreams(handle, &count), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(3, count);
+
+    // handed out in turn, with the handle's pointer mode
+    EXPECT_EQ(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE), HIPBLAS_STATUS_SUCCESS);
+    vector<hipblasHandle_t> handed(4);
+    for(hipblasHandle_t& h : handed)
+    {
+        EXPECT_EQ(hipblasGetIndependentHandle(handle, &h), HIPBLAS_STATUS_SUCCESS);
+        EXPECT_NE(handle, h);
+
+        hipblasPointerMode_t mode;
+        EXPECT_EQ(hipblasGetPointerMode(h, &mode), HIPBLAS_STATUS_SUCCESS);
+        EXPECT_EQ(HIPBLAS_POINTER_MODE_DEVICE, mode);
+    }
+    EXPECT_NE(handed[0], handed[1]);
+    EXPECT_NE(handed[1], handed[2]);
+    EXPECT_EQ(handed[0], handed[3]);
+    EXPECT_EQ(hipblasSynchronizeHandle(handle), HIPBLAS_STATUS_SUCCESS);
+
+    EXPECT_EQ(hipblasSetIndependentStreams(handle, -1), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasGetIndependentHandle(handle, nullptr), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasGetIndependentStreams(nullptr, &count), HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_EQ(hipblasSynchronizeHandle(nullptr), HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    EXPECT_EQ(hipblasSetIndependentStreams(handle, 0), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasGetIndependentHandle(handle, &independent), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(handle, independent);
+
+    hipblasDestroy(handle);
+}
+
+TEST(hipblas_independent_streams, hipblas_synchronize_handle_joins)
+{
+    const int calls = 8, n = 4096;
+    float     alpha = 3.0f;
+
+    vector<float> hx(n), hy(n);
+    for(int i = 0; i < n; i++)
+        hx[i] = float(i % 64);
+
+    float* dx;
+    float* dy;
+    ASSERT_EQ(hipMalloc(&dx, n * sizeof(float)), hipSuccess);
+    ASSERT_EQ(hipMalloc(&dy, calls * n * sizeof(float)), hipSuccess);
+    ASSERT_EQ(hipMemcpy(dx, hx.data(), n * sizeof(float), hipMemcpyHostToDevice), hipSuccess);
+
+    hipblasHandle_t handle;
+    hipblasCreate(&handle);
+    hipStream_t stream;
+    ASSERT_EQ(hipStreamCreate(&stream), hipSuccess);
+    EXPECT_EQ(hipblasSetStream(handle, stream), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasSetIndependentStreams(handle, 4), HIPBLAS_STATUS_SUCCESS);
+
+    // the zeroing on the handle's stream comes before every independent call, and the copy back
+    // after all of them
+    ASSERT_EQ(hipMemsetAsync(dy, 0, calls * n * sizeof(float), stream), hipSuccess);
+    for(int c = 0; c < calls; c++)
+    {
+        hipblasHandle_t independent;
+        EXPECT_EQ(hipblasGetIndependentHandle(handle, &independent), HIPBLAS_STATUS_SUCCESS);
+        EXPECT_EQ(hipblasSaxpy(independent, n, &alpha, dx, 1, dy + c * n, 1),
+                  HIPBLAS_STATUS_SUCCESS);
+    }
+    EXPECT_EQ(hipblasSynchronizeHandle(handle), HIPBLAS_STATUS_SUCCESS);
+
+    for(int c = 0; c < calls; c++)
+    {
+        ASSERT_EQ(hipMemcpyAsync(
+                      hy.data(), dy + c * n, n * sizeof(float), hipMemcpyDeviceToHost, stream),
+                  hipSuccess);
+        ASSERT_EQ(hipStreamSynchronize(stream), hipSuccess);
+        for(int i = 0; i < n; i++)
+            EXPECT_EQ(3.0f * hx[i], hy[i]);
+    }
+
+    hipblasDestroy(handle);
+    EXPECT_EQ(hipStreamDestroy(stream), hipSuccess);
+    EXPECT_EQ(hipFree(dx), hipSuccess);
+    EXPECT_EQ(hipFree(dy), hipSuccess);
+}
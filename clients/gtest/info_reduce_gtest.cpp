@@ -0,0 +1,66 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "utility.h"
+#include <gtest/gtest.h>
+#include <vector>
+
+using namespace std;
+
+/* =====================================================================
+     hipblasInfoReduce:
+=================================================================== */
+
+// Failures from index 7 on, every third batch, reduced into pinned host memory and into device
+// memory
+TEST(hipblas_info_reduce, hipblas_info_reduce)
+{
+    hipblasHandle_t handle;
+    hipblasCreate(&handle);
+    hipStream_t stream;
+    EXPECT_EQ(hipblasGetStream(handle, &stream), HIPBLAS_STATUS_SUCCESS);
+
+    int* d_info;
+    int* d_result;
+    int* h_result;
+    CHECK_HIP_ERROR(hipMalloc(&d_info, 3000 * sizeof(int)));
+    CHECK_HIP_ERROR(hipMalloc(&d_result, 2 * sizeof(int)));
+    CHECK_HIP_ERROR(hipHostMalloc(&h_result, 2 * sizeof(int)));
+
+    for(int batch_count : {0, 1, 7, 8, 3000})
+    {
+        vector<int> info(batch_count, 0);
+        int         failures = 0;
+        for(int b = 7; b < batch_count; b += 3, failures++)
+            info[b] = b % 2 ? 4 : -1;
+        int first = failures ? 7 : -1;
+        if(batch_count > 0)
+            CHECK_HIP_ERROR(hipMemcpy(
+                d_info, info.data(), batch_count * sizeof(int), hipMemcpyHostToDevice));
+
+        h_result[0] = h_result[1] = -2;
+        EXPECT_EQ(hipblasInfoReduce(handle, batch_count, d_info, h_result), HIPBLAS_STATUS_SUCCESS);
+        EXPECT_EQ(hipblasInfoReduce(handle, batch_count, d_info, d_result), HIPBLAS_STATUS_SUCCESS);
+        CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+        EXPECT_EQ(failures, h_result[0]);
+        EXPECT_EQ(first, h_result[1]);
+
+        int result[2];
+        CHECK_HIP_ERROR(hipMemcpy(result, d_result, sizeof(result), hipMemcpyDeviceToHost));
+        EXPECT_EQ(failures, result[0]);
+        EXPECT_EQ(first, result[1]);
+    }
+
+    EXPECT_EQ(hipblasInfoReduce(handle, -1, d_info, d_result), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasInfoReduce(handle, 1, nullptr, d_result), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasInfoReduce(handle, 1, d_info, nullptr), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasInfoReduce(nullptr, 1, d_info, d_result), HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    CHECK_HIP_ERROR(hipFree(d_info));
+    CHECK_HIP_ERROR(hipFree(d_result));
+    CHECK_HIP_ERROR(hipHostFree(h_result));
+    hipblasDestroy(handle);
+}
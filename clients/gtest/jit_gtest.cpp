@@ -0,0 +1,221 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_gemm_jit.hpp"
+#include "utility.h"
+#include <cstdlib>
+#include <dirent.h>
+#include <gtest/gtest.h>
+#include <math.h>
+#include <stdexcept>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+/* =====================================================================
+     BLAS gemm plans of run-time compiled kernels:
+=================================================================== */
+
+typedef std::tuple<vector<int>, vector<char>, int, vector<double>> gemm_jit_tuple;
+
+// {M, N, K}: odd k leaves a partial slice of k, tall and wide problems take the thin tiles, with
+// k = 0 C is beta C, and an empty C has nothing to launch
+const vector<vector<int>> matrix_size_range = {
+    {-1, 4, 4}, {67, 45, 37}, {33, 70, 5}, {1000, 3, 24}, {5, 700, 19}, {12, 10, 0}, {12, 0, 4}};
+
+// {transA, transB}
+const vector<vector<char>> transpose_range = {{'N', 'N'}, {'N', 'T'}, {'T', 'N'}, {'T', 'T'}};
+
+// the epilogue: none, a relu and one of the position of C(i, j)
+const vector<int> epilogue_range = {0, 1, 2};
+
+// {alpha, beta}
+const vector<vector<double>> alpha_beta_range = {{2.0, -1.0}, {2.0, 0.0}, {1.0, 1.0}};
+
+Arguments setup_gemm_jit_arguments(gemm_jit_tuple tup)
+{
+    vector<int>    matrix_size = std::get<0>(tup);
+    vector<char>   transpose   = std::get<1>(tup);
+    vector<double> alpha_beta  = std::get<3>(tup);
+
+    Arguments arg;
+
+    arg.M             = matrix_size[0];
+    arg.N             = matrix_size[1];
+    arg.K             = matrix_size[2];
+    arg.transA_option = transpose[0];
+    arg.transB_option = transpose[1];
+    arg.algo          = std::get<2>(tup);
+    arg.alpha         = alpha_beta[0];
+    arg.beta          = alpha_beta[1];
+
+    // leading dimensions past the rows, which the generated kernel is compiled for
+    arg.lda = max(1, (arg.transA_option == 'N' ? arg.M : arg.K) + 1);
+    arg.ldb = max(1, (arg.transB_option == 'N' ? arg.K : arg.N) + 2);
+    arg.ldc = max(1, arg.M + 3);
+
+    return arg;
+}
+
+// the tester rejects invalid sizes before the plan is made
+static void check_gemm_jit_status(const Arguments& arg, hipblasStatus_t status)
+{
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.M < 0 || arg.N < 0 || arg.K < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+        }
+    }
+}
+
+class gemm_jit_gtest : public ::TestWithParam<gemm_jit_tuple>
+{
+protected:
+    gemm_jit_gtest() {}
+    virtual ~gemm_jit_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_P(gemm_jit_gtest, gemm_jit_float)
+{
+    // GetParam returns a tuple. The setup routine unpacks the tuple
+    // and initializes arg(Arguments), which will be passed to testing routine.
+
+    Arguments arg = setup_gemm_jit_arguments(GetParam());
+
+    check_gemm_jit_status(arg, testing_gemm_jit<float>(arg));
+}
+
+TEST_P(gemm_jit_gtest, gemm_jit_half)
+{
+    Arguments arg = setup_gemm_jit_arguments(GetParam());
+
+    check_gemm_jit_status(arg, testing_gemm_jit<hipblasHalf>(arg));
+}
+
+TEST_P(gemm_jit_gtest, gemm_jit_bfloat16)
+{
+    Arguments arg = setup_gemm_jit_arguments(GetParam());
+
+    check_gemm_jit_status(arg, testing_gemm_jit<hipblasBfloat16>(arg));
+}
+
+// The combinations are  { {M, N, K}, {transA, transB}, epilogue, {alpha, beta} }
+
+INSTANTIATE_TEST_CASE_P(hipblasGemmPlanCreateJit,
+                        gemm_jit_gtest,
+                        Combine(ValuesIn(matrix_size_range),
+                                ValuesIn(transpose_range),
+                                ValuesIn(epilogue_range),
+                                ValuesIn(alpha_beta_range)));
+
+namespace
+{
+    int count_files(const string& dir)
+    {
+        int  count = 0;
+        DIR* d     = opendir(dir.c_str());
+        if(!d)
+            return 0;
+        while(dirent* entry = readdir(d))
+            count += entry->d_name[0] != '.';
+        closedir(d);
+        return count;
+    }
+}
+
+// The first plan of a problem writes its code object, which the next finds
+TEST(hipblas_jit, disk_cache)
+{
+    char dir[] = "/tmp/hipblas_jit_gtest_XXXXXX";
+    ASSERT_NE(mkdtemp(dir), nullptr);
+    string      cache    = string(dir) + "/nested";
+    const char* previous = getenv("HIPBLAS_JIT_CACHE_PATH");
+    string      saved    = previous ? previous : "";
+    setenv("HIPBLAS_JIT_CACHE_PATH", cache.c_str(), 1);
+
+    hipblasHandle_t handle;
+    ASSERT_EQ(hipblas_client_create(&handle), HIPBLAS_STATUS_SUCCESS);
+    hipblasGemmShape_t shape{
+        HIPBLAS_OP_N, HIPBLAS_OP_N, 23, 29, 31, HIPBLAS_R_32F, HIPBLAS_R_32F, HIPBLAS_R_32F,
+        HIPBLAS_R_32F};
+    const char*       code = "v *= S(3);";
+    hipblasGemmPlan_t plan1, plan2;
+    EXPECT_EQ(hipblasGemmPlanCreateJit(handle, &shape, 23, 31, 23, code, &plan1),
+              HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(count_files(cache), 1);
+    EXPECT_EQ(hipblasGemmPlanCreateJit(handle, &shape, 23, 31, 23, code, &plan2),
+              HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(count_files(cache), 1);
+    EXPECT_EQ(hipblasGemmPlanDestroy(plan1), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasGemmPlanDestroy(plan2), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblas_client_destroy(handle), HIPBLAS_STATUS_SUCCESS);
+
+    if(previous)
+        setenv("HIPBLAS_JIT_CACHE_PATH", saved.c_str(), 1);
+    else
+        unsetenv("HIPBLAS_JIT_CACHE_PATH");
+    DIR* d = opendir(cache.c_str());
+    if(d)
+    {
+        while(dirent* entry = readdir(d))
+            if(entry->d_name[0] != '.')
+                unlink((cache + "/" + entry->d_name).c_str());
+        closedir(d);
+    }
+    rmdir(cache.c_str());
+    rmdir(dir);
+}
+
+TEST(hipblas_jit, bad_arg)
+{
+    hipblasHandle_t handle;
+    ASSERT_EQ(hipblas_client_create(&handle), HIPBLAS_STATUS_SUCCESS);
+
+    hipblasGemmShape_t shape{
+        HIPBLAS_OP_N, HIPBLAS_OP_N, 4, 4, 4, HIPBLAS_R_32F, HIPBLAS_R_32F, HIPBLAS_R_32F,
+        HIPBLAS_R_32F};
+    hipblasGemmPlan_t plan;
+    EXPECT_EQ(hipblasGemmPlanCreateJit(nullptr, &shape, 4, 4, 4, nullptr, &plan),
+              HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_EQ(hipblasGemmPlanCreateJit(handle, nullptr, 4, 4, 4, nullptr, &plan),
+              HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasGemmPlanCreateJit(handle, &shape, 4, 4, 4, nullptr, nullptr),
+              HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasGemmPlanCreateJit(handle, &shape, 3, 4, 4, nullptr, &plan),
+              HIPBLAS_STATUS_INVALID_VALUE);
+
+    hipblasGemmShape_t bad = shape;
+    bad.transA             = hipblasOperation_t(-1);
+    EXPECT_EQ(hipblasGemmPlanCreateJit(handle, &bad, 4, 4, 4, nullptr, &plan),
+              HIPBLAS_STATUS_INVALID_ENUM);
+    bad        = shape;
+    bad.c_type = HIPBLAS_C_32F;
+    EXPECT_EQ(hipblasGemmPlanCreateJit(handle, &bad, 4, 4, 4, nullptr, &plan),
+              HIPBLAS_STATUS_NOT_SUPPORTED);
+    bad              = shape;
+    bad.compute_type = HIPBLAS_R_16F;
+    EXPECT_EQ(hipblasGemmPlanCreateJit(handle, &bad, 4, 4, 4, nullptr, &plan),
+              HIPBLAS_STATUS_NOT_SUPPORTED);
+
+    // An epilogue that does not compile
+    EXPECT_EQ(hipblasGemmPlanCreateJit(handle, &shape, 4, 4, 4, "v = undeclared;", &plan),
+              HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(plan, nullptr);
+
+    EXPECT_EQ(hipblas_client_destroy(handle), HIPBLAS_STATUS_SUCCESS);
+}
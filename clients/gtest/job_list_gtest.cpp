@@ -0,0 +1,113 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include <cmath>
+#include <gtest/gtest.h>
+#include <hip/hip_runtime_api.h>
+#include <vector>
+
+using namespace std;
+
+/* =====================================================================
+     BLAS job_list:
+=================================================================== */
+
+namespace
+{
+    // A host buffer and its device copy
+    struct buffer
+    {
+        vector<double> host;
+        double*        device = nullptr;
+
+        explicit buffer(size_t n)
+            : host(n)
+        {
+            for(size_t i = 0; i < n; i++)
+                host[i] = std::sin(double(i) + n);
+            EXPECT_EQ(hipMalloc(&device, n * sizeof(double)), hipSuccess);
+            EXPECT_EQ(hipMemcpy(device, host.data(), n * sizeof(double), hipMemcpyHostToDevice),
+                      hipSuccess);
+        }
+
+        ~buffer()
+        {
+            EXPECT_EQ(hipFree(device), hipSuccess);
+        }
+
+        vector<double> result() const
+        {
+            vector<double> r(host.size());
+            EXPECT_EQ(hipMemcpy(r.data(), device, r.size() * sizeof(double), hipMemcpyDeviceToHost),
+                      hipSuccess);
+            return r;
+        }
+    };
+}
+
+TEST(hipblas_job_list, mixed_jobs)
+{
+    const int m = 37, n = 21, k = 19;
+    buffer    x(n), y(n), A(m * n), gx(n), gy(m), B(k * n), C(m * n), P(m * k);
+
+    vector<hipblasJob_t> jobs(3);
+    jobs[0]     = {HIPBLAS_JOB_AXPY, HIPBLAS_OP_N, HIPBLAS_OP_N, 0, n, 0, 2.0, 0.0};
+    jobs[0].B   = x.device;
+    jobs[0].ldb = 1;
+    jobs[0].C   = y.device;
+    jobs[0].ldc = 1;
+    jobs[1]     = {HIPBLAS_JOB_GEMV, HIPBLAS_OP_N, HIPBLAS_OP_N, m, n, 0, 0.5, 0.25};
+    jobs[1].A   = A.device;
+    jobs[1].lda = m;
+    jobs[1].B   = gx.device;
+    jobs[1].ldb = 1;
+    jobs[1].C   = gy.device;
+    jobs[1].ldc = 1;
+    jobs[2]     = {HIPBLAS_JOB_GEMM, HIPBLAS_OP_N, HIPBLAS_OP_N, m, n, k, 1.5, -1.0};
+    jobs[2].A   = P.device;
+    jobs[2].lda = m;
+    jobs[2].B   = B.device;
+    jobs[2].ldb = k;
+    jobs[2].C   = C.device;
+    jobs[2].ldc = m;
+
+    hipblasHandle_t handle;
+    hipblasCreate(&handle);
+    EXPECT_EQ(hipblasDJobList(handle, jobs.data(), int(jobs.size())), HIPBLAS_STATUS_SUCCESS);
+
+    vector<double> ry = y.result(), rgy = gy.result(), rC = C.result();
+    for(int i = 0; i < n; i++)
+        EXPECT_NEAR(y.host[i] + 2.0 * x.host[i], ry[i], 1e-12);
+    for(int i = 0; i < m; i++)
+    {
+        double s = 0;
+        for(int j = 0; j < n; j++)
+            s += A.host[i + j * m] * gx.host[j];
+        EXPECT_NEAR(0.5 * s + 0.25 * gy.host[i], rgy[i], 1e-12);
+    }
+    for(int j = 0; j < n; j++)
+        for(int i = 0; i < m; i++)
+        {
+            double s = 0;
+            for(int l = 0; l < k; l++)
+                s += P.host[i + l * m] * B.host[l + j * k];
+            EXPECT_NEAR(1.5 * s - C.host[i + j * m], rC[i + j * m], 1e-12);
+        }
+
+    // bad jobs are rejected before anything runs
+    jobs[1].lda = m - 1;
+    EXPECT_EQ(hipblasDJobList(handle, jobs.data(), int(jobs.size())),
+              HIPBLAS_STATUS_INVALID_VALUE);
+    jobs[1].lda  = m;
+    jobs[1].type = hipblasJobType_t(3);
+    EXPECT_EQ(hipblasDJobList(handle, jobs.data(), int(jobs.size())),
+              HIPBLAS_STATUS_INVALID_ENUM);
+    EXPECT_EQ(hipblasDJobList(handle, nullptr, 1), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasDJobList(handle, nullptr, 0), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasDJobList(nullptr, jobs.data(), 1), HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    hipblasDestroy(handle);
+}
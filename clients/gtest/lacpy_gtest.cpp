@@ -0,0 +1,235 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_lacpy.hpp"
+#include "testing_lacpy_batched.hpp"
+#include "testing_lacpy_ex.hpp"
+#include "testing_lacpy_strided_batched.hpp"
+#include "utility.h"
+#include <gtest/gtest.h>
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, char> lacpy_tuple;
+typedef std::tuple<vector<int>, char, double, int> lacpy_batched_tuple;
+
+// {M, N, lda, ldb}; a lda or ldb below M is invalid. Odd sizes end columns mid-vector
+const vector<vector<int>> matrix_size_range = {{-1, 2, 1, 1},
+                                               {3, 2, 2, 3},
+                                               {3, 2, 3, 2},
+                                               {37, 41, 40, 44},
+                                               {65, 70, 65, 80},
+                                               {300, 200, 304, 512},
+                                               {200, 300, 201, 203}};
+
+const vector<vector<int>> batched_matrix_size_range
+    = {{-1, 2, 1, 1}, {17, 33, 20, 17}, {37, 41, 37, 41}, {130, 90, 132, 136}};
+
+// 'F' copies all of A
+const vector<char> uplo_range = {'F', 'U', 'L'};
+
+// 1.5 starts some batches off the 16-byte boundary
+const vector<double> stride_scale_range = {1.0, 1.5};
+
+const vector<int> batch_count_range = {-1, 0, 1, 5};
+
+Arguments setup_lacpy_arguments(lacpy_tuple tup)
+{
+    vector<int> matrix_size = std::get<0>(tup);
+
+    Arguments arg;
+
+    arg.M   = matrix_size[0];
+    arg.N   = matrix_size[1];
+    arg.lda = matrix_size[2];
+    arg.ldb = matrix_size[3];
+
+    arg.uplo_option = std::get<1>(tup);
+
+    return arg;
+}
+
+Arguments setup_lacpy_batched_arguments(lacpy_batched_tuple tup)
+{
+    Arguments arg = setup_lacpy_arguments(lacpy_tuple(std::get<0>(tup), std::get<1>(tup)));
+
+    arg.stride_scale = std::get<2>(tup);
+    arg.batch_count  = std::get<3>(tup);
+
+    return arg;
+}
+
+// the testers reject invalid sizes before the call
+static void check_lacpy_status(const Arguments& arg, hipblasStatus_t status)
+{
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.M < 0 || arg.N < 0 || arg.lda < max(1, arg.M) || arg.ldb < max(1, arg.M)
+           || arg.batch_count < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+        }
+    }
+}
+
+class lacpy_gtest : public ::TestWithParam<lacpy_tuple>
+{
+protected:
+    lacpy_gtest() {}
+    virtual ~lacpy_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_P(lacpy_gtest, lacpy_gtest_float)
+{
+    // GetParam returns a tuple. The setup routine unpacks the tuple
+    // and initializes arg(Arguments), which will be passed to testing routine.
+
+    Arguments arg = setup_lacpy_arguments(GetParam());
+
+    check_lacpy_status(arg, testing_lacpy<float>(arg));
+}
+
+TEST_P(lacpy_gtest, lacpy_gtest_double)
+{
+    Arguments arg = setup_lacpy_arguments(GetParam());
+
+    check_lacpy_status(arg, testing_lacpy<double>(arg));
+}
+
+TEST_P(lacpy_gtest, lacpy_gtest_float_complex)
+{
+    Arguments arg = setup_lacpy_arguments(GetParam());
+
+    check_lacpy_status(arg, testing_lacpy<hipblasComplex>(arg));
+}
+
+TEST_P(lacpy_gtest, lacpy_gtest_double_complex)
+{
+    Arguments arg = setup_lacpy_arguments(GetParam());
+
+    check_lacpy_status(arg, testing_lacpy<hipblasDoubleComplex>(arg));
+}
+
+class lacpy_batched_gtest : public ::TestWithParam<lacpy_batched_tuple>
+{
+protected:
+    lacpy_batched_gtest() {}
+    virtual ~lacpy_batched_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_P(lacpy_batched_gtest, lacpy_batched_gtest_float)
+{
+    Arguments arg = setup_lacpy_batched_arguments(GetParam());
+
+    check_lacpy_status(arg, testing_lacpy_batched<float>(arg));
+}
+
+TEST_P(lacpy_batched_gtest, lacpy_batched_gtest_double_complex)
+{
+    Arguments arg = setup_lacpy_batched_arguments(GetParam());
+
+    check_lacpy_status(arg, testing_lacpy_batched<hipblasDoubleComplex>(arg));
+}
+
+TEST_P(lacpy_batched_gtest, lacpy_strided_batched_gtest_float)
+{
+    Arguments arg = setup_lacpy_batched_arguments(GetParam());
+
+    check_lacpy_status(arg, testing_lacpy_strided_batched<float>(arg));
+}
+
+TEST_P(lacpy_batched_gtest, lacpy_strided_batched_gtest_double_complex)
+{
+    Arguments arg = setup_lacpy_batched_arguments(GetParam());
+
+    check_lacpy_status(arg, testing_lacpy_strided_batched<hipblasDoubleComplex>(arg));
+}
+
+TEST_P(lacpy_batched_gtest, lacpy_strided_batched_ex_gtest_float)
+{
+    Arguments arg = setup_lacpy_batched_arguments(GetParam());
+
+    check_lacpy_status(arg, testing_lacpy_ex<float, float>(arg));
+}
+
+TEST_P(lacpy_batched_gtest, lacpy_strided_batched_ex_gtest_double_complex)
+{
+    Arguments arg = setup_lacpy_batched_arguments(GetParam());
+
+    check_lacpy_status(arg, testing_lacpy_ex<hipblasDoubleComplex, hipblasDoubleComplex>(arg));
+}
+
+// lacpyEx converts between the types of copyEx as it copies
+TEST_P(lacpy_batched_gtest, lacpy_strided_batched_ex_gtest_float_half)
+{
+    Arguments arg = setup_lacpy_batched_arguments(GetParam());
+
+    check_lacpy_status(arg, testing_lacpy_ex<float, hipblasHalf>(arg));
+}
+
+TEST_P(lacpy_batched_gtest, lacpy_strided_batched_ex_gtest_half_float)
+{
+    Arguments arg = setup_lacpy_batched_arguments(GetParam());
+
+    check_lacpy_status(arg, testing_lacpy_ex<hipblasHalf, float>(arg));
+}
+
+// The combinations are  { {M, N, lda, ldb}, uplo } and
+// { {M, N, lda, ldb}, uplo, stride_scale, batch_count }
+
+INSTANTIATE_TEST_CASE_P(hipblasLacpy,
+                        lacpy_gtest,
+                        Combine(ValuesIn(matrix_size_range), ValuesIn(uplo_range)));
+
+INSTANTIATE_TEST_CASE_P(hipblasLacpy_batched,
+                        lacpy_batched_gtest,
+                        Combine(ValuesIn(batched_matrix_size_range),
+                                ValuesIn(uplo_range),
+                                ValuesIn(stride_scale_range),
+                                ValuesIn(batch_count_range)));
+
+TEST(hipblas_lacpy, bad_arg)
+{
+    hipblasHandle_t handle;
+    ASSERT_EQ(hipblas_client_create(&handle), HIPBLAS_STATUS_SUCCESS);
+
+    float             x[16];
+    hipblasFillMode_t full = HIPBLAS_FILL_MODE_FULL;
+    EXPECT_EQ(hipblasSlacpy(nullptr, full, 2, 2, x, 2, x + 8, 2), HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_EQ(hipblasSlacpy(handle, hipblasFillMode_t(0), 2, 2, x, 2, x + 8, 2),
+              HIPBLAS_STATUS_INVALID_ENUM);
+    EXPECT_EQ(hipblasSlacpy(handle, full, -1, 2, x, 2, x + 8, 2), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasSlacpy(handle, full, 2, -1, x, 2, x + 8, 2), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasSlacpy(handle, full, 3, 2, x, 2, x + 8, 3), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasSlacpy(handle, full, 3, 2, x, 3, x + 8, 2), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasSlacpy(handle, full, 2, 2, nullptr, 2, x + 8, 2),
+              HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasSlacpyStridedBatched(handle, full, 2, 2, x, 2, 4, x + 8, 2, 4, -1),
+              HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasLacpyEx(handle, full, 2, 2, x, HIPBLAS_R_32F, 2, x + 8, HIPBLAS_C_32F, 2),
+              HIPBLAS_STATUS_NOT_SUPPORTED);
+
+    // nothing to copy, so the pointers are not looked at
+    EXPECT_EQ(hipblasSlacpy(handle, full, 0, 2, nullptr, 1, nullptr, 1), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasSlacpyBatched(handle, full, 2, 2, nullptr, 2, nullptr, 2, 0),
+              HIPBLAS_STATUS_SUCCESS);
+
+    EXPECT_EQ(hipblas_client_destroy(handle), HIPBLAS_STATUS_SUCCESS);
+}
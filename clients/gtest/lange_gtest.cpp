@@ -0,0 +1,155 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_lange.hpp"
+#include "utility.h"
+#include <gtest/gtest.h>
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, char, int> lange_tuple;
+
+// {M, N, lda}
+const vector<vector<int>> matrix_size_range
+    = {{-1, 1, 1}, {1, -1, 1}, {10, 10, 5}, {0, 4, 1}, {1, 1, 1}, {33, 40, 40}, {600, 500, 601}};
+
+const vector<char> norm_range = {'M', 'O', 'I', 'F'};
+
+const vector<int> batch_count_range = {-1, 0, 1, 3};
+
+Arguments setup_lange_arguments(lange_tuple tup)
+{
+    vector<int> matrix_size = std::get<0>(tup);
+    char        norm        = std::get<1>(tup);
+    int         batch_count = std::get<2>(tup);
+
+    Arguments arg;
+
+    arg.M   = matrix_size[0];
+    arg.N   = matrix_size[1];
+    arg.lda = matrix_size[2];
+
+    arg.norm_option = norm;
+    arg.batch_count = batch_count;
+
+    arg.norm_check = 1;
+
+    return arg;
+}
+
+class lange_gtest : public ::TestWithParam<lange_tuple>
+{
+protected:
+    lange_gtest() {}
+    virtual ~lange_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_P(lange_gtest, lange_strided_batched_gtest_float)
+{
+    // GetParam returns a tuple. The setup routine unpacks the tuple
+    // and initializes arg(Arguments), which will be passed to testing routine.
+
+    Arguments arg = setup_lange_arguments(GetParam());
+
+    hipblasStatus_t status = testing_lange_strided_batched<float>(arg);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.M < 0 || arg.N < 0 || arg.lda < max(1, arg.M) || arg.batch_count < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+        }
+    }
+}
+
+TEST_P(lange_gtest, lange_strided_batched_gtest_double)
+{
+    // GetParam returns a tuple. The setup routine unpacks the tuple
+    // and initializes arg(Arguments), which will be passed to testing routine.
+
+    Arguments arg = setup_lange_arguments(GetParam());
+
+    hipblasStatus_t status = testing_lange_strided_batched<double>(arg);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.M < 0 || arg.N < 0 || arg.lda < max(1, arg.M) || arg.batch_count < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+        }
+    }
+}
+
+TEST_P(lange_gtest, lange_strided_batched_gtest_float_complex)
+{
+    // GetParam returns a tuple. The setup routine unpacks the tuple
+    // and initializes arg(Arguments), which will be passed to testing routine.
+
+    Arguments arg = setup_lange_arguments(GetParam());
+
+    hipblasStatus_t status = testing_lange_strided_batched<hipblasComplex>(arg);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.M < 0 || arg.N < 0 || arg.lda < max(1, arg.M) || arg.batch_count < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+        }
+    }
+}
+
+TEST_P(lange_gtest, lange_strided_batched_gtest_double_complex)
+{
+    // GetParam returns a tuple. The setup routine unpacks the tuple
+    // and initializes arg(Arguments), which will be passed to testing routine.
+
+    Arguments arg = setup_lange_arguments(GetParam());
+
+    hipblasStatus_t status = testing_lange_strided_batched<hipblasDoubleComplex>(arg);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.M < 0 || arg.N < 0 || arg.lda < max(1, arg.M) || arg.batch_count < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+        }
+    }
+}
+
+// notice we are using vector of vector
+// so each elment in xxx_range is a vector,
+// ValuesIn takes each element (a vector), combines them, and feeds them to test_p
+// The combinations are  { {M, N, lda}, norm, batch_count }
+
+INSTANTIATE_TEST_CASE_P(hipblasLange,
+                        lange_gtest,
+                        Combine(ValuesIn(matrix_size_range),
+                                ValuesIn(norm_range),
+                                ValuesIn(batch_count_range)));
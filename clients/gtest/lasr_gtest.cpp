@@ -0,0 +1,210 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_lasr.hpp"
+#include "testing_lasr_batched.hpp"
+#include "testing_lasr_strided_batched.hpp"
+#include "utility.h"
+#include <gtest/gtest.h>
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+/* =====================================================================
+     plane rotation sequences:
+=================================================================== */
+
+typedef std::tuple<vector<int>, char, char, char> lasr_tuple;
+typedef std::tuple<vector<int>, char, char, char, int> lasr_batched_tuple;
+
+// {M, N}: sequences both shorter and longer than one block's staged rotations, and of one
+const vector<vector<int>> matrix_size_range = {{-1, 4}, {7, 5}, {300, 270}, {2, 1}};
+
+const vector<char> side_range   = {'L', 'R'};
+const vector<char> pivot_range  = {'V', 'T', 'B'};
+const vector<char> direct_range = {'F', 'B'};
+
+const vector<int> batch_count_range = {-1, 0, 3};
+
+Arguments setup_lasr_arguments(lasr_tuple tup)
+{
+    vector<int> matrix_size = std::get<0>(tup);
+
+    Arguments arg;
+
+    arg.M             = matrix_size[0];
+    arg.N             = matrix_size[1];
+    arg.side_option   = std::get<1>(tup);
+    arg.pivot_option  = std::get<2>(tup);
+    arg.direct_option = std::get<3>(tup);
+
+    // a padded A, whose extra row must keep its values
+    arg.lda = max(1, arg.M + 1);
+
+    return arg;
+}
+
+Arguments setup_lasr_batched_arguments(lasr_batched_tuple tup)
+{
+    Arguments arg = setup_lasr_arguments(
+        lasr_tuple(std::get<0>(tup), std::get<1>(tup), std::get<2>(tup), std::get<3>(tup)));
+
+    // room between the batches too, for the strided batched form
+    arg.stride_scale = 1.5;
+    arg.batch_count  = std::get<4>(tup);
+
+    return arg;
+}
+
+// the testers reject invalid sizes before the call
+static void check_lasr_status(const Arguments& arg, hipblasStatus_t status)
+{
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.M < 0 || arg.N < 0 || arg.batch_count < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+        }
+    }
+}
+
+class lasr_gtest : public ::TestWithParam<lasr_tuple>
+{
+protected:
+    lasr_gtest() {}
+    virtual ~lasr_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_P(lasr_gtest, lasr_float)
+{
+    // GetParam returns a tuple. The setup routine unpacks the tuple
+    // and initializes arg(Arguments), which will be passed to testing routine.
+
+    Arguments arg = setup_lasr_arguments(GetParam());
+
+    check_lasr_status(arg, testing_lasr<float>(arg));
+}
+
+TEST_P(lasr_gtest, lasr_double)
+{
+    Arguments arg = setup_lasr_arguments(GetParam());
+
+    check_lasr_status(arg, testing_lasr<double>(arg));
+}
+
+TEST_P(lasr_gtest, lasr_float_complex)
+{
+    Arguments arg = setup_lasr_arguments(GetParam());
+
+    check_lasr_status(arg, testing_lasr<hipblasComplex>(arg));
+}
+
+TEST_P(lasr_gtest, lasr_double_complex)
+{
+    Arguments arg = setup_lasr_arguments(GetParam());
+
+    check_lasr_status(arg, testing_lasr<hipblasDoubleComplex>(arg));
+}
+
+class lasr_batched_gtest : public ::TestWithParam<lasr_batched_tuple>
+{
+protected:
+    lasr_batched_gtest() {}
+    virtual ~lasr_batched_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_P(lasr_batched_gtest, lasr_batched_float)
+{
+    Arguments arg = setup_lasr_batched_arguments(GetParam());
+
+    check_lasr_status(arg, testing_lasr_batched<float>(arg));
+}
+
+TEST_P(lasr_batched_gtest, lasr_batched_double_complex)
+{
+    Arguments arg = setup_lasr_batched_arguments(GetParam());
+
+    check_lasr_status(arg, testing_lasr_batched<hipblasDoubleComplex>(arg));
+}
+
+TEST_P(lasr_batched_gtest, lasr_strided_batched_float)
+{
+    Arguments arg = setup_lasr_batched_arguments(GetParam());
+
+    check_lasr_status(arg, testing_lasr_strided_batched<float>(arg));
+}
+
+TEST_P(lasr_batched_gtest, lasr_strided_batched_double)
+{
+    Arguments arg = setup_lasr_batched_arguments(GetParam());
+
+    check_lasr_status(arg, testing_lasr_strided_batched<double>(arg));
+}
+
+// The combinations are  { {M, N}, side, pivot, direct } and
+// { {M, N}, side, pivot, direct, batch_count }
+
+INSTANTIATE_TEST_CASE_P(hipblasLasr,
+                        lasr_gtest,
+                        Combine(ValuesIn(matrix_size_range),
+                                ValuesIn(side_range),
+                                ValuesIn(pivot_range),
+                                ValuesIn(direct_range)));
+
+INSTANTIATE_TEST_CASE_P(hipblasLasr_batched,
+                        lasr_batched_gtest,
+                        Combine(ValuesIn(matrix_size_range),
+                                ValuesIn(side_range),
+                                ValuesIn(pivot_range),
+                                ValuesIn(direct_range),
+                                ValuesIn(batch_count_range)));
+
+TEST(hipblas_lasr, bad_arg)
+{
+    hipblasHandle_t handle;
+    ASSERT_EQ(hipblas_client_create(&handle), HIPBLAS_STATUS_SUCCESS);
+
+    float  x = 0;
+    float* p = &x;
+
+    auto call = [&](hipblasHandle_t h, hipblasPivot_t pivot, int m, int lda, const float* c) {
+        return hipblasSlasr(
+            h, HIPBLAS_SIDE_LEFT, pivot, HIPBLAS_FORWARD_DIRECTION, m, 4, c, p, p, lda);
+    };
+
+    EXPECT_EQ(call(nullptr, HIPBLAS_PIVOT_VARIABLE, 4, 4, p), HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_EQ(call(handle, hipblasPivot_t(9), 4, 4, p), HIPBLAS_STATUS_INVALID_ENUM);
+    EXPECT_EQ(call(handle, HIPBLAS_PIVOT_VARIABLE, 4, 3, p), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(call(handle, HIPBLAS_PIVOT_VARIABLE, -1, 4, p), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(call(handle, HIPBLAS_PIVOT_VARIABLE, 4, 4, nullptr), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(call(handle, HIPBLAS_PIVOT_VARIABLE, 1, 4, nullptr), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasSlasr(handle,
+                           HIPBLAS_SIDE_BOTH,
+                           HIPBLAS_PIVOT_VARIABLE,
+                           HIPBLAS_FORWARD_DIRECTION,
+                           4,
+                           4,
+                           p,
+                           p,
+                           p,
+                           4),
+              HIPBLAS_STATUS_INVALID_ENUM);
+
+    EXPECT_EQ(hipblas_client_destroy(handle), HIPBLAS_STATUS_SUCCESS);
+}
@@ -0,0 +1,85 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include <gtest/gtest.h>
+#include <hip/hip_runtime.h>
+
+using namespace std;
+
+/* =====================================================================
+     BLAS leading dimension advisor and pitched matrix allocation:
+=================================================================== */
+
+// Advised columns hold the rows, start 128-byte aligned and are never a power of two of at least
+// 8 KiB apart, the widest interleave in the table
+TEST(hipblas_leading_dimension, hipblas_get_optimal_leading_dimension)
+{
+    hipblasHandle_t handle;
+    ASSERT_EQ(hipblasCreate(&handle), HIPBLAS_STATUS_SUCCESS);
+
+    for(int elem : {2, 4, 8, 16})
+        for(int rows : {64, 100, 1000, 1024, 4096, 8192, 16384})
+        {
+            int ld = 0;
+            EXPECT_EQ(hipblasGetOptimalLeadingDimension(handle, rows, elem, &ld),
+                      HIPBLAS_STATUS_SUCCESS);
+            EXPECT_GE(ld, rows);
+            EXPECT_EQ(0, int64_t(ld) * elem % 128);
+
+            int64_t bytes = int64_t(ld) * elem;
+            EXPECT_FALSE(bytes >= 8192 && (bytes & (bytes - 1)) == 0) << rows << ' ' << elem;
+        }
+
+    // Columns narrower than the alignment and odd element sizes are left alone
+    int ld = 0;
+    EXPECT_EQ(hipblasGetOptimalLeadingDimension(handle, 3, 4, &ld), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(3, ld);
+    EXPECT_EQ(hipblasGetOptimalLeadingDimension(handle, 1000, 12, &ld), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(1000, ld);
+    EXPECT_EQ(hipblasGetOptimalLeadingDimension(handle, 0, 4, &ld), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(1, ld);
+
+    EXPECT_EQ(hipblasGetOptimalLeadingDimension(handle, -1, 4, &ld), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasGetOptimalLeadingDimension(handle, 8, 0, &ld), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasGetOptimalLeadingDimension(handle, 8, 4, nullptr),
+              HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasGetOptimalLeadingDimension(nullptr, 8, 4, &ld),
+              HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    EXPECT_EQ(hipblasDestroy(handle), HIPBLAS_STATUS_SUCCESS);
+}
+
+TEST(hipblas_leading_dimension, hipblas_malloc_matrix)
+{
+    hipblasHandle_t handle;
+    ASSERT_EQ(hipblasCreate(&handle), HIPBLAS_STATUS_SUCCESS);
+
+    const int rows = 1024, cols = 16;
+    void*     ptr  = nullptr;
+    int       ld   = 0, advised = 0;
+    EXPECT_EQ(hipblasMallocMatrix(handle, rows, cols, sizeof(float), &ptr, &ld),
+              HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasGetOptimalLeadingDimension(handle, rows, sizeof(float), &advised),
+              HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(advised, ld);
+    ASSERT_NE(nullptr, ptr);
+
+    // The whole padded matrix is addressable
+    EXPECT_EQ(hipMemset(ptr, 0, size_t(ld) * cols * sizeof(float)), hipSuccess);
+    EXPECT_EQ(hipFree(ptr), hipSuccess);
+
+    EXPECT_EQ(hipblasMallocMatrix(handle, rows, 0, sizeof(float), &ptr, &ld),
+              HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(nullptr, ptr);
+    EXPECT_EQ(hipblasMallocMatrix(handle, rows, -1, sizeof(float), &ptr, &ld),
+              HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasMallocMatrix(handle, rows, cols, sizeof(float), nullptr, &ld),
+              HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasMallocMatrix(nullptr, rows, cols, sizeof(float), &ptr, &ld),
+              HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    EXPECT_EQ(hipblasDestroy(handle), HIPBLAS_STATUS_SUCCESS);
+}
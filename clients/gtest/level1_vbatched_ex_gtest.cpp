@@ -0,0 +1,194 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_level1_vbatched_ex.hpp"
+#include "utility.h"
+#include <gtest/gtest.h>
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+/* =====================================================================
+     BLAS vbatched level-1 ex: axpy, axpby, scal and copy
+=================================================================== */
+
+typedef std::tuple<int, vector<int>, int> vbatched_ex_tuple;
+
+// the longest entry of the batch; the others are shorter, some empty
+const vector<int> N_range = {-1, 0, 1000, 5000};
+
+// {incx, incy}; the testers vary them across the batch
+const vector<vector<int>> incx_incy_range = {{1, 1}, {-2, 3}};
+
+const vector<int> batch_count_range = {-1, 0, 1, 7, 40, 300};
+
+Arguments setup_vbatched_ex_arguments(vbatched_ex_tuple tup)
+{
+    vector<int> incx_incy = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.N           = std::get<0>(tup);
+    arg.incx        = incx_incy[0];
+    arg.incy        = incx_incy[1];
+    arg.batch_count = std::get<2>(tup);
+
+    // small integers, so the results are exact in every type
+    arg.alpha = 2;
+    arg.beta  = -3;
+
+    return arg;
+}
+
+// the testers reject invalid sizes before the call
+static void check_vbatched_ex_status(const Arguments& arg, hipblasStatus_t status)
+{
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.N < 0 || arg.batch_count < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+        }
+    }
+}
+
+class vbatched_ex_gtest : public ::TestWithParam<vbatched_ex_tuple>
+{
+protected:
+    vbatched_ex_gtest() {}
+    virtual ~vbatched_ex_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_P(vbatched_ex_gtest, axpy_vbatched_ex_float)
+{
+    // GetParam returns a tuple. The setup routine unpacks the tuple
+    // and initializes arg(Arguments), which will be passed to testing routine.
+
+    Arguments arg = setup_vbatched_ex_arguments(GetParam());
+
+    check_vbatched_ex_status(arg, testing_axpy_vbatched_ex<float>(arg));
+}
+
+TEST_P(vbatched_ex_gtest, axpy_vbatched_ex_double)
+{
+    Arguments arg = setup_vbatched_ex_arguments(GetParam());
+
+    check_vbatched_ex_status(arg, testing_axpy_vbatched_ex<double>(arg));
+}
+
+TEST_P(vbatched_ex_gtest, axpy_vbatched_ex_bf16_float)
+{
+    Arguments arg = setup_vbatched_ex_arguments(GetParam());
+
+    check_vbatched_ex_status(arg, testing_axpy_vbatched_ex<hipblasBfloat16, float>(arg));
+}
+
+TEST_P(vbatched_ex_gtest, axpby_vbatched_ex_bf16_float)
+{
+    Arguments arg = setup_vbatched_ex_arguments(GetParam());
+
+    check_vbatched_ex_status(arg, testing_axpby_vbatched_ex<hipblasBfloat16, float>(arg));
+}
+
+TEST_P(vbatched_ex_gtest, axpby_vbatched_ex_float_bf16)
+{
+    Arguments arg = setup_vbatched_ex_arguments(GetParam());
+
+    check_vbatched_ex_status(arg,
+                             testing_axpby_vbatched_ex<float, hipblasBfloat16, float>(arg));
+}
+
+TEST_P(vbatched_ex_gtest, axpby_vbatched_ex_float_double)
+{
+    Arguments arg = setup_vbatched_ex_arguments(GetParam());
+
+    check_vbatched_ex_status(arg, testing_axpby_vbatched_ex<float, double>(arg));
+}
+
+TEST_P(vbatched_ex_gtest, scal_vbatched_ex_double)
+{
+    Arguments arg = setup_vbatched_ex_arguments(GetParam());
+
+    check_vbatched_ex_status(arg, testing_scal_vbatched_ex<double>(arg));
+}
+
+TEST_P(vbatched_ex_gtest, scal_vbatched_ex_bf16_float)
+{
+    Arguments arg = setup_vbatched_ex_arguments(GetParam());
+
+    check_vbatched_ex_status(arg, testing_scal_vbatched_ex<hipblasBfloat16, float>(arg));
+}
+
+TEST_P(vbatched_ex_gtest, copy_vbatched_ex_double_bf16)
+{
+    Arguments arg = setup_vbatched_ex_arguments(GetParam());
+
+    check_vbatched_ex_status(arg, testing_copy_vbatched_ex<double, hipblasBfloat16>(arg));
+}
+
+TEST_P(vbatched_ex_gtest, copy_vbatched_ex_float_double)
+{
+    Arguments arg = setup_vbatched_ex_arguments(GetParam());
+
+    check_vbatched_ex_status(arg, testing_copy_vbatched_ex<float, double>(arg));
+}
+
+// The combinations are  { N, {incx, incy}, batch_count }
+
+INSTANTIATE_TEST_CASE_P(hipblasVbatchedEx,
+                        vbatched_ex_gtest,
+                        Combine(ValuesIn(N_range),
+                                ValuesIn(incx_incy_range),
+                                ValuesIn(batch_count_range)));
+
+TEST(hipblas_vbatched_ex, bad_arg)
+{
+    hipblasHandle_t handle;
+    ASSERT_EQ(hipblas_client_create(&handle), HIPBLAS_STATUS_SUCCESS);
+
+    // Only the host sees these; the arrays are never read
+    int               n[1];
+    float             alpha = 1;
+    void*             x[1];
+    void*             y[1];
+    const void**      cx  = const_cast<const void**>(x);
+    hipblasDatatype_t r32 = HIPBLAS_R_32F;
+
+    EXPECT_EQ(hipblasAxpyVbatchedEx(nullptr, n, &alpha, cx, r32, n, y, r32, n, 1, r32),
+              HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_EQ(hipblasAxpyVbatchedEx(handle, n, &alpha, cx, HIPBLAS_C_32F, n, y, r32, n, 1, r32),
+              HIPBLAS_STATUS_NOT_SUPPORTED);
+    EXPECT_EQ(hipblasCopyVbatchedEx(handle, n, cx, r32, n, y, HIPBLAS_R_8I, n, 1),
+              HIPBLAS_STATUS_NOT_SUPPORTED);
+    EXPECT_EQ(hipblasAxpyVbatchedEx(handle, n, &alpha, cx, r32, n, y, r32, n, -1, r32),
+              HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasAxpyVbatchedEx(handle, n, &alpha, nullptr, r32, n, y, r32, n, 1, r32),
+              HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasAxpbyVbatchedEx(handle, n, &alpha, cx, r32, n, nullptr, y, r32, n, 1, r32),
+              HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasScalVbatchedEx(handle, n, nullptr, x, r32, n, 1, r32),
+              HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasCopyVbatchedEx(handle, nullptr, cx, r32, n, y, r32, n, 1),
+              HIPBLAS_STATUS_INVALID_VALUE);
+
+    // An empty batch looks at nothing
+    EXPECT_EQ(hipblasAxpyVbatchedEx(
+                  handle, nullptr, nullptr, nullptr, r32, nullptr, nullptr, r32, nullptr, 0, r32),
+              HIPBLAS_STATUS_SUCCESS);
+
+    EXPECT_EQ(hipblas_client_destroy(handle), HIPBLAS_STATUS_SUCCESS);
+}
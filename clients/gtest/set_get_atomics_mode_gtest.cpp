@@ -0,0 +1,33 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include <gtest/gtest.h>
+
+using namespace std;
+
+/* =====================================================================
+     BLAS set-get_atomics_mode:
+=================================================================== */
+
+TEST(hipblas_set_atomics_mode, hipblas_get_atomics_mode)
+{
+    hipblasAtomicsMode_t mode = HIPBLAS_ATOMICS_ALLOWED;
+
+    hipblasHandle_t handle;
+    hipblasCreate(&handle);
+
+    EXPECT_EQ(hipblasSetAtomicsMode(handle, HIPBLAS_ATOMICS_NOT_ALLOWED), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasGetAtomicsMode(handle, &mode), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(HIPBLAS_ATOMICS_NOT_ALLOWED, mode);
+
+    EXPECT_EQ(hipblasSetAtomicsMode(handle, HIPBLAS_ATOMICS_ALLOWED), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasGetAtomicsMode(handle, &mode), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(HIPBLAS_ATOMICS_ALLOWED, mode);
+
+    EXPECT_EQ(hipblasGetAtomicsMode(handle, nullptr), HIPBLAS_STATUS_INVALID_VALUE);
+
+    hipblasDestroy(handle);
+}
@@ -0,0 +1,63 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include <gtest/gtest.h>
+#include <hip/hip_runtime_api.h>
+
+using namespace std;
+
+/* =====================================================================
+     BLAS set-get_capture_mode:
+=================================================================== */
+
+TEST(hipblas_set_capture_mode, hipblas_get_capture_mode)
+{
+    hipblasCaptureMode_t mode = HIPBLAS_CAPTURE_MODE_SAFE;
+
+    hipblasHandle_t handle;
+    hipblasCreate(&handle);
+
+    // handles start in the default mode
+    EXPECT_EQ(hipblasGetCaptureMode(handle, &mode), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(HIPBLAS_CAPTURE_MODE_DEFAULT, mode);
+
+    EXPECT_EQ(hipblasSetCaptureMode(handle, HIPBLAS_CAPTURE_MODE_SAFE), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasGetCaptureMode(handle, &mode), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(HIPBLAS_CAPTURE_MODE_SAFE, mode);
+
+    EXPECT_EQ(hipblasSetCaptureMode(handle, hipblasCaptureMode_t(-1)), HIPBLAS_STATUS_INVALID_ENUM);
+    EXPECT_EQ(hipblasGetCaptureMode(handle, nullptr), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasGetCaptureMode(nullptr, &mode), HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_EQ(hipblasSetCaptureMode(nullptr, HIPBLAS_CAPTURE_MODE_SAFE),
+              HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    hipblasDestroy(handle);
+}
+
+TEST(hipblas_set_capture_mode, hipblas_capture_mode_keeps_workspace)
+{
+    size_t size = 1;
+
+    hipblasHandle_t handle;
+    hipblasCreate(&handle);
+
+    const size_t user_size = 1 << 20;
+    void*        user_ws   = nullptr;
+    ASSERT_EQ(hipMalloc(&user_ws, user_size), hipSuccess);
+
+    // switching modes leaves a user workspace in place, so calls can keep carving from it
+    EXPECT_EQ(hipblasSetWorkspace(handle, user_ws, user_size), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasSetCaptureMode(handle, HIPBLAS_CAPTURE_MODE_SAFE), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasGetWorkspaceSize(handle, &size), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(size, user_size);
+
+    EXPECT_EQ(hipblasSetCaptureMode(handle, HIPBLAS_CAPTURE_MODE_DEFAULT), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasGetWorkspaceSize(handle, &size), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(size, user_size);
+
+    hipblasDestroy(handle);
+    EXPECT_EQ(hipFree(user_ws), hipSuccess);
+}
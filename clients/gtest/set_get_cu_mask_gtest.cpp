@@ -0,0 +1,90 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include <gtest/gtest.h>
+#include <hip/hip_runtime_api.h>
+
+using namespace std;
+
+/* =====================================================================
+     BLAS set-get_cu_mask:
+=================================================================== */
+
+TEST(hipblas_set_cu_mask, hipblas_get_cu_mask)
+{
+    hipblasHandle_t handle;
+    hipblasCreate(&handle);
+
+    uint32_t    mask[2] = {0x0f, 0};
+    uint32_t    got[2]  = {0, 0};
+    int         count   = -1;
+    hipStream_t stream  = nullptr;
+
+    EXPECT_EQ(hipblasGetCUMask(handle, 2, got, &count), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(0, count);
+
+#ifdef __HIP_PLATFORM_NVCC__
+    EXPECT_EQ(hipblasSetCUMask(handle, 1, mask), HIPBLAS_STATUS_NOT_SUPPORTED);
+#else
+    // the handle moves to a masked stream of its own, and so do the streams it creates
+    EXPECT_EQ(hipblasSetIndependentStreams(handle, 2), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasSetCUMask(handle, 2, mask), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasGetCUMask(handle, 2, got, &count), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(2, count);
+    EXPECT_EQ(mask[0], got[0]);
+    EXPECT_EQ(mask[1], got[1]);
+    EXPECT_EQ(hipblasGetCUMask(handle, 0, nullptr, &count), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(2, count);
+
+    EXPECT_EQ(hipblasGetStream(handle, &stream), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_NE(nullptr, stream);
+
+    hipblasHandle_t independent;
+    hipStream_t     lane = nullptr;
+    EXPECT_EQ(hipblasGetIndependentHandle(handle, &independent), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasGetStream(independent, &lane), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_NE(nullptr, lane);
+    EXPECT_NE(stream, lane);
+    EXPECT_EQ(hipblasSynchronizeHandle(handle), HIPBLAS_STATUS_SUCCESS);
+
+    // work on the masked stream runs as before
+    float  x      = 2;
+    float  result = 0;
+    float* dx     = nullptr;
+    ASSERT_EQ(hipMalloc(&dx, sizeof(float)), hipSuccess);
+    EXPECT_EQ(hipMemcpy(dx, &x, sizeof(float), hipMemcpyHostToDevice), hipSuccess);
+    EXPECT_EQ(hipblasSdot(handle, 1, dx, 1, dx, 1, &result), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(4.0f, result);
+    EXPECT_EQ(hipFree(dx), hipSuccess);
+
+    // a mask and a priority exclude each other
+    EXPECT_EQ(hipblasSetStreamPriority(handle, HIPBLAS_STREAM_PRIORITY_HIGH),
+              HIPBLAS_STATUS_NOT_SUPPORTED);
+
+    // back on the null stream
+    EXPECT_EQ(hipblasSetCUMask(handle, 0, nullptr), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasGetStream(handle, &stream), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(nullptr, stream);
+    EXPECT_EQ(hipblasGetCUMask(handle, 2, got, &count), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(0, count);
+
+    EXPECT_EQ(hipblasSetStreamPriority(handle, HIPBLAS_STREAM_PRIORITY_HIGH),
+              HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasSetCUMask(handle, 1, mask), HIPBLAS_STATUS_NOT_SUPPORTED);
+    EXPECT_EQ(hipblasSetStreamPriority(handle, HIPBLAS_STREAM_PRIORITY_DEFAULT),
+              HIPBLAS_STATUS_SUCCESS);
+#endif
+
+    EXPECT_EQ(hipblasSetCUMask(handle, -1, mask), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasSetCUMask(handle, 1, nullptr), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasSetCUMask(handle, 1, mask + 1), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasGetCUMask(handle, 1, nullptr, &count), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasGetCUMask(handle, 2, got, nullptr), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasSetCUMask(nullptr, 1, mask), HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_EQ(hipblasGetCUMask(nullptr, 2, got, &count), HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    hipblasDestroy(handle);
+}
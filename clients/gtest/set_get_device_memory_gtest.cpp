@@ -0,0 +1,69 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include <gtest/gtest.h>
+#include <hip/hip_runtime_api.h>
+
+using namespace std;
+
+/* =====================================================================
+     BLAS set-get_device_memory_size:
+=================================================================== */
+
+TEST(hipblas_set_device_memory, hipblas_device_memory_size_query)
+{
+    hipblasHandle_t handle;
+    hipblasCreate(&handle);
+
+    const int n = 256;
+    float *   dA, *dB, *dC;
+    ASSERT_EQ(hipMalloc(&dA, sizeof(float) * n * n), hipSuccess);
+    ASSERT_EQ(hipMalloc(&dB, sizeof(float) * n * n), hipSuccess);
+    ASSERT_EQ(hipMalloc(&dC, sizeof(float) * n * n), hipSuccess);
+
+    size_t size = 0;
+#ifdef __HIP_PLATFORM_NVCC__
+    EXPECT_EQ(hipblasGetDeviceMemorySize(handle, &size), HIPBLAS_STATUS_NOT_SUPPORTED);
+    EXPECT_EQ(hipblasSetDeviceMemorySize(handle, 1 << 20), HIPBLAS_STATUS_NOT_SUPPORTED);
+    EXPECT_EQ(hipblasStartDeviceMemorySizeQuery(handle), HIPBLAS_STATUS_NOT_SUPPORTED);
+#else
+    // calls inside the query only record their memory needs
+    float alpha = 1, beta = 0;
+    EXPECT_EQ(hipblasStartDeviceMemorySizeQuery(handle), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(
+        hipblasSgemm(
+            handle, HIPBLAS_OP_N, HIPBLAS_OP_N, n, n, n, &alpha, dA, n, dB, n, &beta, dC, n),
+        HIPBLAS_STATUS_SUCCESS);
+    size_t needed = 0;
+    EXPECT_EQ(hipblasStopDeviceMemorySizeQuery(handle, &needed), HIPBLAS_STATUS_SUCCESS);
+
+    // stopping a query that was never started is rejected
+    EXPECT_EQ(hipblasStopDeviceMemorySizeQuery(handle, &size), HIPBLAS_STATUS_INVALID_VALUE);
+
+    const size_t fixed = needed + (1 << 20);
+    EXPECT_EQ(hipblasSetDeviceMemorySize(handle, fixed), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasGetDeviceMemorySize(handle, &size), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_GE(size, fixed);
+    EXPECT_EQ(
+        hipblasSgemm(
+            handle, HIPBLAS_OP_N, HIPBLAS_OP_N, n, n, n, &alpha, dA, n, dB, n, &beta, dC, n),
+        HIPBLAS_STATUS_SUCCESS);
+
+    // back to memory managed by the backend
+    EXPECT_EQ(hipblasSetDeviceMemorySize(handle, 0), HIPBLAS_STATUS_SUCCESS);
+#endif
+
+    EXPECT_EQ(hipblasGetDeviceMemorySize(handle, nullptr), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasStopDeviceMemorySizeQuery(handle, nullptr), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasGetDeviceMemorySize(nullptr, &size), HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_EQ(hipblasSetDeviceMemorySize(nullptr, 0), HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_EQ(hipblasStartDeviceMemorySizeQuery(nullptr), HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    hipblasDestroy(handle);
+    EXPECT_EQ(hipFree(dA), hipSuccess);
+    EXPECT_EQ(hipFree(dB), hipSuccess);
+    EXPECT_EQ(hipFree(dC), hipSuccess);
+}
@@ -0,0 +1,39 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include <gtest/gtest.h>
+
+using namespace std;
+
+/* =====================================================================
+     BLAS set-get_gemm_backend:
+=================================================================== */
+
+TEST(hipblas_set_gemm_backend, hipblas_get_gemm_backend)
+{
+    hipblasGemmBackend_t backend = HIPBLAS_GEMM_BACKEND_LT;
+
+    hipblasHandle_t handle;
+    hipblasCreate(&handle);
+
+    EXPECT_EQ(hipblasGetGemmBackend(handle, &backend), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(HIPBLAS_GEMM_BACKEND_DEFAULT, backend);
+
+    EXPECT_EQ(hipblasSetGemmBackend(handle, HIPBLAS_GEMM_BACKEND_LT), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasGetGemmBackend(handle, &backend), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(HIPBLAS_GEMM_BACKEND_LT, backend);
+
+    EXPECT_EQ(hipblasSetGemmBackend(handle, HIPBLAS_GEMM_BACKEND_DEFAULT), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasGetGemmBackend(handle, &backend), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(HIPBLAS_GEMM_BACKEND_DEFAULT, backend);
+
+    EXPECT_EQ(hipblasSetGemmBackend(handle, hipblasGemmBackend_t(2)), HIPBLAS_STATUS_INVALID_ENUM);
+    EXPECT_EQ(hipblasGetGemmBackend(handle, nullptr), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasSetGemmBackend(nullptr, HIPBLAS_GEMM_BACKEND_LT),
+              HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    hipblasDestroy(handle);
+}
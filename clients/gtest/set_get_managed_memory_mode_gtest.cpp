@@ -0,0 +1,65 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include <gtest/gtest.h>
+#include <hip/hip_runtime.h>
+
+using namespace std;
+
+/* =====================================================================
+     BLAS set-get_managed_memory_mode:
+=================================================================== */
+
+TEST(hipblas_set_managed_memory_mode, hipblas_get_managed_memory_mode)
+{
+    hipblasManagedMemoryMode_t mode = HIPBLAS_MANAGED_MEMORY_PREFETCH;
+
+    hipblasHandle_t handle;
+    hipblasCreate(&handle);
+
+    EXPECT_EQ(hipblasGetManagedMemoryMode(handle, &mode), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(HIPBLAS_MANAGED_MEMORY_DEFAULT, mode);
+
+    EXPECT_EQ(hipblasSetManagedMemoryMode(handle, HIPBLAS_MANAGED_MEMORY_PREFETCH),
+              HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasGetManagedMemoryMode(handle, &mode), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(HIPBLAS_MANAGED_MEMORY_PREFETCH, mode);
+
+    EXPECT_EQ(hipblasSetManagedMemoryMode(handle, hipblasManagedMemoryMode_t(2)),
+              HIPBLAS_STATUS_INVALID_ENUM);
+    EXPECT_EQ(hipblasGetManagedMemoryMode(handle, nullptr), HIPBLAS_STATUS_INVALID_VALUE);
+
+    hipblasDestroy(handle);
+}
+
+// Prefetching changes where pages live, never the result; host operands are skipped
+TEST(hipblas_managed_memory_mode, managed_axpy)
+{
+    const int n     = 1000;
+    float     alpha = 2.0f;
+    float *   x, *y;
+    ASSERT_EQ(hipMallocManaged(&x, n * sizeof(float)), hipSuccess);
+    ASSERT_EQ(hipMallocManaged(&y, n * sizeof(float)), hipSuccess);
+    for(int i = 0; i < n; i++)
+    {
+        x[i] = float(i);
+        y[i] = 1.0f;
+    }
+
+    hipblasHandle_t handle;
+    hipblasCreate(&handle);
+    EXPECT_EQ(hipblasSetManagedMemoryMode(handle, HIPBLAS_MANAGED_MEMORY_PREFETCH),
+              HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasSaxpy(handle, n, &alpha, x, 1, y, 1), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipDeviceSynchronize(), hipSuccess);
+
+    for(int i = 0; i < n; i++)
+        EXPECT_EQ(1.0f + 2.0f * i, y[i]);
+
+    hipblasDestroy(handle);
+    EXPECT_EQ(hipFree(x), hipSuccess);
+    EXPECT_EQ(hipFree(y), hipSuccess);
+}
@@ -0,0 +1,119 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include <gtest/gtest.h>
+
+using namespace std;
+
+/* =====================================================================
+     BLAS set-get_math_mode:
+=================================================================== */
+
+TEST(hipblas_set_math_mode, hipblas_get_math_mode)
+{
+    hipblasMath_t mode = HIPBLAS_TF32_TENSOR_OP_MATH;
+
+    hipblasHandle_t handle;
+    hipblasCreate(&handle);
+
+    EXPECT_EQ(hipblasGetMathMode(handle, &mode), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(HIPBLAS_DEFAULT_MATH, mode);
+
+    hipblasMath_t both = hipblasMath_t(HIPBLAS_TF32_TENSOR_OP_MATH | HIPBLAS_FP16_ACCUMULATE_MATH);
+    EXPECT_EQ(hipblasSetMathMode(handle, both), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasGetMathMode(handle, &mode), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(both, mode);
+
+    EXPECT_EQ(hipblasSetMathMode(handle, HIPBLAS_BF16X3_MATH), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasGetMathMode(handle, &mode), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(HIPBLAS_BF16X3_MATH, mode);
+
+    EXPECT_EQ(hipblasSetMathMode(handle, HIPBLAS_INT8_FP64_MATH), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasGetMathMode(handle, &mode), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(HIPBLAS_INT8_FP64_MATH, mode);
+
+    hipblasMath_t flush = hipblasMath_t(HIPBLAS_FLUSH_DENORM_MATH | HIPBLAS_BF16X3_MATH);
+    EXPECT_EQ(hipblasSetMathMode(handle, flush), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasGetMathMode(handle, &mode), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(flush, mode);
+
+    EXPECT_EQ(hipblasSetMathMode(handle, HIPBLAS_DEFAULT_MATH), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasGetMathMode(handle, &mode), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(HIPBLAS_DEFAULT_MATH, mode);
+
+    EXPECT_EQ(hipblasSetMathMode(handle, hipblasMath_t(32)), HIPBLAS_STATUS_INVALID_ENUM);
+    EXPECT_EQ(hipblasGetMathMode(handle, nullptr), HIPBLAS_STATUS_INVALID_VALUE);
+
+    hipblasDestroy(handle);
+}
+
+TEST(hipblas_set_emulation_slices, hipblas_get_emulation_slices)
+{
+    int slices = 0;
+
+    hipblasHandle_t handle;
+    hipblasCreate(&handle);
+
+    EXPECT_EQ(hipblasGetEmulationSlices(handle, &slices), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(7, slices);
+
+    EXPECT_EQ(hipblasSetEmulationSlices(handle, 16), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasGetEmulationSlices(handle, &slices), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(16, slices);
+
+    EXPECT_EQ(hipblasSetEmulationSlices(handle, 0), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasSetEmulationSlices(handle, 17), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasGetEmulationSlices(handle, &slices), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(16, slices);
+    EXPECT_EQ(hipblasGetEmulationSlices(handle, nullptr), HIPBLAS_STATUS_INVALID_VALUE);
+
+    hipblasDestroy(handle);
+}
+
+TEST(hipblas_set_gemm_split_k, hipblas_get_gemm_split_k)
+{
+    int splits = 0;
+
+    hipblasHandle_t handle;
+    hipblasCreate(&handle);
+
+    EXPECT_EQ(hipblasGetGemmSplitK(handle, &splits), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(1, splits);
+
+    EXPECT_EQ(hipblasSetGemmSplitK(handle, 0), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasGetGemmSplitK(handle, &splits), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(0, splits);
+
+    EXPECT_EQ(hipblasSetGemmSplitK(handle, -1), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasGetGemmSplitK(handle, &splits), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(0, splits);
+    EXPECT_EQ(hipblasGetGemmSplitK(handle, nullptr), HIPBLAS_STATUS_INVALID_VALUE);
+
+    hipblasDestroy(handle);
+}
+
+TEST(hipblas_set_gemm_tiny_limit, hipblas_get_gemm_tiny_limit)
+{
+    int limit = 0;
+
+    hipblasHandle_t handle;
+    hipblasCreate(&handle);
+
+    EXPECT_EQ(hipblasGetGemmTinyLimit(handle, &limit), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(16, limit);
+
+    EXPECT_EQ(hipblasSetGemmTinyLimit(handle, 0), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasGetGemmTinyLimit(handle, &limit), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(0, limit);
+
+    EXPECT_EQ(hipblasSetGemmTinyLimit(handle, -1), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasSetGemmTinyLimit(handle, 17), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasGetGemmTinyLimit(handle, &limit), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(0, limit);
+    EXPECT_EQ(hipblasGetGemmTinyLimit(handle, nullptr), HIPBLAS_STATUS_INVALID_VALUE);
+
+    hipblasDestroy(handle);
+}
@@ -0,0 +1,82 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_set_get_matrix_batched.hpp"
+#include "utility.h"
+#include <gtest/gtest.h>
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, vector<int>, int> set_get_matrix_batched_tuple;
+
+// {rows, cols}
+const vector<vector<int>> rows_cols_range = {{3, 3}, {3, 30}, {33, 7}};
+
+// {lda, ldb, ldc}, as offsets past rows so each set covers all sizes
+const vector<vector<int>> lda_ldb_ldc_range = {{0, 0, 0}, {0, 2, 1}, {2, 0, 3}, {1, 1, 0}};
+
+// Large enough batches span several staging chunks of the larger sizes
+const vector<int> batch_count_range = {0, 1, 5, 3000};
+
+Arguments setup_set_get_matrix_batched_arguments(set_get_matrix_batched_tuple tup)
+{
+    vector<int> rows_cols   = std::get<0>(tup);
+    vector<int> lda_ldb_ldc = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.rows = rows_cols[0];
+    arg.cols = rows_cols[1];
+
+    arg.lda = arg.rows + lda_ldb_ldc[0];
+    arg.ldb = arg.rows + lda_ldb_ldc[1];
+    arg.ldc = arg.rows + lda_ldb_ldc[2];
+
+    arg.batch_count = std::get<2>(tup);
+
+    return arg;
+}
+
+class set_get_matrix_batched_gtest : public ::TestWithParam<set_get_matrix_batched_tuple>
+{
+protected:
+    set_get_matrix_batched_gtest() {}
+    virtual ~set_get_matrix_batched_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_P(set_get_matrix_batched_gtest, float)
+{
+    Arguments arg = setup_set_get_matrix_batched_arguments(GetParam());
+
+    hipblasStatus_t status = testing_set_get_matrix_batched<float>(arg);
+
+    EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+}
+
+TEST_P(set_get_matrix_batched_gtest, double)
+{
+    Arguments arg = setup_set_get_matrix_batched_arguments(GetParam());
+
+    hipblasStatus_t status = testing_set_get_matrix_batched<double>(arg);
+
+    EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+}
+
+// The combinations are  { {rows, cols}, {lda, ldb, ldc}, batch_count }
+
+INSTANTIATE_TEST_CASE_P(hipblasAuxiliary_batched,
+                        set_get_matrix_batched_gtest,
+                        Combine(ValuesIn(rows_cols_range),
+                                ValuesIn(lda_ldb_ldc_range),
+                                ValuesIn(batch_count_range)));
@@ -0,0 +1,101 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include <gtest/gtest.h>
+#include <hip/hip_runtime_api.h>
+#include <vector>
+
+using namespace std;
+
+/* =====================================================================
+     BLAS set-get_pointer_array_mode:
+=================================================================== */
+
+TEST(hipblas_set_pointer_array_mode, hipblas_get_pointer_array_mode)
+{
+    hipblasPointerArrayMode_t mode = HIPBLAS_POINTER_ARRAY_HOST;
+
+    hipblasHandle_t handle;
+    hipblasCreate(&handle);
+
+    // handles start with device pointer arrays
+    EXPECT_EQ(hipblasGetPointerArrayMode(handle, &mode), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(HIPBLAS_POINTER_ARRAY_DEVICE, mode);
+
+    EXPECT_EQ(hipblasSetPointerArrayMode(handle, HIPBLAS_POINTER_ARRAY_HOST),
+              HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasGetPointerArrayMode(handle, &mode), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(HIPBLAS_POINTER_ARRAY_HOST, mode);
+
+    EXPECT_EQ(hipblasSetPointerArrayMode(handle, hipblasPointerArrayMode_t(-1)),
+              HIPBLAS_STATUS_INVALID_ENUM);
+    EXPECT_EQ(hipblasGetPointerArrayMode(handle, nullptr), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasGetPointerArrayMode(nullptr, &mode), HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_EQ(hipblasSetPointerArrayMode(nullptr, HIPBLAS_POINTER_ARRAY_HOST),
+              HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    hipblasDestroy(handle);
+}
+
+TEST(hipblas_set_pointer_array_mode, hipblas_host_pointer_arrays)
+{
+    const int n = 64, batch_count = 5;
+
+    hipblasHandle_t handle;
+    hipblasCreate(&handle);
+    EXPECT_EQ(hipblasSetPointerArrayMode(handle, HIPBLAS_POINTER_ARRAY_HOST),
+              HIPBLAS_STATUS_SUCCESS);
+
+    float* dx = nullptr;
+    float* dy = nullptr;
+    ASSERT_EQ(hipMalloc(&dx, sizeof(float) * n * batch_count), hipSuccess);
+    ASSERT_EQ(hipMalloc(&dy, sizeof(float) * n * batch_count), hipSuccess);
+
+    vector<float> hx(n * batch_count), hy(n * batch_count);
+    for(int i = 0; i < n * batch_count; i++)
+    {
+        hx[i] = float(i % 7);
+        hy[i] = float(i % 5);
+    }
+    EXPECT_EQ(hipMemcpy(dx, hx.data(), sizeof(float) * hx.size(), hipMemcpyHostToDevice),
+              hipSuccess);
+    EXPECT_EQ(hipMemcpy(dy, hy.data(), sizeof(float) * hy.size(), hipMemcpyHostToDevice),
+              hipSuccess);
+
+    // more calls than the handle has staging slots, each reusing the same host arrays, which may
+    // change as soon as the call returns
+    const float alpha = 2.0f;
+    const int   calls = 20;
+    float*      x[batch_count];
+    float*      y[batch_count];
+    for(int c = 0; c < calls; c++)
+    {
+        for(int b = 0; b < batch_count; b++)
+        {
+            x[b] = dx + b * n;
+            y[b] = dy + b * n;
+        }
+        EXPECT_EQ(hipblasSaxpyBatched(handle, n, &alpha, x, 1, y, 1, batch_count),
+                  HIPBLAS_STATUS_SUCCESS);
+        for(int b = 0; b < batch_count; b++)
+            x[b] = y[b] = nullptr;
+    }
+
+    vector<float> result(n * batch_count);
+    EXPECT_EQ(hipMemcpy(result.data(), dy, sizeof(float) * result.size(), hipMemcpyDeviceToHost),
+              hipSuccess);
+    for(int i = 0; i < n * batch_count; i++)
+        EXPECT_EQ(result[i], hy[i] + calls * alpha * hx[i]);
+
+    // staging is never captured, since replays would read whatever the pinned slots hold by then
+    EXPECT_EQ(hipblasSetCaptureMode(handle, HIPBLAS_CAPTURE_MODE_SAFE), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasSaxpyBatched(handle, n, &alpha, x, 1, y, 1, batch_count),
+              HIPBLAS_STATUS_NOT_SUPPORTED);
+
+    hipblasDestroy(handle);
+    EXPECT_EQ(hipFree(dx), hipSuccess);
+    EXPECT_EQ(hipFree(dy), hipSuccess);
+}
@@ -48,3 +48,27 @@ TEST(hipblas_set_pointer, hipblas_get_pointer)
 
     hipblasDestroy(handle);
 }
+
+TEST(hipblas_set_pointer, hipblas_pointer_mode_cached)
+{
+    hipblasPointerMode_t mode = HIPBLAS_POINTER_MODE_DEVICE;
+
+    hipblasHandle_t handle;
+    hipblasCreate(&handle);
+
+    // handles start in host mode; repeated sets of the same mode are no-ops
+    EXPECT_EQ(hipblasGetPointerMode(handle, &mode), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(HIPBLAS_POINTER_MODE_HOST, mode);
+    EXPECT_EQ(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasGetPointerMode(handle, &mode), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(HIPBLAS_POINTER_MODE_DEVICE, mode);
+
+    EXPECT_EQ(hipblasGetPointerMode(handle, nullptr), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasGetPointerMode(nullptr, &mode), HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_EQ(hipblasSetPointerMode(nullptr, HIPBLAS_POINTER_MODE_HOST),
+              HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    hipblasDestroy(handle);
+}
@@ -0,0 +1,109 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include <cmath>
+#include <gtest/gtest.h>
+#include <hip/hip_runtime_api.h>
+#include <vector>
+
+using namespace std;
+
+/* =====================================================================
+     BLAS set-get_result_mode:
+=================================================================== */
+
+TEST(hipblas_set_result_mode, hipblas_get_result_mode)
+{
+    const int     n = 1000;
+    vector<float> hx(n);
+    for(int i = 0; i < n; i++)
+        hx[i] = float(i % 7) - 3.0f;
+    hx[417] = 11.0f;
+
+    float* dx;
+    ASSERT_EQ(hipMalloc(&dx, n * sizeof(float)), hipSuccess);
+    EXPECT_EQ(hipMemcpy(dx, hx.data(), n * sizeof(float), hipMemcpyHostToDevice), hipSuccess);
+
+    double dot = 0, asum = 0;
+    for(int i = 0; i < n; i++)
+    {
+        dot += double(hx[i]) * hx[i];
+        asum += std::abs(hx[i]);
+    }
+
+    hipblasHandle_t handle;
+    hipblasCreate(&handle);
+
+    hipblasResultMode_t mode = HIPBLAS_RESULT_MODE_ASYNC;
+    EXPECT_EQ(hipblasGetResultMode(handle, &mode), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(HIPBLAS_RESULT_MODE_BLOCKING, mode);
+
+    EXPECT_EQ(hipblasSetResultMode(handle, HIPBLAS_RESULT_MODE_ASYNC), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasGetResultMode(handle, &mode), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(HIPBLAS_RESULT_MODE_ASYNC, mode);
+
+    // the variables keep their values until the results are delivered
+    float   rdot = -1, rnrm2 = -1, rasum = -1;
+    int     amax = -1;
+    int64_t amax_64 = -1;
+    EXPECT_EQ(hipblasSdot(handle, n, dx, 1, dx, 1, &rdot), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasSnrm2(handle, n, dx, 1, &rnrm2), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasSasum_64(handle, n, dx, 1, &rasum), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasIsamax(handle, n, dx, 1, &amax), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(-1.0f, rdot);
+    EXPECT_EQ(-1.0f, rnrm2);
+    EXPECT_EQ(-1.0f, rasum);
+    EXPECT_EQ(-1, amax);
+
+    // amax_64 converts its result on the host, so it stores it before returning
+    EXPECT_EQ(hipblasIsamax_64(handle, n, dx, 1, &amax_64), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(418, amax_64);
+
+    EXPECT_EQ(hipblasSynchronizeResults(handle), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_NEAR(dot, rdot, 1e-3 * dot);
+    EXPECT_NEAR(std::sqrt(dot), rnrm2, 1e-3 * std::sqrt(dot));
+    EXPECT_NEAR(asum, rasum, 1e-3 * asum);
+    EXPECT_EQ(418, amax);
+
+    // more reductions than slots deliver as they go, and every one lands in its own variable
+    vector<float> norms(600, -1.0f);
+    for(size_t i = 0; i < norms.size(); i++)
+        EXPECT_EQ(hipblasSnrm2(handle, int(i % n) + 1, dx, 1, &norms[i]), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasSynchronizeResults(handle), HIPBLAS_STATUS_SUCCESS);
+    for(size_t i = 0; i < norms.size(); i++)
+    {
+        double ss = 0;
+        for(size_t j = 0; j <= i % n; j++)
+            ss += double(hx[j]) * hx[j];
+        EXPECT_NEAR(std::sqrt(ss), norms[i], 1e-3 * std::sqrt(ss) + 1e-6);
+    }
+
+    // in device pointer mode the result is written by the device as usual
+    float* dresult;
+    ASSERT_EQ(hipMalloc(&dresult, sizeof(float)), hipSuccess);
+    EXPECT_EQ(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasSasum(handle, n, dx, 1, dresult), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipMemcpy(&rasum, dresult, sizeof(float), hipMemcpyDeviceToHost), hipSuccess);
+    EXPECT_NEAR(asum, rasum, 1e-3 * asum);
+    EXPECT_EQ(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST), HIPBLAS_STATUS_SUCCESS);
+
+    // blocking mode stores results before returning again
+    EXPECT_EQ(hipblasSetResultMode(handle, HIPBLAS_RESULT_MODE_BLOCKING), HIPBLAS_STATUS_SUCCESS);
+    rdot = -1;
+    EXPECT_EQ(hipblasSdot(handle, n, dx, 1, dx, 1, &rdot), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_NEAR(dot, rdot, 1e-3 * dot);
+    EXPECT_EQ(hipblasSynchronizeResults(handle), HIPBLAS_STATUS_SUCCESS);
+
+    EXPECT_EQ(hipblasSetResultMode(handle, hipblasResultMode_t(2)), HIPBLAS_STATUS_INVALID_ENUM);
+    EXPECT_EQ(hipblasGetResultMode(handle, nullptr), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasSetResultMode(nullptr, HIPBLAS_RESULT_MODE_ASYNC),
+              HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_EQ(hipblasSynchronizeResults(nullptr), HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    hipblasDestroy(handle);
+    EXPECT_EQ(hipFree(dresult), hipSuccess);
+    EXPECT_EQ(hipFree(dx), hipSuccess);
+}
@@ -0,0 +1,118 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include <gtest/gtest.h>
+#include <hip/hip_runtime_api.h>
+#include <vector>
+
+using namespace std;
+
+/* =====================================================================
+     BLAS set-get_scalar_stride:
+=================================================================== */
+
+TEST(hipblas_set_scalar_stride, hipblas_get_scalar_stride)
+{
+    int64_t stride = 1;
+
+    hipblasHandle_t handle;
+    hipblasCreate(&handle);
+
+    // handles start with the same scalars for every batch
+    EXPECT_EQ(hipblasGetScalarStride(handle, &stride), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(stride, 0);
+
+    EXPECT_EQ(hipblasSetScalarStride(handle, 2), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasGetScalarStride(handle, &stride), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(stride, 2);
+
+    EXPECT_EQ(hipblasSetScalarStride(handle, -1), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasGetScalarStride(handle, nullptr), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasGetScalarStride(nullptr, &stride), HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_EQ(hipblasSetScalarStride(nullptr, 1), HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    hipblasDestroy(handle);
+}
+
+TEST(hipblas_set_scalar_stride, hipblas_per_batch_scalars)
+{
+    const int m = 19, n = 7, k = 11, batch_count = 4;
+    const int stride_a = m * k, stride_b = k * n, stride_c = m * n;
+
+    hipblasHandle_t handle;
+    hipblasCreate(&handle);
+
+    vector<float> hA(stride_a * batch_count), hB(stride_b * batch_count),
+        hC(stride_c * batch_count);
+    for(size_t i = 0; i < hA.size(); i++)
+        hA[i] = float(int(i % 5) - 2);
+    for(size_t i = 0; i < hB.size(); i++)
+        hB[i] = float(int(i % 3) - 1);
+    for(size_t i = 0; i < hC.size(); i++)
+        hC[i] = float(i % 4);
+
+    // alpha and beta of batch b at 2 * b, so the odd entries are never read
+    vector<float> h_alpha(2 * batch_count, 100.0f), h_beta(2 * batch_count, 100.0f);
+    for(int b = 0; b < batch_count; b++)
+    {
+        h_alpha[2 * b] = float(b + 1);
+        h_beta[2 * b]  = b == 1 ? 0.0f : 0.5f * b;
+    }
+
+    float *dA, *dB, *dC, *d_alpha, *d_beta;
+    ASSERT_EQ(hipMalloc(&dA, sizeof(float) * hA.size()), hipSuccess);
+    ASSERT_EQ(hipMalloc(&dB, sizeof(float) * hB.size()), hipSuccess);
+    ASSERT_EQ(hipMalloc(&dC, sizeof(float) * hC.size()), hipSuccess);
+    ASSERT_EQ(hipMalloc(&d_alpha, sizeof(float) * h_alpha.size()), hipSuccess);
+    ASSERT_EQ(hipMalloc(&d_beta, sizeof(float) * h_beta.size()), hipSuccess);
+    hipMemcpy(dA, hA.data(), sizeof(float) * hA.size(), hipMemcpyHostToDevice);
+    hipMemcpy(dB, hB.data(), sizeof(float) * hB.size(), hipMemcpyHostToDevice);
+    hipMemcpy(dC, hC.data(), sizeof(float) * hC.size(), hipMemcpyHostToDevice);
+    hipMemcpy(d_alpha, h_alpha.data(), sizeof(float) * h_alpha.size(), hipMemcpyHostToDevice);
+    hipMemcpy(d_beta, h_beta.data(), sizeof(float) * h_beta.size(), hipMemcpyHostToDevice);
+
+    EXPECT_EQ(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasSetScalarStride(handle, 2), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasSgemmStridedBatched(handle,
+                                         HIPBLAS_OP_N,
+                                         HIPBLAS_OP_N,
+                                         m,
+                                         n,
+                                         k,
+                                         d_alpha,
+                                         dA,
+                                         m,
+                                         stride_a,
+                                         dB,
+                                         k,
+                                         stride_b,
+                                         d_beta,
+                                         dC,
+                                         m,
+                                         stride_c,
+                                         batch_count),
+              HIPBLAS_STATUS_SUCCESS);
+
+    vector<float> result(hC.size());
+    hipMemcpy(result.data(), dC, sizeof(float) * result.size(), hipMemcpyDeviceToHost);
+    for(int b = 0; b < batch_count; b++)
+        for(int j = 0; j < n; j++)
+            for(int i = 0; i < m; i++)
+            {
+                float sum = 0;
+                for(int l = 0; l < k; l++)
+                    sum += hA[b * stride_a + i + l * m] * hB[b * stride_b + l + j * k];
+                float want = h_alpha[2 * b] * sum + h_beta[2 * b] * hC[b * stride_c + i + j * m];
+                EXPECT_EQ(result[b * stride_c + i + j * m], want);
+            }
+
+    hipblasDestroy(handle);
+    hipFree(dA);
+    hipFree(dB);
+    hipFree(dC);
+    hipFree(d_alpha);
+    hipFree(d_beta);
+}
@@ -0,0 +1,108 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include <gtest/gtest.h>
+#include <hip/hip_runtime_api.h>
+#include <vector>
+
+using namespace std;
+
+/* =====================================================================
+     BLAS set-get_shape_dispatch_mode:
+=================================================================== */
+
+TEST(hipblas_set_shape_dispatch_mode, hipblas_get_shape_dispatch_mode)
+{
+    hipblasShapeDispatchMode_t mode = HIPBLAS_SHAPE_DISPATCH_OFF;
+
+    hipblasHandle_t handle;
+    hipblasCreate(&handle);
+
+    // handles start with degenerate gemms rerouted
+    EXPECT_EQ(hipblasGetShapeDispatchMode(handle, &mode), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(mode, HIPBLAS_SHAPE_DISPATCH_ON);
+
+    EXPECT_EQ(hipblasSetShapeDispatchMode(handle, HIPBLAS_SHAPE_DISPATCH_OFF),
+              HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasGetShapeDispatchMode(handle, &mode), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(mode, HIPBLAS_SHAPE_DISPATCH_OFF);
+
+    EXPECT_EQ(hipblasSetShapeDispatchMode(handle, hipblasShapeDispatchMode_t(7)),
+              HIPBLAS_STATUS_INVALID_ENUM);
+    EXPECT_EQ(hipblasGetShapeDispatchMode(handle, nullptr), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasGetShapeDispatchMode(nullptr, &mode), HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_EQ(hipblasSetShapeDispatchMode(nullptr, HIPBLAS_SHAPE_DISPATCH_ON),
+              HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    hipblasDestroy(handle);
+}
+
+TEST(hipblas_set_shape_dispatch_mode, hipblas_degenerate_gemms)
+{
+    // n == 1, k == 1 and m == n == 1 shapes, each with and without the dispatch
+    const int shapes[][3] = {{37, 1, 23}, {29, 17, 1}, {1, 1, 41}};
+
+    hipblasHandle_t handle;
+    hipblasCreate(&handle);
+
+    for(auto mode : {HIPBLAS_SHAPE_DISPATCH_ON, HIPBLAS_SHAPE_DISPATCH_OFF})
+        for(const auto& shape : shapes)
+        {
+            int m = shape[0], n = shape[1], k = shape[2];
+
+            vector<float> hA(m * k), hB(k * n), hC(m * n);
+            for(size_t i = 0; i < hA.size(); i++)
+                hA[i] = float(int(i % 5) - 2);
+            for(size_t i = 0; i < hB.size(); i++)
+                hB[i] = float(int(i % 3) - 1);
+            for(size_t i = 0; i < hC.size(); i++)
+                hC[i] = float(i % 4);
+
+            float *dA, *dB, *dC;
+            ASSERT_EQ(hipMalloc(&dA, sizeof(float) * hA.size()), hipSuccess);
+            ASSERT_EQ(hipMalloc(&dB, sizeof(float) * hB.size()), hipSuccess);
+            ASSERT_EQ(hipMalloc(&dC, sizeof(float) * hC.size()), hipSuccess);
+            hipMemcpy(dA, hA.data(), sizeof(float) * hA.size(), hipMemcpyHostToDevice);
+            hipMemcpy(dB, hB.data(), sizeof(float) * hB.size(), hipMemcpyHostToDevice);
+            hipMemcpy(dC, hC.data(), sizeof(float) * hC.size(), hipMemcpyHostToDevice);
+
+            // alpha = 1 and beta = 0 qualify every shape for its reroute
+            float alpha = 1.0f, beta = 0.0f;
+            EXPECT_EQ(hipblasSetShapeDispatchMode(handle, mode), HIPBLAS_STATUS_SUCCESS);
+            EXPECT_EQ(hipblasSgemm(handle,
+                                   HIPBLAS_OP_N,
+                                   HIPBLAS_OP_N,
+                                   m,
+                                   n,
+                                   k,
+                                   &alpha,
+                                   dA,
+                                   m,
+                                   dB,
+                                   k,
+                                   &beta,
+                                   dC,
+                                   m),
+                      HIPBLAS_STATUS_SUCCESS);
+
+            vector<float> result(hC.size());
+            hipMemcpy(result.data(), dC, sizeof(float) * result.size(), hipMemcpyDeviceToHost);
+            for(int j = 0; j < n; j++)
+                for(int i = 0; i < m; i++)
+                {
+                    float sum = 0;
+                    for(int l = 0; l < k; l++)
+                        sum += hA[i + l * m] * hB[l + j * k];
+                    EXPECT_EQ(result[i + j * m], sum);
+                }
+
+            hipFree(dA);
+            hipFree(dB);
+            hipFree(dC);
+        }
+
+    hipblasDestroy(handle);
+}
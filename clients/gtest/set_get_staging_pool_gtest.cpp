@@ -0,0 +1,83 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include <gtest/gtest.h>
+#include <hip/hip_runtime.h>
+#include <vector>
+
+using namespace std;
+
+/* =====================================================================
+     BLAS set-get_staging_pool_size:
+=================================================================== */
+
+TEST(hipblas_set_staging_pool_size, hipblas_get_staging_pool_size)
+{
+    size_t size = 0;
+    EXPECT_EQ(hipblasGetStagingPoolSize(&size), HIPBLAS_STATUS_SUCCESS);
+    size_t initial = size;
+
+    EXPECT_EQ(hipblasSetStagingPoolSize(4096), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasGetStagingPoolSize(&size), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(4096, size);
+
+    EXPECT_EQ(hipblasGetStagingPoolSize(nullptr), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasSetStagingPoolSize(initial), HIPBLAS_STATUS_SUCCESS);
+}
+
+// A pool far smaller than the matrix splits its columns into pieces, and every other pool size
+// must give the same result, a disabled pool included
+TEST(hipblas_staging_pool, set_get_matrix)
+{
+    const int rows = 300, cols = 7, lda = 301, ldb = 305, ldc = 300;
+
+    vector<double> ha(lda * cols), hb(ldb * cols), hz(ldb * cols, 0.0);
+    for(int i = 0; i < lda * cols; i++)
+        ha[i] = i + 1;
+
+    double* dc;
+    ASSERT_EQ(hipMalloc(&dc, ldc * cols * sizeof(double)), hipSuccess);
+
+    size_t initial;
+    EXPECT_EQ(hipblasGetStagingPoolSize(&initial), HIPBLAS_STATUS_SUCCESS);
+
+    for(size_t pool : {size_t(0), size_t(512), size_t(64 << 10)})
+    {
+        hb = hz;
+        EXPECT_EQ(hipblasSetStagingPoolSize(pool), HIPBLAS_STATUS_SUCCESS);
+        EXPECT_EQ(hipblasSetMatrix(rows, cols, sizeof(double), ha.data(), lda, dc, ldc),
+                  HIPBLAS_STATUS_SUCCESS);
+        EXPECT_EQ(hipblasGetMatrix(rows, cols, sizeof(double), dc, ldc, hb.data(), ldb),
+                  HIPBLAS_STATUS_SUCCESS);
+        for(int j = 0; j < cols; j++)
+            for(int i = 0; i < rows; i++)
+                EXPECT_EQ(ha[i + j * lda], hb[i + j * ldb]);
+
+        hb = hz;
+        EXPECT_EQ(hipblasSetVector(rows, sizeof(double), ha.data(), 2, dc, 1),
+                  HIPBLAS_STATUS_SUCCESS);
+        EXPECT_EQ(hipblasGetVector(rows, sizeof(double), dc, 1, hb.data(), 3),
+                  HIPBLAS_STATUS_SUCCESS);
+        for(int i = 0; i < rows; i++)
+            EXPECT_EQ(ha[i * 2], hb[i * 3]);
+    }
+
+    EXPECT_EQ(hipblasSetStagingPoolSize(initial), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipFree(dc), hipSuccess);
+}
+
+TEST(hipblas_host_alloc, hipblas_host_free)
+{
+    void* ptr = nullptr;
+    EXPECT_EQ(hipblasHostAlloc(&ptr, 1 << 20), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_NE(nullptr, ptr);
+    EXPECT_EQ(hipblasHostFree(ptr), HIPBLAS_STATUS_SUCCESS);
+
+    EXPECT_EQ(hipblasHostAlloc(&ptr, 0), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(nullptr, ptr);
+    EXPECT_EQ(hipblasHostFree(nullptr), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasHostAlloc(nullptr, 16), HIPBLAS_STATUS_INVALID_VALUE);
+}
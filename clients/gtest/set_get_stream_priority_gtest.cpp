@@ -0,0 +1,70 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include <gtest/gtest.h>
+#include <hip/hip_runtime_api.h>
+
+using namespace std;
+
+/* =====================================================================
+     BLAS set-get_stream_priority:
+=================================================================== */
+
+TEST(hipblas_set_stream_priority, hipblas_get_stream_priority)
+{
+    hipblasStreamPriority_t priority = HIPBLAS_STREAM_PRIORITY_HIGH;
+    hipStream_t             stream   = nullptr;
+
+    int least, greatest;
+    ASSERT_EQ(hipDeviceGetStreamPriorityRange(&least, &greatest), hipSuccess);
+
+    hipblasHandle_t handle;
+    hipblasCreate(&handle);
+
+    EXPECT_EQ(hipblasGetStreamPriority(handle, &priority), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(HIPBLAS_STREAM_PRIORITY_DEFAULT, priority);
+
+    // the handle moves to a stream of its own, and so do the streams it creates
+    EXPECT_EQ(hipblasSetIndependentStreams(handle, 2), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasSetStreamPriority(handle, HIPBLAS_STREAM_PRIORITY_HIGH),
+              HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasGetStreamPriority(handle, &priority), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(HIPBLAS_STREAM_PRIORITY_HIGH, priority);
+
+    int value = least;
+    EXPECT_EQ(hipblasGetStream(handle, &stream), HIPBLAS_STATUS_SUCCESS);
+    ASSERT_NE(nullptr, stream);
+    EXPECT_EQ(hipStreamGetPriority(stream, &value), hipSuccess);
+    EXPECT_EQ(greatest, value);
+
+    hipblasHandle_t independent;
+    EXPECT_EQ(hipblasGetIndependentHandle(handle, &independent), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasGetStream(independent, &stream), HIPBLAS_STATUS_SUCCESS);
+    value = least;
+    EXPECT_EQ(hipStreamGetPriority(stream, &value), hipSuccess);
+    EXPECT_EQ(greatest, value);
+    EXPECT_EQ(hipblasSynchronizeHandle(handle), HIPBLAS_STATUS_SUCCESS);
+
+    EXPECT_EQ(hipblasSetStreamPriority(handle, HIPBLAS_STREAM_PRIORITY_LOW),
+              HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasGetStream(handle, &stream), HIPBLAS_STATUS_SUCCESS);
+    value = greatest;
+    EXPECT_EQ(hipStreamGetPriority(stream, &value), hipSuccess);
+    EXPECT_EQ(least, value);
+
+    // back on the null stream
+    EXPECT_EQ(hipblasSetStreamPriority(handle, HIPBLAS_STREAM_PRIORITY_DEFAULT),
+              HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasGetStream(handle, &stream), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(nullptr, stream);
+
+    EXPECT_EQ(hipblasSetStreamPriority(handle, hipblasStreamPriority_t(3)),
+              HIPBLAS_STATUS_INVALID_ENUM);
+    EXPECT_EQ(hipblasGetStreamPriority(handle, nullptr), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasGetStreamPriority(nullptr, &priority), HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    hipblasDestroy(handle);
+}
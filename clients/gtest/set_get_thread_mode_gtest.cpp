@@ -0,0 +1,137 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include <gtest/gtest.h>
+#include <hip/hip_runtime_api.h>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+/* =====================================================================
+     BLAS set-get_thread_mode:
+=================================================================== */
+
+TEST(hipblas_set_thread_mode, hipblas_get_thread_mode)
+{
+    hipblasThreadMode_t mode = HIPBLAS_THREAD_MODE_PER_THREAD;
+
+    hipblasHandle_t handle;
+    hipblasCreate(&handle);
+
+    EXPECT_EQ(hipblasGetThreadMode(handle, &mode), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(HIPBLAS_THREAD_MODE_SHARED, mode);
+
+    EXPECT_EQ(hipblasSetThreadMode(handle, HIPBLAS_THREAD_MODE_PER_THREAD), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasGetThreadMode(handle, &mode), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(HIPBLAS_THREAD_MODE_PER_THREAD, mode);
+
+    EXPECT_EQ(hipblasSetThreadMode(handle, hipblasThreadMode_t(2)), HIPBLAS_STATUS_INVALID_ENUM);
+    EXPECT_EQ(hipblasGetThreadMode(handle, nullptr), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasGetThreadMode(nullptr, &mode), HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    hipblasDestroy(handle);
+}
+
+TEST(hipblas_set_thread_mode, hipblas_thread_mode_per_thread_streams)
+{
+    const int threads = 4, n = 4096;
+
+    float* dx;
+    float* dy;
+    ASSERT_EQ(hipMalloc(&dx, n * sizeof(float)), hipSuccess);
+    ASSERT_EQ(hipMalloc(&dy, threads * n * sizeof(float)), hipSuccess);
+    vector<float> hx(n);
+    for(int i = 0; i < n; i++)
+        hx[i] = float(i % 32);
+    ASSERT_EQ(hipMemcpy(dx, hx.data(), n * sizeof(float), hipMemcpyHostToDevice), hipSuccess);
+
+    hipblasHandle_t handle;
+    hipblasCreate(&handle);
+    EXPECT_EQ(hipblasSetThreadMode(handle, HIPBLAS_THREAD_MODE_PER_THREAD), HIPBLAS_STATUS_SUCCESS);
+
+    // every worker sets its own stream and pointer mode on the one handle
+    vector<int>    bad(threads, 0);
+    vector<thread> workers;
+    for(int t = 0; t < threads; t++)
+        workers.emplace_back([&, t] {
+            hipStream_t stream;
+            if(hipStreamCreate(&stream) != hipSuccess)
+            {
+                bad[t]++;
+                return;
+            }
+            float       alpha = float(t + 1);
+            float*      y     = dy + t * n;
+            hipStream_t seen  = nullptr;
+            bad[t] += hipblasSetStream(handle, stream) != HIPBLAS_STATUS_SUCCESS;
+            bad[t] += hipblasGetStream(handle, &seen) != HIPBLAS_STATUS_SUCCESS || seen != stream;
+            bad[t] += hipMemsetAsync(y, 0, n * sizeof(float), stream) != hipSuccess;
+            for(int r = 0; r < 10; r++)
+                bad[t] += hipblasSaxpy(handle, n, &alpha, dx, 1, y, 1) != HIPBLAS_STATUS_SUCCESS;
+
+            vector<float> hy(n);
+            bad[t] += hipMemcpyAsync(hy.data(), y, n * sizeof(float), hipMemcpyDeviceToHost, stream)
+                      != hipSuccess;
+            bad[t] += hipStreamSynchronize(stream) != hipSuccess;
+            for(int i = 0; i < n; i++)
+                bad[t] += hy[i] != 10.0f * alpha * hx[i];
+            bad[t] += hipStreamDestroy(stream) != hipSuccess;
+        });
+    for(thread& w : workers)
+        w.join();
+    for(int t = 0; t < threads; t++)
+        EXPECT_EQ(0, bad[t]);
+
+    // this thread's copy still has the stream the handle had when the mode was set
+    hipStream_t seen = reinterpret_cast<hipStream_t>(1);
+    EXPECT_EQ(hipblasGetStream(handle, &seen), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(nullptr, seen);
+
+    hipblasDestroy(handle);
+    EXPECT_EQ(hipFree(dx), hipSuccess);
+    EXPECT_EQ(hipFree(dy), hipSuccess);
+}
+
+// Reads the gemm backend, tiny gemm limit and workspace limit of handle
+static void expect_gemm_settings(hipblasHandle_t handle, int& bad)
+{
+    hipblasGemmBackend_t    backend = HIPBLAS_GEMM_BACKEND_DEFAULT;
+    int                     tiny    = -1;
+    hipblasWorkspaceUsage_t usage   = {};
+    bad += hipblasGetGemmBackend(handle, &backend) != HIPBLAS_STATUS_SUCCESS
+           || backend != HIPBLAS_GEMM_BACKEND_LT;
+    bad += hipblasGetGemmTinyLimit(handle, &tiny) != HIPBLAS_STATUS_SUCCESS || tiny != 4;
+    bad += hipblasGetWorkspaceUsage(handle, &usage) != HIPBLAS_STATUS_SUCCESS
+           || usage.limit != (1 << 20);
+}
+
+TEST(hipblas_set_thread_mode, hipblas_thread_mode_inherits_gemm_settings)
+{
+    hipblasHandle_t handle;
+    hipblasCreate(&handle);
+    EXPECT_EQ(hipblasSetGemmBackend(handle, HIPBLAS_GEMM_BACKEND_LT), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasSetGemmTinyLimit(handle, 4), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasSetWorkspaceLimit(handle, 1 << 20), HIPBLAS_STATUS_SUCCESS);
+
+    // a lane of the independent streams
+    hipblasHandle_t lane = nullptr;
+    EXPECT_EQ(hipblasSetIndependentStreams(handle, 2), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasGetIndependentHandle(handle, &lane), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_NE(handle, lane);
+    int bad = 0;
+    expect_gemm_settings(lane, bad);
+    EXPECT_EQ(0, bad);
+    EXPECT_EQ(hipblasSynchronizeHandle(handle), HIPBLAS_STATUS_SUCCESS);
+
+    // the copy a worker thread gets in per-thread mode
+    EXPECT_EQ(hipblasSetThreadMode(handle, HIPBLAS_THREAD_MODE_PER_THREAD), HIPBLAS_STATUS_SUCCESS);
+    thread worker([&] { expect_gemm_settings(handle, bad); });
+    worker.join();
+    EXPECT_EQ(0, bad);
+
+    hipblasDestroy(handle);
+}
@@ -0,0 +1,118 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include <gtest/gtest.h>
+#include <hip/hip_runtime_api.h>
+#include <vector>
+
+using namespace std;
+
+/* =====================================================================
+     BLAS set-get_workspace:
+=================================================================== */
+
+TEST(hipblas_set_workspace, hipblas_get_workspace_size)
+{
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+    size_t          size   = 1;
+
+    hipblasHandle_t handle;
+    hipblasCreate(&handle);
+
+    // library-owned workspace is allocated lazily
+    status = hipblasGetWorkspaceSize(handle, &size);
+    EXPECT_EQ(status, HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(size, size_t(0));
+
+    const size_t user_size = 1 << 20;
+    void*        user_ws   = nullptr;
+    ASSERT_EQ(hipMalloc(&user_ws, user_size), hipSuccess);
+
+    status = hipblasSetWorkspace(handle, user_ws, user_size);
+    EXPECT_EQ(status, HIPBLAS_STATUS_SUCCESS);
+
+    status = hipblasGetWorkspaceSize(handle, &size);
+    EXPECT_EQ(status, HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(size, user_size);
+
+    // a size without storage, or storage without a size, is rejected
+    EXPECT_EQ(hipblasSetWorkspace(handle, nullptr, user_size), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasSetWorkspace(handle, user_ws, 0), HIPBLAS_STATUS_INVALID_VALUE);
+
+    // back to library-owned storage; the user buffer is not freed by hipBLAS
+    status = hipblasSetWorkspace(handle, nullptr, 0);
+    EXPECT_EQ(status, HIPBLAS_STATUS_SUCCESS);
+
+    status = hipblasGetWorkspaceSize(handle, &size);
+    EXPECT_EQ(status, HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(size, size_t(0));
+
+    EXPECT_EQ(hipblasGetWorkspaceSize(handle, nullptr), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasGetWorkspaceSize(nullptr, &size), HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    hipblasDestroy(handle);
+    EXPECT_EQ(hipFree(user_ws), hipSuccess);
+}
+
+TEST(hipblas_set_workspace, hipblas_workspace_usage)
+{
+    const int     n = 1024, k = 4;
+    vector<float> hX(n * k, 1.0f);
+    float         result[k];
+
+    float *dX, *dY;
+    ASSERT_EQ(hipMalloc(&dX, sizeof(float) * n), hipSuccess);
+    ASSERT_EQ(hipMalloc(&dY, sizeof(float) * n * k), hipSuccess);
+    ASSERT_EQ(hipMemcpy(dX, hX.data(), sizeof(float) * n, hipMemcpyHostToDevice), hipSuccess);
+    ASSERT_EQ(hipMemcpy(dY, hX.data(), sizeof(float) * n * k, hipMemcpyHostToDevice), hipSuccess);
+
+    hipblasHandle_t handle;
+    hipblasCreate(&handle);
+
+    hipblasWorkspaceUsage_t usage;
+    size_t                  mark = 1;
+    EXPECT_EQ(hipblasGetWorkspaceHighWaterMark(handle, &mark), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(mark, size_t(0));
+
+    // mdot keeps its partial sums in the workspace, grown once and then reused
+    EXPECT_EQ(hipblasSmdot(handle, n, k, dX, 1, dY, n, 1, result), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasSmdot(handle, n, k, dX, 1, dY, n, 1, result), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasGetWorkspaceUsage(handle, &usage), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_GT(usage.high_water_mark, size_t(0));
+    EXPECT_GE(usage.size, usage.high_water_mark);
+    EXPECT_EQ(usage.growths, 1u);
+    EXPECT_EQ(usage.limit, size_t(0));
+    EXPECT_EQ(hipblasGetWorkspaceHighWaterMark(handle, &mark), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(mark, usage.high_water_mark);
+
+    // A limit never takes back storage already allocated
+    EXPECT_EQ(hipblasSetWorkspaceLimit(handle, 1), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasSmdot(handle, n, k, dX, 1, dY, n, 1, result), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasResetWorkspaceHighWaterMark(handle), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasGetWorkspaceUsage(handle, &usage), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(usage.high_water_mark, size_t(0));
+    EXPECT_EQ(usage.growths, 0u);
+    EXPECT_EQ(usage.limit, size_t(1));
+    hipblasDestroy(handle);
+
+    // but stops it growing, while the request still counts toward the mark
+    hipblasCreate(&handle);
+    EXPECT_EQ(hipblasSetWorkspaceLimit(handle, 1), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasSmdot(handle, n, k, dX, 1, dY, n, 1, result), HIPBLAS_STATUS_ALLOC_FAILED);
+    EXPECT_EQ(hipblasGetWorkspaceUsage(handle, &usage), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(usage.size, size_t(0));
+    EXPECT_GT(usage.high_water_mark, size_t(1));
+    EXPECT_EQ(usage.growths, 0u);
+
+    EXPECT_EQ(hipblasGetWorkspaceUsage(handle, nullptr), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasGetWorkspaceHighWaterMark(handle, nullptr), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasGetWorkspaceUsage(nullptr, &usage), HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_EQ(hipblasSetWorkspaceLimit(nullptr, 0), HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    hipblasDestroy(handle);
+    EXPECT_EQ(hipFree(dX), hipSuccess);
+    EXPECT_EQ(hipFree(dY), hipSuccess);
+}
@@ -0,0 +1,167 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_sparse_gemm24.hpp"
+#include "utility.h"
+#include <gtest/gtest.h>
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+/* =====================================================================
+     BLAS 2:4 structured sparse gemm:
+=================================================================== */
+
+typedef std::tuple<vector<int>, char, char> sparse24_tuple;
+
+// {M, N, K}; K is a multiple of 4
+const vector<vector<int>> matrix_size_range
+    = {{-1, 4, 8}, {4, 4, 6}, {17, 19, 64}, {5, 40, 200}, {33, 3, 68}, {1, 16, 4}};
+
+const vector<char> transA_range = {'N', 'T'};
+const vector<char> transB_range = {'N', 'T'};
+
+Arguments setup_sparse24_arguments(sparse24_tuple tup)
+{
+    vector<int> matrix_size = std::get<0>(tup);
+
+    Arguments arg;
+
+    arg.M             = matrix_size[0];
+    arg.N             = matrix_size[1];
+    arg.K             = matrix_size[2];
+    arg.transA_option = std::get<1>(tup);
+    arg.transB_option = std::get<2>(tup);
+
+    arg.lda = max(1, arg.transA_option == 'N' ? arg.M : arg.K);
+    arg.ldb = max(1, arg.transB_option == 'N' ? arg.K : arg.N);
+    arg.ldc = max(1, arg.M);
+
+    // small integers, so the results are exact
+    arg.alpha = 2;
+    arg.beta  = -1;
+
+    return arg;
+}
+
+// the tester rejects invalid sizes before the calls
+static void check_sparse24_status(const Arguments& arg, hipblasStatus_t status)
+{
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.M < 0 || arg.N < 0 || arg.K < 0 || arg.K % 4)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+        }
+    }
+}
+
+class sparse24_gtest : public ::TestWithParam<sparse24_tuple>
+{
+protected:
+    sparse24_gtest() {}
+    virtual ~sparse24_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_P(sparse24_gtest, sparse_gemm24_float)
+{
+    // GetParam returns a tuple. The setup routine unpacks the tuple
+    // and initializes arg(Arguments), which will be passed to testing routine.
+
+    Arguments arg = setup_sparse24_arguments(GetParam());
+
+    check_sparse24_status(arg, testing_sparse_gemm24<float>(arg));
+}
+
+TEST_P(sparse24_gtest, sparse_gemm24_half)
+{
+    Arguments arg = setup_sparse24_arguments(GetParam());
+
+    check_sparse24_status(arg, testing_sparse_gemm24<hipblasHalf>(arg));
+}
+
+TEST_P(sparse24_gtest, sparse_gemm24_half_float)
+{
+    Arguments arg = setup_sparse24_arguments(GetParam());
+
+    check_sparse24_status(arg, testing_sparse_gemm24<hipblasHalf, float>(arg));
+}
+
+TEST_P(sparse24_gtest, sparse_gemm24_bf16_float)
+{
+    Arguments arg = setup_sparse24_arguments(GetParam());
+
+    check_sparse24_status(arg, testing_sparse_gemm24<hipblasBfloat16, float>(arg));
+}
+
+// The combinations are  { {M, N, K}, transA, transB }
+
+INSTANTIATE_TEST_CASE_P(hipblasSparse24,
+                        sparse24_gtest,
+                        Combine(ValuesIn(matrix_size_range),
+                                ValuesIn(transA_range),
+                                ValuesIn(transB_range)));
+
+TEST(hipblas_sparse24, bad_arg)
+{
+    hipblasHandle_t handle;
+    ASSERT_EQ(hipblas_client_create(&handle), HIPBLAS_STATUS_SUCCESS);
+
+    float                   alpha = 1, beta = 0;
+    void*                   p     = &alpha;
+    uint8_t                 meta;
+    hipblasSparse24Matrix_t a     = {p, 4, &meta, 4};
+
+    EXPECT_EQ(hipblasSparsePrune24(nullptr, HIPBLAS_OP_N, 4, 8, p, HIPBLAS_R_32F, 4, p, 4),
+              HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_EQ(hipblasSparsePrune24(
+                  handle, hipblasOperation_t(-1), 4, 8, p, HIPBLAS_R_32F, 4, p, 4),
+              HIPBLAS_STATUS_INVALID_ENUM);
+    EXPECT_EQ(hipblasSparsePrune24(handle, HIPBLAS_OP_N, 4, 6, p, HIPBLAS_R_32F, 4, p, 4),
+              HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasSparsePrune24(handle, HIPBLAS_OP_N, 4, 8, p, HIPBLAS_R_32F, 4, p, 3),
+              HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasSparsePrune24(handle, HIPBLAS_OP_N, 4, 8, p, HIPBLAS_R_64F, 4, p, 4),
+              HIPBLAS_STATUS_NOT_SUPPORTED);
+    EXPECT_EQ(hipblasSparseCompress24(handle, HIPBLAS_OP_N, 4, 8, p, HIPBLAS_R_32F, 4, nullptr),
+              HIPBLAS_STATUS_INVALID_VALUE);
+
+    auto gemm = [&](int k, const hipblasSparse24Matrix_t* sa, hipblasDatatype_t c_type) {
+        return hipblasSparseGemm24Ex(handle,
+                                     HIPBLAS_OP_N,
+                                     4,
+                                     4,
+                                     k,
+                                     &alpha,
+                                     sa,
+                                     HIPBLAS_R_16F,
+                                     p,
+                                     8,
+                                     &beta,
+                                     p,
+                                     c_type,
+                                     4,
+                                     HIPBLAS_R_32F);
+    };
+    EXPECT_EQ(gemm(6, &a, HIPBLAS_R_16F), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(gemm(8, nullptr, HIPBLAS_R_16F), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(gemm(8, &a, HIPBLAS_R_16B), HIPBLAS_STATUS_NOT_SUPPORTED);
+    a.ld_metadata = 3;
+    EXPECT_EQ(gemm(8, &a, HIPBLAS_R_16F), HIPBLAS_STATUS_INVALID_VALUE);
+
+    EXPECT_EQ(hipblas_client_destroy(handle), HIPBLAS_STATUS_SUCCESS);
+}
@@ -0,0 +1,214 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_symmetrize.hpp"
+#include "testing_symmetrize_batched.hpp"
+#include "testing_symmetrize_strided_batched.hpp"
+#include "utility.h"
+#include <gtest/gtest.h>
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+/* =====================================================================
+     BLAS symmetrize and hermitize:
+=================================================================== */
+
+typedef std::tuple<vector<int>, char> symmetrize_tuple;
+typedef std::tuple<vector<int>, char, double, int> symmetrize_batched_tuple;
+
+// {N, lda}
+const vector<vector<int>> matrix_size_range
+    = {{-1, 1}, {2, 1}, {1, 1}, {31, 33}, {64, 64}, {65, 70}, {97, 100}, {300, 301}};
+
+const vector<vector<int>> batched_matrix_size_range = {{-1, 1}, {33, 33}, {40, 41}, {70, 72}};
+
+const vector<char> uplo_range = {'U', 'L'};
+
+// 1.5 leaves room between the batches, which must keep its values
+const vector<double> stride_scale_range = {1.0, 1.5};
+
+const vector<int> batch_count_range = {-1, 0, 1, 4};
+
+Arguments setup_symmetrize_arguments(symmetrize_tuple tup)
+{
+    vector<int> matrix_size = std::get<0>(tup);
+
+    Arguments arg;
+
+    arg.N   = matrix_size[0];
+    arg.lda = matrix_size[1];
+
+    arg.uplo_option = std::get<1>(tup);
+
+    return arg;
+}
+
+Arguments setup_symmetrize_batched_arguments(symmetrize_batched_tuple tup)
+{
+    Arguments arg
+        = setup_symmetrize_arguments(symmetrize_tuple(std::get<0>(tup), std::get<1>(tup)));
+
+    arg.stride_scale = std::get<2>(tup);
+    arg.batch_count  = std::get<3>(tup);
+
+    return arg;
+}
+
+// the testers reject invalid sizes before the call
+static void check_symmetrize_status(const Arguments& arg, hipblasStatus_t status)
+{
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.N < 0 || arg.lda < max(1, arg.N) || arg.batch_count < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+        }
+    }
+}
+
+class symmetrize_gtest : public ::TestWithParam<symmetrize_tuple>
+{
+protected:
+    symmetrize_gtest() {}
+    virtual ~symmetrize_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_P(symmetrize_gtest, symmetrize_gtest_float)
+{
+    // GetParam returns a tuple. The setup routine unpacks the tuple
+    // and initializes arg(Arguments), which will be passed to testing routine.
+
+    Arguments arg = setup_symmetrize_arguments(GetParam());
+
+    check_symmetrize_status(arg, testing_symmetrize<float>(arg));
+}
+
+TEST_P(symmetrize_gtest, symmetrize_gtest_double)
+{
+    Arguments arg = setup_symmetrize_arguments(GetParam());
+
+    check_symmetrize_status(arg, testing_symmetrize<double>(arg));
+}
+
+TEST_P(symmetrize_gtest, symmetrize_gtest_float_complex)
+{
+    Arguments arg = setup_symmetrize_arguments(GetParam());
+
+    check_symmetrize_status(arg, testing_symmetrize<hipblasComplex>(arg));
+}
+
+TEST_P(symmetrize_gtest, symmetrize_gtest_double_complex)
+{
+    Arguments arg = setup_symmetrize_arguments(GetParam());
+
+    check_symmetrize_status(arg, testing_symmetrize<hipblasDoubleComplex>(arg));
+}
+
+TEST_P(symmetrize_gtest, hermitize_gtest_float_complex)
+{
+    Arguments arg = setup_symmetrize_arguments(GetParam());
+
+    check_symmetrize_status(arg, testing_hermitize<hipblasComplex>(arg));
+}
+
+TEST_P(symmetrize_gtest, hermitize_gtest_double_complex)
+{
+    Arguments arg = setup_symmetrize_arguments(GetParam());
+
+    check_symmetrize_status(arg, testing_hermitize<hipblasDoubleComplex>(arg));
+}
+
+class symmetrize_batched_gtest : public ::TestWithParam<symmetrize_batched_tuple>
+{
+protected:
+    symmetrize_batched_gtest() {}
+    virtual ~symmetrize_batched_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_P(symmetrize_batched_gtest, symmetrize_batched_gtest_double)
+{
+    Arguments arg = setup_symmetrize_batched_arguments(GetParam());
+
+    check_symmetrize_status(arg, testing_symmetrize_batched<double>(arg));
+}
+
+TEST_P(symmetrize_batched_gtest, symmetrize_strided_batched_gtest_double)
+{
+    Arguments arg = setup_symmetrize_batched_arguments(GetParam());
+
+    check_symmetrize_status(arg, testing_symmetrize_strided_batched<double>(arg));
+}
+
+TEST_P(symmetrize_batched_gtest, symmetrize_strided_batched_gtest_float_complex)
+{
+    Arguments arg = setup_symmetrize_batched_arguments(GetParam());
+
+    check_symmetrize_status(arg, testing_symmetrize_strided_batched<hipblasComplex>(arg));
+}
+
+TEST_P(symmetrize_batched_gtest, hermitize_batched_gtest_float_complex)
+{
+    Arguments arg = setup_symmetrize_batched_arguments(GetParam());
+
+    check_symmetrize_status(arg, testing_hermitize_batched<hipblasComplex>(arg));
+}
+
+TEST_P(symmetrize_batched_gtest, hermitize_strided_batched_gtest_float_complex)
+{
+    Arguments arg = setup_symmetrize_batched_arguments(GetParam());
+
+    check_symmetrize_status(arg, testing_hermitize_strided_batched<hipblasComplex>(arg));
+}
+
+// The combinations are  { {N, lda}, uplo } and { {N, lda}, uplo, stride_scale, batch_count }
+
+INSTANTIATE_TEST_CASE_P(hipblasSymmetrize,
+                        symmetrize_gtest,
+                        Combine(ValuesIn(matrix_size_range), ValuesIn(uplo_range)));
+
+INSTANTIATE_TEST_CASE_P(hipblasSymmetrize_batched,
+                        symmetrize_batched_gtest,
+                        Combine(ValuesIn(batched_matrix_size_range),
+                                ValuesIn(uplo_range),
+                                ValuesIn(stride_scale_range),
+                                ValuesIn(batch_count_range)));
+
+TEST(hipblas_symmetrize, bad_arg)
+{
+    hipblasHandle_t handle;
+    ASSERT_EQ(hipblas_client_create(&handle), HIPBLAS_STATUS_SUCCESS);
+
+    float             x[4];
+    hipblasFillMode_t upper = HIPBLAS_FILL_MODE_UPPER;
+    EXPECT_EQ(hipblasSsymmetrize(nullptr, upper, 2, x, 2), HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_EQ(hipblasSsymmetrize(handle, HIPBLAS_FILL_MODE_FULL, 2, x, 2),
+              HIPBLAS_STATUS_INVALID_ENUM);
+    EXPECT_EQ(hipblasSsymmetrize(handle, upper, -1, x, 2), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasSsymmetrize(handle, upper, 2, x, 1), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasSsymmetrize(handle, upper, 2, nullptr, 2), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasSsymmetrizeStridedBatched(handle, upper, 2, x, 2, 4, -1),
+              HIPBLAS_STATUS_INVALID_VALUE);
+
+    // nothing to mirror, so the matrix is not looked at
+    EXPECT_EQ(hipblasSsymmetrize(handle, upper, 0, nullptr, 1), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasZhermitizeBatched(handle, upper, 2, nullptr, 2, 0), HIPBLAS_STATUS_SUCCESS);
+
+    EXPECT_EQ(hipblas_client_destroy(handle), HIPBLAS_STATUS_SUCCESS);
+}
@@ -5,6 +5,7 @@
 
 #include "testing_syrk.hpp"
 #include "testing_syrk_batched.hpp"
+#include "testing_syrk_ex.hpp"
 #include "testing_syrk_strided_batched.hpp"
 #include "utility.h"
 #include <gtest/gtest.h>
@@ -290,6 +291,53 @@ TEST_P(blas2_syrk_gtest, syrk_strided_batched_gtest_double_complex)
     }
 }
 
+// syrk_ex
+TEST_P(blas2_syrk_gtest, syrk_ex_gtest_float)
+{
+    Arguments arg = setup_syrk_arguments(GetParam());
+    if(arg.transA_option == 'C')
+        arg.transA_option = 'T';
+
+    hipblasStatus_t status = testing_syrk_ex<float>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.N < 0 || arg.K < 0 || arg.ldc < arg.N
+           || (arg.transA_option == 'N' && arg.lda < arg.N)
+           || (arg.transA_option != 'N' && arg.lda < arg.K))
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
+
+// several diagonal blocks of the blocked update, with ldc > N
+TEST(blas2_syrk_ex, syrk_ex_blocked_float)
+{
+    Arguments arg;
+    arg.N             = 300;
+    arg.K             = 40;
+    arg.lda           = 300;
+    arg.ldc           = 303;
+    arg.alpha         = 2.0;
+    arg.beta          = -1.0;
+    arg.uplo_option   = 'L';
+    arg.transA_option = 'N';
+    arg.timing        = 0;
+
+    hipblasStatus_t status = testing_syrk_ex<float>(arg);
+    EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+
+    arg.uplo_option = 'U';
+    status          = testing_syrk_ex<float>(arg);
+    EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+}
+
 // notice we are using vector of vector
 // so each elment in xxx_range is a avector,
 // ValuesIn take each element (a vector) and combine them and feed them to test_p
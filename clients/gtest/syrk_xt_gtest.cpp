@@ -0,0 +1,115 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_syrk_xt.hpp"
+#include "utility.h"
+#include <gtest/gtest.h>
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, vector<double>, char, char> syrk_xt_tuple;
+
+// {N, K, lda, ldc}; the tests use 64 x 64 tiles, so the larger sizes have off-diagonal tiles,
+// partial tiles and several k steps
+const vector<vector<int>> matrix_size_range
+    = {{-1, 1, 1, 1}, {11, 6, 11, 11}, {64, 65, 65, 64}, {150, 130, 150, 152}};
+
+// {alpha, alphai, beta, betai}
+const vector<vector<double>> alpha_beta_range = {{-0.5, 1.5, 2.0, 1.5}, {2.0, 1.0, 0.0, 0.0}};
+
+const vector<char> uplo_range   = {'L', 'U'};
+const vector<char> transA_range = {'N', 'T'};
+
+Arguments setup_syrk_xt_arguments(syrk_xt_tuple tup)
+{
+    vector<int>    matrix_size = std::get<0>(tup);
+    vector<double> alpha_beta  = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.N   = matrix_size[0];
+    arg.K   = matrix_size[1];
+    arg.lda = matrix_size[2];
+    arg.ldc = matrix_size[3];
+
+    arg.alpha  = alpha_beta[0];
+    arg.alphai = alpha_beta[1];
+    arg.beta   = alpha_beta[2];
+    arg.betai  = alpha_beta[3];
+
+    arg.uplo_option   = std::get<2>(tup);
+    arg.transA_option = std::get<3>(tup);
+
+    return arg;
+}
+
+class syrk_xt_gtest : public ::TestWithParam<syrk_xt_tuple>
+{
+protected:
+    syrk_xt_gtest() {}
+    virtual ~syrk_xt_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_P(syrk_xt_gtest, syrk_xt_gtest_float)
+{
+    // GetParam returns a tuple. The setup routine unpacks the tuple
+    // and initializes arg(Arguments), which will be passed to testing routine.
+
+    Arguments arg = setup_syrk_xt_arguments(GetParam());
+
+    hipblasStatus_t status = testing_syrk_xt<float>(arg);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.N < 0 || arg.K < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+        }
+    }
+}
+
+TEST_P(syrk_xt_gtest, syrk_xt_gtest_double_complex)
+{
+    // GetParam returns a tuple. The setup routine unpacks the tuple
+    // and initializes arg(Arguments), which will be passed to testing routine.
+
+    Arguments arg = setup_syrk_xt_arguments(GetParam());
+
+    hipblasStatus_t status = testing_syrk_xt<hipblasDoubleComplex>(arg);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.N < 0 || arg.K < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+        }
+    }
+}
+
+// The combinations are  { {N, K, lda, ldc}, {alpha, alphai, beta, betai}, uplo, transA }
+
+INSTANTIATE_TEST_CASE_P(hipblasXtSyrk,
+                        syrk_xt_gtest,
+                        Combine(ValuesIn(matrix_size_range),
+                                ValuesIn(alpha_beta_range),
+                                ValuesIn(uplo_range),
+                                ValuesIn(transA_range)));
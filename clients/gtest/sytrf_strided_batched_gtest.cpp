@@ -0,0 +1,124 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_sytrf_strided_batched.hpp"
+#include "utility.h"
+#include <gtest/gtest.h>
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, char, double, int> sytrf_strided_batched_tuple;
+
+// {N, nrhs, lda, ldb}; N up to 32 factors in shared memory, beyond that in place, or in rocSOLVER
+const vector<vector<int>> matrix_size_range = {{-1, 1, 1, 1},
+                                               {3, 1, 2, 3},
+                                               {1, 1, 1, 1},
+                                               {2, 3, 2, 2},
+                                               {17, 4, 20, 17},
+                                               {32, 1, 32, 32},
+                                               {33, 2, 40, 33},
+                                               {100, 5, 100, 128}};
+
+const vector<char> uplo_range = {'U', 'L'};
+
+const vector<double> stride_scale_range = {2.5};
+
+const vector<int> batch_count_range = {-1, 0, 1, 3};
+
+Arguments setup_sytrf_strided_batched_arguments(sytrf_strided_batched_tuple tup)
+{
+    vector<int> matrix_size  = std::get<0>(tup);
+    char        uplo         = std::get<1>(tup);
+    double      stride_scale = std::get<2>(tup);
+    int         batch_count  = std::get<3>(tup);
+
+    Arguments arg;
+
+    arg.N   = matrix_size[0];
+    arg.K   = matrix_size[1];
+    arg.lda = matrix_size[2];
+    arg.ldb = matrix_size[3];
+
+    arg.uplo_option = uplo;
+
+    arg.stride_scale = stride_scale;
+    arg.batch_count  = batch_count;
+
+    return arg;
+}
+
+class sytrf_strided_batched_gtest : public ::TestWithParam<sytrf_strided_batched_tuple>
+{
+protected:
+    sytrf_strided_batched_gtest() {}
+    virtual ~sytrf_strided_batched_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_P(sytrf_strided_batched_gtest, sytrf_strided_batched_gtest_float)
+{
+    // GetParam returns a tuple. The setup routine unpacks the tuple
+    // and initializes arg(Arguments), which will be passed to testing routine.
+
+    Arguments arg = setup_sytrf_strided_batched_arguments(GetParam());
+
+    hipblasStatus_t status = testing_sytrf_strided_batched<float>(arg);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.N < 0 || arg.K < 0 || arg.lda < max(1, arg.N) || arg.ldb < max(1, arg.N)
+           || arg.batch_count < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+        }
+    }
+}
+
+TEST_P(sytrf_strided_batched_gtest, sytrf_strided_batched_gtest_double)
+{
+    // GetParam returns a tuple. The setup routine unpacks the tuple
+    // and initializes arg(Arguments), which will be passed to testing routine.
+
+    Arguments arg = setup_sytrf_strided_batched_arguments(GetParam());
+
+    hipblasStatus_t status = testing_sytrf_strided_batched<double>(arg);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.N < 0 || arg.K < 0 || arg.lda < max(1, arg.N) || arg.ldb < max(1, arg.N)
+           || arg.batch_count < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+        }
+    }
+}
+
+// notice we are using vector of vector
+// so each elment in xxx_range is a vector,
+// ValuesIn takes each element (a vector), combines them, and feeds them to test_p
+// The combinations are  { {N, nrhs, lda, ldb}, uplo, stride_scale, batch_count }
+
+INSTANTIATE_TEST_CASE_P(hipblasSytrfStridedBatched,
+                        sytrf_strided_batched_gtest,
+                        Combine(ValuesIn(matrix_size_range),
+                                ValuesIn(uplo_range),
+                                ValuesIn(stride_scale_range),
+                                ValuesIn(batch_count_range)));
@@ -0,0 +1,364 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_tbsv.hpp"
+#include "testing_tbsv_batched.hpp"
+#include "testing_tbsv_strided_batched.hpp"
+#include "utility.h"
+#include <gtest/gtest.h>
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+// only GCC/VS 2010 comes with std::tr1::tuple, but it is unnecessary,  std::tuple is good enough;
+
+typedef std::tuple<vector<int>, int, vector<char>, double, int> tbsv_tuple;
+
+/* =====================================================================
+README: This file contains testers to verify the correctness of
+        BLAS routines with google test
+
+        It is supposed to be played/used by advance / expert users
+        Normal users only need to get the library routines without testers
+     =================================================================== */
+
+/* =====================================================================
+Advance users only: BrainStorm the parameters but do not make artificial one which invalidates the
+matrix.
+like lda pairs with M, and "lda must >= M". case "lda < M" will be guarded by argument-checkers
+inside API of course.
+Yet, the goal of this file is to verify result correctness not argument-checkers.
+
+Representative sampling is sufficient, endless brute-force sampling is not necessary
+=================================================================== */
+
+// vector of vector, each vector is a {N, K, lda};
+// add/delete as a group
+const vector<vector<int>> matrix_size_range
+    = {{-1, -1, -1}, {11, 5, 11}, {16, 8, 16}, {32, 16, 32}, {65, 64, 65}, {100, 3, 4}};
+
+const vector<int> incx_range = {1, -1, 0, 2};
+
+// vector of vector, each element is an {uplo, transA, diag}
+const vector<vector<char>> uplo_transA_diag_range
+    = {{'U', 'N', 'N'}, {'L', 'N', 'U'}, {'U', 'T', 'U'}, {'L', 'C', 'N'}};
+
+// add/delete single values, like {2.0}
+const vector<double> stride_scale_range = {1.0, 2.5};
+
+const vector<int> batch_count_range = {-1, 0, 1, 2, 10};
+
+/* ===============Google Unit Test==================================================== */
+
+/* =====================================================================
+     BLAS-2 tbsv:
+=================================================================== */
+
+/* ============================Setup Arguments======================================= */
+
+// Please use "class Arguments" (see utility.hpp) to pass parameters to templated testers;
+// Some routines may not touch/use certain "members" of objects "argus".
+// like BLAS-1 Scal does not have lda, BLAS-2 TBSV does not have ldb, ldc;
+// That is fine. These testers & routines will leave untouched members alone.
+// Do not use std::tuple to directly pass parameters to testers
+// by std:tuple, you have unpack it with extreme care for each one by like "std::get<0>" which is
+// not intuitive and error-prone
+
+Arguments setup_tbsv_arguments(tbsv_tuple tup)
+{
+    vector<int>  matrix_size      = std::get<0>(tup);
+    int          incx             = std::get<1>(tup);
+    vector<char> uplo_transA_diag = std::get<2>(tup);
+    double       stride_scale     = std::get<3>(tup);
+    int          batch_count      = std::get<4>(tup);
+
+    Arguments arg;
+
+    // see the comments about matrix_size_range above
+    arg.N   = matrix_size[0];
+    arg.K   = matrix_size[1];
+    arg.lda = matrix_size[2];
+
+    arg.incx = incx;
+
+    arg.uplo_option   = uplo_transA_diag[0];
+    arg.transA_option = uplo_transA_diag[1];
+    arg.diag_option   = uplo_transA_diag[2];
+
+    arg.timing = 0;
+
+    arg.stride_scale = stride_scale;
+    arg.batch_count  = batch_count;
+
+    return arg;
+}
+
+class blas2_tbsv_gtest : public ::TestWithParam<tbsv_tuple>
+{
+protected:
+    blas2_tbsv_gtest() {}
+    virtual ~blas2_tbsv_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_P(blas2_tbsv_gtest, tbsv_float)
+{
+    Arguments arg = setup_tbsv_arguments(GetParam());
+
+    hipblasStatus_t status = testing_tbsv<float>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.N < 0 || arg.K < 0 || arg.lda < arg.K + 1 || arg.incx == 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
+
+TEST_P(blas2_tbsv_gtest, tbsv_double)
+{
+    Arguments arg = setup_tbsv_arguments(GetParam());
+
+    hipblasStatus_t status = testing_tbsv<double>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.N < 0 || arg.K < 0 || arg.lda < arg.K + 1 || arg.incx == 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
+
+TEST_P(blas2_tbsv_gtest, tbsv_float_complex)
+{
+    Arguments arg = setup_tbsv_arguments(GetParam());
+
+    hipblasStatus_t status = testing_tbsv<hipblasComplex>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.N < 0 || arg.K < 0 || arg.lda < arg.K + 1 || arg.incx == 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
+
+TEST_P(blas2_tbsv_gtest, tbsv_double_complex)
+{
+    Arguments arg = setup_tbsv_arguments(GetParam());
+
+    hipblasStatus_t status = testing_tbsv<hipblasDoubleComplex>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.N < 0 || arg.K < 0 || arg.lda < arg.K + 1 || arg.incx == 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
+
+TEST_P(blas2_tbsv_gtest, tbsv_batched_float)
+{
+    Arguments arg = setup_tbsv_arguments(GetParam());
+
+    hipblasStatus_t status = testing_tbsv_batched<float>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.N < 0 || arg.K < 0 || arg.lda < arg.K + 1 || arg.incx == 0 || arg.batch_count < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_NOT_SUPPORTED, status); // for cuda
+        }
+    }
+}
+
+TEST_P(blas2_tbsv_gtest, tbsv_batched_double)
+{
+    Arguments arg = setup_tbsv_arguments(GetParam());
+
+    hipblasStatus_t status = testing_tbsv_batched<double>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.N < 0 || arg.K < 0 || arg.lda < arg.K + 1 || arg.incx == 0 || arg.batch_count < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_NOT_SUPPORTED, status); // for cuda
+        }
+    }
+}
+
+TEST_P(blas2_tbsv_gtest, tbsv_batched_float_complex)
+{
+    Arguments arg = setup_tbsv_arguments(GetParam());
+
+    hipblasStatus_t status = testing_tbsv_batched<hipblasComplex>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.N < 0 || arg.K < 0 || arg.lda < arg.K + 1 || arg.incx == 0 || arg.batch_count < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_NOT_SUPPORTED, status); // for cuda
+        }
+    }
+}
+
+TEST_P(blas2_tbsv_gtest, tbsv_batched_double_complex)
+{
+    Arguments arg = setup_tbsv_arguments(GetParam());
+
+    hipblasStatus_t status = testing_tbsv_batched<hipblasDoubleComplex>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.N < 0 || arg.K < 0 || arg.lda < arg.K + 1 || arg.incx == 0 || arg.batch_count < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_NOT_SUPPORTED, status); // for cuda
+        }
+    }
+}
+
+TEST_P(blas2_tbsv_gtest, tbsv_strided_batched_float)
+{
+    Arguments arg = setup_tbsv_arguments(GetParam());
+
+    hipblasStatus_t status = testing_tbsv_strided_batched<float>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.N < 0 || arg.K < 0 || arg.lda < arg.K + 1 || arg.incx == 0 || arg.batch_count < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_NOT_SUPPORTED, status); // for cuda
+        }
+    }
+}
+
+TEST_P(blas2_tbsv_gtest, tbsv_strided_batched_double)
+{
+    Arguments arg = setup_tbsv_arguments(GetParam());
+
+    hipblasStatus_t status = testing_tbsv_strided_batched<double>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.N < 0 || arg.K < 0 || arg.lda < arg.K + 1 || arg.incx == 0 || arg.batch_count < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_NOT_SUPPORTED, status); // for cuda
+        }
+    }
+}
+
+TEST_P(blas2_tbsv_gtest, tbsv_strided_batched_float_complex)
+{
+    Arguments arg = setup_tbsv_arguments(GetParam());
+
+    hipblasStatus_t status = testing_tbsv_strided_batched<hipblasComplex>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.N < 0 || arg.K < 0 || arg.lda < arg.K + 1 || arg.incx == 0 || arg.batch_count < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_NOT_SUPPORTED, status); // for cuda
+        }
+    }
+}
+
+TEST_P(blas2_tbsv_gtest, tbsv_strided_batched_double_complex)
+{
+    Arguments arg = setup_tbsv_arguments(GetParam());
+
+    hipblasStatus_t status = testing_tbsv_strided_batched<hipblasDoubleComplex>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.N < 0 || arg.K < 0 || arg.lda < arg.K + 1 || arg.incx == 0 || arg.batch_count < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_NOT_SUPPORTED, status); // for cuda
+        }
+    }
+}
+
+// notice we are using vector of vector
+// so each elment in xxx_range is a avector,
+// ValuesIn take each element (a vector) and combine them and feed them to test_p
+// The combinations are  { {N, K, lda}, incx, {uplo, transA, diag}, stride_scale, batch_count }
+
+INSTANTIATE_TEST_CASE_P(hipblasTbsv,
+                        blas2_tbsv_gtest,
+                        Combine(ValuesIn(matrix_size_range),
+                                ValuesIn(incx_range),
+                                ValuesIn(uplo_transA_diag_range),
+                                ValuesIn(stride_scale_range),
+                                ValuesIn(batch_count_range)));
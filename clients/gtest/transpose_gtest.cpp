@@ -0,0 +1,200 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_transpose.hpp"
+#include "testing_transpose_batched.hpp"
+#include "testing_transpose_strided_batched.hpp"
+#include "utility.h"
+#include <gtest/gtest.h>
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+/* =====================================================================
+     BLAS in-place transpose:
+=================================================================== */
+
+typedef std::tuple<vector<int>, char> transpose_tuple;
+typedef std::tuple<vector<int>, char, double, int> transpose_batched_tuple;
+
+// {N, lda}
+const vector<vector<int>> matrix_size_range = {{-1, 1},
+                                               {2, 1},
+                                               {1, 1},
+                                               {32, 32},
+                                               {33, 40},
+                                               {70, 70},
+                                               {31, 33},
+                                               {129, 130},
+                                               {500, 517}};
+
+const vector<vector<int>> batched_matrix_size_range = {{-1, 1}, {45, 48}, {100, 101}};
+
+const vector<char> trans_range = {'N', 'T', 'C'};
+
+// 1.5 leaves room between the batches, which must keep its values
+const vector<double> stride_scale_range = {1.0, 1.5};
+
+const vector<int> batch_count_range = {-1, 0, 1, 5};
+
+Arguments setup_transpose_arguments(transpose_tuple tup)
+{
+    vector<int> matrix_size = std::get<0>(tup);
+
+    Arguments arg;
+
+    arg.N   = matrix_size[0];
+    arg.lda = matrix_size[1];
+
+    arg.transA_option = std::get<1>(tup);
+
+    return arg;
+}
+
+Arguments setup_transpose_batched_arguments(transpose_batched_tuple tup)
+{
+    Arguments arg = setup_transpose_arguments(transpose_tuple(std::get<0>(tup), std::get<1>(tup)));
+
+    arg.stride_scale = std::get<2>(tup);
+    arg.batch_count  = std::get<3>(tup);
+
+    return arg;
+}
+
+// the testers reject invalid sizes before the call
+static void check_transpose_status(const Arguments& arg, hipblasStatus_t status)
+{
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.N < 0 || arg.lda < max(1, arg.N) || arg.batch_count < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+        }
+    }
+}
+
+class transpose_gtest : public ::TestWithParam<transpose_tuple>
+{
+protected:
+    transpose_gtest() {}
+    virtual ~transpose_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_P(transpose_gtest, transpose_gtest_float)
+{
+    // GetParam returns a tuple. The setup routine unpacks the tuple
+    // and initializes arg(Arguments), which will be passed to testing routine.
+
+    Arguments arg = setup_transpose_arguments(GetParam());
+
+    check_transpose_status(arg, testing_transpose<float>(arg));
+}
+
+TEST_P(transpose_gtest, transpose_gtest_double)
+{
+    Arguments arg = setup_transpose_arguments(GetParam());
+
+    check_transpose_status(arg, testing_transpose<double>(arg));
+}
+
+TEST_P(transpose_gtest, transpose_gtest_float_complex)
+{
+    Arguments arg = setup_transpose_arguments(GetParam());
+
+    check_transpose_status(arg, testing_transpose<hipblasComplex>(arg));
+}
+
+TEST_P(transpose_gtest, transpose_gtest_double_complex)
+{
+    Arguments arg = setup_transpose_arguments(GetParam());
+
+    check_transpose_status(arg, testing_transpose<hipblasDoubleComplex>(arg));
+}
+
+class transpose_batched_gtest : public ::TestWithParam<transpose_batched_tuple>
+{
+protected:
+    transpose_batched_gtest() {}
+    virtual ~transpose_batched_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_P(transpose_batched_gtest, transpose_batched_gtest_float)
+{
+    Arguments arg = setup_transpose_batched_arguments(GetParam());
+
+    check_transpose_status(arg, testing_transpose_batched<float>(arg));
+}
+
+TEST_P(transpose_batched_gtest, transpose_batched_gtest_double_complex)
+{
+    Arguments arg = setup_transpose_batched_arguments(GetParam());
+
+    check_transpose_status(arg, testing_transpose_batched<hipblasDoubleComplex>(arg));
+}
+
+TEST_P(transpose_batched_gtest, transpose_strided_batched_gtest_float)
+{
+    Arguments arg = setup_transpose_batched_arguments(GetParam());
+
+    check_transpose_status(arg, testing_transpose_strided_batched<float>(arg));
+}
+
+TEST_P(transpose_batched_gtest, transpose_strided_batched_gtest_double_complex)
+{
+    Arguments arg = setup_transpose_batched_arguments(GetParam());
+
+    check_transpose_status(arg, testing_transpose_strided_batched<hipblasDoubleComplex>(arg));
+}
+
+// The combinations are  { {N, lda}, trans } and { {N, lda}, trans, stride_scale, batch_count }
+
+INSTANTIATE_TEST_CASE_P(hipblasTranspose,
+                        transpose_gtest,
+                        Combine(ValuesIn(matrix_size_range), ValuesIn(trans_range)));
+
+INSTANTIATE_TEST_CASE_P(hipblasTranspose_batched,
+                        transpose_batched_gtest,
+                        Combine(ValuesIn(batched_matrix_size_range),
+                                ValuesIn(trans_range),
+                                ValuesIn(stride_scale_range),
+                                ValuesIn(batch_count_range)));
+
+TEST(hipblas_transpose, bad_arg)
+{
+    hipblasHandle_t handle;
+    ASSERT_EQ(hipblas_client_create(&handle), HIPBLAS_STATUS_SUCCESS);
+
+    float              x[4];
+    hipblasOperation_t T = HIPBLAS_OP_T;
+    EXPECT_EQ(hipblasStranspose(nullptr, T, 2, x, 2), HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_EQ(hipblasStranspose(handle, hipblasOperation_t(0), 2, x, 2),
+              HIPBLAS_STATUS_INVALID_ENUM);
+    EXPECT_EQ(hipblasStranspose(handle, T, -1, x, 2), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasStranspose(handle, T, 2, x, 1), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasStranspose(handle, T, 2, nullptr, 2), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasStransposeStridedBatched(handle, T, 2, x, 2, 4, -1),
+              HIPBLAS_STATUS_INVALID_VALUE);
+
+    // nothing to move, so the matrix is not looked at
+    EXPECT_EQ(hipblasStranspose(handle, HIPBLAS_OP_N, 2, nullptr, 2), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasStranspose(handle, T, 0, nullptr, 1), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasZtransposeBatched(handle, T, 2, nullptr, 2, 0), HIPBLAS_STATUS_SUCCESS);
+
+    EXPECT_EQ(hipblas_client_destroy(handle), HIPBLAS_STATUS_SUCCESS);
+}
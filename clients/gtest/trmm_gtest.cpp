@@ -5,6 +5,7 @@
 
 #include "testing_trmm.hpp"
 #include "testing_trmm_batched.hpp"
+#include "testing_trmm_outofplace.hpp"
 #include "testing_trmm_strided_batched.hpp"
 #include "utility.h"
 #include <gtest/gtest.h>
@@ -207,6 +208,50 @@ TEST_P(trmm_gtest, trmm_gtest_double_complex)
     }
 }
 
+TEST_P(trmm_gtest, trmm_outofplace_gtest_float)
+{
+    Arguments arg = setup_trmm_arguments(GetParam());
+
+    hipblasStatus_t status = testing_trmm_outofplace<float>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+
+        if(arg.M < 0 || arg.N < 0 || arg.ldb < arg.M
+           || (arg.side_option == 'L' ? arg.lda < arg.M : arg.lda < arg.N))
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
+
+TEST_P(trmm_gtest, trmm_outofplace_gtest_double_complex)
+{
+    Arguments arg = setup_trmm_arguments(GetParam());
+
+    hipblasStatus_t status = testing_trmm_outofplace<hipblasDoubleComplex>(arg);
+
+    // if not success, then the input argument is problematic, so detect the error message
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+
+        if(arg.M < 0 || arg.N < 0 || arg.ldb < arg.M
+           || (arg.side_option == 'L' ? arg.lda < arg.M : arg.lda < arg.N))
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status); // fail
+        }
+    }
+}
+
 TEST_P(trmm_gtest, trmm_batched_gtest_float)
 {
     // GetParam return a tuple. Tee setup routine unpack the tuple
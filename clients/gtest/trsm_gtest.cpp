@@ -5,7 +5,9 @@
 
 #include "testing_trsm.hpp"
 #include "testing_trsm_batched.hpp"
+#include "testing_trsm_ex.hpp"
 #include "testing_trsm_strided_batched.hpp"
+#include "testing_trsm_strided_batched_ex.hpp"
 #include "utility.h"
 #include <gtest/gtest.h>
 #include <math.h>
@@ -320,6 +322,86 @@ TEST_P(trsm_gtest, trsm_strided_batched_gtest_double_complex)
     }
 }
 
+TEST_P(trsm_gtest, trsm_ex_gtest_float)
+{
+    Arguments arg = setup_trsm_arguments(GetParam());
+
+    hipblasStatus_t status = testing_trsm_ex<float>(arg);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.M < 0 || arg.N < 0 || arg.ldb < arg.M
+           || (arg.side_option == 'L' ? arg.lda < arg.M : arg.lda < arg.N))
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+        }
+    }
+}
+
+TEST_P(trsm_gtest, trsm_ex_gtest_double)
+{
+    Arguments arg = setup_trsm_arguments(GetParam());
+
+    hipblasStatus_t status = testing_trsm_ex<double>(arg);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.M < 0 || arg.N < 0 || arg.ldb < arg.M
+           || (arg.side_option == 'L' ? arg.lda < arg.M : arg.lda < arg.N))
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+        }
+    }
+}
+
+TEST_P(trsm_gtest, trsm_strided_batched_ex_gtest_float)
+{
+    Arguments arg = setup_trsm_arguments(GetParam());
+
+    hipblasStatus_t status = testing_trsm_strided_batched_ex<float>(arg);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.M < 0 || arg.N < 0 || arg.ldb < arg.M
+           || (arg.side_option == 'L' ? arg.lda < arg.M : arg.lda < arg.N) || arg.batch_count < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_NOT_SUPPORTED, status); // for cuda
+        }
+    }
+}
+
+TEST_P(trsm_gtest, trsm_strided_batched_ex_gtest_double)
+{
+    Arguments arg = setup_trsm_arguments(GetParam());
+
+    hipblasStatus_t status = testing_trsm_strided_batched_ex<double>(arg);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.M < 0 || arg.N < 0 || arg.ldb < arg.M
+           || (arg.side_option == 'L' ? arg.lda < arg.M : arg.lda < arg.N) || arg.batch_count < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_NOT_SUPPORTED, status); // for cuda
+        }
+    }
+}
+
 // notice we are using vector of vector
 // so each elment in xxx_range is a avector,
 // ValuesIn take each element (a vector) and combine them and feed them to test_p
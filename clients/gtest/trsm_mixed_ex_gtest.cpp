@@ -0,0 +1,257 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_trmm_mixed_batched_ex.hpp"
+#include "testing_trmm_mixed_ex.hpp"
+#include "testing_trmm_mixed_strided_batched_ex.hpp"
+#include "testing_trsm_mixed_batched_ex.hpp"
+#include "testing_trsm_mixed_ex.hpp"
+#include "testing_trsm_mixed_strided_batched_ex.hpp"
+#include "utility.h"
+#include <gtest/gtest.h>
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+/* =====================================================================
+     BLAS mixed-precision trsm and trmm:
+=================================================================== */
+
+typedef std::tuple<vector<int>, char, char, char, char> trsm_mixed_tuple;
+typedef std::tuple<vector<int>, char, char, char, char, int> trsm_mixed_batched_tuple;
+
+// {M, N}: orders of A past one diagonal block recurse, so the gemm updates run between the blocks
+const vector<vector<int>> matrix_size_range
+    = {{-1, 4}, {70, 19}, {45, 33}, {17, 70}, {100, 5}, {9, 40}};
+
+const vector<char> side_range   = {'L', 'R'};
+const vector<char> uplo_range   = {'L', 'U'};
+const vector<char> transA_range = {'N', 'T'};
+const vector<char> diag_range   = {'N', 'U'};
+
+const vector<int> batch_count_range = {-1, 0, 3};
+
+Arguments setup_trsm_mixed_arguments(trsm_mixed_tuple tup)
+{
+    vector<int> matrix_size = std::get<0>(tup);
+
+    Arguments arg;
+
+    arg.M             = matrix_size[0];
+    arg.N             = matrix_size[1];
+    arg.side_option   = std::get<1>(tup);
+    arg.uplo_option   = std::get<2>(tup);
+    arg.transA_option = std::get<3>(tup);
+    arg.diag_option   = std::get<4>(tup);
+
+    // a power of two, so B / alpha stays exact
+    arg.alpha = 2;
+
+    // padded A and B, whose extra rows must not be read or must keep their values
+    int k   = arg.side_option == 'L' ? arg.M : arg.N;
+    arg.lda = max(1, k + 1);
+    arg.ldb = max(1, arg.M + 2);
+
+    return arg;
+}
+
+Arguments setup_trsm_mixed_batched_arguments(trsm_mixed_batched_tuple tup)
+{
+    Arguments arg = setup_trsm_mixed_arguments(trsm_mixed_tuple(std::get<0>(tup),
+                                                                std::get<1>(tup),
+                                                                std::get<2>(tup),
+                                                                std::get<3>(tup),
+                                                                std::get<4>(tup)));
+
+    // room between the batches too, for the strided batched form
+    arg.stride_scale = 1.5;
+    arg.batch_count  = std::get<5>(tup);
+
+    return arg;
+}
+
+// the testers reject invalid sizes before the call
+static void check_trsm_mixed_status(const Arguments& arg, hipblasStatus_t status)
+{
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.M < 0 || arg.N < 0 || arg.batch_count < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+        }
+    }
+}
+
+class trsm_mixed_ex_gtest : public ::TestWithParam<trsm_mixed_tuple>
+{
+protected:
+    trsm_mixed_ex_gtest() {}
+    virtual ~trsm_mixed_ex_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_P(trsm_mixed_ex_gtest, trsm_mixed_ex_half)
+{
+    // GetParam returns a tuple. The setup routine unpacks the tuple
+    // and initializes arg(Arguments), which will be passed to testing routine.
+
+    Arguments arg = setup_trsm_mixed_arguments(GetParam());
+
+    check_trsm_mixed_status(arg, testing_trsm_mixed_ex<hipblasHalf>(arg));
+}
+
+TEST_P(trsm_mixed_ex_gtest, trsm_mixed_ex_bfloat16)
+{
+    Arguments arg = setup_trsm_mixed_arguments(GetParam());
+
+    check_trsm_mixed_status(arg, testing_trsm_mixed_ex<hipblasBfloat16>(arg));
+}
+
+TEST_P(trsm_mixed_ex_gtest, trsm_mixed_ex_float)
+{
+    Arguments arg = setup_trsm_mixed_arguments(GetParam());
+
+    check_trsm_mixed_status(arg, testing_trsm_mixed_ex<float>(arg));
+}
+
+TEST_P(trsm_mixed_ex_gtest, trmm_mixed_ex_half)
+{
+    Arguments arg = setup_trsm_mixed_arguments(GetParam());
+
+    check_trsm_mixed_status(arg, testing_trmm_mixed_ex<hipblasHalf>(arg));
+}
+
+TEST_P(trsm_mixed_ex_gtest, trmm_mixed_ex_bfloat16)
+{
+    Arguments arg = setup_trsm_mixed_arguments(GetParam());
+
+    check_trsm_mixed_status(arg, testing_trmm_mixed_ex<hipblasBfloat16>(arg));
+}
+
+class trsm_mixed_batched_ex_gtest : public ::TestWithParam<trsm_mixed_batched_tuple>
+{
+protected:
+    trsm_mixed_batched_ex_gtest() {}
+    virtual ~trsm_mixed_batched_ex_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_P(trsm_mixed_batched_ex_gtest, trsm_mixed_batched_ex_half)
+{
+    Arguments arg = setup_trsm_mixed_batched_arguments(GetParam());
+
+    check_trsm_mixed_status(arg, testing_trsm_mixed_batched_ex<hipblasHalf>(arg));
+}
+
+TEST_P(trsm_mixed_batched_ex_gtest, trsm_mixed_strided_batched_ex_half)
+{
+    Arguments arg = setup_trsm_mixed_batched_arguments(GetParam());
+
+    check_trsm_mixed_status(arg, testing_trsm_mixed_strided_batched_ex<hipblasHalf>(arg));
+}
+
+TEST_P(trsm_mixed_batched_ex_gtest, trmm_mixed_batched_ex_half)
+{
+    Arguments arg = setup_trsm_mixed_batched_arguments(GetParam());
+
+    check_trsm_mixed_status(arg, testing_trmm_mixed_batched_ex<hipblasHalf>(arg));
+}
+
+TEST_P(trsm_mixed_batched_ex_gtest, trmm_mixed_strided_batched_ex_float)
+{
+    Arguments arg = setup_trsm_mixed_batched_arguments(GetParam());
+
+    check_trsm_mixed_status(arg, testing_trmm_mixed_strided_batched_ex<float>(arg));
+}
+
+// The combinations are  { {M, N}, side, uplo, transA, diag } and
+// { {M, N}, side, uplo, transA, diag, batch_count }
+
+INSTANTIATE_TEST_CASE_P(hipblasTrsmMixedEx,
+                        trsm_mixed_ex_gtest,
+                        Combine(ValuesIn(matrix_size_range),
+                                ValuesIn(side_range),
+                                ValuesIn(uplo_range),
+                                ValuesIn(transA_range),
+                                ValuesIn(diag_range)));
+
+INSTANTIATE_TEST_CASE_P(hipblasTrsmMixedEx_batched,
+                        trsm_mixed_batched_ex_gtest,
+                        Combine(ValuesIn(matrix_size_range),
+                                ValuesIn(side_range),
+                                ValuesIn(uplo_range),
+                                ValuesIn(transA_range),
+                                ValuesIn(diag_range),
+                                ValuesIn(batch_count_range)));
+
+TEST(hipblas_trsm_mixed_ex, bad_arg)
+{
+    hipblasHandle_t handle;
+    ASSERT_EQ(hipblas_client_create(&handle), HIPBLAS_STATUS_SUCCESS);
+
+    float alpha = 1;
+
+    device_vector<hipblasHalf> dA(16);
+    device_vector<hipblasHalf> dB(16);
+
+    hipblasOperation_t OP_N = HIPBLAS_OP_N;
+
+    auto call = [&](hipblasHandle_t    h,
+                    hipblasOperation_t trans,
+                    int                m,
+                    int                lda,
+                    const void*        A,
+                    void*              B,
+                    hipblasDatatype_t  b_type,
+                    hipblasDatatype_t  compute_type) {
+        return hipblasTrsmMixedEx(h,
+                                  HIPBLAS_SIDE_LEFT,
+                                  HIPBLAS_FILL_MODE_LOWER,
+                                  trans,
+                                  HIPBLAS_DIAG_NON_UNIT,
+                                  m,
+                                  4,
+                                  &alpha,
+                                  A,
+                                  HIPBLAS_R_16F,
+                                  lda,
+                                  B,
+                                  b_type,
+                                  4,
+                                  compute_type);
+    };
+    EXPECT_EQ(call(nullptr, OP_N, 4, 4, dA, dB, HIPBLAS_R_16F, HIPBLAS_R_32F),
+              HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_EQ(call(handle, hipblasOperation_t(-1), 4, 4, dA, dB, HIPBLAS_R_16F, HIPBLAS_R_32F),
+              HIPBLAS_STATUS_INVALID_ENUM);
+    EXPECT_EQ(call(handle, OP_N, -1, 4, dA, dB, HIPBLAS_R_16F, HIPBLAS_R_32F),
+              HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(call(handle, OP_N, 4, 3, dA, dB, HIPBLAS_R_16F, HIPBLAS_R_32F),
+              HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(call(handle, OP_N, 4, 4, nullptr, dB, HIPBLAS_R_16F, HIPBLAS_R_32F),
+              HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(call(handle, OP_N, 4, 4, dA, nullptr, HIPBLAS_R_16F, HIPBLAS_R_32F),
+              HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(call(handle, OP_N, 0, 4, nullptr, nullptr, HIPBLAS_R_16F, HIPBLAS_R_32F),
+              HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(call(handle, OP_N, 4, 4, dA, dB, HIPBLAS_R_16B, HIPBLAS_R_32F),
+              HIPBLAS_STATUS_NOT_SUPPORTED);
+    EXPECT_EQ(call(handle, OP_N, 4, 4, dA, dB, HIPBLAS_R_16F, HIPBLAS_R_16F),
+              HIPBLAS_STATUS_NOT_SUPPORTED);
+
+    EXPECT_EQ(hipblas_client_destroy(handle), HIPBLAS_STATUS_SUCCESS);
+}
@@ -0,0 +1,95 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_trsm_xt.hpp"
+#include "utility.h"
+#include <gtest/gtest.h>
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, double, vector<char>> trsm_xt_tuple;
+
+// {M, N, lda, ldb}; the tests use 64 x 64 tiles, so the larger sizes solve in several steps over
+// several panels, with partial tiles
+const vector<vector<int>> matrix_size_range
+    = {{-1, -1, 1, 1}, {10, 10, 20, 100}, {150, 130, 150, 152}};
+
+const vector<double> alpha_range = {1.0, -5.0};
+
+// {side, uplo, transA, diag}
+const vector<vector<char>> side_uplo_transA_diag_range = {
+    {'L', 'L', 'N', 'N'},
+    {'R', 'L', 'N', 'N'},
+    {'L', 'U', 'C', 'N'},
+    {'R', 'U', 'T', 'U'},
+};
+
+Arguments setup_trsm_xt_arguments(trsm_xt_tuple tup)
+{
+    vector<int>  matrix_size           = std::get<0>(tup);
+    vector<char> side_uplo_transA_diag = std::get<2>(tup);
+
+    Arguments arg;
+
+    arg.M   = matrix_size[0];
+    arg.N   = matrix_size[1];
+    arg.lda = matrix_size[2];
+    arg.ldb = matrix_size[3];
+
+    arg.alpha = std::get<1>(tup);
+
+    arg.side_option   = side_uplo_transA_diag[0];
+    arg.uplo_option   = side_uplo_transA_diag[1];
+    arg.transA_option = side_uplo_transA_diag[2];
+    arg.diag_option   = side_uplo_transA_diag[3];
+
+    return arg;
+}
+
+class trsm_xt_gtest : public ::TestWithParam<trsm_xt_tuple>
+{
+protected:
+    trsm_xt_gtest() {}
+    virtual ~trsm_xt_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_P(trsm_xt_gtest, trsm_xt_gtest_double)
+{
+    // GetParam returns a tuple. The setup routine unpacks the tuple
+    // and initializes arg(Arguments), which will be passed to testing routine.
+
+    Arguments arg = setup_trsm_xt_arguments(GetParam());
+
+    hipblasStatus_t status = testing_trsm_xt<double>(arg);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.M < 0 || arg.N < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+        }
+    }
+}
+
+// The combinations are  { {M, N, lda, ldb}, alpha, {side, uplo, transA, diag} }
+
+INSTANTIATE_TEST_CASE_P(hipblasXtTrsm,
+                        trsm_xt_gtest,
+                        Combine(ValuesIn(matrix_size_range),
+                                ValuesIn(alpha_range),
+                                ValuesIn(side_uplo_transA_diag_range)));
@@ -0,0 +1,145 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_tsqr.hpp"
+#include "utility.h"
+#include <gtest/gtest.h>
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, int, bool> tsqr_tuple;
+
+// {M, N, lda, ldr}
+const vector<vector<int>> matrix_size_range = {{-1, 1, 1, 1},
+                                               {3, 4, 8, 4},
+                                               {8, 4, 7, 4},
+                                               {8, 4, 8, 3},
+                                               {8, 0, 8, 1},
+                                               {7, 7, 10, 8},
+                                               {40, 8, 43, 9},
+                                               {200, 4, 203, 5},
+                                               {513, 17, 516, 18},
+                                               {1000, 8, 1003, 9},
+                                               {2048, 64, 2051, 65}};
+
+const vector<int> algo_range
+    = {HIPBLAS_TSQR_AUTO, HIPBLAS_TSQR_CHOLESKY_QR2, HIPBLAS_TSQR_HOUSEHOLDER};
+
+// column 1 zero, so potrf cannot factor the Gram matrix
+const vector<bool> zero_column_range = {false, true};
+
+Arguments setup_tsqr_arguments(tsqr_tuple tup)
+{
+    vector<int> matrix_size = std::get<0>(tup);
+    int         algo        = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.M   = matrix_size[0];
+    arg.N   = matrix_size[1];
+    arg.lda = matrix_size[2];
+    arg.ldb = matrix_size[3];
+
+    arg.algo = algo;
+
+    return arg;
+}
+
+class tsqr_gtest : public ::TestWithParam<tsqr_tuple>
+{
+protected:
+    tsqr_gtest() {}
+    virtual ~tsqr_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+// The tester rejects invalid sizes before the call; bad_arg passes them to the library
+static void check_tsqr_status(const Arguments& arg, hipblasStatus_t status)
+{
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.N < 0 || arg.M < arg.N || arg.lda < max(1, arg.M) || arg.ldb < max(1, arg.N))
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+        }
+    }
+}
+
+TEST_P(tsqr_gtest, tsqr_gtest_float)
+{
+    // GetParam returns a tuple. The setup routine unpacks the tuple
+    // and initializes arg(Arguments), which will be passed to testing routine.
+
+    Arguments arg = setup_tsqr_arguments(GetParam());
+
+    check_tsqr_status(arg, testing_tsqr<float>(arg, std::get<2>(GetParam())));
+}
+
+TEST_P(tsqr_gtest, tsqr_gtest_double)
+{
+    Arguments arg = setup_tsqr_arguments(GetParam());
+
+    check_tsqr_status(arg, testing_tsqr<double>(arg, std::get<2>(GetParam())));
+}
+
+TEST_P(tsqr_gtest, tsqr_gtest_float_complex)
+{
+    Arguments arg = setup_tsqr_arguments(GetParam());
+
+    check_tsqr_status(arg, testing_tsqr<hipblasComplex>(arg, std::get<2>(GetParam())));
+}
+
+TEST_P(tsqr_gtest, tsqr_gtest_double_complex)
+{
+    Arguments arg = setup_tsqr_arguments(GetParam());
+
+    check_tsqr_status(arg, testing_tsqr<hipblasDoubleComplex>(arg, std::get<2>(GetParam())));
+}
+
+// The combinations are  { {M, N, lda, ldr}, algo, zero_column }
+
+INSTANTIATE_TEST_CASE_P(hipblasTsqr,
+                        tsqr_gtest,
+                        Combine(ValuesIn(matrix_size_range),
+                                ValuesIn(algo_range),
+                                ValuesIn(zero_column_range)));
+
+TEST(hipblas_tsqr, bad_arg)
+{
+    hipblasHandle_t handle;
+    ASSERT_EQ(hipblas_client_create(&handle), HIPBLAS_STATUS_SUCCESS);
+
+    double  x = 0;
+    double* p = &x;
+
+    EXPECT_EQ(hipblasDtsqr(nullptr, HIPBLAS_TSQR_AUTO, 8, 4, p, 8, p, 4),
+              HIPBLAS_STATUS_NOT_INITIALIZED);
+    EXPECT_EQ(hipblasDtsqr(handle, hipblasTsqrAlgo_t(5), 8, 4, p, 8, p, 4),
+              HIPBLAS_STATUS_INVALID_ENUM);
+    EXPECT_EQ(hipblasDtsqr(handle, HIPBLAS_TSQR_AUTO, 3, 4, p, 8, p, 4),
+              HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasDtsqr(handle, HIPBLAS_TSQR_AUTO, 8, 4, p, 7, p, 4),
+              HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasDtsqr(handle, HIPBLAS_TSQR_AUTO, 8, 4, p, 8, p, 3),
+              HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasDtsqr(handle, HIPBLAS_TSQR_AUTO, 8, 4, nullptr, 8, p, 4),
+              HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasDtsqr(handle, HIPBLAS_TSQR_AUTO, 8, 0, nullptr, 8, nullptr, 1),
+              HIPBLAS_STATUS_SUCCESS);
+
+    EXPECT_EQ(hipblas_client_destroy(handle), HIPBLAS_STATUS_SUCCESS);
+}
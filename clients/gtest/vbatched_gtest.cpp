@@ -0,0 +1,213 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_vbatched.hpp"
+#include "utility.h"
+#include <gtest/gtest.h>
+#include <math.h>
+#include <stdexcept>
+#include <vector>
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, vector<int>, vector<char>, int> vbatched_tuple;
+
+// vector of vector, each vector is a {M, N}, the largest entry of the batch; trsv uses M alone,
+// and getrf and getrs take M for n and N for nrhs
+const vector<vector<int>> matrix_size_range
+    = {{-1, -1}, {1, 1}, {10, 7}, {33, 65}, {300, 40}};
+
+// vector of vector, each vector is a {incx, incy}, negated for the odd entries
+const vector<vector<int>> incx_incy_range = {{1, 1}, {2, 3}, {0, 1}};
+
+// vector of vector, each vector is a {transA, uplo, diag, side}
+const vector<vector<char>> trans_uplo_diag_range
+    = {{'N', 'L', 'N', 'L'}, {'T', 'U', 'N', 'R'}, {'C', 'L', 'U', 'R'}, {'N', 'U', 'U', 'L'}};
+
+const vector<int> batch_count_range = {-1, 0, 1, 7, 1000};
+
+Arguments setup_vbatched_arguments(vbatched_tuple tup)
+{
+    vector<int>  matrix_size     = std::get<0>(tup);
+    vector<int>  incx_incy       = std::get<1>(tup);
+    vector<char> trans_uplo_diag = std::get<2>(tup);
+    int          batch_count     = std::get<3>(tup);
+
+    Arguments arg;
+
+    arg.M = matrix_size[0];
+    arg.N = matrix_size[1];
+
+    arg.incx = incx_incy[0];
+    arg.incy = incx_incy[1];
+
+    arg.transA_option = trans_uplo_diag[0];
+    arg.uplo_option   = trans_uplo_diag[1];
+    arg.diag_option   = trans_uplo_diag[2];
+    arg.side_option   = trans_uplo_diag[3];
+
+    arg.alpha = 2.0;
+    arg.beta  = -1.0;
+
+    arg.timing      = 0;
+    arg.batch_count = batch_count;
+
+    return arg;
+}
+
+class vbatched_gtest : public ::TestWithParam<vbatched_tuple>
+{
+protected:
+    vbatched_gtest() {}
+    virtual ~vbatched_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_P(vbatched_gtest, gemv_vbatched_gtest_float)
+{
+    // GetParam returns a tuple. The setup routine unpacks the tuple
+    // and initializes arg(Arguments), which will be passed to testing routine.
+
+    Arguments arg = setup_vbatched_arguments(GetParam());
+
+    hipblasStatus_t status = testing_gemv_vbatched<float>(arg);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.M < 0 || arg.N < 0 || arg.incx == 0 || arg.incy == 0 || arg.batch_count < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+        }
+    }
+}
+
+TEST_P(vbatched_gtest, trsv_vbatched_gtest_double)
+{
+    // GetParam returns a tuple. The setup routine unpacks the tuple
+    // and initializes arg(Arguments), which will be passed to testing routine.
+
+    Arguments arg = setup_vbatched_arguments(GetParam());
+
+    hipblasStatus_t status = testing_trsv_vbatched<double>(arg);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.M < 0 || arg.incx == 0 || arg.batch_count < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+        }
+    }
+}
+
+TEST_P(vbatched_gtest, getrf_vbatched_gtest_float)
+{
+    // GetParam returns a tuple. The setup routine unpacks the tuple
+    // and initializes arg(Arguments), which will be passed to testing routine.
+
+    Arguments arg = setup_vbatched_arguments(GetParam());
+
+    hipblasStatus_t status = testing_getrf_vbatched<float>(arg);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.M < 0 || arg.N < 0 || arg.batch_count < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+        }
+    }
+}
+
+TEST_P(vbatched_gtest, trsm_vbatched_gtest_double_complex)
+{
+    // GetParam returns a tuple. The setup routine unpacks the tuple
+    // and initializes arg(Arguments), which will be passed to testing routine.
+
+    Arguments arg = setup_vbatched_arguments(GetParam());
+
+    hipblasStatus_t status = testing_trsm_vbatched<hipblasDoubleComplex>(arg);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.M < 0 || arg.N < 0 || arg.batch_count < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+        }
+    }
+}
+
+TEST_P(vbatched_gtest, nrm2_vbatched_gtest_float)
+{
+    // GetParam returns a tuple. The setup routine unpacks the tuple
+    // and initializes arg(Arguments), which will be passed to testing routine.
+
+    Arguments arg = setup_vbatched_arguments(GetParam());
+
+    hipblasStatus_t status = testing_nrm2_vbatched<float>(arg);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.M < 0 || arg.N < 0 || arg.incx == 0 || arg.batch_count < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+        }
+    }
+}
+
+TEST_P(vbatched_gtest, nrm2_vbatched_gtest_double_complex)
+{
+    // GetParam returns a tuple. The setup routine unpacks the tuple
+    // and initializes arg(Arguments), which will be passed to testing routine.
+
+    Arguments arg = setup_vbatched_arguments(GetParam());
+
+    hipblasStatus_t status = testing_nrm2_vbatched<hipblasDoubleComplex>(arg);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(arg.M < 0 || arg.N < 0 || arg.incx == 0 || arg.batch_count < 0)
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE, status);
+        }
+        else
+        {
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, status);
+        }
+    }
+}
+
+// ValuesIn takes each element of the ranges, combines them, and feeds them to test_p
+// The combinations are  { {M, N}, {incx, incy}, {transA, uplo, diag, side}, batch_count }
+
+INSTANTIATE_TEST_CASE_P(hipblasVbatched,
+                        vbatched_gtest,
+                        Combine(ValuesIn(matrix_size_range),
+                                ValuesIn(incx_incy_range),
+                                ValuesIn(trans_uplo_diag_range),
+                                ValuesIn(batch_count_range)));
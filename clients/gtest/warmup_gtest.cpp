@@ -0,0 +1,99 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include <gtest/gtest.h>
+#include <hip/hip_runtime_api.h>
+#include <vector>
+
+using namespace std;
+
+/* =====================================================================
+     BLAS gemm kernel warmup:
+=================================================================== */
+
+TEST(hipblas_warmup, hipblas_warmup)
+{
+    hipblasHandle_t handle;
+    hipblasCreate(&handle);
+
+    hipblasGemmShape_t shapes[] = {
+        {HIPBLAS_OP_N, HIPBLAS_OP_N, 64, 64, 64, HIPBLAS_R_32F, HIPBLAS_R_32F, HIPBLAS_R_32F,
+         HIPBLAS_R_32F},
+        {HIPBLAS_OP_T, HIPBLAS_OP_N, 128, 32, 16, HIPBLAS_R_16F, HIPBLAS_R_16F, HIPBLAS_R_16F,
+         HIPBLAS_R_32F},
+        {HIPBLAS_OP_N, HIPBLAS_OP_T, 0, 8, 8, HIPBLAS_R_64F, HIPBLAS_R_64F, HIPBLAS_R_64F,
+         HIPBLAS_R_64F}};
+    hipblasGemmShape_t bad = shapes[0];
+    bad.m                  = -1;
+
+    EXPECT_EQ(hipblasWarmup(handle, shapes, 3), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasWarmup(handle, nullptr, 0), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasWarmup(handle, nullptr, 1), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasWarmup(handle, shapes, -1), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasWarmup(handle, &bad, 1), HIPBLAS_STATUS_INVALID_VALUE);
+    EXPECT_EQ(hipblasWarmup(nullptr, shapes, 3), HIPBLAS_STATUS_NOT_INITIALIZED);
+
+    // The caller's pointer mode survives
+    hipblasPointerMode_t mode;
+    EXPECT_EQ(hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasWarmup(handle, shapes, 1), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasGetPointerMode(handle, &mode), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(mode, HIPBLAS_POINTER_MODE_DEVICE);
+
+    EXPECT_EQ(hipblasSetCaptureMode(handle, HIPBLAS_CAPTURE_MODE_SAFE), HIPBLAS_STATUS_SUCCESS);
+    EXPECT_EQ(hipblasWarmup(handle, shapes, 3), HIPBLAS_STATUS_NOT_SUPPORTED);
+
+    hipblasDestroy(handle);
+}
+
+// A warmed shape still computes correctly afterwards
+TEST(hipblas_warmup, hipblas_gemm_ex_after_warmup)
+{
+    const int          n     = 32;
+    hipblasGemmShape_t shape = {HIPBLAS_OP_N, HIPBLAS_OP_N, n, n, n, HIPBLAS_R_32F,
+                                HIPBLAS_R_32F, HIPBLAS_R_32F, HIPBLAS_R_32F};
+
+    vector<float> hA(n * n, 1), hB(n * n, 2), hC(n * n);
+    float *       dA, *dB, *dC;
+    ASSERT_EQ(hipMalloc(&dA, sizeof(float) * n * n), hipSuccess);
+    ASSERT_EQ(hipMalloc(&dB, sizeof(float) * n * n), hipSuccess);
+    ASSERT_EQ(hipMalloc(&dC, sizeof(float) * n * n), hipSuccess);
+    ASSERT_EQ(hipMemcpy(dA, hA.data(), sizeof(float) * n * n, hipMemcpyHostToDevice), hipSuccess);
+    ASSERT_EQ(hipMemcpy(dB, hB.data(), sizeof(float) * n * n, hipMemcpyHostToDevice), hipSuccess);
+
+    hipblasHandle_t handle;
+    hipblasCreate(&handle);
+    EXPECT_EQ(hipblasWarmup(handle, &shape, 1), HIPBLAS_STATUS_SUCCESS);
+
+    float alpha = 1, beta = 0;
+    EXPECT_EQ(hipblasGemmEx(handle,
+                            HIPBLAS_OP_N,
+                            HIPBLAS_OP_N,
+                            n,
+                            n,
+                            n,
+                            &alpha,
+                            dA,
+                            HIPBLAS_R_32F,
+                            n,
+                            dB,
+                            HIPBLAS_R_32F,
+                            n,
+                            &beta,
+                            dC,
+                            HIPBLAS_R_32F,
+                            n,
+                            HIPBLAS_R_32F,
+                            HIPBLAS_GEMM_DEFAULT),
+              HIPBLAS_STATUS_SUCCESS);
+    ASSERT_EQ(hipMemcpy(hC.data(), dC, sizeof(float) * n * n, hipMemcpyDeviceToHost), hipSuccess);
+    EXPECT_EQ(hC, vector<float>(n * n, 2.0f * n));
+
+    hipblasDestroy(handle);
+    EXPECT_EQ(hipFree(dA), hipSuccess);
+    EXPECT_EQ(hipFree(dB), hipSuccess);
+    EXPECT_EQ(hipFree(dC), hipSuccess);
+}
@@ -0,0 +1,54 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include "testing_dispatch.hpp"
+#include "utility.h"
+#include "yaml_cases.h"
+#include <cctype>
+#include <gtest/gtest.h>
+#include <string>
+
+using ::testing::TestWithParam;
+using ::testing::ValuesIn;
+
+/* =====================================================================
+     Cases read at runtime from the YAML list given to hipblas-test with --yaml, restricted to
+     the suites given with --suite; none without --yaml
+=================================================================== */
+
+class yaml_gtest : public ::TestWithParam<hipblas_yaml_case>
+{
+protected:
+    yaml_gtest() {}
+    virtual ~yaml_gtest() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_P(yaml_gtest, run)
+{
+    const hipblas_yaml_case& c   = GetParam();
+    Arguments                arg = c.arg;
+    hipblas_fill_leading_dimensions(arg);
+    arg.timing = 0;
+
+    // the checks are the testers' own; a list names only cases that must succeed
+    EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, testing_dispatch(c.function, c.precision, arg))
+        << c.suite << ": " << c.function << " precision " << c.precision << " M " << arg.M
+        << " N " << arg.N << " K " << arg.K;
+}
+
+// gtest names may only hold letters, digits and underscores
+static std::string yaml_case_name(const ::testing::TestParamInfo<hipblas_yaml_case>& info)
+{
+    std::string name = (info.param.suite.empty() ? "all" : info.param.suite) + "_"
+                       + info.param.function + "_" + info.param.precision + "_"
+                       + std::to_string(info.index);
+    for(char& c : name)
+        c = std::isalnum((unsigned char)c) ? c : '_';
+    return name;
+}
+
+INSTANTIATE_TEST_CASE_P(hipblasYaml, yaml_gtest, ValuesIn(hipblas_yaml_cases()), yaml_case_name);
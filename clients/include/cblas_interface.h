@@ -181,6 +181,10 @@ void cblas_symv(
 template <typename T>
 int cblas_potrf(char uplo, int m, T* A, int lda);
 
+// potrs
+template <typename T>
+int cblas_potrs(char uplo, int n, int nrhs, T* A, int lda, T* B, int ldb);
+
 // tbmv
 template <typename T>
 void cblas_tbmv(hipblasFillMode_t  uplo,
@@ -241,6 +245,21 @@ template <typename T>
 void cblas_hemv(
     hipblasFillMode_t uplo, int n, T alpha, T* A, int lda, T* x, int incx, T beta, T* y, int incy);
 
+// hemm
+template <typename T>
+void cblas_hemm(hipblasSideMode_t side,
+                hipblasFillMode_t uplo,
+                int               m,
+                int               n,
+                T                 alpha,
+                T*                A,
+                int               lda,
+                T*                B,
+                int               ldb,
+                T                 beta,
+                T*                C,
+                int               ldc);
+
 // herk
 template <typename T, typename U>
 void cblas_herk(hipblasFillMode_t  uplo,
@@ -300,6 +319,21 @@ void cblas_gemm(hipblasOperation_t transA,
                 T*                 C,
                 int                ldc);
 
+// symm
+template <typename T>
+void cblas_symm(hipblasSideMode_t side,
+                hipblasFillMode_t uplo,
+                int               m,
+                int               n,
+                T                 alpha,
+                T*                A,
+                int               lda,
+                T*                B,
+                int               ldb,
+                T                 beta,
+                T*                C,
+                int               ldc);
+
 // syrk
 template <typename T>
 void cblas_syrk(hipblasFillMode_t  uplo,
@@ -381,8 +415,15 @@ int cblas_getrf(int m, int n, T* A, int lda, int* ipiv);
 template <typename T>
 int cblas_getrs(char trans, int n, int nrhs, T* A, int lda, int* ipiv, T* B, int ldb);
 
+template <typename T>
+int cblas_getri(int n, T* A, int lda, int* ipiv, T* work, int lwork);
+
 template <typename T>
 int cblas_geqrf(int m, int n, T* A, int lda, T* tau, T* work, int lwork);
+
+// lasr, with real rotations U
+template <typename T, typename U>
+void cblas_lasr(char side, char pivot, char direct, int m, int n, U* c, U* s, T* A, int lda);
 /* ============================================================================================ */
 
 #endif /* _CBLAS_INTERFACE_ */
@@ -0,0 +1,39 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef _DEVICE_BLAS_H_
+#define _DEVICE_BLAS_H_
+
+#include "hipblas.h"
+#include <hip/hip_runtime_api.h>
+
+/*!\file
+ * \brief Kernels built on hipblas_device.hpp for testing it, each a single block that stages its
+ *        operands in shared memory, runs one device routine and writes the result back, as a
+ *        user kernel fusing the routine would.
+ *
+ * The matrices are packed, each leading dimension the number of rows, or of columns in row-major
+ * order. Each call has finished when it returns.
+ */
+
+// The sizes the kernels are specialized for
+constexpr int DEVICE_GEMM_M = 8, DEVICE_GEMM_N = 6, DEVICE_GEMM_K = 5;
+constexpr int DEVICE_TRSM_M = 7, DEVICE_TRSM_N = 3;
+constexpr int DEVICE_GETRF_N = 6;
+
+// C = alpha A B^T + beta C with A of M x K, B of N x K and C of M x N, in order
+hipError_t hipblas_device_gemm(
+    hipblasOrder_t order, float alpha, const float* A, const float* B, float beta, float* C);
+
+// Solves op(A) X = alpha B, or X op(A) = alpha B, for the lower triangular A with a non-unit
+// diagonal and the M x N column-major B, in double precision
+hipError_t hipblas_device_trsm(
+    hipblasSideMode_t side, hipblasOperation_t trans, double alpha, const double* A, double* B);
+
+// getrf of the N x N column-major A
+hipError_t hipblas_device_getrf(hipblasDoubleComplex* A, int* ipiv, int* info);
+
+#endif
@@ -0,0 +1,52 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef _DEVICE_COMPARE_H_
+#define _DEVICE_COMPARE_H_
+
+#include "hipblas.h"
+#include <hip/hip_runtime_api.h>
+
+/*!\file
+ * \brief Compares a device result with a device reference without downloading either; only a
+ *        hipblas_compare_summary comes back to the host.
+ *
+ * Complex elements compare part by part. The relative error of an element is its absolute
+ * error over the magnitude of the reference, or the absolute error where the reference is 0.
+ * Each call has finished when it returns.
+ */
+
+struct hipblas_compare_summary
+{
+    double  max_abs_error;  // over elements with no NaN in either buffer
+    double  max_rel_error;
+    int64_t mismatches;     // elements that differ, counting a NaN on one side only
+    int64_t nan_mismatches; // elements that are NaN in exactly one of the buffers
+    int64_t first_mismatch; // lowest (b * N + j) * M + i that differs, or -1
+};
+
+// the M x N matrices at dRef and dResult + b * stride for b < batch_count
+template <typename T>
+hipError_t hipblas_compare_device(int                      M,
+                                  int                      N,
+                                  int                      batch_count,
+                                  int                      lda,
+                                  int64_t                  stride,
+                                  const T*                 dRef,
+                                  const T*                 dResult,
+                                  hipblas_compare_summary* summary);
+
+// the M x N matrices at dRef[b] and dResult[b], with the pointer arrays in device memory
+template <typename T>
+hipError_t hipblas_compare_device_batched(int                      M,
+                                          int                      N,
+                                          int                      batch_count,
+                                          int                      lda,
+                                          const T* const           dRef[],
+                                          const T* const           dResult[],
+                                          hipblas_compare_summary* summary);
+
+#endif
@@ -0,0 +1,38 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef _DEVICE_GUARD_H_
+#define _DEVICE_GUARD_H_
+
+#include <cstddef>
+#include <hip/hip_runtime_api.h>
+
+/*!\file
+ * \brief Guard memory around device test vectors, written and verified on the device.
+ *
+ * The guards of a vector or of a whole batch are evenly spaced, so one launch writes them all
+ * from a host reference and one launch compares them all with it; only the count of corrupted
+ * guards comes back to the host. Setting HIPBLAS_CLIENT_GUARD=n in the environment shrinks the
+ * guards to n elements, 0 turning them off, for batches whose guards would not fit otherwise.
+ * Each call has finished when it returns.
+ */
+
+// elements of guard each side of a vector whose type allows up to pad
+size_t hipblas_client_guard(size_t pad);
+
+// copies the guard_bytes at the host reference into count guards stride_bytes apart
+hipError_t hipblas_device_fill_guards(
+    void* guards, size_t stride_bytes, size_t count, const void* reference, size_t guard_bytes);
+
+// the number of the count guards stride_bytes apart that differ from the host reference
+hipError_t hipblas_device_check_guards(const void* guards,
+                                       size_t      stride_bytes,
+                                       size_t      count,
+                                       const void* reference,
+                                       size_t      guard_bytes,
+                                       size_t*     corrupted);
+
+#endif
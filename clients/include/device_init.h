@@ -0,0 +1,43 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef _DEVICE_INIT_H_
+#define _DEVICE_INIT_H_
+
+#include "hipblas.h"
+#include <hip/hip_runtime_api.h>
+
+/*!\file
+ * \brief Device-side counterparts of hipblas_init, hipblas_init_alternating_sign,
+ *        hipblas_init_symmetric and hipblas_init_hermitian in utility.h, for benchmarks that
+ *        need no host copy of their inputs.
+ *
+ * Each fills a device matrix, or batch_count of them stride elements apart, with the same value
+ * ranges as the host version. The seed is drawn from rand() the way hipblas_init draws it, so
+ * after the same srand() hipblas_init_device writes exactly the values hipblas_init does. Each
+ * call has finished when it returns.
+ */
+
+template <typename T>
+hipError_t
+    hipblas_init_device(T* dA, int M, int N, int lda, int stride = 0, int batch_count = 1);
+
+// entries with i + j even are negative
+template <typename T>
+hipError_t hipblas_init_alternating_sign_device(
+    T* dA, int M, int N, int lda, int stride = 0, int batch_count = 1);
+
+// the N x N matrices are symmetric, entry (i, j) equals entry (j, i)
+template <typename T>
+hipError_t
+    hipblas_init_symmetric_device(T* dA, int N, int lda, int stride = 0, int batch_count = 1);
+
+// as hipblas_init_symmetric_device, with a real diagonal; complex T only
+template <typename T>
+hipError_t
+    hipblas_init_hermitian_device(T* dA, int N, int lda, int stride = 0, int batch_count = 1);
+
+#endif
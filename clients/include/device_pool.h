@@ -0,0 +1,34 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef _DEVICE_POOL_H_
+#define _DEVICE_POOL_H_
+
+#include <cstddef>
+#include <hip/hip_runtime_api.h>
+
+/*!\file
+ * \brief Caching device allocator behind device_vector and device_batch_vector.
+ *
+ * Requests round up to a size class, and freed blocks wait on the free list of their class and
+ * device for the next request of that class instead of going back to hipFree. When hipMalloc
+ * fails the cached blocks are released and the allocation retried once. Everything cached is
+ * released at process exit. Setting HIPBLAS_CLIENT_POOL=0 in the environment passes every call
+ * straight to hipMalloc and hipFree.
+ */
+
+hipError_t hipblas_pool_malloc(void** ptr, size_t bytes);
+
+// ptr must come from hipblas_pool_malloc, or be nullptr
+hipError_t hipblas_pool_free(void* ptr);
+
+// hipFree every cached block that is not in use
+void hipblas_pool_release();
+
+// the most bytes handed out by hipblas_pool_malloc and not yet freed at any one time
+size_t hipblas_pool_peak_bytes();
+
+#endif
@@ -8,13 +8,119 @@
 #define _ROCBLAS_FLOPS_H_
 
 #include "hipblas.h"
+#include "utility.h"
+#include <algorithm>
 #include <typeinfo>
 
 /*!\file
- * \brief provides Floating point counts of Basic Linear Algebra Subprograms (BLAS) of Level 2 and
- * 3. No flops counts for Level 1 BLAS
+ * \brief provides Floating point counts (in GFLOP) of Basic Linear Algebra Subprograms (BLAS) of
+ * Level 1, 2 and 3, and the device memory traffic (in GB) used to report achieved bandwidth.
+ *
+ * Counts are real operations: one complex multiply is 6 flops and one complex add 2, so a complex
+ * multiply-add costs 4x its real counterpart. Byte counts assume every operand is read once and
+ * every output written once, which is the best a bandwidth-bound kernel can do.
 */
 
+// real flops in one multiply and one add of T
+template <typename T>
+constexpr double hipblas_fmul = is_complex<T> ? 6.0 : 1.0;
+
+template <typename T>
+constexpr double hipblas_fadd = is_complex<T> ? 2.0 : 1.0;
+
+template <typename T>
+constexpr double hipblas_fma = hipblas_fmul<T> + hipblas_fadd<T>;
+
+// elements stored in an n x n triangle, and in an m x n band with kl sub- and ku super-diagonals
+inline double tri_count(int n)
+{
+    return n * (n + 1.0) / 2.0;
+}
+
+inline double band_count(int m, int n, int kl, int ku)
+{
+    double count = 0.0;
+    for(int j = 0; j < n; j++)
+        count += std::max(0, std::min(m, j + kl + 1) - std::max(0, j - ku));
+    return count;
+}
+
+/*
+ * ===========================================================================
+ *    level 1 BLAS
+ * ===========================================================================
+ */
+
+/* \brief floating point counts of ASUM: |re| + |im| per element, then the sum */
+template <typename T>
+double asum_gflop_count(int n)
+{
+    return ((is_complex<T> ? 2.0 : 1.0) * n) / 1e9;
+}
+
+/* \brief floating point counts of AXPY */
+template <typename T>
+double axpy_gflop_count(int n)
+{
+    return (hipblas_fma<T> * n) / 1e9;
+}
+
+/* \brief floating point counts of COPY */
+template <typename T>
+double copy_gflop_count(int n)
+{
+    return 0.0;
+}
+
+/* \brief floating point counts of DOT and DOTC */
+template <typename T>
+double dot_gflop_count(int n)
+{
+    return (hipblas_fma<T> * n) / 1e9;
+}
+
+/* \brief floating point counts of IAMAX and IAMIN: one compare (complex: |re| + |im|) each */
+template <typename T>
+double iamax_gflop_count(int n)
+{
+    return ((is_complex<T> ? 2.0 : 1.0) * n) / 1e9;
+}
+
+/* \brief floating point counts of NRM2: a square and an add per element */
+template <typename T>
+double nrm2_gflop_count(int n)
+{
+    return ((is_complex<T> ? 4.0 : 2.0) * n) / 1e9;
+}
+
+/* \brief floating point counts of ROT with real c and s: four scales and two adds per pair */
+template <typename T>
+double rot_gflop_count(int n)
+{
+    return ((is_complex<T> ? 12.0 : 6.0) * n) / 1e9;
+}
+
+/* \brief floating point counts of ROTM, full H */
+template <typename T>
+double rotm_gflop_count(int n)
+{
+    return (6.0 * n) / 1e9;
+}
+
+/* \brief floating point counts of SCAL; U is the type of alpha */
+template <typename T, typename U = T>
+double scal_gflop_count(int n)
+{
+    return ((is_complex<T> ? (is_complex<U> ? 6.0 : 2.0) : 1.0) * n) / 1e9;
+}
+
+/* \brief floating point counts of SWAP */
+template <typename T>
+double swap_gflop_count(int n)
+{
+    return 0.0;
+}
+
 /*
  * ===========================================================================
  *    level 2 BLAS
@@ -25,21 +131,100 @@
 template <typename T>
 double gemv_gflop_count(int m, int n)
 {
-    return (2.0 * m * n) / 1e9;
+    return (hipblas_fma<T> * m * n) / 1e9;
+}
+
+/* \brief floating point counts of GBMV */
+template <typename T>
+double gbmv_gflop_count(int m, int n, int kl, int ku)
+{
+    return (hipblas_fma<T> * band_count(m, n, kl, ku)) / 1e9;
 }
 
-/* \brief floating point counts of SY(HE)MV */
+/* \brief floating point counts of SY(HE)MV and SP(HP)MV */
 template <typename T>
 double symv_gflop_count(int n)
 {
-    return (2.0 * n * n) / 1e9;
+    return (hipblas_fma<T> * n * n) / 1e9;
+}
+
+template <typename T>
+double hemv_gflop_count(int n)
+{
+    return symv_gflop_count<T>(n);
+}
+
+/* \brief floating point counts of SB(HB)MV: the full band holds n * (2k + 1) - k * (k + 1) */
+template <typename T>
+double sbmv_gflop_count(int n, int k)
+{
+    return (hipblas_fma<T> * band_count(n, n, k, k)) / 1e9;
 }
 
-/* \brief floating point counts of GER */
+template <typename T>
+double hbmv_gflop_count(int n, int k)
+{
+    return sbmv_gflop_count<T>(n, k);
+}
+
+/* \brief floating point counts of GER, GERU and GERC */
 template <typename T>
 double ger_gflop_count(int m, int n)
 {
-    return (2.0 * m * n) / 1e9;
+    return (hipblas_fma<T> * m * n) / 1e9;
+}
+
+/* \brief floating point counts of SY(HE)R and SP(HP)R: one triangle updated */
+template <typename T>
+double syr_gflop_count(int n)
+{
+    return (hipblas_fma<T> * tri_count(n)) / 1e9;
+}
+
+template <typename T>
+double her_gflop_count(int n)
+{
+    return syr_gflop_count<T>(n);
+}
+
+/* \brief floating point counts of SY(HE)R2 and SP(HP)R2 */
+template <typename T>
+double syr2_gflop_count(int n)
+{
+    return (2.0 * hipblas_fma<T> * tri_count(n)) / 1e9;
+}
+
+template <typename T>
+double her2_gflop_count(int n)
+{
+    return syr2_gflop_count<T>(n);
+}
+
+/* \brief floating point counts of TRMV and TPMV */
+template <typename T>
+double trmv_gflop_count(int n)
+{
+    return (hipblas_fma<T> * tri_count(n)) / 1e9;
+}
+
+/* \brief floating point counts of TBMV and TBSV */
+template <typename T>
+double tbmv_gflop_count(int n, int k)
+{
+    return (hipblas_fma<T> * band_count(n, n, 0, k)) / 1e9;
+}
+
+template <typename T>
+double tbsv_gflop_count(int n, int k)
+{
+    return tbmv_gflop_count<T>(n, k);
+}
+
+/* \brief floating point counts of TRSV and TPSV */
+template <typename T>
+double trsv_gflop_count(int n)
+{
+    return (hipblas_fma<T> * tri_count(n)) / 1e9;
 }
 
 /*
@@ -52,21 +237,498 @@ double ger_gflop_count(int m, int n)
 template <typename T>
 double gemm_gflop_count(int m, int n, int k)
 {
-    return (2.0 * m * n * k) / 1e9;
+    return (hipblas_fma<T> * m * n * k) / 1e9;
+}
+
+/* \brief floating point counts of GEAM: two scales and an add per element */
+template <typename T>
+double geam_gflop_count(int m, int n)
+{
+    return ((2.0 * hipblas_fmul<T> + hipblas_fadd<T>) * m * n) / 1e9;
+}
+
+/* \brief floating point counts of DGMM: one multiply per element of C */
+template <typename T>
+double dgmm_gflop_count(int m, int n)
+{
+    return (hipblas_fmul<T> * m * n) / 1e9;
+}
+
+/* \brief floating point counts of SYMM and HEMM; k is the order of the symmetric matrix */
+template <typename T>
+double symm_gflop_count(int m, int n, int k)
+{
+    return (hipblas_fma<T> * m * n * k) / 1e9;
+}
+
+template <typename T>
+double hemm_gflop_count(int m, int n, int k)
+{
+    return symm_gflop_count<T>(m, n, k);
+}
+
+/* \brief floating point counts of SY(HE)RK and SY(HE)RKX: one triangle of C */
+template <typename T>
+double syrk_gflop_count(int n, int k)
+{
+    return (hipblas_fma<T> * tri_count(n) * k) / 1e9;
+}
+
+template <typename T>
+double herk_gflop_count(int n, int k)
+{
+    return syrk_gflop_count<T>(n, k);
+}
+
+/* \brief floating point counts of SY(HE)R2K */
+template <typename T>
+double syr2k_gflop_count(int n, int k)
+{
+    return (2.0 * hipblas_fma<T> * tri_count(n) * k) / 1e9;
+}
+
+template <typename T>
+double her2k_gflop_count(int n, int k)
+{
+    return syr2k_gflop_count<T>(n, k);
+}
+
+/* \brief floating point counts of TRMM; k is the order of the triangular matrix */
+template <typename T>
+double trmm_gflop_count(int m, int n, int k)
+{
+    return (hipblas_fma<T> * (m * n * (k + 1.0)) / 2.0) / 1e9;
 }
 
 /* \brief floating point counts of TRSM */
 template <typename T>
 double trsm_gflop_count(int m, int n, int k)
 {
-    return (1.0 * m * n * (k + 1)) / 1e9;
+    return (hipblas_fma<T> * (m * n * (k + 1.0)) / 2.0) / 1e9;
 }
 
 /* \brief floating point counts of TRTRI */
 template <typename T>
 double trtri_gflop_count(int n)
 {
-    return (1.0 * n * n * n) / 3.0 / 1e9;
+    return (hipblas_fma<T> * n * n * n / 6.0) / 1e9;
+}
+
+/*
+ * ===========================================================================
+ *    LAPACK, leading terms
+ * ===========================================================================
+ */
+
+/* \brief floating point counts of GETRF of an n x n matrix */
+template <typename T>
+double getrf_gflop_count(int n)
+{
+    return (hipblas_fma<T> * n * n * n / 3.0) / 1e9;
+}
+
+/* \brief floating point counts of GETRS: two triangular solves per right hand side */
+template <typename T>
+double getrs_gflop_count(int n, int nrhs)
+{
+    return (hipblas_fma<T> * n * n * (double)nrhs) / 1e9;
+}
+
+/* \brief floating point counts of POTRF of an n x n matrix */
+template <typename T>
+double potrf_gflop_count(int n)
+{
+    return (hipblas_fma<T> * n * n * n / 6.0) / 1e9;
+}
+
+/* \brief floating point counts of GETRI from the LU factors of an n x n matrix */
+template <typename T>
+double getri_gflop_count(int n)
+{
+    return (hipblas_fma<T> * 2.0 * n * n * n / 3.0) / 1e9;
+}
+
+/* \brief floating point counts of GEQRF of an m x n matrix, m >= n */
+template <typename T>
+double geqrf_gflop_count(int m, int n)
+{
+    return (hipblas_fma<T> * ((double)m * n * n - (double)n * n * n / 3.0)) / 1e9;
+}
+
+/* \brief floating point counts of TSQR of an m x n matrix, m >= n: GEQRF and forming Q */
+template <typename T>
+double tsqr_gflop_count(int m, int n)
+{
+    return 2.0 * geqrf_gflop_count<T>(m, n);
+}
+
+/*
+ * ===========================================================================
+ *    memory traffic
+ * ===========================================================================
+ */
+
+/* \brief bytes moved by ASUM, IAMAX, IAMIN and NRM2: read x */
+template <typename T>
+double asum_gbyte_count(int n)
+{
+    return (1.0 * n * sizeof(T)) / 1e9;
+}
+
+template <typename T>
+double iamax_gbyte_count(int n)
+{
+    return asum_gbyte_count<T>(n);
+}
+
+template <typename T>
+double nrm2_gbyte_count(int n)
+{
+    return asum_gbyte_count<T>(n);
+}
+
+/* \brief bytes moved by AXPY: read x and y, write y */
+template <typename T>
+double axpy_gbyte_count(int n)
+{
+    return (3.0 * n * sizeof(T)) / 1e9;
+}
+
+/* \brief bytes moved by COPY: read x, write y */
+template <typename T>
+double copy_gbyte_count(int n)
+{
+    return (2.0 * n * sizeof(T)) / 1e9;
+}
+
+/* \brief bytes moved by DOT: read x and y */
+template <typename T>
+double dot_gbyte_count(int n)
+{
+    return (2.0 * n * sizeof(T)) / 1e9;
+}
+
+/* \brief bytes moved by ROT, ROTM and SWAP: read and write x and y */
+template <typename T>
+double rot_gbyte_count(int n)
+{
+    return (4.0 * n * sizeof(T)) / 1e9;
+}
+
+template <typename T>
+double rotm_gbyte_count(int n)
+{
+    return rot_gbyte_count<T>(n);
+}
+
+template <typename T>
+double swap_gbyte_count(int n)
+{
+    return rot_gbyte_count<T>(n);
+}
+
+/* \brief bytes moved by SCAL: read and write x */
+template <typename T>
+double scal_gbyte_count(int n)
+{
+    return (2.0 * n * sizeof(T)) / 1e9;
+}
+
+/* \brief bytes moved by GEMV: read A, x (length n) and y (length m), write y */
+template <typename T>
+double gemv_gbyte_count(int m, int n)
+{
+    return ((1.0 * m * n + n + 2.0 * m) * sizeof(T)) / 1e9;
+}
+
+/* \brief bytes moved by GBMV: read the band of A, x and y, write y */
+template <typename T>
+double gbmv_gbyte_count(int m, int n, int kl, int ku)
+{
+    return ((band_count(m, n, kl, ku) + n + 2.0 * m) * sizeof(T)) / 1e9;
+}
+
+/* \brief bytes moved by SY(HE)MV and SP(HP)MV: read one triangle of A, x and y, write y */
+template <typename T>
+double symv_gbyte_count(int n)
+{
+    return ((tri_count(n) + 3.0 * n) * sizeof(T)) / 1e9;
+}
+
+template <typename T>
+double hemv_gbyte_count(int n)
+{
+    return symv_gbyte_count<T>(n);
+}
+
+/* \brief bytes moved by SB(HB)MV: read the stored half band, x and y, write y */
+template <typename T>
+double sbmv_gbyte_count(int n, int k)
+{
+    return ((band_count(n, n, 0, k) + 3.0 * n) * sizeof(T)) / 1e9;
+}
+
+template <typename T>
+double hbmv_gbyte_count(int n, int k)
+{
+    return sbmv_gbyte_count<T>(n, k);
+}
+
+/* \brief bytes moved by GER: read x, y and A, write A */
+template <typename T>
+double ger_gbyte_count(int m, int n)
+{
+    return ((2.0 * m * n + m + n) * sizeof(T)) / 1e9;
+}
+
+/* \brief bytes moved by SY(HE)R and SP(HP)R: read x, read and write one triangle of A */
+template <typename T>
+double syr_gbyte_count(int n)
+{
+    return ((2.0 * tri_count(n) + n) * sizeof(T)) / 1e9;
+}
+
+template <typename T>
+double her_gbyte_count(int n)
+{
+    return syr_gbyte_count<T>(n);
+}
+
+/* \brief bytes moved by SY(HE)R2 and SP(HP)R2: read x and y, read and write one triangle */
+template <typename T>
+double syr2_gbyte_count(int n)
+{
+    return ((2.0 * tri_count(n) + 2.0 * n) * sizeof(T)) / 1e9;
+}
+
+template <typename T>
+double her2_gbyte_count(int n)
+{
+    return syr2_gbyte_count<T>(n);
+}
+
+/* \brief bytes moved by TRMV, TPMV, TRSV and TPSV: read the triangle, read and write x */
+template <typename T>
+double trmv_gbyte_count(int n)
+{
+    return ((tri_count(n) + 2.0 * n) * sizeof(T)) / 1e9;
+}
+
+template <typename T>
+double trsv_gbyte_count(int n)
+{
+    return trmv_gbyte_count<T>(n);
+}
+
+/* \brief bytes moved by TBMV and TBSV: read the band, read and write x */
+template <typename T>
+double tbmv_gbyte_count(int n, int k)
+{
+    return ((band_count(n, n, 0, k) + 2.0 * n) * sizeof(T)) / 1e9;
+}
+
+template <typename T>
+double tbsv_gbyte_count(int n, int k)
+{
+    return tbmv_gbyte_count<T>(n, k);
+}
+
+/* \brief bytes moved by GEMM: read A, B and C, write C */
+template <typename T>
+double gemm_gbyte_count(int m, int n, int k)
+{
+    return ((1.0 * m * k + 1.0 * k * n + 2.0 * m * n) * sizeof(T)) / 1e9;
+}
+
+/* \brief bytes moved by GEAM: read A and B, write C */
+template <typename T>
+double geam_gbyte_count(int m, int n)
+{
+    return ((3.0 * m * n) * sizeof(T)) / 1e9;
+}
+
+/* \brief bytes moved by DGMM: read A and the k entries of x, write C */
+template <typename T>
+double dgmm_gbyte_count(int m, int n, int k)
+{
+    return ((2.0 * m * n + k) * sizeof(T)) / 1e9;
+}
+
+/* \brief bytes moved by SYMM and HEMM: read one triangle of order k and B, read and write C */
+template <typename T>
+double symm_gbyte_count(int m, int n, int k)
+{
+    return ((tri_count(k) + 3.0 * m * n) * sizeof(T)) / 1e9;
+}
+
+template <typename T>
+double hemm_gbyte_count(int m, int n, int k)
+{
+    return symm_gbyte_count<T>(m, n, k);
+}
+
+/* \brief bytes moved by SY(HE)RK: read A, read and write one triangle of C */
+template <typename T>
+double syrk_gbyte_count(int n, int k)
+{
+    return ((1.0 * n * k + 2.0 * tri_count(n)) * sizeof(T)) / 1e9;
+}
+
+template <typename T>
+double herk_gbyte_count(int n, int k)
+{
+    return syrk_gbyte_count<T>(n, k);
+}
+
+/* \brief bytes moved by SY(HE)R2K and SY(HE)RKX: read A and B, read and write one triangle */
+template <typename T>
+double syr2k_gbyte_count(int n, int k)
+{
+    return ((2.0 * n * k + 2.0 * tri_count(n)) * sizeof(T)) / 1e9;
+}
+
+template <typename T>
+double her2k_gbyte_count(int n, int k)
+{
+    return syr2k_gbyte_count<T>(n, k);
+}
+
+/* \brief bytes moved by TRMM and TRSM: read the triangle of order k, read and write B */
+template <typename T>
+double trmm_gbyte_count(int m, int n, int k)
+{
+    return ((tri_count(k) + 2.0 * m * n) * sizeof(T)) / 1e9;
+}
+
+template <typename T>
+double trsm_gbyte_count(int m, int n, int k)
+{
+    return trmm_gbyte_count<T>(m, n, k);
+}
+
+/* \brief bytes moved by GETRF and GEQRF: read and write A once */
+template <typename T>
+double getrf_gbyte_count(int m, int n)
+{
+    return (2.0 * m * n * sizeof(T)) / 1e9;
+}
+
+template <typename T>
+double geqrf_gbyte_count(int m, int n)
+{
+    return getrf_gbyte_count<T>(m, n);
+}
+
+/* \brief bytes moved by TSQR: read and write A, write the n x n R */
+template <typename T>
+double tsqr_gbyte_count(int m, int n)
+{
+    return ((2.0 * m * n + (double)n * n) * sizeof(T)) / 1e9;
+}
+
+/* \brief bytes moved by POTRF: read and write a triangle of A */
+template <typename T>
+double potrf_gbyte_count(int n)
+{
+    return (2.0 * tri_count(n) * sizeof(T)) / 1e9;
+}
+
+/* \brief bytes moved by GETRS: read the LU factors, read and write B */
+template <typename T>
+double getrs_gbyte_count(int n, int nrhs)
+{
+    return (((double)n * n + 2.0 * n * nrhs) * sizeof(T)) / 1e9;
+}
+
+/* \brief bytes moved by GETRI: read the LU factors, write the inverse */
+template <typename T>
+double getri_gbyte_count(int n)
+{
+    return (2.0 * n * n * sizeof(T)) / 1e9;
+}
+
+/* \brief bytes moved by LACPY: read the triangle of an m x n A, or all of it, and write it to B */
+template <typename T>
+double lacpy_gbyte_count(hipblasFillMode_t uplo, int m, int n)
+{
+    int    k        = std::min(m, n);
+    double elements = uplo == HIPBLAS_FILL_MODE_UPPER   ? tri_count(k) + double(n - k) * m
+                      : uplo == HIPBLAS_FILL_MODE_LOWER ? double(k) * m - tri_count(k - 1)
+                                                        : double(m) * n;
+    return (2.0 * elements * sizeof(T)) / 1e9;
+}
+
+/* \brief bytes moved by SYMMETRIZE and HERMITIZE: read one strict triangle of A, write the other */
+template <typename T>
+double symmetrize_gbyte_count(int n)
+{
+    return (2.0 * tri_count(n - 1) * sizeof(T)) / 1e9;
+}
+
+/* \brief bytes moved by the in-place TRANSPOSE: read and write A but its diagonal */
+template <typename T>
+double transpose_gbyte_count(int n)
+{
+    return (2.0 * (double(n) * n - n) * sizeof(T)) / 1e9;
+}
+
+/* \brief bytes moved by the vbatched level-1 Ex routines over all the elements of the batch: y is
+ * written, and x and y are read when the routine reads them */
+template <typename Tx, typename Ty>
+double vbatched_gbyte_count(double elements, bool reads_x, bool reads_y)
+{
+    double bytes = (reads_x ? sizeof(Tx) : 0.0) + (reads_y ? sizeof(Ty) : 0.0) + sizeof(Ty);
+    return (elements * bytes) / 1e9;
+}
+
+/* \brief bytes moved by the weight-only quantized gemm: read every batch's A, read and write its C,
+ * and read the bits-wide B and its float scales, and zeros, once, as the batches share them */
+template <typename Ta, typename Tc>
+double gemm_quantized_gbyte_count(
+    int m, int n, int k, int bits, int groups, bool zeros, int batch_count = 1)
+{
+    double ac = double(m) * k * sizeof(Ta) + 2.0 * m * n * sizeof(Tc);
+    double b  = double(k) * n * bits / 8 + (zeros ? 2.0 : 1.0) * groups * n * sizeof(float);
+    return (ac * batch_count + b) / 1e9;
+}
+
+/* \brief bytes moved by the 2:4 sparse gemm: read the kept half of A and its metadata, a byte per
+ * group of four, read B, and read and write C */
+template <typename T, typename Tc>
+double sparse_gemm24_gbyte_count(int m, int n, int k)
+{
+    double a = double(m) * k / 2 * sizeof(T) + double(m) * k / 4;
+    return (a + double(k) * n * sizeof(T) + 2.0 * m * n * sizeof(Tc)) / 1e9;
+}
+
+/* \brief bytes moved by the int8 gemm with requantization: read the int8 A and B and the float
+ * scales and int32 biases of the entries, and write the int8 C */
+inline double gemm_requant_gbyte_count(int m, int n, int k, int entries)
+{
+    double ab = double(m) * k + double(k) * n;
+    return (ab + double(m) * n + entries * (sizeof(float) + sizeof(int32_t))) / 1e9;
+}
+
+/* \brief bytes moved by GER_ACCUMULATE: read the k x and y vectors, and read and write A once */
+template <typename T>
+double ger_accumulate_gbyte_count(int m, int n, int k)
+{
+    return ((2.0 * m * n + double(k) * (m + n)) * sizeof(T)) / 1e9;
+}
+
+/* \brief bytes moved by LASR: read and write A once, and read the z - 1 cosines and sines */
+template <typename T, typename U>
+double lasr_gbyte_count(int m, int n, int z)
+{
+    return (2.0 * m * n * sizeof(T) + 2.0 * (z - 1) * sizeof(U)) / 1e9;
+}
+
+/* \brief bytes moved by GEMM_BATCH_REDUCE: read the A and B of every batch, and read and write
+ * the one C once */
+template <typename T>
+double gemm_batch_reduce_gbyte_count(int m, int n, int k, int batch_count)
+{
+    return ((double(batch_count) * k * (m + n) + 2.0 * m * n) * sizeof(T)) / 1e9;
 }
 
 #endif /* _ROCBLAS_FLOPS_H_ */
@@ -84,6 +84,24 @@ template <typename T>
 hipblasStatus_t hipblasDotc(
     hipblasHandle_t handle, int n, const T* x, int incx, const T* y, int incy, T* result);
 
+template <typename T>
+hipblasStatus_t hipblasDot_64(hipblasHandle_t handle,
+                              int64_t         n,
+                              const T*        x,
+                              int64_t         incx,
+                              const T*        y,
+                              int64_t         incy,
+                              T*              result);
+
+template <typename T>
+hipblasStatus_t hipblasDotc_64(hipblasHandle_t handle,
+                               int64_t         n,
+                               const T*        x,
+                               int64_t         incx,
+                               const T*        y,
+                               int64_t         incy,
+                               T*              result);
+
 template <typename T>
 hipblasStatus_t hipblasDotBatched(hipblasHandle_t handle,
                                   int             n,
@@ -268,6 +286,14 @@ hipblasStatus_t hipblasIamaxStridedBatched(
 template <typename T>
 hipblasStatus_t hipblasIamin(hipblasHandle_t handle, int n, const T* x, int incx, int* result);
 
+template <typename T>
+hipblasStatus_t
+    hipblasIamax_64(hipblasHandle_t handle, int64_t n, const T* x, int64_t incx, int64_t* result);
+
+template <typename T>
+hipblasStatus_t
+    hipblasIamin_64(hipblasHandle_t handle, int64_t n, const T* x, int64_t incx, int64_t* result);
+
 template <typename T>
 hipblasStatus_t hipblasIaminBatched(
     hipblasHandle_t handle, int n, const T* const x[], int incx, int batch_count, int* result);
@@ -280,6 +306,15 @@ template <typename T>
 hipblasStatus_t hipblasAxpy(
     hipblasHandle_t handle, int n, const T* alpha, const T* x, int incx, T* y, int incy);
 
+template <typename T>
+hipblasStatus_t hipblasAxpy_64(hipblasHandle_t handle,
+                               int64_t         n,
+                               const T*        alpha,
+                               const T*        x,
+                               int64_t         incx,
+                               T*              y,
+                               int64_t         incy);
+
 template <typename T>
 hipblasStatus_t hipblasAxpyBatched(hipblasHandle_t handle,
                                    int             n,
@@ -344,6 +379,19 @@ hipblasStatus_t hipblasGerStridedBatched(hipblasHandle_t handle,
                                          int             strideA,
                                          int             batch_count);
 
+template <typename T, bool CONJ>
+hipblasStatus_t hipblasGerAccumulate(hipblasHandle_t handle,
+                                     int             m,
+                                     int             n,
+                                     int             k,
+                                     const T*        alpha,
+                                     const T* const  x[],
+                                     int             incx,
+                                     const T* const  y[],
+                                     int             incy,
+                                     T*              A,
+                                     int             lda);
+
 // hbmv
 template <typename T>
 hipblasStatus_t hipblasHbmv(hipblasHandle_t   handle,
@@ -950,6 +998,47 @@ hipblasStatus_t hipblasTbmvStridedBatched(hipblasHandle_t    handle,
                                           int                stride_x,
                                           int                batch_count);
 
+// tbsv
+template <typename T>
+hipblasStatus_t hipblasTbsv(hipblasHandle_t    handle,
+                            hipblasFillMode_t  uplo,
+                            hipblasOperation_t transA,
+                            hipblasDiagType_t  diag,
+                            int                n,
+                            int                k,
+                            const T*           A,
+                            int                lda,
+                            T*                 x,
+                            int                incx);
+
+template <typename T>
+hipblasStatus_t hipblasTbsvBatched(hipblasHandle_t    handle,
+                                   hipblasFillMode_t  uplo,
+                                   hipblasOperation_t transA,
+                                   hipblasDiagType_t  diag,
+                                   int                n,
+                                   int                k,
+                                   const T* const     A[],
+                                   int                lda,
+                                   T* const           x[],
+                                   int                incx,
+                                   int                batch_count);
+
+template <typename T>
+hipblasStatus_t hipblasTbsvStridedBatched(hipblasHandle_t    handle,
+                                          hipblasFillMode_t  uplo,
+                                          hipblasOperation_t transA,
+                                          hipblasDiagType_t  diag,
+                                          int                n,
+                                          int                k,
+                                          const T*           A,
+                                          int                lda,
+                                          int                stride_a,
+                                          T*                 x,
+                                          int                incx,
+                                          int                stride_x,
+                                          int                batch_count);
+
 // tpmv
 template <typename T>
 hipblasStatus_t hipblasTpmv(hipblasHandle_t    handle,
@@ -1229,6 +1318,22 @@ hipblasStatus_t hipblasGemm(hipblasHandle_t    handle,
                             T*                 C,
                             int                ldc);
 
+template <typename T>
+hipblasStatus_t hipblasXtGemm(hipblasHandle_t    handle,
+                              hipblasOperation_t transA,
+                              hipblasOperation_t transB,
+                              int64_t            m,
+                              int64_t            n,
+                              int64_t            k,
+                              const T*           alpha,
+                              const T*           A,
+                              int64_t            lda,
+                              const T*           B,
+                              int64_t            ldb,
+                              const T*           beta,
+                              T*                 C,
+                              int64_t            ldc);
+
 template <typename T>
 hipblasStatus_t hipblasGemmStridedBatched(hipblasHandle_t    handle,
                                           hipblasOperation_t transA,
@@ -1249,6 +1354,60 @@ hipblasStatus_t hipblasGemmStridedBatched(hipblasHandle_t    handle,
                                           int                bsc,
                                           int                batch_count);
 
+template <typename T>
+hipblasStatus_t hipblasGemm3m(hipblasHandle_t    handle,
+                              hipblasOperation_t transA,
+                              hipblasOperation_t transB,
+                              int                m,
+                              int                n,
+                              int                k,
+                              const T*           alpha,
+                              const T*           A,
+                              int                lda,
+                              const T*           B,
+                              int                ldb,
+                              const T*           beta,
+                              T*                 C,
+                              int                ldc);
+
+template <typename T>
+hipblasStatus_t hipblasGemm3mStridedBatched(hipblasHandle_t    handle,
+                                            hipblasOperation_t transA,
+                                            hipblasOperation_t transB,
+                                            int                m,
+                                            int                n,
+                                            int                k,
+                                            const T*           alpha,
+                                            const T*           A,
+                                            int                lda,
+                                            int                bsa,
+                                            const T*           B,
+                                            int                ldb,
+                                            int                bsb,
+                                            const T*           beta,
+                                            T*                 C,
+                                            int                ldc,
+                                            int                bsc,
+                                            int                batch_count);
+
+template <typename T>
+hipblasStatus_t hipblasGemmGroupedBatched(hipblasHandle_t          handle,
+                                          const hipblasOperation_t transa_array[],
+                                          const hipblasOperation_t transb_array[],
+                                          const int                m_array[],
+                                          const int                n_array[],
+                                          const int                k_array[],
+                                          const T                  alpha_array[],
+                                          const T* const           A_array[],
+                                          const int                lda_array[],
+                                          const T* const           B_array[],
+                                          const int                ldb_array[],
+                                          const T                  beta_array[],
+                                          T* const                 C_array[],
+                                          const int                ldc_array[],
+                                          int                      group_count,
+                                          const int                group_size[]);
+
 template <typename T>
 hipblasStatus_t hipblasGemmBatched(hipblasHandle_t    handle,
                                    hipblasOperation_t transA,
@@ -1266,6 +1425,135 @@ hipblasStatus_t hipblasGemmBatched(hipblasHandle_t    handle,
                                    int                ldc,
                                    int                batch_count);
 
+template <typename T>
+hipblasStatus_t hipblasGemmBatchReduce(hipblasHandle_t    handle,
+                                       hipblasOperation_t transa,
+                                       hipblasOperation_t transb,
+                                       int                m,
+                                       int                n,
+                                       int                k,
+                                       const T*           alpha,
+                                       const T* const     A[],
+                                       int                lda,
+                                       const T* const     B[],
+                                       int                ldb,
+                                       const T*           beta,
+                                       T*                 C,
+                                       int                ldc,
+                                       int                batch_count);
+
+template <typename T>
+hipblasStatus_t hipblasGemmStridedBatchReduce(hipblasHandle_t    handle,
+                                              hipblasOperation_t transa,
+                                              hipblasOperation_t transb,
+                                              int                m,
+                                              int                n,
+                                              int                k,
+                                              const T*           alpha,
+                                              const T*           A,
+                                              int                lda,
+                                              long long          strideA,
+                                              const T*           B,
+                                              int                ldb,
+                                              long long          strideB,
+                                              const T*           beta,
+                                              T*                 C,
+                                              int                ldc,
+                                              int                batch_count);
+
+// dgmm
+template <typename T>
+hipblasStatus_t hipblasDgmm(hipblasHandle_t   handle,
+                            hipblasSideMode_t side,
+                            int               m,
+                            int               n,
+                            const T*          A,
+                            int               lda,
+                            const T*          x,
+                            int               incx,
+                            T*                C,
+                            int               ldc);
+
+template <typename T>
+hipblasStatus_t hipblasDgmmBatched(hipblasHandle_t   handle,
+                                   hipblasSideMode_t side,
+                                   int               m,
+                                   int               n,
+                                   const T* const    A[],
+                                   int               lda,
+                                   const T* const    x[],
+                                   int               incx,
+                                   T* const          C[],
+                                   int               ldc,
+                                   int               batchCount);
+
+template <typename T>
+hipblasStatus_t hipblasDgmmStridedBatched(hipblasHandle_t   handle,
+                                          hipblasSideMode_t side,
+                                          int               m,
+                                          int               n,
+                                          const T*          A,
+                                          int               lda,
+                                          int               strideA,
+                                          const T*          x,
+                                          int               incx,
+                                          int               stridex,
+                                          T*                C,
+                                          int               ldc,
+                                          int               strideC,
+                                          int               batchCount);
+
+// hemm
+template <typename T>
+hipblasStatus_t hipblasHemm(hipblasHandle_t   handle,
+                            hipblasSideMode_t side,
+                            hipblasFillMode_t uplo,
+                            int               m,
+                            int               n,
+                            const T*          alpha,
+                            const T*          A,
+                            int               lda,
+                            const T*          B,
+                            int               ldb,
+                            const T*          beta,
+                            T*                C,
+                            int               ldc);
+
+template <typename T>
+hipblasStatus_t hipblasHemmBatched(hipblasHandle_t   handle,
+                                   hipblasSideMode_t side,
+                                   hipblasFillMode_t uplo,
+                                   int               m,
+                                   int               n,
+                                   const T*          alpha,
+                                   const T* const    A[],
+                                   int               lda,
+                                   const T* const    B[],
+                                   int               ldb,
+                                   const T*          beta,
+                                   T* const          C[],
+                                   int               ldc,
+                                   int               batchCount);
+
+template <typename T>
+hipblasStatus_t hipblasHemmStridedBatched(hipblasHandle_t   handle,
+                                          hipblasSideMode_t side,
+                                          hipblasFillMode_t uplo,
+                                          int               m,
+                                          int               n,
+                                          const T*          alpha,
+                                          const T*          A,
+                                          int               lda,
+                                          int               strideA,
+                                          const T*          B,
+                                          int               ldb,
+                                          int               strideB,
+                                          const T*          beta,
+                                          T*                C,
+                                          int               ldc,
+                                          int               strideC,
+                                          int               batchCount);
+
 // herk
 template <typename T, typename U>
 hipblasStatus_t hipblasHerk(hipblasHandle_t    handle,
@@ -1412,6 +1700,57 @@ hipblasStatus_t hipblasHerkxStridedBatched(hipblasHandle_t    handle,
                                            int                strideC,
                                            int                batchCount);
 
+// symm
+template <typename T>
+hipblasStatus_t hipblasSymm(hipblasHandle_t   handle,
+                            hipblasSideMode_t side,
+                            hipblasFillMode_t uplo,
+                            int               m,
+                            int               n,
+                            const T*          alpha,
+                            const T*          A,
+                            int               lda,
+                            const T*          B,
+                            int               ldb,
+                            const T*          beta,
+                            T*                C,
+                            int               ldc);
+
+template <typename T>
+hipblasStatus_t hipblasSymmBatched(hipblasHandle_t   handle,
+                                   hipblasSideMode_t side,
+                                   hipblasFillMode_t uplo,
+                                   int               m,
+                                   int               n,
+                                   const T*          alpha,
+                                   const T* const    A[],
+                                   int               lda,
+                                   const T* const    B[],
+                                   int               ldb,
+                                   const T*          beta,
+                                   T* const          C[],
+                                   int               ldc,
+                                   int               batchCount);
+
+template <typename T>
+hipblasStatus_t hipblasSymmStridedBatched(hipblasHandle_t   handle,
+                                          hipblasSideMode_t side,
+                                          hipblasFillMode_t uplo,
+                                          int               m,
+                                          int               n,
+                                          const T*          alpha,
+                                          const T*          A,
+                                          int               lda,
+                                          int               strideA,
+                                          const T*          B,
+                                          int               ldb,
+                                          int               strideB,
+                                          const T*          beta,
+                                          T*                C,
+                                          int               ldc,
+                                          int               strideC,
+                                          int               batchCount);
+
 // syrk
 template <typename T>
 hipblasStatus_t hipblasSyrk(hipblasHandle_t    handle,
@@ -1426,6 +1765,19 @@ hipblasStatus_t hipblasSyrk(hipblasHandle_t    handle,
                             T*                 C,
                             int                ldc);
 
+template <typename T>
+hipblasStatus_t hipblasXtSyrk(hipblasHandle_t    handle,
+                              hipblasFillMode_t  uplo,
+                              hipblasOperation_t transA,
+                              int64_t            n,
+                              int64_t            k,
+                              const T*           alpha,
+                              const T*           A,
+                              int64_t            lda,
+                              const T*           beta,
+                              T*                 C,
+                              int64_t            ldc);
+
 template <typename T>
 hipblasStatus_t hipblasSyrkBatched(hipblasHandle_t    handle,
                                    hipblasFillMode_t  uplo,
@@ -1605,6 +1957,43 @@ hipblasStatus_t hipblasTrmmStridedBatched(hipblasHandle_t    handle,
                                           int                strideB,
                                           int                batchCount);
 
+// trmm_outofplace
+template <typename T>
+hipblasStatus_t hipblasTrmmOutOfPlace(hipblasHandle_t    handle,
+                                      hipblasSideMode_t  side,
+                                      hipblasFillMode_t  uplo,
+                                      hipblasOperation_t transA,
+                                      hipblasDiagType_t  diag,
+                                      int                m,
+                                      int                n,
+                                      const T*           alpha,
+                                      const T*           A,
+                                      int                lda,
+                                      const T*           B,
+                                      int                ldb,
+                                      T*                 C,
+                                      int                ldc);
+
+template <typename T>
+hipblasStatus_t hipblasTrmmOutOfPlaceStridedBatched(hipblasHandle_t    handle,
+                                                    hipblasSideMode_t  side,
+                                                    hipblasFillMode_t  uplo,
+                                                    hipblasOperation_t transA,
+                                                    hipblasDiagType_t  diag,
+                                                    int                m,
+                                                    int                n,
+                                                    const T*           alpha,
+                                                    const T*           A,
+                                                    int                lda,
+                                                    int                strideA,
+                                                    const T*           B,
+                                                    int                ldb,
+                                                    int                strideB,
+                                                    T*                 C,
+                                                    int                ldc,
+                                                    int                strideC,
+                                                    int                batchCount);
+
 // trsm
 template <typename T>
 hipblasStatus_t hipblasTrsm(hipblasHandle_t    handle,
@@ -1620,6 +2009,20 @@ hipblasStatus_t hipblasTrsm(hipblasHandle_t    handle,
                             T*                 B,
                             int                ldb);
 
+template <typename T>
+hipblasStatus_t hipblasXtTrsm(hipblasHandle_t    handle,
+                              hipblasSideMode_t  side,
+                              hipblasFillMode_t  uplo,
+                              hipblasOperation_t transA,
+                              hipblasDiagType_t  diag,
+                              int64_t            m,
+                              int64_t            n,
+                              const T*           alpha,
+                              const T*           A,
+                              int64_t            lda,
+                              T*                 B,
+                              int64_t            ldb);
+
 template <typename T>
 hipblasStatus_t hipblasTrsmBatched(hipblasHandle_t    handle,
                                    hipblasSideMode_t  side,
@@ -1663,6 +2066,7 @@ hipblasStatus_t hipblasGetrfBatched(hipblasHandle_t handle,
                                     T* const        A[],
                                     const int       lda,
                                     int*            ipiv,
+                                    const int       strideP,
                                     int*            info,
                                     const int       batchCount);
 
@@ -1698,6 +2102,7 @@ hipblasStatus_t hipblasGetrsBatched(hipblasHandle_t          handle,
                                     T* const                 A[],
                                     const int                lda,
                                     const int*               ipiv,
+                                    const int                strideP,
                                     T* const                 B[],
                                     const int                ldb,
                                     int*                     info,
@@ -1719,6 +2124,202 @@ hipblasStatus_t hipblasGetrsStridedBatched(hipblasHandle_t          handle,
                                            int*                     info,
                                            const int                batchCount);
 
+// getri
+template <typename T>
+hipblasStatus_t hipblasGetriBatched(hipblasHandle_t handle,
+                                    const int       n,
+                                    T* const        A[],
+                                    const int       lda,
+                                    int*            ipiv,
+                                    const int       strideP,
+                                    T* const        C[],
+                                    const int       ldc,
+                                    int*            info,
+                                    const int       batchCount);
+
+template <typename T>
+hipblasStatus_t hipblasGetriStridedBatched(hipblasHandle_t handle,
+                                           const int       n,
+                                           T*              A,
+                                           const int       lda,
+                                           const int       strideA,
+                                           int*            ipiv,
+                                           const int       strideP,
+                                           T*              C,
+                                           const int       ldc,
+                                           const int       strideC,
+                                           int*            info,
+                                           const int       batchCount);
+
+// matinv
+template <typename T>
+hipblasStatus_t hipblasMatinvBatched(hipblasHandle_t handle,
+                                     const int       n,
+                                     const T* const  A[],
+                                     const int       lda,
+                                     T* const        Ainv[],
+                                     const int       lda_inv,
+                                     int*            info,
+                                     const int       batchCount);
+
+// potrf
+template <typename T>
+hipblasStatus_t hipblasPotrf(hipblasHandle_t         handle,
+                             const hipblasFillMode_t uplo,
+                             const int               n,
+                             T*                      A,
+                             const int               lda,
+                             int*                    info);
+
+template <typename T>
+hipblasStatus_t hipblasPotrfBatched(hipblasHandle_t         handle,
+                                    const hipblasFillMode_t uplo,
+                                    const int               n,
+                                    T* const                A[],
+                                    const int               lda,
+                                    int*                    info,
+                                    const int               batchCount);
+
+template <typename T>
+hipblasStatus_t hipblasPotrfStridedBatched(hipblasHandle_t         handle,
+                                           const hipblasFillMode_t uplo,
+                                           const int               n,
+                                           T*                      A,
+                                           const int               lda,
+                                           const int               strideA,
+                                           int*                    info,
+                                           const int               batchCount);
+
+// potrs
+template <typename T>
+hipblasStatus_t hipblasPotrs(hipblasHandle_t         handle,
+                             const hipblasFillMode_t uplo,
+                             const int               n,
+                             const int               nrhs,
+                             T*                      A,
+                             const int               lda,
+                             T*                      B,
+                             const int               ldb,
+                             int*                    info);
+
+template <typename T>
+hipblasStatus_t hipblasPotrsBatched(hipblasHandle_t         handle,
+                                    const hipblasFillMode_t uplo,
+                                    const int               n,
+                                    const int               nrhs,
+                                    T* const                A[],
+                                    const int               lda,
+                                    T* const                B[],
+                                    const int               ldb,
+                                    int*                    info,
+                                    const int               batchCount);
+
+template <typename T>
+hipblasStatus_t hipblasPotrsStridedBatched(hipblasHandle_t         handle,
+                                           const hipblasFillMode_t uplo,
+                                           const int               n,
+                                           const int               nrhs,
+                                           T*                      A,
+                                           const int               lda,
+                                           const int               strideA,
+                                           T*                      B,
+                                           const int               ldb,
+                                           const int               strideB,
+                                           int*                    info,
+                                           const int               batchCount);
+
+template <typename T>
+hipblasStatus_t hipblasGetrfNpvtBatched(hipblasHandle_t handle,
+                                        const int       n,
+                                        T* const        A[],
+                                        const int       lda,
+                                        int*            info,
+                                        const int       batchCount);
+
+template <typename T>
+hipblasStatus_t hipblasGetrfNpvtStridedBatched(hipblasHandle_t handle,
+                                               const int       n,
+                                               T*              A,
+                                               const int       lda,
+                                               const int       strideA,
+                                               int*            info,
+                                               const int       batchCount);
+
+template <typename T>
+hipblasStatus_t hipblasGetrsNpvtBatched(hipblasHandle_t          handle,
+                                        const hipblasOperation_t trans,
+                                        const int                n,
+                                        const int                nrhs,
+                                        T* const                 A[],
+                                        const int                lda,
+                                        T* const                 B[],
+                                        const int                ldb,
+                                        int*                     info,
+                                        const int                batchCount);
+
+template <typename T>
+hipblasStatus_t hipblasGetrsNpvtStridedBatched(hipblasHandle_t          handle,
+                                               const hipblasOperation_t trans,
+                                               const int                n,
+                                               const int                nrhs,
+                                               T*                       A,
+                                               const int                lda,
+                                               const int                strideA,
+                                               T*                       B,
+                                               const int                ldb,
+                                               const int                strideB,
+                                               int*                     info,
+                                               const int                batchCount);
+
+// gesv
+template <typename T>
+hipblasStatus_t hipblasGesvBatched(hipblasHandle_t handle,
+                                   const int       n,
+                                   const int       nrhs,
+                                   T* const        A[],
+                                   const int       lda,
+                                   int*            ipiv,
+                                   const int       strideP,
+                                   T* const        B[],
+                                   const int       ldb,
+                                   int*            info,
+                                   const int       batchCount);
+
+template <typename T>
+hipblasStatus_t hipblasGesvStridedBatched(hipblasHandle_t handle,
+                                          const int       n,
+                                          const int       nrhs,
+                                          T*              A,
+                                          const int       lda,
+                                          const int       strideA,
+                                          int*            ipiv,
+                                          const int       strideP,
+                                          T*              B,
+                                          const int       ldb,
+                                          const int       strideB,
+                                          int*            info,
+                                          const int       batchCount);
+
+// gesv with iterative refinement, factoring in the next lower precision of T
+template <typename T>
+hipblasStatus_t hipblasGesvMixedStridedBatched(hipblasHandle_t handle,
+                                               const int       n,
+                                               const int       nrhs,
+                                               T*              A,
+                                               const int       lda,
+                                               const int       strideA,
+                                               int*            ipiv,
+                                               const int       strideP,
+                                               const T*        B,
+                                               const int       ldb,
+                                               const int       strideB,
+                                               T*              X,
+                                               const int       ldx,
+                                               const int       strideX,
+                                               int*            iter,
+                                               int*            info,
+                                               const int       batchCount);
+
 // geqrf
 template <typename T>
 hipblasStatus_t hipblasGeqrf(
@@ -1746,29 +2347,683 @@ hipblasStatus_t hipblasGeqrfStridedBatched(hipblasHandle_t handle,
                                            int*            info,
                                            const int       batchCount);
 
+// ormqr
+template <typename T>
+hipblasStatus_t hipblasOrmqr(hipblasHandle_t          handle,
+                             const hipblasSideMode_t  side,
+                             const hipblasOperation_t trans,
+                             const int                m,
+                             const int                n,
+                             const int                k,
+                             T*                       A,
+                             const int                lda,
+                             T*                       tau,
+                             T*                       C,
+                             const int                ldc,
+                             int*                     info);
+
+// orgqr
+template <typename T>
+hipblasStatus_t hipblasOrgqr(hipblasHandle_t handle,
+                             const int       m,
+                             const int       n,
+                             const int       k,
+                             T*              A,
+                             const int       lda,
+                             T*              tau,
+                             int*            info);
+
+// gels
+template <typename T>
+hipblasStatus_t hipblasGelsBatched(hipblasHandle_t          handle,
+                                   const hipblasOperation_t trans,
+                                   const int                m,
+                                   const int                n,
+                                   const int                nrhs,
+                                   T* const                 A[],
+                                   const int                lda,
+                                   T* const                 B[],
+                                   const int                ldb,
+                                   int*                     info,
+                                   int*                     deviceInfo,
+                                   const int                batchCount);
+
+template <typename T>
+hipblasStatus_t hipblasGelsStridedBatched(hipblasHandle_t          handle,
+                                          const hipblasOperation_t trans,
+                                          const int                m,
+                                          const int                n,
+                                          const int                nrhs,
+                                          T*                       A,
+                                          const int                lda,
+                                          const int                strideA,
+                                          T*                       B,
+                                          const int                ldb,
+                                          const int                strideB,
+                                          int*                     info,
+                                          int*                     deviceInfo,
+                                          const int                batchCount);
+
+// syevj / heevj
+template <typename T, typename R>
+hipblasStatus_t hipblasSyevjBatched(hipblasHandle_t         handle,
+                                    const hipblasEvect_t    evect,
+                                    const hipblasFillMode_t uplo,
+                                    const int               n,
+                                    T* const                A[],
+                                    const int               lda,
+                                    const R                 abstol,
+                                    R*                      residual,
+                                    const int               max_sweeps,
+                                    int*                    n_sweeps,
+                                    R*                      W,
+                                    const int               strideW,
+                                    int*                    info,
+                                    const int               batchCount);
+
+template <typename T, typename R>
+hipblasStatus_t hipblasSyevjStridedBatched(hipblasHandle_t         handle,
+                                           const hipblasEvect_t    evect,
+                                           const hipblasFillMode_t uplo,
+                                           const int               n,
+                                           T*                      A,
+                                           const int               lda,
+                                           const int               strideA,
+                                           const R                 abstol,
+                                           R*                      residual,
+                                           const int               max_sweeps,
+                                           int*                    n_sweeps,
+                                           R*                      W,
+                                           const int               strideW,
+                                           int*                    info,
+                                           const int               batchCount);
+
+// gesvdj
+template <typename T, typename R>
+hipblasStatus_t hipblasGesvdjStridedBatched(hipblasHandle_t      handle,
+                                            const hipblasSvect_t left_svect,
+                                            const hipblasSvect_t right_svect,
+                                            const int            m,
+                                            const int            n,
+                                            T*                   A,
+                                            const int            lda,
+                                            const int            strideA,
+                                            const R              abstol,
+                                            R*                   residual,
+                                            const int            max_sweeps,
+                                            int*                 n_sweeps,
+                                            R*                   S,
+                                            const int            strideS,
+                                            T*                   U,
+                                            const int            ldu,
+                                            const int            strideU,
+                                            T*                   V,
+                                            const int            ldv,
+                                            const int            strideV,
+                                            int*                 info,
+                                            const int            batchCount);
+
+// sytrf
+template <typename T>
+hipblasStatus_t hipblasSytrfStridedBatched(hipblasHandle_t         handle,
+                                           const hipblasFillMode_t uplo,
+                                           const int               n,
+                                           T*                      A,
+                                           const int               lda,
+                                           const int               strideA,
+                                           int*                    ipiv,
+                                           const int               strideP,
+                                           int*                    info,
+                                           const int               batchCount);
+
+// sytrs
+template <typename T>
+hipblasStatus_t hipblasSytrsStridedBatched(hipblasHandle_t         handle,
+                                           const hipblasFillMode_t uplo,
+                                           const int               n,
+                                           const int               nrhs,
+                                           T*                      A,
+                                           const int               lda,
+                                           const int               strideA,
+                                           const int*              ipiv,
+                                           const int               strideP,
+                                           T*                      B,
+                                           const int               ldb,
+                                           const int               strideB,
+                                           int*                    info,
+                                           const int               batchCount);
+
+// tsqr
+template <typename T>
+hipblasStatus_t hipblasTsqr(hipblasHandle_t   handle,
+                            hipblasTsqrAlgo_t algo,
+                            int               m,
+                            int               n,
+                            T*                A,
+                            int               lda,
+                            T*                R,
+                            int               ldr);
+
+// gtsv
+template <typename T>
+hipblasStatus_t hipblasGtsvStridedBatched(hipblasHandle_t handle,
+                                          const int       m,
+                                          const T*        dl,
+                                          const T*        d,
+                                          const T*        du,
+                                          T*              x,
+                                          const int       stride,
+                                          const int       batchCount);
+
+template <typename T>
+hipblasStatus_t hipblasGtsvInterleavedBatched(hipblasHandle_t handle,
+                                              const int       m,
+                                              const T*        dl,
+                                              const T*        d,
+                                              const T*        du,
+                                              T*              x,
+                                              const int       batchCount);
+
+// pack_compact
+template <typename T>
+hipblasStatus_t hipblasPackCompact(hipblasHandle_t handle,
+                                   const int       m,
+                                   const int       n,
+                                   const T*        A,
+                                   const int       lda,
+                                   const int       strideA,
+                                   T*              Ac,
+                                   const int       ldac,
+                                   const int       batchCount);
+
+// unpack_compact
+template <typename T>
+hipblasStatus_t hipblasUnpackCompact(hipblasHandle_t handle,
+                                     const int       m,
+                                     const int       n,
+                                     const T*        Ac,
+                                     const int       ldac,
+                                     T*              A,
+                                     const int       lda,
+                                     const int       strideA,
+                                     const int       batchCount);
+
+// gemm_compact
+template <typename T>
+hipblasStatus_t hipblasGemmCompact(hipblasHandle_t    handle,
+                                   hipblasOperation_t transA,
+                                   hipblasOperation_t transB,
+                                   const int          m,
+                                   const int          n,
+                                   const int          k,
+                                   const T*           alpha,
+                                   const T*           A,
+                                   const int          lda,
+                                   const T*           B,
+                                   const int          ldb,
+                                   const T*           beta,
+                                   T*                 C,
+                                   const int          ldc,
+                                   const int          batchCount);
+
+// trsm_compact
+template <typename T>
+hipblasStatus_t hipblasTrsmCompact(hipblasHandle_t    handle,
+                                   hipblasSideMode_t  side,
+                                   hipblasFillMode_t  uplo,
+                                   hipblasOperation_t transA,
+                                   hipblasDiagType_t  diag,
+                                   const int          m,
+                                   const int          n,
+                                   const T*           alpha,
+                                   const T*           A,
+                                   const int          lda,
+                                   T*                 B,
+                                   const int          ldb,
+                                   const int          batchCount);
+
+// getrf_compact
+template <typename T>
+hipblasStatus_t hipblasGetrfCompact(hipblasHandle_t handle,
+                                    const int       n,
+                                    T*              A,
+                                    const int       lda,
+                                    int*            ipiv,
+                                    int*            info,
+                                    const int       batchCount);
+
+// getrs_compact
+template <typename T>
+hipblasStatus_t hipblasGetrsCompact(hipblasHandle_t          handle,
+                                    const hipblasOperation_t trans,
+                                    const int                n,
+                                    const int                nrhs,
+                                    const T*                 A,
+                                    const int                lda,
+                                    const int*               ipiv,
+                                    T*                       B,
+                                    const int                ldb,
+                                    const int                batchCount);
+
+// gemv_vbatched
+template <typename T>
+hipblasStatus_t hipblasGemvVbatched(hipblasHandle_t    handle,
+                                    hipblasOperation_t trans,
+                                    const int          m[],
+                                    const int          n[],
+                                    const T*           alpha,
+                                    const T* const     A[],
+                                    const int          lda[],
+                                    const T* const     x[],
+                                    const int          incx[],
+                                    const T*           beta,
+                                    T* const           y[],
+                                    const int          incy[],
+                                    int                batchCount);
+
+// trsv_vbatched
+template <typename T>
+hipblasStatus_t hipblasTrsvVbatched(hipblasHandle_t    handle,
+                                    hipblasFillMode_t  uplo,
+                                    hipblasOperation_t transA,
+                                    hipblasDiagType_t  diag,
+                                    const int          n[],
+                                    const T* const     A[],
+                                    const int          lda[],
+                                    T* const           x[],
+                                    const int          incx[],
+                                    int                batchCount);
+
+// getrf_vbatched
+template <typename T>
+hipblasStatus_t hipblasGetrfVbatched(hipblasHandle_t handle,
+                                     const int       n[],
+                                     T* const        A[],
+                                     const int       lda[],
+                                     int* const      ipiv[],
+                                     int             info[],
+                                     int             batchCount);
+
+// getrs_vbatched
+template <typename T>
+hipblasStatus_t hipblasGetrsVbatched(hipblasHandle_t    handle,
+                                     hipblasOperation_t trans,
+                                     const int          n[],
+                                     const int          nrhs[],
+                                     const T* const     A[],
+                                     const int          lda[],
+                                     const int* const   ipiv[],
+                                     T* const           B[],
+                                     const int          ldb[],
+                                     int*               info,
+                                     int                batchCount);
+
+// trsm_vbatched
+template <typename T>
+hipblasStatus_t hipblasTrsmVbatched(hipblasHandle_t    handle,
+                                    hipblasSideMode_t  side,
+                                    hipblasFillMode_t  uplo,
+                                    hipblasOperation_t transA,
+                                    hipblasDiagType_t  diag,
+                                    const int          m[],
+                                    const int          n[],
+                                    const T*           alpha,
+                                    const T* const     A[],
+                                    const int          lda[],
+                                    T* const           B[],
+                                    const int          ldb[],
+                                    int                batchCount);
+
+// nrm2_vbatched
+template <typename T1, typename T2>
+hipblasStatus_t hipblasNrm2Vbatched(hipblasHandle_t handle,
+                                    const int       n[],
+                                    const T1* const x[],
+                                    const int       incx[],
+                                    int             batchCount,
+                                    T2*             norms,
+                                    T2*             result);
+
+// trttp
+template <typename T>
+hipblasStatus_t hipblasTrttp(hipblasHandle_t         handle,
+                             const hipblasFillMode_t uplo,
+                             const int               n,
+                             const T*                A,
+                             const int               lda,
+                             T*                      AP);
+
+template <typename T>
+hipblasStatus_t hipblasTrttpBatched(hipblasHandle_t         handle,
+                                    const hipblasFillMode_t uplo,
+                                    const int               n,
+                                    const T* const          A[],
+                                    const int               lda,
+                                    T* const                AP[],
+                                    const int               batchCount);
+
+template <typename T>
+hipblasStatus_t hipblasTrttpStridedBatched(hipblasHandle_t         handle,
+                                           const hipblasFillMode_t uplo,
+                                           const int               n,
+                                           const T*                A,
+                                           const int               lda,
+                                           const int               strideA,
+                                           T*                      AP,
+                                           const int               strideAP,
+                                           const int               batchCount);
+
+// tpttr
+template <typename T>
+hipblasStatus_t hipblasTpttr(hipblasHandle_t         handle,
+                             const hipblasFillMode_t uplo,
+                             const int               n,
+                             const T*                AP,
+                             T*                      A,
+                             const int               lda);
+
+template <typename T>
+hipblasStatus_t hipblasTpttrBatched(hipblasHandle_t         handle,
+                                    const hipblasFillMode_t uplo,
+                                    const int               n,
+                                    const T* const          AP[],
+                                    T* const                A[],
+                                    const int               lda,
+                                    const int               batchCount);
+
+template <typename T>
+hipblasStatus_t hipblasTpttrStridedBatched(hipblasHandle_t         handle,
+                                           const hipblasFillMode_t uplo,
+                                           const int               n,
+                                           const T*                AP,
+                                           const int               strideAP,
+                                           T*                      A,
+                                           const int               lda,
+                                           const int               strideA,
+                                           const int               batchCount);
+
+// lacpy
+template <typename T>
+hipblasStatus_t hipblasLacpy(hipblasHandle_t   handle,
+                             hipblasFillMode_t uplo,
+                             int               m,
+                             int               n,
+                             const T*          A,
+                             int               lda,
+                             T*                B,
+                             int               ldb);
+
+template <typename T>
+hipblasStatus_t hipblasLacpyBatched(hipblasHandle_t   handle,
+                                    hipblasFillMode_t uplo,
+                                    int               m,
+                                    int               n,
+                                    const T* const    A[],
+                                    int               lda,
+                                    T* const          B[],
+                                    int               ldb,
+                                    int               batch_count);
+
+template <typename T>
+hipblasStatus_t hipblasLacpyStridedBatched(hipblasHandle_t   handle,
+                                           hipblasFillMode_t uplo,
+                                           int               m,
+                                           int               n,
+                                           const T*          A,
+                                           int               lda,
+                                           long long         strideA,
+                                           T*                B,
+                                           int               ldb,
+                                           long long         strideB,
+                                           int               batch_count);
+
+// symmetrize
+template <typename T>
+hipblasStatus_t hipblasSymmetrize(hipblasHandle_t   handle,
+                                  hipblasFillMode_t uplo,
+                                  int               n,
+                                  T*                A,
+                                  int               lda);
+
+template <typename T>
+hipblasStatus_t hipblasSymmetrizeBatched(hipblasHandle_t   handle,
+                                         hipblasFillMode_t uplo,
+                                         int               n,
+                                         T* const          A[],
+                                         int               lda,
+                                         int               batch_count);
+
+template <typename T>
+hipblasStatus_t hipblasSymmetrizeStridedBatched(hipblasHandle_t   handle,
+                                                hipblasFillMode_t uplo,
+                                                int               n,
+                                                T*                A,
+                                                int               lda,
+                                                long long         strideA,
+                                                int               batch_count);
+
+// hermitize
+template <typename T>
+hipblasStatus_t hipblasHermitize(hipblasHandle_t   handle,
+                                 hipblasFillMode_t uplo,
+                                 int               n,
+                                 T*                A,
+                                 int               lda);
+
+template <typename T>
+hipblasStatus_t hipblasHermitizeBatched(hipblasHandle_t   handle,
+                                        hipblasFillMode_t uplo,
+                                        int               n,
+                                        T* const          A[],
+                                        int               lda,
+                                        int               batch_count);
+
+template <typename T>
+hipblasStatus_t hipblasHermitizeStridedBatched(hipblasHandle_t   handle,
+                                               hipblasFillMode_t uplo,
+                                               int               n,
+                                               T*                A,
+                                               int               lda,
+                                               long long         strideA,
+                                               int               batch_count);
+
+// transpose
+template <typename T>
+hipblasStatus_t hipblasTranspose(hipblasHandle_t    handle,
+                                 hipblasOperation_t trans,
+                                 int                n,
+                                 T*                 A,
+                                 int                lda);
+
+template <typename T>
+hipblasStatus_t hipblasTransposeBatched(hipblasHandle_t    handle,
+                                        hipblasOperation_t trans,
+                                        int                n,
+                                        T* const           A[],
+                                        int                lda,
+                                        int                batch_count);
+
+template <typename T>
+hipblasStatus_t hipblasTransposeStridedBatched(hipblasHandle_t    handle,
+                                               hipblasOperation_t trans,
+                                               int                n,
+                                               T*                 A,
+                                               int                lda,
+                                               long long          strideA,
+                                               int                batch_count);
+
+// lasr
+template <typename T, typename U>
+hipblasStatus_t hipblasLasr(hipblasHandle_t   handle,
+                            hipblasSideMode_t side,
+                            hipblasPivot_t    pivot,
+                            hipblasDirect_t   direct,
+                            int               m,
+                            int               n,
+                            const U*          c,
+                            const U*          s,
+                            T*                A,
+                            int               lda);
+
+template <typename T, typename U>
+hipblasStatus_t hipblasLasrBatched(hipblasHandle_t   handle,
+                                   hipblasSideMode_t side,
+                                   hipblasPivot_t    pivot,
+                                   hipblasDirect_t   direct,
+                                   int               m,
+                                   int               n,
+                                   const U* const    c[],
+                                   const U* const    s[],
+                                   T* const          A[],
+                                   int               lda,
+                                   int               batch_count);
+
+template <typename T, typename U>
+hipblasStatus_t hipblasLasrStridedBatched(hipblasHandle_t   handle,
+                                          hipblasSideMode_t side,
+                                          hipblasPivot_t    pivot,
+                                          hipblasDirect_t   direct,
+                                          int               m,
+                                          int               n,
+                                          const U*          c,
+                                          const U*          s,
+                                          long long         stridecs,
+                                          T*                A,
+                                          int               lda,
+                                          long long         strideA,
+                                          int               batch_count);
+
+// ge2gb
+template <typename T>
+hipblasStatus_t hipblasGe2gb(hipblasHandle_t handle,
+                             const int       m,
+                             const int       n,
+                             const int       kl,
+                             const int       ku,
+                             const T*        A,
+                             const int       lda,
+                             T*              AB,
+                             const int       ldab);
+
+template <typename T>
+hipblasStatus_t hipblasGe2gbBatched(hipblasHandle_t handle,
+                                    const int       m,
+                                    const int       n,
+                                    const int       kl,
+                                    const int       ku,
+                                    const T* const  A[],
+                                    const int       lda,
+                                    T* const        AB[],
+                                    const int       ldab,
+                                    const int       batchCount);
+
+template <typename T>
+hipblasStatus_t hipblasGe2gbStridedBatched(hipblasHandle_t handle,
+                                           const int       m,
+                                           const int       n,
+                                           const int       kl,
+                                           const int       ku,
+                                           const T*        A,
+                                           const int       lda,
+                                           const int       strideA,
+                                           T*              AB,
+                                           const int       ldab,
+                                           const int       strideAB,
+                                           const int       batchCount);
+
+// gb2ge
+template <typename T>
+hipblasStatus_t hipblasGb2ge(hipblasHandle_t handle,
+                             const int       m,
+                             const int       n,
+                             const int       kl,
+                             const int       ku,
+                             const T*        AB,
+                             const int       ldab,
+                             T*              A,
+                             const int       lda);
+
+template <typename T>
+hipblasStatus_t hipblasGb2geBatched(hipblasHandle_t handle,
+                                    const int       m,
+                                    const int       n,
+                                    const int       kl,
+                                    const int       ku,
+                                    const T* const  AB[],
+                                    const int       ldab,
+                                    T* const        A[],
+                                    const int       lda,
+                                    const int       batchCount);
+
+template <typename T>
+hipblasStatus_t hipblasGb2geStridedBatched(hipblasHandle_t handle,
+                                           const int       m,
+                                           const int       n,
+                                           const int       kl,
+                                           const int       ku,
+                                           const T*        AB,
+                                           const int       ldab,
+                                           const int       strideAB,
+                                           T*              A,
+                                           const int       lda,
+                                           const int       strideA,
+                                           const int       batchCount);
+
+// lange
+template <typename T, typename R>
+hipblasStatus_t hipblasLange(hipblasHandle_t         handle,
+                             const hipblasNormType_t norm,
+                             const int               m,
+                             const int               n,
+                             const T*                A,
+                             const int               lda,
+                             R*                      result);
+
+template <typename T, typename R>
+hipblasStatus_t hipblasLangeStridedBatched(hipblasHandle_t         handle,
+                                           const hipblasNormType_t norm,
+                                           const int               m,
+                                           const int               n,
+                                           const T*                A,
+                                           const int               lda,
+                                           const int               strideA,
+                                           const int               batchCount,
+                                           R*                      result);
+
 // trtri
 template <typename T>
 hipblasStatus_t hipblasTrtri(hipblasHandle_t   handle,
                              hipblasFillMode_t uplo,
                              hipblasDiagType_t diag,
                              int               n,
-                             T*                A,
+                             const T*          A,
                              int               lda,
                              T*                invA,
                              int               ldinvA);
 
 template <typename T>
-hipblasStatus_t hipblasTrtri_batched(hipblasHandle_t   handle,
-                                     hipblasFillMode_t uplo,
-                                     hipblasDiagType_t diag,
-                                     int               n,
-                                     T*                A,
-                                     int               lda,
-                                     int               bsa,
-                                     T*                invA,
-                                     int               ldinvA,
-                                     int               bsinvA,
-                                     int               batch_count);
+hipblasStatus_t hipblasTrtriBatched(hipblasHandle_t   handle,
+                                    hipblasFillMode_t uplo,
+                                    hipblasDiagType_t diag,
+                                    int               n,
+                                    const T* const    A[],
+                                    int               lda,
+                                    T* const          invA[],
+                                    int               ldinvA,
+                                    int               batchCount);
+
+template <typename T>
+hipblasStatus_t hipblasTrtriStridedBatched(hipblasHandle_t   handle,
+                                           hipblasFillMode_t uplo,
+                                           hipblasDiagType_t diag,
+                                           int               n,
+                                           const T*          A,
+                                           int               lda,
+                                           int               strideA,
+                                           T*                invA,
+                                           int               ldinvA,
+                                           int               strideInvA,
+                                           int               batchCount);
 
 template <typename T, int NB>
 hipblasStatus_t hipblasTrtri_trsm(hipblasHandle_t   handle,
@@ -1794,4 +3049,39 @@ hipblasStatus_t hipblasGeam(hipblasHandle_t    handle,
                             T*                 C,
                             int                ldc);
 
+template <typename T>
+hipblasStatus_t hipblasGeamBatched(hipblasHandle_t    handle,
+                                   hipblasOperation_t transA,
+                                   hipblasOperation_t transB,
+                                   int                m,
+                                   int                n,
+                                   const T*           alpha,
+                                   const T* const     A[],
+                                   int                lda,
+                                   const T*           beta,
+                                   const T* const     B[],
+                                   int                ldb,
+                                   T* const           C[],
+                                   int                ldc,
+                                   int                batchCount);
+
+template <typename T>
+hipblasStatus_t hipblasGeamStridedBatched(hipblasHandle_t    handle,
+                                          hipblasOperation_t transA,
+                                          hipblasOperation_t transB,
+                                          int                m,
+                                          int                n,
+                                          const T*           alpha,
+                                          const T*           A,
+                                          int                lda,
+                                          int                strideA,
+                                          const T*           beta,
+                                          const T*           B,
+                                          int                ldb,
+                                          int                strideB,
+                                          T*                 C,
+                                          int                ldc,
+                                          int                strideC,
+                                          int                batchCount);
+
 #endif // _ROCBLAS_HPP_
@@ -5,16 +5,20 @@
 #ifndef HIPBLAS_VECTOR_H_
 #define HIPBLAS_VECTOR_H_
 
+#include "device_guard.h"
+#include "device_pool.h"
 #include "hipblas.h"
 #include "utility.h"
 #include <cinttypes>
 #include <cstdio>
+#include <cstring>
 #include <gtest/gtest.h>
 #include <locale.h>
 #include <vector>
 
 /* ============================================================================================ */
-/*! \brief  base-class to allocate/deallocate device memory */
+/*! \brief  base-class to allocate/deallocate device memory; with Google Test each vector sits
+            between guards of up to PAD elements, see device_guard.h */
 template <typename T, size_t PAD, typename U>
 class d_vector
 {
@@ -22,15 +26,18 @@ protected:
     size_t size, bytes;
 
 #ifdef GOOGLE_TEST
-    U guard[PAD];
+    size_t pad; // guard elements each side, PAD unless HIPBLAS_CLIENT_GUARD lowers it
+    U      guard[PAD];
     d_vector(size_t s)
         : size(s)
-        , bytes((s + PAD * 2) * sizeof(T))
+        , pad(hipblas_client_guard(PAD))
     {
+        bytes = (s + pad * 2) * sizeof(T);
+
         // Initialize guard with random data
-        if(PAD > 0)
+        if(pad > 0)
         {
-            hipblas_init_nan(guard, PAD);
+            hipblas_init_nan(guard, pad);
         }
     }
 #else
@@ -44,26 +51,22 @@ protected:
     T* device_vector_setup()
     {
         T* d;
-        if((hipMalloc)(&d, bytes) != hipSuccess)
+        if(hipblas_pool_malloc((void**)&d, bytes) != hipSuccess)
         {
             static char* lc = setlocale(LC_NUMERIC, "");
             fprintf(stderr, "Error allocating %'zu bytes (%zu GB)\n", bytes, bytes >> 30);
             d = nullptr;
         }
 #ifdef GOOGLE_TEST
-        else
+        else if(pad > 0)
         {
-            if(PAD > 0)
-            {
-                // Copy guard to device memory before allocated memory
-                hipMemcpy(d, guard, sizeof(guard), hipMemcpyHostToDevice);
-
-                // Point to allocated block
-                d += PAD;
+            // Copy guard to device memory before and after allocated memory
+            hipError_t err = hipblas_device_fill_guards(
+                d, (size + pad) * sizeof(T), 2, guard, pad * sizeof(U));
+            CHECK_HIP_ERROR(err);
 
-                // Copy guard to device memory after allocated memory
-                hipMemcpy(d + size, guard, sizeof(guard), hipMemcpyHostToDevice);
-            }
+            // Point to allocated block
+            d += pad;
         }
 #endif
         return d;
@@ -74,35 +77,149 @@ protected:
         if(d != nullptr)
         {
 #ifdef GOOGLE_TEST
-            if(PAD > 0)
+            if(pad > 0)
             {
-                U host[PAD];
+                // Point to guard before allocated memory
+                d -= pad;
 
-                // Copy device memory after allocated memory to host
-                hipMemcpy(host, d + size, sizeof(guard), hipMemcpyDeviceToHost);
+                // Make sure no corruption has occurred on either side
+                size_t     corrupted;
+                hipError_t err = hipblas_device_check_guards(
+                    d, (size + pad) * sizeof(T), 2, guard, pad * sizeof(U), &corrupted);
+                CHECK_HIP_ERROR(err);
+                EXPECT_EQ(corrupted, size_t(0));
+            }
+#endif
+            // Return device memory to the pool
+            CHECK_HIP_ERROR(hipblas_pool_free(d));
+        }
+    }
 
-                // Make sure no corruption has occurred
-                EXPECT_EQ(memcmp(host, guard, sizeof(guard)), 0);
+    // One allocation holds count vectors, stride elements apart. With guards the slab reads
+    // guard, vector, guard, vector, ..., guard, so neighbouring vectors share a guard and all
+    // guards are written and checked in one launch; without guards each vector starts on a 256
+    // byte boundary like a separate allocation would
+    T* device_slab_setup(size_t count, size_t& stride)
+    {
+#ifdef GOOGLE_TEST
+        stride            = size + pad;
+        size_t slab_bytes = (count * stride + pad) * sizeof(T);
+#else
+        size_t align      = sizeof(T) < 256 && 256 % sizeof(T) == 0 ? 256 / sizeof(T) : 1;
+        stride            = ((size ? size : 1) + align - 1) / align * align;
+        size_t slab_bytes = count * stride * sizeof(T);
+#endif
+        T* d;
+        if(hipblas_pool_malloc((void**)&d, slab_bytes) != hipSuccess)
+        {
+            static char* lc = setlocale(LC_NUMERIC, "");
+            fprintf(stderr, "Error allocating %'zu bytes (%zu GB)\n", slab_bytes, slab_bytes >> 30);
+            d = nullptr;
+        }
+#ifdef GOOGLE_TEST
+        else if(pad > 0)
+        {
+            // Copy every guard into place at once
+            hipError_t err = hipblas_device_fill_guards(
+                d, stride * sizeof(T), count + 1, guard, pad * sizeof(U));
+            CHECK_HIP_ERROR(err);
 
-                // Point to guard before allocated memory
-                d -= PAD;
+            // Point to the first vector
+            d += pad;
+        }
+#endif
+        return d;
+    }
 
-                // Copy device memory after allocated memory to host
-                hipMemcpy(host, d, sizeof(guard), hipMemcpyDeviceToHost);
+    void device_slab_teardown(T* d, size_t count, size_t stride)
+    {
+        if(d != nullptr)
+        {
+#ifdef GOOGLE_TEST
+            if(pad > 0)
+            {
+                // Point to guard before the first vector
+                d -= pad;
 
-                // Make sure no corruption has occurred
-                EXPECT_EQ(memcmp(host, guard, sizeof(guard)), 0);
+                // Make sure no corruption has occurred, checking every guard at once
+                size_t     corrupted;
+                hipError_t err = hipblas_device_check_guards(
+                    d, stride * sizeof(T), count + 1, guard, pad * sizeof(U), &corrupted);
+                CHECK_HIP_ERROR(err);
+                EXPECT_EQ(corrupted, size_t(0));
             }
 #endif
-            // Free device memory
-            CHECK_HIP_ERROR((hipFree)(d));
+            // Return device memory to the pool
+            CHECK_HIP_ERROR(hipblas_pool_free(d));
+        }
+    }
+};
+
+/* ============================================================================================ */
+/*! \brief  batch of host vectors back to back in one pinned allocation, so that a
+            device_batch_vector of the same shape moves the whole batch in one copy */
+template <typename T>
+class host_batch_vector
+{
+public:
+    explicit host_batch_vector(size_t b, size_t s)
+        : batch(b)
+        , size(s)
+    {
+        size_t bytes = batch * size * sizeof(T);
+        if(bytes && hipHostMalloc((void**)&data, bytes) != hipSuccess)
+        {
+            static char* lc = setlocale(LC_NUMERIC, "");
+            fprintf(stderr, "Error allocating %'zu pinned bytes (%zu GB)\n", bytes, bytes >> 30);
+            data = nullptr;
         }
     }
+
+    ~host_batch_vector()
+    {
+        if(data != nullptr)
+            CHECK_HIP_ERROR(hipHostFree(data));
+    }
+
+    T* operator[](int n)
+    {
+        return data + n * size;
+    }
+
+    const T* operator[](int n) const
+    {
+        return data + n * size;
+    }
+
+    size_t batch_count() const
+    {
+        return batch;
+    }
+
+    size_t elements() const
+    {
+        return size;
+    }
+
+    // Tell whether the allocation failed
+    explicit operator bool() const
+    {
+        return data != nullptr || batch * size == 0;
+    }
+
+    // Disallow copying or assigning
+    host_batch_vector(const host_batch_vector&) = delete;
+    host_batch_vector& operator=(const host_batch_vector&) = delete;
+
+private:
+    T*     data = nullptr;
+    size_t batch;
+    size_t size;
 };
 
 /* ============================================================================================ */
 /*! \brief  pseudo-vector subclass which uses a batch of device memory pointers and
-            an array of pointers in host memory*/
+            an array of pointers in host memory; the batch shares one device allocation*/
 template <typename T, size_t PAD = 4096, typename U = T>
 class device_batch_vector : private d_vector<T, PAD, U>
 {
@@ -112,16 +229,16 @@ public:
         , d_vector<T, PAD, U>(s)
     {
         data = (T**)malloc(batch * sizeof(T*));
-        for(int b = 0; b < batch; ++b)
-            data[b] = this->device_vector_setup();
+        slab = batch ? this->device_slab_setup(batch, stride) : nullptr;
+        for(size_t b = 0; b < batch; ++b)
+            data[b] = slab ? slab + b * stride : nullptr;
     }
 
     ~device_batch_vector()
     {
         if(data != nullptr)
         {
-            for(int b = 0; b < batch; ++b)
-                this->device_vector_teardown(data[b]);
+            this->device_slab_teardown(slab, batch, stride);
             free(data);
         }
     }
@@ -136,13 +253,47 @@ public:
         return data;
     }
 
+    // Move a host batch of the same shape in or out as one strided copy of the whole slab,
+    // leaving the guards between the vectors untouched
+    hipError_t transfer_from(const host_batch_vector<T>& host)
+    {
+        if(host.batch_count() != batch || host.elements() != this->size)
+            return hipErrorInvalidValue;
+        if(batch == 0 || this->size == 0)
+            return hipSuccess;
+        return hipMemcpy2D(slab,
+                           stride * sizeof(T),
+                           host[0],
+                           this->size * sizeof(T),
+                           this->size * sizeof(T),
+                           batch,
+                           hipMemcpyHostToDevice);
+    }
+
+    hipError_t transfer_to(host_batch_vector<T>& host) const
+    {
+        if(host.batch_count() != batch || host.elements() != this->size)
+            return hipErrorInvalidValue;
+        if(batch == 0 || this->size == 0)
+            return hipSuccess;
+        return hipMemcpy2D(host[0],
+                           this->size * sizeof(T),
+                           slab,
+                           stride * sizeof(T),
+                           this->size * sizeof(T),
+                           batch,
+                           hipMemcpyDeviceToHost);
+    }
+
     // Disallow copying or assigning
     device_batch_vector(const device_batch_vector&) = delete;
     device_batch_vector& operator=(const device_batch_vector&) = delete;
 
 private:
     T**    data;
+    T*     slab;
     size_t batch;
+    size_t stride;
 };
 
 /* ============================================================================================ */
@@ -28,6 +28,14 @@
 template <typename T>
 double norm_check_general(char norm_type, int M, int N, int lda, T* hCPU, T* hGPU);
 
+/*! \brief  Template: norm check for general Matrix in device memory: float/double/complex.
+ * Computes dCPU - dGPU with geam and both norms with lange on the device, so nothing is copied
+ * back to the host; returns -1 if a hipblas call fails  */
+
+template <typename T>
+double norm_check_general_device(
+    hipblasHandle_t handle, char norm_type, int M, int N, int lda, const T* dCPU, const T* dGPU);
+
 /*! \brief  Template: norm check for hermitian/symmetric Matrix: float/double/complex */
 
 template <typename T>
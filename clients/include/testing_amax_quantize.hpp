@@ -0,0 +1,164 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <math.h>
+#include <stdlib.h>
+#include <vector>
+
+#include "hipblas.hpp"
+#include "unit.h"
+#include "utility.h"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+// Float A in [-8, 8) quantized to int8 with power-of-two scales, so the products are exact and
+// those past 127 saturate. Each batch of the strided call takes one scale, each row of the
+// batched call its own, and the quantized values and amax are compared exactly against the host
+hipblasStatus_t testing_amax_quantize(Arguments argus)
+{
+    int M           = argus.M;
+    int N           = argus.N;
+    int lda         = argus.lda;
+    int ldq         = argus.ldb;
+    int batch_count = argus.batch_count;
+
+    // check here to prevent undefined memory allocation error
+    if(M < 0 || N < 0 || lda < M || lda == 0 || ldq < M || ldq == 0 || batch_count < 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+
+    int stride_A = lda * N;
+    int stride_Q = ldq * N;
+    int A_size   = stride_A * batch_count;
+    int Q_size   = stride_Q * batch_count;
+    int rows     = M * batch_count;
+
+    // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory, plz follow this practice
+    host_vector<float>  hA(A_size);
+    host_vector<float>  hscale(rows);
+    host_vector<int8_t> hQ(Q_size);
+    host_vector<int>    hQ_cpu(Q_size);
+    host_vector<int>    hQ_gpu(Q_size);
+    host_vector<float>  hamax_cpu(rows);
+    host_vector<float>  hamax_gpu(rows);
+
+    device_vector<float>  dA(A_size);
+    device_vector<float>  dscale(rows);
+    device_vector<int8_t> dQ(Q_size);
+    device_vector<float>  damax(rows);
+
+    vector<const void*>        hA_array(batch_count);
+    vector<void*>              hQ_array(batch_count);
+    device_vector<const void*> dA_array(batch_count);
+    device_vector<void*>       dQ_array(batch_count);
+
+    hipblasHandle_t handle;
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+    hipblas_client_create(&handle);
+
+    // Initial Data on CPU
+    srand(1);
+    for(float& x : hA)
+        x = float(rand() % 4096) / 256 - 8;
+    for(int r = 0; r < rows; r++)
+        hscale[r] = float(1 << (r % 6 + 2));
+    for(int b = 0; b < batch_count; b++)
+    {
+        hA_array[b] = (const float*)dA + b * stride_A;
+        hQ_array[b] = (int8_t*)dQ + b * stride_Q;
+    }
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(float) * A_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dscale, hscale.data(), sizeof(float) * rows, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dA_array, hA_array.data(), sizeof(void*) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dQ_array, hQ_array.data(), sizeof(void*) * batch_count, hipMemcpyHostToDevice));
+
+    auto reference = [&](bool per_row) {
+        for(int b = 0; b < batch_count; b++)
+        {
+            for(int i = 0; i < M; i++)
+                hamax_cpu[per_row ? b * M + i : b] = 0;
+            for(int j = 0; j < N; j++)
+                for(int i = 0; i < M; i++)
+                {
+                    float  x = hA[b * stride_A + i + j * lda];
+                    float  s = hscale[per_row ? b * M + i : b];
+                    float& a = hamax_cpu[per_row ? b * M + i : b];
+                    a        = std::max(a, std::abs(x));
+                    hQ_cpu[b * stride_Q + i + j * ldq]
+                        = int(std::min(std::max(std::nearbyint(s * x), -127.0f), 127.0f));
+                }
+        }
+    };
+
+    auto check = [&](int count) {
+        CHECK_HIP_ERROR(
+            hipMemcpy(hQ.data(), dQ, sizeof(int8_t) * Q_size, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hamax_gpu.data(), damax, sizeof(float) * count, hipMemcpyDeviceToHost));
+        for(int i = 0; i < Q_size; i++)
+            hQ_gpu[i] = hQ[i];
+        unit_check_general<int>(M, N, batch_count, ldq, stride_Q, hQ_cpu.data(), hQ_gpu.data());
+        unit_check_general<float>(1, count, 1, hamax_cpu.data(), hamax_gpu.data());
+    };
+
+    /* =====================================================================
+         ROCBLAS
+    =================================================================== */
+    status = hipblasAmaxQuantizeStridedBatched(handle,
+                                               HIPBLAS_AMAX_PER_TENSOR,
+                                               M,
+                                               N,
+                                               dA,
+                                               HIPBLAS_R_32F,
+                                               lda,
+                                               stride_A,
+                                               dscale,
+                                               dQ,
+                                               HIPBLAS_R_8I,
+                                               ldq,
+                                               stride_Q,
+                                               damax,
+                                               batch_count);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    if(argus.unit_check && M > 0 && N > 0 && batch_count > 0)
+    {
+        reference(false);
+        check(batch_count);
+
+        CHECK_HIP_ERROR(hipMemset(dQ, 0, sizeof(int8_t) * Q_size));
+        EXPECT_EQ(HIPBLAS_STATUS_SUCCESS,
+                  hipblasAmaxQuantizeBatched(handle,
+                                             HIPBLAS_AMAX_PER_ROW,
+                                             M,
+                                             N,
+                                             dA_array,
+                                             HIPBLAS_R_32F,
+                                             lda,
+                                             dscale,
+                                             dQ_array,
+                                             HIPBLAS_R_8I,
+                                             ldq,
+                                             damax,
+                                             batch_count));
+        reference(true);
+        check(rows);
+    }
+
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -50,7 +50,7 @@ hipblasStatus_t testing_asum(Arguments argus)
     double rocblas_error;
 
     hipblasHandle_t handle;
-    hipblasCreate(&handle);
+    hipblas_client_create(&handle);
 
     // allocate memory on device
     CHECK_HIP_ERROR(hipMalloc(&dx, sizeX * sizeof(T1)));
@@ -89,7 +89,7 @@ hipblasStatus_t testing_asum(Arguments argus)
     {
         CHECK_HIP_ERROR(hipFree(dx));
         CHECK_HIP_ERROR(hipFree(d_rocblas_result));
-        hipblasDestroy(handle);
+        hipblas_client_destroy(handle);
         if(status_1 != HIPBLAS_STATUS_SUCCESS)
             return status_1;
         if(status_2 != HIPBLAS_STATUS_SUCCESS)
@@ -119,6 +119,6 @@ hipblasStatus_t testing_asum(Arguments argus)
     //  BLAS_1_RESULT_PRINT
     CHECK_HIP_ERROR(hipFree(dx));
     CHECK_HIP_ERROR(hipFree(d_rocblas_result));
-    hipblasDestroy(handle);
+    hipblas_client_destroy(handle);
     return HIPBLAS_STATUS_SUCCESS;
 }
@@ -46,7 +46,7 @@ hipblasStatus_t testing_asum_batched(Arguments argus)
     double rocblas_error;
 
     hipblasHandle_t handle;
-    hipblasCreate(&handle);
+    hipblas_client_create(&handle);
 
     // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory, plz follow this practice
     host_vector<T1> hx_array[batch_count];
@@ -97,7 +97,7 @@ hipblasStatus_t testing_asum_batched(Arguments argus)
        || (status_2 != HIPBLAS_STATUS_SUCCESS || (status_3 != HIPBLAS_STATUS_SUCCESS)
            || (status_4 != HIPBLAS_STATUS_SUCCESS)))
     {
-        hipblasDestroy(handle);
+        hipblas_client_destroy(handle);
         if(status_1 != HIPBLAS_STATUS_SUCCESS)
             return status_1;
         if(status_2 != HIPBLAS_STATUS_SUCCESS)
@@ -117,10 +117,9 @@ hipblasStatus_t testing_asum_batched(Arguments argus)
         /* =====================================================================
                     CPU BLAS
         =================================================================== */
-        for(int b = 0; b < batch_count; b++)
-        {
+        hipblas_batch_for(batch_count, [&](int b) {
             cblas_asum<T1, T2>(N, hx_array[b], incx, &(h_cpu_result[b]));
-        }
+        });
 
         if(argus.unit_check)
         {
@@ -131,6 +130,6 @@ hipblasStatus_t testing_asum_batched(Arguments argus)
     } // end of if unit/norm check
 
     //  BLAS_1_RESULT_PRINT
-    hipblasDestroy(handle);
+    hipblas_client_destroy(handle);
     return HIPBLAS_STATUS_SUCCESS;
 }
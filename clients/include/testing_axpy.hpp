@@ -8,6 +8,7 @@
 #include <vector>
 
 #include "cblas_interface.h"
+#include "flops.h"
 #include "hipblas.hpp"
 #include "norm.h"
 #include "unit.h"
@@ -48,13 +49,13 @@ hipblasStatus_t testing_axpy(Arguments argus)
     host_vector<T> hy_cpu(sizeY);
 
     device_vector<T> dx(sizeX);
-    device_vector<T> dy(sizeX);
+    device_vector<T> dy(sizeY);
 
     double gpu_time_used, cpu_time_used;
     double rocblas_error = 0.0;
 
     hipblasHandle_t handle;
-    hipblasCreate(&handle);
+    hipblas_client_create(&handle);
 
     // Initial Data on CPU
     srand(1);
@@ -74,7 +75,7 @@ hipblasStatus_t testing_axpy(Arguments argus)
     status = hipblasAxpy<T>(handle, N, &alpha, dx, incx, dy, incy);
     if(status != HIPBLAS_STATUS_SUCCESS)
     {
-        hipblasDestroy(handle);
+        hipblas_client_destroy(handle);
         return status;
     }
 
@@ -99,8 +100,23 @@ hipblasStatus_t testing_axpy(Arguments argus)
 
     } // end of if unit check
 
-    //  BLAS_1_RESULT_PRINT
+    if(argus.timing)
+    {
+        hipblas_timing timing;
+        status = hipblas_time_launches(handle, argus, timing, [&] {
+            return hipblasAxpy<T>(handle, N, &alpha, dx, incx, dy, incy);
+        });
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            hipblas_client_destroy(handle);
+            return status;
+        }
+
+        cout << "N,alpha,incx,incy," HIPBLAS_TIMING_COLUMNS << endl;
+        cout << N << ',' << argus.alpha << ',' << incx << ',' << incy << ',';
+        hipblas_print_timing(cout, timing, axpy_gflop_count<T>(N), axpy_gbyte_count<T>(N));
+    }
 
-    hipblasDestroy(handle);
+    hipblas_client_destroy(handle);
     return HIPBLAS_STATUS_SUCCESS;
 }
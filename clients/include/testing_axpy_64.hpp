@@ -0,0 +1,83 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+#include "cblas_interface.h"
+#include "hipblas.hpp"
+#include "unit.h"
+#include "utility.h"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+template <typename T>
+hipblasStatus_t testing_axpy_64(Arguments argus)
+{
+    int64_t N    = argus.N;
+    int64_t incx = argus.incx;
+    int64_t incy = argus.incy;
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+
+    int abs_incx = incx < 0 ? -incx : incx;
+    int abs_incy = incy < 0 ? -incy : incy;
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    if(N < 0 || !incx || !incy)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+
+    int sizeX = N * abs_incx;
+    int sizeY = N * abs_incy;
+    T   alpha = argus.alpha;
+
+    // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory, plz follow this practice
+    host_vector<T> hx(sizeX);
+    host_vector<T> hy(sizeY);
+    host_vector<T> hy_cpu(sizeY);
+
+    device_vector<T> dx(sizeX);
+    device_vector<T> dy(sizeY);
+
+    hipblasHandle_t handle;
+    hipblas_client_create(&handle);
+
+    // Initial Data on CPU
+    srand(1);
+    hipblas_init<T>(hx, 1, N, abs_incx);
+    hipblas_init<T>(hy, 1, N, abs_incy);
+    hy_cpu = hy;
+
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * sizeX, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy, hy.data(), sizeof(T) * sizeY, hipMemcpyHostToDevice));
+
+    /* =====================================================================
+         HIPBLAS
+    =================================================================== */
+    status = hipblasAxpy_64<T>(handle, N, &alpha, dx, incx, dy, incy);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    // copy output from device to CPU
+    CHECK_HIP_ERROR(hipMemcpy(hy.data(), dy, sizeof(T) * sizeY, hipMemcpyDeviceToHost));
+
+    if(argus.unit_check)
+    {
+        cblas_axpy<T>(N, alpha, hx.data(), incx, hy_cpu.data(), incy);
+        unit_check_general<T>(1, N, abs_incy, hy_cpu.data(), hy.data());
+    }
+
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,95 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+#include "cblas_interface.h"
+#include "hipblas.hpp"
+#include "norm.h"
+#include "unit.h"
+#include "utility.h"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+// x and y are stored as Tx; alpha and the arithmetic are in Tex
+template <typename Tx, typename Tex = Tx>
+hipblasStatus_t testing_axpy_ex(Arguments argus)
+{
+    int N    = argus.N;
+    int incx = argus.incx;
+    int incy = argus.incy;
+
+    hipblasDatatype_t x_type         = hipblas_datatype<Tx>;
+    hipblasDatatype_t execution_type = hipblas_datatype<Tex>;
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+
+    int abs_incx = incx < 0 ? -incx : incx;
+    int abs_incy = incy < 0 ? -incy : incy;
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    if(N < 0 || !incx || !incy)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+
+    int sizeX   = N * abs_incx;
+    int sizeY   = N * abs_incy;
+    Tex alpha   = argus.get_alpha<Tex>();
+    Tx  alpha_x = argus.get_alpha<Tx>();
+
+    // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory, plz follow this practice
+    host_vector<Tx> hx(sizeX);
+    host_vector<Tx> hy(sizeY);
+    host_vector<Tx> hy_cpu(sizeY);
+
+    device_vector<Tx> dx(sizeX);
+    device_vector<Tx> dy(sizeY);
+
+    hipblasHandle_t handle;
+    hipblas_client_create(&handle);
+
+    // Initial Data on CPU
+    srand(1);
+    hipblas_init<Tx>(hx, 1, N, abs_incx);
+    hipblas_init<Tx>(hy, 1, N, abs_incy);
+    hy_cpu = hy;
+
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(Tx) * sizeX, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy, hy.data(), sizeof(Tx) * sizeY, hipMemcpyHostToDevice));
+
+    /* =====================================================================
+         ROCBLAS
+    =================================================================== */
+    status = hipblasAxpyEx(
+        handle, N, &alpha, execution_type, dx, x_type, incx, dy, x_type, incy, execution_type);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    // copy output from device to CPU
+    CHECK_HIP_ERROR(hipMemcpy(hy.data(), dy, sizeof(Tx) * sizeY, hipMemcpyDeviceToHost));
+
+    if(argus.unit_check)
+    {
+        /* =====================================================================
+                    CPU BLAS
+        =================================================================== */
+        // the hipblasHalf reference also computes in float
+        cblas_axpy<Tx>(N, alpha_x, hx.data(), incx, hy_cpu.data(), incy);
+
+        unit_check_general<Tx>(1, N, abs_incy, hy_cpu.data(), hy.data());
+    }
+
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -62,7 +62,7 @@ hipblasStatus_t testing_axpy_strided_batched(Arguments argus)
     double rocblas_error = 0.0;
 
     hipblasHandle_t handle;
-    hipblasCreate(&handle);
+    hipblas_client_create(&handle);
 
     // Initial Data on CPU
     srand(1);
@@ -83,7 +83,7 @@ hipblasStatus_t testing_axpy_strided_batched(Arguments argus)
         handle, N, &alpha, dx, incx, stridex, dy, incy, stridey, batch_count);
     if(status != HIPBLAS_STATUS_SUCCESS)
     {
-        hipblasDestroy(handle);
+        hipblas_client_destroy(handle);
         return status;
     }
 
@@ -96,11 +96,10 @@ hipblasStatus_t testing_axpy_strided_batched(Arguments argus)
         /* =====================================================================
                     CPU BLAS
         =================================================================== */
-        for(int b = 0; b < batch_count; b++)
-        {
+        hipblas_batch_for(batch_count, [&](int b) {
             cblas_axpy<T>(
                 N, alpha, hx_cpu.data() + b * stridex, incx, hy_cpu.data() + b * stridey, incy);
-        }
+        });
 
         // enable unit check, notice unit check is not invasive, but norm check is,
         // unit check and norm check can not be interchanged their order
@@ -114,6 +113,6 @@ hipblasStatus_t testing_axpy_strided_batched(Arguments argus)
 
     //  BLAS_1_RESULT_PRINT
 
-    hipblasDestroy(handle);
+    hipblas_client_destroy(handle);
     return HIPBLAS_STATUS_SUCCESS;
 }
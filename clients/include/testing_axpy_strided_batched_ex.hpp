@@ -0,0 +1,118 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+#include "cblas_interface.h"
+#include "hipblas.hpp"
+#include "norm.h"
+#include "unit.h"
+#include "utility.h"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+// x and y are stored as Tx; alpha and the arithmetic are in Tex
+template <typename Tx, typename Tex = Tx>
+hipblasStatus_t testing_axpy_strided_batched_ex(Arguments argus)
+{
+    int    N            = argus.N;
+    int    incx         = argus.incx;
+    int    incy         = argus.incy;
+    double stride_scale = argus.stride_scale;
+    int    batch_count  = argus.batch_count;
+
+    hipblasDatatype_t x_type         = hipblas_datatype<Tx>;
+    hipblasDatatype_t execution_type = hipblas_datatype<Tex>;
+
+    int abs_incx = incx < 0 ? -incx : incx;
+    int abs_incy = incy < 0 ? -incy : incy;
+
+    int stridex = N * abs_incx * stride_scale;
+    int stridey = N * abs_incy * stride_scale;
+    int sizeX   = stridex * batch_count;
+    int sizeY   = stridey * batch_count;
+
+    Tex alpha   = argus.get_alpha<Tex>();
+    Tx  alpha_x = argus.get_alpha<Tx>();
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    if(N < 0 || !incx || !incy || batch_count < 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    if(!batch_count)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory, plz follow this practice
+    host_vector<Tx> hx(sizeX);
+    host_vector<Tx> hy(sizeY);
+    host_vector<Tx> hy_cpu(sizeY);
+
+    device_vector<Tx> dx(sizeX);
+    device_vector<Tx> dy(sizeY);
+
+    hipblasHandle_t handle;
+    hipblas_client_create(&handle);
+
+    // Initial Data on CPU
+    srand(1);
+    hipblas_init<Tx>(hx, 1, N, abs_incx, stridex, batch_count);
+    hipblas_init<Tx>(hy, 1, N, abs_incy, stridey, batch_count);
+    hy_cpu = hy;
+
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(Tx) * sizeX, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy, hy.data(), sizeof(Tx) * sizeY, hipMemcpyHostToDevice));
+
+    /* =====================================================================
+         ROCBLAS
+    =================================================================== */
+    status = hipblasAxpyStridedBatchedEx(handle,
+                                         N,
+                                         &alpha,
+                                         execution_type,
+                                         dx,
+                                         x_type,
+                                         incx,
+                                         stridex,
+                                         dy,
+                                         x_type,
+                                         incy,
+                                         stridey,
+                                         batch_count,
+                                         execution_type);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    // copy output from device to CPU
+    CHECK_HIP_ERROR(hipMemcpy(hy.data(), dy, sizeof(Tx) * sizeY, hipMemcpyDeviceToHost));
+
+    if(argus.unit_check)
+    {
+        /* =====================================================================
+                    CPU BLAS
+        =================================================================== */
+        hipblas_batch_for(batch_count, [&](int b) {
+            cblas_axpy<Tx>(
+                N, alpha_x, hx.data() + b * stridex, incx, hy_cpu.data() + b * stridey, incy);
+        });
+
+        unit_check_general<Tx>(1, N, batch_count, abs_incy, stridey, hy_cpu.data(), hy.data());
+    }
+
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
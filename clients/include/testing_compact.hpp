@@ -0,0 +1,271 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "cblas_interface.h"
+#include "hipblas.hpp"
+#include "norm.h"
+#include "unit.h"
+#include "utility.h"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+// Strided A, B and C packed to the compact layout, multiplied there and C unpacked again, against
+// cblas_gemm batch by batch
+template <typename T>
+hipblasStatus_t testing_gemm_compact(Arguments argus)
+{
+    int M           = argus.M;
+    int N           = argus.N;
+    int K           = argus.K;
+    int batch_count = argus.batch_count;
+
+    hipblasOperation_t transA = char2hipblas_operation(argus.transA_option);
+    hipblasOperation_t transB = char2hipblas_operation(argus.transB_option);
+
+    int A_row = transA == HIPBLAS_OP_N ? M : K;
+    int A_col = transA == HIPBLAS_OP_N ? K : M;
+    int B_row = transB == HIPBLAS_OP_N ? K : N;
+    int B_col = transB == HIPBLAS_OP_N ? N : K;
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+
+    // check here to prevent undefined memory allocation error
+    if(M < 0 || N < 0 || K < 0 || batch_count < 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    if(M == 0 || N == 0 || batch_count == 0)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    int lda = std::max(1, A_row);
+    int ldb = std::max(1, B_row);
+    int ldc = M;
+
+    int strideA = lda * A_col;
+    int strideB = ldb * B_col;
+    int strideC = ldc * N;
+
+    int A_size = std::max(1, strideA * batch_count);
+    int B_size = std::max(1, strideB * batch_count);
+    int C_size = strideC * batch_count;
+
+    T alpha = argus.get_alpha<T>();
+    T beta  = argus.get_beta<T>();
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA(A_size);
+    host_vector<T> hB(B_size);
+    host_vector<T> hC(C_size);
+    host_vector<T> hC_gpu(C_size);
+
+    device_vector<T> dA(A_size);
+    device_vector<T> dB(B_size);
+    device_vector<T> dC(C_size);
+    device_vector<T> dAc(A_size);
+    device_vector<T> dBc(B_size);
+    device_vector<T> dCc(C_size);
+
+    hipblasHandle_t handle;
+    hipblas_client_create(&handle);
+
+    // Initial Data on CPU
+    srand(1);
+    hipblas_init<T>(hA, A_row, A_col, lda, strideA, batch_count);
+    hipblas_init<T>(hB, B_row, B_col, ldb, strideB, batch_count);
+    hipblas_init<T>(hC, M, N, ldc, strideC, batch_count);
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * A_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB.data(), sizeof(T) * B_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC, hC.data(), sizeof(T) * C_size, hipMemcpyHostToDevice));
+
+    /* =====================================================================
+           HIPBLAS
+    =================================================================== */
+    status = hipblasPackCompact<T>(handle, A_row, A_col, dA, lda, strideA, dAc, lda, batch_count);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasPackCompact<T>(
+            handle, B_row, B_col, dB, ldb, strideB, dBc, ldb, batch_count);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasPackCompact<T>(handle, M, N, dC, ldc, strideC, dCc, ldc, batch_count);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasGemmCompact<T>(handle,
+                                       transA,
+                                       transB,
+                                       M,
+                                       N,
+                                       K,
+                                       &alpha,
+                                       dAc,
+                                       lda,
+                                       dBc,
+                                       ldb,
+                                       &beta,
+                                       dCc,
+                                       ldc,
+                                       batch_count);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasUnpackCompact<T>(handle, M, N, dCc, ldc, dC, ldc, strideC, batch_count);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    // copy output from device to CPU
+    CHECK_HIP_ERROR(hipMemcpy(hC_gpu.data(), dC, sizeof(T) * C_size, hipMemcpyDeviceToHost));
+
+    if(argus.unit_check)
+    {
+        /* =====================================================================
+           CPU BLAS
+        =================================================================== */
+        for(int b = 0; b < batch_count; b++)
+            cblas_gemm<T>(transA,
+                          transB,
+                          M,
+                          N,
+                          K,
+                          alpha,
+                          hA.data() + b * strideA,
+                          lda,
+                          hB.data() + b * strideB,
+                          ldb,
+                          beta,
+                          hC.data() + b * strideC,
+                          ldc);
+
+        unit_check_general<T>(M, N, batch_count, ldc, strideC, hC.data(), hC_gpu.data());
+    }
+
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+// A X = B solved in the compact layout by getrf and getrs, for an A that needs row swaps: each row
+// of A has its dominant element one column to the right of the diagonal, cyclically
+template <typename T>
+hipblasStatus_t testing_getrs_compact(Arguments argus)
+{
+    int N           = argus.N;
+    int nrhs        = argus.K;
+    int batch_count = argus.batch_count;
+
+    hipblasOperation_t trans = char2hipblas_operation(argus.transA_option);
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+
+    // check here to prevent undefined memory allocation error
+    if(N < 0 || nrhs < 0 || batch_count < 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    if(N == 0 || nrhs == 0 || batch_count == 0)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    int lda     = N;
+    int ldb     = N;
+    int strideA = lda * N;
+    int strideB = ldb * nrhs;
+    int A_size  = strideA * batch_count;
+    int B_size  = strideB * batch_count;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T>   hA(A_size);
+    host_vector<T>   hX(B_size);
+    host_vector<T>   hB(B_size);
+    host_vector<int> hInfo(batch_count);
+
+    device_vector<T>   dA(A_size);
+    device_vector<T>   dB(B_size);
+    device_vector<T>   dAc(A_size);
+    device_vector<T>   dBc(B_size);
+    device_vector<int> dIpiv(N * batch_count);
+    device_vector<int> dInfo(batch_count);
+
+    hipblasHandle_t handle;
+    hipblas_client_create(&handle);
+
+    // Initial Data on CPU, with hB = op(A) * hX so the solution is hX
+    srand(1);
+    hipblas_init<T>(hA, N, N, lda, strideA, batch_count);
+    hipblas_init<T>(hX, N, nrhs, ldb, strideB, batch_count);
+    for(int b = 0; b < batch_count; b++)
+    {
+        T* a = hA.data() + b * strideA;
+        for(int i = 0; i < N; i++)
+            a[i + ((i + 1) % N) * lda] += 20 * N;
+        cblas_gemm<T>(trans,
+                      HIPBLAS_OP_N,
+                      N,
+                      nrhs,
+                      N,
+                      T(1),
+                      a,
+                      lda,
+                      hX.data() + b * strideB,
+                      ldb,
+                      T(0),
+                      hB.data() + b * strideB,
+                      ldb);
+    }
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * A_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB.data(), sizeof(T) * B_size, hipMemcpyHostToDevice));
+
+    /* =====================================================================
+           HIPBLAS
+    =================================================================== */
+    status = hipblasPackCompact<T>(handle, N, N, dA, lda, strideA, dAc, lda, batch_count);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasPackCompact<T>(handle, N, nrhs, dB, ldb, strideB, dBc, ldb, batch_count);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasGetrfCompact<T>(handle, N, dAc, lda, dIpiv, dInfo, batch_count);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasGetrsCompact<T>(
+            handle, trans, N, nrhs, dAc, lda, dIpiv, dBc, ldb, batch_count);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasUnpackCompact<T>(handle, N, nrhs, dBc, ldb, dB, ldb, strideB, batch_count);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    // copy output from device to CPU
+    CHECK_HIP_ERROR(hipMemcpy(hB.data(), dB, sizeof(T) * B_size, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(
+        hipMemcpy(hInfo.data(), dInfo, sizeof(int) * batch_count, hipMemcpyDeviceToHost));
+
+    if(argus.unit_check)
+    {
+        T      eps       = std::numeric_limits<T>::epsilon();
+        double tolerance = eps * 100;
+
+        for(int b = 0; b < batch_count; b++)
+        {
+            EXPECT_EQ(0, hInfo[b]);
+            double e = norm_check_general<T>(
+                'F', N, nrhs, ldb, hX.data() + b * strideB, hB.data() + b * strideB);
+            unit_check_error(e, tolerance);
+        }
+    }
+
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
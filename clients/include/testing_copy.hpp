@@ -56,7 +56,7 @@ hipblasStatus_t testing_copy(Arguments argus)
 
     hipblasHandle_t handle;
 
-    hipblasCreate(&handle);
+    hipblas_client_create(&handle);
 
     // allocate memory on device
     CHECK_HIP_ERROR(hipMalloc(&dx, sizeX * sizeof(T)));
@@ -81,7 +81,7 @@ hipblasStatus_t testing_copy(Arguments argus)
     {
         CHECK_HIP_ERROR(hipFree(dx));
         CHECK_HIP_ERROR(hipFree(dy));
-        hipblasDestroy(handle);
+        hipblas_client_destroy(handle);
         return status;
     }
 
@@ -110,6 +110,6 @@ hipblasStatus_t testing_copy(Arguments argus)
 
     CHECK_HIP_ERROR(hipFree(dx));
     CHECK_HIP_ERROR(hipFree(dy));
-    hipblasDestroy(handle);
+    hipblas_client_destroy(handle);
     return HIPBLAS_STATUS_SUCCESS;
 }
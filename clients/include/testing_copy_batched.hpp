@@ -46,7 +46,7 @@ hipblasStatus_t testing_copy_batched(Arguments argus)
     double rocblas_error = 0.0;
 
     hipblasHandle_t handle;
-    hipblasCreate(&handle);
+    hipblas_client_create(&handle);
 
     // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory, plz follow this practice
     host_vector<T> hx_array[batch_count];
@@ -63,7 +63,7 @@ hipblasStatus_t testing_copy_batched(Arguments argus)
     int last = batch_count - 1;
     if(!dx_array || !dy_array || (!bx_array[last] && sizeX) || (!by_array[last] && sizeY))
     {
-        hipblasDestroy(handle);
+        hipblas_client_destroy(handle);
         return HIPBLAS_STATUS_ALLOC_FAILED;
     }
 
@@ -96,7 +96,7 @@ hipblasStatus_t testing_copy_batched(Arguments argus)
     status = hipblasCopyBatched<T>(handle, N, dx_array, incx, dy_array, incy, batch_count);
     if(status != HIPBLAS_STATUS_SUCCESS)
     {
-        hipblasDestroy(handle);
+        hipblas_client_destroy(handle);
         return status;
     }
 
@@ -114,10 +114,9 @@ hipblasStatus_t testing_copy_batched(Arguments argus)
         /* =====================================================================
                     CPU BLAS
         =================================================================== */
-        for(int b = 0; b < batch_count; b++)
-        {
+        hipblas_batch_for(batch_count, [&](int b) {
             cblas_copy<T>(N, hx_cpu_array[b], incx, hy_cpu_array[b], incy);
-        }
+        });
 
         // enable unit check, notice unit check is not invasive, but norm check is,
         // unit check and norm check can not be interchanged their order
@@ -131,6 +130,6 @@ hipblasStatus_t testing_copy_batched(Arguments argus)
 
     //  BLAS_1_RESULT_PRINT
 
-    hipblasDestroy(handle);
+    hipblas_client_destroy(handle);
     return HIPBLAS_STATUS_SUCCESS;
 }
@@ -0,0 +1,172 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <stdlib.h>
+#include <vector>
+
+#include "hipblas.hpp"
+#include "unit.h"
+#include "utility.h"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+// subnormal of the fp16 and fp32 ranges, their smallest normal numbers and ordinary values
+static const float flush_denorm_values[] = {5.9604645e-8f,
+                                            -3.0517578e-5f,
+                                            6.1035156e-5f,
+                                            1.0f,
+                                            1e-6f,
+                                            -3e-5f,
+                                            1e-40f,
+                                            -1e-39f,
+                                            1.1754944e-38f,
+                                            3.0f,
+                                            0.5f};
+
+// float value of a Tx or Ty element, subnormal ones taken as zeros of their sign
+template <typename T>
+float flush_denorm_to_float(T val)
+{
+    float min_normal = std::is_same<T, hipblasHalf>{} ? 6.1035156e-5f
+                                                      : std::numeric_limits<float>::min();
+    float f          = hipblas_to_float(val);
+    return std::abs(f) < min_normal ? std::copysign(0.0f, f) : f;
+}
+
+// bit pattern of an element, so zeros of either sign compare apart
+template <typename T>
+int flush_denorm_bits(T val)
+{
+    int bits = 0;
+    memcpy(&bits, &val, sizeof(T));
+    return bits;
+}
+
+// copy_ex of Tx into Ty with the default math mode and with HIPBLAS_FLUSH_DENORM_MATH, checked
+// bit for bit against the host conversion; with the flush subnormal inputs and subnormal results
+// are zeros of their sign
+template <typename Tx, typename Ty>
+hipblasStatus_t testing_copy_ex_flush_denorm(Arguments argus)
+{
+    int N    = argus.N;
+    int incx = argus.incx;
+    int incy = argus.incy;
+
+    hipblasDatatype_t x_type = hipblas_datatype<Tx>;
+    hipblasDatatype_t y_type = hipblas_datatype<Ty>;
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+
+    int abs_incx = incx < 0 ? -incx : incx;
+    int abs_incy = incy < 0 ? -incy : incy;
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    if(N < 0 || !incx || !incy)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    if(N == 0)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    int sizeX = N * abs_incx;
+    int sizeY = N * abs_incy;
+
+    // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory, plz follow this practice
+    host_vector<Tx>  hx(sizeX);
+    host_vector<Ty>  hy_kept(sizeY);
+    host_vector<Ty>  hy_flushed(sizeY);
+    host_vector<int> hbits_cpu(N);
+    host_vector<int> hbits_gpu(N);
+
+    device_vector<Tx> dx(sizeX);
+    device_vector<Ty> dy(sizeY);
+
+    hipblasHandle_t handle;
+    hipblas_client_create(&handle);
+
+    // Initial Data on CPU
+    size_t values = sizeof(flush_denorm_values) / sizeof(flush_denorm_values[0]);
+    for(int i = 0; i < N; i++)
+        hx[i * abs_incx] = hipblas_from_float<Tx>(flush_denorm_values[i % values]);
+
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(Tx) * sizeX, hipMemcpyHostToDevice));
+
+    auto copy = [&](hipblasMath_t mode, host_vector<Ty>& y) {
+        hipblasStatus_t copy_status = hipblasSetMathMode(handle, mode);
+        if(copy_status == HIPBLAS_STATUS_SUCCESS)
+            copy_status = hipblasCopyEx(handle, N, dx, x_type, incx, dy, y_type, incy);
+        CHECK_HIP_ERROR(hipMemcpy(y.data(), dy, sizeof(Ty) * sizeY, hipMemcpyDeviceToHost));
+        return copy_status;
+    };
+
+    /* =====================================================================
+         HIPBLAS
+    =================================================================== */
+    status = copy(HIPBLAS_DEFAULT_MATH, hy_kept);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = copy(HIPBLAS_FLUSH_DENORM_MATH, hy_flushed);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblasSetMathMode(handle, HIPBLAS_DEFAULT_MATH);
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    if(argus.unit_check)
+    {
+        // element i of x against element i of y, counted from the far end for negative increments
+        auto check = [&](host_vector<Ty>& y, bool flush) {
+            for(int i = 0; i < N; i++)
+            {
+                Tx    x = hx[(incx < 0 ? N - 1 - i : i) * abs_incx];
+                float v = flush ? flush_denorm_to_float(x) : hipblas_to_float(x);
+                Ty    r = hipblas_from_float<Ty>(v);
+                if(flush)
+                    r = hipblas_from_float<Ty>(flush_denorm_to_float(r));
+                hbits_cpu[i] = flush_denorm_bits(r);
+                hbits_gpu[i] = flush_denorm_bits(y[(incy < 0 ? N - 1 - i : i) * abs_incy]);
+            }
+            unit_check_general<int>(1, N, 1, hbits_cpu.data(), hbits_gpu.data());
+        };
+        check(hy_kept, false);
+        check(hy_flushed, true);
+    }
+
+    if(argus.timing)
+    {
+        // timed with the flush on, as the last copy left the handle
+        hipblas_timing timing;
+        status = hipblas_time_launches(handle, argus, timing, [&] {
+            return hipblasCopyEx(handle, N, dx, x_type, incx, dy, y_type, incy);
+        });
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            hipblasSetMathMode(handle, HIPBLAS_DEFAULT_MATH);
+            hipblas_client_destroy(handle);
+            return status;
+        }
+
+        double gbyte = (double(sizeof(Tx)) + sizeof(Ty)) * N / 1e9;
+
+        cout << "N,incx,incy," HIPBLAS_TIMING_COLUMNS << endl;
+        cout << N << ',' << incx << ',' << incy << ',';
+        hipblas_print_timing(cout, timing, 0.0, gbyte);
+    }
+
+    // later Ex calls on a shared handle keep their denormals
+    hipblasSetMathMode(handle, HIPBLAS_DEFAULT_MATH);
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -54,7 +54,7 @@ hipblasStatus_t testing_copy_strided_batched(Arguments argus)
     double rocblas_error = 0.0;
 
     hipblasHandle_t handle;
-    hipblasCreate(&handle);
+    hipblas_client_create(&handle);
 
     // Initial Data on CPU
     srand(1);
@@ -74,7 +74,7 @@ hipblasStatus_t testing_copy_strided_batched(Arguments argus)
         handle, N, dx, incx, stridex, dy, incy, stridey, batch_count);
     if(status != HIPBLAS_STATUS_SUCCESS)
     {
-        hipblasDestroy(handle);
+        hipblas_client_destroy(handle);
         return status;
     }
 
@@ -87,10 +87,9 @@ hipblasStatus_t testing_copy_strided_batched(Arguments argus)
         /* =====================================================================
                     CPU BLAS
         =================================================================== */
-        for(int b = 0; b < batch_count; b++)
-        {
+        hipblas_batch_for(batch_count, [&](int b) {
             cblas_copy<T>(N, hx_cpu.data() + b * stridex, incx, hy_cpu.data() + b * stridey, incy);
-        }
+        });
 
         // enable unit check, notice unit check is not invasive, but norm check is,
         // unit check and norm check can not be interchanged their order
@@ -104,6 +103,6 @@ hipblasStatus_t testing_copy_strided_batched(Arguments argus)
 
     //  BLAS_1_RESULT_PRINT
 
-    hipblasDestroy(handle);
+    hipblas_client_destroy(handle);
     return HIPBLAS_STATUS_SUCCESS;
 }
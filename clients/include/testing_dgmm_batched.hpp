@@ -0,0 +1,155 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "cblas_interface.h"
+#include "flops.h"
+#include "hipblas.hpp"
+#include "norm.h"
+#include "unit.h"
+#include "utility.h"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+template <typename T>
+hipblasStatus_t testing_dgmm_batched(Arguments argus)
+{
+    int M           = argus.M;
+    int N           = argus.N;
+    int lda         = argus.lda;
+    int incx        = argus.incx;
+    int ldc         = argus.ldc;
+    int batch_count = argus.batch_count;
+
+    hipblasSideMode_t side = char2hipblas_side(argus.side_option);
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+
+    // x has K entries, K = M for side == left and N for side == right
+    int K = (side == HIPBLAS_SIDE_LEFT ? M : N);
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    if(M < 0 || N < 0 || lda < M || ldc < M || incx <= 0 || batch_count < 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    else if(batch_count == 0)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    hipblasHandle_t handle;
+    hipblas_client_create(&handle);
+
+    int A_size = lda * N;
+    int X_size = K * incx;
+    int C_size = ldc * N;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA[batch_count];
+    host_vector<T> hx[batch_count];
+    host_vector<T> hC[batch_count];
+    host_vector<T> hC2[batch_count];
+
+    device_batch_vector<T> bA(batch_count, A_size);
+    device_batch_vector<T> bx(batch_count, X_size);
+    device_batch_vector<T> bC(batch_count, C_size);
+
+    device_vector<T*, 0, T> dA(batch_count);
+    device_vector<T*, 0, T> dx(batch_count);
+    device_vector<T*, 0, T> dC(batch_count);
+
+    int last = batch_count - 1;
+    if(!dA || !dx || !dC || (!bA[last] && A_size) || (!bx[last] && X_size)
+       || (!bC[last] && C_size))
+    {
+        hipblas_client_destroy(handle);
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+    }
+
+    // Initial Data on CPU
+    srand(1);
+    for(int b = 0; b < batch_count; b++)
+    {
+        hA[b]  = host_vector<T>(A_size);
+        hx[b]  = host_vector<T>(X_size);
+        hC[b]  = host_vector<T>(C_size);
+        hC2[b] = host_vector<T>(C_size);
+
+        hipblas_init<T>(hA[b], M, N, lda);
+        hipblas_init<T>(hx[b], 1, K, incx);
+        hipblas_init<T>(hC[b], M, N, ldc);
+
+        CHECK_HIP_ERROR(hipMemcpy(bA[b], hA[b], sizeof(T) * A_size, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(bx[b], hx[b], sizeof(T) * X_size, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(bC[b], hC[b], sizeof(T) * C_size, hipMemcpyHostToDevice));
+    }
+    CHECK_HIP_ERROR(hipMemcpy(dA, bA, sizeof(T*) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, bx, sizeof(T*) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC, bC, sizeof(T*) * batch_count, hipMemcpyHostToDevice));
+
+    /* =====================================================================
+           ROCBLAS
+    =================================================================== */
+    status = hipblasDgmmBatched<T>(handle, side, M, N, dA, lda, dx, incx, dC, ldc, batch_count);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    // copy output from device to CPU
+    for(int b = 0; b < batch_count; b++)
+    {
+        hipMemcpy(hC2[b], bC[b], sizeof(T) * C_size, hipMemcpyDeviceToHost);
+    }
+
+    if(argus.unit_check)
+    {
+        /* =====================================================================
+           CPU BLAS
+        =================================================================== */
+        for(int b = 0; b < batch_count; b++)
+            for(int j = 0; j < N; j++)
+                for(int i = 0; i < M; i++)
+                    hC[b][i + j * ldc]
+                        = hA[b][i + j * lda] * hx[b][(side == HIPBLAS_SIDE_LEFT ? i : j) * incx];
+
+        unit_check_general<T>(M, N, batch_count, ldc, hC2, hC);
+    }
+
+    if(argus.timing)
+    {
+        hipblas_timing timing;
+        status = hipblas_time_launches(handle, argus, timing, [&] {
+            return hipblasDgmmBatched<T>(
+                handle, side, M, N, dA, lda, dx, incx, dC, ldc, batch_count);
+        });
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            hipblas_client_destroy(handle);
+            return status;
+        }
+
+        double gflop = dgmm_gflop_count<T>(M, N) * batch_count;
+        double gbyte = dgmm_gbyte_count<T>(M, N, K) * batch_count;
+
+        cout << "M,N,lda,incx,ldc,batch_count,side," HIPBLAS_TIMING_COLUMNS << endl;
+        cout << M << ',' << N << ',' << lda << ',' << incx << ',' << ldc << ',' << batch_count
+             << ',' << argus.side_option << ',';
+        hipblas_print_timing(cout, timing, gflop, gbyte);
+    }
+
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,152 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "cblas_interface.h"
+#include "flops.h"
+#include "hipblas.hpp"
+#include "norm.h"
+#include "unit.h"
+#include "utility.h"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+template <typename T>
+hipblasStatus_t testing_dgmm_strided_batched(Arguments argus)
+{
+    int    M            = argus.M;
+    int    N            = argus.N;
+    int    lda          = argus.lda;
+    int    incx         = argus.incx;
+    int    ldc          = argus.ldc;
+    double stride_scale = argus.stride_scale;
+    int    batch_count  = argus.batch_count;
+
+    hipblasSideMode_t side = char2hipblas_side(argus.side_option);
+
+    // x has K entries, K = M for side == left and N for side == right
+    int K        = (side == HIPBLAS_SIDE_LEFT ? M : N);
+    int stride_A = lda * N * stride_scale;
+    int stride_x = K * incx * stride_scale;
+    int stride_C = ldc * N * stride_scale;
+    int A_size   = stride_A * batch_count;
+    int X_size   = stride_x * batch_count;
+    int C_size   = stride_C * batch_count;
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    if(M < 0 || N < 0 || lda < M || ldc < M || incx <= 0 || batch_count < 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    else if(batch_count == 0)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA(A_size);
+    host_vector<T> hx(X_size);
+    host_vector<T> hC(C_size);
+    host_vector<T> hC2(C_size);
+
+    device_vector<T> dA(A_size);
+    device_vector<T> dx(X_size);
+    device_vector<T> dC(C_size);
+
+    hipblasHandle_t handle;
+    hipblas_client_create(&handle);
+
+    // Initial Data on CPU
+    srand(1);
+    hipblas_init<T>(hA, M, N, lda, stride_A, batch_count);
+    hipblas_init<T>(hx, 1, K, incx, stride_x, batch_count);
+    hipblas_init<T>(hC, M, N, ldc, stride_C, batch_count);
+
+    // copy data from CPU to device
+    hipMemcpy(dA, hA.data(), sizeof(T) * A_size, hipMemcpyHostToDevice);
+    hipMemcpy(dx, hx.data(), sizeof(T) * X_size, hipMemcpyHostToDevice);
+    hipMemcpy(dC, hC.data(), sizeof(T) * C_size, hipMemcpyHostToDevice);
+
+    /* =====================================================================
+           ROCBLAS
+    =================================================================== */
+    status = hipblasDgmmStridedBatched<T>(
+        handle, side, M, N, dA, lda, stride_A, dx, incx, stride_x, dC, ldc, stride_C, batch_count);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    // copy output from device to CPU
+    hipMemcpy(hC2.data(), dC, sizeof(T) * C_size, hipMemcpyDeviceToHost);
+
+    if(argus.unit_check)
+    {
+        /* =====================================================================
+           CPU BLAS
+        =================================================================== */
+        for(int b = 0; b < batch_count; b++)
+        {
+            T* hAb = hA.data() + b * stride_A;
+            T* hxb = hx.data() + b * stride_x;
+            T* hCb = hC.data() + b * stride_C;
+
+            for(int j = 0; j < N; j++)
+                for(int i = 0; i < M; i++)
+                    hCb[i + j * ldc]
+                        = hAb[i + j * lda] * hxb[(side == HIPBLAS_SIDE_LEFT ? i : j) * incx];
+        }
+
+        unit_check_general<T>(M, N, batch_count, ldc, stride_C, hC2.data(), hC.data());
+    }
+
+    if(argus.timing)
+    {
+        hipblas_timing timing;
+        status = hipblas_time_launches(handle, argus, timing, [&] {
+            return hipblasDgmmStridedBatched<T>(handle,
+                                                side,
+                                                M,
+                                                N,
+                                                dA,
+                                                lda,
+                                                stride_A,
+                                                dx,
+                                                incx,
+                                                stride_x,
+                                                dC,
+                                                ldc,
+                                                stride_C,
+                                                batch_count);
+        });
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            hipblas_client_destroy(handle);
+            return status;
+        }
+
+        double gflop = dgmm_gflop_count<T>(M, N) * batch_count;
+        double gbyte = dgmm_gbyte_count<T>(M, N, K) * batch_count;
+
+        cout << "M,N,lda,incx,ldc,stride_scale,batch_count,side," HIPBLAS_TIMING_COLUMNS << endl;
+        cout << M << ',' << N << ',' << lda << ',' << incx << ',' << ldc << ',' << stride_scale
+             << ',' << batch_count << ',' << argus.side_option << ',';
+        hipblas_print_timing(cout, timing, gflop, gbyte);
+    }
+
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,357 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef _TESTING_DISPATCH_HPP_
+#define _TESTING_DISPATCH_HPP_
+
+#include "testing_axpy.hpp"
+#include "testing_dot.hpp"
+#include "testing_gemm.hpp"
+#include "testing_gemm_abft.hpp"
+#include "testing_gemm_abft_batched.hpp"
+#include "testing_gemm_abft_strided_batched.hpp"
+#include "testing_gemm_autotune.hpp"
+#include "testing_gemm_batch_reduce.hpp"
+#include "testing_gemm_batched.hpp"
+#include "testing_gemm_jit.hpp"
+#include "testing_gemm_quantized.hpp"
+#include "testing_gemm_quantized_strided_batched.hpp"
+#include "testing_gemm_requant.hpp"
+#include "testing_gemm_strided_batch_reduce.hpp"
+#include "testing_gemm_strassen.hpp"
+#include "testing_gemm_strided_batched.hpp"
+#include "testing_gemv.hpp"
+#include "testing_ger_accumulate.hpp"
+#include "testing_lacpy.hpp"
+#include "testing_lacpy_batched.hpp"
+#include "testing_lacpy_strided_batched.hpp"
+#include "testing_lasr.hpp"
+#include "testing_lasr_batched.hpp"
+#include "testing_lasr_strided_batched.hpp"
+#include "testing_level1_vbatched_ex.hpp"
+#include "testing_scal.hpp"
+#include "testing_sparse_gemm24.hpp"
+#include "testing_symmetrize.hpp"
+#include "testing_symmetrize_batched.hpp"
+#include "testing_symmetrize_strided_batched.hpp"
+#include "testing_transpose.hpp"
+#include "testing_transpose_batched.hpp"
+#include "testing_transpose_strided_batched.hpp"
+#include "testing_trmm_mixed_batched_ex.hpp"
+#include "testing_trmm_mixed_ex.hpp"
+#include "testing_trmm_mixed_strided_batched_ex.hpp"
+#include "testing_trsm_mixed_batched_ex.hpp"
+#include "testing_trsm_mixed_ex.hpp"
+#include "testing_trsm_mixed_strided_batched_ex.hpp"
+#include "utility.h"
+#include <string>
+
+#ifdef __HIP_PLATFORM_SOLVER__
+#include "testing_geqrf.hpp"
+#include "testing_geqrf_strided_batched.hpp"
+#include "testing_getrf.hpp"
+#include "testing_getrf_strided_batched.hpp"
+#include "testing_getri_strided_batched.hpp"
+#include "testing_getrs.hpp"
+#include "testing_getrs_strided_batched.hpp"
+#include "testing_potrf.hpp"
+#include "testing_potrf_strided_batched.hpp"
+#include "testing_tsqr.hpp"
+#endif
+
+/* ============================================================================================ */
+/*  dispatch: function name and precision to a testing_* template, for the functions the YAML
+    case lists can name */
+
+template <typename T>
+hipblasStatus_t testing_dispatch_level1(const std::string& function, const Arguments& arg)
+{
+    if(function == "axpy")
+        return testing_axpy<T>(arg);
+    else if(function == "dot")
+        return testing_dot<T>(arg);
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+// the vbatched level-1 Ex routines of real x, y and execution type T; n is the longest entry
+template <typename T>
+hipblasStatus_t testing_dispatch_vbatched(const std::string& function, const Arguments& arg)
+{
+    if(function == "axpy_vbatched_ex")
+        return testing_axpy_vbatched_ex<T>(arg);
+    else if(function == "axpby_vbatched_ex")
+        return testing_axpby_vbatched_ex<T>(arg);
+    else if(function == "scal_vbatched_ex")
+        return testing_scal_vbatched_ex<T>(arg);
+    else if(function == "copy_vbatched_ex")
+        return testing_copy_vbatched_ex<T>(arg);
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+// the mixed-precision trsm and trmm of A and B in T with fp32 compute
+template <typename T>
+hipblasStatus_t testing_dispatch_trsm_mixed(const std::string& function, const Arguments& arg)
+{
+    if(function == "trsm_mixed_ex")
+        return testing_trsm_mixed_ex<T>(arg);
+    else if(function == "trsm_mixed_batched_ex")
+        return testing_trsm_mixed_batched_ex<T>(arg);
+    else if(function == "trsm_mixed_strided_batched_ex")
+        return testing_trsm_mixed_strided_batched_ex<T>(arg);
+    else if(function == "trmm_mixed_ex")
+        return testing_trmm_mixed_ex<T>(arg);
+    else if(function == "trmm_mixed_batched_ex")
+        return testing_trmm_mixed_batched_ex<T>(arg);
+    else if(function == "trmm_mixed_strided_batched_ex")
+        return testing_trmm_mixed_strided_batched_ex<T>(arg);
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+// the Ex routines, whose storage and compute types the precision picks: the vbatched level-1 ones
+// in s or d, the quantized gemms on h or s activations with C in s, sparse_gemm24 in h or s, the
+// int8 gemm_requant under s, gemm_autotune, gemm_strassen and the gemm_abft routines in s or d,
+// the mixed trsm and trmm and the gemm_jit plans in h or s. A 4-bit B of the quantized gemms needs
+// an even ldb
+inline hipblasStatus_t
+    testing_dispatch_ex(const std::string& function, char precision, Arguments arg)
+{
+    if(function.size() > 12 && function.compare(function.size() - 12, 12, "_vbatched_ex") == 0)
+    {
+        if(precision == 's')
+            return testing_dispatch_vbatched<float>(function, arg);
+        else if(precision == 'd')
+            return testing_dispatch_vbatched<double>(function, arg);
+    }
+    else if(function == "gemm_quantized" || function == "gemm_quantized_strided_batched")
+    {
+        arg.lda = std::max(arg.lda, arg.transA_option == 'N' ? arg.M : arg.K);
+        arg.ldb = (std::max(arg.ldb, arg.K) + 1) & ~1;
+        bool strided = function == "gemm_quantized_strided_batched";
+        if(precision == 'h')
+            return strided ? testing_gemm_quantized_strided_batched<hipblasHalf>(arg)
+                           : testing_gemm_quantized<hipblasHalf>(arg);
+        else if(precision == 's')
+            return strided ? testing_gemm_quantized_strided_batched<float>(arg)
+                           : testing_gemm_quantized<float>(arg);
+    }
+    else if(function == "sparse_gemm24")
+    {
+        if(precision == 'h')
+            return testing_sparse_gemm24<hipblasHalf>(arg);
+        else if(precision == 's')
+            return testing_sparse_gemm24<float>(arg);
+    }
+    else if(function == "gemm_requant")
+    {
+        if(precision == 's')
+            return testing_gemm_requant(arg);
+    }
+    else if(function == "gemm_autotune")
+    {
+        if(precision == 's')
+            return testing_gemm_autotune<float>(arg);
+        else if(precision == 'd')
+            return testing_gemm_autotune<double>(arg);
+    }
+    else if(function == "gemm_strassen")
+    {
+        if(precision == 's')
+            return testing_gemm_strassen<float>(arg);
+        else if(precision == 'd')
+            return testing_gemm_strassen<double>(arg);
+    }
+    else if(function == "gemm_abft")
+    {
+        if(precision == 's')
+            return testing_gemm_abft<float>(arg);
+        else if(precision == 'd')
+            return testing_gemm_abft<double>(arg);
+    }
+    else if(function == "gemm_abft_batched")
+    {
+        if(precision == 's')
+            return testing_gemm_abft_batched<float>(arg);
+        else if(precision == 'd')
+            return testing_gemm_abft_batched<double>(arg);
+    }
+    else if(function == "gemm_abft_strided_batched")
+    {
+        if(precision == 's')
+            return testing_gemm_abft_strided_batched<float>(arg);
+        else if(precision == 'd')
+            return testing_gemm_abft_strided_batched<double>(arg);
+    }
+    else if(function == "gemm_jit")
+    {
+        if(precision == 'h')
+            return testing_gemm_jit<hipblasHalf>(arg);
+        else if(precision == 's')
+            return testing_gemm_jit<float>(arg);
+    }
+    else if(function.compare(0, 11, "trsm_mixed_") == 0
+            || function.compare(0, 11, "trmm_mixed_") == 0)
+    {
+        if(precision == 'h')
+            return testing_dispatch_trsm_mixed<hipblasHalf>(function, arg);
+        else if(precision == 's')
+            return testing_dispatch_trsm_mixed<float>(function, arg);
+    }
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+#ifdef __HIP_PLATFORM_SOLVER__
+// the solvers but geqrf and tsqr are square of order n, so leading dimensions filled in from m
+// and k are raised to n
+template <typename T>
+hipblasStatus_t testing_dispatch_solver(const std::string& function, Arguments arg)
+{
+    if(function != "geqrf" && function != "geqrf_strided_batched" && function != "tsqr")
+    {
+        arg.lda = std::max(arg.lda, arg.N);
+        arg.ldb = std::max(arg.ldb, arg.N);
+    }
+
+    if(function == "getrf")
+        return testing_getrf<T>(arg);
+    else if(function == "getrf_strided_batched")
+        return testing_getrf_strided_batched<T>(arg);
+    else if(function == "getrs")
+        return testing_getrs<T>(arg);
+    else if(function == "getrs_strided_batched")
+        return testing_getrs_strided_batched<T>(arg);
+    else if(function == "getri_strided_batched")
+        return testing_getri_strided_batched<T>(arg);
+    else if(function == "geqrf")
+        return testing_geqrf<T>(arg);
+    else if(function == "geqrf_strided_batched")
+        return testing_geqrf_strided_batched<T>(arg);
+    else if(function == "potrf")
+        return testing_potrf<T>(arg);
+    else if(function == "potrf_strided_batched")
+        return testing_potrf_strided_batched<T>(arg);
+    else if(function == "tsqr")
+        return testing_tsqr<T>(arg);
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+#endif
+
+// the data-movement routines: lacpy's B is as tall as A and the others are square of order n, so
+// leading dimensions filled in from m and k are raised to fit
+template <typename T>
+hipblasStatus_t testing_dispatch_matrix(const std::string& function, Arguments arg)
+{
+    if(function.compare(0, 5, "lacpy") == 0)
+        arg.ldb = std::max(arg.ldb, arg.M);
+    else
+        arg.lda = std::max(arg.lda, arg.N);
+
+    if(function == "lacpy")
+        return testing_lacpy<T>(arg);
+    else if(function == "lacpy_batched")
+        return testing_lacpy_batched<T>(arg);
+    else if(function == "lacpy_strided_batched")
+        return testing_lacpy_strided_batched<T>(arg);
+    else if(function == "symmetrize")
+        return testing_symmetrize<T>(arg);
+    else if(function == "symmetrize_batched")
+        return testing_symmetrize_batched<T>(arg);
+    else if(function == "symmetrize_strided_batched")
+        return testing_symmetrize_strided_batched<T>(arg);
+    else if(function == "transpose")
+        return testing_transpose<T>(arg);
+    else if(function == "transpose_batched")
+        return testing_transpose_batched<T>(arg);
+    else if(function == "transpose_strided_batched")
+        return testing_transpose_strided_batched<T>(arg);
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+template <typename T>
+hipblasStatus_t testing_dispatch(const std::string& function, const Arguments& arg)
+{
+    if(function == "axpy" || function == "dot")
+        return testing_dispatch_level1<T>(function, arg);
+    else if(function == "scal")
+        return testing_scal<T>(arg);
+    else if(function == "gemv")
+        return testing_gemv<T>(arg);
+    else if(function == "ger_accumulate")
+        return testing_ger_accumulate<T, false>(arg);
+    else if(function == "gemm")
+        return testing_gemm<T>(arg);
+    else if(function == "gemm_batched")
+        return testing_GemmBatched<T>(arg);
+    else if(function == "gemm_strided_batched")
+        return testing_GemmStridedBatched<T>(arg);
+    else if(function == "gemm_batch_reduce")
+        return testing_gemm_batch_reduce<T>(arg);
+    else if(function == "gemm_strided_batch_reduce")
+        return testing_gemm_strided_batch_reduce<T>(arg);
+    else if(function == "lasr")
+        return testing_lasr<T>(arg);
+    else if(function == "lasr_batched")
+        return testing_lasr_batched<T>(arg);
+    else if(function == "lasr_strided_batched")
+        return testing_lasr_strided_batched<T>(arg);
+    return testing_dispatch_matrix<T>(function, arg);
+}
+
+// the functions only the complex precisions have: gerc_accumulate, and hermitize, square of order
+// n as symmetrize is
+template <typename T>
+hipblasStatus_t testing_dispatch_complex(const std::string& function, Arguments arg)
+{
+    if(function == "gerc_accumulate")
+        return testing_ger_accumulate<T, true>(arg);
+    if(function.compare(0, 9, "hermitize") != 0)
+        return testing_dispatch<T>(function, arg);
+
+    arg.lda = std::max(arg.lda, arg.N);
+
+    if(function == "hermitize")
+        return testing_hermitize<T>(arg);
+    else if(function == "hermitize_batched")
+        return testing_hermitize_batched<T>(arg);
+    else if(function == "hermitize_strided_batched")
+        return testing_hermitize_strided_batched<T>(arg);
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+// h is only supported by axpy, dot, the quantized gemms, sparse_gemm24, the mixed trsm and trmm
+// and gemm_jit, the solvers, the vbatched Ex routines, gemm_autotune, gemm_strassen and the
+// gemm_abft routines by s and d, and hermitize and gerc_accumulate by c and z
+inline hipblasStatus_t
+    testing_dispatch(const std::string& function, char precision, const Arguments& arg)
+{
+    hipblasStatus_t status = testing_dispatch_ex(function, precision, arg);
+    if(status != HIPBLAS_STATUS_NOT_SUPPORTED)
+        return status;
+#ifdef __HIP_PLATFORM_SOLVER__
+    if(precision == 's' || precision == 'd')
+    {
+        status = precision == 's' ? testing_dispatch_solver<float>(function, arg)
+                                  : testing_dispatch_solver<double>(function, arg);
+        if(status != HIPBLAS_STATUS_NOT_SUPPORTED)
+            return status;
+    }
+#endif
+    switch(precision)
+    {
+    case 'h':
+        return testing_dispatch_level1<hipblasHalf>(function, arg);
+    case 's':
+        return testing_dispatch<float>(function, arg);
+    case 'd':
+        return testing_dispatch<double>(function, arg);
+    case 'c':
+        return testing_dispatch_complex<hipblasComplex>(function, arg);
+    case 'z':
+        return testing_dispatch_complex<hipblasDoubleComplex>(function, arg);
+    }
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+#endif
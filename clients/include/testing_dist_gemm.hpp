@@ -0,0 +1,118 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "cblas_interface.h"
+#include "hipblas.hpp"
+#include "hipblas_distributed.h"
+#include "unit.h"
+#include "utility.h"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+// hipblasDistDgemm on a 1 x 1 grid over the current device: the blocks still split k into SUMMA
+// steps, which run through the same broadcasts and double-buffered panels as on a larger grid
+hipblasStatus_t testing_dist_gemm(Arguments argus)
+{
+    using T = double;
+
+    int M     = argus.M;
+    int N     = argus.N;
+    int K     = argus.K;
+    int block = argus.ldb;
+    int lda   = argus.lda;
+    int ldc   = argus.ldc;
+
+    T alpha = argus.alpha;
+    T beta  = argus.beta;
+
+    // check here to prevent undefined memory allocation error
+    if(M < 0 || N < 0 || K < 0 || block <= 0 || lda < max(1, M) || ldc < max(1, M))
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+
+    int ldb = max(1, K);
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA(lda * K);
+    host_vector<T> hB(ldb * N);
+    host_vector<T> hC(ldc * N);
+    host_vector<T> hC_gold(ldc * N);
+
+    device_vector<T> dA(lda * K);
+    device_vector<T> dB(ldb * N);
+    device_vector<T> dC(ldc * N);
+
+    int device;
+    CHECK_HIP_ERROR(hipGetDevice(&device));
+    ncclComm_t row_comm, col_comm;
+    if(ncclCommInitAll(&row_comm, 1, &device) != ncclSuccess)
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+    if(ncclCommInitAll(&col_comm, 1, &device) != ncclSuccess)
+    {
+        ncclCommDestroy(row_comm);
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+    }
+
+    hipblasHandle_t   handle;
+    hipblasDistGrid_t grid;
+    hipblas_client_create(&handle);
+    hipblasStatus_t status = hipblasDistGridCreate(&grid, handle, row_comm, col_comm);
+
+    // Initial Data on CPU
+    srand(1);
+    hipblas_init<T>(hA, M, K, lda);
+    hipblas_init<T>(hB, K, N, ldb);
+    hipblas_init<T>(hC, M, N, ldc);
+    hC_gold = hC;
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * lda * K, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB.data(), sizeof(T) * ldb * N, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC, hC.data(), sizeof(T) * ldc * N, hipMemcpyHostToDevice));
+
+    /* =====================================================================
+         HIPBLAS
+    =================================================================== */
+    hipblasDistDesc_t descA = {M, K, block, block, lda};
+    hipblasDistDesc_t descB = {K, N, block, block, ldb};
+    hipblasDistDesc_t descC = {M, N, block, block, ldc};
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasDistDgemm(
+            grid, HIPBLAS_OP_N, HIPBLAS_OP_N, &alpha, dA, &descA, dB, &descB, &beta, dC, &descC);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        CHECK_HIP_ERROR(hipMemcpy(hC.data(), dC, sizeof(T) * ldc * N, hipMemcpyDeviceToHost));
+
+    if(status == HIPBLAS_STATUS_SUCCESS && argus.unit_check)
+    {
+        cblas_gemm<T>(HIPBLAS_OP_N,
+                      HIPBLAS_OP_N,
+                      M,
+                      N,
+                      K,
+                      alpha,
+                      hA.data(),
+                      lda,
+                      hB.data(),
+                      ldb,
+                      beta,
+                      hC_gold.data(),
+                      ldc);
+
+        unit_check_general<T>(M, N, ldc, hC_gold.data(), hC.data());
+    }
+
+    hipblasDistGridDestroy(grid);
+    hipblas_client_destroy(handle);
+    ncclCommDestroy(col_comm);
+    ncclCommDestroy(row_comm);
+    return status;
+}
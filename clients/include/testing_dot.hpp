@@ -8,6 +8,7 @@
 #include <vector>
 
 #include "cblas_interface.h"
+#include "flops.h"
 #include "hipblas.hpp"
 #include "norm.h"
 #include "unit.h"
@@ -61,7 +62,7 @@ hipblasStatus_t testing_dot(Arguments argus)
     double rocblas_error;
 
     hipblasHandle_t handle;
-    hipblasCreate(&handle);
+    hipblas_client_create(&handle);
 
     // allocate memory on device
     CHECK_HIP_ERROR(hipMalloc(&dx, sizeX * sizeof(T)));
@@ -106,7 +107,7 @@ hipblasStatus_t testing_dot(Arguments argus)
         CHECK_HIP_ERROR(hipFree(dx));
         CHECK_HIP_ERROR(hipFree(dy));
         CHECK_HIP_ERROR(hipFree(d_rocblas_result));
-        hipblasDestroy(handle);
+        hipblas_client_destroy(handle);
         if(status_1 != HIPBLAS_STATUS_SUCCESS)
             return status_1;
         if(status_2 != HIPBLAS_STATUS_SUCCESS)
@@ -132,12 +133,32 @@ hipblasStatus_t testing_dot(Arguments argus)
 
     } // end of if unit/norm check
 
-    //  BLAS_1_RESULT_PRINT
+    if(argus.timing)
+    {
+        hipblas_timing timing;
+        status_1 = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE);
+        status_2 = hipblas_time_launches(handle, argus, timing, [&] {
+            return (CONJ ? hipblasDotc<T>
+                         : hipblasDot<T>)(handle, N, dx, incx, dy, incy, d_rocblas_result);
+        });
+        if((status_1 != HIPBLAS_STATUS_SUCCESS) || (status_2 != HIPBLAS_STATUS_SUCCESS))
+        {
+            CHECK_HIP_ERROR(hipFree(dx));
+            CHECK_HIP_ERROR(hipFree(dy));
+            CHECK_HIP_ERROR(hipFree(d_rocblas_result));
+            hipblas_client_destroy(handle);
+            return status_1 != HIPBLAS_STATUS_SUCCESS ? status_1 : status_2;
+        }
+
+        cout << "N,incx,incy," HIPBLAS_TIMING_COLUMNS << endl;
+        cout << N << ',' << incx << ',' << incy << ',';
+        hipblas_print_timing(cout, timing, dot_gflop_count<T>(N), dot_gbyte_count<T>(N));
+    }
 
     CHECK_HIP_ERROR(hipFree(dx));
     CHECK_HIP_ERROR(hipFree(dy));
     CHECK_HIP_ERROR(hipFree(d_rocblas_result));
-    hipblasDestroy(handle);
+    hipblas_client_destroy(handle);
     return HIPBLAS_STATUS_SUCCESS;
 }
 
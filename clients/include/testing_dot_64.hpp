@@ -0,0 +1,92 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+#include "cblas_interface.h"
+#include "hipblas.hpp"
+#include "unit.h"
+#include "utility.h"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+template <typename T, bool CONJ = false>
+hipblasStatus_t testing_dot_64(Arguments argus)
+{
+    int64_t N    = argus.N;
+    int64_t incx = argus.incx;
+    int64_t incy = argus.incy;
+
+    hipblasStatus_t status_1 = HIPBLAS_STATUS_SUCCESS;
+    hipblasStatus_t status_2 = HIPBLAS_STATUS_SUCCESS;
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    if(N < 0 || incx < 0 || incy < 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+
+    int sizeX = N * incx;
+    int sizeY = N * incy;
+
+    // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory, plz follow this practice
+    host_vector<T> hx(sizeX);
+    host_vector<T> hy(sizeY);
+
+    T cpu_result, host_result, device_result;
+
+    device_vector<T> dx(sizeX);
+    device_vector<T> dy(sizeY);
+    device_vector<T> d_result(1);
+
+    hipblasHandle_t handle;
+    hipblas_client_create(&handle);
+
+    // Initial Data on CPU
+    srand(1);
+    hipblas_init_alternating_sign<T>(hx, 1, N, incx);
+    hipblas_init<T>(hy, 1, N, incy);
+
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * sizeX, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy, hy.data(), sizeof(T) * sizeY, hipMemcpyHostToDevice));
+
+    /* =====================================================================
+         HIPBLAS
+    =================================================================== */
+    // both pointer modes, since the chunked path reduces on the host in either
+    auto dot = CONJ ? hipblasDotc_64<T> : hipblasDot_64<T>;
+
+    status_1 = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST);
+    if(status_1 == HIPBLAS_STATUS_SUCCESS)
+        status_1 = dot(handle, N, dx, incx, dy, incy, &host_result);
+
+    status_2 = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE);
+    if(status_2 == HIPBLAS_STATUS_SUCCESS)
+        status_2 = dot(handle, N, dx, incx, dy, incy, d_result);
+
+    if((status_1 != HIPBLAS_STATUS_SUCCESS) || (status_2 != HIPBLAS_STATUS_SUCCESS))
+    {
+        hipblas_client_destroy(handle);
+        return status_1 != HIPBLAS_STATUS_SUCCESS ? status_1 : status_2;
+    }
+
+    CHECK_HIP_ERROR(hipMemcpy(&device_result, d_result, sizeof(T), hipMemcpyDeviceToHost));
+
+    if(argus.unit_check)
+    {
+        (CONJ ? cblas_dotc<T> : cblas_dot<T>)(N, hx.data(), incx, hy.data(), incy, &cpu_result);
+
+        unit_check_general<T>(1, 1, 1, &cpu_result, &host_result);
+        unit_check_general<T>(1, 1, 1, &cpu_result, &device_result);
+    }
+
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
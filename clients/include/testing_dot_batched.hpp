@@ -49,7 +49,7 @@ hipblasStatus_t testing_dot_batched(Arguments argus)
     double rocblas_error;
 
     hipblasHandle_t handle;
-    hipblasCreate(&handle);
+    hipblas_client_create(&handle);
 
     // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory, plz follow this practice
     host_vector<T> hx_array[batch_count];
@@ -74,7 +74,7 @@ hipblasStatus_t testing_dot_batched(Arguments argus)
     if(!dx_array || !dy_array || !d_rocblas_result || (!bx_array[last] && sizeX)
        || (!by_array[last] && sizeY))
     {
-        hipblasDestroy(handle);
+        hipblas_client_destroy(handle);
         return HIPBLAS_STATUS_ALLOC_FAILED;
     }
 
@@ -133,7 +133,7 @@ hipblasStatus_t testing_dot_batched(Arguments argus)
     if((status_1 != HIPBLAS_STATUS_SUCCESS) || (status_2 != HIPBLAS_STATUS_SUCCESS)
        || (status_3 != HIPBLAS_STATUS_SUCCESS) || (status_4 != HIPBLAS_STATUS_SUCCESS))
     {
-        hipblasDestroy(handle);
+        hipblas_client_destroy(handle);
         if(status_1 != HIPBLAS_STATUS_SUCCESS)
             return status_1;
         if(status_2 != HIPBLAS_STATUS_SUCCESS)
@@ -153,11 +153,10 @@ hipblasStatus_t testing_dot_batched(Arguments argus)
         /* =====================================================================
                     CPU BLAS
         =================================================================== */
-        for(int b = 0; b < batch_count; b++)
-        {
+        hipblas_batch_for(batch_count, [&](int b) {
             (CONJ ? cblas_dotc<T>
                   : cblas_dot<T>)(N, hx_array[b], incx, hy_array[b], incy, &(h_cpu_result[b]));
-        }
+        });
 
         if(argus.unit_check)
         {
@@ -169,7 +168,7 @@ hipblasStatus_t testing_dot_batched(Arguments argus)
 
     //  BLAS_1_RESULT_PRINT
 
-    hipblasDestroy(handle);
+    hipblas_client_destroy(handle);
     return HIPBLAS_STATUS_SUCCESS;
 }
 
@@ -0,0 +1,92 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+#include "cblas_interface.h"
+#include "hipblas.hpp"
+#include "norm.h"
+#include "unit.h"
+#include "utility.h"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+// x, y and the result are stored as Tx; the products are accumulated in Tex
+template <typename Tx, typename Tex = Tx, bool CONJ = false>
+hipblasStatus_t testing_dot_ex(Arguments argus)
+{
+    int N    = argus.N;
+    int incx = argus.incx;
+    int incy = argus.incy;
+
+    hipblasDatatype_t x_type         = hipblas_datatype<Tx>;
+    hipblasDatatype_t execution_type = hipblas_datatype<Tex>;
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    if(N < 0 || incx < 0 || incy < 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+
+    int sizeX = N * incx;
+    int sizeY = N * incy;
+
+    // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory, plz follow this practice
+    host_vector<Tx> hx(sizeX);
+    host_vector<Tx> hy(sizeY);
+
+    device_vector<Tx> dx(sizeX);
+    device_vector<Tx> dy(sizeY);
+    device_vector<Tx> d_result(1);
+
+    Tx cpu_result, rocblas_result;
+
+    hipblasHandle_t handle;
+    hipblas_client_create(&handle);
+
+    // Initial Data on CPU
+    srand(1);
+    hipblas_init_alternating_sign<Tx>(hx, 1, N, incx);
+    hipblas_init<Tx>(hy, 1, N, incy);
+
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(Tx) * sizeX, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy, hy.data(), sizeof(Tx) * sizeY, hipMemcpyHostToDevice));
+
+    /* =====================================================================
+         ROCBLAS
+    =================================================================== */
+    status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = (CONJ ? hipblasDotcEx : hipblasDotEx)(
+            handle, N, dx, x_type, incx, dy, x_type, incy, d_result, x_type, execution_type);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    CHECK_HIP_ERROR(hipMemcpy(&rocblas_result, d_result, sizeof(Tx), hipMemcpyDeviceToHost));
+
+    if(argus.unit_check)
+    {
+        /* =====================================================================
+                    CPU BLAS
+        =================================================================== */
+        // the hipblasHalf reference also accumulates in float
+        (CONJ ? cblas_dotc<Tx> : cblas_dot<Tx>)(N, hx.data(), incx, hy.data(), incy, &cpu_result);
+
+        unit_check_general<Tx>(1, 1, 1, &cpu_result, &rocblas_result);
+    }
+
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -68,7 +68,7 @@ hipblasStatus_t testing_dot_strided_batched(Arguments argus)
     double rocblas_error;
 
     hipblasHandle_t handle;
-    hipblasCreate(&handle);
+    hipblas_client_create(&handle);
 
     // Initial Data on CPU
     srand(1);
@@ -121,7 +121,7 @@ hipblasStatus_t testing_dot_strided_batched(Arguments argus)
     if((status_1 != HIPBLAS_STATUS_SUCCESS) || (status_2 != HIPBLAS_STATUS_SUCCESS)
        || (status_3 != HIPBLAS_STATUS_SUCCESS) || (status_4 != HIPBLAS_STATUS_SUCCESS))
     {
-        hipblasDestroy(handle);
+        hipblas_client_destroy(handle);
         if(status_1 != HIPBLAS_STATUS_SUCCESS)
             return status_1;
         if(status_2 != HIPBLAS_STATUS_SUCCESS)
@@ -141,15 +141,14 @@ hipblasStatus_t testing_dot_strided_batched(Arguments argus)
         /* =====================================================================
                     CPU BLAS
         =================================================================== */
-        for(int b = 0; b < batch_count; b++)
-        {
+        hipblas_batch_for(batch_count, [&](int b) {
             (CONJ ? cblas_dotc<T> : cblas_dot<T>)(N,
                                                   hx.data() + b * stridex,
                                                   incx,
                                                   hy.data() + b * stridey,
                                                   incy,
                                                   &h_cpu_result[b]);
-        }
+        });
 
         if(argus.unit_check)
         {
@@ -161,7 +160,7 @@ hipblasStatus_t testing_dot_strided_batched(Arguments argus)
 
     //  BLAS_1_RESULT_PRINT
 
-    hipblasDestroy(handle);
+    hipblas_client_destroy(handle);
     return HIPBLAS_STATUS_SUCCESS;
 }
 
@@ -0,0 +1,119 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+#include "cblas_interface.h"
+#include "hipblas.hpp"
+#include "norm.h"
+#include "unit.h"
+#include "utility.h"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+// x, y and the results are stored as Tx; the products are accumulated in Tex
+template <typename Tx, typename Tex = Tx, bool CONJ = false>
+hipblasStatus_t testing_dot_strided_batched_ex(Arguments argus)
+{
+    int    N            = argus.N;
+    int    incx         = argus.incx;
+    int    incy         = argus.incy;
+    double stride_scale = argus.stride_scale;
+    int    batch_count  = argus.batch_count;
+
+    hipblasDatatype_t x_type         = hipblas_datatype<Tx>;
+    hipblasDatatype_t execution_type = hipblas_datatype<Tex>;
+
+    int stridex = N * incx * stride_scale;
+    int stridey = N * incy * stride_scale;
+    int sizeX   = stridex * batch_count;
+    int sizeY   = stridey * batch_count;
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    if(N < 0 || incx < 0 || incy < 0 || batch_count < 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    if(batch_count == 0)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory, plz follow this practice
+    host_vector<Tx> hx(sizeX);
+    host_vector<Tx> hy(sizeY);
+    host_vector<Tx> h_rocblas_result(batch_count);
+    host_vector<Tx> h_cpu_result(batch_count);
+
+    device_vector<Tx> dx(sizeX);
+    device_vector<Tx> dy(sizeY);
+    device_vector<Tx> d_result(batch_count);
+
+    hipblasHandle_t handle;
+    hipblas_client_create(&handle);
+
+    // Initial Data on CPU
+    srand(1);
+    hipblas_init_alternating_sign<Tx>(hx, 1, N, incx, stridex, batch_count);
+    hipblas_init<Tx>(hy, 1, N, incy, stridey, batch_count);
+
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(Tx) * sizeX, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy, hy.data(), sizeof(Tx) * sizeY, hipMemcpyHostToDevice));
+
+    /* =====================================================================
+         ROCBLAS
+    =================================================================== */
+    status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = (CONJ ? hipblasDotcStridedBatchedEx : hipblasDotStridedBatchedEx)(handle,
+                                                                                   N,
+                                                                                   dx,
+                                                                                   x_type,
+                                                                                   incx,
+                                                                                   stridex,
+                                                                                   dy,
+                                                                                   x_type,
+                                                                                   incy,
+                                                                                   stridey,
+                                                                                   batch_count,
+                                                                                   d_result,
+                                                                                   x_type,
+                                                                                   execution_type);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    CHECK_HIP_ERROR(hipMemcpy(
+        h_rocblas_result.data(), d_result, sizeof(Tx) * batch_count, hipMemcpyDeviceToHost));
+
+    if(argus.unit_check)
+    {
+        /* =====================================================================
+                    CPU BLAS
+        =================================================================== */
+        hipblas_batch_for(batch_count, [&](int b) {
+            (CONJ ? cblas_dotc<Tx> : cblas_dot<Tx>)(N,
+                                                    hx.data() + b * stridex,
+                                                    incx,
+                                                    hy.data() + b * stridey,
+                                                    incy,
+                                                    h_cpu_result.data() + b);
+        });
+
+        unit_check_general<Tx>(1, batch_count, 1, h_cpu_result.data(), h_rocblas_result.data());
+    }
+
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
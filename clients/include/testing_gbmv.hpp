@@ -76,7 +76,7 @@ hipblasStatus_t testing_gbmv(Arguments argus)
     T beta  = (T)argus.beta;
 
     hipblasHandle_t handle;
-    hipblasCreate(&handle);
+    hipblas_client_create(&handle);
 
     // Initial Data on CPU
     srand(1);
@@ -103,7 +103,7 @@ hipblasStatus_t testing_gbmv(Arguments argus)
 
         if(status != HIPBLAS_STATUS_SUCCESS)
         {
-            hipblasDestroy(handle);
+            hipblas_client_destroy(handle);
             return status;
         }
     }
@@ -128,6 +128,6 @@ hipblasStatus_t testing_gbmv(Arguments argus)
         }
     }
 
-    hipblasDestroy(handle);
+    hipblas_client_destroy(handle);
     return HIPBLAS_STATUS_SUCCESS;
 }
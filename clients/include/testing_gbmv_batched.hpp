@@ -70,7 +70,7 @@ hipblasStatus_t testing_gbmvBatched(Arguments argus)
     }
 
     hipblasHandle_t handle;
-    hipblasCreate(&handle);
+    hipblas_client_create(&handle);
 
     double gpu_time_used, cpu_time_used;
     double hipblasGflops, cblas_gflops, hipblasBandwidth;
@@ -99,7 +99,7 @@ hipblasStatus_t testing_gbmvBatched(Arguments argus)
     if(!dA_array || !dx_array || !dy_array || (!bA_array[last] && A_size)
        || (!bx_array[last] && X_size) || (!by_array[last] && Y_size))
     {
-        hipblasDestroy(handle);
+        hipblas_client_destroy(handle);
         return HIPBLAS_STATUS_ALLOC_FAILED;
     }
 
@@ -126,7 +126,7 @@ hipblasStatus_t testing_gbmvBatched(Arguments argus)
 
         if(err_A != hipSuccess || err_x != hipSuccess || err_y != hipSuccess)
         {
-            hipblasDestroy(handle);
+            hipblas_client_destroy(handle);
             return HIPBLAS_STATUS_MAPPING_ERROR;
         }
     }
@@ -136,7 +136,7 @@ hipblasStatus_t testing_gbmvBatched(Arguments argus)
     err_y = hipMemcpy(dy_array, by_array, batch_count * sizeof(T*), hipMemcpyHostToDevice);
     if(err_A != hipSuccess || err_x != hipSuccess || err_y != hipSuccess)
     {
-        hipblasDestroy(handle);
+        hipblas_client_destroy(handle);
         return HIPBLAS_STATUS_MAPPING_ERROR;
     }
 
@@ -164,7 +164,7 @@ hipblasStatus_t testing_gbmvBatched(Arguments argus)
         if(status != HIPBLAS_STATUS_SUCCESS)
         {
             // here in cuda
-            hipblasDestroy(handle);
+            hipblas_client_destroy(handle);
             return status;
         }
     }
@@ -181,8 +181,7 @@ hipblasStatus_t testing_gbmvBatched(Arguments argus)
            CPU BLAS
         =================================================================== */
 
-        for(int b = 0; b < batch_count; b++)
-        {
+        hipblas_batch_for(batch_count, [&](int b) {
             cblas_gbmv<T>(transA,
                           M,
                           N,
@@ -196,7 +195,7 @@ hipblasStatus_t testing_gbmvBatched(Arguments argus)
                           beta,
                           hz_array[b],
                           incy);
-        }
+        });
 
         // enable unit check, notice unit check is not invasive, but norm check is,
         // unit check and norm check can not be interchanged their order
@@ -206,6 +205,6 @@ hipblasStatus_t testing_gbmvBatched(Arguments argus)
         }
     }
 
-    hipblasDestroy(handle);
+    hipblas_client_destroy(handle);
     return HIPBLAS_STATUS_SUCCESS;
 }
@@ -89,7 +89,7 @@ hipblasStatus_t testing_gbmvStridedBatched(Arguments argus)
     T beta  = (T)argus.beta;
 
     hipblasHandle_t handle;
-    hipblasCreate(&handle);
+    hipblas_client_create(&handle);
 
     // Initial Data on CPU
     srand(1);
@@ -132,7 +132,7 @@ hipblasStatus_t testing_gbmvStridedBatched(Arguments argus)
         if(status != HIPBLAS_STATUS_SUCCESS)
         {
             // here in cuda
-            hipblasDestroy(handle);
+            hipblas_client_destroy(handle);
             return status;
         }
     }
@@ -146,8 +146,7 @@ hipblasStatus_t testing_gbmvStridedBatched(Arguments argus)
            CPU BLAS
         =================================================================== */
 
-        for(int b = 0; b < batch_count; b++)
-        {
+        hipblas_batch_for(batch_count, [&](int b) {
             cblas_gbmv<T>(transA,
                           M,
                           N,
@@ -161,7 +160,7 @@ hipblasStatus_t testing_gbmvStridedBatched(Arguments argus)
                           beta,
                           hz.data() + b * stride_y,
                           incy);
-        }
+        });
 
         // enable unit check, notice unit check is not invasive, but norm check is,
         // unit check and norm check can not be interchanged their order
@@ -171,6 +170,6 @@ hipblasStatus_t testing_gbmvStridedBatched(Arguments argus)
         }
     }
 
-    hipblasDestroy(handle);
+    hipblas_client_destroy(handle);
     return HIPBLAS_STATUS_SUCCESS;
 }
@@ -0,0 +1,109 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "hipblas.hpp"
+#include "unit.h"
+#include "utility.h"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+template <typename T>
+hipblasStatus_t testing_ge2gb(Arguments argus)
+{
+    int M    = argus.M;
+    int N    = argus.N;
+    int KL   = argus.KL;
+    int KU   = argus.KU;
+    int lda  = argus.lda;
+    int ldab = argus.ldb;
+
+    int A_size  = lda * N;
+    int AB_size = ldab * N;
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    if(M < 0 || N < 0 || KL < 0 || KU < 0 || lda < max(1, M) || ldab < KL + KU + 1)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    if(M == 0 || N == 0)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA(A_size);
+    host_vector<T> hB(A_size);
+    host_vector<T> hB_gold(A_size);
+    host_vector<T> hAB(AB_size);
+    host_vector<T> hAB_gold(AB_size);
+
+    device_vector<T> dA(A_size);
+    device_vector<T> dB(A_size);
+    device_vector<T> dAB(AB_size);
+
+    hipblasHandle_t handle;
+    hipblas_client_create(&handle);
+
+    // Initial Data on CPU. The band goes back into hB, which is zero outside it; the corners of
+    // hAB outside the matrix must stay as they were
+    srand(1);
+    hipblas_init<T>(hA, M, N, lda);
+    hipblas_init<T>(hAB, ldab, N, ldab);
+    hAB_gold = hAB;
+
+    for(int j = 0; j < N; j++)
+    {
+        for(int i = 0; i < M; i++)
+        {
+            if(i - j <= KL && j - i <= KU)
+            {
+                hAB_gold[KU + i - j + j * ldab] = hA[i + j * lda];
+                hB_gold[i + j * lda]            = hA[i + j * lda];
+            }
+            else
+                hB_gold[i + j * lda] = T(0);
+        }
+    }
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * A_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dAB, hAB.data(), sizeof(T) * AB_size, hipMemcpyHostToDevice));
+
+    /* =====================================================================
+           HIPBLAS
+    =================================================================== */
+
+    status = hipblasGe2gb<T>(handle, M, N, KL, KU, dA, lda, dAB, ldab);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasGb2ge<T>(handle, M, N, KL, KU, dAB, ldab, dB, lda);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    // copy output from device to CPU
+    CHECK_HIP_ERROR(hipMemcpy(hAB.data(), dAB, sizeof(T) * AB_size, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hB.data(), dB, sizeof(T) * A_size, hipMemcpyDeviceToHost));
+
+    if(argus.unit_check)
+    {
+        unit_check_general<T>(ldab, N, ldab, hAB_gold.data(), hAB.data());
+        unit_check_general<T>(M, N, lda, hB_gold.data(), hB.data());
+    }
+
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
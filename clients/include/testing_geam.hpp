@@ -33,8 +33,8 @@ hipblasStatus_t testing_geam(Arguments argus)
     hipblasOperation_t transA = char2hipblas_operation(argus.transA_option);
     hipblasOperation_t transB = char2hipblas_operation(argus.transB_option);
 
-    T h_alpha = argus.alpha;
-    T h_beta  = argus.beta;
+    T h_alpha = argus.get_alpha<T>();
+    T h_beta  = argus.get_beta<T>();
 
     int A_size, B_size, C_size, A_row, A_col, B_row, B_col;
     int inc1_A, inc2_A, inc1_B, inc2_B;
@@ -44,7 +44,7 @@ hipblasStatus_t testing_geam(Arguments argus)
     hipblasHandle_t handle;
     hipblasStatus_t status1 = HIPBLAS_STATUS_SUCCESS;
     hipblasStatus_t status2 = HIPBLAS_STATUS_SUCCESS;
-    hipblasCreate(&handle);
+    hipblas_client_create(&handle);
 
     if(transA == HIPBLAS_OP_N)
     {
@@ -82,7 +82,7 @@ hipblasStatus_t testing_geam(Arguments argus)
     // check here to prevent undefined memory allocation error
     if(M <= 0 || N <= 0 || lda < A_row || ldb < B_row || ldc < M)
     {
-        hipblasDestroy(handle);
+        hipblas_client_destroy(handle);
         return HIPBLAS_STATUS_INVALID_VALUE;
     }
 
@@ -104,7 +104,7 @@ hipblasStatus_t testing_geam(Arguments argus)
     T* d_beta  = (T*)d_beta_managed.get();
     if(!dA || !dB || !dC || !d_alpha || !d_beta)
     {
-        hipblasDestroy(handle);
+        hipblas_client_destroy(handle);
         return HIPBLAS_STATUS_ALLOC_FAILED;
     }
 
@@ -140,7 +140,7 @@ hipblasStatus_t testing_geam(Arguments argus)
 
         if(status1 != HIPBLAS_STATUS_SUCCESS)
         {
-            hipblasDestroy(handle);
+            hipblas_client_destroy(handle);
             return status1;
         }
 
@@ -149,7 +149,7 @@ hipblasStatus_t testing_geam(Arguments argus)
 
         if(status2 != HIPBLAS_STATUS_SUCCESS)
         {
-            hipblasDestroy(handle);
+            hipblas_client_destroy(handle);
             return status2;
         }
 
@@ -161,7 +161,7 @@ hipblasStatus_t testing_geam(Arguments argus)
 
         if(status1 != HIPBLAS_STATUS_SUCCESS)
         {
-            hipblasDestroy(handle);
+            hipblas_client_destroy(handle);
             return status1;
         }
 
@@ -172,7 +172,7 @@ hipblasStatus_t testing_geam(Arguments argus)
 
         if(status2 != HIPBLAS_STATUS_SUCCESS)
         {
-            hipblasDestroy(handle);
+            hipblas_client_destroy(handle);
             return status2;
         }
 
@@ -189,8 +189,15 @@ hipblasStatus_t testing_geam(Arguments argus)
         {
             for(int i2 = 0; i2 < N; i2++)
             {
-                hC_copy[i1 + i2 * ldc] = h_alpha * hA[i1 * inc1_A + i2 * inc2_A]
-                                         + h_beta * hB[i1 * inc1_B + i2 * inc2_B];
+                T a = hA[i1 * inc1_A + i2 * inc2_A];
+                T b = hB[i1 * inc1_B + i2 * inc2_B];
+                if(transA == HIPBLAS_OP_C)
+                    a = hipblas_conjugate(a);
+                if(transB == HIPBLAS_OP_C)
+                    b = hipblas_conjugate(b);
+
+                hC_copy[i1 + i2 * ldc] = h_alpha * a;
+                hC_copy[i1 + i2 * ldc] += h_beta * b;
             }
         }
     }
@@ -207,6 +214,6 @@ hipblasStatus_t testing_geam(Arguments argus)
         unit_check_general<T>(M, N, ldc, hC_copy.data(), hC2.data());
     }
 
-    hipblasDestroy(handle);
+    hipblas_client_destroy(handle);
     return HIPBLAS_STATUS_SUCCESS;
 }
@@ -0,0 +1,187 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "flops.h"
+#include "hipblas.hpp"
+#include "norm.h"
+#include "unit.h"
+#include "utility.h"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+template <typename T>
+hipblasStatus_t testing_geam_batched(Arguments argus)
+{
+    int M           = argus.M;
+    int N           = argus.N;
+    int lda         = argus.lda;
+    int ldb         = argus.ldb;
+    int ldc         = argus.ldc;
+    int batch_count = argus.batch_count;
+
+    hipblasOperation_t transA = char2hipblas_operation(argus.transA_option);
+    hipblasOperation_t transB = char2hipblas_operation(argus.transB_option);
+
+    T alpha = argus.get_alpha<T>();
+    T beta  = argus.get_beta<T>();
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+
+    // op(A) and op(B) are M x N
+    int A_row = (transA == HIPBLAS_OP_N ? M : N);
+    int A_col = (transA == HIPBLAS_OP_N ? N : M);
+    int B_row = (transB == HIPBLAS_OP_N ? M : N);
+    int B_col = (transB == HIPBLAS_OP_N ? N : M);
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    if(M < 0 || N < 0 || lda < A_row || ldb < B_row || ldc < M || batch_count < 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    else if(batch_count == 0)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    hipblasHandle_t handle;
+    hipblas_client_create(&handle);
+
+    int A_size = lda * A_col;
+    int B_size = ldb * B_col;
+    int C_size = ldc * N;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA[batch_count];
+    host_vector<T> hB[batch_count];
+    host_vector<T> hC[batch_count];
+    host_vector<T> hC2[batch_count];
+
+    device_batch_vector<T> bA(batch_count, A_size);
+    device_batch_vector<T> bB(batch_count, B_size);
+    device_batch_vector<T> bC(batch_count, C_size);
+
+    device_vector<T*, 0, T> dA(batch_count);
+    device_vector<T*, 0, T> dB(batch_count);
+    device_vector<T*, 0, T> dC(batch_count);
+
+    int last = batch_count - 1;
+    if(!dA || !dB || !dC || (!bA[last] && A_size) || (!bB[last] && B_size)
+       || (!bC[last] && C_size))
+    {
+        hipblas_client_destroy(handle);
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+    }
+
+    // Initial Data on CPU
+    srand(1);
+    for(int b = 0; b < batch_count; b++)
+    {
+        hA[b]  = host_vector<T>(A_size);
+        hB[b]  = host_vector<T>(B_size);
+        hC[b]  = host_vector<T>(C_size);
+        hC2[b] = host_vector<T>(C_size);
+
+        hipblas_init<T>(hA[b], A_row, A_col, lda);
+        hipblas_init<T>(hB[b], B_row, B_col, ldb);
+        hipblas_init<T>(hC[b], M, N, ldc);
+
+        CHECK_HIP_ERROR(hipMemcpy(bA[b], hA[b], sizeof(T) * A_size, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(bB[b], hB[b], sizeof(T) * B_size, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(bC[b], hC[b], sizeof(T) * C_size, hipMemcpyHostToDevice));
+    }
+    CHECK_HIP_ERROR(hipMemcpy(dA, bA, sizeof(T*) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, bB, sizeof(T*) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC, bC, sizeof(T*) * batch_count, hipMemcpyHostToDevice));
+
+    /* =====================================================================
+           ROCBLAS
+    =================================================================== */
+    status = hipblasGeamBatched<T>(
+        handle, transA, transB, M, N, &alpha, dA, lda, &beta, dB, ldb, dC, ldc, batch_count);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    // copy output from device to CPU
+    for(int b = 0; b < batch_count; b++)
+    {
+        hipMemcpy(hC2[b], bC[b], sizeof(T) * C_size, hipMemcpyDeviceToHost);
+    }
+
+    if(argus.unit_check)
+    {
+        /* =====================================================================
+           CPU BLAS
+        =================================================================== */
+        for(int b = 0; b < batch_count; b++)
+        {
+            for(int j = 0; j < N; j++)
+            {
+                for(int i = 0; i < M; i++)
+                {
+                    T a = transA == HIPBLAS_OP_N ? hA[b][i + j * lda] : hA[b][j + i * lda];
+                    T c = transB == HIPBLAS_OP_N ? hB[b][i + j * ldb] : hB[b][j + i * ldb];
+                    if(transA == HIPBLAS_OP_C)
+                        a = hipblas_conjugate(a);
+                    if(transB == HIPBLAS_OP_C)
+                        c = hipblas_conjugate(c);
+
+                    hC[b][i + j * ldc] = alpha * a;
+                    hC[b][i + j * ldc] += beta * c;
+                }
+            }
+        }
+
+        unit_check_general<T>(M, N, batch_count, ldc, hC2, hC);
+    }
+
+    if(argus.timing)
+    {
+        hipblas_timing timing;
+        status = hipblas_time_launches(handle, argus, timing, [&] {
+            return hipblasGeamBatched<T>(handle,
+                                         transA,
+                                         transB,
+                                         M,
+                                         N,
+                                         &alpha,
+                                         dA,
+                                         lda,
+                                         &beta,
+                                         dB,
+                                         ldb,
+                                         dC,
+                                         ldc,
+                                         batch_count);
+        });
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            hipblas_client_destroy(handle);
+            return status;
+        }
+
+        double gflop = geam_gflop_count<T>(M, N) * batch_count;
+        double gbyte = geam_gbyte_count<T>(M, N) * batch_count;
+
+        cout << "M,N,lda,ldb,ldc,batch_count,transA,transB," HIPBLAS_TIMING_COLUMNS << endl;
+        cout << M << ',' << N << ',' << lda << ',' << ldb << ',' << ldc << ',' << batch_count
+             << ',' << argus.transA_option << ',' << argus.transB_option << ',';
+        hipblas_print_timing(cout, timing, gflop, gbyte);
+    }
+
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,187 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <cmath>
+#include <stdlib.h>
+#include <vector>
+
+#include "hipblas.hpp"
+#include "near.h"
+#include "unit.h"
+#include "utility.h"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+// hipblasGeamStridedBatchedEx from float A and B to a half C, computed in float, then the half C
+// transposed back to float by hipblasTransposeStridedBatchedEx and copied to float as vectors
+// spanning each batch's columns by hipblasCopyStridedBatchedEx. Those two only convert, so they
+// are checked exactly against the half C
+hipblasStatus_t testing_geam_ex_strided_batched(Arguments argus)
+{
+    int    M            = argus.M;
+    int    N            = argus.N;
+    int    lda          = argus.lda;
+    int    ldb          = argus.ldb;
+    int    ldc          = argus.ldc;
+    double stride_scale = argus.stride_scale;
+    int    batch_count  = argus.batch_count;
+
+    hipblasOperation_t transA = char2hipblas_operation(argus.transA_option);
+    hipblasOperation_t transB = char2hipblas_operation(argus.transB_option);
+
+    // op(A) and op(B) are M x N; D = C^T is N x M with leading dimension N
+    int A_row    = (transA == HIPBLAS_OP_N ? M : N);
+    int A_col    = (transA == HIPBLAS_OP_N ? N : M);
+    int B_row    = (transB == HIPBLAS_OP_N ? M : N);
+    int B_col    = (transB == HIPBLAS_OP_N ? N : M);
+    int stride_A = lda * A_col * stride_scale;
+    int stride_B = ldb * B_col * stride_scale;
+    int stride_C = ldc * N * stride_scale;
+    int stride_D = N * M;
+    int A_size   = stride_A * batch_count;
+    int B_size   = stride_B * batch_count;
+    int C_size   = stride_C * batch_count;
+    int D_size   = stride_D * batch_count;
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    if(M < 0 || N < 0 || lda < A_row || ldb < B_row || ldc < M || batch_count < 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    else if(batch_count == 0)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<float>       hA(A_size);
+    host_vector<float>       hB(B_size);
+    host_vector<hipblasHalf> hC(C_size);
+    host_vector<float>       hC_gold(C_size);
+    host_vector<float>       hC_float(C_size);
+    host_vector<float>       hD(D_size);
+    host_vector<float>       hD_gold(D_size);
+    host_vector<float>       hE(C_size);
+
+    device_vector<float>       dA(A_size);
+    device_vector<float>       dB(B_size);
+    device_vector<hipblasHalf> dC(C_size);
+    device_vector<float>       dD(D_size);
+    device_vector<float>       dE(C_size);
+
+    float alpha = argus.get_alpha<float>();
+    float beta  = argus.get_beta<float>();
+
+    hipblasHandle_t handle;
+    hipblas_client_create(&handle);
+
+    // Initial Data on CPU
+    srand(1);
+    hipblas_init<float>(hA, A_row, A_col, lda, stride_A, batch_count);
+    hipblas_init<float>(hB, B_row, B_col, ldb, stride_B, batch_count);
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(float) * A_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB.data(), sizeof(float) * B_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemset(dC, 0, sizeof(hipblasHalf) * C_size));
+
+    /* =====================================================================
+           HIPBLAS
+    =================================================================== */
+    status = hipblasGeamStridedBatchedEx(handle,
+                                         transA,
+                                         transB,
+                                         M,
+                                         N,
+                                         &alpha,
+                                         dA,
+                                         HIPBLAS_R_32F,
+                                         lda,
+                                         stride_A,
+                                         &beta,
+                                         dB,
+                                         HIPBLAS_R_32F,
+                                         ldb,
+                                         stride_B,
+                                         dC,
+                                         HIPBLAS_R_16F,
+                                         ldc,
+                                         stride_C,
+                                         batch_count,
+                                         HIPBLAS_R_32F);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasTransposeStridedBatchedEx(handle,
+                                                  HIPBLAS_OP_T,
+                                                  N,
+                                                  M,
+                                                  dC,
+                                                  HIPBLAS_R_16F,
+                                                  ldc,
+                                                  stride_C,
+                                                  dD,
+                                                  HIPBLAS_R_32F,
+                                                  max(N, 1),
+                                                  stride_D,
+                                                  batch_count);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasCopyStridedBatchedEx(handle,
+                                             stride_C,
+                                             dC,
+                                             HIPBLAS_R_16F,
+                                             1,
+                                             stride_C,
+                                             dE,
+                                             HIPBLAS_R_32F,
+                                             1,
+                                             stride_C,
+                                             batch_count);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    CHECK_HIP_ERROR(hipMemcpy(hC.data(), dC, sizeof(hipblasHalf) * C_size, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hD.data(), dD, sizeof(float) * D_size, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hE.data(), dE, sizeof(float) * C_size, hipMemcpyDeviceToHost));
+
+    if(argus.unit_check)
+    {
+        // The float results before their rounding to half, which allows half an ulp of the
+        // largest
+        float largest = 0;
+        for(int b = 0; b < batch_count; b++)
+            for(int j = 0; j < N; j++)
+                for(int i = 0; i < M; i++)
+                {
+                    float a = transA == HIPBLAS_OP_N ? hA[b * stride_A + i + j * lda]
+                                                     : hA[b * stride_A + j + i * lda];
+                    float c = transB == HIPBLAS_OP_N ? hB[b * stride_B + i + j * ldb]
+                                                     : hB[b * stride_B + j + i * ldb];
+                    float v = alpha * a + beta * c;
+                    hC_gold[b * stride_C + i + j * ldc] = v;
+                    largest                             = max(largest, std::abs(v));
+                }
+
+        for(int e = 0; e < C_size; e++)
+            hC_float[e] = half_to_float(hC[e]);
+        near_check_general<float>(
+            M, N, batch_count, ldc, stride_C, hC_gold, hC_float, largest / 1024);
+
+        for(int b = 0; b < batch_count; b++)
+            for(int j = 0; j < N; j++)
+                for(int i = 0; i < M; i++)
+                    hD_gold[b * stride_D + j + i * N] = hC_float[b * stride_C + i + j * ldc];
+        unit_check_general<float>(N, M, batch_count, N, stride_D, hD_gold, hD);
+        unit_check_general<float>(1, C_size, 1, hC_float, hE);
+    }
+
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
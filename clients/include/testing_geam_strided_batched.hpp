@@ -0,0 +1,189 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "flops.h"
+#include "hipblas.hpp"
+#include "norm.h"
+#include "unit.h"
+#include "utility.h"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+template <typename T>
+hipblasStatus_t testing_geam_strided_batched(Arguments argus)
+{
+    int    M            = argus.M;
+    int    N            = argus.N;
+    int    lda          = argus.lda;
+    int    ldb          = argus.ldb;
+    int    ldc          = argus.ldc;
+    double stride_scale = argus.stride_scale;
+    int    batch_count  = argus.batch_count;
+
+    hipblasOperation_t transA = char2hipblas_operation(argus.transA_option);
+    hipblasOperation_t transB = char2hipblas_operation(argus.transB_option);
+
+    // op(A) and op(B) are M x N
+    int A_row    = (transA == HIPBLAS_OP_N ? M : N);
+    int A_col    = (transA == HIPBLAS_OP_N ? N : M);
+    int B_row    = (transB == HIPBLAS_OP_N ? M : N);
+    int B_col    = (transB == HIPBLAS_OP_N ? N : M);
+    int stride_A = lda * A_col * stride_scale;
+    int stride_B = ldb * B_col * stride_scale;
+    int stride_C = ldc * N * stride_scale;
+    int A_size   = stride_A * batch_count;
+    int B_size   = stride_B * batch_count;
+    int C_size   = stride_C * batch_count;
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    if(M < 0 || N < 0 || lda < A_row || ldb < B_row || ldc < M || batch_count < 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    else if(batch_count == 0)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA(A_size);
+    host_vector<T> hB(B_size);
+    host_vector<T> hC(C_size);
+    host_vector<T> hC2(C_size);
+
+    device_vector<T> dA(A_size);
+    device_vector<T> dB(B_size);
+    device_vector<T> dC(C_size);
+
+    T alpha = argus.get_alpha<T>();
+    T beta  = argus.get_beta<T>();
+
+    hipblasHandle_t handle;
+    hipblas_client_create(&handle);
+
+    // Initial Data on CPU
+    srand(1);
+    hipblas_init<T>(hA, A_row, A_col, lda, stride_A, batch_count);
+    hipblas_init<T>(hB, B_row, B_col, ldb, stride_B, batch_count);
+    hipblas_init<T>(hC, M, N, ldc, stride_C, batch_count);
+
+    // copy data from CPU to device
+    hipMemcpy(dA, hA.data(), sizeof(T) * A_size, hipMemcpyHostToDevice);
+    hipMemcpy(dB, hB.data(), sizeof(T) * B_size, hipMemcpyHostToDevice);
+    hipMemcpy(dC, hC.data(), sizeof(T) * C_size, hipMemcpyHostToDevice);
+
+    /* =====================================================================
+           ROCBLAS
+    =================================================================== */
+    status = hipblasGeamStridedBatched<T>(handle,
+                                          transA,
+                                          transB,
+                                          M,
+                                          N,
+                                          &alpha,
+                                          dA,
+                                          lda,
+                                          stride_A,
+                                          &beta,
+                                          dB,
+                                          ldb,
+                                          stride_B,
+                                          dC,
+                                          ldc,
+                                          stride_C,
+                                          batch_count);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    // copy output from device to CPU
+    hipMemcpy(hC2.data(), dC, sizeof(T) * C_size, hipMemcpyDeviceToHost);
+
+    if(argus.unit_check)
+    {
+        /* =====================================================================
+           CPU BLAS
+        =================================================================== */
+        for(int b = 0; b < batch_count; b++)
+        {
+            T* hAb = hA.data() + b * stride_A;
+            T* hBb = hB.data() + b * stride_B;
+            T* hCb = hC.data() + b * stride_C;
+
+            for(int j = 0; j < N; j++)
+            {
+                for(int i = 0; i < M; i++)
+                {
+                    T a = transA == HIPBLAS_OP_N ? hAb[i + j * lda] : hAb[j + i * lda];
+                    T c = transB == HIPBLAS_OP_N ? hBb[i + j * ldb] : hBb[j + i * ldb];
+                    if(transA == HIPBLAS_OP_C)
+                        a = hipblas_conjugate(a);
+                    if(transB == HIPBLAS_OP_C)
+                        c = hipblas_conjugate(c);
+
+                    hCb[i + j * ldc] = alpha * a;
+                    hCb[i + j * ldc] += beta * c;
+                }
+            }
+        }
+
+        unit_check_general<T>(M, N, batch_count, ldc, stride_C, hC2.data(), hC.data());
+    }
+
+    if(argus.timing)
+    {
+        hipblas_timing timing;
+        status = hipblas_time_launches(handle, argus, timing, [&] {
+            return hipblasGeamStridedBatched<T>(handle,
+                                                transA,
+                                                transB,
+                                                M,
+                                                N,
+                                                &alpha,
+                                                dA,
+                                                lda,
+                                                stride_A,
+                                                &beta,
+                                                dB,
+                                                ldb,
+                                                stride_B,
+                                                dC,
+                                                ldc,
+                                                stride_C,
+                                                batch_count);
+        });
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            hipblas_client_destroy(handle);
+            return status;
+        }
+
+        double gflop = geam_gflop_count<T>(M, N) * batch_count;
+        double gbyte = geam_gbyte_count<T>(M, N) * batch_count;
+
+        cout << "M,N,lda,ldb,ldc,stride_scale,batch_count,transA,transB," HIPBLAS_TIMING_COLUMNS
+             << endl;
+        cout << M << ',' << N << ',' << lda << ',' << ldb << ',' << ldc << ',' << stride_scale
+             << ',' << batch_count << ',' << argus.transA_option << ',' << argus.transB_option
+             << ',';
+        hipblas_print_timing(cout, timing, gflop, gbyte);
+    }
+
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,133 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "cblas_interface.h"
+#include "flops.h"
+#include "hipblas.hpp"
+#include "norm.h"
+#include "unit.h"
+#include "utility.h"
+
+using namespace std;
+
+template <typename T>
+hipblasStatus_t testing_gels_batched(Arguments argus)
+{
+    int M           = argus.M;
+    int N           = argus.N;
+    int lda         = argus.lda;
+    int ldb         = argus.ldb;
+    int batch_count = argus.batch_count;
+    int nrhs        = 2;
+
+    int A_size = lda * N;
+    int B_size = ldb * nrhs;
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+
+    // Check to prevent memory allocation error
+    if(M < 0 || N < 0 || lda < M || ldb < max(M, N) || batch_count < 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    if(batch_count == 0)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T>   hA[batch_count];
+    host_vector<T>   hX[batch_count];
+    host_vector<T>   hB[batch_count];
+    host_vector<int> hInfo(batch_count);
+    int              info;
+
+    device_batch_vector<T> bA(batch_count, A_size);
+    device_batch_vector<T> bB(batch_count, B_size);
+
+    device_vector<T*, 0, T> dA(batch_count);
+    device_vector<T*, 0, T> dB(batch_count);
+    device_vector<int>      dInfo(batch_count);
+
+    hipblasHandle_t handle;
+    hipblas_client_create(&handle);
+
+    // Initial hA, hX on CPU, with hB = hA * hX, so the least squares solution is hX
+    srand(1);
+    hipblasOperation_t op = HIPBLAS_OP_N;
+    for(int b = 0; b < batch_count; b++)
+    {
+        hA[b] = host_vector<T>(A_size);
+        hX[b] = host_vector<T>(B_size);
+        hB[b] = host_vector<T>(B_size);
+
+        hipblas_init<T>(hA[b], M, N, lda);
+        hipblas_init<T>(hX[b], N, nrhs, ldb);
+
+        // Put hA entries into range [0, 1], make the leading N by N block diagonally dominant
+        for(int i = 0; i < M; i++)
+        {
+            for(int j = 0; j < N; j++)
+            {
+                hA[b][i + j * lda] = (hA[b][i + j * lda] - 1.0) / 10.0;
+
+                if(i == j)
+                    hA[b][i + j * lda] *= 100;
+            }
+        }
+
+        cblas_gemm<T>(
+            op, op, M, nrhs, N, 1, hA[b].data(), lda, hX[b].data(), ldb, 0, hB[b].data(), ldb);
+
+        CHECK_HIP_ERROR(hipMemcpy(bA[b], hA[b].data(), A_size * sizeof(T), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(bB[b], hB[b].data(), B_size * sizeof(T), hipMemcpyHostToDevice));
+    }
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, bA, batch_count * sizeof(T*), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, bB, batch_count * sizeof(T*), hipMemcpyHostToDevice));
+
+    /* =====================================================================
+           HIPBLAS
+    =================================================================== */
+
+    status = hipblasGelsBatched<T>(
+        handle, op, M, N, nrhs, dA, lda, dB, ldb, &info, dInfo, batch_count);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    // copy output from device to CPU
+    for(int b = 0; b < batch_count; b++)
+        CHECK_HIP_ERROR(hipMemcpy(hB[b].data(), bB[b], B_size * sizeof(T), hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(
+        hipMemcpy(hInfo.data(), dInfo, batch_count * sizeof(int), hipMemcpyDeviceToHost));
+
+    if(argus.unit_check)
+    {
+        // The first N rows of B now hold hX
+        T      eps       = std::numeric_limits<T>::epsilon();
+        double tolerance = max(M, N) * eps * 100;
+
+        EXPECT_EQ(0, info);
+        for(int b = 0; b < batch_count; b++)
+        {
+            EXPECT_EQ(0, hInfo[b]);
+
+            double e = norm_check_general<T>('M', N, nrhs, ldb, hX[b].data(), hB[b].data());
+            unit_check_error(e, tolerance);
+        }
+    }
+
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,129 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "cblas_interface.h"
+#include "flops.h"
+#include "hipblas.hpp"
+#include "norm.h"
+#include "unit.h"
+#include "utility.h"
+
+using namespace std;
+
+template <typename T>
+hipblasStatus_t testing_gels_strided_batched(Arguments argus)
+{
+    int    M            = argus.M;
+    int    N            = argus.N;
+    int    lda          = argus.lda;
+    int    ldb          = argus.ldb;
+    int    batch_count  = argus.batch_count;
+    double stride_scale = argus.stride_scale;
+    int    nrhs         = 2;
+
+    int strideA = lda * N * stride_scale;
+    int strideB = ldb * nrhs * stride_scale;
+    int A_size  = strideA * batch_count;
+    int B_size  = strideB * batch_count;
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+
+    // Check to prevent memory allocation error
+    if(M < 0 || N < 0 || lda < M || ldb < max(M, N) || batch_count < 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    if(batch_count == 0)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T>   hA(A_size);
+    host_vector<T>   hX(B_size);
+    host_vector<T>   hB(B_size);
+    host_vector<int> hInfo(batch_count);
+    int              info;
+
+    device_vector<T>   dA(A_size);
+    device_vector<T>   dB(B_size);
+    device_vector<int> dInfo(batch_count);
+
+    hipblasHandle_t handle;
+    hipblas_client_create(&handle);
+
+    // Initial hA, hX on CPU, with hB = hA * hX, so the least squares solution is hX
+    srand(1);
+    hipblasOperation_t op = HIPBLAS_OP_N;
+    for(int b = 0; b < batch_count; b++)
+    {
+        T* hAb = hA.data() + b * strideA;
+        T* hXb = hX.data() + b * strideB;
+        T* hBb = hB.data() + b * strideB;
+
+        hipblas_init<T>(hAb, M, N, lda);
+        hipblas_init<T>(hXb, N, nrhs, ldb);
+
+        // Put hA entries into range [0, 1], make the leading N by N block diagonally dominant
+        for(int i = 0; i < M; i++)
+        {
+            for(int j = 0; j < N; j++)
+            {
+                hAb[i + j * lda] = (hAb[i + j * lda] - 1.0) / 10.0;
+
+                if(i == j)
+                    hAb[i + j * lda] *= 100;
+            }
+        }
+
+        cblas_gemm<T>(op, op, M, nrhs, N, 1, hAb, lda, hXb, ldb, 0, hBb, ldb);
+    }
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), A_size * sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB.data(), B_size * sizeof(T), hipMemcpyHostToDevice));
+
+    /* =====================================================================
+           HIPBLAS
+    =================================================================== */
+
+    status = hipblasGelsStridedBatched<T>(
+        handle, op, M, N, nrhs, dA, lda, strideA, dB, ldb, strideB, &info, dInfo, batch_count);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    // copy output from device to CPU
+    CHECK_HIP_ERROR(hipMemcpy(hB.data(), dB, B_size * sizeof(T), hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(
+        hipMemcpy(hInfo.data(), dInfo, batch_count * sizeof(int), hipMemcpyDeviceToHost));
+
+    if(argus.unit_check)
+    {
+        // The first N rows of each B now hold hX
+        T      eps       = std::numeric_limits<T>::epsilon();
+        double tolerance = max(M, N) * eps * 100;
+
+        EXPECT_EQ(0, info);
+        for(int b = 0; b < batch_count; b++)
+        {
+            EXPECT_EQ(0, hInfo[b]);
+
+            double e = norm_check_general<T>(
+                'M', N, nrhs, ldb, hX.data() + b * strideB, hB.data() + b * strideB);
+            unit_check_error(e, tolerance);
+        }
+    }
+
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -10,6 +10,7 @@
 #include <vector>
 
 #include "cblas_interface.h"
+#include "device_init.h"
 #include "flops.h"
 #include "hipblas.hpp"
 #include "norm.h"
@@ -74,31 +75,64 @@ hipblasStatus_t testing_gemm(Arguments argus)
 
     hipblasHandle_t handle;
     hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
-    hipblasCreate(&handle);
+    hipblas_client_create(&handle);
+
+    // without a host check the inputs can be filled on the device and the host copies skipped
+    bool host_init = argus.unit_check || !argus.device_init;
 
     // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory, plz follow this practice
-    vector<T> hA(A_size);
-    vector<T> hB(B_size);
-    vector<T> hC(C_size);
-    vector<T> hC_copy(C_size);
+    vector<T> hA(host_init ? A_size : 0);
+    vector<T> hB(host_init ? B_size : 0);
+    vector<T> hC(host_init ? C_size : 0);
+    vector<T> hC_copy(host_init ? C_size : 0);
 
     device_vector<T> dA(A_size);
     device_vector<T> dB(B_size);
     device_vector<T> dC(C_size);
 
-    // Initial Data on CPU
     srand(1);
-    hipblas_init<T>(hA, A_row, A_col, lda);
-    hipblas_init<T>(hB, B_row, B_col, ldb);
-    hipblas_init<T>(hC, M, N, ldc);
-
-    // copy vector is easy in STL; hz = hx: save a copy in hC_copy which will be output of CPU BLAS
-    hC_copy = hC;
+    if(host_init)
+    {
+        // Initial Data on CPU
+        hipblas_init<T>(hA, A_row, A_col, lda);
+        hipblas_init<T>(hB, B_row, B_col, ldb);
+        hipblas_init<T>(hC, M, N, ldc);
+
+        // copy vector is easy in STL; hz = hx: save a copy in hC_copy which will be output of
+        // CPU BLAS
+        hC_copy = hC;
+
+        // copy data from CPU to device, does not work for lda != A_row
+        CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * lda * A_col, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dB, hB.data(), sizeof(T) * ldb * B_col, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dC, hC.data(), sizeof(T) * ldc * N, hipMemcpyHostToDevice));
+    }
+    else
+    {
+        CHECK_HIP_ERROR(hipblas_init_device<T>(dA, A_row, A_col, lda));
+        CHECK_HIP_ERROR(hipblas_init_device<T>(dB, B_row, B_col, ldb));
+        CHECK_HIP_ERROR(hipblas_init_device<T>(dC, M, N, ldc));
+    }
 
-    // copy data from CPU to device, does not work for lda != A_row
-    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * lda * A_col, hipMemcpyHostToDevice));
-    CHECK_HIP_ERROR(hipMemcpy(dB, hB.data(), sizeof(T) * ldb * B_col, hipMemcpyHostToDevice));
-    CHECK_HIP_ERROR(hipMemcpy(dC, hC.data(), sizeof(T) * ldc * N, hipMemcpyHostToDevice));
+    // the CPU reference runs while the GPU computes; it reads hA and hB and writes hC_copy only
+    hipblas_host_reference reference([&] {
+        if(argus.unit_check)
+        {
+            cblas_gemm<T>(transA,
+                          transB,
+                          M,
+                          N,
+                          K,
+                          alpha,
+                          hA.data(),
+                          lda,
+                          hB.data(),
+                          ldb,
+                          beta,
+                          hC_copy.data(),
+                          ldc);
+        }
+    });
 
     /* =====================================================================
          ROCBLAS
@@ -109,7 +143,10 @@ hipblasStatus_t testing_gemm(Arguments argus)
         = hipblasGemm<T>(handle, transA, transB, M, N, K, &alpha, dA, lda, dB, ldb, &beta, dC, ldc);
 
     // copy output from device to CPU
-    CHECK_HIP_ERROR(hipMemcpy(hC.data(), dC, sizeof(T) * ldc * N, hipMemcpyDeviceToHost));
+    if(host_init)
+    {
+        CHECK_HIP_ERROR(hipMemcpy(hC.data(), dC, sizeof(T) * ldc * N, hipMemcpyDeviceToHost));
+    }
 
     if(argus.unit_check)
     {
@@ -117,22 +154,7 @@ hipblasStatus_t testing_gemm(Arguments argus)
         /* =====================================================================
                     CPU BLAS
         =================================================================== */
-        if(status != HIPBLAS_STATUS_INVALID_VALUE)
-        { // only valid size compare with cblas
-            cblas_gemm<T>(transA,
-                          transB,
-                          M,
-                          N,
-                          K,
-                          alpha,
-                          hA.data(),
-                          lda,
-                          hB.data(),
-                          ldb,
-                          beta,
-                          hC_copy.data(),
-                          ldc);
-        }
+        reference.wait();
 
 #ifndef NDEBUG
         print_matrix(hC_copy, hC, min(M, 3), min(N, 3), ldc);
@@ -147,6 +169,29 @@ hipblasStatus_t testing_gemm(Arguments argus)
 
     } // end of if unit/norm check
 
-    hipblasDestroy(handle);
+    if(argus.timing)
+    {
+        hipblas_timing timing;
+        status = hipblas_time_launches(handle, argus, timing, [&] {
+            return hipblasGemm<T>(
+                handle, transA, transB, M, N, K, &alpha, dA, lda, dB, ldb, &beta, dC, ldc);
+        });
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            hipblas_client_destroy(handle);
+            return status;
+        }
+
+        double gflop = gemm_gflop_count<T>(M, N, K);
+        double gbyte = gemm_gbyte_count<T>(M, N, K);
+
+        cout << "transA,transB,M,N,K,alpha,lda,ldb,beta,ldc," HIPBLAS_TIMING_COLUMNS << endl;
+        cout << argus.transA_option << ',' << argus.transB_option << ',' << M << ',' << N << ','
+             << K << ',' << argus.alpha << ',' << lda << ',' << ldb << ',' << argus.beta << ','
+             << ldc << ',';
+        hipblas_print_timing(cout, timing, gflop, gbyte);
+    }
+
+    hipblas_client_destroy(handle);
     return status;
 }
@@ -0,0 +1,194 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <sys/time.h>
+#include <vector>
+
+#include "cblas_interface.h"
+#include "flops.h"
+#include "hipblas.hpp"
+#include "norm.h"
+#include "unit.h"
+#include "utility.h"
+#include <typeinfo>
+
+using namespace std;
+
+/* ============================================================================================ */
+
+// the 3M product of integer data is exact, so it is compared exactly against the direct product
+template <typename T>
+hipblasStatus_t testing_gemm3m(Arguments argus)
+{
+    int M = argus.M;
+    int N = argus.N;
+    int K = argus.K;
+
+    int lda = argus.lda;
+    int ldb = argus.ldb;
+    int ldc = argus.ldc;
+
+    hipblasOperation_t transA = char2hipblas_operation(argus.transA_option);
+    hipblasOperation_t transB = char2hipblas_operation(argus.transB_option);
+
+    T alpha = argus.alpha;
+    T beta  = argus.beta;
+
+    int A_size, B_size, C_size, A_row, A_col, B_row, B_col;
+
+    if(transA == HIPBLAS_OP_N)
+    {
+        A_row = M;
+        A_col = K;
+    }
+    else
+    {
+        A_row = K;
+        A_col = M;
+    }
+
+    if(transB == HIPBLAS_OP_N)
+    {
+        B_row = K;
+        B_col = N;
+    }
+    else
+    {
+        B_row = N;
+        B_col = K;
+    }
+
+    A_size = lda * A_col;
+    B_size = ldb * B_col;
+    C_size = ldc * N;
+
+    // check here to prevent undefined memory allocation error
+    if(M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+
+    hipblasHandle_t handle;
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+    hipblas_client_create(&handle);
+
+    // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory, plz follow this practice
+    vector<T> hA(A_size);
+    vector<T> hB(B_size);
+    vector<T> hC(C_size);
+    vector<T> hC_copy(C_size);
+
+    device_vector<T> dA(A_size);
+    device_vector<T> dB(B_size);
+    device_vector<T> dC(C_size);
+
+    // Initial Data on CPU
+    srand(1);
+    hipblas_init<T>(hA, A_row, A_col, lda);
+    hipblas_init<T>(hB, B_row, B_col, ldb);
+    hipblas_init<T>(hC, M, N, ldc);
+
+    // copy vector is easy in STL; hz = hx: save a copy in hC_copy which will be output of CPU BLAS
+    hC_copy             = hC;
+    vector<T> hC_before = hC;
+
+    // copy data from CPU to device, does not work for lda != A_row
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * lda * A_col, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB.data(), sizeof(T) * ldb * B_col, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC, hC.data(), sizeof(T) * ldc * N, hipMemcpyHostToDevice));
+
+    /* =====================================================================
+         ROCBLAS
+    =================================================================== */
+
+    // library interface
+    status = hipblasGemm3m<T>(
+        handle, transA, transB, M, N, K, &alpha, dA, lda, dB, ldb, &beta, dC, ldc);
+
+    // copy output from device to CPU
+    CHECK_HIP_ERROR(hipMemcpy(hC.data(), dC, sizeof(T) * ldc * N, hipMemcpyDeviceToHost));
+
+    if(argus.unit_check)
+    {
+
+        /* =====================================================================
+                    CPU BLAS
+        =================================================================== */
+        if(status != HIPBLAS_STATUS_INVALID_VALUE)
+        { // only valid size compare with cblas
+            cblas_gemm<T>(transA,
+                          transB,
+                          M,
+                          N,
+                          K,
+                          alpha,
+                          hA.data(),
+                          lda,
+                          hB.data(),
+                          ldb,
+                          beta,
+                          hC_copy.data(),
+                          ldc);
+        }
+
+#ifndef NDEBUG
+        print_matrix(hC_copy, hC, min(M, 3), min(N, 3), ldc);
+#endif
+
+        // enable unit check, notice unit check is not invasive, but norm check is,
+        // unit check and norm check can not be interchanged their order
+        if(argus.unit_check)
+        {
+            unit_check_general<T>(M, N, ldc, hC_copy.data(), hC.data());
+        }
+
+    } // end of if unit/norm check
+
+    // a handle whose workspace cannot hold the 3M products runs the plain complex gemm instead
+    if(argus.unit_check && status == HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblasHandle_t capped;
+        hipblas_client_create(&capped);
+        CHECK_HIP_ERROR(
+            hipMemcpy(dC, hC_before.data(), sizeof(T) * ldc * N, hipMemcpyHostToDevice));
+        status = hipblasSetWorkspaceLimit(capped, 1);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblasGemm3m<T>(
+                capped, transA, transB, M, N, K, &alpha, dA, lda, dB, ldb, &beta, dC, ldc);
+        CHECK_HIP_ERROR(hipMemcpy(hC.data(), dC, sizeof(T) * ldc * N, hipMemcpyDeviceToHost));
+        hipblas_client_destroy(capped);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            unit_check_general<T>(M, N, ldc, hC_copy.data(), hC.data());
+    }
+
+    if(argus.timing)
+    {
+        hipblas_timing timing;
+        status = hipblas_time_launches(handle, argus, timing, [&] {
+            return hipblasGemm3m<T>(
+                handle, transA, transB, M, N, K, &alpha, dA, lda, dB, ldb, &beta, dC, ldc);
+        });
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            hipblas_client_destroy(handle);
+            return status;
+        }
+
+        double gflop = gemm_gflop_count<T>(M, N, K);
+        double gbyte = gemm_gbyte_count<T>(M, N, K);
+
+        cout << "transA,transB,M,N,K,alpha,lda,ldb,beta,ldc," HIPBLAS_TIMING_COLUMNS << endl;
+        cout << argus.transA_option << ',' << argus.transB_option << ',' << M << ',' << N << ','
+             << K << ',' << argus.alpha << ',' << lda << ',' << ldb << ',' << argus.beta << ','
+             << ldc << ',';
+        hipblas_print_timing(cout, timing, gflop, gbyte);
+    }
+
+    hipblas_client_destroy(handle);
+    return status;
+}
@@ -0,0 +1,237 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "cblas_interface.h"
+#include "flops.h"
+#include "hipblas.hpp"
+#include "unit.h"
+#include "utility.h"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+// hipblasGemmBatched with host and then device scalars on a handle checking its gemms in the
+// hipblasAbftMode_t of argus.abft_mode. Small integers keep every product and sum exact, so each C
+// is compared exactly with the host and no tile of the correct results may fail. The report counts
+// the two calls and the 256 x 256 tiles of every batch unless checking is off
+template <typename T>
+hipblasStatus_t testing_gemm_abft_batched(Arguments argus)
+{
+    int M           = argus.M;
+    int N           = argus.N;
+    int K           = argus.K;
+    int lda         = argus.lda;
+    int ldb         = argus.ldb;
+    int ldc         = argus.ldc;
+    int batch_count = argus.batch_count;
+
+    hipblasOperation_t transA = char2hipblas_operation(argus.transA_option);
+    hipblasOperation_t transB = char2hipblas_operation(argus.transB_option);
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    if(M < 0 || N < 0 || K < 0 || lda < max(1, transA == HIPBLAS_OP_N ? M : K)
+       || ldb < max(1, transB == HIPBLAS_OP_N ? K : N) || ldc < max(1, M) || batch_count < 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    if(M == 0 || N == 0 || batch_count == 0)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    int A_size = lda * (transA == HIPBLAS_OP_N ? K : M);
+    int B_size = ldb * (transB == HIPBLAS_OP_N ? N : K);
+    int C_size = ldc * N;
+
+    T alpha = argus.get_alpha<T>();
+    T beta  = argus.get_beta<T>();
+
+    hipblasHandle_t handle;
+    hipblas_client_create(&handle);
+
+    // a shared handle keeps the counts of the tests before
+    hipblasResetAbftReport(handle);
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA[batch_count];
+    host_vector<T> hB[batch_count];
+    host_vector<T> hC[batch_count];
+    host_vector<T> hC_gold[batch_count];
+    host_vector<T> hC_host[batch_count];
+    host_vector<T> hC_device[batch_count];
+
+    device_batch_vector<T> bA(batch_count, A_size);
+    device_batch_vector<T> bB(batch_count, B_size);
+    device_batch_vector<T> bC(batch_count, C_size);
+
+    device_vector<T*, 0, T> dA(batch_count);
+    device_vector<T*, 0, T> dB(batch_count);
+    device_vector<T*, 0, T> dC(batch_count);
+    device_vector<T>        dalpha(1);
+    device_vector<T>        dbeta(1);
+
+    if(!dA || !dB || !dC || !dalpha || !dbeta || !bA[batch_count - 1] || !bB[batch_count - 1]
+       || !bC[batch_count - 1])
+    {
+        hipblasSetAbftMode(handle, HIPBLAS_ABFT_OFF);
+        hipblas_client_destroy(handle);
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+    }
+
+    // Initial Data on CPU
+    srand(1);
+    for(int b = 0; b < batch_count; b++)
+    {
+        hA[b]        = host_vector<T>(A_size);
+        hB[b]        = host_vector<T>(B_size);
+        hC[b]        = host_vector<T>(C_size);
+        hC_host[b]   = host_vector<T>(C_size);
+        hC_device[b] = host_vector<T>(C_size);
+        for(int i = 0; i < A_size; i++)
+            hA[b][i] = T(rand() % 7 - 3);
+        for(int i = 0; i < B_size; i++)
+            hB[b][i] = T(rand() % 5 - 2);
+        for(int i = 0; i < C_size; i++)
+            hC[b][i] = T(rand() % 3 - 1);
+
+        hC_gold[b] = hC[b];
+        cblas_gemm<T>(transA,
+                      transB,
+                      M,
+                      N,
+                      K,
+                      alpha,
+                      hA[b].data(),
+                      lda,
+                      hB[b].data(),
+                      ldb,
+                      beta,
+                      hC_gold[b].data(),
+                      ldc);
+
+        CHECK_HIP_ERROR(hipMemcpy(bA[b], hA[b], sizeof(T) * A_size, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(bB[b], hB[b], sizeof(T) * B_size, hipMemcpyHostToDevice));
+    }
+    CHECK_HIP_ERROR(hipMemcpy(dA, bA, sizeof(T*) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, bB, sizeof(T*) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC, bC, sizeof(T*) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dalpha, &alpha, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dbeta, &beta, sizeof(T), hipMemcpyHostToDevice));
+
+    auto set_c = [&] {
+        for(int b = 0; b < batch_count; b++)
+            CHECK_HIP_ERROR(hipMemcpy(bC[b], hC[b], sizeof(T) * C_size, hipMemcpyHostToDevice));
+    };
+    auto get_c = [&](host_vector<T>* hC_result) {
+        for(int b = 0; b < batch_count; b++)
+            CHECK_HIP_ERROR(
+                hipMemcpy(hC_result[b], bC[b], sizeof(T) * C_size, hipMemcpyDeviceToHost));
+    };
+    auto gemm = [&](const T* alpha_ptr, const T* beta_ptr) {
+        return hipblasGemmBatched<T>(handle,
+                                     transA,
+                                     transB,
+                                     M,
+                                     N,
+                                     K,
+                                     alpha_ptr,
+                                     dA,
+                                     lda,
+                                     dB,
+                                     ldb,
+                                     beta_ptr,
+                                     dC,
+                                     ldc,
+                                     batch_count);
+    };
+
+    /* =====================================================================
+           HIPBLAS
+    =================================================================== */
+
+    status = hipblasSetAbftMode(handle, hipblasAbftMode_t(argus.abft_mode));
+
+    set_c();
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = gemm(&alpha, &beta);
+    get_c(hC_host);
+
+    if(status == HIPBLAS_STATUS_SUCCESS)
+    {
+        set_c();
+        status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = gemm(dalpha, dbeta);
+        get_c(hC_device);
+    }
+
+    hipblasAbftReport_t report{};
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasGetAbftReport(handle, &report);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblasSetAbftMode(handle, HIPBLAS_ABFT_OFF);
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    if(argus.unit_check)
+    {
+        for(int b = 0; b < batch_count; b++)
+        {
+            unit_check_general<T>(M, N, ldc, hC_gold[b].data(), hC_host[b].data());
+            unit_check_general<T>(M, N, ldc, hC_gold[b].data(), hC_device[b].data());
+        }
+
+        unsigned long long calls = argus.abft_mode == HIPBLAS_ABFT_OFF || K == 0 ? 0 : 2;
+        EXPECT_EQ(report.calls, calls);
+        EXPECT_EQ(report.tiles,
+                  calls * ((M - 1) / 256 + 1) * ((N - 1) / 256 + 1) * batch_count);
+        EXPECT_EQ(report.failed_tiles, 0u);
+        EXPECT_EQ(report.corrected_tiles, 0u);
+        EXPECT_EQ(report.unchecked_calls, 0u);
+    }
+
+    if(argus.timing)
+    {
+        // with the device scalars the last call left the handle
+        hipblas_timing timing;
+        status = hipblas_time_launches(
+            handle, argus, timing, [&] { return gemm(dalpha, dbeta); });
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            hipblasSetAbftMode(handle, HIPBLAS_ABFT_OFF);
+            hipblas_client_destroy(handle);
+            return status;
+        }
+
+        double gflop = gemm_gflop_count<T>(M, N, K) * batch_count;
+        double gbyte = gemm_gbyte_count<T>(M, N, K) * batch_count;
+
+        cout << "transA,transB,M,N,K,lda,ldb,ldc,batch_count,abft_mode," HIPBLAS_TIMING_COLUMNS
+             << endl;
+        cout << argus.transA_option << ',' << argus.transB_option << ',' << M << ',' << N << ','
+             << K << ',' << lda << ',' << ldb << ',' << ldc << ',' << batch_count << ','
+             << argus.abft_mode << ',';
+        hipblas_print_timing(cout, timing, gflop, gbyte);
+    }
+
+    // later gemms on a shared handle run unchecked
+    hipblasSetAbftMode(handle, HIPBLAS_ABFT_OFF);
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
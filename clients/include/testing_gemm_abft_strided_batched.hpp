@@ -0,0 +1,212 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "cblas_interface.h"
+#include "flops.h"
+#include "hipblas.hpp"
+#include "unit.h"
+#include "utility.h"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+// hipblasGemmStridedBatched with host and then device scalars on a handle checking its gemms in
+// the hipblasAbftMode_t of argus.abft_mode; the batches of each operand are stride_scale times
+// their size apart. Small integers keep every product and sum exact, so C is compared exactly with
+// the host and no tile of the correct results may fail. The report counts the two calls and the
+// 256 x 256 tiles of every batch unless checking is off
+template <typename T>
+hipblasStatus_t testing_gemm_abft_strided_batched(Arguments argus)
+{
+    int M           = argus.M;
+    int N           = argus.N;
+    int K           = argus.K;
+    int lda         = argus.lda;
+    int ldb         = argus.ldb;
+    int ldc         = argus.ldc;
+    int batch_count = argus.batch_count;
+
+    hipblasOperation_t transA = char2hipblas_operation(argus.transA_option);
+    hipblasOperation_t transB = char2hipblas_operation(argus.transB_option);
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    if(M < 0 || N < 0 || K < 0 || lda < max(1, transA == HIPBLAS_OP_N ? M : K)
+       || ldb < max(1, transB == HIPBLAS_OP_N ? K : N) || ldc < max(1, M) || batch_count < 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    if(M == 0 || N == 0 || batch_count == 0)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    int strideA = lda * (transA == HIPBLAS_OP_N ? K : M) * argus.stride_scale;
+    int strideB = ldb * (transB == HIPBLAS_OP_N ? N : K) * argus.stride_scale;
+    int strideC = ldc * N * argus.stride_scale;
+    int A_size  = strideA * batch_count;
+    int B_size  = strideB * batch_count;
+    int C_size  = strideC * batch_count;
+
+    T alpha = argus.get_alpha<T>();
+    T beta  = argus.get_beta<T>();
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA(A_size);
+    host_vector<T> hB(B_size);
+    host_vector<T> hC(C_size);
+    host_vector<T> hC_gold(C_size);
+    host_vector<T> hC_host(C_size);
+    host_vector<T> hC_device(C_size);
+
+    device_vector<T> dA(A_size);
+    device_vector<T> dB(B_size);
+    device_vector<T> dC(C_size);
+    device_vector<T> dalpha(1);
+    device_vector<T> dbeta(1);
+
+    hipblasHandle_t handle;
+    hipblas_client_create(&handle);
+
+    // a shared handle keeps the counts of the tests before
+    hipblasResetAbftReport(handle);
+
+    // Initial Data on CPU
+    srand(1);
+    for(int i = 0; i < A_size; i++)
+        hA[i] = T(rand() % 7 - 3);
+    for(int i = 0; i < B_size; i++)
+        hB[i] = T(rand() % 5 - 2);
+    for(int i = 0; i < C_size; i++)
+        hC[i] = T(rand() % 3 - 1);
+
+    hC_gold = hC;
+    for(int b = 0; b < batch_count; b++)
+        cblas_gemm<T>(transA,
+                      transB,
+                      M,
+                      N,
+                      K,
+                      alpha,
+                      hA.data() + b * strideA,
+                      lda,
+                      hB.data() + b * strideB,
+                      ldb,
+                      beta,
+                      hC_gold.data() + b * strideC,
+                      ldc);
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * A_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB.data(), sizeof(T) * B_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dalpha, &alpha, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dbeta, &beta, sizeof(T), hipMemcpyHostToDevice));
+
+    auto gemm = [&](const T* alpha_ptr, const T* beta_ptr) {
+        return hipblasGemmStridedBatched<T>(handle,
+                                            transA,
+                                            transB,
+                                            M,
+                                            N,
+                                            K,
+                                            alpha_ptr,
+                                            dA,
+                                            lda,
+                                            strideA,
+                                            dB,
+                                            ldb,
+                                            strideB,
+                                            beta_ptr,
+                                            dC,
+                                            ldc,
+                                            strideC,
+                                            batch_count);
+    };
+
+    /* =====================================================================
+           HIPBLAS
+    =================================================================== */
+
+    status = hipblasSetAbftMode(handle, hipblasAbftMode_t(argus.abft_mode));
+
+    CHECK_HIP_ERROR(hipMemcpy(dC, hC.data(), sizeof(T) * C_size, hipMemcpyHostToDevice));
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = gemm(&alpha, &beta);
+    CHECK_HIP_ERROR(hipMemcpy(hC_host.data(), dC, sizeof(T) * C_size, hipMemcpyDeviceToHost));
+
+    if(status == HIPBLAS_STATUS_SUCCESS)
+    {
+        CHECK_HIP_ERROR(hipMemcpy(dC, hC.data(), sizeof(T) * C_size, hipMemcpyHostToDevice));
+        status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = gemm(dalpha, dbeta);
+        CHECK_HIP_ERROR(
+            hipMemcpy(hC_device.data(), dC, sizeof(T) * C_size, hipMemcpyDeviceToHost));
+    }
+
+    hipblasAbftReport_t report{};
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasGetAbftReport(handle, &report);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblasSetAbftMode(handle, HIPBLAS_ABFT_OFF);
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    if(argus.unit_check)
+    {
+        // the whole buffers, so the gaps between the batches keep their values too
+        unit_check_general<T>(1, C_size, 1, hC_gold.data(), hC_host.data());
+        unit_check_general<T>(1, C_size, 1, hC_gold.data(), hC_device.data());
+
+        unsigned long long calls = argus.abft_mode == HIPBLAS_ABFT_OFF || K == 0 ? 0 : 2;
+        EXPECT_EQ(report.calls, calls);
+        EXPECT_EQ(report.tiles,
+                  calls * ((M - 1) / 256 + 1) * ((N - 1) / 256 + 1) * batch_count);
+        EXPECT_EQ(report.failed_tiles, 0u);
+        EXPECT_EQ(report.corrected_tiles, 0u);
+        EXPECT_EQ(report.unchecked_calls, 0u);
+    }
+
+    if(argus.timing)
+    {
+        // with the device scalars the last call left the handle
+        hipblas_timing timing;
+        status = hipblas_time_launches(
+            handle, argus, timing, [&] { return gemm(dalpha, dbeta); });
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            hipblasSetAbftMode(handle, HIPBLAS_ABFT_OFF);
+            hipblas_client_destroy(handle);
+            return status;
+        }
+
+        double gflop = gemm_gflop_count<T>(M, N, K) * batch_count;
+        double gbyte = gemm_gbyte_count<T>(M, N, K) * batch_count;
+
+        cout << "transA,transB,M,N,K,lda,ldb,ldc,batch_count,abft_mode," HIPBLAS_TIMING_COLUMNS
+             << endl;
+        cout << argus.transA_option << ',' << argus.transB_option << ',' << M << ',' << N << ','
+             << K << ',' << lda << ',' << ldb << ',' << ldc << ',' << batch_count << ','
+             << argus.abft_mode << ',';
+        hipblas_print_timing(cout, timing, gflop, gbyte);
+    }
+
+    // later gemms on a shared handle run unchecked
+    hipblasSetAbftMode(handle, HIPBLAS_ABFT_OFF);
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
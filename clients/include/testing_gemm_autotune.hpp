@@ -0,0 +1,182 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "cblas_interface.h"
+#include "flops.h"
+#include "hipblas.hpp"
+#include "unit.h"
+#include "utility.h"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+// argus.apiCallCount hipblasGemmEx calls of one problem on a handle autotuning with argus.autotune
+// trials, each checked. Small integers make every candidate's product exact, so each call while
+// the candidates take turns matches the host exactly. C is restored before every call
+template <typename T>
+hipblasStatus_t testing_gemm_autotune(Arguments argus)
+{
+    int M     = argus.M;
+    int N     = argus.N;
+    int K     = argus.K;
+    int lda   = argus.lda;
+    int ldb   = argus.ldb;
+    int ldc   = argus.ldc;
+    int calls = argus.apiCallCount;
+
+    hipblasOperation_t transA = char2hipblas_operation(argus.transA_option);
+    hipblasOperation_t transB = char2hipblas_operation(argus.transB_option);
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    if(M < 0 || N < 0 || K < 0 || lda < max(1, transA == HIPBLAS_OP_N ? M : K)
+       || ldb < max(1, transB == HIPBLAS_OP_N ? K : N) || ldc < max(1, M) || argus.autotune < 0
+       || calls < 1)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    if(M == 0 || N == 0)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    int A_size = lda * (transA == HIPBLAS_OP_N ? K : M);
+    int B_size = ldb * (transB == HIPBLAS_OP_N ? N : K);
+    int C_size = ldc * N;
+
+    T alpha = argus.get_alpha<T>();
+    T beta  = argus.get_beta<T>();
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA(A_size);
+    host_vector<T> hB(B_size);
+    host_vector<T> hC(C_size);
+    host_vector<T> hC_gold(C_size);
+    host_vector<T> hC_result(C_size);
+
+    device_vector<T> dA(A_size);
+    device_vector<T> dB(B_size);
+    device_vector<T> dC(C_size);
+
+    hipblasHandle_t handle;
+    hipblas_client_create(&handle);
+
+    // Initial Data on CPU
+    srand(1);
+    for(int i = 0; i < A_size; i++)
+        hA[i] = T(rand() % 7 - 3);
+    for(int i = 0; i < B_size; i++)
+        hB[i] = T(rand() % 5 - 2);
+    for(int i = 0; i < C_size; i++)
+        hC[i] = T(rand() % 5 - 2);
+
+    hC_gold = hC;
+    cblas_gemm<T>(transA,
+                  transB,
+                  M,
+                  N,
+                  K,
+                  alpha,
+                  hA.data(),
+                  lda,
+                  hB.data(),
+                  ldb,
+                  beta,
+                  hC_gold.data(),
+                  ldc);
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * A_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB.data(), sizeof(T) * B_size, hipMemcpyHostToDevice));
+
+    auto gemm_ex = [&] {
+        return hipblasGemmEx(handle,
+                             transA,
+                             transB,
+                             M,
+                             N,
+                             K,
+                             &alpha,
+                             dA,
+                             hipblas_datatype<T>,
+                             lda,
+                             dB,
+                             hipblas_datatype<T>,
+                             ldb,
+                             &beta,
+                             dC,
+                             hipblas_datatype<T>,
+                             ldc,
+                             hipblas_datatype<T>,
+                             HIPBLAS_GEMM_DEFAULT);
+    };
+
+    /* =====================================================================
+           HIPBLAS
+    =================================================================== */
+
+    status = hipblasSetGemmAutotune(handle, argus.autotune);
+
+    // each call copies C back, so the timed trials have been read by the next call
+    for(int call = 0; call < calls && status == HIPBLAS_STATUS_SUCCESS; call++)
+    {
+        CHECK_HIP_ERROR(hipMemcpy(dC, hC.data(), sizeof(T) * C_size, hipMemcpyHostToDevice));
+        status = gemm_ex();
+        CHECK_HIP_ERROR(
+            hipMemcpy(hC_result.data(), dC, sizeof(T) * C_size, hipMemcpyDeviceToHost));
+
+        if(status == HIPBLAS_STATUS_SUCCESS && argus.unit_check)
+        {
+            unit_check_general<T>(M, N, ldc, hC_gold.data(), hC_result.data());
+        }
+    }
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblasSetGemmAutotune(handle, 0);
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    if(argus.timing)
+    {
+        // twice the trials untimed first, read back, so the tuner has settled on the timed calls
+        for(int call = 0; call < 2 * argus.autotune && status == HIPBLAS_STATUS_SUCCESS; call++)
+        {
+            status = gemm_ex();
+            CHECK_HIP_ERROR(hipDeviceSynchronize());
+        }
+
+        hipblas_timing timing;
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblas_time_launches(handle, argus, timing, gemm_ex);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            hipblasSetGemmAutotune(handle, 0);
+            hipblas_client_destroy(handle);
+            return status;
+        }
+
+        double gflop = gemm_gflop_count<T>(M, N, K);
+        double gbyte = gemm_gbyte_count<T>(M, N, K);
+
+        cout << "transA,transB,M,N,K,lda,ldb,ldc,autotune," HIPBLAS_TIMING_COLUMNS << endl;
+        cout << argus.transA_option << ',' << argus.transB_option << ',' << M << ',' << N << ','
+             << K << ',' << lda << ',' << ldb << ',' << ldc << ',' << argus.autotune << ',';
+        hipblas_print_timing(cout, timing, gflop, gbyte);
+    }
+
+    // later gemm_ex calls on a shared handle run untuned
+    hipblasSetGemmAutotune(handle, 0);
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
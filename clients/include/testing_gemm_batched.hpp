@@ -45,7 +45,7 @@ hipblasStatus_t testing_GemmBatched(Arguments argus)
     {
         hipblasHandle_t handle;
         hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
-        hipblasCreate(&handle);
+        hipblas_client_create(&handle);
 
         const T *dA_array[1], *dB_array[1];
         T*       dC1_array[1];
@@ -70,7 +70,7 @@ hipblasStatus_t testing_GemmBatched(Arguments argus)
             status,
             "ERROR: batch_count < 0 || M < 0 || N < 0 || K < 0 || lda < 0 || ldb < 0 || ldc < 0 ");
 
-        hipblasDestroy(handle);
+        hipblas_client_destroy(handle);
 
         return status;
     }
@@ -114,17 +114,17 @@ hipblasStatus_t testing_GemmBatched(Arguments argus)
     }
 
     hipblasHandle_t handle;
-    hipblasCreate(&handle);
+    hipblas_client_create(&handle);
 
     int A_mat_size = A_col * lda;
     int B_mat_size = B_col * ldb;
     int C_mat_size = N * ldc;
 
-    // arrays of pointers-to-host on host
-    host_vector<T> hA_array[batch_count];
-    host_vector<T> hB_array[batch_count];
-    host_vector<T> hC_array[batch_count];
-    host_vector<T> hC_copy_array[batch_count];
+    // batches of host matrices, each in one pinned allocation
+    host_batch_vector<T> hA_array(batch_count, A_mat_size);
+    host_batch_vector<T> hB_array(batch_count, B_mat_size);
+    host_batch_vector<T> hC_array(batch_count, C_mat_size);
+    host_batch_vector<T> hC_copy_array(batch_count, C_mat_size);
 
     // arrays of pointers-to-device on host
     device_batch_vector<T> dA_array(batch_count, A_mat_size);
@@ -142,9 +142,10 @@ hipblasStatus_t testing_GemmBatched(Arguments argus)
 
     int last = batch_count - 1;
     if((!dA_array[last] && A_mat_size) || (!dB_array[last] && B_mat_size)
-       || (!dC1_array[last] && C_mat_size) || (!dC2_array[last] && C_mat_size))
+       || (!dC1_array[last] && C_mat_size) || (!dC2_array[last] && C_mat_size) || !hA_array
+       || !hB_array || !hC_array || !hC_copy_array)
     {
-        hipblasDestroy(handle);
+        hipblas_client_destroy(handle);
         return HIPBLAS_STATUS_ALLOC_FAILED;
     }
 
@@ -152,11 +153,6 @@ hipblasStatus_t testing_GemmBatched(Arguments argus)
     srand(1);
     for(int i = 0; i < batch_count; i++)
     {
-        hA_array[i]      = host_vector<T>(A_mat_size);
-        hB_array[i]      = host_vector<T>(B_mat_size);
-        hC_array[i]      = host_vector<T>(C_mat_size);
-        hC_copy_array[i] = host_vector<T>(C_mat_size);
-
         // initialize matrices on host
         srand(1);
         hipblas_init<T>(hA_array[i], A_row, A_col, lda);
@@ -170,24 +166,22 @@ hipblasStatus_t testing_GemmBatched(Arguments argus)
                 hC_copy_array[i][i1 + i2 * ldc] = hC_array[i][i1 + i2 * ldc];
             }
         }
+    }
 
-        // copy initialized matrices from host to device
-        err_A = hipMemcpy(dA_array[i], hA_array[i], sizeof(T) * A_mat_size, hipMemcpyHostToDevice);
-        err_B = hipMemcpy(dB_array[i], hB_array[i], sizeof(T) * B_mat_size, hipMemcpyHostToDevice);
-        err_C_1
-            = hipMemcpy(dC1_array[i], hC_array[i], sizeof(T) * C_mat_size, hipMemcpyHostToDevice);
-        err_C_2
-            = hipMemcpy(dC2_array[i], hC_array[i], sizeof(T) * C_mat_size, hipMemcpyHostToDevice);
-        err_alpha = hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice);
-        err_beta  = hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice);
-
-        if((err_A != hipSuccess) || (err_C_1 != hipSuccess) || (err_alpha != hipSuccess)
-           || (err_B != hipSuccess) || (err_C_2 != hipSuccess) || (err_beta != hipSuccess))
-        {
-            hipblasDestroy(handle);
-            std::cerr << "dX_array[i] hipMemcpy error" << std::endl;
-            return HIPBLAS_STATUS_MAPPING_ERROR;
-        }
+    // copy initialized matrices from host to device, one copy per batch
+    err_A     = dA_array.transfer_from(hA_array);
+    err_B     = dB_array.transfer_from(hB_array);
+    err_C_1   = dC1_array.transfer_from(hC_array);
+    err_C_2   = dC2_array.transfer_from(hC_array);
+    err_alpha = hipMemcpy(d_alpha, &h_alpha, sizeof(T), hipMemcpyHostToDevice);
+    err_beta  = hipMemcpy(d_beta, &h_beta, sizeof(T), hipMemcpyHostToDevice);
+
+    if((err_A != hipSuccess) || (err_C_1 != hipSuccess) || (err_alpha != hipSuccess)
+       || (err_B != hipSuccess) || (err_C_2 != hipSuccess) || (err_beta != hipSuccess))
+    {
+        hipblas_client_destroy(handle);
+        std::cerr << "dX_array hipMemcpy error" << std::endl;
+        return HIPBLAS_STATUS_MAPPING_ERROR;
     }
 
     // copy array of pointers-to-device from host to device
@@ -202,28 +196,29 @@ hipblasStatus_t testing_GemmBatched(Arguments argus)
     if((err_A != hipSuccess) || (err_B != hipSuccess) || (err_C_1 != hipSuccess)
        || (err_C_2 != hipSuccess))
     {
-        hipblasDestroy(handle);
+        hipblas_client_destroy(handle);
         std::cerr << "dX_array[i] hipMemcpy error" << std::endl;
         return HIPBLAS_STATUS_MAPPING_ERROR;
     }
 
-    // calculate "golden" result on CPU
-    for(int i = 0; i < batch_count; i++)
-    {
-        cblas_gemm<T>(transA,
-                      transB,
-                      M,
-                      N,
-                      K,
-                      h_alpha,
-                      hA_array[i],
-                      lda,
-                      hB_array[i],
-                      ldb,
-                      h_beta,
-                      hC_copy_array[i],
-                      ldc);
-    }
+    // calculate "golden" result on CPU while the GPU computes; it writes hC_copy_array only
+    hipblas_host_reference reference([&] {
+        hipblas_batch_for(batch_count, [&](int i) {
+            cblas_gemm<T>(transA,
+                          transB,
+                          M,
+                          N,
+                          K,
+                          h_alpha,
+                          hA_array[i],
+                          lda,
+                          hB_array[i],
+                          ldb,
+                          h_beta,
+                          hC_copy_array[i],
+                          ldc);
+        });
+    });
 
     // test hipBLAS batched gemm with alpha and beta pointers on host
     {
@@ -248,29 +243,26 @@ hipblasStatus_t testing_GemmBatched(Arguments argus)
         if((status_1 != HIPBLAS_STATUS_SUCCESS) || (status_2 != HIPBLAS_STATUS_SUCCESS))
         {
             std::cout << "hipblasGemmBatched error" << std::endl;
-            hipblasDestroy(handle);
+            hipblas_client_destroy(handle);
             if(status_1 != HIPBLAS_STATUS_SUCCESS)
                 return status_1;
             if(status_2 != HIPBLAS_STATUS_SUCCESS)
                 return status_2;
         }
 
-        for(int i = 0; i < batch_count; i++)
+        // copy result matrices from device to host
+        err_C_2 = dC2_array.transfer_to(hC_array);
+        if(err_C_2 != hipSuccess)
         {
-            // copy result matrices from device to host
-            err_C_2 = hipMemcpy(
-                hC_array[i], dC2_array[i], sizeof(T) * C_mat_size, hipMemcpyDeviceToHost);
-
-            if(err_C_2 != hipSuccess)
-            {
-                hipblasDestroy(handle);
-                std::cerr << "dX_array[i] hipMemcpy error" << std::endl;
-                return HIPBLAS_STATUS_MAPPING_ERROR;
-            }
+            hipblas_client_destroy(handle);
+            std::cerr << "dX_array hipMemcpy error" << std::endl;
+            return HIPBLAS_STATUS_MAPPING_ERROR;
+        }
 
-            // check hipBLAS result against "golden" result
+        // check hipBLAS result against "golden" result
+        reference.wait();
+        for(int i = 0; i < batch_count; i++)
             unit_check_general<T>(M, N, lda, hC_copy_array[i], hC_array[i]);
-        }
     }
 
     // test hipBLAS batched gemm with alpha and beta pointers on device
@@ -296,31 +288,65 @@ hipblasStatus_t testing_GemmBatched(Arguments argus)
         if((status_1 != HIPBLAS_STATUS_SUCCESS) || (status_2 != HIPBLAS_STATUS_SUCCESS))
         {
             std::cout << "hipblasGemmBatched error" << std::endl;
-            hipblasDestroy(handle);
+            hipblas_client_destroy(handle);
             if(status_1 != HIPBLAS_STATUS_SUCCESS)
                 return status_1;
             if(status_2 != HIPBLAS_STATUS_SUCCESS)
                 return status_2;
         }
 
-        for(int i = 0; i < batch_count; i++)
+        // copy result matrices from device to host
+        err_C_1 = dC1_array.transfer_to(hC_array);
+        if(err_C_1 != hipSuccess)
         {
-            // copy result matrices from device to host
-            err_C_1 = hipMemcpy(
-                hC_array[i], dC1_array[i], sizeof(T) * C_mat_size, hipMemcpyDeviceToHost);
-
-            if(err_C_1 != hipSuccess)
-            {
-                hipblasDestroy(handle);
-                std::cerr << "hC_array[i] hipMemcpy error" << std::endl;
-                return HIPBLAS_STATUS_MAPPING_ERROR;
-            }
+            hipblas_client_destroy(handle);
+            std::cerr << "hC_array hipMemcpy error" << std::endl;
+            return HIPBLAS_STATUS_MAPPING_ERROR;
+        }
 
-            // check hipBLAS result against "golden" result
+        // check hipBLAS result against "golden" result
+        for(int i = 0; i < batch_count; i++)
             unit_check_general<T>(M, N, lda, hC_copy_array[i], hC_array[i]);
+    }
+
+    if(argus.timing)
+    {
+        hipblas_timing timing;
+        status_1 = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST);
+        status_2 = hipblas_time_launches(handle, argus, timing, [&] {
+            return hipblasGemmBatched<T>(handle,
+                                         transA,
+                                         transB,
+                                         M,
+                                         N,
+                                         K,
+                                         &h_alpha,
+                                         (const T* const*)dA_array_dev,
+                                         lda,
+                                         (const T* const*)dB_array_dev,
+                                         ldb,
+                                         &h_beta,
+                                         dC2_array_dev,
+                                         ldc,
+                                         batch_count);
+        });
+        if((status_1 != HIPBLAS_STATUS_SUCCESS) || (status_2 != HIPBLAS_STATUS_SUCCESS))
+        {
+            hipblas_client_destroy(handle);
+            return status_1 != HIPBLAS_STATUS_SUCCESS ? status_1 : status_2;
         }
+
+        double gflop = gemm_gflop_count<T>(M, N, K) * batch_count;
+        double gbyte = gemm_gbyte_count<T>(M, N, K) * batch_count;
+
+        cout << "transA,transB,M,N,K,alpha,lda,ldb,beta,ldc,batch_count," HIPBLAS_TIMING_COLUMNS
+             << endl;
+        cout << argus.transA_option << ',' << argus.transB_option << ',' << M << ',' << N << ','
+             << K << ',' << argus.alpha << ',' << lda << ',' << ldb << ',' << argus.beta << ','
+             << ldc << ',' << batch_count << ',';
+        hipblas_print_timing(cout, timing, gflop, gbyte);
     }
 
-    hipblasDestroy(handle);
+    hipblas_client_destroy(handle);
     return HIPBLAS_STATUS_SUCCESS;
 }
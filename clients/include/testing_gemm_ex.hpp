@@ -42,9 +42,9 @@ hipblasStatus_t testing_gemm_ex_template(hipblasOperation_t transA,
                                          hipblasDatatype_t  compute_type)
 {
     hipblasGemmAlgo_t algo           = HIPBLAS_GEMM_DEFAULT;
-    uint32_t          solution_index = 0;
-    uint32_t          flags          = 0;
-    size_t*           workspace_size = 0;
+    int32_t           solution_index = 0;
+    uint32_t          flags          = HIPBLAS_GEMM_FLAGS_NONE;
+    size_t            workspace_size = 1 << 20;
     void*             workspace      = 0;
 
     Td h_alpha_Td;
@@ -128,17 +128,20 @@ hipblasStatus_t testing_gemm_ex_template(hipblasOperation_t transA,
     //  Tc* d_alpha_Tc = (Tc*)d_alpha_Tc_managed.get();
     //  Tc* d_beta_Tc  = (Tc*)d_beta_Tc_managed.get();
 
-    Td *dA, *dB, *dC;
+    Td *dA, *dB, *dC, *dC_ws, *dC_lt;
     Tc *d_alpha_Tc, *d_beta_Tc;
 
     CHECK_HIP_ERROR(hipMalloc(&dA, size_A * sizeof(Td)));
     CHECK_HIP_ERROR(hipMalloc(&dB, size_B * sizeof(Td)));
     CHECK_HIP_ERROR(hipMalloc(&dC, size_C * sizeof(Td)));
+    CHECK_HIP_ERROR(hipMalloc(&dC_ws, size_C * sizeof(Td)));
+    CHECK_HIP_ERROR(hipMalloc(&dC_lt, size_C * sizeof(Td)));
+    CHECK_HIP_ERROR(hipMalloc(&workspace, workspace_size));
 
     CHECK_HIP_ERROR(hipMalloc(&d_alpha_Tc, sizeof(Td)));
     CHECK_HIP_ERROR(hipMalloc(&d_beta_Tc, sizeof(Td)));
 
-    if(!dA || !dB || !dC || !d_alpha_Tc || !d_beta_Tc)
+    if(!dA || !dB || !dC || !dC_ws || !dC_lt || !workspace || !d_alpha_Tc || !d_beta_Tc)
     {
         PRINT_IF_HIP_ERROR(hipErrorOutOfMemory);
         return HIPBLAS_STATUS_ALLOC_FAILED;
@@ -146,13 +149,15 @@ hipblasStatus_t testing_gemm_ex_template(hipblasOperation_t transA,
 
     hipblasHandle_t handle;
     hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
-    hipblasCreate(&handle);
+    hipblas_client_create(&handle);
 
     // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory
     vector<Td> hA(size_A);
     vector<Td> hB(size_B);
     vector<Td> hC(size_C);
     vector<Td> hC_gold(size_C);
+    vector<Td> hC_ws(size_C);
+    vector<Td> hC_lt(size_C);
 
     // Initial Data on CPU
     srand(1);
@@ -191,6 +196,8 @@ hipblasStatus_t testing_gemm_ex_template(hipblasOperation_t transA,
     CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(Td) * size_A, hipMemcpyHostToDevice));
     CHECK_HIP_ERROR(hipMemcpy(dB, hB.data(), sizeof(Td) * size_B, hipMemcpyHostToDevice));
     CHECK_HIP_ERROR(hipMemcpy(dC, hC.data(), sizeof(Td) * size_C, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC_ws, hC.data(), sizeof(Td) * size_C, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC_lt, hC.data(), sizeof(Td) * size_C, hipMemcpyHostToDevice));
 
     status = hipblasGemmEx(handle,
                            transA,
@@ -212,13 +219,66 @@ hipblasStatus_t testing_gemm_ex_template(hipblasOperation_t transA,
                            compute_type,
                            algo);
 
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasGemmExWithSolution(handle,
+                                           transA,
+                                           transB,
+                                           M,
+                                           N,
+                                           K,
+                                           &h_alpha_Tc,
+                                           dA,
+                                           a_type,
+                                           lda,
+                                           dB,
+                                           b_type,
+                                           ldb,
+                                           &h_beta_Tc,
+                                           dC_ws,
+                                           c_type,
+                                           ldc,
+                                           compute_type,
+                                           algo,
+                                           solution_index,
+                                           flags,
+                                           workspace_size,
+                                           workspace);
+
+    // the Lt preference falls back to the classic path where it is unavailable, so every
+    // backend must give the same result
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasSetGemmBackend(handle, HIPBLAS_GEMM_BACKEND_LT);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasGemmEx(handle,
+                               transA,
+                               transB,
+                               M,
+                               N,
+                               K,
+                               &h_alpha_Tc,
+                               dA,
+                               a_type,
+                               lda,
+                               dB,
+                               b_type,
+                               ldb,
+                               &h_beta_Tc,
+                               dC_lt,
+                               c_type,
+                               ldc,
+                               compute_type,
+                               algo);
+
     if(status != HIPBLAS_STATUS_SUCCESS)
     {
-        hipblasDestroy(handle);
+        hipblas_client_destroy(handle);
 
         CHECK_HIP_ERROR(hipFree(dA));
         CHECK_HIP_ERROR(hipFree(dB));
         CHECK_HIP_ERROR(hipFree(dC));
+        CHECK_HIP_ERROR(hipFree(dC_ws));
+        CHECK_HIP_ERROR(hipFree(dC_lt));
+        CHECK_HIP_ERROR(hipFree(workspace));
 
         CHECK_HIP_ERROR(hipFree(d_alpha_Tc));
         CHECK_HIP_ERROR(hipFree(d_beta_Tc));
@@ -226,6 +286,8 @@ hipblasStatus_t testing_gemm_ex_template(hipblasOperation_t transA,
     }
 
     CHECK_HIP_ERROR(hipMemcpy(hC.data(), dC, sizeof(Td) * size_C, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hC_ws.data(), dC_ws, sizeof(Td) * size_C, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hC_lt.data(), dC_lt, sizeof(Td) * size_C, hipMemcpyDeviceToHost));
 
     //      std::cout << std::endl << "-----hD_1---------------------------------------" <<
     //      std::endl;
@@ -277,12 +339,17 @@ hipblasStatus_t testing_gemm_ex_template(hipblasOperation_t transA,
     if(unit_check)
     {
         unit_check_general<Td>(M, N, ldc, hC_gold.data(), hC.data());
+        unit_check_general<Td>(M, N, ldc, hC_gold.data(), hC_ws.data());
+        unit_check_general<Td>(M, N, ldc, hC_gold.data(), hC_lt.data());
     }
 
-    hipblasDestroy(handle);
+    hipblas_client_destroy(handle);
     CHECK_HIP_ERROR(hipFree(dA));
     CHECK_HIP_ERROR(hipFree(dB));
     CHECK_HIP_ERROR(hipFree(dC));
+    CHECK_HIP_ERROR(hipFree(dC_ws));
+    CHECK_HIP_ERROR(hipFree(dC_lt));
+    CHECK_HIP_ERROR(hipFree(workspace));
 
     CHECK_HIP_ERROR(hipFree(d_alpha_Tc));
     CHECK_HIP_ERROR(hipFree(d_beta_Tc));
@@ -290,6 +357,116 @@ hipblasStatus_t testing_gemm_ex_template(hipblasOperation_t transA,
     return status;
 }
 
+// int8 inputs with int32 accumulation and output; checked exactly against a host reference
+hipblasStatus_t testing_gemm_ex_int8_template(hipblasOperation_t transA,
+                                              hipblasOperation_t transB,
+                                              int                M,
+                                              int                N,
+                                              int                K,
+                                              float              alpha_float,
+                                              int                lda,
+                                              int                ldb,
+                                              float              beta_float,
+                                              int                ldc,
+                                              int                unit_check)
+{
+    int32_t h_alpha = static_cast<int32_t>(alpha_float);
+    int32_t h_beta  = static_cast<int32_t>(beta_float);
+
+    int A_row = transA == HIPBLAS_OP_N ? M : K;
+    int A_col = transA == HIPBLAS_OP_N ? K : M;
+    int B_row = transB == HIPBLAS_OP_N ? K : N;
+    int B_col = transB == HIPBLAS_OP_N ? N : K;
+
+    // check here to prevent undefined memory allocation error
+    if(M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+
+    const size_t size_A = static_cast<size_t>(lda) * static_cast<size_t>(A_col);
+    const size_t size_B = static_cast<size_t>(ldb) * static_cast<size_t>(B_col);
+    const size_t size_C = static_cast<size_t>(ldc) * static_cast<size_t>(N);
+
+    vector<int8_t>  hA(size_A);
+    vector<int8_t>  hB(size_B);
+    vector<int32_t> hC(size_C);
+    vector<int32_t> hC_gold(size_C);
+
+    srand(1);
+    hipblas_init<int8_t>(hA, A_row, A_col, lda);
+    hipblas_init_alternating_sign<int8_t>(hB, B_row, B_col, ldb);
+    hipblas_init<int32_t>(hC, M, N, ldc);
+    hC_gold = hC;
+
+    int8_t *dA, *dB;
+    int32_t* dC;
+    CHECK_HIP_ERROR(hipMalloc(&dA, size_A * sizeof(int8_t)));
+    CHECK_HIP_ERROR(hipMalloc(&dB, size_B * sizeof(int8_t)));
+    CHECK_HIP_ERROR(hipMalloc(&dC, size_C * sizeof(int32_t)));
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(int8_t) * size_A, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB.data(), sizeof(int8_t) * size_B, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC, hC.data(), sizeof(int32_t) * size_C, hipMemcpyHostToDevice));
+
+    hipblasHandle_t handle;
+    hipblas_client_create(&handle);
+
+    hipblasStatus_t status = hipblasGemmEx(handle,
+                                           transA,
+                                           transB,
+                                           M,
+                                           N,
+                                           K,
+                                           &h_alpha,
+                                           dA,
+                                           HIPBLAS_R_8I,
+                                           lda,
+                                           dB,
+                                           HIPBLAS_R_8I,
+                                           ldb,
+                                           &h_beta,
+                                           dC,
+                                           HIPBLAS_R_32I,
+                                           ldc,
+                                           HIPBLAS_R_32I,
+                                           HIPBLAS_GEMM_DEFAULT);
+
+    if(status == HIPBLAS_STATUS_SUCCESS)
+    {
+        CHECK_HIP_ERROR(
+            hipMemcpy(hC.data(), dC, sizeof(int32_t) * size_C, hipMemcpyDeviceToHost));
+
+        // CPU reference; cblas has no int8 gemm
+        for(int j = 0; j < N; j++)
+        {
+            for(int i = 0; i < M; i++)
+            {
+                int32_t sum = 0;
+                for(int l = 0; l < K; l++)
+                {
+                    int32_t a = transA == HIPBLAS_OP_N ? hA[i + l * lda] : hA[l + i * lda];
+                    int32_t b = transB == HIPBLAS_OP_N ? hB[l + j * ldb] : hB[j + l * ldb];
+                    sum += a * b;
+                }
+                hC_gold[i + j * ldc] = h_alpha * sum + h_beta * hC_gold[i + j * ldc];
+            }
+        }
+
+        if(unit_check)
+        {
+            unit_check_general<int32_t>(M, N, ldc, hC_gold.data(), hC.data());
+        }
+    }
+
+    hipblas_client_destroy(handle);
+    CHECK_HIP_ERROR(hipFree(dA));
+    CHECK_HIP_ERROR(hipFree(dB));
+    CHECK_HIP_ERROR(hipFree(dC));
+
+    return status;
+}
+
 hipblasStatus_t testing_gemm_ex(Arguments argus)
 {
     hipblasOperation_t transA = char2hipblas_operation(argus.transA_option);
@@ -396,6 +573,12 @@ hipblasStatus_t testing_gemm_ex(Arguments argus)
                                                           c_type,
                                                           compute_type);
     }
+    else if(a_type == HIPBLAS_R_8I && b_type == HIPBLAS_R_8I && c_type == HIPBLAS_R_32I
+            && compute_type == HIPBLAS_R_32I)
+    {
+        status = testing_gemm_ex_int8_template(
+            transA, transB, M, N, K, alpha, lda, ldb, beta, ldc, unit_check);
+    }
     else
     {
         status = HIPBLAS_STATUS_NOT_SUPPORTED;
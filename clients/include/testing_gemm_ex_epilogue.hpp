@@ -0,0 +1,168 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <math.h>
+#include <stdlib.h>
+#include <vector>
+
+#include "cblas_interface.h"
+#include "hipblas.hpp"
+#include "near.h"
+#include "norm.h"
+#include "unit.h"
+#include "utility.h"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+template <typename T>
+static T gemm_epilogue_reference(hipblasActivation_t activation, T x)
+{
+    if(activation == HIPBLAS_ACTIVATION_RELU)
+        return x > 0 ? x : 0;
+    if(activation == HIPBLAS_ACTIVATION_GELU)
+        return 0.5 * x * (1 + tanh(0.7978845608028654 * (x + 0.044715 * x * x * x)));
+    return x;
+}
+
+// Runs every activation with a bias, an aux output and an output scale of 2
+template <typename T>
+hipblasStatus_t testing_gemm_ex_epilogue(Arguments argus)
+{
+    int M = argus.M;
+    int N = argus.N;
+    int K = argus.K;
+
+    int lda = argus.lda;
+    int ldb = argus.ldb;
+    int ldc = argus.ldc;
+
+    hipblasOperation_t transA = char2hipblas_operation(argus.transA_option);
+    hipblasOperation_t transB = char2hipblas_operation(argus.transB_option);
+    hipblasDatatype_t  type   = hipblas_datatype<T>;
+
+    T alpha = argus.alpha;
+    T beta  = argus.beta;
+
+    int A_row = transA == HIPBLAS_OP_N ? M : K;
+    int A_col = transA == HIPBLAS_OP_N ? K : M;
+    int B_row = transB == HIPBLAS_OP_N ? K : N;
+    int B_col = transB == HIPBLAS_OP_N ? N : K;
+
+    // check here to prevent undefined memory allocation error
+    if(M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+
+    int A_size = lda * A_col;
+    int B_size = ldb * B_col;
+    int C_size = ldc * N;
+
+    // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory, plz follow this practice
+    host_vector<T> hA(A_size);
+    host_vector<T> hB(B_size);
+    host_vector<T> hC(C_size);
+    host_vector<T> hbias(M);
+    host_vector<T> hC_gemm(C_size);
+    host_vector<T> hC_cpu(C_size);
+    host_vector<T> haux_cpu(C_size);
+    host_vector<T> hC_gpu(C_size);
+    host_vector<T> haux_gpu(C_size);
+
+    device_vector<T> dA(A_size);
+    device_vector<T> dB(B_size);
+    device_vector<T> dC(C_size);
+    device_vector<T> dbias(M);
+    device_vector<T> daux(C_size);
+
+    hipblasHandle_t handle;
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+    hipblas_client_create(&handle);
+
+    // Initial Data on CPU
+    srand(1);
+    hipblas_init<T>(hA, A_row, A_col, lda);
+    hipblas_init<T>(hB, B_row, B_col, ldb);
+    hipblas_init<T>(hC, M, N, ldc);
+    hipblas_init_alternating_sign<T>(hbias, 1, M, 1);
+
+    hC_gemm = hC;
+    cblas_gemm<T>(
+        transA, transB, M, N, K, alpha, hA.data(), lda, hB.data(), ldb, beta, hC_gemm.data(), ldc);
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * A_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB.data(), sizeof(T) * B_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dbias, hbias.data(), sizeof(T) * M, hipMemcpyHostToDevice));
+
+    for(hipblasActivation_t activation :
+        {HIPBLAS_ACTIVATION_NONE, HIPBLAS_ACTIVATION_RELU, HIPBLAS_ACTIVATION_GELU})
+    {
+        hipblasGemmEpilogue_t epilogue = {activation, dbias, 2.0, daux, ldc};
+
+        CHECK_HIP_ERROR(hipMemcpy(dC, hC.data(), sizeof(T) * C_size, hipMemcpyHostToDevice));
+
+        /* =====================================================================
+             ROCBLAS
+        =================================================================== */
+        status = hipblasGemmExWithEpilogue(handle,
+                                           transA,
+                                           transB,
+                                           M,
+                                           N,
+                                           K,
+                                           &alpha,
+                                           dA,
+                                           type,
+                                           lda,
+                                           dB,
+                                           type,
+                                           ldb,
+                                           &beta,
+                                           dC,
+                                           type,
+                                           ldc,
+                                           type,
+                                           HIPBLAS_GEMM_DEFAULT,
+                                           &epilogue);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            hipblas_client_destroy(handle);
+            return status;
+        }
+
+        CHECK_HIP_ERROR(hipMemcpy(hC_gpu.data(), dC, sizeof(T) * C_size, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(haux_gpu.data(), daux, sizeof(T) * C_size, hipMemcpyDeviceToHost));
+
+        if(argus.unit_check)
+        {
+            /* =====================================================================
+                        CPU BLAS
+            =================================================================== */
+            for(int j = 0; j < N; j++)
+            {
+                for(int i = 0; i < M; i++)
+                {
+                    T p                   = hC_gemm[i + j * ldc] + hbias[i];
+                    haux_cpu[i + j * ldc] = p;
+                    hC_cpu[i + j * ldc]   = 2 * gemm_epilogue_reference(activation, p);
+                }
+            }
+
+            unit_check_general<T>(M, N, ldc, haux_cpu.data(), haux_gpu.data());
+            if(activation == HIPBLAS_ACTIVATION_GELU)
+                near_check_general<T>(M, N, ldc, hC_cpu.data(), hC_gpu.data(), 1e-3);
+            else
+                unit_check_general<T>(M, N, ldc, hC_cpu.data(), hC_gpu.data());
+        }
+    }
+
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,212 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <math.h>
+#include <stdlib.h>
+#include <vector>
+
+#include "cblas_interface.h"
+#include "hipblas.hpp"
+#include "near.h"
+#include "norm.h"
+#include "unit.h"
+#include "utility.h"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+// The fp8 encoding of v, which must be 0 or a normal value exact in the format
+static uint8_t fp8_exact_bits(float v, int mantissa_bits, int bias)
+{
+    if(v == 0)
+        return 0;
+    int   e;
+    float f = frexpf(fabsf(v), &e);
+    return (v < 0 ? 0x80 : 0) | (e - 1 + bias) << mantissa_bits
+           | int((2 * f - 1) * (1 << mantissa_bits));
+}
+
+// A in E4M3 and B in E5M2 hold integers in [-4, 4], which both formats store exactly, so with
+// power-of-two scales the only rounding left is the fp32 gemm's own
+template <typename T>
+hipblasStatus_t testing_gemm_ex_scales(Arguments argus)
+{
+    int M = argus.M;
+    int N = argus.N;
+    int K = argus.K;
+
+    int lda = argus.lda;
+    int ldb = argus.ldb;
+    int ldc = argus.ldc;
+
+    hipblasOperation_t transA = char2hipblas_operation(argus.transA_option);
+    hipblasOperation_t transB = char2hipblas_operation(argus.transB_option);
+    hipblasDatatype_t  type   = hipblas_datatype<T>;
+
+    float alpha = argus.alpha;
+    float beta  = argus.beta;
+
+    int A_row = transA == HIPBLAS_OP_N ? M : K;
+    int A_col = transA == HIPBLAS_OP_N ? K : M;
+    int B_row = transB == HIPBLAS_OP_N ? K : N;
+    int B_col = transB == HIPBLAS_OP_N ? N : K;
+
+    // check here to prevent undefined memory allocation error
+    if(M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+
+    int A_size = lda * A_col;
+    int B_size = ldb * B_col;
+    int C_size = ldc * N;
+
+    // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory, plz follow this practice
+    host_vector<uint8_t> hA(A_size);
+    host_vector<uint8_t> hB(B_size);
+    host_vector<T>       hA_value(A_size);
+    host_vector<T>       hB_value(B_size);
+    host_vector<T>       hC(C_size);
+    host_vector<T>       hD_cpu(C_size);
+    host_vector<T>       hD_gpu(C_size);
+
+    device_vector<uint8_t> dA(A_size);
+    device_vector<uint8_t> dB(B_size);
+    device_vector<T>       dC(C_size);
+    device_vector<T>       dD(C_size);
+    device_vector<float>   dscales(5);
+
+    hipblasHandle_t handle;
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+    hipblas_client_create(&handle);
+
+    // Initial Data on CPU
+    srand(1);
+    for(int i = 0; i < A_size; i++)
+    {
+        hA_value[i] = T(rand() % 9 - 4);
+        hA[i]       = fp8_exact_bits(hA_value[i], 3, 7);
+    }
+    for(int i = 0; i < B_size; i++)
+    {
+        hB_value[i] = T(rand() % 9 - 4);
+        hB[i]       = fp8_exact_bits(hB_value[i], 2, 15);
+    }
+    hipblas_init<T>(hC, M, N, ldc);
+
+    // scale_a, scale_b, scale_c, scale_d and amax_d
+    float hscales[5] = {0.5f, 4.0f, 2.0f, 0.25f, -1.0f};
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), A_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB.data(), B_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC, hC.data(), sizeof(T) * C_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dscales, hscales, sizeof(hscales), hipMemcpyHostToDevice));
+
+    hipblasGemmScales_t scales = {dscales, dscales + 1, dscales + 2, dscales + 3, dscales + 4};
+
+    /* =====================================================================
+         ROCBLAS
+    =================================================================== */
+    status = hipblasGemmExWithScales(handle,
+                                     transA,
+                                     transB,
+                                     M,
+                                     N,
+                                     K,
+                                     &alpha,
+                                     dA,
+                                     HIPBLAS_R_8F_E4M3,
+                                     lda,
+                                     dB,
+                                     HIPBLAS_R_8F_E5M2,
+                                     ldb,
+                                     &beta,
+                                     dC,
+                                     type,
+                                     ldc,
+                                     dD,
+                                     type,
+                                     ldc,
+                                     HIPBLAS_R_32F,
+                                     HIPBLAS_GEMM_DEFAULT,
+                                     &scales);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    CHECK_HIP_ERROR(hipMemcpy(hD_gpu.data(), dD, sizeof(T) * C_size, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hscales, dscales, sizeof(hscales), hipMemcpyDeviceToHost));
+
+    if(argus.unit_check)
+    {
+        /* =====================================================================
+                    CPU BLAS
+        =================================================================== */
+        for(int j = 0; j < N; j++)
+            for(int i = 0; i < M; i++)
+                hD_cpu[i + j * ldc] = 2 * hC[i + j * ldc];
+        cblas_gemm<T>(transA,
+                      transB,
+                      M,
+                      N,
+                      K,
+                      T(alpha * 0.5f * 4.0f),
+                      hA_value.data(),
+                      lda,
+                      hB_value.data(),
+                      ldb,
+                      T(beta),
+                      hD_cpu.data(),
+                      ldc);
+
+        T amax = 0;
+        for(int j = 0; j < N; j++)
+        {
+            for(int i = 0; i < M; i++)
+            {
+                amax = std::max(amax, T(fabs(hD_cpu[i + j * ldc])));
+                hD_cpu[i + j * ldc] *= 0.25f;
+            }
+        }
+
+        double tolerance = 1e-6 * std::max(T(1), amax);
+        near_check_general<T>(M, N, ldc, hD_cpu.data(), hD_gpu.data(), 0.25 * tolerance);
+        EXPECT_NEAR(amax, hscales[4], tolerance);
+    }
+
+    // a non-fp8 A is not a scaled gemm
+    EXPECT_EQ(HIPBLAS_STATUS_NOT_SUPPORTED,
+              hipblasGemmExWithScales(handle,
+                                      transA,
+                                      transB,
+                                      M,
+                                      N,
+                                      K,
+                                      &alpha,
+                                      dD,
+                                      type,
+                                      lda,
+                                      dB,
+                                      HIPBLAS_R_8F_E5M2,
+                                      ldb,
+                                      &beta,
+                                      dC,
+                                      type,
+                                      ldc,
+                                      dD,
+                                      type,
+                                      ldc,
+                                      HIPBLAS_R_32F,
+                                      HIPBLAS_GEMM_DEFAULT,
+                                      &scales));
+
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,208 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <math.h>
+#include <stdlib.h>
+#include <vector>
+
+#include "cblas_interface.h"
+#include "hipblas.hpp"
+#include "near.h"
+#include "norm.h"
+#include "unit.h"
+#include "utility.h"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+// hipblasGemmExWithD and hipblasGemmStridedBatchedExWithD with D apart from C and ldd != ldc, on
+// small integers so the results are exact. D must match the reference product and C must be left
+// as it was
+template <typename T>
+hipblasStatus_t testing_gemm_ex_with_d(Arguments argus)
+{
+    int M = argus.M;
+    int N = argus.N;
+    int K = argus.K;
+
+    int lda = argus.lda;
+    int ldb = argus.ldb;
+    int ldc = argus.ldc;
+    int ldd = ldc + 3;
+
+    hipblasOperation_t transA = char2hipblas_operation(argus.transA_option);
+    hipblasOperation_t transB = char2hipblas_operation(argus.transB_option);
+    hipblasDatatype_t  type   = hipblas_datatype<T>;
+
+    T alpha = argus.alpha;
+    T beta  = argus.beta;
+
+    int A_row = transA == HIPBLAS_OP_N ? M : K;
+    int A_col = transA == HIPBLAS_OP_N ? K : M;
+    int B_row = transB == HIPBLAS_OP_N ? K : N;
+    int B_col = transB == HIPBLAS_OP_N ? N : K;
+
+    // check here to prevent undefined memory allocation error
+    if(M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+
+    // two batches for the strided form, each batch of D after the first at an odd stride
+    const int batch_count = 2;
+    int       A_size      = lda * A_col;
+    int       B_size      = ldb * B_col;
+    int       C_size      = ldc * N;
+    int       D_size      = ldd * N + 1;
+
+    // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory, plz follow this practice
+    host_vector<T> hA(A_size * batch_count);
+    host_vector<T> hB(B_size * batch_count);
+    host_vector<T> hC(C_size * batch_count);
+    host_vector<T> hC_gpu(C_size * batch_count);
+    host_vector<T> hD_cpu(D_size * batch_count);
+    host_vector<T> hD_gpu(D_size * batch_count);
+
+    device_vector<T> dA(A_size * batch_count);
+    device_vector<T> dB(B_size * batch_count);
+    device_vector<T> dC(C_size * batch_count);
+    device_vector<T> dD(D_size * batch_count);
+
+    hipblasHandle_t handle;
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+    hipblas_client_create(&handle);
+
+    // Initial Data on CPU
+    srand(1);
+    hipblas_init<T>(hA, A_row, A_col, lda, A_size, batch_count);
+    hipblas_init<T>(hB, B_row, B_col, ldb, B_size, batch_count);
+    hipblas_init<T>(hC, M, N, ldc, C_size, batch_count);
+    for(int b = 0; b < batch_count; b++)
+    {
+        for(int j = 0; j < N; j++)
+            for(int i = 0; i < M; i++)
+                hD_cpu[i + j * ldd + b * D_size] = hC[i + j * ldc + b * C_size];
+        cblas_gemm<T>(transA,
+                      transB,
+                      M,
+                      N,
+                      K,
+                      alpha,
+                      hA.data() + b * A_size,
+                      lda,
+                      hB.data() + b * B_size,
+                      ldb,
+                      beta,
+                      hD_cpu.data() + b * D_size,
+                      ldd);
+    }
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * hA.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB.data(), sizeof(T) * hB.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC, hC.data(), sizeof(T) * hC.size(), hipMemcpyHostToDevice));
+
+    /* =====================================================================
+         ROCBLAS
+    =================================================================== */
+    status = hipblasGemmExWithD(handle,
+                                transA,
+                                transB,
+                                M,
+                                N,
+                                K,
+                                &alpha,
+                                dA,
+                                type,
+                                lda,
+                                dB,
+                                type,
+                                ldb,
+                                &beta,
+                                dC,
+                                type,
+                                ldc,
+                                dD,
+                                type,
+                                ldd,
+                                type,
+                                HIPBLAS_GEMM_DEFAULT);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_client_destroy(handle);
+        return status;
+    }
+    CHECK_HIP_ERROR(hipMemcpy(hD_gpu.data(), dD, sizeof(T) * D_size, hipMemcpyDeviceToHost));
+
+    if(argus.unit_check)
+    {
+        unit_check_general<T>(M, N, ldd, hD_cpu.data(), hD_gpu.data());
+
+        EXPECT_EQ(HIPBLAS_STATUS_SUCCESS,
+                  hipblasGemmStridedBatchedExWithD(handle,
+                                                   transA,
+                                                   transB,
+                                                   M,
+                                                   N,
+                                                   K,
+                                                   &alpha,
+                                                   dA,
+                                                   type,
+                                                   lda,
+                                                   A_size,
+                                                   dB,
+                                                   type,
+                                                   ldb,
+                                                   B_size,
+                                                   &beta,
+                                                   dC,
+                                                   type,
+                                                   ldc,
+                                                   C_size,
+                                                   dD,
+                                                   type,
+                                                   ldd,
+                                                   D_size,
+                                                   batch_count,
+                                                   type,
+                                                   HIPBLAS_GEMM_DEFAULT));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hD_gpu.data(), dD, sizeof(T) * hD_gpu.size(), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hC_gpu.data(), dC, sizeof(T) * hC_gpu.size(), hipMemcpyDeviceToHost));
+        unit_check_general<T>(M, N, batch_count, ldd, D_size, hD_cpu.data(), hD_gpu.data());
+        unit_check_general<T>(M, N, batch_count, ldc, C_size, hC.data(), hC_gpu.data());
+
+        // D of another type is not supported
+        EXPECT_EQ(HIPBLAS_STATUS_NOT_SUPPORTED,
+                  hipblasGemmExWithD(handle,
+                                     transA,
+                                     transB,
+                                     M,
+                                     N,
+                                     K,
+                                     &alpha,
+                                     dA,
+                                     type,
+                                     lda,
+                                     dB,
+                                     type,
+                                     ldb,
+                                     &beta,
+                                     dC,
+                                     type,
+                                     ldc,
+                                     dD,
+                                     HIPBLAS_R_16F,
+                                     ldd,
+                                     type,
+                                     HIPBLAS_GEMM_DEFAULT));
+    }
+
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,154 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <math.h>
+#include <stdlib.h>
+#include <vector>
+
+#include "cblas_interface.h"
+#include "hipblas.hpp"
+#include "near.h"
+#include "norm.h"
+#include "unit.h"
+#include "utility.h"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+// hipblasSgemm under HIPBLAS_BF16X3_MATH and hipblasGemmEx with the fast compute types, on
+// inputs in [-1, 1) with low bits set so the bf16 low parts are not zero. Each result is checked
+// against the error bound documented for its path, k |alpha| 2^-14 for bf16x3 and k |alpha| 2^-10
+// for TF32, plus the fp32 accumulation
+hipblasStatus_t testing_gemm_fast_fp32(Arguments argus)
+{
+    int M = argus.M;
+    int N = argus.N;
+    int K = argus.K;
+
+    int lda = argus.lda;
+    int ldb = argus.ldb;
+    int ldc = argus.ldc;
+
+    hipblasOperation_t transA = char2hipblas_operation(argus.transA_option);
+    hipblasOperation_t transB = char2hipblas_operation(argus.transB_option);
+
+    float alpha = argus.alpha;
+    float beta  = argus.beta;
+
+    int A_row = transA == HIPBLAS_OP_N ? M : K;
+    int A_col = transA == HIPBLAS_OP_N ? K : M;
+    int B_row = transB == HIPBLAS_OP_N ? K : N;
+    int B_col = transB == HIPBLAS_OP_N ? N : K;
+
+    // check here to prevent undefined memory allocation error
+    if(M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+
+    int A_size = lda * A_col;
+    int B_size = ldb * B_col;
+    int C_size = ldc * N;
+
+    // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory, plz follow this practice
+    host_vector<float> hA(A_size);
+    host_vector<float> hB(B_size);
+    host_vector<float> hC(C_size);
+    host_vector<float> hC_cpu(C_size);
+    host_vector<float> hC_gpu(C_size);
+    host_vector<float> hC_ex(C_size);
+
+    device_vector<float> dA(A_size);
+    device_vector<float> dB(B_size);
+    device_vector<float> dC(C_size);
+
+    hipblasHandle_t handle;
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+    hipblas_client_create(&handle);
+
+    // Initial Data on CPU
+    srand(1);
+    for(auto* v : {&hA, &hB, &hC})
+        for(float& x : *v)
+            x = float(rand()) / RAND_MAX * 2 - 1;
+
+    hC_cpu = hC;
+    cblas_gemm<float>(
+        transA, transB, M, N, K, alpha, hA.data(), lda, hB.data(), ldb, beta, hC_cpu.data(), ldc);
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(float) * A_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB.data(), sizeof(float) * B_size, hipMemcpyHostToDevice));
+
+    auto gemm_ex = [&](hipblasDatatype_t compute_type, host_vector<float>& result) {
+        CHECK_HIP_ERROR(hipMemcpy(dC, hC.data(), sizeof(float) * C_size, hipMemcpyHostToDevice));
+        hipblasStatus_t gemm_status = hipblasGemmEx(handle,
+                                                    transA,
+                                                    transB,
+                                                    M,
+                                                    N,
+                                                    K,
+                                                    &alpha,
+                                                    dA,
+                                                    HIPBLAS_R_32F,
+                                                    lda,
+                                                    dB,
+                                                    HIPBLAS_R_32F,
+                                                    ldb,
+                                                    &beta,
+                                                    dC,
+                                                    HIPBLAS_R_32F,
+                                                    ldc,
+                                                    compute_type,
+                                                    HIPBLAS_GEMM_DEFAULT);
+        CHECK_HIP_ERROR(
+            hipMemcpy(result.data(), dC, sizeof(float) * C_size, hipMemcpyDeviceToHost));
+        return gemm_status;
+    };
+
+    /* =====================================================================
+         ROCBLAS
+    =================================================================== */
+    CHECK_HIP_ERROR(hipMemcpy(dC, hC.data(), sizeof(float) * C_size, hipMemcpyHostToDevice));
+    status = hipblasSetMathMode(handle, HIPBLAS_BF16X3_MATH);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasSgemm(
+            handle, transA, transB, M, N, K, &alpha, dA, lda, dB, ldb, &beta, dC, ldc);
+    hipblasSetMathMode(handle, HIPBLAS_DEFAULT_MATH);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_client_destroy(handle);
+        return status;
+    }
+    CHECK_HIP_ERROR(hipMemcpy(hC_gpu.data(), dC, sizeof(float) * C_size, hipMemcpyDeviceToHost));
+
+    if(argus.unit_check)
+    {
+        double accumulation = (K + 2) * std::abs(alpha) * pow(2.0, -23);
+        near_check_general<float>(M,
+                                  N,
+                                  ldc,
+                                  hC_cpu.data(),
+                                  hC_gpu.data(),
+                                  K * std::abs(alpha) * pow(2.0, -14) + accumulation);
+
+        // the compute type takes the same path as the math mode
+        EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, gemm_ex(HIPBLAS_COMPUTE_32F_FAST_BF16X3, hC_ex));
+        unit_check_general<float>(M, N, ldc, hC_gpu.data(), hC_ex.data());
+
+        EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, gemm_ex(HIPBLAS_COMPUTE_32F_FAST_TF32, hC_ex));
+        near_check_general<float>(M,
+                                  N,
+                                  ldc,
+                                  hC_cpu.data(),
+                                  hC_ex.data(),
+                                  K * std::abs(alpha) * pow(2.0, -10) + accumulation);
+    }
+
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
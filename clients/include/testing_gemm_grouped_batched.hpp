@@ -0,0 +1,226 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <sys/time.h>
+#include <vector>
+
+#include "cblas_interface.h"
+#include "flops.h"
+#include "hipblas.hpp"
+#include "norm.h"
+#include "unit.h"
+#include "utility.h"
+#include <typeinfo>
+
+using namespace std;
+
+/* ============================================================================================ */
+
+// Each group grows the sizes and leading dimensions of the previous one and runs batch_count
+// gemms, so the groups differ in every per-group argument
+template <typename T>
+hipblasStatus_t testing_gemm_grouped_batched(Arguments argus)
+{
+    const int group_count = 3;
+
+    int batch_count = argus.batch_count;
+
+    hipblasOperation_t transA = char2hipblas_operation(argus.transA_option);
+    hipblasOperation_t transB = char2hipblas_operation(argus.transB_option);
+
+    vector<hipblasOperation_t> transa_array(group_count, transA), transb_array(group_count, transB);
+    vector<int> m_array(group_count), n_array(group_count), k_array(group_count);
+    vector<int> lda_array(group_count), ldb_array(group_count), ldc_array(group_count);
+    vector<int> group_size(group_count, batch_count);
+    vector<T>   alpha_array(group_count), beta_array(group_count);
+
+    for(int g = 0; g < group_count; g++)
+    {
+        m_array[g]     = argus.M + g;
+        n_array[g]     = argus.N + 2 * g;
+        k_array[g]     = argus.K + g;
+        lda_array[g]   = (transA == HIPBLAS_OP_N ? m_array[g] : k_array[g]) + g;
+        ldb_array[g]   = (transB == HIPBLAS_OP_N ? k_array[g] : n_array[g]) + g;
+        ldc_array[g]   = m_array[g] + g;
+        alpha_array[g] = argus.alpha * (g + 1);
+        beta_array[g]  = argus.beta;
+    }
+
+    hipblasHandle_t handle;
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+    hipblas_client_create(&handle);
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    if(argus.M < 0 || argus.N < 0 || argus.K < 0 || batch_count < 0)
+    {
+        status = hipblasGemmGroupedBatched<T>(handle,
+                                              transa_array.data(),
+                                              transb_array.data(),
+                                              m_array.data(),
+                                              n_array.data(),
+                                              k_array.data(),
+                                              alpha_array.data(),
+                                              nullptr,
+                                              lda_array.data(),
+                                              nullptr,
+                                              ldb_array.data(),
+                                              beta_array.data(),
+                                              nullptr,
+                                              ldc_array.data(),
+                                              group_count,
+                                              group_size.data());
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    // every matrix of every group is stored back to back in one buffer per operand
+    int         total = group_count * batch_count;
+    vector<int> offset_A(total + 1, 0), offset_B(total + 1, 0), offset_C(total + 1, 0);
+    for(int g = 0, i = 0; g < group_count; g++)
+    {
+        int A_col = transA == HIPBLAS_OP_N ? k_array[g] : m_array[g];
+        int B_col = transB == HIPBLAS_OP_N ? n_array[g] : k_array[g];
+        for(int b = 0; b < batch_count; b++, i++)
+        {
+            offset_A[i + 1] = offset_A[i] + lda_array[g] * A_col;
+            offset_B[i + 1] = offset_B[i] + ldb_array[g] * B_col;
+            offset_C[i + 1] = offset_C[i] + ldc_array[g] * n_array[g];
+        }
+    }
+
+    // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory, plz follow this practice
+    host_vector<T> hA(offset_A[total]);
+    host_vector<T> hB(offset_B[total]);
+    host_vector<T> hC(offset_C[total]);
+    host_vector<T> hC_copy(offset_C[total]);
+
+    device_vector<T> dA(offset_A[total]);
+    device_vector<T> dB(offset_B[total]);
+    device_vector<T> dC(offset_C[total]);
+
+    // arrays of pointers-to-device on host and on device
+    vector<T*>              hA_ptr(total), hB_ptr(total), hC_ptr(total);
+    device_vector<T*, 0, T> dA_array(total);
+    device_vector<T*, 0, T> dB_array(total);
+    device_vector<T*, 0, T> dC_array(total);
+
+    srand(1);
+    hipblas_init<T>(hA, 1, offset_A[total], 1);
+    hipblas_init<T>(hB, 1, offset_B[total], 1);
+    hipblas_init<T>(hC, 1, offset_C[total], 1);
+    hC_copy = hC;
+
+    for(int i = 0; i < total; i++)
+    {
+        hA_ptr[i] = (T*)dA + offset_A[i];
+        hB_ptr[i] = (T*)dB + offset_B[i];
+        hC_ptr[i] = (T*)dC + offset_C[i];
+    }
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * offset_A[total], hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB.data(), sizeof(T) * offset_B[total], hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC, hC.data(), sizeof(T) * offset_C[total], hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dA_array, hA_ptr.data(), sizeof(T*) * total, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB_array, hB_ptr.data(), sizeof(T*) * total, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC_array, hC_ptr.data(), sizeof(T*) * total, hipMemcpyHostToDevice));
+
+    /* =====================================================================
+         ROCBLAS
+    =================================================================== */
+    auto run = [&] {
+        return hipblasGemmGroupedBatched<T>(handle,
+                                            transa_array.data(),
+                                            transb_array.data(),
+                                            m_array.data(),
+                                            n_array.data(),
+                                            k_array.data(),
+                                            alpha_array.data(),
+                                            (const T* const*)dA_array,
+                                            lda_array.data(),
+                                            (const T* const*)dB_array,
+                                            ldb_array.data(),
+                                            beta_array.data(),
+                                            dC_array,
+                                            ldc_array.data(),
+                                            group_count,
+                                            group_size.data());
+    };
+
+    // the scalars are host arrays whatever the pointer mode
+    status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = run();
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    CHECK_HIP_ERROR(hipMemcpy(hC.data(), dC, sizeof(T) * offset_C[total], hipMemcpyDeviceToHost));
+
+    if(argus.unit_check)
+    {
+        /* =====================================================================
+                    CPU BLAS
+        =================================================================== */
+        for(int g = 0, i = 0; g < group_count; g++)
+        {
+            for(int b = 0; b < batch_count; b++, i++)
+            {
+                cblas_gemm<T>(transA,
+                              transB,
+                              m_array[g],
+                              n_array[g],
+                              k_array[g],
+                              alpha_array[g],
+                              hA.data() + offset_A[i],
+                              lda_array[g],
+                              hB.data() + offset_B[i],
+                              ldb_array[g],
+                              beta_array[g],
+                              hC_copy.data() + offset_C[i],
+                              ldc_array[g]);
+
+                unit_check_general<T>(m_array[g],
+                                      n_array[g],
+                                      ldc_array[g],
+                                      hC_copy.data() + offset_C[i],
+                                      hC.data() + offset_C[i]);
+            }
+        }
+    }
+
+    if(argus.timing)
+    {
+        hipblas_timing timing;
+        status = hipblas_time_launches(handle, argus, timing, run);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            hipblas_client_destroy(handle);
+            return status;
+        }
+
+        double gflop = 0, gbyte = 0;
+        for(int g = 0; g < group_count; g++)
+        {
+            gflop += gemm_gflop_count<T>(m_array[g], n_array[g], k_array[g]) * batch_count;
+            gbyte += gemm_gbyte_count<T>(m_array[g], n_array[g], k_array[g]) * batch_count;
+        }
+
+        cout << "transA,transB,M,N,K,alpha,beta,group_count,batch_count," HIPBLAS_TIMING_COLUMNS
+             << endl;
+        cout << argus.transA_option << ',' << argus.transB_option << ',' << argus.M << ','
+             << argus.N << ',' << argus.K << ',' << argus.alpha << ',' << argus.beta << ','
+             << group_count << ',' << batch_count << ',';
+        hipblas_print_timing(cout, timing, gflop, gbyte);
+    }
+
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,155 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <math.h>
+#include <stdlib.h>
+#include <vector>
+
+#include "cblas_interface.h"
+#include "hipblas.hpp"
+#include "near.h"
+#include "norm.h"
+#include "unit.h"
+#include "utility.h"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+// hipblasDgemm under HIPBLAS_INT8_FP64_MATH and hipblasGemmEx with the emulated compute type, on
+// inputs in [-1, 1). Each result is checked against the documented bound k |alpha| (S + 1) 2^-7S
+// for S slices, plus the fp64 accumulation, at the default 7 slices and at 2
+hipblasStatus_t testing_gemm_int8_fp64(Arguments argus)
+{
+    int M = argus.M;
+    int N = argus.N;
+    int K = argus.K;
+
+    int lda = argus.lda;
+    int ldb = argus.ldb;
+    int ldc = argus.ldc;
+
+    hipblasOperation_t transA = char2hipblas_operation(argus.transA_option);
+    hipblasOperation_t transB = char2hipblas_operation(argus.transB_option);
+
+    double alpha = argus.alpha;
+    double beta  = argus.beta;
+
+    int A_row = transA == HIPBLAS_OP_N ? M : K;
+    int A_col = transA == HIPBLAS_OP_N ? K : M;
+    int B_row = transB == HIPBLAS_OP_N ? K : N;
+    int B_col = transB == HIPBLAS_OP_N ? N : K;
+
+    // check here to prevent undefined memory allocation error
+    if(M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+
+    int A_size = lda * A_col;
+    int B_size = ldb * B_col;
+    int C_size = ldc * N;
+
+    // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory, plz follow this practice
+    host_vector<double> hA(A_size);
+    host_vector<double> hB(B_size);
+    host_vector<double> hC(C_size);
+    host_vector<double> hC_cpu(C_size);
+    host_vector<double> hC_gpu(C_size);
+    host_vector<double> hC_ex(C_size);
+
+    device_vector<double> dA(A_size);
+    device_vector<double> dB(B_size);
+    device_vector<double> dC(C_size);
+
+    hipblasHandle_t handle;
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+    hipblas_client_create(&handle);
+
+    // Initial Data on CPU
+    srand(1);
+    for(auto* v : {&hA, &hB, &hC})
+        for(double& x : *v)
+            x = double(rand()) / RAND_MAX * 2 - 1;
+
+    hC_cpu = hC;
+    cblas_gemm<double>(
+        transA, transB, M, N, K, alpha, hA.data(), lda, hB.data(), ldb, beta, hC_cpu.data(), ldc);
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(double) * A_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB.data(), sizeof(double) * B_size, hipMemcpyHostToDevice));
+
+    auto gemm_ex = [&](host_vector<double>& result) {
+        CHECK_HIP_ERROR(hipMemcpy(dC, hC.data(), sizeof(double) * C_size, hipMemcpyHostToDevice));
+        hipblasStatus_t gemm_status = hipblasGemmEx(handle,
+                                                    transA,
+                                                    transB,
+                                                    M,
+                                                    N,
+                                                    K,
+                                                    &alpha,
+                                                    dA,
+                                                    HIPBLAS_R_64F,
+                                                    lda,
+                                                    dB,
+                                                    HIPBLAS_R_64F,
+                                                    ldb,
+                                                    &beta,
+                                                    dC,
+                                                    HIPBLAS_R_64F,
+                                                    ldc,
+                                                    HIPBLAS_COMPUTE_64F_EMULATED_INT8,
+                                                    HIPBLAS_GEMM_DEFAULT);
+        CHECK_HIP_ERROR(
+            hipMemcpy(result.data(), dC, sizeof(double) * C_size, hipMemcpyDeviceToHost));
+        return gemm_status;
+    };
+
+    /* =====================================================================
+         ROCBLAS
+    =================================================================== */
+    CHECK_HIP_ERROR(hipMemcpy(dC, hC.data(), sizeof(double) * C_size, hipMemcpyHostToDevice));
+    status = hipblasSetMathMode(handle, HIPBLAS_INT8_FP64_MATH);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasDgemm(
+            handle, transA, transB, M, N, K, &alpha, dA, lda, dB, ldb, &beta, dC, ldc);
+    hipblasSetMathMode(handle, HIPBLAS_DEFAULT_MATH);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_client_destroy(handle);
+        return status;
+    }
+    CHECK_HIP_ERROR(hipMemcpy(hC_gpu.data(), dC, sizeof(double) * C_size, hipMemcpyDeviceToHost));
+
+    if(argus.unit_check)
+    {
+        double accumulation = (K + 2) * std::abs(alpha) * pow(2.0, -52);
+        near_check_general<double>(M,
+                                   N,
+                                   ldc,
+                                   hC_cpu.data(),
+                                   hC_gpu.data(),
+                                   K * std::abs(alpha) * 8 * pow(2.0, -49) + accumulation);
+
+        // the compute type takes the same path as the math mode
+        EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, gemm_ex(hC_ex));
+        unit_check_general<double>(M, N, ldc, hC_gpu.data(), hC_ex.data());
+
+        EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, hipblasSetEmulationSlices(handle, 2));
+        EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, gemm_ex(hC_ex));
+        hipblasSetEmulationSlices(handle, 7);
+        near_check_general<double>(M,
+                                   N,
+                                   ldc,
+                                   hC_cpu.data(),
+                                   hC_ex.data(),
+                                   K * std::abs(alpha) * 3 * pow(2.0, -14) + accumulation);
+    }
+
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
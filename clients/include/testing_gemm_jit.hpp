@@ -0,0 +1,190 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "flops.h"
+#include "hipblas.hpp"
+#include "unit.h"
+#include "utility.h"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+// the epilogues argus.algo picks for testing_gemm_jit: none, a relu, and one adding i - 2 j
+inline const char* gemm_jit_epilogue_code(int algo)
+{
+    return algo == 1 ? "v = v > 0 ? v : S(0);" : algo == 2 ? "v += S(i - 2 * j);" : nullptr;
+}
+
+inline float gemm_jit_epilogue(int algo, float v, int i, int j)
+{
+    return algo == 1 ? (v > 0 ? v : 0) : algo == 2 ? v + float(i - 2 * j) : v;
+}
+
+// A gemm plan of a run-time compiled kernel with the epilogue of argus.algo, executed with host
+// and then device scalars, for A, B and C in T with fp32 compute. Small integers keep every sum
+// exact in the data type, so C is compared exactly with the host
+template <typename T>
+hipblasStatus_t testing_gemm_jit(Arguments argus)
+{
+    int M   = argus.M;
+    int N   = argus.N;
+    int K   = argus.K;
+    int lda = argus.lda;
+    int ldb = argus.ldb;
+    int ldc = argus.ldc;
+
+    hipblasOperation_t transA = char2hipblas_operation(argus.transA_option);
+    hipblasOperation_t transB = char2hipblas_operation(argus.transB_option);
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    if(M < 0 || N < 0 || K < 0 || lda < max(1, transA == HIPBLAS_OP_N ? M : K)
+       || ldb < max(1, transB == HIPBLAS_OP_N ? K : N) || ldc < max(1, M) || argus.algo < 0
+       || argus.algo > 2)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+
+    int A_size = lda * (transA == HIPBLAS_OP_N ? K : M);
+    int B_size = ldb * (transB == HIPBLAS_OP_N ? N : K);
+    int C_size = ldc * N;
+
+    float alpha = argus.alpha;
+    float beta  = argus.beta;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA(A_size);
+    host_vector<T> hB(B_size);
+    host_vector<T> hC(C_size);
+    host_vector<T> hC_gold(C_size);
+    host_vector<T> hC_host(C_size);
+    host_vector<T> hC_device(C_size);
+
+    device_vector<T>     dA(A_size);
+    device_vector<T>     dB(B_size);
+    device_vector<T>     dC(C_size);
+    device_vector<float> dalpha(1);
+    device_vector<float> dbeta(1);
+
+    hipblasHandle_t handle;
+    hipblas_client_create(&handle);
+
+    // Initial Data on CPU
+    srand(1);
+    for(int i = 0; i < A_size; i++)
+        hA[i] = hipblas_from_float<T>(float(rand() % 7 - 3));
+    for(int i = 0; i < B_size; i++)
+        hB[i] = hipblas_from_float<T>(float(rand() % 5 - 2));
+    for(int i = 0; i < C_size; i++)
+        hC[i] = hipblas_from_float<T>(float(rand() % 3 - 1));
+
+    // rows of C past M keep their values
+    hC_gold = hC;
+    for(int j = 0; j < N; j++)
+        for(int i = 0; i < M; i++)
+        {
+            float sum = 0;
+            for(int l = 0; l < K; l++)
+            {
+                int a = transA == HIPBLAS_OP_N ? i + l * lda : l + i * lda;
+                int b = transB == HIPBLAS_OP_N ? l + j * ldb : j + l * ldb;
+                sum += hipblas_to_float(hA[a]) * hipblas_to_float(hB[b]);
+            }
+            float c              = alpha * sum + beta * hipblas_to_float(hC[i + j * ldc]);
+            hC_gold[i + j * ldc] = hipblas_from_float<T>(gemm_jit_epilogue(argus.algo, c, i, j));
+        }
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * A_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB.data(), sizeof(T) * B_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dalpha, &alpha, sizeof(float), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dbeta, &beta, sizeof(float), hipMemcpyHostToDevice));
+
+    hipblasGemmShape_t shape = {transA,
+                                transB,
+                                M,
+                                N,
+                                K,
+                                hipblas_datatype<T>,
+                                hipblas_datatype<T>,
+                                hipblas_datatype<T>,
+                                HIPBLAS_R_32F};
+
+    hipblasGemmPlan_t plan = nullptr;
+
+    auto execute = [&](const float* alpha_ptr, const float* beta_ptr) {
+        return hipblasGemmPlanExecute(plan, dA, dB, dC, alpha_ptr, beta_ptr);
+    };
+
+    /* =====================================================================
+           HIPBLAS
+    =================================================================== */
+
+    status = hipblasGemmPlanCreateJit(
+        handle, &shape, lda, ldb, ldc, gemm_jit_epilogue_code(argus.algo), &plan);
+
+    CHECK_HIP_ERROR(hipMemcpy(dC, hC.data(), sizeof(T) * C_size, hipMemcpyHostToDevice));
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = execute(&alpha, &beta);
+    CHECK_HIP_ERROR(hipMemcpy(hC_host.data(), dC, sizeof(T) * C_size, hipMemcpyDeviceToHost));
+
+    if(status == HIPBLAS_STATUS_SUCCESS)
+    {
+        CHECK_HIP_ERROR(hipMemcpy(dC, hC.data(), sizeof(T) * C_size, hipMemcpyHostToDevice));
+        status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = execute(dalpha, dbeta);
+        CHECK_HIP_ERROR(
+            hipMemcpy(hC_device.data(), dC, sizeof(T) * C_size, hipMemcpyDeviceToHost));
+    }
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblasGemmPlanDestroy(plan);
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    if(argus.unit_check)
+    {
+        unit_check_general<T>(M, N, ldc, hC_gold.data(), hC_host.data());
+        unit_check_general<T>(M, N, ldc, hC_gold.data(), hC_device.data());
+    }
+
+    if(argus.timing)
+    {
+        // the plan alone, compiled before the first timed call
+        hipblas_timing timing;
+        status = hipblas_time_launches(
+            handle, argus, timing, [&] { return execute(dalpha, dbeta); });
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            hipblasGemmPlanDestroy(plan);
+            hipblas_client_destroy(handle);
+            return status;
+        }
+
+        double gflop = gemm_gflop_count<float>(M, N, K);
+        double gbyte = gemm_gbyte_count<T>(M, N, K);
+
+        cout << "transA,transB,M,N,K,lda,ldb,ldc,epilogue," HIPBLAS_TIMING_COLUMNS << endl;
+        cout << argus.transA_option << ',' << argus.transB_option << ',' << M << ',' << N << ','
+             << K << ',' << lda << ',' << ldb << ',' << ldc << ',' << argus.algo << ',';
+        hipblas_print_timing(cout, timing, gflop, gbyte);
+    }
+
+    hipblasGemmPlanDestroy(plan);
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
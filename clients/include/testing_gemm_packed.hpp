@@ -0,0 +1,168 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <math.h>
+#include <stdlib.h>
+#include <vector>
+
+#include "cblas_interface.h"
+#include "hipblas.hpp"
+#include "unit.h"
+#include "utility.h"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+// One single precision B packed and multiplied twice, on new A and C and with new scalars the
+// second time, after B itself has been overwritten. The data are small integers, so every run is
+// exact and checked bitwise against cblas
+hipblasStatus_t testing_gemm_packed(Arguments argus)
+{
+    int M = argus.M;
+    int N = argus.N;
+    int K = argus.K;
+
+    int lda = argus.lda;
+    int ldb = argus.ldb;
+    int ldc = argus.ldc;
+
+    hipblasOperation_t transA = char2hipblas_operation(argus.transA_option);
+    hipblasOperation_t transB = char2hipblas_operation(argus.transB_option);
+
+    int A_row = transA == HIPBLAS_OP_N ? M : K;
+    int A_col = transA == HIPBLAS_OP_N ? K : M;
+    int B_row = transB == HIPBLAS_OP_N ? K : N;
+    int B_col = transB == HIPBLAS_OP_N ? N : K;
+
+    // check here to prevent undefined memory allocation error
+    if(M < 0 || N < 0 || K < 0 || lda < max(1, A_row) || ldb < max(1, B_row) || ldc < max(1, M))
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+
+    int A_size = lda * A_col;
+    int B_size = ldb * B_col;
+    int C_size = ldc * N;
+
+    // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory, plz follow this practice
+    host_vector<float> hA(A_size);
+    host_vector<float> hB(B_size);
+    host_vector<float> hC(C_size);
+    host_vector<float> hC_cpu(C_size);
+    host_vector<float> hC_gpu(C_size);
+
+    device_vector<float> dA(A_size);
+    device_vector<float> dB(B_size);
+    device_vector<float> dC(C_size);
+
+    hipblasHandle_t handle;
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+    hipblas_client_create(&handle);
+
+    srand(1);
+    for(float& x : hB)
+        x = rand() % 9 - 4;
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB.data(), sizeof(float) * B_size, hipMemcpyHostToDevice));
+
+    hipblasGemmPacked_t packed = nullptr;
+    status                     = hipblasGemmPack(
+        handle, transB, K, N, dB, HIPBLAS_R_32F, ldb, HIPBLAS_R_32F, &packed);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        EXPECT_EQ(nullptr, packed);
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    // The gemms read only the packed copy, so B is clobbered once it has been taken
+    CHECK_HIP_ERROR(hipDeviceSynchronize());
+    CHECK_HIP_ERROR(hipMemset(dB, 0xff, sizeof(float) * B_size));
+
+    // Fresh A and C for each run, as a hot loop gives the packed weights
+    auto run = [&](float alpha, float beta) {
+        for(auto* v : {&hA, &hC})
+            for(float& x : *v)
+                x = rand() % 9 - 4;
+        hC_cpu = hC;
+        cblas_gemm<float>(transA,
+                          transB,
+                          M,
+                          N,
+                          K,
+                          alpha,
+                          hA.data(),
+                          lda,
+                          hB.data(),
+                          ldb,
+                          beta,
+                          hC_cpu.data(),
+                          ldc);
+
+        CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(float) * A_size, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dC, hC.data(), sizeof(float) * C_size, hipMemcpyHostToDevice));
+
+        hipblasStatus_t run_status = hipblasGemmPackedEx(handle,
+                                                         transA,
+                                                         M,
+                                                         &alpha,
+                                                         dA,
+                                                         HIPBLAS_R_32F,
+                                                         lda,
+                                                         packed,
+                                                         &beta,
+                                                         dC,
+                                                         HIPBLAS_R_32F,
+                                                         ldc,
+                                                         HIPBLAS_R_32F,
+                                                         HIPBLAS_GEMM_DEFAULT);
+
+        CHECK_HIP_ERROR(
+            hipMemcpy(hC_gpu.data(), dC, sizeof(float) * C_size, hipMemcpyDeviceToHost));
+        return run_status;
+    };
+
+    /* =====================================================================
+         ROCBLAS
+    =================================================================== */
+    status = run(argus.alpha, argus.beta);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblasGemmPackDestroy(packed);
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    if(argus.unit_check)
+    {
+        float alpha = 1, beta = 0;
+        unit_check_general<float>(M, N, ldc, hC_cpu.data(), hC_gpu.data());
+
+        EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, run(-2, 1));
+        unit_check_general<float>(M, N, ldc, hC_cpu.data(), hC_gpu.data());
+
+        EXPECT_EQ(HIPBLAS_STATUS_INVALID_VALUE,
+                  hipblasGemmPackedEx(handle,
+                                      transA,
+                                      M,
+                                      &alpha,
+                                      dA,
+                                      HIPBLAS_R_32F,
+                                      lda,
+                                      nullptr,
+                                      &beta,
+                                      dC,
+                                      HIPBLAS_R_32F,
+                                      ldc,
+                                      HIPBLAS_R_32F,
+                                      HIPBLAS_GEMM_DEFAULT));
+    }
+
+    EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, hipblasGemmPackDestroy(packed));
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
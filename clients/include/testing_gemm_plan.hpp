@@ -0,0 +1,147 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <math.h>
+#include <stdlib.h>
+#include <vector>
+
+#include "cblas_interface.h"
+#include "hipblas.hpp"
+#include "unit.h"
+#include "utility.h"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+// One single precision gemm plan executed twice, on new B and C and with new scalars the second
+// time, and once more with device scalars. The data are small integers, so every run is exact
+// and checked bitwise against cblas
+hipblasStatus_t testing_gemm_plan(Arguments argus)
+{
+    int M = argus.M;
+    int N = argus.N;
+    int K = argus.K;
+
+    int lda = argus.lda;
+    int ldb = argus.ldb;
+    int ldc = argus.ldc;
+
+    hipblasOperation_t transA = char2hipblas_operation(argus.transA_option);
+    hipblasOperation_t transB = char2hipblas_operation(argus.transB_option);
+
+    int A_row = transA == HIPBLAS_OP_N ? M : K;
+    int A_col = transA == HIPBLAS_OP_N ? K : M;
+    int B_row = transB == HIPBLAS_OP_N ? K : N;
+    int B_col = transB == HIPBLAS_OP_N ? N : K;
+
+    hipblasHandle_t handle;
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+    hipblas_client_create(&handle);
+
+    // The plan makes the argument checks, so a bad problem fails here with no plan
+    hipblasGemmShape_t shape
+        = {transA, transB, M, N, K, HIPBLAS_R_32F, HIPBLAS_R_32F, HIPBLAS_R_32F, HIPBLAS_R_32F};
+    hipblasGemmPlan_t plan = nullptr;
+    status                 = hipblasGemmPlanCreate(
+        handle, &shape, lda, ldb, ldc, HIPBLAS_GEMM_DEFAULT, nullptr, &plan);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        EXPECT_EQ(nullptr, plan);
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    int A_size = lda * A_col;
+    int B_size = ldb * B_col;
+    int C_size = ldc * N;
+
+    // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory, plz follow this practice
+    host_vector<float> hA(A_size);
+    host_vector<float> hB(B_size);
+    host_vector<float> hC(C_size);
+    host_vector<float> hC_cpu(C_size);
+    host_vector<float> hC_gpu(C_size);
+
+    device_vector<float> dA(A_size);
+    device_vector<float> dB(B_size);
+    device_vector<float> dC(C_size);
+    device_vector<float> d_scalars(2);
+
+    srand(1);
+    for(float& x : hA)
+        x = rand() % 9 - 4;
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(float) * A_size, hipMemcpyHostToDevice));
+
+    // Fresh B and C for each run, as a hot loop gives the plan
+    auto run = [&](float alpha, float beta, bool device_scalars) {
+        for(auto* v : {&hB, &hC})
+            for(float& x : *v)
+                x = rand() % 9 - 4;
+        hC_cpu = hC;
+        cblas_gemm<float>(transA,
+                          transB,
+                          M,
+                          N,
+                          K,
+                          alpha,
+                          hA.data(),
+                          lda,
+                          hB.data(),
+                          ldb,
+                          beta,
+                          hC_cpu.data(),
+                          ldc);
+
+        float scalars[2] = {alpha, beta};
+        CHECK_HIP_ERROR(hipMemcpy(d_scalars, scalars, sizeof(scalars), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dB, hB.data(), sizeof(float) * B_size, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dC, hC.data(), sizeof(float) * C_size, hipMemcpyHostToDevice));
+
+        hipblasStatus_t run_status = hipblasSetPointerMode(
+            handle, device_scalars ? HIPBLAS_POINTER_MODE_DEVICE : HIPBLAS_POINTER_MODE_HOST);
+        const float* d_alpha = d_scalars;
+        if(run_status == HIPBLAS_STATUS_SUCCESS)
+            run_status = hipblasGemmPlanExecute(plan,
+                                                dA,
+                                                dB,
+                                                dC,
+                                                device_scalars ? d_alpha : &alpha,
+                                                device_scalars ? d_alpha + 1 : &beta);
+        hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST);
+
+        CHECK_HIP_ERROR(
+            hipMemcpy(hC_gpu.data(), dC, sizeof(float) * C_size, hipMemcpyDeviceToHost));
+        return run_status;
+    };
+
+    /* =====================================================================
+         ROCBLAS
+    =================================================================== */
+    status = run(argus.alpha, argus.beta, false);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblasGemmPlanDestroy(plan);
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    if(argus.unit_check)
+    {
+        unit_check_general<float>(M, N, ldc, hC_cpu.data(), hC_gpu.data());
+
+        EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, run(-2, 1, false));
+        unit_check_general<float>(M, N, ldc, hC_cpu.data(), hC_gpu.data());
+
+        EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, run(3, -1, true));
+        unit_check_general<float>(M, N, ldc, hC_cpu.data(), hC_gpu.data());
+    }
+
+    hipblasGemmPlanDestroy(plan);
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,173 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <math.h>
+#include <stdlib.h>
+#include <vector>
+
+#include "cblas_interface.h"
+#include "hipblas.hpp"
+#include "unit.h"
+#include "utility.h"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+// hipblasGemmPlanarComplexStridedBatched in single precision over two batches, with real host
+// scalars (the 4M path) and with complex device scalars (the 3M path). The planes hold small
+// integers, so both are exact and checked bitwise against cblas_gemm on the interleaved matrices
+hipblasStatus_t testing_gemm_planar_complex(Arguments argus)
+{
+    int M = argus.M;
+    int N = argus.N;
+    int K = argus.K;
+
+    int lda = argus.lda;
+    int ldb = argus.ldb;
+    int ldc = argus.ldc;
+
+    int batch_count = 2;
+
+    hipblasOperation_t transA = char2hipblas_operation(argus.transA_option);
+    hipblasOperation_t transB = char2hipblas_operation(argus.transB_option);
+
+    int A_row = transA == HIPBLAS_OP_N ? M : K;
+    int A_col = transA == HIPBLAS_OP_N ? K : M;
+    int B_row = transB == HIPBLAS_OP_N ? K : N;
+    int B_col = transB == HIPBLAS_OP_N ? N : K;
+
+    // check here to prevent undefined memory allocation error
+    if(M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+
+    int stride_A = lda * A_col;
+    int stride_B = ldb * B_col;
+    int stride_C = ldc * N;
+    int A_size   = stride_A * batch_count;
+    int B_size   = stride_B * batch_count;
+    int C_size   = stride_C * batch_count;
+
+    // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory, plz follow this practice
+    host_vector<hipblasComplex> hA(A_size);
+    host_vector<hipblasComplex> hB(B_size);
+    host_vector<hipblasComplex> hC(C_size);
+    host_vector<hipblasComplex> hC_cpu(C_size);
+    host_vector<hipblasComplex> hC_gpu(C_size);
+    host_vector<float>          hPlanes(2 * C_size);
+
+    device_vector<float>          dA(2 * A_size);
+    device_vector<float>          dB(2 * B_size);
+    device_vector<float>          dC(2 * C_size);
+    device_vector<hipblasComplex> d_scalars(2);
+
+    hipblasHandle_t handle;
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+    hipblas_client_create(&handle);
+
+    // Initial Data on CPU
+    srand(1);
+    for(auto* v : {&hA, &hB, &hC})
+        for(hipblasComplex& x : *v)
+            x = hipblasComplex(rand() % 9 - 4, rand() % 9 - 4);
+
+    // The real planes of an interleaved matrix, one after the other
+    auto to_device = [](float* d, const host_vector<hipblasComplex>& h) {
+        host_vector<float> planes(2 * h.size());
+        for(size_t i = 0; i < h.size(); i++)
+        {
+            planes[i]            = h[i].x;
+            planes[h.size() + i] = h[i].y;
+        }
+        CHECK_HIP_ERROR(
+            hipMemcpy(d, planes.data(), sizeof(float) * planes.size(), hipMemcpyHostToDevice));
+    };
+    to_device(dA, hA);
+    to_device(dB, hB);
+
+    auto gemm = [&](hipblasComplex alpha, hipblasComplex beta, bool device_scalars) {
+        hC_cpu = hC;
+        for(int b = 0; b < batch_count; b++)
+            cblas_gemm<hipblasComplex>(transA,
+                                       transB,
+                                       M,
+                                       N,
+                                       K,
+                                       alpha,
+                                       hA.data() + b * stride_A,
+                                       lda,
+                                       hB.data() + b * stride_B,
+                                       ldb,
+                                       beta,
+                                       hC_cpu.data() + b * stride_C,
+                                       ldc);
+
+        hipblasComplex scalars[2] = {alpha, beta};
+        CHECK_HIP_ERROR(hipMemcpy(d_scalars, scalars, sizeof(scalars), hipMemcpyHostToDevice));
+        to_device(dC, hC);
+
+        hipblasStatus_t gemm_status = hipblasSetPointerMode(
+            handle, device_scalars ? HIPBLAS_POINTER_MODE_DEVICE : HIPBLAS_POINTER_MODE_HOST);
+        if(gemm_status == HIPBLAS_STATUS_SUCCESS)
+            gemm_status = hipblasGemmPlanarComplexStridedBatched(
+                handle,
+                transA,
+                transB,
+                M,
+                N,
+                K,
+                device_scalars ? (const void*)d_scalars : &alpha,
+                dA,
+                (float*)dA + A_size,
+                lda,
+                stride_A,
+                dB,
+                (float*)dB + B_size,
+                ldb,
+                stride_B,
+                device_scalars ? (const void*)((hipblasComplex*)d_scalars + 1) : &beta,
+                dC,
+                (float*)dC + C_size,
+                ldc,
+                stride_C,
+                batch_count,
+                HIPBLAS_C_32F);
+        hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST);
+
+        CHECK_HIP_ERROR(hipMemcpy(
+            hPlanes.data(), dC, sizeof(float) * hPlanes.size(), hipMemcpyDeviceToHost));
+        for(int i = 0; i < C_size; i++)
+            hC_gpu[i] = hipblasComplex(hPlanes[i], hPlanes[C_size + i]);
+        return gemm_status;
+    };
+
+    /* =====================================================================
+         ROCBLAS
+    =================================================================== */
+    status = gemm(hipblasComplex(argus.alpha, 0), hipblasComplex(argus.beta, 0), false);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    if(argus.unit_check)
+    {
+        unit_check_general<hipblasComplex>(
+            M, N, batch_count, ldc, stride_C, hC_cpu.data(), hC_gpu.data());
+
+        hipblasComplex alpha(argus.alpha, 0.5), beta(argus.beta, -1);
+        EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, gemm(alpha, beta, true));
+        unit_check_general<hipblasComplex>(
+            M, N, batch_count, ldc, stride_C, hC_cpu.data(), hC_gpu.data());
+    }
+
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,194 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "flops.h"
+#include "hipblas.hpp"
+#include "unit.h"
+#include "utility.h"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+// C = alpha op(A) B + beta C with B in the hipblasWeightFormat_t argus.algo, argus.group_size rows
+// to a scale. The unsigned formats also have zeros. Small integer activations, weights and zeros
+// and power of two scales keep every product and sum exact, so the result is compared to the host
+// one exactly
+template <typename Ta, typename Tc = float>
+hipblasStatus_t testing_gemm_quantized(Arguments argus)
+{
+    int M          = argus.M;
+    int N          = argus.N;
+    int K          = argus.K;
+    int lda        = argus.lda;
+    int ldb        = argus.ldb;
+    int ldc        = argus.ldc;
+    int group_size = argus.group_size;
+
+    hipblasOperation_t    transA = char2hipblas_operation(argus.transA_option);
+    hipblasWeightFormat_t format = hipblasWeightFormat_t(argus.algo);
+
+    bool four_bit  = format == HIPBLAS_WEIGHT_INT4 || format == HIPBLAS_WEIGHT_UINT4;
+    bool is_signed = format == HIPBLAS_WEIGHT_INT4 || format == HIPBLAS_WEIGHT_INT8;
+    int  bits      = four_bit ? 4 : 8;
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    if(M < 0 || N < 0 || K < 0 || lda < max(1, transA == HIPBLAS_OP_N ? M : K)
+       || ldb < max(1, K) || ldc < max(1, M) || (four_bit && ldb % 2) || group_size < 1
+       || argus.algo < HIPBLAS_WEIGHT_INT8 || argus.algo > HIPBLAS_WEIGHT_UINT4)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    if(M == 0 || N == 0)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    int groups = max(1, (K - 1) / group_size + 1);
+    int A_cols = transA == HIPBLAS_OP_N ? K : M;
+    int A_size = lda * A_cols;
+    int Q_size = ldb * N;
+    int B_size = four_bit ? Q_size / 2 : Q_size;
+    int S_size = groups * N;
+    int C_size = ldc * N;
+
+    float alpha = argus.alpha;
+    float beta  = argus.beta;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<Ta>      hA(A_size);
+    host_vector<int>     hQ(Q_size);
+    host_vector<uint8_t> hB(B_size);
+    host_vector<float>   hscales(S_size);
+    host_vector<float>   hzeros(S_size);
+    host_vector<Tc>      hC(C_size);
+    host_vector<Tc>      hC_gold(C_size);
+
+    device_vector<Ta>      dA(A_size);
+    device_vector<uint8_t> dB(B_size);
+    device_vector<float>   dscales(S_size);
+    device_vector<float>   dzeros(S_size);
+    device_vector<Tc>      dC(C_size);
+
+    hipblasHandle_t handle;
+    hipblas_client_create(&handle);
+
+    // Initial Data on CPU
+    srand(1);
+    int lo = is_signed ? -(1 << (bits - 1)) : 0;
+    int hi = is_signed ? (1 << (bits - 1)) - 1 : (1 << bits) - 1;
+    for(int i = 0; i < A_size; i++)
+        hA[i] = hipblas_from_float<Ta>(float(rand() % 7 - 3));
+    for(int i = 0; i < Q_size; i++)
+    {
+        hQ[i] = lo + rand() % (hi - lo + 1);
+        if(four_bit)
+            hB[i / 2] |= uint8_t((hQ[i] & 0xf) << (i % 2 ? 4 : 0));
+        else
+            hB[i] = uint8_t(hQ[i]);
+    }
+    for(int i = 0; i < S_size; i++)
+    {
+        hscales[i] = float(1 << (rand() % 3)) / 2;
+        hzeros[i]  = is_signed ? 0.0f : float(lo + rand() % (hi - lo + 1));
+    }
+    for(int i = 0; i < C_size; i++)
+        hC[i] = hipblas_from_float<Tc>(float(rand() % 5 - 2));
+
+    for(int j = 0; j < N; j++)
+        for(int i = 0; i < M; i++)
+        {
+            float sum = 0;
+            for(int l = 0; l < K; l++)
+            {
+                int   g = l / group_size + j * groups;
+                float w = hscales[g] * (hQ[l + j * ldb] - hzeros[g]);
+                float a = hipblas_to_float(hA[transA == HIPBLAS_OP_N ? i + l * lda : l + i * lda]);
+                sum += a * w;
+            }
+            hC_gold[i + j * ldc]
+                = hipblas_from_float<Tc>(alpha * sum + beta * hipblas_to_float(hC[i + j * ldc]));
+        }
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(Ta) * A_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB.data(), B_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dscales, hscales.data(), sizeof(float) * S_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dzeros, hzeros.data(), sizeof(float) * S_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC, hC.data(), sizeof(Tc) * C_size, hipMemcpyHostToDevice));
+
+    const float*                zeros = is_signed ? nullptr : (float*)dzeros;
+    hipblasWeightQuantization_t quant = {format, group_size, dscales, zeros, HIPBLAS_R_32F, groups};
+
+    auto gemm = [&] {
+        return hipblasGemmQuantizedEx(handle,
+                                      transA,
+                                      M,
+                                      N,
+                                      K,
+                                      &alpha,
+                                      dA,
+                                      hipblas_datatype<Ta>,
+                                      lda,
+                                      dB,
+                                      ldb,
+                                      &quant,
+                                      &beta,
+                                      dC,
+                                      hipblas_datatype<Tc>,
+                                      ldc,
+                                      HIPBLAS_R_32F);
+    };
+
+    /* =====================================================================
+           HIPBLAS
+    =================================================================== */
+
+    status = gemm();
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    CHECK_HIP_ERROR(hipMemcpy(hC.data(), dC, sizeof(Tc) * C_size, hipMemcpyDeviceToHost));
+
+    if(argus.unit_check)
+    {
+        unit_check_general<Tc>(M, N, ldc, hC_gold.data(), hC.data());
+    }
+
+    if(argus.timing)
+    {
+        hipblas_timing timing;
+        status = hipblas_time_launches(handle, argus, timing, gemm);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            hipblas_client_destroy(handle);
+            return status;
+        }
+
+        double gflop = gemm_gflop_count<float>(M, N, K);
+        double gbyte = gemm_quantized_gbyte_count<Ta, Tc>(M, N, K, bits, groups, !is_signed);
+
+        cout << "transA,M,N,K,lda,ldb,ldc,format,group_size," HIPBLAS_TIMING_COLUMNS << endl;
+        cout << argus.transA_option << ',' << M << ',' << N << ',' << K << ',' << lda << ','
+             << ldb << ',' << ldc << ',' << argus.algo << ',' << group_size << ',';
+        hipblas_print_timing(cout, timing, gflop, gbyte);
+    }
+
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,212 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "flops.h"
+#include "hipblas.hpp"
+#include "unit.h"
+#include "utility.h"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+// every batch of A and C against the one B, with its scales and zeros, that strides of 0 share, as
+// the weights of a model are
+template <typename Ta, typename Tc = float>
+hipblasStatus_t testing_gemm_quantized_strided_batched(Arguments argus)
+{
+    int M           = argus.M;
+    int N           = argus.N;
+    int K           = argus.K;
+    int lda         = argus.lda;
+    int ldb         = argus.ldb;
+    int ldc         = argus.ldc;
+    int group_size  = argus.group_size;
+    int batch_count = argus.batch_count;
+
+    double stride_scale = argus.stride_scale;
+
+    hipblasOperation_t    transA = char2hipblas_operation(argus.transA_option);
+    hipblasWeightFormat_t format = hipblasWeightFormat_t(argus.algo);
+
+    bool four_bit  = format == HIPBLAS_WEIGHT_INT4 || format == HIPBLAS_WEIGHT_UINT4;
+    bool is_signed = format == HIPBLAS_WEIGHT_INT4 || format == HIPBLAS_WEIGHT_INT8;
+    int  bits      = four_bit ? 4 : 8;
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    if(M < 0 || N < 0 || K < 0 || lda < max(1, transA == HIPBLAS_OP_N ? M : K)
+       || ldb < max(1, K) || ldc < max(1, M) || (four_bit && ldb % 2) || group_size < 1
+       || argus.algo < HIPBLAS_WEIGHT_INT8 || argus.algo > HIPBLAS_WEIGHT_UINT4 || batch_count < 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    if(M == 0 || N == 0 || batch_count == 0)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    int groups = max(1, (K - 1) / group_size + 1);
+    int A_cols = transA == HIPBLAS_OP_N ? K : M;
+    int Q_size = ldb * N;
+    int B_size = four_bit ? Q_size / 2 : Q_size;
+    int S_size = groups * N;
+
+    long long stride_A = lda * A_cols * stride_scale;
+    long long stride_C = ldc * N * stride_scale;
+
+    size_t A_size = stride_A * batch_count;
+    size_t C_size = stride_C * batch_count;
+
+    float alpha = argus.alpha;
+    float beta  = argus.beta;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<Ta>      hA(A_size);
+    host_vector<int>     hQ(Q_size);
+    host_vector<uint8_t> hB(B_size);
+    host_vector<float>   hscales(S_size);
+    host_vector<float>   hzeros(S_size);
+    host_vector<Tc>      hC(C_size);
+    host_vector<Tc>      hC_gold(C_size);
+
+    device_vector<Ta>      dA(A_size);
+    device_vector<uint8_t> dB(B_size);
+    device_vector<float>   dscales(S_size);
+    device_vector<float>   dzeros(S_size);
+    device_vector<Tc>      dC(C_size);
+
+    hipblasHandle_t handle;
+    hipblas_client_create(&handle);
+
+    // Initial Data on CPU
+    srand(1);
+    int lo = is_signed ? -(1 << (bits - 1)) : 0;
+    int hi = is_signed ? (1 << (bits - 1)) - 1 : (1 << bits) - 1;
+    for(size_t i = 0; i < A_size; i++)
+        hA[i] = hipblas_from_float<Ta>(float(rand() % 7 - 3));
+    for(int i = 0; i < Q_size; i++)
+    {
+        hQ[i] = lo + rand() % (hi - lo + 1);
+        if(four_bit)
+            hB[i / 2] |= uint8_t((hQ[i] & 0xf) << (i % 2 ? 4 : 0));
+        else
+            hB[i] = uint8_t(hQ[i]);
+    }
+    for(int i = 0; i < S_size; i++)
+    {
+        hscales[i] = float(1 << (rand() % 3)) / 2;
+        hzeros[i]  = is_signed ? 0.0f : float(lo + rand() % (hi - lo + 1));
+    }
+    for(size_t i = 0; i < C_size; i++)
+        hC[i] = hipblas_from_float<Tc>(float(rand() % 5 - 2));
+
+    hC_gold = hC;
+    for(int b = 0; b < batch_count; b++)
+        for(int j = 0; j < N; j++)
+            for(int i = 0; i < M; i++)
+            {
+                Ta*   A   = hA.data() + b * stride_A;
+                Tc&   c   = hC_gold[b * stride_C + i + j * ldc];
+                float sum = 0;
+                for(int l = 0; l < K; l++)
+                {
+                    int   g = l / group_size + j * groups;
+                    float w = hscales[g] * (hQ[l + j * ldb] - hzeros[g]);
+                    float a
+                        = hipblas_to_float(A[transA == HIPBLAS_OP_N ? i + l * lda : l + i * lda]);
+                    sum += a * w;
+                }
+                c = hipblas_from_float<Tc>(alpha * sum + beta * hipblas_to_float(c));
+            }
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(Ta) * A_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB.data(), B_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dscales, hscales.data(), sizeof(float) * S_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dzeros, hzeros.data(), sizeof(float) * S_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC, hC.data(), sizeof(Tc) * C_size, hipMemcpyHostToDevice));
+
+    const float*                zeros = is_signed ? nullptr : (float*)dzeros;
+    hipblasWeightQuantization_t quant = {format, group_size, dscales, zeros, HIPBLAS_R_32F, groups};
+
+    auto gemm = [&] {
+        return hipblasGemmQuantizedStridedBatchedEx(handle,
+                                                    transA,
+                                                    M,
+                                                    N,
+                                                    K,
+                                                    &alpha,
+                                                    dA,
+                                                    hipblas_datatype<Ta>,
+                                                    lda,
+                                                    stride_A,
+                                                    dB,
+                                                    ldb,
+                                                    0,
+                                                    &quant,
+                                                    0,
+                                                    &beta,
+                                                    dC,
+                                                    hipblas_datatype<Tc>,
+                                                    ldc,
+                                                    stride_C,
+                                                    batch_count,
+                                                    HIPBLAS_R_32F);
+    };
+
+    /* =====================================================================
+           HIPBLAS
+    =================================================================== */
+
+    status = gemm();
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    CHECK_HIP_ERROR(hipMemcpy(hC.data(), dC, sizeof(Tc) * C_size, hipMemcpyDeviceToHost));
+
+    if(argus.unit_check)
+    {
+        unit_check_general<Tc>(M, N, batch_count, ldc, stride_C, hC_gold.data(), hC.data());
+    }
+
+    if(argus.timing)
+    {
+        hipblas_timing timing;
+        status = hipblas_time_launches(handle, argus, timing, gemm);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            hipblas_client_destroy(handle);
+            return status;
+        }
+
+        double gflop = gemm_gflop_count<float>(M, N, K) * batch_count;
+        double gbyte
+            = gemm_quantized_gbyte_count<Ta, Tc>(M, N, K, bits, groups, !is_signed, batch_count);
+
+        cout << "transA,M,N,K,lda,ldb,ldc,format,group_size,stride_scale,batch_count,"
+                HIPBLAS_TIMING_COLUMNS
+             << endl;
+        cout << argus.transA_option << ',' << M << ',' << N << ',' << K << ',' << lda << ','
+             << ldb << ',' << ldc << ',' << argus.algo << ',' << group_size << ','
+             << stride_scale << ',' << batch_count << ',';
+        hipblas_print_timing(cout, timing, gflop, gbyte);
+    }
+
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
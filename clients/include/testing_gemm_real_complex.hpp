@@ -0,0 +1,182 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <math.h>
+#include <stdlib.h>
+#include <vector>
+
+#include "cblas_interface.h"
+#include "hipblas.hpp"
+#include "near.h"
+#include "norm.h"
+#include "unit.h"
+#include "utility.h"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+// hipblasGemmStridedBatchedEx over two batches with a real R_32F operand: a complex A times a
+// real B, with real scalars and then with complex ones, and a real A times a complex B. Each is
+// checked against cblas_gemm on the real operand widened to complex
+hipblasStatus_t testing_gemm_real_complex(Arguments argus)
+{
+    int M = argus.M;
+    int N = argus.N;
+    int K = argus.K;
+
+    int lda = argus.lda;
+    int ldb = argus.ldb;
+    int ldc = argus.ldc;
+
+    int batch_count = 2;
+
+    hipblasOperation_t transA = char2hipblas_operation(argus.transA_option);
+    hipblasOperation_t transB = char2hipblas_operation(argus.transB_option);
+
+    int A_row = transA == HIPBLAS_OP_N ? M : K;
+    int A_col = transA == HIPBLAS_OP_N ? K : M;
+    int B_row = transB == HIPBLAS_OP_N ? K : N;
+    int B_col = transB == HIPBLAS_OP_N ? N : K;
+
+    // check here to prevent undefined memory allocation error
+    if(M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+
+    int stride_A = lda * A_col;
+    int stride_B = ldb * B_col;
+    int stride_C = ldc * N;
+    int A_size   = stride_A * batch_count;
+    int B_size   = stride_B * batch_count;
+    int C_size   = stride_C * batch_count;
+
+    // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory, plz follow this practice
+    host_vector<float>          hA_real(A_size);
+    host_vector<float>          hB_real(B_size);
+    host_vector<hipblasComplex> hA(A_size);
+    host_vector<hipblasComplex> hB(B_size);
+    host_vector<hipblasComplex> hC(C_size);
+    host_vector<hipblasComplex> hC_cpu(C_size);
+    host_vector<hipblasComplex> hC_gpu(C_size);
+
+    device_vector<float>          dA_real(A_size);
+    device_vector<float>          dB_real(B_size);
+    device_vector<hipblasComplex> dA(A_size);
+    device_vector<hipblasComplex> dB(B_size);
+    device_vector<hipblasComplex> dC(C_size);
+
+    hipblasHandle_t handle;
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+    hipblas_client_create(&handle);
+
+    // Initial Data on CPU
+    srand(1);
+    auto random = [] { return float(rand()) / RAND_MAX * 2 - 1; };
+    for(float& x : hA_real)
+        x = random();
+    for(float& x : hB_real)
+        x = random();
+    for(auto* v : {&hA, &hB, &hC})
+        for(hipblasComplex& x : *v)
+            x = hipblasComplex(random(), random());
+
+    CHECK_HIP_ERROR(
+        hipMemcpy(dA_real, hA_real.data(), sizeof(float) * A_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dB_real, hB_real.data(), sizeof(float) * B_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dA, hA.data(), sizeof(hipblasComplex) * A_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dB, hB.data(), sizeof(hipblasComplex) * B_size, hipMemcpyHostToDevice));
+
+    // C = alpha op(A) op(B) + beta C with the real operand the A or B side of a_real
+    auto gemm = [&](bool a_real, hipblasComplex alpha, hipblasComplex beta) {
+        host_vector<hipblasComplex> wide(a_real ? A_size : B_size);
+        const host_vector<float>&   real = a_real ? hA_real : hB_real;
+        for(size_t i = 0; i < wide.size(); i++)
+            wide[i] = hipblasComplex(real[i], 0);
+
+        hC_cpu = hC;
+        for(int b = 0; b < batch_count; b++)
+            cblas_gemm<hipblasComplex>(transA,
+                                       transB,
+                                       M,
+                                       N,
+                                       K,
+                                       alpha,
+                                       (a_real ? wide.data() : hA.data()) + b * stride_A,
+                                       lda,
+                                       (a_real ? hB.data() : wide.data()) + b * stride_B,
+                                       ldb,
+                                       beta,
+                                       hC_cpu.data() + b * stride_C,
+                                       ldc);
+
+        CHECK_HIP_ERROR(
+            hipMemcpy(dC, hC.data(), sizeof(hipblasComplex) * C_size, hipMemcpyHostToDevice));
+        hipblasStatus_t gemm_status
+            = hipblasGemmStridedBatchedEx(handle,
+                                          transA,
+                                          transB,
+                                          M,
+                                          N,
+                                          K,
+                                          &alpha,
+                                          a_real ? (const void*)dA_real : (const void*)dA,
+                                          a_real ? HIPBLAS_R_32F : HIPBLAS_C_32F,
+                                          lda,
+                                          stride_A,
+                                          a_real ? (const void*)dB : (const void*)dB_real,
+                                          a_real ? HIPBLAS_C_32F : HIPBLAS_R_32F,
+                                          ldb,
+                                          stride_B,
+                                          &beta,
+                                          dC,
+                                          HIPBLAS_C_32F,
+                                          ldc,
+                                          stride_C,
+                                          batch_count,
+                                          HIPBLAS_C_32F,
+                                          HIPBLAS_GEMM_DEFAULT);
+        CHECK_HIP_ERROR(hipMemcpy(
+            hC_gpu.data(), dC, sizeof(hipblasComplex) * C_size, hipMemcpyDeviceToHost));
+        return gemm_status;
+    };
+
+    /* =====================================================================
+         ROCBLAS
+    =================================================================== */
+    hipblasComplex real_alpha(argus.alpha, 0), real_beta(argus.beta, 0);
+    hipblasComplex complex_alpha(argus.alpha, 0.5), complex_beta(argus.beta, -0.25);
+    double         accumulation = (K + 2) * 4 * pow(2.0, -23);
+
+    status = gemm(false, real_alpha, real_beta);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    if(argus.unit_check)
+    {
+        near_check_general<hipblasComplex>(
+            M, N, batch_count, ldc, stride_C, hC_cpu.data(), hC_gpu.data(), accumulation);
+
+        EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, gemm(false, complex_alpha, complex_beta));
+        near_check_general<hipblasComplex>(
+            M, N, batch_count, ldc, stride_C, hC_cpu.data(), hC_gpu.data(), accumulation);
+
+        EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, gemm(true, complex_alpha, complex_beta));
+        near_check_general<hipblasComplex>(
+            M, N, batch_count, ldc, stride_C, hC_cpu.data(), hC_gpu.data(), accumulation);
+    }
+
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
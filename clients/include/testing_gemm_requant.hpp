@@ -0,0 +1,184 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <math.h>
+#include <stdlib.h>
+#include <vector>
+
+#include "flops.h"
+#include "hipblas.hpp"
+#include "unit.h"
+#include "utility.h"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+// int8 C = requantized op(A) op(B) in the hipblasRequantMode_t argus.algo, once without and once
+// with a bias. Power of two scales keep scale * sum exact in float, so the host rounds the same
+// value the device does and C is compared exactly; the scales are small enough that both
+// saturation bounds and the values between them all occur
+inline hipblasStatus_t testing_gemm_requant(Arguments argus)
+{
+    int M   = argus.M;
+    int N   = argus.N;
+    int K   = argus.K;
+    int lda = argus.lda;
+    int ldb = argus.ldb;
+    int ldc = argus.ldc;
+
+    hipblasOperation_t   transA = char2hipblas_operation(argus.transA_option);
+    hipblasOperation_t   transB = char2hipblas_operation(argus.transB_option);
+    hipblasRequantMode_t mode   = hipblasRequantMode_t(argus.algo);
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    if(M < 0 || N < 0 || K < 0 || lda < max(1, transA == HIPBLAS_OP_N ? M : K)
+       || ldb < max(1, transB == HIPBLAS_OP_N ? K : N) || ldc < max(1, M)
+       || argus.algo < HIPBLAS_REQUANT_PER_TENSOR || argus.algo > HIPBLAS_REQUANT_PER_COLUMN)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    if(M == 0 || N == 0)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    int A_size  = lda * (transA == HIPBLAS_OP_N ? K : M);
+    int B_size  = ldb * (transB == HIPBLAS_OP_N ? N : K);
+    int C_size  = ldc * N;
+    int entries = mode == HIPBLAS_REQUANT_PER_ROW      ? M
+                  : mode == HIPBLAS_REQUANT_PER_COLUMN ? N
+                                                       : 1;
+
+    int32_t zero_point = -3;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<int8_t>  hA(A_size);
+    host_vector<int8_t>  hB(B_size);
+    host_vector<int8_t>  hC(C_size);
+    host_vector<int8_t>  hC_gold(C_size);
+    host_vector<int8_t>  hC_bias_gold(C_size);
+    host_vector<float>   hscale(entries);
+    host_vector<int32_t> hbias(entries);
+
+    device_vector<int8_t>  dA(A_size);
+    device_vector<int8_t>  dB(B_size);
+    device_vector<int8_t>  dC(C_size);
+    device_vector<float>   dscale(entries);
+    device_vector<int32_t> dbias(entries);
+
+    hipblasHandle_t handle;
+    hipblas_client_create(&handle);
+
+    // Initial Data on CPU
+    srand(1);
+    for(int i = 0; i < A_size; i++)
+        hA[i] = int8_t(rand() % 256 - 128);
+    for(int i = 0; i < B_size; i++)
+        hB[i] = int8_t(rand() % 256 - 128);
+    for(int i = 0; i < C_size; i++)
+        hC[i] = int8_t(rand() % 256 - 128);
+    for(int i = 0; i < entries; i++)
+    {
+        hscale[i] = ldexpf(1.0f, -(rand() % 6 + 8));
+        hbias[i]  = rand() % 20001 - 10000;
+    }
+
+    // rows of C past M keep their values
+    hC_gold      = hC;
+    hC_bias_gold = hC;
+    for(int j = 0; j < N; j++)
+        for(int i = 0; i < M; i++)
+        {
+            int32_t sum = 0;
+            for(int l = 0; l < K; l++)
+            {
+                int a = transA == HIPBLAS_OP_N ? hA[i + l * lda] : hA[l + i * lda];
+                int b = transB == HIPBLAS_OP_N ? hB[l + j * ldb] : hB[j + l * ldb];
+                sum += a * b;
+            }
+            int c = mode == HIPBLAS_REQUANT_PER_ROW      ? i
+                    : mode == HIPBLAS_REQUANT_PER_COLUMN ? j
+                                                         : 0;
+
+            float v      = rintf(hscale[c] * float(sum)) + float(zero_point);
+            float v_bias = rintf(hscale[c] * float(sum + hbias[c])) + float(zero_point);
+
+            hC_gold[i + j * ldc]      = int8_t(min(max(v, -128.0f), 127.0f));
+            hC_bias_gold[i + j * ldc] = int8_t(min(max(v_bias, -128.0f), 127.0f));
+        }
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), A_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB.data(), B_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC, hC.data(), C_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dscale, hscale.data(), sizeof(float) * entries, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dbias, hbias.data(), sizeof(int32_t) * entries, hipMemcpyHostToDevice));
+
+    hipblasRequantization_t requant = {mode, dscale, nullptr, zero_point};
+
+    auto gemm = [&] {
+        return hipblasGemmExWithRequantization(
+            handle, transA, transB, M, N, K, dA, lda, dB, ldb, dC, ldc, &requant);
+    };
+
+    /* =====================================================================
+           HIPBLAS
+    =================================================================== */
+
+    status = gemm();
+    CHECK_HIP_ERROR(hipMemcpy(hC.data(), dC, C_size, hipMemcpyDeviceToHost));
+
+    if(status == HIPBLAS_STATUS_SUCCESS && argus.unit_check)
+    {
+        unit_check_general<int8_t>(M, N, ldc, hC_gold.data(), hC.data());
+    }
+
+    requant.bias = dbias;
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = gemm();
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    CHECK_HIP_ERROR(hipMemcpy(hC.data(), dC, C_size, hipMemcpyDeviceToHost));
+
+    if(argus.unit_check)
+    {
+        unit_check_general<int8_t>(M, N, ldc, hC_bias_gold.data(), hC.data());
+    }
+
+    if(argus.timing)
+    {
+        // with the bias
+        hipblas_timing timing;
+        status = hipblas_time_launches(handle, argus, timing, gemm);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            hipblas_client_destroy(handle);
+            return status;
+        }
+
+        double gflop = gemm_gflop_count<float>(M, N, K);
+        double gbyte = gemm_requant_gbyte_count(M, N, K, entries);
+
+        cout << "transA,transB,M,N,K,lda,ldb,ldc,mode," HIPBLAS_TIMING_COLUMNS << endl;
+        cout << argus.transA_option << ',' << argus.transB_option << ',' << M << ',' << N << ','
+             << K << ',' << lda << ',' << ldb << ',' << ldc << ',' << argus.algo << ',';
+        hipblas_print_timing(cout, timing, gflop, gbyte);
+    }
+
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
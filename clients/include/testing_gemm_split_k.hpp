@@ -0,0 +1,153 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <math.h>
+#include <stdlib.h>
+#include <vector>
+
+#include "cblas_interface.h"
+#include "hipblas.hpp"
+#include "near.h"
+#include "norm.h"
+#include "unit.h"
+#include "utility.h"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+// hipblasDgemm split into 3 parts, so K % 3 makes a tail part, with host scalars, and
+// hipblasGemmEx split automatically with device scalars. Both are checked against cblas within
+// the fp64 accumulation bound; the automatic split is also checked bitwise against a second run,
+// since the parts are summed in a fixed order
+hipblasStatus_t testing_gemm_split_k(Arguments argus)
+{
+    int M = argus.M;
+    int N = argus.N;
+    int K = argus.K;
+
+    int lda = argus.lda;
+    int ldb = argus.ldb;
+    int ldc = argus.ldc;
+
+    hipblasOperation_t transA = char2hipblas_operation(argus.transA_option);
+    hipblasOperation_t transB = char2hipblas_operation(argus.transB_option);
+
+    double alpha = argus.alpha;
+    double beta  = argus.beta;
+
+    int A_row = transA == HIPBLAS_OP_N ? M : K;
+    int A_col = transA == HIPBLAS_OP_N ? K : M;
+    int B_row = transB == HIPBLAS_OP_N ? K : N;
+    int B_col = transB == HIPBLAS_OP_N ? N : K;
+
+    // check here to prevent undefined memory allocation error
+    if(M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+
+    int A_size = lda * A_col;
+    int B_size = ldb * B_col;
+    int C_size = ldc * N;
+
+    // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory, plz follow this practice
+    host_vector<double> hA(A_size);
+    host_vector<double> hB(B_size);
+    host_vector<double> hC(C_size);
+    host_vector<double> hC_cpu(C_size);
+    host_vector<double> hC_gpu(C_size);
+    host_vector<double> hC_ex(C_size);
+    host_vector<double> hC_again(C_size);
+
+    device_vector<double> dA(A_size);
+    device_vector<double> dB(B_size);
+    device_vector<double> dC(C_size);
+    device_vector<double> d_alpha(1);
+    device_vector<double> d_beta(1);
+
+    hipblasHandle_t handle;
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+    hipblas_client_create(&handle);
+
+    // Initial Data on CPU
+    srand(1);
+    for(auto* v : {&hA, &hB, &hC})
+        for(double& x : *v)
+            x = double(rand()) / RAND_MAX * 2 - 1;
+
+    hC_cpu = hC;
+    cblas_gemm<double>(
+        transA, transB, M, N, K, alpha, hA.data(), lda, hB.data(), ldb, beta, hC_cpu.data(), ldc);
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(double) * A_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB.data(), sizeof(double) * B_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &alpha, sizeof(double), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &beta, sizeof(double), hipMemcpyHostToDevice));
+
+    auto gemm_ex = [&](host_vector<double>& result) {
+        CHECK_HIP_ERROR(hipMemcpy(dC, hC.data(), sizeof(double) * C_size, hipMemcpyHostToDevice));
+        hipblasStatus_t gemm_status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE);
+        if(gemm_status == HIPBLAS_STATUS_SUCCESS)
+            gemm_status = hipblasGemmEx(handle,
+                                        transA,
+                                        transB,
+                                        M,
+                                        N,
+                                        K,
+                                        d_alpha,
+                                        dA,
+                                        HIPBLAS_R_64F,
+                                        lda,
+                                        dB,
+                                        HIPBLAS_R_64F,
+                                        ldb,
+                                        d_beta,
+                                        dC,
+                                        HIPBLAS_R_64F,
+                                        ldc,
+                                        HIPBLAS_R_64F,
+                                        HIPBLAS_GEMM_DEFAULT);
+        hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST);
+        CHECK_HIP_ERROR(
+            hipMemcpy(result.data(), dC, sizeof(double) * C_size, hipMemcpyDeviceToHost));
+        return gemm_status;
+    };
+
+    /* =====================================================================
+         ROCBLAS
+    =================================================================== */
+    CHECK_HIP_ERROR(hipMemcpy(dC, hC.data(), sizeof(double) * C_size, hipMemcpyHostToDevice));
+    status = hipblasSetGemmSplitK(handle, 3);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasDgemm(
+            handle, transA, transB, M, N, K, &alpha, dA, lda, dB, ldb, &beta, dC, ldc);
+    // 1, the default, so later gemms on a shared handle run whole; 0 would pick splits for them
+    hipblasSetGemmSplitK(handle, 1);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_client_destroy(handle);
+        return status;
+    }
+    CHECK_HIP_ERROR(hipMemcpy(hC_gpu.data(), dC, sizeof(double) * C_size, hipMemcpyDeviceToHost));
+
+    if(argus.unit_check)
+    {
+        double accumulation = (K + 2) * (std::abs(alpha) + std::abs(beta)) * pow(2.0, -52);
+        near_check_general<double>(M, N, ldc, hC_cpu.data(), hC_gpu.data(), accumulation);
+
+        EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, hipblasSetGemmSplitK(handle, 0));
+        EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, gemm_ex(hC_ex));
+        EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, gemm_ex(hC_again));
+        near_check_general<double>(M, N, ldc, hC_cpu.data(), hC_ex.data(), accumulation);
+        unit_check_general<double>(M, N, ldc, hC_ex.data(), hC_again.data());
+        EXPECT_EQ(HIPBLAS_STATUS_SUCCESS, hipblasSetGemmSplitK(handle, 1));
+    }
+
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
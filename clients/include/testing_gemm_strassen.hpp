@@ -0,0 +1,234 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <stdlib.h>
+#include <vector>
+
+#include "cblas_interface.h"
+#include "flops.h"
+#include "hipblas.hpp"
+#include "unit.h"
+#include "utility.h"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+// Bytes of workspace the Strassen-Winograd recursion of an m x k by k x n product takes: at each
+// level the quadrant sums of op(A) and op(B) and two products. A cutoff of 0 is the library's 8192
+inline size_t gemm_strassen_workspace(size_t elem, int levels, int cutoff, int m, int n, int k)
+{
+    if(levels == 0 || min(m, min(n, k)) < max(cutoff ? cutoff : 8192, 2))
+        return 0;
+    size_t m2 = m / 2, n2 = n / 2, k2 = k / 2;
+    return elem * (m2 * k2 + k2 * n2 + 2 * m2 * n2)
+           + gemm_strassen_workspace(elem, levels - 1, cutoff, m / 2, n / 2, k / 2);
+}
+
+// hipblasGemm with host and then device scalars, and hipblasGemmEx with device scalars, on a
+// handle set to argus.strassen_levels of recursion past argus.strassen_cutoff. Small integers
+// keep every sum and product of the recursion exact, so C is compared exactly with the host; with
+// beta 0 C starts as NaN, which must not be read. The gemms take the workspace of the recursion
+// when every dimension is past the cutoff, and none below it
+template <typename T>
+hipblasStatus_t testing_gemm_strassen(Arguments argus)
+{
+    int M   = argus.M;
+    int N   = argus.N;
+    int K   = argus.K;
+    int lda = argus.lda;
+    int ldb = argus.ldb;
+    int ldc = argus.ldc;
+
+    hipblasOperation_t transA = char2hipblas_operation(argus.transA_option);
+    hipblasOperation_t transB = char2hipblas_operation(argus.transB_option);
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    if(M < 0 || N < 0 || K < 0 || lda < max(1, transA == HIPBLAS_OP_N ? M : K)
+       || ldb < max(1, transB == HIPBLAS_OP_N ? K : N) || ldc < max(1, M))
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    if(M == 0 || N == 0)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    int A_size = lda * (transA == HIPBLAS_OP_N ? K : M);
+    int B_size = ldb * (transB == HIPBLAS_OP_N ? N : K);
+    int C_size = ldc * N;
+
+    T alpha = argus.get_alpha<T>();
+    T beta  = argus.get_beta<T>();
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA(A_size);
+    host_vector<T> hB(B_size);
+    host_vector<T> hC(C_size);
+    host_vector<T> hC_gold(C_size);
+    host_vector<T> hC_host(C_size);
+    host_vector<T> hC_device(C_size);
+    host_vector<T> hC_ex(C_size);
+
+    device_vector<T> dA(A_size);
+    device_vector<T> dB(B_size);
+    device_vector<T> dC(C_size);
+    device_vector<T> dalpha(1);
+    device_vector<T> dbeta(1);
+
+    hipblasHandle_t handle;
+    hipblas_client_create(&handle);
+
+    // Initial Data on CPU
+    srand(1);
+    for(int i = 0; i < A_size; i++)
+        hA[i] = T(rand() % 7 - 3);
+    for(int i = 0; i < B_size; i++)
+        hB[i] = T(rand() % 5 - 2);
+    for(int i = 0; i < C_size; i++)
+        hC[i] = beta == 0 ? numeric_limits<T>::quiet_NaN() : T(rand() % 3 - 1);
+
+    hC_gold = hC;
+    cblas_gemm<T>(transA,
+                  transB,
+                  M,
+                  N,
+                  K,
+                  alpha,
+                  hA.data(),
+                  lda,
+                  hB.data(),
+                  ldb,
+                  beta,
+                  hC_gold.data(),
+                  ldc);
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * A_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB.data(), sizeof(T) * B_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dalpha, &alpha, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dbeta, &beta, sizeof(T), hipMemcpyHostToDevice));
+
+    auto gemm = [&](const T* alpha_ptr, const T* beta_ptr) {
+        return hipblasGemm<T>(
+            handle, transA, transB, M, N, K, alpha_ptr, dA, lda, dB, ldb, beta_ptr, dC, ldc);
+    };
+    auto gemm_ex = [&] {
+        return hipblasGemmEx(handle,
+                             transA,
+                             transB,
+                             M,
+                             N,
+                             K,
+                             dalpha,
+                             dA,
+                             hipblas_datatype<T>,
+                             lda,
+                             dB,
+                             hipblas_datatype<T>,
+                             ldb,
+                             dbeta,
+                             dC,
+                             hipblas_datatype<T>,
+                             ldc,
+                             hipblas_datatype<T>,
+                             HIPBLAS_GEMM_DEFAULT);
+    };
+
+    /* =====================================================================
+           HIPBLAS
+    =================================================================== */
+
+    status = hipblasSetGemmStrassen(handle, argus.strassen_levels, argus.strassen_cutoff);
+
+    // a shared handle keeps the peak of the tests before
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasResetWorkspaceHighWaterMark(handle);
+
+    CHECK_HIP_ERROR(hipMemcpy(dC, hC.data(), sizeof(T) * C_size, hipMemcpyHostToDevice));
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = gemm(&alpha, &beta);
+    CHECK_HIP_ERROR(hipMemcpy(hC_host.data(), dC, sizeof(T) * C_size, hipMemcpyDeviceToHost));
+
+    if(status == HIPBLAS_STATUS_SUCCESS)
+    {
+        CHECK_HIP_ERROR(hipMemcpy(dC, hC.data(), sizeof(T) * C_size, hipMemcpyHostToDevice));
+        status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = gemm(dalpha, dbeta);
+        CHECK_HIP_ERROR(
+            hipMemcpy(hC_device.data(), dC, sizeof(T) * C_size, hipMemcpyDeviceToHost));
+    }
+
+    // the workspace of the two gemms, before gemm_ex
+    hipblasWorkspaceUsage_t usage{};
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasGetWorkspaceUsage(handle, &usage);
+
+    if(status == HIPBLAS_STATUS_SUCCESS)
+    {
+        CHECK_HIP_ERROR(hipMemcpy(dC, hC.data(), sizeof(T) * C_size, hipMemcpyHostToDevice));
+        status = gemm_ex();
+        CHECK_HIP_ERROR(hipMemcpy(hC_ex.data(), dC, sizeof(T) * C_size, hipMemcpyDeviceToHost));
+    }
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblasSetGemmStrassen(handle, 0, 0);
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    if(argus.unit_check)
+    {
+        unit_check_general<T>(M, N, ldc, hC_gold.data(), hC_host.data());
+        unit_check_general<T>(M, N, ldc, hC_gold.data(), hC_device.data());
+        unit_check_general<T>(M, N, ldc, hC_gold.data(), hC_ex.data());
+
+        size_t workspace = gemm_strassen_workspace(
+            sizeof(T), argus.strassen_levels, argus.strassen_cutoff, M, N, K);
+        if(workspace)
+            EXPECT_GE(usage.high_water_mark, workspace);
+        else
+            EXPECT_EQ(usage.high_water_mark, size_t(0));
+    }
+
+    if(argus.timing)
+    {
+        // with the device scalars the last call left the handle
+        hipblas_timing timing;
+        status = hipblas_time_launches(
+            handle, argus, timing, [&] { return gemm(dalpha, dbeta); });
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            hipblasSetGemmStrassen(handle, 0, 0);
+            hipblas_client_destroy(handle);
+            return status;
+        }
+
+        double gflop = gemm_gflop_count<T>(M, N, K);
+        double gbyte = gemm_gbyte_count<T>(M, N, K);
+
+        cout << "transA,transB,M,N,K,lda,ldb,ldc,strassen_levels,strassen_cutoff,"
+                HIPBLAS_TIMING_COLUMNS
+             << endl;
+        cout << argus.transA_option << ',' << argus.transB_option << ',' << M << ',' << N << ','
+             << K << ',' << lda << ',' << ldb << ',' << ldc << ',' << argus.strassen_levels << ','
+             << argus.strassen_cutoff << ',';
+        hipblas_print_timing(cout, timing, gflop, gbyte);
+    }
+
+    // later gemms on a shared handle run plain
+    hipblasSetGemmStrassen(handle, 0, 0);
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
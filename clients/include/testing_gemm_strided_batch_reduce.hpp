@@ -0,0 +1,192 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "cblas_interface.h"
+#include "flops.h"
+#include "hipblas.hpp"
+#include "unit.h"
+#include "utility.h"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+// The strided form of testing_gemm_batch_reduce. Batch b of op(A) and op(B) starts stride_scale
+// * b k-blocks in: a stride_scale of 1 lays the batches one after another along k, the column
+// blocks of one A or row blocks of one B, and one above leaves room between them
+template <typename T>
+hipblasStatus_t testing_gemm_strided_batch_reduce(Arguments argus)
+{
+    int    M            = argus.M;
+    int    N            = argus.N;
+    int    K            = argus.K;
+    int    lda          = argus.lda;
+    int    ldb          = argus.ldb;
+    int    ldc          = argus.ldc;
+    int    batch_count  = argus.batch_count;
+    double stride_scale = argus.stride_scale;
+
+    hipblasOperation_t transA = char2hipblas_operation(argus.transA_option);
+    hipblasOperation_t transB = char2hipblas_operation(argus.transB_option);
+
+    long long strideA = stride_scale * K * (transA == HIPBLAS_OP_N ? lda : 1);
+    long long strideB = stride_scale * K * (transB == HIPBLAS_OP_N ? 1 : ldb);
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    if(M < 0 || N < 0 || K < 0 || lda < max(1, transA == HIPBLAS_OP_N ? M : K)
+       || ldb < max(1, transB == HIPBLAS_OP_N ? K : N) || ldc < max(1, M) || batch_count < 0
+       || stride_scale < 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    if(M == 0 || N == 0)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    int    batches = max(batch_count, 1);
+    size_t A_size  = strideA * (batches - 1) + size_t(lda) * (transA == HIPBLAS_OP_N ? K : M);
+    size_t B_size  = strideB * (batches - 1) + size_t(ldb) * (transB == HIPBLAS_OP_N ? N : K);
+    int    C_size  = ldc * N;
+
+    T alpha = argus.get_alpha<T>();
+    T beta  = argus.get_beta<T>();
+    T one   = T(1);
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA(A_size);
+    host_vector<T> hB(B_size);
+    host_vector<T> hC(C_size);
+    host_vector<T> hC_gold(C_size);
+    host_vector<T> hC_host(C_size);
+    host_vector<T> hC_device(C_size);
+
+    device_vector<T> dA(A_size);
+    device_vector<T> dB(B_size);
+    device_vector<T> dC(C_size);
+    device_vector<T> dalpha(1);
+    device_vector<T> dbeta(1);
+
+    hipblasHandle_t handle;
+    hipblas_client_create(&handle);
+
+    // Initial Data on CPU
+    srand(1);
+    hipblas_init<T>(hA, 1, A_size, 1);
+    hipblas_init<T>(hB, 1, B_size, 1);
+    hipblas_init<T>(hC, M, N, ldc);
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * A_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB.data(), sizeof(T) * B_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dalpha, &alpha, sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dbeta, &beta, sizeof(T), hipMemcpyHostToDevice));
+
+    auto reduce = [&](const T* alpha_ptr, const T* beta_ptr) {
+        return hipblasGemmStridedBatchReduce<T>(handle,
+                                                transA,
+                                                transB,
+                                                M,
+                                                N,
+                                                K,
+                                                alpha_ptr,
+                                                dA,
+                                                lda,
+                                                strideA,
+                                                dB,
+                                                ldb,
+                                                strideB,
+                                                beta_ptr,
+                                                dC,
+                                                ldc,
+                                                batch_count);
+    };
+
+    /* =====================================================================
+           HIPBLAS
+    =================================================================== */
+
+    CHECK_HIP_ERROR(hipMemcpy(dC, hC.data(), sizeof(T) * C_size, hipMemcpyHostToDevice));
+    status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = reduce(&alpha, &beta);
+    CHECK_HIP_ERROR(hipMemcpy(hC_host.data(), dC, sizeof(T) * C_size, hipMemcpyDeviceToHost));
+
+    if(status == HIPBLAS_STATUS_SUCCESS)
+    {
+        CHECK_HIP_ERROR(hipMemcpy(dC, hC.data(), sizeof(T) * C_size, hipMemcpyHostToDevice));
+        status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = reduce(dalpha, dbeta);
+        CHECK_HIP_ERROR(
+            hipMemcpy(hC_device.data(), dC, sizeof(T) * C_size, hipMemcpyDeviceToHost));
+    }
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    if(argus.unit_check)
+    {
+        /* =====================================================================
+           CPU BLAS
+        =================================================================== */
+        // the first gemm applies beta, with K 0 when there are no batches
+        hC_gold = hC;
+        for(int b = 0; b < batches; b++)
+            cblas_gemm<T>(transA,
+                          transB,
+                          M,
+                          N,
+                          batch_count ? K : 0,
+                          alpha,
+                          hA.data() + b * strideA,
+                          lda,
+                          hB.data() + b * strideB,
+                          ldb,
+                          b ? one : beta,
+                          hC_gold.data(),
+                          ldc);
+
+        unit_check_general<T>(M, N, ldc, hC_gold.data(), hC_host.data());
+        unit_check_general<T>(M, N, ldc, hC_gold.data(), hC_device.data());
+    }
+
+    if(argus.timing)
+    {
+        // with the device scalars the last call left the handle
+        hipblas_timing timing;
+        status = hipblas_time_launches(
+            handle, argus, timing, [&] { return reduce(dalpha, dbeta); });
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            hipblas_client_destroy(handle);
+            return status;
+        }
+
+        double gflop = gemm_gflop_count<T>(M, N, K) * batch_count;
+        double gbyte = gemm_batch_reduce_gbyte_count<T>(M, N, K, batch_count);
+
+        cout << "transA,transB,M,N,K,lda,stride_a,ldb,stride_b,ldc,batch_count,"
+                HIPBLAS_TIMING_COLUMNS
+             << endl;
+        cout << argus.transA_option << ',' << argus.transB_option << ',' << M << ',' << N << ','
+             << K << ',' << lda << ',' << strideA << ',' << ldb << ',' << strideB << ',' << ldc
+             << ',' << batch_count << ',';
+        hipblas_print_timing(cout, timing, gflop, gbyte);
+    }
+
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
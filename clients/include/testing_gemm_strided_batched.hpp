@@ -10,6 +10,7 @@
 #include <vector>
 
 #include "cblas_interface.h"
+#include "device_init.h"
 #include "flops.h"
 #include "hipblas.hpp"
 #include "norm.h"
@@ -54,7 +55,7 @@ hipblasStatus_t testing_GemmStridedBatched(Arguments argus)
     T               rocblas_error = 0.0;
     hipblasHandle_t handle;
     hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
-    hipblasCreate(&handle);
+    hipblas_client_create(&handle);
 
     if(transA == HIPBLAS_OP_N)
     {
@@ -85,29 +86,64 @@ hipblasStatus_t testing_GemmStridedBatched(Arguments argus)
     B_size = bsb * batch_count;
     C_size = bsc * batch_count;
 
+    // without a host check the inputs can be filled on the device and the host copies skipped
+    bool host_init = argus.unit_check || !argus.device_init;
+
     // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory, plz follow this practice
-    vector<T> hA(A_size);
-    vector<T> hB(B_size);
-    vector<T> hC(C_size);
-    vector<T> hC_copy(C_size);
+    vector<T> hA(host_init ? A_size : 0);
+    vector<T> hB(host_init ? B_size : 0);
+    vector<T> hC(host_init ? C_size : 0);
+    vector<T> hC_copy(host_init ? C_size : 0);
 
     device_vector<T> dA(A_size);
     device_vector<T> dB(B_size);
     device_vector<T> dC(C_size);
 
-    // Initial Data on CPU
     srand(1);
-    hipblas_init<T>(hA, A_row, A_col * batch_count, lda);
-    hipblas_init<T>(hB, B_row, B_col * batch_count, ldb);
-    hipblas_init<T>(hC, M, N * batch_count, ldc);
-
-    // copy vector is easy in STL; hz = hx: save a copy in hC_copy which will be output of CPU BLAS
-    hC_copy = hC;
+    if(host_init)
+    {
+        // Initial Data on CPU
+        hipblas_init<T>(hA, A_row, A_col * batch_count, lda);
+        hipblas_init<T>(hB, B_row, B_col * batch_count, ldb);
+        hipblas_init<T>(hC, M, N * batch_count, ldc);
+
+        // copy vector is easy in STL; hz = hx: save a copy in hC_copy which will be output of
+        // CPU BLAS
+        hC_copy = hC;
+
+        // copy data from CPU to device, does not work for lda != A_row
+        CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * A_size, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dB, hB.data(), sizeof(T) * B_size, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dC, hC.data(), sizeof(T) * C_size, hipMemcpyHostToDevice));
+    }
+    else
+    {
+        CHECK_HIP_ERROR(hipblas_init_device<T>(dA, A_row, A_col * batch_count, lda));
+        CHECK_HIP_ERROR(hipblas_init_device<T>(dB, B_row, B_col * batch_count, ldb));
+        CHECK_HIP_ERROR(hipblas_init_device<T>(dC, M, N * batch_count, ldc));
+    }
 
-    // copy data from CPU to device, does not work for lda != A_row
-    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * A_size, hipMemcpyHostToDevice));
-    CHECK_HIP_ERROR(hipMemcpy(dB, hB.data(), sizeof(T) * B_size, hipMemcpyHostToDevice));
-    CHECK_HIP_ERROR(hipMemcpy(dC, hC.data(), sizeof(T) * C_size, hipMemcpyHostToDevice));
+    // the CPU reference runs while the GPU computes; it reads hA and hB and writes hC_copy only
+    hipblas_host_reference reference([&] {
+        if(argus.unit_check)
+        {
+            hipblas_batch_for(batch_count, [&](int i) {
+                cblas_gemm<T>(transA,
+                              transB,
+                              M,
+                              N,
+                              K,
+                              alpha,
+                              hA.data() + bsa * i,
+                              lda,
+                              hB.data() + bsb * i,
+                              ldb,
+                              beta,
+                              hC_copy.data() + bsc * i,
+                              ldc);
+            });
+        }
+    });
 
     /* =====================================================================
          ROCBLAS
@@ -134,7 +170,10 @@ hipblasStatus_t testing_GemmStridedBatched(Arguments argus)
                                           batch_count);
 
     // copy output from device to CPU
-    CHECK_HIP_ERROR(hipMemcpy(hC.data(), dC, sizeof(T) * C_size, hipMemcpyDeviceToHost));
+    if(host_init)
+    {
+        CHECK_HIP_ERROR(hipMemcpy(hC.data(), dC, sizeof(T) * C_size, hipMemcpyDeviceToHost));
+    }
 
     if(argus.unit_check)
     {
@@ -142,23 +181,7 @@ hipblasStatus_t testing_GemmStridedBatched(Arguments argus)
         /* =====================================================================
                     CPU BLAS
         =================================================================== */
-
-        for(int i = 0; i < batch_count; i++)
-        {
-            cblas_gemm<T>(transA,
-                          transB,
-                          M,
-                          N,
-                          K,
-                          alpha,
-                          hA.data() + bsa * i,
-                          lda,
-                          hB.data() + bsb * i,
-                          ldb,
-                          beta,
-                          hC_copy.data() + bsc * i,
-                          ldc);
-        }
+        reference.wait();
 
         // enable unit check, notice unit check is not invasive, but norm check is,
         // unit check and norm check can not be interchanged their order
@@ -169,6 +192,47 @@ hipblasStatus_t testing_GemmStridedBatched(Arguments argus)
 
     } // end of if unit/norm check
 
-    hipblasDestroy(handle);
+    if(argus.timing)
+    {
+        hipblas_timing timing;
+        status = hipblas_time_launches(handle, argus, timing, [&] {
+            return hipblasGemmStridedBatched<T>(handle,
+                                                transA,
+                                                transB,
+                                                M,
+                                                N,
+                                                K,
+                                                &alpha,
+                                                dA,
+                                                lda,
+                                                bsa,
+                                                dB,
+                                                ldb,
+                                                bsb,
+                                                &beta,
+                                                dC,
+                                                ldc,
+                                                bsc,
+                                                batch_count);
+        });
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            hipblas_client_destroy(handle);
+            return status;
+        }
+
+        double gflop = gemm_gflop_count<T>(M, N, K) * batch_count;
+        double gbyte = gemm_gbyte_count<T>(M, N, K) * batch_count;
+
+        cout << "transA,transB,M,N,K,alpha,lda,stride_a,ldb,stride_b,beta,ldc,stride_c,"
+                "batch_count," HIPBLAS_TIMING_COLUMNS
+             << endl;
+        cout << argus.transA_option << ',' << argus.transB_option << ',' << M << ',' << N << ','
+             << K << ',' << argus.alpha << ',' << lda << ',' << bsa << ',' << ldb << ',' << bsb
+             << ',' << argus.beta << ',' << ldc << ',' << bsc << ',' << batch_count << ',';
+        hipblas_print_timing(cout, timing, gflop, gbyte);
+    }
+
+    hipblas_client_destroy(handle);
     return HIPBLAS_STATUS_SUCCESS;
 }
@@ -0,0 +1,201 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <sys/time.h>
+#include <vector>
+
+#include "cblas_interface.h"
+#include "flops.h"
+#include "hipblas.hpp"
+#include "hipblas_vector.hpp"
+#include "norm.h"
+#include "unit.h"
+#include "utility.h"
+#include <typeinfo>
+
+using namespace std;
+
+/* ============================================================================================ */
+
+template <typename Td, typename Tc>
+hipblasStatus_t testing_gemm_strided_batched_ex_template(Arguments argus)
+{
+    hipblasOperation_t transA = char2hipblas_operation(argus.transA_option);
+    hipblasOperation_t transB = char2hipblas_operation(argus.transB_option);
+
+    int M = argus.M;
+    int N = argus.N;
+    int K = argus.K;
+
+    int lda         = argus.lda;
+    int ldb         = argus.ldb;
+    int ldc         = argus.ldc;
+    int batch_count = argus.batch_count;
+
+    Td h_alpha_Td, h_beta_Td;
+    Tc h_alpha_Tc, h_beta_Tc;
+
+    if(is_same<Td, hipblasHalf>::value)
+    {
+        h_alpha_Td = float_to_half(argus.alpha);
+        h_beta_Td  = float_to_half(argus.beta);
+    }
+    else
+    {
+        h_alpha_Td = static_cast<Td>(argus.alpha);
+        h_beta_Td  = static_cast<Td>(argus.beta);
+    }
+
+    if(is_same<Tc, hipblasHalf>::value)
+    {
+        h_alpha_Tc = float_to_half(argus.alpha);
+        h_beta_Tc  = float_to_half(argus.beta);
+    }
+    else
+    {
+        h_alpha_Tc = static_cast<Tc>(argus.alpha);
+        h_beta_Tc  = static_cast<Tc>(argus.beta);
+    }
+
+    int A_row = transA == HIPBLAS_OP_N ? M : K;
+    int A_col = transA == HIPBLAS_OP_N ? K : M;
+    int B_row = transB == HIPBLAS_OP_N ? K : N;
+    int B_col = transB == HIPBLAS_OP_N ? N : K;
+
+    // check here to prevent undefined memory allocation error
+    if(M < 0 || N < 0 || K < 0 || lda < A_row || ldb < B_row || ldc < M || batch_count < 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+
+    long long stride_A = static_cast<long long>(lda) * A_col;
+    long long stride_B = static_cast<long long>(ldb) * B_col;
+    long long stride_C = static_cast<long long>(ldc) * N;
+
+    size_t A_size = stride_A * batch_count;
+    size_t B_size = stride_B * batch_count;
+    size_t C_size = stride_C * batch_count;
+
+    // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory
+    vector<Td> hA(A_size);
+    vector<Td> hB(B_size);
+    vector<Td> hC(C_size);
+    vector<Td> hC_gold(C_size);
+
+    device_vector<Td> dA(A_size);
+    device_vector<Td> dB(B_size);
+    device_vector<Td> dC(C_size);
+
+    if((!dA && A_size) || (!dB && B_size) || (!dC && C_size))
+    {
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+    }
+
+    // Initial Data on CPU
+    srand(1);
+    hipblas_init<Td>(hA, A_row, A_col, lda, stride_A, batch_count);
+    hipblas_init_alternating_sign<Td>(hB, B_row, B_col, ldb, stride_B, batch_count);
+    hipblas_init<Td>(hC, M, N, ldc, stride_C, batch_count);
+    hC_gold = hC;
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(Td) * A_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB.data(), sizeof(Td) * B_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC, hC.data(), sizeof(Td) * C_size, hipMemcpyHostToDevice));
+
+    hipblasHandle_t handle;
+    hipblas_client_create(&handle);
+
+    hipblasStatus_t status = hipblasGemmStridedBatchedEx(handle,
+                                                         transA,
+                                                         transB,
+                                                         M,
+                                                         N,
+                                                         K,
+                                                         &h_alpha_Tc,
+                                                         dA,
+                                                         argus.a_type,
+                                                         lda,
+                                                         stride_A,
+                                                         dB,
+                                                         argus.b_type,
+                                                         ldb,
+                                                         stride_B,
+                                                         &h_beta_Tc,
+                                                         dC,
+                                                         argus.c_type,
+                                                         ldc,
+                                                         stride_C,
+                                                         batch_count,
+                                                         argus.compute_type,
+                                                         HIPBLAS_GEMM_DEFAULT);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    CHECK_HIP_ERROR(hipMemcpy(hC.data(), dC, sizeof(Td) * C_size, hipMemcpyDeviceToHost));
+
+    if(argus.unit_check)
+    {
+        /* =====================================================================
+                    CPU BLAS
+        =================================================================== */
+        hipblas_batch_for(batch_count, [&](int b) {
+            cblas_gemm<Td>(transA,
+                           transB,
+                           M,
+                           N,
+                           K,
+                           h_alpha_Td,
+                           hA.data() + b * stride_A,
+                           lda,
+                           hB.data() + b * stride_B,
+                           ldb,
+                           h_beta_Td,
+                           hC_gold.data() + b * stride_C,
+                           ldc);
+        });
+
+        unit_check_general<Td>(M, N, batch_count, ldc, stride_C, hC_gold.data(), hC.data());
+    }
+
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t testing_gemm_strided_batched_ex(Arguments argus)
+{
+    hipblasDatatype_t a_type       = argus.a_type;
+    hipblasDatatype_t b_type       = argus.b_type;
+    hipblasDatatype_t c_type       = argus.c_type;
+    hipblasDatatype_t compute_type = argus.compute_type;
+
+    if(a_type == HIPBLAS_R_16F && b_type == HIPBLAS_R_16F && c_type == HIPBLAS_R_16F
+       && compute_type == HIPBLAS_R_16F)
+    {
+        return testing_gemm_strided_batched_ex_template<hipblasHalf, hipblasHalf>(argus);
+    }
+    else if(a_type == HIPBLAS_R_16F && b_type == HIPBLAS_R_16F && c_type == HIPBLAS_R_16F
+            && compute_type == HIPBLAS_R_32F)
+    {
+        return testing_gemm_strided_batched_ex_template<hipblasHalf, float>(argus);
+    }
+    else if(a_type == HIPBLAS_R_32F && b_type == HIPBLAS_R_32F && c_type == HIPBLAS_R_32F
+            && compute_type == HIPBLAS_R_32F)
+    {
+        return testing_gemm_strided_batched_ex_template<float, float>(argus);
+    }
+    else if(a_type == HIPBLAS_R_64F && b_type == HIPBLAS_R_64F && c_type == HIPBLAS_R_64F
+            && compute_type == HIPBLAS_R_64F)
+    {
+        return testing_gemm_strided_batched_ex_template<double, double>(argus);
+    }
+
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
@@ -0,0 +1,172 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <math.h>
+#include <stdlib.h>
+#include <vector>
+
+#include "cblas_interface.h"
+#include "hipblas.hpp"
+#include "unit.h"
+#include "utility.h"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+// hipblasSgemmWithOrder and hipblasCgemvWithOrder in row-major order, the gemv with
+// HIPBLAS_OP_C, which runs on conjugated vectors. Every matrix is M x K, K x N or M x N as read
+// row by row, with lda, ldb and ldc row strides. The data are small integers, so the results are
+// exact and checked bitwise against loops over the row-major matrices
+hipblasStatus_t testing_gemm_with_order(Arguments argus)
+{
+    int M = argus.M;
+    int N = argus.N;
+    int K = argus.K;
+
+    int lda = argus.lda;
+    int ldb = argus.ldb;
+    int ldc = argus.ldc;
+
+    hipblasOperation_t transA = char2hipblas_operation(argus.transA_option);
+    hipblasOperation_t transB = char2hipblas_operation(argus.transB_option);
+
+    int A_row = transA == HIPBLAS_OP_N ? M : K;
+    int A_col = transA == HIPBLAS_OP_N ? K : M;
+    int B_row = transB == HIPBLAS_OP_N ? K : N;
+    int B_col = transB == HIPBLAS_OP_N ? N : K;
+
+    // check here to prevent undefined memory allocation error
+    if(M < 0 || N < 0 || K < 0 || lda < A_col || ldb < B_col || ldc < N)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+
+    int A_size = lda * A_row;
+    int B_size = ldb * B_row;
+    int C_size = ldc * M;
+
+    float alpha = argus.alpha;
+    float beta  = argus.beta;
+
+    // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory, plz follow this practice
+    host_vector<float> hA(A_size);
+    host_vector<float> hB(B_size);
+    host_vector<float> hC(C_size);
+    host_vector<float> hC_cpu(C_size);
+
+    device_vector<float> dA(A_size);
+    device_vector<float> dB(B_size);
+    device_vector<float> dC(C_size);
+
+    hipblasHandle_t handle;
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+    hipblas_client_create(&handle);
+
+    // Initial Data on CPU
+    srand(1);
+    for(auto* v : {&hA, &hB, &hC})
+        for(float& x : *v)
+            x = rand() % 9 - 4;
+    hC_cpu = hC;
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(float) * A_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB.data(), sizeof(float) * B_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC, hC.data(), sizeof(float) * C_size, hipMemcpyHostToDevice));
+
+    /* =====================================================================
+         ROCBLAS
+    =================================================================== */
+    status = hipblasSgemmWithOrder(handle,
+                                   HIPBLAS_ORDER_ROW_MAJOR,
+                                   transA,
+                                   transB,
+                                   M,
+                                   N,
+                                   K,
+                                   &alpha,
+                                   dA,
+                                   lda,
+                                   dB,
+                                   ldb,
+                                   &beta,
+                                   dC,
+                                   ldc);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    if(argus.unit_check)
+    {
+        CHECK_HIP_ERROR(hipMemcpy(hC.data(), dC, sizeof(float) * C_size, hipMemcpyDeviceToHost));
+        for(int i = 0; i < M; i++)
+            for(int j = 0; j < N; j++)
+            {
+                float sum = 0;
+                for(int l = 0; l < K; l++)
+                    sum += (transA == HIPBLAS_OP_N ? hA[i * lda + l] : hA[l * lda + i])
+                           * (transB == HIPBLAS_OP_N ? hB[l * ldb + j] : hB[j * ldb + l]);
+                hC_cpu[i * ldc + j] = alpha * sum + beta * hC_cpu[i * ldc + j];
+            }
+        unit_check_general<float>(N, M, ldc, hC_cpu.data(), hC.data());
+
+        // y = alpha A^H x + beta y with the M x K row-major A, which takes the workspace path
+        if(transA == HIPBLAS_OP_N)
+        {
+            host_vector<hipblasComplex> hAc(A_size), hx(M), hy(K), hy_cpu(K);
+            for(int i = 0; i < A_size; i++)
+                hAc[i] = hipblasComplex(hA[i], hA[(i + 1) % A_size]);
+            for(int i = 0; i < M; i++)
+                hx[i] = hipblasComplex(rand() % 9 - 4, rand() % 9 - 4);
+            for(int i = 0; i < K; i++)
+                hy[i] = hipblasComplex(rand() % 9 - 4, rand() % 9 - 4);
+
+            hipblasComplex calpha(argus.alpha, 1), cbeta(argus.beta, -2);
+            for(int j = 0; j < K; j++)
+            {
+                hipblasComplex sum = 0;
+                for(int i = 0; i < M; i++)
+                {
+                    hipblasComplex a = hAc[i * lda + j];
+                    sum += hipblasComplex(a.x, -a.y) * hx[i];
+                }
+                hy_cpu[j] = calpha * sum + cbeta * hy[j];
+            }
+
+            device_vector<hipblasComplex> dAc(A_size), dx(M), dy(K);
+            CHECK_HIP_ERROR(hipMemcpy(
+                dAc, hAc.data(), sizeof(hipblasComplex) * A_size, hipMemcpyHostToDevice));
+            CHECK_HIP_ERROR(
+                hipMemcpy(dx, hx.data(), sizeof(hipblasComplex) * M, hipMemcpyHostToDevice));
+            CHECK_HIP_ERROR(
+                hipMemcpy(dy, hy.data(), sizeof(hipblasComplex) * K, hipMemcpyHostToDevice));
+
+            EXPECT_EQ(HIPBLAS_STATUS_SUCCESS,
+                      hipblasCgemvWithOrder(handle,
+                                            HIPBLAS_ORDER_ROW_MAJOR,
+                                            HIPBLAS_OP_C,
+                                            M,
+                                            K,
+                                            &calpha,
+                                            dAc,
+                                            lda,
+                                            dx,
+                                            1,
+                                            &cbeta,
+                                            dy,
+                                            1));
+            CHECK_HIP_ERROR(
+                hipMemcpy(hy.data(), dy, sizeof(hipblasComplex) * K, hipMemcpyDeviceToHost));
+            unit_check_general<hipblasComplex>(1, K, 1, hy_cpu.data(), hy.data());
+        }
+    }
+
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
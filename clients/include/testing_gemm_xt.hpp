@@ -0,0 +1,116 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "cblas_interface.h"
+#include "hipblas.hpp"
+#include "unit.h"
+#include "utility.h"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+template <typename T>
+hipblasStatus_t testing_gemm_xt(Arguments argus)
+{
+    int M = argus.M;
+    int N = argus.N;
+    int K = argus.K;
+
+    int lda = argus.lda;
+    int ldb = argus.ldb;
+    int ldc = argus.ldc;
+
+    hipblasOperation_t transA = char2hipblas_operation(argus.transA_option);
+    hipblasOperation_t transB = char2hipblas_operation(argus.transB_option);
+
+    T alpha = argus.alpha;
+    T beta  = argus.beta;
+
+    int A_row = transA == HIPBLAS_OP_N ? M : K;
+    int A_col = transA == HIPBLAS_OP_N ? K : M;
+    int B_row = transB == HIPBLAS_OP_N ? K : N;
+    int B_col = transB == HIPBLAS_OP_N ? N : K;
+
+    // check here to prevent undefined memory allocation error
+    if(M < 0 || N < 0 || K < 0 || lda < max(1, A_row) || ldb < max(1, B_row) || ldc < max(1, M))
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+
+    // Naming: all matrices are in CPU (host) memory, which hipblasXtGemm streams to the device
+    host_vector<T> hA(lda * A_col);
+    host_vector<T> hB(ldb * B_col);
+    host_vector<T> hC(ldc * N);
+    host_vector<T> hC_gold(ldc * N);
+
+    hipblasHandle_t handle;
+    hipblas_client_create(&handle);
+
+    // A small block so that the test sizes span several tiles and k steps
+    hipblasStatus_t status = hipblasXtSetBlockDim(handle, 64);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    // Initial Data on CPU
+    srand(1);
+    hipblas_init<T>(hA, A_row, A_col, lda);
+    hipblas_init<T>(hB, B_row, B_col, ldb);
+    hipblas_init<T>(hC, M, N, ldc);
+    hC_gold = hC;
+
+    /* =====================================================================
+         HIPBLAS
+    =================================================================== */
+    status = hipblasXtGemm<T>(handle,
+                              transA,
+                              transB,
+                              M,
+                              N,
+                              K,
+                              &alpha,
+                              hA.data(),
+                              lda,
+                              hB.data(),
+                              ldb,
+                              &beta,
+                              hC.data(),
+                              ldc);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    if(argus.unit_check)
+    {
+        cblas_gemm<T>(transA,
+                      transB,
+                      M,
+                      N,
+                      K,
+                      alpha,
+                      hA.data(),
+                      lda,
+                      hB.data(),
+                      ldb,
+                      beta,
+                      hC_gold.data(),
+                      ldc);
+
+        unit_check_general<T>(M, N, ldc, hC_gold.data(), hC.data());
+    }
+
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
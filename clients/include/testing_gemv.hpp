@@ -94,7 +94,7 @@ hipblasStatus_t testing_gemv(Arguments argus)
     T beta  = (T)argus.beta;
 
     hipblasHandle_t handle;
-    hipblasCreate(&handle);
+    hipblas_client_create(&handle);
 
     // Initial Data on CPU
     srand(1);
@@ -121,7 +121,7 @@ hipblasStatus_t testing_gemv(Arguments argus)
 
         if(status != HIPBLAS_STATUS_SUCCESS)
         {
-            hipblasDestroy(handle);
+            hipblas_client_destroy(handle);
             return status;
         }
     }
@@ -145,6 +145,28 @@ hipblasStatus_t testing_gemv(Arguments argus)
         }
     }
 
-    hipblasDestroy(handle);
+    if(argus.timing)
+    {
+        hipblas_timing timing;
+        status = hipblas_time_launches(handle, argus, timing, [&] {
+            return hipblasGemv<T>(
+                handle, transA, M, N, (T*)&alpha, dA, lda, dx, incx, (T*)&beta, dy, incy);
+        });
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            hipblas_client_destroy(handle);
+            return status;
+        }
+
+        double gflop = gemv_gflop_count<T>(M, N);
+        double gbyte = gemv_gbyte_count<T>(M, N);
+
+        cout << "transA,M,N,alpha,lda,incx,beta,incy," HIPBLAS_TIMING_COLUMNS << endl;
+        cout << argus.transA_option << ',' << M << ',' << N << ',' << argus.alpha << ',' << lda
+             << ',' << incx << ',' << argus.beta << ',' << incy << ',';
+        hipblas_print_timing(cout, timing, gflop, gbyte);
+    }
+
+    hipblas_client_destroy(handle);
     return HIPBLAS_STATUS_SUCCESS;
 }
@@ -67,7 +67,7 @@ hipblasStatus_t testing_gemvBatched(Arguments argus)
     }
 
     hipblasHandle_t handle;
-    hipblasCreate(&handle);
+    hipblas_client_create(&handle);
 
     double gpu_time_used, cpu_time_used;
     double hipblasGflops, cblas_gflops, hipblasBandwidth;
@@ -96,7 +96,7 @@ hipblasStatus_t testing_gemvBatched(Arguments argus)
     if(!dA_array || !dx_array || !dy_array || (!bA_array[last] && A_size)
        || (!bx_array[last] && X_size) || (!by_array[last] && Y_size))
     {
-        hipblasDestroy(handle);
+        hipblas_client_destroy(handle);
         return HIPBLAS_STATUS_ALLOC_FAILED;
     }
 
@@ -123,7 +123,7 @@ hipblasStatus_t testing_gemvBatched(Arguments argus)
 
         if(err_A != hipSuccess || err_x != hipSuccess || err_y != hipSuccess)
         {
-            hipblasDestroy(handle);
+            hipblas_client_destroy(handle);
             return HIPBLAS_STATUS_MAPPING_ERROR;
         }
     }
@@ -133,7 +133,7 @@ hipblasStatus_t testing_gemvBatched(Arguments argus)
     err_y = hipMemcpy(dy_array, by_array, batch_count * sizeof(T*), hipMemcpyHostToDevice);
     if(err_A != hipSuccess || err_x != hipSuccess || err_y != hipSuccess)
     {
-        hipblasDestroy(handle);
+        hipblas_client_destroy(handle);
         return HIPBLAS_STATUS_MAPPING_ERROR;
     }
 
@@ -159,7 +159,7 @@ hipblasStatus_t testing_gemvBatched(Arguments argus)
         if(status != HIPBLAS_STATUS_SUCCESS)
         {
             // here in cuda
-            hipblasDestroy(handle);
+            hipblas_client_destroy(handle);
             return status;
         }
     }
@@ -176,11 +176,10 @@ hipblasStatus_t testing_gemvBatched(Arguments argus)
            CPU BLAS
         =================================================================== */
 
-        for(int b = 0; b < batch_count; b++)
-        {
+        hipblas_batch_for(batch_count, [&](int b) {
             cblas_gemv<T>(
                 transA, M, N, alpha, hA_array[b], lda, hx_array[b], incx, beta, hz_array[b], incy);
-        }
+        });
 
         // enable unit check, notice unit check is not invasive, but norm check is,
         // unit check and norm check can not be interchanged their order
@@ -190,6 +189,6 @@ hipblasStatus_t testing_gemvBatched(Arguments argus)
         }
     }
 
-    hipblasDestroy(handle);
+    hipblas_client_destroy(handle);
     return HIPBLAS_STATUS_SUCCESS;
 }
@@ -86,7 +86,7 @@ hipblasStatus_t testing_gemvStridedBatched(Arguments argus)
     T beta  = (T)argus.beta;
 
     hipblasHandle_t handle;
-    hipblasCreate(&handle);
+    hipblas_client_create(&handle);
 
     // Initial Data on CPU
     srand(1);
@@ -127,7 +127,7 @@ hipblasStatus_t testing_gemvStridedBatched(Arguments argus)
         if(status != HIPBLAS_STATUS_SUCCESS)
         {
             // here in cuda
-            hipblasDestroy(handle);
+            hipblas_client_destroy(handle);
             return status;
         }
     }
@@ -141,8 +141,7 @@ hipblasStatus_t testing_gemvStridedBatched(Arguments argus)
            CPU BLAS
         =================================================================== */
 
-        for(int b = 0; b < batch_count; b++)
-        {
+        hipblas_batch_for(batch_count, [&](int b) {
             cblas_gemv<T>(transA,
                           M,
                           N,
@@ -154,7 +153,7 @@ hipblasStatus_t testing_gemvStridedBatched(Arguments argus)
                           beta,
                           hz.data() + b * stride_y,
                           incy);
-        }
+        });
 
         // enable unit check, notice unit check is not invasive, but norm check is,
         // unit check and norm check can not be interchanged their order
@@ -164,6 +163,6 @@ hipblasStatus_t testing_gemvStridedBatched(Arguments argus)
         }
     }
 
-    hipblasDestroy(handle);
+    hipblas_client_destroy(handle);
     return HIPBLAS_STATUS_SUCCESS;
 }
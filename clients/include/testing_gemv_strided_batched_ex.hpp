@@ -0,0 +1,154 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+#include "cblas_interface.h"
+#include "hipblas.hpp"
+#include "norm.h"
+#include "unit.h"
+#include "utility.h"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+// A and x are stored as Ti and y as To; alpha, beta and the arithmetic are float
+template <typename Ti, typename To>
+hipblasStatus_t testing_gemv_strided_batched_ex(Arguments argus)
+{
+    int    M            = argus.M;
+    int    N            = argus.N;
+    int    lda          = argus.lda;
+    int    incx         = argus.incx;
+    int    incy         = argus.incy;
+    double stride_scale = argus.stride_scale;
+    int    batch_count  = argus.batch_count;
+
+    hipblasOperation_t transA = char2hipblas_operation(argus.transA_option);
+
+    int x_els = transA == HIPBLAS_OP_N ? N : M;
+    int y_els = transA == HIPBLAS_OP_N ? M : N;
+
+    int stride_A = lda * N * stride_scale;
+    int stride_x = x_els * incx * stride_scale;
+    int stride_y = y_els * incy * stride_scale;
+    int A_size   = stride_A * batch_count;
+    int X_size   = stride_x * batch_count;
+    int Y_size   = stride_y * batch_count;
+
+    float alpha = argus.alpha;
+    float beta  = argus.beta;
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    if(M < 0 || N < 0 || lda < 0 || incx <= 0 || incy <= 0 || batch_count < 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    if(batch_count == 0)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<Ti> hA(A_size);
+    host_vector<Ti> hx(X_size);
+    host_vector<To> hy(Y_size);
+
+    device_vector<Ti> dA(A_size);
+    device_vector<Ti> dx(X_size);
+    device_vector<To> dy(Y_size);
+
+    hipblasHandle_t handle;
+    hipblas_client_create(&handle);
+
+    // Initial Data on CPU
+    srand(1);
+    hipblas_init<Ti>(hA, M, N, lda, stride_A, batch_count);
+    hipblas_init<Ti>(hx, 1, x_els, incx, stride_x, batch_count);
+    hipblas_init<To>(hy, 1, y_els, incy, stride_y, batch_count);
+
+    // The reference runs in float on the same values
+    host_vector<float> fA(A_size), fx(X_size), fy(Y_size);
+    for(int i = 0; i < A_size; i++)
+        fA[i] = hipblas_to_float(hA[i]);
+    for(int i = 0; i < X_size; i++)
+        fx[i] = hipblas_to_float(hx[i]);
+    for(int i = 0; i < Y_size; i++)
+        fy[i] = hipblas_to_float(hy[i]);
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(Ti) * A_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(Ti) * X_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy, hy.data(), sizeof(To) * Y_size, hipMemcpyHostToDevice));
+
+    /* =====================================================================
+           ROCBLAS
+    =================================================================== */
+    status = hipblasGemvStridedBatchedEx(handle,
+                                         transA,
+                                         M,
+                                         N,
+                                         &alpha,
+                                         dA,
+                                         hipblas_datatype<Ti>,
+                                         lda,
+                                         stride_A,
+                                         dx,
+                                         hipblas_datatype<Ti>,
+                                         incx,
+                                         stride_x,
+                                         &beta,
+                                         dy,
+                                         hipblas_datatype<To>,
+                                         incy,
+                                         stride_y,
+                                         batch_count,
+                                         HIPBLAS_R_32F);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    // copy output from device to CPU
+    CHECK_HIP_ERROR(hipMemcpy(hy.data(), dy, sizeof(To) * Y_size, hipMemcpyDeviceToHost));
+
+    if(argus.unit_check)
+    {
+        /* =====================================================================
+           CPU BLAS
+        =================================================================== */
+        hipblas_batch_for(batch_count, [&](int b) {
+            cblas_gemv<float>(transA,
+                              M,
+                              N,
+                              alpha,
+                              fA.data() + b * stride_A,
+                              lda,
+                              fx.data() + b * stride_x,
+                              incx,
+                              beta,
+                              fy.data() + b * stride_y,
+                              incy);
+        });
+
+        // compare after rounding the reference to To
+        host_vector<float> gy(Y_size);
+        for(int i = 0; i < Y_size; i++)
+        {
+            fy[i] = hipblas_to_float(hipblas_from_float<To>(fy[i]));
+            gy[i] = hipblas_to_float(hy[i]);
+        }
+        unit_check_general<float>(1, y_els, batch_count, incy, stride_y, fy.data(), gy.data());
+    }
+
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
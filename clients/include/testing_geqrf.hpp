@@ -50,7 +50,7 @@ hipblasStatus_t testing_geqrf(Arguments argus)
     double rocblas_error;
 
     hipblasHandle_t handle;
-    hipblasCreate(&handle);
+    hipblas_client_create(&handle);
 
     // Initial hA on CPU
     srand(1);
@@ -68,7 +68,7 @@ hipblasStatus_t testing_geqrf(Arguments argus)
 
     if(status != HIPBLAS_STATUS_SUCCESS)
     {
-        hipblasDestroy(handle);
+        hipblas_client_destroy(handle);
         return status;
     }
 
@@ -85,7 +85,7 @@ hipblasStatus_t testing_geqrf(Arguments argus)
         // Workspace query
         host_vector<T> work(1);
         cblas_geqrf(M, N, hA.data(), lda, hIpiv.data(), work.data(), -1);
-        int lwork = (int)work[0];
+        int lwork = (int)std::abs(work[0]);
 
         // Perform factorization
         work = host_vector<T>(lwork);
@@ -93,8 +93,8 @@ hipblasStatus_t testing_geqrf(Arguments argus)
 
         if(argus.unit_check)
         {
-            T      eps       = std::numeric_limits<T>::epsilon();
-            double tolerance = eps * 2000;
+            real_t<T> eps       = std::numeric_limits<real_t<T>>::epsilon();
+            double    tolerance = eps * 2000;
 
             double e1 = norm_check_general<T>('M', M, N, lda, hA.data(), hA1.data());
             unit_check_error(e1, tolerance);
@@ -105,6 +105,35 @@ hipblasStatus_t testing_geqrf(Arguments argus)
         }
     }
 
-    hipblasDestroy(handle);
+    if(argus.timing)
+    {
+        // the timed calls factor in place, so each gets the original matrix back first
+        srand(1);
+        hipblas_init<T>(hA, M, N, lda);
+        device_vector<T> dA0(A_size);
+        CHECK_HIP_ERROR(hipMemcpy(dA0, hA.data(), A_size * sizeof(T), hipMemcpyHostToDevice));
+
+        hipblas_timing timing;
+        status = hipblas_time_launches(
+            handle,
+            argus,
+            timing,
+            [&] { return hipblas_restore_input(handle, dA, dA0, A_size * sizeof(T)); },
+            [&] { return hipblasGeqrf<T>(handle, M, N, dA, lda, dIpiv, &info); });
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            hipblas_client_destroy(handle);
+            return status;
+        }
+
+        double gflop = geqrf_gflop_count<T>(M, N);
+        double gbyte = geqrf_gbyte_count<T>(M, N);
+
+        cout << "M,N,lda," HIPBLAS_TIMING_COLUMNS << endl;
+        cout << M << ',' << N << ',' << lda << ',';
+        hipblas_print_timing(cout, timing, gflop, gbyte);
+    }
+
+    hipblas_client_destroy(handle);
     return HIPBLAS_STATUS_SUCCESS;
 }
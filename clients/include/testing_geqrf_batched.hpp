@@ -58,7 +58,7 @@ hipblasStatus_t testing_geqrf_batched(Arguments argus)
     double rocblas_error;
 
     hipblasHandle_t handle;
-    hipblasCreate(&handle);
+    hipblas_client_create(&handle);
 
     // Initial hA on CPU
     srand(1);
@@ -88,7 +88,7 @@ hipblasStatus_t testing_geqrf_batched(Arguments argus)
 
     if(status != HIPBLAS_STATUS_SUCCESS)
     {
-        hipblasDestroy(handle);
+        hipblas_client_destroy(handle);
         return status;
     }
 
@@ -109,7 +109,7 @@ hipblasStatus_t testing_geqrf_batched(Arguments argus)
         // Workspace query
         host_vector<T> work(1);
         cblas_geqrf(M, N, hA[0].data(), lda, hIpiv[0].data(), work.data(), -1);
-        int lwork = (int)work[0];
+        int lwork = (int)std::abs(work[0]);
 
         // Perform factorization
         work = host_vector<T>(lwork);
@@ -119,8 +119,8 @@ hipblasStatus_t testing_geqrf_batched(Arguments argus)
 
             if(argus.unit_check)
             {
-                T      eps       = std::numeric_limits<T>::epsilon();
-                double tolerance = eps * 2000;
+                real_t<T> eps       = std::numeric_limits<real_t<T>>::epsilon();
+                double    tolerance = eps * 2000;
 
                 double e1 = norm_check_general<T>('M', M, N, lda, hA[b].data(), hA1[b].data());
                 unit_check_error(e1, tolerance);
@@ -132,6 +132,6 @@ hipblasStatus_t testing_geqrf_batched(Arguments argus)
         }
     }
 
-    hipblasDestroy(handle);
+    hipblas_client_destroy(handle);
     return HIPBLAS_STATUS_SUCCESS;
 }
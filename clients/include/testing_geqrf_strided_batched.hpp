@@ -58,7 +58,7 @@ hipblasStatus_t testing_geqrf_strided_batched(Arguments argus)
     double rocblas_error;
 
     hipblasHandle_t handle;
-    hipblasCreate(&handle);
+    hipblas_client_create(&handle);
 
     // Initial hA on CPU
     srand(1);
@@ -82,7 +82,7 @@ hipblasStatus_t testing_geqrf_strided_batched(Arguments argus)
 
     if(status != HIPBLAS_STATUS_SUCCESS)
     {
-        hipblasDestroy(handle);
+        hipblas_client_destroy(handle);
         return status;
     }
 
@@ -99,7 +99,7 @@ hipblasStatus_t testing_geqrf_strided_batched(Arguments argus)
         // Workspace query
         host_vector<T> work(1);
         cblas_geqrf(M, N, hA.data(), lda, hIpiv.data(), work.data(), -1);
-        int lwork = (int)work[0];
+        int lwork = (int)std::abs(work[0]);
 
         // Perform factorization
         work = host_vector<T>(lwork);
@@ -110,8 +110,8 @@ hipblasStatus_t testing_geqrf_strided_batched(Arguments argus)
 
             if(argus.unit_check)
             {
-                T      eps       = std::numeric_limits<T>::epsilon();
-                double tolerance = eps * 2000;
+                real_t<T> eps       = std::numeric_limits<real_t<T>>::epsilon();
+                double    tolerance = eps * 2000;
 
                 double e1 = norm_check_general<T>(
                     'M', M, N, lda, hA.data() + b * strideA, hA1.data() + b * strideA);
@@ -128,6 +128,39 @@ hipblasStatus_t testing_geqrf_strided_batched(Arguments argus)
         }
     }
 
-    hipblasDestroy(handle);
+    if(argus.timing)
+    {
+        // the timed calls factor in place, so each gets the original matrices back first
+        srand(1);
+        for(int b = 0; b < batch_count; b++)
+            hipblas_init<T>(hA.data() + b * strideA, M, N, lda);
+        device_vector<T> dA0(A_size);
+        CHECK_HIP_ERROR(hipMemcpy(dA0, hA.data(), A_size * sizeof(T), hipMemcpyHostToDevice));
+
+        hipblas_timing timing;
+        status = hipblas_time_launches(
+            handle,
+            argus,
+            timing,
+            [&] { return hipblas_restore_input(handle, dA, dA0, A_size * sizeof(T)); },
+            [&] {
+                return hipblasGeqrfStridedBatched<T>(
+                    handle, M, N, dA, lda, strideA, dIpiv, strideP, &info, batch_count);
+            });
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            hipblas_client_destroy(handle);
+            return status;
+        }
+
+        double gflop = geqrf_gflop_count<T>(M, N) * batch_count;
+        double gbyte = geqrf_gbyte_count<T>(M, N) * batch_count;
+
+        cout << "M,N,lda,stride_a,batch_count," HIPBLAS_TIMING_COLUMNS << endl;
+        cout << M << ',' << N << ',' << lda << ',' << strideA << ',' << batch_count << ',';
+        hipblas_print_timing(cout, timing, gflop, gbyte);
+    }
+
+    hipblas_client_destroy(handle);
     return HIPBLAS_STATUS_SUCCESS;
 }
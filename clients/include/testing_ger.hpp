@@ -78,7 +78,7 @@ hipblasStatus_t testing_ger(Arguments argus)
     T alpha = argus.get_alpha<T>();
 
     hipblasHandle_t handle;
-    hipblasCreate(&handle);
+    hipblas_client_create(&handle);
 
     // Initial Data on CPU
     srand(1);
@@ -97,21 +97,12 @@ hipblasStatus_t testing_ger(Arguments argus)
     /* =====================================================================
            ROCBLAS
     =================================================================== */
-    if(argus.timing)
-    {
-        gpu_time_used = get_time_us(); // in microseconds
-    }
+    status = hipblasGer<T, CONJ>(handle, M, N, (T*)&alpha, dx, incx, dy, incy, dA, lda);
 
-    for(int iter = 0; iter < 1; iter++)
+    if(status != HIPBLAS_STATUS_SUCCESS)
     {
-
-        status = hipblasGer<T, CONJ>(handle, M, N, (T*)&alpha, dx, incx, dy, incy, dA, lda);
-
-        if(status != HIPBLAS_STATUS_SUCCESS)
-        {
-            hipblasDestroy(handle);
-            return status;
-        }
+        hipblas_client_destroy(handle);
+        return status;
     }
 
     // copy output from device to CPU
@@ -132,6 +123,26 @@ hipblasStatus_t testing_ger(Arguments argus)
         }
     }
 
-    hipblasDestroy(handle);
+    if(argus.timing)
+    {
+        hipblas_timing timing;
+        status = hipblas_time_launches(handle, argus, timing, [&] {
+            return hipblasGer<T, CONJ>(handle, M, N, (T*)&alpha, dx, incx, dy, incy, dA, lda);
+        });
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            hipblas_client_destroy(handle);
+            return status;
+        }
+
+        double gflop = ger_gflop_count<T>(M, N);
+        double gbyte = ger_gbyte_count<T>(M, N);
+
+        cout << "M,N,incx,incy,lda," HIPBLAS_TIMING_COLUMNS << endl;
+        cout << M << ',' << N << ',' << incx << ',' << incy << ',' << lda << ',';
+        hipblas_print_timing(cout, timing, gflop, gbyte);
+    }
+
+    hipblas_client_destroy(handle);
     return HIPBLAS_STATUS_SUCCESS;
 }
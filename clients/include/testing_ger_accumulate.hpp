@@ -0,0 +1,160 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "cblas_interface.h"
+#include "flops.h"
+#include "hipblas.hpp"
+#include "unit.h"
+#include "utility.h"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+// A += alpha (x[0] y[0]^T + ... + x[K - 1] y[K - 1]^T), y^H for CONJ, with alpha on the host and
+// then on the device. Small integers keep every product and sum exact, so A is compared exactly
+// with the K host gers applied one after another
+template <typename T, bool CONJ>
+hipblasStatus_t testing_ger_accumulate(Arguments argus)
+{
+    int M    = argus.M;
+    int N    = argus.N;
+    int K    = argus.K;
+    int incx = argus.incx;
+    int incy = argus.incy;
+    int lda  = argus.lda;
+
+    T alpha = argus.get_alpha<T>();
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    if(M < 0 || N < 0 || K < 0 || incx == 0 || incy == 0 || lda < max(1, M))
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    if(M == 0 || N == 0 || K == 0)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    int A_size = lda * N;
+    int x_size = M * abs(incx);
+    int y_size = N * abs(incy);
+
+    hipblasHandle_t handle;
+    hipblas_client_create(&handle);
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA(A_size);
+    host_vector<T> hA_gold(A_size);
+    host_vector<T> hA_host(A_size);
+    host_vector<T> hA_device(A_size);
+    host_vector<T> hx[K];
+    host_vector<T> hy[K];
+
+    device_batch_vector<T> bx(K, x_size);
+    device_batch_vector<T> by(K, y_size);
+
+    device_vector<T*, 0, T> dx(K);
+    device_vector<T*, 0, T> dy(K);
+    device_vector<T>        dA(A_size);
+    device_vector<T>        dalpha(1);
+
+    if(!dx || !dy || !dA || !dalpha || !bx[K - 1] || !by[K - 1])
+    {
+        hipblas_client_destroy(handle);
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+    }
+
+    // Initial Data on CPU
+    srand(1);
+    hipblas_init<T>(hA, M, N, lda);
+    for(int b = 0; b < K; b++)
+    {
+        hx[b] = host_vector<T>(x_size);
+        hy[b] = host_vector<T>(y_size);
+        hipblas_init<T>(hx[b], 1, M, abs(incx));
+        hipblas_init<T>(hy[b], 1, N, abs(incy));
+
+        CHECK_HIP_ERROR(hipMemcpy(bx[b], hx[b], sizeof(T) * x_size, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(by[b], hy[b], sizeof(T) * y_size, hipMemcpyHostToDevice));
+    }
+    CHECK_HIP_ERROR(hipMemcpy(dx, bx, sizeof(T*) * K, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy, by, sizeof(T*) * K, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dalpha, &alpha, sizeof(T), hipMemcpyHostToDevice));
+
+    auto accumulate = [&](const T* alpha_ptr) {
+        return hipblasGerAccumulate<T, CONJ>(
+            handle, M, N, K, alpha_ptr, dx, incx, dy, incy, dA, lda);
+    };
+
+    /* =====================================================================
+           HIPBLAS
+    =================================================================== */
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * A_size, hipMemcpyHostToDevice));
+    status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = accumulate(&alpha);
+    CHECK_HIP_ERROR(hipMemcpy(hA_host.data(), dA, sizeof(T) * A_size, hipMemcpyDeviceToHost));
+
+    if(status == HIPBLAS_STATUS_SUCCESS)
+    {
+        CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * A_size, hipMemcpyHostToDevice));
+        status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = accumulate(dalpha);
+        CHECK_HIP_ERROR(
+            hipMemcpy(hA_device.data(), dA, sizeof(T) * A_size, hipMemcpyDeviceToHost));
+    }
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    if(argus.unit_check)
+    {
+        /* =====================================================================
+           CPU BLAS
+        =================================================================== */
+        hA_gold = hA;
+        for(int b = 0; b < K; b++)
+            cblas_ger<T, CONJ>(M, N, alpha, hx[b], incx, hy[b], incy, hA_gold, lda);
+
+        unit_check_general<T>(M, N, lda, hA_gold.data(), hA_host.data());
+        unit_check_general<T>(M, N, lda, hA_gold.data(), hA_device.data());
+    }
+
+    if(argus.timing)
+    {
+        // with the device alpha the last call left the handle
+        hipblas_timing timing;
+        status = hipblas_time_launches(handle, argus, timing, [&] { return accumulate(dalpha); });
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            hipblas_client_destroy(handle);
+            return status;
+        }
+
+        double gflop = ger_gflop_count<T>(M, N) * K;
+        double gbyte = ger_accumulate_gbyte_count<T>(M, N, K);
+
+        cout << "M,N,K,incx,incy,lda," HIPBLAS_TIMING_COLUMNS << endl;
+        cout << M << ',' << N << ',' << K << ',' << incx << ',' << incy << ',' << lda << ',';
+        hipblas_print_timing(cout, timing, gflop, gbyte);
+    }
+
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
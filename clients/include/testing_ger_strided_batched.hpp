@@ -67,7 +67,7 @@ hipblasStatus_t testing_ger_strided_batched(Arguments argus)
     T alpha = (T)argus.alpha;
 
     hipblasHandle_t handle;
-    hipblasCreate(&handle);
+    hipblas_client_create(&handle);
 
     // Initial Data on CPU
     srand(1);
@@ -86,34 +86,25 @@ hipblasStatus_t testing_ger_strided_batched(Arguments argus)
     /* =====================================================================
            ROCBLAS
     =================================================================== */
-    if(argus.timing)
+    status = hipblasGerStridedBatched<T, CONJ>(handle,
+                                               M,
+                                               N,
+                                               (T*)&alpha,
+                                               dx,
+                                               incx,
+                                               stride_x,
+                                               dy,
+                                               incy,
+                                               stride_y,
+                                               dA,
+                                               lda,
+                                               stride_A,
+                                               batch_count);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
     {
-        gpu_time_used = get_time_us(); // in microseconds
-    }
-
-    for(int iter = 0; iter < 1; iter++)
-    {
-
-        status = hipblasGerStridedBatched<T, CONJ>(handle,
-                                                   M,
-                                                   N,
-                                                   (T*)&alpha,
-                                                   dx,
-                                                   incx,
-                                                   stride_x,
-                                                   dy,
-                                                   incy,
-                                                   stride_y,
-                                                   dA,
-                                                   lda,
-                                                   stride_A,
-                                                   batch_count);
-
-        if(status != HIPBLAS_STATUS_SUCCESS)
-        {
-            hipblasDestroy(handle);
-            return status;
-        }
+        hipblas_client_destroy(handle);
+        return status;
     }
 
     // copy output from device to CPU
@@ -124,8 +115,7 @@ hipblasStatus_t testing_ger_strided_batched(Arguments argus)
         /* =====================================================================
            CPU BLAS
         =================================================================== */
-        for(int b = 0; b < batch_count; b++)
-        {
+        hipblas_batch_for(batch_count, [&](int b) {
             cblas_ger<T, CONJ>(M,
                                N,
                                alpha,
@@ -135,7 +125,7 @@ hipblasStatus_t testing_ger_strided_batched(Arguments argus)
                                incy,
                                hB.data() + b * stride_A,
                                lda);
-        }
+        });
 
         // enable unit check, notice unit check is not invasive, but norm check is,
         // unit check and norm check can not be interchanged their order
@@ -145,6 +135,40 @@ hipblasStatus_t testing_ger_strided_batched(Arguments argus)
         }
     }
 
-    hipblasDestroy(handle);
+    if(argus.timing)
+    {
+        hipblas_timing timing;
+        status = hipblas_time_launches(handle, argus, timing, [&] {
+            return hipblasGerStridedBatched<T, CONJ>(handle,
+                                                     M,
+                                                     N,
+                                                     (T*)&alpha,
+                                                     dx,
+                                                     incx,
+                                                     stride_x,
+                                                     dy,
+                                                     incy,
+                                                     stride_y,
+                                                     dA,
+                                                     lda,
+                                                     stride_A,
+                                                     batch_count);
+        });
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            hipblas_client_destroy(handle);
+            return status;
+        }
+
+        double gflop = ger_gflop_count<T>(M, N) * batch_count;
+        double gbyte = ger_gbyte_count<T>(M, N) * batch_count;
+
+        cout << "M,N,incx,incy,lda,stride_scale,batch_count," HIPBLAS_TIMING_COLUMNS << endl;
+        cout << M << ',' << N << ',' << incx << ',' << incy << ',' << lda << ',' << stride_scale
+             << ',' << batch_count << ',';
+        hipblas_print_timing(cout, timing, gflop, gbyte);
+    }
+
+    hipblas_client_destroy(handle);
     return HIPBLAS_STATUS_SUCCESS;
 }
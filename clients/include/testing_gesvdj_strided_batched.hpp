@@ -0,0 +1,196 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "cblas_interface.h"
+#include "flops.h"
+#include "hipblas.hpp"
+#include "near.h"
+#include "norm.h"
+#include "unit.h"
+#include "utility.h"
+
+using namespace std;
+
+// The singular vectors reconstruct A as U * diag(S) * V^H, and a second run without them gives the
+// same singular values
+template <typename T>
+hipblasStatus_t testing_gesvdj_strided_batched(Arguments argus)
+{
+    int M           = argus.M;
+    int N           = argus.N;
+    int lda         = argus.lda;
+    int batch_count = argus.batch_count;
+    int max_sweeps  = 100;
+
+    int K       = min(M, N);
+    int ldu     = max(M, 1);
+    int ldv     = max(K, 1);
+    int strideA = lda * N * argus.stride_scale;
+    int strideU = ldu * K;
+    int strideV = ldv * N;
+    int A_size  = strideA * batch_count;
+    int U_size  = strideU * batch_count;
+    int V_size  = strideV * batch_count;
+    int S_size  = K * batch_count;
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+
+    // Check to prevent memory allocation error
+    if(M < 0 || N < 0 || lda < max(1, M) || batch_count < 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    if(batch_count == 0)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T>   hA(A_size);
+    host_vector<T>   hU(U_size);
+    host_vector<T>   hV(V_size);
+    host_vector<T>   hS(S_size);
+    host_vector<T>   hS_values(S_size);
+    host_vector<int> hSweeps(batch_count);
+    host_vector<int> hInfo(batch_count);
+
+    device_vector<T>   dA(A_size);
+    device_vector<T>   dU(U_size);
+    device_vector<T>   dV(V_size);
+    device_vector<T>   dS(S_size);
+    device_vector<T>   dResidual(batch_count);
+    device_vector<int> dSweeps(batch_count);
+    device_vector<int> dInfo(batch_count);
+
+    hipblasHandle_t handle;
+    hipblas_client_create(&handle);
+
+    // Initial hA on CPU: entries in [-0.1, 0.9]
+    srand(1);
+    hipblas_init<T>(hA, M, N, lda, strideA, batch_count);
+    for(int b = 0; b < batch_count; b++)
+        for(int j = 0; j < N; j++)
+            for(int i = 0; i < M; i++)
+                hA[b * strideA + i + j * lda] = (hA[b * strideA + i + j * lda] - 1.0) / 10.0;
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), A_size * sizeof(T), hipMemcpyHostToDevice));
+
+    /* =====================================================================
+           HIPBLAS
+    =================================================================== */
+
+    status = hipblasGesvdjStridedBatched<T, T>(handle,
+                                               HIPBLAS_SVECT_SINGULAR,
+                                               HIPBLAS_SVECT_SINGULAR,
+                                               M,
+                                               N,
+                                               dA,
+                                               lda,
+                                               strideA,
+                                               0,
+                                               dResidual,
+                                               max_sweeps,
+                                               dSweeps,
+                                               dS,
+                                               K,
+                                               dU,
+                                               ldu,
+                                               strideU,
+                                               dV,
+                                               ldv,
+                                               strideV,
+                                               dInfo,
+                                               batch_count);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    // copy output from device to CPU
+    CHECK_HIP_ERROR(hipMemcpy(hU.data(), dU, U_size * sizeof(T), hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hV.data(), dV, V_size * sizeof(T), hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hS.data(), dS, S_size * sizeof(T), hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(
+        hipMemcpy(hSweeps.data(), dSweeps, batch_count * sizeof(int), hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(
+        hipMemcpy(hInfo.data(), dInfo, batch_count * sizeof(int), hipMemcpyDeviceToHost));
+
+    // The singular values alone, from a fresh copy of A
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), A_size * sizeof(T), hipMemcpyHostToDevice));
+    status = hipblasGesvdjStridedBatched<T, T>(handle,
+                                               HIPBLAS_SVECT_NONE,
+                                               HIPBLAS_SVECT_NONE,
+                                               M,
+                                               N,
+                                               dA,
+                                               lda,
+                                               strideA,
+                                               0,
+                                               dResidual,
+                                               max_sweeps,
+                                               dSweeps,
+                                               dS,
+                                               K,
+                                               nullptr,
+                                               1,
+                                               0,
+                                               nullptr,
+                                               1,
+                                               0,
+                                               dInfo,
+                                               batch_count);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    CHECK_HIP_ERROR(hipMemcpy(hS_values.data(), dS, S_size * sizeof(T), hipMemcpyDeviceToHost));
+
+    if(argus.unit_check && K > 0)
+    {
+        // A = U * diag(S) * V^H, with S descending
+        T      eps       = std::numeric_limits<T>::epsilon();
+        double tolerance = max(M, N) * eps * 100;
+
+        hipblasOperation_t op = HIPBLAS_OP_N;
+        host_vector<T>     hUS(ldu * K);
+        host_vector<T>     hUSV(lda * N);
+        for(int b = 0; b < batch_count; b++)
+        {
+            EXPECT_EQ(0, hInfo[b]);
+            EXPECT_LE(hSweeps[b], max_sweeps);
+
+            T* s = hS.data() + b * K;
+            T* u = hU.data() + b * strideU;
+            T* v = hV.data() + b * strideV;
+            T* a = hA.data() + b * strideA;
+            for(int j = 0; j < K; j++)
+            {
+                if(j > 0)
+                    EXPECT_LE(s[j], s[j - 1]);
+                for(int i = 0; i < M; i++)
+                    hUS[i + j * ldu] = u[i + j * ldu] * s[j];
+            }
+            cblas_gemm<T>(op, op, M, N, K, 1, hUS.data(), ldu, v, ldv, 0, hUSV.data(), lda);
+
+            double e = norm_check_general<T>('F', M, N, lda, a, hUSV.data());
+            unit_check_error(e, tolerance);
+
+            near_check_general<T>(1, K, 1, s, hS_values.data() + b * K, T(tolerance * s[0]));
+        }
+    }
+
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
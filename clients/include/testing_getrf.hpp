@@ -52,7 +52,7 @@ hipblasStatus_t testing_getrf(Arguments argus)
     double rocblas_error;
 
     hipblasHandle_t handle;
-    hipblasCreate(&handle);
+    hipblas_client_create(&handle);
 
     // Initial hA on CPU
     srand(1);
@@ -71,7 +71,7 @@ hipblasStatus_t testing_getrf(Arguments argus)
 
     if(status != HIPBLAS_STATUS_SUCCESS)
     {
-        hipblasDestroy(handle);
+        hipblas_client_destroy(handle);
         return status;
     }
 
@@ -99,6 +99,35 @@ hipblasStatus_t testing_getrf(Arguments argus)
         }
     }
 
-    hipblasDestroy(handle);
+    if(argus.timing)
+    {
+        // the timed calls factor in place, so each gets the original matrix back first
+        srand(1);
+        hipblas_init<T>(hA, M, N, lda);
+        device_vector<T> dA0(A_size);
+        CHECK_HIP_ERROR(hipMemcpy(dA0, hA.data(), A_size * sizeof(T), hipMemcpyHostToDevice));
+
+        hipblas_timing timing;
+        status = hipblas_time_launches(
+            handle,
+            argus,
+            timing,
+            [&] { return hipblas_restore_input(handle, dA, dA0, A_size * sizeof(T)); },
+            [&] { return hipblasGetrf<T>(handle, N, dA, lda, dIpiv, dInfo); });
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            hipblas_client_destroy(handle);
+            return status;
+        }
+
+        double gflop = getrf_gflop_count<T>(N);
+        double gbyte = getrf_gbyte_count<T>(M, N);
+
+        cout << "N,lda," HIPBLAS_TIMING_COLUMNS << endl;
+        cout << N << ',' << lda << ',';
+        hipblas_print_timing(cout, timing, gflop, gbyte);
+    }
+
+    hipblas_client_destroy(handle);
     return HIPBLAS_STATUS_SUCCESS;
 }
@@ -60,7 +60,7 @@ hipblasStatus_t testing_getrf_batched(Arguments argus)
     double rocblas_error;
 
     hipblasHandle_t handle;
-    hipblasCreate(&handle);
+    hipblas_client_create(&handle);
 
     // Initial hA on CPU
     srand(1);
@@ -83,11 +83,11 @@ hipblasStatus_t testing_getrf_batched(Arguments argus)
            HIPBLAS
     =================================================================== */
 
-    status = hipblasGetrfBatched<T>(handle, N, dA, lda, dIpiv, dInfo, batch_count);
+    status = hipblasGetrfBatched<T>(handle, N, dA, lda, dIpiv, strideP, dInfo, batch_count);
 
     if(status != HIPBLAS_STATUS_SUCCESS)
     {
-        hipblasDestroy(handle);
+        hipblas_client_destroy(handle);
         return status;
     }
 
@@ -120,6 +120,6 @@ hipblasStatus_t testing_getrf_batched(Arguments argus)
         }
     }
 
-    hipblasDestroy(handle);
+    hipblas_client_destroy(handle);
     return HIPBLAS_STATUS_SUCCESS;
 }
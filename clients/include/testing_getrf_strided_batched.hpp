@@ -60,7 +60,7 @@ hipblasStatus_t testing_getrf_strided_batched(Arguments argus)
     double rocblas_error;
 
     hipblasHandle_t handle;
-    hipblasCreate(&handle);
+    hipblas_client_create(&handle);
 
     // Initial hA on CPU
     srand(1);
@@ -85,7 +85,7 @@ hipblasStatus_t testing_getrf_strided_batched(Arguments argus)
 
     if(status != HIPBLAS_STATUS_SUCCESS)
     {
-        hipblasDestroy(handle);
+        hipblas_client_destroy(handle);
         return status;
     }
 
@@ -118,6 +118,39 @@ hipblasStatus_t testing_getrf_strided_batched(Arguments argus)
         }
     }
 
-    hipblasDestroy(handle);
+    if(argus.timing)
+    {
+        // the timed calls factor in place, so each gets the original matrices back first
+        srand(1);
+        for(int b = 0; b < batch_count; b++)
+            hipblas_init<T>(hA.data() + b * strideA, M, N, lda);
+        device_vector<T> dA0(A_size);
+        CHECK_HIP_ERROR(hipMemcpy(dA0, hA.data(), A_size * sizeof(T), hipMemcpyHostToDevice));
+
+        hipblas_timing timing;
+        status = hipblas_time_launches(
+            handle,
+            argus,
+            timing,
+            [&] { return hipblas_restore_input(handle, dA, dA0, A_size * sizeof(T)); },
+            [&] {
+                return hipblasGetrfStridedBatched<T>(
+                    handle, N, dA, lda, strideA, dIpiv, strideP, dInfo, batch_count);
+            });
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            hipblas_client_destroy(handle);
+            return status;
+        }
+
+        double gflop = getrf_gflop_count<T>(N) * batch_count;
+        double gbyte = getrf_gbyte_count<T>(M, N) * batch_count;
+
+        cout << "N,lda,stride_a,batch_count," HIPBLAS_TIMING_COLUMNS << endl;
+        cout << N << ',' << lda << ',' << strideA << ',' << batch_count << ',';
+        hipblas_print_timing(cout, timing, gflop, gbyte);
+    }
+
+    hipblas_client_destroy(handle);
     return HIPBLAS_STATUS_SUCCESS;
 }
@@ -0,0 +1,130 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "cblas_interface.h"
+#include "flops.h"
+#include "hipblas.hpp"
+#include "norm.h"
+#include "unit.h"
+#include "utility.h"
+
+using namespace std;
+
+template <typename T>
+hipblasStatus_t testing_getri_batched(Arguments argus)
+{
+    int N           = argus.N;
+    int lda         = argus.lda;
+    int ldc         = argus.lda;
+    int batch_count = argus.batch_count;
+
+    int strideP   = N;
+    int A_size    = lda * N;
+    int C_size    = ldc * N;
+    int Ipiv_size = strideP * batch_count;
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+
+    // Check to prevent memory allocation error
+    if(N < 0 || lda < N || batch_count < 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    if(batch_count == 0)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T>   hA[batch_count];
+    host_vector<T>   hC1[batch_count];
+    host_vector<int> hIpiv(Ipiv_size);
+    host_vector<int> hInfo1(batch_count);
+
+    device_batch_vector<T> bA(batch_count, A_size);
+    device_batch_vector<T> bC(batch_count, C_size);
+
+    device_vector<T*, 0, T> dA(batch_count);
+    device_vector<T*, 0, T> dC(batch_count);
+    device_vector<int>      dIpiv(Ipiv_size);
+    device_vector<int>      dInfo(batch_count);
+
+    hipblasHandle_t handle;
+    hipblas_client_create(&handle);
+
+    // Initial hA on CPU; the diagonal is boosted so every matrix is well conditioned
+    srand(1);
+    for(int b = 0; b < batch_count; b++)
+    {
+        hA[b]  = host_vector<T>(A_size);
+        hC1[b] = host_vector<T>(C_size);
+
+        hipblas_init<T>(hA[b], N, N, lda);
+        for(int i = 0; i < N; i++)
+            hA[b][i + i * lda] += T(10 * N);
+
+        // Copy data from CPU to device
+        CHECK_HIP_ERROR(hipMemcpy(bA[b], hA[b].data(), A_size * sizeof(T), hipMemcpyHostToDevice));
+    }
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, bA, batch_count * sizeof(T*), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC, bC, batch_count * sizeof(T*), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemset(dIpiv, 0, Ipiv_size * sizeof(int)));
+    CHECK_HIP_ERROR(hipMemset(dInfo, 0, batch_count * sizeof(int)));
+
+    /* =====================================================================
+           HIPBLAS
+    =================================================================== */
+
+    status = hipblasGetrfBatched<T>(handle, N, dA, lda, dIpiv, strideP, dInfo, batch_count);
+
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasGetriBatched<T>(
+            handle, N, dA, lda, dIpiv, strideP, dC, ldc, dInfo, batch_count);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    // Copy output from device to CPU
+    for(int b = 0; b < batch_count; b++)
+        CHECK_HIP_ERROR(hipMemcpy(hC1[b].data(), bC[b], C_size * sizeof(T), hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(
+        hipMemcpy(hInfo1.data(), dInfo, batch_count * sizeof(int), hipMemcpyDeviceToHost));
+
+    if(argus.unit_check)
+    {
+        /* =====================================================================
+           CPU LAPACK
+        =================================================================== */
+
+        int            lwork = max(1, N);
+        host_vector<T> work(lwork);
+        for(int b = 0; b < batch_count; b++)
+        {
+            cblas_getrf(N, N, hA[b].data(), lda, hIpiv.data() + b * strideP);
+            int info
+                = cblas_getri(N, hA[b].data(), lda, hIpiv.data() + b * strideP, work.data(), lwork);
+
+            unit_check_general<int>(1, 1, 1, &info, hInfo1.data() + b);
+
+            real_t<T> eps       = std::numeric_limits<real_t<T>>::epsilon();
+            double    tolerance = eps * 2000;
+
+            double e = norm_check_general<T>('M', N, N, lda, hA[b].data(), hC1[b].data());
+            unit_check_error(e, tolerance);
+        }
+    }
+
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
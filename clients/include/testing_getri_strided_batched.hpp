@@ -0,0 +1,150 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "cblas_interface.h"
+#include "flops.h"
+#include "hipblas.hpp"
+#include "norm.h"
+#include "unit.h"
+#include "utility.h"
+
+using namespace std;
+
+template <typename T>
+hipblasStatus_t testing_getri_strided_batched(Arguments argus)
+{
+    int    N            = argus.N;
+    int    lda          = argus.lda;
+    int    ldc          = argus.lda;
+    int    batch_count  = argus.batch_count;
+    double stride_scale = argus.stride_scale;
+
+    int strideA   = lda * N * stride_scale;
+    int strideC   = ldc * N * stride_scale;
+    int strideP   = N * stride_scale;
+    int A_size    = strideA * batch_count;
+    int C_size    = strideC * batch_count;
+    int Ipiv_size = strideP * batch_count;
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+
+    // Check to prevent memory allocation error
+    if(N < 0 || lda < N || batch_count < 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    if(batch_count == 0)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T>   hA(A_size);
+    host_vector<T>   hC1(C_size);
+    host_vector<int> hIpiv(Ipiv_size);
+    host_vector<int> hInfo1(batch_count);
+
+    device_vector<T>   dA(A_size);
+    device_vector<T>   dC(C_size);
+    device_vector<int> dIpiv(Ipiv_size);
+    device_vector<int> dInfo(batch_count);
+
+    hipblasHandle_t handle;
+    hipblas_client_create(&handle);
+
+    // Initial hA on CPU; the diagonal is boosted so every matrix is well conditioned
+    srand(1);
+    for(int b = 0; b < batch_count; b++)
+    {
+        T* hAb = hA.data() + b * strideA;
+
+        hipblas_init<T>(hAb, N, N, lda);
+        for(int i = 0; i < N; i++)
+            hAb[i + i * lda] += T(10 * N);
+    }
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), A_size * sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemset(dIpiv, 0, Ipiv_size * sizeof(int)));
+    CHECK_HIP_ERROR(hipMemset(dInfo, 0, batch_count * sizeof(int)));
+
+    /* =====================================================================
+           HIPBLAS
+    =================================================================== */
+
+    status = hipblasGetrfStridedBatched<T>(
+        handle, N, dA, lda, strideA, dIpiv, strideP, dInfo, batch_count);
+
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasGetriStridedBatched<T>(
+            handle, N, dA, lda, strideA, dIpiv, strideP, dC, ldc, strideC, dInfo, batch_count);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    // Copy output from device to CPU
+    CHECK_HIP_ERROR(hipMemcpy(hC1.data(), dC, C_size * sizeof(T), hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(
+        hipMemcpy(hInfo1.data(), dInfo, batch_count * sizeof(int), hipMemcpyDeviceToHost));
+
+    if(argus.unit_check)
+    {
+        /* =====================================================================
+           CPU LAPACK
+        =================================================================== */
+
+        int            lwork = max(1, N);
+        host_vector<T> work(lwork);
+        for(int b = 0; b < batch_count; b++)
+        {
+            T*   hAb    = hA.data() + b * strideA;
+            int* hIpivb = hIpiv.data() + b * strideP;
+
+            cblas_getrf(N, N, hAb, lda, hIpivb);
+            int info = cblas_getri(N, hAb, lda, hIpivb, work.data(), lwork);
+
+            unit_check_general<int>(1, 1, 1, &info, hInfo1.data() + b);
+
+            real_t<T> eps       = std::numeric_limits<real_t<T>>::epsilon();
+            double    tolerance = eps * 2000;
+
+            double e = norm_check_general<T>('M', N, N, lda, hAb, hC1.data() + b * strideC);
+            unit_check_error(e, tolerance);
+        }
+    }
+
+    if(argus.timing)
+    {
+        hipblas_timing timing;
+        status = hipblas_time_launches(handle, argus, timing, [&] {
+            return hipblasGetriStridedBatched<T>(
+                handle, N, dA, lda, strideA, dIpiv, strideP, dC, ldc, strideC, dInfo, batch_count);
+        });
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            hipblas_client_destroy(handle);
+            return status;
+        }
+
+        double gflop = getri_gflop_count<T>(N) * batch_count;
+        double gbyte = getri_gbyte_count<T>(N) * batch_count;
+
+        cout << "N,lda,ldc,stride_a,stride_c,batch_count," HIPBLAS_TIMING_COLUMNS << endl;
+        cout << N << ',' << lda << ',' << ldc << ',' << strideA << ',' << strideC << ','
+             << batch_count << ',';
+        hipblas_print_timing(cout, timing, gflop, gbyte);
+    }
+
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -54,7 +54,7 @@ hipblasStatus_t testing_getrs(Arguments argus)
     double rocblas_error;
 
     hipblasHandle_t handle;
-    hipblasCreate(&handle);
+    hipblas_client_create(&handle);
 
     // Initial hA, hB, hX on CPU
     srand(1);
@@ -98,7 +98,7 @@ hipblasStatus_t testing_getrs(Arguments argus)
 
     if(status != HIPBLAS_STATUS_SUCCESS)
     {
-        hipblasDestroy(handle);
+        hipblas_client_destroy(handle);
         return status;
     }
 
@@ -130,6 +130,33 @@ hipblasStatus_t testing_getrs(Arguments argus)
         }
     }
 
-    hipblasDestroy(handle);
+    if(argus.timing)
+    {
+        // the timed calls overwrite B with the solution, so each gets B back first
+        device_vector<T> dB0(B_size);
+        CHECK_HIP_ERROR(hipMemcpy(dB0, hX.data(), B_size * sizeof(T), hipMemcpyHostToDevice));
+
+        hipblas_timing timing;
+        status = hipblas_time_launches(
+            handle,
+            argus,
+            timing,
+            [&] { return hipblas_restore_input(handle, dB, dB0, B_size * sizeof(T)); },
+            [&] { return hipblasGetrs<T>(handle, op, N, 1, dA, lda, dIpiv, dB, ldb, &info); });
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            hipblas_client_destroy(handle);
+            return status;
+        }
+
+        double gflop = getrs_gflop_count<T>(N, 1);
+        double gbyte = getrs_gbyte_count<T>(N, 1);
+
+        cout << "N,nrhs,lda,ldb," HIPBLAS_TIMING_COLUMNS << endl;
+        cout << N << ',' << 1 << ',' << lda << ',' << ldb << ',';
+        hipblas_print_timing(cout, timing, gflop, gbyte);
+    }
+
+    hipblas_client_destroy(handle);
     return HIPBLAS_STATUS_SUCCESS;
 }
@@ -63,7 +63,7 @@ hipblasStatus_t testing_getrs_batched(Arguments argus)
     double rocblas_error;
 
     hipblasHandle_t handle;
-    hipblasCreate(&handle);
+    hipblas_client_create(&handle);
 
     // Initial hA, hB, hX on CPU
     srand(1);
@@ -116,11 +116,12 @@ hipblasStatus_t testing_getrs_batched(Arguments argus)
            HIPBLAS
     =================================================================== */
 
-    status = hipblasGetrsBatched<T>(handle, op, N, 1, dA, lda, dIpiv, dB, ldb, &info, batch_count);
+    status = hipblasGetrsBatched<T>(
+        handle, op, N, 1, dA, lda, dIpiv, strideP, dB, ldb, &info, batch_count);
 
     if(status != HIPBLAS_STATUS_SUCCESS)
     {
-        hipblasDestroy(handle);
+        hipblas_client_destroy(handle);
         return status;
     }
 
@@ -152,6 +153,6 @@ hipblasStatus_t testing_getrs_batched(Arguments argus)
         }
     }
 
-    hipblasDestroy(handle);
+    hipblas_client_destroy(handle);
     return HIPBLAS_STATUS_SUCCESS;
 }
@@ -63,7 +63,7 @@ hipblasStatus_t testing_getrs_strided_batched(Arguments argus)
     double rocblas_error;
 
     hipblasHandle_t handle;
-    hipblasCreate(&handle);
+    hipblas_client_create(&handle);
 
     // Initial hA, hB, hX on CPU
     srand(1);
@@ -116,7 +116,7 @@ hipblasStatus_t testing_getrs_strided_batched(Arguments argus)
 
     if(status != HIPBLAS_STATUS_SUCCESS)
     {
-        hipblasDestroy(handle);
+        hipblas_client_destroy(handle);
         return status;
     }
 
@@ -154,6 +154,49 @@ hipblasStatus_t testing_getrs_strided_batched(Arguments argus)
         }
     }
 
-    hipblasDestroy(handle);
+    if(argus.timing)
+    {
+        // the timed calls overwrite B with the solutions, so each gets B back first
+        device_vector<T> dB0(B_size);
+        CHECK_HIP_ERROR(hipMemcpy(dB0, hX.data(), B_size * sizeof(T), hipMemcpyHostToDevice));
+
+        hipblas_timing timing;
+        status = hipblas_time_launches(
+            handle,
+            argus,
+            timing,
+            [&] { return hipblas_restore_input(handle, dB, dB0, B_size * sizeof(T)); },
+            [&] {
+                return hipblasGetrsStridedBatched<T>(handle,
+                                                     op,
+                                                     N,
+                                                     1,
+                                                     dA,
+                                                     lda,
+                                                     strideA,
+                                                     dIpiv,
+                                                     strideP,
+                                                     dB,
+                                                     ldb,
+                                                     strideB,
+                                                     &info,
+                                                     batch_count);
+            });
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            hipblas_client_destroy(handle);
+            return status;
+        }
+
+        double gflop = getrs_gflop_count<T>(N, 1) * batch_count;
+        double gbyte = getrs_gbyte_count<T>(N, 1) * batch_count;
+
+        cout << "N,nrhs,lda,ldb,stride_a,stride_b,batch_count," HIPBLAS_TIMING_COLUMNS << endl;
+        cout << N << ',' << 1 << ',' << lda << ',' << ldb << ',' << strideA << ',' << strideB << ','
+             << batch_count << ',';
+        hipblas_print_timing(cout, timing, gflop, gbyte);
+    }
+
+    hipblas_client_destroy(handle);
     return HIPBLAS_STATUS_SUCCESS;
 }
@@ -0,0 +1,107 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "cblas_interface.h"
+#include "flops.h"
+#include "hipblas.hpp"
+#include "norm.h"
+#include "unit.h"
+#include "utility.h"
+
+using namespace std;
+
+template <typename T>
+hipblasStatus_t testing_gtsv_interleaved_batched(Arguments argus)
+{
+    int M           = argus.M;
+    int batch_count = argus.batch_count;
+
+    int size = M * batch_count;
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+
+    // Check to prevent memory allocation error
+    if(M < 0 || batch_count < 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    if(M == 0 || batch_count == 0)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hDL(size);
+    host_vector<T> hD(size);
+    host_vector<T> hDU(size);
+    host_vector<T> hX(size);
+    host_vector<T> hB(size);
+
+    device_vector<T> dDL(size);
+    device_vector<T> dD(size);
+    device_vector<T> dDU(size);
+    device_vector<T> dB(size);
+
+    hipblasHandle_t handle;
+    hipblas_client_create(&handle);
+
+    // Initial the bands and hX on CPU, with a diagonally dominant matrix and hB = A * hX, so the
+    // solution is hX. Element i of batch b is at i * batch_count + b
+    srand(1);
+    hipblas_init<T>(hDL, batch_count, M, batch_count);
+    hipblas_init<T>(hD, batch_count, M, batch_count);
+    hipblas_init<T>(hDU, batch_count, M, batch_count);
+    hipblas_init<T>(hX, batch_count, M, batch_count);
+    for(int b = 0; b < batch_count; b++)
+    {
+        for(int i = 0; i < M; i++)
+        {
+            int k = i * batch_count + b;
+            hD[k] += 20;
+            hB[k] = hD[k] * hX[k];
+            if(i > 0)
+                hB[k] += hDL[k] * hX[k - batch_count];
+            if(i < M - 1)
+                hB[k] += hDU[k] * hX[k + batch_count];
+        }
+    }
+
+    CHECK_HIP_ERROR(hipMemcpy(dDL, hDL.data(), sizeof(T) * size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dD, hD.data(), sizeof(T) * size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dDU, hDU.data(), sizeof(T) * size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB.data(), sizeof(T) * size, hipMemcpyHostToDevice));
+
+    /* =====================================================================
+           HIPBLAS
+    =================================================================== */
+
+    status = hipblasGtsvInterleavedBatched<T>(handle, M, dDL, dD, dDU, dB, batch_count);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    // copy output from device to CPU
+    CHECK_HIP_ERROR(hipMemcpy(hB.data(), dB, sizeof(T) * size, hipMemcpyDeviceToHost));
+
+    if(argus.unit_check)
+    {
+        T      eps       = std::numeric_limits<T>::epsilon();
+        double tolerance = eps * 100;
+
+        double e = norm_check_general<T>('F', batch_count, M, batch_count, hX.data(), hB.data());
+        unit_check_error(e, tolerance);
+    }
+
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,116 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "cblas_interface.h"
+#include "flops.h"
+#include "hipblas.hpp"
+#include "norm.h"
+#include "unit.h"
+#include "utility.h"
+
+using namespace std;
+
+template <typename T>
+hipblasStatus_t testing_gtsv_strided_batched(Arguments argus)
+{
+    int M           = argus.M;
+    int batch_count = argus.batch_count;
+    int stride      = M * argus.stride_scale;
+
+    int size = stride * batch_count;
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+
+    // Check to prevent memory allocation error
+    if(M < 0 || batch_count < 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    if(M == 0 || batch_count == 0)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hDL(size);
+    host_vector<T> hD(size);
+    host_vector<T> hDU(size);
+    host_vector<T> hX(size);
+    host_vector<T> hB(size);
+
+    device_vector<T> dDL(size);
+    device_vector<T> dD(size);
+    device_vector<T> dDU(size);
+    device_vector<T> dB(size);
+
+    hipblasHandle_t handle;
+    hipblas_client_create(&handle);
+
+    // Initial the bands and hX on CPU, with a diagonally dominant matrix and hB = A * hX, so the
+    // solution is hX
+    srand(1);
+    hipblas_init<T>(hDL, M, 1, M, stride, batch_count);
+    hipblas_init<T>(hD, M, 1, M, stride, batch_count);
+    hipblas_init<T>(hDU, M, 1, M, stride, batch_count);
+    hipblas_init<T>(hX, M, 1, M, stride, batch_count);
+    for(int b = 0; b < batch_count; b++)
+    {
+        T* dl = hDL.data() + b * stride;
+        T* d  = hD.data() + b * stride;
+        T* du = hDU.data() + b * stride;
+        T* x  = hX.data() + b * stride;
+        T* y  = hB.data() + b * stride;
+        for(int i = 0; i < M; i++)
+        {
+            d[i] += 20;
+            y[i] = d[i] * x[i];
+            if(i > 0)
+                y[i] += dl[i] * x[i - 1];
+            if(i < M - 1)
+                y[i] += du[i] * x[i + 1];
+        }
+    }
+
+    CHECK_HIP_ERROR(hipMemcpy(dDL, hDL.data(), sizeof(T) * size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dD, hD.data(), sizeof(T) * size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dDU, hDU.data(), sizeof(T) * size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB.data(), sizeof(T) * size, hipMemcpyHostToDevice));
+
+    /* =====================================================================
+           HIPBLAS
+    =================================================================== */
+
+    status = hipblasGtsvStridedBatched<T>(handle, M, dDL, dD, dDU, dB, stride, batch_count);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    // copy output from device to CPU
+    CHECK_HIP_ERROR(hipMemcpy(hB.data(), dB, sizeof(T) * size, hipMemcpyDeviceToHost));
+
+    if(argus.unit_check)
+    {
+        T      eps       = std::numeric_limits<T>::epsilon();
+        double tolerance = eps * 100;
+
+        for(int b = 0; b < batch_count; b++)
+        {
+            double e = norm_check_general<T>(
+                'F', M, 1, M, hX.data() + b * stride, hB.data() + b * stride);
+            unit_check_error(e, tolerance);
+        }
+    }
+
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -59,7 +59,7 @@ hipblasStatus_t testing_hbmv(Arguments argus)
     T beta  = argus.get_beta<T>();
 
     hipblasHandle_t handle;
-    hipblasCreate(&handle);
+    hipblas_client_create(&handle);
 
     // Initial Data on CPU
     srand(1);
@@ -86,7 +86,7 @@ hipblasStatus_t testing_hbmv(Arguments argus)
 
         if(status != HIPBLAS_STATUS_SUCCESS)
         {
-            hipblasDestroy(handle);
+            hipblas_client_destroy(handle);
             return status;
         }
     }
@@ -110,6 +110,6 @@ hipblasStatus_t testing_hbmv(Arguments argus)
         }
     }
 
-    hipblasDestroy(handle);
+    hipblas_client_destroy(handle);
     return HIPBLAS_STATUS_SUCCESS;
 }
@@ -0,0 +1,126 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "cblas_interface.h"
+#include "flops.h"
+#include "hipblas.hpp"
+#include "norm.h"
+#include "unit.h"
+#include "utility.h"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+template <typename T>
+hipblasStatus_t testing_hemm(Arguments argus)
+{
+    int M   = argus.M;
+    int N   = argus.N;
+    int lda = argus.lda;
+    int ldb = argus.ldb;
+    int ldc = argus.ldc;
+
+    hipblasSideMode_t side = char2hipblas_side(argus.side_option);
+    hipblasFillMode_t uplo = char2hipblas_fill(argus.uplo_option);
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+
+    // A is K x K, K = M for side == left and N for side == right
+    int K = (side == HIPBLAS_SIDE_LEFT ? M : N);
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    if(M < 0 || N < 0 || lda < K || ldb < M || ldc < M)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+
+    int A_size = lda * K;
+    int B_size = ldb * N;
+    int C_size = ldc * N;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA(A_size);
+    host_vector<T> hB(B_size);
+    host_vector<T> hC(C_size);
+    host_vector<T> hC2(C_size);
+
+    device_vector<T> dA(A_size);
+    device_vector<T> dB(B_size);
+    device_vector<T> dC(C_size);
+
+    T alpha = argus.get_alpha<T>();
+    T beta  = argus.get_beta<T>();
+
+    hipblasHandle_t handle;
+    hipblas_client_create(&handle);
+
+    // Initial Data on CPU; only the uplo triangle of A is referenced
+    srand(1);
+    hipblas_init<T>(hA, K, K, lda);
+    hipblas_init<T>(hB, M, N, ldb);
+    hipblas_init<T>(hC, M, N, ldc);
+
+    // copy data from CPU to device
+    hipMemcpy(dA, hA.data(), sizeof(T) * A_size, hipMemcpyHostToDevice);
+    hipMemcpy(dB, hB.data(), sizeof(T) * B_size, hipMemcpyHostToDevice);
+    hipMemcpy(dC, hC.data(), sizeof(T) * C_size, hipMemcpyHostToDevice);
+
+    /* =====================================================================
+           ROCBLAS
+    =================================================================== */
+    status = hipblasHemm<T>(handle, side, uplo, M, N, &alpha, dA, lda, dB, ldb, &beta, dC, ldc);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    // copy output from device to CPU
+    hipMemcpy(hC2.data(), dC, sizeof(T) * C_size, hipMemcpyDeviceToHost);
+
+    if(argus.unit_check)
+    {
+        /* =====================================================================
+           CPU BLAS
+        =================================================================== */
+        cblas_hemm<T>(
+            side, uplo, M, N, alpha, hA.data(), lda, hB.data(), ldb, beta, hC.data(), ldc);
+
+        unit_check_general<T>(M, N, ldc, hC2.data(), hC.data());
+    }
+
+    if(argus.timing)
+    {
+        hipblas_timing timing;
+        status = hipblas_time_launches(handle, argus, timing, [&] {
+            return hipblasHemm<T>(
+                handle, side, uplo, M, N, &alpha, dA, lda, dB, ldb, &beta, dC, ldc);
+        });
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            hipblas_client_destroy(handle);
+            return status;
+        }
+
+        double gflop = hemm_gflop_count<T>(M, N, K);
+        double gbyte = hemm_gbyte_count<T>(M, N, K);
+
+        cout << "M,N,lda,ldb,ldc,side,uplo," HIPBLAS_TIMING_COLUMNS << endl;
+        cout << M << ',' << N << ',' << lda << ',' << ldb << ',' << ldc << ','
+             << argus.side_option << ',' << argus.uplo_option << ',';
+        hipblas_print_timing(cout, timing, gflop, gbyte);
+    }
+
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,158 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "cblas_interface.h"
+#include "flops.h"
+#include "hipblas.hpp"
+#include "norm.h"
+#include "unit.h"
+#include "utility.h"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+template <typename T>
+hipblasStatus_t testing_hemm_batched(Arguments argus)
+{
+    int M           = argus.M;
+    int N           = argus.N;
+    int lda         = argus.lda;
+    int ldb         = argus.ldb;
+    int ldc         = argus.ldc;
+    int batch_count = argus.batch_count;
+
+    hipblasSideMode_t side = char2hipblas_side(argus.side_option);
+    hipblasFillMode_t uplo = char2hipblas_fill(argus.uplo_option);
+
+    T alpha = argus.get_alpha<T>();
+    T beta  = argus.get_beta<T>();
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+
+    // A is K x K, K = M for side == left and N for side == right
+    int K = (side == HIPBLAS_SIDE_LEFT ? M : N);
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    if(M < 0 || N < 0 || lda < K || ldb < M || ldc < M || batch_count < 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    else if(batch_count == 0)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    hipblasHandle_t handle;
+    hipblas_client_create(&handle);
+
+    int A_size = lda * K;
+    int B_size = ldb * N;
+    int C_size = ldc * N;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA[batch_count];
+    host_vector<T> hB[batch_count];
+    host_vector<T> hC[batch_count];
+    host_vector<T> hC2[batch_count];
+
+    device_batch_vector<T> bA(batch_count, A_size);
+    device_batch_vector<T> bB(batch_count, B_size);
+    device_batch_vector<T> bC(batch_count, C_size);
+
+    device_vector<T*, 0, T> dA(batch_count);
+    device_vector<T*, 0, T> dB(batch_count);
+    device_vector<T*, 0, T> dC(batch_count);
+
+    int last = batch_count - 1;
+    if(!dA || !dB || !dC || (!bA[last] && A_size) || (!bB[last] && B_size)
+       || (!bC[last] && C_size))
+    {
+        hipblas_client_destroy(handle);
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+    }
+
+    // Initial Data on CPU; only the uplo triangle of A is referenced
+    srand(1);
+    for(int b = 0; b < batch_count; b++)
+    {
+        hA[b]  = host_vector<T>(A_size);
+        hB[b]  = host_vector<T>(B_size);
+        hC[b]  = host_vector<T>(C_size);
+        hC2[b] = host_vector<T>(C_size);
+
+        hipblas_init<T>(hA[b], K, K, lda);
+        hipblas_init<T>(hB[b], M, N, ldb);
+        hipblas_init<T>(hC[b], M, N, ldc);
+
+        CHECK_HIP_ERROR(hipMemcpy(bA[b], hA[b], sizeof(T) * A_size, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(bB[b], hB[b], sizeof(T) * B_size, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(bC[b], hC[b], sizeof(T) * C_size, hipMemcpyHostToDevice));
+    }
+    CHECK_HIP_ERROR(hipMemcpy(dA, bA, sizeof(T*) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, bB, sizeof(T*) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC, bC, sizeof(T*) * batch_count, hipMemcpyHostToDevice));
+
+    /* =====================================================================
+           ROCBLAS
+    =================================================================== */
+    status = hipblasHemmBatched<T>(
+        handle, side, uplo, M, N, &alpha, dA, lda, dB, ldb, &beta, dC, ldc, batch_count);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    // copy output from device to CPU
+    for(int b = 0; b < batch_count; b++)
+    {
+        hipMemcpy(hC2[b], bC[b], sizeof(T) * C_size, hipMemcpyDeviceToHost);
+    }
+
+    if(argus.unit_check)
+    {
+        /* =====================================================================
+           CPU BLAS
+        =================================================================== */
+        hipblas_batch_for(batch_count, [&](int b) {
+            cblas_hemm<T>(side, uplo, M, N, alpha, hA[b], lda, hB[b], ldb, beta, hC[b], ldc);
+        });
+
+        unit_check_general<T>(M, N, batch_count, ldc, hC2, hC);
+    }
+
+    if(argus.timing)
+    {
+        hipblas_timing timing;
+        status = hipblas_time_launches(handle, argus, timing, [&] {
+            return hipblasHemmBatched<T>(
+                handle, side, uplo, M, N, &alpha, dA, lda, dB, ldb, &beta, dC, ldc, batch_count);
+        });
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            hipblas_client_destroy(handle);
+            return status;
+        }
+
+        double gflop = hemm_gflop_count<T>(M, N, K) * batch_count;
+        double gbyte = hemm_gbyte_count<T>(M, N, K) * batch_count;
+
+        cout << "M,N,lda,ldb,ldc,batch_count,side,uplo," HIPBLAS_TIMING_COLUMNS << endl;
+        cout << M << ',' << N << ',' << lda << ',' << ldb << ',' << ldc << ',' << batch_count
+             << ',' << argus.side_option << ',' << argus.uplo_option << ',';
+        hipblas_print_timing(cout, timing, gflop, gbyte);
+    }
+
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,178 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "cblas_interface.h"
+#include "flops.h"
+#include "hipblas.hpp"
+#include "norm.h"
+#include "unit.h"
+#include "utility.h"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+template <typename T>
+hipblasStatus_t testing_hemm_strided_batched(Arguments argus)
+{
+    int    M            = argus.M;
+    int    N            = argus.N;
+    int    lda          = argus.lda;
+    int    ldb          = argus.ldb;
+    int    ldc          = argus.ldc;
+    double stride_scale = argus.stride_scale;
+    int    batch_count  = argus.batch_count;
+
+    hipblasSideMode_t side = char2hipblas_side(argus.side_option);
+    hipblasFillMode_t uplo = char2hipblas_fill(argus.uplo_option);
+
+    // A is K x K, K = M for side == left and N for side == right
+    int K        = (side == HIPBLAS_SIDE_LEFT ? M : N);
+    int stride_A = lda * K * stride_scale;
+    int stride_B = ldb * N * stride_scale;
+    int stride_C = ldc * N * stride_scale;
+    int A_size   = stride_A * batch_count;
+    int B_size   = stride_B * batch_count;
+    int C_size   = stride_C * batch_count;
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    if(M < 0 || N < 0 || lda < K || ldb < M || ldc < M || batch_count < 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    else if(batch_count == 0)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA(A_size);
+    host_vector<T> hB(B_size);
+    host_vector<T> hC(C_size);
+    host_vector<T> hC2(C_size);
+
+    device_vector<T> dA(A_size);
+    device_vector<T> dB(B_size);
+    device_vector<T> dC(C_size);
+
+    T alpha = argus.get_alpha<T>();
+    T beta  = argus.get_beta<T>();
+
+    hipblasHandle_t handle;
+    hipblas_client_create(&handle);
+
+    // Initial Data on CPU; only the uplo triangle of A is referenced
+    srand(1);
+    hipblas_init<T>(hA, K, K, lda, stride_A, batch_count);
+    hipblas_init<T>(hB, M, N, ldb, stride_B, batch_count);
+    hipblas_init<T>(hC, M, N, ldc, stride_C, batch_count);
+
+    // copy data from CPU to device
+    hipMemcpy(dA, hA.data(), sizeof(T) * A_size, hipMemcpyHostToDevice);
+    hipMemcpy(dB, hB.data(), sizeof(T) * B_size, hipMemcpyHostToDevice);
+    hipMemcpy(dC, hC.data(), sizeof(T) * C_size, hipMemcpyHostToDevice);
+
+    /* =====================================================================
+           ROCBLAS
+    =================================================================== */
+    status = hipblasHemmStridedBatched<T>(handle,
+                                          side,
+                                          uplo,
+                                          M,
+                                          N,
+                                          &alpha,
+                                          dA,
+                                          lda,
+                                          stride_A,
+                                          dB,
+                                          ldb,
+                                          stride_B,
+                                          &beta,
+                                          dC,
+                                          ldc,
+                                          stride_C,
+                                          batch_count);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    // copy output from device to CPU
+    hipMemcpy(hC2.data(), dC, sizeof(T) * C_size, hipMemcpyDeviceToHost);
+
+    if(argus.unit_check)
+    {
+        /* =====================================================================
+           CPU BLAS
+        =================================================================== */
+        hipblas_batch_for(batch_count, [&](int b) {
+            cblas_hemm<T>(side,
+                          uplo,
+                          M,
+                          N,
+                          alpha,
+                          hA.data() + b * stride_A,
+                          lda,
+                          hB.data() + b * stride_B,
+                          ldb,
+                          beta,
+                          hC.data() + b * stride_C,
+                          ldc);
+        });
+
+        unit_check_general<T>(M, N, batch_count, ldc, stride_C, hC2.data(), hC.data());
+    }
+
+    if(argus.timing)
+    {
+        hipblas_timing timing;
+        status = hipblas_time_launches(handle, argus, timing, [&] {
+            return hipblasHemmStridedBatched<T>(handle,
+                                                side,
+                                                uplo,
+                                                M,
+                                                N,
+                                                &alpha,
+                                                dA,
+                                                lda,
+                                                stride_A,
+                                                dB,
+                                                ldb,
+                                                stride_B,
+                                                &beta,
+                                                dC,
+                                                ldc,
+                                                stride_C,
+                                                batch_count);
+        });
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            hipblas_client_destroy(handle);
+            return status;
+        }
+
+        double gflop = hemm_gflop_count<T>(M, N, K) * batch_count;
+        double gbyte = hemm_gbyte_count<T>(M, N, K) * batch_count;
+
+        cout << "M,N,lda,ldb,ldc,stride_scale,batch_count,side,uplo," HIPBLAS_TIMING_COLUMNS
+             << endl;
+        cout << M << ',' << N << ',' << lda << ',' << ldb << ',' << ldc << ',' << stride_scale
+             << ',' << batch_count << ',' << argus.side_option << ',' << argus.uplo_option << ',';
+        hipblas_print_timing(cout, timing, gflop, gbyte);
+    }
+
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -58,7 +58,7 @@ hipblasStatus_t testing_hemv(Arguments argus)
     T beta  = (T)argus.beta;
 
     hipblasHandle_t handle;
-    hipblasCreate(&handle);
+    hipblas_client_create(&handle);
 
     // Initial Data on CPU
     srand(1);
@@ -85,7 +85,7 @@ hipblasStatus_t testing_hemv(Arguments argus)
 
         if(status != HIPBLAS_STATUS_SUCCESS)
         {
-            hipblasDestroy(handle);
+            hipblas_client_destroy(handle);
             return status;
         }
     }
@@ -109,6 +109,6 @@ hipblasStatus_t testing_hemv(Arguments argus)
         }
     }
 
-    hipblasDestroy(handle);
+    hipblas_client_destroy(handle);
     return HIPBLAS_STATUS_SUCCESS;
 }
@@ -52,7 +52,7 @@ hipblasStatus_t testing_hemvBatched(Arguments argus)
     }
 
     hipblasHandle_t handle;
-    hipblasCreate(&handle);
+    hipblas_client_create(&handle);
 
     double gpu_time_used, cpu_time_used;
     double hipblasGflops, cblas_gflops, hipblasBandwidth;
@@ -81,7 +81,7 @@ hipblasStatus_t testing_hemvBatched(Arguments argus)
     if(!dA_array || !dx_array || !dy_array || (!bA_array[last] && A_size)
        || (!bx_array[last] && X_size) || (!by_array[last] && Y_size))
     {
-        hipblasDestroy(handle);
+        hipblas_client_destroy(handle);
         return HIPBLAS_STATUS_ALLOC_FAILED;
     }
 
@@ -108,7 +108,7 @@ hipblasStatus_t testing_hemvBatched(Arguments argus)
 
         if(err_A != hipSuccess || err_x != hipSuccess || err_y != hipSuccess)
         {
-            hipblasDestroy(handle);
+            hipblas_client_destroy(handle);
             return HIPBLAS_STATUS_MAPPING_ERROR;
         }
     }
@@ -118,7 +118,7 @@ hipblasStatus_t testing_hemvBatched(Arguments argus)
     err_y = hipMemcpy(dy_array, by_array, batch_count * sizeof(T*), hipMemcpyHostToDevice);
     if(err_A != hipSuccess || err_x != hipSuccess || err_y != hipSuccess)
     {
-        hipblasDestroy(handle);
+        hipblas_client_destroy(handle);
         return HIPBLAS_STATUS_MAPPING_ERROR;
     }
 
@@ -143,7 +143,7 @@ hipblasStatus_t testing_hemvBatched(Arguments argus)
         if(status != HIPBLAS_STATUS_SUCCESS)
         {
             // here in cuda
-            hipblasDestroy(handle);
+            hipblas_client_destroy(handle);
             return status;
         }
     }
@@ -160,11 +160,10 @@ hipblasStatus_t testing_hemvBatched(Arguments argus)
            CPU BLAS
         =================================================================== */
 
-        for(int b = 0; b < batch_count; b++)
-        {
+        hipblas_batch_for(batch_count, [&](int b) {
             cblas_hemv<T>(
                 uplo, N, alpha, hA_array[b], lda, hx_array[b], incx, beta, hz_array[b], incy);
-        }
+        });
 
         // enable unit check, notice unit check is not invasive, but norm check is,
         // unit check and norm check can not be interchanged their order
@@ -174,6 +173,6 @@ hipblasStatus_t testing_hemvBatched(Arguments argus)
         }
     }
 
-    hipblasDestroy(handle);
+    hipblas_client_destroy(handle);
     return HIPBLAS_STATUS_SUCCESS;
 }
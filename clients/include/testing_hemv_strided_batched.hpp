@@ -70,7 +70,7 @@ hipblasStatus_t testing_hemvStridedBatched(Arguments argus)
     T beta  = (T)argus.beta;
 
     hipblasHandle_t handle;
-    hipblasCreate(&handle);
+    hipblas_client_create(&handle);
 
     // Initial Data on CPU
     srand(1);
@@ -110,7 +110,7 @@ hipblasStatus_t testing_hemvStridedBatched(Arguments argus)
         if(status != HIPBLAS_STATUS_SUCCESS)
         {
             // here in cuda
-            hipblasDestroy(handle);
+            hipblas_client_destroy(handle);
             return status;
         }
     }
@@ -124,8 +124,7 @@ hipblasStatus_t testing_hemvStridedBatched(Arguments argus)
            CPU BLAS
         =================================================================== */
 
-        for(int b = 0; b < batch_count; b++)
-        {
+        hipblas_batch_for(batch_count, [&](int b) {
             cblas_hemv<T>(uplo,
                           N,
                           alpha,
@@ -136,7 +135,7 @@ hipblasStatus_t testing_hemvStridedBatched(Arguments argus)
                           beta,
                           hz.data() + b * stride_y,
                           incy);
-        }
+        });
 
         // enable unit check, notice unit check is not invasive, but norm check is,
         // unit check and norm check can not be interchanged their order
@@ -146,6 +145,6 @@ hipblasStatus_t testing_hemvStridedBatched(Arguments argus)
         }
     }
 
-    hipblasDestroy(handle);
+    hipblas_client_destroy(handle);
     return HIPBLAS_STATUS_SUCCESS;
 }
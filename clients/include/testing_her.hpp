@@ -53,7 +53,7 @@ hipblasStatus_t testing_her(Arguments argus)
     U alpha = argus.get_alpha<U>();
 
     hipblasHandle_t handle;
-    hipblasCreate(&handle);
+    hipblas_client_create(&handle);
 
     // Initial Data on CPU
     srand(1);
@@ -70,21 +70,12 @@ hipblasStatus_t testing_her(Arguments argus)
     /* =====================================================================
            ROCBLAS
     =================================================================== */
-    if(argus.timing)
-    {
-        gpu_time_used = get_time_us(); // in microseconds
-    }
+    status = hipblasHer<T>(handle, uplo, N, (U*)&alpha, dx, incx, dA, lda);
 
-    for(int iter = 0; iter < 1; iter++)
+    if(status != HIPBLAS_STATUS_SUCCESS)
     {
-
-        status = hipblasHer<T>(handle, uplo, N, (U*)&alpha, dx, incx, dA, lda);
-
-        if(status != HIPBLAS_STATUS_SUCCESS)
-        {
-            hipblasDestroy(handle);
-            return status;
-        }
+        hipblas_client_destroy(handle);
+        return status;
     }
 
     // copy output from device to CPU
@@ -105,6 +96,26 @@ hipblasStatus_t testing_her(Arguments argus)
         }
     }
 
-    hipblasDestroy(handle);
+    if(argus.timing)
+    {
+        hipblas_timing timing;
+        status = hipblas_time_launches(handle, argus, timing, [&] {
+            return hipblasHer<T>(handle, uplo, N, (U*)&alpha, dx, incx, dA, lda);
+        });
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            hipblas_client_destroy(handle);
+            return status;
+        }
+
+        double gflop = her_gflop_count<T>(N);
+        double gbyte = her_gbyte_count<T>(N);
+
+        cout << "N,incx,lda,uplo," HIPBLAS_TIMING_COLUMNS << endl;
+        cout << N << ',' << incx << ',' << lda << ',' << argus.uplo_option << ',';
+        hipblas_print_timing(cout, timing, gflop, gbyte);
+    }
+
+    hipblas_client_destroy(handle);
     return HIPBLAS_STATUS_SUCCESS;
 }
@@ -56,7 +56,7 @@ hipblasStatus_t testing_her2(Arguments argus)
     T alpha = argus.get_alpha<T>();
 
     hipblasHandle_t handle;
-    hipblasCreate(&handle);
+    hipblas_client_create(&handle);
 
     // Initial Data on CPU
     srand(1);
@@ -75,21 +75,12 @@ hipblasStatus_t testing_her2(Arguments argus)
     /* =====================================================================
            ROCBLAS
     =================================================================== */
-    if(argus.timing)
-    {
-        gpu_time_used = get_time_us(); // in microseconds
-    }
+    status = hipblasHer2<T>(handle, uplo, N, (T*)&alpha, dx, incx, dy, incy, dA, lda);
 
-    for(int iter = 0; iter < 1; iter++)
+    if(status != HIPBLAS_STATUS_SUCCESS)
     {
-
-        status = hipblasHer2<T>(handle, uplo, N, (T*)&alpha, dx, incx, dy, incy, dA, lda);
-
-        if(status != HIPBLAS_STATUS_SUCCESS)
-        {
-            hipblasDestroy(handle);
-            return status;
-        }
+        hipblas_client_destroy(handle);
+        return status;
     }
 
     // copy output from device to CPU
@@ -110,6 +101,26 @@ hipblasStatus_t testing_her2(Arguments argus)
         }
     }
 
-    hipblasDestroy(handle);
+    if(argus.timing)
+    {
+        hipblas_timing timing;
+        status = hipblas_time_launches(handle, argus, timing, [&] {
+            return hipblasHer2<T>(handle, uplo, N, (T*)&alpha, dx, incx, dy, incy, dA, lda);
+        });
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            hipblas_client_destroy(handle);
+            return status;
+        }
+
+        double gflop = her2_gflop_count<T>(N);
+        double gbyte = her2_gbyte_count<T>(N);
+
+        cout << "N,incx,incy,lda,uplo," HIPBLAS_TIMING_COLUMNS << endl;
+        cout << N << ',' << incx << ',' << incy << ',' << lda << ',' << argus.uplo_option << ',';
+        hipblas_print_timing(cout, timing, gflop, gbyte);
+    }
+
+    hipblas_client_destroy(handle);
     return HIPBLAS_STATUS_SUCCESS;
 }
@@ -62,7 +62,7 @@ hipblasStatus_t testing_her_strided_batched(Arguments argus)
     U alpha = argus.get_alpha<U>();
 
     hipblasHandle_t handle;
-    hipblasCreate(&handle);
+    hipblas_client_create(&handle);
 
     // Initial Data on CPU
     srand(1);
@@ -79,21 +79,13 @@ hipblasStatus_t testing_her_strided_batched(Arguments argus)
     /* =====================================================================
            ROCBLAS
     =================================================================== */
-    if(argus.timing)
-    {
-        gpu_time_used = get_time_us(); // in microseconds
-    }
+    status = hipblasHerStridedBatched<T>(
+        handle, uplo, N, (U*)&alpha, dx, incx, stride_x, dA, lda, stride_A, batch_count);
 
-    for(int iter = 0; iter < 1; iter++)
+    if(status != HIPBLAS_STATUS_SUCCESS)
     {
-        status = hipblasHerStridedBatched<T>(
-            handle, uplo, N, (U*)&alpha, dx, incx, stride_x, dA, lda, stride_A, batch_count);
-
-        if(status != HIPBLAS_STATUS_SUCCESS)
-        {
-            hipblasDestroy(handle);
-            return status;
-        }
+        hipblas_client_destroy(handle);
+        return status;
     }
 
     // copy output from device to CPU
@@ -104,11 +96,10 @@ hipblasStatus_t testing_her_strided_batched(Arguments argus)
         /* =====================================================================
            CPU BLAS
         =================================================================== */
-        for(int b = 0; b < batch_count; b++)
-        {
+        hipblas_batch_for(batch_count, [&](int b) {
             cblas_her<T>(
                 uplo, N, alpha, hx.data() + b * stride_x, incx, hB.data() + b * stride_A, lda);
-        }
+        });
 
         // enable unit check, notice unit check is not invasive, but norm check is,
         // unit check and norm check can not be interchanged their order
@@ -118,6 +109,28 @@ hipblasStatus_t testing_her_strided_batched(Arguments argus)
         }
     }
 
-    hipblasDestroy(handle);
+    if(argus.timing)
+    {
+        hipblas_timing timing;
+        status = hipblas_time_launches(handle, argus, timing, [&] {
+            return hipblasHerStridedBatched<T>(
+                handle, uplo, N, (U*)&alpha, dx, incx, stride_x, dA, lda, stride_A, batch_count);
+        });
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            hipblas_client_destroy(handle);
+            return status;
+        }
+
+        double gflop = her_gflop_count<T>(N) * batch_count;
+        double gbyte = her_gbyte_count<T>(N) * batch_count;
+
+        cout << "N,incx,lda,stride_scale,batch_count,uplo," HIPBLAS_TIMING_COLUMNS << endl;
+        cout << N << ',' << incx << ',' << lda << ',' << stride_scale << ',' << batch_count << ','
+             << argus.uplo_option << ',';
+        hipblas_print_timing(cout, timing, gflop, gbyte);
+    }
+
+    hipblas_client_destroy(handle);
     return HIPBLAS_STATUS_SUCCESS;
 }
@@ -60,7 +60,7 @@ hipblasStatus_t testing_herk(Arguments argus)
     U beta  = argus.get_beta<U>();
 
     hipblasHandle_t handle;
-    hipblasCreate(&handle);
+    hipblas_client_create(&handle);
 
     // Initial Data on CPU
     srand(1);
@@ -77,22 +77,12 @@ hipblasStatus_t testing_herk(Arguments argus)
     /* =====================================================================
            ROCBLAS
     =================================================================== */
-    if(argus.timing)
-    {
-        gpu_time_used = get_time_us(); // in microseconds
-    }
+    status = hipblasHerk<T>(handle, uplo, transA, N, K, (U*)&alpha, dA, lda, (U*)&beta, dC, ldc);
 
-    for(int iter = 0; iter < 1; iter++)
+    if(status != HIPBLAS_STATUS_SUCCESS)
     {
-
-        status
-            = hipblasHerk<T>(handle, uplo, transA, N, K, (U*)&alpha, dA, lda, (U*)&beta, dC, ldc);
-
-        if(status != HIPBLAS_STATUS_SUCCESS)
-        {
-            hipblasDestroy(handle);
-            return status;
-        }
+        hipblas_client_destroy(handle);
+        return status;
     }
 
     // copy output from device to CPU
@@ -113,6 +103,28 @@ hipblasStatus_t testing_herk(Arguments argus)
         }
     }
 
-    hipblasDestroy(handle);
+    if(argus.timing)
+    {
+        hipblas_timing timing;
+        status = hipblas_time_launches(handle, argus, timing, [&] {
+            return hipblasHerk<T>(
+                handle, uplo, transA, N, K, (U*)&alpha, dA, lda, (U*)&beta, dC, ldc);
+        });
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            hipblas_client_destroy(handle);
+            return status;
+        }
+
+        double gflop = herk_gflop_count<T>(N, K);
+        double gbyte = herk_gbyte_count<T>(N, K);
+
+        cout << "N,K,lda,ldc,uplo,transA," HIPBLAS_TIMING_COLUMNS << endl;
+        cout << N << ',' << K << ',' << lda << ',' << ldc << ',' << argus.uplo_option << ','
+             << argus.transA_option << ',';
+        hipblas_print_timing(cout, timing, gflop, gbyte);
+    }
+
+    hipblas_client_destroy(handle);
     return HIPBLAS_STATUS_SUCCESS;
 }
@@ -53,7 +53,7 @@ hipblasStatus_t testing_herk_batched(Arguments argus)
     }
 
     hipblasHandle_t handle;
-    hipblasCreate(&handle);
+    hipblas_client_create(&handle);
 
     int K1     = (transA == HIPBLAS_OP_N ? K : N);
     int A_size = lda * K1;
@@ -73,7 +73,7 @@ hipblasStatus_t testing_herk_batched(Arguments argus)
     int last = batch_count - 1;
     if(!dA || !dC || (!bA[last] && A_size) || (!bC[last] && C_size))
     {
-        hipblasDestroy(handle);
+        hipblas_client_destroy(handle);
         return HIPBLAS_STATUS_ALLOC_FAILED;
     }
 
@@ -98,21 +98,13 @@ hipblasStatus_t testing_herk_batched(Arguments argus)
     /* =====================================================================
            ROCBLAS
     =================================================================== */
-    if(argus.timing)
-    {
-        gpu_time_used = get_time_us(); // in microseconds
-    }
+    status = hipblasHerkBatched<T>(
+        handle, uplo, transA, N, K, (U*)&alpha, dA, lda, (U*)&beta, dC, ldc, batch_count);
 
-    for(int iter = 0; iter < 1; iter++)
+    if(status != HIPBLAS_STATUS_SUCCESS)
     {
-        status = hipblasHerkBatched<T>(
-            handle, uplo, transA, N, K, (U*)&alpha, dA, lda, (U*)&beta, dC, ldc, batch_count);
-
-        if(status != HIPBLAS_STATUS_SUCCESS)
-        {
-            hipblasDestroy(handle);
-            return status;
-        }
+        hipblas_client_destroy(handle);
+        return status;
     }
 
     // copy output from device to CPU
@@ -126,10 +118,9 @@ hipblasStatus_t testing_herk_batched(Arguments argus)
         /* =====================================================================
            CPU BLAS
         =================================================================== */
-        for(int b = 0; b < batch_count; b++)
-        {
+        hipblas_batch_for(batch_count, [&](int b) {
             cblas_herk<T>(uplo, transA, N, K, alpha, hA[b], lda, beta, hC[b], ldc);
-        }
+        });
 
         // enable unit check, notice unit check is not invasive, but norm check is,
         // unit check and norm check can not be interchanged their order
@@ -139,6 +130,28 @@ hipblasStatus_t testing_herk_batched(Arguments argus)
         }
     }
 
-    hipblasDestroy(handle);
+    if(argus.timing)
+    {
+        hipblas_timing timing;
+        status = hipblas_time_launches(handle, argus, timing, [&] {
+            return hipblasHerkBatched<T>(
+                handle, uplo, transA, N, K, (U*)&alpha, dA, lda, (U*)&beta, dC, ldc, batch_count);
+        });
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            hipblas_client_destroy(handle);
+            return status;
+        }
+
+        double gflop = herk_gflop_count<T>(N, K) * batch_count;
+        double gbyte = herk_gbyte_count<T>(N, K) * batch_count;
+
+        cout << "N,K,lda,ldc,batch_count,uplo,transA," HIPBLAS_TIMING_COLUMNS << endl;
+        cout << N << ',' << K << ',' << lda << ',' << ldc << ',' << batch_count << ','
+             << argus.uplo_option << ',' << argus.transA_option << ',';
+        hipblas_print_timing(cout, timing, gflop, gbyte);
+    }
+
+    hipblas_client_destroy(handle);
     return HIPBLAS_STATUS_SUCCESS;
 }
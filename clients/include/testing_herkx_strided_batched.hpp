@@ -72,7 +72,7 @@ hipblasStatus_t testing_herkx_strided_batched(Arguments argus)
     U beta  = argus.get_beta<U>();
 
     hipblasHandle_t handle;
-    hipblasCreate(&handle);
+    hipblas_client_create(&handle);
 
     // Initial Data on CPU
     srand(1);
@@ -88,36 +88,28 @@ hipblasStatus_t testing_herkx_strided_batched(Arguments argus)
     /* =====================================================================
            ROCBLAS
     =================================================================== */
-    if(argus.timing)
+    status = hipblasHerkxStridedBatched<T>(handle,
+                                           uplo,
+                                           transA,
+                                           N,
+                                           K,
+                                           (T*)&alpha,
+                                           dA,
+                                           lda,
+                                           stride_A,
+                                           dB,
+                                           ldb,
+                                           stride_B,
+                                           (U*)&beta,
+                                           dC,
+                                           ldc,
+                                           stride_C,
+                                           batch_count);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
     {
-        gpu_time_used = get_time_us(); // in microseconds
-    }
-
-    for(int iter = 0; iter < 1; iter++)
-    {
-        status = hipblasHerkxStridedBatched<T>(handle,
-                                               uplo,
-                                               transA,
-                                               N,
-                                               K,
-                                               (T*)&alpha,
-                                               dA,
-                                               lda,
-                                               stride_A,
-                                               dB,
-                                               ldb,
-                                               stride_B,
-                                               (U*)&beta,
-                                               dC,
-                                               ldc,
-                                               stride_C,
-                                               batch_count);
-
-        if(status != HIPBLAS_STATUS_SUCCESS)
-        {
-            hipblasDestroy(handle);
-            return status;
-        }
+        hipblas_client_destroy(handle);
+        return status;
     }
 
     // copy output from device to CPU
@@ -128,8 +120,7 @@ hipblasStatus_t testing_herkx_strided_batched(Arguments argus)
         /* =====================================================================
            CPU BLAS
         =================================================================== */
-        for(int b = 0; b < batch_count; b++)
-        {
+        hipblas_batch_for(batch_count, [&](int b) {
             cblas_herkx<T>(uplo,
                            transA,
                            N,
@@ -142,7 +133,7 @@ hipblasStatus_t testing_herkx_strided_batched(Arguments argus)
                            beta,
                            hC.data() + b * stride_C,
                            ldc);
-        }
+        });
 
         // enable unit check, notice unit check is not invasive, but norm check is,
         // unit check and norm check can not be interchanged their order
@@ -152,6 +143,44 @@ hipblasStatus_t testing_herkx_strided_batched(Arguments argus)
         }
     }
 
-    hipblasDestroy(handle);
+    if(argus.timing)
+    {
+        hipblas_timing timing;
+        status = hipblas_time_launches(handle, argus, timing, [&] {
+            return hipblasHerkxStridedBatched<T>(handle,
+                                                 uplo,
+                                                 transA,
+                                                 N,
+                                                 K,
+                                                 (T*)&alpha,
+                                                 dA,
+                                                 lda,
+                                                 stride_A,
+                                                 dB,
+                                                 ldb,
+                                                 stride_B,
+                                                 (U*)&beta,
+                                                 dC,
+                                                 ldc,
+                                                 stride_C,
+                                                 batch_count);
+        });
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            hipblas_client_destroy(handle);
+            return status;
+        }
+
+        double gflop = herk_gflop_count<T>(N, K) * batch_count;
+        double gbyte = her2k_gbyte_count<T>(N, K) * batch_count;
+
+        cout << "N,K,lda,ldb,ldc,stride_scale,batch_count,uplo,transA," HIPBLAS_TIMING_COLUMNS
+             << endl;
+        cout << N << ',' << K << ',' << lda << ',' << ldb << ',' << ldc << ',' << stride_scale
+             << ',' << batch_count << ',' << argus.uplo_option << ',' << argus.transA_option << ',';
+        hipblas_print_timing(cout, timing, gflop, gbyte);
+    }
+
+    hipblas_client_destroy(handle);
     return HIPBLAS_STATUS_SUCCESS;
 }
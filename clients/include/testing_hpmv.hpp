@@ -57,7 +57,7 @@ hipblasStatus_t testing_hpmv(Arguments argus)
     T beta  = argus.get_beta<T>();
 
     hipblasHandle_t handle;
-    hipblasCreate(&handle);
+    hipblas_client_create(&handle);
 
     // Initial Data on CPU
     srand(1);
@@ -82,7 +82,7 @@ hipblasStatus_t testing_hpmv(Arguments argus)
 
         if(status != HIPBLAS_STATUS_SUCCESS)
         {
-            hipblasDestroy(handle);
+            hipblas_client_destroy(handle);
             return status;
         }
     }
@@ -106,6 +106,6 @@ hipblasStatus_t testing_hpmv(Arguments argus)
         }
     }
 
-    hipblasDestroy(handle);
+    hipblas_client_destroy(handle);
     return HIPBLAS_STATUS_SUCCESS;
 }
@@ -55,7 +55,7 @@ hipblasStatus_t testing_hpr2(Arguments argus)
     T alpha = argus.get_alpha<T>();
 
     hipblasHandle_t handle;
-    hipblasCreate(&handle);
+    hipblas_client_create(&handle);
 
     // Initial Data on CPU
     srand(1);
@@ -74,21 +74,12 @@ hipblasStatus_t testing_hpr2(Arguments argus)
     /* =====================================================================
            ROCBLAS
     =================================================================== */
-    if(argus.timing)
-    {
-        gpu_time_used = get_time_us(); // in microseconds
-    }
+    status = hipblasHpr2<T>(handle, uplo, N, (T*)&alpha, dx, incx, dy, incy, dA);
 
-    for(int iter = 0; iter < 1; iter++)
+    if(status != HIPBLAS_STATUS_SUCCESS)
     {
-
-        status = hipblasHpr2<T>(handle, uplo, N, (T*)&alpha, dx, incx, dy, incy, dA);
-
-        if(status != HIPBLAS_STATUS_SUCCESS)
-        {
-            hipblasDestroy(handle);
-            return status;
-        }
+        hipblas_client_destroy(handle);
+        return status;
     }
 
     // copy output from device to CPU
@@ -109,6 +100,26 @@ hipblasStatus_t testing_hpr2(Arguments argus)
         }
     }
 
-    hipblasDestroy(handle);
+    if(argus.timing)
+    {
+        hipblas_timing timing;
+        status = hipblas_time_launches(handle, argus, timing, [&] {
+            return hipblasHpr2<T>(handle, uplo, N, (T*)&alpha, dx, incx, dy, incy, dA);
+        });
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            hipblas_client_destroy(handle);
+            return status;
+        }
+
+        double gflop = her2_gflop_count<T>(N);
+        double gbyte = her2_gbyte_count<T>(N);
+
+        cout << "N,incx,incy,uplo," HIPBLAS_TIMING_COLUMNS << endl;
+        cout << N << ',' << incx << ',' << incy << ',' << argus.uplo_option << ',';
+        hipblas_print_timing(cout, timing, gflop, gbyte);
+    }
+
+    hipblas_client_destroy(handle);
     return HIPBLAS_STATUS_SUCCESS;
 }
@@ -52,7 +52,7 @@ hipblasStatus_t testing_hpr2_batched(Arguments argus)
     }
 
     hipblasHandle_t handle;
-    hipblasCreate(&handle);
+    hipblas_client_create(&handle);
 
     // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
     host_vector<T> hA[batch_count];
@@ -71,7 +71,7 @@ hipblasStatus_t testing_hpr2_batched(Arguments argus)
     int last = batch_count - 1;
     if(!dA || !dx || !dy || (!bA[last] && A_size) || (!bx[last] && x_size) || (!by[last] && y_size))
     {
-        hipblasDestroy(handle);
+        hipblas_client_destroy(handle);
         return HIPBLAS_STATUS_ALLOC_FAILED;
     }
 
@@ -101,21 +101,13 @@ hipblasStatus_t testing_hpr2_batched(Arguments argus)
     /* =====================================================================
            ROCBLAS
     =================================================================== */
-    if(argus.timing)
-    {
-        gpu_time_used = get_time_us(); // in microseconds
-    }
+    status = hipblasHpr2Batched<T>(
+        handle, uplo, N, (T*)&alpha, dx, incx, dy, incy, dA, batch_count);
 
-    for(int iter = 0; iter < 1; iter++)
+    if(status != HIPBLAS_STATUS_SUCCESS)
     {
-        status = hipblasHpr2Batched<T>(
-            handle, uplo, N, (T*)&alpha, dx, incx, dy, incy, dA, batch_count);
-
-        if(status != HIPBLAS_STATUS_SUCCESS)
-        {
-            hipblasDestroy(handle);
-            return status;
-        }
+        hipblas_client_destroy(handle);
+        return status;
     }
 
     // copy output from device to CPU
@@ -129,10 +121,9 @@ hipblasStatus_t testing_hpr2_batched(Arguments argus)
         /* =====================================================================
            CPU BLAS
         =================================================================== */
-        for(int b = 0; b < batch_count; b++)
-        {
+        hipblas_batch_for(batch_count, [&](int b) {
             cblas_hpr2<T>(uplo, N, alpha, hx[b], incx, hy[b], incy, hB[b]);
-        }
+        });
 
         // enable unit check, notice unit check is not invasive, but norm check is,
         // unit check and norm check can not be interchanged their order
@@ -142,6 +133,28 @@ hipblasStatus_t testing_hpr2_batched(Arguments argus)
         }
     }
 
-    hipblasDestroy(handle);
+    if(argus.timing)
+    {
+        hipblas_timing timing;
+        status = hipblas_time_launches(handle, argus, timing, [&] {
+            return hipblasHpr2Batched<T>(
+                handle, uplo, N, (T*)&alpha, dx, incx, dy, incy, dA, batch_count);
+        });
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            hipblas_client_destroy(handle);
+            return status;
+        }
+
+        double gflop = her2_gflop_count<T>(N) * batch_count;
+        double gbyte = her2_gbyte_count<T>(N) * batch_count;
+
+        cout << "N,incx,incy,batch_count,uplo," HIPBLAS_TIMING_COLUMNS << endl;
+        cout << N << ',' << incx << ',' << incy << ',' << batch_count << ',' << argus.uplo_option
+             << ',';
+        hipblas_print_timing(cout, timing, gflop, gbyte);
+    }
+
+    hipblas_client_destroy(handle);
     return HIPBLAS_STATUS_SUCCESS;
 }
@@ -29,7 +29,7 @@ hipblasStatus_t testing_amax(Arguments argus)
     hipblasStatus_t status_3 = HIPBLAS_STATUS_SUCCESS;
 
     hipblasHandle_t handle;
-    hipblasCreate(&handle);
+    hipblas_client_create(&handle);
 
     T*   dx;
     int* d_rocblas_result;
@@ -105,7 +105,7 @@ hipblasStatus_t testing_amax(Arguments argus)
 
     CHECK_HIP_ERROR(hipFree(dx));
     CHECK_HIP_ERROR(hipFree(d_rocblas_result));
-    hipblasDestroy(handle);
+    hipblas_client_destroy(handle);
 
     if(status_1 != HIPBLAS_STATUS_SUCCESS)
     {
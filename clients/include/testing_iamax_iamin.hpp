@@ -31,7 +31,7 @@ hipblasStatus_t testing_iamax_iamin(const Arguments& argus, hipblas_iamax_iamin_
     hipblasStatus_t status_3 = HIPBLAS_STATUS_SUCCESS;
 
     hipblasHandle_t handle;
-    hipblasCreate(&handle);
+    hipblas_client_create(&handle);
 
     T*   dx;
     int* d_rocblas_result;
@@ -107,7 +107,7 @@ hipblasStatus_t testing_iamax_iamin(const Arguments& argus, hipblas_iamax_iamin_
 
     CHECK_HIP_ERROR(hipFree(dx));
     CHECK_HIP_ERROR(hipFree(d_rocblas_result));
-    hipblasDestroy(handle);
+    hipblas_client_destroy(handle);
 
     if(status_1 != HIPBLAS_STATUS_SUCCESS)
     {
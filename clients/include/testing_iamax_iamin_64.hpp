@@ -0,0 +1,104 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+#include "cblas_interface.h"
+#include "hipblas.hpp"
+#include "unit.h"
+#include "utility.h"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+template <typename T>
+using hipblas_iamax_iamin_64_t = hipblasStatus_t (*)(
+    hipblasHandle_t handle, int64_t n, const T* x, int64_t incx, int64_t* result);
+
+template <typename T, void REFBLAS_FUNC(int, const T*, int, int*)>
+hipblasStatus_t testing_iamax_iamin_64(const Arguments& argus, hipblas_iamax_iamin_64_t<T> func)
+{
+    int64_t N    = argus.N;
+    int64_t incx = argus.incx;
+
+    hipblasStatus_t status_1 = HIPBLAS_STATUS_SUCCESS;
+    hipblasStatus_t status_2 = HIPBLAS_STATUS_SUCCESS;
+
+    int64_t sizeX = N < 1 || incx <= 0 ? 1 : N * incx;
+
+    // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory, plz follow this practice
+    host_vector<T> hx(sizeX);
+
+    int64_t host_result = -1, device_result = -1;
+    int     cpu_result  = 0;
+
+    device_vector<T>       dx(sizeX);
+    device_vector<int64_t> d_result(1);
+
+    hipblasHandle_t handle;
+    hipblas_client_create(&handle);
+
+    // Initial Data on CPU
+    srand(1);
+    if(N > 0 && incx > 0)
+        hipblas_init<T>(hx, 1, N, incx);
+
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * sizeX, hipMemcpyHostToDevice));
+
+    // the device result is preset so a high half left from before shows
+    CHECK_HIP_ERROR(hipMemset(d_result, 0xff, sizeof(int64_t)));
+
+    /* =====================================================================
+         HIPBLAS
+    =================================================================== */
+    // both pointer modes, since device mode keeps the index on the device
+    status_1 = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST);
+    if(status_1 == HIPBLAS_STATUS_SUCCESS)
+        status_1 = func(handle, N, dx, incx, &host_result);
+
+    status_2 = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE);
+    if(status_2 == HIPBLAS_STATUS_SUCCESS)
+        status_2 = func(handle, N, dx, incx, d_result);
+
+    if((status_1 != HIPBLAS_STATUS_SUCCESS) || (status_2 != HIPBLAS_STATUS_SUCCESS))
+    {
+        hipblas_client_destroy(handle);
+        return status_1 != HIPBLAS_STATUS_SUCCESS ? status_1 : status_2;
+    }
+
+    CHECK_HIP_ERROR(hipMemcpy(&device_result, d_result, sizeof(int64_t), hipMemcpyDeviceToHost));
+
+    if(argus.unit_check)
+    {
+        // change to Fortran 1 based indexing as in BLAS standard, not cblas zero based indexing
+        if(N > 0 && incx > 0)
+        {
+            REFBLAS_FUNC(N, hx.data(), incx, &cpu_result);
+            cpu_result += 1;
+        }
+
+        int64_t expected = cpu_result;
+        unit_check_general<int64_t>(1, 1, 1, &expected, &host_result);
+        unit_check_general<int64_t>(1, 1, 1, &expected, &device_result);
+    }
+
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+template <typename T>
+hipblasStatus_t testing_amax_64(const Arguments& arg)
+{
+    return testing_iamax_iamin_64<T, cblas_iamax<T>>(arg, hipblasIamax_64<T>);
+}
+
+template <typename T>
+hipblasStatus_t testing_amin_64(const Arguments& arg)
+{
+    return testing_iamax_iamin_64<T, cblas_iamin<T>>(arg, hipblasIamin_64<T>);
+}
@@ -33,7 +33,7 @@ hipblasStatus_t testing_iamax_iamin_batched(const Arguments&                 arg
     hipblasStatus_t status_3 = HIPBLAS_STATUS_SUCCESS;
 
     hipblasHandle_t handle;
-    hipblasCreate(&handle);
+    hipblas_client_create(&handle);
 
     // check to prevent undefined memory allocation error
     if(batch_count == 0)
@@ -80,7 +80,7 @@ hipblasStatus_t testing_iamax_iamin_batched(const Arguments&                 arg
 
         if(!dx_array || (!bx_array[batch_count - 1] && sizeX))
         {
-            hipblasDestroy(handle);
+            hipblas_client_destroy(handle);
             return HIPBLAS_STATUS_ALLOC_FAILED;
         }
 
@@ -141,7 +141,7 @@ hipblasStatus_t testing_iamax_iamin_batched(const Arguments&                 arg
         } // end of if unit/norm check
     }
 
-    hipblasDestroy(handle);
+    hipblas_client_destroy(handle);
 
     if(status_1 != HIPBLAS_STATUS_SUCCESS)
     {
@@ -37,7 +37,7 @@ hipblasStatus_t testing_iamax_iamin_strided_batched(const Arguments&
     hipblasStatus_t status_3 = HIPBLAS_STATUS_SUCCESS;
 
     hipblasHandle_t handle;
-    hipblasCreate(&handle);
+    hipblas_client_create(&handle);
 
     // check to prevent undefined memory allocation error
     if(batch_count == 0)
@@ -123,7 +123,7 @@ hipblasStatus_t testing_iamax_iamin_strided_batched(const Arguments&
         } // end of if unit/norm check
     }
 
-    hipblasDestroy(handle);
+    hipblas_client_destroy(handle);
 
     if(status_1 != HIPBLAS_STATUS_SUCCESS)
     {
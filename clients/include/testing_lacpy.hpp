@@ -0,0 +1,129 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "flops.h"
+#include "hipblas.hpp"
+#include "unit.h"
+#include "utility.h"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+// B = A over argus.uplo_option's triangle, or all of A for 'F', with what lies outside it keeping
+// its values. The copy is repeated into B one element off its allocation, which takes the kernel's
+// element-by-element path
+template <typename T>
+hipblasStatus_t testing_lacpy(Arguments argus)
+{
+    int M   = argus.M;
+    int N   = argus.N;
+    int lda = argus.lda;
+    int ldb = argus.ldb;
+
+    hipblasFillMode_t uplo = char2hipblas_fill(argus.uplo_option);
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    if(M < 0 || N < 0 || lda < max(1, M) || ldb < max(1, M))
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    if(M == 0 || N == 0)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    int A_size = lda * N;
+    int B_size = ldb * N;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA(A_size);
+    host_vector<T> hB(B_size + 1);
+    host_vector<T> hB_result(B_size + 1);
+    host_vector<T> hB_gold(B_size + 1);
+    host_vector<T> hB_offset_result(B_size + 1);
+    host_vector<T> hB_offset_gold(B_size + 1);
+
+    device_vector<T> dA(A_size);
+    device_vector<T> dB(B_size + 1);
+
+    hipblasHandle_t handle;
+    hipblas_client_create(&handle);
+
+    // Initial Data on CPU
+    srand(1);
+    hipblas_init<T>(hA, M, N, lda);
+    hipblas_init<T>(hB, 1, B_size + 1, 1);
+    hB_gold        = hB;
+    hB_offset_gold = hB;
+
+    for(int j = 0; j < N; j++)
+        for(int i = 0; i < M; i++)
+            if((uplo != HIPBLAS_FILL_MODE_UPPER || i <= j)
+               && (uplo != HIPBLAS_FILL_MODE_LOWER || i >= j))
+            {
+                hB_gold[i + j * ldb]            = hA[i + j * lda];
+                hB_offset_gold[1 + i + j * ldb] = hA[i + j * lda];
+            }
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * A_size, hipMemcpyHostToDevice));
+
+    auto copy = [&](int offset, host_vector<T>& B) {
+        CHECK_HIP_ERROR(hipMemcpy(dB, hB.data(), sizeof(T) * (B_size + 1), hipMemcpyHostToDevice));
+        hipblasStatus_t copy_status
+            = hipblasLacpy<T>(handle, uplo, M, N, dA, lda, (T*)dB + offset, ldb);
+        CHECK_HIP_ERROR(hipMemcpy(B.data(), dB, sizeof(T) * (B_size + 1), hipMemcpyDeviceToHost));
+        return copy_status;
+    };
+
+    /* =====================================================================
+           HIPBLAS
+    =================================================================== */
+    status = copy(0, hB_result);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = copy(1, hB_offset_result);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    if(argus.unit_check)
+    {
+        unit_check_general<T>(1, B_size + 1, 1, hB_gold.data(), hB_result.data());
+        unit_check_general<T>(1, B_size + 1, 1, hB_offset_gold.data(), hB_offset_result.data());
+    }
+
+    if(argus.timing)
+    {
+        hipblas_timing timing;
+        status = hipblas_time_launches(handle, argus, timing, [&] {
+            return hipblasLacpy<T>(handle, uplo, M, N, dA, lda, dB, ldb);
+        });
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            hipblas_client_destroy(handle);
+            return status;
+        }
+
+        double gbyte = lacpy_gbyte_count<T>(uplo, M, N);
+
+        cout << "uplo,M,N,lda,ldb," HIPBLAS_TIMING_COLUMNS << endl;
+        cout << argus.uplo_option << ',' << M << ',' << N << ',' << lda << ',' << ldb << ',';
+        hipblas_print_timing(cout, timing, 0.0, gbyte);
+    }
+
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,130 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "flops.h"
+#include "hipblas.hpp"
+#include "unit.h"
+#include "utility.h"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+template <typename T>
+hipblasStatus_t testing_lacpy_batched(Arguments argus)
+{
+    int M           = argus.M;
+    int N           = argus.N;
+    int lda         = argus.lda;
+    int ldb         = argus.ldb;
+    int batch_count = argus.batch_count;
+
+    hipblasFillMode_t uplo = char2hipblas_fill(argus.uplo_option);
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    if(M < 0 || N < 0 || lda < max(1, M) || ldb < max(1, M) || batch_count < 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    if(M == 0 || N == 0 || batch_count == 0)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    int A_size = lda * N;
+    int B_size = ldb * N;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA[batch_count];
+    host_vector<T> hB[batch_count];
+    host_vector<T> hB_gold[batch_count];
+
+    device_batch_vector<T> bA(batch_count, A_size);
+    device_batch_vector<T> bB(batch_count, B_size);
+
+    device_vector<T*, 0, T> dA(batch_count);
+    device_vector<T*, 0, T> dB(batch_count);
+
+    hipblasHandle_t handle;
+    hipblas_client_create(&handle);
+
+    // Initial Data on CPU. Every batch holds its own values, and what lies outside the triangle
+    // must keep them
+    srand(1);
+    for(int b = 0; b < batch_count; b++)
+    {
+        hA[b] = host_vector<T>(A_size);
+        hB[b] = host_vector<T>(B_size);
+
+        hipblas_init<T>(hA[b], M, N, lda);
+        hipblas_init<T>(hB[b], M, N, ldb);
+        hB_gold[b] = hB[b];
+
+        for(int j = 0; j < N; j++)
+            for(int i = 0; i < M; i++)
+                if((uplo != HIPBLAS_FILL_MODE_UPPER || i <= j)
+                   && (uplo != HIPBLAS_FILL_MODE_LOWER || i >= j))
+                    hB_gold[b][i + j * ldb] = hA[b][i + j * lda];
+
+        CHECK_HIP_ERROR(hipMemcpy(bA[b], hA[b].data(), sizeof(T) * A_size, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(bB[b], hB[b].data(), sizeof(T) * B_size, hipMemcpyHostToDevice));
+    }
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, bA, sizeof(T*) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, bB, sizeof(T*) * batch_count, hipMemcpyHostToDevice));
+
+    /* =====================================================================
+           HIPBLAS
+    =================================================================== */
+
+    status = hipblasLacpyBatched<T>(handle, uplo, M, N, dA, lda, dB, ldb, batch_count);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    // copy output from device to CPU
+    for(int b = 0; b < batch_count; b++)
+        CHECK_HIP_ERROR(hipMemcpy(hB[b].data(), bB[b], sizeof(T) * B_size, hipMemcpyDeviceToHost));
+
+    if(argus.unit_check)
+    {
+        for(int b = 0; b < batch_count; b++)
+            unit_check_general<T>(M, N, ldb, hB_gold[b].data(), hB[b].data());
+    }
+
+    if(argus.timing)
+    {
+        hipblas_timing timing;
+        status = hipblas_time_launches(handle, argus, timing, [&] {
+            return hipblasLacpyBatched<T>(handle, uplo, M, N, dA, lda, dB, ldb, batch_count);
+        });
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            hipblas_client_destroy(handle);
+            return status;
+        }
+
+        double gbyte = lacpy_gbyte_count<T>(uplo, M, N) * batch_count;
+
+        cout << "uplo,M,N,lda,ldb,batch_count," HIPBLAS_TIMING_COLUMNS << endl;
+        cout << argus.uplo_option << ',' << M << ',' << N << ',' << lda << ',' << ldb << ','
+             << batch_count << ',';
+        hipblas_print_timing(cout, timing, 0.0, gbyte);
+    }
+
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
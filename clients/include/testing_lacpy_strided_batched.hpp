@@ -0,0 +1,124 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "flops.h"
+#include "hipblas.hpp"
+#include "unit.h"
+#include "utility.h"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+// The strides of a stride_scale that is not a whole number start a batch's B off the 16-byte
+// boundary, which takes the kernel's element-by-element path
+template <typename T>
+hipblasStatus_t testing_lacpy_strided_batched(Arguments argus)
+{
+    int    M            = argus.M;
+    int    N            = argus.N;
+    int    lda          = argus.lda;
+    int    ldb          = argus.ldb;
+    int    batch_count  = argus.batch_count;
+    double stride_scale = argus.stride_scale;
+
+    hipblasFillMode_t uplo = char2hipblas_fill(argus.uplo_option);
+
+    long long strideA = lda * N * stride_scale;
+    long long strideB = ldb * N * stride_scale;
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    if(M < 0 || N < 0 || lda < max(1, M) || ldb < max(1, M) || batch_count < 0
+       || strideA < (long long)lda * N || strideB < (long long)ldb * N)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    if(M == 0 || N == 0 || batch_count == 0)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    size_t A_size = strideA * batch_count;
+    size_t B_size = strideB * batch_count;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA(A_size);
+    host_vector<T> hB(B_size);
+    host_vector<T> hB_gold(B_size);
+
+    device_vector<T> dA(A_size);
+    device_vector<T> dB(B_size);
+
+    hipblasHandle_t handle;
+    hipblas_client_create(&handle);
+
+    // Initial Data on CPU
+    srand(1);
+    hipblas_init<T>(hA, 1, A_size, 1);
+    hipblas_init<T>(hB, 1, B_size, 1);
+    hB_gold = hB;
+
+    for(int b = 0; b < batch_count; b++)
+        for(int j = 0; j < N; j++)
+            for(int i = 0; i < M; i++)
+                if((uplo != HIPBLAS_FILL_MODE_UPPER || i <= j)
+                   && (uplo != HIPBLAS_FILL_MODE_LOWER || i >= j))
+                    hB_gold[b * strideB + i + j * ldb] = hA[b * strideA + i + j * lda];
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * A_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB.data(), sizeof(T) * B_size, hipMemcpyHostToDevice));
+
+    /* =====================================================================
+           HIPBLAS
+    =================================================================== */
+
+    status = hipblasLacpyStridedBatched<T>(
+        handle, uplo, M, N, dA, lda, strideA, dB, ldb, strideB, batch_count);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    CHECK_HIP_ERROR(hipMemcpy(hB.data(), dB, sizeof(T) * B_size, hipMemcpyDeviceToHost));
+
+    if(argus.unit_check)
+    {
+        unit_check_general<T>(1, B_size, 1, hB_gold.data(), hB.data());
+    }
+
+    if(argus.timing)
+    {
+        hipblas_timing timing;
+        status = hipblas_time_launches(handle, argus, timing, [&] {
+            return hipblasLacpyStridedBatched<T>(
+                handle, uplo, M, N, dA, lda, strideA, dB, ldb, strideB, batch_count);
+        });
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            hipblas_client_destroy(handle);
+            return status;
+        }
+
+        double gbyte = lacpy_gbyte_count<T>(uplo, M, N) * batch_count;
+
+        cout << "uplo,M,N,lda,ldb,stride_scale,batch_count," HIPBLAS_TIMING_COLUMNS << endl;
+        cout << argus.uplo_option << ',' << M << ',' << N << ',' << lda << ',' << ldb << ','
+             << stride_scale << ',' << batch_count << ',';
+        hipblas_print_timing(cout, timing, 0.0, gbyte);
+    }
+
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
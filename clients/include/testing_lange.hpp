@@ -0,0 +1,147 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <cmath>
+#include <limits>
+#include <stdlib.h>
+#include <vector>
+
+#include "hipblas.hpp"
+#include "near.h"
+#include "norm.h"
+#include "unit.h"
+#include "utility.h"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+// The strided batched lange, with a host result and then a device one, checked against loops over
+// the batches. norm_check_general_device then measures dA against a copy with one element changed,
+// which norm_check_general measures on the host
+template <typename T>
+hipblasStatus_t testing_lange_strided_batched(Arguments argus)
+{
+    using R = real_t<T>;
+
+    int    M            = argus.M;
+    int    N            = argus.N;
+    int    lda          = argus.lda;
+    double stride_scale = argus.stride_scale;
+    int    batch_count  = argus.batch_count;
+
+    hipblasNormType_t norm = char2hipblas_norm(argus.norm_option);
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    if(M < 0 || N < 0 || lda < max(1, M) || batch_count < 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    if(batch_count == 0)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    int strideA = lda * N * stride_scale;
+    int A_size  = max(strideA * batch_count, 1);
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA(A_size);
+    host_vector<T> hB(A_size);
+    host_vector<R> h_result(batch_count);
+    host_vector<R> h_device_result(batch_count);
+    host_vector<R> h_cpu_result(batch_count);
+
+    device_vector<T> dA(A_size);
+    device_vector<T> dB(A_size);
+    device_vector<R> d_result(batch_count);
+
+    hipblasHandle_t handle;
+    hipblas_client_create(&handle);
+
+    // Initial Data on CPU
+    srand(1);
+    hipblas_init<T>(hA, M, N, lda, strideA, batch_count);
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * A_size, hipMemcpyHostToDevice));
+
+    /* =====================================================================
+           HIPBLAS
+    =================================================================== */
+
+    hipblasStatus_t status = hipblasLangeStridedBatched<T, R>(
+        handle, norm, M, N, dA, lda, strideA, batch_count, h_result);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasLangeStridedBatched<T, R>(
+            handle, norm, M, N, dA, lda, strideA, batch_count, d_result);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    if(argus.unit_check)
+    {
+        hipblas_batch_for(batch_count, [&](int b) {
+            double norm_max = 0, sum = 0, ss = 0;
+            for(int j = 0; j < N; j++)
+            {
+                double col = 0;
+                for(int i = 0; i < M; i++)
+                {
+                    T      a = hA[b * strideA + i + j * lda];
+                    double v = std::abs(a);
+                    norm_max = std::max(norm_max, v);
+                    col += v;
+                    ss += v * v;
+                }
+                sum = std::max(sum, col);
+            }
+            if(norm == HIPBLAS_NORM_INF)
+            {
+                sum = 0;
+                for(int i = 0; i < M; i++)
+                {
+                    double row = 0;
+                    for(int j = 0; j < N; j++)
+                        row += std::abs(hA[b * strideA + i + j * lda]);
+                    sum = std::max(sum, row);
+                }
+            }
+            h_cpu_result[b] = norm == HIPBLAS_NORM_MAX         ? norm_max
+                              : norm == HIPBLAS_NORM_FROBENIUS ? std::sqrt(ss)
+                                                               : sum;
+        });
+
+        // Both pointer modes run the same kernels
+        double tolerance = (M + N + 1) * double(std::numeric_limits<R>::epsilon());
+        for(int b = 0; b < batch_count; b++)
+            near_check_general<R>(
+                1, 1, 1, &h_cpu_result[b], &h_result[b], tolerance * h_cpu_result[b]);
+
+        CHECK_HIP_ERROR(hipMemcpy(
+            h_device_result, d_result, sizeof(R) * batch_count, hipMemcpyDeviceToHost));
+        unit_check_general<R>(1, batch_count, 1, h_result, h_device_result);
+    }
+
+    if(argus.norm_check && M > 0 && N > 0)
+    {
+        status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST);
+
+        hB    = hA;
+        hB[0] = hB[0] + T(1);
+        CHECK_HIP_ERROR(hipMemcpy(dB, hB.data(), sizeof(T) * A_size, hipMemcpyHostToDevice));
+
+        double device_error
+            = norm_check_general_device<T>(handle, argus.norm_option, M, N, lda, dA, dB);
+        double host_error = norm_check_general<T>(argus.norm_option, M, N, lda, hA, hB);
+        near_check_general<double>(1, 1, 1, &host_error, &device_error, 1e-5 * host_error);
+    }
+
+    hipblas_client_destroy(handle);
+    return status;
+}
@@ -0,0 +1,139 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <math.h>
+#include <stdlib.h>
+#include <vector>
+
+#include "cblas_interface.h"
+#include "flops.h"
+#include "hipblas.hpp"
+#include "near.h"
+#include "utility.h"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+// The sequence of z - 1 rotations of random angles, compared with LAPACK's xLASR, which applies
+// them one at a time across the whole matrix. The device may contract the products into fused
+// multiply-adds, so the tolerance grows with the length of the sequence
+template <typename T>
+hipblasStatus_t testing_lasr(Arguments argus)
+{
+    using U = real_t<T>;
+
+    int M   = argus.M;
+    int N   = argus.N;
+    int lda = argus.lda;
+
+    hipblasSideMode_t side   = char2hipblas_side(argus.side_option);
+    hipblasPivot_t    pivot  = char2hipblas_pivot(argus.pivot_option);
+    hipblasDirect_t   direct = char2hipblas_direct(argus.direct_option);
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    if(M < 0 || N < 0 || lda < max(1, M))
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    if(M == 0 || N == 0)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    int z       = side == HIPBLAS_SIDE_LEFT ? M : N;
+    int A_size  = lda * N;
+    int cs_size = max(1, z - 1);
+
+    double abs_error = std::numeric_limits<U>::epsilon() * 100 * z;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA(A_size);
+    host_vector<T> hA_gold(A_size);
+    host_vector<U> hc(cs_size);
+    host_vector<U> hs(cs_size);
+
+    device_vector<T> dA(A_size);
+    device_vector<U> dc(cs_size);
+    device_vector<U> ds(cs_size);
+
+    hipblasHandle_t handle;
+    hipblas_client_create(&handle);
+
+    // Initial Data on CPU
+    srand(1);
+    hipblas_init<T>(hA, M, N, lda);
+    for(int i = 0; i < cs_size; i++)
+    {
+        double theta = 6.0 * rand() / RAND_MAX;
+        hc[i]        = U(cos(theta));
+        hs[i]        = U(sin(theta));
+    }
+
+    hA_gold = hA;
+    cblas_lasr<T, U>(argus.side_option,
+                     argus.pivot_option,
+                     argus.direct_option,
+                     M,
+                     N,
+                     hc.data(),
+                     hs.data(),
+                     hA_gold.data(),
+                     lda);
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * A_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dc, hc.data(), sizeof(U) * cs_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(ds, hs.data(), sizeof(U) * cs_size, hipMemcpyHostToDevice));
+
+    /* =====================================================================
+           HIPBLAS
+    =================================================================== */
+
+    status = hipblasLasr<T, U>(handle, side, pivot, direct, M, N, dc, ds, dA, lda);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    CHECK_HIP_ERROR(hipMemcpy(hA.data(), dA, sizeof(T) * A_size, hipMemcpyDeviceToHost));
+
+    if(argus.unit_check)
+    {
+        near_check_general<T>(M, N, lda, hA_gold.data(), hA.data(), abs_error);
+    }
+
+    if(argus.timing)
+    {
+        // rotations keep the norms of A's rows and columns, so the timed calls run on in place
+        hipblas_timing timing;
+        status = hipblas_time_launches(handle, argus, timing, [&] {
+            return hipblasLasr<T, U>(handle, side, pivot, direct, M, N, dc, ds, dA, lda);
+        });
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            hipblas_client_destroy(handle);
+            return status;
+        }
+
+        double gflop = rot_gflop_count<T>((z - 1) * (side == HIPBLAS_SIDE_LEFT ? N : M));
+        double gbyte = lasr_gbyte_count<T, U>(M, N, z);
+
+        cout << "side,pivot,direct,M,N,lda," HIPBLAS_TIMING_COLUMNS << endl;
+        cout << argus.side_option << ',' << argus.pivot_option << ',' << argus.direct_option << ','
+             << M << ',' << N << ',' << lda << ',';
+        hipblas_print_timing(cout, timing, gflop, gbyte);
+    }
+
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
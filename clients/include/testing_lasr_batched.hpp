@@ -0,0 +1,162 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <math.h>
+#include <stdlib.h>
+#include <vector>
+
+#include "cblas_interface.h"
+#include "flops.h"
+#include "hipblas.hpp"
+#include "near.h"
+#include "utility.h"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+// every batch has its own rotations and matrix, each reached through a pointer array
+template <typename T>
+hipblasStatus_t testing_lasr_batched(Arguments argus)
+{
+    using U = real_t<T>;
+
+    int M           = argus.M;
+    int N           = argus.N;
+    int lda         = argus.lda;
+    int batch_count = argus.batch_count;
+
+    hipblasSideMode_t side   = char2hipblas_side(argus.side_option);
+    hipblasPivot_t    pivot  = char2hipblas_pivot(argus.pivot_option);
+    hipblasDirect_t   direct = char2hipblas_direct(argus.direct_option);
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    if(M < 0 || N < 0 || lda < max(1, M) || batch_count < 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    if(M == 0 || N == 0 || batch_count == 0)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    int z       = side == HIPBLAS_SIDE_LEFT ? M : N;
+    int A_size  = lda * N;
+    int cs_size = max(1, z - 1);
+
+    double abs_error = std::numeric_limits<U>::epsilon() * 100 * z;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA[batch_count];
+    host_vector<T> hA_gold[batch_count];
+    host_vector<U> hc[batch_count];
+    host_vector<U> hs[batch_count];
+
+    device_batch_vector<T> bA(batch_count, A_size);
+    device_batch_vector<U> bc(batch_count, cs_size);
+    device_batch_vector<U> bs(batch_count, cs_size);
+
+    device_vector<T*, 0, T> dA(batch_count);
+    device_vector<U*, 0, U> dc(batch_count);
+    device_vector<U*, 0, U> ds(batch_count);
+
+    hipblasHandle_t handle;
+    hipblas_client_create(&handle);
+
+    // Initial Data on CPU
+    srand(1);
+    for(int b = 0; b < batch_count; b++)
+    {
+        hA[b] = host_vector<T>(A_size);
+        hc[b] = host_vector<U>(cs_size);
+        hs[b] = host_vector<U>(cs_size);
+
+        hipblas_init<T>(hA[b], M, N, lda);
+        for(int i = 0; i < cs_size; i++)
+        {
+            double theta = 6.0 * rand() / RAND_MAX;
+            hc[b][i]     = U(cos(theta));
+            hs[b][i]     = U(sin(theta));
+        }
+
+        hA_gold[b] = hA[b];
+        cblas_lasr<T, U>(argus.side_option,
+                         argus.pivot_option,
+                         argus.direct_option,
+                         M,
+                         N,
+                         hc[b].data(),
+                         hs[b].data(),
+                         hA_gold[b].data(),
+                         lda);
+
+        CHECK_HIP_ERROR(hipMemcpy(bA[b], hA[b].data(), sizeof(T) * A_size, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(
+            hipMemcpy(bc[b], hc[b].data(), sizeof(U) * cs_size, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(
+            hipMemcpy(bs[b], hs[b].data(), sizeof(U) * cs_size, hipMemcpyHostToDevice));
+    }
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, bA, sizeof(T*) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dc, bc, sizeof(U*) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(ds, bs, sizeof(U*) * batch_count, hipMemcpyHostToDevice));
+
+    auto lasr = [&] {
+        return hipblasLasrBatched<T, U>(
+            handle, side, pivot, direct, M, N, dc, ds, dA, lda, batch_count);
+    };
+
+    /* =====================================================================
+           HIPBLAS
+    =================================================================== */
+
+    status = lasr();
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    // copy output from device to CPU
+    for(int b = 0; b < batch_count; b++)
+        CHECK_HIP_ERROR(hipMemcpy(hA[b].data(), bA[b], sizeof(T) * A_size, hipMemcpyDeviceToHost));
+
+    if(argus.unit_check)
+    {
+        for(int b = 0; b < batch_count; b++)
+            near_check_general<T>(M, N, lda, hA_gold[b].data(), hA[b].data(), abs_error);
+    }
+
+    if(argus.timing)
+    {
+        // rotations keep the norms of A's rows and columns, so the timed calls run on in place
+        hipblas_timing timing;
+        status = hipblas_time_launches(handle, argus, timing, lasr);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            hipblas_client_destroy(handle);
+            return status;
+        }
+
+        double gflop
+            = rot_gflop_count<T>((z - 1) * (side == HIPBLAS_SIDE_LEFT ? N : M)) * batch_count;
+        double gbyte = lasr_gbyte_count<T, U>(M, N, z) * batch_count;
+
+        cout << "side,pivot,direct,M,N,lda,batch_count," HIPBLAS_TIMING_COLUMNS << endl;
+        cout << argus.side_option << ',' << argus.pivot_option << ',' << argus.direct_option << ','
+             << M << ',' << N << ',' << lda << ',' << batch_count << ',';
+        hipblas_print_timing(cout, timing, gflop, gbyte);
+    }
+
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,152 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <math.h>
+#include <stdlib.h>
+#include <vector>
+
+#include "cblas_interface.h"
+#include "flops.h"
+#include "hipblas.hpp"
+#include "near.h"
+#include "utility.h"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+// every batch has its own rotations and matrix; what lies between the batches of A, with a
+// stride_scale above 1, must keep its values
+template <typename T>
+hipblasStatus_t testing_lasr_strided_batched(Arguments argus)
+{
+    using U = real_t<T>;
+
+    int    M            = argus.M;
+    int    N            = argus.N;
+    int    lda          = argus.lda;
+    int    batch_count  = argus.batch_count;
+    double stride_scale = argus.stride_scale;
+
+    hipblasSideMode_t side   = char2hipblas_side(argus.side_option);
+    hipblasPivot_t    pivot  = char2hipblas_pivot(argus.pivot_option);
+    hipblasDirect_t   direct = char2hipblas_direct(argus.direct_option);
+
+    int z       = side == HIPBLAS_SIDE_LEFT ? M : N;
+    int cs_size = max(1, z - 1);
+
+    long long strideA  = lda * N * stride_scale;
+    long long stridecs = cs_size * stride_scale;
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    if(M < 0 || N < 0 || lda < max(1, M) || batch_count < 0 || strideA < (long long)lda * N
+       || stridecs < cs_size)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    if(M == 0 || N == 0 || batch_count == 0)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    size_t A_size  = strideA * batch_count;
+    size_t cs_span = stridecs * batch_count;
+
+    double abs_error = std::numeric_limits<U>::epsilon() * 100 * z;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA(A_size);
+    host_vector<T> hA_gold(A_size);
+    host_vector<U> hc(cs_span);
+    host_vector<U> hs(cs_span);
+
+    device_vector<T> dA(A_size);
+    device_vector<U> dc(cs_span);
+    device_vector<U> ds(cs_span);
+
+    hipblasHandle_t handle;
+    hipblas_client_create(&handle);
+
+    // Initial Data on CPU
+    srand(1);
+    hipblas_init<T>(hA, 1, A_size, 1);
+    for(size_t i = 0; i < cs_span; i++)
+    {
+        double theta = 6.0 * rand() / RAND_MAX;
+        hc[i]        = U(cos(theta));
+        hs[i]        = U(sin(theta));
+    }
+
+    hA_gold = hA;
+    for(int b = 0; b < batch_count; b++)
+        cblas_lasr<T, U>(argus.side_option,
+                         argus.pivot_option,
+                         argus.direct_option,
+                         M,
+                         N,
+                         hc.data() + b * stridecs,
+                         hs.data() + b * stridecs,
+                         hA_gold.data() + b * strideA,
+                         lda);
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * A_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dc, hc.data(), sizeof(U) * cs_span, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(ds, hs.data(), sizeof(U) * cs_span, hipMemcpyHostToDevice));
+
+    auto lasr = [&] {
+        return hipblasLasrStridedBatched<T, U>(
+            handle, side, pivot, direct, M, N, dc, ds, stridecs, dA, lda, strideA, batch_count);
+    };
+
+    /* =====================================================================
+           HIPBLAS
+    =================================================================== */
+
+    status = lasr();
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    CHECK_HIP_ERROR(hipMemcpy(hA.data(), dA, sizeof(T) * A_size, hipMemcpyDeviceToHost));
+
+    if(argus.unit_check)
+    {
+        near_check_general<T>(1, A_size, 1, hA_gold.data(), hA.data(), abs_error);
+    }
+
+    if(argus.timing)
+    {
+        // rotations keep the norms of A's rows and columns, so the timed calls run on in place
+        hipblas_timing timing;
+        status = hipblas_time_launches(handle, argus, timing, lasr);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            hipblas_client_destroy(handle);
+            return status;
+        }
+
+        double gflop
+            = rot_gflop_count<T>((z - 1) * (side == HIPBLAS_SIDE_LEFT ? N : M)) * batch_count;
+        double gbyte = lasr_gbyte_count<T, U>(M, N, z) * batch_count;
+
+        cout << "side,pivot,direct,M,N,lda,stride_scale,batch_count," HIPBLAS_TIMING_COLUMNS
+             << endl;
+        cout << argus.side_option << ',' << argus.pivot_option << ',' << argus.direct_option << ','
+             << M << ',' << N << ',' << lda << ',' << stride_scale << ',' << batch_count << ',';
+        hipblas_print_timing(cout, timing, gflop, gbyte);
+    }
+
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
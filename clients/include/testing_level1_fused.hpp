@@ -0,0 +1,183 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+#include "hipblas.hpp"
+#include "unit.h"
+#include "utility.h"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+// The strided batched hipblasSwaxpby and hipblasSaxpby, hipblasSmdot over K vectors and
+// hipblasSaxpyDot with z = w, checked against loops over the batches. The scalars are host memory
+// for waxpby and mdot and device memory for axpby and axpyDot. The data are small integers, so
+// the results are exact
+hipblasStatus_t testing_level1_fused_strided_batched(Arguments argus)
+{
+    const int K = 3;
+
+    int    N            = argus.N;
+    int    incx         = argus.incx;
+    int    incy         = argus.incy;
+    double stride_scale = argus.stride_scale;
+    int    batch_count  = argus.batch_count;
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    if(N < 0 || !incx || !incy || batch_count < 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    if(batch_count == 0)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    int abs_incx = incx < 0 ? -incx : incx;
+    int abs_incy = incy < 0 ? -incy : incy;
+    int stridex  = N * abs_incx * stride_scale;
+    int stridey  = N * abs_incy * stride_scale;
+    int ldy      = N * abs_incy;
+    int strideY  = ldy * K * stride_scale;
+    int sizeX    = stridex * batch_count;
+    int sizeY    = stridey * batch_count;
+    int sizeYm   = strideY * batch_count;
+
+    float alpha = argus.alpha;
+    float beta  = argus.beta;
+
+    // Offset of element i of a vector with increment inc, from its far end when inc is negative
+    auto at = [&](int i, int inc) { return inc < 0 ? (N - 1 - i) * -inc : i * inc; };
+
+    // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory, plz follow this practice
+    host_vector<float> hx(sizeX);
+    host_vector<float> hy(sizeY);
+    host_vector<float> hw(sizeY);
+    host_vector<float> hY(sizeYm);
+    host_vector<float> h_result(K * batch_count);
+    host_vector<float> h_cpu_result(K * batch_count);
+    host_vector<float> h_gold(sizeY);
+
+    device_vector<float> dx(sizeX);
+    device_vector<float> dy(sizeY);
+    device_vector<float> dw(sizeY);
+    device_vector<float> dY(sizeYm);
+    device_vector<float> d_result(batch_count);
+    device_vector<float> d_alpha(1);
+    device_vector<float> d_beta(1);
+
+    hipblasHandle_t handle;
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+    hipblas_client_create(&handle);
+
+    // Initial Data on CPU
+    srand(1);
+    for(auto* v : {&hx, &hy, &hw, &hY})
+        for(float& e : *v)
+            e = rand() % 9 - 4;
+
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(float) * sizeX, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy, hy.data(), sizeof(float) * sizeY, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dw, hw.data(), sizeof(float) * sizeY, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dY, hY.data(), sizeof(float) * sizeYm, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_alpha, &alpha, sizeof(float), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(d_beta, &beta, sizeof(float), hipMemcpyHostToDevice));
+
+    /* =====================================================================
+         ROCBLAS
+    =================================================================== */
+    // w = alpha * x + beta * y
+    status = hipblasSwaxpbyStridedBatched(handle,
+                                          N,
+                                          &alpha,
+                                          dx,
+                                          incx,
+                                          stridex,
+                                          &beta,
+                                          dy,
+                                          incy,
+                                          stridey,
+                                          dw,
+                                          incy,
+                                          stridey,
+                                          batch_count);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_batch_for(batch_count, [&](int b) {
+            for(int i = 0; i < N; i++)
+                hw[b * stridey + at(i, incy)]
+                    = alpha * hx[b * stridex + at(i, incx)] + beta * hy[b * stridey + at(i, incy)];
+        });
+        CHECK_HIP_ERROR(hipMemcpy(h_gold, dw, sizeof(float) * sizeY, hipMemcpyDeviceToHost));
+        unit_check_general<float>(1, sizeY, 1, hw, h_gold);
+
+        // result[b * K + j] = x^T Y_j
+        status = hipblasSmdotStridedBatched(
+            handle, N, K, dx, incx, stridex, dY, ldy, incy, strideY, batch_count, h_result);
+    }
+    if(status == HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_batch_for(batch_count, [&](int b) {
+            for(int j = 0; j < K; j++)
+            {
+                float sum = 0;
+                for(int i = 0; i < N; i++)
+                    sum += hx[b * stridex + at(i, incx)]
+                           * hY[b * strideY + j * ldy + at(i, incy)];
+                h_cpu_result[b * K + j] = sum;
+            }
+        });
+        unit_check_general<float>(1, K * batch_count, 1, h_cpu_result, h_result);
+
+        // y = alpha * x + beta * y, then y = alpha * x + y and result = w^T y
+        status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE);
+    }
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasSaxpbyStridedBatched(
+            handle, N, d_alpha, dx, incx, stridex, d_beta, dy, incy, stridey, batch_count);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasSaxpyDotStridedBatched(handle,
+                                               N,
+                                               d_alpha,
+                                               dx,
+                                               incx,
+                                               stridex,
+                                               dy,
+                                               incy,
+                                               stridey,
+                                               dw,
+                                               incy,
+                                               stridey,
+                                               batch_count,
+                                               d_result);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_batch_for(batch_count, [&](int b) {
+            float sum = 0;
+            for(int i = 0; i < N; i++)
+            {
+                float  xi = hx[b * stridex + at(i, incx)];
+                float& yi = hy[b * stridey + at(i, incy)];
+                yi        = alpha * xi + beta * yi;
+                yi        = alpha * xi + yi;
+                sum += hw[b * stridey + at(i, incy)] * yi;
+            }
+            h_cpu_result[b] = sum;
+        });
+        CHECK_HIP_ERROR(hipMemcpy(h_gold, dy, sizeof(float) * sizeY, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(h_result, d_result, sizeof(float) * batch_count, hipMemcpyDeviceToHost));
+        unit_check_general<float>(1, sizeY, 1, hy, h_gold);
+        unit_check_general<float>(1, batch_count, 1, h_cpu_result, h_result);
+    }
+
+    hipblas_client_destroy(handle);
+    return status;
+}
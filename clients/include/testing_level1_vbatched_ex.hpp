@@ -0,0 +1,346 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "flops.h"
+#include "hipblas.hpp"
+#include "unit.h"
+#include "utility.h"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+// double value of a float, double or hipblasBfloat16 element, and back
+template <typename T>
+double vbatched_to_double(T val)
+{
+    return hipblas_to_float(val);
+}
+inline double vbatched_to_double(double val)
+{
+    return val;
+}
+
+template <typename T>
+T vbatched_from_double(double val)
+{
+    return hipblas_from_float<T>(float(val));
+}
+template <>
+inline double vbatched_from_double<double>(double val)
+{
+    return val;
+}
+
+// func(handle, n, alpha, x, incx, beta, y, incy) makes the vbatched call and reference(alpha, x,
+// beta, y) is an element of its result; reads_x and reads_y say what the routine reads
+template <typename Tx, typename Ty, typename Tex, typename F, typename R>
+hipblasStatus_t testing_level1_vbatched_ex_template(const Arguments& argus,
+                                                    F                func,
+                                                    R                reference,
+                                                    double           flops,
+                                                    bool             reads_x,
+                                                    bool             reads_y)
+{
+    int N           = argus.N;
+    int incx        = argus.incx;
+    int incy        = argus.incy;
+    int batch_count = argus.batch_count;
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    if(N < 0 || !incx || !incy || batch_count < 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    if(batch_count == 0)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // entries up to N long, some empty, with x increments of incx, 2 incx and -incx in turn.
+    // Entry 3's y increment is 0 and entry 5's length negative, so both are skipped and keep their
+    // values. The elements and scalars are small integers, so every result is exact in each type
+    host_vector<int>    hn(batch_count);
+    host_vector<int>    hincx(batch_count);
+    host_vector<int>    hincy(batch_count);
+    host_vector<size_t> x_offset(batch_count);
+    host_vector<size_t> y_offset(batch_count);
+
+    size_t x_size = 0, y_size = 0, elements = 0;
+    for(int b = 0; b < batch_count; b++)
+    {
+        hn[b]       = b == 5 ? -3 : int(b * 997LL % (N + 1));
+        hincx[b]    = b % 3 == 0 ? incx : b % 3 == 1 ? 2 * incx : -incx;
+        hincy[b]    = b == 3 ? 0 : b % 2 ? -incy : incy;
+        x_offset[b] = x_size;
+        y_offset[b] = y_size;
+        x_size += 1 + size_t(max(hn[b] - 1, 0)) * abs(hincx[b]);
+        y_size += 1 + size_t(max(hn[b] - 1, 0)) * abs(hincy[b]);
+        elements += hincy[b] ? max(hn[b], 0) : 0;
+    }
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<Tx>    hx(x_size);
+    host_vector<Ty>    hy(y_size);
+    host_vector<Ty>    hy_host(y_size);
+    host_vector<Ty>    hy_device(y_size);
+    host_vector<Ty>    hy_gold(y_size);
+    host_vector<Tex>   halpha(batch_count);
+    host_vector<Tex>   hbeta(batch_count);
+    host_vector<void*> hx_array(batch_count);
+    host_vector<void*> hy_array(batch_count);
+
+    device_vector<Tx>           dx(x_size);
+    device_vector<Ty>           dy(y_size);
+    device_vector<int>          dn(batch_count);
+    device_vector<int>          dincx(batch_count);
+    device_vector<int>          dincy(batch_count);
+    device_vector<Tex>          dalpha(batch_count);
+    device_vector<Tex>          dbeta(batch_count);
+    device_vector<void*, 0, Tx> dx_array(batch_count);
+    device_vector<void*, 0, Ty> dy_array(batch_count);
+
+    hipblasHandle_t handle;
+    hipblas_client_create(&handle);
+
+    // Initial Data on CPU; with device scalars entry b's alpha and beta are alpha + b % 3 and
+    // beta - b % 2, a scalar stride of 1 apart
+    for(size_t i = 0; i < x_size; i++)
+        hx[i] = vbatched_from_double<Tx>(double(i % 17) - 8);
+    for(size_t i = 0; i < y_size; i++)
+        hy[i] = vbatched_from_double<Ty>(double(i % 13) - 6);
+    for(int b = 0; b < batch_count; b++)
+    {
+        halpha[b]   = vbatched_from_double<Tex>(argus.alpha + b % 3);
+        hbeta[b]    = vbatched_from_double<Tex>(argus.beta - b % 2);
+        hx_array[b] = (Tx*)dx + x_offset[b];
+        hy_array[b] = (Ty*)dy + y_offset[b];
+    }
+
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(Tx) * x_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dn, hn.data(), sizeof(int) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dincx, hincx.data(), sizeof(int) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dincy, hincy.data(), sizeof(int) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dalpha, halpha.data(), sizeof(Tex) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dbeta, hbeta.data(), sizeof(Tex) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dx_array, hx_array.data(), sizeof(void*) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dy_array, hy_array.data(), sizeof(void*) * batch_count, hipMemcpyHostToDevice));
+
+    auto launch = [&](const void* alpha, const void* beta) {
+        return func(handle, dn, alpha, dx_array, dincx, beta, dy_array, dincy);
+    };
+
+    /* =====================================================================
+           HIPBLAS
+    =================================================================== */
+
+    // host scalars are entry 0's, the same for every entry then
+    CHECK_HIP_ERROR(hipMemcpy(dy, hy.data(), sizeof(Ty) * y_size, hipMemcpyHostToDevice));
+    status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = launch(&halpha[0], &hbeta[0]);
+    CHECK_HIP_ERROR(hipMemcpy(hy_host.data(), dy, sizeof(Ty) * y_size, hipMemcpyDeviceToHost));
+
+    if(status == HIPBLAS_STATUS_SUCCESS)
+    {
+        CHECK_HIP_ERROR(hipMemcpy(dy, hy.data(), sizeof(Ty) * y_size, hipMemcpyHostToDevice));
+        status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblasSetScalarStride(handle, 1);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = launch(dalpha, dbeta);
+        CHECK_HIP_ERROR(
+            hipMemcpy(hy_device.data(), dy, sizeof(Ty) * y_size, hipMemcpyDeviceToHost));
+    }
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblasSetScalarStride(handle, 0);
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    if(argus.unit_check)
+    {
+        // element i of an entry, counted from the far end for negative increments
+        auto element = [](int i, int n, int inc) {
+            return inc >= 0 ? size_t(i) * inc : size_t(i - (n - 1)) * inc;
+        };
+        auto check = [&](host_vector<Ty>& result, bool device_scalars) {
+            hy_gold = hy;
+            for(int b = 0; b < batch_count; b++)
+            {
+                int    n     = hn[b];
+                double alpha = vbatched_to_double(halpha[device_scalars ? b : 0]);
+                double beta  = vbatched_to_double(hbeta[device_scalars ? b : 0]);
+                for(int i = 0; hincy[b] && i < n; i++)
+                {
+                    double x = vbatched_to_double(hx[x_offset[b] + element(i, n, hincx[b])]);
+                    Ty&    y = hy_gold[y_offset[b] + element(i, n, hincy[b])];
+                    y = vbatched_from_double<Ty>(reference(alpha, x, beta, vbatched_to_double(y)));
+                }
+            }
+            unit_check_general<Ty>(1, y_size, 1, hy_gold.data(), result.data());
+        };
+        check(hy_host, false);
+        check(hy_device, true);
+    }
+
+    if(argus.timing)
+    {
+        // timed with the device scalars the last call left the handle
+        hipblas_timing timing;
+        status = hipblas_time_launches(
+            handle, argus, timing, [&] { return launch(dalpha, dbeta); });
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            hipblasSetScalarStride(handle, 0);
+            hipblas_client_destroy(handle);
+            return status;
+        }
+
+        double gflop = flops * elements / 1e9;
+        double gbyte = vbatched_gbyte_count<Tx, Ty>(elements, reads_x, reads_y);
+
+        cout << "N,incx,incy,batch_count," HIPBLAS_TIMING_COLUMNS << endl;
+        cout << N << ',' << incx << ',' << incy << ',' << batch_count << ',';
+        hipblas_print_timing(cout, timing, gflop, gbyte);
+    }
+
+    // the handle may be shared with later tests, which read one alpha and beta for all batches
+    hipblasSetScalarStride(handle, 0);
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+// x and y are stored as Tx and Ty; alpha, beta and the arithmetic are in Tex
+template <typename Tx, typename Ty = Tx, typename Tex = Ty>
+hipblasStatus_t testing_axpy_vbatched_ex(const Arguments& arg)
+{
+    hipblasDatatype_t x_type = hipblas_datatype<Tx>, y_type = hipblas_datatype<Ty>;
+    hipblasDatatype_t execution_type = hipblas_datatype<Tex>;
+    int               batch_count    = arg.batch_count;
+
+    return testing_level1_vbatched_ex_template<Tx, Ty, Tex>(
+        arg,
+        [&](hipblasHandle_t   handle,
+            const int*        n,
+            const void*       alpha,
+            const void* const x[],
+            const int*        incx,
+            const void*,
+            void* const y[],
+            const int*  incy) {
+            return hipblasAxpyVbatchedEx(
+                handle, n, alpha, x, x_type, incx, y, y_type, incy, batch_count, execution_type);
+        },
+        [](double alpha, double x, double, double y) { return alpha * x + y; },
+        2.0,
+        true,
+        true);
+}
+
+template <typename Tx, typename Ty = Tx, typename Tex = Ty>
+hipblasStatus_t testing_axpby_vbatched_ex(const Arguments& arg)
+{
+    hipblasDatatype_t x_type = hipblas_datatype<Tx>, y_type = hipblas_datatype<Ty>;
+    hipblasDatatype_t execution_type = hipblas_datatype<Tex>;
+    int               batch_count    = arg.batch_count;
+
+    return testing_level1_vbatched_ex_template<Tx, Ty, Tex>(
+        arg,
+        [&](hipblasHandle_t   handle,
+            const int*        n,
+            const void*       alpha,
+            const void* const x[],
+            const int*        incx,
+            const void*       beta,
+            void* const       y[],
+            const int*        incy) {
+            return hipblasAxpbyVbatchedEx(handle,
+                                          n,
+                                          alpha,
+                                          x,
+                                          x_type,
+                                          incx,
+                                          beta,
+                                          y,
+                                          y_type,
+                                          incy,
+                                          batch_count,
+                                          execution_type);
+        },
+        [](double alpha, double x, double beta, double y) { return alpha * x + beta * y; },
+        3.0,
+        true,
+        true);
+}
+
+// y = alpha y; x is not looked at
+template <typename Ty, typename Tex = Ty>
+hipblasStatus_t testing_scal_vbatched_ex(const Arguments& arg)
+{
+    hipblasDatatype_t y_type         = hipblas_datatype<Ty>;
+    hipblasDatatype_t execution_type = hipblas_datatype<Tex>;
+    int               batch_count    = arg.batch_count;
+
+    return testing_level1_vbatched_ex_template<Ty, Ty, Tex>(
+        arg,
+        [&](hipblasHandle_t handle,
+            const int*      n,
+            const void*     alpha,
+            const void* const*,
+            const int*,
+            const void*,
+            void* const y[],
+            const int*  incy) {
+            return hipblasScalVbatchedEx(
+                handle, n, alpha, y, y_type, incy, batch_count, execution_type);
+        },
+        [](double alpha, double, double, double y) { return alpha * y; },
+        1.0,
+        false,
+        true);
+}
+
+// y = x, converted from Tx to Ty; there are no scalars
+template <typename Tx, typename Ty = Tx>
+hipblasStatus_t testing_copy_vbatched_ex(const Arguments& arg)
+{
+    hipblasDatatype_t x_type = hipblas_datatype<Tx>, y_type = hipblas_datatype<Ty>;
+    int               batch_count = arg.batch_count;
+
+    return testing_level1_vbatched_ex_template<Tx, Ty, Ty>(
+        arg,
+        [&](hipblasHandle_t handle,
+            const int*      n,
+            const void*,
+            const void* const x[],
+            const int*        incx,
+            const void*,
+            void* const y[],
+            const int*  incy) {
+            return hipblasCopyVbatchedEx(
+                handle, n, x, x_type, incx, y, y_type, incy, batch_count);
+        },
+        [](double, double x, double, double) { return x; },
+        0.0,
+        true,
+        false);
+}
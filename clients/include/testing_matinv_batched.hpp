@@ -0,0 +1,130 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "cblas_interface.h"
+#include "flops.h"
+#include "hipblas.hpp"
+#include "norm.h"
+#include "unit.h"
+#include "utility.h"
+
+using namespace std;
+
+template <typename T>
+hipblasStatus_t testing_matinv_batched(Arguments argus)
+{
+    int N           = argus.N;
+    int lda         = argus.lda;
+    int lda_inv     = argus.lda;
+    int batch_count = argus.batch_count;
+
+    int A_size    = lda * N;
+    int Ainv_size = lda_inv * N;
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+
+    // Check to prevent memory allocation error; matinv only takes matrices up to 32 x 32
+    if(N < 0 || N > 32 || lda < N || batch_count < 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    if(batch_count == 0)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T>   hA[batch_count];
+    host_vector<T>   hA1[batch_count];
+    host_vector<T>   hAinv1[batch_count];
+    host_vector<int> hIpiv(N);
+    host_vector<int> hInfo1(batch_count);
+
+    device_batch_vector<T> bA(batch_count, A_size);
+    device_batch_vector<T> bAinv(batch_count, Ainv_size);
+
+    device_vector<T*, 0, T> dA(batch_count);
+    device_vector<T*, 0, T> dAinv(batch_count);
+    device_vector<int>      dInfo(batch_count);
+
+    hipblasHandle_t handle;
+    hipblas_client_create(&handle);
+
+    // Initial hA on CPU; the diagonal is boosted so every matrix is well conditioned
+    srand(1);
+    for(int b = 0; b < batch_count; b++)
+    {
+        hA[b]     = host_vector<T>(A_size);
+        hA1[b]    = host_vector<T>(A_size);
+        hAinv1[b] = host_vector<T>(Ainv_size);
+
+        hipblas_init<T>(hA[b], N, N, lda);
+        for(int i = 0; i < N; i++)
+            hA[b][i + i * lda] += T(10 * N);
+
+        // Copy data from CPU to device
+        CHECK_HIP_ERROR(hipMemcpy(bA[b], hA[b].data(), A_size * sizeof(T), hipMemcpyHostToDevice));
+    }
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, bA, batch_count * sizeof(T*), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dAinv, bAinv, batch_count * sizeof(T*), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemset(dInfo, 0, batch_count * sizeof(int)));
+
+    /* =====================================================================
+           HIPBLAS
+    =================================================================== */
+
+    status = hipblasMatinvBatched<T>(handle, N, dA, lda, dAinv, lda_inv, dInfo, batch_count);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    // Copy output from device to CPU
+    for(int b = 0; b < batch_count; b++)
+    {
+        CHECK_HIP_ERROR(hipMemcpy(hA1[b].data(), bA[b], A_size * sizeof(T), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hAinv1[b].data(), bAinv[b], Ainv_size * sizeof(T), hipMemcpyDeviceToHost));
+    }
+    CHECK_HIP_ERROR(
+        hipMemcpy(hInfo1.data(), dInfo, batch_count * sizeof(int), hipMemcpyDeviceToHost));
+
+    if(argus.unit_check)
+    {
+        /* =====================================================================
+           CPU LAPACK
+        =================================================================== */
+
+        int            lwork = max(1, N);
+        host_vector<T> work(lwork);
+        for(int b = 0; b < batch_count; b++)
+        {
+            // A is an input only
+            unit_check_general<T>(N, N, lda, hA[b].data(), hA1[b].data());
+
+            cblas_getrf(N, N, hA[b].data(), lda, hIpiv.data());
+            int info = cblas_getri(N, hA[b].data(), lda, hIpiv.data(), work.data(), lwork);
+
+            unit_check_general<int>(1, 1, 1, &info, hInfo1.data() + b);
+
+            real_t<T> eps       = std::numeric_limits<real_t<T>>::epsilon();
+            double    tolerance = eps * 2000;
+
+            double e = norm_check_general<T>('M', N, N, lda, hA[b].data(), hAinv1[b].data());
+            unit_check_error(e, tolerance);
+        }
+    }
+
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,84 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+#include "cblas_interface.h"
+#include "hipblas.hpp"
+#include "norm.h"
+#include "unit.h"
+#include "utility.h"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+// x is stored as Tx; the result and the arithmetic are in Tr
+template <typename Tx, typename Tr = real_t<Tx>>
+hipblasStatus_t testing_nrm2_ex(Arguments argus)
+{
+    int N    = argus.N;
+    int incx = argus.incx;
+
+    hipblasDatatype_t x_type      = hipblas_datatype<Tx>;
+    hipblasDatatype_t result_type = hipblas_datatype<Tr>;
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+
+    // check to prevent undefined memory allocation error
+    if(N < 0 || incx < 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+
+    int sizeX = N * incx;
+
+    // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory, plz follow this practice
+    host_vector<Tx> hx(sizeX);
+
+    device_vector<Tx> dx(sizeX);
+    device_vector<Tr> d_result(1);
+
+    Tr cpu_result, rocblas_result;
+
+    hipblasHandle_t handle;
+    hipblas_client_create(&handle);
+
+    // Initial Data on CPU
+    srand(1);
+    hipblas_init<Tx>(hx, 1, N, incx);
+
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(Tx) * sizeX, hipMemcpyHostToDevice));
+
+    /* =====================================================================
+         ROCBLAS
+    =================================================================== */
+    status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasNrm2Ex(handle, N, dx, x_type, incx, d_result, result_type, result_type);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    CHECK_HIP_ERROR(hipMemcpy(&rocblas_result, d_result, sizeof(Tr), hipMemcpyDeviceToHost));
+
+    if(argus.unit_check)
+    {
+        /* =====================================================================
+                    CPU BLAS
+        =================================================================== */
+        cblas_nrm2<Tx, Tr>(N, hx.data(), incx, &cpu_result);
+
+        Tr tolerance = is_complex<Tx> ? 110 : 100;
+        unit_check_nrm2<Tr>(cpu_result, rocblas_result, tolerance);
+    }
+
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
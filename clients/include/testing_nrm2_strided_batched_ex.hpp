@@ -0,0 +1,95 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+#include "cblas_interface.h"
+#include "hipblas.hpp"
+#include "norm.h"
+#include "unit.h"
+#include "utility.h"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+// x is stored as Tx; the results and the arithmetic are in Tr
+template <typename Tx, typename Tr = real_t<Tx>>
+hipblasStatus_t testing_nrm2_strided_batched_ex(Arguments argus)
+{
+    int    N            = argus.N;
+    int    incx         = argus.incx;
+    double stride_scale = argus.stride_scale;
+    int    batch_count  = argus.batch_count;
+
+    hipblasDatatype_t x_type      = hipblas_datatype<Tx>;
+    hipblasDatatype_t result_type = hipblas_datatype<Tr>;
+
+    int stridex = N * incx * stride_scale;
+    int sizeX   = stridex * batch_count;
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+
+    // check to prevent undefined memory allocation error
+    if(N < 0 || incx < 0 || batch_count < 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    if(batch_count == 0)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory, plz follow this practice
+    host_vector<Tx> hx(sizeX);
+    host_vector<Tr> h_rocblas_result(batch_count);
+    host_vector<Tr> h_cpu_result(batch_count);
+
+    device_vector<Tx> dx(sizeX);
+    device_vector<Tr> d_result(batch_count);
+
+    hipblasHandle_t handle;
+    hipblas_client_create(&handle);
+
+    // Initial Data on CPU
+    srand(1);
+    hipblas_init<Tx>(hx, 1, N, incx, stridex, batch_count);
+
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(Tx) * sizeX, hipMemcpyHostToDevice));
+
+    /* =====================================================================
+         ROCBLAS
+    =================================================================== */
+    status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasNrm2StridedBatchedEx(
+            handle, N, dx, x_type, incx, stridex, batch_count, d_result, result_type, result_type);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    CHECK_HIP_ERROR(hipMemcpy(
+        h_rocblas_result.data(), d_result, sizeof(Tr) * batch_count, hipMemcpyDeviceToHost));
+
+    if(argus.unit_check)
+    {
+        /* =====================================================================
+                    CPU BLAS
+        =================================================================== */
+        Tr tolerance = is_complex<Tx> ? 110 : 100;
+        for(int b = 0; b < batch_count; b++)
+        {
+            cblas_nrm2<Tx, Tr>(N, hx.data() + b * stridex, incx, h_cpu_result.data() + b);
+            unit_check_nrm2<Tr>(h_cpu_result[b], h_rocblas_result[b], tolerance);
+        }
+    }
+
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,100 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "cblas_interface.h"
+#include "flops.h"
+#include "hipblas.hpp"
+#include "norm.h"
+#include "unit.h"
+#include "utility.h"
+
+using namespace std;
+
+template <typename T>
+hipblasStatus_t testing_orgqr(Arguments argus)
+{
+    int M   = argus.M;
+    int N   = argus.N;
+    int lda = argus.lda;
+
+    int A_size = lda * N;
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+
+    // Check to prevent memory allocation error; Q has no more columns than rows
+    if(M < 0 || N < 0 || N > M || lda < M)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA(A_size);
+    host_vector<T> hQR(A_size);
+    host_vector<T> hR(N * N);
+    host_vector<T> hQ(A_size);
+    host_vector<T> hA1(A_size);
+    int            info;
+
+    device_vector<T> dA(A_size);
+    device_vector<T> dTau(N);
+
+    hipblasHandle_t handle;
+    hipblas_client_create(&handle);
+
+    // Initial hA on CPU
+    srand(1);
+    hipblas_init<T>(hA, M, N, lda);
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), A_size * sizeof(T), hipMemcpyHostToDevice));
+
+    /* =====================================================================
+           HIPBLAS
+    =================================================================== */
+
+    status = hipblasGeqrf<T>(handle, M, N, dA, lda, dTau, &info);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        CHECK_HIP_ERROR(hipMemcpy(hQR.data(), dA, A_size * sizeof(T), hipMemcpyDeviceToHost));
+
+    // A is overwritten by the first N columns of Q
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasOrgqr<T>(handle, M, N, N, dA, lda, dTau, &info);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    // Copy output from device to CPU
+    CHECK_HIP_ERROR(hipMemcpy(hQ.data(), dA, A_size * sizeof(T), hipMemcpyDeviceToHost));
+
+    if(argus.unit_check)
+    {
+        EXPECT_EQ(0, info);
+
+        // Q R gives back A
+        for(int j = 0; j < N; j++)
+            for(int i = 0; i < N; i++)
+                hR[i + j * N] = i <= j ? hQR[i + j * lda] : T(0);
+
+        hipblasOperation_t op = HIPBLAS_OP_N;
+        cblas_gemm<T>(op, op, M, N, N, 1, hQ.data(), lda, hR.data(), N, 0, hA1.data(), lda);
+
+        T      eps       = std::numeric_limits<T>::epsilon();
+        double tolerance = eps * 2000;
+
+        double e = norm_check_general<T>('M', M, N, lda, hA.data(), hA1.data());
+        unit_check_error(e, tolerance);
+    }
+
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
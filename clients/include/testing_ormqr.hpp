@@ -0,0 +1,100 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "cblas_interface.h"
+#include "flops.h"
+#include "hipblas.hpp"
+#include "norm.h"
+#include "unit.h"
+#include "utility.h"
+
+using namespace std;
+
+template <typename T>
+hipblasStatus_t testing_ormqr(Arguments argus)
+{
+    int M   = argus.M;
+    int N   = argus.N;
+    int lda = argus.lda;
+    int K   = min(M, N);
+
+    int A_size   = lda * N;
+    int Tau_size = K;
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+
+    // Check to prevent memory allocation error
+    if(M < 0 || N < 0 || lda < M)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA(A_size);
+    host_vector<T> hQR(A_size);
+    host_vector<T> hR(A_size);
+    host_vector<T> hC(A_size);
+    int            info;
+
+    device_vector<T> dA(A_size);
+    device_vector<T> dC(A_size);
+    device_vector<T> dTau(Tau_size);
+
+    hipblasHandle_t handle;
+    hipblas_client_create(&handle);
+
+    // Initial hA on CPU
+    srand(1);
+    hipblas_init<T>(hA, M, N, lda);
+
+    // Copy data from CPU to device; C starts as A
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), A_size * sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC, hA.data(), A_size * sizeof(T), hipMemcpyHostToDevice));
+
+    /* =====================================================================
+           HIPBLAS
+    =================================================================== */
+
+    status = hipblasGeqrf<T>(handle, M, N, dA, lda, dTau, &info);
+
+    // Q' A is the R of the factorization
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasOrmqr<T>(
+            handle, HIPBLAS_SIDE_LEFT, HIPBLAS_OP_T, M, N, K, dA, lda, dTau, dC, lda, &info);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    // Copy output from device to CPU
+    CHECK_HIP_ERROR(hipMemcpy(hQR.data(), dA, A_size * sizeof(T), hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hC.data(), dC, A_size * sizeof(T), hipMemcpyDeviceToHost));
+
+    if(argus.unit_check)
+    {
+        EXPECT_EQ(0, info);
+
+        // R is the upper triangle geqrf left in A, with zeros below it
+        for(int j = 0; j < N; j++)
+            for(int i = 0; i < M; i++)
+                hR[i + j * lda] = i <= j ? hQR[i + j * lda] : T(0);
+
+        T      eps       = std::numeric_limits<T>::epsilon();
+        double tolerance = eps * 2000;
+
+        double e = norm_check_general<T>('M', M, N, lda, hR.data(), hC.data());
+        unit_check_error(e, tolerance);
+    }
+
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
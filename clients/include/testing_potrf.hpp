@@ -0,0 +1,126 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "cblas_interface.h"
+#include "flops.h"
+#include "hipblas.hpp"
+#include "norm.h"
+#include "unit.h"
+#include "utility.h"
+
+using namespace std;
+
+template <typename T>
+hipblasStatus_t testing_potrf(Arguments argus)
+{
+    int               N      = argus.N;
+    int               lda    = argus.lda;
+    char              char_u = argus.uplo_option;
+    hipblasFillMode_t uplo   = char2hipblas_fill(char_u);
+
+    int A_size = lda * N;
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+
+    // Check to prevent memory allocation error
+    if(N < 0 || lda < N)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T>   hA(A_size);
+    host_vector<T>   hA1(A_size);
+    host_vector<int> hInfo1(1);
+    int              info;
+
+    device_vector<T>   dA(A_size);
+    device_vector<int> dInfo(1);
+
+    hipblasHandle_t handle;
+    hipblas_client_create(&handle);
+
+    // Initial hA on CPU: symmetric and diagonally dominant, so positive definite
+    srand(1);
+    hipblas_init_symmetric<T>(hA, N, lda);
+    for(int i = 0; i < N; i++)
+        hA[i + i * lda] += T(10 * N);
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), A_size * sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemset(dInfo, 0, sizeof(int)));
+
+    /* =====================================================================
+           HIPBLAS
+    =================================================================== */
+
+    status = hipblasPotrf<T>(handle, uplo, N, dA, lda, dInfo);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    // Copy output from device to CPU
+    CHECK_HIP_ERROR(hipMemcpy(hA1.data(), dA, A_size * sizeof(T), hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hInfo1.data(), dInfo, sizeof(int), hipMemcpyDeviceToHost));
+
+    if(argus.unit_check)
+    {
+        /* =====================================================================
+           CPU LAPACK
+        =================================================================== */
+
+        info = cblas_potrf<T>(char_u, N, hA.data(), lda);
+
+        unit_check_general<int>(1, 1, 1, &info, hInfo1.data());
+
+        real_t<T> eps       = std::numeric_limits<real_t<T>>::epsilon();
+        double    tolerance = eps * 2000;
+
+        double e = norm_check_general<T>('M', N, N, lda, hA.data(), hA1.data());
+        unit_check_error(e, tolerance);
+    }
+
+    if(argus.timing)
+    {
+        // the timed calls factor in place, so each gets the original matrix back first
+        srand(1);
+        hipblas_init_symmetric<T>(hA, N, lda);
+        for(int i = 0; i < N; i++)
+            hA[i + i * lda] += T(10 * N);
+        device_vector<T> dA0(A_size);
+        CHECK_HIP_ERROR(hipMemcpy(dA0, hA.data(), A_size * sizeof(T), hipMemcpyHostToDevice));
+
+        hipblas_timing timing;
+        status = hipblas_time_launches(
+            handle,
+            argus,
+            timing,
+            [&] { return hipblas_restore_input(handle, dA, dA0, A_size * sizeof(T)); },
+            [&] { return hipblasPotrf<T>(handle, uplo, N, dA, lda, dInfo); });
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            hipblas_client_destroy(handle);
+            return status;
+        }
+
+        double gflop = potrf_gflop_count<T>(N);
+        double gbyte = potrf_gbyte_count<T>(N);
+
+        cout << "uplo,N,lda," HIPBLAS_TIMING_COLUMNS << endl;
+        cout << char_u << ',' << N << ',' << lda << ',';
+        hipblas_print_timing(cout, timing, gflop, gbyte);
+    }
+
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
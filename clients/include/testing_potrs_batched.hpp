@@ -0,0 +1,133 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "cblas_interface.h"
+#include "flops.h"
+#include "hipblas.hpp"
+#include "norm.h"
+#include "unit.h"
+#include "utility.h"
+
+using namespace std;
+
+template <typename T>
+hipblasStatus_t testing_potrs_batched(Arguments argus)
+{
+    int               N           = argus.N;
+    int               lda         = argus.lda;
+    int               ldb         = argus.ldb;
+    int               batch_count = argus.batch_count;
+    char              char_u      = argus.uplo_option;
+    hipblasFillMode_t uplo        = char2hipblas_fill(char_u);
+
+    int A_size = lda * N;
+    int B_size = ldb * 1;
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+
+    // Check to prevent memory allocation error
+    if(N < 0 || lda < N || ldb < N || batch_count < 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    if(batch_count == 0)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA[batch_count];
+    host_vector<T> hX[batch_count];
+    host_vector<T> hB[batch_count];
+    host_vector<T> hB1[batch_count];
+    int            info;
+
+    device_batch_vector<T> bA(batch_count, A_size);
+    device_batch_vector<T> bB(batch_count, B_size);
+
+    device_vector<T*, 0, T> dA(batch_count);
+    device_vector<T*, 0, T> dB(batch_count);
+
+    hipblasHandle_t handle;
+    hipblas_client_create(&handle);
+
+    // Initial hA, hB, hX on CPU; hA is symmetric and diagonally dominant, so positive definite
+    srand(1);
+    hipblasOperation_t op = HIPBLAS_OP_N;
+    for(int b = 0; b < batch_count; b++)
+    {
+        hA[b]  = host_vector<T>(A_size);
+        hX[b]  = host_vector<T>(B_size);
+        hB[b]  = host_vector<T>(B_size);
+        hB1[b] = host_vector<T>(B_size);
+
+        hipblas_init_symmetric<T>(hA[b], N, lda);
+        hipblas_init<T>(hX[b], N, 1, ldb);
+        for(int i = 0; i < N; i++)
+            hA[b][i + i * lda] += T(10 * N);
+
+        // Calculate hB = hA*hX;
+        cblas_gemm<T>(
+            op, op, N, 1, N, 1, hA[b].data(), lda, hX[b].data(), ldb, 0, hB[b].data(), ldb);
+
+        // Cholesky factorize hA on the CPU
+        info = cblas_potrf<T>(char_u, N, hA[b].data(), lda);
+        if(info != 0)
+        {
+            cerr << "Cholesky decomposition failed" << endl;
+            return HIPBLAS_STATUS_SUCCESS;
+        }
+
+        // Copy data from CPU to device
+        CHECK_HIP_ERROR(hipMemcpy(bA[b], hA[b].data(), A_size * sizeof(T), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(bB[b], hB[b].data(), B_size * sizeof(T), hipMemcpyHostToDevice));
+    }
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(dA, bA, batch_count * sizeof(T*), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, bB, batch_count * sizeof(T*), hipMemcpyHostToDevice));
+
+    /* =====================================================================
+           HIPBLAS
+    =================================================================== */
+
+    status = hipblasPotrsBatched<T>(handle, uplo, N, 1, dA, lda, dB, ldb, &info, batch_count);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    // copy output from device to CPU
+    for(int b = 0; b < batch_count; b++)
+        CHECK_HIP_ERROR(hipMemcpy(hB1[b].data(), bB[b], B_size * sizeof(T), hipMemcpyDeviceToHost));
+
+    if(argus.unit_check)
+    {
+        /* =====================================================================
+           CPU LAPACK
+        =================================================================== */
+
+        for(int b = 0; b < batch_count; b++)
+        {
+            cblas_potrs<T>(char_u, N, 1, hA[b].data(), lda, hB[b].data(), ldb);
+
+            real_t<T> eps       = std::numeric_limits<real_t<T>>::epsilon();
+            double    tolerance = N * eps * 100;
+
+            double e = norm_check_general<T>('M', N, 1, ldb, hB[b].data(), hB1[b].data());
+            unit_check_error(e, tolerance);
+        }
+    }
+
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,129 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "cblas_interface.h"
+#include "flops.h"
+#include "hipblas.hpp"
+#include "norm.h"
+#include "unit.h"
+#include "utility.h"
+
+using namespace std;
+
+template <typename T>
+hipblasStatus_t testing_potrs_strided_batched(Arguments argus)
+{
+    int               N            = argus.N;
+    int               lda          = argus.lda;
+    int               ldb          = argus.ldb;
+    int               batch_count  = argus.batch_count;
+    double            stride_scale = argus.stride_scale;
+    char              char_u       = argus.uplo_option;
+    hipblasFillMode_t uplo         = char2hipblas_fill(char_u);
+
+    int strideA = lda * N * stride_scale;
+    int strideB = ldb * 1 * stride_scale;
+    int A_size  = strideA * batch_count;
+    int B_size  = strideB * batch_count;
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+
+    // Check to prevent memory allocation error
+    if(N < 0 || lda < N || ldb < N || batch_count < 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    if(batch_count == 0)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA(A_size);
+    host_vector<T> hX(B_size);
+    host_vector<T> hB(B_size);
+    host_vector<T> hB1(B_size);
+    int            info;
+
+    device_vector<T> dA(A_size);
+    device_vector<T> dB(B_size);
+
+    hipblasHandle_t handle;
+    hipblas_client_create(&handle);
+
+    // Initial hA, hB, hX on CPU; hA is symmetric and diagonally dominant, so positive definite
+    srand(1);
+    hipblas_init_symmetric<T>(hA, N, lda, strideA, batch_count);
+    hipblas_init<T>(hX, N, 1, ldb, strideB, batch_count);
+    hipblasOperation_t op = HIPBLAS_OP_N;
+    for(int b = 0; b < batch_count; b++)
+    {
+        T* hAb = hA.data() + b * strideA;
+        T* hXb = hX.data() + b * strideB;
+        T* hBb = hB.data() + b * strideB;
+
+        for(int i = 0; i < N; i++)
+            hAb[i + i * lda] += T(10 * N);
+
+        // Calculate hB = hA*hX;
+        cblas_gemm<T>(op, op, N, 1, N, 1, hAb, lda, hXb, ldb, 0, hBb, ldb);
+
+        // Cholesky factorize hA on the CPU
+        info = cblas_potrf<T>(char_u, N, hAb, lda);
+        if(info != 0)
+        {
+            cerr << "Cholesky decomposition failed" << endl;
+            return HIPBLAS_STATUS_SUCCESS;
+        }
+    }
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), A_size * sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB.data(), B_size * sizeof(T), hipMemcpyHostToDevice));
+
+    /* =====================================================================
+           HIPBLAS
+    =================================================================== */
+
+    status = hipblasPotrsStridedBatched<T>(
+        handle, uplo, N, 1, dA, lda, strideA, dB, ldb, strideB, &info, batch_count);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    // copy output from device to CPU
+    CHECK_HIP_ERROR(hipMemcpy(hB1.data(), dB, B_size * sizeof(T), hipMemcpyDeviceToHost));
+
+    if(argus.unit_check)
+    {
+        /* =====================================================================
+           CPU LAPACK
+        =================================================================== */
+
+        for(int b = 0; b < batch_count; b++)
+        {
+            cblas_potrs<T>(
+                char_u, N, 1, hA.data() + b * strideA, lda, hB.data() + b * strideB, ldb);
+
+            real_t<T> eps       = std::numeric_limits<real_t<T>>::epsilon();
+            double    tolerance = N * eps * 100;
+
+            double e = norm_check_general<T>(
+                'M', N, 1, ldb, hB.data() + b * strideB, hB1.data() + b * strideB);
+            unit_check_error(e, tolerance);
+        }
+    }
+
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
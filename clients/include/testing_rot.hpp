@@ -40,7 +40,7 @@ hipblasStatus_t testing_rot(Arguments arg)
     }
 
     hipblasHandle_t handle;
-    hipblasCreate(&handle);
+    hipblas_client_create(&handle);
 
     size_t size_x = N * size_t(incx);
     size_t size_y = N * size_t(incy);
@@ -115,7 +115,7 @@ hipblasStatus_t testing_rot(Arguments arg)
     if((status_1 != HIPBLAS_STATUS_SUCCESS) || (status_2 != HIPBLAS_STATUS_SUCCESS)
        || (status_3 != HIPBLAS_STATUS_SUCCESS) || (status_4 != HIPBLAS_STATUS_SUCCESS))
     {
-        hipblasDestroy(handle);
+        hipblas_client_destroy(handle);
         if(status_1 != HIPBLAS_STATUS_SUCCESS)
             return status_1;
         if(status_2 != HIPBLAS_STATUS_SUCCESS)
@@ -125,6 +125,6 @@ hipblasStatus_t testing_rot(Arguments arg)
         if(status_4 != HIPBLAS_STATUS_SUCCESS)
             return status_4;
     }
-    hipblasDestroy(handle);
+    hipblas_client_destroy(handle);
     return HIPBLAS_STATUS_SUCCESS;
 }
@@ -44,7 +44,7 @@ hipblasStatus_t testing_rot_batched(Arguments arg)
     }
 
     hipblasHandle_t handle;
-    hipblasCreate(&handle);
+    hipblas_client_create(&handle);
 
     size_t size_x = N * size_t(incx);
     size_t size_y = N * size_t(incy);
@@ -95,10 +95,9 @@ hipblasStatus_t testing_rot_batched(Arguments arg)
     // cblas_rotg<T, U>(cx, cy, hc, hs);
     // cx[0] = hx[0];
     // cy[0] = hy[0];
-    for(int b = 0; b < batch_count; b++)
-    {
+    hipblas_batch_for(batch_count, [&](int b) {
         cblas_rot<T, U, V>(N, cx[b].data(), incx, cy[b].data(), incy, *hc, *hs);
-    }
+    });
 
     if(arg.unit_check)
     {
@@ -118,7 +117,7 @@ hipblasStatus_t testing_rot_batched(Arguments arg)
 
             if((status_1 != HIPBLAS_STATUS_SUCCESS) || (status_2 != HIPBLAS_STATUS_SUCCESS))
             {
-                hipblasDestroy(handle);
+                hipblas_client_destroy(handle);
                 if(status_1 != HIPBLAS_STATUS_SUCCESS)
                     return status_1;
                 if(status_2 != HIPBLAS_STATUS_SUCCESS)
@@ -161,7 +160,7 @@ hipblasStatus_t testing_rot_batched(Arguments arg)
 
             if((status_3 != HIPBLAS_STATUS_SUCCESS) || (status_4 != HIPBLAS_STATUS_SUCCESS))
             {
-                hipblasDestroy(handle);
+                hipblas_client_destroy(handle);
                 if(status_3 != HIPBLAS_STATUS_SUCCESS)
                     return status_3;
                 if(status_4 != HIPBLAS_STATUS_SUCCESS)
@@ -186,6 +185,6 @@ hipblasStatus_t testing_rot_batched(Arguments arg)
         }
     }
 
-    hipblasDestroy(handle);
+    hipblas_client_destroy(handle);
     return HIPBLAS_STATUS_SUCCESS;
 }
@@ -48,7 +48,7 @@ hipblasStatus_t testing_rot_strided_batched(Arguments arg)
     }
 
     hipblasHandle_t handle;
-    hipblasCreate(&handle);
+    hipblas_client_create(&handle);
 
     size_t size_x = N * size_t(incx) + size_t(stride_x) * size_t(batch_count - 1);
     size_t size_y = N * size_t(incy) + size_t(stride_y) * size_t(batch_count - 1);
@@ -81,11 +81,10 @@ hipblasStatus_t testing_rot_strided_batched(Arguments arg)
     // cblas_rotg<T, U>(cx, cy, hc, hs);
     // cx[0] = hx[0];
     // cy[0] = hy[0];
-    for(int b = 0; b < batch_count; b++)
-    {
+    hipblas_batch_for(batch_count, [&](int b) {
         cblas_rot<T, U, V>(
             N, cx.data() + b * stride_x, incx, cy.data() + b * stride_y, incy, *hc, *hs);
-    }
+    });
 
     if(arg.unit_check)
     {
@@ -99,7 +98,7 @@ hipblasStatus_t testing_rot_strided_batched(Arguments arg)
 
             if((status_1 != HIPBLAS_STATUS_SUCCESS) || (status_2 != HIPBLAS_STATUS_SUCCESS))
             {
-                hipblasDestroy(handle);
+                hipblas_client_destroy(handle);
                 if(status_1 != HIPBLAS_STATUS_SUCCESS)
                     return status_1;
                 if(status_2 != HIPBLAS_STATUS_SUCCESS)
@@ -128,7 +127,7 @@ hipblasStatus_t testing_rot_strided_batched(Arguments arg)
 
             if((status_3 != HIPBLAS_STATUS_SUCCESS) || (status_4 != HIPBLAS_STATUS_SUCCESS))
             {
-                hipblasDestroy(handle);
+                hipblas_client_destroy(handle);
                 if(status_3 != HIPBLAS_STATUS_SUCCESS)
                     return status_3;
                 if(status_4 != HIPBLAS_STATUS_SUCCESS)
@@ -146,6 +145,6 @@ hipblasStatus_t testing_rot_strided_batched(Arguments arg)
             }
         }
     }
-    hipblasDestroy(handle);
+    hipblas_client_destroy(handle);
     return HIPBLAS_STATUS_SUCCESS;
 }
@@ -0,0 +1,129 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+#include "cblas_interface.h"
+#include "hipblas.hpp"
+#include "near.h"
+#include "norm.h"
+#include "unit.h"
+#include "utility.h"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+// x and y are stored as Tx, c and s as Tcs; the arithmetic is in Tx
+template <typename Tx, typename Tcs = Tx>
+hipblasStatus_t testing_rot_strided_batched_ex(Arguments argus)
+{
+    int    N            = argus.N;
+    int    incx         = argus.incx;
+    int    incy         = argus.incy;
+    double stride_scale = argus.stride_scale;
+    int    batch_count  = argus.batch_count;
+
+    hipblasDatatype_t x_type  = hipblas_datatype<Tx>;
+    hipblasDatatype_t cs_type = hipblas_datatype<Tcs>;
+
+    const Tcs rel_error = std::numeric_limits<Tcs>::epsilon() * 1000;
+
+    // check to prevent undefined memory allocation error
+    if(N < 0 || incx < 0 || incy < 0 || batch_count < 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    if(batch_count == 0)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+
+    int stridex = N * incx * stride_scale;
+    int stridey = N * incy * stride_scale;
+    int sizeX   = stridex * batch_count;
+    int sizeY   = stridey * batch_count;
+
+    // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory, plz follow this practice
+    host_vector<Tx> hx(sizeX);
+    host_vector<Tx> hy(sizeY);
+
+    device_vector<Tx> dx(sizeX);
+    device_vector<Tx> dy(sizeY);
+
+    hipblasHandle_t handle;
+    hipblas_client_create(&handle);
+
+    // Initial Data on CPU
+    srand(1);
+    hipblas_init<Tx>(hx, 1, N, incx, stridex, batch_count);
+    hipblas_init<Tx>(hy, 1, N, incy, stridey, batch_count);
+
+    // Random alpha (0 - 10); c and s are its cos and sin (in rads)
+    host_vector<int> alpha(1);
+    hipblas_init<int>(alpha, 1, 1, 1);
+    Tcs c = cos(alpha[0]);
+    Tcs s = sin(alpha[0]);
+
+    // CPU BLAS reference data
+    host_vector<Tx> cx = hx;
+    host_vector<Tx> cy = hy;
+
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(Tx) * sizeX, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy, hy.data(), sizeof(Tx) * sizeY, hipMemcpyHostToDevice));
+
+    /* =====================================================================
+         ROCBLAS
+    =================================================================== */
+    status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasRotStridedBatchedEx(handle,
+                                            N,
+                                            dx,
+                                            x_type,
+                                            incx,
+                                            stridex,
+                                            dy,
+                                            x_type,
+                                            incy,
+                                            stridey,
+                                            &c,
+                                            &s,
+                                            cs_type,
+                                            batch_count,
+                                            x_type);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    // copy output from device to CPU
+    CHECK_HIP_ERROR(hipMemcpy(hx.data(), dx, sizeof(Tx) * sizeX, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hy.data(), dy, sizeof(Tx) * sizeY, hipMemcpyDeviceToHost));
+
+    if(argus.unit_check)
+    {
+        /* =====================================================================
+                    CPU BLAS
+        =================================================================== */
+        hipblas_batch_for(batch_count, [&](int b) {
+            cblas_rot<Tx, Tcs, Tcs>(
+                N, cx.data() + b * stridex, incx, cy.data() + b * stridey, incy, c, s);
+        });
+
+        near_check_general(
+            1, N, batch_count, incx, stridex, cx.data(), hx.data(), double(rel_error));
+        near_check_general(
+            1, N, batch_count, incy, stridey, cy.data(), hy.data(), double(rel_error));
+    }
+
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
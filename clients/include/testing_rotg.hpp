@@ -27,7 +27,7 @@ hipblasStatus_t testing_rotg(Arguments arg)
     hipblasStatus_t status_4 = HIPBLAS_STATUS_SUCCESS;
 
     hipblasHandle_t handle;
-    hipblasCreate(&handle);
+    hipblas_client_create(&handle);
 
     const U rel_error = std::numeric_limits<U>::epsilon() * 1000;
 
@@ -100,7 +100,7 @@ hipblasStatus_t testing_rotg(Arguments arg)
     if((status_1 != HIPBLAS_STATUS_SUCCESS) || (status_2 != HIPBLAS_STATUS_SUCCESS)
        || (status_3 != HIPBLAS_STATUS_SUCCESS) || (status_4 != HIPBLAS_STATUS_SUCCESS))
     {
-        hipblasDestroy(handle);
+        hipblas_client_destroy(handle);
         if(status_1 != HIPBLAS_STATUS_SUCCESS)
             return status_1;
         if(status_2 != HIPBLAS_STATUS_SUCCESS)
@@ -110,6 +110,6 @@ hipblasStatus_t testing_rotg(Arguments arg)
         if(status_4 != HIPBLAS_STATUS_SUCCESS)
             return status_4;
     }
-    hipblasDestroy(handle);
+    hipblas_client_destroy(handle);
     return HIPBLAS_STATUS_SUCCESS;
 }
@@ -40,7 +40,7 @@ hipblasStatus_t testing_rotg_batched(Arguments arg)
     }
 
     hipblasHandle_t handle;
-    hipblasCreate(&handle);
+    hipblas_client_create(&handle);
 
     // Initial Data on CPU
     host_vector<T> ha[batch_count];
@@ -77,10 +77,9 @@ hipblasStatus_t testing_rotg_batched(Arguments arg)
         cs[b] = hs[b];
     }
 
-    for(int b = 0; b < batch_count; b++)
-    {
+    hipblas_batch_for(batch_count, [&](int b) {
         cblas_rotg<T, U>(ca[b], cb[b], cc[b], cs[b]);
-    }
+    });
 
     // Test host
     {
@@ -106,7 +105,7 @@ hipblasStatus_t testing_rotg_batched(Arguments arg)
 
         if((status_1 != HIPBLAS_STATUS_SUCCESS) || (status_2 != HIPBLAS_STATUS_SUCCESS))
         {
-            hipblasDestroy(handle);
+            hipblas_client_destroy(handle);
             if(status_1 != HIPBLAS_STATUS_SUCCESS)
                 return status_1;
             if(status_2 != HIPBLAS_STATUS_SUCCESS)
@@ -149,7 +148,7 @@ hipblasStatus_t testing_rotg_batched(Arguments arg)
 
         if((status_3 != HIPBLAS_STATUS_SUCCESS) || (status_4 != HIPBLAS_STATUS_SUCCESS))
         {
-            hipblasDestroy(handle);
+            hipblas_client_destroy(handle);
             if(status_3 != HIPBLAS_STATUS_SUCCESS)
                 return status_3;
             if(status_4 != HIPBLAS_STATUS_SUCCESS)
@@ -180,6 +179,6 @@ hipblasStatus_t testing_rotg_batched(Arguments arg)
             near_check_general<T>(1, 1, batch_count, 1, rs, cs, rel_error);
         }
     }
-    hipblasDestroy(handle);
+    hipblas_client_destroy(handle);
     return HIPBLAS_STATUS_SUCCESS;
 }
@@ -46,7 +46,7 @@ hipblasStatus_t testing_rotg_strided_batched(Arguments arg)
     }
 
     hipblasHandle_t handle;
-    hipblasCreate(&handle);
+    hipblas_client_create(&handle);
 
     size_t size_a = size_t(stride_a) * size_t(batch_count);
     size_t size_b = size_t(stride_b) * size_t(batch_count);
@@ -71,13 +71,12 @@ hipblasStatus_t testing_rotg_strided_batched(Arguments arg)
     host_vector<U> cc = hc;
     host_vector<T> cs = hs;
 
-    for(int b = 0; b < batch_count; b++)
-    {
+    hipblas_batch_for(batch_count, [&](int b) {
         cblas_rotg<T, U>(ca.data() + b * stride_a,
                          cb.data() + b * stride_b,
                          cc.data() + b * stride_c,
                          cs.data() + b * stride_s);
-    }
+    });
 
     // Test host
     {
@@ -91,7 +90,7 @@ hipblasStatus_t testing_rotg_strided_batched(Arguments arg)
 
         if((status_1 != HIPBLAS_STATUS_SUCCESS) || (status_2 != HIPBLAS_STATUS_SUCCESS))
         {
-            hipblasDestroy(handle);
+            hipblas_client_destroy(handle);
             if(status_1 != HIPBLAS_STATUS_SUCCESS)
                 return status_1;
             if(status_2 != HIPBLAS_STATUS_SUCCESS)
@@ -123,7 +122,7 @@ hipblasStatus_t testing_rotg_strided_batched(Arguments arg)
 
         if((status_3 != HIPBLAS_STATUS_SUCCESS) || (status_4 != HIPBLAS_STATUS_SUCCESS))
         {
-            hipblasDestroy(handle);
+            hipblas_client_destroy(handle);
             if(status_3 != HIPBLAS_STATUS_SUCCESS)
                 return status_3;
             if(status_4 != HIPBLAS_STATUS_SUCCESS)
@@ -147,6 +146,6 @@ hipblasStatus_t testing_rotg_strided_batched(Arguments arg)
             near_check_general<T>(1, 1, batch_count, 1, stride_s, cs, rs, rel_error);
         }
     }
-    hipblasDestroy(handle);
+    hipblas_client_destroy(handle);
     return HIPBLAS_STATUS_SUCCESS;
 }
@@ -38,7 +38,7 @@ hipblasStatus_t testing_rotm_batched(Arguments arg)
     }
 
     hipblasHandle_t handle;
-    hipblasCreate(&handle);
+    hipblas_client_create(&handle);
 
     size_t size_x = N * size_t(incx);
     size_t size_y = N * size_t(incy);
@@ -119,7 +119,7 @@ hipblasStatus_t testing_rotm_batched(Arguments arg)
 
                 if((status_1 != HIPBLAS_STATUS_SUCCESS) || (status_2 != HIPBLAS_STATUS_SUCCESS))
                 {
-                    hipblasDestroy(handle);
+                    hipblas_client_destroy(handle);
                     if(status_1 != HIPBLAS_STATUS_SUCCESS)
                         return status_1;
                     if(status_2 != HIPBLAS_STATUS_SUCCESS)
@@ -146,6 +146,6 @@ hipblasStatus_t testing_rotm_batched(Arguments arg)
             }
         }
     }
-    hipblasDestroy(handle);
+    hipblas_client_destroy(handle);
     return HIPBLAS_STATUS_SUCCESS;
 }
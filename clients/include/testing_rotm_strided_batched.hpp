@@ -43,7 +43,7 @@ hipblasStatus_t testing_rotm_strided_batched(Arguments arg)
     }
 
     hipblasHandle_t handle;
-    hipblasCreate(&handle);
+    hipblas_client_create(&handle);
 
     size_t size_x     = N * size_t(incx) + size_t(stride_x) * size_t(batch_count - 1);
     size_t size_y     = N * size_t(incy) + size_t(stride_y) * size_t(batch_count - 1);
@@ -82,11 +82,10 @@ hipblasStatus_t testing_rotm_strided_batched(Arguments arg)
         host_vector<T> cx = hx;
         host_vector<T> cy = hy;
 
-        for(int b = 0; b < batch_count; b++)
-        {
+        hipblas_batch_for(batch_count, [&](int b) {
             cblas_rotm<T>(
                 N, cx + b * stride_x, incx, cy + b * stride_y, incy, hparam + b * stride_param);
-        }
+        });
 
         if(arg.unit_check || arg.norm_check)
         {
@@ -111,7 +110,7 @@ hipblasStatus_t testing_rotm_strided_batched(Arguments arg)
 
                 if((status_1 != HIPBLAS_STATUS_SUCCESS) || (status_2 != HIPBLAS_STATUS_SUCCESS))
                 {
-                    hipblasDestroy(handle);
+                    hipblas_client_destroy(handle);
                     if(status_1 != HIPBLAS_STATUS_SUCCESS)
                         return status_1;
                     if(status_2 != HIPBLAS_STATUS_SUCCESS)
@@ -130,6 +129,6 @@ hipblasStatus_t testing_rotm_strided_batched(Arguments arg)
             }
         }
     }
-    hipblasDestroy(handle);
+    hipblas_client_destroy(handle);
     return HIPBLAS_STATUS_SUCCESS;
 }
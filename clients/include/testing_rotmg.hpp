@@ -22,7 +22,7 @@ template <typename T>
 hipblasStatus_t testing_rotmg(Arguments arg)
 {
     hipblasHandle_t handle;
-    hipblasCreate(&handle);
+    hipblas_client_create(&handle);
     host_vector<T> params(9);
 
     hipblasStatus_t status_1 = HIPBLAS_STATUS_SUCCESS;
@@ -68,7 +68,7 @@ hipblasStatus_t testing_rotmg(Arguments arg)
     if((status_1 != HIPBLAS_STATUS_SUCCESS) || (status_2 != HIPBLAS_STATUS_SUCCESS)
        || (status_3 != HIPBLAS_STATUS_SUCCESS) || (status_4 != HIPBLAS_STATUS_SUCCESS))
     {
-        hipblasDestroy(handle);
+        hipblas_client_destroy(handle);
         if(status_1 != HIPBLAS_STATUS_SUCCESS)
             return status_1;
         if(status_2 != HIPBLAS_STATUS_SUCCESS)
@@ -78,6 +78,6 @@ hipblasStatus_t testing_rotmg(Arguments arg)
         if(status_4 != HIPBLAS_STATUS_SUCCESS)
             return status_4;
     }
-    hipblasDestroy(handle);
+    hipblas_client_destroy(handle);
     return HIPBLAS_STATUS_SUCCESS;
 }
@@ -41,7 +41,7 @@ hipblasStatus_t testing_rotmg_batched(Arguments arg)
     }
 
     hipblasHandle_t handle;
-    hipblasCreate(&handle);
+    hipblas_client_create(&handle);
 
     // Initial Data on CPU
     host_vector<T> hd1[batch_count];
@@ -86,10 +86,9 @@ hipblasStatus_t testing_rotmg_batched(Arguments arg)
         cparams[b] = hparams[b];
     }
 
-    for(int b = 0; b < batch_count; b++)
-    {
+    hipblas_batch_for(batch_count, [&](int b) {
         cblas_rotmg<T>(cd1[b], cd2[b], cx1[b], cy1[b], cparams[b]);
-    }
+    });
 
     // Test host
     {
@@ -119,7 +118,7 @@ hipblasStatus_t testing_rotmg_batched(Arguments arg)
 
         if((status_1 != HIPBLAS_STATUS_SUCCESS) || (status_2 != HIPBLAS_STATUS_SUCCESS))
         {
-            hipblasDestroy(handle);
+            hipblas_client_destroy(handle);
             if(status_1 != HIPBLAS_STATUS_SUCCESS)
                 return status_1;
             if(status_2 != HIPBLAS_STATUS_SUCCESS)
@@ -170,7 +169,7 @@ hipblasStatus_t testing_rotmg_batched(Arguments arg)
 
         if((status_3 != HIPBLAS_STATUS_SUCCESS) || (status_4 != HIPBLAS_STATUS_SUCCESS))
         {
-            hipblasDestroy(handle);
+            hipblas_client_destroy(handle);
             if(status_3 != HIPBLAS_STATUS_SUCCESS)
                 return status_3;
             if(status_4 != HIPBLAS_STATUS_SUCCESS)
@@ -206,6 +205,6 @@ hipblasStatus_t testing_rotmg_batched(Arguments arg)
             near_check_general<T>(1, 5, batch_count, 1, rparams, cparams, rel_error);
         }
     }
-    hipblasDestroy(handle);
+    hipblas_client_destroy(handle);
     return HIPBLAS_STATUS_SUCCESS;
 }
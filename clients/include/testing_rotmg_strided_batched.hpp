@@ -47,7 +47,7 @@ hipblasStatus_t testing_rotmg_strided_batched(Arguments arg)
     }
 
     hipblasHandle_t handle;
-    hipblasCreate(&handle);
+    hipblas_client_create(&handle);
 
     size_t size_d1    = batch_count * stride_d1;
     size_t size_d2    = batch_count * stride_d2;
@@ -75,14 +75,13 @@ hipblasStatus_t testing_rotmg_strided_batched(Arguments arg)
     host_vector<T> cx1     = hx1;
     host_vector<T> cy1     = hy1;
 
-    for(int b = 0; b < batch_count; b++)
-    {
+    hipblas_batch_for(batch_count, [&](int b) {
         cblas_rotmg<T>(cd1 + b * stride_d1,
                        cd2 + b * stride_d2,
                        cx1 + b * stride_x1,
                        cy1 + b * stride_y1,
                        cparams + b * stride_param);
-    }
+    });
 
     // Test host
     {
@@ -109,7 +108,7 @@ hipblasStatus_t testing_rotmg_strided_batched(Arguments arg)
 
         if((status_1 != HIPBLAS_STATUS_SUCCESS) || (status_2 != HIPBLAS_STATUS_SUCCESS))
         {
-            hipblasDestroy(handle);
+            hipblas_client_destroy(handle);
             if(status_1 != HIPBLAS_STATUS_SUCCESS)
                 return status_1;
             if(status_2 != HIPBLAS_STATUS_SUCCESS)
@@ -156,7 +155,7 @@ hipblasStatus_t testing_rotmg_strided_batched(Arguments arg)
 
         if((status_3 != HIPBLAS_STATUS_SUCCESS) || (status_4 != HIPBLAS_STATUS_SUCCESS))
         {
-            hipblasDestroy(handle);
+            hipblas_client_destroy(handle);
             if(status_3 != HIPBLAS_STATUS_SUCCESS)
                 return status_3;
             if(status_4 != HIPBLAS_STATUS_SUCCESS)
@@ -184,6 +183,6 @@ hipblasStatus_t testing_rotmg_strided_batched(Arguments arg)
             near_check_general<T>(1, 5, batch_count, 1, stride_param, rparams, cparams, rel_error);
         }
     }
-    hipblasDestroy(handle);
+    hipblas_client_destroy(handle);
     return HIPBLAS_STATUS_SUCCESS;
 }
@@ -8,6 +8,7 @@
 #include <vector>
 
 #include "cblas_interface.h"
+#include "flops.h"
 #include "hipblas.hpp"
 #include "norm.h"
 #include "unit.h"
@@ -53,7 +54,7 @@ hipblasStatus_t testing_scal(Arguments argus)
 
     hipblasHandle_t handle;
 
-    hipblasCreate(&handle);
+    hipblas_client_create(&handle);
 
     // allocate memory on device
     CHECK_HIP_ERROR(hipMalloc(&dx, sizeX * sizeof(T)));
@@ -75,7 +76,7 @@ hipblasStatus_t testing_scal(Arguments argus)
     if(status != HIPBLAS_STATUS_SUCCESS)
     {
         CHECK_HIP_ERROR(hipFree(dx));
-        hipblasDestroy(handle);
+        hipblas_client_destroy(handle);
         return status;
     }
 
@@ -99,9 +100,25 @@ hipblasStatus_t testing_scal(Arguments argus)
 
     } // end of if unit check
 
-    //  BLAS_1_RESULT_PRINT
+    if(argus.timing)
+    {
+        hipblas_timing timing;
+        status = hipblas_time_launches(handle, argus, timing, [&] {
+            return hipblasScal<T, U>(handle, N, &alpha, dx, incx);
+        });
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            CHECK_HIP_ERROR(hipFree(dx));
+            hipblas_client_destroy(handle);
+            return status;
+        }
+
+        cout << "N,alpha,incx," HIPBLAS_TIMING_COLUMNS << endl;
+        cout << N << ',' << argus.alpha << ',' << incx << ',';
+        hipblas_print_timing(cout, timing, scal_gflop_count<T, U>(N), scal_gbyte_count<T>(N));
+    }
 
     CHECK_HIP_ERROR(hipFree(dx));
-    hipblasDestroy(handle);
+    hipblas_client_destroy(handle);
     return HIPBLAS_STATUS_SUCCESS;
 }
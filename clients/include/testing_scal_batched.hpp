@@ -44,7 +44,7 @@ hipblasStatus_t testing_scal_batched(Arguments argus)
     double rocblas_error = 0.0;
 
     hipblasHandle_t handle;
-    hipblasCreate(&handle);
+    hipblas_client_create(&handle);
 
     // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory, plz follow this practice
     host_vector<T> hx_array[batch_count];
@@ -59,7 +59,7 @@ hipblasStatus_t testing_scal_batched(Arguments argus)
     int last = batch_count - 1;
     if(!dx_array || !dz_array || (!bx_array[last] && sizeX) || (!bz_array[last] && sizeX))
     {
-        hipblasDestroy(handle);
+        hipblas_client_destroy(handle);
         return HIPBLAS_STATUS_ALLOC_FAILED;
     }
 
@@ -85,7 +85,7 @@ hipblasStatus_t testing_scal_batched(Arguments argus)
     status = hipblasScalBatched<T, U>(handle, N, &alpha, dx_array, incx, batch_count);
     if(status != HIPBLAS_STATUS_SUCCESS)
     {
-        hipblasDestroy(handle);
+        hipblas_client_destroy(handle);
         return status;
     }
 
@@ -101,10 +101,9 @@ hipblasStatus_t testing_scal_batched(Arguments argus)
         /* =====================================================================
                     CPU BLAS
         =================================================================== */
-        for(int b = 0; b < batch_count; b++)
-        {
+        hipblas_batch_for(batch_count, [&](int b) {
             cblas_scal<T, U>(N, alpha, hz_array[b], incx);
-        }
+        });
 
         // enable unit check, notice unit check is not invasive, but norm check is,
         // unit check and norm check can not be interchanged their order
@@ -117,6 +116,6 @@ hipblasStatus_t testing_scal_batched(Arguments argus)
 
     //  BLAS_1_RESULT_PRINT
 
-    hipblasDestroy(handle);
+    hipblas_client_destroy(handle);
     return HIPBLAS_STATUS_SUCCESS;
 }
@@ -51,7 +51,7 @@ hipblasStatus_t testing_scal_strided_batched(Arguments argus)
     double rocblas_error = 0.0;
 
     hipblasHandle_t handle;
-    hipblasCreate(&handle);
+    hipblas_client_create(&handle);
 
     // Initial Data on CPU
     srand(1);
@@ -69,7 +69,7 @@ hipblasStatus_t testing_scal_strided_batched(Arguments argus)
     status = hipblasScalStridedBatched<T, U>(handle, N, &alpha, dx, incx, stridex, batch_count);
     if(status != HIPBLAS_STATUS_SUCCESS)
     {
-        hipblasDestroy(handle);
+        hipblas_client_destroy(handle);
         return status;
     }
 
@@ -82,10 +82,9 @@ hipblasStatus_t testing_scal_strided_batched(Arguments argus)
         /* =====================================================================
                     CPU BLAS
         =================================================================== */
-        for(int b = 0; b < batch_count; b++)
-        {
+        hipblas_batch_for(batch_count, [&](int b) {
             cblas_scal<T, U>(N, alpha, hz.data() + b * stridex, incx);
-        }
+        });
 
         // enable unit check, notice unit check is not invasive, but norm check is,
         // unit check and norm check can not be interchanged their order
@@ -98,6 +97,6 @@ hipblasStatus_t testing_scal_strided_batched(Arguments argus)
 
     //  BLAS_1_RESULT_PRINT
 
-    hipblasDestroy(handle);
+    hipblas_client_destroy(handle);
     return HIPBLAS_STATUS_SUCCESS;
 }
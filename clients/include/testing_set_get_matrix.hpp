@@ -74,7 +74,7 @@ hipblasStatus_t testing_set_get_matrix(Arguments argus)
 
     hipblasHandle_t handle;
 
-    hipblasCreate(&handle);
+    hipblas_client_create(&handle);
 
     // allocate memory on device
     CHECK_HIP_ERROR(hipMalloc(&dc, cols * ldc * sizeof(T)));
@@ -103,7 +103,7 @@ hipblasStatus_t testing_set_get_matrix(Arguments argus)
     if(status_set != HIPBLAS_STATUS_SUCCESS || status_get != HIPBLAS_STATUS_SUCCESS)
     {
         CHECK_HIP_ERROR(hipFree(dc));
-        hipblasDestroy(handle);
+        hipblas_client_destroy(handle);
         return status;
     }
 
@@ -131,6 +131,6 @@ hipblasStatus_t testing_set_get_matrix(Arguments argus)
     }
 
     CHECK_HIP_ERROR(hipFree(dc));
-    hipblasDestroy(handle);
+    hipblas_client_destroy(handle);
     return HIPBLAS_STATUS_SUCCESS;
 }
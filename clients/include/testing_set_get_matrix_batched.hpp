@@ -0,0 +1,150 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "cblas_interface.h"
+#include "flops.h"
+#include "hipblas.hpp"
+#include "norm.h"
+#include "unit.h"
+#include "utility.h"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+// Sets batch_count host matrices of leading dimension lda into device ones of ldc, then gets
+// them back into host ones of ldb, through both the batched and the strided batched calls
+template <typename T>
+hipblasStatus_t testing_set_get_matrix_batched(Arguments argus)
+{
+    int rows        = argus.rows;
+    int cols        = argus.cols;
+    int lda         = argus.lda;
+    int ldb         = argus.ldb;
+    int ldc         = argus.ldc;
+    int batch_count = argus.batch_count;
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    if(rows < 0 || cols < 0 || lda <= 0 || ldb <= 0 || ldc <= 0 || batch_count < 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+
+    int stride_a = lda * cols;
+    int stride_b = ldb * cols;
+    int stride_c = ldc * cols;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    vector<T> ha(stride_a * batch_count);
+    vector<T> hb(stride_b * batch_count);
+    vector<T> hb_strided(stride_b * batch_count);
+    vector<T> hb_ref(stride_b * batch_count);
+
+    vector<const void*> ha_array(batch_count);
+    vector<void*>       hb_array(batch_count);
+    vector<void*>       dc_array(batch_count);
+
+    T* dc;
+    T* dc_strided;
+
+    hipblasHandle_t handle;
+    hipblas_client_create(&handle);
+
+    // allocate memory on device
+    CHECK_HIP_ERROR(hipMalloc(&dc, stride_c * batch_count * sizeof(T)));
+    CHECK_HIP_ERROR(hipMalloc(&dc_strided, stride_c * batch_count * sizeof(T)));
+
+    // Initial Data on CPU
+    srand(1);
+    hipblas_init<T>(ha, rows, cols, lda, stride_a, batch_count);
+    hipblas_init<T>(hb, rows, cols, ldb, stride_b, batch_count);
+    hb_strided = hb;
+    hb_ref     = hb;
+
+    // The device matrices are handed out in reverse, so the scatter cannot pass by assuming
+    // the pointers are strided
+    for(int b = 0; b < batch_count; b++)
+    {
+        ha_array[b] = ha.data() + b * stride_a;
+        hb_array[b] = hb.data() + b * stride_b;
+        dc_array[b] = dc + (batch_count - 1 - b) * stride_c;
+    }
+
+    /* =====================================================================
+           ROCBLAS
+    =================================================================== */
+
+    hipblasStatus_t status = hipblasSetMatrixBatched(
+        handle, rows, cols, sizeof(T), ha_array.data(), lda, dc_array.data(), ldc, batch_count);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasGetMatrixBatched(handle,
+                                         rows,
+                                         cols,
+                                         sizeof(T),
+                                         (const void* const*)dc_array.data(),
+                                         ldc,
+                                         hb_array.data(),
+                                         ldb,
+                                         batch_count);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasSetMatrixStridedBatched(handle,
+                                                rows,
+                                                cols,
+                                                sizeof(T),
+                                                ha.data(),
+                                                lda,
+                                                stride_a,
+                                                dc_strided,
+                                                ldc,
+                                                stride_c,
+                                                batch_count);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasGetMatrixStridedBatched(handle,
+                                                rows,
+                                                cols,
+                                                sizeof(T),
+                                                dc_strided,
+                                                ldc,
+                                                stride_c,
+                                                hb_strided.data(),
+                                                ldb,
+                                                stride_b,
+                                                batch_count);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        CHECK_HIP_ERROR(hipFree(dc));
+        CHECK_HIP_ERROR(hipFree(dc_strided));
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    if(argus.unit_check)
+    {
+        /* =====================================================================
+           CPU BLAS
+        =================================================================== */
+
+        // reference calculation
+        for(int b = 0; b < batch_count; b++)
+            for(int i1 = 0; i1 < rows; i1++)
+                for(int i2 = 0; i2 < cols; i2++)
+                    hb_ref[i1 + i2 * ldb + b * stride_b] = ha[i1 + i2 * lda + b * stride_a];
+
+        unit_check_general<T>(rows, cols, batch_count, ldb, stride_b, hb.data(), hb_ref.data());
+        unit_check_general<T>(
+            rows, cols, batch_count, ldb, stride_b, hb_strided.data(), hb_ref.data());
+    }
+
+    CHECK_HIP_ERROR(hipFree(dc));
+    CHECK_HIP_ERROR(hipFree(dc_strided));
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -62,7 +62,7 @@ hipblasStatus_t testing_set_get_vector(Arguments argus)
 
     hipblasHandle_t handle;
 
-    hipblasCreate(&handle);
+    hipblas_client_create(&handle);
 
     // allocate memory on device
     CHECK_HIP_ERROR(hipMalloc(&db, M * incd * sizeof(T)));
@@ -83,14 +83,14 @@ hipblasStatus_t testing_set_get_vector(Arguments argus)
     if(status_set != HIPBLAS_STATUS_SUCCESS)
     {
         CHECK_HIP_ERROR(hipFree(db));
-        hipblasDestroy(handle);
+        hipblas_client_destroy(handle);
         return status;
     }
 
     if(status_get != HIPBLAS_STATUS_SUCCESS)
     {
         CHECK_HIP_ERROR(hipFree(db));
-        hipblasDestroy(handle);
+        hipblas_client_destroy(handle);
         return status;
     }
 
@@ -115,6 +115,6 @@ hipblasStatus_t testing_set_get_vector(Arguments argus)
     }
 
     CHECK_HIP_ERROR(hipFree(db));
-    hipblasDestroy(handle);
+    hipblas_client_destroy(handle);
     return HIPBLAS_STATUS_SUCCESS;
 }
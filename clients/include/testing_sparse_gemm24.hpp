@@ -0,0 +1,207 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <math.h>
+#include <stdlib.h>
+#include <vector>
+
+#include "flops.h"
+#include "hipblas.hpp"
+#include "unit.h"
+#include "utility.h"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+// prune24 of op(A), then compress24 of op(A) and gemm24 of the compressed A, then compress24 of
+// the pruned matrix and gemm24 with beta 0. Small integers keep the products exact, so all three
+// are compared exactly with the host; repeated magnitudes within a group exercise the tie rule
+template <typename T, typename Tc = T>
+hipblasStatus_t testing_sparse_gemm24(Arguments argus)
+{
+    int M   = argus.M;
+    int N   = argus.N;
+    int K   = argus.K;
+    int lda = argus.lda;
+    int ldb = argus.ldb;
+    int ldc = argus.ldc;
+
+    hipblasOperation_t transA = char2hipblas_operation(argus.transA_option);
+    hipblasOperation_t transB = char2hipblas_operation(argus.transB_option);
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    if(M < 0 || N < 0 || K < 0 || K % 4 || lda < max(1, transA == HIPBLAS_OP_N ? M : K)
+       || ldb < max(1, transB == HIPBLAS_OP_N ? K : N) || ldc < max(1, M))
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    if(M == 0 || N == 0 || K == 0)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    int A_size = lda * (transA == HIPBLAS_OP_N ? K : M);
+    int B_size = ldb * (transB == HIPBLAS_OP_N ? N : K);
+    int C_size = ldc * N;
+    int P_size = M * K;
+
+    float alpha = argus.alpha;
+    float beta  = argus.beta;
+    float zero  = 0;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T>  hA(A_size);
+    host_vector<T>  hB(B_size);
+    host_vector<Tc> hC(C_size);
+    host_vector<T>  hP(P_size);
+    host_vector<T>  hP_gold(P_size);
+    host_vector<Tc> hC_result(C_size);
+    host_vector<Tc> hC_gold(C_size);
+    host_vector<Tc> hproduct_result(C_size);
+    host_vector<Tc> hproduct_gold(C_size);
+
+    device_vector<T>       dA(A_size);
+    device_vector<T>       dB(B_size);
+    device_vector<Tc>      dC(C_size);
+    device_vector<T>       dP(P_size);
+    device_vector<T>       dvalues(P_size / 2);
+    device_vector<uint8_t> dmetadata(P_size / 4);
+
+    hipblasHandle_t handle;
+    hipblas_client_create(&handle);
+
+    // Initial Data on CPU
+    srand(1);
+    for(int i = 0; i < A_size; i++)
+        hA[i] = hipblas_from_float<T>(float(rand() % 9 - 4));
+    for(int i = 0; i < B_size; i++)
+        hB[i] = hipblas_from_float<T>(float(rand() % 7 - 3));
+    for(int i = 0; i < C_size; i++)
+        hC[i] = hipblas_from_float<Tc>(float(rand() % 5 - 2));
+
+    auto op_a = [&](int i, int l) {
+        return hipblas_to_float(transA == HIPBLAS_OP_N ? hA[i + l * lda] : hA[l + i * lda]);
+    };
+    auto op_b = [&](int l, int j) {
+        return hipblas_to_float(transB == HIPBLAS_OP_N ? hB[l + j * ldb] : hB[j + l * ldb]);
+    };
+
+    // the two largest magnitudes of each group, the lower position first among equals
+    for(int i = 0; i < P_size; i++)
+        hP_gold[i] = hipblas_from_float<T>(0.0f);
+    for(int i = 0; i < M; i++)
+        for(int g = 0; g < K / 4; g++)
+        {
+            int pos[4] = {0, 1, 2, 3};
+            stable_sort(pos, pos + 4, [&](int x, int y) {
+                return fabs(op_a(i, 4 * g + x)) > fabs(op_a(i, 4 * g + y));
+            });
+            for(int r = 0; r < 2; r++)
+                hP_gold[i + (4 * g + pos[r]) * M] = hipblas_from_float<T>(op_a(i, 4 * g + pos[r]));
+        }
+
+    hC_gold       = hC;
+    hproduct_gold = hC;
+    for(int j = 0; j < N; j++)
+        for(int i = 0; i < M; i++)
+        {
+            float sum = 0;
+            for(int l = 0; l < K; l++)
+                sum += hipblas_to_float(hP_gold[i + l * M]) * op_b(l, j);
+            int c            = i + j * ldc;
+            hproduct_gold[c] = hipblas_from_float<Tc>(alpha * sum);
+            hC_gold[c]       = hipblas_from_float<Tc>(alpha * sum + beta * hipblas_to_float(hC[c]));
+        }
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * A_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB.data(), sizeof(T) * B_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC, hC.data(), sizeof(Tc) * C_size, hipMemcpyHostToDevice));
+
+    hipblasSparse24Matrix_t compressed = {dvalues, M, dmetadata, M};
+
+    auto gemm = [&](const float* gemm_beta) {
+        return hipblasSparseGemm24Ex(handle,
+                                     transB,
+                                     M,
+                                     N,
+                                     K,
+                                     &alpha,
+                                     &compressed,
+                                     hipblas_datatype<T>,
+                                     dB,
+                                     ldb,
+                                     gemm_beta,
+                                     dC,
+                                     hipblas_datatype<Tc>,
+                                     ldc,
+                                     HIPBLAS_R_32F);
+    };
+
+    /* =====================================================================
+           HIPBLAS
+    =================================================================== */
+
+    status = hipblasSparsePrune24(handle, transA, M, K, dA, hipblas_datatype<T>, lda, dP, M);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasSparseCompress24(
+            handle, transA, M, K, dA, hipblas_datatype<T>, lda, &compressed);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = gemm(&beta);
+    CHECK_HIP_ERROR(hipMemcpy(hC_result.data(), dC, sizeof(Tc) * C_size, hipMemcpyDeviceToHost));
+
+    // compressing the pruned matrix again gives the same product, now with C unread
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasSparseCompress24(
+            handle, HIPBLAS_OP_N, M, K, dP, hipblas_datatype<T>, M, &compressed);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = gemm(&zero);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    CHECK_HIP_ERROR(hipMemcpy(hP.data(), dP, sizeof(T) * P_size, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(
+        hipMemcpy(hproduct_result.data(), dC, sizeof(Tc) * C_size, hipMemcpyDeviceToHost));
+
+    if(argus.unit_check)
+    {
+        unit_check_general<T>(M, K, M, hP_gold.data(), hP.data());
+        unit_check_general<Tc>(M, N, ldc, hC_gold.data(), hC_result.data());
+        unit_check_general<Tc>(M, N, ldc, hproduct_gold.data(), hproduct_result.data());
+    }
+
+    if(argus.timing)
+    {
+        // the gemm alone, on the compressed A it is given
+        hipblas_timing timing;
+        status = hipblas_time_launches(handle, argus, timing, [&] { return gemm(&beta); });
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            hipblas_client_destroy(handle);
+            return status;
+        }
+
+        double gflop = gemm_gflop_count<float>(M, N, K) / 2;
+        double gbyte = sparse_gemm24_gbyte_count<T, Tc>(M, N, K);
+
+        cout << "transA,transB,M,N,K,lda,ldb,ldc," HIPBLAS_TIMING_COLUMNS << endl;
+        cout << argus.transA_option << ',' << argus.transB_option << ',' << M << ',' << N << ','
+             << K << ',' << lda << ',' << ldb << ',' << ldc << ',';
+        hipblas_print_timing(cout, timing, gflop, gbyte);
+    }
+
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
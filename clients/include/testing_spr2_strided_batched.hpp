@@ -71,7 +71,7 @@ hipblasStatus_t testing_spr2_strided_batched(Arguments argus)
     T alpha = argus.get_alpha<T>();
 
     hipblasHandle_t handle;
-    hipblasCreate(&handle);
+    hipblas_client_create(&handle);
 
     // Initial Data on CPU
     srand(1);
@@ -88,32 +88,24 @@ hipblasStatus_t testing_spr2_strided_batched(Arguments argus)
     /* =====================================================================
            ROCBLAS
     =================================================================== */
-    if(argus.timing)
+    status = hipblasSpr2StridedBatched<T>(handle,
+                                          uplo,
+                                          N,
+                                          (T*)&alpha,
+                                          dx,
+                                          incx,
+                                          stridex,
+                                          dy,
+                                          incy,
+                                          stridey,
+                                          dA,
+                                          strideA,
+                                          batch_count);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
     {
-        gpu_time_used = get_time_us(); // in microseconds
-    }
-
-    for(int iter = 0; iter < 1; iter++)
-    {
-        status = hipblasSpr2StridedBatched<T>(handle,
-                                              uplo,
-                                              N,
-                                              (T*)&alpha,
-                                              dx,
-                                              incx,
-                                              stridex,
-                                              dy,
-                                              incy,
-                                              stridey,
-                                              dA,
-                                              strideA,
-                                              batch_count);
-
-        if(status != HIPBLAS_STATUS_SUCCESS)
-        {
-            hipblasDestroy(handle);
-            return status;
-        }
+        hipblas_client_destroy(handle);
+        return status;
     }
 
     // copy output from device to CPU
@@ -124,8 +116,7 @@ hipblasStatus_t testing_spr2_strided_batched(Arguments argus)
         /* =====================================================================
            CPU BLAS
         =================================================================== */
-        for(int b = 0; b < batch_count; b++)
-        {
+        hipblas_batch_for(batch_count, [&](int b) {
             cblas_spr2<T>(uplo,
                           N,
                           alpha,
@@ -134,7 +125,7 @@ hipblasStatus_t testing_spr2_strided_batched(Arguments argus)
                           hy.data() + b * stridey,
                           incy,
                           hA_cpu.data() + b * strideA);
-        }
+        });
 
         // enable unit check, notice unit check is not invasive, but norm check is,
         // unit check and norm check can not be interchanged their order
@@ -144,6 +135,39 @@ hipblasStatus_t testing_spr2_strided_batched(Arguments argus)
         }
     }
 
-    hipblasDestroy(handle);
+    if(argus.timing)
+    {
+        hipblas_timing timing;
+        status = hipblas_time_launches(handle, argus, timing, [&] {
+            return hipblasSpr2StridedBatched<T>(handle,
+                                                uplo,
+                                                N,
+                                                (T*)&alpha,
+                                                dx,
+                                                incx,
+                                                stridex,
+                                                dy,
+                                                incy,
+                                                stridey,
+                                                dA,
+                                                strideA,
+                                                batch_count);
+        });
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            hipblas_client_destroy(handle);
+            return status;
+        }
+
+        double gflop = syr2_gflop_count<T>(N) * batch_count;
+        double gbyte = syr2_gbyte_count<T>(N) * batch_count;
+
+        cout << "N,incx,incy,uplo,stride_scale,batch_count," HIPBLAS_TIMING_COLUMNS << endl;
+        cout << N << ',' << incx << ',' << incy << ',' << char_uplo << ',' << stride_scale << ','
+             << batch_count << ',';
+        hipblas_print_timing(cout, timing, gflop, gbyte);
+    }
+
+    hipblas_client_destroy(handle);
     return HIPBLAS_STATUS_SUCCESS;
 }
@@ -48,7 +48,7 @@ hipblasStatus_t testing_swap_batched(Arguments argus)
     double rocblas_error;
 
     hipblasHandle_t handle;
-    hipblasCreate(&handle);
+    hipblas_client_create(&handle);
 
     // Naming: dX is in GPU (device) memory. hK is in CPU (host) memory, plz follow this practice
     host_vector<T> hx_array[batch_count];
@@ -65,7 +65,7 @@ hipblasStatus_t testing_swap_batched(Arguments argus)
     int last = batch_count - 1;
     if(!dx_array || !dy_array || (!bx_array[last] && sizeX) || (!by_array[last] && sizeY))
     {
-        hipblasDestroy(handle);
+        hipblas_client_destroy(handle);
         return HIPBLAS_STATUS_ALLOC_FAILED;
     }
 
@@ -100,7 +100,7 @@ hipblasStatus_t testing_swap_batched(Arguments argus)
 
     if((status != HIPBLAS_STATUS_SUCCESS))
     {
-        hipblasDestroy(handle);
+        hipblas_client_destroy(handle);
         return status;
     }
 
@@ -118,10 +118,9 @@ hipblasStatus_t testing_swap_batched(Arguments argus)
         /* =====================================================================
                     CPU BLAS
         =================================================================== */
-        for(int b = 0; b < batch_count; b++)
-        {
+        hipblas_batch_for(batch_count, [&](int b) {
             cblas_swap<T>(N, hx_cpu_array[b], incx, hy_cpu_array[b], incy);
-        }
+        });
 
         if(argus.unit_check)
         {
@@ -133,6 +132,6 @@ hipblasStatus_t testing_swap_batched(Arguments argus)
 
     //  BLAS_1_RESULT_PRINT
 
-    hipblasDestroy(handle);
+    hipblas_client_destroy(handle);
     return HIPBLAS_STATUS_SUCCESS;
 }
@@ -56,7 +56,7 @@ hipblasStatus_t testing_swap_strided_batched(Arguments argus)
     double rocblas_error;
 
     hipblasHandle_t handle;
-    hipblasCreate(&handle);
+    hipblas_client_create(&handle);
 
     // Initial Data on CPU
     srand(1);
@@ -77,7 +77,7 @@ hipblasStatus_t testing_swap_strided_batched(Arguments argus)
 
     if((status != HIPBLAS_STATUS_SUCCESS))
     {
-        hipblasDestroy(handle);
+        hipblas_client_destroy(handle);
         return status;
     }
 
@@ -90,10 +90,9 @@ hipblasStatus_t testing_swap_strided_batched(Arguments argus)
         /* =====================================================================
                     CPU BLAS
         =================================================================== */
-        for(int b = 0; b < batch_count; b++)
-        {
+        hipblas_batch_for(batch_count, [&](int b) {
             cblas_swap<T>(N, hx.data() + b * stridex, incx, hy.data() + b * stridey, incy);
-        }
+        });
 
         if(argus.unit_check)
         {
@@ -105,6 +104,6 @@ hipblasStatus_t testing_swap_strided_batched(Arguments argus)
 
     //  BLAS_1_RESULT_PRINT
 
-    hipblasDestroy(handle);
+    hipblas_client_destroy(handle);
     return HIPBLAS_STATUS_SUCCESS;
 }
@@ -0,0 +1,145 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "cblas_interface.h"
+#include "flops.h"
+#include "hipblas.hpp"
+#include "norm.h"
+#include "unit.h"
+#include "utility.h"
+
+using namespace std;
+
+template <typename T>
+hipblasStatus_t testing_syevj_batched(Arguments argus)
+{
+    int N           = argus.N;
+    int lda         = argus.lda;
+    int batch_count = argus.batch_count;
+    int max_sweeps  = 100;
+
+    int A_size = lda * N;
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+
+    // Check to prevent memory allocation error
+    if(N < 0 || lda < max(1, N) || batch_count < 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    if(batch_count == 0)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T>   hA[batch_count];
+    host_vector<T>   hV[batch_count];
+    host_vector<T>   hW(N * batch_count);
+    host_vector<int> hSweeps(batch_count);
+    host_vector<int> hInfo(batch_count);
+
+    device_batch_vector<T> bA(batch_count, A_size);
+
+    device_vector<T*, 0, T> dA(batch_count);
+    device_vector<T>        dW(N * batch_count);
+    device_vector<T>        dResidual(batch_count);
+    device_vector<int>      dSweeps(batch_count);
+    device_vector<int>      dInfo(batch_count);
+
+    hipblasHandle_t handle;
+    hipblas_client_create(&handle);
+
+    // Initial hA on CPU: symmetric entries in [0, 1], both triangles filled
+    srand(1);
+    for(int b = 0; b < batch_count; b++)
+    {
+        hA[b] = host_vector<T>(A_size);
+        hV[b] = host_vector<T>(A_size);
+
+        hipblas_init<T>(hA[b], N, N, lda);
+        for(int i = 0; i < N; i++)
+        {
+            for(int j = 0; j < i; j++)
+                hA[b][i + j * lda] = hA[b][j + i * lda] = (hA[b][j + i * lda] - 1.0) / 10.0;
+            hA[b][i + i * lda] = (hA[b][i + i * lda] - 1.0) / 10.0;
+        }
+
+        CHECK_HIP_ERROR(hipMemcpy(bA[b], hA[b].data(), A_size * sizeof(T), hipMemcpyHostToDevice));
+    }
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, bA, batch_count * sizeof(T*), hipMemcpyHostToDevice));
+
+    /* =====================================================================
+           HIPBLAS
+    =================================================================== */
+
+    status = hipblasSyevjBatched<T, T>(handle,
+                                       HIPBLAS_EVECT_ORIGINAL,
+                                       HIPBLAS_FILL_MODE_UPPER,
+                                       N,
+                                       dA,
+                                       lda,
+                                       0,
+                                       dResidual,
+                                       max_sweeps,
+                                       dSweeps,
+                                       dW,
+                                       N,
+                                       dInfo,
+                                       batch_count);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    // copy output from device to CPU
+    for(int b = 0; b < batch_count; b++)
+        CHECK_HIP_ERROR(hipMemcpy(hV[b].data(), bA[b], A_size * sizeof(T), hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hW.data(), dW, N * batch_count * sizeof(T), hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(
+        hipMemcpy(hSweeps.data(), dSweeps, batch_count * sizeof(int), hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(
+        hipMemcpy(hInfo.data(), dInfo, batch_count * sizeof(int), hipMemcpyDeviceToHost));
+
+    if(argus.unit_check && N > 0)
+    {
+        // A * V = V * diag(W), with W ascending
+        T      eps       = std::numeric_limits<T>::epsilon();
+        double tolerance = N * eps * 100;
+
+        hipblasOperation_t op = HIPBLAS_OP_N;
+        host_vector<T>     hAV(A_size);
+        for(int b = 0; b < batch_count; b++)
+        {
+            EXPECT_EQ(0, hInfo[b]);
+            EXPECT_LE(hSweeps[b], max_sweeps);
+
+            T* w = hW.data() + b * N;
+            cblas_gemm<T>(
+                op, op, N, N, N, 1, hA[b].data(), lda, hV[b].data(), lda, 0, hAV.data(), lda);
+            for(int j = 0; j < N; j++)
+            {
+                if(j > 0)
+                    EXPECT_LE(w[j - 1], w[j]);
+                for(int i = 0; i < N; i++)
+                    hV[b][i + j * lda] *= w[j];
+            }
+
+            double e = norm_check_general<T>('F', N, N, lda, hAV.data(), hV[b].data());
+            unit_check_error(e, tolerance);
+        }
+    }
+
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
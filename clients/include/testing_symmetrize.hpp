@@ -0,0 +1,132 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "flops.h"
+#include "hipblas.hpp"
+#include "unit.h"
+#include "utility.h"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+template <typename T>
+using hipblas_symmetrize_t
+    = hipblasStatus_t (*)(hipblasHandle_t handle, hipblasFillMode_t uplo, int n, T* A, int lda);
+
+// The other triangle of A from its argus.uplo_option triangle, conjugated for hermitize, which
+// also makes the diagonal real. Every element outside the triangle starts out as values the mirror
+// has to replace, and the padding rows below n must keep theirs
+template <typename T>
+hipblasStatus_t testing_symmetrize_template(const Arguments&        argus,
+                                            hipblas_symmetrize_t<T> func,
+                                            bool                    conjugate)
+{
+    int N   = argus.N;
+    int lda = argus.lda;
+
+    hipblasFillMode_t uplo = char2hipblas_fill(argus.uplo_option);
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    if(N < 0 || lda < max(1, N))
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    if(N == 0)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    int A_size = lda * N;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA(A_size);
+    host_vector<T> hA_gold(A_size);
+
+    device_vector<T> dA(A_size);
+
+    hipblasHandle_t handle;
+    hipblas_client_create(&handle);
+
+    // Initial Data on CPU
+    srand(1);
+    hipblas_init<T>(hA, 1, A_size, 1);
+    hA_gold = hA;
+
+    for(int j = 0; j < N; j++)
+        for(int i = 0; i < N; i++)
+        {
+            bool source = uplo == HIPBLAS_FILL_MODE_LOWER ? i >= j : i <= j;
+            T&   gold   = hA_gold[i + j * lda];
+            if(!source)
+                gold = conjugate ? hipblas_conjugate(hA[j + i * lda]) : hA[j + i * lda];
+            // the real part, exactly for the small integers hipblas_init gives
+            if(conjugate && i == j)
+                gold = (gold + hipblas_conjugate(gold)) * T(0.5);
+        }
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * A_size, hipMemcpyHostToDevice));
+
+    /* =====================================================================
+           HIPBLAS
+    =================================================================== */
+
+    status = func(handle, uplo, N, dA, lda);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    CHECK_HIP_ERROR(hipMemcpy(hA.data(), dA, sizeof(T) * A_size, hipMemcpyDeviceToHost));
+
+    if(argus.unit_check)
+    {
+        unit_check_general<T>(1, A_size, 1, hA_gold.data(), hA.data());
+    }
+
+    if(argus.timing)
+    {
+        // the mirror of a mirrored matrix is itself, so the timed calls need no fresh input
+        hipblas_timing timing;
+        status = hipblas_time_launches(
+            handle, argus, timing, [&] { return func(handle, uplo, N, dA, lda); });
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            hipblas_client_destroy(handle);
+            return status;
+        }
+
+        double gbyte = symmetrize_gbyte_count<T>(N);
+
+        cout << "uplo,N,lda," HIPBLAS_TIMING_COLUMNS << endl;
+        cout << argus.uplo_option << ',' << N << ',' << lda << ',';
+        hipblas_print_timing(cout, timing, 0.0, gbyte);
+    }
+
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+template <typename T>
+hipblasStatus_t testing_symmetrize(const Arguments& arg)
+{
+    return testing_symmetrize_template<T>(arg, hipblasSymmetrize<T>, false);
+}
+
+template <typename T>
+hipblasStatus_t testing_hermitize(const Arguments& arg)
+{
+    return testing_symmetrize_template<T>(arg, hipblasHermitize<T>, true);
+}
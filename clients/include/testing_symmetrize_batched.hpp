@@ -0,0 +1,141 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "flops.h"
+#include "hipblas.hpp"
+#include "unit.h"
+#include "utility.h"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+template <typename T>
+using hipblas_symmetrize_batched_t = hipblasStatus_t (*)(
+    hipblasHandle_t handle, hipblasFillMode_t uplo, int n, T* const A[], int lda, int batch_count);
+
+template <typename T>
+hipblasStatus_t testing_symmetrize_batched_template(const Arguments&                argus,
+                                                    hipblas_symmetrize_batched_t<T> func,
+                                                    bool                            conjugate)
+{
+    int N           = argus.N;
+    int lda         = argus.lda;
+    int batch_count = argus.batch_count;
+
+    hipblasFillMode_t uplo = char2hipblas_fill(argus.uplo_option);
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    if(N < 0 || lda < max(1, N) || batch_count < 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    if(N == 0 || batch_count == 0)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    int A_size = lda * N;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA[batch_count];
+    host_vector<T> hA_gold[batch_count];
+
+    device_batch_vector<T> bA(batch_count, A_size);
+
+    device_vector<T*, 0, T> dA(batch_count);
+
+    hipblasHandle_t handle;
+    hipblas_client_create(&handle);
+
+    // Initial Data on CPU
+    srand(1);
+    for(int b = 0; b < batch_count; b++)
+    {
+        hA[b] = host_vector<T>(A_size);
+
+        hipblas_init<T>(hA[b], 1, A_size, 1);
+        hA_gold[b] = hA[b];
+
+        for(int j = 0; j < N; j++)
+            for(int i = 0; i < N; i++)
+            {
+                bool source = uplo == HIPBLAS_FILL_MODE_LOWER ? i >= j : i <= j;
+                T&   gold   = hA_gold[b][i + j * lda];
+                if(!source)
+                    gold = conjugate ? hipblas_conjugate(hA[b][j + i * lda]) : hA[b][j + i * lda];
+                if(conjugate && i == j)
+                    gold = (gold + hipblas_conjugate(gold)) * T(0.5);
+            }
+
+        CHECK_HIP_ERROR(hipMemcpy(bA[b], hA[b].data(), sizeof(T) * A_size, hipMemcpyHostToDevice));
+    }
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, bA, sizeof(T*) * batch_count, hipMemcpyHostToDevice));
+
+    /* =====================================================================
+           HIPBLAS
+    =================================================================== */
+
+    status = func(handle, uplo, N, dA, lda, batch_count);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    // copy output from device to CPU
+    for(int b = 0; b < batch_count; b++)
+        CHECK_HIP_ERROR(hipMemcpy(hA[b].data(), bA[b], sizeof(T) * A_size, hipMemcpyDeviceToHost));
+
+    if(argus.unit_check)
+    {
+        for(int b = 0; b < batch_count; b++)
+            unit_check_general<T>(1, A_size, 1, hA_gold[b].data(), hA[b].data());
+    }
+
+    if(argus.timing)
+    {
+        // the mirror of a mirrored matrix is itself, so the timed calls need no fresh input
+        hipblas_timing timing;
+        status = hipblas_time_launches(
+            handle, argus, timing, [&] { return func(handle, uplo, N, dA, lda, batch_count); });
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            hipblas_client_destroy(handle);
+            return status;
+        }
+
+        double gbyte = symmetrize_gbyte_count<T>(N) * batch_count;
+
+        cout << "uplo,N,lda,batch_count," HIPBLAS_TIMING_COLUMNS << endl;
+        cout << argus.uplo_option << ',' << N << ',' << lda << ',' << batch_count << ',';
+        hipblas_print_timing(cout, timing, 0.0, gbyte);
+    }
+
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+template <typename T>
+hipblasStatus_t testing_symmetrize_batched(const Arguments& arg)
+{
+    return testing_symmetrize_batched_template<T>(arg, hipblasSymmetrizeBatched<T>, false);
+}
+
+template <typename T>
+hipblasStatus_t testing_hermitize_batched(const Arguments& arg)
+{
+    return testing_symmetrize_batched_template<T>(arg, hipblasHermitizeBatched<T>, true);
+}
@@ -0,0 +1,145 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "flops.h"
+#include "hipblas.hpp"
+#include "unit.h"
+#include "utility.h"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+template <typename T>
+using hipblas_symmetrize_strided_batched_t = hipblasStatus_t (*)(hipblasHandle_t   handle,
+                                                                 hipblasFillMode_t uplo,
+                                                                 int               n,
+                                                                 T*                A,
+                                                                 int               lda,
+                                                                 long long         strideA,
+                                                                 int               batch_count);
+
+// what lies between the batches, with a stride_scale above 1, must keep its values
+template <typename T>
+hipblasStatus_t
+    testing_symmetrize_strided_batched_template(const Arguments&                        argus,
+                                                hipblas_symmetrize_strided_batched_t<T> func,
+                                                bool                                    conjugate)
+{
+    int    N            = argus.N;
+    int    lda          = argus.lda;
+    int    batch_count  = argus.batch_count;
+    double stride_scale = argus.stride_scale;
+
+    hipblasFillMode_t uplo = char2hipblas_fill(argus.uplo_option);
+
+    long long strideA = lda * N * stride_scale;
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    if(N < 0 || lda < max(1, N) || batch_count < 0 || strideA < (long long)lda * N)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    if(N == 0 || batch_count == 0)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    size_t A_size = strideA * batch_count;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA(A_size);
+    host_vector<T> hA_gold(A_size);
+
+    device_vector<T> dA(A_size);
+
+    hipblasHandle_t handle;
+    hipblas_client_create(&handle);
+
+    // Initial Data on CPU
+    srand(1);
+    hipblas_init<T>(hA, 1, A_size, 1);
+    hA_gold = hA;
+
+    for(int b = 0; b < batch_count; b++)
+        for(int j = 0; j < N; j++)
+            for(int i = 0; i < N; i++)
+            {
+                bool source = uplo == HIPBLAS_FILL_MODE_LOWER ? i >= j : i <= j;
+                T&   gold   = hA_gold[b * strideA + i + j * lda];
+                T    mirror = hA[b * strideA + j + i * lda];
+                if(!source)
+                    gold = conjugate ? hipblas_conjugate(mirror) : mirror;
+                if(conjugate && i == j)
+                    gold = (gold + hipblas_conjugate(gold)) * T(0.5);
+            }
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * A_size, hipMemcpyHostToDevice));
+
+    /* =====================================================================
+           HIPBLAS
+    =================================================================== */
+
+    status = func(handle, uplo, N, dA, lda, strideA, batch_count);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    CHECK_HIP_ERROR(hipMemcpy(hA.data(), dA, sizeof(T) * A_size, hipMemcpyDeviceToHost));
+
+    if(argus.unit_check)
+    {
+        unit_check_general<T>(1, A_size, 1, hA_gold.data(), hA.data());
+    }
+
+    if(argus.timing)
+    {
+        // the mirror of a mirrored matrix is itself, so the timed calls need no fresh input
+        hipblas_timing timing;
+        status = hipblas_time_launches(handle, argus, timing, [&] {
+            return func(handle, uplo, N, dA, lda, strideA, batch_count);
+        });
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            hipblas_client_destroy(handle);
+            return status;
+        }
+
+        double gbyte = symmetrize_gbyte_count<T>(N) * batch_count;
+
+        cout << "uplo,N,lda,stride_scale,batch_count," HIPBLAS_TIMING_COLUMNS << endl;
+        cout << argus.uplo_option << ',' << N << ',' << lda << ',' << stride_scale << ','
+             << batch_count << ',';
+        hipblas_print_timing(cout, timing, 0.0, gbyte);
+    }
+
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+template <typename T>
+hipblasStatus_t testing_symmetrize_strided_batched(const Arguments& arg)
+{
+    return testing_symmetrize_strided_batched_template<T>(
+        arg, hipblasSymmetrizeStridedBatched<T>, false);
+}
+
+template <typename T>
+hipblasStatus_t testing_hermitize_strided_batched(const Arguments& arg)
+{
+    return testing_symmetrize_strided_batched_template<T>(
+        arg, hipblasHermitizeStridedBatched<T>, true);
+}
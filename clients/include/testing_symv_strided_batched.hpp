@@ -66,7 +66,7 @@ hipblasStatus_t testing_symv_strided_batched(Arguments argus)
     T beta  = argus.get_beta<T>();
 
     hipblasHandle_t handle;
-    hipblasCreate(&handle);
+    hipblas_client_create(&handle);
 
     // Initial Data on CPU
     srand(1);
@@ -104,7 +104,7 @@ hipblasStatus_t testing_symv_strided_batched(Arguments argus)
         if(status != HIPBLAS_STATUS_SUCCESS)
         {
             // here in cuda
-            hipblasDestroy(handle);
+            hipblas_client_destroy(handle);
             return status;
         }
     }
@@ -118,8 +118,7 @@ hipblasStatus_t testing_symv_strided_batched(Arguments argus)
            CPU BLAS
         =================================================================== */
 
-        for(int b = 0; b < batch_count; b++)
-        {
+        hipblas_batch_for(batch_count, [&](int b) {
             cblas_symv<T>(uplo,
                           M,
                           alpha,
@@ -130,7 +129,7 @@ hipblasStatus_t testing_symv_strided_batched(Arguments argus)
                           beta,
                           hy.data() + b * stride_y,
                           incy);
-        }
+        });
 
         // enable unit check, notice unit check is not invasive, but norm check is,
         // unit check and norm check can not be interchanged their order
@@ -140,6 +139,6 @@ hipblasStatus_t testing_symv_strided_batched(Arguments argus)
         }
     }
 
-    hipblasDestroy(handle);
+    hipblas_client_destroy(handle);
     return HIPBLAS_STATUS_SUCCESS;
 }
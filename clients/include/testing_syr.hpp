@@ -73,7 +73,7 @@ hipblasStatus_t testing_syr(Arguments argus)
     T alpha = argus.get_alpha<T>();
 
     hipblasHandle_t handle;
-    hipblasCreate(&handle);
+    hipblas_client_create(&handle);
 
     // Initial Data on CPU
     srand(1);
@@ -88,20 +88,12 @@ hipblasStatus_t testing_syr(Arguments argus)
     /* =====================================================================
            ROCBLAS
     =================================================================== */
-    if(argus.timing)
-    {
-        gpu_time_used = get_time_us(); // in microseconds
-    }
+    status = hipblasSyr<T>(handle, uplo, N, (T*)&alpha, dx, incx, dA, lda);
 
-    for(int iter = 0; iter < 1; iter++)
+    if(status != HIPBLAS_STATUS_SUCCESS)
     {
-        status = hipblasSyr<T>(handle, uplo, N, (T*)&alpha, dx, incx, dA, lda);
-
-        if(status != HIPBLAS_STATUS_SUCCESS)
-        {
-            hipblasDestroy(handle);
-            return status;
-        }
+        hipblas_client_destroy(handle);
+        return status;
     }
 
     // copy output from device to CPU
@@ -122,6 +114,26 @@ hipblasStatus_t testing_syr(Arguments argus)
         }
     }
 
-    hipblasDestroy(handle);
+    if(argus.timing)
+    {
+        hipblas_timing timing;
+        status = hipblas_time_launches(handle, argus, timing, [&] {
+            return hipblasSyr<T>(handle, uplo, N, (T*)&alpha, dx, incx, dA, lda);
+        });
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            hipblas_client_destroy(handle);
+            return status;
+        }
+
+        double gflop = syr_gflop_count<T>(N);
+        double gbyte = syr_gbyte_count<T>(N);
+
+        cout << "M,N,incx,lda,uplo," HIPBLAS_TIMING_COLUMNS << endl;
+        cout << M << ',' << N << ',' << incx << ',' << lda << ',' << char_uplo << ',';
+        hipblas_print_timing(cout, timing, gflop, gbyte);
+    }
+
+    hipblas_client_destroy(handle);
     return HIPBLAS_STATUS_SUCCESS;
 }
@@ -71,7 +71,7 @@ hipblasStatus_t testing_syr2_strided_batched(Arguments argus)
     T alpha = argus.get_alpha<T>();
 
     hipblasHandle_t handle;
-    hipblasCreate(&handle);
+    hipblas_client_create(&handle);
 
     // Initial Data on CPU
     srand(1);
@@ -88,33 +88,25 @@ hipblasStatus_t testing_syr2_strided_batched(Arguments argus)
     /* =====================================================================
            ROCBLAS
     =================================================================== */
-    if(argus.timing)
+    status = hipblasSyr2StridedBatched<T>(handle,
+                                          uplo,
+                                          N,
+                                          (T*)&alpha,
+                                          dx,
+                                          incx,
+                                          stridex,
+                                          dy,
+                                          incy,
+                                          stridey,
+                                          dA,
+                                          lda,
+                                          strideA,
+                                          batch_count);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
     {
-        gpu_time_used = get_time_us(); // in microseconds
-    }
-
-    for(int iter = 0; iter < 1; iter++)
-    {
-        status = hipblasSyr2StridedBatched<T>(handle,
-                                              uplo,
-                                              N,
-                                              (T*)&alpha,
-                                              dx,
-                                              incx,
-                                              stridex,
-                                              dy,
-                                              incy,
-                                              stridey,
-                                              dA,
-                                              lda,
-                                              strideA,
-                                              batch_count);
-
-        if(status != HIPBLAS_STATUS_SUCCESS)
-        {
-            hipblasDestroy(handle);
-            return status;
-        }
+        hipblas_client_destroy(handle);
+        return status;
     }
 
     // copy output from device to CPU
@@ -125,8 +117,7 @@ hipblasStatus_t testing_syr2_strided_batched(Arguments argus)
         /* =====================================================================
            CPU BLAS
         =================================================================== */
-        for(int b = 0; b < batch_count; b++)
-        {
+        hipblas_batch_for(batch_count, [&](int b) {
             cblas_syr2<T>(uplo,
                           N,
                           alpha,
@@ -136,7 +127,7 @@ hipblasStatus_t testing_syr2_strided_batched(Arguments argus)
                           incy,
                           hA_cpu.data() + b * strideA,
                           lda);
-        }
+        });
 
         // enable unit check, notice unit check is not invasive, but norm check is,
         // unit check and norm check can not be interchanged their order
@@ -146,6 +137,40 @@ hipblasStatus_t testing_syr2_strided_batched(Arguments argus)
         }
     }
 
-    hipblasDestroy(handle);
+    if(argus.timing)
+    {
+        hipblas_timing timing;
+        status = hipblas_time_launches(handle, argus, timing, [&] {
+            return hipblasSyr2StridedBatched<T>(handle,
+                                                uplo,
+                                                N,
+                                                (T*)&alpha,
+                                                dx,
+                                                incx,
+                                                stridex,
+                                                dy,
+                                                incy,
+                                                stridey,
+                                                dA,
+                                                lda,
+                                                strideA,
+                                                batch_count);
+        });
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            hipblas_client_destroy(handle);
+            return status;
+        }
+
+        double gflop = syr2_gflop_count<T>(N) * batch_count;
+        double gbyte = syr2_gbyte_count<T>(N) * batch_count;
+
+        cout << "N,incx,incy,lda,uplo,stride_scale,batch_count," HIPBLAS_TIMING_COLUMNS << endl;
+        cout << N << ',' << incx << ',' << incy << ',' << lda << ',' << char_uplo << ','
+             << stride_scale << ',' << batch_count << ',';
+        hipblas_print_timing(cout, timing, gflop, gbyte);
+    }
+
+    hipblas_client_destroy(handle);
     return HIPBLAS_STATUS_SUCCESS;
 }
@@ -64,7 +64,7 @@ hipblasStatus_t testing_syr2k(Arguments argus)
     T beta  = argus.get_beta<T>();
 
     hipblasHandle_t handle;
-    hipblasCreate(&handle);
+    hipblas_client_create(&handle);
 
     // Initial Data on CPU
     srand(1);
@@ -83,22 +83,13 @@ hipblasStatus_t testing_syr2k(Arguments argus)
     /* =====================================================================
            ROCBLAS
     =================================================================== */
-    if(argus.timing)
-    {
-        gpu_time_used = get_time_us(); // in microseconds
-    }
+    status = hipblasSyr2k<T>(
+        handle, uplo, transA, N, K, (T*)&alpha, dA, lda, dB, ldb, (T*)&beta, dC, ldc);
 
-    for(int iter = 0; iter < 1; iter++)
+    if(status != HIPBLAS_STATUS_SUCCESS)
     {
-
-        status = hipblasSyr2k<T>(
-            handle, uplo, transA, N, K, (T*)&alpha, dA, lda, dB, ldb, (T*)&beta, dC, ldc);
-
-        if(status != HIPBLAS_STATUS_SUCCESS)
-        {
-            hipblasDestroy(handle);
-            return status;
-        }
+        hipblas_client_destroy(handle);
+        return status;
     }
 
     // copy output from device to CPU
@@ -119,6 +110,28 @@ hipblasStatus_t testing_syr2k(Arguments argus)
         }
     }
 
-    hipblasDestroy(handle);
+    if(argus.timing)
+    {
+        hipblas_timing timing;
+        status = hipblas_time_launches(handle, argus, timing, [&] {
+            return hipblasSyr2k<T>(
+                handle, uplo, transA, N, K, (T*)&alpha, dA, lda, dB, ldb, (T*)&beta, dC, ldc);
+        });
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            hipblas_client_destroy(handle);
+            return status;
+        }
+
+        double gflop = syr2k_gflop_count<T>(N, K);
+        double gbyte = syr2k_gbyte_count<T>(N, K);
+
+        cout << "N,K,lda,ldb,ldc,uplo,transA," HIPBLAS_TIMING_COLUMNS << endl;
+        cout << N << ',' << K << ',' << lda << ',' << ldb << ',' << ldc << ',' << argus.uplo_option
+             << ',' << argus.transA_option << ',';
+        hipblas_print_timing(cout, timing, gflop, gbyte);
+    }
+
+    hipblas_client_destroy(handle);
     return HIPBLAS_STATUS_SUCCESS;
 }
@@ -55,7 +55,7 @@ hipblasStatus_t testing_syr_batched(Arguments argus)
     }
 
     hipblasHandle_t handle;
-    hipblasCreate(&handle);
+    hipblas_client_create(&handle);
 
     // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
     host_vector<T> hA[batch_count];
@@ -71,7 +71,7 @@ hipblasStatus_t testing_syr_batched(Arguments argus)
     int last = batch_count - 1;
     if(!dA || !dx || (!bA[last] && A_size) || (!bx[last] && x_size))
     {
-        hipblasDestroy(handle);
+        hipblas_client_destroy(handle);
         return HIPBLAS_STATUS_ALLOC_FAILED;
     }
 
@@ -97,20 +97,12 @@ hipblasStatus_t testing_syr_batched(Arguments argus)
     /* =====================================================================
            ROCBLAS
     =================================================================== */
-    if(argus.timing)
-    {
-        gpu_time_used = get_time_us(); // in microseconds
-    }
+    status = hipblasSyrBatched<T>(handle, uplo, N, (T*)&alpha, dx, incx, dA, lda, batch_count);
 
-    for(int iter = 0; iter < 1; iter++)
+    if(status != HIPBLAS_STATUS_SUCCESS)
     {
-        status = hipblasSyrBatched<T>(handle, uplo, N, (T*)&alpha, dx, incx, dA, lda, batch_count);
-
-        if(status != HIPBLAS_STATUS_SUCCESS)
-        {
-            hipblasDestroy(handle);
-            return status;
-        }
+        hipblas_client_destroy(handle);
+        return status;
     }
 
     // copy output from device to CPU
@@ -124,10 +116,9 @@ hipblasStatus_t testing_syr_batched(Arguments argus)
         /* =====================================================================
            CPU BLAS
         =================================================================== */
-        for(int b = 0; b < batch_count; b++)
-        {
+        hipblas_batch_for(batch_count, [&](int b) {
             cblas_syr<T>(uplo, N, alpha, hx[b], incx, hA_cpu[b], lda);
-        }
+        });
 
         // enable unit check, notice unit check is not invasive, but norm check is,
         // unit check and norm check can not be interchanged their order
@@ -137,6 +128,28 @@ hipblasStatus_t testing_syr_batched(Arguments argus)
         }
     }
 
-    hipblasDestroy(handle);
+    if(argus.timing)
+    {
+        hipblas_timing timing;
+        status = hipblas_time_launches(handle, argus, timing, [&] {
+            return hipblasSyrBatched<T>(
+                handle, uplo, N, (T*)&alpha, dx, incx, dA, lda, batch_count);
+        });
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            hipblas_client_destroy(handle);
+            return status;
+        }
+
+        double gflop = syr_gflop_count<T>(N) * batch_count;
+        double gbyte = syr_gbyte_count<T>(N) * batch_count;
+
+        cout << "M,N,incx,lda,uplo,batch_count," HIPBLAS_TIMING_COLUMNS << endl;
+        cout << M << ',' << N << ',' << incx << ',' << lda << ',' << char_uplo << ',' << batch_count
+             << ',';
+        hipblas_print_timing(cout, timing, gflop, gbyte);
+    }
+
+    hipblas_client_destroy(handle);
     return HIPBLAS_STATUS_SUCCESS;
 }
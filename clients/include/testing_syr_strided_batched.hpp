@@ -67,7 +67,7 @@ hipblasStatus_t testing_syr_strided_batched(Arguments argus)
     T alpha = argus.get_alpha<T>();
 
     hipblasHandle_t handle;
-    hipblasCreate(&handle);
+    hipblas_client_create(&handle);
 
     // Initial Data on CPU
     srand(1);
@@ -82,21 +82,13 @@ hipblasStatus_t testing_syr_strided_batched(Arguments argus)
     /* =====================================================================
            ROCBLAS
     =================================================================== */
-    if(argus.timing)
-    {
-        gpu_time_used = get_time_us(); // in microseconds
-    }
+    status = hipblasSyrStridedBatched<T>(
+        handle, uplo, N, (T*)&alpha, dx, incx, stridex, dA, lda, strideA, batch_count);
 
-    for(int iter = 0; iter < 1; iter++)
+    if(status != HIPBLAS_STATUS_SUCCESS)
     {
-        status = hipblasSyrStridedBatched<T>(
-            handle, uplo, N, (T*)&alpha, dx, incx, stridex, dA, lda, strideA, batch_count);
-
-        if(status != HIPBLAS_STATUS_SUCCESS)
-        {
-            hipblasDestroy(handle);
-            return status;
-        }
+        hipblas_client_destroy(handle);
+        return status;
     }
 
     // copy output from device to CPU
@@ -107,11 +99,10 @@ hipblasStatus_t testing_syr_strided_batched(Arguments argus)
         /* =====================================================================
            CPU BLAS
         =================================================================== */
-        for(int b = 0; b < batch_count; b++)
-        {
+        hipblas_batch_for(batch_count, [&](int b) {
             cblas_syr<T>(
                 uplo, N, alpha, hx.data() + b * stridex, incx, hA_cpu.data() + b * strideA, lda);
-        }
+        });
 
         // enable unit check, notice unit check is not invasive, but norm check is,
         // unit check and norm check can not be interchanged their order
@@ -121,6 +112,28 @@ hipblasStatus_t testing_syr_strided_batched(Arguments argus)
         }
     }
 
-    hipblasDestroy(handle);
+    if(argus.timing)
+    {
+        hipblas_timing timing;
+        status = hipblas_time_launches(handle, argus, timing, [&] {
+            return hipblasSyrStridedBatched<T>(
+                handle, uplo, N, (T*)&alpha, dx, incx, stridex, dA, lda, strideA, batch_count);
+        });
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            hipblas_client_destroy(handle);
+            return status;
+        }
+
+        double gflop = syr_gflop_count<T>(N) * batch_count;
+        double gbyte = syr_gbyte_count<T>(N) * batch_count;
+
+        cout << "M,N,incx,lda,uplo,stride_scale,batch_count," HIPBLAS_TIMING_COLUMNS << endl;
+        cout << M << ',' << N << ',' << incx << ',' << lda << ',' << char_uplo << ','
+             << stride_scale << ',' << batch_count << ',';
+        hipblas_print_timing(cout, timing, gflop, gbyte);
+    }
+
+    hipblas_client_destroy(handle);
     return HIPBLAS_STATUS_SUCCESS;
 }
@@ -0,0 +1,99 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "cblas_interface.h"
+#include "hipblas.hpp"
+#include "norm.h"
+#include "unit.h"
+#include "utility.h"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+// hipblasSyrkEx with A, C and the compute type all T. The whole of C is checked, so the triangle
+// opposite uplo must be left as it was
+template <typename T>
+hipblasStatus_t testing_syrk_ex(Arguments argus)
+{
+    int N   = argus.N;
+    int K   = argus.K;
+    int lda = argus.lda;
+    int ldc = argus.ldc;
+
+    hipblasFillMode_t  uplo   = char2hipblas_fill(argus.uplo_option);
+    hipblasOperation_t transA = char2hipblas_operation(argus.transA_option);
+    hipblasDatatype_t  type   = hipblas_datatype<T>;
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    if(N < 0 || K < 0 || ldc < N || (transA == HIPBLAS_OP_N && lda < N)
+       || (transA != HIPBLAS_OP_N && lda < K))
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+
+    int K1     = (transA == HIPBLAS_OP_N ? K : N);
+    int A_size = lda * K1;
+    int C_size = ldc * N;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA(A_size);
+    host_vector<T> hC(C_size);
+    host_vector<T> hC2(C_size);
+
+    device_vector<T> dA(A_size);
+    device_vector<T> dC(C_size);
+
+    T alpha = argus.get_alpha<T>();
+    T beta  = argus.get_beta<T>();
+
+    hipblasHandle_t handle;
+    hipblas_client_create(&handle);
+
+    // Initial Data on CPU
+    srand(1);
+    hipblas_init<T>(hA, N, K1, lda);
+    hipblas_init<T>(hC, N, N, ldc);
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * A_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dC, hC.data(), sizeof(T) * C_size, hipMemcpyHostToDevice));
+
+    /* =====================================================================
+           ROCBLAS
+    =================================================================== */
+    status = hipblasSyrkEx(
+        handle, uplo, transA, N, K, &alpha, dA, type, lda, &beta, dC, type, ldc, type);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    // copy output from device to CPU
+    CHECK_HIP_ERROR(hipMemcpy(hC2.data(), dC, sizeof(T) * C_size, hipMemcpyDeviceToHost));
+
+    if(argus.unit_check)
+    {
+        /* =====================================================================
+           CPU BLAS
+        =================================================================== */
+        cblas_syrk<T>(uplo, transA, N, K, alpha, hA.data(), lda, beta, hC, ldc);
+
+        unit_check_general<T>(N, N, ldc, hC2.data(), hC.data());
+    }
+
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,86 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "cblas_interface.h"
+#include "hipblas.hpp"
+#include "unit.h"
+#include "utility.h"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+template <typename T>
+hipblasStatus_t testing_syrk_xt(Arguments argus)
+{
+    int N   = argus.N;
+    int K   = argus.K;
+    int lda = argus.lda;
+    int ldc = argus.ldc;
+
+    hipblasFillMode_t  uplo   = char2hipblas_fill(argus.uplo_option);
+    hipblasOperation_t transA = char2hipblas_operation(argus.transA_option);
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    if(N < 0 || K < 0 || ldc < max(1, N) || (transA == HIPBLAS_OP_N && lda < max(1, N))
+       || (transA != HIPBLAS_OP_N && lda < max(1, K)))
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+
+    int K1 = transA == HIPBLAS_OP_N ? K : N;
+
+    // Naming: all matrices are in CPU (host) memory, which hipblasXtSyrk streams to the device
+    host_vector<T> hA(lda * K1);
+    host_vector<T> hC(ldc * N);
+    host_vector<T> hC_gold(ldc * N);
+
+    T alpha = argus.get_alpha<T>();
+    T beta  = argus.get_beta<T>();
+
+    hipblasHandle_t handle;
+    hipblas_client_create(&handle);
+
+    // A small block so that the test sizes span diagonal and off-diagonal tiles
+    hipblasStatus_t status = hipblasXtSetBlockDim(handle, 64);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    // Initial Data on CPU. The triangle syrk does not update must come back as it was
+    srand(1);
+    hipblas_init<T>(hA, N, K1, lda);
+    hipblas_init<T>(hC, N, N, ldc);
+    hC_gold = hC;
+
+    /* =====================================================================
+         HIPBLAS
+    =================================================================== */
+    status = hipblasXtSyrk<T>(
+        handle, uplo, transA, N, K, &alpha, hA.data(), lda, &beta, hC.data(), ldc);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    if(argus.unit_check)
+    {
+        cblas_syrk<T>(uplo, transA, N, K, alpha, hA.data(), lda, beta, hC_gold.data(), ldc);
+
+        unit_check_general<T>(N, N, ldc, hC_gold.data(), hC.data());
+    }
+
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
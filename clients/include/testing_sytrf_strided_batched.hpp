@@ -0,0 +1,152 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "cblas_interface.h"
+#include "flops.h"
+#include "hipblas.hpp"
+#include "norm.h"
+#include "unit.h"
+#include "utility.h"
+
+using namespace std;
+
+// A symmetric indefinite A, with every other diagonal entry zero so that 2 x 2 pivots occur, is
+// factored by sytrf and B = A * X solved by sytrs from the factors; the solution must give B back
+template <typename T>
+hipblasStatus_t testing_sytrf_strided_batched(Arguments argus)
+{
+    int    N            = argus.N;
+    int    nrhs         = argus.K;
+    int    lda          = argus.lda;
+    int    ldb          = argus.ldb;
+    int    batch_count  = argus.batch_count;
+    double stride_scale = argus.stride_scale;
+
+    hipblasFillMode_t uplo = char2hipblas_fill(argus.uplo_option);
+
+    int strideA   = lda * N * stride_scale;
+    int strideB   = ldb * nrhs * stride_scale;
+    int strideP   = N * stride_scale;
+    int A_size    = strideA * batch_count;
+    int B_size    = strideB * batch_count;
+    int Ipiv_size = strideP * batch_count;
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+
+    // Check to prevent memory allocation error
+    if(N < 0 || nrhs < 0 || lda < max(1, N) || ldb < max(1, N) || batch_count < 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    if(batch_count == 0)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T>   hA(A_size);
+    host_vector<T>   hX(B_size);
+    host_vector<T>   hB(B_size);
+    host_vector<T>   hB1(B_size);
+    host_vector<T>   hAX(ldb * nrhs);
+    host_vector<int> hInfo(batch_count);
+    int              info;
+
+    device_vector<T>   dA(A_size);
+    device_vector<T>   dB(B_size);
+    device_vector<int> dIpiv(Ipiv_size);
+    device_vector<int> dInfo(batch_count);
+
+    hipblasHandle_t handle;
+    hipblas_client_create(&handle);
+
+    // Initial hA, hX and hB = hA * hX on CPU
+    srand(1);
+    hipblasOperation_t op = HIPBLAS_OP_N;
+    for(int b = 0; b < batch_count; b++)
+    {
+        T* hAb = hA.data() + b * strideA;
+        T* hXb = hX.data() + b * strideB;
+        T* hBb = hB.data() + b * strideB;
+
+        hipblas_init<T>(hAb, N, N, lda);
+        hipblas_init<T>(hXb, N, nrhs, ldb);
+        for(int j = 0; j < N; j++)
+            for(int i = j; i < N; i++)
+            {
+                T a              = i == j && j % 2 ? T(0) : (hAb[i + j * lda] - 0.5) / 10.0;
+                hAb[i + j * lda] = a;
+                hAb[j + i * lda] = a;
+            }
+
+        cblas_gemm<T>(op, op, N, nrhs, N, 1, hAb, lda, hXb, ldb, 0, hBb, ldb);
+    }
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), A_size * sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB.data(), B_size * sizeof(T), hipMemcpyHostToDevice));
+
+    /* =====================================================================
+           HIPBLAS
+    =================================================================== */
+
+    status = hipblasSytrfStridedBatched<T>(
+        handle, uplo, N, dA, lda, strideA, dIpiv, strideP, dInfo, batch_count);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasSytrsStridedBatched<T>(handle,
+                                               uplo,
+                                               N,
+                                               nrhs,
+                                               dA,
+                                               lda,
+                                               strideA,
+                                               dIpiv,
+                                               strideP,
+                                               dB,
+                                               ldb,
+                                               strideB,
+                                               &info,
+                                               batch_count);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    // copy output from device to CPU
+    CHECK_HIP_ERROR(hipMemcpy(hB1.data(), dB, B_size * sizeof(T), hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(
+        hipMemcpy(hInfo.data(), dInfo, batch_count * sizeof(int), hipMemcpyDeviceToHost));
+
+    if(argus.unit_check && N > 0 && nrhs > 0)
+    {
+        T      eps       = std::numeric_limits<T>::epsilon();
+        double tolerance = N * eps * 1000;
+
+        EXPECT_EQ(0, info);
+        for(int b = 0; b < batch_count; b++)
+        {
+            EXPECT_EQ(0, hInfo[b]);
+
+            // hA * hB1 against hB
+            T* hAb  = hA.data() + b * strideA;
+            T* hBb  = hB.data() + b * strideB;
+            T* hB1b = hB1.data() + b * strideB;
+            cblas_gemm<T>(op, op, N, nrhs, N, 1, hAb, lda, hB1b, ldb, 0, hAX.data(), ldb);
+
+            double e = norm_check_general<T>('F', N, nrhs, ldb, hBb, hAX.data());
+            unit_check_error(e, tolerance);
+        }
+    }
+
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -50,7 +50,7 @@ hipblasStatus_t testing_tbmv_batched(Arguments argus)
     }
 
     hipblasHandle_t handle;
-    hipblasCreate(&handle);
+    hipblas_client_create(&handle);
 
     double gpu_time_used, cpu_time_used;
     double hipblasGflops, cblas_gflops, hipblasBandwidth;
@@ -75,7 +75,7 @@ hipblasStatus_t testing_tbmv_batched(Arguments argus)
     int last = batch_count - 1;
     if(!dA_array || !dx_array || (!bA_array[last] && A_size) || (!bx_array[last] && X_size))
     {
-        hipblasDestroy(handle);
+        hipblas_client_destroy(handle);
         return HIPBLAS_STATUS_ALLOC_FAILED;
     }
 
@@ -99,7 +99,7 @@ hipblasStatus_t testing_tbmv_batched(Arguments argus)
 
         if(err_A != hipSuccess || err_x != hipSuccess)
         {
-            hipblasDestroy(handle);
+            hipblas_client_destroy(handle);
             return HIPBLAS_STATUS_MAPPING_ERROR;
         }
     }
@@ -108,7 +108,7 @@ hipblasStatus_t testing_tbmv_batched(Arguments argus)
     err_x = hipMemcpy(dx_array, bx_array, batch_count * sizeof(T*), hipMemcpyHostToDevice);
     if(err_A != hipSuccess || err_x != hipSuccess)
     {
-        hipblasDestroy(handle);
+        hipblas_client_destroy(handle);
         return HIPBLAS_STATUS_MAPPING_ERROR;
     }
 
@@ -122,7 +122,7 @@ hipblasStatus_t testing_tbmv_batched(Arguments argus)
 
         if(status != HIPBLAS_STATUS_SUCCESS)
         {
-            hipblasDestroy(handle);
+            hipblas_client_destroy(handle);
             return status;
         }
     }
@@ -139,10 +139,9 @@ hipblasStatus_t testing_tbmv_batched(Arguments argus)
            CPU BLAS
         =================================================================== */
 
-        for(int b = 0; b < batch_count; b++)
-        {
+        hipblas_batch_for(batch_count, [&](int b) {
             cblas_tbmv<T>(uplo, transA, diag, M, K, hA_array[b], lda, hx_array[b], incx);
-        }
+        });
 
         // enable unit check, notice unit check is not invasive, but norm check is,
         // unit check and norm check can not be interchanged their order
@@ -152,6 +151,6 @@ hipblasStatus_t testing_tbmv_batched(Arguments argus)
         }
     }
 
-    hipblasDestroy(handle);
+    hipblas_client_destroy(handle);
     return HIPBLAS_STATUS_SUCCESS;
 }
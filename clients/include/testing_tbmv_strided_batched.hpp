@@ -64,7 +64,7 @@ hipblasStatus_t testing_tbmv_strided_batched(Arguments argus)
     T beta  = (T)argus.beta;
 
     hipblasHandle_t handle;
-    hipblasCreate(&handle);
+    hipblas_client_create(&handle);
 
     // Initial Data on CPU
     srand(1);
@@ -87,7 +87,7 @@ hipblasStatus_t testing_tbmv_strided_batched(Arguments argus)
         if(status != HIPBLAS_STATUS_SUCCESS)
         {
             // here in cuda
-            hipblasDestroy(handle);
+            hipblas_client_destroy(handle);
             return status;
         }
     }
@@ -101,8 +101,7 @@ hipblasStatus_t testing_tbmv_strided_batched(Arguments argus)
            CPU BLAS
         =================================================================== */
 
-        for(int b = 0; b < batch_count; b++)
-        {
+        hipblas_batch_for(batch_count, [&](int b) {
             cblas_tbmv<T>(uplo,
                           transA,
                           diag,
@@ -112,7 +111,7 @@ hipblasStatus_t testing_tbmv_strided_batched(Arguments argus)
                           lda,
                           hx.data() + b * stride_x,
                           incx);
-        }
+        });
 
         // enable unit check, notice unit check is not invasive, but norm check is,
         // unit check and norm check can not be interchanged their order
@@ -122,6 +121,6 @@ hipblasStatus_t testing_tbmv_strided_batched(Arguments argus)
         }
     }
 
-    hipblasDestroy(handle);
+    hipblas_client_destroy(handle);
     return HIPBLAS_STATUS_SUCCESS;
 }
@@ -0,0 +1,125 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "cblas_interface.h"
+#include "flops.h"
+#include "hipblas.hpp"
+#include "norm.h"
+#include "unit.h"
+#include "utility.h"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+template <typename T>
+hipblasStatus_t testing_tbsv(Arguments argus)
+{
+    int                N           = argus.N;
+    int                K           = argus.K;
+    int                lda         = argus.lda;
+    int                incx        = argus.incx;
+    char               char_uplo   = argus.uplo_option;
+    char               char_diag   = argus.diag_option;
+    char               char_transA = argus.transA_option;
+    hipblasFillMode_t  uplo        = char2hipblas_fill(char_uplo);
+    hipblasDiagType_t  diag        = char2hipblas_diagonal(char_diag);
+    hipblasOperation_t transA      = char2hipblas_operation(char_transA);
+
+    int abs_incx = incx < 0 ? -incx : incx;
+    int size_A   = lda * N;
+    int size_x   = abs_incx * N;
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    if(N < 0 || K < 0 || lda < K + 1 || incx == 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA(size_A);
+    host_vector<T> hx(size_x);
+    host_vector<T> hb(size_x);
+
+    device_vector<T> dA(size_A);
+    device_vector<T> dx_or_b(size_x);
+
+    hipblasHandle_t handle;
+    hipblas_client_create(&handle);
+
+    // Initial Data on CPU; b = op(A) * x so the solve recovers x
+    srand(1);
+    hipblas_init_banded_triangular<T>(hA, uplo == HIPBLAS_FILL_MODE_UPPER, N, K, lda);
+    hipblas_init<T>(hx, 1, N, abs_incx);
+    hb = hx;
+    cblas_tbmv<T>(uplo, transA, diag, N, K, hA.data(), lda, hb.data(), incx);
+
+    // copy data from CPU to device
+    hipMemcpy(dA, hA.data(), sizeof(T) * size_A, hipMemcpyHostToDevice);
+    hipMemcpy(dx_or_b, hb.data(), sizeof(T) * size_x, hipMemcpyHostToDevice);
+
+    /* =====================================================================
+           ROCBLAS
+    =================================================================== */
+    status = hipblasTbsv<T>(handle, uplo, transA, diag, N, K, dA, lda, dx_or_b, incx);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    // copy output from device to CPU
+    hipMemcpy(hb.data(), dx_or_b, sizeof(T) * size_x, hipMemcpyDeviceToHost);
+
+    if(argus.unit_check)
+    {
+        real_t<T> eps       = std::numeric_limits<real_t<T>>::epsilon();
+        double    tolerance = eps * 40 * N;
+
+        double max_err = 0.0, max_err_scal = 0.0;
+        for(int i = 0; i < N; i++)
+        {
+            T diff = T(hx[i * abs_incx]) - hb[i * abs_incx];
+            max_err += abs(diff);
+            max_err_scal += abs(hb[i * abs_incx]);
+        }
+        double error = max_err_scal == 0 ? max_err : max_err / max_err_scal;
+
+        unit_check_error(error, tolerance);
+    }
+
+    if(argus.timing)
+    {
+        hipblas_timing timing;
+        status = hipblas_time_launches(handle, argus, timing, [&] {
+            return hipblasTbsv<T>(handle, uplo, transA, diag, N, K, dA, lda, dx_or_b, incx);
+        });
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            hipblas_client_destroy(handle);
+            return status;
+        }
+
+        double gflop = tbsv_gflop_count<T>(N, K);
+        double gbyte = tbsv_gbyte_count<T>(N, K);
+
+        cout << "N,K,lda,incx,uplo,diag,transA," HIPBLAS_TIMING_COLUMNS << endl;
+        cout << N << ',' << K << ',' << lda << ',' << incx << ',' << char_uplo << ',' << char_diag
+             << ',' << char_transA << ',';
+        hipblas_print_timing(cout, timing, gflop, gbyte);
+    }
+
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,163 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "cblas_interface.h"
+#include "flops.h"
+#include "hipblas.hpp"
+#include "norm.h"
+#include "unit.h"
+#include "utility.h"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+template <typename T>
+hipblasStatus_t testing_tbsv_strided_batched(Arguments argus)
+{
+    int                N            = argus.N;
+    int                K            = argus.K;
+    int                lda          = argus.lda;
+    int                incx         = argus.incx;
+    char               char_uplo    = argus.uplo_option;
+    char               char_diag    = argus.diag_option;
+    char               char_transA  = argus.transA_option;
+    hipblasFillMode_t  uplo         = char2hipblas_fill(char_uplo);
+    hipblasDiagType_t  diag         = char2hipblas_diagonal(char_diag);
+    hipblasOperation_t transA       = char2hipblas_operation(char_transA);
+    double             stride_scale = argus.stride_scale;
+    int                batch_count  = argus.batch_count;
+
+    int abs_incx = incx < 0 ? -incx : incx;
+    int stride_A = lda * N * stride_scale;
+    int stride_x = abs_incx * N * stride_scale;
+    int size_A   = stride_A * batch_count;
+    int size_x   = stride_x * batch_count;
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    if(N < 0 || K < 0 || lda < K + 1 || incx == 0 || batch_count < 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    else if(!batch_count)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA(size_A);
+    host_vector<T> hx(size_x);
+    host_vector<T> hb(size_x);
+
+    device_vector<T> dA(size_A);
+    device_vector<T> dx_or_b(size_x);
+
+    hipblasHandle_t handle;
+    hipblas_client_create(&handle);
+
+    // Initial Data on CPU; b = op(A) * x so the solve recovers x
+    srand(1);
+    hipblas_init_banded_triangular<T>(
+        hA, uplo == HIPBLAS_FILL_MODE_UPPER, N, K, lda, stride_A, batch_count);
+    hipblas_init<T>(hx, 1, N, abs_incx, stride_x, batch_count);
+    hb = hx;
+    for(int b = 0; b < batch_count; b++)
+        cblas_tbmv<T>(uplo,
+                      transA,
+                      diag,
+                      N,
+                      K,
+                      hA.data() + b * stride_A,
+                      lda,
+                      hb.data() + b * stride_x,
+                      incx);
+
+    // copy data from CPU to device
+    hipMemcpy(dA, hA.data(), sizeof(T) * size_A, hipMemcpyHostToDevice);
+    hipMemcpy(dx_or_b, hb.data(), sizeof(T) * size_x, hipMemcpyHostToDevice);
+
+    /* =====================================================================
+           ROCBLAS
+    =================================================================== */
+    status = hipblasTbsvStridedBatched<T>(
+        handle, uplo, transA, diag, N, K, dA, lda, stride_A, dx_or_b, incx, stride_x, batch_count);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    // copy output from device to CPU
+    hipMemcpy(hb.data(), dx_or_b, sizeof(T) * size_x, hipMemcpyDeviceToHost);
+
+    if(argus.unit_check)
+    {
+        real_t<T> eps       = std::numeric_limits<real_t<T>>::epsilon();
+        double    tolerance = eps * 40 * N;
+
+        for(int b = 0; b < batch_count; b++)
+        {
+            T* hxb = hx.data() + b * stride_x;
+            T* hbb = hb.data() + b * stride_x;
+
+            double max_err = 0.0, max_err_scal = 0.0;
+            for(int i = 0; i < N; i++)
+            {
+                T diff = T(hxb[i * abs_incx]) - hbb[i * abs_incx];
+                max_err += abs(diff);
+                max_err_scal += abs(hbb[i * abs_incx]);
+            }
+            double error = max_err_scal == 0 ? max_err : max_err / max_err_scal;
+
+            unit_check_error(error, tolerance);
+        }
+    }
+
+    if(argus.timing)
+    {
+        hipblas_timing timing;
+        status = hipblas_time_launches(handle, argus, timing, [&] {
+            return hipblasTbsvStridedBatched<T>(handle,
+                                                uplo,
+                                                transA,
+                                                diag,
+                                                N,
+                                                K,
+                                                dA,
+                                                lda,
+                                                stride_A,
+                                                dx_or_b,
+                                                incx,
+                                                stride_x,
+                                                batch_count);
+        });
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            hipblas_client_destroy(handle);
+            return status;
+        }
+
+        double gflop = tbsv_gflop_count<T>(N, K) * batch_count;
+        double gbyte = tbsv_gbyte_count<T>(N, K) * batch_count;
+
+        cout << "N,K,lda,incx,stride_scale,batch_count,uplo,diag,transA," HIPBLAS_TIMING_COLUMNS
+             << endl;
+        cout << N << ',' << K << ',' << lda << ',' << incx << ',' << stride_scale << ','
+             << batch_count << ',' << char_uplo << ',' << char_diag << ',' << char_transA << ',';
+        hipblas_print_timing(cout, timing, gflop, gbyte);
+    }
+
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -62,7 +62,7 @@ hipblasStatus_t testing_tpsv(Arguments argus)
     double hipblasGflops, cblas_gflops, hipblasBandwidth;
 
     hipblasHandle_t handle;
-    hipblasCreate(&handle);
+    hipblas_client_create(&handle);
 
     // Initial Data on CPU
     srand(1);
@@ -123,20 +123,12 @@ hipblasStatus_t testing_tpsv(Arguments argus)
     /* =====================================================================
            ROCBLAS
     =================================================================== */
-    if(argus.timing)
-    {
-        gpu_time_used = get_time_us(); // in microseconds
-    }
+    status = hipblasTpsv<T>(handle, uplo, transA, diag, N, dAP, dx_or_b, incx);
 
-    for(int iter = 0; iter < 1; iter++)
+    if(status != HIPBLAS_STATUS_SUCCESS)
     {
-        status = hipblasTpsv<T>(handle, uplo, transA, diag, N, dAP, dx_or_b, incx);
-
-        if(status != HIPBLAS_STATUS_SUCCESS)
-        {
-            hipblasDestroy(handle);
-            return status;
-        }
+        hipblas_client_destroy(handle);
+        return status;
     }
 
     // copy output from device to CPU
@@ -162,6 +154,27 @@ hipblasStatus_t testing_tpsv(Arguments argus)
         unit_check_error(error, tolerance);
     }
 
-    hipblasDestroy(handle);
+    if(argus.timing)
+    {
+        hipblas_timing timing;
+        status = hipblas_time_launches(handle, argus, timing, [&] {
+            return hipblasTpsv<T>(handle, uplo, transA, diag, N, dAP, dx_or_b, incx);
+        });
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            hipblas_client_destroy(handle);
+            return status;
+        }
+
+        double gflop = trsv_gflop_count<T>(N);
+        double gbyte = trsv_gbyte_count<T>(N);
+
+        cout << "N,incx,uplo,diag,transA," HIPBLAS_TIMING_COLUMNS << endl;
+        cout << N << ',' << incx << ',' << char_uplo << ',' << char_diag << ',' << char_transA
+             << ',';
+        hipblas_print_timing(cout, timing, gflop, gbyte);
+    }
+
+    hipblas_client_destroy(handle);
     return HIPBLAS_STATUS_SUCCESS;
 }
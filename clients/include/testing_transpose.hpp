@@ -0,0 +1,116 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "flops.h"
+#include "hipblas.hpp"
+#include "unit.h"
+#include "utility.h"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+// A = op(A) in place for argus.transA_option: element (i, j) of the result is the element first
+// at (j, i), conjugated for 'C'; 'N' leaves A as it is. The padding rows keep their values
+template <typename T>
+hipblasStatus_t testing_transpose(Arguments argus)
+{
+    int N   = argus.N;
+    int lda = argus.lda;
+
+    hipblasOperation_t trans = char2hipblas_operation(argus.transA_option);
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    if(N < 0 || lda < max(1, N))
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    if(N == 0)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    int A_size = lda * N;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA(A_size);
+    host_vector<T> hA_gold(A_size);
+
+    device_vector<T> dA(A_size);
+    device_vector<T> dA0(A_size);
+
+    hipblasHandle_t handle;
+    hipblas_client_create(&handle);
+
+    // Initial Data on CPU
+    srand(1);
+    hipblas_init<T>(hA, 1, A_size, 1);
+    hA_gold = hA;
+
+    if(trans != HIPBLAS_OP_N)
+        for(int j = 0; j < N; j++)
+            for(int i = 0; i < N; i++)
+            {
+                T source = hA[j + i * lda];
+                hA_gold[i + j * lda]
+                    = trans == HIPBLAS_OP_C ? hipblas_conjugate(source) : source;
+            }
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * A_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dA0, hA.data(), sizeof(T) * A_size, hipMemcpyHostToDevice));
+
+    /* =====================================================================
+           HIPBLAS
+    =================================================================== */
+
+    status = hipblasTranspose<T>(handle, trans, N, dA, lda);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    CHECK_HIP_ERROR(hipMemcpy(hA.data(), dA, sizeof(T) * A_size, hipMemcpyDeviceToHost));
+
+    if(argus.unit_check)
+    {
+        unit_check_general<T>(1, A_size, 1, hA_gold.data(), hA.data());
+    }
+
+    if(argus.timing)
+    {
+        // the timed calls work in place, so each gets the original matrix back first
+        hipblas_timing timing;
+        status = hipblas_time_launches(
+            handle,
+            argus,
+            timing,
+            [&] { return hipblas_restore_input(handle, dA, dA0, sizeof(T) * A_size); },
+            [&] { return hipblasTranspose<T>(handle, trans, N, dA, lda); });
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            hipblas_client_destroy(handle);
+            return status;
+        }
+
+        double gbyte = trans == HIPBLAS_OP_N ? 0.0 : transpose_gbyte_count<T>(N);
+
+        cout << "trans,N,lda," HIPBLAS_TIMING_COLUMNS << endl;
+        cout << argus.transA_option << ',' << N << ',' << lda << ',';
+        hipblas_print_timing(cout, timing, 0.0, gbyte);
+    }
+
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,131 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "flops.h"
+#include "hipblas.hpp"
+#include "unit.h"
+#include "utility.h"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+template <typename T>
+hipblasStatus_t testing_transpose_batched(Arguments argus)
+{
+    int N           = argus.N;
+    int lda         = argus.lda;
+    int batch_count = argus.batch_count;
+
+    hipblasOperation_t trans = char2hipblas_operation(argus.transA_option);
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    if(N < 0 || lda < max(1, N) || batch_count < 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    if(N == 0 || batch_count == 0)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    int A_size = lda * N;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA[batch_count];
+    host_vector<T> hA_gold[batch_count];
+
+    device_batch_vector<T> bA(batch_count, A_size);
+    device_batch_vector<T> bA0(batch_count, A_size);
+
+    device_vector<T*, 0, T> dA(batch_count);
+
+    hipblasHandle_t handle;
+    hipblas_client_create(&handle);
+
+    // Initial Data on CPU
+    srand(1);
+    for(int b = 0; b < batch_count; b++)
+    {
+        hA[b] = host_vector<T>(A_size);
+
+        hipblas_init<T>(hA[b], 1, A_size, 1);
+        hA_gold[b] = hA[b];
+
+        if(trans != HIPBLAS_OP_N)
+            for(int j = 0; j < N; j++)
+                for(int i = 0; i < N; i++)
+                {
+                    T source = hA[b][j + i * lda];
+                    hA_gold[b][i + j * lda]
+                        = trans == HIPBLAS_OP_C ? hipblas_conjugate(source) : source;
+                }
+
+        CHECK_HIP_ERROR(hipMemcpy(bA[b], hA[b].data(), sizeof(T) * A_size, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(
+            hipMemcpy(bA0[b], hA[b].data(), sizeof(T) * A_size, hipMemcpyHostToDevice));
+    }
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, bA, sizeof(T*) * batch_count, hipMemcpyHostToDevice));
+
+    /* =====================================================================
+           HIPBLAS
+    =================================================================== */
+
+    status = hipblasTransposeBatched<T>(handle, trans, N, dA, lda, batch_count);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    // copy output from device to CPU
+    for(int b = 0; b < batch_count; b++)
+        CHECK_HIP_ERROR(hipMemcpy(hA[b].data(), bA[b], sizeof(T) * A_size, hipMemcpyDeviceToHost));
+
+    if(argus.unit_check)
+    {
+        for(int b = 0; b < batch_count; b++)
+            unit_check_general<T>(1, A_size, 1, hA_gold[b].data(), hA[b].data());
+    }
+
+    if(argus.timing)
+    {
+        // the timed calls work in place, so each gets the original matrices back first
+        auto restore = [&] {
+            hipblasStatus_t restore_status = HIPBLAS_STATUS_SUCCESS;
+            for(int b = 0; b < batch_count && restore_status == HIPBLAS_STATUS_SUCCESS; b++)
+                restore_status = hipblas_restore_input(handle, bA[b], bA0[b], sizeof(T) * A_size);
+            return restore_status;
+        };
+        hipblas_timing timing;
+        status = hipblas_time_launches(handle, argus, timing, restore, [&] {
+            return hipblasTransposeBatched<T>(handle, trans, N, dA, lda, batch_count);
+        });
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            hipblas_client_destroy(handle);
+            return status;
+        }
+
+        double gbyte = trans == HIPBLAS_OP_N ? 0.0 : transpose_gbyte_count<T>(N) * batch_count;
+
+        cout << "trans,N,lda,batch_count," HIPBLAS_TIMING_COLUMNS << endl;
+        cout << argus.transA_option << ',' << N << ',' << lda << ',' << batch_count << ',';
+        hipblas_print_timing(cout, timing, 0.0, gbyte);
+    }
+
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,124 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "flops.h"
+#include "hipblas.hpp"
+#include "unit.h"
+#include "utility.h"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+// what lies between the batches, with a stride_scale above 1, must keep its values
+template <typename T>
+hipblasStatus_t testing_transpose_strided_batched(Arguments argus)
+{
+    int    N            = argus.N;
+    int    lda          = argus.lda;
+    int    batch_count  = argus.batch_count;
+    double stride_scale = argus.stride_scale;
+
+    hipblasOperation_t trans = char2hipblas_operation(argus.transA_option);
+
+    long long strideA = lda * N * stride_scale;
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    if(N < 0 || lda < max(1, N) || batch_count < 0 || strideA < (long long)lda * N)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    if(N == 0 || batch_count == 0)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    size_t A_size = strideA * batch_count;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA(A_size);
+    host_vector<T> hA_gold(A_size);
+
+    device_vector<T> dA(A_size);
+    device_vector<T> dA0(A_size);
+
+    hipblasHandle_t handle;
+    hipblas_client_create(&handle);
+
+    // Initial Data on CPU
+    srand(1);
+    hipblas_init<T>(hA, 1, A_size, 1);
+    hA_gold = hA;
+
+    if(trans != HIPBLAS_OP_N)
+        for(int b = 0; b < batch_count; b++)
+            for(int j = 0; j < N; j++)
+                for(int i = 0; i < N; i++)
+                {
+                    T source = hA[b * strideA + j + i * lda];
+                    hA_gold[b * strideA + i + j * lda]
+                        = trans == HIPBLAS_OP_C ? hipblas_conjugate(source) : source;
+                }
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * A_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dA0, hA.data(), sizeof(T) * A_size, hipMemcpyHostToDevice));
+
+    /* =====================================================================
+           HIPBLAS
+    =================================================================== */
+
+    status = hipblasTransposeStridedBatched<T>(handle, trans, N, dA, lda, strideA, batch_count);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    CHECK_HIP_ERROR(hipMemcpy(hA.data(), dA, sizeof(T) * A_size, hipMemcpyDeviceToHost));
+
+    if(argus.unit_check)
+    {
+        unit_check_general<T>(1, A_size, 1, hA_gold.data(), hA.data());
+    }
+
+    if(argus.timing)
+    {
+        // the timed calls work in place, so each gets the original matrices back first
+        hipblas_timing timing;
+        status = hipblas_time_launches(
+            handle,
+            argus,
+            timing,
+            [&] { return hipblas_restore_input(handle, dA, dA0, sizeof(T) * A_size); },
+            [&] {
+                return hipblasTransposeStridedBatched<T>(
+                    handle, trans, N, dA, lda, strideA, batch_count);
+            });
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            hipblas_client_destroy(handle);
+            return status;
+        }
+
+        double gbyte = trans == HIPBLAS_OP_N ? 0.0 : transpose_gbyte_count<T>(N) * batch_count;
+
+        cout << "trans,N,lda,stride_scale,batch_count," HIPBLAS_TIMING_COLUMNS << endl;
+        cout << argus.transA_option << ',' << N << ',' << lda << ',' << stride_scale << ','
+             << batch_count << ',';
+        hipblas_print_timing(cout, timing, 0.0, gbyte);
+    }
+
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
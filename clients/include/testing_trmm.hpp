@@ -61,7 +61,7 @@ hipblasStatus_t testing_trmm(Arguments argus)
     double hipblasGflops, cblas_gflops;
 
     hipblasHandle_t handle;
-    hipblasCreate(&handle);
+    hipblas_client_create(&handle);
 
     // Initial Data on CPU
     srand(1);
@@ -80,7 +80,7 @@ hipblasStatus_t testing_trmm(Arguments argus)
 
     if(status != HIPBLAS_STATUS_SUCCESS)
     {
-        hipblasDestroy(handle);
+        hipblas_client_destroy(handle);
         return status;
     }
 
@@ -103,6 +103,6 @@ hipblasStatus_t testing_trmm(Arguments argus)
         }
     }
 
-    hipblasDestroy(handle);
+    hipblas_client_destroy(handle);
     return HIPBLAS_STATUS_SUCCESS;
 }
@@ -52,7 +52,7 @@ hipblasStatus_t testing_trmm_batched(Arguments argus)
     }
 
     hipblasHandle_t handle;
-    hipblasCreate(&handle);
+    hipblas_client_create(&handle);
 
     double gpu_time_used, cpu_time_used;
     double hipblasGflops, cblas_gflops, hipblasBandwidth;
@@ -77,7 +77,7 @@ hipblasStatus_t testing_trmm_batched(Arguments argus)
     int last = batch_count - 1;
     if(!dA_array || !dB_array || (!bA_array[last] && A_size) || (!bB_array[last] && B_size))
     {
-        hipblasDestroy(handle);
+        hipblas_client_destroy(handle);
         return HIPBLAS_STATUS_ALLOC_FAILED;
     }
 
@@ -102,7 +102,7 @@ hipblasStatus_t testing_trmm_batched(Arguments argus)
 
         if(err_A != hipSuccess || err_B != hipSuccess)
         {
-            hipblasDestroy(handle);
+            hipblas_client_destroy(handle);
             return HIPBLAS_STATUS_MAPPING_ERROR;
         }
     }
@@ -111,7 +111,7 @@ hipblasStatus_t testing_trmm_batched(Arguments argus)
     err_B = hipMemcpy(dB_array, bB_array, batch_count * sizeof(T*), hipMemcpyHostToDevice);
     if(err_A != hipSuccess || err_B != hipSuccess)
     {
-        hipblasDestroy(handle);
+        hipblas_client_destroy(handle);
         return HIPBLAS_STATUS_MAPPING_ERROR;
     }
 
@@ -136,7 +136,7 @@ hipblasStatus_t testing_trmm_batched(Arguments argus)
 
         if(status != HIPBLAS_STATUS_SUCCESS)
         {
-            hipblasDestroy(handle);
+            hipblas_client_destroy(handle);
             return status;
         }
     }
@@ -153,11 +153,10 @@ hipblasStatus_t testing_trmm_batched(Arguments argus)
            CPU BLAS
         =================================================================== */
 
-        for(int b = 0; b < batch_count; b++)
-        {
+        hipblas_batch_for(batch_count, [&](int b) {
             cblas_trmm<T>(
                 side, uplo, transA, diag, M, N, alpha, hA_array[b], lda, hB_array[b], ldb);
-        }
+        });
 
         // enable unit check, notice unit check is not invasive, but norm check is,
         // unit check and norm check can not be interchanged their order
@@ -167,6 +166,6 @@ hipblasStatus_t testing_trmm_batched(Arguments argus)
         }
     }
 
-    hipblasDestroy(handle);
+    hipblas_client_destroy(handle);
     return HIPBLAS_STATUS_SUCCESS;
 }
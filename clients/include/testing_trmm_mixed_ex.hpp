@@ -0,0 +1,177 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "cblas_interface.h"
+#include "flops.h"
+#include "hipblas.hpp"
+#include "unit.h"
+#include "utility.h"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+// B = alpha op(A) B, or alpha B op(A), for an fp16, bf16 or fp32 A and B with fp32 compute, with
+// alpha on the host and then on the device. A's triangle is sparse with entries of +-1 and a
+// diagonal of 2 and B holds small integers, so with a power of two alpha every partial sum is
+// exact in the data type and B is compared exactly with the product on the host. The other
+// triangle, a unit diagonal and the rows past k of A hold 7s that must not be read
+template <typename T>
+hipblasStatus_t testing_trmm_mixed_ex(Arguments argus)
+{
+    int M   = argus.M;
+    int N   = argus.N;
+    int lda = argus.lda;
+    int ldb = argus.ldb;
+
+    hipblasSideMode_t  side   = char2hipblas_side(argus.side_option);
+    hipblasFillMode_t  uplo   = char2hipblas_fill(argus.uplo_option);
+    hipblasOperation_t transA = char2hipblas_operation(argus.transA_option);
+    hipblasDiagType_t  diag   = char2hipblas_diagonal(argus.diag_option);
+
+    int K = side == HIPBLAS_SIDE_LEFT ? M : N;
+
+    float alpha = argus.alpha;
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    if(M < 0 || N < 0 || lda < max(1, K) || ldb < max(1, M))
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    if(M == 0 || N == 0)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    int A_size = lda * K;
+    int B_size = ldb * N;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<float> hA_float(A_size);
+    host_vector<float> hX_float(B_size);
+    host_vector<T>     hA(A_size);
+    host_vector<T>     hB(B_size);
+    host_vector<T>     hB_gold(B_size);
+    host_vector<T>     hB_host(B_size);
+    host_vector<T>     hB_device(B_size);
+
+    device_vector<T>     dA(A_size);
+    device_vector<T>     dB(B_size);
+    device_vector<float> dalpha(1);
+
+    hipblasHandle_t handle;
+    hipblas_client_create(&handle);
+
+    // Initial Data on CPU
+    for(int c = 0; c < K; c++)
+        for(int r = 0; r < lda; r++)
+        {
+            bool stored = r < K && (uplo == HIPBLAS_FILL_MODE_UPPER ? r < c : r > c);
+            hA_float[r + c * lda]
+                = r == c && diag == HIPBLAS_DIAG_NON_UNIT ? 2
+                  : !stored                               ? 7
+                  : (r * 3 + c) % 5 == 0                  ? ((r + c) % 2 ? 1 : -1)
+                                                          : 0;
+        }
+    for(int j = 0; j < N; j++)
+        for(int i = 0; i < ldb; i++)
+            hX_float[i + j * ldb] = float((i * 7 + j * 3) % 5 - 2);
+
+    host_vector<float> hB_float = hX_float;
+    cblas_trmm<float>(
+        side, uplo, transA, diag, M, N, alpha, hA_float.data(), lda, hB_float.data(), ldb);
+
+    for(int i = 0; i < A_size; i++)
+        hA[i] = hipblas_from_float<T>(hA_float[i]);
+    for(int i = 0; i < B_size; i++)
+    {
+        hB[i]      = hipblas_from_float<T>(hX_float[i]);
+        hB_gold[i] = hipblas_from_float<T>(hB_float[i]);
+    }
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * A_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dalpha, &alpha, sizeof(float), hipMemcpyHostToDevice));
+
+    auto trmm = [&](const float* alpha_ptr) {
+        return hipblasTrmmMixedEx(handle,
+                                  side,
+                                  uplo,
+                                  transA,
+                                  diag,
+                                  M,
+                                  N,
+                                  alpha_ptr,
+                                  dA,
+                                  hipblas_datatype<T>,
+                                  lda,
+                                  dB,
+                                  hipblas_datatype<T>,
+                                  ldb,
+                                  HIPBLAS_R_32F);
+    };
+
+    /* =====================================================================
+           HIPBLAS
+    =================================================================== */
+
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB.data(), sizeof(T) * B_size, hipMemcpyHostToDevice));
+    status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = trmm(&alpha);
+    CHECK_HIP_ERROR(hipMemcpy(hB_host.data(), dB, sizeof(T) * B_size, hipMemcpyDeviceToHost));
+
+    if(status == HIPBLAS_STATUS_SUCCESS)
+    {
+        CHECK_HIP_ERROR(hipMemcpy(dB, hB.data(), sizeof(T) * B_size, hipMemcpyHostToDevice));
+        status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = trmm(dalpha);
+        CHECK_HIP_ERROR(
+            hipMemcpy(hB_device.data(), dB, sizeof(T) * B_size, hipMemcpyDeviceToHost));
+    }
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    if(argus.unit_check)
+    {
+        unit_check_general<T>(M, N, ldb, hB_gold.data(), hB_host.data());
+        unit_check_general<T>(M, N, ldb, hB_gold.data(), hB_device.data());
+    }
+
+    if(argus.timing)
+    {
+        // B is multiplied again in place, with the device alpha the last call left the handle
+        hipblas_timing timing;
+        status = hipblas_time_launches(handle, argus, timing, [&] { return trmm(dalpha); });
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            hipblas_client_destroy(handle);
+            return status;
+        }
+
+        double gflop = trmm_gflop_count<float>(M, N, K);
+        double gbyte = trmm_gbyte_count<T>(M, N, K);
+
+        cout << "side,uplo,transA,diag,M,N,lda,ldb," HIPBLAS_TIMING_COLUMNS << endl;
+        cout << argus.side_option << ',' << argus.uplo_option << ',' << argus.transA_option << ','
+             << argus.diag_option << ',' << M << ',' << N << ',' << lda << ',' << ldb << ',';
+        hipblas_print_timing(cout, timing, gflop, gbyte);
+    }
+
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,199 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "cblas_interface.h"
+#include "flops.h"
+#include "hipblas.hpp"
+#include "unit.h"
+#include "utility.h"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+// The strided batched form of testing_trmm_mixed_ex, every batch with a triangle and B of its
+// own. What lies between the batches, with a stride_scale above 1, is compared too
+template <typename T>
+hipblasStatus_t testing_trmm_mixed_strided_batched_ex(Arguments argus)
+{
+    int    M            = argus.M;
+    int    N            = argus.N;
+    int    lda          = argus.lda;
+    int    ldb          = argus.ldb;
+    int    batch_count  = argus.batch_count;
+    double stride_scale = argus.stride_scale;
+
+    hipblasSideMode_t  side   = char2hipblas_side(argus.side_option);
+    hipblasFillMode_t  uplo   = char2hipblas_fill(argus.uplo_option);
+    hipblasOperation_t transA = char2hipblas_operation(argus.transA_option);
+    hipblasDiagType_t  diag   = char2hipblas_diagonal(argus.diag_option);
+
+    int K = side == HIPBLAS_SIDE_LEFT ? M : N;
+
+    long long strideA = (long long)lda * K * stride_scale;
+    long long strideB = (long long)ldb * N * stride_scale;
+
+    float alpha = argus.alpha;
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    if(M < 0 || N < 0 || lda < max(1, K) || ldb < max(1, M) || batch_count < 0
+       || strideA < (long long)lda * K || strideB < (long long)ldb * N)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    if(M == 0 || N == 0 || batch_count == 0)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    size_t A_size = strideA * batch_count;
+    size_t B_size = strideB * batch_count;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<float> hA_float(A_size);
+    host_vector<float> hX_float(B_size);
+    host_vector<T>     hA(A_size);
+    host_vector<T>     hB(B_size);
+    host_vector<T>     hB_gold(B_size);
+    host_vector<T>     hB_host(B_size);
+    host_vector<T>     hB_device(B_size);
+
+    device_vector<T>     dA(A_size);
+    device_vector<T>     dB(B_size);
+    device_vector<float> dalpha(1);
+
+    hipblasHandle_t handle;
+    hipblas_client_create(&handle);
+
+    // Initial Data on CPU; the gaps between the batches hold 7s in A and small integers in B
+    for(size_t i = 0; i < A_size; i++)
+        hA_float[i] = 7;
+    for(size_t i = 0; i < B_size; i++)
+        hX_float[i] = float(i % 5) - 2;
+    for(int b = 0; b < batch_count; b++)
+        for(int c = 0; c < K; c++)
+            for(int r = 0; r < K; r++)
+            {
+                bool stored = uplo == HIPBLAS_FILL_MODE_UPPER ? r < c : r > c;
+                if(r == c && diag == HIPBLAS_DIAG_NON_UNIT)
+                    hA_float[b * strideA + r + c * lda] = 2;
+                else if(stored)
+                    hA_float[b * strideA + r + c * lda]
+                        = (r * 3 + c + b) % 5 == 0 ? ((r + c) % 2 ? 1 : -1) : 0;
+            }
+
+    host_vector<float> hB_float = hX_float;
+    for(int b = 0; b < batch_count; b++)
+        cblas_trmm<float>(side,
+                          uplo,
+                          transA,
+                          diag,
+                          M,
+                          N,
+                          alpha,
+                          hA_float.data() + b * strideA,
+                          lda,
+                          hB_float.data() + b * strideB,
+                          ldb);
+
+    for(size_t i = 0; i < A_size; i++)
+        hA[i] = hipblas_from_float<T>(hA_float[i]);
+    for(size_t i = 0; i < B_size; i++)
+    {
+        hB[i]      = hipblas_from_float<T>(hX_float[i]);
+        hB_gold[i] = hipblas_from_float<T>(hB_float[i]);
+    }
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * A_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dalpha, &alpha, sizeof(float), hipMemcpyHostToDevice));
+
+    auto trmm = [&](const float* alpha_ptr) {
+        return hipblasTrmmMixedStridedBatchedEx(handle,
+                                                side,
+                                                uplo,
+                                                transA,
+                                                diag,
+                                                M,
+                                                N,
+                                                alpha_ptr,
+                                                dA,
+                                                hipblas_datatype<T>,
+                                                lda,
+                                                strideA,
+                                                dB,
+                                                hipblas_datatype<T>,
+                                                ldb,
+                                                strideB,
+                                                batch_count,
+                                                HIPBLAS_R_32F);
+    };
+
+    /* =====================================================================
+           HIPBLAS
+    =================================================================== */
+
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB.data(), sizeof(T) * B_size, hipMemcpyHostToDevice));
+    status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = trmm(&alpha);
+    CHECK_HIP_ERROR(hipMemcpy(hB_host.data(), dB, sizeof(T) * B_size, hipMemcpyDeviceToHost));
+
+    if(status == HIPBLAS_STATUS_SUCCESS)
+    {
+        CHECK_HIP_ERROR(hipMemcpy(dB, hB.data(), sizeof(T) * B_size, hipMemcpyHostToDevice));
+        status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = trmm(dalpha);
+        CHECK_HIP_ERROR(
+            hipMemcpy(hB_device.data(), dB, sizeof(T) * B_size, hipMemcpyDeviceToHost));
+    }
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    if(argus.unit_check)
+    {
+        // all of B, the gaps between the batches too
+        unit_check_general<T>(1, B_size, 1, hB_gold.data(), hB_host.data());
+        unit_check_general<T>(1, B_size, 1, hB_gold.data(), hB_device.data());
+    }
+
+    if(argus.timing)
+    {
+        // B is multiplied again in place, with the device alpha the last call left the handle
+        hipblas_timing timing;
+        status = hipblas_time_launches(handle, argus, timing, [&] { return trmm(dalpha); });
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            hipblas_client_destroy(handle);
+            return status;
+        }
+
+        double gflop = trmm_gflop_count<float>(M, N, K) * batch_count;
+        double gbyte = trmm_gbyte_count<T>(M, N, K) * batch_count;
+
+        cout << "side,uplo,transA,diag,M,N,lda,stride_a,ldb,stride_b,batch_count,"
+                HIPBLAS_TIMING_COLUMNS
+             << endl;
+        cout << argus.side_option << ',' << argus.uplo_option << ',' << argus.transA_option << ','
+             << argus.diag_option << ',' << M << ',' << N << ',' << lda << ',' << strideA << ','
+             << ldb << ',' << strideB << ',' << batch_count << ',';
+        hipblas_print_timing(cout, timing, gflop, gbyte);
+    }
+
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
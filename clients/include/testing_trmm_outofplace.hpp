@@ -0,0 +1,111 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "cblas_interface.h"
+#include "hipblas.hpp"
+#include "norm.h"
+#include "unit.h"
+#include "utility.h"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+// hipblasTrmmOutOfPlace with C apart from B and ldc != ldb. C must match the in-place reference
+// and B must be left as it was
+template <typename T>
+hipblasStatus_t testing_trmm_outofplace(Arguments argus)
+{
+    int M   = argus.M;
+    int N   = argus.N;
+    int lda = argus.lda;
+    int ldb = argus.ldb;
+    int ldc = ldb + 2;
+
+    char char_side   = argus.side_option;
+    char char_uplo   = argus.uplo_option;
+    char char_transA = argus.transA_option;
+    char char_diag   = argus.diag_option;
+    T    alpha       = argus.alpha;
+
+    hipblasSideMode_t  side   = char2hipblas_side(char_side);
+    hipblasFillMode_t  uplo   = char2hipblas_fill(char_uplo);
+    hipblasOperation_t transA = char2hipblas_operation(char_transA);
+    hipblasDiagType_t  diag   = char2hipblas_diagonal(char_diag);
+
+    int K      = (side == HIPBLAS_SIDE_LEFT ? M : N);
+    int A_size = lda * K;
+    int B_size = ldb * N;
+    int C_size = ldc * N;
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+
+    // check here to prevent undefined memory allocation error
+    if(M < 0 || N < 0 || lda < K || ldb < M)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA(A_size);
+    host_vector<T> hB(B_size);
+    host_vector<T> hB_gpu(B_size);
+    host_vector<T> hC_cpu(C_size);
+    host_vector<T> hC_gpu(C_size);
+
+    device_vector<T> dA(A_size);
+    device_vector<T> dB(B_size);
+    device_vector<T> dC(C_size);
+
+    hipblasHandle_t handle;
+    hipblas_client_create(&handle);
+
+    // Initial Data on CPU
+    srand(1);
+    hipblas_init_symmetric<T>(hA, K, lda);
+    hipblas_init<T>(hB, M, N, ldb);
+    for(int j = 0; j < N; j++)
+        for(int i = 0; i < M; i++)
+            hC_cpu[i + j * ldc] = hB[i + j * ldb];
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * A_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB.data(), sizeof(T) * B_size, hipMemcpyHostToDevice));
+
+    /* =====================================================================
+           ROCBLAS
+    =================================================================== */
+    status = hipblasTrmmOutOfPlace<T>(
+        handle, side, uplo, transA, diag, M, N, &alpha, dA, lda, dB, ldb, dC, ldc);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    // copy output from device to CPU
+    CHECK_HIP_ERROR(hipMemcpy(hC_gpu.data(), dC, sizeof(T) * C_size, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hB_gpu.data(), dB, sizeof(T) * B_size, hipMemcpyDeviceToHost));
+
+    if(argus.unit_check)
+    {
+        /* =====================================================================
+           CPU BLAS
+        =================================================================== */
+
+        cblas_trmm<T>(side, uplo, transA, diag, M, N, alpha, hA.data(), lda, hC_cpu.data(), ldc);
+
+        unit_check_general<T>(M, N, ldc, hC_cpu.data(), hC_gpu.data());
+        unit_check_general<T>(M, N, ldb, hB.data(), hB_gpu.data());
+    }
+
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -66,7 +66,7 @@ hipblasStatus_t testing_trmm_strided_batched(Arguments argus)
     T beta  = argus.get_beta<T>();
 
     hipblasHandle_t handle;
-    hipblasCreate(&handle);
+    hipblas_client_create(&handle);
 
     // Initial Data on CPU
     srand(1);
@@ -102,7 +102,7 @@ hipblasStatus_t testing_trmm_strided_batched(Arguments argus)
         if(status != HIPBLAS_STATUS_SUCCESS)
         {
             // here in cuda
-            hipblasDestroy(handle);
+            hipblas_client_destroy(handle);
             return status;
         }
     }
@@ -116,8 +116,7 @@ hipblasStatus_t testing_trmm_strided_batched(Arguments argus)
            CPU BLAS
         =================================================================== */
 
-        for(int b = 0; b < batch_count; b++)
-        {
+        hipblas_batch_for(batch_count, [&](int b) {
             cblas_trmm<T>(side,
                           uplo,
                           transA,
@@ -129,7 +128,7 @@ hipblasStatus_t testing_trmm_strided_batched(Arguments argus)
                           lda,
                           hB.data() + b * stride_B,
                           ldb);
-        }
+        });
 
         // enable unit check, notice unit check is not invasive, but norm check is,
         // unit check and norm check can not be interchanged their order
@@ -139,6 +138,6 @@ hipblasStatus_t testing_trmm_strided_batched(Arguments argus)
         }
     }
 
-    hipblasDestroy(handle);
+    hipblas_client_destroy(handle);
     return HIPBLAS_STATUS_SUCCESS;
 }
@@ -63,7 +63,7 @@ hipblasStatus_t testing_trmv_strided_batched(Arguments argus)
     T beta  = (T)argus.beta;
 
     hipblasHandle_t handle;
-    hipblasCreate(&handle);
+    hipblas_client_create(&handle);
 
     // Initial Data on CPU
     srand(1);
@@ -86,7 +86,7 @@ hipblasStatus_t testing_trmv_strided_batched(Arguments argus)
         if(status != HIPBLAS_STATUS_SUCCESS)
         {
             // here in cuda
-            hipblasDestroy(handle);
+            hipblas_client_destroy(handle);
             return status;
         }
     }
@@ -100,8 +100,7 @@ hipblasStatus_t testing_trmv_strided_batched(Arguments argus)
            CPU BLAS
         =================================================================== */
 
-        for(int b = 0; b < batch_count; b++)
-        {
+        hipblas_batch_for(batch_count, [&](int b) {
             cblas_trmv<T>(uplo,
                           transA,
                           diag,
@@ -110,7 +109,7 @@ hipblasStatus_t testing_trmv_strided_batched(Arguments argus)
                           lda,
                           hx.data() + b * stride_x,
                           incx);
-        }
+        });
 
         // enable unit check, notice unit check is not invasive, but norm check is,
         // unit check and norm check can not be interchanged their order
@@ -120,6 +119,6 @@ hipblasStatus_t testing_trmv_strided_batched(Arguments argus)
         }
     }
 
-    hipblasDestroy(handle);
+    hipblas_client_destroy(handle);
     return HIPBLAS_STATUS_SUCCESS;
 }
@@ -64,7 +64,7 @@ hipblasStatus_t testing_trsm(Arguments argus)
     double rocblas_error;
 
     hipblasHandle_t handle;
-    hipblasCreate(&handle);
+    hipblas_client_create(&handle);
 
     // Initial hA on CPU
     srand(1);
@@ -145,6 +145,6 @@ hipblasStatus_t testing_trsm(Arguments argus)
         unit_check_error(error, tolerance);
     }
 
-    hipblasDestroy(handle);
+    hipblas_client_destroy(handle);
     return HIPBLAS_STATUS_SUCCESS;
 }
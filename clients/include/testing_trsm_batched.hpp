@@ -77,7 +77,7 @@ hipblasStatus_t testing_trsm_batched(Arguments argus)
     double hipblasGflops, cblas_gflops;
 
     hipblasHandle_t handle;
-    hipblasCreate(&handle);
+    hipblas_client_create(&handle);
 
     // Initial hA on CPU
     srand(1);
@@ -165,8 +165,7 @@ hipblasStatus_t testing_trsm_batched(Arguments argus)
            CPU BLAS
         =================================================================== */
 
-        for(int b = 0; b < batch_count; b++)
-        {
+        hipblas_batch_for(batch_count, [&](int b) {
             cblas_trsm<T>(side,
                           uplo,
                           transA,
@@ -178,7 +177,7 @@ hipblasStatus_t testing_trsm_batched(Arguments argus)
                           lda,
                           hB_copy[b].data(),
                           ldb);
-        }
+        });
 
         // if enable norm check, norm check is invasive
         // any typeinfo(T) will not work here, because template deduction is matched in compilation
@@ -193,6 +192,6 @@ hipblasStatus_t testing_trsm_batched(Arguments argus)
         }
     }
 
-    hipblasDestroy(handle);
+    hipblas_client_destroy(handle);
     return HIPBLAS_STATUS_SUCCESS;
 }
@@ -72,7 +72,7 @@ hipblasStatus_t testing_trsm_strided_batched(Arguments argus)
     double hipblasGflops, cblas_gflops;
 
     hipblasHandle_t handle;
-    hipblasCreate(&handle);
+    hipblas_client_create(&handle);
 
     // Initial hA on CPU
     srand(1);
@@ -150,7 +150,7 @@ hipblasStatus_t testing_trsm_strided_batched(Arguments argus)
 
     if(status != HIPBLAS_STATUS_SUCCESS)
     {
-        hipblasDestroy(handle);
+        hipblas_client_destroy(handle);
         return status;
     }
 
@@ -163,8 +163,7 @@ hipblasStatus_t testing_trsm_strided_batched(Arguments argus)
            CPU BLAS
         =================================================================== */
 
-        for(int b = 0; b < batch_count; b++)
-        {
+        hipblas_batch_for(batch_count, [&](int b) {
             cblas_trsm<T>(side,
                           uplo,
                           transA,
@@ -176,7 +175,7 @@ hipblasStatus_t testing_trsm_strided_batched(Arguments argus)
                           lda,
                           hB_copy.data() + b * strideB,
                           ldb);
-        }
+        });
 
         // if enable norm check, norm check is invasive
         // any typeinfo(T) will not work here, because template deduction is matched in compilation
@@ -192,6 +191,6 @@ hipblasStatus_t testing_trsm_strided_batched(Arguments argus)
         }
     }
 
-    hipblasDestroy(handle);
+    hipblas_client_destroy(handle);
     return HIPBLAS_STATUS_SUCCESS;
 }
@@ -0,0 +1,120 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <stdlib.h>
+#include <vector>
+
+#include "cblas_interface.h"
+#include "hipblas.hpp"
+#include "norm.h"
+#include "unit.h"
+#include "utility.h"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+template <typename T>
+hipblasStatus_t testing_trsm_xt(Arguments argus)
+{
+    int M   = argus.M;
+    int N   = argus.N;
+    int lda = argus.lda;
+    int ldb = argus.ldb;
+
+    hipblasSideMode_t  side   = char2hipblas_side(argus.side_option);
+    hipblasFillMode_t  uplo   = char2hipblas_fill(argus.uplo_option);
+    hipblasOperation_t transA = char2hipblas_operation(argus.transA_option);
+    hipblasDiagType_t  diag   = char2hipblas_diagonal(argus.diag_option);
+    T                  alpha  = argus.alpha;
+
+    int K = (side == HIPBLAS_SIDE_LEFT ? M : N);
+
+    // check here to prevent undefined memory allocation error
+    if(M < 0 || N < 0 || lda < K || ldb < M)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+
+    // Naming: all matrices are in CPU (host) memory, which hipblasXtTrsm streams to the devices
+    host_vector<T> hA(lda * K);
+    host_vector<T> hB(ldb * N);
+    host_vector<T> hB_gold(ldb * N);
+
+    hipblasHandle_t handle;
+    hipblas_client_create(&handle);
+
+    // A small block so that the test sizes span several panels and solve steps, spread over every
+    // device in the node
+    int             device_count = 0;
+    hipblasStatus_t status       = hipblasXtSetBlockDim(handle, 64);
+    CHECK_HIP_ERROR(hipGetDeviceCount(&device_count));
+    vector<int> devices(device_count);
+    for(int d = 0; d < device_count; d++)
+        devices[d] = d;
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasXtDeviceSelect(handle, device_count, devices.data());
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    // Initial hA on CPU, factored as in testing_trsm to keep it well conditioned
+    srand(1);
+    hipblas_init_symmetric<T>(hA, K, lda);
+    for(int i = K; i < lda; i++)
+    {
+        for(int j = 0; j < K; j++)
+        {
+            hA[i + j * lda] = 0.0;
+        }
+    }
+    vector<int> ipiv(K);
+    cblas_getrf(K, K, hA.data(), lda, ipiv.data());
+    for(int i = 0; i < K; i++)
+    {
+        for(int j = i; j < K; j++)
+        {
+            hA[i + j * lda] = hA[j + i * lda];
+            if(diag == HIPBLAS_DIAG_UNIT && i == j)
+                hA[i + j * lda] = 1.0;
+        }
+    }
+
+    hipblas_init<T>(hB, M, N, ldb);
+    cblas_trmm<T>(
+        side, uplo, transA, diag, M, N, T(1.0) / alpha, (const T*)hA.data(), lda, hB.data(), ldb);
+    hB_gold = hB;
+
+    /* =====================================================================
+           HIPBLAS
+    =================================================================== */
+    status = hipblasXtTrsm<T>(
+        handle, side, uplo, transA, diag, M, N, &alpha, hA.data(), lda, hB.data(), ldb);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    if(argus.unit_check)
+    {
+        cblas_trsm<T>(
+            side, uplo, transA, diag, M, N, alpha, (const T*)hA.data(), lda, hB_gold.data(), ldb);
+
+        real_t<T> eps       = std::numeric_limits<real_t<T>>::epsilon();
+        double    tolerance = eps * 40 * M;
+
+        double error = norm_check_general<T>('F', M, N, ldb, hB_gold.data(), hB.data());
+        unit_check_error(error, tolerance);
+    }
+
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
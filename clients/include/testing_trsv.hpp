@@ -72,7 +72,7 @@ hipblasStatus_t testing_trsv(Arguments argus)
     double hipblasGflops, cblas_gflops, hipblasBandwidth;
 
     hipblasHandle_t handle;
-    hipblasCreate(&handle);
+    hipblas_client_create(&handle);
 
     // Initial Data on CPU
     srand(1);
@@ -142,20 +142,12 @@ hipblasStatus_t testing_trsv(Arguments argus)
     /* =====================================================================
            ROCBLAS
     =================================================================== */
-    if(argus.timing)
-    {
-        gpu_time_used = get_time_us(); // in microseconds
-    }
+    status = hipblasTrsv<T>(handle, uplo, transA, diag, M, dA, lda, dx_or_b, incx);
 
-    for(int iter = 0; iter < 1; iter++)
+    if(status != HIPBLAS_STATUS_SUCCESS)
     {
-        status = hipblasTrsv<T>(handle, uplo, transA, diag, M, dA, lda, dx_or_b, incx);
-
-        if(status != HIPBLAS_STATUS_SUCCESS)
-        {
-            hipblasDestroy(handle);
-            return status;
-        }
+        hipblas_client_destroy(handle);
+        return status;
     }
 
     // copy output from device to CPU
@@ -184,6 +176,27 @@ hipblasStatus_t testing_trsv(Arguments argus)
         }
     }
 
-    hipblasDestroy(handle);
+    if(argus.timing)
+    {
+        hipblas_timing timing;
+        status = hipblas_time_launches(handle, argus, timing, [&] {
+            return hipblasTrsv<T>(handle, uplo, transA, diag, M, dA, lda, dx_or_b, incx);
+        });
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            hipblas_client_destroy(handle);
+            return status;
+        }
+
+        double gflop = trsv_gflop_count<T>(M);
+        double gbyte = trsv_gbyte_count<T>(M);
+
+        cout << "M,incx,lda,uplo,diag,transA," HIPBLAS_TIMING_COLUMNS << endl;
+        cout << M << ',' << incx << ',' << lda << ',' << char_uplo << ',' << char_diag << ','
+             << char_transA << ',';
+        hipblas_print_timing(cout, timing, gflop, gbyte);
+    }
+
+    hipblas_client_destroy(handle);
     return HIPBLAS_STATUS_SUCCESS;
 }
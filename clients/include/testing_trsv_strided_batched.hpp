@@ -69,7 +69,7 @@ hipblasStatus_t testing_trsv_strided_batched(Arguments argus)
     double hipblasGflops, cblas_gflops, hipblasBandwidth;
 
     hipblasHandle_t handle;
-    hipblasCreate(&handle);
+    hipblas_client_create(&handle);
 
     // Initial Data on CPU
     srand(1);
@@ -133,21 +133,13 @@ hipblasStatus_t testing_trsv_strided_batched(Arguments argus)
     /* =====================================================================
            ROCBLAS
     =================================================================== */
-    if(argus.timing)
-    {
-        gpu_time_used = get_time_us(); // in microseconds
-    }
+    status = hipblasTrsvStridedBatched<T>(
+        handle, uplo, transA, diag, M, dA, lda, strideA, dx_or_b, incx, stridex, batch_count);
 
-    for(int iter = 0; iter < 1; iter++)
+    if(status != HIPBLAS_STATUS_SUCCESS)
     {
-        status = hipblasTrsvStridedBatched<T>(
-            handle, uplo, transA, diag, M, dA, lda, strideA, dx_or_b, incx, stridex, batch_count);
-
-        if(status != HIPBLAS_STATUS_SUCCESS)
-        {
-            hipblasDestroy(handle);
-            return status;
-        }
+        hipblas_client_destroy(handle);
+        return status;
     }
 
     // copy output from device to CPU
@@ -178,6 +170,39 @@ hipblasStatus_t testing_trsv_strided_batched(Arguments argus)
         }
     }
 
-    hipblasDestroy(handle);
+    if(argus.timing)
+    {
+        hipblas_timing timing;
+        status = hipblas_time_launches(handle, argus, timing, [&] {
+            return hipblasTrsvStridedBatched<T>(handle,
+                                                uplo,
+                                                transA,
+                                                diag,
+                                                M,
+                                                dA,
+                                                lda,
+                                                strideA,
+                                                dx_or_b,
+                                                incx,
+                                                stridex,
+                                                batch_count);
+        });
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            hipblas_client_destroy(handle);
+            return status;
+        }
+
+        double gflop = trsv_gflop_count<T>(M) * batch_count;
+        double gbyte = trsv_gbyte_count<T>(M) * batch_count;
+
+        cout << "M,incx,lda,uplo,diag,transA,stride_scale,batch_count," HIPBLAS_TIMING_COLUMNS
+             << endl;
+        cout << M << ',' << incx << ',' << lda << ',' << char_uplo << ',' << char_diag << ','
+             << char_transA << ',' << stride_scale << ',' << batch_count << ',';
+        hipblas_print_timing(cout, timing, gflop, gbyte);
+    }
+
+    hipblas_client_destroy(handle);
     return HIPBLAS_STATUS_SUCCESS;
 }
@@ -22,105 +22,85 @@ using namespace std;
 template <typename T>
 hipblasStatus_t testing_trtri(Arguments argus)
 {
+    int N      = argus.N;
+    int lda    = argus.lda;
+    int ldinvA = argus.lda;
 
-    int N = argus.N;
-    int lda;
-    int ldinvA;
-    ldinvA = lda = argus.lda;
+    char char_uplo = argus.uplo_option;
+    char char_diag = argus.diag_option;
+
+    hipblasFillMode_t uplo = char2hipblas_fill(char_uplo);
+    hipblasDiagType_t diag = char2hipblas_diagonal(char_diag);
 
     int A_size = lda * N;
 
     hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
 
-    // check here to prevent undefined memory allocation error
-    if(N < 0 || lda < 0)
+    // Check to prevent memory allocation error
+    if(N < 0 || lda < N)
     {
         return HIPBLAS_STATUS_INVALID_VALUE;
     }
-    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
-    vector<T> hA(A_size);
-    vector<T> hB(A_size);
 
-    T *dA, *dinvA;
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA(A_size);
+    host_vector<T> hinvA1(A_size);
 
-    double gpu_time_used, cpu_time_used;
-    double hipblasGflops, cblas_gflops;
-    double rocblas_error;
+    device_vector<T> dA(A_size);
+    device_vector<T> dinvA(A_size);
 
     hipblasHandle_t handle;
+    hipblas_client_create(&handle);
 
-    char char_uplo = argus.uplo_option;
-    char char_diag = argus.diag_option;
-
-    hipblasFillMode_t uplo = char2hipblasFillMode_t(char_uplo);
-    hipblasDiagType_t diag = char2hipblasDiagType_t(char_diag);
-
-    hipblasCreate(&handle);
-
-    // allocate memory on device
-    CHECK_HIP_ERROR(hipMalloc(&dA, A_size * sizeof(T)));
-    CHECK_HIP_ERROR(hipMalloc(&dinvA, A_size * sizeof(T)));
-
-    // Initial Data on CPU
+    // Initial hA on CPU
     srand(1);
-    hipblas_init_symmetric<T>(hA, N, lda);
-
-    // proprocess the matrix to avoid ill-conditioned matrix
-    for(int i = 0; i < N; i++)
+    hipblas_init<T>(hA, N, N, lda);
+    // A is made triangular; its diagonal is boosted, or set to 1 for a unit diagonal
+    for(int j = 0; j < N; j++)
     {
-        for(int j = 0; j < N; j++)
+        for(int i = 0; i < N; i++)
         {
-            hA[i + j * lda] *= 0.01;
-
-            if(j % 2)
-                hA[i + j * lda] *= -1;
             if(i == j)
-            {
-                if(diag == HIPBLAS_DIAG_UNIT)
-                    hA[i + j * lda] = 1.0;
-                else
-                    hA[i + j * lda] *= 100.0;
-            }
+                hA[i + j * lda] = char_diag == 'U' ? T(1) : hA[i + j * lda] + T(10 * N);
+            else if(char_uplo == 'U' ? i > j : i < j)
+                hA[i + j * lda] = T(0);
         }
     }
-    hB = hA;
 
-    // copy data from CPU to device
-    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * A_size, hipMemcpyHostToDevice));
+    // Copy data from CPU to device; invA starts as A so the triangle not written stays zero
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), A_size * sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dinvA, hA.data(), A_size * sizeof(T), hipMemcpyHostToDevice));
 
     /* =====================================================================
-           ROCBLAS
+           HIPBLAS
     =================================================================== */
+
     status = hipblasTrtri<T>(handle, uplo, diag, N, dA, lda, dinvA, ldinvA);
 
-    // copy output from device to CPU
-    CHECK_HIP_ERROR(hipMemcpy(hA.data(), dinvA, sizeof(T) * A_size, hipMemcpyDeviceToHost));
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    // Copy output from device to CPU
+    CHECK_HIP_ERROR(hipMemcpy(hinvA1.data(), dinvA, A_size * sizeof(T), hipMemcpyDeviceToHost));
 
     if(argus.unit_check)
     {
         /* =====================================================================
-           CPU BLAS
+           CPU LAPACK
         =================================================================== */
 
-        int info = cblas_trtri<T>(char_uplo, char_diag, N, hB.data(), lda);
-
-        if(info != 0)
-            printf("error in cblas_trtri\n");
+        cblas_trtri<T>(char_uplo, char_diag, N, hA.data(), lda);
 
-#ifndef NDEBUG
-        print_matrix(hB, hA, N, N, lda);
-#endif
+        real_t<T> eps       = std::numeric_limits<real_t<T>>::epsilon();
+        double    tolerance = eps * 2000;
 
-        // enable unit check, notice unit check is not invasive, but norm check is,
-        // unit check and norm check can not be interchanged their order
-        if(argus.unit_check)
-        {
-            unit_check_general<T>(N, N, lda, hB.data(), hA.data());
-        }
+        double e = norm_check_general<T>('M', N, N, lda, hA.data(), hinvA1.data());
+        unit_check_error(e, tolerance);
     }
 
-    CHECK_HIP_ERROR(hipFree(dA));
-    CHECK_HIP_ERROR(hipFree(dinvA));
-    hipblasDestroy(handle);
+    hipblas_client_destroy(handle);
     return HIPBLAS_STATUS_SUCCESS;
 }
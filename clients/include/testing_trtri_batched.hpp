@@ -22,123 +22,108 @@ using namespace std;
 template <typename T>
 hipblasStatus_t testing_trtri_batched(Arguments argus)
 {
-
     int N           = argus.N;
     int lda         = argus.lda;
+    int ldinvA      = argus.lda;
     int batch_count = argus.batch_count;
 
-    int A_size = lda * N * batch_count;
-    int bsa    = lda * N;
+    char char_uplo = argus.uplo_option;
+    char char_diag = argus.diag_option;
+
+    hipblasFillMode_t uplo = char2hipblas_fill(char_uplo);
+    hipblasDiagType_t diag = char2hipblas_diagonal(char_diag);
+
+    int A_size = lda * N;
 
     hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
 
-    // argument sanity check, quick return if input parameters are invalid before allocating invalid
-    // memory
-    if(N < 0)
-    {
-        status = HIPBLAS_STATUS_INVALID_VALUE;
-        return status;
-    }
-    else if(lda < 0)
+    // Check to prevent memory allocation error
+    if(N < 0 || lda < N || batch_count < 0)
     {
-        status = HIPBLAS_STATUS_INVALID_VALUE;
-        return status;
+        return HIPBLAS_STATUS_INVALID_VALUE;
     }
-    else if(batch_count < 0)
+    if(batch_count == 0)
     {
-        status = HIPBLAS_STATUS_INVALID_VALUE;
-        return status;
+        return HIPBLAS_STATUS_SUCCESS;
     }
 
     // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
-    vector<T> hB(A_size);
-    vector<T> hA;
-
-    // Initial Data on CPU
-    srand(1);
-    vector<T> hA_sub(bsa);
-    for(size_t i = 0; i < batch_count; i++)
-    {
-        hipblas_init_symmetric<T>(hA_sub, N, lda);
-        for(int j = 0; j < bsa; j++)
-        {
-            hA.push_back(hA_sub[j]);
-        }
-    }
-    hB = hA;
+    host_vector<T> hA[batch_count];
+    host_vector<T> hinvA1[batch_count];
 
-    T *dA, *dinvA;
+    device_batch_vector<T> bA(batch_count, A_size);
+    device_batch_vector<T> binvA(batch_count, A_size);
 
-    double gpu_time_used, cpu_time_used;
-    double hipblasGflops, cblas_gflops;
-    double rocblas_error = 0.0;
+    device_vector<T*, 0, T> dA(batch_count);
+    device_vector<T*, 0, T> dinvA(batch_count);
 
     hipblasHandle_t handle;
+    hipblas_client_create(&handle);
 
-    char char_uplo = argus.uplo_option;
-    char char_diag = argus.diag_option;
-
-    // char_uplo = 'U';
-    hipblasFillMode_t uplo = char2hipblasFillMode_t(char_uplo);
-    hipblasDiagType_t diag = char2hipblasDiagType_t(char_diag);
+    // Initial hA on CPU
+    srand(1);
+    for(int b = 0; b < batch_count; b++)
+    {
+        hA[b]     = host_vector<T>(A_size);
+        hinvA1[b] = host_vector<T>(A_size);
 
-    hipblasCreate(&handle);
+        hipblas_init<T>(hA[b], N, N, lda);
+        // A is made triangular; its diagonal is boosted, or set to 1 for a unit diagonal
+        for(int j = 0; j < N; j++)
+        {
+            for(int i = 0; i < N; i++)
+            {
+                if(i == j)
+                    hA[b][i + j * lda] = char_diag == 'U' ? T(1) : hA[b][i + j * lda] + T(10 * N);
+                else if(char_uplo == 'U' ? i > j : i < j)
+                    hA[b][i + j * lda] = T(0);
+            }
+        }
 
-    // allocate memory on device
-    CHECK_HIP_ERROR(hipMalloc(&dA, A_size * sizeof(T)));
-    CHECK_HIP_ERROR(hipMalloc(&dinvA, A_size * sizeof(T)));
+        // Copy data from CPU to device; invA starts as A so the triangle not written stays zero
+        CHECK_HIP_ERROR(hipMemcpy(bA[b], hA[b].data(), A_size * sizeof(T), hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(
+            hipMemcpy(binvA[b], hA[b].data(), A_size * sizeof(T), hipMemcpyHostToDevice));
+    }
 
-    // copy data from CPU to device
-    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * A_size, hipMemcpyHostToDevice));
-    CHECK_HIP_ERROR(hipMemcpy(dinvA, hA.data(), sizeof(T) * A_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dA, bA, batch_count * sizeof(T*), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dinvA, binvA, batch_count * sizeof(T*), hipMemcpyHostToDevice));
 
     /* =====================================================================
-           ROCBLAS
+           HIPBLAS
     =================================================================== */
 
-    status = hipblasTrtri_batched<T>(
-        handle, uplo, diag, N, dA, lda, bsa, dinvA, lda, bsa, batch_count);
+    status = hipblasTrtriBatched<T>(handle, uplo, diag, N, dA, lda, dinvA, ldinvA, batch_count);
 
     if(status != HIPBLAS_STATUS_SUCCESS)
     {
-        CHECK_HIP_ERROR(hipFree(dA));
-        CHECK_HIP_ERROR(hipFree(dinvA));
-        hipblasDestroy(handle);
+        hipblas_client_destroy(handle);
         return status;
     }
 
-    // copy output from device to CPU
-    CHECK_HIP_ERROR(hipMemcpy(hA.data(), dinvA, sizeof(T) * A_size, hipMemcpyDeviceToHost));
+    // Copy output from device to CPU
+    for(int b = 0; b < batch_count; b++)
+        CHECK_HIP_ERROR(
+            hipMemcpy(hinvA1[b].data(), binvA[b], A_size * sizeof(T), hipMemcpyDeviceToHost));
 
     if(argus.unit_check)
     {
         /* =====================================================================
-           CPU BLAS
+           CPU LAPACK
         =================================================================== */
-        for(size_t i = 0; i < batch_count; i++)
-        {
-            int info = cblas_trtri<T>(char_uplo, char_diag, N, hB.data() + i * bsa, lda);
-            if(info != 0)
-                printf("error in cblas_trtri\n");
-        }
 
-        // enable unit check, notice unit check is not invasive, but norm check is,
-        // unit check and norm check can not be interchanged their order
-        if(argus.unit_check)
+        for(int b = 0; b < batch_count; b++)
         {
-            unit_check_general<T>(N, N * batch_count, lda, hB.data(), hA.data());
-        }
+            cblas_trtri<T>(char_uplo, char_diag, N, hA[b].data(), lda);
 
-        for(int i = 0; i < 32; i++)
-        {
-            printf("CPU[%d]=%f, GPU[%d]=%f\n", i, hB[i], i, hA[i]);
-        }
-        // if enable norm check, norm check is invasive
+            real_t<T> eps       = std::numeric_limits<real_t<T>>::epsilon();
+            double    tolerance = eps * 2000;
 
-    } // end of norm_check
+            double e = norm_check_general<T>('M', N, N, lda, hA[b].data(), hinvA1[b].data());
+            unit_check_error(e, tolerance);
+        }
+    }
 
-    CHECK_HIP_ERROR(hipFree(dA));
-    CHECK_HIP_ERROR(hipFree(dinvA));
-    hipblasDestroy(handle);
+    hipblas_client_destroy(handle);
     return HIPBLAS_STATUS_SUCCESS;
 }
@@ -0,0 +1,130 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "cblas_interface.h"
+#include "flops.h"
+#include "hipblas.hpp"
+#include "norm.h"
+#include "unit.h"
+#include "utility.h"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+template <typename T>
+hipblasStatus_t testing_trtri_strided_batched(Arguments argus)
+{
+    int    N            = argus.N;
+    int    lda          = argus.lda;
+    int    ldinvA       = argus.lda;
+    int    batch_count  = argus.batch_count;
+    double stride_scale = argus.stride_scale;
+
+    char char_uplo = argus.uplo_option;
+    char char_diag = argus.diag_option;
+
+    hipblasFillMode_t uplo = char2hipblas_fill(char_uplo);
+    hipblasDiagType_t diag = char2hipblas_diagonal(char_diag);
+
+    int strideA    = lda * N * stride_scale;
+    int strideInvA = ldinvA * N * stride_scale;
+    int A_size     = strideA * batch_count;
+    int invA_size  = strideInvA * batch_count;
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+
+    // Check to prevent memory allocation error
+    if(N < 0 || lda < N || batch_count < 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    if(batch_count == 0)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA(A_size);
+    host_vector<T> hinvA(invA_size);
+    host_vector<T> hinvA1(invA_size);
+
+    device_vector<T> dA(A_size);
+    device_vector<T> dinvA(invA_size);
+
+    hipblasHandle_t handle;
+    hipblas_client_create(&handle);
+
+    // Initial hA on CPU; invA starts as A so the triangle not written stays zero
+    srand(1);
+    for(int b = 0; b < batch_count; b++)
+    {
+        T* hAb = hA.data() + b * strideA;
+
+        hipblas_init<T>(hAb, N, N, lda);
+        // A is made triangular; its diagonal is boosted, or set to 1 for a unit diagonal
+        for(int j = 0; j < N; j++)
+        {
+            for(int i = 0; i < N; i++)
+            {
+                if(i == j)
+                    hAb[i + j * lda] = char_diag == 'U' ? T(1) : hAb[i + j * lda] + T(10 * N);
+                else if(char_uplo == 'U' ? i > j : i < j)
+                    hAb[i + j * lda] = T(0);
+            }
+        }
+        for(int j = 0; j < N; j++)
+            for(int i = 0; i < N; i++)
+                hinvA[b * strideInvA + i + j * ldinvA] = hAb[i + j * lda];
+    }
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), A_size * sizeof(T), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dinvA, hinvA.data(), invA_size * sizeof(T), hipMemcpyHostToDevice));
+
+    /* =====================================================================
+           HIPBLAS
+    =================================================================== */
+
+    status = hipblasTrtriStridedBatched<T>(
+        handle, uplo, diag, N, dA, lda, strideA, dinvA, ldinvA, strideInvA, batch_count);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    // Copy output from device to CPU
+    CHECK_HIP_ERROR(hipMemcpy(hinvA1.data(), dinvA, invA_size * sizeof(T), hipMemcpyDeviceToHost));
+
+    if(argus.unit_check)
+    {
+        /* =====================================================================
+           CPU LAPACK
+        =================================================================== */
+
+        for(int b = 0; b < batch_count; b++)
+        {
+            T* hAb = hA.data() + b * strideA;
+
+            cblas_trtri<T>(char_uplo, char_diag, N, hAb, lda);
+
+            real_t<T> eps       = std::numeric_limits<real_t<T>>::epsilon();
+            double    tolerance = eps * 2000;
+
+            double e = norm_check_general<T>('M', N, N, lda, hAb, hinvA1.data() + b * strideInvA);
+            unit_check_error(e, tolerance);
+        }
+    }
+
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
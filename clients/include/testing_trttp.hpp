@@ -0,0 +1,104 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "hipblas.hpp"
+#include "unit.h"
+#include "utility.h"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+template <typename T>
+hipblasStatus_t testing_trttp(Arguments argus)
+{
+    int N   = argus.N;
+    int lda = argus.lda;
+
+    hipblasFillMode_t uplo  = char2hipblas_fill(argus.uplo_option);
+    bool              upper = uplo == HIPBLAS_FILL_MODE_UPPER;
+
+    int A_size  = lda * N;
+    int AP_size = N * (N + 1) / 2;
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    if(N < 0 || lda < max(1, N))
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    if(N == 0)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA(A_size);
+    host_vector<T> hB(A_size);
+    host_vector<T> hB_gold(A_size);
+    host_vector<T> hAP(AP_size);
+    host_vector<T> hAP_gold(AP_size);
+
+    device_vector<T> dA(A_size);
+    device_vector<T> dB(A_size);
+    device_vector<T> dAP(AP_size);
+
+    hipblasHandle_t handle;
+    hipblas_client_create(&handle);
+
+    // Initial Data on CPU. The packed triangle goes back into hB, whose other triangle must stay
+    // as it was
+    srand(1);
+    hipblas_init<T>(hA, N, N, lda);
+    hipblas_init<T>(hB, N, N, lda);
+    hB_gold = hB;
+
+    int index = 0;
+    for(int j = 0; j < N; j++)
+    {
+        for(int i = upper ? 0 : j; i < (upper ? j + 1 : N); i++)
+        {
+            hAP_gold[index++]    = hA[i + j * lda];
+            hB_gold[i + j * lda] = hA[i + j * lda];
+        }
+    }
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * A_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB.data(), sizeof(T) * A_size, hipMemcpyHostToDevice));
+
+    /* =====================================================================
+           HIPBLAS
+    =================================================================== */
+
+    status = hipblasTrttp<T>(handle, uplo, N, dA, lda, dAP);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasTpttr<T>(handle, uplo, N, dAP, dB, lda);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    // copy output from device to CPU
+    CHECK_HIP_ERROR(hipMemcpy(hAP.data(), dAP, sizeof(T) * AP_size, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hB.data(), dB, sizeof(T) * A_size, hipMemcpyDeviceToHost));
+
+    if(argus.unit_check)
+    {
+        unit_check_general<T>(1, AP_size, 1, hAP_gold.data(), hAP.data());
+        unit_check_general<T>(N, N, lda, hB_gold.data(), hB.data());
+    }
+
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
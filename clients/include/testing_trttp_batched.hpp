@@ -0,0 +1,128 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "hipblas.hpp"
+#include "unit.h"
+#include "utility.h"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+template <typename T>
+hipblasStatus_t testing_trttp_batched(Arguments argus)
+{
+    int N           = argus.N;
+    int lda         = argus.lda;
+    int batch_count = argus.batch_count;
+
+    hipblasFillMode_t uplo  = char2hipblas_fill(argus.uplo_option);
+    bool              upper = uplo == HIPBLAS_FILL_MODE_UPPER;
+
+    int A_size  = lda * N;
+    int AP_size = N * (N + 1) / 2;
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+
+    // argument sanity check, quick return if input parameters are invalid before allocating invalid
+    // memory
+    if(N < 0 || lda < max(1, N) || batch_count < 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    if(N == 0 || batch_count == 0)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA[batch_count];
+    host_vector<T> hB[batch_count];
+    host_vector<T> hB_gold[batch_count];
+    host_vector<T> hAP[batch_count];
+    host_vector<T> hAP_gold[batch_count];
+
+    device_batch_vector<T> bA(batch_count, A_size);
+    device_batch_vector<T> bB(batch_count, A_size);
+    device_batch_vector<T> bAP(batch_count, AP_size);
+
+    device_vector<T*, 0, T> dA(batch_count);
+    device_vector<T*, 0, T> dB(batch_count);
+    device_vector<T*, 0, T> dAP(batch_count);
+
+    hipblasHandle_t handle;
+    hipblas_client_create(&handle);
+
+    // Initial Data on CPU. The packed triangles go back into hB, whose other triangles must stay
+    // as they were
+    srand(1);
+    for(int b = 0; b < batch_count; b++)
+    {
+        hA[b]       = host_vector<T>(A_size);
+        hB[b]       = host_vector<T>(A_size);
+        hAP[b]      = host_vector<T>(AP_size);
+        hAP_gold[b] = host_vector<T>(AP_size);
+
+        hipblas_init<T>(hA[b], N, N, lda);
+        hipblas_init<T>(hB[b], N, N, lda);
+        hB_gold[b] = hB[b];
+
+        int index = 0;
+        for(int j = 0; j < N; j++)
+        {
+            for(int i = upper ? 0 : j; i < (upper ? j + 1 : N); i++)
+            {
+                hAP_gold[b][index++]    = hA[b][i + j * lda];
+                hB_gold[b][i + j * lda] = hA[b][i + j * lda];
+            }
+        }
+
+        CHECK_HIP_ERROR(hipMemcpy(bA[b], hA[b].data(), sizeof(T) * A_size, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(bB[b], hB[b].data(), sizeof(T) * A_size, hipMemcpyHostToDevice));
+    }
+
+    CHECK_HIP_ERROR(hipMemcpy(dA, bA, sizeof(T*) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, bB, sizeof(T*) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dAP, bAP, sizeof(T*) * batch_count, hipMemcpyHostToDevice));
+
+    /* =====================================================================
+           HIPBLAS
+    =================================================================== */
+
+    status = hipblasTrttpBatched<T>(handle, uplo, N, dA, lda, dAP, batch_count);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasTpttrBatched<T>(handle, uplo, N, dAP, dB, lda, batch_count);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    // copy output from device to CPU
+    for(int b = 0; b < batch_count; b++)
+    {
+        CHECK_HIP_ERROR(
+            hipMemcpy(hAP[b].data(), bAP[b], sizeof(T) * AP_size, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hB[b].data(), bB[b], sizeof(T) * A_size, hipMemcpyDeviceToHost));
+    }
+
+    if(argus.unit_check)
+    {
+        for(int b = 0; b < batch_count; b++)
+        {
+            unit_check_general<T>(1, AP_size, 1, hAP_gold[b].data(), hAP[b].data());
+            unit_check_general<T>(N, N, lda, hB_gold[b].data(), hB[b].data());
+        }
+    }
+
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
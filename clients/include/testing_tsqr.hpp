@@ -0,0 +1,187 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <stdlib.h>
+#include <vector>
+
+#include "cblas_interface.h"
+#include "flops.h"
+#include "hipblas.hpp"
+#include "norm.h"
+#include "unit.h"
+#include "utility.h"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+// tsqr with argus.algo, checked for an upper triangular R, orthonormal columns of Q and Q R = A.
+// A zero column sends CholeskyQR2 to the Householder fallback, whose Q is orthonormal all the
+// same. The factorization is repeated with split-k and Strassen on the handle, whose gemms would
+// carve the workspace tsqr keeps its Gram matrix in, and must come out the same
+template <typename T>
+hipblasStatus_t testing_tsqr(Arguments argus, bool zero_column = false)
+{
+    int M   = argus.M;
+    int N   = argus.N;
+    int lda = argus.lda;
+    int ldr = argus.ldb;
+
+    hipblasTsqrAlgo_t algo = hipblasTsqrAlgo_t(argus.algo);
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+
+    // Check to prevent memory allocation error
+    if(N < 0 || M < N || lda < max(1, M) || ldr < max(1, N))
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    if(N == 0)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    int A_size = lda * N;
+    int R_size = ldr * N;
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA(A_size);
+    host_vector<T> hQ(A_size);
+    host_vector<T> hR(R_size);
+    host_vector<T> hR_init(R_size, T(-1));
+    host_vector<T> hQR(A_size);
+    host_vector<T> hI(N * N);
+    host_vector<T> hQtQ(N * N);
+    host_vector<T> hQ_routed(A_size);
+    host_vector<T> hR_routed(R_size);
+
+    device_vector<T> dA(A_size);
+    device_vector<T> dA0(A_size);
+    device_vector<T> dR(R_size);
+
+    hipblasHandle_t handle;
+    hipblas_client_create(&handle);
+
+    // Initial hA on CPU
+    srand(1);
+    hipblas_init<T>(hA, M, N, lda);
+    if(zero_column && N > 1)
+        for(int i = 0; i < M; i++)
+            hA[i + lda] = T(0);
+
+    // Copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(dA0, hA.data(), A_size * sizeof(T), hipMemcpyHostToDevice));
+
+    auto factor = [&](host_vector<T>& Q, host_vector<T>& R) {
+        CHECK_HIP_ERROR(hipMemcpy(dA, dA0, A_size * sizeof(T), hipMemcpyDeviceToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dR, hR_init.data(), R_size * sizeof(T), hipMemcpyHostToDevice));
+        hipblasStatus_t tsqr_status = hipblasTsqr<T>(handle, algo, M, N, dA, lda, dR, ldr);
+        CHECK_HIP_ERROR(hipMemcpy(Q.data(), dA, A_size * sizeof(T), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(R.data(), dR, R_size * sizeof(T), hipMemcpyDeviceToHost));
+        return tsqr_status;
+    };
+
+    /* =====================================================================
+           HIPBLAS
+    =================================================================== */
+
+    status = factor(hQ, hR);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    if(argus.unit_check)
+    {
+        double tolerance = double(std::numeric_limits<real_t<T>>::epsilon()) * 4 * M * N;
+
+        // the strict lower triangle of R is written as zeros
+        T zero = T(0);
+        for(int j = 0; j < N; j++)
+            for(int i = j + 1; i < N; i++)
+                unit_check_general<T>(1, 1, 1, &zero, &hR[i + j * ldr]);
+
+        cblas_gemm<T>(HIPBLAS_OP_N,
+                      HIPBLAS_OP_N,
+                      M,
+                      N,
+                      N,
+                      T(1),
+                      hQ.data(),
+                      lda,
+                      hR.data(),
+                      ldr,
+                      T(0),
+                      hQR.data(),
+                      lda);
+        cblas_gemm<T>(HIPBLAS_OP_C,
+                      HIPBLAS_OP_N,
+                      N,
+                      N,
+                      M,
+                      T(1),
+                      hQ.data(),
+                      lda,
+                      hQ.data(),
+                      lda,
+                      T(0),
+                      hQtQ.data(),
+                      N);
+        for(int j = 0; j < N; j++)
+            hI[j + j * N] = T(1);
+
+        unit_check_error(norm_check_general<T>('F', M, N, lda, hA.data(), hQR.data()), tolerance);
+        unit_check_error(norm_check_general<T>('F', N, N, N, hI.data(), hQtQ.data()), tolerance);
+
+        status = hipblasSetGemmSplitK(handle, 4);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblasSetGemmStrassen(handle, 1, 16);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = factor(hQ_routed, hR_routed);
+        hipblasSetGemmStrassen(handle, 0, 0);
+        hipblasSetGemmSplitK(handle, 1);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            hipblas_client_destroy(handle);
+            return status;
+        }
+        unit_check_error(norm_check_general<T>('F', M, N, lda, hQ.data(), hQ_routed.data()),
+                         tolerance);
+        unit_check_error(norm_check_general<T>('F', N, N, ldr, hR.data(), hR_routed.data()),
+                         tolerance);
+    }
+
+    if(argus.timing)
+    {
+        // the timed calls factor in place, so each gets the original matrix back first
+        hipblas_timing timing;
+        status = hipblas_time_launches(
+            handle,
+            argus,
+            timing,
+            [&] { return hipblas_restore_input(handle, dA, dA0, A_size * sizeof(T)); },
+            [&] { return hipblasTsqr<T>(handle, algo, M, N, dA, lda, dR, ldr); });
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            hipblas_client_destroy(handle);
+            return status;
+        }
+
+        double gflop = tsqr_gflop_count<T>(M, N);
+        double gbyte = tsqr_gbyte_count<T>(M, N);
+
+        cout << "M,N,lda,ldr,algo," HIPBLAS_TIMING_COLUMNS << endl;
+        cout << M << ',' << N << ',' << lda << ',' << ldr << ',' << argus.algo << ',';
+        hipblas_print_timing(cout, timing, gflop, gbyte);
+    }
+
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
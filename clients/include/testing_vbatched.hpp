@@ -0,0 +1,801 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#include <fstream>
+#include <iostream>
+#include <stdlib.h>
+#include <vector>
+
+#include "cblas_interface.h"
+#include "hipblas.hpp"
+#include "norm.h"
+#include "unit.h"
+#include "utility.h"
+
+using namespace std;
+
+/* ============================================================================================ */
+
+// Entry b of a vbatched test is at most M x N, with sizes down to 0 spread over the batch, a
+// leading dimension up to 2 past its rows and the increments negated for odd b
+inline int vbatched_size(int max_size, int b, int step)
+{
+    return max_size - (b * step) % (max_size + 1);
+}
+
+inline int vbatched_ld(int rows, int b)
+{
+    return std::max(1, rows) + b % 3;
+}
+
+inline int vbatched_inc(int inc, int b)
+{
+    return b % 2 ? -inc : inc;
+}
+
+inline int vbatched_vector_size(int n, int inc)
+{
+    return n > 0 ? 1 + (n - 1) * std::abs(inc) : 1;
+}
+
+// One gemv per entry, all of different sizes, in one call against cblas_gemv entry by entry
+template <typename T>
+hipblasStatus_t testing_gemv_vbatched(Arguments argus)
+{
+    int M           = argus.M;
+    int N           = argus.N;
+    int incx        = argus.incx;
+    int incy        = argus.incy;
+    int batch_count = argus.batch_count;
+
+    hipblasOperation_t transA = char2hipblas_operation(argus.transA_option);
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+
+    // check here to prevent undefined memory allocation error
+    if(M < 0 || N < 0 || incx == 0 || incy == 0 || batch_count < 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    if(batch_count == 0)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    vector<int> hm(batch_count), hn(batch_count), hlda(batch_count);
+    vector<int> hincx(batch_count), hincy(batch_count);
+    vector<int> A_off(batch_count), x_off(batch_count), y_off(batch_count);
+
+    int A_size = 0, X_size = 0, Y_size = 0;
+    for(int b = 0; b < batch_count; b++)
+    {
+        hm[b]    = vbatched_size(M, b, 3);
+        hn[b]    = vbatched_size(N, b, 5);
+        hlda[b]  = vbatched_ld(hm[b], b);
+        hincx[b] = vbatched_inc(incx, b);
+        hincy[b] = vbatched_inc(incy, b);
+
+        int X_els = transA == HIPBLAS_OP_N ? hn[b] : hm[b];
+        int Y_els = transA == HIPBLAS_OP_N ? hm[b] : hn[b];
+
+        A_off[b] = A_size;
+        x_off[b] = X_size;
+        y_off[b] = Y_size;
+        A_size += hlda[b] * std::max(1, hn[b]);
+        X_size += vbatched_vector_size(X_els, hincx[b]);
+        Y_size += vbatched_vector_size(Y_els, hincy[b]);
+    }
+
+    T alpha = argus.get_alpha<T>();
+    T beta  = argus.get_beta<T>();
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA(A_size);
+    host_vector<T> hx(X_size);
+    host_vector<T> hy(Y_size);
+    host_vector<T> hy_gpu(Y_size);
+
+    device_vector<T>   dA(A_size);
+    device_vector<T>   dx(X_size);
+    device_vector<T>   dy(Y_size);
+    device_vector<int> dm(batch_count);
+    device_vector<int> dn(batch_count);
+    device_vector<int> dlda(batch_count);
+    device_vector<int> dincx(batch_count);
+    device_vector<int> dincy(batch_count);
+
+    device_vector<T*, 0, T> dA_array(batch_count);
+    device_vector<T*, 0, T> dx_array(batch_count);
+    device_vector<T*, 0, T> dy_array(batch_count);
+
+    if(!dA || !dx || !dy || !dA_array || !dx_array || !dy_array)
+    {
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+    }
+
+    vector<T*> hA_array(batch_count), hx_array(batch_count), hy_array(batch_count);
+    for(int b = 0; b < batch_count; b++)
+    {
+        hA_array[b] = dA + A_off[b];
+        hx_array[b] = dx + x_off[b];
+        hy_array[b] = dy + y_off[b];
+    }
+
+    hipblasHandle_t handle;
+    hipblas_client_create(&handle);
+
+    // Initial Data on CPU
+    srand(1);
+    hipblas_init<T>(hA, 1, A_size, 1);
+    hipblas_init<T>(hx, 1, X_size, 1);
+    hipblas_init<T>(hy, 1, Y_size, 1);
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * A_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * X_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dy, hy.data(), sizeof(T) * Y_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dm, hm.data(), sizeof(int) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dn, hn.data(), sizeof(int) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dlda, hlda.data(), sizeof(int) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dincx, hincx.data(), sizeof(int) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dincy, hincy.data(), sizeof(int) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dA_array, hA_array.data(), sizeof(T*) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dx_array, hx_array.data(), sizeof(T*) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dy_array, hy_array.data(), sizeof(T*) * batch_count, hipMemcpyHostToDevice));
+
+    /* =====================================================================
+           HIPBLAS
+    =================================================================== */
+    status = hipblasGemvVbatched<T>(handle,
+                                    transA,
+                                    dm,
+                                    dn,
+                                    &alpha,
+                                    dA_array,
+                                    dlda,
+                                    dx_array,
+                                    dincx,
+                                    &beta,
+                                    dy_array,
+                                    dincy,
+                                    batch_count);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    // copy output from device to CPU
+    CHECK_HIP_ERROR(hipMemcpy(hy_gpu.data(), dy, sizeof(T) * Y_size, hipMemcpyDeviceToHost));
+
+    if(argus.unit_check)
+    {
+        /* =====================================================================
+           CPU BLAS
+        =================================================================== */
+        for(int b = 0; b < batch_count; b++)
+            cblas_gemv<T>(transA,
+                          hm[b],
+                          hn[b],
+                          alpha,
+                          hA.data() + A_off[b],
+                          hlda[b],
+                          hx.data() + x_off[b],
+                          hincx[b],
+                          beta,
+                          hy.data() + y_off[b],
+                          hincy[b]);
+
+        unit_check_general<T>(1, Y_size, 1, hy.data(), hy_gpu.data());
+    }
+
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+// b = op(A) * x entry by entry on the host, solved back for x in one call. The off-diagonal
+// entries are scaled down so that every triangle, unit or not, is well conditioned
+template <typename T>
+hipblasStatus_t testing_trsv_vbatched(Arguments argus)
+{
+    int M           = argus.M;
+    int incx        = argus.incx;
+    int batch_count = argus.batch_count;
+
+    hipblasFillMode_t  uplo   = char2hipblas_fill(argus.uplo_option);
+    hipblasOperation_t transA = char2hipblas_operation(argus.transA_option);
+    hipblasDiagType_t  diag   = char2hipblas_diagonal(argus.diag_option);
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+
+    // check here to prevent undefined memory allocation error
+    if(M < 0 || incx == 0 || batch_count < 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    if(batch_count == 0)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    vector<int> hn(batch_count), hlda(batch_count), hincx(batch_count);
+    vector<int> A_off(batch_count), x_off(batch_count);
+
+    int A_size = 0, X_size = 0;
+    for(int b = 0; b < batch_count; b++)
+    {
+        hn[b]    = vbatched_size(M, b, 3);
+        hlda[b]  = vbatched_ld(hn[b], b);
+        hincx[b] = vbatched_inc(incx, b);
+
+        A_off[b] = A_size;
+        x_off[b] = X_size;
+        A_size += hlda[b] * std::max(1, hn[b]);
+        X_size += vbatched_vector_size(hn[b], hincx[b]);
+    }
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA(A_size);
+    host_vector<T> hx(X_size);
+    host_vector<T> hb(X_size);
+    host_vector<T> hx_gpu(X_size);
+
+    device_vector<T>   dA(A_size);
+    device_vector<T>   dx(X_size);
+    device_vector<int> dn(batch_count);
+    device_vector<int> dlda(batch_count);
+    device_vector<int> dincx(batch_count);
+
+    device_vector<T*, 0, T> dA_array(batch_count);
+    device_vector<T*, 0, T> dx_array(batch_count);
+
+    if(!dA || !dx || !dA_array || !dx_array)
+    {
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+    }
+
+    vector<T*> hA_array(batch_count), hx_array(batch_count);
+    for(int b = 0; b < batch_count; b++)
+    {
+        hA_array[b] = dA + A_off[b];
+        hx_array[b] = dx + x_off[b];
+    }
+
+    hipblasHandle_t handle;
+    hipblas_client_create(&handle);
+
+    // Initial Data on CPU
+    srand(1);
+    hipblas_init<T>(hA, 1, A_size, 1);
+    hipblas_init<T>(hx, 1, X_size, 1);
+    for(int b = 0; b < batch_count; b++)
+    {
+        T* A = hA.data() + A_off[b];
+        for(int j = 0; j < hn[b]; j++)
+            for(int i = 0; i < hn[b]; i++)
+                A[i + j * hlda[b]] = i == j ? A[i + j * hlda[b]] + T(1)
+                                            : A[i + j * hlda[b]] / T(10 * hn[b]);
+    }
+    hb = hx;
+    for(int b = 0; b < batch_count; b++)
+        cblas_trmv<T>(uplo,
+                      transA,
+                      diag,
+                      hn[b],
+                      hA.data() + A_off[b],
+                      hlda[b],
+                      hb.data() + x_off[b],
+                      hincx[b]);
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * A_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dx, hb.data(), sizeof(T) * X_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dn, hn.data(), sizeof(int) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dlda, hlda.data(), sizeof(int) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dincx, hincx.data(), sizeof(int) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dA_array, hA_array.data(), sizeof(T*) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dx_array, hx_array.data(), sizeof(T*) * batch_count, hipMemcpyHostToDevice));
+
+    /* =====================================================================
+           HIPBLAS
+    =================================================================== */
+    status = hipblasTrsvVbatched<T>(
+        handle, uplo, transA, diag, dn, dA_array, dlda, dx_array, dincx, batch_count);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    // copy output from device to CPU
+    CHECK_HIP_ERROR(hipMemcpy(hx_gpu.data(), dx, sizeof(T) * X_size, hipMemcpyDeviceToHost));
+
+    if(argus.unit_check)
+    {
+        real_t<T> eps       = std::numeric_limits<real_t<T>>::epsilon();
+        double    tolerance = eps * 40 * std::max(1, M);
+
+        double max_err_scal = 0.0, max_err = 0.0;
+        for(int i = 0; i < X_size; i++)
+        {
+            max_err += abs(hx[i] - hx_gpu[i]);
+            max_err_scal += abs(hx[i]);
+        }
+        unit_check_error(max_err / max_err_scal, tolerance);
+    }
+
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+// getrf then getrs for op(A) * X = B, entry by entry of different sizes in one call each, where
+// B = op(A) * X on the host. The diagonal is raised so that every entry is well conditioned
+template <typename T>
+hipblasStatus_t testing_getrf_vbatched(Arguments argus)
+{
+    int M           = argus.M;
+    int N           = argus.N;
+    int batch_count = argus.batch_count;
+
+    hipblasOperation_t transA = char2hipblas_operation(argus.transA_option);
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+
+    // check here to prevent undefined memory allocation error
+    if(M < 0 || N < 0 || batch_count < 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    if(batch_count == 0)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    vector<int> hn(batch_count), hnrhs(batch_count), hlda(batch_count), hldb(batch_count);
+    vector<int> A_off(batch_count), B_off(batch_count), P_off(batch_count);
+
+    int A_size = 0, B_size = 0, P_size = 0;
+    for(int b = 0; b < batch_count; b++)
+    {
+        hn[b]    = vbatched_size(M, b, 3);
+        hnrhs[b] = vbatched_size(N, b, 5);
+        hlda[b]  = vbatched_ld(hn[b], b);
+        hldb[b]  = vbatched_ld(hn[b], b + 1);
+
+        A_off[b] = A_size;
+        B_off[b] = B_size;
+        P_off[b] = P_size;
+        A_size += hlda[b] * std::max(1, hn[b]);
+        B_size += hldb[b] * std::max(1, hnrhs[b]);
+        P_size += std::max(1, hn[b]);
+    }
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T>   hA(A_size);
+    host_vector<T>   hX(B_size);
+    host_vector<T>   hB(B_size);
+    host_vector<T>   hX_gpu(B_size);
+    host_vector<int> hinfo(batch_count);
+    int              info;
+
+    device_vector<T>   dA(A_size);
+    device_vector<T>   dB(B_size);
+    device_vector<int> dipiv(P_size);
+    device_vector<int> dinfo(batch_count);
+    device_vector<int> dn(batch_count);
+    device_vector<int> dnrhs(batch_count);
+    device_vector<int> dlda(batch_count);
+    device_vector<int> dldb(batch_count);
+
+    device_vector<T*, 0, T>     dA_array(batch_count);
+    device_vector<T*, 0, T>     dB_array(batch_count);
+    device_vector<int*, 0, int> dipiv_array(batch_count);
+
+    if(!dA || !dB || !dipiv || !dA_array || !dB_array || !dipiv_array)
+    {
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+    }
+
+    vector<T*>   hA_array(batch_count), hB_array(batch_count);
+    vector<int*> hipiv_array(batch_count);
+    for(int b = 0; b < batch_count; b++)
+    {
+        hA_array[b]    = dA + A_off[b];
+        hB_array[b]    = dB + B_off[b];
+        hipiv_array[b] = dipiv + P_off[b];
+    }
+
+    hipblasHandle_t handle;
+    hipblas_client_create(&handle);
+
+    // Initial Data on CPU
+    srand(1);
+    hipblas_init<T>(hA, 1, A_size, 1);
+    hipblas_init<T>(hX, 1, B_size, 1);
+    for(int b = 0; b < batch_count; b++)
+    {
+        T* A = hA.data() + A_off[b];
+        for(int i = 0; i < hn[b]; i++)
+            A[i + i * hlda[b]] = A[i + i * hlda[b]] + T(10 * hn[b]);
+        cblas_gemm<T>(transA,
+                      HIPBLAS_OP_N,
+                      hn[b],
+                      hnrhs[b],
+                      hn[b],
+                      T(1),
+                      A,
+                      hlda[b],
+                      hX.data() + B_off[b],
+                      hldb[b],
+                      T(0),
+                      hB.data() + B_off[b],
+                      hldb[b]);
+    }
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * A_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB.data(), sizeof(T) * B_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dn, hn.data(), sizeof(int) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dnrhs, hnrhs.data(), sizeof(int) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dlda, hlda.data(), sizeof(int) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dldb, hldb.data(), sizeof(int) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dA_array, hA_array.data(), sizeof(T*) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dB_array, hB_array.data(), sizeof(T*) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dipiv_array, hipiv_array.data(), sizeof(int*) * batch_count, hipMemcpyHostToDevice));
+
+    /* =====================================================================
+           HIPBLAS
+    =================================================================== */
+    status
+        = hipblasGetrfVbatched<T>(handle, dn, dA_array, dlda, dipiv_array, dinfo, batch_count);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasGetrsVbatched<T>(handle,
+                                         transA,
+                                         dn,
+                                         dnrhs,
+                                         dA_array,
+                                         dlda,
+                                         dipiv_array,
+                                         dB_array,
+                                         dldb,
+                                         &info,
+                                         batch_count);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    // copy output from device to CPU
+    CHECK_HIP_ERROR(hipMemcpy(hX_gpu.data(), dB, sizeof(T) * B_size, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(
+        hipMemcpy(hinfo.data(), dinfo, sizeof(int) * batch_count, hipMemcpyDeviceToHost));
+
+    if(argus.unit_check)
+    {
+        real_t<T> eps       = std::numeric_limits<real_t<T>>::epsilon();
+        double    tolerance = eps * 40 * std::max(1, M);
+
+        EXPECT_EQ(0, info);
+        double max_err_scal = 0.0, max_err = 0.0;
+        for(int b = 0; b < batch_count; b++)
+        {
+            EXPECT_EQ(0, hinfo[b]);
+            for(int j = 0; j < hnrhs[b]; j++)
+                for(int i = 0; i < hn[b]; i++)
+                {
+                    int e = B_off[b] + i + j * hldb[b];
+                    max_err += abs(hX[e] - hX_gpu[e]);
+                    max_err_scal += abs(hX[e]);
+                }
+        }
+        if(max_err_scal > 0)
+            unit_check_error(max_err / max_err_scal, tolerance);
+    }
+
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+// B = op(A) * X or X * op(A) entry by entry on the host by trmm, solved back for alpha * X in one
+// call; triangles are kept well conditioned as for trsv
+template <typename T>
+hipblasStatus_t testing_trsm_vbatched(Arguments argus)
+{
+    int M           = argus.M;
+    int N           = argus.N;
+    int batch_count = argus.batch_count;
+
+    hipblasSideMode_t  side   = char2hipblas_side(argus.side_option);
+    hipblasFillMode_t  uplo   = char2hipblas_fill(argus.uplo_option);
+    hipblasOperation_t transA = char2hipblas_operation(argus.transA_option);
+    hipblasDiagType_t  diag   = char2hipblas_diagonal(argus.diag_option);
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+
+    // check here to prevent undefined memory allocation error
+    if(M < 0 || N < 0 || batch_count < 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    if(batch_count == 0)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    vector<int> hm(batch_count), hn(batch_count), hk(batch_count);
+    vector<int> hlda(batch_count), hldb(batch_count);
+    vector<int> A_off(batch_count), B_off(batch_count);
+
+    int A_size = 0, B_size = 0;
+    for(int b = 0; b < batch_count; b++)
+    {
+        hm[b]   = vbatched_size(M, b, 3);
+        hn[b]   = vbatched_size(N, b, 5);
+        hk[b]   = side == HIPBLAS_SIDE_LEFT ? hm[b] : hn[b];
+        hlda[b] = vbatched_ld(hk[b], b);
+        hldb[b] = vbatched_ld(hm[b], b + 1);
+
+        A_off[b] = A_size;
+        B_off[b] = B_size;
+        A_size += hlda[b] * std::max(1, hk[b]);
+        B_size += hldb[b] * std::max(1, hn[b]);
+    }
+
+    T alpha = argus.get_alpha<T>();
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T> hA(A_size);
+    host_vector<T> hX(B_size);
+    host_vector<T> hB(B_size);
+    host_vector<T> hB_gpu(B_size);
+
+    device_vector<T>   dA(A_size);
+    device_vector<T>   dB(B_size);
+    device_vector<int> dm(batch_count);
+    device_vector<int> dn(batch_count);
+    device_vector<int> dlda(batch_count);
+    device_vector<int> dldb(batch_count);
+
+    device_vector<T*, 0, T> dA_array(batch_count);
+    device_vector<T*, 0, T> dB_array(batch_count);
+
+    if(!dA || !dB || !dA_array || !dB_array)
+    {
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+    }
+
+    vector<T*> hA_array(batch_count), hB_array(batch_count);
+    for(int b = 0; b < batch_count; b++)
+    {
+        hA_array[b] = dA + A_off[b];
+        hB_array[b] = dB + B_off[b];
+    }
+
+    hipblasHandle_t handle;
+    hipblas_client_create(&handle);
+
+    // Initial Data on CPU
+    srand(1);
+    hipblas_init<T>(hA, 1, A_size, 1);
+    hipblas_init<T>(hX, 1, B_size, 1);
+    for(int b = 0; b < batch_count; b++)
+    {
+        T* A = hA.data() + A_off[b];
+        for(int j = 0; j < hk[b]; j++)
+            for(int i = 0; i < hk[b]; i++)
+                A[i + j * hlda[b]] = i == j ? A[i + j * hlda[b]] + T(1)
+                                            : A[i + j * hlda[b]] / T(10 * hk[b]);
+    }
+    hB = hX;
+    for(int b = 0; b < batch_count; b++)
+        cblas_trmm<T>(side,
+                      uplo,
+                      transA,
+                      diag,
+                      hm[b],
+                      hn[b],
+                      T(1),
+                      hA.data() + A_off[b],
+                      hlda[b],
+                      hB.data() + B_off[b],
+                      hldb[b]);
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(T) * A_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dB, hB.data(), sizeof(T) * B_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dm, hm.data(), sizeof(int) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dn, hn.data(), sizeof(int) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dlda, hlda.data(), sizeof(int) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dldb, hldb.data(), sizeof(int) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dA_array, hA_array.data(), sizeof(T*) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dB_array, hB_array.data(), sizeof(T*) * batch_count, hipMemcpyHostToDevice));
+
+    /* =====================================================================
+           HIPBLAS
+    =================================================================== */
+    status = hipblasTrsmVbatched<T>(handle,
+                                    side,
+                                    uplo,
+                                    transA,
+                                    diag,
+                                    dm,
+                                    dn,
+                                    &alpha,
+                                    dA_array,
+                                    dlda,
+                                    dB_array,
+                                    dldb,
+                                    batch_count);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    // copy output from device to CPU
+    CHECK_HIP_ERROR(hipMemcpy(hB_gpu.data(), dB, sizeof(T) * B_size, hipMemcpyDeviceToHost));
+
+    if(argus.unit_check)
+    {
+        real_t<T> eps       = std::numeric_limits<real_t<T>>::epsilon();
+        double    tolerance = eps * 40 * std::max(1, std::max(M, N));
+
+        double max_err_scal = 0.0, max_err = 0.0;
+        for(int b = 0; b < batch_count; b++)
+            for(int j = 0; j < hn[b]; j++)
+                for(int i = 0; i < hm[b]; i++)
+                {
+                    int e = B_off[b] + i + j * hldb[b];
+                    max_err += abs(alpha * hX[e] - hB_gpu[e]);
+                    max_err_scal += abs(alpha * hX[e]);
+                }
+        if(max_err_scal > 0)
+            unit_check_error(max_err / max_err_scal, tolerance);
+    }
+
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+// The norm of each entry of lengths up to M * N, and of the whole batch, against cblas_nrm2 entry
+// by entry; the second call leaves out the norms and must still find the same global norm
+template <typename T>
+hipblasStatus_t testing_nrm2_vbatched(Arguments argus)
+{
+    using Tr = real_t<T>;
+
+    int M           = argus.M;
+    int N           = argus.N;
+    int incx        = argus.incx;
+    int batch_count = argus.batch_count;
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+
+    // check here to prevent undefined memory allocation error
+    if(M < 0 || N < 0 || incx == 0 || batch_count < 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    if(batch_count == 0)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    vector<int> hn(batch_count), hincx(batch_count), x_off(batch_count);
+
+    int X_size = 0;
+    for(int b = 0; b < batch_count; b++)
+    {
+        hn[b]    = vbatched_size(M * N, b, 997);
+        hincx[b] = vbatched_inc(incx, b);
+        x_off[b] = X_size;
+        X_size += vbatched_vector_size(hn[b], hincx[b]);
+    }
+
+    // Naming: dK is in GPU (device) memory. hK is in CPU (host) memory
+    host_vector<T>  hx(X_size);
+    host_vector<Tr> hnorms(batch_count);
+    host_vector<Tr> hnorms_gpu(batch_count);
+    Tr              hresult_gpu[2];
+
+    device_vector<T>   dx(X_size);
+    device_vector<int> dn(batch_count);
+    device_vector<int> dincx(batch_count);
+    device_vector<Tr>  dnorms(batch_count);
+    device_vector<Tr>  dresult(2);
+
+    device_vector<T*, 0, T> dx_array(batch_count);
+
+    if(!dx || !dnorms || !dresult || !dx_array)
+    {
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+    }
+
+    vector<T*> hx_array(batch_count);
+    for(int b = 0; b < batch_count; b++)
+        hx_array[b] = dx + x_off[b];
+
+    hipblasHandle_t handle;
+    hipblas_client_create(&handle);
+
+    // Initial Data on CPU
+    srand(1);
+    hipblas_init<T>(hx, 1, X_size, 1);
+
+    // copy data from CPU to device
+    CHECK_HIP_ERROR(hipMemcpy(dx, hx.data(), sizeof(T) * X_size, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(dn, hn.data(), sizeof(int) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(
+        hipMemcpy(dincx, hincx.data(), sizeof(int) * batch_count, hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dx_array, hx_array.data(), sizeof(T*) * batch_count, hipMemcpyHostToDevice));
+
+    /* =====================================================================
+           HIPBLAS
+    =================================================================== */
+    status = hipblasNrm2Vbatched<T, Tr>(handle, dn, dx_array, dincx, batch_count, dnorms, dresult);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasNrm2Vbatched<T, Tr>(
+            handle, dn, dx_array, dincx, batch_count, nullptr, dresult + 1);
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblas_client_destroy(handle);
+        return status;
+    }
+
+    // copy output from device to CPU
+    CHECK_HIP_ERROR(
+        hipMemcpy(hnorms_gpu.data(), dnorms, sizeof(Tr) * batch_count, hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hresult_gpu, dresult, sizeof(Tr) * 2, hipMemcpyDeviceToHost));
+
+    if(argus.unit_check)
+    {
+        /* =====================================================================
+           CPU BLAS
+        =================================================================== */
+        double sum = 0;
+        for(int b = 0; b < batch_count; b++)
+        {
+            cblas_nrm2<T, Tr>(hn[b], hx.data() + x_off[b], hincx[b], &hnorms[b]);
+            sum += double(hnorms[b]) * hnorms[b];
+        }
+        Tr result = Tr(sqrt(sum));
+
+        Tr tolerance = 100;
+        for(int b = 0; b < batch_count; b++)
+            unit_check_nrm2<Tr>(hnorms[b], hnorms_gpu[b], tolerance);
+        unit_check_nrm2<Tr>(result, hresult_gpu[0], tolerance);
+        unit_check_nrm2<Tr>(result, hresult_gpu[1], tolerance);
+    }
+
+    hipblas_client_destroy(handle);
+    return HIPBLAS_STATUS_SUCCESS;
+}
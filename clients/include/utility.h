@@ -7,12 +7,16 @@
 #define _TESTING_UTILITY_H_
 
 #include "hipblas.h"
+#include <algorithm>
 #include <cmath>
+#include <functional>
 #include <immintrin.h>
+#include <ostream>
 #include <random>
 #include <stdio.h>
 #include <stdlib.h>
 #include <sys/time.h>
+#include <thread>
 #include <typeinfo>
 #include <vector>
 
@@ -129,6 +133,39 @@ inline hipblasBfloat16 float_to_bfloat16(float f)
     return rv;
 }
 
+// float value of a float, hipblasHalf or hipblasBfloat16 element, and back
+inline float hipblas_to_float(float val)
+{
+    return val;
+}
+inline float hipblas_to_float(hipblasHalf val)
+{
+    return half_to_float(val);
+}
+inline float hipblas_to_float(hipblasBfloat16 val)
+{
+    return bfloat16_to_float(val);
+}
+
+template <typename T>
+T hipblas_from_float(float val);
+
+template <>
+inline float hipblas_from_float<float>(float val)
+{
+    return val;
+}
+template <>
+inline hipblasHalf hipblas_from_float<hipblasHalf>(float val)
+{
+    return float_to_half(val);
+}
+template <>
+inline hipblasBfloat16 hipblas_from_float<hipblasBfloat16>(float val)
+{
+    return float_to_bfloat16(val);
+}
+
 /* ============================================================================================ */
 /*! \brief  Random number generator which generates NaN values */
 
@@ -281,37 +318,134 @@ inline hipblasDoubleComplex random_generator_negative<hipblasDoubleComplex>()
 /* ============================================================================================ */
 
 /* ============================================================================================ */
-/*! \brief  matrix/vector initialization: */
-// for vector x (M=1, N=lengthX, lda=incx);
-// for complex number, the real/imag part would be initialized with the same value
+/*! \brief  Counter-based random numbers: element index of the stream named by seed, from a
+ *          splitmix64 hash, so elements can be generated in any order and on any thread */
+inline uint64_t hipblas_counter_hash(uint64_t seed, uint64_t index)
+{
+    uint64_t z = seed + (index + 1) * 0x9e3779b97f4a7c15ull;
+    z          = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+    z          = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+    return z ^ (z >> 31);
+}
+
+/*! \brief  the counter-based counterpart of random_generator, with the same ranges */
 template <typename T>
-void hipblas_init(vector<T>& A, int M, int N, int lda, int stride = 0, int batch_count = 1)
+inline T random_counter_generator(uint64_t seed, uint64_t index)
 {
-    for(int b = 0; b < batch_count; b++)
+    return T(hipblas_counter_hash(seed, index) % 10 + 1);
+}
+
+template <>
+inline hipblasHalf random_counter_generator<hipblasHalf>(uint64_t seed, uint64_t index)
+{
+    return float_to_half(float(hipblas_counter_hash(seed, index) % 3 + 1));
+}
+
+template <>
+inline hipblasBfloat16 random_counter_generator<hipblasBfloat16>(uint64_t seed, uint64_t index)
+{
+    return float_to_bfloat16(float(hipblas_counter_hash(seed, index) % 3 + 1));
+}
+
+// the real and imaginary parts come from separate halves of one hash
+template <>
+inline hipblasComplex random_counter_generator<hipblasComplex>(uint64_t seed, uint64_t index)
+{
+    uint64_t h = hipblas_counter_hash(seed, index);
+    return hipblasComplex(float(h % 10 + 1), float((h >> 32) % 10 + 1));
+}
+
+template <>
+inline hipblasDoubleComplex random_counter_generator<hipblasDoubleComplex>(uint64_t seed,
+                                                                           uint64_t index)
+{
+    uint64_t h = hipblas_counter_hash(seed, index);
+    return hipblasDoubleComplex(double(h % 10 + 1), double((h >> 32) % 10 + 1));
+}
+
+/*! \brief  Calls f(first, last) over [0, count) split into equal ranges, on as many threads as
+ *          the host has once count reaches min_parallel, otherwise on the calling thread */
+template <typename F>
+void hipblas_parallel_for(size_t count, size_t min_parallel, F f)
+{
+    size_t threads = std::thread::hardware_concurrency();
+    if(count < min_parallel || threads < 2)
     {
-        for(int i = 0; i < M; ++i)
-        {
-            for(int j = 0; j < N; ++j)
-            {
-                A[i + j * lda + b * stride] = random_generator<T>();
-            }
-        }
+        f(size_t(0), count);
+        return;
     }
+
+    threads = std::min(threads, count);
+    vector<std::thread> pool;
+    for(size_t t = 1; t < threads; t++)
+        pool.emplace_back(f, count * t / threads, count * (t + 1) / threads);
+    f(size_t(0), count / threads);
+    for(auto& thread : pool)
+        thread.join();
+}
+
+/*! \brief  Calls f(b) for each b in [0, batch_count) over host threads; for the CPU reference
+ *          loops of the batched tests, whose batches share no output */
+template <typename F>
+void hipblas_batch_for(int batch_count, F f)
+{
+    hipblas_parallel_for(std::max(batch_count, 0), 2, [&](size_t first, size_t last) {
+        for(size_t b = first; b < last; b++)
+            f(int(b));
+    });
+}
+
+/*! \brief  Runs the CPU reference of a test on a thread of its own while the caller runs the
+ *          hipBLAS call and copies its result back, so a case takes the longer of the two
+ *          rather than their sum. wait() joins it and must come before the comparison; the
+ *          destructor waits too. The reference may only read what the caller does not write
+ *          meanwhile. HIPBLAS_CLIENT_OVERLAP=0 runs it on the calling thread at wait() instead */
+class hipblas_host_reference
+{
+public:
+    explicit hipblas_host_reference(std::function<void()> reference);
+    ~hipblas_host_reference();
+
+    hipblas_host_reference(const hipblas_host_reference&) = delete;
+    hipblas_host_reference& operator=(const hipblas_host_reference&) = delete;
+
+    void wait();
+
+private:
+    std::function<void()> reference; // cleared once it has run
+    std::thread           worker;
 };
 
+/* ============================================================================================ */
+/*! \brief  matrix/vector initialization: */
+// for vector x (M=1, N=lengthX, lda=incx);
+// for complex number, the real/imag part would be initialized with the same value.
+// Element (i, j) of batch b is number (b * N + j) * M + i of a stream whose seed is drawn from
+// rand(), so the values follow srand() whatever lda, stride and thread count are; columns are
+// filled in memory order, split over host threads for large matrices
 template <typename T>
 void hipblas_init(T* A, int M, int N, int lda, int stride = 0, int batch_count = 1)
 {
-    for(int b = 0; b < batch_count; b++)
-    {
-        for(int i = 0; i < M; ++i)
+    if(M <= 0 || N <= 0 || batch_count <= 0)
+        return;
+
+    uint64_t seed    = uint64_t(rand()) << 32 | uint64_t(rand());
+    size_t   columns = size_t(N) * batch_count;
+    hipblas_parallel_for(columns, (size_t(1) << 20) / M + 1, [=](size_t first, size_t last) {
+        for(size_t c = first; c < last; c++)
         {
-            for(int j = 0; j < N; ++j)
-            {
-                A[i + j * lda + b * stride] = random_generator<T>();
-            }
+            size_t b = c / N, j = c % N;
+            T*     column = A + j * size_t(lda) + b * size_t(stride);
+            for(int i = 0; i < M; ++i)
+                column[i] = random_counter_generator<T>(seed, c * M + i);
         }
-    }
+    });
+};
+
+template <typename T>
+void hipblas_init(vector<T>& A, int M, int N, int lda, int stride = 0, int batch_count = 1)
+{
+    hipblas_init(A.data(), M, N, lda, stride, batch_count);
 };
 
 template <typename T>
@@ -417,6 +551,24 @@ void hipblas_init_hermitian(vector<T>& A, int N, int lda)
     }
 };
 
+/*! \brief  banded triangular matrix initialization, in banded storage with K off-diagonals: */
+// the off-diagonals are scaled down so that the matrix stays diagonally dominant with a unit
+// diagonal too; tbsv tests rely on this to keep the solves well conditioned
+template <typename T>
+void hipblas_init_banded_triangular(
+    vector<T>& A, bool upper, int N, int K, int lda, int strideA = 0, int batch_count = 1)
+{
+    T   scale = T(1.0 / (10.0 * (K + 1)));
+    int d     = upper ? K : 0;
+    for(int b = 0; b < batch_count; b++)
+        for(int j = 0; j < N; ++j)
+            for(int i = 0; i <= K; ++i)
+            {
+                T a                          = random_generator<T>();
+                A[i + j * lda + b * strideA] = i == d ? a : a * scale;
+            }
+}
+
 /* ============================================================================================ */
 /*! \brief  Initialize an array with random data, with NaN where appropriate */
 
@@ -524,6 +676,29 @@ namespace std
 template <typename T>
 using real_t = typename real_t_impl<T>::type;
 
+// Complex conjugate; the identity for real types
+template <typename T, std::enable_if_t<!is_complex<T>, int> = 0>
+inline T hipblas_conjugate(const T& z)
+{
+    return z;
+}
+
+template <typename T, std::enable_if_t<+is_complex<T>, int> = 0>
+inline T hipblas_conjugate(const T& z)
+{
+    return T(z.x, -z.y);
+}
+
+// hipblasDatatype_t of a host type, for the datatype-parameterized Ex routines
+template <typename T>
+constexpr hipblasDatatype_t hipblas_datatype
+    = std::is_same<T, hipblasHalf>{} ? HIPBLAS_R_16F
+      : std::is_same<T, float>{} ? HIPBLAS_R_32F
+      : std::is_same<T, double>{} ? HIPBLAS_R_64F
+      : std::is_same<T, hipblasComplex>{} ? HIPBLAS_C_32F
+      : std::is_same<T, hipblasBfloat16>{} ? HIPBLAS_R_16B
+                                          : HIPBLAS_C_64F;
+
 /* =============================================================================================== */
 
 #ifdef __cplusplus
@@ -569,6 +744,12 @@ hipblasDiagType_t char2hipblas_diagonal(char value);
 
 hipblasSideMode_t char2hipblas_side(char value);
 
+hipblasNormType_t char2hipblas_norm(char value);
+
+hipblasPivot_t char2hipblas_pivot(char value);
+
+hipblasDirect_t char2hipblas_direct(char value);
+
 #ifdef __cplusplus
 }
 #endif
@@ -621,14 +802,43 @@ public:
     char side_option   = 'L';
     char uplo_option   = 'L';
     char diag_option   = 'N';
+    char norm_option   = 'O';
+    char pivot_option  = 'V';
+    char direct_option = 'F';
 
     int apiCallCount = 1;
     int batch_count  = 10;
 
+    // the algorithm or variant of routines that have several, 0 for the default
+    int algo = 0;
+
+    // the k rows of B that share a scale in the quantized gemms
+    int group_size = 128;
+
+    // the trials of hipblasSetGemmAutotune, 0 for off
+    int autotune = 0;
+
+    // the levels of recursion and the cutoff of hipblasSetGemmStrassen, 0 for off and the default
+    int strassen_levels = 0;
+    int strassen_cutoff = 0;
+
+    // the hipblasAbftMode_t of hipblasSetAbftMode, 0 for off
+    int abft_mode = 0;
+
     int norm_check = 0;
     int unit_check = 1;
     int timing     = 0;
 
+    // timed runs: cold_iters untimed warm-up calls, then hot_iters timed calls
+    int cold_iters = 2;
+    int hot_iters  = 10;
+
+    // fill the inputs on the device when nothing is checked on the host
+    int device_init = 0;
+
+    // evict the device caches before every timed launch, so it starts cold
+    int flush = 0;
+
     Arguments& operator=(const Arguments& rhs)
     {
         M  = rhs.M;
@@ -661,14 +871,35 @@ public:
         side_option   = rhs.side_option;
         uplo_option   = rhs.uplo_option;
         diag_option   = rhs.diag_option;
+        norm_option   = rhs.norm_option;
+        pivot_option  = rhs.pivot_option;
+        direct_option = rhs.direct_option;
 
         apiCallCount = rhs.apiCallCount;
         batch_count  = rhs.batch_count;
 
+        algo = rhs.algo;
+
+        group_size = rhs.group_size;
+
+        autotune = rhs.autotune;
+
+        strassen_levels = rhs.strassen_levels;
+        strassen_cutoff = rhs.strassen_cutoff;
+
+        abft_mode = rhs.abft_mode;
+
         norm_check = rhs.norm_check;
         unit_check = rhs.unit_check;
         timing     = rhs.timing;
 
+        cold_iters = rhs.cold_iters;
+        hot_iters  = rhs.hot_iters;
+
+        device_init = rhs.device_init;
+
+        flush = rhs.flush;
+
         return *this;
     }
 
@@ -678,23 +909,215 @@ public:
         return T(alpha, alphai);
     }
 
-    template <typename T, std::enable_if_t<!is_complex<T>, int> = 0>
+    template <typename T,
+              std::enable_if_t<!is_complex<T> && !std::is_same<T, hipblasHalf>{}, int> = 0>
     T get_alpha()
     {
         return T(alpha);
     }
 
+    template <typename T, std::enable_if_t<std::is_same<T, hipblasHalf>{}, int> = 0>
+    T get_alpha()
+    {
+        return float_to_half(alpha);
+    }
+
     template <typename T, std::enable_if_t<+is_complex<T>, int> = 0>
     T get_beta()
     {
         return T(beta, betai);
     }
 
-    template <typename T, std::enable_if_t<!is_complex<T>, int> = 0>
+    template <typename T,
+              std::enable_if_t<!is_complex<T> && !std::is_same<T, hipblasHalf>{}, int> = 0>
     T get_beta()
     {
         return T(beta);
     }
+
+    template <typename T, std::enable_if_t<std::is_same<T, hipblasHalf>{}, int> = 0>
+    T get_beta()
+    {
+        return float_to_half(beta);
+    }
+};
+
+/* ============================================================================================ */
+/*! \brief  Hardware counters over the timed launches of a run, as a timing observer read them;
+ *          -1 where the device does not count it */
+struct hipblas_counters
+{
+    bool   collected         = false;
+    double occupancy_percent = -1; // mean resident waves per CU over the most a CU holds
+    double l2_hit_percent    = -1;
+    double hbm_bytes         = -1; // read and written past the L2, per launch
+    double matrix_percent    = -1; // matrix core busy
+    double valu_percent      = -1; // active lanes of the VALU instructions
+};
+
+/*! \brief  Per-launch device time of a timed run, in microseconds */
+struct hipblas_timing
+{
+    double           median_us = 0.0;
+    double           min_us    = 0.0;
+    double           mad_us    = 0.0; // median absolute deviation of the launches from median_us
+    int              launches  = 0;
+    hipblas_counters counters;
+};
+
+/*! \brief  Hooks hipblas_time_launches runs around the timed launches of the thread that set
+ *          it: begin once the untimed calls are queued and end once the timed ones finished */
+struct hipblas_timing_observer
+{
+    virtual ~hipblas_timing_observer() = default;
+
+    virtual void begin(hipStream_t stream)                                         = 0;
+    virtual void end(hipStream_t stream, int launches, hipblas_counters& counters) = 0;
+};
+
+/*! \brief  The observer of the calling thread's timed runs, or nullptr for none */
+void hipblas_set_timing_observer(hipblas_timing_observer* observer);
+
+hipblas_timing_observer* hipblas_get_timing_observer();
+
+/*! \brief  A timed run as hipblas_print_timing wrote it */
+struct hipblas_timing_result
+{
+    hipblas_timing timing;
+    double         gflops = 0.0;
+    double         gbytes = 0.0; // GB/s
+    int            device = 0;   // the device current on the thread that timed it
 };
 
+/*! \brief  The runs hipblas_print_timing has written since the last call, oldest first */
+vector<hipblas_timing_result> hipblas_take_timing_results();
+
+/*! \brief  CSV columns written by hipblas_print_timing, after a routine's own argument columns */
+#define HIPBLAS_TIMING_COLUMNS "hipblas-Gflops,hipblas-GB/s,hipblas-%peak-bw,median-us,min-us"
+
+/*! \brief  Handles of the testing_* functions. While sharing is on, hipblas_client_create gives
+ *          the thread that turned it on one handle per device, created on first use, and
+ *          hipblas_client_destroy puts the stream, pointer mode and gemm backend back to their
+ *          defaults instead of destroying it. Other threads, and a second handle taken before
+ *          the first is given back, get a handle of their own. Turning sharing off destroys the
+ *          shared handles. */
+void hipblas_client_share_handles(bool share);
+
+hipblasStatus_t hipblas_client_create(hipblasHandle_t* handle);
+
+hipblasStatus_t hipblas_client_destroy(hipblasHandle_t handle);
+
+/*! \brief  Theoretical memory bandwidth of the current device in GB/s, from hipDeviceProp_t */
+double hipblas_peak_gbyte_rate();
+
+/*! \brief  Write the HIPBLAS_TIMING_COLUMNS values of a timed run that does gflop GFLOP and moves
+ *          gbyte GB per launch, and end the row. Rates are taken from the median launch. */
+void hipblas_print_timing(std::ostream&         out,
+                          const hipblas_timing& timing,
+                          double                gflop,
+                          double                gbyte);
+
+/*! \brief  Copy bytes from src to dst, both in device memory, on the handle stream: the prepare
+ *          step of hipblas_time_launches for routines that work in place */
+hipblasStatus_t
+    hipblas_restore_input(hipblasHandle_t handle, void* dst, const void* src, size_t bytes);
+
+/*! \brief  Overwrite a device buffer several times the size of the L2 cache, and at least
+ *          512 MiB for the caches behind it, on stream, so the next launch finds nothing of its
+ *          operands cached. HIPBLAS_CLIENT_FLUSH_BYTES overrides the size. The buffer is kept
+ *          per device for the rest of the process */
+hipblasStatus_t hipblas_flush_cache(hipStream_t stream);
+
+/*! \brief  GPU Timer: make argus.cold_iters untimed calls of launch, then time each of
+ *          argus.hot_iters calls with hipEvents recorded on the handle stream. prepare runs before
+ *          every call, outside the timed interval; routines that overwrite their input use it to
+ *          put the input back. With argus.flush the caches are flushed after prepare, also
+ *          untimed. Both return the hipblasStatus_t of what they do; the first failure is
+ *          returned. */
+template <typename P, typename F>
+hipblasStatus_t hipblas_time_launches(hipblasHandle_t  handle,
+                                      const Arguments& argus,
+                                      hipblas_timing&  timing,
+                                      P                prepare,
+                                      F                launch)
+{
+    hipStream_t     stream;
+    hipblasStatus_t status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    if(argus.hot_iters < 1 || argus.cold_iters < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    for(int iter = 0; iter < argus.cold_iters && status == HIPBLAS_STATUS_SUCCESS; iter++)
+    {
+        status = prepare();
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = launch();
+    }
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // an event before and after each launch, so each launch is timed on its own
+    vector<hipEvent_t> events(2 * argus.hot_iters);
+    for(auto& event : events)
+        CHECK_HIP_ERROR(hipEventCreate(&event));
+
+    hipblas_timing_observer* observer = hipblas_get_timing_observer();
+    if(observer)
+        observer->begin(stream);
+
+    for(int iter = 0; iter < argus.hot_iters && status == HIPBLAS_STATUS_SUCCESS; iter++)
+    {
+        status = prepare();
+        if(status == HIPBLAS_STATUS_SUCCESS && argus.flush)
+            status = hipblas_flush_cache(stream);
+        CHECK_HIP_ERROR(hipEventRecord(events[2 * iter], stream));
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = launch();
+        CHECK_HIP_ERROR(hipEventRecord(events[2 * iter + 1], stream));
+    }
+    CHECK_HIP_ERROR(hipEventSynchronize(events.back()));
+    if(observer)
+        observer->end(stream, argus.hot_iters, timing.counters);
+
+    vector<double> times(argus.hot_iters);
+    for(int iter = 0; iter < argus.hot_iters; iter++)
+    {
+        float ms = 0.0f;
+        CHECK_HIP_ERROR(hipEventElapsedTime(&ms, events[2 * iter], events[2 * iter + 1]));
+        times[iter] = ms * 1000.0;
+    }
+
+    for(auto& event : events)
+        CHECK_HIP_ERROR(hipEventDestroy(event));
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    auto median = [](vector<double>& v) {
+        std::sort(v.begin(), v.end());
+        size_t mid = v.size() / 2;
+        return v.size() % 2 ? v[mid] : (v[mid - 1] + v[mid]) / 2;
+    };
+    timing.median_us = median(times);
+    timing.min_us    = times.front();
+    timing.launches  = argus.hot_iters;
+    for(auto& t : times)
+        t = std::abs(t - timing.median_us);
+    timing.mad_us = median(times);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+/*! \brief  hipblas_time_launches with nothing to prepare between calls */
+template <typename F>
+hipblasStatus_t hipblas_time_launches(hipblasHandle_t  handle,
+                                      const Arguments& argus,
+                                      hipblas_timing&  timing,
+                                      F                launch)
+{
+    return hipblas_time_launches(
+        handle, argus, timing, [] { return HIPBLAS_STATUS_SUCCESS; }, launch);
+}
+
 #endif
@@ -0,0 +1,54 @@
+/* ************************************************************************
+ * Copyright 2016-2020 Advanced Micro Devices, Inc.
+ *
+ * ************************************************************************ */
+
+#pragma once
+#ifndef _YAML_CASES_H_
+#define _YAML_CASES_H_
+
+#include "utility.h"
+#include <string>
+#include <vector>
+
+/*!\file
+ * \brief Test and benchmark cases read at runtime from YAML case lists, shared by hipblas-test
+ *        and hipblas-bench.
+ *
+ * Only a small subset of YAML is recognized: suite headers, a name and a colon alone on a line
+ * starting in the first column, each followed by flow-mapping entries, one per line:
+ *
+ *     quick:
+ *       - { function: gemm, precision: s, M: 1024, N: 1024, K: 1024, transposeA: T }
+ *
+ * Keys are the long option names of hipblas-bench; M, N and K are accepted for sizem, sizen and
+ * sizek. Keys an entry leaves out keep their default. Entries before the first header belong to
+ * every suite. Blank lines and lines starting with '#' are skipped. Malformed lines, unknown
+ * keys and bad values throw std::invalid_argument naming the file and line.
+ */
+
+struct hipblas_yaml_case
+{
+    std::string suite; // empty before the first header
+    std::string function;
+    char        precision;
+    Arguments   arg;
+};
+
+/*! \brief  The cases of path whose suite is in the comma separated list suites, all cases when
+ *          suites is empty, each starting from defaults */
+std::vector<hipblas_yaml_case> hipblas_read_yaml_cases(const std::string&       path,
+                                                       const std::string&       suites,
+                                                       const hipblas_yaml_case& defaults);
+
+/*! \brief  Leading dimensions left at 0 or below take the smallest value every function in the
+ *          case lists accepts */
+void hipblas_fill_leading_dimensions(Arguments& arg);
+
+/*! \brief  The cases the yaml gtests run; hipblas-test sets them from --yaml and --suite before
+ *          the tests are registered */
+void hipblas_set_yaml_cases(std::vector<hipblas_yaml_case> cases);
+
+const std::vector<hipblas_yaml_case>& hipblas_yaml_cases();
+
+#endif
@@ -18,6 +18,11 @@
 #include <hip/hip_runtime_api.h>
 
 typedef void* hipblasHandle_t;
+typedef void* hipblasHandlePool_t;
+typedef void* hipblasGemmPlan_t;
+typedef void* hipblasGemmPacked_t;
+typedef void* hipblasBatcher_t;
+typedef void* hipblasCompletionQueue_t;
 
 typedef uint16_t hipblasHalf;
 
@@ -26,48 +31,58 @@ struct hipblasBfloat16
     uint16_t data;
 };
 
+// Marks the complex type's members callable from kernels; empty for host-only compilers, whose
+// HIP headers leave __host__ undefined
+#if defined(__host__) && defined(__device__)
+#define HIPBLAS_HOST_DEVICE __host__ __device__
+#else
+#define HIPBLAS_HOST_DEVICE
+#endif
+
+// Complex number with the size and alignment of cuComplex and cuDoubleComplex, and the layout of
+// rocblas_float_complex and rocblas_double_complex, so arrays of it pass to either library and
+// load as one 64 or 128 bit word. The default constructor is trivial: hipblasComplex c; is
+// uninitialized, as a float is, while hipblasComplex() and hipblasComplex{} are zero. Every member
+// is constexpr and callable from host and device code
 template <typename T>
-struct hip_complex_number
+struct alignas(2 * sizeof(T)) hip_complex_number
 {
     T x, y;
 
-    template <typename U>
-    hip_complex_number(U a, U b)
+    hip_complex_number() = default;
+
+    template <typename U, typename V>
+    HIPBLAS_HOST_DEVICE constexpr hip_complex_number(U a, V b)
         : x(a)
         , y(b)
     {
     }
     template <typename U>
-    hip_complex_number(U a)
+    HIPBLAS_HOST_DEVICE constexpr hip_complex_number(U a)
         : x(a)
         , y(0)
     {
     }
-    hip_complex_number()
-        : x(0)
-        , y(0)
-    {
-    }
 
-    hip_complex_number& operator*=(const hip_complex_number& rhs)
+    HIPBLAS_HOST_DEVICE constexpr hip_complex_number& operator+=(const hip_complex_number& rhs)
     {
-        return *this = {x * rhs.x - y * rhs.y, y * rhs.x + x * rhs.y};
+        return *this = {x + rhs.x, y + rhs.y};
     }
 
-    hip_complex_number operator*(const hip_complex_number& rhs) const
+    HIPBLAS_HOST_DEVICE constexpr hip_complex_number& operator-=(const hip_complex_number& rhs)
     {
-        auto lhs = *this;
-        return lhs *= rhs;
+        return *this = {x - rhs.x, y - rhs.y};
     }
 
-    hip_complex_number& operator+=(const hip_complex_number& rhs)
+    HIPBLAS_HOST_DEVICE constexpr hip_complex_number& operator*=(const hip_complex_number& rhs)
     {
-        return *this = {x + rhs.x, y + rhs.y};
+        return *this = {x * rhs.x - y * rhs.y, y * rhs.x + x * rhs.y};
     }
 
-    hip_complex_number& operator/(const hip_complex_number& rhs)
+    // Smith's algorithm, which scales by the larger part of rhs so the denominator cannot overflow
+    HIPBLAS_HOST_DEVICE constexpr hip_complex_number& operator/=(const hip_complex_number& rhs)
     {
-        if(abs(rhs.x) > abs(rhs.y))
+        if((rhs.x < 0 ? -rhs.x : rhs.x) > (rhs.y < 0 ? -rhs.y : rhs.y))
         {
             T ratio = rhs.y / rhs.x;
             T scale = 1 / (rhs.x + rhs.y * ratio);
@@ -82,19 +97,43 @@ struct hip_complex_number
         return *this;
     }
 
-    hip_complex_number& operator-(const hip_complex_number& rhs)
+    HIPBLAS_HOST_DEVICE constexpr hip_complex_number operator+(const hip_complex_number& rhs) const
     {
-        return *this = {x - rhs.x, y - rhs.y};
+        auto lhs = *this;
+        return lhs += rhs;
+    }
+
+    HIPBLAS_HOST_DEVICE constexpr hip_complex_number operator-(const hip_complex_number& rhs) const
+    {
+        auto lhs = *this;
+        return lhs -= rhs;
+    }
+
+    HIPBLAS_HOST_DEVICE constexpr hip_complex_number operator*(const hip_complex_number& rhs) const
+    {
+        auto lhs = *this;
+        return lhs *= rhs;
+    }
+
+    HIPBLAS_HOST_DEVICE constexpr hip_complex_number operator/(const hip_complex_number& rhs) const
+    {
+        auto lhs = *this;
+        return lhs /= rhs;
+    }
+
+    HIPBLAS_HOST_DEVICE constexpr hip_complex_number operator-() const
+    {
+        return {-x, -y};
     }
 
-    bool operator!=(const hip_complex_number& rhs) const
+    HIPBLAS_HOST_DEVICE constexpr bool operator==(const hip_complex_number& rhs) const
     {
-        return !(x == y);
+        return x == rhs.x && y == rhs.y;
     }
 
-    bool operator==(const hip_complex_number& rhs) const
+    HIPBLAS_HOST_DEVICE constexpr bool operator!=(const hip_complex_number& rhs) const
     {
-        return (x == rhs.x && y == rhs.y);
+        return !(*this == rhs);
     }
 };
 
@@ -103,16 +142,18 @@ typedef hip_complex_number<double> hipblasDoubleComplex;
 
 enum hipblasStatus_t
 {
-    HIPBLAS_STATUS_SUCCESS           = 0, // Function succeeds
-    HIPBLAS_STATUS_NOT_INITIALIZED   = 1, // HIPBLAS library not initialized
-    HIPBLAS_STATUS_ALLOC_FAILED      = 2, // resource allocation failed
-    HIPBLAS_STATUS_INVALID_VALUE     = 3, // unsupported numerical value was passed to function
-    HIPBLAS_STATUS_MAPPING_ERROR     = 4, // access to GPU memory space failed
-    HIPBLAS_STATUS_EXECUTION_FAILED  = 5, // GPU program failed to execute
-    HIPBLAS_STATUS_INTERNAL_ERROR    = 6, // an internal HIPBLAS operation failed
-    HIPBLAS_STATUS_NOT_SUPPORTED     = 7, // function not implemented
+    HIPBLAS_STATUS_SUCCESS           = 0,  // Function succeeds
+    HIPBLAS_STATUS_NOT_INITIALIZED   = 1,  // HIPBLAS library not initialized
+    HIPBLAS_STATUS_ALLOC_FAILED      = 2,  // resource allocation failed
+    HIPBLAS_STATUS_INVALID_VALUE     = 3,  // unsupported numerical value was passed to function
+    HIPBLAS_STATUS_MAPPING_ERROR     = 4,  // access to GPU memory space failed
+    HIPBLAS_STATUS_EXECUTION_FAILED  = 5,  // GPU program failed to execute
+    HIPBLAS_STATUS_INTERNAL_ERROR    = 6,  // an internal HIPBLAS operation failed
+    HIPBLAS_STATUS_NOT_SUPPORTED     = 7,  // function not implemented
     HIPBLAS_STATUS_ARCH_MISMATCH     = 8,
-    HIPBLAS_STATUS_HANDLE_IS_NULLPTR = 9 // hipBLAS handle is null pointer
+    HIPBLAS_STATUS_HANDLE_IS_NULLPTR = 9,  // hipBLAS handle is null pointer
+    HIPBLAS_STATUS_INVALID_ENUM      = 10, // unsupported enum value was passed to function
+    HIPBLAS_STATUS_UNKNOWN           = 11  // backend returned an unsupported status code
 };
 
 // set the values of enum constants to be the same as those used in cblas
@@ -129,6 +170,108 @@ enum hipblasPointerMode_t
     HIPBLAS_POINTER_MODE_DEVICE
 };
 
+enum hipblasAtomicsMode_t
+{
+    HIPBLAS_ATOMICS_NOT_ALLOWED = 0, // deterministic, bitwise reproducible results
+    HIPBLAS_ATOMICS_ALLOWED     = 1  // faster kernels whose reductions may use atomics
+};
+
+enum hipblasMath_t
+{
+    HIPBLAS_DEFAULT_MATH         = 0, // full-precision arithmetic
+    HIPBLAS_TF32_TENSOR_OP_MATH  = 1, // fp32 gemms may round their inputs to TF32 on matrix cores
+    HIPBLAS_FP16_ACCUMULATE_MATH = 2, // fp16 gemms computed in fp32 may accumulate in fp16
+    HIPBLAS_BF16X3_MATH          = 4, // fp32 gemms run as three bf16 products, fp32 accumulated
+    HIPBLAS_INT8_FP64_MATH       = 8, // fp64 gemms run as int8 slice products, fp64 accumulated
+    HIPBLAS_FLUSH_DENORM_MATH    = 16 // the data-movement Ex routines take subnormals as zero
+};
+
+enum hipblasGemmBackend_t
+{
+    HIPBLAS_GEMM_BACKEND_DEFAULT, // the backend's classic gemm entry points
+    HIPBLAS_GEMM_BACKEND_LT       // cuBLASLt where hipBLAS was built with it
+};
+
+enum hipblasCaptureMode_t
+{
+    HIPBLAS_CAPTURE_MODE_DEFAULT, // the workspace grows on demand
+    HIPBLAS_CAPTURE_MODE_SAFE     // no allocation, synchronization or device-to-host copy
+};
+
+enum hipblasPointerArrayMode_t
+{
+    HIPBLAS_POINTER_ARRAY_DEVICE, // the pointer arrays of batched calls are in device memory
+    HIPBLAS_POINTER_ARRAY_HOST // they are in host memory, and hipBLAS uploads them
+};
+
+enum hipblasManagedMemoryMode_t
+{
+    HIPBLAS_MANAGED_MEMORY_DEFAULT, // managed operands migrate on first touch
+    HIPBLAS_MANAGED_MEMORY_PREFETCH // each call prefetches its managed operands to the device
+};
+
+enum hipblasHostDispatchMode_t
+{
+    HIPBLAS_HOST_DISPATCH_OFF, // operands are used where they are
+    HIPBLAS_HOST_DISPATCH_ON   // gemm and axpy on host operands run wherever they finish first
+};
+
+enum hipblasThreadMode_t
+{
+    HIPBLAS_THREAD_MODE_SHARED,    // every thread uses the handle and its stream as they are
+    HIPBLAS_THREAD_MODE_PER_THREAD // each thread uses its own copy, with its own stream
+};
+
+enum hipblasStreamPriority_t
+{
+    HIPBLAS_STREAM_PRIORITY_DEFAULT, // the stream set by hipblasSetStream, null by default
+    HIPBLAS_STREAM_PRIORITY_HIGH,    // a stream of the device's greatest priority
+    HIPBLAS_STREAM_PRIORITY_LOW      // a stream of the device's least priority
+};
+
+enum hipblasResultMode_t
+{
+    HIPBLAS_RESULT_MODE_BLOCKING, // reductions store their host result before returning
+    HIPBLAS_RESULT_MODE_ASYNC     // hipblasSynchronizeResults stores it
+};
+
+enum hipblasShapeDispatchMode_t
+{
+    HIPBLAS_SHAPE_DISPATCH_ON, // degenerate gemms run as the gemv, ger or dot they reduce to
+    HIPBLAS_SHAPE_DISPATCH_OFF // every gemm runs the backend's gemm
+};
+
+enum hipblasStatsMode_t
+{
+    HIPBLAS_STATS_MODE_OFF, // counters keep their values but stop counting
+    HIPBLAS_STATS_MODE_ON
+};
+
+enum hipblasTimingMode_t
+{
+    HIPBLAS_TIMING_MODE_OFF, // records already taken can still be drained
+    HIPBLAS_TIMING_MODE_ON
+};
+
+enum hipblasAbftMode_t
+{
+    HIPBLAS_ABFT_OFF,    // gemms run unchecked
+    HIPBLAS_ABFT_DETECT, // checksums are verified and failed tiles counted
+    HIPBLAS_ABFT_CORRECT // failed tiles are also recomputed
+};
+
+// Groups the per-handle counters of hipblasGetHandleStats
+enum hipblasRoutineFamily_t
+{
+    HIPBLAS_FAMILY_LEVEL1, // vector-vector
+    HIPBLAS_FAMILY_LEVEL2, // matrix-vector
+    HIPBLAS_FAMILY_LEVEL3, // matrix-matrix
+    HIPBLAS_FAMILY_EXTENSION, // the *Ex functions, geam and dgmm
+    HIPBLAS_FAMILY_SOLVER, // LAPACK-style factorizations and solves
+    HIPBLAS_FAMILY_AUXILIARY, // handle, mode and host/device copy functions
+    HIPBLAS_FAMILY_COUNT
+};
+
 enum hipblasFillMode_t
 {
     HIPBLAS_FILL_MODE_UPPER = 121,
@@ -149,29 +292,334 @@ enum hipblasSideMode_t
     HIPBLAS_SIDE_BOTH  = 143
 };
 
+// Whether the eigensolvers also return eigenvectors; the values match rocblas_evect
+enum hipblasEvect_t
+{
+    HIPBLAS_EVECT_ORIGINAL = 211, /**< eigenvectors of the original matrix, written over A */
+    HIPBLAS_EVECT_NONE     = 213  /**< eigenvalues only */
+};
+
+// Whether gesvdj also returns singular vectors; the values match rocblas_svect
+enum hipblasSvect_t
+{
+    HIPBLAS_SVECT_SINGULAR = 192, /**< the min(m, n) singular vectors */
+    HIPBLAS_SVECT_NONE     = 194  /**< singular values only */
+};
+
+// Order of the plane rotations lasr applies; the values match rocblas_direct
+enum hipblasDirect_t
+{
+    HIPBLAS_FORWARD_DIRECTION  = 171, /**< P(0) first */
+    HIPBLAS_BACKWARD_DIRECTION = 172  /**< P(z - 2) first */
+};
+
+// The plane lasr's rotation P(k) acts in, for a sequence over z rows or columns
+enum hipblasPivot_t
+{
+    HIPBLAS_PIVOT_VARIABLE, /**< rows or columns k and k + 1 */
+    HIPBLAS_PIVOT_TOP,      /**< 0 and k + 1 */
+    HIPBLAS_PIVOT_BOTTOM    /**< k and z - 1 */
+};
+
+// How hipblasXtsqr factors its tall-skinny A. CholeskyQR2 is two passes of syrk, potrf and trsm,
+// gemm-like work throughout, and turns to Householder when a Gram matrix is not numerically
+// positive definite; Householder is geqrf and orgqr
+enum hipblasTsqrAlgo_t
+{
+    HIPBLAS_TSQR_AUTO,         /**< CholeskyQR2 when m is at least 16 n, else Householder */
+    HIPBLAS_TSQR_CHOLESKY_QR2, /**< CholeskyQR2 whatever the shape */
+    HIPBLAS_TSQR_HOUSEHOLDER   /**< geqrf and orgqr */
+};
+
 enum hipblasDatatype_t
 {
-    HIPBLAS_R_16F = 150, /**< 16 bit floating point, real */
-    HIPBLAS_R_32F = 151, /**< 32 bit floating point, real */
-    HIPBLAS_R_64F = 152, /**< 64 bit floating point, real */
-    HIPBLAS_C_16F = 153, /**< 16 bit floating point, complex */
-    HIPBLAS_C_32F = 154, /**< 32 bit floating point, complex */
-    HIPBLAS_C_64F = 155, /**< 64 bit floating point, complex */
-    HIPBLAS_R_8I  = 160, /**<  8 bit signed integer, real */
-    HIPBLAS_R_8U  = 161, /**<  8 bit unsigned integer, real */
-    HIPBLAS_R_32I = 162, /**< 32 bit signed integer, real */
-    HIPBLAS_R_32U = 163, /**< 32 bit unsigned integer, real */
-    HIPBLAS_C_8I  = 164, /**<  8 bit signed integer, complex */
-    HIPBLAS_C_8U  = 165, /**<  8 bit unsigned integer, complex */
-    HIPBLAS_C_32I = 166, /**< 32 bit signed integer, complex */
-    HIPBLAS_C_32U = 167, /**< 32 bit unsigned integer, complex */
-    HIPBLAS_R_16B = 168, /**< 16 bit bfloat, real */
-    HIPBLAS_C_16B = 169, /**< 16 bit bfloat, complex */
+    HIPBLAS_R_16F                     = 150, /**< 16 bit floating point, real */
+    HIPBLAS_R_32F                     = 151, /**< 32 bit floating point, real */
+    HIPBLAS_R_64F                     = 152, /**< 64 bit floating point, real */
+    HIPBLAS_C_16F                     = 153, /**< 16 bit floating point, complex */
+    HIPBLAS_C_32F                     = 154, /**< 32 bit floating point, complex */
+    HIPBLAS_C_64F                     = 155, /**< 64 bit floating point, complex */
+    HIPBLAS_R_8I                      = 160, /**<  8 bit signed integer, real */
+    HIPBLAS_R_8U                      = 161, /**<  8 bit unsigned integer, real */
+    HIPBLAS_R_32I                     = 162, /**< 32 bit signed integer, real */
+    HIPBLAS_R_32U                     = 163, /**< 32 bit unsigned integer, real */
+    HIPBLAS_C_8I                      = 164, /**<  8 bit signed integer, complex */
+    HIPBLAS_C_8U                      = 165, /**<  8 bit unsigned integer, complex */
+    HIPBLAS_C_32I                     = 166, /**< 32 bit signed integer, complex */
+    HIPBLAS_C_32U                     = 167, /**< 32 bit unsigned integer, complex */
+    HIPBLAS_R_16B                     = 168, /**< 16 bit bfloat, real */
+    HIPBLAS_C_16B                     = 169, /**< 16 bit bfloat, complex */
+    HIPBLAS_R_8F_E4M3                 = 170, /**<  8 bit OCP float e4m3, max 448, real */
+    HIPBLAS_R_8F_E5M2                 = 171, /**<  8 bit OCP float e5m2, max 57344, real */
+    HIPBLAS_COMPUTE_32F_FAST_TF32     = 172, /**< compute type only: fp32 with TF32 inputs */
+    HIPBLAS_COMPUTE_32F_FAST_BF16X3   = 173, /**< compute type only: fp32 as three bf16 products */
+    HIPBLAS_COMPUTE_64F_EMULATED_INT8 = 174, /**< compute type only: fp64 as int8 slice products */
 };
 
 enum hipblasGemmAlgo_t
 {
-    HIPBLAS_GEMM_DEFAULT = 160
+    HIPBLAS_GEMM_DEFAULT           = 160,
+    HIPBLAS_GEMM_DEFAULT_TENSOR_OP = 161,
+    HIPBLAS_GEMM_ALGO0             = 170,
+    HIPBLAS_GEMM_ALGO1             = 171,
+    HIPBLAS_GEMM_ALGO2             = 172,
+    HIPBLAS_GEMM_ALGO3             = 173,
+    HIPBLAS_GEMM_ALGO4             = 174,
+    HIPBLAS_GEMM_ALGO5             = 175,
+    HIPBLAS_GEMM_ALGO6             = 176,
+    HIPBLAS_GEMM_ALGO7             = 177,
+    HIPBLAS_GEMM_ALGO8             = 178,
+    HIPBLAS_GEMM_ALGO9             = 179,
+    HIPBLAS_GEMM_ALGO10            = 180,
+    HIPBLAS_GEMM_ALGO11            = 181,
+    HIPBLAS_GEMM_ALGO12            = 182,
+    HIPBLAS_GEMM_ALGO13            = 183,
+    HIPBLAS_GEMM_ALGO14            = 184,
+    HIPBLAS_GEMM_ALGO15            = 185,
+    HIPBLAS_GEMM_ALGO16            = 186,
+    HIPBLAS_GEMM_ALGO17            = 187,
+    HIPBLAS_GEMM_ALGO18            = 188,
+    HIPBLAS_GEMM_ALGO19            = 189,
+    HIPBLAS_GEMM_ALGO20            = 190,
+    HIPBLAS_GEMM_ALGO21            = 191,
+    HIPBLAS_GEMM_ALGO22            = 192,
+    HIPBLAS_GEMM_ALGO23            = 193,
+    HIPBLAS_GEMM_ALGO0_TENSOR_OP   = 200,
+    HIPBLAS_GEMM_ALGO1_TENSOR_OP   = 201,
+    HIPBLAS_GEMM_ALGO2_TENSOR_OP   = 202,
+    HIPBLAS_GEMM_ALGO3_TENSOR_OP   = 203,
+    HIPBLAS_GEMM_ALGO4_TENSOR_OP   = 204,
+    HIPBLAS_GEMM_ALGO5_TENSOR_OP   = 205,
+    HIPBLAS_GEMM_ALGO6_TENSOR_OP   = 206,
+    HIPBLAS_GEMM_ALGO7_TENSOR_OP   = 207,
+    HIPBLAS_GEMM_ALGO8_TENSOR_OP   = 208,
+    HIPBLAS_GEMM_ALGO9_TENSOR_OP   = 209,
+    HIPBLAS_GEMM_ALGO10_TENSOR_OP  = 210,
+    HIPBLAS_GEMM_ALGO11_TENSOR_OP  = 211,
+    HIPBLAS_GEMM_ALGO12_TENSOR_OP  = 212,
+    HIPBLAS_GEMM_ALGO13_TENSOR_OP  = 213,
+    HIPBLAS_GEMM_ALGO14_TENSOR_OP  = 214,
+    HIPBLAS_GEMM_ALGO15_TENSOR_OP  = 215
+};
+
+enum hipblasGemmFlags_t
+{
+    HIPBLAS_GEMM_FLAGS_NONE        = 0,
+    HIPBLAS_GEMM_FLAGS_PACK_INT8x4 = 1 /**< int8 A and B are packed 4 along k (rocBLAS only) */
+};
+
+enum hipblasActivation_t
+{
+    HIPBLAS_ACTIVATION_NONE = 0,
+    HIPBLAS_ACTIVATION_RELU = 1,
+    HIPBLAS_ACTIVATION_GELU = 2 /**< tanh approximation */
+};
+
+// Work fused onto the output of hipblasGemmExWithEpilogue. With P = alpha * op(A) op(B) + beta * C
+// + bias, aux receives P for the backward pass and C is overwritten with scale * activation(P).
+// bias is a device vector of m entries and aux a device matrix with leading dimension ldaux, both
+// of c_type; either may be nullptr
+struct hipblasGemmEpilogue_t
+{
+    hipblasActivation_t activation;
+    const void*         bias;
+    double              scale;
+    void*               aux;
+    int                 ldaux;
+};
+
+// Scaling of hipblasGemmExWithScales, which computes
+//     D = scale_d * (alpha * (scale_a * op(A)) (scale_b * op(B)) + beta * scale_c * C)
+// Each scale is a device float, nullptr meaning 1. amax_d, when set, is a device float that
+// receives the largest magnitude in D before scale_d is applied, for choosing the next scale_d
+struct hipblasGemmScales_t
+{
+    const float* scale_a;
+    const float* scale_b;
+    const float* scale_c;
+    const float* scale_d;
+    float*       amax_d;
+};
+
+// Which entries of hipblasRequantization_t's scale and bias apply to C(i, j): entry 0, entry i or
+// entry j, the last two matching per-output-channel weights as A or as B
+enum hipblasRequantMode_t
+{
+    HIPBLAS_REQUANT_PER_TENSOR,
+    HIPBLAS_REQUANT_PER_ROW,
+    HIPBLAS_REQUANT_PER_COLUMN
+};
+
+// Requantization of hipblasGemmExWithRequantization, which computes
+//     C(i, j) = saturate(round(scale[c] * ((op(A) op(B))(i, j) + bias[c])) + zero_point)
+// with the product summed in int32, c the entry mode selects, rounding to nearest even and
+// saturation to [-128, 127]. scale is device floats and bias device int32s, added to the
+// accumulator before scaling; a null bias is 0
+struct hipblasRequantization_t
+{
+    hipblasRequantMode_t mode;
+    const float*         scale;
+    const int32_t*       bias;
+    int32_t              zero_point;
+};
+
+// Storage of the quantized B of hipblasGemmQuantizedEx. The 4-bit formats hold two values per
+// byte, the one of lower k index in the low nibble; the signed formats are two's complement
+enum hipblasWeightFormat_t
+{
+    HIPBLAS_WEIGHT_INT8,
+    HIPBLAS_WEIGHT_UINT8,
+    HIPBLAS_WEIGHT_INT4,
+    HIPBLAS_WEIGHT_UINT4
+};
+
+// Dequantization of hipblasGemmQuantizedEx, whose B is used as
+//     B(l, j) = scales(l / group_size, j) * (Q(l, j) - zeros(l / group_size, j))
+// for the k x n matrix Q stored in format. scales and zeros are ceil(k / group_size) x n, in
+// device memory with leading dimension ld_scales and of scale_type, R_16F or R_32F; zeros is
+// nullptr for symmetric quantization. A group_size of k gives one scale per column
+struct hipblasWeightQuantization_t
+{
+    hipblasWeightFormat_t format;
+    int                   group_size;
+    const void*           scales;
+    const void*           zeros;
+    hipblasDatatype_t     scale_type;
+    int                   ld_scales;
+};
+
+// An m x k matrix A with 2:4 structured sparsity, as hipblasSparseCompress24 leaves it: of each
+// group of four consecutive values along a row, A(i, 4g) to A(i, 4g + 3), at most two are nonzero.
+// values is m x k / 2, column major with leading dimension ld_values, holding the two kept values
+// of group g as columns 2g and 2g + 1. metadata is m x k / 4 bytes with leading dimension
+// ld_metadata; byte (i, g) holds the positions in the group of the first kept value in bits 0-1
+// and of the second in bits 2-3. Both are in device memory
+struct hipblasSparse24Matrix_t
+{
+    void*    values;
+    int      ld_values;
+    uint8_t* metadata;
+    int      ld_metadata;
+};
+
+// Whether hipblasAmaxQuantize takes one amax and scale per matrix or one per row of it
+enum hipblasAmaxMode_t
+{
+    HIPBLAS_AMAX_PER_TENSOR,
+    HIPBLAS_AMAX_PER_ROW
+};
+
+// Storage order of the matrices passed to the *WithOrder functions, as CBLAS_ORDER is for cblas
+enum hipblasOrder_t
+{
+    HIPBLAS_ORDER_COLUMN_MAJOR,
+    HIPBLAS_ORDER_ROW_MAJOR
+};
+
+// The matrix norm hipblas?lange computes, as the norm argument of LAPACK's lange: the largest
+// modulus ('M'), the largest column sum ('1' or 'O'), the largest row sum ('I') and the Frobenius
+// norm ('F' or 'E')
+enum hipblasNormType_t
+{
+    HIPBLAS_NORM_MAX,
+    HIPBLAS_NORM_ONE,
+    HIPBLAS_NORM_INF,
+    HIPBLAS_NORM_FROBENIUS
+};
+
+// Counters for one hipblasRoutineFamily_t. bytes and flops are estimates from the arguments, kept
+// for the gemm, gemv and vector functions most workloads are made of, and 0 for the others
+struct hipblasRoutineStats_t
+{
+    unsigned long long calls;
+    unsigned long long bytes;
+    unsigned long long flops;
+    unsigned long long host_ns;
+};
+
+struct hipblasHandleStats_t
+{
+    hipblasRoutineStats_t family[HIPBLAS_FAMILY_COUNT];
+};
+
+// One timed call of hipblasDrainTimings. m, n and k are 0 for functions without them and
+// batch_count is 1 for those that are not batched; sequence numbers, from 0, the calls made while
+// timing was on, so gaps are the calls not sampled or dropped
+struct hipblasCallTiming_t
+{
+    const char*            function;
+    hipblasRoutineFamily_t family;
+    long long              m;
+    long long              n;
+    long long              k;
+    long long              batch_count;
+    unsigned long long     sequence;
+    float                  gpu_ms;
+};
+
+// Workspace figures of hipblasGetWorkspaceUsage. device_memory is the backend's own memory, as for
+// hipblasGetDeviceMemorySize, and 0 where the backend does not report it
+struct hipblasWorkspaceUsage_t
+{
+    size_t             size;
+    size_t             high_water_mark;
+    unsigned long long growths;
+    size_t             limit;
+    size_t             device_memory;
+};
+
+// Checksum figures of hipblasGetAbftReport since the handle was created or the report reset.
+// corrected_tiles counts the failed tiles whose recomputation passed, and unchecked_calls the
+// gemms checksums applied to that ran unchecked, their checksums not fitting the buffer
+struct hipblasAbftReport_t
+{
+    unsigned long long calls;
+    unsigned long long tiles;
+    unsigned long long failed_tiles;
+    unsigned long long corrected_tiles;
+    unsigned long long unchecked_calls;
+};
+
+// One gemm problem for hipblasWarmup, described as for hipblasGemmEx
+struct hipblasGemmShape_t
+{
+    hipblasOperation_t transA;
+    hipblasOperation_t transB;
+    int                m;
+    int                n;
+    int                k;
+    hipblasDatatype_t  a_type;
+    hipblasDatatype_t  b_type;
+    hipblasDatatype_t  c_type;
+    hipblasDatatype_t  compute_type;
+};
+
+enum hipblasJobType_t
+{
+    HIPBLAS_JOB_AXPY = 0, // C = alpha * B + C for vectors of n elements
+    HIPBLAS_JOB_GEMV = 1, // C = alpha * op(A) * B + beta * C for the m x n matrix A
+    HIPBLAS_JOB_GEMM = 2  // C = alpha * op(A) * op(B) + beta * C for the m x n matrix C
+};
+
+// One operation of a job list. Vector operands use ldb and ldc as their increments, which may be
+// negative as in BLAS; transb and k are read by gemm only, and A, lda, transa and beta not by axpy.
+// alpha and beta are host values in the list's type, whatever the pointer mode
+struct hipblasJob_t
+{
+    hipblasJobType_t   type;
+    hipblasOperation_t transa;
+    hipblasOperation_t transb;
+    int                m;
+    int                n;
+    int                k;
+    double             alpha;
+    double             beta;
+    const void*        A;
+    int                lda;
+    const void*        B;
+    int                ldb;
+    void*              C;
+    int                ldc;
 };
 
 #ifdef __cplusplus
@@ -182,16 +630,532 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCreate(hipblasHandle_t* handle);
 
 HIPBLAS_EXPORT hipblasStatus_t hipblasDestroy(hipblasHandle_t handle);
 
+// Thread-safe cache of idle handles for code that creates a handle per request. Acquire reuses
+// an idle handle made on the current device, keeping its backend state and workspace, or creates
+// one; Release resets the stream, its priority and CU mask, the pointer, capture, result, atomics,
+// math, gemm backend and autotune modes, the workspace, the independent streams and the tuning
+// table to what hipblasCreate gives, then returns it to the pool. Release a handle before
+// destroying the stream set on it; release every handle before destroying the pool, which
+// destroys the idle ones
+HIPBLAS_EXPORT hipblasStatus_t hipblasHandlePoolCreate(hipblasHandlePool_t* pool);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasHandlePoolDestroy(hipblasHandlePool_t pool);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasHandlePoolAcquire(hipblasHandlePool_t pool,
+                                                        hipblasHandle_t*    handle);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasHandlePoolRelease(hipblasHandlePool_t pool,
+                                                        hipblasHandle_t     handle);
+
+// Opt-in front end that merges small gemm and gemv calls submitted from many threads. A dispatcher
+// thread collects the calls for up to window_us microseconds after the first one arrives, or until
+// max_batch are queued, and launches each group of calls with the same precision, operations,
+// sizes, leading dimensions, increments and scalar values as one *StridedBatched call when their
+// matrices are evenly spaced and one *Batched call otherwise, on its own handle made on the
+// current device and set to stream. alpha and beta are host scalars read at submission. Each
+// submission returns a ticket; Wait blocks until the launch holding that call has run on the
+// device and returns the call's status, which is only reported once. The operands must stay valid
+// and unmodified until then. Flush dispatches the queued calls without waiting for the window;
+// Destroy runs them and waits for the device
+HIPBLAS_EXPORT hipblasStatus_t hipblasBatcherCreate(hipblasBatcher_t* batcher,
+                                                    hipStream_t       stream,
+                                                    int               window_us,
+                                                    int               max_batch);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasBatcherDestroy(hipblasBatcher_t batcher);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasBatcherFlush(hipblasBatcher_t batcher);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasBatcherWait(hipblasBatcher_t batcher, uint64_t ticket);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasBatcherSgemm(hipblasBatcher_t   batcher,
+                                                   hipblasOperation_t transa,
+                                                   hipblasOperation_t transb,
+                                                   int                m,
+                                                   int                n,
+                                                   int                k,
+                                                   const float*       alpha,
+                                                   const float*       A,
+                                                   int                lda,
+                                                   const float*       B,
+                                                   int                ldb,
+                                                   const float*       beta,
+                                                   float*             C,
+                                                   int                ldc,
+                                                   uint64_t*          ticket);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasBatcherDgemm(hipblasBatcher_t   batcher,
+                                                   hipblasOperation_t transa,
+                                                   hipblasOperation_t transb,
+                                                   int                m,
+                                                   int                n,
+                                                   int                k,
+                                                   const double*      alpha,
+                                                   const double*      A,
+                                                   int                lda,
+                                                   const double*      B,
+                                                   int                ldb,
+                                                   const double*      beta,
+                                                   double*            C,
+                                                   int                ldc,
+                                                   uint64_t*          ticket);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasBatcherSgemv(hipblasBatcher_t   batcher,
+                                                   hipblasOperation_t trans,
+                                                   int                m,
+                                                   int                n,
+                                                   const float*       alpha,
+                                                   const float*       A,
+                                                   int                lda,
+                                                   const float*       x,
+                                                   int                incx,
+                                                   const float*       beta,
+                                                   float*             y,
+                                                   int                incy,
+                                                   uint64_t*          ticket);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasBatcherDgemv(hipblasBatcher_t   batcher,
+                                                   hipblasOperation_t trans,
+                                                   int                m,
+                                                   int                n,
+                                                   const double*      alpha,
+                                                   const double*      A,
+                                                   int                lda,
+                                                   const double*      x,
+                                                   int                incx,
+                                                   const double*      beta,
+                                                   double*            y,
+                                                   int                incy,
+                                                   uint64_t*          ticket);
+
+// Called on the completion queue's thread once the work queued before the notification has run,
+// with HIPBLAS_STATUS_SUCCESS, or HIPBLAS_STATUS_EXECUTION_FAILED when the stream failed
+typedef void (*hipblasCompletionCallback_t)(void* user_data, hipblasStatus_t status);
+
+// Tells host code when device work is done without a thread blocking in hipStreamSynchronize.
+// Notify records an event, taken from a pool the queue keeps per device, on the handle's stream
+// and returns at once; a polling thread of the queue queries the pending events every poll_us
+// microseconds, oldest first, and calls each callback from that thread as its event completes.
+// Callbacks should be short: later ones wait for them. Destroy waits for every pending callback
+// to have run. Not available on a handle in HIPBLAS_CAPTURE_MODE_SAFE, as events recorded in a
+// capture never complete by themselves; hipblas_async.hpp builds futures and awaitables on this
+HIPBLAS_EXPORT hipblasStatus_t hipblasCompletionQueueCreate(hipblasCompletionQueue_t* queue,
+                                                            int                       poll_us);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCompletionQueueDestroy(hipblasCompletionQueue_t queue);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCompletionQueueNotify(hipblasCompletionQueue_t    queue,
+                                                            hipblasHandle_t             handle,
+                                                            hipblasCompletionCallback_t callback,
+                                                            void*                       user_data);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasSetStream(hipblasHandle_t handle, hipStream_t streamId);
 
 HIPBLAS_EXPORT hipblasStatus_t hipblasGetStream(hipblasHandle_t handle, hipStream_t* streamId);
 
+// Device workspace used for hipBLAS-internal temporaries. By default hipBLAS owns it and grows it
+// on demand; a user buffer set here is never reallocated. Pass nullptr, 0 to return to the default.
+HIPBLAS_EXPORT hipblasStatus_t hipblasSetWorkspace(hipblasHandle_t handle, void* addr, size_t size);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetWorkspaceSize(hipblasHandle_t handle, size_t* size);
+
+// Sizing the workspace. The high-water mark is the largest amount any call on the handle asked
+// for since it was created or last reset, including requests that failed, and growths counts the
+// reallocations of library-owned storage in the same window. With a limit set, a call that would
+// grow library-owned storage past it fails with HIPBLAS_STATUS_ALLOC_FAILED instead; 0 removes
+// the limit, and storage already allocated is kept either way
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetWorkspaceHighWaterMark(hipblasHandle_t handle,
+                                                                size_t*         bytes);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetWorkspaceUsage(hipblasHandle_t          handle,
+                                                        hipblasWorkspaceUsage_t* usage);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasResetWorkspaceHighWaterMark(hipblasHandle_t handle);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSetWorkspaceLimit(hipblasHandle_t handle, size_t limit);
+
+// Device memory the backend library keeps for its own temporaries, separate from the workspace
+// above. Setting a size makes the backend allocate exactly that much once; 0 returns to its
+// default of growing on demand. Between Start and Stop every call on the handle only records the
+// memory it would need and computes nothing, and Stop returns the largest amount seen, so a
+// representative sequence of calls can size the memory up front. hipBLAS kernels outside the
+// backend still run in that window; hipblasGetWorkspaceSize reports their memory. The cuBLAS
+// backend manages this memory itself and returns HIPBLAS_STATUS_NOT_SUPPORTED
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetDeviceMemorySize(hipblasHandle_t handle, size_t* size);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSetDeviceMemorySize(hipblasHandle_t handle, size_t size);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasStartDeviceMemorySizeQuery(hipblasHandle_t handle);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasStopDeviceMemorySizeQuery(hipblasHandle_t handle,
+                                                                size_t*         size);
+
+// In HIPBLAS_CAPTURE_MODE_SAFE every BLAS and solver call on the handle may be recorded by stream
+// capture: none of them allocates, synchronizes or copies to the host. A call that needs more
+// workspace than the handle holds fails with HIPBLAS_STATUS_ALLOC_FAILED instead of growing it,
+// so set a workspace or run the sequence once before capture. Pointer-mode changes only touch
+// host-side state.
+HIPBLAS_EXPORT hipblasStatus_t hipblasSetCaptureMode(hipblasHandle_t      handle,
+                                                     hipblasCaptureMode_t mode);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetCaptureMode(hipblasHandle_t       handle,
+                                                     hipblasCaptureMode_t* mode);
+
+// Records the calls made on the handle between Begin and End into a graph, so a sequence of many
+// small calls replays with one hipGraphLaunch. Begin starts capturing the handle's stream, which
+// must not be the null stream, and switches the handle to HIPBLAS_CAPTURE_MODE_SAFE until the
+// capture ends; keep the stream and make no synchronizing calls on it in between. End stops the
+// capture and instantiates it into *graph, which the caller launches on any stream and destroys
+// with hipGraphExecDestroy. Update instead records into an existing executable from End, so new
+// pointers and host-mode scalars are bound without instantiating again; it fails with
+// HIPBLAS_STATUS_INVALID_VALUE, leaving graph as it was, when the calls differ in kind or order.
+// Scalars in device pointer mode are read when the graph runs and need no update. End and Update
+// fail with HIPBLAS_STATUS_INTERNAL_ERROR when a call invalidated the capture; the handle is no
+// longer capturing after either returns
+HIPBLAS_EXPORT hipblasStatus_t hipblasBeginCapture(hipblasHandle_t handle);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasEndCapture(hipblasHandle_t handle, hipGraphExec_t* graph);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasUpdateCapture(hipblasHandle_t handle, hipGraphExec_t graph);
+
+// In HIPBLAS_POINTER_ARRAY_HOST the A[], x[] and other pointer arrays of every *Batched call on
+// the handle, including the batched Ex and solver functions, are host arrays of device pointers.
+// Each call copies them into a pinned slot of a small ring owned by the handle and uploads them
+// on the handle's stream, so the caller may reuse its arrays as soon as the call returns. A slot
+// is reused once the call that last used it has run, so staging only waits when that many calls
+// are still queued. The rotg and rotmg scalar arrays and rotm's param array follow the pointer
+// mode as before. Host arrays are not supported in HIPBLAS_CAPTURE_MODE_SAFE, where such calls
+// fail with HIPBLAS_STATUS_NOT_SUPPORTED
+HIPBLAS_EXPORT hipblasStatus_t hipblasSetPointerArrayMode(hipblasHandle_t           handle,
+                                                          hipblasPointerArrayMode_t mode);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetPointerArrayMode(hipblasHandle_t            handle,
+                                                          hipblasPointerArrayMode_t* mode);
+
+// In HIPBLAS_MANAGED_MEMORY_PREFETCH every call on the handle looks up its pointer arguments, and
+// for each one in managed memory advises the driver that the device accesses it and prefetches it
+// on the handle's stream, from the pointer to the end of its allocation, before the work is
+// queued. The scalars alpha and beta and the result of reductions are left where they are, and of
+// batched calls only the pointer arrays themselves are seen. No prefetches are issued in
+// HIPBLAS_CAPTURE_MODE_SAFE
+HIPBLAS_EXPORT hipblasStatus_t hipblasSetManagedMemoryMode(hipblasHandle_t            handle,
+                                                           hipblasManagedMemoryMode_t mode);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetManagedMemoryMode(hipblasHandle_t             handle,
+                                                           hipblasManagedMemoryMode_t* mode);
+
+// In HIPBLAS_HOST_DISPATCH_ON, gemm and axpy of every precision but half take pinned or mapped
+// host memory for their matrices and vectors in HIPBLAS_POINTER_MODE_HOST. Each such call runs
+// on the host or on compact copies in the device's workspace, whichever a cost model calibrated
+// once per device, when the mode is first set on it, says finishes first, and has completed when
+// it returns. Calls with any operand elsewhere, with non-positive increments or in
+// HIPBLAS_CAPTURE_MODE_SAFE run as before
+HIPBLAS_EXPORT hipblasStatus_t hipblasSetHostDispatchMode(hipblasHandle_t           handle,
+                                                          hipblasHostDispatchMode_t mode);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetHostDispatchMode(hipblasHandle_t            handle,
+                                                          hipblasHostDispatchMode_t* mode);
+
+// Calls that do not depend on each other can run concurrently on streams the handle owns. With
+// count > 0 the handle keeps count streams, each with its own backend handle and workspace, on
+// the handle's device; 0 releases them. hipblasGetIndependentHandle hands out their handles in
+// turn, each set to the modes the handle has at that moment and ordered after the work queued so
+// far on the handle's stream; calls made through it run on its stream, without switching the
+// stream of any handle. hipblasSynchronizeHandle then makes the handle's stream wait for the
+// work queued on every stream handed out since the last join. It is event-based and does not
+// block the host, so it also joins the streams inside a capture. With no streams the handle
+// hands out itself. Join before changing the count, and never destroy the handed-out handles
+HIPBLAS_EXPORT hipblasStatus_t hipblasSetIndependentStreams(hipblasHandle_t handle, int count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetIndependentStreams(hipblasHandle_t handle, int* count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetIndependentHandle(hipblasHandle_t  handle,
+                                                           hipblasHandle_t* independent);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSynchronizeHandle(hipblasHandle_t handle);
+
+// In HIPBLAS_THREAD_MODE_PER_THREAD any number of threads may use the handle at once. The first
+// call a thread makes on it creates that thread's copy, on the handle's device and with the
+// handle's stream and modes at that moment; from then on every call the thread makes on the
+// handle goes to its copy without taking a lock. Stream, workspace, modes and counters set on the
+// handle are then the calling thread's own, so each thread calls hipblasSetStream for itself. The
+// copies live until the handle is destroyed or returned to a handle pool. Set the mode before
+// sharing the handle; hipblasDestroy and these two functions always act on the handle itself
+HIPBLAS_EXPORT hipblasStatus_t hipblasSetThreadMode(hipblasHandle_t     handle,
+                                                    hipblasThreadMode_t mode);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetThreadMode(hipblasHandle_t      handle,
+                                                    hipblasThreadMode_t* mode);
+
+// With HIPBLAS_STREAM_PRIORITY_HIGH or _LOW the handle creates and owns a non-blocking stream of
+// that priority and makes it the handle's stream, so work on a high-priority handle is scheduled
+// ahead of work queued on low-priority ones. The streams hipBLAS creates for the handle, those of
+// hipblasSetIndependentStreams and of the Xt functions, get the same priority; set it while
+// they are joined and idle. HIPBLAS_STREAM_PRIORITY_DEFAULT destroys the owned stream and returns
+// the handle to the null stream. A stream set later with hipblasSetStream replaces the owned one
+// until the priority is set again. Not available in HIPBLAS_CAPTURE_MODE_SAFE
+HIPBLAS_EXPORT hipblasStatus_t hipblasSetStreamPriority(hipblasHandle_t         handle,
+                                                        hipblasStreamPriority_t priority);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetStreamPriority(hipblasHandle_t          handle,
+                                                        hipblasStreamPriority_t* priority);
+
+// On AMD devices a mask of count 32-bit words, bit i % 32 of word i / 32 standing for CU i, makes
+// the handle create and own a stream of hipExtStreamCreateWithCUMask restricted to the set CUs and
+// make it the handle's stream; the streams hipBLAS creates for the handle are restricted alike, so
+// handles given disjoint masks split the device's CUs between them. count 0 removes the mask,
+// destroying the owned stream and returning the handle to the null stream. A masked stream has
+// the default priority, so a mask and a stream priority other than HIPBLAS_STREAM_PRIORITY_DEFAULT
+// exclude each other, the later call failing with HIPBLAS_STATUS_NOT_SUPPORTED; so does a mask on
+// the nvcc backend or in HIPBLAS_CAPTURE_MODE_SAFE. A mask naming no CU of the device, or no CU at
+// all, is HIPBLAS_STATUS_INVALID_VALUE. Get copies up to capacity words of the mask and sets count
+// to its length, 0 when there is none
+HIPBLAS_EXPORT hipblasStatus_t hipblasSetCUMask(hipblasHandle_t handle,
+                                                int             count,
+                                                const uint32_t* mask);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetCUMask(hipblasHandle_t handle,
+                                                int             capacity,
+                                                uint32_t*       mask,
+                                                int*            count);
+
+// In HIPBLAS_RESULT_MODE_ASYNC the dot, nrm2, asum, amax and amin functions called in host
+// pointer mode return once their work is queued instead of waiting for the result. The device
+// writes it to pinned host memory the handle owns, so work queued afterwards overlaps with the
+// reduction, and hipblasSynchronizeResults waits for the reductions queued on the handle and
+// stores each result in the caller's variable, which must stay valid until then. A reduction
+// made with 256 results pending delivers them first. Changing the mode leaves pending results
+// pending; destroying the handle or returning it to a pool drops them. Batched reductions, calls
+// in HIPBLAS_CAPTURE_MODE_SAFE and the _64 functions, except dot, nrm2 and asum at sizes that fit
+// in int, still store their results before returning
+HIPBLAS_EXPORT hipblasStatus_t hipblasSetResultMode(hipblasHandle_t     handle,
+                                                    hipblasResultMode_t mode);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetResultMode(hipblasHandle_t      handle,
+                                                    hipblasResultMode_t* mode);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSynchronizeResults(hipblasHandle_t handle);
+
+// Per-batch scalars for the batched and strided batched gemm, gemv and axpy functions. In device
+// pointer mode with a non-zero stride, batch b reads alpha at alpha + b * stride and beta at
+// beta + b * stride, so a scale that differs per batch entry needs neither separate calls nor a
+// pass over C afterwards. These calls then run hipBLAS's own kernels rather than the backend
+// library's. The default stride of 0 gives every batch the same scalars; host pointer mode, the
+// half-precision gemms and all other functions ignore the stride
+HIPBLAS_EXPORT hipblasStatus_t hipblasSetScalarStride(hipblasHandle_t handle, int64_t stride);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetScalarStride(hipblasHandle_t handle, int64_t* stride);
+
+// Reroutes the typed gemm, gemmBatched and gemmStridedBatched functions whose shape reduces to a
+// level 1 or 2 routine: n == 1 runs as gemv; k == 1 as ger, when beta is 0 or 1 in host pointer
+// mode; and m == n == 1 as dot, when alpha is 1 and beta is 0 in host pointer mode. Conjugated
+// operands that the smaller routine cannot express keep the gemm, as do the half-precision and
+// Ex gemms. HIPBLAS_LAYER trace logging records each rerouted call. On by default
+HIPBLAS_EXPORT hipblasStatus_t hipblasSetShapeDispatchMode(hipblasHandle_t            handle,
+                                                           hipblasShapeDispatchMode_t mode);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetShapeDispatchMode(hipblasHandle_t             handle,
+                                                           hipblasShapeDispatchMode_t* mode);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasSetPointerMode(hipblasHandle_t      handle,
                                                      hipblasPointerMode_t mode);
 
 HIPBLAS_EXPORT hipblasStatus_t hipblasGetPointerMode(hipblasHandle_t       handle,
                                                      hipblasPointerMode_t* mode);
 
+// Lets the backend pick kernels that accumulate with atomics, which are faster but can round
+// differently from run to run
+HIPBLAS_EXPORT hipblasStatus_t hipblasSetAtomicsMode(hipblasHandle_t      handle,
+                                                     hipblasAtomicsMode_t atomics_mode);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetAtomicsMode(hipblasHandle_t       handle,
+                                                     hipblasAtomicsMode_t* atomics_mode);
+
+// Allows reduced-precision matrix-core paths for every gemm on the handle. The hipblasMath_t
+// values are flags and may be or-ed together; a backend without an equivalent path ignores them.
+// The fp32 speedups differ in the error of each product term a * b, accumulation being fp32:
+//   TF32:   |a| |b| 2^-10, on NVIDIA matrix cores only
+//   BF16X3: |a| |b| 2^-14 on either backend, for hipblasSgemm and R_32F hipblasGemmEx. a and b
+//           split into bf16 high and low parts and the low * low product is dropped; the split
+//           operands take 6 (m k + k n) bytes of the handle workspace
+// The HIPBLAS_COMPUTE_32F_FAST_* compute types request the same for a single hipblasGemmEx.
+// INT8_FP64 applies to hipblasDgemm and R_64F hipblasGemmEx on either backend; see
+// hipblasSetEmulationSlices.
+// FLUSH_DENORM applies only to the data-movement Ex routines, hipblasCopyEx, hipblasLacpyEx,
+// hipblasTransposeEx, hipblasGeamEx and the vbatched level-1 Ex routines with their batched
+// forms: they read and write values subnormal in their operand's type, fp16 ones below 2^-14 for
+// instance, as zeros of their sign. Every other routine ignores it, the gemms, the mixed trsm and
+// trmm Ex, quantized gemm, syrk Ex, level-1 Ex arithmetic and the split-k and epilogue kernels
+// among them, and the rocBLAS and cuBLAS routines keep their own handling of subnormals
+HIPBLAS_EXPORT hipblasStatus_t hipblasSetMathMode(hipblasHandle_t handle, hipblasMath_t math_mode);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetMathMode(hipblasHandle_t handle, hipblasMath_t* math_mode);
+
+// Slices per operand of the int8 fp64 gemms, from 1 to 16; 7 by default. Each row of op(A) and
+// column of op(B) is scaled by a power of two to magnitudes below 1 and cut into slices of
+// 7 bits, and the S (S + 1) / 2 slice products of highest weight run as exact int8 gemms whose
+// int32 results are summed in fp64. An element of the result is then within about
+//     k (S + 1) 2^(-7 S) max |op(A)(i, :)| max |op(B)(:, j)|
+// of the fp64 product, so 8 slices match fp64 for rows and columns free of large outliers.
+// Inputs must be finite. The slices take S ((k + 3) & ~3) (m + n) bytes of the handle workspace,
+// and the int32 and fp64 partial results about 12 m n more
+HIPBLAS_EXPORT hipblasStatus_t hipblasSetEmulationSlices(hipblasHandle_t handle, int slices);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetEmulationSlices(hipblasHandle_t handle, int* slices);
+
+// Splits the k range of hipblas{S,D,C,Z}gemm and of hipblasGemmEx calls whose types all match
+// and are one of those four into parts that run as one strided batched gemm, each into an m by n
+// slice of the handle workspace, and sums the slices into C in order. A fixed order keeps results
+// reproducible from run to run; they differ from the unsplit gemm by rounding. 1, the default,
+// leaves gemms whole; s > 1 cuts min(s, k) parts; 0 picks the part count from the shape and the
+// compute units, splitting only gemms whose output tiles leave the device idle, such as
+// m = n = 256 with k in the millions. A gemm whose slices do not fit the workspace runs whole
+HIPBLAS_EXPORT hipblasStatus_t hipblasSetGemmSplitK(hipblasHandle_t handle, int splits);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetGemmSplitK(hipblasHandle_t handle, int* splits);
+
+// Runs hipblas{S,D}gemm and hipblasGemmEx calls whose types are all R_32F or all R_64F through up
+// to levels, 0, the default, 1 or 2, of Strassen-Winograd recursion, each level applied while m,
+// n and k are all at least cutoff, or 8192 for cutoff 0. A level does the product in 7 gemms of
+// half size and 14 geams, so two levels need about 0.766 times the flops of the plain gemm on
+// large matrices; an odd row, column or rank-1 term is peeled off into plain gemms. The price is
+// accuracy: the error is bounded normwise, by a constant times u ||A|| ||B|| that grows by up to
+// a factor of about 18 with each level (Higham, Accuracy and Stability of Numerical Algorithms,
+// section 23.2), rather than elementwise by k u |A| |B| as for the plain gemm, so an element of
+// C much smaller than the typical can lose all its digits. One level takes
+// (m k + k n + 2 m n) / 4 elements of the handle workspace, and a second a quarter of that more;
+// a gemm whose temporaries do not fit, or whose scalars are on the device in
+// HIPBLAS_CAPTURE_MODE_SAFE, runs plain. Device scalars are otherwise read with a synchronize
+HIPBLAS_EXPORT hipblasStatus_t hipblasSetGemmStrassen(hipblasHandle_t handle,
+                                                      int             levels,
+                                                      int             cutoff);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetGemmStrassen(hipblasHandle_t handle,
+                                                      int*            levels,
+                                                      int*            cutoff);
+
+// Checks hipblas{S,D}gemm, hipblas{S,D}gemmStridedBatched, hipblas{S,D}gemmBatched and the
+// hipblasGemmEx calls whose types are all R_32F or all R_64F against checksums, for the silent
+// data corruption of long jobs (Huang and Abraham, algorithm-based fault tolerance). Each column
+// of C is cut into blocks of 256 rows. Before the gemm the block sums of op(A) and of C give the
+// expected block sums of the result through a gemm 256 times smaller, and after it one pass over
+// C compares them; 256 x 256 tiles of C whose sums differ by more than 2 (k + 512) u times
+//     |alpha| sum |op(A)(block, :)| max |op(B)(:, j)| + |beta| sum |C(block, j)|
+// fail, u being the unit roundoff, or 2^-11 with HIPBLAS_TF32_TENSOR_OP_MATH. An error is thus
+// caught when it is large against the rounding a correct result may carry, as one in an exponent
+// or the high bits of a significand is; sums whose bound is not finite are not checked. In
+// HIPBLAS_ABFT_DETECT failures are counted on the device, without synchronizing, and
+// hipblasGetAbftReport reads them. HIPBLAS_ABFT_CORRECT waits for the check, restores each failed
+// tile from a copy of C taken before the gemm, recomputes it alone and checks it again, returning
+// HIPBLAS_STATUS_EXECUTION_FAILED if any tile still fails; in HIPBLAS_CAPTURE_MODE_SAFE it only
+// detects. The checksums take about (2 m k + 3 m n) / 256 + n elements per batch and the copy of
+// C m n more, in a buffer of the handle's own that grows on demand, so gemms hipBLAS runs on
+// workspace operands, such as the parts of split-k and Strassen gemms, are checked as well; a
+// call whose checksums do not fit in HIPBLAS_CAPTURE_MODE_SAFE runs unchecked. Gemms hipBLAS
+// computes by other means than one backend gemm, such as the fast fp32, int8 fp64, tiny and host
+// paths, are not checked
+HIPBLAS_EXPORT hipblasStatus_t hipblasSetAbftMode(hipblasHandle_t handle, hipblasAbftMode_t mode);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetAbftMode(hipblasHandle_t handle, hipblasAbftMode_t* mode);
+
+// Synchronizes the handle's stream to read the failures counted on the device. Not available in
+// HIPBLAS_CAPTURE_MODE_SAFE
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetAbftReport(hipblasHandle_t      handle,
+                                                    hipblasAbftReport_t* report);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasResetAbftReport(hipblasHandle_t handle);
+
+// Runs hipblas{S,D,C,Z}gemmStridedBatched calls whose m, n and k are all at most limit on kernels
+// hipBLAS compiles for each operation pair and precision, with the matrices padded to 2, 4, 8 or
+// 16 a side and held in registers: one matrix per thread up to 4 and one per group of threads
+// above that. The backend's gemm kernels are tiled for large matrices and leave most of each tile
+// idle on such batches. 16, the default, is also the largest limit; 0 sends every call to the
+// backend. HIPBLAS_LAYER trace logging records each call the kernels take
+HIPBLAS_EXPORT hipblasStatus_t hipblasSetGemmTinyLimit(hipblasHandle_t handle, int limit);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetGemmTinyLimit(hipblasHandle_t handle, int* limit);
+
+// Routes hipblasGemmEx and hipblasGemmStridedBatchedEx through cuBLASLt, whose heuristic is
+// queried once per problem shape and cached on the handle. This is a preference: builds without
+// BUILD_WITH_CUBLASLT, the rocBLAS backend and problems cuBLASLt has no algorithm for all run
+// the classic path
+HIPBLAS_EXPORT hipblasStatus_t hipblasSetGemmBackend(hipblasHandle_t      handle,
+                                                     hipblasGemmBackend_t backend);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetGemmBackend(hipblasHandle_t       handle,
+                                                     hipblasGemmBackend_t* backend);
+
+// Loads gemm_ex choices written by hipblas-tune. A hipblasGemmEx call whose algo is
+// HIPBLAS_GEMM_DEFAULT and whose transposes, sizes and types match an entry uses that entry's
+// algo and solution index instead. hipblasCreate loads the file named by the
+// HIPBLAS_GEMM_TUNING_FILE environment variable, ignoring it if it does not parse; a null path
+// drops the table
+HIPBLAS_EXPORT hipblasStatus_t hipblasSetGemmTuningFile(hipblasHandle_t handle, const char* path);
+
+// Online tuning of hipblasGemmEx calls with algo HIPBLAS_GEMM_DEFAULT whose problem the tuning
+// table does not have. With trials > 0 the calls of a problem new to the process, keyed by
+// device, transposes, sizes and types, run in turn the backend heuristic and the candidates
+// hipblas-tune tries, rocBLAS solution indices 1 to 64 or the cuBLAS algos, each timed with a
+// pair of events on the handle's stream. The times are read without waiting by later calls of the
+// problem; once trials calls have been timed and read, the fastest candidate serves the problem
+// for every autotuning handle in the process. A candidate the backend rejects is dropped, and the
+// call runs the heuristic instead. Give at least twice the candidate count to time each one
+// warm. Results of a problem's first calls can differ from each other by rounding. 0, the
+// default, turns autotuning off; it is also off in HIPBLAS_CAPTURE_MODE_SAFE
+HIPBLAS_EXPORT hipblasStatus_t hipblasSetGemmAutotune(hipblasHandle_t handle, int trials);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetGemmAutotune(hipblasHandle_t handle, int* trials);
+
+// Writes the settled autotuning choices of the process to path, in the format of
+// hipblasSetGemmTuningFile. When the HIPBLAS_GEMM_AUTOTUNE_FILE environment variable names a file
+// they are also written there at process exit
+HIPBLAS_EXPORT hipblasStatus_t hipblasSaveGemmAutotune(const char* path);
+
+// Runs each shape once through hipblasGemmEx on scratch memory and waits for it, so the backend
+// loads and resolves the kernels before the first real call. Typed gemms such as hipblasSgemm
+// share the kernels of the matching hipblasGemmEx types. When HIPBLAS_WARMUP is set to a non-zero
+// value hipblasCreate warms every shape of the tuning file it loaded. Not available in
+// HIPBLAS_CAPTURE_MODE_SAFE, since the scratch memory is allocated
+HIPBLAS_EXPORT hipblasStatus_t hipblasWarmup(hipblasHandle_t           handle,
+                                             const hipblasGemmShape_t* shapes,
+                                             int                       count);
+
+// Per-handle call counters for telemetry, off by default. Each call on the handle, counted once
+// even when it calls other hipBLAS functions, adds to its family's call count, estimated bytes and
+// flops, and host time from entry to return. hipblasGetHandleStats and hipblasResetHandleStats
+// may be called from another thread while the handle is in use; a snapshot may then be torn
+// between families but each counter is exact
+HIPBLAS_EXPORT hipblasStatus_t hipblasSetStatsMode(hipblasHandle_t handle, hipblasStatsMode_t mode);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetStatsMode(hipblasHandle_t     handle,
+                                                   hipblasStatsMode_t* mode);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetHandleStats(hipblasHandle_t       handle,
+                                                     hipblasHandleStats_t* stats);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasResetHandleStats(hipblasHandle_t handle);
+
+// Device timing of individual calls, off by default. One in every sample_every calls on the
+// handle, counted as for hipblasGetHandleStats, records events on its stream around its work into
+// a ring of 1024 records; calls that find the ring full are counted as dropped. Calls are not
+// timed in HIPBLAS_CAPTURE_MODE_SAFE, so none recorded by hipblasBeginCapture are
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasSetTimingMode(hipblasHandle_t handle, hipblasTimingMode_t mode, int sample_every);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetTimingMode(hipblasHandle_t      handle,
+                                                    hipblasTimingMode_t* mode,
+                                                    int*                 sample_every);
+
+// Copies out, oldest first, up to capacity records of calls whose device work has completed, and
+// frees their slots; stops at the first call still running. dropped, if not null, receives the
+// calls dropped since the previous drain. May be called from another thread while the handle is
+// in use
+HIPBLAS_EXPORT hipblasStatus_t hipblasDrainTimings(hipblasHandle_t      handle,
+                                                   hipblasCallTiming_t* records,
+                                                   int                  capacity,
+                                                   int*                 count,
+                                                   unsigned long long*  dropped);
+
 HIPBLAS_EXPORT hipblasStatus_t
     hipblasSetVector(int n, int elemSize, const void* x, int incx, void* y, int incy);
 
@@ -204,6 +1168,110 @@ HIPBLAS_EXPORT hipblasStatus_t
 HIPBLAS_EXPORT hipblasStatus_t
     hipblasGetMatrix(int rows, int cols, int elemSize, const void* A, int lda, void* B, int ldb);
 
+// hipblasSet/GetVector and hipblasSet/GetMatrix move pageable host memory through a process-wide
+// pool of pinned memory, in pieces that alternate between its two halves so packing one overlaps
+// the DMA of the other. Each device gets its own pool, placed on the NUMA node of the device's
+// PCI slot. A pool holds 8 MiB unless HIPBLAS_STAGING_POOL_SIZE gives its size in bytes; 0
+// disables it. Resizing waits for the transfer in flight and frees the old pools
+HIPBLAS_EXPORT hipblasStatus_t hipblasSetStagingPoolSize(size_t bytes);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetStagingPoolSize(size_t* bytes);
+
+// Pinned host memory, usable by every device, for callers who can keep their data in it and skip
+// the staging pool altogether
+HIPBLAS_EXPORT hipblasStatus_t hipblasHostAlloc(void** ptr, size_t bytes);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasHostFree(void* ptr);
+
+// Leading dimension, at least rows, for a column-major matrix of elemSize-byte elements on the
+// handle's device: columns start on a 128-byte boundary and are never a whole multiple of the
+// device's memory-channel interleave apart, which for large power-of-two lda sends every column
+// to the same channel. Columns narrower than 128 bytes keep ld = rows
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetOptimalLeadingDimension(hipblasHandle_t handle,
+                                                                 int             rows,
+                                                                 int             elemSize,
+                                                                 int*            ld);
+
+// Device memory on the handle's device for a rows x cols matrix at the leading dimension above,
+// which is returned in ld; nullptr for an empty matrix. Free it with hipFree
+HIPBLAS_EXPORT hipblasStatus_t hipblasMallocMatrix(
+    hipblasHandle_t handle, int rows, int cols, int elemSize, void** ptr, int* ld);
+
+// stream-ordered variants of the above; host memory should be pinned for the copy to overlap
+HIPBLAS_EXPORT hipblasStatus_t hipblasSetVectorAsync(
+    int n, int elemSize, const void* x, int incx, void* y, int incy, hipStream_t stream);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetVectorAsync(
+    int n, int elemSize, const void* x, int incx, void* y, int incy, hipStream_t stream);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSetMatrixAsync(int         rows,
+                                                     int         cols,
+                                                     int         elemSize,
+                                                     const void* A,
+                                                     int         lda,
+                                                     void*       B,
+                                                     int         ldb,
+                                                     hipStream_t stream);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetMatrixAsync(int         rows,
+                                                     int         cols,
+                                                     int         elemSize,
+                                                     const void* A,
+                                                     int         lda,
+                                                     void*       B,
+                                                     int         ldb,
+                                                     hipStream_t stream);
+
+// Copies batch_count matrices between host and device on the handle's stream. Matrices are packed
+// into pinned staging in chunks, moved in one transfer per chunk and scattered or gathered by one
+// kernel, so a batch of small matrices costs a few transfers rather than one each. Set returns once
+// the host matrices are staged; Get returns once B holds the result. Pointer arrays are host
+// arrays, of host pointers for the host side and device pointers for the device side
+HIPBLAS_EXPORT hipblasStatus_t hipblasSetMatrixBatched(hipblasHandle_t   handle,
+                                                       int               rows,
+                                                       int               cols,
+                                                       int               elemSize,
+                                                       const void* const A[],
+                                                       int               lda,
+                                                       void* const       B[],
+                                                       int               ldb,
+                                                       int               batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetMatrixBatched(hipblasHandle_t   handle,
+                                                       int               rows,
+                                                       int               cols,
+                                                       int               elemSize,
+                                                       const void* const A[],
+                                                       int               lda,
+                                                       void* const       B[],
+                                                       int               ldb,
+                                                       int               batch_count);
+
+// strideA and strideB count elements between consecutive matrices
+HIPBLAS_EXPORT hipblasStatus_t hipblasSetMatrixStridedBatched(hipblasHandle_t handle,
+                                                              int             rows,
+                                                              int             cols,
+                                                              int             elemSize,
+                                                              const void*     A,
+                                                              int             lda,
+                                                              long long       strideA,
+                                                              void*           B,
+                                                              int             ldb,
+                                                              long long       strideB,
+                                                              int             batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasGetMatrixStridedBatched(hipblasHandle_t handle,
+                                                              int             rows,
+                                                              int             cols,
+                                                              int             elemSize,
+                                                              const void*     A,
+                                                              int             lda,
+                                                              long long       strideA,
+                                                              void*           B,
+                                                              int             ldb,
+                                                              long long       strideB,
+                                                              int             batch_count);
+
 HIPBLAS_EXPORT hipblasStatus_t hipblasSgeam(hipblasHandle_t    handle,
                                             hipblasOperation_t transa,
                                             hipblasOperation_t transb,
@@ -232,30 +1300,210 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDgeam(hipblasHandle_t    handle,
                                             double*            C,
                                             int                ldc);
 
-// amax
-HIPBLAS_EXPORT hipblasStatus_t
-    hipblasIsamax(hipblasHandle_t handle, int n, const float* x, int incx, int* result);
-
-HIPBLAS_EXPORT hipblasStatus_t
-    hipblasIdamax(hipblasHandle_t handle, int n, const double* x, int incx, int* result);
-
-HIPBLAS_EXPORT hipblasStatus_t
-    hipblasIcamax(hipblasHandle_t handle, int n, const hipblasComplex* x, int incx, int* result);
-
-HIPBLAS_EXPORT hipblasStatus_t hipblasIzamax(
-    hipblasHandle_t handle, int n, const hipblasDoubleComplex* x, int incx, int* result);
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgeam(hipblasHandle_t       handle,
+                                            hipblasOperation_t    transa,
+                                            hipblasOperation_t    transb,
+                                            int                   m,
+                                            int                   n,
+                                            const hipblasComplex* alpha,
+                                            const hipblasComplex* A,
+                                            int                   lda,
+                                            const hipblasComplex* beta,
+                                            const hipblasComplex* B,
+                                            int                   ldb,
+                                            hipblasComplex*       C,
+                                            int                   ldc);
 
-// amax_batched
-HIPBLAS_EXPORT hipblasStatus_t hipblasIsamaxBatched(
-    hipblasHandle_t handle, int n, const float* const x[], int incx, int batch_count, int* result);
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgeam(hipblasHandle_t             handle,
+                                            hipblasOperation_t          transa,
+                                            hipblasOperation_t          transb,
+                                            int                         m,
+                                            int                         n,
+                                            const hipblasDoubleComplex* alpha,
+                                            const hipblasDoubleComplex* A,
+                                            int                         lda,
+                                            const hipblasDoubleComplex* beta,
+                                            const hipblasDoubleComplex* B,
+                                            int                         ldb,
+                                            hipblasDoubleComplex*       C,
+                                            int                         ldc);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasIdamaxBatched(
-    hipblasHandle_t handle, int n, const double* const x[], int incx, int batch_count, int* result);
+// geam_batched
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgeamBatched(hipblasHandle_t    handle,
+                                                   hipblasOperation_t transa,
+                                                   hipblasOperation_t transb,
+                                                   int                m,
+                                                   int                n,
+                                                   const float*       alpha,
+                                                   const float* const A[],
+                                                   int                lda,
+                                                   const float*       beta,
+                                                   const float* const B[],
+                                                   int                ldb,
+                                                   float* const       C[],
+                                                   int                ldc,
+                                                   int                batchCount);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasIcamaxBatched(hipblasHandle_t             handle,
-                                                    int                         n,
-                                                    const hipblasComplex* const x[],
-                                                    int                         incx,
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgeamBatched(hipblasHandle_t     handle,
+                                                   hipblasOperation_t  transa,
+                                                   hipblasOperation_t  transb,
+                                                   int                 m,
+                                                   int                 n,
+                                                   const double*       alpha,
+                                                   const double* const A[],
+                                                   int                 lda,
+                                                   const double*       beta,
+                                                   const double* const B[],
+                                                   int                 ldb,
+                                                   double* const       C[],
+                                                   int                 ldc,
+                                                   int                 batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgeamBatched(hipblasHandle_t             handle,
+                                                   hipblasOperation_t          transa,
+                                                   hipblasOperation_t          transb,
+                                                   int                         m,
+                                                   int                         n,
+                                                   const hipblasComplex*       alpha,
+                                                   const hipblasComplex* const A[],
+                                                   int                         lda,
+                                                   const hipblasComplex*       beta,
+                                                   const hipblasComplex* const B[],
+                                                   int                         ldb,
+                                                   hipblasComplex* const       C[],
+                                                   int                         ldc,
+                                                   int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgeamBatched(hipblasHandle_t                   handle,
+                                                   hipblasOperation_t                transa,
+                                                   hipblasOperation_t                transb,
+                                                   int                               m,
+                                                   int                               n,
+                                                   const hipblasDoubleComplex*       alpha,
+                                                   const hipblasDoubleComplex* const A[],
+                                                   int                               lda,
+                                                   const hipblasDoubleComplex*       beta,
+                                                   const hipblasDoubleComplex* const B[],
+                                                   int                               ldb,
+                                                   hipblasDoubleComplex* const       C[],
+                                                   int                               ldc,
+                                                   int                               batchCount);
+
+// geam_strided_batched
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgeamStridedBatched(hipblasHandle_t    handle,
+                                                          hipblasOperation_t transa,
+                                                          hipblasOperation_t transb,
+                                                          int                m,
+                                                          int                n,
+                                                          const float*       alpha,
+                                                          const float*       A,
+                                                          int                lda,
+                                                          int                strideA,
+                                                          const float*       beta,
+                                                          const float*       B,
+                                                          int                ldb,
+                                                          int                strideB,
+                                                          float*             C,
+                                                          int                ldc,
+                                                          int                strideC,
+                                                          int                batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgeamStridedBatched(hipblasHandle_t    handle,
+                                                          hipblasOperation_t transa,
+                                                          hipblasOperation_t transb,
+                                                          int                m,
+                                                          int                n,
+                                                          const double*      alpha,
+                                                          const double*      A,
+                                                          int                lda,
+                                                          int                strideA,
+                                                          const double*      beta,
+                                                          const double*      B,
+                                                          int                ldb,
+                                                          int                strideB,
+                                                          double*            C,
+                                                          int                ldc,
+                                                          int                strideC,
+                                                          int                batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgeamStridedBatched(hipblasHandle_t       handle,
+                                                          hipblasOperation_t    transa,
+                                                          hipblasOperation_t    transb,
+                                                          int                   m,
+                                                          int                   n,
+                                                          const hipblasComplex* alpha,
+                                                          const hipblasComplex* A,
+                                                          int                   lda,
+                                                          int                   strideA,
+                                                          const hipblasComplex* beta,
+                                                          const hipblasComplex* B,
+                                                          int                   ldb,
+                                                          int                   strideB,
+                                                          hipblasComplex*       C,
+                                                          int                   ldc,
+                                                          int                   strideC,
+                                                          int                   batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgeamStridedBatched(hipblasHandle_t             handle,
+                                                          hipblasOperation_t          transa,
+                                                          hipblasOperation_t          transb,
+                                                          int                         m,
+                                                          int                         n,
+                                                          const hipblasDoubleComplex* alpha,
+                                                          const hipblasDoubleComplex* A,
+                                                          int                         lda,
+                                                          int                         strideA,
+                                                          const hipblasDoubleComplex* beta,
+                                                          const hipblasDoubleComplex* B,
+                                                          int                         ldb,
+                                                          int                         strideB,
+                                                          hipblasDoubleComplex*       C,
+                                                          int                         ldc,
+                                                          int                         strideC,
+                                                          int                         batchCount);
+
+// amax
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasIsamax(hipblasHandle_t handle, int n, const float* x, int incx, int* result);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasIdamax(hipblasHandle_t handle, int n, const double* x, int incx, int* result);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasIcamax(hipblasHandle_t handle, int n, const hipblasComplex* x, int incx, int* result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasIzamax(
+    hipblasHandle_t handle, int n, const hipblasDoubleComplex* x, int incx, int* result);
+
+// amax_64: the _64 forms take 64-bit sizes and increments. Calls whose sizes fit in int go
+// straight to the 32-bit routine; larger ones run as a sequence of 32-bit calls on the same
+// handle, with the partial results of reductions combined on the host
+HIPBLAS_EXPORT hipblasStatus_t hipblasIsamax_64(
+    hipblasHandle_t handle, int64_t n, const float* x, int64_t incx, int64_t* result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasIdamax_64(
+    hipblasHandle_t handle, int64_t n, const double* x, int64_t incx, int64_t* result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasIcamax_64(
+    hipblasHandle_t handle, int64_t n, const hipblasComplex* x, int64_t incx, int64_t* result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasIzamax_64(hipblasHandle_t             handle,
+                                                int64_t                     n,
+                                                const hipblasDoubleComplex* x,
+                                                int64_t                     incx,
+                                                int64_t*                    result);
+
+// amax_batched
+HIPBLAS_EXPORT hipblasStatus_t hipblasIsamaxBatched(
+    hipblasHandle_t handle, int n, const float* const x[], int incx, int batch_count, int* result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasIdamaxBatched(
+    hipblasHandle_t handle, int n, const double* const x[], int incx, int batch_count, int* result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasIcamaxBatched(hipblasHandle_t             handle,
+                                                    int                         n,
+                                                    const hipblasComplex* const x[],
+                                                    int                         incx,
                                                     int                         batch_count,
                                                     int*                        result);
 
@@ -312,6 +1560,22 @@ HIPBLAS_EXPORT hipblasStatus_t
 HIPBLAS_EXPORT hipblasStatus_t hipblasIzamin(
     hipblasHandle_t handle, int n, const hipblasDoubleComplex* x, int incx, int* result);
 
+// amin_64
+HIPBLAS_EXPORT hipblasStatus_t hipblasIsamin_64(
+    hipblasHandle_t handle, int64_t n, const float* x, int64_t incx, int64_t* result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasIdamin_64(
+    hipblasHandle_t handle, int64_t n, const double* x, int64_t incx, int64_t* result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasIcamin_64(
+    hipblasHandle_t handle, int64_t n, const hipblasComplex* x, int64_t incx, int64_t* result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasIzamin_64(hipblasHandle_t             handle,
+                                                int64_t                     n,
+                                                const hipblasDoubleComplex* x,
+                                                int64_t                     incx,
+                                                int64_t*                    result);
+
 // amin_batched
 HIPBLAS_EXPORT hipblasStatus_t hipblasIsaminBatched(
     hipblasHandle_t handle, int n, const float* const x[], int incx, int batch_count, int* result);
@@ -379,6 +1643,19 @@ HIPBLAS_EXPORT hipblasStatus_t
 HIPBLAS_EXPORT hipblasStatus_t hipblasDzasum(
     hipblasHandle_t handle, int n, const hipblasDoubleComplex* x, int incx, double* result);
 
+// asum_64
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasSasum_64(hipblasHandle_t handle, int64_t n, const float* x, int64_t incx, float* result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDasum_64(
+    hipblasHandle_t handle, int64_t n, const double* x, int64_t incx, double* result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasScasum_64(
+    hipblasHandle_t handle, int64_t n, const hipblasComplex* x, int64_t incx, float* result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDzasum_64(
+    hipblasHandle_t handle, int64_t n, const hipblasDoubleComplex* x, int64_t incx, double* result);
+
 // asum_batched
 HIPBLAS_EXPORT hipblasStatus_t hipblasSasumBatched(
     hipblasHandle_t handle, int n, const float* const x[], int incx, int batchCount, float* result);
@@ -478,6 +1755,39 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZaxpy(hipblasHandle_t             handle,
                                             hipblasDoubleComplex*       y,
                                             int                         incy);
 
+// axpy_64
+HIPBLAS_EXPORT hipblasStatus_t hipblasSaxpy_64(hipblasHandle_t handle,
+                                               int64_t         n,
+                                               const float*    alpha,
+                                               const float*    x,
+                                               int64_t         incx,
+                                               float*          y,
+                                               int64_t         incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDaxpy_64(hipblasHandle_t handle,
+                                               int64_t         n,
+                                               const double*   alpha,
+                                               const double*   x,
+                                               int64_t         incx,
+                                               double*         y,
+                                               int64_t         incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCaxpy_64(hipblasHandle_t       handle,
+                                               int64_t               n,
+                                               const hipblasComplex* alpha,
+                                               const hipblasComplex* x,
+                                               int64_t               incx,
+                                               hipblasComplex*       y,
+                                               int64_t               incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZaxpy_64(hipblasHandle_t             handle,
+                                               int64_t                     n,
+                                               const hipblasDoubleComplex* alpha,
+                                               const hipblasDoubleComplex* x,
+                                               int64_t                     incx,
+                                               hipblasDoubleComplex*       y,
+                                               int64_t                     incy);
+
 // axpy_batched
 HIPBLAS_EXPORT hipblasStatus_t hipblasHaxpyBatched(hipblasHandle_t          handle,
                                                    int                      n,
@@ -597,6 +1907,27 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZcopy(hipblasHandle_t             handle,
                                             hipblasDoubleComplex*       y,
                                             int                         incy);
 
+// copy_64
+HIPBLAS_EXPORT hipblasStatus_t hipblasScopy_64(
+    hipblasHandle_t handle, int64_t n, const float* x, int64_t incx, float* y, int64_t incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDcopy_64(
+    hipblasHandle_t handle, int64_t n, const double* x, int64_t incx, double* y, int64_t incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCcopy_64(hipblasHandle_t       handle,
+                                               int64_t               n,
+                                               const hipblasComplex* x,
+                                               int64_t               incx,
+                                               hipblasComplex*       y,
+                                               int64_t               incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZcopy_64(hipblasHandle_t             handle,
+                                               int64_t                     n,
+                                               const hipblasDoubleComplex* x,
+                                               int64_t                     incx,
+                                               hipblasDoubleComplex*       y,
+                                               int64_t                     incy);
+
 // copy_batched
 HIPBLAS_EXPORT hipblasStatus_t hipblasScopyBatched(hipblasHandle_t    handle,
                                                    int                n,
@@ -736,6 +2067,55 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZdotu(hipblasHandle_t             handle,
                                             int                         incy,
                                             hipblasDoubleComplex*       result);
 
+// dot_64
+HIPBLAS_EXPORT hipblasStatus_t hipblasSdot_64(hipblasHandle_t handle,
+                                              int64_t         n,
+                                              const float*    x,
+                                              int64_t         incx,
+                                              const float*    y,
+                                              int64_t         incy,
+                                              float*          result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDdot_64(hipblasHandle_t handle,
+                                              int64_t         n,
+                                              const double*   x,
+                                              int64_t         incx,
+                                              const double*   y,
+                                              int64_t         incy,
+                                              double*         result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCdotc_64(hipblasHandle_t       handle,
+                                               int64_t               n,
+                                               const hipblasComplex* x,
+                                               int64_t               incx,
+                                               const hipblasComplex* y,
+                                               int64_t               incy,
+                                               hipblasComplex*       result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCdotu_64(hipblasHandle_t       handle,
+                                               int64_t               n,
+                                               const hipblasComplex* x,
+                                               int64_t               incx,
+                                               const hipblasComplex* y,
+                                               int64_t               incy,
+                                               hipblasComplex*       result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZdotc_64(hipblasHandle_t             handle,
+                                               int64_t                     n,
+                                               const hipblasDoubleComplex* x,
+                                               int64_t                     incx,
+                                               const hipblasDoubleComplex* y,
+                                               int64_t                     incy,
+                                               hipblasDoubleComplex*       result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZdotu_64(hipblasHandle_t             handle,
+                                               int64_t                     n,
+                                               const hipblasDoubleComplex* x,
+                                               int64_t                     incx,
+                                               const hipblasDoubleComplex* y,
+                                               int64_t                     incy,
+                                               hipblasDoubleComplex*       result);
+
 // dot_batched
 HIPBLAS_EXPORT hipblasStatus_t hipblasHdotBatched(hipblasHandle_t          handle,
                                                   int                      n,
@@ -911,6 +2291,19 @@ HIPBLAS_EXPORT hipblasStatus_t
 HIPBLAS_EXPORT hipblasStatus_t hipblasDznrm2(
     hipblasHandle_t handle, int n, const hipblasDoubleComplex* x, int incx, double* result);
 
+// nrm2_64
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasSnrm2_64(hipblasHandle_t handle, int64_t n, const float* x, int64_t incx, float* result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDnrm2_64(
+    hipblasHandle_t handle, int64_t n, const double* x, int64_t incx, double* result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasScnrm2_64(
+    hipblasHandle_t handle, int64_t n, const hipblasComplex* x, int64_t incx, float* result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDznrm2_64(
+    hipblasHandle_t handle, int64_t n, const hipblasDoubleComplex* x, int64_t incx, double* result);
+
 // nrm2_batched
 HIPBLAS_EXPORT hipblasStatus_t hipblasSnrm2Batched(
     hipblasHandle_t handle, int n, const float* const x[], int incx, int batchCount, float* result);
@@ -1372,6 +2765,31 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZscal(hipblasHandle_t             handle,
 HIPBLAS_EXPORT hipblasStatus_t hipblasZdscal(
     hipblasHandle_t handle, int n, const double* alpha, hipblasDoubleComplex* x, int incx);
 
+// scal_64
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasSscal_64(hipblasHandle_t handle, int64_t n, const float* alpha, float* x, int64_t incx);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDscal_64(
+    hipblasHandle_t handle, int64_t n, const double* alpha, double* x, int64_t incx);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCscal_64(hipblasHandle_t       handle,
+                                               int64_t               n,
+                                               const hipblasComplex* alpha,
+                                               hipblasComplex*       x,
+                                               int64_t               incx);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsscal_64(
+    hipblasHandle_t handle, int64_t n, const float* alpha, hipblasComplex* x, int64_t incx);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZscal_64(hipblasHandle_t             handle,
+                                               int64_t                     n,
+                                               const hipblasDoubleComplex* alpha,
+                                               hipblasDoubleComplex*       x,
+                                               int64_t                     incx);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZdscal_64(
+    hipblasHandle_t handle, int64_t n, const double* alpha, hipblasDoubleComplex* x, int64_t incx);
+
 // scal_batched
 HIPBLAS_EXPORT hipblasStatus_t hipblasSscalBatched(
     hipblasHandle_t handle, int n, const float* alpha, float* const x[], int incx, int batchCount);
@@ -1477,6 +2895,27 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZswap(hipblasHandle_t       handle,
                                             hipblasDoubleComplex* y,
                                             int                   incy);
 
+// swap_64
+HIPBLAS_EXPORT hipblasStatus_t hipblasSswap_64(
+    hipblasHandle_t handle, int64_t n, float* x, int64_t incx, float* y, int64_t incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDswap_64(
+    hipblasHandle_t handle, int64_t n, double* x, int64_t incx, double* y, int64_t incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCswap_64(hipblasHandle_t handle,
+                                               int64_t         n,
+                                               hipblasComplex* x,
+                                               int64_t         incx,
+                                               hipblasComplex* y,
+                                               int64_t         incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZswap_64(hipblasHandle_t       handle,
+                                               int64_t               n,
+                                               hipblasDoubleComplex* x,
+                                               int64_t               incx,
+                                               hipblasDoubleComplex* y,
+                                               int64_t               incy);
+
 // swap_batched
 HIPBLAS_EXPORT hipblasStatus_t hipblasSswapBatched(
     hipblasHandle_t handle, int n, float* x[], int incx, float* y[], int incy, int batchCount);
@@ -2158,6 +3597,82 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZgercStridedBatched(hipblasHandle_t
                                                           int                         strideA,
                                                           int                         batchCount);
 
+// ger_accumulate: A += alpha * (x[0] y[0]^T + ... + x[k - 1] y[k - 1]^T), the k rank-1 updates
+// of as many ger calls, with y^H in place of y^T for gerc. x and y are device arrays of k device
+// pointers, as in ger_batched. The vectors are gathered into workspace and A is updated by one
+// gemm, which reads and writes A once rather than k times
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgerAccumulate(hipblasHandle_t    handle,
+                                                     int                m,
+                                                     int                n,
+                                                     int                k,
+                                                     const float*       alpha,
+                                                     const float* const x[],
+                                                     int                incx,
+                                                     const float* const y[],
+                                                     int                incy,
+                                                     float*             A,
+                                                     int                lda);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgerAccumulate(hipblasHandle_t     handle,
+                                                     int                 m,
+                                                     int                 n,
+                                                     int                 k,
+                                                     const double*       alpha,
+                                                     const double* const x[],
+                                                     int                 incx,
+                                                     const double* const y[],
+                                                     int                 incy,
+                                                     double*             A,
+                                                     int                 lda);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgeruAccumulate(hipblasHandle_t             handle,
+                                                      int                         m,
+                                                      int                         n,
+                                                      int                         k,
+                                                      const hipblasComplex*       alpha,
+                                                      const hipblasComplex* const x[],
+                                                      int                         incx,
+                                                      const hipblasComplex* const y[],
+                                                      int                         incy,
+                                                      hipblasComplex*             A,
+                                                      int                         lda);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgercAccumulate(hipblasHandle_t             handle,
+                                                      int                         m,
+                                                      int                         n,
+                                                      int                         k,
+                                                      const hipblasComplex*       alpha,
+                                                      const hipblasComplex* const x[],
+                                                      int                         incx,
+                                                      const hipblasComplex* const y[],
+                                                      int                         incy,
+                                                      hipblasComplex*             A,
+                                                      int                         lda);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgeruAccumulate(hipblasHandle_t                   handle,
+                                                      int                               m,
+                                                      int                               n,
+                                                      int                               k,
+                                                      const hipblasDoubleComplex*       alpha,
+                                                      const hipblasDoubleComplex* const x[],
+                                                      int                               incx,
+                                                      const hipblasDoubleComplex* const y[],
+                                                      int                               incy,
+                                                      hipblasDoubleComplex*             A,
+                                                      int                               lda);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgercAccumulate(hipblasHandle_t                   handle,
+                                                      int                               m,
+                                                      int                               n,
+                                                      int                               k,
+                                                      const hipblasDoubleComplex*       alpha,
+                                                      const hipblasDoubleComplex* const x[],
+                                                      int                               incx,
+                                                      const hipblasDoubleComplex* const y[],
+                                                      int                               incy,
+                                                      hipblasDoubleComplex*             A,
+                                                      int                               lda);
+
 // hbmv
 HIPBLAS_EXPORT hipblasStatus_t hipblasChbmv(hipblasHandle_t       handle,
                                             hipblasFillMode_t     uplo,
@@ -3648,106 +5163,257 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZtbmvStridedBatched(hipblasHandle_t
                                                           int                         stride_x,
                                                           int                         batch_count);
 
-// tpmv
-HIPBLAS_EXPORT hipblasStatus_t hipblasStpmv(hipblasHandle_t    handle,
+// tbsv
+HIPBLAS_EXPORT hipblasStatus_t hipblasStbsv(hipblasHandle_t    handle,
                                             hipblasFillMode_t  uplo,
                                             hipblasOperation_t transA,
                                             hipblasDiagType_t  diag,
-                                            int                m,
-                                            const float*       AP,
+                                            int                n,
+                                            int                k,
+                                            const float*       A,
+                                            int                lda,
                                             float*             x,
                                             int                incx);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasDtpmv(hipblasHandle_t    handle,
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtbsv(hipblasHandle_t    handle,
                                             hipblasFillMode_t  uplo,
                                             hipblasOperation_t transA,
                                             hipblasDiagType_t  diag,
-                                            int                m,
-                                            const double*      AP,
+                                            int                n,
+                                            int                k,
+                                            const double*      A,
+                                            int                lda,
                                             double*            x,
                                             int                incx);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasCtpmv(hipblasHandle_t       handle,
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtbsv(hipblasHandle_t       handle,
                                             hipblasFillMode_t     uplo,
                                             hipblasOperation_t    transA,
                                             hipblasDiagType_t     diag,
-                                            int                   m,
-                                            const hipblasComplex* AP,
+                                            int                   n,
+                                            int                   k,
+                                            const hipblasComplex* A,
+                                            int                   lda,
                                             hipblasComplex*       x,
                                             int                   incx);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasZtpmv(hipblasHandle_t             handle,
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtbsv(hipblasHandle_t             handle,
                                             hipblasFillMode_t           uplo,
                                             hipblasOperation_t          transA,
                                             hipblasDiagType_t           diag,
-                                            int                         m,
-                                            const hipblasDoubleComplex* AP,
+                                            int                         n,
+                                            int                         k,
+                                            const hipblasDoubleComplex* A,
+                                            int                         lda,
                                             hipblasDoubleComplex*       x,
                                             int                         incx);
 
-// tpmv_batched
-HIPBLAS_EXPORT hipblasStatus_t hipblasStpmvBatched(hipblasHandle_t    handle,
+// tbsv_batched
+HIPBLAS_EXPORT hipblasStatus_t hipblasStbsvBatched(hipblasHandle_t    handle,
                                                    hipblasFillMode_t  uplo,
                                                    hipblasOperation_t transA,
                                                    hipblasDiagType_t  diag,
-                                                   int                m,
-                                                   const float* const AP[],
+                                                   int                n,
+                                                   int                k,
+                                                   const float* const A[],
+                                                   int                lda,
                                                    float* const       x[],
                                                    int                incx,
-                                                   int                batchCount);
+                                                   int                batch_count);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasDtpmvBatched(hipblasHandle_t     handle,
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtbsvBatched(hipblasHandle_t     handle,
                                                    hipblasFillMode_t   uplo,
                                                    hipblasOperation_t  transA,
                                                    hipblasDiagType_t   diag,
-                                                   int                 m,
-                                                   const double* const AP[],
+                                                   int                 n,
+                                                   int                 k,
+                                                   const double* const A[],
+                                                   int                 lda,
                                                    double* const       x[],
                                                    int                 incx,
-                                                   int                 batchCount);
+                                                   int                 batch_count);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasCtpmvBatched(hipblasHandle_t             handle,
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtbsvBatched(hipblasHandle_t             handle,
                                                    hipblasFillMode_t           uplo,
                                                    hipblasOperation_t          transA,
                                                    hipblasDiagType_t           diag,
-                                                   int                         m,
-                                                   const hipblasComplex* const AP[],
+                                                   int                         n,
+                                                   int                         k,
+                                                   const hipblasComplex* const A[],
+                                                   int                         lda,
                                                    hipblasComplex* const       x[],
                                                    int                         incx,
-                                                   int                         batchCount);
+                                                   int                         batch_count);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasZtpmvBatched(hipblasHandle_t                   handle,
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtbsvBatched(hipblasHandle_t                   handle,
                                                    hipblasFillMode_t                 uplo,
                                                    hipblasOperation_t                transA,
                                                    hipblasDiagType_t                 diag,
-                                                   int                               m,
-                                                   const hipblasDoubleComplex* const AP[],
+                                                   int                               n,
+                                                   int                               k,
+                                                   const hipblasDoubleComplex* const A[],
+                                                   int                               lda,
                                                    hipblasDoubleComplex* const       x[],
                                                    int                               incx,
-                                                   int                               batchCount);
+                                                   int                               batch_count);
 
-// tpmv_strided_batched
-HIPBLAS_EXPORT hipblasStatus_t hipblasStpmvStridedBatched(hipblasHandle_t    handle,
+// tbsv_strided_batched
+HIPBLAS_EXPORT hipblasStatus_t hipblasStbsvStridedBatched(hipblasHandle_t    handle,
                                                           hipblasFillMode_t  uplo,
                                                           hipblasOperation_t transA,
                                                           hipblasDiagType_t  diag,
-                                                          int                m,
-                                                          const float*       AP,
-                                                          int                strideAP,
+                                                          int                n,
+                                                          int                k,
+                                                          const float*       A,
+                                                          int                lda,
+                                                          int                stride_a,
                                                           float*             x,
                                                           int                incx,
-                                                          int                stride,
-                                                          int                batchCount);
+                                                          int                stride_x,
+                                                          int                batch_count);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasDtpmvStridedBatched(hipblasHandle_t    handle,
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtbsvStridedBatched(hipblasHandle_t    handle,
                                                           hipblasFillMode_t  uplo,
                                                           hipblasOperation_t transA,
                                                           hipblasDiagType_t  diag,
-                                                          int                m,
-                                                          const double*      AP,
-                                                          int                strideAP,
-                                                          double*            x,
-                                                          int                incx,
+                                                          int                n,
+                                                          int                k,
+                                                          const double*      A,
+                                                          int                lda,
+                                                          int                stride_a,
+                                                          double*            x,
+                                                          int                incx,
+                                                          int                stride_x,
+                                                          int                batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtbsvStridedBatched(hipblasHandle_t       handle,
+                                                          hipblasFillMode_t     uplo,
+                                                          hipblasOperation_t    transA,
+                                                          hipblasDiagType_t     diag,
+                                                          int                   n,
+                                                          int                   k,
+                                                          const hipblasComplex* A,
+                                                          int                   lda,
+                                                          int                   stride_a,
+                                                          hipblasComplex*       x,
+                                                          int                   incx,
+                                                          int                   stride_x,
+                                                          int                   batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtbsvStridedBatched(hipblasHandle_t             handle,
+                                                          hipblasFillMode_t           uplo,
+                                                          hipblasOperation_t          transA,
+                                                          hipblasDiagType_t           diag,
+                                                          int                         n,
+                                                          int                         k,
+                                                          const hipblasDoubleComplex* A,
+                                                          int                         lda,
+                                                          int                         stride_a,
+                                                          hipblasDoubleComplex*       x,
+                                                          int                         incx,
+                                                          int                         stride_x,
+                                                          int                         batch_count);
+
+// tpmv
+HIPBLAS_EXPORT hipblasStatus_t hipblasStpmv(hipblasHandle_t    handle,
+                                            hipblasFillMode_t  uplo,
+                                            hipblasOperation_t transA,
+                                            hipblasDiagType_t  diag,
+                                            int                m,
+                                            const float*       AP,
+                                            float*             x,
+                                            int                incx);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtpmv(hipblasHandle_t    handle,
+                                            hipblasFillMode_t  uplo,
+                                            hipblasOperation_t transA,
+                                            hipblasDiagType_t  diag,
+                                            int                m,
+                                            const double*      AP,
+                                            double*            x,
+                                            int                incx);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtpmv(hipblasHandle_t       handle,
+                                            hipblasFillMode_t     uplo,
+                                            hipblasOperation_t    transA,
+                                            hipblasDiagType_t     diag,
+                                            int                   m,
+                                            const hipblasComplex* AP,
+                                            hipblasComplex*       x,
+                                            int                   incx);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtpmv(hipblasHandle_t             handle,
+                                            hipblasFillMode_t           uplo,
+                                            hipblasOperation_t          transA,
+                                            hipblasDiagType_t           diag,
+                                            int                         m,
+                                            const hipblasDoubleComplex* AP,
+                                            hipblasDoubleComplex*       x,
+                                            int                         incx);
+
+// tpmv_batched
+HIPBLAS_EXPORT hipblasStatus_t hipblasStpmvBatched(hipblasHandle_t    handle,
+                                                   hipblasFillMode_t  uplo,
+                                                   hipblasOperation_t transA,
+                                                   hipblasDiagType_t  diag,
+                                                   int                m,
+                                                   const float* const AP[],
+                                                   float* const       x[],
+                                                   int                incx,
+                                                   int                batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtpmvBatched(hipblasHandle_t     handle,
+                                                   hipblasFillMode_t   uplo,
+                                                   hipblasOperation_t  transA,
+                                                   hipblasDiagType_t   diag,
+                                                   int                 m,
+                                                   const double* const AP[],
+                                                   double* const       x[],
+                                                   int                 incx,
+                                                   int                 batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtpmvBatched(hipblasHandle_t             handle,
+                                                   hipblasFillMode_t           uplo,
+                                                   hipblasOperation_t          transA,
+                                                   hipblasDiagType_t           diag,
+                                                   int                         m,
+                                                   const hipblasComplex* const AP[],
+                                                   hipblasComplex* const       x[],
+                                                   int                         incx,
+                                                   int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtpmvBatched(hipblasHandle_t                   handle,
+                                                   hipblasFillMode_t                 uplo,
+                                                   hipblasOperation_t                transA,
+                                                   hipblasDiagType_t                 diag,
+                                                   int                               m,
+                                                   const hipblasDoubleComplex* const AP[],
+                                                   hipblasDoubleComplex* const       x[],
+                                                   int                               incx,
+                                                   int                               batchCount);
+
+// tpmv_strided_batched
+HIPBLAS_EXPORT hipblasStatus_t hipblasStpmvStridedBatched(hipblasHandle_t    handle,
+                                                          hipblasFillMode_t  uplo,
+                                                          hipblasOperation_t transA,
+                                                          hipblasDiagType_t  diag,
+                                                          int                m,
+                                                          const float*       AP,
+                                                          int                strideAP,
+                                                          float*             x,
+                                                          int                incx,
+                                                          int                stride,
+                                                          int                batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtpmvStridedBatched(hipblasHandle_t    handle,
+                                                          hipblasFillMode_t  uplo,
+                                                          hipblasOperation_t transA,
+                                                          hipblasDiagType_t  diag,
+                                                          int                m,
+                                                          const double*      AP,
+                                                          int                strideAP,
+                                                          double*            x,
+                                                          int                incx,
                                                           int                stride,
                                                           int                batchCount);
 
@@ -4184,92 +5850,344 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZtrsvStridedBatched(hipblasHandle_t
 // ========== LEVEL 3 =============
 // ================================
 
-// herk
-HIPBLAS_EXPORT hipblasStatus_t hipblasCherk(hipblasHandle_t       handle,
-                                            hipblasFillMode_t     uplo,
-                                            hipblasOperation_t    transA,
+// dgmm
+HIPBLAS_EXPORT hipblasStatus_t hipblasSdgmm(hipblasHandle_t   handle,
+                                            hipblasSideMode_t side,
+                                            int               m,
+                                            int               n,
+                                            const float*      A,
+                                            int               lda,
+                                            const float*      x,
+                                            int               incx,
+                                            float*            C,
+                                            int               ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDdgmm(hipblasHandle_t   handle,
+                                            hipblasSideMode_t side,
+                                            int               m,
+                                            int               n,
+                                            const double*     A,
+                                            int               lda,
+                                            const double*     x,
+                                            int               incx,
+                                            double*           C,
+                                            int               ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCdgmm(hipblasHandle_t       handle,
+                                            hipblasSideMode_t     side,
+                                            int                   m,
                                             int                   n,
-                                            int                   k,
-                                            const float*          alpha,
                                             const hipblasComplex* A,
                                             int                   lda,
-                                            const float*          beta,
+                                            const hipblasComplex* x,
+                                            int                   incx,
                                             hipblasComplex*       C,
                                             int                   ldc);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasZherk(hipblasHandle_t             handle,
-                                            hipblasFillMode_t           uplo,
-                                            hipblasOperation_t          transA,
+HIPBLAS_EXPORT hipblasStatus_t hipblasZdgmm(hipblasHandle_t             handle,
+                                            hipblasSideMode_t           side,
+                                            int                         m,
                                             int                         n,
-                                            int                         k,
-                                            const double*               alpha,
                                             const hipblasDoubleComplex* A,
                                             int                         lda,
-                                            const double*               beta,
+                                            const hipblasDoubleComplex* x,
+                                            int                         incx,
                                             hipblasDoubleComplex*       C,
                                             int                         ldc);
 
-// herk_batched
-HIPBLAS_EXPORT hipblasStatus_t hipblasCherkBatched(hipblasHandle_t             handle,
-                                                   hipblasFillMode_t           uplo,
-                                                   hipblasOperation_t          transA,
+// dgmm_batched
+HIPBLAS_EXPORT hipblasStatus_t hipblasSdgmmBatched(hipblasHandle_t    handle,
+                                                   hipblasSideMode_t  side,
+                                                   int                m,
+                                                   int                n,
+                                                   const float* const A[],
+                                                   int                lda,
+                                                   const float* const x[],
+                                                   int                incx,
+                                                   float* const       C[],
+                                                   int                ldc,
+                                                   int                batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDdgmmBatched(hipblasHandle_t     handle,
+                                                   hipblasSideMode_t   side,
+                                                   int                 m,
+                                                   int                 n,
+                                                   const double* const A[],
+                                                   int                 lda,
+                                                   const double* const x[],
+                                                   int                 incx,
+                                                   double* const       C[],
+                                                   int                 ldc,
+                                                   int                 batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCdgmmBatched(hipblasHandle_t             handle,
+                                                   hipblasSideMode_t           side,
+                                                   int                         m,
                                                    int                         n,
-                                                   int                         k,
-                                                   const float*                alpha,
                                                    const hipblasComplex* const A[],
                                                    int                         lda,
-                                                   const float*                beta,
+                                                   const hipblasComplex* const x[],
+                                                   int                         incx,
                                                    hipblasComplex* const       C[],
                                                    int                         ldc,
                                                    int                         batchCount);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasZherkBatched(hipblasHandle_t                   handle,
-                                                   hipblasFillMode_t                 uplo,
-                                                   hipblasOperation_t                transA,
+HIPBLAS_EXPORT hipblasStatus_t hipblasZdgmmBatched(hipblasHandle_t                   handle,
+                                                   hipblasSideMode_t                 side,
+                                                   int                               m,
                                                    int                               n,
-                                                   int                               k,
-                                                   const double*                     alpha,
                                                    const hipblasDoubleComplex* const A[],
                                                    int                               lda,
-                                                   const double*                     beta,
+                                                   const hipblasDoubleComplex* const x[],
+                                                   int                               incx,
                                                    hipblasDoubleComplex* const       C[],
                                                    int                               ldc,
                                                    int                               batchCount);
 
-// herk_strided_batched
-HIPBLAS_EXPORT hipblasStatus_t hipblasCherkStridedBatched(hipblasHandle_t       handle,
-                                                          hipblasFillMode_t     uplo,
-                                                          hipblasOperation_t    transA,
+// dgmm_strided_batched
+HIPBLAS_EXPORT hipblasStatus_t hipblasSdgmmStridedBatched(hipblasHandle_t   handle,
+                                                          hipblasSideMode_t side,
+                                                          int               m,
+                                                          int               n,
+                                                          const float*      A,
+                                                          int               lda,
+                                                          int               strideA,
+                                                          const float*      x,
+                                                          int               incx,
+                                                          int               stridex,
+                                                          float*            C,
+                                                          int               ldc,
+                                                          int               strideC,
+                                                          int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDdgmmStridedBatched(hipblasHandle_t   handle,
+                                                          hipblasSideMode_t side,
+                                                          int               m,
+                                                          int               n,
+                                                          const double*     A,
+                                                          int               lda,
+                                                          int               strideA,
+                                                          const double*     x,
+                                                          int               incx,
+                                                          int               stridex,
+                                                          double*           C,
+                                                          int               ldc,
+                                                          int               strideC,
+                                                          int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCdgmmStridedBatched(hipblasHandle_t       handle,
+                                                          hipblasSideMode_t     side,
+                                                          int                   m,
                                                           int                   n,
-                                                          int                   k,
-                                                          const float*          alpha,
                                                           const hipblasComplex* A,
                                                           int                   lda,
                                                           int                   strideA,
-                                                          const float*          beta,
+                                                          const hipblasComplex* x,
+                                                          int                   incx,
+                                                          int                   stridex,
                                                           hipblasComplex*       C,
                                                           int                   ldc,
                                                           int                   strideC,
                                                           int                   batchCount);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasZherkStridedBatched(hipblasHandle_t             handle,
-                                                          hipblasFillMode_t           uplo,
-                                                          hipblasOperation_t          transA,
+HIPBLAS_EXPORT hipblasStatus_t hipblasZdgmmStridedBatched(hipblasHandle_t             handle,
+                                                          hipblasSideMode_t           side,
+                                                          int                         m,
                                                           int                         n,
-                                                          int                         k,
-                                                          const double*               alpha,
                                                           const hipblasDoubleComplex* A,
                                                           int                         lda,
                                                           int                         strideA,
-                                                          const double*               beta,
+                                                          const hipblasDoubleComplex* x,
+                                                          int                         incx,
+                                                          int                         stridex,
                                                           hipblasDoubleComplex*       C,
                                                           int                         ldc,
                                                           int                         strideC,
                                                           int                         batchCount);
 
-// herkx
-HIPBLAS_EXPORT hipblasStatus_t hipblasCherkx(hipblasHandle_t       handle,
-                                             hipblasFillMode_t     uplo,
+// hemm
+HIPBLAS_EXPORT hipblasStatus_t hipblasChemm(hipblasHandle_t       handle,
+                                            hipblasSideMode_t     side,
+                                            hipblasFillMode_t     uplo,
+                                            int                   m,
+                                            int                   n,
+                                            const hipblasComplex* alpha,
+                                            const hipblasComplex* A,
+                                            int                   lda,
+                                            const hipblasComplex* B,
+                                            int                   ldb,
+                                            const hipblasComplex* beta,
+                                            hipblasComplex*       C,
+                                            int                   ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZhemm(hipblasHandle_t             handle,
+                                            hipblasSideMode_t           side,
+                                            hipblasFillMode_t           uplo,
+                                            int                         m,
+                                            int                         n,
+                                            const hipblasDoubleComplex* alpha,
+                                            const hipblasDoubleComplex* A,
+                                            int                         lda,
+                                            const hipblasDoubleComplex* B,
+                                            int                         ldb,
+                                            const hipblasDoubleComplex* beta,
+                                            hipblasDoubleComplex*       C,
+                                            int                         ldc);
+
+// hemm_batched
+HIPBLAS_EXPORT hipblasStatus_t hipblasChemmBatched(hipblasHandle_t             handle,
+                                                   hipblasSideMode_t           side,
+                                                   hipblasFillMode_t           uplo,
+                                                   int                         m,
+                                                   int                         n,
+                                                   const hipblasComplex*       alpha,
+                                                   const hipblasComplex* const A[],
+                                                   int                         lda,
+                                                   const hipblasComplex* const B[],
+                                                   int                         ldb,
+                                                   const hipblasComplex*       beta,
+                                                   hipblasComplex* const       C[],
+                                                   int                         ldc,
+                                                   int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZhemmBatched(hipblasHandle_t                   handle,
+                                                   hipblasSideMode_t                 side,
+                                                   hipblasFillMode_t                 uplo,
+                                                   int                               m,
+                                                   int                               n,
+                                                   const hipblasDoubleComplex*       alpha,
+                                                   const hipblasDoubleComplex* const A[],
+                                                   int                               lda,
+                                                   const hipblasDoubleComplex* const B[],
+                                                   int                               ldb,
+                                                   const hipblasDoubleComplex*       beta,
+                                                   hipblasDoubleComplex* const       C[],
+                                                   int                               ldc,
+                                                   int                               batchCount);
+
+// hemm_strided_batched
+HIPBLAS_EXPORT hipblasStatus_t hipblasChemmStridedBatched(hipblasHandle_t       handle,
+                                                          hipblasSideMode_t     side,
+                                                          hipblasFillMode_t     uplo,
+                                                          int                   m,
+                                                          int                   n,
+                                                          const hipblasComplex* alpha,
+                                                          const hipblasComplex* A,
+                                                          int                   lda,
+                                                          int                   strideA,
+                                                          const hipblasComplex* B,
+                                                          int                   ldb,
+                                                          int                   strideB,
+                                                          const hipblasComplex* beta,
+                                                          hipblasComplex*       C,
+                                                          int                   ldc,
+                                                          int                   strideC,
+                                                          int                   batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZhemmStridedBatched(hipblasHandle_t             handle,
+                                                          hipblasSideMode_t           side,
+                                                          hipblasFillMode_t           uplo,
+                                                          int                         m,
+                                                          int                         n,
+                                                          const hipblasDoubleComplex* alpha,
+                                                          const hipblasDoubleComplex* A,
+                                                          int                         lda,
+                                                          int                         strideA,
+                                                          const hipblasDoubleComplex* B,
+                                                          int                         ldb,
+                                                          int                         strideB,
+                                                          const hipblasDoubleComplex* beta,
+                                                          hipblasDoubleComplex*       C,
+                                                          int                         ldc,
+                                                          int                         strideC,
+                                                          int                         batchCount);
+
+// herk
+HIPBLAS_EXPORT hipblasStatus_t hipblasCherk(hipblasHandle_t       handle,
+                                            hipblasFillMode_t     uplo,
+                                            hipblasOperation_t    transA,
+                                            int                   n,
+                                            int                   k,
+                                            const float*          alpha,
+                                            const hipblasComplex* A,
+                                            int                   lda,
+                                            const float*          beta,
+                                            hipblasComplex*       C,
+                                            int                   ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZherk(hipblasHandle_t             handle,
+                                            hipblasFillMode_t           uplo,
+                                            hipblasOperation_t          transA,
+                                            int                         n,
+                                            int                         k,
+                                            const double*               alpha,
+                                            const hipblasDoubleComplex* A,
+                                            int                         lda,
+                                            const double*               beta,
+                                            hipblasDoubleComplex*       C,
+                                            int                         ldc);
+
+// herk_batched
+HIPBLAS_EXPORT hipblasStatus_t hipblasCherkBatched(hipblasHandle_t             handle,
+                                                   hipblasFillMode_t           uplo,
+                                                   hipblasOperation_t          transA,
+                                                   int                         n,
+                                                   int                         k,
+                                                   const float*                alpha,
+                                                   const hipblasComplex* const A[],
+                                                   int                         lda,
+                                                   const float*                beta,
+                                                   hipblasComplex* const       C[],
+                                                   int                         ldc,
+                                                   int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZherkBatched(hipblasHandle_t                   handle,
+                                                   hipblasFillMode_t                 uplo,
+                                                   hipblasOperation_t                transA,
+                                                   int                               n,
+                                                   int                               k,
+                                                   const double*                     alpha,
+                                                   const hipblasDoubleComplex* const A[],
+                                                   int                               lda,
+                                                   const double*                     beta,
+                                                   hipblasDoubleComplex* const       C[],
+                                                   int                               ldc,
+                                                   int                               batchCount);
+
+// herk_strided_batched
+HIPBLAS_EXPORT hipblasStatus_t hipblasCherkStridedBatched(hipblasHandle_t       handle,
+                                                          hipblasFillMode_t     uplo,
+                                                          hipblasOperation_t    transA,
+                                                          int                   n,
+                                                          int                   k,
+                                                          const float*          alpha,
+                                                          const hipblasComplex* A,
+                                                          int                   lda,
+                                                          int                   strideA,
+                                                          const float*          beta,
+                                                          hipblasComplex*       C,
+                                                          int                   ldc,
+                                                          int                   strideC,
+                                                          int                   batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZherkStridedBatched(hipblasHandle_t             handle,
+                                                          hipblasFillMode_t           uplo,
+                                                          hipblasOperation_t          transA,
+                                                          int                         n,
+                                                          int                         k,
+                                                          const double*               alpha,
+                                                          const hipblasDoubleComplex* A,
+                                                          int                         lda,
+                                                          int                         strideA,
+                                                          const double*               beta,
+                                                          hipblasDoubleComplex*       C,
+                                                          int                         ldc,
+                                                          int                         strideC,
+                                                          int                         batchCount);
+
+// herkx
+HIPBLAS_EXPORT hipblasStatus_t hipblasCherkx(hipblasHandle_t       handle,
+                                             hipblasFillMode_t     uplo,
                                              hipblasOperation_t    transA,
                                              int                   n,
                                              int                   k,
@@ -4461,112 +6379,303 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZher2kStridedBatched(hipblasHandle_t
                                                            int                         strideC,
                                                            int                         batchCount);
 
-// syrk
-HIPBLAS_EXPORT hipblasStatus_t hipblasSsyrk(hipblasHandle_t    handle,
-                                            hipblasFillMode_t  uplo,
-                                            hipblasOperation_t transA,
-                                            int                n,
-                                            int                k,
-                                            const float*       alpha,
-                                            const float*       A,
-                                            int                lda,
-                                            const float*       beta,
-                                            float*             C,
-                                            int                ldc);
+// symm
+HIPBLAS_EXPORT hipblasStatus_t hipblasSsymm(hipblasHandle_t   handle,
+                                            hipblasSideMode_t side,
+                                            hipblasFillMode_t uplo,
+                                            int               m,
+                                            int               n,
+                                            const float*      alpha,
+                                            const float*      A,
+                                            int               lda,
+                                            const float*      B,
+                                            int               ldb,
+                                            const float*      beta,
+                                            float*            C,
+                                            int               ldc);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasDsyrk(hipblasHandle_t    handle,
-                                            hipblasFillMode_t  uplo,
-                                            hipblasOperation_t transA,
-                                            int                n,
-                                            int                k,
-                                            const double*      alpha,
-                                            const double*      A,
-                                            int                lda,
-                                            const double*      beta,
-                                            double*            C,
-                                            int                ldc);
+HIPBLAS_EXPORT hipblasStatus_t hipblasDsymm(hipblasHandle_t   handle,
+                                            hipblasSideMode_t side,
+                                            hipblasFillMode_t uplo,
+                                            int               m,
+                                            int               n,
+                                            const double*     alpha,
+                                            const double*     A,
+                                            int               lda,
+                                            const double*     B,
+                                            int               ldb,
+                                            const double*     beta,
+                                            double*           C,
+                                            int               ldc);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasCsyrk(hipblasHandle_t       handle,
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsymm(hipblasHandle_t       handle,
+                                            hipblasSideMode_t     side,
                                             hipblasFillMode_t     uplo,
-                                            hipblasOperation_t    transA,
+                                            int                   m,
                                             int                   n,
-                                            int                   k,
                                             const hipblasComplex* alpha,
                                             const hipblasComplex* A,
                                             int                   lda,
+                                            const hipblasComplex* B,
+                                            int                   ldb,
                                             const hipblasComplex* beta,
                                             hipblasComplex*       C,
                                             int                   ldc);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasZsyrk(hipblasHandle_t             handle,
+HIPBLAS_EXPORT hipblasStatus_t hipblasZsymm(hipblasHandle_t             handle,
+                                            hipblasSideMode_t           side,
                                             hipblasFillMode_t           uplo,
-                                            hipblasOperation_t          transA,
+                                            int                         m,
                                             int                         n,
-                                            int                         k,
                                             const hipblasDoubleComplex* alpha,
                                             const hipblasDoubleComplex* A,
                                             int                         lda,
+                                            const hipblasDoubleComplex* B,
+                                            int                         ldb,
                                             const hipblasDoubleComplex* beta,
                                             hipblasDoubleComplex*       C,
                                             int                         ldc);
 
-// syrk_batched
-HIPBLAS_EXPORT hipblasStatus_t hipblasSsyrkBatched(hipblasHandle_t    handle,
+// symm_batched
+HIPBLAS_EXPORT hipblasStatus_t hipblasSsymmBatched(hipblasHandle_t    handle,
+                                                   hipblasSideMode_t  side,
                                                    hipblasFillMode_t  uplo,
-                                                   hipblasOperation_t transA,
+                                                   int                m,
                                                    int                n,
-                                                   int                k,
                                                    const float*       alpha,
                                                    const float* const A[],
                                                    int                lda,
+                                                   const float* const B[],
+                                                   int                ldb,
                                                    const float*       beta,
                                                    float* const       C[],
                                                    int                ldc,
                                                    int                batchCount);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasDsyrkBatched(hipblasHandle_t     handle,
+HIPBLAS_EXPORT hipblasStatus_t hipblasDsymmBatched(hipblasHandle_t     handle,
+                                                   hipblasSideMode_t   side,
                                                    hipblasFillMode_t   uplo,
-                                                   hipblasOperation_t  transA,
+                                                   int                 m,
                                                    int                 n,
-                                                   int                 k,
                                                    const double*       alpha,
                                                    const double* const A[],
                                                    int                 lda,
+                                                   const double* const B[],
+                                                   int                 ldb,
                                                    const double*       beta,
                                                    double* const       C[],
                                                    int                 ldc,
                                                    int                 batchCount);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasCsyrkBatched(hipblasHandle_t             handle,
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsymmBatched(hipblasHandle_t             handle,
+                                                   hipblasSideMode_t           side,
                                                    hipblasFillMode_t           uplo,
-                                                   hipblasOperation_t          transA,
+                                                   int                         m,
                                                    int                         n,
-                                                   int                         k,
                                                    const hipblasComplex*       alpha,
                                                    const hipblasComplex* const A[],
                                                    int                         lda,
+                                                   const hipblasComplex* const B[],
+                                                   int                         ldb,
                                                    const hipblasComplex*       beta,
                                                    hipblasComplex* const       C[],
                                                    int                         ldc,
                                                    int                         batchCount);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasZsyrkBatched(hipblasHandle_t                   handle,
+HIPBLAS_EXPORT hipblasStatus_t hipblasZsymmBatched(hipblasHandle_t                   handle,
+                                                   hipblasSideMode_t                 side,
                                                    hipblasFillMode_t                 uplo,
-                                                   hipblasOperation_t                transA,
+                                                   int                               m,
                                                    int                               n,
-                                                   int                               k,
                                                    const hipblasDoubleComplex*       alpha,
                                                    const hipblasDoubleComplex* const A[],
                                                    int                               lda,
+                                                   const hipblasDoubleComplex* const B[],
+                                                   int                               ldb,
                                                    const hipblasDoubleComplex*       beta,
                                                    hipblasDoubleComplex* const       C[],
                                                    int                               ldc,
                                                    int                               batchCount);
 
-// syrk_strided_batched
-HIPBLAS_EXPORT hipblasStatus_t hipblasSsyrkStridedBatched(hipblasHandle_t    handle,
-                                                          hipblasFillMode_t  uplo,
-                                                          hipblasOperation_t transA,
+// symm_strided_batched
+HIPBLAS_EXPORT hipblasStatus_t hipblasSsymmStridedBatched(hipblasHandle_t   handle,
+                                                          hipblasSideMode_t side,
+                                                          hipblasFillMode_t uplo,
+                                                          int               m,
+                                                          int               n,
+                                                          const float*      alpha,
+                                                          const float*      A,
+                                                          int               lda,
+                                                          int               strideA,
+                                                          const float*      B,
+                                                          int               ldb,
+                                                          int               strideB,
+                                                          const float*      beta,
+                                                          float*            C,
+                                                          int               ldc,
+                                                          int               strideC,
+                                                          int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDsymmStridedBatched(hipblasHandle_t   handle,
+                                                          hipblasSideMode_t side,
+                                                          hipblasFillMode_t uplo,
+                                                          int               m,
+                                                          int               n,
+                                                          const double*     alpha,
+                                                          const double*     A,
+                                                          int               lda,
+                                                          int               strideA,
+                                                          const double*     B,
+                                                          int               ldb,
+                                                          int               strideB,
+                                                          const double*     beta,
+                                                          double*           C,
+                                                          int               ldc,
+                                                          int               strideC,
+                                                          int               batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsymmStridedBatched(hipblasHandle_t       handle,
+                                                          hipblasSideMode_t     side,
+                                                          hipblasFillMode_t     uplo,
+                                                          int                   m,
+                                                          int                   n,
+                                                          const hipblasComplex* alpha,
+                                                          const hipblasComplex* A,
+                                                          int                   lda,
+                                                          int                   strideA,
+                                                          const hipblasComplex* B,
+                                                          int                   ldb,
+                                                          int                   strideB,
+                                                          const hipblasComplex* beta,
+                                                          hipblasComplex*       C,
+                                                          int                   ldc,
+                                                          int                   strideC,
+                                                          int                   batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZsymmStridedBatched(hipblasHandle_t             handle,
+                                                          hipblasSideMode_t           side,
+                                                          hipblasFillMode_t           uplo,
+                                                          int                         m,
+                                                          int                         n,
+                                                          const hipblasDoubleComplex* alpha,
+                                                          const hipblasDoubleComplex* A,
+                                                          int                         lda,
+                                                          int                         strideA,
+                                                          const hipblasDoubleComplex* B,
+                                                          int                         ldb,
+                                                          int                         strideB,
+                                                          const hipblasDoubleComplex* beta,
+                                                          hipblasDoubleComplex*       C,
+                                                          int                         ldc,
+                                                          int                         strideC,
+                                                          int                         batchCount);
+
+// syrk
+HIPBLAS_EXPORT hipblasStatus_t hipblasSsyrk(hipblasHandle_t    handle,
+                                            hipblasFillMode_t  uplo,
+                                            hipblasOperation_t transA,
+                                            int                n,
+                                            int                k,
+                                            const float*       alpha,
+                                            const float*       A,
+                                            int                lda,
+                                            const float*       beta,
+                                            float*             C,
+                                            int                ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDsyrk(hipblasHandle_t    handle,
+                                            hipblasFillMode_t  uplo,
+                                            hipblasOperation_t transA,
+                                            int                n,
+                                            int                k,
+                                            const double*      alpha,
+                                            const double*      A,
+                                            int                lda,
+                                            const double*      beta,
+                                            double*            C,
+                                            int                ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsyrk(hipblasHandle_t       handle,
+                                            hipblasFillMode_t     uplo,
+                                            hipblasOperation_t    transA,
+                                            int                   n,
+                                            int                   k,
+                                            const hipblasComplex* alpha,
+                                            const hipblasComplex* A,
+                                            int                   lda,
+                                            const hipblasComplex* beta,
+                                            hipblasComplex*       C,
+                                            int                   ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZsyrk(hipblasHandle_t             handle,
+                                            hipblasFillMode_t           uplo,
+                                            hipblasOperation_t          transA,
+                                            int                         n,
+                                            int                         k,
+                                            const hipblasDoubleComplex* alpha,
+                                            const hipblasDoubleComplex* A,
+                                            int                         lda,
+                                            const hipblasDoubleComplex* beta,
+                                            hipblasDoubleComplex*       C,
+                                            int                         ldc);
+
+// syrk_batched
+HIPBLAS_EXPORT hipblasStatus_t hipblasSsyrkBatched(hipblasHandle_t    handle,
+                                                   hipblasFillMode_t  uplo,
+                                                   hipblasOperation_t transA,
+                                                   int                n,
+                                                   int                k,
+                                                   const float*       alpha,
+                                                   const float* const A[],
+                                                   int                lda,
+                                                   const float*       beta,
+                                                   float* const       C[],
+                                                   int                ldc,
+                                                   int                batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDsyrkBatched(hipblasHandle_t     handle,
+                                                   hipblasFillMode_t   uplo,
+                                                   hipblasOperation_t  transA,
+                                                   int                 n,
+                                                   int                 k,
+                                                   const double*       alpha,
+                                                   const double* const A[],
+                                                   int                 lda,
+                                                   const double*       beta,
+                                                   double* const       C[],
+                                                   int                 ldc,
+                                                   int                 batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsyrkBatched(hipblasHandle_t             handle,
+                                                   hipblasFillMode_t           uplo,
+                                                   hipblasOperation_t          transA,
+                                                   int                         n,
+                                                   int                         k,
+                                                   const hipblasComplex*       alpha,
+                                                   const hipblasComplex* const A[],
+                                                   int                         lda,
+                                                   const hipblasComplex*       beta,
+                                                   hipblasComplex* const       C[],
+                                                   int                         ldc,
+                                                   int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZsyrkBatched(hipblasHandle_t                   handle,
+                                                   hipblasFillMode_t                 uplo,
+                                                   hipblasOperation_t                transA,
+                                                   int                               n,
+                                                   int                               k,
+                                                   const hipblasDoubleComplex*       alpha,
+                                                   const hipblasDoubleComplex* const A[],
+                                                   int                               lda,
+                                                   const hipblasDoubleComplex*       beta,
+                                                   hipblasDoubleComplex* const       C[],
+                                                   int                               ldc,
+                                                   int                               batchCount);
+
+// syrk_strided_batched
+HIPBLAS_EXPORT hipblasStatus_t hipblasSsyrkStridedBatched(hipblasHandle_t    handle,
+                                                          hipblasFillMode_t  uplo,
+                                                          hipblasOperation_t transA,
                                                           int                n,
                                                           int                k,
                                                           const float*       alpha,
@@ -5181,6 +7290,217 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZtrmmStridedBatched(hipblasHandle_t
                                                           int                         strideB,
                                                           int                         batchCount);
 
+// trmm writing C = alpha op(A) B, or alpha B op(A) with side right, to its own m x n matrix and
+// leaving B unchanged. cuBLAS computes C directly; rocBLAS copies B to C and updates C in place.
+// C given as B with ldc == ldb (and strideC == strideB) is the in-place trmm; C must not otherwise
+// overlap B. On cuBLAS the Batched and StridedBatched forms are not supported, as for trmm
+// trmm_outofplace
+HIPBLAS_EXPORT hipblasStatus_t hipblasStrmmOutOfPlace(hipblasHandle_t    handle,
+                                                      hipblasSideMode_t  side,
+                                                      hipblasFillMode_t  uplo,
+                                                      hipblasOperation_t transA,
+                                                      hipblasDiagType_t  diag,
+                                                      int                m,
+                                                      int                n,
+                                                      const float*       alpha,
+                                                      const float*       A,
+                                                      int                lda,
+                                                      const float*       B,
+                                                      int                ldb,
+                                                      float*             C,
+                                                      int                ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtrmmOutOfPlace(hipblasHandle_t    handle,
+                                                      hipblasSideMode_t  side,
+                                                      hipblasFillMode_t  uplo,
+                                                      hipblasOperation_t transA,
+                                                      hipblasDiagType_t  diag,
+                                                      int                m,
+                                                      int                n,
+                                                      const double*      alpha,
+                                                      const double*      A,
+                                                      int                lda,
+                                                      const double*      B,
+                                                      int                ldb,
+                                                      double*            C,
+                                                      int                ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtrmmOutOfPlace(hipblasHandle_t       handle,
+                                                      hipblasSideMode_t     side,
+                                                      hipblasFillMode_t     uplo,
+                                                      hipblasOperation_t    transA,
+                                                      hipblasDiagType_t     diag,
+                                                      int                   m,
+                                                      int                   n,
+                                                      const hipblasComplex* alpha,
+                                                      const hipblasComplex* A,
+                                                      int                   lda,
+                                                      const hipblasComplex* B,
+                                                      int                   ldb,
+                                                      hipblasComplex*       C,
+                                                      int                   ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtrmmOutOfPlace(hipblasHandle_t             handle,
+                                                      hipblasSideMode_t           side,
+                                                      hipblasFillMode_t           uplo,
+                                                      hipblasOperation_t          transA,
+                                                      hipblasDiagType_t           diag,
+                                                      int                         m,
+                                                      int                         n,
+                                                      const hipblasDoubleComplex* alpha,
+                                                      const hipblasDoubleComplex* A,
+                                                      int                         lda,
+                                                      const hipblasDoubleComplex* B,
+                                                      int                         ldb,
+                                                      hipblasDoubleComplex*       C,
+                                                      int                         ldc);
+
+// trmm_outofplace_batched
+HIPBLAS_EXPORT hipblasStatus_t hipblasStrmmOutOfPlaceBatched(hipblasHandle_t    handle,
+                                                             hipblasSideMode_t  side,
+                                                             hipblasFillMode_t  uplo,
+                                                             hipblasOperation_t transA,
+                                                             hipblasDiagType_t  diag,
+                                                             int                m,
+                                                             int                n,
+                                                             const float*       alpha,
+                                                             const float* const A[],
+                                                             int                lda,
+                                                             const float* const B[],
+                                                             int                ldb,
+                                                             float* const       C[],
+                                                             int                ldc,
+                                                             int                batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtrmmOutOfPlaceBatched(hipblasHandle_t     handle,
+                                                             hipblasSideMode_t   side,
+                                                             hipblasFillMode_t   uplo,
+                                                             hipblasOperation_t  transA,
+                                                             hipblasDiagType_t   diag,
+                                                             int                 m,
+                                                             int                 n,
+                                                             const double*       alpha,
+                                                             const double* const A[],
+                                                             int                 lda,
+                                                             const double* const B[],
+                                                             int                 ldb,
+                                                             double* const       C[],
+                                                             int                 ldc,
+                                                             int                 batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasCtrmmOutOfPlaceBatched(hipblasHandle_t             handle,
+                                  hipblasSideMode_t           side,
+                                  hipblasFillMode_t           uplo,
+                                  hipblasOperation_t          transA,
+                                  hipblasDiagType_t           diag,
+                                  int                         m,
+                                  int                         n,
+                                  const hipblasComplex*       alpha,
+                                  const hipblasComplex* const A[],
+                                  int                         lda,
+                                  const hipblasComplex* const B[],
+                                  int                         ldb,
+                                  hipblasComplex* const       C[],
+                                  int                         ldc,
+                                  int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZtrmmOutOfPlaceBatched(hipblasHandle_t                   handle,
+                                  hipblasSideMode_t                 side,
+                                  hipblasFillMode_t                 uplo,
+                                  hipblasOperation_t                transA,
+                                  hipblasDiagType_t                 diag,
+                                  int                               m,
+                                  int                               n,
+                                  const hipblasDoubleComplex*       alpha,
+                                  const hipblasDoubleComplex* const A[],
+                                  int                               lda,
+                                  const hipblasDoubleComplex* const B[],
+                                  int                               ldb,
+                                  hipblasDoubleComplex* const       C[],
+                                  int                               ldc,
+                                  int                               batchCount);
+
+// trmm_outofplace_strided_batched
+HIPBLAS_EXPORT hipblasStatus_t hipblasStrmmOutOfPlaceStridedBatched(hipblasHandle_t    handle,
+                                                                    hipblasSideMode_t  side,
+                                                                    hipblasFillMode_t  uplo,
+                                                                    hipblasOperation_t transA,
+                                                                    hipblasDiagType_t  diag,
+                                                                    int                m,
+                                                                    int                n,
+                                                                    const float*       alpha,
+                                                                    const float*       A,
+                                                                    int                lda,
+                                                                    int                strideA,
+                                                                    const float*       B,
+                                                                    int                ldb,
+                                                                    int                strideB,
+                                                                    float*             C,
+                                                                    int                ldc,
+                                                                    int                strideC,
+                                                                    int                batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtrmmOutOfPlaceStridedBatched(hipblasHandle_t    handle,
+                                                                    hipblasSideMode_t  side,
+                                                                    hipblasFillMode_t  uplo,
+                                                                    hipblasOperation_t transA,
+                                                                    hipblasDiagType_t  diag,
+                                                                    int                m,
+                                                                    int                n,
+                                                                    const double*      alpha,
+                                                                    const double*      A,
+                                                                    int                lda,
+                                                                    int                strideA,
+                                                                    const double*      B,
+                                                                    int                ldb,
+                                                                    int                strideB,
+                                                                    double*            C,
+                                                                    int                ldc,
+                                                                    int                strideC,
+                                                                    int                batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasCtrmmOutOfPlaceStridedBatched(hipblasHandle_t       handle,
+                                         hipblasSideMode_t     side,
+                                         hipblasFillMode_t     uplo,
+                                         hipblasOperation_t    transA,
+                                         hipblasDiagType_t     diag,
+                                         int                   m,
+                                         int                   n,
+                                         const hipblasComplex* alpha,
+                                         const hipblasComplex* A,
+                                         int                   lda,
+                                         int                   strideA,
+                                         const hipblasComplex* B,
+                                         int                   ldb,
+                                         int                   strideB,
+                                         hipblasComplex*       C,
+                                         int                   ldc,
+                                         int                   strideC,
+                                         int                   batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZtrmmOutOfPlaceStridedBatched(hipblasHandle_t             handle,
+                                         hipblasSideMode_t           side,
+                                         hipblasFillMode_t           uplo,
+                                         hipblasOperation_t          transA,
+                                         hipblasDiagType_t           diag,
+                                         int                         m,
+                                         int                         n,
+                                         const hipblasDoubleComplex* alpha,
+                                         const hipblasDoubleComplex* A,
+                                         int                         lda,
+                                         int                         strideA,
+                                         const hipblasDoubleComplex* B,
+                                         int                         ldb,
+                                         int                         strideB,
+                                         hipblasDoubleComplex*       C,
+                                         int                         ldc,
+                                         int                         strideC,
+                                         int                         batchCount);
+
 // trsm
 HIPBLAS_EXPORT hipblasStatus_t hipblasStrsm(hipblasHandle_t    handle,
                                             hipblasSideMode_t  side,
@@ -5356,6 +7676,133 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZtrsmStridedBatched(hipblasHandle_t
                                                           int                         strideB,
                                                           int                         batch_count);
 
+// trtri: invA = inv(A) for triangular A; A and invA must not overlap
+HIPBLAS_EXPORT hipblasStatus_t hipblasStrtri(hipblasHandle_t   handle,
+                                             hipblasFillMode_t uplo,
+                                             hipblasDiagType_t diag,
+                                             int               n,
+                                             const float*      A,
+                                             int               lda,
+                                             float*            invA,
+                                             int               ldinvA);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtrtri(hipblasHandle_t   handle,
+                                             hipblasFillMode_t uplo,
+                                             hipblasDiagType_t diag,
+                                             int               n,
+                                             const double*     A,
+                                             int               lda,
+                                             double*           invA,
+                                             int               ldinvA);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtrtri(hipblasHandle_t       handle,
+                                             hipblasFillMode_t     uplo,
+                                             hipblasDiagType_t     diag,
+                                             int                   n,
+                                             const hipblasComplex* A,
+                                             int                   lda,
+                                             hipblasComplex*       invA,
+                                             int                   ldinvA);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtrtri(hipblasHandle_t             handle,
+                                             hipblasFillMode_t           uplo,
+                                             hipblasDiagType_t           diag,
+                                             int                         n,
+                                             const hipblasDoubleComplex* A,
+                                             int                         lda,
+                                             hipblasDoubleComplex*       invA,
+                                             int                         ldinvA);
+
+// trtri_batched
+HIPBLAS_EXPORT hipblasStatus_t hipblasStrtriBatched(hipblasHandle_t    handle,
+                                                    hipblasFillMode_t  uplo,
+                                                    hipblasDiagType_t  diag,
+                                                    int                n,
+                                                    const float* const A[],
+                                                    int                lda,
+                                                    float* const       invA[],
+                                                    int                ldinvA,
+                                                    int                batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtrtriBatched(hipblasHandle_t     handle,
+                                                    hipblasFillMode_t   uplo,
+                                                    hipblasDiagType_t   diag,
+                                                    int                 n,
+                                                    const double* const A[],
+                                                    int                 lda,
+                                                    double* const       invA[],
+                                                    int                 ldinvA,
+                                                    int                 batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtrtriBatched(hipblasHandle_t             handle,
+                                                    hipblasFillMode_t           uplo,
+                                                    hipblasDiagType_t           diag,
+                                                    int                         n,
+                                                    const hipblasComplex* const A[],
+                                                    int                         lda,
+                                                    hipblasComplex* const       invA[],
+                                                    int                         ldinvA,
+                                                    int                         batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtrtriBatched(hipblasHandle_t                   handle,
+                                                    hipblasFillMode_t                 uplo,
+                                                    hipblasDiagType_t                 diag,
+                                                    int                               n,
+                                                    const hipblasDoubleComplex* const A[],
+                                                    int                               lda,
+                                                    hipblasDoubleComplex* const       invA[],
+                                                    int                               ldinvA,
+                                                    int                               batch_count);
+
+// trtri_strided_batched
+HIPBLAS_EXPORT hipblasStatus_t hipblasStrtriStridedBatched(hipblasHandle_t   handle,
+                                                           hipblasFillMode_t uplo,
+                                                           hipblasDiagType_t diag,
+                                                           int               n,
+                                                           const float*      A,
+                                                           int               lda,
+                                                           int               strideA,
+                                                           float*            invA,
+                                                           int               ldinvA,
+                                                           int               strideInvA,
+                                                           int               batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtrtriStridedBatched(hipblasHandle_t   handle,
+                                                           hipblasFillMode_t uplo,
+                                                           hipblasDiagType_t diag,
+                                                           int               n,
+                                                           const double*     A,
+                                                           int               lda,
+                                                           int               strideA,
+                                                           double*           invA,
+                                                           int               ldinvA,
+                                                           int               strideInvA,
+                                                           int               batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtrtriStridedBatched(hipblasHandle_t       handle,
+                                                           hipblasFillMode_t     uplo,
+                                                           hipblasDiagType_t     diag,
+                                                           int                   n,
+                                                           const hipblasComplex* A,
+                                                           int                   lda,
+                                                           int                   strideA,
+                                                           hipblasComplex*       invA,
+                                                           int                   ldinvA,
+                                                           int                   strideInvA,
+                                                           int                   batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtrtriStridedBatched(hipblasHandle_t             handle,
+                                                           hipblasFillMode_t           uplo,
+                                                           hipblasDiagType_t           diag,
+                                                           int                         n,
+                                                           const hipblasDoubleComplex* A,
+                                                           int                         lda,
+                                                           int                         strideA,
+                                                           hipblasDoubleComplex*       invA,
+                                                           int                         ldinvA,
+                                                           int                         strideInvA,
+                                                           int                         batch_count);
+
 // getrf
 HIPBLAS_EXPORT hipblasStatus_t hipblasSgetrf(
     hipblasHandle_t handle, const int n, float* A, const int lda, int* ipiv, int* info);
@@ -5379,6 +7826,7 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSgetrfBatched(hipblasHandle_t handle,
                                                     float* const    A[],
                                                     const int       lda,
                                                     int*            ipiv,
+                                                    const int       strideP,
                                                     int*            info,
                                                     const int       batch_count);
 
@@ -5387,6 +7835,7 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDgetrfBatched(hipblasHandle_t handle,
                                                     double* const   A[],
                                                     const int       lda,
                                                     int*            ipiv,
+                                                    const int       strideP,
                                                     int*            info,
                                                     const int       batch_count);
 
@@ -5395,6 +7844,7 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCgetrfBatched(hipblasHandle_t       handle
                                                     hipblasComplex* const A[],
                                                     const int             lda,
                                                     int*                  ipiv,
+                                                    const int             strideP,
                                                     int*                  info,
                                                     const int             batch_count);
 
@@ -5403,6 +7853,7 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZgetrfBatched(hipblasHandle_t
                                                     hipblasDoubleComplex* const A[],
                                                     const int                   lda,
                                                     int*                        ipiv,
+                                                    const int                   strideP,
                                                     int*                        info,
                                                     const int                   batch_count);
 
@@ -5500,6 +7951,7 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasSgetrsBatched(hipblasHandle_t          han
                                                     float* const             A[],
                                                     const int                lda,
                                                     const int*               ipiv,
+                                                    const int                strideP,
                                                     float* const             B[],
                                                     const int                ldb,
                                                     int*                     info,
@@ -5512,6 +7964,7 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasDgetrsBatched(hipblasHandle_t          han
                                                     double* const            A[],
                                                     const int                lda,
                                                     const int*               ipiv,
+                                                    const int                strideP,
                                                     double* const            B[],
                                                     const int                ldb,
                                                     int*                     info,
@@ -5524,6 +7977,7 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasCgetrsBatched(hipblasHandle_t          han
                                                     hipblasComplex* const    A[],
                                                     const int                lda,
                                                     const int*               ipiv,
+                                                    const int                strideP,
                                                     hipblasComplex* const    B[],
                                                     const int                ldb,
                                                     int*                     info,
@@ -5536,6 +7990,7 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZgetrsBatched(hipblasHandle_t
                                                     hipblasDoubleComplex* const A[],
                                                     const int                   lda,
                                                     const int*                  ipiv,
+                                                    const int                   strideP,
                                                     hipblasDoubleComplex* const B[],
                                                     const int                   ldb,
                                                     int*                        info,
@@ -5602,69 +8057,819 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZgetrsStridedBatched(hipblasHandle_t
                                                            int*                     info,
                                                            const int                batch_count);
 
-// geqrf
-HIPBLAS_EXPORT hipblasStatus_t hipblasSgeqrf(hipblasHandle_t handle,
-                                             const int       m,
-                                             const int       n,
-                                             float*          A,
-                                             const int       lda,
-                                             float*          ipiv,
-                                             int*            info);
-
-HIPBLAS_EXPORT hipblasStatus_t hipblasDgeqrf(hipblasHandle_t handle,
-                                             const int       m,
-                                             const int       n,
-                                             double*         A,
-                                             const int       lda,
-                                             double*         ipiv,
-                                             int*            info);
-
-HIPBLAS_EXPORT hipblasStatus_t hipblasCgeqrf(hipblasHandle_t handle,
-                                             const int       m,
-                                             const int       n,
-                                             hipblasComplex* A,
-                                             const int       lda,
-                                             hipblasComplex* ipiv,
-                                             int*            info);
-
-HIPBLAS_EXPORT hipblasStatus_t hipblasZgeqrf(hipblasHandle_t       handle,
-                                             const int             m,
-                                             const int             n,
-                                             hipblasDoubleComplex* A,
-                                             const int             lda,
-                                             hipblasDoubleComplex* ipiv,
-                                             int*                  info);
-
-// geqrf_batched
-HIPBLAS_EXPORT hipblasStatus_t hipblasSgeqrfBatched(hipblasHandle_t handle,
-                                                    const int       m,
+// getri_batched
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgetriBatched(hipblasHandle_t handle,
                                                     const int       n,
                                                     float* const    A[],
                                                     const int       lda,
-                                                    float* const    ipiv[],
+                                                    int*            ipiv,
+                                                    const int       strideP,
+                                                    float* const    C[],
+                                                    const int       ldc,
                                                     int*            info,
                                                     const int       batch_count);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasDgeqrfBatched(hipblasHandle_t handle,
-                                                    const int       m,
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgetriBatched(hipblasHandle_t handle,
                                                     const int       n,
                                                     double* const   A[],
                                                     const int       lda,
-                                                    double* const   ipiv[],
+                                                    int*            ipiv,
+                                                    const int       strideP,
+                                                    double* const   C[],
+                                                    const int       ldc,
                                                     int*            info,
                                                     const int       batch_count);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasCgeqrfBatched(hipblasHandle_t       handle,
-                                                    const int             m,
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgetriBatched(hipblasHandle_t       handle,
                                                     const int             n,
                                                     hipblasComplex* const A[],
                                                     const int             lda,
-                                                    hipblasComplex* const ipiv[],
+                                                    int*                  ipiv,
+                                                    const int             strideP,
+                                                    hipblasComplex* const C[],
+                                                    const int             ldc,
                                                     int*                  info,
                                                     const int             batch_count);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasZgeqrfBatched(hipblasHandle_t             handle,
-                                                    const int                   m,
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgetriBatched(hipblasHandle_t             handle,
+                                                    const int                   n,
+                                                    hipblasDoubleComplex* const A[],
+                                                    const int                   lda,
+                                                    int*                        ipiv,
+                                                    const int                   strideP,
+                                                    hipblasDoubleComplex* const C[],
+                                                    const int                   ldc,
+                                                    int*                        info,
+                                                    const int                   batch_count);
+
+// getri_strided_batched
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgetriStridedBatched(hipblasHandle_t handle,
+                                                           const int       n,
+                                                           float*          A,
+                                                           const int       lda,
+                                                           const int       strideA,
+                                                           int*            ipiv,
+                                                           const int       strideP,
+                                                           float*          C,
+                                                           const int       ldc,
+                                                           const int       strideC,
+                                                           int*            info,
+                                                           const int       batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgetriStridedBatched(hipblasHandle_t handle,
+                                                           const int       n,
+                                                           double*         A,
+                                                           const int       lda,
+                                                           const int       strideA,
+                                                           int*            ipiv,
+                                                           const int       strideP,
+                                                           double*         C,
+                                                           const int       ldc,
+                                                           const int       strideC,
+                                                           int*            info,
+                                                           const int       batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgetriStridedBatched(hipblasHandle_t handle,
+                                                           const int       n,
+                                                           hipblasComplex* A,
+                                                           const int       lda,
+                                                           const int       strideA,
+                                                           int*            ipiv,
+                                                           const int       strideP,
+                                                           hipblasComplex* C,
+                                                           const int       ldc,
+                                                           const int       strideC,
+                                                           int*            info,
+                                                           const int       batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgetriStridedBatched(hipblasHandle_t       handle,
+                                                           const int             n,
+                                                           hipblasDoubleComplex* A,
+                                                           const int             lda,
+                                                           const int             strideA,
+                                                           int*                  ipiv,
+                                                           const int             strideP,
+                                                           hipblasDoubleComplex* C,
+                                                           const int             ldc,
+                                                           const int             strideC,
+                                                           int*                  info,
+                                                           const int             batch_count);
+
+// matinv_batched: n <= 32, A is left unmodified
+HIPBLAS_EXPORT hipblasStatus_t hipblasSmatinvBatched(hipblasHandle_t    handle,
+                                                     const int          n,
+                                                     const float* const A[],
+                                                     const int          lda,
+                                                     float* const       Ainv[],
+                                                     const int          lda_inv,
+                                                     int*               info,
+                                                     const int          batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDmatinvBatched(hipblasHandle_t     handle,
+                                                     const int           n,
+                                                     const double* const A[],
+                                                     const int           lda,
+                                                     double* const       Ainv[],
+                                                     const int           lda_inv,
+                                                     int*                info,
+                                                     const int           batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCmatinvBatched(hipblasHandle_t             handle,
+                                                     const int                   n,
+                                                     const hipblasComplex* const A[],
+                                                     const int                   lda,
+                                                     hipblasComplex* const       Ainv[],
+                                                     const int                   lda_inv,
+                                                     int*                        info,
+                                                     const int                   batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZmatinvBatched(hipblasHandle_t                   handle,
+                                                     const int                         n,
+                                                     const hipblasDoubleComplex* const A[],
+                                                     const int                         lda,
+                                                     hipblasDoubleComplex* const       Ainv[],
+                                                     const int                         lda_inv,
+                                                     int*                              info,
+                                                     const int                         batch_count);
+
+// potrf
+HIPBLAS_EXPORT hipblasStatus_t hipblasSpotrf(hipblasHandle_t         handle,
+                                             const hipblasFillMode_t uplo,
+                                             const int               n,
+                                             float*                  A,
+                                             const int               lda,
+                                             int*                    info);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDpotrf(hipblasHandle_t         handle,
+                                             const hipblasFillMode_t uplo,
+                                             const int               n,
+                                             double*                 A,
+                                             const int               lda,
+                                             int*                    info);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCpotrf(hipblasHandle_t         handle,
+                                             const hipblasFillMode_t uplo,
+                                             const int               n,
+                                             hipblasComplex*         A,
+                                             const int               lda,
+                                             int*                    info);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZpotrf(hipblasHandle_t         handle,
+                                             const hipblasFillMode_t uplo,
+                                             const int               n,
+                                             hipblasDoubleComplex*   A,
+                                             const int               lda,
+                                             int*                    info);
+
+// potrf_batched
+HIPBLAS_EXPORT hipblasStatus_t hipblasSpotrfBatched(hipblasHandle_t         handle,
+                                                    const hipblasFillMode_t uplo,
+                                                    const int               n,
+                                                    float* const            A[],
+                                                    const int               lda,
+                                                    int*                    info,
+                                                    const int               batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDpotrfBatched(hipblasHandle_t         handle,
+                                                    const hipblasFillMode_t uplo,
+                                                    const int               n,
+                                                    double* const           A[],
+                                                    const int               lda,
+                                                    int*                    info,
+                                                    const int               batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCpotrfBatched(hipblasHandle_t         handle,
+                                                    const hipblasFillMode_t uplo,
+                                                    const int               n,
+                                                    hipblasComplex* const   A[],
+                                                    const int               lda,
+                                                    int*                    info,
+                                                    const int               batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZpotrfBatched(hipblasHandle_t             handle,
+                                                    const hipblasFillMode_t     uplo,
+                                                    const int                   n,
+                                                    hipblasDoubleComplex* const A[],
+                                                    const int                   lda,
+                                                    int*                        info,
+                                                    const int                   batch_count);
+
+// potrf_strided_batched
+HIPBLAS_EXPORT hipblasStatus_t hipblasSpotrfStridedBatched(hipblasHandle_t         handle,
+                                                           const hipblasFillMode_t uplo,
+                                                           const int               n,
+                                                           float*                  A,
+                                                           const int               lda,
+                                                           const int               strideA,
+                                                           int*                    info,
+                                                           const int               batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDpotrfStridedBatched(hipblasHandle_t         handle,
+                                                           const hipblasFillMode_t uplo,
+                                                           const int               n,
+                                                           double*                 A,
+                                                           const int               lda,
+                                                           const int               strideA,
+                                                           int*                    info,
+                                                           const int               batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCpotrfStridedBatched(hipblasHandle_t         handle,
+                                                           const hipblasFillMode_t uplo,
+                                                           const int               n,
+                                                           hipblasComplex*         A,
+                                                           const int               lda,
+                                                           const int               strideA,
+                                                           int*                    info,
+                                                           const int               batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZpotrfStridedBatched(hipblasHandle_t         handle,
+                                                           const hipblasFillMode_t uplo,
+                                                           const int               n,
+                                                           hipblasDoubleComplex*   A,
+                                                           const int               lda,
+                                                           const int               strideA,
+                                                           int*                    info,
+                                                           const int               batch_count);
+
+// potrs
+HIPBLAS_EXPORT hipblasStatus_t hipblasSpotrs(hipblasHandle_t         handle,
+                                             const hipblasFillMode_t uplo,
+                                             const int               n,
+                                             const int               nrhs,
+                                             float*                  A,
+                                             const int               lda,
+                                             float*                  B,
+                                             const int               ldb,
+                                             int*                    info);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDpotrs(hipblasHandle_t         handle,
+                                             const hipblasFillMode_t uplo,
+                                             const int               n,
+                                             const int               nrhs,
+                                             double*                 A,
+                                             const int               lda,
+                                             double*                 B,
+                                             const int               ldb,
+                                             int*                    info);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCpotrs(hipblasHandle_t         handle,
+                                             const hipblasFillMode_t uplo,
+                                             const int               n,
+                                             const int               nrhs,
+                                             hipblasComplex*         A,
+                                             const int               lda,
+                                             hipblasComplex*         B,
+                                             const int               ldb,
+                                             int*                    info);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZpotrs(hipblasHandle_t         handle,
+                                             const hipblasFillMode_t uplo,
+                                             const int               n,
+                                             const int               nrhs,
+                                             hipblasDoubleComplex*   A,
+                                             const int               lda,
+                                             hipblasDoubleComplex*   B,
+                                             const int               ldb,
+                                             int*                    info);
+
+// potrs_batched
+HIPBLAS_EXPORT hipblasStatus_t hipblasSpotrsBatched(hipblasHandle_t         handle,
+                                                    const hipblasFillMode_t uplo,
+                                                    const int               n,
+                                                    const int               nrhs,
+                                                    float* const            A[],
+                                                    const int               lda,
+                                                    float* const            B[],
+                                                    const int               ldb,
+                                                    int*                    info,
+                                                    const int               batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDpotrsBatched(hipblasHandle_t         handle,
+                                                    const hipblasFillMode_t uplo,
+                                                    const int               n,
+                                                    const int               nrhs,
+                                                    double* const           A[],
+                                                    const int               lda,
+                                                    double* const           B[],
+                                                    const int               ldb,
+                                                    int*                    info,
+                                                    const int               batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCpotrsBatched(hipblasHandle_t         handle,
+                                                    const hipblasFillMode_t uplo,
+                                                    const int               n,
+                                                    const int               nrhs,
+                                                    hipblasComplex* const   A[],
+                                                    const int               lda,
+                                                    hipblasComplex* const   B[],
+                                                    const int               ldb,
+                                                    int*                    info,
+                                                    const int               batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZpotrsBatched(hipblasHandle_t             handle,
+                                                    const hipblasFillMode_t     uplo,
+                                                    const int                   n,
+                                                    const int                   nrhs,
+                                                    hipblasDoubleComplex* const A[],
+                                                    const int                   lda,
+                                                    hipblasDoubleComplex* const B[],
+                                                    const int                   ldb,
+                                                    int*                        info,
+                                                    const int                   batch_count);
+
+// potrs_strided_batched
+HIPBLAS_EXPORT hipblasStatus_t hipblasSpotrsStridedBatched(hipblasHandle_t         handle,
+                                                           const hipblasFillMode_t uplo,
+                                                           const int               n,
+                                                           const int               nrhs,
+                                                           float*                  A,
+                                                           const int               lda,
+                                                           const int               strideA,
+                                                           float*                  B,
+                                                           const int               ldb,
+                                                           const int               strideB,
+                                                           int*                    info,
+                                                           const int               batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDpotrsStridedBatched(hipblasHandle_t         handle,
+                                                           const hipblasFillMode_t uplo,
+                                                           const int               n,
+                                                           const int               nrhs,
+                                                           double*                 A,
+                                                           const int               lda,
+                                                           const int               strideA,
+                                                           double*                 B,
+                                                           const int               ldb,
+                                                           const int               strideB,
+                                                           int*                    info,
+                                                           const int               batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCpotrsStridedBatched(hipblasHandle_t         handle,
+                                                           const hipblasFillMode_t uplo,
+                                                           const int               n,
+                                                           const int               nrhs,
+                                                           hipblasComplex*         A,
+                                                           const int               lda,
+                                                           const int               strideA,
+                                                           hipblasComplex*         B,
+                                                           const int               ldb,
+                                                           const int               strideB,
+                                                           int*                    info,
+                                                           const int               batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZpotrsStridedBatched(hipblasHandle_t         handle,
+                                                           const hipblasFillMode_t uplo,
+                                                           const int               n,
+                                                           const int               nrhs,
+                                                           hipblasDoubleComplex*   A,
+                                                           const int               lda,
+                                                           const int               strideA,
+                                                           hipblasDoubleComplex*   B,
+                                                           const int               ldb,
+                                                           const int               strideB,
+                                                           int*                    info,
+                                                           const int               batch_count);
+
+// getrf_npvt_batched
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgetrfNpvtBatched(hipblasHandle_t handle,
+                                                        const int       n,
+                                                        float* const    A[],
+                                                        const int       lda,
+                                                        int*            info,
+                                                        const int       batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgetrfNpvtBatched(hipblasHandle_t handle,
+                                                        const int       n,
+                                                        double* const   A[],
+                                                        const int       lda,
+                                                        int*            info,
+                                                        const int       batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgetrfNpvtBatched(hipblasHandle_t       handle,
+                                                        const int             n,
+                                                        hipblasComplex* const A[],
+                                                        const int             lda,
+                                                        int*                  info,
+                                                        const int             batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgetrfNpvtBatched(hipblasHandle_t             handle,
+                                                        const int                   n,
+                                                        hipblasDoubleComplex* const A[],
+                                                        const int                   lda,
+                                                        int*                        info,
+                                                        const int                   batch_count);
+
+// getrf_npvt_strided_batched
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgetrfNpvtStridedBatched(hipblasHandle_t handle,
+                                                               const int       n,
+                                                               float*          A,
+                                                               const int       lda,
+                                                               const int       strideA,
+                                                               int*            info,
+                                                               const int       batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgetrfNpvtStridedBatched(hipblasHandle_t handle,
+                                                               const int       n,
+                                                               double*         A,
+                                                               const int       lda,
+                                                               const int       strideA,
+                                                               int*            info,
+                                                               const int       batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgetrfNpvtStridedBatched(hipblasHandle_t handle,
+                                                               const int       n,
+                                                               hipblasComplex* A,
+                                                               const int       lda,
+                                                               const int       strideA,
+                                                               int*            info,
+                                                               const int       batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgetrfNpvtStridedBatched(hipblasHandle_t       handle,
+                                                               const int             n,
+                                                               hipblasDoubleComplex* A,
+                                                               const int             lda,
+                                                               const int             strideA,
+                                                               int*                  info,
+                                                               const int             batch_count);
+
+// getrs_npvt_batched
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgetrsNpvtBatched(hipblasHandle_t          handle,
+                                                        const hipblasOperation_t trans,
+                                                        const int                n,
+                                                        const int                nrhs,
+                                                        float* const             A[],
+                                                        const int                lda,
+                                                        float* const             B[],
+                                                        const int                ldb,
+                                                        int*                     info,
+                                                        const int                batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgetrsNpvtBatched(hipblasHandle_t          handle,
+                                                        const hipblasOperation_t trans,
+                                                        const int                n,
+                                                        const int                nrhs,
+                                                        double* const            A[],
+                                                        const int                lda,
+                                                        double* const            B[],
+                                                        const int                ldb,
+                                                        int*                     info,
+                                                        const int                batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgetrsNpvtBatched(hipblasHandle_t          handle,
+                                                        const hipblasOperation_t trans,
+                                                        const int                n,
+                                                        const int                nrhs,
+                                                        hipblasComplex* const    A[],
+                                                        const int                lda,
+                                                        hipblasComplex* const    B[],
+                                                        const int                ldb,
+                                                        int*                     info,
+                                                        const int                batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgetrsNpvtBatched(hipblasHandle_t             handle,
+                                                        const hipblasOperation_t    trans,
+                                                        const int                   n,
+                                                        const int                   nrhs,
+                                                        hipblasDoubleComplex* const A[],
+                                                        const int                   lda,
+                                                        hipblasDoubleComplex* const B[],
+                                                        const int                   ldb,
+                                                        int*                        info,
+                                                        const int                   batch_count);
+
+// getrs_npvt_strided_batched
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgetrsNpvtStridedBatched(hipblasHandle_t          handle,
+                                                               const hipblasOperation_t trans,
+                                                               const int                n,
+                                                               const int                nrhs,
+                                                               float*                   A,
+                                                               const int                lda,
+                                                               const int                strideA,
+                                                               float*                   B,
+                                                               const int                ldb,
+                                                               const int                strideB,
+                                                               int*                     info,
+                                                               const int batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgetrsNpvtStridedBatched(hipblasHandle_t          handle,
+                                                               const hipblasOperation_t trans,
+                                                               const int                n,
+                                                               const int                nrhs,
+                                                               double*                  A,
+                                                               const int                lda,
+                                                               const int                strideA,
+                                                               double*                  B,
+                                                               const int                ldb,
+                                                               const int                strideB,
+                                                               int*                     info,
+                                                               const int batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgetrsNpvtStridedBatched(hipblasHandle_t          handle,
+                                                               const hipblasOperation_t trans,
+                                                               const int                n,
+                                                               const int                nrhs,
+                                                               hipblasComplex*          A,
+                                                               const int                lda,
+                                                               const int                strideA,
+                                                               hipblasComplex*          B,
+                                                               const int                ldb,
+                                                               const int                strideB,
+                                                               int*                     info,
+                                                               const int batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgetrsNpvtStridedBatched(hipblasHandle_t          handle,
+                                                               const hipblasOperation_t trans,
+                                                               const int                n,
+                                                               const int                nrhs,
+                                                               hipblasDoubleComplex*    A,
+                                                               const int                lda,
+                                                               const int                strideA,
+                                                               hipblasDoubleComplex*    B,
+                                                               const int                ldb,
+                                                               const int                strideB,
+                                                               int*                     info,
+                                                               const int batch_count);
+
+// gesv_batched
+// Solves A X = B for each batch with the LU factorization of getrf, overwriting A with its factors
+// and B with X in one call. ipiv receives the pivots of each matrix strideP apart, or may be null
+// when they are not needed, in which case they live in the handle's workspace. info is a device
+// array holding, for each batch, 0 or the index i of the first exactly zero pivot U(i, i), in which
+// case that batch's B is not a solution. Systems with n <= 32 are factored and solved by a single
+// kernel that keeps each matrix in shared memory; larger ones run getrf and then getrs, which on
+// the cuBLAS backend needs strideP == n when ipiv is given
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgesvBatched(hipblasHandle_t handle,
+                                                   const int       n,
+                                                   const int       nrhs,
+                                                   float* const    A[],
+                                                   const int       lda,
+                                                   int*            ipiv,
+                                                   const int       strideP,
+                                                   float* const    B[],
+                                                   const int       ldb,
+                                                   int*            info,
+                                                   const int       batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgesvBatched(hipblasHandle_t handle,
+                                                   const int       n,
+                                                   const int       nrhs,
+                                                   double* const   A[],
+                                                   const int       lda,
+                                                   int*            ipiv,
+                                                   const int       strideP,
+                                                   double* const   B[],
+                                                   const int       ldb,
+                                                   int*            info,
+                                                   const int       batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgesvBatched(hipblasHandle_t       handle,
+                                                   const int             n,
+                                                   const int             nrhs,
+                                                   hipblasComplex* const A[],
+                                                   const int             lda,
+                                                   int*                  ipiv,
+                                                   const int             strideP,
+                                                   hipblasComplex* const B[],
+                                                   const int             ldb,
+                                                   int*                  info,
+                                                   const int             batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgesvBatched(hipblasHandle_t             handle,
+                                                   const int                   n,
+                                                   const int                   nrhs,
+                                                   hipblasDoubleComplex* const A[],
+                                                   const int                   lda,
+                                                   int*                        ipiv,
+                                                   const int                   strideP,
+                                                   hipblasDoubleComplex* const B[],
+                                                   const int                   ldb,
+                                                   int*                        info,
+                                                   const int                   batch_count);
+
+// gesv_strided_batched
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgesvStridedBatched(hipblasHandle_t handle,
+                                                          const int       n,
+                                                          const int       nrhs,
+                                                          float*          A,
+                                                          const int       lda,
+                                                          const int       strideA,
+                                                          int*            ipiv,
+                                                          const int       strideP,
+                                                          float*          B,
+                                                          const int       ldb,
+                                                          const int       strideB,
+                                                          int*            info,
+                                                          const int       batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgesvStridedBatched(hipblasHandle_t handle,
+                                                          const int       n,
+                                                          const int       nrhs,
+                                                          double*         A,
+                                                          const int       lda,
+                                                          const int       strideA,
+                                                          int*            ipiv,
+                                                          const int       strideP,
+                                                          double*         B,
+                                                          const int       ldb,
+                                                          const int       strideB,
+                                                          int*            info,
+                                                          const int       batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgesvStridedBatched(hipblasHandle_t handle,
+                                                          const int       n,
+                                                          const int       nrhs,
+                                                          hipblasComplex* A,
+                                                          const int       lda,
+                                                          const int       strideA,
+                                                          int*            ipiv,
+                                                          const int       strideP,
+                                                          hipblasComplex* B,
+                                                          const int       ldb,
+                                                          const int       strideB,
+                                                          int*            info,
+                                                          const int       batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgesvStridedBatched(hipblasHandle_t       handle,
+                                                          const int             n,
+                                                          const int             nrhs,
+                                                          hipblasDoubleComplex* A,
+                                                          const int             lda,
+                                                          const int             strideA,
+                                                          int*                  ipiv,
+                                                          const int             strideP,
+                                                          hipblasDoubleComplex* B,
+                                                          const int             ldb,
+                                                          const int             strideB,
+                                                          int*                  info,
+                                                          const int             batch_count);
+
+// gesv with iterative refinement
+// Solves A X = B like gesv, factoring in single precision and refining X in double precision
+// with residuals B - A X until every column has max |R(i, j)| <= max |X(i, j)| * ||A||_inf *
+// eps * sqrt(n), as LAPACK's dsgesv and zcgesv do; A and B are left as they were. iter and info
+// are device arrays with one entry per batch. iter[b] >= 0 is the number of refinement steps
+// batch b took, while a negative iter[b] says the call solved it in double precision after all,
+// leaving A with its double-precision factors: -2 when A or a residual overflowed single
+// precision, -3 when the single-precision factors had a zero pivot, -31 when 30 steps did not
+// converge, and -1 when another batch of the call fell back, which takes the whole batch with it.
+// info[b] is 0, or the index of the first zero pivot of the double-precision factors. ipiv and
+// strideP are as for getrfBatched. Each step reads the convergence state back to the host, so the
+// call synchronizes with the handle's stream and is refused in capture-safe mode
+HIPBLAS_EXPORT hipblasStatus_t hipblasDSgesv(hipblasHandle_t handle,
+                                             const int       n,
+                                             const int       nrhs,
+                                             double*         A,
+                                             const int       lda,
+                                             int*            ipiv,
+                                             const double*   B,
+                                             const int       ldb,
+                                             double*         X,
+                                             const int       ldx,
+                                             int*            iter,
+                                             int*            info);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZCgesv(hipblasHandle_t             handle,
+                                             const int                   n,
+                                             const int                   nrhs,
+                                             hipblasDoubleComplex*       A,
+                                             const int                   lda,
+                                             int*                        ipiv,
+                                             const hipblasDoubleComplex* B,
+                                             const int                   ldb,
+                                             hipblasDoubleComplex*       X,
+                                             const int                   ldx,
+                                             int*                        iter,
+                                             int*                        info);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDSgesvBatched(hipblasHandle_t     handle,
+                                                    const int           n,
+                                                    const int           nrhs,
+                                                    double* const       A[],
+                                                    const int           lda,
+                                                    int*                ipiv,
+                                                    const int           strideP,
+                                                    const double* const B[],
+                                                    const int           ldb,
+                                                    double* const       X[],
+                                                    const int           ldx,
+                                                    int*                iter,
+                                                    int*                info,
+                                                    const int           batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZCgesvBatched(hipblasHandle_t                   handle,
+                                                    const int                         n,
+                                                    const int                         nrhs,
+                                                    hipblasDoubleComplex* const       A[],
+                                                    const int                         lda,
+                                                    int*                              ipiv,
+                                                    const int                         strideP,
+                                                    const hipblasDoubleComplex* const B[],
+                                                    const int                         ldb,
+                                                    hipblasDoubleComplex* const       X[],
+                                                    const int                         ldx,
+                                                    int*                              iter,
+                                                    int*                              info,
+                                                    const int                         batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDSgesvStridedBatched(hipblasHandle_t handle,
+                                                           const int       n,
+                                                           const int       nrhs,
+                                                           double*         A,
+                                                           const int       lda,
+                                                           const int       strideA,
+                                                           int*            ipiv,
+                                                           const int       strideP,
+                                                           const double*   B,
+                                                           const int       ldb,
+                                                           const int       strideB,
+                                                           double*         X,
+                                                           const int       ldx,
+                                                           const int       strideX,
+                                                           int*            iter,
+                                                           int*            info,
+                                                           const int       batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZCgesvStridedBatched(hipblasHandle_t             handle,
+                                                           const int                   n,
+                                                           const int                   nrhs,
+                                                           hipblasDoubleComplex*       A,
+                                                           const int                   lda,
+                                                           const int                   strideA,
+                                                           int*                        ipiv,
+                                                           const int                   strideP,
+                                                           const hipblasDoubleComplex* B,
+                                                           const int                   ldb,
+                                                           const int                   strideB,
+                                                           hipblasDoubleComplex*       X,
+                                                           const int                   ldx,
+                                                           const int                   strideX,
+                                                           int*                        iter,
+                                                           int*                        info,
+                                                           const int                   batch_count);
+
+// geqrf
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgeqrf(hipblasHandle_t handle,
+                                             const int       m,
+                                             const int       n,
+                                             float*          A,
+                                             const int       lda,
+                                             float*          ipiv,
+                                             int*            info);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgeqrf(hipblasHandle_t handle,
+                                             const int       m,
+                                             const int       n,
+                                             double*         A,
+                                             const int       lda,
+                                             double*         ipiv,
+                                             int*            info);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgeqrf(hipblasHandle_t handle,
+                                             const int       m,
+                                             const int       n,
+                                             hipblasComplex* A,
+                                             const int       lda,
+                                             hipblasComplex* ipiv,
+                                             int*            info);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgeqrf(hipblasHandle_t       handle,
+                                             const int             m,
+                                             const int             n,
+                                             hipblasDoubleComplex* A,
+                                             const int             lda,
+                                             hipblasDoubleComplex* ipiv,
+                                             int*                  info);
+
+// geqrf_batched
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgeqrfBatched(hipblasHandle_t handle,
+                                                    const int       m,
+                                                    const int       n,
+                                                    float* const    A[],
+                                                    const int       lda,
+                                                    float* const    ipiv[],
+                                                    int*            info,
+                                                    const int       batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgeqrfBatched(hipblasHandle_t handle,
+                                                    const int       m,
+                                                    const int       n,
+                                                    double* const   A[],
+                                                    const int       lda,
+                                                    double* const   ipiv[],
+                                                    int*            info,
+                                                    const int       batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgeqrfBatched(hipblasHandle_t       handle,
+                                                    const int             m,
+                                                    const int             n,
+                                                    hipblasComplex* const A[],
+                                                    const int             lda,
+                                                    hipblasComplex* const ipiv[],
+                                                    int*                  info,
+                                                    const int             batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgeqrfBatched(hipblasHandle_t             handle,
+                                                    const int                   m,
                                                     const int                   n,
                                                     hipblasDoubleComplex* const A[],
                                                     const int                   lda,
@@ -5717,70 +8922,1684 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZgeqrfStridedBatched(hipblasHandle_t
                                                            int*                  info,
                                                            const int             batch_count);
 
-// gemm
-HIPBLAS_EXPORT hipblasStatus_t hipblasHgemm(hipblasHandle_t    handle,
-                                            hipblasOperation_t transa,
-                                            hipblasOperation_t transb,
-                                            int                m,
-                                            int                n,
-                                            int                k,
-                                            const hipblasHalf* alpha,
-                                            const hipblasHalf* A,
-                                            int                lda,
-                                            const hipblasHalf* B,
-                                            int                ldb,
-                                            const hipblasHalf* beta,
-                                            hipblasHalf*       C,
-                                            int                ldc);
+// ormqr / unmqr: apply the Q of a geqrf factorization to C without forming it
+HIPBLAS_EXPORT hipblasStatus_t hipblasSormqr(hipblasHandle_t          handle,
+                                             const hipblasSideMode_t  side,
+                                             const hipblasOperation_t trans,
+                                             const int                m,
+                                             const int                n,
+                                             const int                k,
+                                             float*                   A,
+                                             const int                lda,
+                                             float*                   tau,
+                                             float*                   C,
+                                             const int                ldc,
+                                             int*                     info);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasSgemm(hipblasHandle_t    handle,
-                                            hipblasOperation_t transa,
-                                            hipblasOperation_t transb,
-                                            int                m,
-                                            int                n,
-                                            int                k,
-                                            const float*       alpha,
-                                            const float*       A,
-                                            int                lda,
-                                            const float*       B,
-                                            int                ldb,
-                                            const float*       beta,
-                                            float*             C,
-                                            int                ldc);
+HIPBLAS_EXPORT hipblasStatus_t hipblasDormqr(hipblasHandle_t          handle,
+                                             const hipblasSideMode_t  side,
+                                             const hipblasOperation_t trans,
+                                             const int                m,
+                                             const int                n,
+                                             const int                k,
+                                             double*                  A,
+                                             const int                lda,
+                                             double*                  tau,
+                                             double*                  C,
+                                             const int                ldc,
+                                             int*                     info);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasDgemm(hipblasHandle_t    handle,
-                                            hipblasOperation_t transa,
-                                            hipblasOperation_t transb,
-                                            int                m,
-                                            int                n,
-                                            int                k,
-                                            const double*      alpha,
-                                            const double*      A,
-                                            int                lda,
-                                            const double*      B,
-                                            int                ldb,
-                                            const double*      beta,
-                                            double*            C,
-                                            int                ldc);
+HIPBLAS_EXPORT hipblasStatus_t hipblasCunmqr(hipblasHandle_t          handle,
+                                             const hipblasSideMode_t  side,
+                                             const hipblasOperation_t trans,
+                                             const int                m,
+                                             const int                n,
+                                             const int                k,
+                                             hipblasComplex*          A,
+                                             const int                lda,
+                                             hipblasComplex*          tau,
+                                             hipblasComplex*          C,
+                                             const int                ldc,
+                                             int*                     info);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasCgemm(hipblasHandle_t       handle,
-                                            hipblasOperation_t    transa,
-                                            hipblasOperation_t    transb,
+HIPBLAS_EXPORT hipblasStatus_t hipblasZunmqr(hipblasHandle_t          handle,
+                                             const hipblasSideMode_t  side,
+                                             const hipblasOperation_t trans,
+                                             const int                m,
+                                             const int                n,
+                                             const int                k,
+                                             hipblasDoubleComplex*    A,
+                                             const int                lda,
+                                             hipblasDoubleComplex*    tau,
+                                             hipblasDoubleComplex*    C,
+                                             const int                ldc,
+                                             int*                     info);
+
+// orgqr / ungqr: form the first n columns of the Q of a geqrf factorization
+HIPBLAS_EXPORT hipblasStatus_t hipblasSorgqr(hipblasHandle_t handle,
+                                             const int       m,
+                                             const int       n,
+                                             const int       k,
+                                             float*          A,
+                                             const int       lda,
+                                             float*          tau,
+                                             int*            info);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDorgqr(hipblasHandle_t handle,
+                                             const int       m,
+                                             const int       n,
+                                             const int       k,
+                                             double*         A,
+                                             const int       lda,
+                                             double*         tau,
+                                             int*            info);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCungqr(hipblasHandle_t handle,
+                                             const int       m,
+                                             const int       n,
+                                             const int       k,
+                                             hipblasComplex* A,
+                                             const int       lda,
+                                             hipblasComplex* tau,
+                                             int*            info);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZungqr(hipblasHandle_t       handle,
+                                             const int             m,
+                                             const int             n,
+                                             const int             k,
+                                             hipblasDoubleComplex* A,
+                                             const int             lda,
+                                             hipblasDoubleComplex* tau,
+                                             int*                  info);
+
+// tsqr: A = Q R for a tall-skinny m x n A, m >= n, with Q written over A and the n x n upper
+// triangular R, its lower triangle zeroed, to R. CholeskyQR2 attains Householder's orthogonality
+// for A of condition number up to about 1 / sqrt(eps) and falls back to Householder beyond, where
+// potrf of the Gram matrix breaks down. An A near that bound, whose Gram matrix only just factors,
+// may leave Q short of full orthogonality, and HIPBLAS_TSQR_HOUSEHOLDER is the safe choice there
+HIPBLAS_EXPORT hipblasStatus_t hipblasStsqr(hipblasHandle_t   handle,
+                                            hipblasTsqrAlgo_t algo,
+                                            int               m,
+                                            int               n,
+                                            float*            A,
+                                            int               lda,
+                                            float*            R,
+                                            int               ldr);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtsqr(hipblasHandle_t   handle,
+                                            hipblasTsqrAlgo_t algo,
+                                            int               m,
+                                            int               n,
+                                            double*           A,
+                                            int               lda,
+                                            double*           R,
+                                            int               ldr);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtsqr(hipblasHandle_t   handle,
+                                            hipblasTsqrAlgo_t algo,
+                                            int               m,
+                                            int               n,
+                                            hipblasComplex*   A,
+                                            int               lda,
+                                            hipblasComplex*   R,
+                                            int               ldr);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtsqr(hipblasHandle_t       handle,
+                                            hipblasTsqrAlgo_t     algo,
                                             int                   m,
                                             int                   n,
-                                            int                   k,
-                                            const hipblasComplex* alpha,
-                                            const hipblasComplex* A,
+                                            hipblasDoubleComplex* A,
                                             int                   lda,
-                                            const hipblasComplex* B,
-                                            int                   ldb,
-                                            const hipblasComplex* beta,
-                                            hipblasComplex*       C,
-                                            int                   ldc);
-
-HIPBLAS_EXPORT hipblasStatus_t hipblasZgemm(hipblasHandle_t             handle,
-                                            hipblasOperation_t          transa,
-                                            hipblasOperation_t          transb,
+                                            hipblasDoubleComplex* R,
+                                            int                   ldr);
+
+// gels_batched: least squares or minimum norm solutions of op(A) X = B through a QR or LQ
+// factorization of each A; B of ldb >= max(m, n) is overwritten by X
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgelsBatched(hipblasHandle_t          handle,
+                                                   const hipblasOperation_t trans,
+                                                   const int                m,
+                                                   const int                n,
+                                                   const int                nrhs,
+                                                   float* const             A[],
+                                                   const int                lda,
+                                                   float* const             B[],
+                                                   const int                ldb,
+                                                   int*                     info,
+                                                   int*                     deviceInfo,
+                                                   const int                batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgelsBatched(hipblasHandle_t          handle,
+                                                   const hipblasOperation_t trans,
+                                                   const int                m,
+                                                   const int                n,
+                                                   const int                nrhs,
+                                                   double* const            A[],
+                                                   const int                lda,
+                                                   double* const            B[],
+                                                   const int                ldb,
+                                                   int*                     info,
+                                                   int*                     deviceInfo,
+                                                   const int                batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgelsBatched(hipblasHandle_t          handle,
+                                                   const hipblasOperation_t trans,
+                                                   const int                m,
+                                                   const int                n,
+                                                   const int                nrhs,
+                                                   hipblasComplex* const    A[],
+                                                   const int                lda,
+                                                   hipblasComplex* const    B[],
+                                                   const int                ldb,
+                                                   int*                     info,
+                                                   int*                     deviceInfo,
+                                                   const int                batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgelsBatched(hipblasHandle_t             handle,
+                                                   const hipblasOperation_t    trans,
+                                                   const int                   m,
+                                                   const int                   n,
+                                                   const int                   nrhs,
+                                                   hipblasDoubleComplex* const A[],
+                                                   const int                   lda,
+                                                   hipblasDoubleComplex* const B[],
+                                                   const int                   ldb,
+                                                   int*                        info,
+                                                   int*                        deviceInfo,
+                                                   const int                   batch_count);
+
+// gels_strided_batched
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgelsStridedBatched(hipblasHandle_t          handle,
+                                                          const hipblasOperation_t trans,
+                                                          const int                m,
+                                                          const int                n,
+                                                          const int                nrhs,
+                                                          float*                   A,
+                                                          const int                lda,
+                                                          const int                strideA,
+                                                          float*                   B,
+                                                          const int                ldb,
+                                                          const int                strideB,
+                                                          int*                     info,
+                                                          int*                     deviceInfo,
+                                                          const int                batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgelsStridedBatched(hipblasHandle_t          handle,
+                                                          const hipblasOperation_t trans,
+                                                          const int                m,
+                                                          const int                n,
+                                                          const int                nrhs,
+                                                          double*                  A,
+                                                          const int                lda,
+                                                          const int                strideA,
+                                                          double*                  B,
+                                                          const int                ldb,
+                                                          const int                strideB,
+                                                          int*                     info,
+                                                          int*                     deviceInfo,
+                                                          const int                batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgelsStridedBatched(hipblasHandle_t          handle,
+                                                          const hipblasOperation_t trans,
+                                                          const int                m,
+                                                          const int                n,
+                                                          const int                nrhs,
+                                                          hipblasComplex*          A,
+                                                          const int                lda,
+                                                          const int                strideA,
+                                                          hipblasComplex*          B,
+                                                          const int                ldb,
+                                                          const int                strideB,
+                                                          int*                     info,
+                                                          int*                     deviceInfo,
+                                                          const int                batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgelsStridedBatched(hipblasHandle_t          handle,
+                                                          const hipblasOperation_t trans,
+                                                          const int                m,
+                                                          const int                n,
+                                                          const int                nrhs,
+                                                          hipblasDoubleComplex*    A,
+                                                          const int                lda,
+                                                          const int                strideA,
+                                                          hipblasDoubleComplex*    B,
+                                                          const int                ldb,
+                                                          const int                strideB,
+                                                          int*                     info,
+                                                          int*                     deviceInfo,
+                                                          const int                batch_count);
+
+// syevj_batched / heevj_batched: eigenvalues, and optionally eigenvectors, of each
+// Hermitian matrix by Jacobi sweeps; W holds them in ascending order, and the sweeps stop
+// once the off-diagonal norm is at most abstol (machine epsilon when abstol <= 0) times
+// the norm of A, or after max_sweeps with info[b] = 1
+HIPBLAS_EXPORT hipblasStatus_t hipblasSsyevjBatched(hipblasHandle_t         handle,
+                                                    const hipblasEvect_t    evect,
+                                                    const hipblasFillMode_t uplo,
+                                                    const int               n,
+                                                    float* const            A[],
+                                                    const int               lda,
+                                                    const float             abstol,
+                                                    float*                  residual,
+                                                    const int               max_sweeps,
+                                                    int*                    n_sweeps,
+                                                    float*                  W,
+                                                    const int               strideW,
+                                                    int*                    info,
+                                                    const int               batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDsyevjBatched(hipblasHandle_t         handle,
+                                                    const hipblasEvect_t    evect,
+                                                    const hipblasFillMode_t uplo,
+                                                    const int               n,
+                                                    double* const           A[],
+                                                    const int               lda,
+                                                    const double            abstol,
+                                                    double*                 residual,
+                                                    const int               max_sweeps,
+                                                    int*                    n_sweeps,
+                                                    double*                 W,
+                                                    const int               strideW,
+                                                    int*                    info,
+                                                    const int               batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCheevjBatched(hipblasHandle_t         handle,
+                                                    const hipblasEvect_t    evect,
+                                                    const hipblasFillMode_t uplo,
+                                                    const int               n,
+                                                    hipblasComplex* const   A[],
+                                                    const int               lda,
+                                                    const float             abstol,
+                                                    float*                  residual,
+                                                    const int               max_sweeps,
+                                                    int*                    n_sweeps,
+                                                    float*                  W,
+                                                    const int               strideW,
+                                                    int*                    info,
+                                                    const int               batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZheevjBatched(hipblasHandle_t             handle,
+                                                    const hipblasEvect_t        evect,
+                                                    const hipblasFillMode_t     uplo,
+                                                    const int                   n,
+                                                    hipblasDoubleComplex* const A[],
+                                                    const int                   lda,
+                                                    const double                abstol,
+                                                    double*                     residual,
+                                                    const int                   max_sweeps,
+                                                    int*                        n_sweeps,
+                                                    double*                     W,
+                                                    const int                   strideW,
+                                                    int*                        info,
+                                                    const int                   batch_count);
+
+// syevj_strided_batched / heevj_strided_batched
+HIPBLAS_EXPORT hipblasStatus_t hipblasSsyevjStridedBatched(hipblasHandle_t         handle,
+                                                           const hipblasEvect_t    evect,
+                                                           const hipblasFillMode_t uplo,
+                                                           const int               n,
+                                                           float*                  A,
+                                                           const int               lda,
+                                                           const int               strideA,
+                                                           const float             abstol,
+                                                           float*                  residual,
+                                                           const int               max_sweeps,
+                                                           int*                    n_sweeps,
+                                                           float*                  W,
+                                                           const int               strideW,
+                                                           int*                    info,
+                                                           const int               batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDsyevjStridedBatched(hipblasHandle_t         handle,
+                                                           const hipblasEvect_t    evect,
+                                                           const hipblasFillMode_t uplo,
+                                                           const int               n,
+                                                           double*                 A,
+                                                           const int               lda,
+                                                           const int               strideA,
+                                                           const double            abstol,
+                                                           double*                 residual,
+                                                           const int               max_sweeps,
+                                                           int*                    n_sweeps,
+                                                           double*                 W,
+                                                           const int               strideW,
+                                                           int*                    info,
+                                                           const int               batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCheevjStridedBatched(hipblasHandle_t         handle,
+                                                           const hipblasEvect_t    evect,
+                                                           const hipblasFillMode_t uplo,
+                                                           const int               n,
+                                                           hipblasComplex*         A,
+                                                           const int               lda,
+                                                           const int               strideA,
+                                                           const float             abstol,
+                                                           float*                  residual,
+                                                           const int               max_sweeps,
+                                                           int*                    n_sweeps,
+                                                           float*                  W,
+                                                           const int               strideW,
+                                                           int*                    info,
+                                                           const int               batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZheevjStridedBatched(hipblasHandle_t         handle,
+                                                           const hipblasEvect_t    evect,
+                                                           const hipblasFillMode_t uplo,
+                                                           const int               n,
+                                                           hipblasDoubleComplex*   A,
+                                                           const int               lda,
+                                                           const int               strideA,
+                                                           const double            abstol,
+                                                           double*                 residual,
+                                                           const int               max_sweeps,
+                                                           int*                    n_sweeps,
+                                                           double*                 W,
+                                                           const int               strideW,
+                                                           int*                    info,
+                                                           const int               batch_count);
+
+// gesvdj_batched: singular values, and optionally singular vectors, of each m x n matrix by
+// one-sided Jacobi sweeps, which overwrite A. S holds the min(m, n) singular values in descending
+// order; with left_svect HIPBLAS_SVECT_SINGULAR the columns of U (ldu >= m) are the matching left
+// singular vectors, and with right_svect HIPBLAS_SVECT_SINGULAR the rows of V (ldv >= min(m, n))
+// hold V^H. The sweeps stop once the off-diagonal Frobenius norm of A^H A is at most abstol
+// (machine epsilon when abstol <= 0) times the squared norm of A, or after max_sweeps with
+// info[b] = 1
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgesvdjBatched(hipblasHandle_t      handle,
+                                                     const hipblasSvect_t left_svect,
+                                                     const hipblasSvect_t right_svect,
+                                                     const int            m,
+                                                     const int            n,
+                                                     float* const         A[],
+                                                     const int            lda,
+                                                     const float          abstol,
+                                                     float*               residual,
+                                                     const int            max_sweeps,
+                                                     int*                 n_sweeps,
+                                                     float*               S,
+                                                     const int            strideS,
+                                                     float*               U,
+                                                     const int            ldu,
+                                                     const int            strideU,
+                                                     float*               V,
+                                                     const int            ldv,
+                                                     const int            strideV,
+                                                     int*                 info,
+                                                     const int            batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgesvdjBatched(hipblasHandle_t      handle,
+                                                     const hipblasSvect_t left_svect,
+                                                     const hipblasSvect_t right_svect,
+                                                     const int            m,
+                                                     const int            n,
+                                                     double* const        A[],
+                                                     const int            lda,
+                                                     const double         abstol,
+                                                     double*              residual,
+                                                     const int            max_sweeps,
+                                                     int*                 n_sweeps,
+                                                     double*              S,
+                                                     const int            strideS,
+                                                     double*              U,
+                                                     const int            ldu,
+                                                     const int            strideU,
+                                                     double*              V,
+                                                     const int            ldv,
+                                                     const int            strideV,
+                                                     int*                 info,
+                                                     const int            batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgesvdjBatched(hipblasHandle_t       handle,
+                                                     const hipblasSvect_t  left_svect,
+                                                     const hipblasSvect_t  right_svect,
+                                                     const int             m,
+                                                     const int             n,
+                                                     hipblasComplex* const A[],
+                                                     const int             lda,
+                                                     const float           abstol,
+                                                     float*                residual,
+                                                     const int             max_sweeps,
+                                                     int*                  n_sweeps,
+                                                     float*                S,
+                                                     const int             strideS,
+                                                     hipblasComplex*       U,
+                                                     const int             ldu,
+                                                     const int             strideU,
+                                                     hipblasComplex*       V,
+                                                     const int             ldv,
+                                                     const int             strideV,
+                                                     int*                  info,
+                                                     const int             batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgesvdjBatched(hipblasHandle_t             handle,
+                                                     const hipblasSvect_t        left_svect,
+                                                     const hipblasSvect_t        right_svect,
+                                                     const int                   m,
+                                                     const int                   n,
+                                                     hipblasDoubleComplex* const A[],
+                                                     const int                   lda,
+                                                     const double                abstol,
+                                                     double*                     residual,
+                                                     const int                   max_sweeps,
+                                                     int*                        n_sweeps,
+                                                     double*                     S,
+                                                     const int                   strideS,
+                                                     hipblasDoubleComplex*       U,
+                                                     const int                   ldu,
+                                                     const int                   strideU,
+                                                     hipblasDoubleComplex*       V,
+                                                     const int                   ldv,
+                                                     const int                   strideV,
+                                                     int*                        info,
+                                                     const int                   batch_count);
+
+// gesvdj_strided_batched
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgesvdjStridedBatched(hipblasHandle_t      handle,
+                                                            const hipblasSvect_t left_svect,
+                                                            const hipblasSvect_t right_svect,
+                                                            const int            m,
+                                                            const int            n,
+                                                            float*               A,
+                                                            const int            lda,
+                                                            const int            strideA,
+                                                            const float          abstol,
+                                                            float*               residual,
+                                                            const int            max_sweeps,
+                                                            int*                 n_sweeps,
+                                                            float*               S,
+                                                            const int            strideS,
+                                                            float*               U,
+                                                            const int            ldu,
+                                                            const int            strideU,
+                                                            float*               V,
+                                                            const int            ldv,
+                                                            const int            strideV,
+                                                            int*                 info,
+                                                            const int            batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgesvdjStridedBatched(hipblasHandle_t      handle,
+                                                            const hipblasSvect_t left_svect,
+                                                            const hipblasSvect_t right_svect,
+                                                            const int            m,
+                                                            const int            n,
+                                                            double*              A,
+                                                            const int            lda,
+                                                            const int            strideA,
+                                                            const double         abstol,
+                                                            double*              residual,
+                                                            const int            max_sweeps,
+                                                            int*                 n_sweeps,
+                                                            double*              S,
+                                                            const int            strideS,
+                                                            double*              U,
+                                                            const int            ldu,
+                                                            const int            strideU,
+                                                            double*              V,
+                                                            const int            ldv,
+                                                            const int            strideV,
+                                                            int*                 info,
+                                                            const int            batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgesvdjStridedBatched(hipblasHandle_t      handle,
+                                                            const hipblasSvect_t left_svect,
+                                                            const hipblasSvect_t right_svect,
+                                                            const int            m,
+                                                            const int            n,
+                                                            hipblasComplex*      A,
+                                                            const int            lda,
+                                                            const int            strideA,
+                                                            const float          abstol,
+                                                            float*               residual,
+                                                            const int            max_sweeps,
+                                                            int*                 n_sweeps,
+                                                            float*               S,
+                                                            const int            strideS,
+                                                            hipblasComplex*      U,
+                                                            const int            ldu,
+                                                            const int            strideU,
+                                                            hipblasComplex*      V,
+                                                            const int            ldv,
+                                                            const int            strideV,
+                                                            int*                 info,
+                                                            const int            batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgesvdjStridedBatched(hipblasHandle_t       handle,
+                                                            const hipblasSvect_t  left_svect,
+                                                            const hipblasSvect_t  right_svect,
+                                                            const int             m,
+                                                            const int             n,
+                                                            hipblasDoubleComplex* A,
+                                                            const int             lda,
+                                                            const int             strideA,
+                                                            const double          abstol,
+                                                            double*               residual,
+                                                            const int             max_sweeps,
+                                                            int*                  n_sweeps,
+                                                            double*               S,
+                                                            const int             strideS,
+                                                            hipblasDoubleComplex* U,
+                                                            const int             ldu,
+                                                            const int             strideU,
+                                                            hipblasDoubleComplex* V,
+                                                            const int             ldv,
+                                                            const int             strideV,
+                                                            int*                  info,
+                                                            const int             batch_count);
+
+// sytrf_batched: Bunch-Kaufman factorization A = U D U^T or L D L^T of each n x n symmetric
+// matrix stored in the uplo triangle of A, with D block diagonal in 1 x 1 and 2 x 2 blocks. ipiv
+// holds LAPACK's pivots, negative for 2 x 2 blocks, and info[b] = i when D(i, i) is exactly zero
+HIPBLAS_EXPORT hipblasStatus_t hipblasSsytrfBatched(hipblasHandle_t         handle,
+                                                    const hipblasFillMode_t uplo,
+                                                    const int               n,
+                                                    float* const            A[],
+                                                    const int               lda,
+                                                    int*                    ipiv,
+                                                    const int               strideP,
+                                                    int*                    info,
+                                                    const int               batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDsytrfBatched(hipblasHandle_t         handle,
+                                                    const hipblasFillMode_t uplo,
+                                                    const int               n,
+                                                    double* const           A[],
+                                                    const int               lda,
+                                                    int*                    ipiv,
+                                                    const int               strideP,
+                                                    int*                    info,
+                                                    const int               batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsytrfBatched(hipblasHandle_t         handle,
+                                                    const hipblasFillMode_t uplo,
+                                                    const int               n,
+                                                    hipblasComplex* const   A[],
+                                                    const int               lda,
+                                                    int*                    ipiv,
+                                                    const int               strideP,
+                                                    int*                    info,
+                                                    const int               batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZsytrfBatched(hipblasHandle_t             handle,
+                                                    const hipblasFillMode_t     uplo,
+                                                    const int                   n,
+                                                    hipblasDoubleComplex* const A[],
+                                                    const int                   lda,
+                                                    int*                        ipiv,
+                                                    const int                   strideP,
+                                                    int*                        info,
+                                                    const int                   batch_count);
+
+// sytrf_strided_batched
+HIPBLAS_EXPORT hipblasStatus_t hipblasSsytrfStridedBatched(hipblasHandle_t         handle,
+                                                           const hipblasFillMode_t uplo,
+                                                           const int               n,
+                                                           float*                  A,
+                                                           const int               lda,
+                                                           const int               strideA,
+                                                           int*                    ipiv,
+                                                           const int               strideP,
+                                                           int*                    info,
+                                                           const int               batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDsytrfStridedBatched(hipblasHandle_t         handle,
+                                                           const hipblasFillMode_t uplo,
+                                                           const int               n,
+                                                           double*                 A,
+                                                           const int               lda,
+                                                           const int               strideA,
+                                                           int*                    ipiv,
+                                                           const int               strideP,
+                                                           int*                    info,
+                                                           const int               batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsytrfStridedBatched(hipblasHandle_t         handle,
+                                                           const hipblasFillMode_t uplo,
+                                                           const int               n,
+                                                           hipblasComplex*         A,
+                                                           const int               lda,
+                                                           const int               strideA,
+                                                           int*                    ipiv,
+                                                           const int               strideP,
+                                                           int*                    info,
+                                                           const int               batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZsytrfStridedBatched(hipblasHandle_t         handle,
+                                                           const hipblasFillMode_t uplo,
+                                                           const int               n,
+                                                           hipblasDoubleComplex*   A,
+                                                           const int               lda,
+                                                           const int               strideA,
+                                                           int*                    ipiv,
+                                                           const int               strideP,
+                                                           int*                    info,
+                                                           const int               batch_count);
+
+// sytrs_batched: solve A X = B for each system from the factors and pivots of sytrf_batched,
+// overwriting B with X. info is a host pointer set to the first invalid argument, as for getrs
+HIPBLAS_EXPORT hipblasStatus_t hipblasSsytrsBatched(hipblasHandle_t         handle,
+                                                    const hipblasFillMode_t uplo,
+                                                    const int               n,
+                                                    const int               nrhs,
+                                                    float* const            A[],
+                                                    const int               lda,
+                                                    const int*              ipiv,
+                                                    const int               strideP,
+                                                    float* const            B[],
+                                                    const int               ldb,
+                                                    int*                    info,
+                                                    const int               batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDsytrsBatched(hipblasHandle_t         handle,
+                                                    const hipblasFillMode_t uplo,
+                                                    const int               n,
+                                                    const int               nrhs,
+                                                    double* const           A[],
+                                                    const int               lda,
+                                                    const int*              ipiv,
+                                                    const int               strideP,
+                                                    double* const           B[],
+                                                    const int               ldb,
+                                                    int*                    info,
+                                                    const int               batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsytrsBatched(hipblasHandle_t         handle,
+                                                    const hipblasFillMode_t uplo,
+                                                    const int               n,
+                                                    const int               nrhs,
+                                                    hipblasComplex* const   A[],
+                                                    const int               lda,
+                                                    const int*              ipiv,
+                                                    const int               strideP,
+                                                    hipblasComplex* const   B[],
+                                                    const int               ldb,
+                                                    int*                    info,
+                                                    const int               batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZsytrsBatched(hipblasHandle_t             handle,
+                                                    const hipblasFillMode_t     uplo,
+                                                    const int                   n,
+                                                    const int                   nrhs,
+                                                    hipblasDoubleComplex* const A[],
+                                                    const int                   lda,
+                                                    const int*                  ipiv,
+                                                    const int                   strideP,
+                                                    hipblasDoubleComplex* const B[],
+                                                    const int                   ldb,
+                                                    int*                        info,
+                                                    const int                   batch_count);
+
+// sytrs_strided_batched
+HIPBLAS_EXPORT hipblasStatus_t hipblasSsytrsStridedBatched(hipblasHandle_t         handle,
+                                                           const hipblasFillMode_t uplo,
+                                                           const int               n,
+                                                           const int               nrhs,
+                                                           float*                  A,
+                                                           const int               lda,
+                                                           const int               strideA,
+                                                           const int*              ipiv,
+                                                           const int               strideP,
+                                                           float*                  B,
+                                                           const int               ldb,
+                                                           const int               strideB,
+                                                           int*                    info,
+                                                           const int               batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDsytrsStridedBatched(hipblasHandle_t         handle,
+                                                           const hipblasFillMode_t uplo,
+                                                           const int               n,
+                                                           const int               nrhs,
+                                                           double*                 A,
+                                                           const int               lda,
+                                                           const int               strideA,
+                                                           const int*              ipiv,
+                                                           const int               strideP,
+                                                           double*                 B,
+                                                           const int               ldb,
+                                                           const int               strideB,
+                                                           int*                    info,
+                                                           const int               batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsytrsStridedBatched(hipblasHandle_t         handle,
+                                                           const hipblasFillMode_t uplo,
+                                                           const int               n,
+                                                           const int               nrhs,
+                                                           hipblasComplex*         A,
+                                                           const int               lda,
+                                                           const int               strideA,
+                                                           const int*              ipiv,
+                                                           const int               strideP,
+                                                           hipblasComplex*         B,
+                                                           const int               ldb,
+                                                           const int               strideB,
+                                                           int*                    info,
+                                                           const int               batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZsytrsStridedBatched(hipblasHandle_t         handle,
+                                                           const hipblasFillMode_t uplo,
+                                                           const int               n,
+                                                           const int               nrhs,
+                                                           hipblasDoubleComplex*   A,
+                                                           const int               lda,
+                                                           const int               strideA,
+                                                           const int*              ipiv,
+                                                           const int               strideP,
+                                                           hipblasDoubleComplex*   B,
+                                                           const int               ldb,
+                                                           const int               strideB,
+                                                           int*                    info,
+                                                           const int               batch_count);
+
+// gtsv_strided_batched: solve batch_count tridiagonal systems without pivoting, each m x m with
+// subdiagonal dl, diagonal d and superdiagonal du, overwriting the right-hand side x with the
+// solution. The four arrays of batch b start at b * stride; dl[0] and du[m - 1] are not read
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgtsvStridedBatched(hipblasHandle_t handle,
+                                                          const int       m,
+                                                          const float*    dl,
+                                                          const float*    d,
+                                                          const float*    du,
+                                                          float*          x,
+                                                          const int       stride,
+                                                          const int       batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgtsvStridedBatched(hipblasHandle_t handle,
+                                                          const int       m,
+                                                          const double*   dl,
+                                                          const double*   d,
+                                                          const double*   du,
+                                                          double*         x,
+                                                          const int       stride,
+                                                          const int       batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgtsvStridedBatched(hipblasHandle_t       handle,
+                                                          const int             m,
+                                                          const hipblasComplex* dl,
+                                                          const hipblasComplex* d,
+                                                          const hipblasComplex* du,
+                                                          hipblasComplex*       x,
+                                                          const int             stride,
+                                                          const int             batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgtsvStridedBatched(hipblasHandle_t             handle,
+                                                          const int                   m,
+                                                          const hipblasDoubleComplex* dl,
+                                                          const hipblasDoubleComplex* d,
+                                                          const hipblasDoubleComplex* du,
+                                                          hipblasDoubleComplex*       x,
+                                                          const int                   stride,
+                                                          const int                   batch_count);
+
+// gtsv_interleaved_batched: the same with the systems interleaved, element i of batch b at
+// i * batch_count + b in each array, so consecutive batches are contiguous in memory
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgtsvInterleavedBatched(hipblasHandle_t handle,
+                                                              const int       m,
+                                                              const float*    dl,
+                                                              const float*    d,
+                                                              const float*    du,
+                                                              float*          x,
+                                                              const int       batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgtsvInterleavedBatched(hipblasHandle_t handle,
+                                                              const int       m,
+                                                              const double*   dl,
+                                                              const double*   d,
+                                                              const double*   du,
+                                                              double*         x,
+                                                              const int       batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgtsvInterleavedBatched(hipblasHandle_t       handle,
+                                                              const int             m,
+                                                              const hipblasComplex* dl,
+                                                              const hipblasComplex* d,
+                                                              const hipblasComplex* du,
+                                                              hipblasComplex*       x,
+                                                              const int             batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgtsvInterleavedBatched(
+    hipblasHandle_t             handle,
+    const int                   m,
+    const hipblasDoubleComplex* dl,
+    const hipblasDoubleComplex* d,
+    const hipblasDoubleComplex* du,
+    hipblasDoubleComplex*       x,
+    const int                   batch_count);
+
+// Compact functions: batches of tiny matrices, 2 x 2 to 16 x 16 or so, kept interleaved so that
+// element (i, j) of batch b is at (i + j * ld) * batch_count + b, ld being the leading dimension
+// lda, ldb or ldc of the argument. The matrices of consecutive batches then sit side by side
+// element by element, and one thread per matrix makes every access of a warp contiguous, where the
+// strided and pointer-array layouts leave each thread its own cache lines. A compact array of
+// m x n matrices holds ld * n * batch_count elements. The ipiv of getrf and getrs is compact with
+// ld 1, pivot j of batch b at j * batch_count + b, and the info of getrf holds one value per batch
+
+// pack_compact: copy the m x n matrices of strided A, batch b's at b * strideA, to compact Ac
+HIPBLAS_EXPORT hipblasStatus_t hipblasSpackCompact(hipblasHandle_t handle,
+                                                   const int       m,
+                                                   const int       n,
+                                                   const float*    A,
+                                                   const int       lda,
+                                                   const int       strideA,
+                                                   float*          Ac,
+                                                   const int       ldac,
+                                                   const int       batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDpackCompact(hipblasHandle_t handle,
+                                                   const int       m,
+                                                   const int       n,
+                                                   const double*   A,
+                                                   const int       lda,
+                                                   const int       strideA,
+                                                   double*         Ac,
+                                                   const int       ldac,
+                                                   const int       batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCpackCompact(hipblasHandle_t       handle,
+                                                   const int             m,
+                                                   const int             n,
+                                                   const hipblasComplex* A,
+                                                   const int             lda,
+                                                   const int             strideA,
+                                                   hipblasComplex*       Ac,
+                                                   const int             ldac,
+                                                   const int             batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZpackCompact(hipblasHandle_t             handle,
+                                                   const int                   m,
+                                                   const int                   n,
+                                                   const hipblasDoubleComplex* A,
+                                                   const int                   lda,
+                                                   const int                   strideA,
+                                                   hipblasDoubleComplex*       Ac,
+                                                   const int                   ldac,
+                                                   const int                   batch_count);
+
+// unpack_compact: copy the m x n matrices of compact Ac back to strided A
+HIPBLAS_EXPORT hipblasStatus_t hipblasSunpackCompact(hipblasHandle_t handle,
+                                                     const int       m,
+                                                     const int       n,
+                                                     const float*    Ac,
+                                                     const int       ldac,
+                                                     float*          A,
+                                                     const int       lda,
+                                                     const int       strideA,
+                                                     const int       batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDunpackCompact(hipblasHandle_t handle,
+                                                     const int       m,
+                                                     const int       n,
+                                                     const double*   Ac,
+                                                     const int       ldac,
+                                                     double*         A,
+                                                     const int       lda,
+                                                     const int       strideA,
+                                                     const int       batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCunpackCompact(hipblasHandle_t       handle,
+                                                     const int             m,
+                                                     const int             n,
+                                                     const hipblasComplex* Ac,
+                                                     const int             ldac,
+                                                     hipblasComplex*       A,
+                                                     const int             lda,
+                                                     const int             strideA,
+                                                     const int             batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZunpackCompact(hipblasHandle_t             handle,
+                                                     const int                   m,
+                                                     const int                   n,
+                                                     const hipblasDoubleComplex* Ac,
+                                                     const int                   ldac,
+                                                     hipblasDoubleComplex*       A,
+                                                     const int                   lda,
+                                                     const int                   strideA,
+                                                     const int                   batch_count);
+
+// gemm_compact: C = alpha * op(A) * op(B) + beta * C for each batch of compact A, B and C, where C
+// is never read when beta is zero
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgemmCompact(hipblasHandle_t    handle,
+                                                   hipblasOperation_t transA,
+                                                   hipblasOperation_t transB,
+                                                   const int          m,
+                                                   const int          n,
+                                                   const int          k,
+                                                   const float*       alpha,
+                                                   const float*       A,
+                                                   const int          lda,
+                                                   const float*       B,
+                                                   const int          ldb,
+                                                   const float*       beta,
+                                                   float*             C,
+                                                   const int          ldc,
+                                                   const int          batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgemmCompact(hipblasHandle_t    handle,
+                                                   hipblasOperation_t transA,
+                                                   hipblasOperation_t transB,
+                                                   const int          m,
+                                                   const int          n,
+                                                   const int          k,
+                                                   const double*      alpha,
+                                                   const double*      A,
+                                                   const int          lda,
+                                                   const double*      B,
+                                                   const int          ldb,
+                                                   const double*      beta,
+                                                   double*            C,
+                                                   const int          ldc,
+                                                   const int          batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgemmCompact(hipblasHandle_t       handle,
+                                                   hipblasOperation_t    transA,
+                                                   hipblasOperation_t    transB,
+                                                   const int             m,
+                                                   const int             n,
+                                                   const int             k,
+                                                   const hipblasComplex* alpha,
+                                                   const hipblasComplex* A,
+                                                   const int             lda,
+                                                   const hipblasComplex* B,
+                                                   const int             ldb,
+                                                   const hipblasComplex* beta,
+                                                   hipblasComplex*       C,
+                                                   const int             ldc,
+                                                   const int             batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgemmCompact(hipblasHandle_t             handle,
+                                                   hipblasOperation_t          transA,
+                                                   hipblasOperation_t          transB,
+                                                   const int                   m,
+                                                   const int                   n,
+                                                   const int                   k,
+                                                   const hipblasDoubleComplex* alpha,
+                                                   const hipblasDoubleComplex* A,
+                                                   const int                   lda,
+                                                   const hipblasDoubleComplex* B,
+                                                   const int                   ldb,
+                                                   const hipblasDoubleComplex* beta,
+                                                   hipblasDoubleComplex*       C,
+                                                   const int                   ldc,
+                                                   const int                   batch_count);
+
+// trsm_compact: solves op(A) X = alpha B, or X op(A) = alpha B on the right side, for each batch of
+// compact triangular A and m x n B, overwriting B with X
+HIPBLAS_EXPORT hipblasStatus_t hipblasStrsmCompact(hipblasHandle_t    handle,
+                                                   hipblasSideMode_t  side,
+                                                   hipblasFillMode_t  uplo,
+                                                   hipblasOperation_t transA,
+                                                   hipblasDiagType_t  diag,
+                                                   const int          m,
+                                                   const int          n,
+                                                   const float*       alpha,
+                                                   const float*       A,
+                                                   const int          lda,
+                                                   float*             B,
+                                                   const int          ldb,
+                                                   const int          batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtrsmCompact(hipblasHandle_t    handle,
+                                                   hipblasSideMode_t  side,
+                                                   hipblasFillMode_t  uplo,
+                                                   hipblasOperation_t transA,
+                                                   hipblasDiagType_t  diag,
+                                                   const int          m,
+                                                   const int          n,
+                                                   const double*      alpha,
+                                                   const double*      A,
+                                                   const int          lda,
+                                                   double*            B,
+                                                   const int          ldb,
+                                                   const int          batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtrsmCompact(hipblasHandle_t       handle,
+                                                   hipblasSideMode_t     side,
+                                                   hipblasFillMode_t     uplo,
+                                                   hipblasOperation_t    transA,
+                                                   hipblasDiagType_t     diag,
+                                                   const int             m,
+                                                   const int             n,
+                                                   const hipblasComplex* alpha,
+                                                   const hipblasComplex* A,
+                                                   const int             lda,
+                                                   hipblasComplex*       B,
+                                                   const int             ldb,
+                                                   const int             batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtrsmCompact(hipblasHandle_t             handle,
+                                                   hipblasSideMode_t           side,
+                                                   hipblasFillMode_t           uplo,
+                                                   hipblasOperation_t          transA,
+                                                   hipblasDiagType_t           diag,
+                                                   const int                   m,
+                                                   const int                   n,
+                                                   const hipblasDoubleComplex* alpha,
+                                                   const hipblasDoubleComplex* A,
+                                                   const int                   lda,
+                                                   hipblasDoubleComplex*       B,
+                                                   const int                   ldb,
+                                                   const int                   batch_count);
+
+// getrf_compact: the LU factorization with partial pivoting of each batch of compact n x n A, as
+// getrf_strided_batched
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgetrfCompact(hipblasHandle_t handle,
+                                                    const int       n,
+                                                    float*          A,
+                                                    const int       lda,
+                                                    int*            ipiv,
+                                                    int*            info,
+                                                    const int       batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgetrfCompact(hipblasHandle_t handle,
+                                                    const int       n,
+                                                    double*         A,
+                                                    const int       lda,
+                                                    int*            ipiv,
+                                                    int*            info,
+                                                    const int       batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgetrfCompact(hipblasHandle_t handle,
+                                                    const int       n,
+                                                    hipblasComplex* A,
+                                                    const int       lda,
+                                                    int*            ipiv,
+                                                    int*            info,
+                                                    const int       batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgetrfCompact(hipblasHandle_t       handle,
+                                                    const int             n,
+                                                    hipblasDoubleComplex* A,
+                                                    const int             lda,
+                                                    int*                  ipiv,
+                                                    int*                  info,
+                                                    const int             batch_count);
+
+// getrs_compact: solves op(A) X = B for each batch of compact B, with the factors and pivots of
+// getrf_compact, overwriting B with X
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgetrsCompact(hipblasHandle_t          handle,
+                                                    const hipblasOperation_t trans,
+                                                    const int                n,
+                                                    const int                nrhs,
+                                                    const float*             A,
+                                                    const int                lda,
+                                                    const int*               ipiv,
+                                                    float*                   B,
+                                                    const int                ldb,
+                                                    const int                batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgetrsCompact(hipblasHandle_t          handle,
+                                                    const hipblasOperation_t trans,
+                                                    const int                n,
+                                                    const int                nrhs,
+                                                    const double*            A,
+                                                    const int                lda,
+                                                    const int*               ipiv,
+                                                    double*                  B,
+                                                    const int                ldb,
+                                                    const int                batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgetrsCompact(hipblasHandle_t          handle,
+                                                    const hipblasOperation_t trans,
+                                                    const int                n,
+                                                    const int                nrhs,
+                                                    const hipblasComplex*    A,
+                                                    const int                lda,
+                                                    const int*               ipiv,
+                                                    hipblasComplex*          B,
+                                                    const int                ldb,
+                                                    const int                batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgetrsCompact(hipblasHandle_t             handle,
+                                                    const hipblasOperation_t    trans,
+                                                    const int                   n,
+                                                    const int                   nrhs,
+                                                    const hipblasDoubleComplex* A,
+                                                    const int                   lda,
+                                                    const int*                  ipiv,
+                                                    hipblasDoubleComplex*       B,
+                                                    const int                   ldb,
+                                                    const int                   batch_count);
+
+// trttp: copy the uplo triangle of the n x n matrix A to packed storage AP, as tpmv, spmv
+// and the other packed routines read it
+HIPBLAS_EXPORT hipblasStatus_t hipblasStrttp(hipblasHandle_t         handle,
+                                             const hipblasFillMode_t uplo,
+                                             const int               n,
+                                             const float*            A,
+                                             const int               lda,
+                                             float*                  AP);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtrttp(hipblasHandle_t         handle,
+                                             const hipblasFillMode_t uplo,
+                                             const int               n,
+                                             const double*           A,
+                                             const int               lda,
+                                             double*                 AP);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtrttp(hipblasHandle_t         handle,
+                                             const hipblasFillMode_t uplo,
+                                             const int               n,
+                                             const hipblasComplex*   A,
+                                             const int               lda,
+                                             hipblasComplex*         AP);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtrttp(hipblasHandle_t             handle,
+                                             const hipblasFillMode_t     uplo,
+                                             const int                   n,
+                                             const hipblasDoubleComplex* A,
+                                             const int                   lda,
+                                             hipblasDoubleComplex*       AP);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasStrttpBatched(hipblasHandle_t         handle,
+                                                    const hipblasFillMode_t uplo,
+                                                    const int               n,
+                                                    const float* const      A[],
+                                                    const int               lda,
+                                                    float* const            AP[],
+                                                    const int               batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtrttpBatched(hipblasHandle_t         handle,
+                                                    const hipblasFillMode_t uplo,
+                                                    const int               n,
+                                                    const double* const     A[],
+                                                    const int               lda,
+                                                    double* const           AP[],
+                                                    const int               batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtrttpBatched(hipblasHandle_t             handle,
+                                                    const hipblasFillMode_t     uplo,
+                                                    const int                   n,
+                                                    const hipblasComplex* const A[],
+                                                    const int                   lda,
+                                                    hipblasComplex* const       AP[],
+                                                    const int                   batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtrttpBatched(hipblasHandle_t                   handle,
+                                                    const hipblasFillMode_t           uplo,
+                                                    const int                         n,
+                                                    const hipblasDoubleComplex* const A[],
+                                                    const int                         lda,
+                                                    hipblasDoubleComplex* const       AP[],
+                                                    const int                         batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasStrttpStridedBatched(hipblasHandle_t         handle,
+                                                           const hipblasFillMode_t uplo,
+                                                           const int               n,
+                                                           const float*            A,
+                                                           const int               lda,
+                                                           const int               strideA,
+                                                           float*                  AP,
+                                                           const int               strideAP,
+                                                           const int               batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtrttpStridedBatched(hipblasHandle_t         handle,
+                                                           const hipblasFillMode_t uplo,
+                                                           const int               n,
+                                                           const double*           A,
+                                                           const int               lda,
+                                                           const int               strideA,
+                                                           double*                 AP,
+                                                           const int               strideAP,
+                                                           const int               batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtrttpStridedBatched(hipblasHandle_t         handle,
+                                                           const hipblasFillMode_t uplo,
+                                                           const int               n,
+                                                           const hipblasComplex*   A,
+                                                           const int               lda,
+                                                           const int               strideA,
+                                                           hipblasComplex*         AP,
+                                                           const int               strideAP,
+                                                           const int               batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtrttpStridedBatched(hipblasHandle_t             handle,
+                                                           const hipblasFillMode_t     uplo,
+                                                           const int                   n,
+                                                           const hipblasDoubleComplex* A,
+                                                           const int                   lda,
+                                                           const int                   strideA,
+                                                           hipblasDoubleComplex*       AP,
+                                                           const int                   strideAP,
+                                                           const int                   batch_count);
+
+// tpttr: copy the packed triangle AP to the uplo triangle of A, leaving the other triangle as
+// it was
+HIPBLAS_EXPORT hipblasStatus_t hipblasStpttr(hipblasHandle_t         handle,
+                                             const hipblasFillMode_t uplo,
+                                             const int               n,
+                                             const float*            AP,
+                                             float*                  A,
+                                             const int               lda);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtpttr(hipblasHandle_t         handle,
+                                             const hipblasFillMode_t uplo,
+                                             const int               n,
+                                             const double*           AP,
+                                             double*                 A,
+                                             const int               lda);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtpttr(hipblasHandle_t         handle,
+                                             const hipblasFillMode_t uplo,
+                                             const int               n,
+                                             const hipblasComplex*   AP,
+                                             hipblasComplex*         A,
+                                             const int               lda);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtpttr(hipblasHandle_t             handle,
+                                             const hipblasFillMode_t     uplo,
+                                             const int                   n,
+                                             const hipblasDoubleComplex* AP,
+                                             hipblasDoubleComplex*       A,
+                                             const int                   lda);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasStpttrBatched(hipblasHandle_t         handle,
+                                                    const hipblasFillMode_t uplo,
+                                                    const int               n,
+                                                    const float* const      AP[],
+                                                    float* const            A[],
+                                                    const int               lda,
+                                                    const int               batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtpttrBatched(hipblasHandle_t         handle,
+                                                    const hipblasFillMode_t uplo,
+                                                    const int               n,
+                                                    const double* const     AP[],
+                                                    double* const           A[],
+                                                    const int               lda,
+                                                    const int               batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtpttrBatched(hipblasHandle_t             handle,
+                                                    const hipblasFillMode_t     uplo,
+                                                    const int                   n,
+                                                    const hipblasComplex* const AP[],
+                                                    hipblasComplex* const       A[],
+                                                    const int                   lda,
+                                                    const int                   batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtpttrBatched(hipblasHandle_t                   handle,
+                                                    const hipblasFillMode_t           uplo,
+                                                    const int                         n,
+                                                    const hipblasDoubleComplex* const AP[],
+                                                    hipblasDoubleComplex* const       A[],
+                                                    const int                         lda,
+                                                    const int                         batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasStpttrStridedBatched(hipblasHandle_t         handle,
+                                                           const hipblasFillMode_t uplo,
+                                                           const int               n,
+                                                           const float*            AP,
+                                                           const int               strideAP,
+                                                           float*                  A,
+                                                           const int               lda,
+                                                           const int               strideA,
+                                                           const int               batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtpttrStridedBatched(hipblasHandle_t         handle,
+                                                           const hipblasFillMode_t uplo,
+                                                           const int               n,
+                                                           const double*           AP,
+                                                           const int               strideAP,
+                                                           double*                 A,
+                                                           const int               lda,
+                                                           const int               strideA,
+                                                           const int               batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtpttrStridedBatched(hipblasHandle_t         handle,
+                                                           const hipblasFillMode_t uplo,
+                                                           const int               n,
+                                                           const hipblasComplex*   AP,
+                                                           const int               strideAP,
+                                                           hipblasComplex*         A,
+                                                           const int               lda,
+                                                           const int               strideA,
+                                                           const int               batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtpttrStridedBatched(hipblasHandle_t             handle,
+                                                           const hipblasFillMode_t     uplo,
+                                                           const int                   n,
+                                                           const hipblasDoubleComplex* AP,
+                                                           const int                   strideAP,
+                                                           hipblasDoubleComplex*       A,
+                                                           const int                   lda,
+                                                           const int                   strideA,
+                                                           const int                   batch_count);
+
+// ge2gb: copy the kl, ku band of the m x n matrix A to band storage AB, with
+// AB(ku + i - j, j) = A(i, j) as gbmv reads it. The symmetric and triangular band
+// layouts of sbmv, hbmv and tbmv are kl = 0, ku = k for upper and kl = k, ku = 0 for lower
+HIPBLAS_EXPORT hipblasStatus_t hipblasSge2gb(hipblasHandle_t handle,
+                                             const int       m,
+                                             const int       n,
+                                             const int       kl,
+                                             const int       ku,
+                                             const float*    A,
+                                             const int       lda,
+                                             float*          AB,
+                                             const int       ldab);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDge2gb(hipblasHandle_t handle,
+                                             const int       m,
+                                             const int       n,
+                                             const int       kl,
+                                             const int       ku,
+                                             const double*   A,
+                                             const int       lda,
+                                             double*         AB,
+                                             const int       ldab);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCge2gb(hipblasHandle_t       handle,
+                                             const int             m,
+                                             const int             n,
+                                             const int             kl,
+                                             const int             ku,
+                                             const hipblasComplex* A,
+                                             const int             lda,
+                                             hipblasComplex*       AB,
+                                             const int             ldab);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZge2gb(hipblasHandle_t             handle,
+                                             const int                   m,
+                                             const int                   n,
+                                             const int                   kl,
+                                             const int                   ku,
+                                             const hipblasDoubleComplex* A,
+                                             const int                   lda,
+                                             hipblasDoubleComplex*       AB,
+                                             const int                   ldab);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSge2gbBatched(hipblasHandle_t    handle,
+                                                    const int          m,
+                                                    const int          n,
+                                                    const int          kl,
+                                                    const int          ku,
+                                                    const float* const A[],
+                                                    const int          lda,
+                                                    float* const       AB[],
+                                                    const int          ldab,
+                                                    const int          batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDge2gbBatched(hipblasHandle_t     handle,
+                                                    const int           m,
+                                                    const int           n,
+                                                    const int           kl,
+                                                    const int           ku,
+                                                    const double* const A[],
+                                                    const int           lda,
+                                                    double* const       AB[],
+                                                    const int           ldab,
+                                                    const int           batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCge2gbBatched(hipblasHandle_t             handle,
+                                                    const int                   m,
+                                                    const int                   n,
+                                                    const int                   kl,
+                                                    const int                   ku,
+                                                    const hipblasComplex* const A[],
+                                                    const int                   lda,
+                                                    hipblasComplex* const       AB[],
+                                                    const int                   ldab,
+                                                    const int                   batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZge2gbBatched(hipblasHandle_t                   handle,
+                                                    const int                         m,
+                                                    const int                         n,
+                                                    const int                         kl,
+                                                    const int                         ku,
+                                                    const hipblasDoubleComplex* const A[],
+                                                    const int                         lda,
+                                                    hipblasDoubleComplex* const       AB[],
+                                                    const int                         ldab,
+                                                    const int                         batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSge2gbStridedBatched(hipblasHandle_t handle,
+                                                           const int       m,
+                                                           const int       n,
+                                                           const int       kl,
+                                                           const int       ku,
+                                                           const float*    A,
+                                                           const int       lda,
+                                                           const int       strideA,
+                                                           float*          AB,
+                                                           const int       ldab,
+                                                           const int       strideAB,
+                                                           const int       batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDge2gbStridedBatched(hipblasHandle_t handle,
+                                                           const int       m,
+                                                           const int       n,
+                                                           const int       kl,
+                                                           const int       ku,
+                                                           const double*   A,
+                                                           const int       lda,
+                                                           const int       strideA,
+                                                           double*         AB,
+                                                           const int       ldab,
+                                                           const int       strideAB,
+                                                           const int       batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCge2gbStridedBatched(hipblasHandle_t       handle,
+                                                           const int             m,
+                                                           const int             n,
+                                                           const int             kl,
+                                                           const int             ku,
+                                                           const hipblasComplex* A,
+                                                           const int             lda,
+                                                           const int             strideA,
+                                                           hipblasComplex*       AB,
+                                                           const int             ldab,
+                                                           const int             strideAB,
+                                                           const int             batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZge2gbStridedBatched(hipblasHandle_t             handle,
+                                                           const int                   m,
+                                                           const int                   n,
+                                                           const int                   kl,
+                                                           const int                   ku,
+                                                           const hipblasDoubleComplex* A,
+                                                           const int                   lda,
+                                                           const int                   strideA,
+                                                           hipblasDoubleComplex*       AB,
+                                                           const int                   ldab,
+                                                           const int                   strideAB,
+                                                           const int                   batch_count);
+
+// gb2ge: copy the band storage AB back to the m x n matrix A, which is zero outside the band
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgb2ge(hipblasHandle_t handle,
+                                             const int       m,
+                                             const int       n,
+                                             const int       kl,
+                                             const int       ku,
+                                             const float*    AB,
+                                             const int       ldab,
+                                             float*          A,
+                                             const int       lda);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgb2ge(hipblasHandle_t handle,
+                                             const int       m,
+                                             const int       n,
+                                             const int       kl,
+                                             const int       ku,
+                                             const double*   AB,
+                                             const int       ldab,
+                                             double*         A,
+                                             const int       lda);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgb2ge(hipblasHandle_t       handle,
+                                             const int             m,
+                                             const int             n,
+                                             const int             kl,
+                                             const int             ku,
+                                             const hipblasComplex* AB,
+                                             const int             ldab,
+                                             hipblasComplex*       A,
+                                             const int             lda);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgb2ge(hipblasHandle_t             handle,
+                                             const int                   m,
+                                             const int                   n,
+                                             const int                   kl,
+                                             const int                   ku,
+                                             const hipblasDoubleComplex* AB,
+                                             const int                   ldab,
+                                             hipblasDoubleComplex*       A,
+                                             const int                   lda);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgb2geBatched(hipblasHandle_t    handle,
+                                                    const int          m,
+                                                    const int          n,
+                                                    const int          kl,
+                                                    const int          ku,
+                                                    const float* const AB[],
+                                                    const int          ldab,
+                                                    float* const       A[],
+                                                    const int          lda,
+                                                    const int          batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgb2geBatched(hipblasHandle_t     handle,
+                                                    const int           m,
+                                                    const int           n,
+                                                    const int           kl,
+                                                    const int           ku,
+                                                    const double* const AB[],
+                                                    const int           ldab,
+                                                    double* const       A[],
+                                                    const int           lda,
+                                                    const int           batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgb2geBatched(hipblasHandle_t             handle,
+                                                    const int                   m,
+                                                    const int                   n,
+                                                    const int                   kl,
+                                                    const int                   ku,
+                                                    const hipblasComplex* const AB[],
+                                                    const int                   ldab,
+                                                    hipblasComplex* const       A[],
+                                                    const int                   lda,
+                                                    const int                   batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgb2geBatched(hipblasHandle_t                   handle,
+                                                    const int                         m,
+                                                    const int                         n,
+                                                    const int                         kl,
+                                                    const int                         ku,
+                                                    const hipblasDoubleComplex* const AB[],
+                                                    const int                         ldab,
+                                                    hipblasDoubleComplex* const       A[],
+                                                    const int                         lda,
+                                                    const int                         batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgb2geStridedBatched(hipblasHandle_t handle,
+                                                           const int       m,
+                                                           const int       n,
+                                                           const int       kl,
+                                                           const int       ku,
+                                                           const float*    AB,
+                                                           const int       ldab,
+                                                           const int       strideAB,
+                                                           float*          A,
+                                                           const int       lda,
+                                                           const int       strideA,
+                                                           const int       batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgb2geStridedBatched(hipblasHandle_t handle,
+                                                           const int       m,
+                                                           const int       n,
+                                                           const int       kl,
+                                                           const int       ku,
+                                                           const double*   AB,
+                                                           const int       ldab,
+                                                           const int       strideAB,
+                                                           double*         A,
+                                                           const int       lda,
+                                                           const int       strideA,
+                                                           const int       batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgb2geStridedBatched(hipblasHandle_t       handle,
+                                                           const int             m,
+                                                           const int             n,
+                                                           const int             kl,
+                                                           const int             ku,
+                                                           const hipblasComplex* AB,
+                                                           const int             ldab,
+                                                           const int             strideAB,
+                                                           hipblasComplex*       A,
+                                                           const int             lda,
+                                                           const int             strideA,
+                                                           const int             batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgb2geStridedBatched(hipblasHandle_t             handle,
+                                                           const int                   m,
+                                                           const int                   n,
+                                                           const int                   kl,
+                                                           const int                   ku,
+                                                           const hipblasDoubleComplex* AB,
+                                                           const int                   ldab,
+                                                           const int                   strideAB,
+                                                           hipblasDoubleComplex*       A,
+                                                           const int                   lda,
+                                                           const int                   strideA,
+                                                           const int                   batch_count);
+
+// gemm
+HIPBLAS_EXPORT hipblasStatus_t hipblasHgemm(hipblasHandle_t    handle,
+                                            hipblasOperation_t transa,
+                                            hipblasOperation_t transb,
+                                            int                m,
+                                            int                n,
+                                            int                k,
+                                            const hipblasHalf* alpha,
+                                            const hipblasHalf* A,
+                                            int                lda,
+                                            const hipblasHalf* B,
+                                            int                ldb,
+                                            const hipblasHalf* beta,
+                                            hipblasHalf*       C,
+                                            int                ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgemm(hipblasHandle_t    handle,
+                                            hipblasOperation_t transa,
+                                            hipblasOperation_t transb,
+                                            int                m,
+                                            int                n,
+                                            int                k,
+                                            const float*       alpha,
+                                            const float*       A,
+                                            int                lda,
+                                            const float*       B,
+                                            int                ldb,
+                                            const float*       beta,
+                                            float*             C,
+                                            int                ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgemm(hipblasHandle_t    handle,
+                                            hipblasOperation_t transa,
+                                            hipblasOperation_t transb,
+                                            int                m,
+                                            int                n,
+                                            int                k,
+                                            const double*      alpha,
+                                            const double*      A,
+                                            int                lda,
+                                            const double*      B,
+                                            int                ldb,
+                                            const double*      beta,
+                                            double*            C,
+                                            int                ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgemm(hipblasHandle_t       handle,
+                                            hipblasOperation_t    transa,
+                                            hipblasOperation_t    transb,
+                                            int                   m,
+                                            int                   n,
+                                            int                   k,
+                                            const hipblasComplex* alpha,
+                                            const hipblasComplex* A,
+                                            int                   lda,
+                                            const hipblasComplex* B,
+                                            int                   ldb,
+                                            const hipblasComplex* beta,
+                                            hipblasComplex*       C,
+                                            int                   ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgemm(hipblasHandle_t             handle,
+                                            hipblasOperation_t          transa,
+                                            hipblasOperation_t          transb,
                                             int                         m,
                                             int                         n,
                                             int                         k,
@@ -5793,203 +10612,4014 @@ HIPBLAS_EXPORT hipblasStatus_t hipblasZgemm(hipblasHandle_t             handle,
                                             hipblasDoubleComplex*       C,
                                             int                         ldc);
 
-// gemm batched
-HIPBLAS_EXPORT hipblasStatus_t hipblasHgemmBatched(hipblasHandle_t          handle,
-                                                   hipblasOperation_t       transa,
-                                                   hipblasOperation_t       transb,
-                                                   int                      m,
-                                                   int                      n,
-                                                   int                      k,
-                                                   const hipblasHalf*       alpha,
-                                                   const hipblasHalf* const A[],
-                                                   int                      lda,
-                                                   const hipblasHalf* const B[],
-                                                   int                      ldb,
-                                                   const hipblasHalf*       beta,
-                                                   hipblasHalf* const       C[],
-                                                   int                      ldc,
-                                                   int                      batchCount);
+// gemm batched
+HIPBLAS_EXPORT hipblasStatus_t hipblasHgemmBatched(hipblasHandle_t          handle,
+                                                   hipblasOperation_t       transa,
+                                                   hipblasOperation_t       transb,
+                                                   int                      m,
+                                                   int                      n,
+                                                   int                      k,
+                                                   const hipblasHalf*       alpha,
+                                                   const hipblasHalf* const A[],
+                                                   int                      lda,
+                                                   const hipblasHalf* const B[],
+                                                   int                      ldb,
+                                                   const hipblasHalf*       beta,
+                                                   hipblasHalf* const       C[],
+                                                   int                      ldc,
+                                                   int                      batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgemmBatched(hipblasHandle_t    handle,
+                                                   hipblasOperation_t transa,
+                                                   hipblasOperation_t transb,
+                                                   int                m,
+                                                   int                n,
+                                                   int                k,
+                                                   const float*       alpha,
+                                                   const float* const A[],
+                                                   int                lda,
+                                                   const float* const B[],
+                                                   int                ldb,
+                                                   const float*       beta,
+                                                   float* const       C[],
+                                                   int                ldc,
+                                                   int                batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgemmBatched(hipblasHandle_t     handle,
+                                                   hipblasOperation_t  transa,
+                                                   hipblasOperation_t  transb,
+                                                   int                 m,
+                                                   int                 n,
+                                                   int                 k,
+                                                   const double*       alpha,
+                                                   const double* const A[],
+                                                   int                 lda,
+                                                   const double* const B[],
+                                                   int                 ldb,
+                                                   const double*       beta,
+                                                   double* const       C[],
+                                                   int                 ldc,
+                                                   int                 batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgemmBatched(hipblasHandle_t             handle,
+                                                   hipblasOperation_t          transa,
+                                                   hipblasOperation_t          transb,
+                                                   int                         m,
+                                                   int                         n,
+                                                   int                         k,
+                                                   const hipblasComplex*       alpha,
+                                                   const hipblasComplex* const A[],
+                                                   int                         lda,
+                                                   const hipblasComplex* const B[],
+                                                   int                         ldb,
+                                                   const hipblasComplex*       beta,
+                                                   hipblasComplex* const       C[],
+                                                   int                         ldc,
+                                                   int                         batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgemmBatched(hipblasHandle_t                   handle,
+                                                   hipblasOperation_t                transa,
+                                                   hipblasOperation_t                transb,
+                                                   int                               m,
+                                                   int                               n,
+                                                   int                               k,
+                                                   const hipblasDoubleComplex*       alpha,
+                                                   const hipblasDoubleComplex* const A[],
+                                                   int                               lda,
+                                                   const hipblasDoubleComplex* const B[],
+                                                   int                               ldb,
+                                                   const hipblasDoubleComplex*       beta,
+                                                   hipblasDoubleComplex* const       C[],
+                                                   int                               ldc,
+                                                   int                               batchCount);
+
+// gemm_strided_batched
+HIPBLAS_EXPORT hipblasStatus_t hipblasHgemmStridedBatched(hipblasHandle_t    handle,
+                                                          hipblasOperation_t transa,
+                                                          hipblasOperation_t transb,
+                                                          int                m,
+                                                          int                n,
+                                                          int                k,
+                                                          const hipblasHalf* alpha,
+                                                          const hipblasHalf* A,
+                                                          int                lda,
+                                                          long long          bsa,
+                                                          const hipblasHalf* B,
+                                                          int                ldb,
+                                                          long long          bsb,
+                                                          const hipblasHalf* beta,
+                                                          hipblasHalf*       C,
+                                                          int                ldc,
+                                                          long long          bsc,
+                                                          int                batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgemmStridedBatched(hipblasHandle_t    handle,
+                                                          hipblasOperation_t transa,
+                                                          hipblasOperation_t transb,
+                                                          int                m,
+                                                          int                n,
+                                                          int                k,
+                                                          const float*       alpha,
+                                                          const float*       A,
+                                                          int                lda,
+                                                          long long          bsa,
+                                                          const float*       B,
+                                                          int                ldb,
+                                                          long long          bsb,
+                                                          const float*       beta,
+                                                          float*             C,
+                                                          int                ldc,
+                                                          long long          bsc,
+                                                          int                batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgemmStridedBatched(hipblasHandle_t    handle,
+                                                          hipblasOperation_t transa,
+                                                          hipblasOperation_t transb,
+                                                          int                m,
+                                                          int                n,
+                                                          int                k,
+                                                          const double*      alpha,
+                                                          const double*      A,
+                                                          int                lda,
+                                                          long long          bsa,
+                                                          const double*      B,
+                                                          int                ldb,
+                                                          long long          bsb,
+                                                          const double*      beta,
+                                                          double*            C,
+                                                          int                ldc,
+                                                          long long          bsc,
+                                                          int                batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgemmStridedBatched(hipblasHandle_t       handle,
+                                                          hipblasOperation_t    transa,
+                                                          hipblasOperation_t    transb,
+                                                          int                   m,
+                                                          int                   n,
+                                                          int                   k,
+                                                          const hipblasComplex* alpha,
+                                                          const hipblasComplex* A,
+                                                          int                   lda,
+                                                          long long             bsa,
+                                                          const hipblasComplex* B,
+                                                          int                   ldb,
+                                                          long long             bsb,
+                                                          const hipblasComplex* beta,
+                                                          hipblasComplex*       C,
+                                                          int                   ldc,
+                                                          long long             bsc,
+                                                          int                   batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgemmStridedBatched(hipblasHandle_t             handle,
+                                                          hipblasOperation_t          transa,
+                                                          hipblasOperation_t          transb,
+                                                          int                         m,
+                                                          int                         n,
+                                                          int                         k,
+                                                          const hipblasDoubleComplex* alpha,
+                                                          const hipblasDoubleComplex* A,
+                                                          int                         lda,
+                                                          long long                   bsa,
+                                                          const hipblasDoubleComplex* B,
+                                                          int                         ldb,
+                                                          long long                   bsb,
+                                                          const hipblasDoubleComplex* beta,
+                                                          hipblasDoubleComplex*       C,
+                                                          int                         ldc,
+                                                          long long                   bsc,
+                                                          int                         batchCount);
+
+// gemm_batch_reduce: C = alpha * (op(A_0) * op(B_0) + ... + op(A_{b-1}) * op(B_{b-1})) + beta * C
+// for b = batch_count, every batch accumulating into the one m x n C. Nothing is kept per batch:
+// the products are summed in registers and C is written once
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgemmBatchReduce(hipblasHandle_t    handle,
+                                                       hipblasOperation_t transa,
+                                                       hipblasOperation_t transb,
+                                                       int                m,
+                                                       int                n,
+                                                       int                k,
+                                                       const float*       alpha,
+                                                       const float* const A[],
+                                                       int                lda,
+                                                       const float* const B[],
+                                                       int                ldb,
+                                                       const float*       beta,
+                                                       float*             C,
+                                                       int                ldc,
+                                                       int                batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgemmBatchReduce(hipblasHandle_t     handle,
+                                                       hipblasOperation_t  transa,
+                                                       hipblasOperation_t  transb,
+                                                       int                 m,
+                                                       int                 n,
+                                                       int                 k,
+                                                       const double*       alpha,
+                                                       const double* const A[],
+                                                       int                 lda,
+                                                       const double* const B[],
+                                                       int                 ldb,
+                                                       const double*       beta,
+                                                       double*             C,
+                                                       int                 ldc,
+                                                       int                 batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgemmBatchReduce(hipblasHandle_t             handle,
+                                                       hipblasOperation_t          transa,
+                                                       hipblasOperation_t          transb,
+                                                       int                         m,
+                                                       int                         n,
+                                                       int                         k,
+                                                       const hipblasComplex*       alpha,
+                                                       const hipblasComplex* const A[],
+                                                       int                         lda,
+                                                       const hipblasComplex* const B[],
+                                                       int                         ldb,
+                                                       const hipblasComplex*       beta,
+                                                       hipblasComplex*             C,
+                                                       int                         ldc,
+                                                       int                         batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgemmBatchReduce(
+    hipblasHandle_t                   handle,
+    hipblasOperation_t                transa,
+    hipblasOperation_t                transb,
+    int                               m,
+    int                               n,
+    int                               k,
+    const hipblasDoubleComplex*       alpha,
+    const hipblasDoubleComplex* const A[],
+    int                               lda,
+    const hipblasDoubleComplex* const B[],
+    int                               ldb,
+    const hipblasDoubleComplex*       beta,
+    hipblasDoubleComplex*             C,
+    int                               ldc,
+    int                               batch_count);
+
+// gemm_strided_batch_reduce: batch i's A and B are at A + i * strideA and B + i * strideB. Batches
+// that lie one after another along k, such as the column blocks of one A (strideA = k * lda for
+// HIPBLAS_OP_N) and the row blocks of one B (strideB = k for HIPBLAS_OP_N), are computed as a
+// single gemm k * batch_count deep
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgemmStridedBatchReduce(hipblasHandle_t    handle,
+                                                              hipblasOperation_t transa,
+                                                              hipblasOperation_t transb,
+                                                              int                m,
+                                                              int                n,
+                                                              int                k,
+                                                              const float*       alpha,
+                                                              const float*       A,
+                                                              int                lda,
+                                                              long long          strideA,
+                                                              const float*       B,
+                                                              int                ldb,
+                                                              long long          strideB,
+                                                              const float*       beta,
+                                                              float*             C,
+                                                              int                ldc,
+                                                              int                batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgemmStridedBatchReduce(hipblasHandle_t    handle,
+                                                              hipblasOperation_t transa,
+                                                              hipblasOperation_t transb,
+                                                              int                m,
+                                                              int                n,
+                                                              int                k,
+                                                              const double*      alpha,
+                                                              const double*      A,
+                                                              int                lda,
+                                                              long long          strideA,
+                                                              const double*      B,
+                                                              int                ldb,
+                                                              long long          strideB,
+                                                              const double*      beta,
+                                                              double*            C,
+                                                              int                ldc,
+                                                              int                batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgemmStridedBatchReduce(hipblasHandle_t       handle,
+                                                              hipblasOperation_t    transa,
+                                                              hipblasOperation_t    transb,
+                                                              int                   m,
+                                                              int                   n,
+                                                              int                   k,
+                                                              const hipblasComplex* alpha,
+                                                              const hipblasComplex* A,
+                                                              int                   lda,
+                                                              long long             strideA,
+                                                              const hipblasComplex* B,
+                                                              int                   ldb,
+                                                              long long             strideB,
+                                                              const hipblasComplex* beta,
+                                                              hipblasComplex*       C,
+                                                              int                   ldc,
+                                                              int                   batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgemmStridedBatchReduce(
+    hipblasHandle_t             handle,
+    hipblasOperation_t          transa,
+    hipblasOperation_t          transb,
+    int                         m,
+    int                         n,
+    int                         k,
+    const hipblasDoubleComplex* alpha,
+    const hipblasDoubleComplex* A,
+    int                         lda,
+    long long                   strideA,
+    const hipblasDoubleComplex* B,
+    int                         ldb,
+    long long                   strideB,
+    const hipblasDoubleComplex* beta,
+    hipblasDoubleComplex*       C,
+    int                         ldc,
+    int                         batch_count);
+
+// gemm3m: complex gemm using the 3M method, which forms the product from three real
+// multiplications of the real parts, the imaginary parts and their sums instead of four. On
+// rocBLAS the split operands and the three products take 3 * (m * k + k * n + m * n) real
+// elements per batch of the handle workspace; when the workspace cannot provide them, as past
+// hipblasSetWorkspaceLimit or a user workspace, the call runs as the plain complex gemm
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgemm3m(hipblasHandle_t       handle,
+                                              hipblasOperation_t    transa,
+                                              hipblasOperation_t    transb,
+                                              int                   m,
+                                              int                   n,
+                                              int                   k,
+                                              const hipblasComplex* alpha,
+                                              const hipblasComplex* A,
+                                              int                   lda,
+                                              const hipblasComplex* B,
+                                              int                   ldb,
+                                              const hipblasComplex* beta,
+                                              hipblasComplex*       C,
+                                              int                   ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgemm3m(hipblasHandle_t             handle,
+                                              hipblasOperation_t          transa,
+                                              hipblasOperation_t          transb,
+                                              int                         m,
+                                              int                         n,
+                                              int                         k,
+                                              const hipblasDoubleComplex* alpha,
+                                              const hipblasDoubleComplex* A,
+                                              int                         lda,
+                                              const hipblasDoubleComplex* B,
+                                              int                         ldb,
+                                              const hipblasDoubleComplex* beta,
+                                              hipblasDoubleComplex*       C,
+                                              int                         ldc);
+
+// gemm3m_strided_batched
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgemm3mStridedBatched(hipblasHandle_t       handle,
+                                                            hipblasOperation_t    transa,
+                                                            hipblasOperation_t    transb,
+                                                            int                   m,
+                                                            int                   n,
+                                                            int                   k,
+                                                            const hipblasComplex* alpha,
+                                                            const hipblasComplex* A,
+                                                            int                   lda,
+                                                            long long             bsa,
+                                                            const hipblasComplex* B,
+                                                            int                   ldb,
+                                                            long long             bsb,
+                                                            const hipblasComplex* beta,
+                                                            hipblasComplex*       C,
+                                                            int                   ldc,
+                                                            long long             bsc,
+                                                            int                   batchCount);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgemm3mStridedBatched(hipblasHandle_t             handle,
+                                                            hipblasOperation_t          transa,
+                                                            hipblasOperation_t          transb,
+                                                            int                         m,
+                                                            int                         n,
+                                                            int                         k,
+                                                            const hipblasDoubleComplex* alpha,
+                                                            const hipblasDoubleComplex* A,
+                                                            int                         lda,
+                                                            long long                   bsa,
+                                                            const hipblasDoubleComplex* B,
+                                                            int                         ldb,
+                                                            long long                   bsb,
+                                                            const hipblasDoubleComplex* beta,
+                                                            hipblasDoubleComplex*       C,
+                                                            int                         ldc,
+                                                            long long                   bsc,
+                                                            int                         batchCount);
+
+// gemm_planar_complex: C = alpha * op(A) op(B) + beta * C for complex matrices held as separate
+// real and imaginary planes of the same leading dimension, so no interleaving pass is needed.
+// type is HIPBLAS_C_32F or HIPBLAS_C_64F, the planes being real of its precision and alpha and
+// beta complex of it. Real alpha and beta in host pointer mode take four real gemms straight
+// into C; other scalars take the 3M products of hipblasCgemm3m in the handle workspace. The
+// strided form's batch strides apply to both planes of each matrix
+HIPBLAS_EXPORT hipblasStatus_t hipblasGemmPlanarComplex(hipblasHandle_t    handle,
+                                                        hipblasOperation_t transa,
+                                                        hipblasOperation_t transb,
+                                                        int                m,
+                                                        int                n,
+                                                        int                k,
+                                                        const void*        alpha,
+                                                        const void*        A_re,
+                                                        const void*        A_im,
+                                                        int                lda,
+                                                        const void*        B_re,
+                                                        const void*        B_im,
+                                                        int                ldb,
+                                                        const void*        beta,
+                                                        void*              C_re,
+                                                        void*              C_im,
+                                                        int                ldc,
+                                                        hipblasDatatype_t  type);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasGemmPlanarComplexStridedBatched(hipblasHandle_t    handle,
+                                                                      hipblasOperation_t transa,
+                                                                      hipblasOperation_t transb,
+                                                                      int                m,
+                                                                      int                n,
+                                                                      int                k,
+                                                                      const void*        alpha,
+                                                                      const void*        A_re,
+                                                                      const void*        A_im,
+                                                                      int                lda,
+                                                                      long long          stride_A,
+                                                                      const void*        B_re,
+                                                                      const void*        B_im,
+                                                                      int                ldb,
+                                                                      long long          stride_B,
+                                                                      const void*        beta,
+                                                                      void*              C_re,
+                                                                      void*              C_im,
+                                                                      int                ldc,
+                                                                      long long          stride_C,
+                                                                      int                batchCount,
+                                                                      hipblasDatatype_t  type);
+
+// gemm_grouped_batched: group g runs group_size[g] gemms with its own transa, transb, m, n, k,
+// alpha, leading dimensions and beta. The per-group arrays, alpha_array and beta_array are host
+// arrays of group_count entries; A_array, B_array and C_array are device arrays holding the
+// pointers of every group in order, sum(group_size) entries in all
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgemmGroupedBatched(hipblasHandle_t          handle,
+                                                          const hipblasOperation_t transa_array[],
+                                                          const hipblasOperation_t transb_array[],
+                                                          const int                m_array[],
+                                                          const int                n_array[],
+                                                          const int                k_array[],
+                                                          const float              alpha_array[],
+                                                          const float* const       A_array[],
+                                                          const int                lda_array[],
+                                                          const float* const       B_array[],
+                                                          const int                ldb_array[],
+                                                          const float              beta_array[],
+                                                          float* const             C_array[],
+                                                          const int                ldc_array[],
+                                                          int                      group_count,
+                                                          const int                group_size[]);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgemmGroupedBatched(hipblasHandle_t          handle,
+                                                          const hipblasOperation_t transa_array[],
+                                                          const hipblasOperation_t transb_array[],
+                                                          const int                m_array[],
+                                                          const int                n_array[],
+                                                          const int                k_array[],
+                                                          const double             alpha_array[],
+                                                          const double* const      A_array[],
+                                                          const int                lda_array[],
+                                                          const double* const      B_array[],
+                                                          const int                ldb_array[],
+                                                          const double             beta_array[],
+                                                          double* const            C_array[],
+                                                          const int                ldc_array[],
+                                                          int                      group_count,
+                                                          const int                group_size[]);
+
+// gemv_vbatched and trsv_vbatched: gemv and trsv over batch_count problems of their own sizes.
+// m, n, lda, incx and incy are device arrays of batch_count entries, as are the pointer arrays
+// unless the handle is in HIPBLAS_POINTER_ARRAY_HOST mode; alpha and beta are shared, or apart
+// by the handle's scalar stride in device pointer mode. The sizes are never copied to the host:
+// an entry with sizes BLAS would reject is skipped rather than reported. One launch runs the
+// whole batch, with gemv split into row tiles and trsv handing out batches as blocks come free,
+// so the work balances across entries however uneven the sizes are
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgemvVbatched(hipblasHandle_t    handle,
+                                                    hipblasOperation_t trans,
+                                                    const int          m[],
+                                                    const int          n[],
+                                                    const float*       alpha,
+                                                    const float* const A[],
+                                                    const int          lda[],
+                                                    const float* const x[],
+                                                    const int          incx[],
+                                                    const float*       beta,
+                                                    float* const       y[],
+                                                    const int          incy[],
+                                                    int                batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgemvVbatched(hipblasHandle_t     handle,
+                                                    hipblasOperation_t  trans,
+                                                    const int           m[],
+                                                    const int           n[],
+                                                    const double*       alpha,
+                                                    const double* const A[],
+                                                    const int           lda[],
+                                                    const double* const x[],
+                                                    const int           incx[],
+                                                    const double*       beta,
+                                                    double* const       y[],
+                                                    const int           incy[],
+                                                    int                 batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgemvVbatched(hipblasHandle_t             handle,
+                                                    hipblasOperation_t          trans,
+                                                    const int                   m[],
+                                                    const int                   n[],
+                                                    const hipblasComplex*       alpha,
+                                                    const hipblasComplex* const A[],
+                                                    const int                   lda[],
+                                                    const hipblasComplex* const x[],
+                                                    const int                   incx[],
+                                                    const hipblasComplex*       beta,
+                                                    hipblasComplex* const       y[],
+                                                    const int                   incy[],
+                                                    int                         batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgemvVbatched(hipblasHandle_t                   handle,
+                                                    hipblasOperation_t                trans,
+                                                    const int                         m[],
+                                                    const int                         n[],
+                                                    const hipblasDoubleComplex*       alpha,
+                                                    const hipblasDoubleComplex* const A[],
+                                                    const int                         lda[],
+                                                    const hipblasDoubleComplex* const x[],
+                                                    const int                         incx[],
+                                                    const hipblasDoubleComplex*       beta,
+                                                    hipblasDoubleComplex* const       y[],
+                                                    const int                         incy[],
+                                                    int                               batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasStrsvVbatched(hipblasHandle_t    handle,
+                                                    hipblasFillMode_t  uplo,
+                                                    hipblasOperation_t transA,
+                                                    hipblasDiagType_t  diag,
+                                                    const int          n[],
+                                                    const float* const A[],
+                                                    const int          lda[],
+                                                    float* const       x[],
+                                                    const int          incx[],
+                                                    int                batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtrsvVbatched(hipblasHandle_t     handle,
+                                                    hipblasFillMode_t   uplo,
+                                                    hipblasOperation_t  transA,
+                                                    hipblasDiagType_t   diag,
+                                                    const int           n[],
+                                                    const double* const A[],
+                                                    const int           lda[],
+                                                    double* const       x[],
+                                                    const int           incx[],
+                                                    int                 batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtrsvVbatched(hipblasHandle_t             handle,
+                                                    hipblasFillMode_t           uplo,
+                                                    hipblasOperation_t          transA,
+                                                    hipblasDiagType_t           diag,
+                                                    const int                   n[],
+                                                    const hipblasComplex* const A[],
+                                                    const int                   lda[],
+                                                    hipblasComplex* const       x[],
+                                                    const int                   incx[],
+                                                    int                         batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtrsvVbatched(hipblasHandle_t                   handle,
+                                                    hipblasFillMode_t                 uplo,
+                                                    hipblasOperation_t                transA,
+                                                    hipblasDiagType_t                 diag,
+                                                    const int                         n[],
+                                                    const hipblasDoubleComplex* const A[],
+                                                    const int                         lda[],
+                                                    hipblasDoubleComplex* const       x[],
+                                                    const int                         incx[],
+                                                    int                               batch_count);
+
+// getrf_vbatched, getrs_vbatched and trsm_vbatched: getrf, getrs and trsm over batch_count
+// problems of their own sizes, with the size arrays, ipiv and info in device memory as for
+// gemv_vbatched. getrf_vbatched pivots as getrfBatched, each entry's pivots at ipiv[b], and
+// sets info[b] to its first zero pivot; getrs_vbatched's info is a host pointer set to the first
+// invalid argument, as for getrs. An entry with sizes LAPACK would reject is skipped. Each call
+// is one launch over the whole batch: the entries are sorted by their work, largest first, and
+// handed to thread blocks as those come free, so a batch of very uneven sizes keeps the device
+// busy without bucketing by size on the host
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgetrfVbatched(hipblasHandle_t handle,
+                                                     const int       n[],
+                                                     float* const    A[],
+                                                     const int       lda[],
+                                                     int* const      ipiv[],
+                                                     int             info[],
+                                                     int             batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgetrfVbatched(hipblasHandle_t handle,
+                                                     const int       n[],
+                                                     double* const   A[],
+                                                     const int       lda[],
+                                                     int* const      ipiv[],
+                                                     int             info[],
+                                                     int             batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgetrfVbatched(hipblasHandle_t       handle,
+                                                     const int             n[],
+                                                     hipblasComplex* const A[],
+                                                     const int             lda[],
+                                                     int* const            ipiv[],
+                                                     int                   info[],
+                                                     int                   batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgetrfVbatched(hipblasHandle_t             handle,
+                                                     const int                   n[],
+                                                     hipblasDoubleComplex* const A[],
+                                                     const int                   lda[],
+                                                     int* const                  ipiv[],
+                                                     int                         info[],
+                                                     int                         batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgetrsVbatched(hipblasHandle_t    handle,
+                                                     hipblasOperation_t trans,
+                                                     const int          n[],
+                                                     const int          nrhs[],
+                                                     const float* const A[],
+                                                     const int          lda[],
+                                                     const int* const   ipiv[],
+                                                     float* const       B[],
+                                                     const int          ldb[],
+                                                     int*               info,
+                                                     int                batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgetrsVbatched(hipblasHandle_t     handle,
+                                                     hipblasOperation_t  trans,
+                                                     const int           n[],
+                                                     const int           nrhs[],
+                                                     const double* const A[],
+                                                     const int           lda[],
+                                                     const int* const    ipiv[],
+                                                     double* const       B[],
+                                                     const int           ldb[],
+                                                     int*                info,
+                                                     int                 batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgetrsVbatched(hipblasHandle_t             handle,
+                                                     hipblasOperation_t          trans,
+                                                     const int                   n[],
+                                                     const int                   nrhs[],
+                                                     const hipblasComplex* const A[],
+                                                     const int                   lda[],
+                                                     const int* const            ipiv[],
+                                                     hipblasComplex* const       B[],
+                                                     const int                   ldb[],
+                                                     int*                        info,
+                                                     int                         batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgetrsVbatched(hipblasHandle_t                   handle,
+                                                     hipblasOperation_t                trans,
+                                                     const int                         n[],
+                                                     const int                         nrhs[],
+                                                     const hipblasDoubleComplex* const A[],
+                                                     const int                         lda[],
+                                                     const int* const                  ipiv[],
+                                                     hipblasDoubleComplex* const       B[],
+                                                     const int                         ldb[],
+                                                     int*                              info,
+                                                     int                               batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasStrsmVbatched(hipblasHandle_t    handle,
+                                                    hipblasSideMode_t  side,
+                                                    hipblasFillMode_t  uplo,
+                                                    hipblasOperation_t transA,
+                                                    hipblasDiagType_t  diag,
+                                                    const int          m[],
+                                                    const int          n[],
+                                                    const float*       alpha,
+                                                    const float* const A[],
+                                                    const int          lda[],
+                                                    float* const       B[],
+                                                    const int          ldb[],
+                                                    int                batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtrsmVbatched(hipblasHandle_t     handle,
+                                                    hipblasSideMode_t   side,
+                                                    hipblasFillMode_t   uplo,
+                                                    hipblasOperation_t  transA,
+                                                    hipblasDiagType_t   diag,
+                                                    const int           m[],
+                                                    const int           n[],
+                                                    const double*       alpha,
+                                                    const double* const A[],
+                                                    const int           lda[],
+                                                    double* const       B[],
+                                                    const int           ldb[],
+                                                    int                 batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtrsmVbatched(hipblasHandle_t             handle,
+                                                    hipblasSideMode_t           side,
+                                                    hipblasFillMode_t           uplo,
+                                                    hipblasOperation_t          transA,
+                                                    hipblasDiagType_t           diag,
+                                                    const int                   m[],
+                                                    const int                   n[],
+                                                    const hipblasComplex*       alpha,
+                                                    const hipblasComplex* const A[],
+                                                    const int                   lda[],
+                                                    hipblasComplex* const       B[],
+                                                    const int                   ldb[],
+                                                    int                         batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtrsmVbatched(hipblasHandle_t                   handle,
+                                                    hipblasSideMode_t                 side,
+                                                    hipblasFillMode_t                 uplo,
+                                                    hipblasOperation_t                transA,
+                                                    hipblasDiagType_t                 diag,
+                                                    const int                         m[],
+                                                    const int                         n[],
+                                                    const hipblasDoubleComplex*       alpha,
+                                                    const hipblasDoubleComplex* const A[],
+                                                    const int                         lda[],
+                                                    hipblasDoubleComplex* const       B[],
+                                                    const int                         ldb[],
+                                                    int                               batch_count);
+
+// nrm2_vbatched: the 2-norms of batch_count vectors of their own lengths, and the 2-norm of all
+// of them together, such as the global norm of a model's gradients. n, incx and the pointer array
+// x are device arrays as for gemv_vbatched, x following the handle's pointer array mode; norms,
+// which may be null, and result are always in device memory, whatever the pointer mode, so the
+// norm never makes the host wait and can be read by the kernel that clips by it. An entry with
+// n[b] <= 0 or incx[b] <= 0 has norm 0, as in nrm2. The whole batch is cut into chunks of about
+// the same length, whatever the entries' lengths, and reduced in two launches
+HIPBLAS_EXPORT hipblasStatus_t hipblasSnrm2Vbatched(hipblasHandle_t    handle,
+                                                    const int          n[],
+                                                    const float* const x[],
+                                                    const int          incx[],
+                                                    int                batch_count,
+                                                    float*             norms,
+                                                    float*             result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDnrm2Vbatched(hipblasHandle_t     handle,
+                                                    const int           n[],
+                                                    const double* const x[],
+                                                    const int           incx[],
+                                                    int                 batch_count,
+                                                    double*             norms,
+                                                    double*             result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasScnrm2Vbatched(hipblasHandle_t             handle,
+                                                     const int                   n[],
+                                                     const hipblasComplex* const x[],
+                                                     const int                   incx[],
+                                                     int                         batch_count,
+                                                     float*                      norms,
+                                                     float*                      result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDznrm2Vbatched(hipblasHandle_t                   handle,
+                                                     const int                         n[],
+                                                     const hipblasDoubleComplex* const x[],
+                                                     const int                         incx[],
+                                                     int                               batch_count,
+                                                     double*                           norms,
+                                                     double*                           result);
+
+// job_list: runs job_count independent axpy, gemv and gemm jobs of any shapes with one kernel
+// launch on the handle's stream. jobs is a host array, copied before the call returns; the jobs
+// must not write memory another job of the list reads or writes, since they run in no particular
+// order. Small jobs are where this pays off: each launch of a separate call then costs more than
+// its work. Not available in HIPBLAS_CAPTURE_MODE_SAFE, since the list is uploaded from a staging
+// slot the next calls reuse
+HIPBLAS_EXPORT hipblasStatus_t hipblasSJobList(hipblasHandle_t     handle,
+                                               const hipblasJob_t* jobs,
+                                               int                 job_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDJobList(hipblasHandle_t     handle,
+                                               const hipblasJob_t* jobs,
+                                               int                 job_count);
+
+// gemm_xt, syrk_xt and trsm_xt: gemm, syrk and trsm on host matrices too large for the device. A, B
+// and C are host memory and alpha and beta host scalars, whatever the pointer mode. C is split into
+// tiles of hipblasXtSetBlockDim elements a side (2048 by default) and k into blocks of that depth;
+// the tiles are packed into pinned buffers and streamed through three streams per device, so
+// packing, the copies each way and the gemms of different tiles overlap. syrk updates only the uplo
+// triangle of C. trsm solves B in panels, a panel at a time on each stream. The calls return once
+// C, or B for trsm, holds the result; they order after the handle's stream but do not run on it
+HIPBLAS_EXPORT hipblasStatus_t hipblasXtSetBlockDim(hipblasHandle_t handle, int block_dim);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasXtGetBlockDim(hipblasHandle_t handle, int* block_dim);
+
+// Devices the Xt functions spread their tiles over, each fed by its own host thread, with tiles
+// handed out as devices finish earlier ones; n_devices == 0 goes back to the device current at
+// each call. Operands are staged through host memory, never copied between devices
+HIPBLAS_EXPORT hipblasStatus_t hipblasXtDeviceSelect(hipblasHandle_t handle,
+                                                     int             n_devices,
+                                                     const int       devices[]);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasXtSgemm(hipblasHandle_t    handle,
+                                              hipblasOperation_t transa,
+                                              hipblasOperation_t transb,
+                                              int64_t            m,
+                                              int64_t            n,
+                                              int64_t            k,
+                                              const float*       alpha,
+                                              const float*       A,
+                                              int64_t            lda,
+                                              const float*       B,
+                                              int64_t            ldb,
+                                              const float*       beta,
+                                              float*             C,
+                                              int64_t            ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasXtDgemm(hipblasHandle_t    handle,
+                                              hipblasOperation_t transa,
+                                              hipblasOperation_t transb,
+                                              int64_t            m,
+                                              int64_t            n,
+                                              int64_t            k,
+                                              const double*      alpha,
+                                              const double*      A,
+                                              int64_t            lda,
+                                              const double*      B,
+                                              int64_t            ldb,
+                                              const double*      beta,
+                                              double*            C,
+                                              int64_t            ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasXtCgemm(hipblasHandle_t       handle,
+                                              hipblasOperation_t    transa,
+                                              hipblasOperation_t    transb,
+                                              int64_t               m,
+                                              int64_t               n,
+                                              int64_t               k,
+                                              const hipblasComplex* alpha,
+                                              const hipblasComplex* A,
+                                              int64_t               lda,
+                                              const hipblasComplex* B,
+                                              int64_t               ldb,
+                                              const hipblasComplex* beta,
+                                              hipblasComplex*       C,
+                                              int64_t               ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasXtZgemm(hipblasHandle_t             handle,
+                                              hipblasOperation_t          transa,
+                                              hipblasOperation_t          transb,
+                                              int64_t                     m,
+                                              int64_t                     n,
+                                              int64_t                     k,
+                                              const hipblasDoubleComplex* alpha,
+                                              const hipblasDoubleComplex* A,
+                                              int64_t                     lda,
+                                              const hipblasDoubleComplex* B,
+                                              int64_t                     ldb,
+                                              const hipblasDoubleComplex* beta,
+                                              hipblasDoubleComplex*       C,
+                                              int64_t                     ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasXtSsyrk(hipblasHandle_t    handle,
+                                              hipblasFillMode_t  uplo,
+                                              hipblasOperation_t transA,
+                                              int64_t            n,
+                                              int64_t            k,
+                                              const float*       alpha,
+                                              const float*       A,
+                                              int64_t            lda,
+                                              const float*       beta,
+                                              float*             C,
+                                              int64_t            ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasXtDsyrk(hipblasHandle_t    handle,
+                                              hipblasFillMode_t  uplo,
+                                              hipblasOperation_t transA,
+                                              int64_t            n,
+                                              int64_t            k,
+                                              const double*      alpha,
+                                              const double*      A,
+                                              int64_t            lda,
+                                              const double*      beta,
+                                              double*            C,
+                                              int64_t            ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasXtCsyrk(hipblasHandle_t       handle,
+                                              hipblasFillMode_t     uplo,
+                                              hipblasOperation_t    transA,
+                                              int64_t               n,
+                                              int64_t               k,
+                                              const hipblasComplex* alpha,
+                                              const hipblasComplex* A,
+                                              int64_t               lda,
+                                              const hipblasComplex* beta,
+                                              hipblasComplex*       C,
+                                              int64_t               ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasXtZsyrk(hipblasHandle_t             handle,
+                                              hipblasFillMode_t           uplo,
+                                              hipblasOperation_t          transA,
+                                              int64_t                     n,
+                                              int64_t                     k,
+                                              const hipblasDoubleComplex* alpha,
+                                              const hipblasDoubleComplex* A,
+                                              int64_t                     lda,
+                                              const hipblasDoubleComplex* beta,
+                                              hipblasDoubleComplex*       C,
+                                              int64_t                     ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasXtStrsm(hipblasHandle_t    handle,
+                                              hipblasSideMode_t  side,
+                                              hipblasFillMode_t  uplo,
+                                              hipblasOperation_t transA,
+                                              hipblasDiagType_t  diag,
+                                              int64_t            m,
+                                              int64_t            n,
+                                              const float*       alpha,
+                                              const float*       A,
+                                              int64_t            lda,
+                                              float*             B,
+                                              int64_t            ldb);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasXtDtrsm(hipblasHandle_t    handle,
+                                              hipblasSideMode_t  side,
+                                              hipblasFillMode_t  uplo,
+                                              hipblasOperation_t transA,
+                                              hipblasDiagType_t  diag,
+                                              int64_t            m,
+                                              int64_t            n,
+                                              const double*      alpha,
+                                              const double*      A,
+                                              int64_t            lda,
+                                              double*            B,
+                                              int64_t            ldb);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasXtCtrsm(hipblasHandle_t       handle,
+                                              hipblasSideMode_t     side,
+                                              hipblasFillMode_t     uplo,
+                                              hipblasOperation_t    transA,
+                                              hipblasDiagType_t     diag,
+                                              int64_t               m,
+                                              int64_t               n,
+                                              const hipblasComplex* alpha,
+                                              const hipblasComplex* A,
+                                              int64_t               lda,
+                                              hipblasComplex*       B,
+                                              int64_t               ldb);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasXtZtrsm(hipblasHandle_t             handle,
+                                              hipblasSideMode_t           side,
+                                              hipblasFillMode_t           uplo,
+                                              hipblasOperation_t          transA,
+                                              hipblasDiagType_t           diag,
+                                              int64_t                     m,
+                                              int64_t                     n,
+                                              const hipblasDoubleComplex* alpha,
+                                              const hipblasDoubleComplex* A,
+                                              int64_t                     lda,
+                                              hipblasDoubleComplex*       B,
+                                              int64_t                     ldb);
+
+// gemmex
+// The gemmex functions also take one real and one complex operand: a_type or b_type R_32F and the
+// other, with c_type, C_32F, or the same in double precision, with compute_type either type of
+// that precision and complex alpha and beta. The real operand is read at its own size
+HIPBLAS_EXPORT hipblasStatus_t hipblasGemmEx(hipblasHandle_t    handle,
+                                             hipblasOperation_t trans_a,
+                                             hipblasOperation_t trans_b,
+                                             int                m,
+                                             int                n,
+                                             int                k,
+                                             const void*        alpha,
+                                             const void*        a,
+                                             hipblasDatatype_t  a_type,
+                                             int                lda,
+                                             const void*        b,
+                                             hipblasDatatype_t  b_type,
+                                             int                ldb,
+                                             const void*        beta,
+                                             void*              c,
+                                             hipblasDatatype_t  c_type,
+                                             int                ldc,
+                                             hipblasDatatype_t  compute_type,
+                                             hipblasGemmAlgo_t  algo);
+
+// gemmex with an explicit backend solution, hipblasGemmFlags_t flags and a caller-provided
+// device workspace. solution_index selects a rocBLAS solution (0 = heuristic); cuBLAS selects
+// through algo and ignores solution_index and workspace.
+HIPBLAS_EXPORT hipblasStatus_t hipblasGemmExWithSolution(hipblasHandle_t    handle,
+                                                         hipblasOperation_t trans_a,
+                                                         hipblasOperation_t trans_b,
+                                                         int                m,
+                                                         int                n,
+                                                         int                k,
+                                                         const void*        alpha,
+                                                         const void*        a,
+                                                         hipblasDatatype_t  a_type,
+                                                         int                lda,
+                                                         const void*        b,
+                                                         hipblasDatatype_t  b_type,
+                                                         int                ldb,
+                                                         const void*        beta,
+                                                         void*              c,
+                                                         hipblasDatatype_t  c_type,
+                                                         int                ldc,
+                                                         hipblasDatatype_t  compute_type,
+                                                         hipblasGemmAlgo_t  algo,
+                                                         int32_t            solution_index,
+                                                         uint32_t           flags,
+                                                         size_t             workspace_size,
+                                                         void*              workspace);
+
+// gemmex followed by the epilogue in one call. The epilogue makes a single pass over C and supports
+// R_16F, R_32F and R_64F results; a null epilogue is a plain hipblasGemmEx
+HIPBLAS_EXPORT hipblasStatus_t hipblasGemmExWithEpilogue(hipblasHandle_t              handle,
+                                                         hipblasOperation_t           trans_a,
+                                                         hipblasOperation_t           trans_b,
+                                                         int                          m,
+                                                         int                          n,
+                                                         int                          k,
+                                                         const void*                  alpha,
+                                                         const void*                  a,
+                                                         hipblasDatatype_t            a_type,
+                                                         int                          lda,
+                                                         const void*                  b,
+                                                         hipblasDatatype_t            b_type,
+                                                         int                          ldb,
+                                                         const void*                  beta,
+                                                         void*                        c,
+                                                         hipblasDatatype_t            c_type,
+                                                         int                          ldc,
+                                                         hipblasDatatype_t            compute_type,
+                                                         hipblasGemmAlgo_t            algo,
+                                                         const hipblasGemmEpilogue_t* epilogue);
+
+// A gemmex problem, with an optional epilogue, validated and resolved once for repeated execution.
+// Create checks everything hipblasGemmExWithEpilogue would and looks up the tuned algo and
+// solution; Execute then launches the gemm on new operands and scalars, in the handle's pointer
+// mode, with no further lookup. The epilogue is copied, its bias and aux pointers included. A plan
+// is used with the handle it was made on, which must outlive it; changing the handle's math mode,
+// split-k hint, gemm backend or tuning table after Create takes the full hipblasGemmEx path
+HIPBLAS_EXPORT hipblasStatus_t hipblasGemmPlanCreate(hipblasHandle_t              handle,
+                                                     const hipblasGemmShape_t*    shape,
+                                                     int                          lda,
+                                                     int                          ldb,
+                                                     int                          ldc,
+                                                     hipblasGemmAlgo_t            algo,
+                                                     const hipblasGemmEpilogue_t* epilogue,
+                                                     hipblasGemmPlan_t*           plan);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasGemmPlanExecute(hipblasGemmPlan_t plan,
+                                                      const void*       A,
+                                                      const void*       B,
+                                                      void*             C,
+                                                      const void*       alpha,
+                                                      const void*       beta);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasGemmPlanDestroy(hipblasGemmPlan_t plan);
+
+// A gemm plan of a kernel compiled at run time, with hipRTC or NVRTC on CUDA, for its one shape,
+// transposes, leading dimensions and real types, so odd k and extreme aspect ratios get a tiling
+// of their own. epilogue_code, when not null, is the body of a device function
+// void epilogue(S& v, int i, int j) applied to each v = alpha op(A) op(B) + beta C before it is
+// stored to C(i, j), S being float for HIPBLAS_R_32F compute and double for HIPBLAS_R_64F. A, B
+// and C are HIPBLAS_R_16F, HIPBLAS_R_16B, HIPBLAS_R_32F or HIPBLAS_R_64F, A and B of one type.
+// The code objects are kept for the process and on disk, under HIPBLAS_JIT_CACHE_PATH or else
+// $XDG_CACHE_HOME/hipblas/jit or $HOME/.cache/hipblas/jit, keyed by the generated source and the
+// device architecture, so only the first process to build a kernel compiles it. Code that does
+// not compile gives HIPBLAS_STATUS_INVALID_VALUE, with the compiler log on stderr. The plan runs
+// with hipblasGemmPlanExecute in the handle's pointer mode, whatever its math mode and backend.
+// Returns HIPBLAS_STATUS_NOT_SUPPORTED unless hipBLAS was built with BUILD_WITH_RTC
+HIPBLAS_EXPORT hipblasStatus_t hipblasGemmPlanCreateJit(hipblasHandle_t           handle,
+                                                        const hipblasGemmShape_t* shape,
+                                                        int                       lda,
+                                                        int                       ldb,
+                                                        int                       ldc,
+                                                        const char*               epilogue_code,
+                                                        hipblasGemmPlan_t*        plan);
+
+// Constant B operands, such as inference weights, transformed once for many gemms. Pack copies
+// op(B), k x n, into a buffer the library allocates on the handle's device, converted to
+// packed_type and with any conjugation applied. Each hipblasGemmPackedEx then reads it
+// untransposed, column by column: the columns are k-contiguous, 128-byte aligned and a leading
+// dimension apart that hipblasGetOptimalLeadingDimension picks, which is the layout both backends
+// stream fastest in the small-m gemms of decode batches. A conversion takes the types
+// hipblasTransposeEx does; an untransposed copy in b_type takes any type. Pack is ordered on the
+// handle's stream, so B may be changed once that work completes
+HIPBLAS_EXPORT hipblasStatus_t hipblasGemmPack(hipblasHandle_t      handle,
+                                               hipblasOperation_t   transB,
+                                               int                  k,
+                                               int                  n,
+                                               const void*          B,
+                                               hipblasDatatype_t    b_type,
+                                               int                  ldb,
+                                               hipblasDatatype_t    packed_type,
+                                               hipblasGemmPacked_t* packed);
+
+// hipblasGemmEx with the packed operand as B, its k and n the gemm's, on a handle of the device
+// it was packed on
+HIPBLAS_EXPORT hipblasStatus_t hipblasGemmPackedEx(hipblasHandle_t     handle,
+                                                   hipblasOperation_t  transA,
+                                                   int                 m,
+                                                   const void*         alpha,
+                                                   const void*         A,
+                                                   hipblasDatatype_t   a_type,
+                                                   int                 lda,
+                                                   hipblasGemmPacked_t packed,
+                                                   const void*         beta,
+                                                   void*               C,
+                                                   hipblasDatatype_t   c_type,
+                                                   int                 ldc,
+                                                   hipblasDatatype_t   compute_type,
+                                                   hipblasGemmAlgo_t   algo);
+
+// Frees the packed buffer, which gemms still using it must have finished with
+HIPBLAS_EXPORT hipblasStatus_t hipblasGemmPackDestroy(hipblasGemmPacked_t packed);
+
+// gemmex on fp8 operands with per-tensor scaling, writing D rather than C. A and B are R_8F_E4M3 or
+// R_8F_E5M2, C is R_16F, R_16B or R_32F, D is either fp8 type or c_type, and compute_type is R_32F
+// with float alpha and beta. Values outside the range of an fp8 D saturate. The gemm runs in
+// cuBLASLt where it has a kernel for the problem, otherwise through fp32 with the handle workspace
+// holding the converted operands
+HIPBLAS_EXPORT hipblasStatus_t hipblasGemmExWithScales(hipblasHandle_t            handle,
+                                                       hipblasOperation_t         trans_a,
+                                                       hipblasOperation_t         trans_b,
+                                                       int                        m,
+                                                       int                        n,
+                                                       int                        k,
+                                                       const void*                alpha,
+                                                       const void*                a,
+                                                       hipblasDatatype_t          a_type,
+                                                       int                        lda,
+                                                       const void*                b,
+                                                       hipblasDatatype_t          b_type,
+                                                       int                        ldb,
+                                                       const void*                beta,
+                                                       const void*                c,
+                                                       hipblasDatatype_t          c_type,
+                                                       int                        ldc,
+                                                       void*                      d,
+                                                       hipblasDatatype_t          d_type,
+                                                       int                        ldd,
+                                                       hipblasDatatype_t          compute_type,
+                                                       hipblasGemmAlgo_t          algo,
+                                                       const hipblasGemmScales_t* scales);
+
+// int8 gemmex writing int8, C = requantized op(A) op(B) as requant describes. A, B and C are R_8I;
+// the int32 accumulator is scaled, biased and saturated in registers and never stored, so C is
+// a quarter of the bytes of the int32 result of hipblasGemmEx
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasGemmExWithRequantization(hipblasHandle_t                handle,
+                                    hipblasOperation_t             trans_a,
+                                    hipblasOperation_t             trans_b,
+                                    int                            m,
+                                    int                            n,
+                                    int                            k,
+                                    const void*                    a,
+                                    int                            lda,
+                                    const void*                    b,
+                                    int                            ldb,
+                                    void*                          c,
+                                    int                            ldc,
+                                    const hipblasRequantization_t* requant);
+
+// gemmex on weight-only quantized B, C = alpha op(A) B + beta C, dequantizing B as quant describes
+// while it is read, so compressed weights stream straight into the product with no full-precision
+// copy. Sized for serving, where m is a small batch of activations and the gemm is bound by
+// reading B once. A is R_16F, R_16B or R_32F, C is a_type or R_32F, and compute_type is R_32F
+// with float alpha and beta. B is k x n and untransposed, with ldb counted in values, even for
+// the 4-bit formats so that every column starts on a byte. The strided batched form takes
+// stride_scales between the batches' scales and zeros; a stride of 0 shares an operand, as
+// weights usually are
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasGemmQuantizedEx(hipblasHandle_t                    handle,
+                           hipblasOperation_t                 trans_a,
+                           int                                m,
+                           int                                n,
+                           int                                k,
+                           const void*                        alpha,
+                           const void*                        a,
+                           hipblasDatatype_t                  a_type,
+                           int                                lda,
+                           const void*                        b,
+                           int                                ldb,
+                           const hipblasWeightQuantization_t* quant,
+                           const void*                        beta,
+                           void*                              c,
+                           hipblasDatatype_t                  c_type,
+                           int                                ldc,
+                           hipblasDatatype_t                  compute_type);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasGemmQuantizedStridedBatchedEx(hipblasHandle_t                    handle,
+                                         hipblasOperation_t                 trans_a,
+                                         int                                m,
+                                         int                                n,
+                                         int                                k,
+                                         const void*                        alpha,
+                                         const void*                        a,
+                                         hipblasDatatype_t                  a_type,
+                                         int                                lda,
+                                         long long                          stride_a,
+                                         const void*                        b,
+                                         int                                ldb,
+                                         long long                          stride_b,
+                                         const hipblasWeightQuantization_t* quant,
+                                         long long                          stride_scales,
+                                         const void*                        beta,
+                                         void*                              c,
+                                         hipblasDatatype_t                  c_type,
+                                         int                                ldc,
+                                         long long                          stride_c,
+                                         int                                batch_count,
+                                         hipblasDatatype_t                  compute_type);
+
+// sparse24: 2:4 structured sparsity for pruned weights. prune24 overwrites P with op(A), m x k,
+// keeping the two values of largest magnitude in each group of four along a row and zeroing the
+// rest, the lower position winning ties. compress24 does the same selection and stores the kept
+// values in the compressed form of hipblasSparse24Matrix_t, so a matrix already 2:4 sparse is
+// packed unchanged. k is a multiple of 4 and the type is R_16F, R_16B or R_32F
+HIPBLAS_EXPORT hipblasStatus_t hipblasSparsePrune24(hipblasHandle_t    handle,
+                                                    hipblasOperation_t trans_a,
+                                                    int                m,
+                                                    int                k,
+                                                    const void*        a,
+                                                    hipblasDatatype_t  type,
+                                                    int                lda,
+                                                    void*              p,
+                                                    int                ldp);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSparseCompress24(hipblasHandle_t                handle,
+                                                       hipblasOperation_t             trans_a,
+                                                       int                            m,
+                                                       int                            k,
+                                                       const void*                    a,
+                                                       hipblasDatatype_t              type,
+                                                       int                            lda,
+                                                       const hipblasSparse24Matrix_t* compressed);
+
+// gemmex with a 2:4 sparse A, C = alpha A op(B) + beta C for the compressed A from
+// hipblasSparseCompress24. Only the kept half of A is read and multiplied, halving A's traffic and
+// the multiply-adds. A and B are of a_type, R_16F, R_16B or R_32F, C is a_type or R_32F, and
+// compute_type is R_32F with float alpha and beta
+HIPBLAS_EXPORT hipblasStatus_t hipblasSparseGemm24Ex(hipblasHandle_t                handle,
+                                                     hipblasOperation_t             trans_b,
+                                                     int                            m,
+                                                     int                            n,
+                                                     int                            k,
+                                                     const void*                    alpha,
+                                                     const hipblasSparse24Matrix_t* a,
+                                                     hipblasDatatype_t              a_type,
+                                                     const void*                    b,
+                                                     int                            ldb,
+                                                     const void*                    beta,
+                                                     void*                          c,
+                                                     hipblasDatatype_t              c_type,
+                                                     int                            ldc,
+                                                     hipblasDatatype_t              compute_type);
+
+// amax_quantize: one pass over the m x n matrix A, of type R_16F, R_16B or R_32F, that stores the
+// largest |A(i, j)| to amax and, when Q is set, Q(i, j) = scale * A(i, j) rounded to nearest even
+// in q_type, R_8F_E4M3, R_8F_E5M2 or R_8I. Values outside the range of q_type saturate, int8 to
+// [-127, 127], and NaNs are skipped by amax. amax and scale are device floats, one per matrix in
+// HIPBLAS_AMAX_PER_TENSOR mode and m per matrix, amax[b * m + i] for row i of batch b, in
+// HIPBLAS_AMAX_PER_ROW mode; a null scale means 1 and a null amax skips it. Taking scale from the
+// previous step's amax, as with hipblasGemmScales_t::amax_d, keeps quantization to the one pass
+HIPBLAS_EXPORT hipblasStatus_t hipblasAmaxQuantize(hipblasHandle_t   handle,
+                                                   hipblasAmaxMode_t mode,
+                                                   int               m,
+                                                   int               n,
+                                                   const void*       A,
+                                                   hipblasDatatype_t a_type,
+                                                   int               lda,
+                                                   const float*      scale,
+                                                   void*             Q,
+                                                   hipblasDatatype_t q_type,
+                                                   int               ldq,
+                                                   float*            amax);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasAmaxQuantizeBatched(hipblasHandle_t   handle,
+                                                          hipblasAmaxMode_t mode,
+                                                          int               m,
+                                                          int               n,
+                                                          const void* const A[],
+                                                          hipblasDatatype_t a_type,
+                                                          int               lda,
+                                                          const float*      scale,
+                                                          void* const       Q[],
+                                                          hipblasDatatype_t q_type,
+                                                          int               ldq,
+                                                          float*            amax,
+                                                          int               batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasAmaxQuantizeStridedBatched(hipblasHandle_t   handle,
+                                                                 hipblasAmaxMode_t mode,
+                                                                 int               m,
+                                                                 int               n,
+                                                                 const void*       A,
+                                                                 hipblasDatatype_t a_type,
+                                                                 int               lda,
+                                                                 long long         stride_A,
+                                                                 const float*      scale,
+                                                                 void*             Q,
+                                                                 hipblasDatatype_t q_type,
+                                                                 int               ldq,
+                                                                 long long         stride_Q,
+                                                                 float*            amax,
+                                                                 int               batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasGemmBatchedEx(hipblasHandle_t    handle,
+                                                    hipblasOperation_t trans_a,
+                                                    hipblasOperation_t trans_b,
+                                                    int                m,
+                                                    int                n,
+                                                    int                k,
+                                                    const void*        alpha,
+                                                    const void*        a[],
+                                                    hipblasDatatype_t  a_type,
+                                                    int                lda,
+                                                    const void*        b[],
+                                                    hipblasDatatype_t  b_type,
+                                                    int                ldb,
+                                                    const void*        beta,
+                                                    void*              c[],
+                                                    hipblasDatatype_t  c_type,
+                                                    int                ldc,
+                                                    int                batch_count,
+                                                    hipblasDatatype_t  compute_type,
+                                                    hipblasGemmAlgo_t  algo);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasGemmStridedBatchedEx(hipblasHandle_t    handle,
+                                                           hipblasOperation_t trans_a,
+                                                           hipblasOperation_t trans_b,
+                                                           int                m,
+                                                           int                n,
+                                                           int                k,
+                                                           const void*        alpha,
+                                                           const void*        a,
+                                                           hipblasDatatype_t  a_type,
+                                                           int                lda,
+                                                           long long          stride_A,
+                                                           const void*        b,
+                                                           hipblasDatatype_t  b_type,
+                                                           int                ldb,
+                                                           long long          stride_B,
+                                                           const void*        beta,
+                                                           void*              c,
+                                                           hipblasDatatype_t  c_type,
+                                                           int                ldc,
+                                                           long long          stride_C,
+                                                           int                batch_count,
+                                                           hipblasDatatype_t  compute_type,
+                                                           hipblasGemmAlgo_t  algo);
+
+// gemmex writing D = alpha op(A) op(B) + beta C to its own matrix, leaving C unchanged. d_type must
+// be c_type. rocBLAS computes D directly; cuBLAS does through cuBLASLt where it has an algorithm
+// for the problem and otherwise copies C to D and updates D in place. When D is C with ldd == ldc
+// and stride_D == stride_C these are the plain Ex functions; D must not otherwise overlap C. The
+// BF16X3 and INT8_FP64 math modes are only honoured in place
+HIPBLAS_EXPORT hipblasStatus_t hipblasGemmExWithD(hipblasHandle_t    handle,
+                                                  hipblasOperation_t trans_a,
+                                                  hipblasOperation_t trans_b,
+                                                  int                m,
+                                                  int                n,
+                                                  int                k,
+                                                  const void*        alpha,
+                                                  const void*        a,
+                                                  hipblasDatatype_t  a_type,
+                                                  int                lda,
+                                                  const void*        b,
+                                                  hipblasDatatype_t  b_type,
+                                                  int                ldb,
+                                                  const void*        beta,
+                                                  const void*        c,
+                                                  hipblasDatatype_t  c_type,
+                                                  int                ldc,
+                                                  void*              d,
+                                                  hipblasDatatype_t  d_type,
+                                                  int                ldd,
+                                                  hipblasDatatype_t  compute_type,
+                                                  hipblasGemmAlgo_t  algo);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasGemmBatchedExWithD(hipblasHandle_t    handle,
+                                                         hipblasOperation_t trans_a,
+                                                         hipblasOperation_t trans_b,
+                                                         int                m,
+                                                         int                n,
+                                                         int                k,
+                                                         const void*        alpha,
+                                                         const void*        a[],
+                                                         hipblasDatatype_t  a_type,
+                                                         int                lda,
+                                                         const void*        b[],
+                                                         hipblasDatatype_t  b_type,
+                                                         int                ldb,
+                                                         const void*        beta,
+                                                         const void*        c[],
+                                                         hipblasDatatype_t  c_type,
+                                                         int                ldc,
+                                                         void*              d[],
+                                                         hipblasDatatype_t  d_type,
+                                                         int                ldd,
+                                                         int                batch_count,
+                                                         hipblasDatatype_t  compute_type,
+                                                         hipblasGemmAlgo_t  algo);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasGemmStridedBatchedExWithD(hipblasHandle_t    handle,
+                                                                hipblasOperation_t trans_a,
+                                                                hipblasOperation_t trans_b,
+                                                                int                m,
+                                                                int                n,
+                                                                int                k,
+                                                                const void*        alpha,
+                                                                const void*        a,
+                                                                hipblasDatatype_t  a_type,
+                                                                int                lda,
+                                                                long long          stride_A,
+                                                                const void*        b,
+                                                                hipblasDatatype_t  b_type,
+                                                                int                ldb,
+                                                                long long          stride_B,
+                                                                const void*        beta,
+                                                                const void*        c,
+                                                                hipblasDatatype_t  c_type,
+                                                                int                ldc,
+                                                                long long          stride_C,
+                                                                void*              d,
+                                                                hipblasDatatype_t  d_type,
+                                                                int                ldd,
+                                                                long long          stride_D,
+                                                                int                batch_count,
+                                                                hipblasDatatype_t  compute_type,
+                                                                hipblasGemmAlgo_t  algo);
+
+// gemvex: y = alpha op(A) x + beta y with half or bfloat16 A and x, y of the same type or
+// float, and float alpha, beta and arithmetic (compute_type HIPBLAS_R_32F). Other type
+// combinations return HIPBLAS_STATUS_NOT_SUPPORTED.
+HIPBLAS_EXPORT hipblasStatus_t hipblasGemvEx(hipblasHandle_t    handle,
+                                             hipblasOperation_t trans,
+                                             int                m,
+                                             int                n,
+                                             const void*        alpha,
+                                             const void*        A,
+                                             hipblasDatatype_t  a_type,
+                                             int                lda,
+                                             const void*        x,
+                                             hipblasDatatype_t  x_type,
+                                             int                incx,
+                                             const void*        beta,
+                                             void*              y,
+                                             hipblasDatatype_t  y_type,
+                                             int                incy,
+                                             hipblasDatatype_t  compute_type);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasGemvBatchedEx(hipblasHandle_t    handle,
+                                                    hipblasOperation_t trans,
+                                                    int                m,
+                                                    int                n,
+                                                    const void*        alpha,
+                                                    const void*        A[],
+                                                    hipblasDatatype_t  a_type,
+                                                    int                lda,
+                                                    const void*        x[],
+                                                    hipblasDatatype_t  x_type,
+                                                    int                incx,
+                                                    const void*        beta,
+                                                    void*              y[],
+                                                    hipblasDatatype_t  y_type,
+                                                    int                incy,
+                                                    int                batch_count,
+                                                    hipblasDatatype_t  compute_type);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasGemvStridedBatchedEx(hipblasHandle_t    handle,
+                                                           hipblasOperation_t trans,
+                                                           int                m,
+                                                           int                n,
+                                                           const void*        alpha,
+                                                           const void*        A,
+                                                           hipblasDatatype_t  a_type,
+                                                           int                lda,
+                                                           long long          stride_A,
+                                                           const void*        x,
+                                                           hipblasDatatype_t  x_type,
+                                                           int                incx,
+                                                           long long          stride_x,
+                                                           const void*        beta,
+                                                           void*              y,
+                                                           hipblasDatatype_t  y_type,
+                                                           int                incy,
+                                                           long long          stride_y,
+                                                           int                batch_count,
+                                                           hipblasDatatype_t  compute_type);
+
+// syrkex, herkex: the uplo triangle of C = alpha op(A) op(A)^T + beta C, or op(A) op(A)^H with
+// herk, for the A, C and compute types hipblasGemmEx takes, so fp16, bf16 and int8 updates run on
+// its kernels. herk takes complex A and C, HIPBLAS_C_32F or HIPBLAS_C_64F compute, real alpha and
+// beta of the compute precision, and leaves the imaginary parts of C's diagonal zero. The diagonal
+// blocks are computed in the handle workspace. herk with device scalars reads them back, so it is
+// not available in HIPBLAS_CAPTURE_MODE_SAFE or with a per-batch scalar stride
+HIPBLAS_EXPORT hipblasStatus_t hipblasSyrkEx(hipblasHandle_t    handle,
+                                             hipblasFillMode_t  uplo,
+                                             hipblasOperation_t trans,
+                                             int                n,
+                                             int                k,
+                                             const void*        alpha,
+                                             const void*        A,
+                                             hipblasDatatype_t  a_type,
+                                             int                lda,
+                                             const void*        beta,
+                                             void*              C,
+                                             hipblasDatatype_t  c_type,
+                                             int                ldc,
+                                             hipblasDatatype_t  compute_type);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSyrkBatchedEx(hipblasHandle_t    handle,
+                                                    hipblasFillMode_t  uplo,
+                                                    hipblasOperation_t trans,
+                                                    int                n,
+                                                    int                k,
+                                                    const void*        alpha,
+                                                    const void*        A[],
+                                                    hipblasDatatype_t  a_type,
+                                                    int                lda,
+                                                    const void*        beta,
+                                                    void*              C[],
+                                                    hipblasDatatype_t  c_type,
+                                                    int                ldc,
+                                                    int                batch_count,
+                                                    hipblasDatatype_t  compute_type);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasSyrkStridedBatchedEx(hipblasHandle_t    handle,
+                                                           hipblasFillMode_t  uplo,
+                                                           hipblasOperation_t trans,
+                                                           int                n,
+                                                           int                k,
+                                                           const void*        alpha,
+                                                           const void*        A,
+                                                           hipblasDatatype_t  a_type,
+                                                           int                lda,
+                                                           long long          stride_A,
+                                                           const void*        beta,
+                                                           void*              C,
+                                                           hipblasDatatype_t  c_type,
+                                                           int                ldc,
+                                                           long long          stride_C,
+                                                           int                batch_count,
+                                                           hipblasDatatype_t  compute_type);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasHerkEx(hipblasHandle_t    handle,
+                                             hipblasFillMode_t  uplo,
+                                             hipblasOperation_t trans,
+                                             int                n,
+                                             int                k,
+                                             const void*        alpha,
+                                             const void*        A,
+                                             hipblasDatatype_t  a_type,
+                                             int                lda,
+                                             const void*        beta,
+                                             void*              C,
+                                             hipblasDatatype_t  c_type,
+                                             int                ldc,
+                                             hipblasDatatype_t  compute_type);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasHerkBatchedEx(hipblasHandle_t    handle,
+                                                    hipblasFillMode_t  uplo,
+                                                    hipblasOperation_t trans,
+                                                    int                n,
+                                                    int                k,
+                                                    const void*        alpha,
+                                                    const void*        A[],
+                                                    hipblasDatatype_t  a_type,
+                                                    int                lda,
+                                                    const void*        beta,
+                                                    void*              C[],
+                                                    hipblasDatatype_t  c_type,
+                                                    int                ldc,
+                                                    int                batch_count,
+                                                    hipblasDatatype_t  compute_type);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasHerkStridedBatchedEx(hipblasHandle_t    handle,
+                                                           hipblasFillMode_t  uplo,
+                                                           hipblasOperation_t trans,
+                                                           int                n,
+                                                           int                k,
+                                                           const void*        alpha,
+                                                           const void*        A,
+                                                           hipblasDatatype_t  a_type,
+                                                           int                lda,
+                                                           long long          stride_A,
+                                                           const void*        beta,
+                                                           void*              C,
+                                                           hipblasDatatype_t  c_type,
+                                                           int                ldc,
+                                                           long long          stride_C,
+                                                           int                batch_count,
+                                                           hipblasDatatype_t  compute_type);
+
+// trsmex: solves op(A) X = alpha B, or X op(A) = alpha B, with the inverses of the diagonal blocks
+// of A supplied in invA, so repeated solves against the same A skip the inversion. invA holds
+// HIPBLAS_TRSM_EX_BLOCK * k elements, k = m for a left side and n for a right side, and is
+// computed once by hipblasTrsmExInvA; strided-batched solves take one invA per matrix, stride_invA
+// apart. cuBLAS has no such path: it ignores invA, and the helper only validates its arguments.
+#define HIPBLAS_TRSM_EX_BLOCK 128
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasTrsmExInvA(hipblasHandle_t   handle,
+                                                 hipblasSideMode_t side,
+                                                 hipblasFillMode_t uplo,
+                                                 hipblasDiagType_t diag,
+                                                 int               m,
+                                                 int               n,
+                                                 const void*       A,
+                                                 int               lda,
+                                                 long long         stride_A,
+                                                 void*             invA,
+                                                 int               invA_size,
+                                                 long long         stride_invA,
+                                                 int               batch_count,
+                                                 hipblasDatatype_t compute_type);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasTrsmEx(hipblasHandle_t    handle,
+                                             hipblasSideMode_t  side,
+                                             hipblasFillMode_t  uplo,
+                                             hipblasOperation_t transA,
+                                             hipblasDiagType_t  diag,
+                                             int                m,
+                                             int                n,
+                                             const void*        alpha,
+                                             const void*        A,
+                                             int                lda,
+                                             void*              B,
+                                             int                ldb,
+                                             const void*        invA,
+                                             int                invA_size,
+                                             hipblasDatatype_t  compute_type);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasTrsmStridedBatchedEx(hipblasHandle_t    handle,
+                                                           hipblasSideMode_t  side,
+                                                           hipblasFillMode_t  uplo,
+                                                           hipblasOperation_t transA,
+                                                           hipblasDiagType_t  diag,
+                                                           int                m,
+                                                           int                n,
+                                                           const void*        alpha,
+                                                           const void*        A,
+                                                           int                lda,
+                                                           long long          stride_A,
+                                                           void*              B,
+                                                           int                ldb,
+                                                           long long          stride_B,
+                                                           int                batch_count,
+                                                           const void*        invA,
+                                                           int                invA_size,
+                                                           long long          stride_invA,
+                                                           hipblasDatatype_t  compute_type);
+
+// trsmmixedex, trmmmixedex: op(A) X = alpha B, or X op(A) = alpha B, overwriting B with X, and
+// B = alpha op(A) B, or alpha B op(A), for fp16, bf16 or fp32 A and B of one type with
+// HIPBLAS_R_32F compute and a float alpha, so half data is solved and multiplied without being
+// widened in memory. The diagonal blocks of op(A) are applied by a kernel with fp32 arithmetic
+// and the rest by hipblasGemmEx calls, whose results are rounded to the data type between them.
+// Device scalars are read back, so they are not available in HIPBLAS_CAPTURE_MODE_SAFE
+HIPBLAS_EXPORT hipblasStatus_t hipblasTrsmMixedEx(hipblasHandle_t    handle,
+                                                  hipblasSideMode_t  side,
+                                                  hipblasFillMode_t  uplo,
+                                                  hipblasOperation_t transA,
+                                                  hipblasDiagType_t  diag,
+                                                  int                m,
+                                                  int                n,
+                                                  const void*        alpha,
+                                                  const void*        A,
+                                                  hipblasDatatype_t  a_type,
+                                                  int                lda,
+                                                  void*              B,
+                                                  hipblasDatatype_t  b_type,
+                                                  int                ldb,
+                                                  hipblasDatatype_t  compute_type);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasTrsmMixedBatchedEx(hipblasHandle_t    handle,
+                                                         hipblasSideMode_t  side,
+                                                         hipblasFillMode_t  uplo,
+                                                         hipblasOperation_t transA,
+                                                         hipblasDiagType_t  diag,
+                                                         int                m,
+                                                         int                n,
+                                                         const void*        alpha,
+                                                         const void*        A[],
+                                                         hipblasDatatype_t  a_type,
+                                                         int                lda,
+                                                         void*              B[],
+                                                         hipblasDatatype_t  b_type,
+                                                         int                ldb,
+                                                         int                batch_count,
+                                                         hipblasDatatype_t  compute_type);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasTrsmMixedStridedBatchedEx(hipblasHandle_t    handle,
+                                                                hipblasSideMode_t  side,
+                                                                hipblasFillMode_t  uplo,
+                                                                hipblasOperation_t transA,
+                                                                hipblasDiagType_t  diag,
+                                                                int                m,
+                                                                int                n,
+                                                                const void*        alpha,
+                                                                const void*        A,
+                                                                hipblasDatatype_t  a_type,
+                                                                int                lda,
+                                                                long long          stride_A,
+                                                                void*              B,
+                                                                hipblasDatatype_t  b_type,
+                                                                int                ldb,
+                                                                long long          stride_B,
+                                                                int                batch_count,
+                                                                hipblasDatatype_t  compute_type);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasTrmmMixedEx(hipblasHandle_t    handle,
+                                                  hipblasSideMode_t  side,
+                                                  hipblasFillMode_t  uplo,
+                                                  hipblasOperation_t transA,
+                                                  hipblasDiagType_t  diag,
+                                                  int                m,
+                                                  int                n,
+                                                  const void*        alpha,
+                                                  const void*        A,
+                                                  hipblasDatatype_t  a_type,
+                                                  int                lda,
+                                                  void*              B,
+                                                  hipblasDatatype_t  b_type,
+                                                  int                ldb,
+                                                  hipblasDatatype_t  compute_type);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasTrmmMixedBatchedEx(hipblasHandle_t    handle,
+                                                         hipblasSideMode_t  side,
+                                                         hipblasFillMode_t  uplo,
+                                                         hipblasOperation_t transA,
+                                                         hipblasDiagType_t  diag,
+                                                         int                m,
+                                                         int                n,
+                                                         const void*        alpha,
+                                                         const void*        A[],
+                                                         hipblasDatatype_t  a_type,
+                                                         int                lda,
+                                                         void*              B[],
+                                                         hipblasDatatype_t  b_type,
+                                                         int                ldb,
+                                                         int                batch_count,
+                                                         hipblasDatatype_t  compute_type);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasTrmmMixedStridedBatchedEx(hipblasHandle_t    handle,
+                                                                hipblasSideMode_t  side,
+                                                                hipblasFillMode_t  uplo,
+                                                                hipblasOperation_t transA,
+                                                                hipblasDiagType_t  diag,
+                                                                int                m,
+                                                                int                n,
+                                                                const void*        alpha,
+                                                                const void*        A,
+                                                                hipblasDatatype_t  a_type,
+                                                                int                lda,
+                                                                long long          stride_A,
+                                                                void*              B,
+                                                                hipblasDatatype_t  b_type,
+                                                                int                ldb,
+                                                                long long          stride_B,
+                                                                int                batch_count,
+                                                                hipblasDatatype_t  compute_type);
+
+// level-1 ex: axpy, dot, dotc, nrm2, rot and scal with a hipblasDatatype_t per vector, scalar
+// and result, and the arithmetic done in execution_type, e.g. half vectors accumulated in
+// float. cuBLAS has no batched forms, so those return HIPBLAS_STATUS_NOT_SUPPORTED there.
+HIPBLAS_EXPORT hipblasStatus_t hipblasAxpyEx(hipblasHandle_t   handle,
+                                             int               n,
+                                             const void*       alpha,
+                                             hipblasDatatype_t alpha_type,
+                                             const void*       x,
+                                             hipblasDatatype_t x_type,
+                                             int               incx,
+                                             void*             y,
+                                             hipblasDatatype_t y_type,
+                                             int               incy,
+                                             hipblasDatatype_t execution_type);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasAxpyBatchedEx(hipblasHandle_t   handle,
+                                                    int               n,
+                                                    const void*       alpha,
+                                                    hipblasDatatype_t alpha_type,
+                                                    const void*       x[],
+                                                    hipblasDatatype_t x_type,
+                                                    int               incx,
+                                                    void*             y[],
+                                                    hipblasDatatype_t y_type,
+                                                    int               incy,
+                                                    int               batch_count,
+                                                    hipblasDatatype_t execution_type);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasAxpyStridedBatchedEx(hipblasHandle_t   handle,
+                                                           int               n,
+                                                           const void*       alpha,
+                                                           hipblasDatatype_t alpha_type,
+                                                           const void*       x,
+                                                           hipblasDatatype_t x_type,
+                                                           int               incx,
+                                                           long long         stride_x,
+                                                           void*             y,
+                                                           hipblasDatatype_t y_type,
+                                                           int               incy,
+                                                           long long         stride_y,
+                                                           int               batch_count,
+                                                           hipblasDatatype_t execution_type);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDotEx(hipblasHandle_t   handle,
+                                            int               n,
+                                            const void*       x,
+                                            hipblasDatatype_t x_type,
+                                            int               incx,
+                                            const void*       y,
+                                            hipblasDatatype_t y_type,
+                                            int               incy,
+                                            void*             result,
+                                            hipblasDatatype_t result_type,
+                                            hipblasDatatype_t execution_type);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDotBatchedEx(hipblasHandle_t   handle,
+                                                   int               n,
+                                                   const void*       x[],
+                                                   hipblasDatatype_t x_type,
+                                                   int               incx,
+                                                   const void*       y[],
+                                                   hipblasDatatype_t y_type,
+                                                   int               incy,
+                                                   int               batch_count,
+                                                   void*             result,
+                                                   hipblasDatatype_t result_type,
+                                                   hipblasDatatype_t execution_type);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDotStridedBatchedEx(hipblasHandle_t   handle,
+                                                          int               n,
+                                                          const void*       x,
+                                                          hipblasDatatype_t x_type,
+                                                          int               incx,
+                                                          long long         stride_x,
+                                                          const void*       y,
+                                                          hipblasDatatype_t y_type,
+                                                          int               incy,
+                                                          long long         stride_y,
+                                                          int               batch_count,
+                                                          void*             result,
+                                                          hipblasDatatype_t result_type,
+                                                          hipblasDatatype_t execution_type);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDotcEx(hipblasHandle_t   handle,
+                                             int               n,
+                                             const void*       x,
+                                             hipblasDatatype_t x_type,
+                                             int               incx,
+                                             const void*       y,
+                                             hipblasDatatype_t y_type,
+                                             int               incy,
+                                             void*             result,
+                                             hipblasDatatype_t result_type,
+                                             hipblasDatatype_t execution_type);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDotcBatchedEx(hipblasHandle_t   handle,
+                                                    int               n,
+                                                    const void*       x[],
+                                                    hipblasDatatype_t x_type,
+                                                    int               incx,
+                                                    const void*       y[],
+                                                    hipblasDatatype_t y_type,
+                                                    int               incy,
+                                                    int               batch_count,
+                                                    void*             result,
+                                                    hipblasDatatype_t result_type,
+                                                    hipblasDatatype_t execution_type);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDotcStridedBatchedEx(hipblasHandle_t   handle,
+                                                           int               n,
+                                                           const void*       x,
+                                                           hipblasDatatype_t x_type,
+                                                           int               incx,
+                                                           long long         stride_x,
+                                                           const void*       y,
+                                                           hipblasDatatype_t y_type,
+                                                           int               incy,
+                                                           long long         stride_y,
+                                                           int               batch_count,
+                                                           void*             result,
+                                                           hipblasDatatype_t result_type,
+                                                           hipblasDatatype_t execution_type);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasNrm2Ex(hipblasHandle_t   handle,
+                                             int               n,
+                                             const void*       x,
+                                             hipblasDatatype_t x_type,
+                                             int               incx,
+                                             void*             result,
+                                             hipblasDatatype_t result_type,
+                                             hipblasDatatype_t execution_type);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasNrm2BatchedEx(hipblasHandle_t   handle,
+                                                    int               n,
+                                                    const void*       x[],
+                                                    hipblasDatatype_t x_type,
+                                                    int               incx,
+                                                    int               batch_count,
+                                                    void*             result,
+                                                    hipblasDatatype_t result_type,
+                                                    hipblasDatatype_t execution_type);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasNrm2StridedBatchedEx(hipblasHandle_t   handle,
+                                                           int               n,
+                                                           const void*       x,
+                                                           hipblasDatatype_t x_type,
+                                                           int               incx,
+                                                           long long         stride_x,
+                                                           int               batch_count,
+                                                           void*             result,
+                                                           hipblasDatatype_t result_type,
+                                                           hipblasDatatype_t execution_type);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasRotEx(hipblasHandle_t   handle,
+                                            int               n,
+                                            void*             x,
+                                            hipblasDatatype_t x_type,
+                                            int               incx,
+                                            void*             y,
+                                            hipblasDatatype_t y_type,
+                                            int               incy,
+                                            const void*       c,
+                                            const void*       s,
+                                            hipblasDatatype_t cs_type,
+                                            hipblasDatatype_t execution_type);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasRotBatchedEx(hipblasHandle_t   handle,
+                                                   int               n,
+                                                   void*             x[],
+                                                   hipblasDatatype_t x_type,
+                                                   int               incx,
+                                                   void*             y[],
+                                                   hipblasDatatype_t y_type,
+                                                   int               incy,
+                                                   const void*       c,
+                                                   const void*       s,
+                                                   hipblasDatatype_t cs_type,
+                                                   int               batch_count,
+                                                   hipblasDatatype_t execution_type);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasRotStridedBatchedEx(hipblasHandle_t   handle,
+                                                          int               n,
+                                                          void*             x,
+                                                          hipblasDatatype_t x_type,
+                                                          int               incx,
+                                                          long long         stride_x,
+                                                          void*             y,
+                                                          hipblasDatatype_t y_type,
+                                                          int               incy,
+                                                          long long         stride_y,
+                                                          const void*       c,
+                                                          const void*       s,
+                                                          hipblasDatatype_t cs_type,
+                                                          int               batch_count,
+                                                          hipblasDatatype_t execution_type);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasScalEx(hipblasHandle_t   handle,
+                                             int               n,
+                                             const void*       alpha,
+                                             hipblasDatatype_t alpha_type,
+                                             void*             x,
+                                             hipblasDatatype_t x_type,
+                                             int               incx,
+                                             hipblasDatatype_t execution_type);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasScalBatchedEx(hipblasHandle_t   handle,
+                                                    int               n,
+                                                    const void*       alpha,
+                                                    hipblasDatatype_t alpha_type,
+                                                    void*             x[],
+                                                    hipblasDatatype_t x_type,
+                                                    int               incx,
+                                                    int               batch_count,
+                                                    hipblasDatatype_t execution_type);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasScalStridedBatchedEx(hipblasHandle_t   handle,
+                                                           int               n,
+                                                           const void*       alpha,
+                                                           hipblasDatatype_t alpha_type,
+                                                           void*             x,
+                                                           hipblasDatatype_t x_type,
+                                                           int               incx,
+                                                           long long         stride_x,
+                                                           int               batch_count,
+                                                           hipblasDatatype_t execution_type);
+
+// The routines below with an order argument, as the cblas interface has. Column-major order is the
+// plain routine; row-major order takes every matrix argument with its leading dimension a row
+// stride, and runs as the column-major routine on the transposes without copying, except for
+// getrf and geqrf, which factor a transposed copy in the handle's workspace
+// gemm
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgemmWithOrder(hipblasHandle_t    handle,
+                                                     hipblasOrder_t     order,
+                                                     hipblasOperation_t transa,
+                                                     hipblasOperation_t transb,
+                                                     int                m,
+                                                     int                n,
+                                                     int                k,
+                                                     const float*       alpha,
+                                                     const float*       A,
+                                                     int                lda,
+                                                     const float*       B,
+                                                     int                ldb,
+                                                     const float*       beta,
+                                                     float*             C,
+                                                     int                ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgemmWithOrder(hipblasHandle_t    handle,
+                                                     hipblasOrder_t     order,
+                                                     hipblasOperation_t transa,
+                                                     hipblasOperation_t transb,
+                                                     int                m,
+                                                     int                n,
+                                                     int                k,
+                                                     const double*      alpha,
+                                                     const double*      A,
+                                                     int                lda,
+                                                     const double*      B,
+                                                     int                ldb,
+                                                     const double*      beta,
+                                                     double*            C,
+                                                     int                ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgemmWithOrder(hipblasHandle_t       handle,
+                                                     hipblasOrder_t        order,
+                                                     hipblasOperation_t    transa,
+                                                     hipblasOperation_t    transb,
+                                                     int                   m,
+                                                     int                   n,
+                                                     int                   k,
+                                                     const hipblasComplex* alpha,
+                                                     const hipblasComplex* A,
+                                                     int                   lda,
+                                                     const hipblasComplex* B,
+                                                     int                   ldb,
+                                                     const hipblasComplex* beta,
+                                                     hipblasComplex*       C,
+                                                     int                   ldc);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgemmWithOrder(hipblasHandle_t             handle,
+                                                     hipblasOrder_t              order,
+                                                     hipblasOperation_t          transa,
+                                                     hipblasOperation_t          transb,
+                                                     int                         m,
+                                                     int                         n,
+                                                     int                         k,
+                                                     const hipblasDoubleComplex* alpha,
+                                                     const hipblasDoubleComplex* A,
+                                                     int                         lda,
+                                                     const hipblasDoubleComplex* B,
+                                                     int                         ldb,
+                                                     const hipblasDoubleComplex* beta,
+                                                     hipblasDoubleComplex*       C,
+                                                     int                         ldc);
+
+// gemv
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgemvWithOrder(hipblasHandle_t    handle,
+                                                     hipblasOrder_t     order,
+                                                     hipblasOperation_t trans,
+                                                     int                m,
+                                                     int                n,
+                                                     const float*       alpha,
+                                                     const float*       A,
+                                                     int                lda,
+                                                     const float*       x,
+                                                     int                incx,
+                                                     const float*       beta,
+                                                     float*             y,
+                                                     int                incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgemvWithOrder(hipblasHandle_t    handle,
+                                                     hipblasOrder_t     order,
+                                                     hipblasOperation_t trans,
+                                                     int                m,
+                                                     int                n,
+                                                     const double*      alpha,
+                                                     const double*      A,
+                                                     int                lda,
+                                                     const double*      x,
+                                                     int                incx,
+                                                     const double*      beta,
+                                                     double*            y,
+                                                     int                incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgemvWithOrder(hipblasHandle_t       handle,
+                                                     hipblasOrder_t        order,
+                                                     hipblasOperation_t    trans,
+                                                     int                   m,
+                                                     int                   n,
+                                                     const hipblasComplex* alpha,
+                                                     const hipblasComplex* A,
+                                                     int                   lda,
+                                                     const hipblasComplex* x,
+                                                     int                   incx,
+                                                     const hipblasComplex* beta,
+                                                     hipblasComplex*       y,
+                                                     int                   incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgemvWithOrder(hipblasHandle_t             handle,
+                                                     hipblasOrder_t              order,
+                                                     hipblasOperation_t          trans,
+                                                     int                         m,
+                                                     int                         n,
+                                                     const hipblasDoubleComplex* alpha,
+                                                     const hipblasDoubleComplex* A,
+                                                     int                         lda,
+                                                     const hipblasDoubleComplex* x,
+                                                     int                         incx,
+                                                     const hipblasDoubleComplex* beta,
+                                                     hipblasDoubleComplex*       y,
+                                                     int                         incy);
+
+// ger
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgerWithOrder(hipblasHandle_t handle,
+                                                    hipblasOrder_t  order,
+                                                    int             m,
+                                                    int             n,
+                                                    const float*    alpha,
+                                                    const float*    x,
+                                                    int             incx,
+                                                    const float*    y,
+                                                    int             incy,
+                                                    float*          A,
+                                                    int             lda);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgerWithOrder(hipblasHandle_t handle,
+                                                    hipblasOrder_t  order,
+                                                    int             m,
+                                                    int             n,
+                                                    const double*   alpha,
+                                                    const double*   x,
+                                                    int             incx,
+                                                    const double*   y,
+                                                    int             incy,
+                                                    double*         A,
+                                                    int             lda);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgeruWithOrder(hipblasHandle_t       handle,
+                                                     hipblasOrder_t        order,
+                                                     int                   m,
+                                                     int                   n,
+                                                     const hipblasComplex* alpha,
+                                                     const hipblasComplex* x,
+                                                     int                   incx,
+                                                     const hipblasComplex* y,
+                                                     int                   incy,
+                                                     hipblasComplex*       A,
+                                                     int                   lda);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgercWithOrder(hipblasHandle_t       handle,
+                                                     hipblasOrder_t        order,
+                                                     int                   m,
+                                                     int                   n,
+                                                     const hipblasComplex* alpha,
+                                                     const hipblasComplex* x,
+                                                     int                   incx,
+                                                     const hipblasComplex* y,
+                                                     int                   incy,
+                                                     hipblasComplex*       A,
+                                                     int                   lda);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgeruWithOrder(hipblasHandle_t             handle,
+                                                     hipblasOrder_t              order,
+                                                     int                         m,
+                                                     int                         n,
+                                                     const hipblasDoubleComplex* alpha,
+                                                     const hipblasDoubleComplex* x,
+                                                     int                         incx,
+                                                     const hipblasDoubleComplex* y,
+                                                     int                         incy,
+                                                     hipblasDoubleComplex*       A,
+                                                     int                         lda);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgercWithOrder(hipblasHandle_t             handle,
+                                                     hipblasOrder_t              order,
+                                                     int                         m,
+                                                     int                         n,
+                                                     const hipblasDoubleComplex* alpha,
+                                                     const hipblasDoubleComplex* x,
+                                                     int                         incx,
+                                                     const hipblasDoubleComplex* y,
+                                                     int                         incy,
+                                                     hipblasDoubleComplex*       A,
+                                                     int                         lda);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasSgemmBatched(hipblasHandle_t    handle,
-                                                   hipblasOperation_t transa,
-                                                   hipblasOperation_t transb,
-                                                   int                m,
+// syr
+HIPBLAS_EXPORT hipblasStatus_t hipblasSsyrWithOrder(hipblasHandle_t   handle,
+                                                    hipblasOrder_t    order,
+                                                    hipblasFillMode_t uplo,
+                                                    int               n,
+                                                    const float*      alpha,
+                                                    const float*      x,
+                                                    int               incx,
+                                                    float*            A,
+                                                    int               lda);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDsyrWithOrder(hipblasHandle_t   handle,
+                                                    hipblasOrder_t    order,
+                                                    hipblasFillMode_t uplo,
+                                                    int               n,
+                                                    const double*     alpha,
+                                                    const double*     x,
+                                                    int               incx,
+                                                    double*           A,
+                                                    int               lda);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsyrWithOrder(hipblasHandle_t       handle,
+                                                    hipblasOrder_t        order,
+                                                    hipblasFillMode_t     uplo,
+                                                    int                   n,
+                                                    const hipblasComplex* alpha,
+                                                    const hipblasComplex* x,
+                                                    int                   incx,
+                                                    hipblasComplex*       A,
+                                                    int                   lda);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZsyrWithOrder(hipblasHandle_t             handle,
+                                                    hipblasOrder_t              order,
+                                                    hipblasFillMode_t           uplo,
+                                                    int                         n,
+                                                    const hipblasDoubleComplex* alpha,
+                                                    const hipblasDoubleComplex* x,
+                                                    int                         incx,
+                                                    hipblasDoubleComplex*       A,
+                                                    int                         lda);
+
+// trsv
+HIPBLAS_EXPORT hipblasStatus_t hipblasStrsvWithOrder(hipblasHandle_t    handle,
+                                                     hipblasOrder_t     order,
+                                                     hipblasFillMode_t  uplo,
+                                                     hipblasOperation_t transA,
+                                                     hipblasDiagType_t  diag,
+                                                     int                m,
+                                                     const float*       A,
+                                                     int                lda,
+                                                     float*             x,
+                                                     int                incx);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtrsvWithOrder(hipblasHandle_t    handle,
+                                                     hipblasOrder_t     order,
+                                                     hipblasFillMode_t  uplo,
+                                                     hipblasOperation_t transA,
+                                                     hipblasDiagType_t  diag,
+                                                     int                m,
+                                                     const double*      A,
+                                                     int                lda,
+                                                     double*            x,
+                                                     int                incx);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtrsvWithOrder(hipblasHandle_t       handle,
+                                                     hipblasOrder_t        order,
+                                                     hipblasFillMode_t     uplo,
+                                                     hipblasOperation_t    transA,
+                                                     hipblasDiagType_t     diag,
+                                                     int                   m,
+                                                     const hipblasComplex* A,
+                                                     int                   lda,
+                                                     hipblasComplex*       x,
+                                                     int                   incx);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtrsvWithOrder(hipblasHandle_t             handle,
+                                                     hipblasOrder_t              order,
+                                                     hipblasFillMode_t           uplo,
+                                                     hipblasOperation_t          transA,
+                                                     hipblasDiagType_t           diag,
+                                                     int                         m,
+                                                     const hipblasDoubleComplex* A,
+                                                     int                         lda,
+                                                     hipblasDoubleComplex*       x,
+                                                     int                         incx);
+
+// trsm
+HIPBLAS_EXPORT hipblasStatus_t hipblasStrsmWithOrder(hipblasHandle_t    handle,
+                                                     hipblasOrder_t     order,
+                                                     hipblasSideMode_t  side,
+                                                     hipblasFillMode_t  uplo,
+                                                     hipblasOperation_t transA,
+                                                     hipblasDiagType_t  diag,
+                                                     int                m,
+                                                     int                n,
+                                                     const float*       alpha,
+                                                     float*             A,
+                                                     int                lda,
+                                                     float*             B,
+                                                     int                ldb);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtrsmWithOrder(hipblasHandle_t    handle,
+                                                     hipblasOrder_t     order,
+                                                     hipblasSideMode_t  side,
+                                                     hipblasFillMode_t  uplo,
+                                                     hipblasOperation_t transA,
+                                                     hipblasDiagType_t  diag,
+                                                     int                m,
+                                                     int                n,
+                                                     const double*      alpha,
+                                                     double*            A,
+                                                     int                lda,
+                                                     double*            B,
+                                                     int                ldb);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtrsmWithOrder(hipblasHandle_t       handle,
+                                                     hipblasOrder_t        order,
+                                                     hipblasSideMode_t     side,
+                                                     hipblasFillMode_t     uplo,
+                                                     hipblasOperation_t    transA,
+                                                     hipblasDiagType_t     diag,
+                                                     int                   m,
+                                                     int                   n,
+                                                     const hipblasComplex* alpha,
+                                                     hipblasComplex*       A,
+                                                     int                   lda,
+                                                     hipblasComplex*       B,
+                                                     int                   ldb);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtrsmWithOrder(hipblasHandle_t             handle,
+                                                     hipblasOrder_t              order,
+                                                     hipblasSideMode_t           side,
+                                                     hipblasFillMode_t           uplo,
+                                                     hipblasOperation_t          transA,
+                                                     hipblasDiagType_t           diag,
+                                                     int                         m,
+                                                     int                         n,
+                                                     const hipblasDoubleComplex* alpha,
+                                                     hipblasDoubleComplex*       A,
+                                                     int                         lda,
+                                                     hipblasDoubleComplex*       B,
+                                                     int                         ldb);
+
+// getrf
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgetrfWithOrder(hipblasHandle_t handle,
+                                                      hipblasOrder_t  order,
+                                                      int             n,
+                                                      float*          A,
+                                                      int             lda,
+                                                      int*            ipiv,
+                                                      int*            info);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgetrfWithOrder(hipblasHandle_t handle,
+                                                      hipblasOrder_t  order,
+                                                      int             n,
+                                                      double*         A,
+                                                      int             lda,
+                                                      int*            ipiv,
+                                                      int*            info);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgetrfWithOrder(hipblasHandle_t handle,
+                                                      hipblasOrder_t  order,
+                                                      int             n,
+                                                      hipblasComplex* A,
+                                                      int             lda,
+                                                      int*            ipiv,
+                                                      int*            info);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgetrfWithOrder(hipblasHandle_t       handle,
+                                                      hipblasOrder_t        order,
+                                                      int                   n,
+                                                      hipblasDoubleComplex* A,
+                                                      int                   lda,
+                                                      int*                  ipiv,
+                                                      int*                  info);
+
+// geqrf
+HIPBLAS_EXPORT hipblasStatus_t hipblasSgeqrfWithOrder(hipblasHandle_t handle,
+                                                      hipblasOrder_t  order,
+                                                      int             m,
+                                                      int             n,
+                                                      float*          A,
+                                                      int             lda,
+                                                      float*          tau,
+                                                      int*            info);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDgeqrfWithOrder(hipblasHandle_t handle,
+                                                      hipblasOrder_t  order,
+                                                      int             m,
+                                                      int             n,
+                                                      double*         A,
+                                                      int             lda,
+                                                      double*         tau,
+                                                      int*            info);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCgeqrfWithOrder(hipblasHandle_t handle,
+                                                      hipblasOrder_t  order,
+                                                      int             m,
+                                                      int             n,
+                                                      hipblasComplex* A,
+                                                      int             lda,
+                                                      hipblasComplex* tau,
+                                                      int*            info);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZgeqrfWithOrder(hipblasHandle_t       handle,
+                                                      hipblasOrder_t        order,
+                                                      int                   m,
+                                                      int                   n,
+                                                      hipblasDoubleComplex* A,
+                                                      int                   lda,
+                                                      hipblasDoubleComplex* tau,
+                                                      int*                  info);
+
+// Fused level-1 routines for iterative solvers, each one pass over its vectors:
+//   axpby:   y = alpha * x + beta * y
+//   waxpby:  w = alpha * x + beta * y
+//   mdot:    result[j] = x^T y_j for the k vectors y_j at Y + j * ldy, or x^H y_j for mdotc
+//   axpyDot: y = alpha * x + y, then result = z^T y, or z^H y for axpyDotc; z may be y
+// y is not read by axpby and waxpby when beta is 0. alpha, beta and result follow the pointer
+// mode, batch b's scalars at b times the handle's scalar stride in device pointer mode. The
+// batched mdot stores result[b * k + j], and a host result is returned once the stream has
+// finished
+// axpby
+HIPBLAS_EXPORT hipblasStatus_t hipblasSaxpby(hipblasHandle_t handle,
+                                             int             n,
+                                             const float*    alpha,
+                                             const float*    x,
+                                             int             incx,
+                                             const float*    beta,
+                                             float*          y,
+                                             int             incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDaxpby(hipblasHandle_t handle,
+                                             int             n,
+                                             const double*   alpha,
+                                             const double*   x,
+                                             int             incx,
+                                             const double*   beta,
+                                             double*         y,
+                                             int             incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCaxpby(hipblasHandle_t       handle,
+                                             int                   n,
+                                             const hipblasComplex* alpha,
+                                             const hipblasComplex* x,
+                                             int                   incx,
+                                             const hipblasComplex* beta,
+                                             hipblasComplex*       y,
+                                             int                   incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZaxpby(hipblasHandle_t             handle,
+                                             int                         n,
+                                             const hipblasDoubleComplex* alpha,
+                                             const hipblasDoubleComplex* x,
+                                             int                         incx,
+                                             const hipblasDoubleComplex* beta,
+                                             hipblasDoubleComplex*       y,
+                                             int                         incy);
+
+// axpby_batched
+HIPBLAS_EXPORT hipblasStatus_t hipblasSaxpbyBatched(hipblasHandle_t    handle,
+                                                    int                n,
+                                                    const float*       alpha,
+                                                    const float* const x[],
+                                                    int                incx,
+                                                    const float*       beta,
+                                                    float* const       y[],
+                                                    int                incy,
+                                                    int                batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDaxpbyBatched(hipblasHandle_t     handle,
+                                                    int                 n,
+                                                    const double*       alpha,
+                                                    const double* const x[],
+                                                    int                 incx,
+                                                    const double*       beta,
+                                                    double* const       y[],
+                                                    int                 incy,
+                                                    int                 batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCaxpbyBatched(hipblasHandle_t             handle,
+                                                    int                         n,
+                                                    const hipblasComplex*       alpha,
+                                                    const hipblasComplex* const x[],
+                                                    int                         incx,
+                                                    const hipblasComplex*       beta,
+                                                    hipblasComplex* const       y[],
+                                                    int                         incy,
+                                                    int                         batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZaxpbyBatched(hipblasHandle_t                   handle,
+                                                    int                               n,
+                                                    const hipblasDoubleComplex*       alpha,
+                                                    const hipblasDoubleComplex* const x[],
+                                                    int                               incx,
+                                                    const hipblasDoubleComplex*       beta,
+                                                    hipblasDoubleComplex* const       y[],
+                                                    int                               incy,
+                                                    int                               batch_count);
+
+// axpby_strided_batched
+HIPBLAS_EXPORT hipblasStatus_t hipblasSaxpbyStridedBatched(hipblasHandle_t handle,
+                                                           int             n,
+                                                           const float*    alpha,
+                                                           const float*    x,
+                                                           int             incx,
+                                                           int             stridex,
+                                                           const float*    beta,
+                                                           float*          y,
+                                                           int             incy,
+                                                           int             stridey,
+                                                           int             batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDaxpbyStridedBatched(hipblasHandle_t handle,
+                                                           int             n,
+                                                           const double*   alpha,
+                                                           const double*   x,
+                                                           int             incx,
+                                                           int             stridex,
+                                                           const double*   beta,
+                                                           double*         y,
+                                                           int             incy,
+                                                           int             stridey,
+                                                           int             batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCaxpbyStridedBatched(hipblasHandle_t       handle,
+                                                           int                   n,
+                                                           const hipblasComplex* alpha,
+                                                           const hipblasComplex* x,
+                                                           int                   incx,
+                                                           int                   stridex,
+                                                           const hipblasComplex* beta,
+                                                           hipblasComplex*       y,
+                                                           int                   incy,
+                                                           int                   stridey,
+                                                           int                   batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZaxpbyStridedBatched(hipblasHandle_t             handle,
+                                                           int                         n,
+                                                           const hipblasDoubleComplex* alpha,
+                                                           const hipblasDoubleComplex* x,
+                                                           int                         incx,
+                                                           int                         stridex,
+                                                           const hipblasDoubleComplex* beta,
+                                                           hipblasDoubleComplex*       y,
+                                                           int                         incy,
+                                                           int                         stridey,
+                                                           int                         batch_count);
+
+// waxpby
+HIPBLAS_EXPORT hipblasStatus_t hipblasSwaxpby(hipblasHandle_t handle,
+                                              int             n,
+                                              const float*    alpha,
+                                              const float*    x,
+                                              int             incx,
+                                              const float*    beta,
+                                              const float*    y,
+                                              int             incy,
+                                              float*          w,
+                                              int             incw);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDwaxpby(hipblasHandle_t handle,
+                                              int             n,
+                                              const double*   alpha,
+                                              const double*   x,
+                                              int             incx,
+                                              const double*   beta,
+                                              const double*   y,
+                                              int             incy,
+                                              double*         w,
+                                              int             incw);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCwaxpby(hipblasHandle_t       handle,
+                                              int                   n,
+                                              const hipblasComplex* alpha,
+                                              const hipblasComplex* x,
+                                              int                   incx,
+                                              const hipblasComplex* beta,
+                                              const hipblasComplex* y,
+                                              int                   incy,
+                                              hipblasComplex*       w,
+                                              int                   incw);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZwaxpby(hipblasHandle_t             handle,
+                                              int                         n,
+                                              const hipblasDoubleComplex* alpha,
+                                              const hipblasDoubleComplex* x,
+                                              int                         incx,
+                                              const hipblasDoubleComplex* beta,
+                                              const hipblasDoubleComplex* y,
+                                              int                         incy,
+                                              hipblasDoubleComplex*       w,
+                                              int                         incw);
+
+// waxpby_batched
+HIPBLAS_EXPORT hipblasStatus_t hipblasSwaxpbyBatched(hipblasHandle_t    handle,
+                                                     int                n,
+                                                     const float*       alpha,
+                                                     const float* const x[],
+                                                     int                incx,
+                                                     const float*       beta,
+                                                     const float* const y[],
+                                                     int                incy,
+                                                     float* const       w[],
+                                                     int                incw,
+                                                     int                batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDwaxpbyBatched(hipblasHandle_t     handle,
+                                                     int                 n,
+                                                     const double*       alpha,
+                                                     const double* const x[],
+                                                     int                 incx,
+                                                     const double*       beta,
+                                                     const double* const y[],
+                                                     int                 incy,
+                                                     double* const       w[],
+                                                     int                 incw,
+                                                     int                 batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCwaxpbyBatched(hipblasHandle_t             handle,
+                                                     int                         n,
+                                                     const hipblasComplex*       alpha,
+                                                     const hipblasComplex* const x[],
+                                                     int                         incx,
+                                                     const hipblasComplex*       beta,
+                                                     const hipblasComplex* const y[],
+                                                     int                         incy,
+                                                     hipblasComplex* const       w[],
+                                                     int                         incw,
+                                                     int                         batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZwaxpbyBatched(hipblasHandle_t                   handle,
+                                                     int                               n,
+                                                     const hipblasDoubleComplex*       alpha,
+                                                     const hipblasDoubleComplex* const x[],
+                                                     int                               incx,
+                                                     const hipblasDoubleComplex*       beta,
+                                                     const hipblasDoubleComplex* const y[],
+                                                     int                               incy,
+                                                     hipblasDoubleComplex* const       w[],
+                                                     int                               incw,
+                                                     int                               batch_count);
+
+// waxpby_strided_batched
+HIPBLAS_EXPORT hipblasStatus_t hipblasSwaxpbyStridedBatched(hipblasHandle_t handle,
+                                                            int             n,
+                                                            const float*    alpha,
+                                                            const float*    x,
+                                                            int             incx,
+                                                            int             stridex,
+                                                            const float*    beta,
+                                                            const float*    y,
+                                                            int             incy,
+                                                            int             stridey,
+                                                            float*          w,
+                                                            int             incw,
+                                                            int             stridew,
+                                                            int             batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDwaxpbyStridedBatched(hipblasHandle_t handle,
+                                                            int             n,
+                                                            const double*   alpha,
+                                                            const double*   x,
+                                                            int             incx,
+                                                            int             stridex,
+                                                            const double*   beta,
+                                                            const double*   y,
+                                                            int             incy,
+                                                            int             stridey,
+                                                            double*         w,
+                                                            int             incw,
+                                                            int             stridew,
+                                                            int             batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCwaxpbyStridedBatched(hipblasHandle_t       handle,
+                                                            int                   n,
+                                                            const hipblasComplex* alpha,
+                                                            const hipblasComplex* x,
+                                                            int                   incx,
+                                                            int                   stridex,
+                                                            const hipblasComplex* beta,
+                                                            const hipblasComplex* y,
+                                                            int                   incy,
+                                                            int                   stridey,
+                                                            hipblasComplex*       w,
+                                                            int                   incw,
+                                                            int                   stridew,
+                                                            int                   batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZwaxpbyStridedBatched(hipblasHandle_t             handle,
+                                 int                         n,
+                                 const hipblasDoubleComplex* alpha,
+                                 const hipblasDoubleComplex* x,
+                                 int                         incx,
+                                 int                         stridex,
+                                 const hipblasDoubleComplex* beta,
+                                 const hipblasDoubleComplex* y,
+                                 int                         incy,
+                                 int                         stridey,
+                                 hipblasDoubleComplex*       w,
+                                 int                         incw,
+                                 int                         stridew,
+                                 int                         batch_count);
+
+// mdot
+HIPBLAS_EXPORT hipblasStatus_t hipblasSmdot(hipblasHandle_t handle,
+                                            int             n,
+                                            int             k,
+                                            const float*    x,
+                                            int             incx,
+                                            const float*    Y,
+                                            int             ldy,
+                                            int             incy,
+                                            float*          result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDmdot(hipblasHandle_t handle,
+                                            int             n,
+                                            int             k,
+                                            const double*   x,
+                                            int             incx,
+                                            const double*   Y,
+                                            int             ldy,
+                                            int             incy,
+                                            double*         result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCmdotu(hipblasHandle_t       handle,
+                                             int                   n,
+                                             int                   k,
+                                             const hipblasComplex* x,
+                                             int                   incx,
+                                             const hipblasComplex* Y,
+                                             int                   ldy,
+                                             int                   incy,
+                                             hipblasComplex*       result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCmdotc(hipblasHandle_t       handle,
+                                             int                   n,
+                                             int                   k,
+                                             const hipblasComplex* x,
+                                             int                   incx,
+                                             const hipblasComplex* Y,
+                                             int                   ldy,
+                                             int                   incy,
+                                             hipblasComplex*       result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZmdotu(hipblasHandle_t             handle,
+                                             int                         n,
+                                             int                         k,
+                                             const hipblasDoubleComplex* x,
+                                             int                         incx,
+                                             const hipblasDoubleComplex* Y,
+                                             int                         ldy,
+                                             int                         incy,
+                                             hipblasDoubleComplex*       result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZmdotc(hipblasHandle_t             handle,
+                                             int                         n,
+                                             int                         k,
+                                             const hipblasDoubleComplex* x,
+                                             int                         incx,
+                                             const hipblasDoubleComplex* Y,
+                                             int                         ldy,
+                                             int                         incy,
+                                             hipblasDoubleComplex*       result);
+
+// mdot_batched
+HIPBLAS_EXPORT hipblasStatus_t hipblasSmdotBatched(hipblasHandle_t    handle,
                                                    int                n,
                                                    int                k,
-                                                   const float*       alpha,
-                                                   const float* const A[],
+                                                   const float* const x[],
+                                                   int                incx,
+                                                   const float* const Y[],
+                                                   int                ldy,
+                                                   int                incy,
+                                                   int                batch_count,
+                                                   float*             result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDmdotBatched(hipblasHandle_t     handle,
+                                                   int                 n,
+                                                   int                 k,
+                                                   const double* const x[],
+                                                   int                 incx,
+                                                   const double* const Y[],
+                                                   int                 ldy,
+                                                   int                 incy,
+                                                   int                 batch_count,
+                                                   double*             result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCmdotuBatched(hipblasHandle_t             handle,
+                                                    int                         n,
+                                                    int                         k,
+                                                    const hipblasComplex* const x[],
+                                                    int                         incx,
+                                                    const hipblasComplex* const Y[],
+                                                    int                         ldy,
+                                                    int                         incy,
+                                                    int                         batch_count,
+                                                    hipblasComplex*             result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCmdotcBatched(hipblasHandle_t             handle,
+                                                    int                         n,
+                                                    int                         k,
+                                                    const hipblasComplex* const x[],
+                                                    int                         incx,
+                                                    const hipblasComplex* const Y[],
+                                                    int                         ldy,
+                                                    int                         incy,
+                                                    int                         batch_count,
+                                                    hipblasComplex*             result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZmdotuBatched(hipblasHandle_t                   handle,
+                                                    int                               n,
+                                                    int                               k,
+                                                    const hipblasDoubleComplex* const x[],
+                                                    int                               incx,
+                                                    const hipblasDoubleComplex* const Y[],
+                                                    int                               ldy,
+                                                    int                               incy,
+                                                    int                               batch_count,
+                                                    hipblasDoubleComplex*             result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZmdotcBatched(hipblasHandle_t                   handle,
+                                                    int                               n,
+                                                    int                               k,
+                                                    const hipblasDoubleComplex* const x[],
+                                                    int                               incx,
+                                                    const hipblasDoubleComplex* const Y[],
+                                                    int                               ldy,
+                                                    int                               incy,
+                                                    int                               batch_count,
+                                                    hipblasDoubleComplex*             result);
+
+// mdot_strided_batched
+HIPBLAS_EXPORT hipblasStatus_t hipblasSmdotStridedBatched(hipblasHandle_t handle,
+                                                          int             n,
+                                                          int             k,
+                                                          const float*    x,
+                                                          int             incx,
+                                                          int             stridex,
+                                                          const float*    Y,
+                                                          int             ldy,
+                                                          int             incy,
+                                                          int             strideY,
+                                                          int             batch_count,
+                                                          float*          result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDmdotStridedBatched(hipblasHandle_t handle,
+                                                          int             n,
+                                                          int             k,
+                                                          const double*   x,
+                                                          int             incx,
+                                                          int             stridex,
+                                                          const double*   Y,
+                                                          int             ldy,
+                                                          int             incy,
+                                                          int             strideY,
+                                                          int             batch_count,
+                                                          double*         result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCmdotuStridedBatched(hipblasHandle_t       handle,
+                                                           int                   n,
+                                                           int                   k,
+                                                           const hipblasComplex* x,
+                                                           int                   incx,
+                                                           int                   stridex,
+                                                           const hipblasComplex* Y,
+                                                           int                   ldy,
+                                                           int                   incy,
+                                                           int                   strideY,
+                                                           int                   batch_count,
+                                                           hipblasComplex*       result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCmdotcStridedBatched(hipblasHandle_t       handle,
+                                                           int                   n,
+                                                           int                   k,
+                                                           const hipblasComplex* x,
+                                                           int                   incx,
+                                                           int                   stridex,
+                                                           const hipblasComplex* Y,
+                                                           int                   ldy,
+                                                           int                   incy,
+                                                           int                   strideY,
+                                                           int                   batch_count,
+                                                           hipblasComplex*       result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZmdotuStridedBatched(hipblasHandle_t             handle,
+                                                           int                         n,
+                                                           int                         k,
+                                                           const hipblasDoubleComplex* x,
+                                                           int                         incx,
+                                                           int                         stridex,
+                                                           const hipblasDoubleComplex* Y,
+                                                           int                         ldy,
+                                                           int                         incy,
+                                                           int                         strideY,
+                                                           int                         batch_count,
+                                                           hipblasDoubleComplex*       result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZmdotcStridedBatched(hipblasHandle_t             handle,
+                                                           int                         n,
+                                                           int                         k,
+                                                           const hipblasDoubleComplex* x,
+                                                           int                         incx,
+                                                           int                         stridex,
+                                                           const hipblasDoubleComplex* Y,
+                                                           int                         ldy,
+                                                           int                         incy,
+                                                           int                         strideY,
+                                                           int                         batch_count,
+                                                           hipblasDoubleComplex*       result);
+
+// axpyDot
+HIPBLAS_EXPORT hipblasStatus_t hipblasSaxpyDot(hipblasHandle_t handle,
+                                               int             n,
+                                               const float*    alpha,
+                                               const float*    x,
+                                               int             incx,
+                                               float*          y,
+                                               int             incy,
+                                               const float*    z,
+                                               int             incz,
+                                               float*          result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDaxpyDot(hipblasHandle_t handle,
+                                               int             n,
+                                               const double*   alpha,
+                                               const double*   x,
+                                               int             incx,
+                                               double*         y,
+                                               int             incy,
+                                               const double*   z,
+                                               int             incz,
+                                               double*         result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCaxpyDotu(hipblasHandle_t       handle,
+                                                int                   n,
+                                                const hipblasComplex* alpha,
+                                                const hipblasComplex* x,
+                                                int                   incx,
+                                                hipblasComplex*       y,
+                                                int                   incy,
+                                                const hipblasComplex* z,
+                                                int                   incz,
+                                                hipblasComplex*       result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCaxpyDotc(hipblasHandle_t       handle,
+                                                int                   n,
+                                                const hipblasComplex* alpha,
+                                                const hipblasComplex* x,
+                                                int                   incx,
+                                                hipblasComplex*       y,
+                                                int                   incy,
+                                                const hipblasComplex* z,
+                                                int                   incz,
+                                                hipblasComplex*       result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZaxpyDotu(hipblasHandle_t             handle,
+                                                int                         n,
+                                                const hipblasDoubleComplex* alpha,
+                                                const hipblasDoubleComplex* x,
+                                                int                         incx,
+                                                hipblasDoubleComplex*       y,
+                                                int                         incy,
+                                                const hipblasDoubleComplex* z,
+                                                int                         incz,
+                                                hipblasDoubleComplex*       result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZaxpyDotc(hipblasHandle_t             handle,
+                                                int                         n,
+                                                const hipblasDoubleComplex* alpha,
+                                                const hipblasDoubleComplex* x,
+                                                int                         incx,
+                                                hipblasDoubleComplex*       y,
+                                                int                         incy,
+                                                const hipblasDoubleComplex* z,
+                                                int                         incz,
+                                                hipblasDoubleComplex*       result);
+
+// axpyDot_batched
+HIPBLAS_EXPORT hipblasStatus_t hipblasSaxpyDotBatched(hipblasHandle_t    handle,
+                                                      int                n,
+                                                      const float*       alpha,
+                                                      const float* const x[],
+                                                      int                incx,
+                                                      float* const       y[],
+                                                      int                incy,
+                                                      const float* const z[],
+                                                      int                incz,
+                                                      int                batch_count,
+                                                      float*             result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDaxpyDotBatched(hipblasHandle_t     handle,
+                                                      int                 n,
+                                                      const double*       alpha,
+                                                      const double* const x[],
+                                                      int                 incx,
+                                                      double* const       y[],
+                                                      int                 incy,
+                                                      const double* const z[],
+                                                      int                 incz,
+                                                      int                 batch_count,
+                                                      double*             result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCaxpyDotuBatched(hipblasHandle_t             handle,
+                                                       int                         n,
+                                                       const hipblasComplex*       alpha,
+                                                       const hipblasComplex* const x[],
+                                                       int                         incx,
+                                                       hipblasComplex* const       y[],
+                                                       int                         incy,
+                                                       const hipblasComplex* const z[],
+                                                       int                         incz,
+                                                       int                         batch_count,
+                                                       hipblasComplex*             result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCaxpyDotcBatched(hipblasHandle_t             handle,
+                                                       int                         n,
+                                                       const hipblasComplex*       alpha,
+                                                       const hipblasComplex* const x[],
+                                                       int                         incx,
+                                                       hipblasComplex* const       y[],
+                                                       int                         incy,
+                                                       const hipblasComplex* const z[],
+                                                       int                         incz,
+                                                       int                         batch_count,
+                                                       hipblasComplex*             result);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZaxpyDotuBatched(hipblasHandle_t                   handle,
+                            int                               n,
+                            const hipblasDoubleComplex*       alpha,
+                            const hipblasDoubleComplex* const x[],
+                            int                               incx,
+                            hipblasDoubleComplex* const       y[],
+                            int                               incy,
+                            const hipblasDoubleComplex* const z[],
+                            int                               incz,
+                            int                               batch_count,
+                            hipblasDoubleComplex*             result);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZaxpyDotcBatched(hipblasHandle_t                   handle,
+                            int                               n,
+                            const hipblasDoubleComplex*       alpha,
+                            const hipblasDoubleComplex* const x[],
+                            int                               incx,
+                            hipblasDoubleComplex* const       y[],
+                            int                               incy,
+                            const hipblasDoubleComplex* const z[],
+                            int                               incz,
+                            int                               batch_count,
+                            hipblasDoubleComplex*             result);
+
+// axpyDot_strided_batched
+HIPBLAS_EXPORT hipblasStatus_t hipblasSaxpyDotStridedBatched(hipblasHandle_t handle,
+                                                             int             n,
+                                                             const float*    alpha,
+                                                             const float*    x,
+                                                             int             incx,
+                                                             int             stridex,
+                                                             float*          y,
+                                                             int             incy,
+                                                             int             stridey,
+                                                             const float*    z,
+                                                             int             incz,
+                                                             int             stridez,
+                                                             int             batch_count,
+                                                             float*          result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDaxpyDotStridedBatched(hipblasHandle_t handle,
+                                                             int             n,
+                                                             const double*   alpha,
+                                                             const double*   x,
+                                                             int             incx,
+                                                             int             stridex,
+                                                             double*         y,
+                                                             int             incy,
+                                                             int             stridey,
+                                                             const double*   z,
+                                                             int             incz,
+                                                             int             stridez,
+                                                             int             batch_count,
+                                                             double*         result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCaxpyDotuStridedBatched(hipblasHandle_t       handle,
+                                                              int                   n,
+                                                              const hipblasComplex* alpha,
+                                                              const hipblasComplex* x,
+                                                              int                   incx,
+                                                              int                   stridex,
+                                                              hipblasComplex*       y,
+                                                              int                   incy,
+                                                              int                   stridey,
+                                                              const hipblasComplex* z,
+                                                              int                   incz,
+                                                              int                   stridez,
+                                                              int                   batch_count,
+                                                              hipblasComplex*       result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCaxpyDotcStridedBatched(hipblasHandle_t       handle,
+                                                              int                   n,
+                                                              const hipblasComplex* alpha,
+                                                              const hipblasComplex* x,
+                                                              int                   incx,
+                                                              int                   stridex,
+                                                              hipblasComplex*       y,
+                                                              int                   incy,
+                                                              int                   stridey,
+                                                              const hipblasComplex* z,
+                                                              int                   incz,
+                                                              int                   stridez,
+                                                              int                   batch_count,
+                                                              hipblasComplex*       result);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZaxpyDotuStridedBatched(hipblasHandle_t             handle,
+                                   int                         n,
+                                   const hipblasDoubleComplex* alpha,
+                                   const hipblasDoubleComplex* x,
+                                   int                         incx,
+                                   int                         stridex,
+                                   hipblasDoubleComplex*       y,
+                                   int                         incy,
+                                   int                         stridey,
+                                   const hipblasDoubleComplex* z,
+                                   int                         incz,
+                                   int                         stridez,
+                                   int                         batch_count,
+                                   hipblasDoubleComplex*       result);
+
+HIPBLAS_EXPORT hipblasStatus_t
+    hipblasZaxpyDotcStridedBatched(hipblasHandle_t             handle,
+                                   int                         n,
+                                   const hipblasDoubleComplex* alpha,
+                                   const hipblasDoubleComplex* x,
+                                   int                         incx,
+                                   int                         stridex,
+                                   hipblasDoubleComplex*       y,
+                                   int                         incy,
+                                   int                         stridey,
+                                   const hipblasDoubleComplex* z,
+                                   int                         incz,
+                                   int                         stridez,
+                                   int                         batch_count,
+                                   hipblasDoubleComplex*       result);
+
+// Matrix norms of the m x n matrix A, as LAPACK's lange, with result following the pointer mode.
+// The batched forms store one norm per batch, and a host result is returned once the stream has
+// finished
+// lange
+HIPBLAS_EXPORT hipblasStatus_t hipblasSlange(hipblasHandle_t   handle,
+                                             hipblasNormType_t norm,
+                                             int               m,
+                                             int               n,
+                                             const float*      A,
+                                             int               lda,
+                                             float*            result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDlange(hipblasHandle_t   handle,
+                                             hipblasNormType_t norm,
+                                             int               m,
+                                             int               n,
+                                             const double*     A,
+                                             int               lda,
+                                             double*           result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasClange(hipblasHandle_t       handle,
+                                             hipblasNormType_t     norm,
+                                             int                   m,
+                                             int                   n,
+                                             const hipblasComplex* A,
+                                             int                   lda,
+                                             float*                result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZlange(hipblasHandle_t             handle,
+                                             hipblasNormType_t           norm,
+                                             int                         m,
+                                             int                         n,
+                                             const hipblasDoubleComplex* A,
+                                             int                         lda,
+                                             double*                     result);
+
+// lange_batched
+HIPBLAS_EXPORT hipblasStatus_t hipblasSlangeBatched(hipblasHandle_t    handle,
+                                                    hipblasNormType_t  norm,
+                                                    int                m,
+                                                    int                n,
+                                                    const float* const A[],
+                                                    int                lda,
+                                                    int                batch_count,
+                                                    float*             result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDlangeBatched(hipblasHandle_t     handle,
+                                                    hipblasNormType_t   norm,
+                                                    int                 m,
+                                                    int                 n,
+                                                    const double* const A[],
+                                                    int                 lda,
+                                                    int                 batch_count,
+                                                    double*             result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasClangeBatched(hipblasHandle_t             handle,
+                                                    hipblasNormType_t           norm,
+                                                    int                         m,
+                                                    int                         n,
+                                                    const hipblasComplex* const A[],
+                                                    int                         lda,
+                                                    int                         batch_count,
+                                                    float*                      result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZlangeBatched(hipblasHandle_t                   handle,
+                                                    hipblasNormType_t                 norm,
+                                                    int                               m,
+                                                    int                               n,
+                                                    const hipblasDoubleComplex* const A[],
+                                                    int                               lda,
+                                                    int                               batch_count,
+                                                    double*                           result);
+
+// lange_strided_batched
+HIPBLAS_EXPORT hipblasStatus_t hipblasSlangeStridedBatched(hipblasHandle_t   handle,
+                                                           hipblasNormType_t norm,
+                                                           int               m,
+                                                           int               n,
+                                                           const float*      A,
+                                                           int               lda,
+                                                           long long         strideA,
+                                                           int               batch_count,
+                                                           float*            result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDlangeStridedBatched(hipblasHandle_t   handle,
+                                                           hipblasNormType_t norm,
+                                                           int               m,
+                                                           int               n,
+                                                           const double*     A,
+                                                           int               lda,
+                                                           long long         strideA,
+                                                           int               batch_count,
+                                                           double*           result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasClangeStridedBatched(hipblasHandle_t       handle,
+                                                           hipblasNormType_t     norm,
+                                                           int                   m,
+                                                           int                   n,
+                                                           const hipblasComplex* A,
+                                                           int                   lda,
+                                                           long long             strideA,
+                                                           int                   batch_count,
+                                                           float*                result);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZlangeStridedBatched(hipblasHandle_t             handle,
+                                                           hipblasNormType_t           norm,
+                                                           int                         m,
+                                                           int                         n,
+                                                           const hipblasDoubleComplex* A,
+                                                           int                         lda,
+                                                           long long                   strideA,
+                                                           int                         batch_count,
+                                                           double*                     result);
+
+// lasr: A = P A for HIPBLAS_SIDE_LEFT, z = m, or A = A P^T for HIPBLAS_SIDE_RIGHT, z = n, with the
+// sequence of z - 1 plane rotations P = P(z - 2) ... P(1) P(0) in the forward direction and
+// P(0) P(1) ... P(z - 2) backward. P(k) is the rotation [c[k] s[k]; -s[k] c[k]] in the plane
+// pivot names, as in LAPACK's xLASR, and c and s are real device arrays. One launch applies the
+// whole sequence, each row or column held in registers as the rotations sweep it
+HIPBLAS_EXPORT hipblasStatus_t hipblasSlasr(hipblasHandle_t   handle,
+                                            hipblasSideMode_t side,
+                                            hipblasPivot_t    pivot,
+                                            hipblasDirect_t   direct,
+                                            int               m,
+                                            int               n,
+                                            const float*      c,
+                                            const float*      s,
+                                            float*            A,
+                                            int               lda);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDlasr(hipblasHandle_t   handle,
+                                            hipblasSideMode_t side,
+                                            hipblasPivot_t    pivot,
+                                            hipblasDirect_t   direct,
+                                            int               m,
+                                            int               n,
+                                            const double*     c,
+                                            const double*     s,
+                                            double*           A,
+                                            int               lda);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasClasr(hipblasHandle_t   handle,
+                                            hipblasSideMode_t side,
+                                            hipblasPivot_t    pivot,
+                                            hipblasDirect_t   direct,
+                                            int               m,
+                                            int               n,
+                                            const float*      c,
+                                            const float*      s,
+                                            hipblasComplex*   A,
+                                            int               lda);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZlasr(hipblasHandle_t       handle,
+                                            hipblasSideMode_t     side,
+                                            hipblasPivot_t        pivot,
+                                            hipblasDirect_t       direct,
+                                            int                   m,
+                                            int                   n,
+                                            const double*         c,
+                                            const double*         s,
+                                            hipblasDoubleComplex* A,
+                                            int                   lda);
+
+// lasr_batched
+HIPBLAS_EXPORT hipblasStatus_t hipblasSlasrBatched(hipblasHandle_t    handle,
+                                                   hipblasSideMode_t  side,
+                                                   hipblasPivot_t     pivot,
+                                                   hipblasDirect_t    direct,
+                                                   int                m,
+                                                   int                n,
+                                                   const float* const c[],
+                                                   const float* const s[],
+                                                   float* const       A[],
                                                    int                lda,
-                                                   const float* const B[],
-                                                   int                ldb,
-                                                   const float*       beta,
-                                                   float* const       C[],
-                                                   int                ldc,
-                                                   int                batchCount);
+                                                   int                batch_count);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasDgemmBatched(hipblasHandle_t     handle,
-                                                   hipblasOperation_t  transa,
-                                                   hipblasOperation_t  transb,
+HIPBLAS_EXPORT hipblasStatus_t hipblasDlasrBatched(hipblasHandle_t     handle,
+                                                   hipblasSideMode_t   side,
+                                                   hipblasPivot_t      pivot,
+                                                   hipblasDirect_t     direct,
                                                    int                 m,
                                                    int                 n,
-                                                   int                 k,
-                                                   const double*       alpha,
-                                                   const double* const A[],
+                                                   const double* const c[],
+                                                   const double* const s[],
+                                                   double* const       A[],
                                                    int                 lda,
-                                                   const double* const B[],
-                                                   int                 ldb,
-                                                   const double*       beta,
-                                                   double* const       C[],
-                                                   int                 ldc,
-                                                   int                 batchCount);
+                                                   int                 batch_count);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasCgemmBatched(hipblasHandle_t             handle,
-                                                   hipblasOperation_t          transa,
-                                                   hipblasOperation_t          transb,
+HIPBLAS_EXPORT hipblasStatus_t hipblasClasrBatched(hipblasHandle_t       handle,
+                                                   hipblasSideMode_t     side,
+                                                   hipblasPivot_t        pivot,
+                                                   hipblasDirect_t       direct,
+                                                   int                   m,
+                                                   int                   n,
+                                                   const float* const    c[],
+                                                   const float* const    s[],
+                                                   hipblasComplex* const A[],
+                                                   int                   lda,
+                                                   int                   batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZlasrBatched(hipblasHandle_t             handle,
+                                                   hipblasSideMode_t           side,
+                                                   hipblasPivot_t              pivot,
+                                                   hipblasDirect_t             direct,
                                                    int                         m,
                                                    int                         n,
-                                                   int                         k,
-                                                   const hipblasComplex*       alpha,
-                                                   const hipblasComplex* const A[],
+                                                   const double* const         c[],
+                                                   const double* const         s[],
+                                                   hipblasDoubleComplex* const A[],
                                                    int                         lda,
-                                                   const hipblasComplex* const B[],
-                                                   int                         ldb,
-                                                   const hipblasComplex*       beta,
-                                                   hipblasComplex* const       C[],
-                                                   int                         ldc,
-                                                   int                         batchCount);
-
-HIPBLAS_EXPORT hipblasStatus_t hipblasZgemmBatched(hipblasHandle_t                   handle,
-                                                   hipblasOperation_t                transa,
-                                                   hipblasOperation_t                transb,
-                                                   int                               m,
-                                                   int                               n,
-                                                   int                               k,
-                                                   const hipblasDoubleComplex*       alpha,
-                                                   const hipblasDoubleComplex* const A[],
-                                                   int                               lda,
-                                                   const hipblasDoubleComplex* const B[],
-                                                   int                               ldb,
-                                                   const hipblasDoubleComplex*       beta,
-                                                   hipblasDoubleComplex* const       C[],
-                                                   int                               ldc,
-                                                   int                               batchCount);
-
-// gemm_strided_batched
-HIPBLAS_EXPORT hipblasStatus_t hipblasHgemmStridedBatched(hipblasHandle_t    handle,
-                                                          hipblasOperation_t transa,
-                                                          hipblasOperation_t transb,
-                                                          int                m,
-                                                          int                n,
-                                                          int                k,
-                                                          const hipblasHalf* alpha,
-                                                          const hipblasHalf* A,
-                                                          int                lda,
-                                                          long long          bsa,
-                                                          const hipblasHalf* B,
-                                                          int                ldb,
-                                                          long long          bsb,
-                                                          const hipblasHalf* beta,
-                                                          hipblasHalf*       C,
-                                                          int                ldc,
-                                                          long long          bsc,
-                                                          int                batchCount);
-
-HIPBLAS_EXPORT hipblasStatus_t hipblasSgemmStridedBatched(hipblasHandle_t    handle,
-                                                          hipblasOperation_t transa,
-                                                          hipblasOperation_t transb,
-                                                          int                m,
-                                                          int                n,
-                                                          int                k,
-                                                          const float*       alpha,
-                                                          const float*       A,
-                                                          int                lda,
-                                                          long long          bsa,
-                                                          const float*       B,
-                                                          int                ldb,
-                                                          long long          bsb,
-                                                          const float*       beta,
-                                                          float*             C,
-                                                          int                ldc,
-                                                          long long          bsc,
-                                                          int                batchCount);
+                                                   int                         batch_count);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasDgemmStridedBatched(hipblasHandle_t    handle,
-                                                          hipblasOperation_t transa,
-                                                          hipblasOperation_t transb,
-                                                          int                m,
-                                                          int                n,
-                                                          int                k,
-                                                          const double*      alpha,
-                                                          const double*      A,
-                                                          int                lda,
-                                                          long long          bsa,
-                                                          const double*      B,
-                                                          int                ldb,
-                                                          long long          bsb,
-                                                          const double*      beta,
-                                                          double*            C,
-                                                          int                ldc,
-                                                          long long          bsc,
-                                                          int                batchCount);
+// lasr_strided_batched: batch b's rotations are at c + b * stridecs and s + b * stridecs
+HIPBLAS_EXPORT hipblasStatus_t hipblasSlasrStridedBatched(hipblasHandle_t   handle,
+                                                          hipblasSideMode_t side,
+                                                          hipblasPivot_t    pivot,
+                                                          hipblasDirect_t   direct,
+                                                          int               m,
+                                                          int               n,
+                                                          const float*      c,
+                                                          const float*      s,
+                                                          long long         stridecs,
+                                                          float*            A,
+                                                          int               lda,
+                                                          long long         strideA,
+                                                          int               batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDlasrStridedBatched(hipblasHandle_t   handle,
+                                                          hipblasSideMode_t side,
+                                                          hipblasPivot_t    pivot,
+                                                          hipblasDirect_t   direct,
+                                                          int               m,
+                                                          int               n,
+                                                          const double*     c,
+                                                          const double*     s,
+                                                          long long         stridecs,
+                                                          double*           A,
+                                                          int               lda,
+                                                          long long         strideA,
+                                                          int               batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasClasrStridedBatched(hipblasHandle_t   handle,
+                                                          hipblasSideMode_t side,
+                                                          hipblasPivot_t    pivot,
+                                                          hipblasDirect_t   direct,
+                                                          int               m,
+                                                          int               n,
+                                                          const float*      c,
+                                                          const float*      s,
+                                                          long long         stridecs,
+                                                          hipblasComplex*   A,
+                                                          int               lda,
+                                                          long long         strideA,
+                                                          int               batch_count);
 
-HIPBLAS_EXPORT hipblasStatus_t hipblasCgemmStridedBatched(hipblasHandle_t       handle,
-                                                          hipblasOperation_t    transa,
-                                                          hipblasOperation_t    transb,
+HIPBLAS_EXPORT hipblasStatus_t hipblasZlasrStridedBatched(hipblasHandle_t       handle,
+                                                          hipblasSideMode_t     side,
+                                                          hipblasPivot_t        pivot,
+                                                          hipblasDirect_t       direct,
                                                           int                   m,
                                                           int                   n,
-                                                          int                   k,
-                                                          const hipblasComplex* alpha,
-                                                          const hipblasComplex* A,
+                                                          const double*         c,
+                                                          const double*         s,
+                                                          long long             stridecs,
+                                                          hipblasDoubleComplex* A,
                                                           int                   lda,
-                                                          long long             bsa,
-                                                          const hipblasComplex* B,
-                                                          int                   ldb,
-                                                          long long             bsb,
-                                                          const hipblasComplex* beta,
-                                                          hipblasComplex*       C,
-                                                          int                   ldc,
-                                                          long long             bsc,
-                                                          int                   batchCount);
-
-HIPBLAS_EXPORT hipblasStatus_t hipblasZgemmStridedBatched(hipblasHandle_t             handle,
-                                                          hipblasOperation_t          transa,
-                                                          hipblasOperation_t          transb,
-                                                          int                         m,
-                                                          int                         n,
-                                                          int                         k,
-                                                          const hipblasDoubleComplex* alpha,
-                                                          const hipblasDoubleComplex* A,
-                                                          int                         lda,
-                                                          long long                   bsa,
-                                                          const hipblasDoubleComplex* B,
-                                                          int                         ldb,
-                                                          long long                   bsb,
-                                                          const hipblasDoubleComplex* beta,
-                                                          hipblasDoubleComplex*       C,
-                                                          int                         ldc,
-                                                          long long                   bsc,
-                                                          int                         batchCount);
+                                                          long long             strideA,
+                                                          int                   batch_count);
 
-// gemmex
-HIPBLAS_EXPORT hipblasStatus_t hipblasGemmEx(hipblasHandle_t    handle,
-                                             hipblasOperation_t trans_a,
-                                             hipblasOperation_t trans_b,
+// Type-converting copies, each one pass over its operands. copyEx copies x to y and geamEx
+// computes C = alpha op(A) + beta op(B) in execution_type, every vector or matrix with its own
+// type; transposeEx sets B = op(A), which may convert as well. The real types are HIPBLAS_R_16F,
+// R_16B, R_32F and R_64F and the complex ones C_32F and C_64F; all operands are real or all
+// complex. copyEx and transposeEx convert through R_64F or C_64F when an operand has that type,
+// else through R_32F or C_32F. alpha and beta are of execution_type and follow the pointer mode,
+// and A is not read when alpha is 0, nor B when beta is 0. C may be an untransposed A or B of its
+// own type and leading dimension. Strides count elements of the operand's type
+// copy_ex
+HIPBLAS_EXPORT hipblasStatus_t hipblasCopyEx(hipblasHandle_t   handle,
+                                             int               n,
+                                             const void*       x,
+                                             hipblasDatatype_t x_type,
+                                             int               incx,
+                                             void*             y,
+                                             hipblasDatatype_t y_type,
+                                             int               incy);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCopyBatchedEx(hipblasHandle_t   handle,
+                                                    int               n,
+                                                    const void* const x[],
+                                                    hipblasDatatype_t x_type,
+                                                    int               incx,
+                                                    void* const       y[],
+                                                    hipblasDatatype_t y_type,
+                                                    int               incy,
+                                                    int               batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCopyStridedBatchedEx(hipblasHandle_t   handle,
+                                                           int               n,
+                                                           const void*       x,
+                                                           hipblasDatatype_t x_type,
+                                                           int               incx,
+                                                           long long         stride_x,
+                                                           void*             y,
+                                                           hipblasDatatype_t y_type,
+                                                           int               incy,
+                                                           long long         stride_y,
+                                                           int               batch_count);
+
+// geam_ex
+HIPBLAS_EXPORT hipblasStatus_t hipblasGeamEx(hipblasHandle_t    handle,
+                                             hipblasOperation_t transA,
+                                             hipblasOperation_t transB,
                                              int                m,
                                              int                n,
-                                             int                k,
                                              const void*        alpha,
-                                             const void*        a,
+                                             const void*        A,
                                              hipblasDatatype_t  a_type,
                                              int                lda,
-                                             const void*        b,
+                                             const void*        beta,
+                                             const void*        B,
                                              hipblasDatatype_t  b_type,
                                              int                ldb,
-                                             const void*        beta,
-                                             void*              c,
+                                             void*              C,
                                              hipblasDatatype_t  c_type,
                                              int                ldc,
-                                             hipblasDatatype_t  compute_type,
-                                             hipblasGemmAlgo_t  algo);
+                                             hipblasDatatype_t  execution_type);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasGeamBatchedEx(hipblasHandle_t    handle,
+                                                    hipblasOperation_t transA,
+                                                    hipblasOperation_t transB,
+                                                    int                m,
+                                                    int                n,
+                                                    const void*        alpha,
+                                                    const void* const  A[],
+                                                    hipblasDatatype_t  a_type,
+                                                    int                lda,
+                                                    const void*        beta,
+                                                    const void* const  B[],
+                                                    hipblasDatatype_t  b_type,
+                                                    int                ldb,
+                                                    void* const        C[],
+                                                    hipblasDatatype_t  c_type,
+                                                    int                ldc,
+                                                    int                batch_count,
+                                                    hipblasDatatype_t  execution_type);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasGeamStridedBatchedEx(hipblasHandle_t    handle,
+                                                           hipblasOperation_t transA,
+                                                           hipblasOperation_t transB,
+                                                           int                m,
+                                                           int                n,
+                                                           const void*        alpha,
+                                                           const void*        A,
+                                                           hipblasDatatype_t  a_type,
+                                                           int                lda,
+                                                           long long          strideA,
+                                                           const void*        beta,
+                                                           const void*        B,
+                                                           hipblasDatatype_t  b_type,
+                                                           int                ldb,
+                                                           long long          strideB,
+                                                           void*              C,
+                                                           hipblasDatatype_t  c_type,
+                                                           int                ldc,
+                                                           long long          strideC,
+                                                           int                batch_count,
+                                                           hipblasDatatype_t  execution_type);
+
+// transpose_ex
+HIPBLAS_EXPORT hipblasStatus_t hipblasTransposeEx(hipblasHandle_t    handle,
+                                                  hipblasOperation_t trans,
+                                                  int                m,
+                                                  int                n,
+                                                  const void*        A,
+                                                  hipblasDatatype_t  a_type,
+                                                  int                lda,
+                                                  void*              B,
+                                                  hipblasDatatype_t  b_type,
+                                                  int                ldb);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasTransposeBatchedEx(hipblasHandle_t    handle,
+                                                         hipblasOperation_t trans,
+                                                         int                m,
+                                                         int                n,
+                                                         const void* const  A[],
+                                                         hipblasDatatype_t  a_type,
+                                                         int                lda,
+                                                         void* const        B[],
+                                                         hipblasDatatype_t  b_type,
+                                                         int                ldb,
+                                                         int                batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasTransposeStridedBatchedEx(hipblasHandle_t    handle,
+                                                                hipblasOperation_t trans,
+                                                                int                m,
+                                                                int                n,
+                                                                const void*        A,
+                                                                hipblasDatatype_t  a_type,
+                                                                int                lda,
+                                                                long long          strideA,
+                                                                void*              B,
+                                                                hipblasDatatype_t  b_type,
+                                                                int                ldb,
+                                                                long long          strideB,
+                                                                int                batch_count);
+
+// Copies of the m x n matrix A to B, each with its own leading dimension, as LAPACK's lacpy:
+// the upper or lower triangle, or all of A for HIPBLAS_FILL_MODE_FULL; the rest of B is left as
+// it was. Each is one launch moving columns 16 bytes at a time when the operands allow, with no
+// arithmetic, where geam with beta = 0 would scale every element. lacpyEx converts between the
+// types of copyEx as it copies. A and B must not overlap. Strides count elements of the operand's
+// type
+// lacpy
+HIPBLAS_EXPORT hipblasStatus_t hipblasSlacpy(hipblasHandle_t   handle,
+                                             hipblasFillMode_t uplo,
+                                             int               m,
+                                             int               n,
+                                             const float*      A,
+                                             int               lda,
+                                             float*            B,
+                                             int               ldb);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDlacpy(hipblasHandle_t   handle,
+                                             hipblasFillMode_t uplo,
+                                             int               m,
+                                             int               n,
+                                             const double*     A,
+                                             int               lda,
+                                             double*           B,
+                                             int               ldb);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasClacpy(hipblasHandle_t       handle,
+                                             hipblasFillMode_t     uplo,
+                                             int                   m,
+                                             int                   n,
+                                             const hipblasComplex* A,
+                                             int                   lda,
+                                             hipblasComplex*       B,
+                                             int                   ldb);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZlacpy(hipblasHandle_t             handle,
+                                             hipblasFillMode_t           uplo,
+                                             int                         m,
+                                             int                         n,
+                                             const hipblasDoubleComplex* A,
+                                             int                         lda,
+                                             hipblasDoubleComplex*       B,
+                                             int                         ldb);
+
+// lacpy_batched
+HIPBLAS_EXPORT hipblasStatus_t hipblasSlacpyBatched(hipblasHandle_t    handle,
+                                                    hipblasFillMode_t  uplo,
+                                                    int                m,
+                                                    int                n,
+                                                    const float* const A[],
+                                                    int                lda,
+                                                    float* const       B[],
+                                                    int                ldb,
+                                                    int                batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDlacpyBatched(hipblasHandle_t     handle,
+                                                    hipblasFillMode_t   uplo,
+                                                    int                 m,
+                                                    int                 n,
+                                                    const double* const A[],
+                                                    int                 lda,
+                                                    double* const       B[],
+                                                    int                 ldb,
+                                                    int                 batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasClacpyBatched(hipblasHandle_t             handle,
+                                                    hipblasFillMode_t           uplo,
+                                                    int                         m,
+                                                    int                         n,
+                                                    const hipblasComplex* const A[],
+                                                    int                         lda,
+                                                    hipblasComplex* const       B[],
+                                                    int                         ldb,
+                                                    int                         batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZlacpyBatched(hipblasHandle_t                   handle,
+                                                    hipblasFillMode_t                 uplo,
+                                                    int                               m,
+                                                    int                               n,
+                                                    const hipblasDoubleComplex* const A[],
+                                                    int                               lda,
+                                                    hipblasDoubleComplex* const       B[],
+                                                    int                               ldb,
+                                                    int                               batch_count);
+
+// lacpy_strided_batched
+HIPBLAS_EXPORT hipblasStatus_t hipblasSlacpyStridedBatched(hipblasHandle_t   handle,
+                                                           hipblasFillMode_t uplo,
+                                                           int               m,
+                                                           int               n,
+                                                           const float*      A,
+                                                           int               lda,
+                                                           long long         strideA,
+                                                           float*            B,
+                                                           int               ldb,
+                                                           long long         strideB,
+                                                           int               batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDlacpyStridedBatched(hipblasHandle_t   handle,
+                                                           hipblasFillMode_t uplo,
+                                                           int               m,
+                                                           int               n,
+                                                           const double*     A,
+                                                           int               lda,
+                                                           long long         strideA,
+                                                           double*           B,
+                                                           int               ldb,
+                                                           long long         strideB,
+                                                           int               batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasClacpyStridedBatched(hipblasHandle_t       handle,
+                                                           hipblasFillMode_t     uplo,
+                                                           int                   m,
+                                                           int                   n,
+                                                           const hipblasComplex* A,
+                                                           int                   lda,
+                                                           long long             strideA,
+                                                           hipblasComplex*       B,
+                                                           int                   ldb,
+                                                           long long             strideB,
+                                                           int                   batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZlacpyStridedBatched(hipblasHandle_t             handle,
+                                                           hipblasFillMode_t           uplo,
+                                                           int                         m,
+                                                           int                         n,
+                                                           const hipblasDoubleComplex* A,
+                                                           int                         lda,
+                                                           long long                   strideA,
+                                                           hipblasDoubleComplex*       B,
+                                                           int                         ldb,
+                                                           long long                   strideB,
+                                                           int                         batch_count);
+
+// lacpy_ex
+HIPBLAS_EXPORT hipblasStatus_t hipblasLacpyEx(hipblasHandle_t   handle,
+                                              hipblasFillMode_t uplo,
+                                              int               m,
+                                              int               n,
+                                              const void*       A,
+                                              hipblasDatatype_t a_type,
+                                              int               lda,
+                                              void*             B,
+                                              hipblasDatatype_t b_type,
+                                              int               ldb);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasLacpyBatchedEx(hipblasHandle_t   handle,
+                                                     hipblasFillMode_t uplo,
+                                                     int               m,
+                                                     int               n,
+                                                     const void* const A[],
+                                                     hipblasDatatype_t a_type,
+                                                     int               lda,
+                                                     void* const       B[],
+                                                     hipblasDatatype_t b_type,
+                                                     int               ldb,
+                                                     int               batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasLacpyStridedBatchedEx(hipblasHandle_t   handle,
+                                                            hipblasFillMode_t uplo,
+                                                            int               m,
+                                                            int               n,
+                                                            const void*       A,
+                                                            hipblasDatatype_t a_type,
+                                                            int               lda,
+                                                            long long         strideA,
+                                                            void*             B,
+                                                            hipblasDatatype_t b_type,
+                                                            int               ldb,
+                                                            long long         strideB,
+                                                            int               batch_count);
+
+// vbatched level-1 ex: axpy, axpby, scal and copy over batch_count vectors of their own lengths,
+// such as the parameters an optimizer step updates, each with the types of copyEx and computed
+// in execution_type as geamEx is; copy converts as copyEx does. n, incx, incy and the pointer
+// arrays are device arrays as for gemv_vbatched, and an entry with n[b] <= 0 or a zero increment
+// is skipped. alpha and beta are of execution_type and follow the pointer mode, apart by the
+// handle's scalar stride in device pointer mode; y is not read when beta is 0. Each call is one
+// launch that deals the elements of the whole batch out evenly to the threads, whatever the
+// lengths are; the lengths are walked by every thread, so the batch is best kept to thousands
+HIPBLAS_EXPORT hipblasStatus_t hipblasAxpyVbatchedEx(hipblasHandle_t   handle,
+                                                     const int         n[],
+                                                     const void*       alpha,
+                                                     const void* const x[],
+                                                     hipblasDatatype_t x_type,
+                                                     const int         incx[],
+                                                     void* const       y[],
+                                                     hipblasDatatype_t y_type,
+                                                     const int         incy[],
+                                                     int               batch_count,
+                                                     hipblasDatatype_t execution_type);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasAxpbyVbatchedEx(hipblasHandle_t   handle,
+                                                      const int         n[],
+                                                      const void*       alpha,
+                                                      const void* const x[],
+                                                      hipblasDatatype_t x_type,
+                                                      const int         incx[],
+                                                      const void*       beta,
+                                                      void* const       y[],
+                                                      hipblasDatatype_t y_type,
+                                                      const int         incy[],
+                                                      int               batch_count,
+                                                      hipblasDatatype_t execution_type);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasScalVbatchedEx(hipblasHandle_t   handle,
+                                                     const int         n[],
+                                                     const void*       alpha,
+                                                     void* const       x[],
+                                                     hipblasDatatype_t x_type,
+                                                     const int         incx[],
+                                                     int               batch_count,
+                                                     hipblasDatatype_t execution_type);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCopyVbatchedEx(hipblasHandle_t   handle,
+                                                     const int         n[],
+                                                     const void* const x[],
+                                                     hipblasDatatype_t x_type,
+                                                     const int         incx[],
+                                                     void* const       y[],
+                                                     hipblasDatatype_t y_type,
+                                                     const int         incy[],
+                                                     int               batch_count);
+
+// Fill the other triangle of the n x n matrix A from its uplo triangle, as the full matrix syrk,
+// syrkx, herk and her2k leave in one triangle: symmetrize mirrors it and hermitize mirrors its
+// conjugate and makes the diagonal real. One launch mirrors tiles through shared memory for all
+// batches; uplo is HIPBLAS_FILL_MODE_UPPER or HIPBLAS_FILL_MODE_LOWER
+// symmetrize
+HIPBLAS_EXPORT hipblasStatus_t hipblasSsymmetrize(hipblasHandle_t   handle,
+                                                  hipblasFillMode_t uplo,
+                                                  int               n,
+                                                  float*            A,
+                                                  int               lda);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDsymmetrize(hipblasHandle_t   handle,
+                                                  hipblasFillMode_t uplo,
+                                                  int               n,
+                                                  double*           A,
+                                                  int               lda);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsymmetrize(hipblasHandle_t   handle,
+                                                  hipblasFillMode_t uplo,
+                                                  int               n,
+                                                  hipblasComplex*   A,
+                                                  int               lda);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZsymmetrize(hipblasHandle_t       handle,
+                                                  hipblasFillMode_t     uplo,
+                                                  int                   n,
+                                                  hipblasDoubleComplex* A,
+                                                  int                   lda);
+
+// symmetrize_batched
+HIPBLAS_EXPORT hipblasStatus_t hipblasSsymmetrizeBatched(hipblasHandle_t   handle,
+                                                         hipblasFillMode_t uplo,
+                                                         int               n,
+                                                         float* const      A[],
+                                                         int               lda,
+                                                         int               batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDsymmetrizeBatched(hipblasHandle_t   handle,
+                                                         hipblasFillMode_t uplo,
+                                                         int               n,
+                                                         double* const     A[],
+                                                         int               lda,
+                                                         int               batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsymmetrizeBatched(hipblasHandle_t       handle,
+                                                         hipblasFillMode_t     uplo,
+                                                         int                   n,
+                                                         hipblasComplex* const A[],
+                                                         int                   lda,
+                                                         int                   batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZsymmetrizeBatched(hipblasHandle_t             handle,
+                                                         hipblasFillMode_t           uplo,
+                                                         int                         n,
+                                                         hipblasDoubleComplex* const A[],
+                                                         int                         lda,
+                                                         int                         batch_count);
+
+// symmetrize_strided_batched
+HIPBLAS_EXPORT hipblasStatus_t hipblasSsymmetrizeStridedBatched(hipblasHandle_t   handle,
+                                                                hipblasFillMode_t uplo,
+                                                                int               n,
+                                                                float*            A,
+                                                                int               lda,
+                                                                long long         strideA,
+                                                                int               batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDsymmetrizeStridedBatched(hipblasHandle_t   handle,
+                                                                hipblasFillMode_t uplo,
+                                                                int               n,
+                                                                double*           A,
+                                                                int               lda,
+                                                                long long         strideA,
+                                                                int               batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCsymmetrizeStridedBatched(hipblasHandle_t   handle,
+                                                                hipblasFillMode_t uplo,
+                                                                int               n,
+                                                                hipblasComplex*   A,
+                                                                int               lda,
+                                                                long long         strideA,
+                                                                int               batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZsymmetrizeStridedBatched(hipblasHandle_t       handle,
+                                                                hipblasFillMode_t     uplo,
+                                                                int                   n,
+                                                                hipblasDoubleComplex* A,
+                                                                int                   lda,
+                                                                long long             strideA,
+                                                                int                   batch_count);
+
+// hermitize
+HIPBLAS_EXPORT hipblasStatus_t hipblasChermitize(hipblasHandle_t   handle,
+                                                 hipblasFillMode_t uplo,
+                                                 int               n,
+                                                 hipblasComplex*   A,
+                                                 int               lda);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZhermitize(hipblasHandle_t       handle,
+                                                 hipblasFillMode_t     uplo,
+                                                 int                   n,
+                                                 hipblasDoubleComplex* A,
+                                                 int                   lda);
+
+// hermitize_batched
+HIPBLAS_EXPORT hipblasStatus_t hipblasChermitizeBatched(hipblasHandle_t       handle,
+                                                        hipblasFillMode_t     uplo,
+                                                        int                   n,
+                                                        hipblasComplex* const A[],
+                                                        int                   lda,
+                                                        int                   batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZhermitizeBatched(hipblasHandle_t             handle,
+                                                        hipblasFillMode_t           uplo,
+                                                        int                         n,
+                                                        hipblasDoubleComplex* const A[],
+                                                        int                         lda,
+                                                        int                         batch_count);
+
+// hermitize_strided_batched
+HIPBLAS_EXPORT hipblasStatus_t hipblasChermitizeStridedBatched(hipblasHandle_t   handle,
+                                                               hipblasFillMode_t uplo,
+                                                               int               n,
+                                                               hipblasComplex*   A,
+                                                               int               lda,
+                                                               long long         strideA,
+                                                               int               batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZhermitizeStridedBatched(hipblasHandle_t       handle,
+                                                               hipblasFillMode_t     uplo,
+                                                               int                   n,
+                                                               hipblasDoubleComplex* A,
+                                                               int                   lda,
+                                                               long long             strideA,
+                                                               int                   batch_count);
+
+// In-place transpose of the n x n matrix A, A = op(A) for trans HIPBLAS_OP_T or HIPBLAS_OP_C, the
+// two alike for real types; HIPBLAS_OP_N leaves A as it is. For routines that take no transpose
+// option, such as getrf and geqrf, without the second matrix an out-of-place transposeEx needs.
+// One launch swaps each pair of tiles across the diagonal through shared memory for all batches
+// transpose
+HIPBLAS_EXPORT hipblasStatus_t hipblasStranspose(hipblasHandle_t    handle,
+                                                 hipblasOperation_t trans,
+                                                 int                n,
+                                                 float*             A,
+                                                 int                lda);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtranspose(hipblasHandle_t    handle,
+                                                 hipblasOperation_t trans,
+                                                 int                n,
+                                                 double*            A,
+                                                 int                lda);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtranspose(hipblasHandle_t    handle,
+                                                 hipblasOperation_t trans,
+                                                 int                n,
+                                                 hipblasComplex*    A,
+                                                 int                lda);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtranspose(hipblasHandle_t       handle,
+                                                 hipblasOperation_t    trans,
+                                                 int                   n,
+                                                 hipblasDoubleComplex* A,
+                                                 int                   lda);
+
+// transpose_batched
+HIPBLAS_EXPORT hipblasStatus_t hipblasStransposeBatched(hipblasHandle_t    handle,
+                                                        hipblasOperation_t trans,
+                                                        int                n,
+                                                        float* const       A[],
+                                                        int                lda,
+                                                        int                batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtransposeBatched(hipblasHandle_t    handle,
+                                                        hipblasOperation_t trans,
+                                                        int                n,
+                                                        double* const      A[],
+                                                        int                lda,
+                                                        int                batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtransposeBatched(hipblasHandle_t       handle,
+                                                        hipblasOperation_t    trans,
+                                                        int                   n,
+                                                        hipblasComplex* const A[],
+                                                        int                   lda,
+                                                        int                   batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtransposeBatched(hipblasHandle_t             handle,
+                                                        hipblasOperation_t          trans,
+                                                        int                         n,
+                                                        hipblasDoubleComplex* const A[],
+                                                        int                         lda,
+                                                        int                         batch_count);
+
+// transpose_strided_batched
+HIPBLAS_EXPORT hipblasStatus_t hipblasStransposeStridedBatched(hipblasHandle_t    handle,
+                                                               hipblasOperation_t trans,
+                                                               int                n,
+                                                               float*             A,
+                                                               int                lda,
+                                                               long long          strideA,
+                                                               int                batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDtransposeStridedBatched(hipblasHandle_t    handle,
+                                                               hipblasOperation_t trans,
+                                                               int                n,
+                                                               double*            A,
+                                                               int                lda,
+                                                               long long          strideA,
+                                                               int                batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasCtransposeStridedBatched(hipblasHandle_t    handle,
+                                                               hipblasOperation_t trans,
+                                                               int                n,
+                                                               hipblasComplex*    A,
+                                                               int                lda,
+                                                               long long          strideA,
+                                                               int                batch_count);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasZtransposeStridedBatched(hipblasHandle_t       handle,
+                                                               hipblasOperation_t    trans,
+                                                               int                   n,
+                                                               hipblasDoubleComplex* A,
+                                                               int                   lda,
+                                                               long long             strideA,
+                                                               int                   batch_count);
+
+// Checks the info array a batched solver such as getrfBatched leaves in device memory without
+// copying it back: result[0] is set to the number of batches with a nonzero info and result[1] to
+// the index of the first, or -1 when every batch succeeded. result is written asynchronously on
+// the handle's stream, so it may be device memory or pinned host memory the device can address;
+// the host reads it once the stream has passed the call
+HIPBLAS_EXPORT hipblasStatus_t hipblasInfoReduce(hipblasHandle_t handle,
+                                                 int             batch_count,
+                                                 const int*      info,
+                                                 int*            result);
+
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,527 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+//! Typed C++ interface to hipblas. Every routine in namespace hipblas is an inline overload of
+//! its C entry point, picked by the element type of its pointer arguments, so generic code such
+//! as hipblas::gemm(handle, ..., A, ...) with T* A resolves to hipblasSgemm, hipblasZgemm and so
+//! on at compile time and inlines to a direct call of the C routine. The backend is the one the
+//! C library was built for.
+//
+#ifndef HIPBLAS_HPP
+#define HIPBLAS_HPP
+#pragma once
+#include "hipblas.h"
+
+namespace hipblas
+{
+    // hipblasDatatype_t of an element type, for the Ex routines
+    template <typename T>
+    struct datatype;
+
+    template <>
+    struct datatype<hipblasHalf>
+    {
+        static constexpr hipblasDatatype_t value = HIPBLAS_R_16F;
+    };
+
+    template <>
+    struct datatype<hipblasBfloat16>
+    {
+        static constexpr hipblasDatatype_t value = HIPBLAS_R_16B;
+    };
+
+    template <>
+    struct datatype<float>
+    {
+        static constexpr hipblasDatatype_t value = HIPBLAS_R_32F;
+    };
+
+    template <>
+    struct datatype<double>
+    {
+        static constexpr hipblasDatatype_t value = HIPBLAS_R_64F;
+    };
+
+    template <>
+    struct datatype<hipblasComplex>
+    {
+        static constexpr hipblasDatatype_t value = HIPBLAS_C_32F;
+    };
+
+    template <>
+    struct datatype<hipblasDoubleComplex>
+    {
+        static constexpr hipblasDatatype_t value = HIPBLAS_C_64F;
+    };
+
+    // Real type of an element type: the type of nrm2 and asum results and of the real scal
+    template <typename T>
+    struct real_type
+    {
+        using type = T;
+    };
+
+    template <>
+    struct real_type<hipblasComplex>
+    {
+        using type = float;
+    };
+
+    template <>
+    struct real_type<hipblasDoubleComplex>
+    {
+        using type = double;
+    };
+
+    template <typename T>
+    using real_t = typename real_type<T>::type;
+
+// clang-format off
+// P is the precision prefix of the C routine, R that of nrm2 and asum and I that of amax/amin
+#define HIPBLAS_CXX_LEVEL1(T, P, R, I)                                                             \
+    inline hipblasStatus_t scal(hipblasHandle_t h, int n, const T* alpha, T* x, int incx)          \
+    {                                                                                              \
+        return hipblas##P##scal(h, n, alpha, x, incx);                                             \
+    }                                                                                              \
+    inline hipblasStatus_t copy(hipblasHandle_t h, int n, const T* x, int incx, T* y, int incy)    \
+    {                                                                                              \
+        return hipblas##P##copy(h, n, x, incx, y, incy);                                           \
+    }                                                                                              \
+    inline hipblasStatus_t swap(hipblasHandle_t h, int n, T* x, int incx, T* y, int incy)          \
+    {                                                                                              \
+        return hipblas##P##swap(h, n, x, incx, y, incy);                                           \
+    }                                                                                              \
+    inline hipblasStatus_t axpy(                                                                   \
+        hipblasHandle_t h, int n, const T* alpha, const T* x, int incx, T* y, int incy)            \
+    {                                                                                              \
+        return hipblas##P##axpy(h, n, alpha, x, incx, y, incy);                                    \
+    }                                                                                              \
+    inline hipblasStatus_t nrm2(hipblasHandle_t h, int n, const T* x, int incx, real_t<T>* result) \
+    {                                                                                              \
+        return hipblas##R##nrm2(h, n, x, incx, result);                                            \
+    }                                                                                              \
+    inline hipblasStatus_t asum(hipblasHandle_t h, int n, const T* x, int incx, real_t<T>* result) \
+    {                                                                                              \
+        return hipblas##R##asum(h, n, x, incx, result);                                            \
+    }                                                                                              \
+    inline hipblasStatus_t amax(hipblasHandle_t h, int n, const T* x, int incx, int* result)       \
+    {                                                                                              \
+        return hipblasI##I##amax(h, n, x, incx, result);                                           \
+    }                                                                                              \
+    inline hipblasStatus_t amin(hipblasHandle_t h, int n, const T* x, int incx, int* result)       \
+    {                                                                                              \
+        return hipblasI##I##amin(h, n, x, incx, result);                                           \
+    }
+
+#define HIPBLAS_CXX_GEMM(T, P)                                                                     \
+    inline hipblasStatus_t gemm(hipblasHandle_t    h,                                              \
+                                hipblasOperation_t transa,                                         \
+                                hipblasOperation_t transb,                                         \
+                                int                m,                                              \
+                                int                n,                                              \
+                                int                k,                                              \
+                                const T*           alpha,                                          \
+                                const T*           A,                                              \
+                                int                lda,                                            \
+                                const T*           B,                                              \
+                                int                ldb,                                            \
+                                const T*           beta,                                           \
+                                T*                 C,                                              \
+                                int                ldc)                                            \
+    {                                                                                              \
+        return hipblas##P##gemm(h, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);  \
+    }                                                                                              \
+    inline hipblasStatus_t gemmBatched(hipblasHandle_t    h,                                       \
+                                       hipblasOperation_t transa,                                  \
+                                       hipblasOperation_t transb,                                  \
+                                       int                m,                                       \
+                                       int                n,                                       \
+                                       int                k,                                       \
+                                       const T*           alpha,                                   \
+                                       const T* const     A[],                                     \
+                                       int                lda,                                     \
+                                       const T* const     B[],                                     \
+                                       int                ldb,                                     \
+                                       const T*           beta,                                    \
+                                       T* const           C[],                                     \
+                                       int                ldc,                                     \
+                                       int                batch_count)                             \
+    {                                                                                              \
+        return hipblas##P##gemmBatched(                                                            \
+            h, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batch_count);         \
+    }                                                                                              \
+    inline hipblasStatus_t gemmStridedBatched(hipblasHandle_t    h,                                \
+                                              hipblasOperation_t transa,                           \
+                                              hipblasOperation_t transb,                           \
+                                              int                m,                                \
+                                              int                n,                                \
+                                              int                k,                                \
+                                              const T*           alpha,                            \
+                                              const T*           A,                                \
+                                              int                lda,                              \
+                                              long long          stride_a,                         \
+                                              const T*           B,                                \
+                                              int                ldb,                              \
+                                              long long          stride_b,                         \
+                                              const T*           beta,                             \
+                                              T*                 C,                                \
+                                              int                ldc,                              \
+                                              long long          stride_c,                         \
+                                              int                batch_count)                      \
+    {                                                                                              \
+        return hipblas##P##gemmStridedBatched(h,                                                   \
+                                              transa,                                              \
+                                              transb,                                              \
+                                              m,                                                   \
+                                              n,                                                   \
+                                              k,                                                   \
+                                              alpha,                                               \
+                                              A,                                                   \
+                                              lda,                                                 \
+                                              stride_a,                                            \
+                                              B,                                                   \
+                                              ldb,                                                 \
+                                              stride_b,                                            \
+                                              beta,                                                \
+                                              C,                                                   \
+                                              ldc,                                                 \
+                                              stride_c,                                            \
+                                              batch_count);                                        \
+    }
+
+#define HIPBLAS_CXX_LEVEL23(T, P)                                                                  \
+    inline hipblasStatus_t gemv(hipblasHandle_t    h,                                              \
+                                hipblasOperation_t trans,                                          \
+                                int                m,                                              \
+                                int                n,                                              \
+                                const T*           alpha,                                          \
+                                const T*           A,                                              \
+                                int                lda,                                            \
+                                const T*           x,                                              \
+                                int                incx,                                           \
+                                const T*           beta,                                           \
+                                T*                 y,                                              \
+                                int                incy)                                           \
+    {                                                                                              \
+        return hipblas##P##gemv(h, trans, m, n, alpha, A, lda, x, incx, beta, y, incy);            \
+    }                                                                                              \
+    inline hipblasStatus_t trsm(hipblasHandle_t    h,                                              \
+                                hipblasSideMode_t  side,                                           \
+                                hipblasFillMode_t  uplo,                                           \
+                                hipblasOperation_t trans,                                          \
+                                hipblasDiagType_t  diag,                                           \
+                                int                m,                                              \
+                                int                n,                                              \
+                                const T*           alpha,                                          \
+                                T*                 A,                                              \
+                                int                lda,                                            \
+                                T*                 B,                                              \
+                                int                ldb)                                            \
+    {                                                                                              \
+        return hipblas##P##trsm(h, side, uplo, trans, diag, m, n, alpha, A, lda, B, ldb);          \
+    }                                                                                              \
+    inline hipblasStatus_t syrk(hipblasHandle_t    h,                                              \
+                                hipblasFillMode_t  uplo,                                           \
+                                hipblasOperation_t trans,                                          \
+                                int                n,                                              \
+                                int                k,                                              \
+                                const T*           alpha,                                          \
+                                const T*           A,                                              \
+                                int                lda,                                            \
+                                const T*           beta,                                           \
+                                T*                 C,                                              \
+                                int                ldc)                                            \
+    {                                                                                              \
+        return hipblas##P##syrk(h, uplo, trans, n, k, alpha, A, lda, beta, C, ldc);                \
+    }
+    // clang-format on
+
+    HIPBLAS_CXX_LEVEL1(float, S, S, s)
+    HIPBLAS_CXX_LEVEL1(double, D, D, d)
+    HIPBLAS_CXX_LEVEL1(hipblasComplex, C, Sc, c)
+    HIPBLAS_CXX_LEVEL1(hipblasDoubleComplex, Z, Dz, z)
+
+    HIPBLAS_CXX_GEMM(hipblasHalf, H)
+    HIPBLAS_CXX_GEMM(float, S)
+    HIPBLAS_CXX_GEMM(double, D)
+    HIPBLAS_CXX_GEMM(hipblasComplex, C)
+    HIPBLAS_CXX_GEMM(hipblasDoubleComplex, Z)
+
+    HIPBLAS_CXX_LEVEL23(float, S)
+    HIPBLAS_CXX_LEVEL23(double, D)
+    HIPBLAS_CXX_LEVEL23(hipblasComplex, C)
+    HIPBLAS_CXX_LEVEL23(hipblasDoubleComplex, Z)
+
+#undef HIPBLAS_CXX_LEVEL1
+#undef HIPBLAS_CXX_GEMM
+#undef HIPBLAS_CXX_LEVEL23
+
+    // Complex vectors scaled by a real alpha
+    inline hipblasStatus_t
+        scal(hipblasHandle_t h, int n, const float* alpha, hipblasComplex* x, int incx)
+    {
+        return hipblasCsscal(h, n, alpha, x, incx);
+    }
+
+    inline hipblasStatus_t
+        scal(hipblasHandle_t h, int n, const double* alpha, hipblasDoubleComplex* x, int incx)
+    {
+        return hipblasZdscal(h, n, alpha, x, incx);
+    }
+
+    // dot is the unconjugated product and dotc conjugates x; they agree for real types
+    inline hipblasStatus_t dot(hipblasHandle_t    h,
+                               int                n,
+                               const hipblasHalf* x,
+                               int                incx,
+                               const hipblasHalf* y,
+                               int                incy,
+                               hipblasHalf*       result)
+    {
+        return hipblasHdot(h, n, x, incx, y, incy, result);
+    }
+
+    inline hipblasStatus_t dot(hipblasHandle_t        h,
+                               int                    n,
+                               const hipblasBfloat16* x,
+                               int                    incx,
+                               const hipblasBfloat16* y,
+                               int                    incy,
+                               hipblasBfloat16*       result)
+    {
+        return hipblasBfdot(h, n, x, incx, y, incy, result);
+    }
+
+    inline hipblasStatus_t dot(
+        hipblasHandle_t h, int n, const float* x, int incx, const float* y, int incy, float* result)
+    {
+        return hipblasSdot(h, n, x, incx, y, incy, result);
+    }
+
+    inline hipblasStatus_t dot(hipblasHandle_t h,
+                               int             n,
+                               const double*   x,
+                               int             incx,
+                               const double*   y,
+                               int             incy,
+                               double*         result)
+    {
+        return hipblasDdot(h, n, x, incx, y, incy, result);
+    }
+
+    inline hipblasStatus_t dot(hipblasHandle_t       h,
+                               int                   n,
+                               const hipblasComplex* x,
+                               int                   incx,
+                               const hipblasComplex* y,
+                               int                   incy,
+                               hipblasComplex*       result)
+    {
+        return hipblasCdotu(h, n, x, incx, y, incy, result);
+    }
+
+    inline hipblasStatus_t dot(hipblasHandle_t             h,
+                               int                         n,
+                               const hipblasDoubleComplex* x,
+                               int                         incx,
+                               const hipblasDoubleComplex* y,
+                               int                         incy,
+                               hipblasDoubleComplex*       result)
+    {
+        return hipblasZdotu(h, n, x, incx, y, incy, result);
+    }
+
+    inline hipblasStatus_t dotc(
+        hipblasHandle_t h, int n, const float* x, int incx, const float* y, int incy, float* result)
+    {
+        return hipblasSdot(h, n, x, incx, y, incy, result);
+    }
+
+    inline hipblasStatus_t dotc(hipblasHandle_t h,
+                                int             n,
+                                const double*   x,
+                                int             incx,
+                                const double*   y,
+                                int             incy,
+                                double*         result)
+    {
+        return hipblasDdot(h, n, x, incx, y, incy, result);
+    }
+
+    inline hipblasStatus_t dotc(hipblasHandle_t       h,
+                                int                   n,
+                                const hipblasComplex* x,
+                                int                   incx,
+                                const hipblasComplex* y,
+                                int                   incy,
+                                hipblasComplex*       result)
+    {
+        return hipblasCdotc(h, n, x, incx, y, incy, result);
+    }
+
+    inline hipblasStatus_t dotc(hipblasHandle_t             h,
+                                int                         n,
+                                const hipblasDoubleComplex* x,
+                                int                         incx,
+                                const hipblasDoubleComplex* y,
+                                int                         incy,
+                                hipblasDoubleComplex*       result)
+    {
+        return hipblasZdotc(h, n, x, incx, y, incy, result);
+    }
+
+    // ger is the unconjugated rank-1 update and gerc conjugates y; they agree for real types
+    inline hipblasStatus_t ger(hipblasHandle_t h,
+                               int             m,
+                               int             n,
+                               const float*    alpha,
+                               const float*    x,
+                               int             incx,
+                               const float*    y,
+                               int             incy,
+                               float*          A,
+                               int             lda)
+    {
+        return hipblasSger(h, m, n, alpha, x, incx, y, incy, A, lda);
+    }
+
+    inline hipblasStatus_t ger(hipblasHandle_t h,
+                               int             m,
+                               int             n,
+                               const double*   alpha,
+                               const double*   x,
+                               int             incx,
+                               const double*   y,
+                               int             incy,
+                               double*         A,
+                               int             lda)
+    {
+        return hipblasDger(h, m, n, alpha, x, incx, y, incy, A, lda);
+    }
+
+    inline hipblasStatus_t ger(hipblasHandle_t       h,
+                               int                   m,
+                               int                   n,
+                               const hipblasComplex* alpha,
+                               const hipblasComplex* x,
+                               int                   incx,
+                               const hipblasComplex* y,
+                               int                   incy,
+                               hipblasComplex*       A,
+                               int                   lda)
+    {
+        return hipblasCgeru(h, m, n, alpha, x, incx, y, incy, A, lda);
+    }
+
+    inline hipblasStatus_t ger(hipblasHandle_t             h,
+                               int                         m,
+                               int                         n,
+                               const hipblasDoubleComplex* alpha,
+                               const hipblasDoubleComplex* x,
+                               int                         incx,
+                               const hipblasDoubleComplex* y,
+                               int                         incy,
+                               hipblasDoubleComplex*       A,
+                               int                         lda)
+    {
+        return hipblasZgeru(h, m, n, alpha, x, incx, y, incy, A, lda);
+    }
+
+    inline hipblasStatus_t gerc(hipblasHandle_t h,
+                                int             m,
+                                int             n,
+                                const float*    alpha,
+                                const float*    x,
+                                int             incx,
+                                const float*    y,
+                                int             incy,
+                                float*          A,
+                                int             lda)
+    {
+        return hipblasSger(h, m, n, alpha, x, incx, y, incy, A, lda);
+    }
+
+    inline hipblasStatus_t gerc(hipblasHandle_t h,
+                                int             m,
+                                int             n,
+                                const double*   alpha,
+                                const double*   x,
+                                int             incx,
+                                const double*   y,
+                                int             incy,
+                                double*         A,
+                                int             lda)
+    {
+        return hipblasDger(h, m, n, alpha, x, incx, y, incy, A, lda);
+    }
+
+    inline hipblasStatus_t gerc(hipblasHandle_t       h,
+                                int                   m,
+                                int                   n,
+                                const hipblasComplex* alpha,
+                                const hipblasComplex* x,
+                                int                   incx,
+                                const hipblasComplex* y,
+                                int                   incy,
+                                hipblasComplex*       A,
+                                int                   lda)
+    {
+        return hipblasCgerc(h, m, n, alpha, x, incx, y, incy, A, lda);
+    }
+
+    inline hipblasStatus_t gerc(hipblasHandle_t             h,
+                                int                         m,
+                                int                         n,
+                                const hipblasDoubleComplex* alpha,
+                                const hipblasDoubleComplex* x,
+                                int                         incx,
+                                const hipblasDoubleComplex* y,
+                                int                         incy,
+                                hipblasDoubleComplex*       A,
+                                int                         lda)
+    {
+        return hipblasZgerc(h, m, n, alpha, x, incx, y, incy, A, lda);
+    }
+
+    // gemmEx with the data and compute types taken from the element types
+    template <typename Ti, typename To, typename Tc>
+    inline hipblasStatus_t gemmEx(hipblasHandle_t    h,
+                                  hipblasOperation_t transa,
+                                  hipblasOperation_t transb,
+                                  int                m,
+                                  int                n,
+                                  int                k,
+                                  const Tc*          alpha,
+                                  const Ti*          A,
+                                  int                lda,
+                                  const Ti*          B,
+                                  int                ldb,
+                                  const Tc*          beta,
+                                  To*                C,
+                                  int                ldc,
+                                  hipblasGemmAlgo_t  algo = HIPBLAS_GEMM_DEFAULT)
+    {
+        return hipblasGemmEx(h,
+                             transa,
+                             transb,
+                             m,
+                             n,
+                             k,
+                             alpha,
+                             A,
+                             datatype<Ti>::value,
+                             lda,
+                             B,
+                             datatype<Ti>::value,
+                             ldb,
+                             beta,
+                             C,
+                             datatype<To>::value,
+                             ldc,
+                             datatype<Tc>::value,
+                             algo);
+    }
+} // namespace hipblas
+
+#endif // HIPBLAS_HPP
@@ -0,0 +1,237 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+//! Asynchronous C++ interface to hipblas, on a hipblasCompletionQueue_t. hipblas::async runs a
+//! callable that queues hipBLAS work on a handle, such as a hipblas::gemm call, and returns at once
+//! with an async_status that completes when that work has run on the device: wait() or get()
+//! block for it, and with C++20 coroutines it can be co_awaited, the coroutine resuming on the
+//! queue's polling thread. hipblas::async_future returns a std::future instead. The *_async forms
+//! of the hipblas.hpp routines, such as co_await hipblas::gemm_async(queue, handle, ...), wrap
+//! one call each. A call that fails, or whose completion cannot be queued, completes at once with
+//! its status. The operands must stay valid until completion, as for any call on a stream.
+//
+#ifndef HIPBLAS_ASYNC_HPP
+#define HIPBLAS_ASYNC_HPP
+#pragma once
+#include "hipblas.hpp"
+#include <condition_variable>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+#if defined(__cpp_impl_coroutine) && defined(__has_include)
+#if __has_include(<coroutine>)
+#include <coroutine>
+#define HIPBLAS_ASYNC_COROUTINES 1
+#endif
+#endif
+
+namespace hipblas
+{
+    // Owns a hipblasCompletionQueue_t; destruction waits for its pending completions
+    class completion_queue
+    {
+    public:
+        explicit completion_queue(int poll_us = 20)
+            : created(hipblasCompletionQueueCreate(&queue, poll_us))
+        {
+        }
+
+        ~completion_queue()
+        {
+            if(created == HIPBLAS_STATUS_SUCCESS)
+                hipblasCompletionQueueDestroy(queue);
+        }
+
+        completion_queue(const completion_queue&) = delete;
+        completion_queue& operator=(const completion_queue&) = delete;
+
+        // The status of the creation; async calls on a queue that was not created fail with it
+        hipblasStatus_t status() const
+        {
+            return created;
+        }
+
+        hipblasCompletionQueue_t get() const
+        {
+            return queue;
+        }
+
+    private:
+        hipblasCompletionQueue_t queue = nullptr;
+        hipblasStatus_t          created;
+    };
+
+    class async_status
+    {
+        struct state
+        {
+            std::mutex              mutex;
+            std::condition_variable completed;
+            bool                    done   = false;
+            hipblasStatus_t         status = HIPBLAS_STATUS_SUCCESS;
+#ifdef HIPBLAS_ASYNC_COROUTINES
+            std::coroutine_handle<> waiter;
+#endif
+
+            // A waiting coroutine resumes on the thread finishing, once the lock is released
+            void finish(hipblasStatus_t result)
+            {
+#ifdef HIPBLAS_ASYNC_COROUTINES
+                std::coroutine_handle<> resume;
+#endif
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    status = result;
+                    done   = true;
+#ifdef HIPBLAS_ASYNC_COROUTINES
+                    resume = waiter;
+#endif
+                }
+                completed.notify_all();
+#ifdef HIPBLAS_ASYNC_COROUTINES
+                if(resume)
+                    resume.resume();
+#endif
+            }
+        };
+
+        // The callback owns one reference to the state, given to Notify as its user data
+        static void complete(void* user_data, hipblasStatus_t status)
+        {
+            std::unique_ptr<std::shared_ptr<state>> owner(
+                static_cast<std::shared_ptr<state>*>(user_data));
+            (*owner)->finish(status);
+        }
+
+        std::shared_ptr<state> s;
+
+    public:
+        template <typename F>
+        async_status(completion_queue& queue, hipblasHandle_t handle, F&& call)
+            : s(std::make_shared<state>())
+        {
+            hipblasStatus_t status = queue.status();
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = std::forward<F>(call)();
+            if(status == HIPBLAS_STATUS_SUCCESS)
+            {
+                std::unique_ptr<std::shared_ptr<state>> owner(new std::shared_ptr<state>(s));
+                status = hipblasCompletionQueueNotify(queue.get(), handle, complete, owner.get());
+                if(status == HIPBLAS_STATUS_SUCCESS)
+                {
+                    owner.release();
+                    return;
+                }
+            }
+            s->done   = true;
+            s->status = status;
+        }
+
+        bool ready() const
+        {
+            std::lock_guard<std::mutex> lock(s->mutex);
+            return s->done;
+        }
+
+        void wait() const
+        {
+            std::unique_lock<std::mutex> lock(s->mutex);
+            s->completed.wait(lock, [this] { return s->done; });
+        }
+
+        hipblasStatus_t get() const
+        {
+            wait();
+            return s->status;
+        }
+
+#ifdef HIPBLAS_ASYNC_COROUTINES
+        bool await_ready() const
+        {
+            return ready();
+        }
+
+        // Does not suspend when the work completed since await_ready
+        bool await_suspend(std::coroutine_handle<> coroutine)
+        {
+            std::lock_guard<std::mutex> lock(s->mutex);
+            if(s->done)
+                return false;
+            s->waiter = coroutine;
+            return true;
+        }
+
+        hipblasStatus_t await_resume() const
+        {
+            return s->status;
+        }
+#endif
+    };
+
+    // Runs call, a callable returning the hipblasStatus_t of the work it queues on handle
+    template <typename F>
+    inline async_status async(completion_queue& queue, hipblasHandle_t handle, F&& call)
+    {
+        return async_status(queue, handle, std::forward<F>(call));
+    }
+
+    template <typename F>
+    inline std::future<hipblasStatus_t>
+        async_future(completion_queue& queue, hipblasHandle_t handle, F&& call)
+    {
+        using promise = std::promise<hipblasStatus_t>;
+
+        std::unique_ptr<promise>     p(new promise);
+        std::future<hipblasStatus_t> result = p->get_future();
+        hipblasStatus_t              status = queue.status();
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = std::forward<F>(call)();
+        if(status == HIPBLAS_STATUS_SUCCESS)
+        {
+            auto complete = [](void* user_data, hipblasStatus_t completion) {
+                std::unique_ptr<promise> owner(static_cast<promise*>(user_data));
+                owner->set_value(completion);
+            };
+            status = hipblasCompletionQueueNotify(queue.get(), handle, complete, p.get());
+            if(status == HIPBLAS_STATUS_SUCCESS)
+            {
+                p.release();
+                return result;
+            }
+        }
+        p->set_value(status);
+        return result;
+    }
+
+// clang-format off
+#define HIPBLAS_CXX_ASYNC(name)                                                                    \
+    template <typename... Args>                                                                    \
+    inline async_status name##_async(completion_queue& queue, hipblasHandle_t h, Args&&... args)   \
+    {                                                                                              \
+        return async(queue, h, [&] { return name(h, std::forward<Args>(args)...); });              \
+    }
+
+    HIPBLAS_CXX_ASYNC(scal)
+    HIPBLAS_CXX_ASYNC(copy)
+    HIPBLAS_CXX_ASYNC(swap)
+    HIPBLAS_CXX_ASYNC(axpy)
+    HIPBLAS_CXX_ASYNC(dot)
+    HIPBLAS_CXX_ASYNC(nrm2)
+    HIPBLAS_CXX_ASYNC(asum)
+    HIPBLAS_CXX_ASYNC(gemv)
+    HIPBLAS_CXX_ASYNC(ger)
+    HIPBLAS_CXX_ASYNC(gemm)
+    HIPBLAS_CXX_ASYNC(gemmBatched)
+    HIPBLAS_CXX_ASYNC(gemmStridedBatched)
+    HIPBLAS_CXX_ASYNC(gemmEx)
+    HIPBLAS_CXX_ASYNC(syrk)
+    HIPBLAS_CXX_ASYNC(trsm)
+
+#undef HIPBLAS_CXX_ASYNC
+    // clang-format on
+} // namespace hipblas
+
+#endif // HIPBLAS_ASYNC_HPP
@@ -0,0 +1,239 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+//! Device-side building blocks for fusing small BLAS and LAPACK operations into user kernels.
+//! Header-only: each routine is a struct templated on its sizes, operations, storage order and
+//! element type, whose static run() is a __device__ function called by every thread of one
+//! block, with the same arguments. The threads share the work whatever the block's shape, so a
+//! block of one wavefront runs them at wavefront level, and run() ends with a __syncthreads() so
+//! its results are visible to the whole block. The operands may be in global or shared memory
+//! and must be ready when run() is called. Element types are float, double, hipblasComplex and
+//! hipblasDoubleComplex. Include from HIP sources only; nothing here needs the hipblas library.
+//
+#ifndef HIPBLAS_DEVICE_HPP
+#define HIPBLAS_DEVICE_HPP
+#pragma once
+#include "hipblas.h"
+#include <hip/hip_runtime.h>
+
+namespace hipblas
+{
+    namespace device
+    {
+        // Offset of element (i, j) of a matrix with leading dimension ld
+        template <hipblasOrder_t Order>
+        __host__ __device__ constexpr int index(int i, int j, int ld)
+        {
+            return Order == HIPBLAS_ORDER_ROW_MAJOR ? i * ld + j : i + j * ld;
+        }
+
+        namespace detail
+        {
+            template <typename T>
+            __device__ T conj(T a)
+            {
+                return a;
+            }
+
+            template <typename T>
+            __device__ hip_complex_number<T> conj(hip_complex_number<T> a)
+            {
+                return {a.x, -a.y};
+            }
+
+            // |re| + |im|, which pivoting compares as LAPACK's i?amax does
+            template <typename T>
+            __device__ T abs1(T a)
+            {
+                return a < 0 ? -a : a;
+            }
+
+            template <typename T>
+            __device__ T abs1(hip_complex_number<T> a)
+            {
+                return abs1(a.x) + abs1(a.y);
+            }
+
+            // op(X)(i, j)
+            template <hipblasOperation_t Op, hipblasOrder_t Order, typename T>
+            __device__ T load(const T* X, int i, int j, int ld)
+            {
+                return Op == HIPBLAS_OP_N   ? X[index<Order>(i, j, ld)]
+                       : Op == HIPBLAS_OP_T ? X[index<Order>(j, i, ld)]
+                                            : conj(X[index<Order>(j, i, ld)]);
+            }
+
+            __device__ inline int thread_rank()
+            {
+                return threadIdx.x + blockDim.x * (threadIdx.y + blockDim.y * threadIdx.z);
+            }
+
+            __device__ inline int block_size()
+            {
+                return blockDim.x * blockDim.y * blockDim.z;
+            }
+
+            // Whether op(A) of a triangular A is lower triangular
+            __host__ __device__ constexpr bool lower(hipblasFillMode_t  uplo,
+                                                     hipblasOperation_t trans)
+            {
+                return (uplo == HIPBLAS_FILL_MODE_LOWER) == (trans == HIPBLAS_OP_N);
+            }
+        }
+
+        // C = alpha op(A) op(B) + beta C for the M x N matrix C, and C is not read when beta is 0.
+        // Each thread computes whole elements of C, neighbouring threads neighbouring elements
+        // in Order; C must not overlap A or B
+        template <int                M,
+                  int                N,
+                  int                K,
+                  hipblasOperation_t TransA,
+                  hipblasOperation_t TransB,
+                  hipblasOrder_t     Order,
+                  typename T>
+        struct gemm
+        {
+            static_assert(M > 0 && N > 0 && K > 0, "gemm sizes must be positive");
+
+            __device__ static void
+                run(T alpha, const T* A, int lda, const T* B, int ldb, T beta, T* C, int ldc)
+            {
+                for(int e = detail::thread_rank(); e < M * N; e += detail::block_size())
+                {
+                    int i = Order == HIPBLAS_ORDER_ROW_MAJOR ? e / N : e % M;
+                    int j = Order == HIPBLAS_ORDER_ROW_MAJOR ? e % N : e / M;
+
+                    T sum = 0;
+#pragma unroll
+                    for(int l = 0; l < K; l++)
+                        sum += detail::load<TransA, Order>(A, i, l, lda)
+                               * detail::load<TransB, Order>(B, l, j, ldb);
+
+                    T& c = C[index<Order>(i, j, ldc)];
+                    c    = beta == T(0) ? alpha * sum : alpha * sum + beta * c;
+                }
+                __syncthreads();
+            }
+        };
+
+        // Solves op(A) X = alpha B for Side HIPBLAS_SIDE_LEFT, or X op(A) = alpha B for
+        // HIPBLAS_SIDE_RIGHT, with the triangular A of M x M or N x N, overwriting the M x N
+        // matrix B with X. A singular A is not detected. Each thread solves whole columns of B,
+        // or rows for the right side, so at most N or M threads take part
+        template <int                M,
+                  int                N,
+                  hipblasSideMode_t  Side,
+                  hipblasFillMode_t  Uplo,
+                  hipblasOperation_t TransA,
+                  hipblasDiagType_t  Diag,
+                  hipblasOrder_t     Order,
+                  typename T>
+        struct trsm
+        {
+            static_assert(M > 0 && N > 0, "trsm sizes must be positive");
+
+            __device__ static void run(T alpha, const T* A, int lda, T* B, int ldb)
+            {
+                constexpr bool left  = Side == HIPBLAS_SIDE_LEFT;
+                constexpr bool lower = detail::lower(Uplo, TransA);
+                constexpr int  D     = left ? M : N; // order of A
+                constexpr int  R     = left ? N : M; // independent right-hand sides
+
+                for(int r = detail::thread_rank(); r < R; r += detail::block_size())
+                {
+                    // x(t) is element t of right-hand side r; a(t, u) the element of op(A) that
+                    // multiplies x(u) in equation t, so the right side solves op(A)^T
+                    auto x = [&](int t) -> T& {
+                        return left ? B[index<Order>(t, r, ldb)] : B[index<Order>(r, t, ldb)];
+                    };
+                    auto a = [&](int t, int u) {
+                        return left ? detail::load<TransA, Order>(A, t, u, lda)
+                                    : detail::load<TransA, Order>(A, u, t, lda);
+                    };
+
+                    // Lower op(A) on the left, or upper on the right, runs forward
+                    constexpr bool forward = left == lower;
+#pragma unroll
+                    for(int s = 0; s < D; s++)
+                    {
+                        int t   = forward ? s : D - 1 - s;
+                        T   sum = alpha * x(t);
+                        for(int q = 0; q < s; q++)
+                        {
+                            int u = forward ? q : D - 1 - q;
+                            sum   = sum - a(t, u) * x(u);
+                        }
+                        x(t) = Diag == HIPBLAS_DIAG_UNIT ? sum : sum / a(t, t);
+                    }
+                }
+                __syncthreads();
+            }
+        };
+
+        // LU factorization with partial pivoting of the N x N matrix A, as getrf: A = P L U with
+        // unit lower L, L and U overwriting A. ipiv[j] is the 1-based row swapped with row j, and
+        // info is 0, or j + 1 for the first zero pivot U(j, j), where the factorization carries
+        // on without scaling that column. ipiv and info are written by thread 0 alone
+        template <int N, hipblasOrder_t Order, typename T>
+        struct getrf
+        {
+            static_assert(N > 0, "getrf size must be positive");
+
+            __device__ static void run(T* A, int lda, int* ipiv, int* info)
+            {
+                __shared__ int pivot;
+
+                int  rank = detail::thread_rank();
+                int  size = detail::block_size();
+                auto a    = [&](int i, int j) -> T& { return A[index<Order>(i, j, lda)]; };
+
+                if(rank == 0)
+                    *info = 0;
+                for(int j = 0; j < N; j++)
+                {
+                    if(rank == 0)
+                    {
+                        int p = j;
+                        for(int i = j + 1; i < N; i++)
+                            if(detail::abs1(a(i, j)) > detail::abs1(a(p, j)))
+                                p = i;
+                        ipiv[j] = p + 1;
+                        pivot   = p;
+                        if(a(p, j) == T(0) && *info == 0)
+                            *info = j + 1;
+                    }
+                    __syncthreads();
+
+                    int p = pivot;
+                    if(p != j)
+                        for(int c = rank; c < N; c += size)
+                        {
+                            T t     = a(j, c);
+                            a(j, c) = a(p, c);
+                            a(p, c) = t;
+                        }
+                    __syncthreads();
+
+                    T d = a(j, j);
+                    if(d != T(0))
+                        for(int i = j + 1 + rank; i < N; i += size)
+                            a(i, j) = a(i, j) / d;
+                    __syncthreads();
+
+                    // The trailing update, one element of A(j + 1 :, j + 1 :) per step
+                    int rest = N - j - 1;
+                    for(int e = rank; e < rest * rest; e += size)
+                    {
+                        int i = j + 1 + (Order == HIPBLAS_ORDER_ROW_MAJOR ? e / rest : e % rest);
+                        int c = j + 1 + (Order == HIPBLAS_ORDER_ROW_MAJOR ? e % rest : e / rest);
+                        a(i, c) = a(i, c) - a(i, j) * a(j, c);
+                    }
+                    __syncthreads();
+                }
+            }
+        };
+    }
+}
+
+#endif
@@ -0,0 +1,117 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+//! Distributed gemm for hipblas: SUMMA over a 2D grid of processes, one device each, holding
+//! block-cyclic matrices. Panels move through RCCL on the AMD backend and NCCL on the CUDA one.
+//! Built as the separate hipblas_distributed library when BUILD_WITH_DISTRIBUTED is on
+//
+#ifndef HIPBLAS_DISTRIBUTED_H
+#define HIPBLAS_DISTRIBUTED_H
+#pragma once
+#include "hipblas.h"
+#include "hipblas_distributed-export.h"
+
+#ifdef __HIP_PLATFORM_NVCC__
+#include <nccl.h>
+#else
+#include <rccl.h>
+#endif
+
+typedef void* hipblasDistGrid_t;
+
+// A matrix of m x n elements split into mb x nb blocks, dealt out cyclically over the grid with
+// block (0, 0) on process (0, 0), as in ScaLAPACK. Each process keeps its blocks column-major in
+// a device array of leading dimension ld
+typedef struct
+{
+    int64_t m;
+    int64_t n;
+    int     mb;
+    int     nb;
+    int64_t ld;
+} hipblasDistDesc_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// A grid over the processes of row_comm and col_comm: the processes in this one's grid row, and
+// those in its grid column. Their sizes give the grid shape and their ranks this process's place
+// in it. The grid runs its local gemms on handle, whose device must be the one of the
+// communicators, and owns a second stream and the panel buffers
+HIPBLAS_DISTRIBUTED_EXPORT hipblasStatus_t hipblasDistGridCreate(hipblasDistGrid_t* grid,
+                                                                 hipblasHandle_t    handle,
+                                                                 ncclComm_t         row_comm,
+                                                                 ncclComm_t         col_comm);
+
+HIPBLAS_DISTRIBUTED_EXPORT hipblasStatus_t hipblasDistGridDestroy(hipblasDistGrid_t grid);
+
+HIPBLAS_DISTRIBUTED_EXPORT hipblasStatus_t
+    hipblasDistGridGetInfo(hipblasDistGrid_t grid, int* nprow, int* npcol, int* myrow, int* mycol);
+
+// The rows and columns of a matrix this process holds, the least its local array must hold
+HIPBLAS_DISTRIBUTED_EXPORT hipblasStatus_t hipblasDistLocalSize(hipblasDistGrid_t        grid,
+                                                                const hipblasDistDesc_t* desc,
+                                                                int64_t*                 rows,
+                                                                int64_t*                 cols);
+
+// C = alpha A B + beta C on matrices of m x k, k x n and m x n, called by every process of the
+// grid. The blocks must line up: A.mb == C.mb, B.nb == C.nb and A.nb == B.mb, which is also the
+// depth of each SUMMA step. Each step broadcasts a column panel of A along the grid rows and a
+// row panel of B down the grid columns, on the grid's stream, while the local gemm of the step
+// before runs on the handle's stream. alpha and beta are host scalars; the call is asynchronous
+// with respect to the host, like the gemm it wraps. Only HIPBLAS_OP_N is supported
+HIPBLAS_DISTRIBUTED_EXPORT hipblasStatus_t hipblasDistSgemm(hipblasDistGrid_t        grid,
+                                                            hipblasOperation_t       transa,
+                                                            hipblasOperation_t       transb,
+                                                            const float*             alpha,
+                                                            const float*             A,
+                                                            const hipblasDistDesc_t* descA,
+                                                            const float*             B,
+                                                            const hipblasDistDesc_t* descB,
+                                                            const float*             beta,
+                                                            float*                   C,
+                                                            const hipblasDistDesc_t* descC);
+
+HIPBLAS_DISTRIBUTED_EXPORT hipblasStatus_t hipblasDistDgemm(hipblasDistGrid_t        grid,
+                                                            hipblasOperation_t       transa,
+                                                            hipblasOperation_t       transb,
+                                                            const double*            alpha,
+                                                            const double*            A,
+                                                            const hipblasDistDesc_t* descA,
+                                                            const double*            B,
+                                                            const hipblasDistDesc_t* descB,
+                                                            const double*            beta,
+                                                            double*                  C,
+                                                            const hipblasDistDesc_t* descC);
+
+HIPBLAS_DISTRIBUTED_EXPORT hipblasStatus_t hipblasDistCgemm(hipblasDistGrid_t        grid,
+                                                            hipblasOperation_t       transa,
+                                                            hipblasOperation_t       transb,
+                                                            const hipblasComplex*    alpha,
+                                                            const hipblasComplex*    A,
+                                                            const hipblasDistDesc_t* descA,
+                                                            const hipblasComplex*    B,
+                                                            const hipblasDistDesc_t* descB,
+                                                            const hipblasComplex*    beta,
+                                                            hipblasComplex*          C,
+                                                            const hipblasDistDesc_t* descC);
+
+HIPBLAS_DISTRIBUTED_EXPORT hipblasStatus_t hipblasDistZgemm(hipblasDistGrid_t           grid,
+                                                            hipblasOperation_t          transa,
+                                                            hipblasOperation_t          transb,
+                                                            const hipblasDoubleComplex* alpha,
+                                                            const hipblasDoubleComplex* A,
+                                                            const hipblasDistDesc_t*    descA,
+                                                            const hipblasDoubleComplex* B,
+                                                            const hipblasDistDesc_t*    descB,
+                                                            const hipblasDoubleComplex* beta,
+                                                            hipblasDoubleComplex*       C,
+                                                            const hipblasDistDesc_t*    descC);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
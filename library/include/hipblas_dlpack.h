@@ -0,0 +1,95 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+//! DLPack interop for hipblas: framework tensors, such as those of PyTorch and CuPy, described by
+//! DLManagedTensor and used in place. The layout a routine needs, column-major with a leading
+//! dimension and possibly transposed, is derived from the tensor's shape and strides; a tensor no
+//! BLAS layout describes is refused with HIPBLAS_STATUS_NOT_SUPPORTED rather than copied. Tensors
+//! must live on the handle's device, as kDLROCM, kDLCUDA or kDLCUDAManaged, and have strides in
+//! elements as DLPack defines them. Functions only read the descriptors and never call their
+//! deleters. Available when hipBLAS is built with BUILD_WITH_DLPACK
+//
+#ifndef HIPBLAS_DLPACK_H
+#define HIPBLAS_DLPACK_H
+#pragma once
+#include "hipblas.h"
+#include <dlpack/dlpack.h>
+
+// The last two dimensions of a tensor, rows x cols, as op(M) for a column-major matrix M at data
+// with leading dimension ld: op is HIPBLAS_OP_N for column-major strides and HIPBLAS_OP_T for
+// row-major ones. A third, leading dimension is the batch, each matrix stride elements after the
+// one before; stride is 0 and batch_count 1 for a 1-D or 2-D tensor. A 1-D tensor is a column
+typedef struct
+{
+    void*              data;
+    hipblasDatatype_t  type;
+    hipblasOperation_t op;
+    int                rows;
+    int                cols;
+    int                ld;
+    long long          stride;
+    int                batch_count;
+} hipblasDLPackMatrix_t;
+
+// A 1-D tensor as a vector of n elements inc apart, or a 2-D one as a batch of such vectors
+// stride elements apart. data points where BLAS expects it, so for a negative inc to the element
+// with the lowest address
+typedef struct
+{
+    void*             data;
+    hipblasDatatype_t type;
+    int               n;
+    int               inc;
+    long long         stride;
+    int               batch_count;
+} hipblasDLPackVector_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Layouts for calling any typed or Ex entry point on a tensor; trans_a = desc.op and lda = desc.ld
+// describe a tensor of m x k as the A of a gemm
+HIPBLAS_EXPORT hipblasStatus_t hipblasDLPackGetMatrix(hipblasHandle_t        handle,
+                                                      const DLManagedTensor* tensor,
+                                                      hipblasDLPackMatrix_t* matrix);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDLPackGetVector(hipblasHandle_t        handle,
+                                                      const DLManagedTensor* tensor,
+                                                      hipblasDLPackVector_t* vector);
+
+// C = alpha A B + beta C for A of m x k, B of k x n and C of m x n, through hipblasGemmEx or,
+// when any of them has a batch dimension, hipblasGemmStridedBatchedEx; an unbatched A or B is
+// then used for every matrix of C. A row-major C is computed as C^T = B^T A^T. A and B share a
+// type; the arithmetic, and alpha and beta, are float for half and bfloat16 inputs, int32 for
+// int8 ones and of C's type otherwise
+HIPBLAS_EXPORT hipblasStatus_t hipblasDLPackGemm(hipblasHandle_t        handle,
+                                                 const void*            alpha,
+                                                 const DLManagedTensor* A,
+                                                 const DLManagedTensor* B,
+                                                 const void*            beta,
+                                                 DLManagedTensor*       C);
+
+// y = alpha x + y, x = alpha x and result = x . y through the level-1 Ex functions, batched when
+// the vectors are 2-D. The arithmetic and alpha are float for half and bfloat16 vectors and of
+// x's type otherwise; result has x's type
+HIPBLAS_EXPORT hipblasStatus_t hipblasDLPackAxpy(hipblasHandle_t        handle,
+                                                 const void*            alpha,
+                                                 const DLManagedTensor* x,
+                                                 DLManagedTensor*       y);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDLPackScal(hipblasHandle_t  handle,
+                                                 const void*      alpha,
+                                                 DLManagedTensor* x);
+
+HIPBLAS_EXPORT hipblasStatus_t hipblasDLPackDot(hipblasHandle_t        handle,
+                                                const DLManagedTensor* x,
+                                                const DLManagedTensor* y,
+                                                void*                  result);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // HIPBLAS_DLPACK_H
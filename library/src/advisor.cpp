@@ -0,0 +1,215 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipblas_handle.h"
+#include "hipblas_logging.h"
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <utility>
+
+/* ============================================================================================ */
+/*  HIPBLAS_LAYER advisor: call patterns with a faster alternative.
+ *
+ *  Each pattern a call shows is counted per function, and a line naming the pattern, its count
+ *  so far and the faster API is written to HIPBLAS_LOG_ADVISOR_PATH, or stderr, the 1st, 10th,
+ *  100th and so on time, so a loop shows up at a few lines; the counts are written in full when
+ *  the library unloads. */
+
+namespace
+{
+    // A GemmEx problem repeated this many times in a row on a thread is worth a plan
+    constexpr int PLAN_REPEATS = 4;
+
+    // Address alignment of vector loads, and the interleave a leading dimension should not be a
+    // multiple of
+    constexpr uintptr_t LOAD_ALIGNMENT   = 16;
+    constexpr long long CHANNEL_INTERVAL = 4096;
+
+    enum advice
+    {
+        ADVICE_MISALIGNED,
+        ADVICE_LD_POWER_OF_TWO,
+        ADVICE_SINGLE_BATCH,
+        ADVICE_HOST_REDUCTION,
+        ADVICE_UNPLANNED_GEMM_EX,
+        ADVICE_BROADCAST_STRIDE,
+        ADVICE_COUNT
+    };
+
+    struct advice_text
+    {
+        const char* pattern;
+        const char* suggestion;
+    };
+
+    constexpr advice_text advice_texts[ADVICE_COUNT] = {
+        {"an operand is not 16-byte aligned",
+         "allocate with hipMalloc or hipblasMallocMatrix and offset views by whole 16 bytes"},
+        {"a leading dimension is a multiple of 4096 bytes, so every column maps to one memory "
+         "channel",
+         "pad it with hipblasGetOptimalLeadingDimension or allocate with hipblasMallocMatrix"},
+        {"a batched call with batch_count 1", "call the non-batched function"},
+        {"a reduction returns its result in host pointer mode, so each call waits for the device",
+         "use HIPBLAS_POINTER_MODE_DEVICE, or hipblasSetResultMode(HIPBLAS_RESULT_MODE_ASYNC) and "
+         "hipblasSynchronizeResults once after the loop"},
+        {"the same GemmEx problem is called repeatedly",
+         "resolve it once with hipblasGemmPlanCreate and run it with hipblasGemmPlanExecute"},
+        {"a stride of 0 broadcasts one operand to every batch",
+         "when the other operands' batches are contiguous, fold the batch into n of one "
+         "non-batched call"}};
+
+    bool is_power_of_ten(unsigned long long count)
+    {
+        while(count % 10 == 0)
+            count /= 10;
+        return count == 1;
+    }
+
+    class advisor
+    {
+    public:
+        advisor()
+        {
+            const char* path = std::getenv("HIPBLAS_LOG_ADVISOR_PATH");
+            if(path && *path)
+            {
+                file.reset(new std::ofstream(path));
+                if(!*file)
+                    file.reset();
+            }
+        }
+
+        ~advisor()
+        {
+            if(counts.empty())
+                return;
+            std::ostream& os = out();
+            os << "hipblas advisor\n";
+            for(const auto& it : counts)
+                os << "- { function: " << it.first.second
+                   << ", pattern: \"" << advice_texts[it.first.first].pattern
+                   << "\", calls: " << it.second << " }\n";
+            os.flush();
+        }
+
+        void hit(advice a, const char* function)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            unsigned long long          count = ++counts[{a, function}];
+            if(!is_power_of_ten(count))
+                return;
+            std::ostream& os = out();
+            os << "hipblas advisor: " << function << ": " << advice_texts[a].pattern << " ("
+               << count << (count == 1 ? " call" : " calls") << "); "
+               << advice_texts[a].suggestion << '\n';
+            os.flush();
+        }
+
+    private:
+        std::ostream& out()
+        {
+            return file ? *file : std::cerr;
+        }
+
+        std::mutex                                                mutex;
+        std::unique_ptr<std::ofstream>                            file;
+        std::map<std::pair<int, std::string>, unsigned long long> counts;
+    };
+
+    advisor advisor_log;
+
+    bool has(unsigned long long mask, int i)
+    {
+        return i < 64 && (mask >> i & 1);
+    }
+
+    // Bytes per element, 0 when unknown; the Ex functions are taken at their first data type
+    size_t element_bytes(const hipblas_log_site& site, const hipblas_log_arg* args, int count)
+    {
+        if(site.element_size)
+            return site.element_size;
+        if(site.data_type >= 0 && site.data_type < count
+           && args[site.data_type].kind != hipblas_log_arg::POINTER)
+            return hipblas_datatype_size(hipblasDatatype_t(args[site.data_type].i));
+        return 0;
+    }
+
+    // The repeats of the last GemmEx problem on this thread
+    thread_local std::string last_gemm_ex;
+    thread_local int         gemm_ex_repeats = 0;
+
+    bool repeated_gemm_ex(const hipblas_log_site& site, const hipblas_log_arg* args, int count)
+    {
+        if(std::strcmp(site.function, "hipblasGemmEx") != 0
+           && std::strcmp(site.function, "hipblasGemmExWithEpilogue") != 0)
+            return false;
+
+        std::ostringstream shape;
+        shape << site.function;
+        for(int i = 0; i < count; i++)
+            if(args[i].kind == hipblas_log_arg::REAL)
+                shape << ',' << args[i].d;
+            else if(args[i].kind != hipblas_log_arg::POINTER)
+                shape << ',' << args[i].i;
+        if(shape.str() == last_gemm_ex)
+            return ++gemm_ex_repeats >= PLAN_REPEATS;
+        last_gemm_ex    = shape.str();
+        gemm_ex_repeats = 1;
+        return false;
+    }
+}
+
+void hipblas_advise_call(hipblasHandle_t         handle,
+                         const hipblas_log_site& site,
+                         const hipblas_log_arg*  args,
+                         int                     count)
+{
+    size_t element_size = element_bytes(site, args, count);
+    bool   misaligned = false, ld_interleaved = false, broadcast = false;
+    for(int i = 0; i < count; i++)
+    {
+        const hipblas_log_arg& arg = args[i];
+        if(arg.kind == hipblas_log_arg::POINTER)
+        {
+            // The operands of pointer-array functions are the arrays themselves
+            misaligned |= has(site.operands, i) && !site.pointer_arrays && arg.p
+                          && reinterpret_cast<uintptr_t>(arg.p) % LOAD_ALIGNMENT != 0;
+            continue;
+        }
+        if(arg.kind != hipblas_log_arg::INTEGER)
+            continue;
+        long long bytes = arg.i * (long long)element_size;
+        ld_interleaved |= has(site.leading_dims, i) && bytes >= CHANNEL_INTERVAL
+                          && bytes % CHANNEL_INTERVAL == 0;
+        broadcast |= has(site.strides, i) && arg.i == 0;
+    }
+
+    long long batch_count = -1;
+    if(site.batch_count >= 0 && site.batch_count < count
+       && args[site.batch_count].kind == hipblas_log_arg::INTEGER)
+        batch_count = args[site.batch_count].i;
+
+    const hipblas_handle* h = static_cast<const hipblas_handle*>(handle);
+    if(misaligned)
+        advisor_log.hit(ADVICE_MISALIGNED, site.function);
+    if(ld_interleaved)
+        advisor_log.hit(ADVICE_LD_POWER_OF_TWO, site.function);
+    if((site.pointer_arrays || site.strided) && batch_count == 1)
+        advisor_log.hit(ADVICE_SINGLE_BATCH, site.function);
+    if(site.strided && broadcast && batch_count > 1)
+        advisor_log.hit(ADVICE_BROADCAST_STRIDE, site.function);
+    if(h && site.result >= 0 && h->pointer_mode == HIPBLAS_POINTER_MODE_HOST
+       && h->result_mode == HIPBLAS_RESULT_MODE_BLOCKING)
+        advisor_log.hit(ADVICE_HOST_REDUCTION, site.function);
+    if(repeated_gemm_ex(site, args, count))
+        advisor_log.hit(ADVICE_UNPLANNED_GEMM_EX, site.function);
+}
@@ -0,0 +1,193 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "hipblas_handle.h"
+#include "hipblas_kernels.h"
+#include "hipblas_logging.h"
+#include <algorithm>
+#include <hip/hip_runtime_api.h>
+
+namespace
+{
+    // Neither backend library measures and quantizes in one pass, so both run the same kernel on
+    // the handle's stream
+    hipblasStatus_t launch_status(hipError_t err)
+    {
+        return err == hipSuccess ? HIPBLAS_STATUS_SUCCESS : HIPBLAS_STATUS_INTERNAL_ERROR;
+    }
+
+    template <typename T>
+    hipblas_batched_operand<T> batch_of(T* ptr, int64_t stride)
+    {
+        return {ptr, stride, nullptr};
+    }
+
+    template <typename T>
+    hipblas_batched_operand<T> batch_of(T* const array[])
+    {
+        return {nullptr, 0, array};
+    }
+
+    template <typename T>
+    bool missing(hipblas_batched_operand<T> op)
+    {
+        return op.ptr == nullptr && op.array == nullptr;
+    }
+
+    hipblasStatus_t amax_quantize_batched(hipblasHandle_t                     handle,
+                                          hipblasAmaxMode_t                   mode,
+                                          int                                 m,
+                                          int                                 n,
+                                          hipblas_batched_operand<const void> A,
+                                          hipblasDatatype_t                   a_type,
+                                          int                                 lda,
+                                          const float*                        scale,
+                                          hipblas_batched_operand<void>       Q,
+                                          hipblasDatatype_t                   q_type,
+                                          int                                 ldq,
+                                          float*                              amax,
+                                          int                                 batch_count)
+    {
+        if(handle == nullptr)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if(mode != HIPBLAS_AMAX_PER_TENSOR && mode != HIPBLAS_AMAX_PER_ROW)
+            return HIPBLAS_STATUS_INVALID_ENUM;
+        bool quantize = !missing(Q);
+        if((a_type != HIPBLAS_R_16F && a_type != HIPBLAS_R_16B && a_type != HIPBLAS_R_32F)
+           || (quantize && q_type != HIPBLAS_R_8F_E4M3 && q_type != HIPBLAS_R_8F_E5M2
+               && q_type != HIPBLAS_R_8I))
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+        if(m < 0 || n < 0 || lda < std::max(1, m) || (quantize && ldq < std::max(1, m))
+           || batch_count < 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(m > 0 && n > 0 && batch_count > 0 && missing(A))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        hipStream_t     stream;
+        hipblasStatus_t status = hipblasGetStream(handle, &stream);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        return launch_status(hipblas_amax_quantize_batched(stream,
+                                                           mode == HIPBLAS_AMAX_PER_ROW,
+                                                           m,
+                                                           n,
+                                                           A,
+                                                           a_type,
+                                                           lda,
+                                                           scale,
+                                                           Q,
+                                                           q_type,
+                                                           ldq,
+                                                           amax,
+                                                           batch_count));
+    }
+}
+
+hipblasStatus_t hipblasAmaxQuantize(hipblasHandle_t   handle,
+                                    hipblasAmaxMode_t mode,
+                                    int               m,
+                                    int               n,
+                                    const void*       A,
+                                    hipblasDatatype_t a_type,
+                                    int               lda,
+                                    const float*      scale,
+                                    void*             Q,
+                                    hipblasDatatype_t q_type,
+                                    int               ldq,
+                                    float*            amax)
+{
+    HIPBLAS_LOG_CALL(handle, mode, m, n, A, a_type, lda, scale, Q, q_type, ldq, amax);
+    return amax_quantize_batched(handle,
+                                 mode,
+                                 m,
+                                 n,
+                                 batch_of(A, 0),
+                                 a_type,
+                                 lda,
+                                 scale,
+                                 batch_of(Q, 0),
+                                 q_type,
+                                 ldq,
+                                 amax,
+                                 1);
+}
+
+hipblasStatus_t hipblasAmaxQuantizeBatched(hipblasHandle_t   handle,
+                                           hipblasAmaxMode_t mode,
+                                           int               m,
+                                           int               n,
+                                           const void* const A[],
+                                           hipblasDatatype_t a_type,
+                                           int               lda,
+                                           const float*      scale,
+                                           void* const       Q[],
+                                           hipblasDatatype_t q_type,
+                                           int               ldq,
+                                           float*            amax,
+                                           int               batch_count)
+{
+    HIPBLAS_LOG_CALL(
+        handle, mode, m, n, A, a_type, lda, scale, Q, q_type, ldq, amax, batch_count);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, A, Q);
+    return amax_quantize_batched(handle,
+                                 mode,
+                                 m,
+                                 n,
+                                 batch_of(A),
+                                 a_type,
+                                 lda,
+                                 scale,
+                                 batch_of(Q),
+                                 q_type,
+                                 ldq,
+                                 amax,
+                                 batch_count);
+}
+
+hipblasStatus_t hipblasAmaxQuantizeStridedBatched(hipblasHandle_t   handle,
+                                                  hipblasAmaxMode_t mode,
+                                                  int               m,
+                                                  int               n,
+                                                  const void*       A,
+                                                  hipblasDatatype_t a_type,
+                                                  int               lda,
+                                                  long long         stride_A,
+                                                  const float*      scale,
+                                                  void*             Q,
+                                                  hipblasDatatype_t q_type,
+                                                  int               ldq,
+                                                  long long         stride_Q,
+                                                  float*            amax,
+                                                  int               batch_count)
+{
+    HIPBLAS_LOG_CALL(handle,
+                     mode,
+                     m,
+                     n,
+                     A,
+                     a_type,
+                     lda,
+                     stride_A,
+                     scale,
+                     Q,
+                     q_type,
+                     ldq,
+                     stride_Q,
+                     amax,
+                     batch_count);
+    return amax_quantize_batched(handle,
+                                 mode,
+                                 m,
+                                 n,
+                                 batch_of(A, stride_A),
+                                 a_type,
+                                 lda,
+                                 scale,
+                                 batch_of(Q, stride_Q),
+                                 q_type,
+                                 ldq,
+                                 amax,
+                                 batch_count);
+}
@@ -0,0 +1,670 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "hipblas_logging.h"
+#include <algorithm>
+#include <chrono>
+#include <climits>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <hip/hip_runtime_api.h>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <system_error>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+    using batcher_clock = std::chrono::steady_clock;
+
+    // One submitted gemm or gemv; a gemv keeps incx and incy in ldb and ldc, and its x and y in B
+    // and C. The scalars of either precision are exact as doubles
+    struct batched_call
+    {
+        uint64_t                  ticket;
+        batcher_clock::time_point arrival;
+        bool                      gemv;
+        bool                      fp64;
+        hipblasOperation_t        transa, transb;
+        int                       m, n, k;
+        int                       lda, ldb, ldc;
+        double                    alpha, beta;
+        const void*               A;
+        const void*               B;
+        void*                     C;
+    };
+
+    // The tickets first to last, launched together and run once event has completed
+    struct launch_window
+    {
+        uint64_t   first, last;
+        hipEvent_t event = nullptr;
+
+        ~launch_window()
+        {
+            if(event)
+                hipEventDestroy(event);
+        }
+    };
+
+    struct hipblas_batcher
+    {
+        hipblasHandle_t         handle = nullptr;
+        hipStream_t             stream = nullptr;
+        int                     device = 0;
+        batcher_clock::duration window;
+        size_t                  max_batch;
+
+        std::mutex                mutex;
+        std::condition_variable   submitted; // a call, a flush or the stop request arrived
+        std::condition_variable   dispatched; // a window of calls was launched
+        std::vector<batched_call> pending;
+        uint64_t                  next_ticket        = 1;
+        uint64_t                  dispatched_through = 0;
+        bool                      flush              = false;
+        bool                      stop               = false;
+
+        std::deque<std::shared_ptr<launch_window>>    windows; // launched, some still running
+        std::unordered_map<uint64_t, hipblasStatus_t> failed; // not yet reported by Wait
+
+        std::thread dispatcher;
+    };
+
+    bool same_bits(double a, double b)
+    {
+        return std::memcmp(&a, &b, sizeof(double)) == 0;
+    }
+
+    // Whether one launch can run both calls
+    bool compatible(const batched_call& a, const batched_call& b)
+    {
+        return a.gemv == b.gemv && a.fp64 == b.fp64 && a.transa == b.transa && a.transb == b.transb
+               && a.m == b.m && a.n == b.n && a.k == b.k && a.lda == b.lda && a.ldb == b.ldb
+               && a.ldc == b.ldc && same_bits(a.alpha, b.alpha) && same_bits(a.beta, b.beta);
+    }
+
+    // The common distance in elements from each of p to the next, when there is one
+    template <typename P>
+    bool even_stride(const std::vector<P>& p, long long& stride)
+    {
+        constexpr intptr_t size  = sizeof(*p[0]);
+        intptr_t           bytes = intptr_t(p[1]) - intptr_t(p[0]);
+        if(bytes < 0 || bytes % size)
+            return false;
+        for(size_t i = 2; i < p.size(); i++)
+            if(intptr_t(p[i]) - intptr_t(p[i - 1]) != bytes)
+                return false;
+        stride = bytes / size;
+        return true;
+    }
+
+    template <typename T>
+    struct routines;
+
+    template <>
+    struct routines<float>
+    {
+        static constexpr auto gemm                 = hipblasSgemm;
+        static constexpr auto gemm_batched         = hipblasSgemmBatched;
+        static constexpr auto gemm_strided_batched = hipblasSgemmStridedBatched;
+        static constexpr auto gemv                 = hipblasSgemv;
+        static constexpr auto gemv_batched         = hipblasSgemvBatched;
+        static constexpr auto gemv_strided_batched = hipblasSgemvStridedBatched;
+    };
+
+    template <>
+    struct routines<double>
+    {
+        static constexpr auto gemm                 = hipblasDgemm;
+        static constexpr auto gemm_batched         = hipblasDgemmBatched;
+        static constexpr auto gemm_strided_batched = hipblasDgemmStridedBatched;
+        static constexpr auto gemv                 = hipblasDgemv;
+        static constexpr auto gemv_batched         = hipblasDgemvBatched;
+        static constexpr auto gemv_strided_batched = hipblasDgemvStridedBatched;
+    };
+
+    // Runs a group of compatible calls as one call, strided when the operands are evenly spaced,
+    // which needs no pointer arrays; the handle uploads the host arrays of a batched call
+    template <typename T>
+    hipblasStatus_t launch(hipblasHandle_t handle, const std::vector<const batched_call*>& group)
+    {
+        const batched_call& c     = *group[0];
+        T                   alpha = T(c.alpha);
+        T                   beta  = T(c.beta);
+        int                 count = int(group.size());
+
+        std::vector<const T*> A(count), B(count);
+        std::vector<T*>       C(count);
+        for(int i = 0; i < count; i++)
+        {
+            A[i] = static_cast<const T*>(group[i]->A);
+            B[i] = static_cast<const T*>(group[i]->B);
+            C[i] = static_cast<T*>(group[i]->C);
+        }
+
+        if(c.gemv)
+        {
+            if(count == 1)
+                return routines<T>::gemv(handle,
+                                         c.transa,
+                                         c.m,
+                                         c.n,
+                                         &alpha,
+                                         A[0],
+                                         c.lda,
+                                         B[0],
+                                         c.ldb,
+                                         &beta,
+                                         C[0],
+                                         c.ldc);
+
+            long long sa, sx, sy;
+            if(even_stride(A, sa) && even_stride(B, sx) && even_stride(C, sy)
+               && std::max({sa, sx, sy}) <= INT_MAX)
+                return routines<T>::gemv_strided_batched(handle,
+                                                         c.transa,
+                                                         c.m,
+                                                         c.n,
+                                                         &alpha,
+                                                         A[0],
+                                                         c.lda,
+                                                         int(sa),
+                                                         B[0],
+                                                         c.ldb,
+                                                         int(sx),
+                                                         &beta,
+                                                         C[0],
+                                                         c.ldc,
+                                                         int(sy),
+                                                         count);
+            return routines<T>::gemv_batched(handle,
+                                             c.transa,
+                                             c.m,
+                                             c.n,
+                                             &alpha,
+                                             A.data(),
+                                             c.lda,
+                                             B.data(),
+                                             c.ldb,
+                                             &beta,
+                                             C.data(),
+                                             c.ldc,
+                                             count);
+        }
+
+        if(count == 1)
+            return routines<T>::gemm(handle,
+                                     c.transa,
+                                     c.transb,
+                                     c.m,
+                                     c.n,
+                                     c.k,
+                                     &alpha,
+                                     A[0],
+                                     c.lda,
+                                     B[0],
+                                     c.ldb,
+                                     &beta,
+                                     C[0],
+                                     c.ldc);
+
+        long long sa, sb, sc;
+        if(even_stride(A, sa) && even_stride(B, sb) && even_stride(C, sc))
+            return routines<T>::gemm_strided_batched(handle,
+                                                     c.transa,
+                                                     c.transb,
+                                                     c.m,
+                                                     c.n,
+                                                     c.k,
+                                                     &alpha,
+                                                     A[0],
+                                                     c.lda,
+                                                     sa,
+                                                     B[0],
+                                                     c.ldb,
+                                                     sb,
+                                                     &beta,
+                                                     C[0],
+                                                     c.ldc,
+                                                     sc,
+                                                     count);
+        return routines<T>::gemm_batched(handle,
+                                         c.transa,
+                                         c.transb,
+                                         c.m,
+                                         c.n,
+                                         c.k,
+                                         &alpha,
+                                         A.data(),
+                                         c.lda,
+                                         B.data(),
+                                         c.ldb,
+                                         &beta,
+                                         C.data(),
+                                         c.ldc,
+                                         count);
+    }
+
+    // Launches the calls of one window in groups of at most max_batch, each group led by the
+    // earliest call not yet launched, and returns the window's event; without one, the window is
+    // waited for here
+    std::shared_ptr<launch_window>
+        dispatch(hipblas_batcher*                                   b,
+                 const std::vector<batched_call>&                   calls,
+                 std::vector<std::pair<uint64_t, hipblasStatus_t>>& failures)
+    {
+        std::vector<bool>                taken(calls.size(), false);
+        std::vector<const batched_call*> group;
+        for(size_t i = 0; i < calls.size(); i++)
+        {
+            if(taken[i])
+                continue;
+
+            hipblasStatus_t status;
+            try
+            {
+                group.clear();
+                for(size_t j = i; j < calls.size() && group.size() < b->max_batch; j++)
+                {
+                    if(!taken[j] && compatible(calls[i], calls[j]))
+                    {
+                        group.push_back(&calls[j]);
+                        taken[j] = true;
+                    }
+                }
+                status = calls[i].fp64 ? launch<double>(b->handle, group)
+                                       : launch<float>(b->handle, group);
+            }
+            catch(const std::bad_alloc&)
+            {
+                status = HIPBLAS_STATUS_ALLOC_FAILED;
+            }
+            if(status != HIPBLAS_STATUS_SUCCESS)
+            {
+                for(const batched_call* call : group)
+                    failures.emplace_back(call->ticket, status);
+            }
+        }
+
+        std::shared_ptr<launch_window> window = std::make_shared<launch_window>();
+        window->first                         = calls.front().ticket;
+        window->last                          = calls.back().ticket;
+        if(hipEventCreateWithFlags(&window->event, hipEventDisableTiming) != hipSuccess)
+            window->event = nullptr;
+        if(!window->event || hipEventRecord(window->event, b->stream) != hipSuccess)
+        {
+            hipStreamSynchronize(b->stream);
+            return nullptr;
+        }
+        return window;
+    }
+
+    void run(hipblas_batcher* b)
+    {
+        hipSetDevice(b->device);
+
+        std::unique_lock<std::mutex> lock(b->mutex);
+        for(;;)
+        {
+            b->submitted.wait(lock, [b] { return b->stop || !b->pending.empty(); });
+            if(b->pending.empty())
+                return;
+            b->submitted.wait_until(lock, b->pending.front().arrival + b->window, [b] {
+                return b->stop || b->flush || b->pending.size() >= b->max_batch;
+            });
+
+            std::vector<batched_call> calls;
+            calls.swap(b->pending);
+            b->flush = false;
+            lock.unlock();
+
+            std::vector<std::pair<uint64_t, hipblasStatus_t>> failures;
+            std::shared_ptr<launch_window>                    window;
+            try
+            {
+                window = dispatch(b, calls, failures);
+            }
+            catch(const std::bad_alloc&)
+            {
+                hipStreamSynchronize(b->stream);
+            }
+
+            lock.lock();
+            try
+            {
+                b->failed.insert(failures.begin(), failures.end());
+                if(window)
+                    b->windows.push_back(std::move(window));
+            }
+            catch(const std::bad_alloc&)
+            {
+                hipStreamSynchronize(b->stream);
+            }
+            while(!b->windows.empty() && hipEventQuery(b->windows.front()->event) == hipSuccess)
+                b->windows.pop_front();
+            b->dispatched_through = calls.back().ticket;
+            b->dispatched.notify_all();
+        }
+    }
+
+    hipblasStatus_t submit(hipblas_batcher* b, const batched_call& call, uint64_t* ticket)
+    {
+        std::lock_guard<std::mutex> lock(b->mutex);
+        try
+        {
+            b->pending.push_back(call);
+        }
+        catch(const std::bad_alloc&)
+        {
+            return HIPBLAS_STATUS_ALLOC_FAILED;
+        }
+        b->pending.back().ticket  = b->next_ticket;
+        b->pending.back().arrival = batcher_clock::now();
+        *ticket                   = b->next_ticket++;
+        b->submitted.notify_one();
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    bool valid_operation(hipblasOperation_t op)
+    {
+        return op == HIPBLAS_OP_N || op == HIPBLAS_OP_T || op == HIPBLAS_OP_C;
+    }
+
+    // Checked here rather than at launch, so that a bad call does not fail the calls merged with it
+    template <typename T>
+    hipblasStatus_t submit_gemm(hipblasBatcher_t   batcher,
+                                hipblasOperation_t transa,
+                                hipblasOperation_t transb,
+                                int                m,
+                                int                n,
+                                int                k,
+                                const T*           alpha,
+                                const T*           A,
+                                int                lda,
+                                const T*           B,
+                                int                ldb,
+                                const T*           beta,
+                                T*                 C,
+                                int                ldc,
+                                uint64_t*          ticket)
+    {
+        hipblas_batcher* b = static_cast<hipblas_batcher*>(batcher);
+        if(b == nullptr)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if(!valid_operation(transa) || !valid_operation(transb))
+            return HIPBLAS_STATUS_INVALID_ENUM;
+        if(m < 0 || n < 0 || k < 0 || lda < std::max(1, transa == HIPBLAS_OP_N ? m : k)
+           || ldb < std::max(1, transb == HIPBLAS_OP_N ? k : n) || ldc < std::max(1, m))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(!alpha || !beta || !ticket || (m && n && (!C || (k && (!A || !B)))))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        batched_call call = {};
+        call.fp64         = sizeof(T) == sizeof(double);
+        call.transa       = transa;
+        call.transb       = transb;
+        call.m            = m;
+        call.n            = n;
+        call.k            = k;
+        call.lda          = lda;
+        call.ldb          = ldb;
+        call.ldc          = ldc;
+        call.alpha        = *alpha;
+        call.beta         = *beta;
+        call.A            = A;
+        call.B            = B;
+        call.C            = C;
+        return submit(b, call, ticket);
+    }
+
+    template <typename T>
+    hipblasStatus_t submit_gemv(hipblasBatcher_t   batcher,
+                                hipblasOperation_t trans,
+                                int                m,
+                                int                n,
+                                const T*           alpha,
+                                const T*           A,
+                                int                lda,
+                                const T*           x,
+                                int                incx,
+                                const T*           beta,
+                                T*                 y,
+                                int                incy,
+                                uint64_t*          ticket)
+    {
+        hipblas_batcher* b = static_cast<hipblas_batcher*>(batcher);
+        if(b == nullptr)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if(!valid_operation(trans))
+            return HIPBLAS_STATUS_INVALID_ENUM;
+        if(m < 0 || n < 0 || lda < std::max(1, m) || incx == 0 || incy == 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(!alpha || !beta || !ticket || (m && n && (!A || !x || !y)))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        batched_call call = {};
+        call.gemv         = true;
+        call.fp64         = sizeof(T) == sizeof(double);
+        call.transa       = trans;
+        call.transb       = HIPBLAS_OP_N;
+        call.m            = m;
+        call.n            = n;
+        call.lda          = lda;
+        call.ldb          = incx;
+        call.ldc          = incy;
+        call.alpha        = *alpha;
+        call.beta         = *beta;
+        call.A            = A;
+        call.B            = x;
+        call.C            = y;
+        return submit(b, call, ticket);
+    }
+}
+
+hipblasStatus_t hipblasBatcherCreate(hipblasBatcher_t* batcher,
+                                     hipStream_t       stream,
+                                     int               window_us,
+                                     int               max_batch)
+{
+    HIPBLAS_LOG_CALL_NO_HANDLE(batcher, stream, window_us, max_batch);
+    if(batcher == nullptr || window_us < 0 || max_batch < 1)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    std::unique_ptr<hipblas_batcher> b(new(std::nothrow) hipblas_batcher);
+    if(!b)
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+    b->stream    = stream;
+    b->window    = std::chrono::microseconds(window_us);
+    b->max_batch = size_t(max_batch);
+    if(hipGetDevice(&b->device) != hipSuccess)
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+    hipblasStatus_t status = hipblasCreate(&b->handle);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    status = hipblasSetStream(b->handle, stream);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasSetPointerArrayMode(b->handle, HIPBLAS_POINTER_ARRAY_HOST);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+    {
+        try
+        {
+            b->dispatcher = std::thread(run, b.get());
+        }
+        catch(const std::system_error&)
+        {
+            status = HIPBLAS_STATUS_INTERNAL_ERROR;
+        }
+    }
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblasDestroy(b->handle);
+        return status;
+    }
+    *batcher = b.release();
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblasBatcherDestroy(hipblasBatcher_t batcher)
+{
+    HIPBLAS_LOG_CALL_NO_HANDLE(batcher);
+    hipblas_batcher* b = static_cast<hipblas_batcher*>(batcher);
+    if(b == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    {
+        std::lock_guard<std::mutex> lock(b->mutex);
+        b->stop = true;
+    }
+    b->submitted.notify_one();
+    b->dispatcher.join();
+
+    hipblasStatus_t status = hipStreamSynchronize(b->stream) == hipSuccess
+                                 ? HIPBLAS_STATUS_SUCCESS
+                                 : HIPBLAS_STATUS_INTERNAL_ERROR;
+    b->windows.clear();
+    hipblasStatus_t destroyed = hipblasDestroy(b->handle);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = destroyed;
+    delete b;
+    return status;
+}
+
+hipblasStatus_t hipblasBatcherFlush(hipblasBatcher_t batcher)
+{
+    HIPBLAS_LOG_CALL_NO_HANDLE(batcher);
+    hipblas_batcher* b = static_cast<hipblas_batcher*>(batcher);
+    if(b == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    std::lock_guard<std::mutex> lock(b->mutex);
+    if(!b->pending.empty())
+    {
+        b->flush = true;
+        b->submitted.notify_one();
+    }
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblasBatcherWait(hipblasBatcher_t batcher, uint64_t ticket)
+{
+    HIPBLAS_LOG_CALL_NO_HANDLE(batcher, ticket);
+    hipblas_batcher* b = static_cast<hipblas_batcher*>(batcher);
+    if(b == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    // The window is found under the lock and waited for outside it; windows no longer listed
+    // have completed
+    std::shared_ptr<launch_window> window;
+    hipblasStatus_t                status = HIPBLAS_STATUS_SUCCESS;
+    {
+        std::unique_lock<std::mutex> lock(b->mutex);
+        if(ticket == 0 || ticket >= b->next_ticket)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        b->dispatched.wait(lock, [b, ticket] { return b->dispatched_through >= ticket; });
+        for(const std::shared_ptr<launch_window>& w : b->windows)
+        {
+            if(w->first <= ticket && ticket <= w->last)
+            {
+                window = w;
+                break;
+            }
+        }
+        auto failure = b->failed.find(ticket);
+        if(failure != b->failed.end())
+        {
+            status = failure->second;
+            b->failed.erase(failure);
+        }
+    }
+    if(window && hipEventSynchronize(window->event) != hipSuccess)
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+    return status;
+}
+
+hipblasStatus_t hipblasBatcherSgemm(hipblasBatcher_t   batcher,
+                                    hipblasOperation_t transa,
+                                    hipblasOperation_t transb,
+                                    int                m,
+                                    int                n,
+                                    int                k,
+                                    const float*       alpha,
+                                    const float*       A,
+                                    int                lda,
+                                    const float*       B,
+                                    int                ldb,
+                                    const float*       beta,
+                                    float*             C,
+                                    int                ldc,
+                                    uint64_t*          ticket)
+{
+    HIPBLAS_LOG_CALL_NO_HANDLE(
+        batcher, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, ticket);
+    return submit_gemm(
+        batcher, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, ticket);
+}
+
+hipblasStatus_t hipblasBatcherDgemm(hipblasBatcher_t   batcher,
+                                    hipblasOperation_t transa,
+                                    hipblasOperation_t transb,
+                                    int                m,
+                                    int                n,
+                                    int                k,
+                                    const double*      alpha,
+                                    const double*      A,
+                                    int                lda,
+                                    const double*      B,
+                                    int                ldb,
+                                    const double*      beta,
+                                    double*            C,
+                                    int                ldc,
+                                    uint64_t*          ticket)
+{
+    HIPBLAS_LOG_CALL_NO_HANDLE(
+        batcher, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, ticket);
+    return submit_gemm(
+        batcher, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, ticket);
+}
+
+hipblasStatus_t hipblasBatcherSgemv(hipblasBatcher_t   batcher,
+                                    hipblasOperation_t trans,
+                                    int                m,
+                                    int                n,
+                                    const float*       alpha,
+                                    const float*       A,
+                                    int                lda,
+                                    const float*       x,
+                                    int                incx,
+                                    const float*       beta,
+                                    float*             y,
+                                    int                incy,
+                                    uint64_t*          ticket)
+{
+    HIPBLAS_LOG_CALL_NO_HANDLE(batcher, trans, m, n, alpha, A, lda, x, incx, beta, y, incy, ticket);
+    return submit_gemv(batcher, trans, m, n, alpha, A, lda, x, incx, beta, y, incy, ticket);
+}
+
+hipblasStatus_t hipblasBatcherDgemv(hipblasBatcher_t   batcher,
+                                    hipblasOperation_t trans,
+                                    int                m,
+                                    int                n,
+                                    const double*      alpha,
+                                    const double*      A,
+                                    int                lda,
+                                    const double*      x,
+                                    int                incx,
+                                    const double*      beta,
+                                    double*            y,
+                                    int                incy,
+                                    uint64_t*          ticket)
+{
+    HIPBLAS_LOG_CALL_NO_HANDLE(batcher, trans, m, n, alpha, A, lda, x, incx, beta, y, incy, ticket);
+    return submit_gemv(batcher, trans, m, n, alpha, A, lda, x, incx, beta, y, incy, ticket);
+}
@@ -0,0 +1,235 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipblas_handle.h"
+#include "hipblas_logging.h"
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <hip/hip_runtime_api.h>
+#include <map>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+/* ============================================================================================ */
+/*  HIPBLAS_LAYER record: the binary call trace hipblas-replay re-issues.
+ *
+ *  The file named by HIPBLAS_LOG_RECORD_PATH starts with the bytes "HBRC" and a uint32 version,
+ *  then holds these records, in host byte order:
+ *    'F' u32 id, u16 length, name              before the first call of each function
+ *    'C' u32 function, u64 sequence, u64 handle, u64 stream, f64 host_us, u64 after, u8 count,
+ *        then count arguments
+ *  host_us is the host time of the call since the first one recorded, and after is 1 + the
+ *  sequence of the last earlier call on another stream that used one of this call's device
+ *  allocations, or 0. An argument is a u8 hipblas_log_arg::kind_t, then an i64 for INTEGER and
+ *  NAME, an f64 for REAL, and for POINTER the u64 address, then the u64 base and size of the
+ *  device allocation it points into (both 0 for host memory), a u32 length and that many bytes:
+ *  the value of a host-mode scalar or, with HIPBLAS_LOG_RECORD_DATA=1, the device memory from the
+ *  address to the end of its allocation as the call found it. */
+
+namespace
+{
+    constexpr uint32_t record_version = 1;
+
+    // Bytes behind a host-mode scalar, 0 when unknown; the Ex functions are taken at the size of
+    // their first data type, which is enough for replaying their shape
+    size_t scalar_bytes(const hipblas_log_site& site, const hipblas_log_arg* args, int count)
+    {
+        const char* name = site.function + (std::strncmp(site.function, "hipblas", 7) ? 0 : 7);
+        if(site.element_size)
+        {
+            // csscal and zdscal take a real alpha
+            bool real = !std::strncmp(name, "Cs", 2) || !std::strncmp(name, "Zd", 2);
+            return real ? site.element_size / 2 : site.element_size;
+        }
+        if(site.data_type >= 0 && site.data_type < count
+           && args[site.data_type].kind != hipblas_log_arg::POINTER)
+            return hipblas_datatype_size(hipblasDatatype_t(args[site.data_type].i));
+        return 0;
+    }
+
+    class call_recorder
+    {
+    public:
+        call_recorder()
+        {
+            const char* path = std::getenv("HIPBLAS_LOG_RECORD_PATH");
+            const char* data = std::getenv("HIPBLAS_LOG_RECORD_DATA");
+            with_data        = data && std::atoi(data) != 0;
+            if(!path || !*path)
+                return;
+
+            file.open(path, std::ios::binary | std::ios::trunc);
+            if(!file)
+                return;
+            file.write("HBRC", 4);
+            file.write(reinterpret_cast<const char*>(&record_version), sizeof(record_version));
+        }
+
+        void record(hipblasHandle_t         handle,
+                    const hipblas_log_site& site,
+                    const hipblas_log_arg*  args,
+                    int                     count);
+
+    private:
+        template <typename T>
+        void put(const T& value)
+        {
+            const char* bytes = reinterpret_cast<const char*>(&value);
+            buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+        }
+
+        void put_bytes(const void* data, size_t bytes)
+        {
+            put(uint32_t(bytes));
+            const char* first = static_cast<const char*>(data);
+            buffer.insert(buffer.end(), first, first + bytes);
+        }
+
+        std::mutex                                         mutex;
+        std::ofstream                                      file;
+        bool                                               with_data = false;
+        std::vector<char>                                  buffer;
+        std::vector<char>                                  staging;
+        std::map<const char*, uint32_t>                    functions;
+        std::map<uintptr_t, std::pair<uint64_t, uint64_t>> last_use; // base: sequence, stream
+        uint64_t                                           sequence = 0;
+        std::chrono::steady_clock::time_point              first;
+    };
+
+    void call_recorder::record(hipblasHandle_t         handle,
+                               const hipblas_log_site& site,
+                               const hipblas_log_arg*  args,
+                               int                     count)
+    {
+        if(!file.is_open())
+            return;
+
+        const hipblas_handle* h         = static_cast<const hipblas_handle*>(handle);
+        hipStream_t           stream    = nullptr;
+        bool                  host_mode = true;
+        if(h)
+        {
+            if(hipblasGetStream(handle, &stream) != HIPBLAS_STATUS_SUCCESS)
+                stream = nullptr;
+            host_mode = h->pointer_mode == HIPBLAS_POINTER_MODE_HOST;
+        }
+
+        // Reading device memory waits for the stream, which a capture cannot do
+        bool   data   = with_data && (!h || h->capture_mode == HIPBLAS_CAPTURE_MODE_DEFAULT);
+        bool   synced = false;
+        size_t scalar = scalar_bytes(site, args, count);
+        auto   now    = std::chrono::steady_clock::now();
+
+        std::lock_guard<std::mutex> lock(mutex);
+        if(sequence == 0)
+            first = now;
+        buffer.clear();
+
+        auto known = functions.find(site.function);
+        if(known == functions.end())
+        {
+            uint16_t length = uint16_t(std::strlen(site.function));
+            known           = functions.emplace(site.function, uint32_t(functions.size())).first;
+            buffer.push_back('F');
+            put(known->second);
+            put(length);
+            buffer.insert(buffer.end(), site.function, site.function + length);
+        }
+
+        // after is filled in once the allocations are known
+        uint64_t stream_id = uint64_t(uintptr_t(stream));
+        uint64_t after     = 0;
+        buffer.push_back('C');
+        put(known->second);
+        put(sequence);
+        put(uint64_t(uintptr_t(handle)));
+        put(stream_id);
+        put(std::chrono::duration<double, std::micro>(now - first).count());
+        size_t after_at = buffer.size();
+        put(after);
+        put(uint8_t(count));
+
+        for(int i = 0; i < count; i++)
+        {
+            const hipblas_log_arg& arg = args[i];
+            put(uint8_t(arg.kind));
+            if(arg.kind == hipblas_log_arg::REAL)
+            {
+                put(arg.d);
+                continue;
+            }
+            if(arg.kind != hipblas_log_arg::POINTER)
+            {
+                put(int64_t(arg.i));
+                continue;
+            }
+
+            // Host pointers are unknown to the runtime, which is not an error here
+            void*  base = nullptr;
+            size_t size = 0;
+            if(arg.p
+               && hipMemGetAddressRange(&base, &size, const_cast<void*>(arg.p)) != hipSuccess)
+            {
+                (void)hipGetLastError();
+                base = nullptr;
+                size = 0;
+            }
+            put(uint64_t(uintptr_t(arg.p)));
+            put(uint64_t(uintptr_t(base)));
+            put(uint64_t(size));
+
+            bool is_scalar = i < 64 && (site.scalars >> i & 1);
+            if(!base)
+            {
+                if(is_scalar && host_mode && arg.p)
+                    put_bytes(arg.p, scalar);
+                else
+                    put_bytes(nullptr, 0);
+                continue;
+            }
+
+            auto used = last_use.find(uintptr_t(base));
+            if(used != last_use.end() && used->second.second != stream_id
+               && used->second.first + 1 > after)
+                after = used->second.first + 1;
+            last_use[uintptr_t(base)] = {sequence, stream_id};
+
+            size_t bytes = size - (static_cast<const char*>(arg.p) - static_cast<char*>(base));
+            if(data && !synced)
+                synced = hipStreamSynchronize(stream) == hipSuccess;
+            if(!synced)
+            {
+                put_bytes(nullptr, 0);
+                continue;
+            }
+            staging.resize(bytes);
+            if(hipMemcpy(staging.data(), arg.p, bytes, hipMemcpyDeviceToHost) != hipSuccess)
+            {
+                (void)hipGetLastError();
+                put_bytes(nullptr, 0);
+                continue;
+            }
+            put_bytes(staging.data(), bytes);
+        }
+        std::memcpy(buffer.data() + after_at, &after, sizeof(after));
+
+        file.write(buffer.data(), buffer.size());
+        file.flush();
+        sequence++;
+    }
+
+    call_recorder recorder;
+}
+
+void hipblas_record_call(hipblasHandle_t         handle,
+                         const hipblas_log_site& site,
+                         const hipblas_log_arg*  args,
+                         int                     count)
+{
+    recorder.record(handle, site, args, count);
+}
@@ -0,0 +1,110 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipblas_handle.h"
+#include "hipblas_logging.h"
+#include <hip/hip_runtime_api.h>
+
+namespace
+{
+    // Stops the capture begun on the handle and returns its graph; the handle is back in the
+    // mode it had before, whatever the outcome
+    hipblasStatus_t end_capture(hipblas_handle* h, hipGraph_t* graph)
+    {
+        *graph = nullptr;
+        if(!h->capturing)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        hipStream_t     stream;
+        hipblasStatus_t status = hipblasGetStream(h, &stream);
+        h->capturing           = false;
+        h->capture_mode        = h->capture_restore;
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        if(hipStreamEndCapture(stream, graph) != hipSuccess || *graph == nullptr)
+        {
+            if(*graph)
+                (void)hipGraphDestroy(*graph);
+            *graph = nullptr;
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+        }
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+}
+
+hipblasStatus_t hipblasBeginCapture(hipblasHandle_t handle)
+{
+    HIPBLAS_LOG_CALL(handle);
+    hipblas_handle* h = static_cast<hipblas_handle*>(handle);
+    if(h == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(h->capturing)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipStream_t     stream;
+    hipblasStatus_t status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // The null stream synchronizes with every other one, so it cannot be captured. Thread-local
+    // capture lets other threads keep allocating while this one must stay capture-safe
+    if(stream == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(hipStreamBeginCapture(stream, hipStreamCaptureModeThreadLocal) != hipSuccess)
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+    h->capturing       = true;
+    h->capture_restore = h->capture_mode;
+    h->capture_mode    = HIPBLAS_CAPTURE_MODE_SAFE;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblasEndCapture(hipblasHandle_t handle, hipGraphExec_t* graph)
+{
+    HIPBLAS_LOG_CALL(handle, graph);
+    hipblas_handle* h = static_cast<hipblas_handle*>(handle);
+    if(h == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    hipGraph_t      recorded;
+    hipblasStatus_t status = end_capture(h, &recorded);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // The capture is ended even without somewhere to put it, so the stream is usable again
+    if(graph == nullptr)
+        status = HIPBLAS_STATUS_INVALID_VALUE;
+    else if(hipGraphInstantiate(graph, recorded, nullptr, nullptr, 0) != hipSuccess)
+    {
+        *graph = nullptr;
+        status = HIPBLAS_STATUS_INTERNAL_ERROR;
+    }
+    (void)hipGraphDestroy(recorded);
+    return status;
+}
+
+hipblasStatus_t hipblasUpdateCapture(hipblasHandle_t handle, hipGraphExec_t graph)
+{
+    HIPBLAS_LOG_CALL(handle, graph);
+    hipblas_handle* h = static_cast<hipblas_handle*>(handle);
+    if(h == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    hipGraph_t      recorded;
+    hipblasStatus_t status = end_capture(h, &recorded);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // Only kernel parameters and copy addresses may change; a different sequence of nodes is
+    // refused and graph keeps replaying the one it was made from
+    hipGraphNode_t           error_node;
+    hipGraphExecUpdateResult result;
+    if(graph == nullptr
+       || hipGraphExecUpdate(graph, recorded, &error_node, &result) != hipSuccess
+       || result != hipGraphExecUpdateSuccess)
+        status = HIPBLAS_STATUS_INVALID_VALUE;
+    (void)hipGraphDestroy(recorded);
+    return status;
+}
@@ -0,0 +1,654 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "hipblas_handle.h"
+#include "hipblas_kernels.h"
+#include "hipblas_logging.h"
+#include <algorithm>
+#include <hip/hip_runtime_api.h>
+
+namespace
+{
+    hipblasStatus_t launch_status(hipError_t err)
+    {
+        return err == hipSuccess ? HIPBLAS_STATUS_SUCCESS : HIPBLAS_STATUS_INTERNAL_ERROR;
+    }
+
+    bool valid_operation(hipblasOperation_t trans)
+    {
+        return trans == HIPBLAS_OP_N || trans == HIPBLAS_OP_T || trans == HIPBLAS_OP_C;
+    }
+
+    // Neither backend library has a compact layout, so both run the same kernels: one thread per
+    // matrix on the handle's stream, with no workspace
+    hipblasStatus_t
+        compact_launch(hipblasHandle_t handle, hipStream_t& stream, bool& device_scalars)
+    {
+        hipblasPointerMode_t mode   = HIPBLAS_POINTER_MODE_HOST;
+        hipblasStatus_t      status = hipblasGetStream(handle, &stream);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblasGetPointerMode(handle, &mode);
+        device_scalars = mode == HIPBLAS_POINTER_MODE_DEVICE;
+        return status;
+    }
+
+    template <typename T>
+    hipblasStatus_t pack_compact(hipblasHandle_t handle,
+                                 bool            unpack,
+                                 int             m,
+                                 int             n,
+                                 const T*        src,
+                                 int             lds,
+                                 T*              dst,
+                                 int             ldd,
+                                 int             stride,
+                                 int             batch_count)
+    {
+        int ld_strided = unpack ? ldd : lds;
+        if(m < 0 || n < 0 || lds < std::max(1, m) || ldd < std::max(1, m)
+           || stride < int64_t(ld_strided) * n || batch_count < 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(m == 0 || n == 0 || batch_count == 0)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(src == nullptr || dst == nullptr)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        hipStream_t     stream;
+        bool            device_scalars;
+        hipblasStatus_t status = compact_launch(handle, stream, device_scalars);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        return launch_status(hipblas_compact_pack(
+            stream, unpack, m, n, src, lds, dst, ldd, stride, batch_count));
+    }
+
+    template <typename T>
+    hipblasStatus_t gemm_compact(hipblasHandle_t    handle,
+                                 hipblasOperation_t transA,
+                                 hipblasOperation_t transB,
+                                 int                m,
+                                 int                n,
+                                 int                k,
+                                 const T*           alpha,
+                                 const T*           A,
+                                 int                lda,
+                                 const T*           B,
+                                 int                ldb,
+                                 const T*           beta,
+                                 T*                 C,
+                                 int                ldc,
+                                 int                batch_count)
+    {
+        int a_rows = transA == HIPBLAS_OP_N ? m : k;
+        int b_rows = transB == HIPBLAS_OP_N ? k : n;
+        if(!valid_operation(transA) || !valid_operation(transB) || m < 0 || n < 0 || k < 0
+           || lda < std::max(1, a_rows) || ldb < std::max(1, b_rows) || ldc < std::max(1, m)
+           || batch_count < 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(m == 0 || n == 0 || batch_count == 0)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(!alpha || !beta || !C || (k > 0 && (!A || !B)))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        hipStream_t     stream;
+        bool            device_scalars;
+        hipblasStatus_t status = compact_launch(handle, stream, device_scalars);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        return launch_status(hipblas_gemm_compact(stream,
+                                                  transA,
+                                                  transB,
+                                                  m,
+                                                  n,
+                                                  k,
+                                                  alpha,
+                                                  beta,
+                                                  device_scalars,
+                                                  A,
+                                                  lda,
+                                                  B,
+                                                  ldb,
+                                                  C,
+                                                  ldc,
+                                                  batch_count));
+    }
+
+    template <typename T>
+    hipblasStatus_t trsm_compact(hipblasHandle_t    handle,
+                                 hipblasSideMode_t  side,
+                                 hipblasFillMode_t  uplo,
+                                 hipblasOperation_t transA,
+                                 hipblasDiagType_t  diag,
+                                 int                m,
+                                 int                n,
+                                 const T*           alpha,
+                                 const T*           A,
+                                 int                lda,
+                                 T*                 B,
+                                 int                ldb,
+                                 int                batch_count)
+    {
+        int k = side == HIPBLAS_SIDE_LEFT ? m : n;
+        if((side != HIPBLAS_SIDE_LEFT && side != HIPBLAS_SIDE_RIGHT)
+           || (uplo != HIPBLAS_FILL_MODE_UPPER && uplo != HIPBLAS_FILL_MODE_LOWER)
+           || !valid_operation(transA)
+           || (diag != HIPBLAS_DIAG_NON_UNIT && diag != HIPBLAS_DIAG_UNIT) || m < 0 || n < 0
+           || lda < std::max(1, k) || ldb < std::max(1, m) || batch_count < 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(m == 0 || n == 0 || batch_count == 0)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(!alpha || !A || !B)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        hipStream_t     stream;
+        bool            device_scalars;
+        hipblasStatus_t status = compact_launch(handle, stream, device_scalars);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        return launch_status(hipblas_trsm_compact(stream,
+                                                  side,
+                                                  uplo,
+                                                  transA,
+                                                  diag,
+                                                  m,
+                                                  n,
+                                                  alpha,
+                                                  device_scalars,
+                                                  A,
+                                                  lda,
+                                                  B,
+                                                  ldb,
+                                                  batch_count));
+    }
+
+    template <typename T>
+    hipblasStatus_t getrf_compact(
+        hipblasHandle_t handle, int n, T* A, int lda, int* ipiv, int* info, int batch_count)
+    {
+        if(n < 0 || lda < std::max(1, n) || batch_count < 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(batch_count == 0)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(!info || (n > 0 && (!A || !ipiv)))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        hipStream_t     stream;
+        bool            device_scalars;
+        hipblasStatus_t status = compact_launch(handle, stream, device_scalars);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        return launch_status(hipblas_getrf_compact(stream, n, A, lda, ipiv, info, batch_count));
+    }
+
+    template <typename T>
+    hipblasStatus_t getrs_compact(hipblasHandle_t    handle,
+                                  hipblasOperation_t trans,
+                                  int                n,
+                                  int                nrhs,
+                                  const T*           A,
+                                  int                lda,
+                                  const int*         ipiv,
+                                  T*                 B,
+                                  int                ldb,
+                                  int                batch_count)
+    {
+        if(!valid_operation(trans) || n < 0 || nrhs < 0 || lda < std::max(1, n)
+           || ldb < std::max(1, n) || batch_count < 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(n == 0 || nrhs == 0 || batch_count == 0)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(!A || !ipiv || !B)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        hipStream_t     stream;
+        bool            device_scalars;
+        hipblasStatus_t status = compact_launch(handle, stream, device_scalars);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        return launch_status(
+            hipblas_getrs_compact(stream, trans, n, nrhs, A, lda, ipiv, B, ldb, batch_count));
+    }
+}
+
+hipblasStatus_t hipblasSpackCompact(hipblasHandle_t handle,
+                                    const int       m,
+                                    const int       n,
+                                    const float*    A,
+                                    const int       lda,
+                                    const int       strideA,
+                                    float*          Ac,
+                                    const int       ldac,
+                                    const int       batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, m, n, A, lda, strideA, Ac, ldac, batch_count);
+    return pack_compact(handle, false, m, n, A, lda, Ac, ldac, strideA, batch_count);
+}
+
+hipblasStatus_t hipblasDpackCompact(hipblasHandle_t handle,
+                                    const int       m,
+                                    const int       n,
+                                    const double*   A,
+                                    const int       lda,
+                                    const int       strideA,
+                                    double*         Ac,
+                                    const int       ldac,
+                                    const int       batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, m, n, A, lda, strideA, Ac, ldac, batch_count);
+    return pack_compact(handle, false, m, n, A, lda, Ac, ldac, strideA, batch_count);
+}
+
+hipblasStatus_t hipblasCpackCompact(hipblasHandle_t       handle,
+                                    const int             m,
+                                    const int             n,
+                                    const hipblasComplex* A,
+                                    const int             lda,
+                                    const int             strideA,
+                                    hipblasComplex*       Ac,
+                                    const int             ldac,
+                                    const int             batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, m, n, A, lda, strideA, Ac, ldac, batch_count);
+    return pack_compact(handle, false, m, n, A, lda, Ac, ldac, strideA, batch_count);
+}
+
+hipblasStatus_t hipblasZpackCompact(hipblasHandle_t             handle,
+                                    const int                   m,
+                                    const int                   n,
+                                    const hipblasDoubleComplex* A,
+                                    const int                   lda,
+                                    const int                   strideA,
+                                    hipblasDoubleComplex*       Ac,
+                                    const int                   ldac,
+                                    const int                   batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, m, n, A, lda, strideA, Ac, ldac, batch_count);
+    return pack_compact(handle, false, m, n, A, lda, Ac, ldac, strideA, batch_count);
+}
+
+hipblasStatus_t hipblasSunpackCompact(hipblasHandle_t handle,
+                                      const int       m,
+                                      const int       n,
+                                      const float*    Ac,
+                                      const int       ldac,
+                                      float*          A,
+                                      const int       lda,
+                                      const int       strideA,
+                                      const int       batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, m, n, Ac, ldac, A, lda, strideA, batch_count);
+    return pack_compact(handle, true, m, n, Ac, ldac, A, lda, strideA, batch_count);
+}
+
+hipblasStatus_t hipblasDunpackCompact(hipblasHandle_t handle,
+                                      const int       m,
+                                      const int       n,
+                                      const double*   Ac,
+                                      const int       ldac,
+                                      double*         A,
+                                      const int       lda,
+                                      const int       strideA,
+                                      const int       batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, m, n, Ac, ldac, A, lda, strideA, batch_count);
+    return pack_compact(handle, true, m, n, Ac, ldac, A, lda, strideA, batch_count);
+}
+
+hipblasStatus_t hipblasCunpackCompact(hipblasHandle_t       handle,
+                                      const int             m,
+                                      const int             n,
+                                      const hipblasComplex* Ac,
+                                      const int             ldac,
+                                      hipblasComplex*       A,
+                                      const int             lda,
+                                      const int             strideA,
+                                      const int             batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, m, n, Ac, ldac, A, lda, strideA, batch_count);
+    return pack_compact(handle, true, m, n, Ac, ldac, A, lda, strideA, batch_count);
+}
+
+hipblasStatus_t hipblasZunpackCompact(hipblasHandle_t             handle,
+                                      const int                   m,
+                                      const int                   n,
+                                      const hipblasDoubleComplex* Ac,
+                                      const int                   ldac,
+                                      hipblasDoubleComplex*       A,
+                                      const int                   lda,
+                                      const int                   strideA,
+                                      const int                   batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, m, n, Ac, ldac, A, lda, strideA, batch_count);
+    return pack_compact(handle, true, m, n, Ac, ldac, A, lda, strideA, batch_count);
+}
+
+hipblasStatus_t hipblasSgemmCompact(hipblasHandle_t    handle,
+                                    hipblasOperation_t transA,
+                                    hipblasOperation_t transB,
+                                    const int          m,
+                                    const int          n,
+                                    const int          k,
+                                    const float*       alpha,
+                                    const float*       A,
+                                    const int          lda,
+                                    const float*       B,
+                                    const int          ldb,
+                                    const float*       beta,
+                                    float*             C,
+                                    const int          ldc,
+                                    const int          batch_count)
+{
+    HIPBLAS_LOG_CALL(handle,
+                     transA,
+                     transB,
+                     m,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     B,
+                     ldb,
+                     beta,
+                     C,
+                     ldc,
+                     batch_count);
+    return gemm_compact(
+        handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batch_count);
+}
+
+hipblasStatus_t hipblasDgemmCompact(hipblasHandle_t    handle,
+                                    hipblasOperation_t transA,
+                                    hipblasOperation_t transB,
+                                    const int          m,
+                                    const int          n,
+                                    const int          k,
+                                    const double*      alpha,
+                                    const double*      A,
+                                    const int          lda,
+                                    const double*      B,
+                                    const int          ldb,
+                                    const double*      beta,
+                                    double*            C,
+                                    const int          ldc,
+                                    const int          batch_count)
+{
+    HIPBLAS_LOG_CALL(handle,
+                     transA,
+                     transB,
+                     m,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     B,
+                     ldb,
+                     beta,
+                     C,
+                     ldc,
+                     batch_count);
+    return gemm_compact(
+        handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batch_count);
+}
+
+hipblasStatus_t hipblasCgemmCompact(hipblasHandle_t       handle,
+                                    hipblasOperation_t    transA,
+                                    hipblasOperation_t    transB,
+                                    const int             m,
+                                    const int             n,
+                                    const int             k,
+                                    const hipblasComplex* alpha,
+                                    const hipblasComplex* A,
+                                    const int             lda,
+                                    const hipblasComplex* B,
+                                    const int             ldb,
+                                    const hipblasComplex* beta,
+                                    hipblasComplex*       C,
+                                    const int             ldc,
+                                    const int             batch_count)
+{
+    HIPBLAS_LOG_CALL(handle,
+                     transA,
+                     transB,
+                     m,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     B,
+                     ldb,
+                     beta,
+                     C,
+                     ldc,
+                     batch_count);
+    return gemm_compact(
+        handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batch_count);
+}
+
+hipblasStatus_t hipblasZgemmCompact(hipblasHandle_t             handle,
+                                    hipblasOperation_t          transA,
+                                    hipblasOperation_t          transB,
+                                    const int                   m,
+                                    const int                   n,
+                                    const int                   k,
+                                    const hipblasDoubleComplex* alpha,
+                                    const hipblasDoubleComplex* A,
+                                    const int                   lda,
+                                    const hipblasDoubleComplex* B,
+                                    const int                   ldb,
+                                    const hipblasDoubleComplex* beta,
+                                    hipblasDoubleComplex*       C,
+                                    const int                   ldc,
+                                    const int                   batch_count)
+{
+    HIPBLAS_LOG_CALL(handle,
+                     transA,
+                     transB,
+                     m,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     B,
+                     ldb,
+                     beta,
+                     C,
+                     ldc,
+                     batch_count);
+    return gemm_compact(
+        handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batch_count);
+}
+
+hipblasStatus_t hipblasStrsmCompact(hipblasHandle_t    handle,
+                                    hipblasSideMode_t  side,
+                                    hipblasFillMode_t  uplo,
+                                    hipblasOperation_t transA,
+                                    hipblasDiagType_t  diag,
+                                    const int          m,
+                                    const int          n,
+                                    const float*       alpha,
+                                    const float*       A,
+                                    const int          lda,
+                                    float*             B,
+                                    const int          ldb,
+                                    const int          batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb, batch_count);
+    return trsm_compact(
+        handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb, batch_count);
+}
+
+hipblasStatus_t hipblasDtrsmCompact(hipblasHandle_t    handle,
+                                    hipblasSideMode_t  side,
+                                    hipblasFillMode_t  uplo,
+                                    hipblasOperation_t transA,
+                                    hipblasDiagType_t  diag,
+                                    const int          m,
+                                    const int          n,
+                                    const double*      alpha,
+                                    const double*      A,
+                                    const int          lda,
+                                    double*            B,
+                                    const int          ldb,
+                                    const int          batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb, batch_count);
+    return trsm_compact(
+        handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb, batch_count);
+}
+
+hipblasStatus_t hipblasCtrsmCompact(hipblasHandle_t       handle,
+                                    hipblasSideMode_t     side,
+                                    hipblasFillMode_t     uplo,
+                                    hipblasOperation_t    transA,
+                                    hipblasDiagType_t     diag,
+                                    const int             m,
+                                    const int             n,
+                                    const hipblasComplex* alpha,
+                                    const hipblasComplex* A,
+                                    const int             lda,
+                                    hipblasComplex*       B,
+                                    const int             ldb,
+                                    const int             batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb, batch_count);
+    return trsm_compact(
+        handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb, batch_count);
+}
+
+hipblasStatus_t hipblasZtrsmCompact(hipblasHandle_t             handle,
+                                    hipblasSideMode_t           side,
+                                    hipblasFillMode_t           uplo,
+                                    hipblasOperation_t          transA,
+                                    hipblasDiagType_t           diag,
+                                    const int                   m,
+                                    const int                   n,
+                                    const hipblasDoubleComplex* alpha,
+                                    const hipblasDoubleComplex* A,
+                                    const int                   lda,
+                                    hipblasDoubleComplex*       B,
+                                    const int                   ldb,
+                                    const int                   batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb, batch_count);
+    return trsm_compact(
+        handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb, batch_count);
+}
+
+hipblasStatus_t hipblasSgetrfCompact(hipblasHandle_t handle,
+                                     const int       n,
+                                     float*          A,
+                                     const int       lda,
+                                     int*            ipiv,
+                                     int*            info,
+                                     const int       batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, n, A, lda, ipiv, info, batch_count);
+    return getrf_compact(handle, n, A, lda, ipiv, info, batch_count);
+}
+
+hipblasStatus_t hipblasDgetrfCompact(hipblasHandle_t handle,
+                                     const int       n,
+                                     double*         A,
+                                     const int       lda,
+                                     int*            ipiv,
+                                     int*            info,
+                                     const int       batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, n, A, lda, ipiv, info, batch_count);
+    return getrf_compact(handle, n, A, lda, ipiv, info, batch_count);
+}
+
+hipblasStatus_t hipblasCgetrfCompact(hipblasHandle_t handle,
+                                     const int       n,
+                                     hipblasComplex* A,
+                                     const int       lda,
+                                     int*            ipiv,
+                                     int*            info,
+                                     const int       batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, n, A, lda, ipiv, info, batch_count);
+    return getrf_compact(handle, n, A, lda, ipiv, info, batch_count);
+}
+
+hipblasStatus_t hipblasZgetrfCompact(hipblasHandle_t       handle,
+                                     const int             n,
+                                     hipblasDoubleComplex* A,
+                                     const int             lda,
+                                     int*                  ipiv,
+                                     int*                  info,
+                                     const int             batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, n, A, lda, ipiv, info, batch_count);
+    return getrf_compact(handle, n, A, lda, ipiv, info, batch_count);
+}
+
+hipblasStatus_t hipblasSgetrsCompact(hipblasHandle_t          handle,
+                                     const hipblasOperation_t trans,
+                                     const int                n,
+                                     const int                nrhs,
+                                     const float*             A,
+                                     const int                lda,
+                                     const int*               ipiv,
+                                     float*                   B,
+                                     const int                ldb,
+                                     const int                batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, batch_count);
+    return getrs_compact(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, batch_count);
+}
+
+hipblasStatus_t hipblasDgetrsCompact(hipblasHandle_t          handle,
+                                     const hipblasOperation_t trans,
+                                     const int                n,
+                                     const int                nrhs,
+                                     const double*            A,
+                                     const int                lda,
+                                     const int*               ipiv,
+                                     double*                  B,
+                                     const int                ldb,
+                                     const int                batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, batch_count);
+    return getrs_compact(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, batch_count);
+}
+
+hipblasStatus_t hipblasCgetrsCompact(hipblasHandle_t          handle,
+                                     const hipblasOperation_t trans,
+                                     const int                n,
+                                     const int                nrhs,
+                                     const hipblasComplex*    A,
+                                     const int                lda,
+                                     const int*               ipiv,
+                                     hipblasComplex*          B,
+                                     const int                ldb,
+                                     const int                batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, batch_count);
+    return getrs_compact(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, batch_count);
+}
+
+hipblasStatus_t hipblasZgetrsCompact(hipblasHandle_t             handle,
+                                     const hipblasOperation_t    trans,
+                                     const int                   n,
+                                     const int                   nrhs,
+                                     const hipblasDoubleComplex* A,
+                                     const int                   lda,
+                                     const int*                  ipiv,
+                                     hipblasDoubleComplex*       B,
+                                     const int                   ldb,
+                                     const int                   batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, batch_count);
+    return getrs_compact(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, batch_count);
+}
@@ -0,0 +1,189 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "hipblas_handle.h"
+#include "hipblas_logging.h"
+#include <chrono>
+#include <condition_variable>
+#include <hip/hip_runtime_api.h>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <system_error>
+#include <thread>
+
+namespace
+{
+    // An event of the pool, with the callback it was last recorded for
+    struct completion
+    {
+        hipEvent_t                  event  = nullptr;
+        int                         device = 0;
+        hipblasCompletionCallback_t callback;
+        void*                       user_data;
+    };
+
+    // The completions move between the lists by splicing, so the polling thread never allocates
+    struct hipblas_completion_queue
+    {
+        std::chrono::microseconds poll;
+
+        std::mutex              mutex;
+        std::condition_variable submitted; // a completion or the stop request arrived
+        std::list<completion>   pending; // oldest first
+        std::list<completion>   idle;
+        bool                    stop = false;
+
+        std::thread poller;
+    };
+
+    // Queries and callbacks run outside the lock, so Notify never waits for a callback
+    void run(hipblas_completion_queue* q)
+    {
+        std::unique_lock<std::mutex> lock(q->mutex);
+        for(;;)
+        {
+            q->submitted.wait(lock, [q] { return q->stop || !q->pending.empty(); });
+            if(q->pending.empty())
+                return;
+
+            std::list<completion> polled, finished;
+            polled.splice(polled.end(), q->pending);
+            lock.unlock();
+
+            for(auto c = polled.begin(); c != polled.end();)
+            {
+                hipError_t query = hipEventQuery(c->event);
+                if(query == hipErrorNotReady)
+                {
+                    ++c;
+                    continue;
+                }
+                c->callback(c->user_data,
+                            query == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                                : HIPBLAS_STATUS_EXECUTION_FAILED);
+                finished.splice(finished.end(), polled, c++);
+            }
+
+            lock.lock();
+            q->pending.splice(q->pending.begin(), polled);
+            q->idle.splice(q->idle.end(), finished);
+            if(!q->pending.empty())
+                q->submitted.wait_for(lock, q->poll);
+        }
+    }
+}
+
+hipblasStatus_t hipblasCompletionQueueCreate(hipblasCompletionQueue_t* queue, int poll_us)
+{
+    HIPBLAS_LOG_CALL_NO_HANDLE(queue, poll_us);
+    if(queue == nullptr || poll_us < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    std::unique_ptr<hipblas_completion_queue> q(new(std::nothrow) hipblas_completion_queue);
+    if(!q)
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+    q->poll = std::chrono::microseconds(poll_us);
+    try
+    {
+        q->poller = std::thread(run, q.get());
+    }
+    catch(const std::system_error&)
+    {
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+    }
+    *queue = q.release();
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblasCompletionQueueDestroy(hipblasCompletionQueue_t queue)
+{
+    HIPBLAS_LOG_CALL_NO_HANDLE(queue);
+    hipblas_completion_queue* q = static_cast<hipblas_completion_queue*>(queue);
+    if(q == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    {
+        std::lock_guard<std::mutex> lock(q->mutex);
+        q->stop = true;
+    }
+    q->submitted.notify_one();
+    q->poller.join();
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+    for(const completion& c : q->idle)
+        if(hipEventDestroy(c.event) != hipSuccess)
+            status = HIPBLAS_STATUS_INTERNAL_ERROR;
+    delete q;
+    return status;
+}
+
+hipblasStatus_t hipblasCompletionQueueNotify(hipblasCompletionQueue_t    queue,
+                                             hipblasHandle_t             handle,
+                                             hipblasCompletionCallback_t callback,
+                                             void*                       user_data)
+{
+    HIPBLAS_LOG_CALL(handle, queue, user_data);
+    hipblas_completion_queue* q = static_cast<hipblas_completion_queue*>(queue);
+    hipblas_handle*           h = static_cast<hipblas_handle*>(handle);
+    if(q == nullptr || h == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(callback == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(h->capture_mode == HIPBLAS_CAPTURE_MODE_SAFE)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    hipStream_t     stream;
+    hipblasStatus_t status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // An idle event of the handle's device, or a new one made on it
+    std::list<completion> node;
+    {
+        std::lock_guard<std::mutex> lock(q->mutex);
+        for(auto c = q->idle.begin(); c != q->idle.end(); ++c)
+        {
+            if(c->device == h->device)
+            {
+                node.splice(node.end(), q->idle, c);
+                break;
+            }
+        }
+    }
+    if(node.empty())
+    {
+        try
+        {
+            node.emplace_back();
+        }
+        catch(const std::bad_alloc&)
+        {
+            return HIPBLAS_STATUS_ALLOC_FAILED;
+        }
+        int current;
+        if(hipGetDevice(&current) != hipSuccess || hipSetDevice(h->device) != hipSuccess)
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+        hipError_t created = hipEventCreateWithFlags(&node.front().event, hipEventDisableTiming);
+        (void)hipSetDevice(current);
+        if(created != hipSuccess)
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+        node.front().device = h->device;
+    }
+    node.front().callback  = callback;
+    node.front().user_data = user_data;
+
+    bool recorded = hipEventRecord(node.front().event, stream) == hipSuccess;
+    {
+        std::lock_guard<std::mutex> lock(q->mutex);
+        std::list<completion>&      list = recorded ? q->pending : q->idle;
+        list.splice(list.end(), node);
+    }
+    if(!recorded)
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+    q->submitted.notify_one();
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,957 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "hipblas_handle.h"
+#include "hipblas_kernels.h"
+#include "hipblas_logging.h"
+#include <algorithm>
+#include <hip/hip_runtime_api.h>
+
+namespace
+{
+    // Neither rocBLAS nor cuBLAS converts types in a copy or geam, so both backends run the same
+    // kernels on the handle's stream
+    hipblasStatus_t launch_status(hipError_t err)
+    {
+        return err == hipSuccess ? HIPBLAS_STATUS_SUCCESS : HIPBLAS_STATUS_INTERNAL_ERROR;
+    }
+
+    bool valid_operation(hipblasOperation_t op)
+    {
+        return op == HIPBLAS_OP_N || op == HIPBLAS_OP_T || op == HIPBLAS_OP_C;
+    }
+
+    // HIPBLAS_FLUSH_DENORM_MATH selects the kernels that take subnormal values as zero
+    bool flush_denorms(hipblasHandle_t handle)
+    {
+        return static_cast<hipblas_handle*>(handle)->math_mode & HIPBLAS_FLUSH_DENORM_MATH;
+    }
+
+    bool is_real(hipblasDatatype_t type)
+    {
+        return type == HIPBLAS_R_16F || type == HIPBLAS_R_16B || type == HIPBLAS_R_32F
+               || type == HIPBLAS_R_64F;
+    }
+
+    bool is_complex(hipblasDatatype_t type)
+    {
+        return type == HIPBLAS_C_32F || type == HIPBLAS_C_64F;
+    }
+
+    // Whether every type is of execution's kind
+    bool supported(hipblasDatatype_t execution, std::initializer_list<hipblasDatatype_t> types)
+    {
+        if(execution != HIPBLAS_R_32F && execution != HIPBLAS_R_64F && execution != HIPBLAS_C_32F
+           && execution != HIPBLAS_C_64F)
+            return false;
+        for(hipblasDatatype_t type : types)
+            if(is_complex(execution) ? !is_complex(type) : !is_real(type))
+                return false;
+        return true;
+    }
+
+    // The execution type of a plain conversion from a to b: double precision when either is
+    hipblasDatatype_t conversion_type(hipblasDatatype_t a, hipblasDatatype_t b)
+    {
+        if(is_complex(a) || is_complex(b))
+            return a == HIPBLAS_C_64F || b == HIPBLAS_C_64F ? HIPBLAS_C_64F : HIPBLAS_C_32F;
+        return a == HIPBLAS_R_64F || b == HIPBLAS_R_64F ? HIPBLAS_R_64F : HIPBLAS_R_32F;
+    }
+
+    hipblas_batched_operand<const void> single(const void* p)
+    {
+        return {p, 0, nullptr};
+    }
+
+    template <typename V>
+    hipblas_batched_operand<V> strided(V* p, long long stride)
+    {
+        return {p, stride, nullptr};
+    }
+
+    template <typename V>
+    hipblas_batched_operand<V> arrays(V* const* a)
+    {
+        return {nullptr, 0, a};
+    }
+
+    template <typename V>
+    bool missing(hipblas_batched_operand<V> op)
+    {
+        return op.ptr == nullptr && op.array == nullptr;
+    }
+
+    hipblasStatus_t copy_ex(hipblasHandle_t                     handle,
+                            int                                 n,
+                            hipblas_batched_operand<const void> x,
+                            hipblasDatatype_t                   x_type,
+                            int                                 incx,
+                            hipblas_batched_operand<void>       y,
+                            hipblasDatatype_t                   y_type,
+                            int                                 incy,
+                            int                                 batch_count)
+    {
+        if(handle == nullptr)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        hipblasDatatype_t execution = conversion_type(x_type, y_type);
+        if(!supported(execution, {x_type, y_type}))
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+        if(n < 0 || incx == 0 || incy == 0 || batch_count < 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(n == 0 || batch_count == 0)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(missing(x) || missing(y))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        hipStream_t     stream;
+        hipblasStatus_t status = hipblasGetStream(handle, &stream);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        bool flush = flush_denorms(handle);
+        switch(execution)
+        {
+        case HIPBLAS_R_32F:
+            return launch_status(hipblas_copy_ex_batched<float>(
+                stream, n, x, x_type, incx, y, y_type, incy, batch_count, flush));
+        case HIPBLAS_R_64F:
+            return launch_status(hipblas_copy_ex_batched<double>(
+                stream, n, x, x_type, incx, y, y_type, incy, batch_count, flush));
+        case HIPBLAS_C_32F:
+            return launch_status(hipblas_copy_ex_batched<hipblasComplex>(
+                stream, n, x, x_type, incx, y, y_type, incy, batch_count, flush));
+        default:
+            return launch_status(hipblas_copy_ex_batched<hipblasDoubleComplex>(
+                stream, n, x, x_type, incx, y, y_type, incy, batch_count, flush));
+        }
+    }
+
+    template <typename T>
+    hipError_t launch_geam_ex(hipblasHandle_t                     handle,
+                              hipStream_t                         stream,
+                              hipblasOperation_t                  transA,
+                              hipblasOperation_t                  transB,
+                              int                                 m,
+                              int                                 n,
+                              const void*                         alpha,
+                              hipblas_batched_operand<const void> A,
+                              hipblasDatatype_t                   a_type,
+                              int                                 lda,
+                              const void*                         beta,
+                              hipblas_batched_operand<const void> B,
+                              hipblasDatatype_t                   b_type,
+                              int                                 ldb,
+                              hipblas_batched_operand<void>       C,
+                              hipblasDatatype_t                   c_type,
+                              int                                 ldc,
+                              bool                                device_scalars,
+                              int                                 batch_count)
+    {
+        return hipblas_geam_ex_batched(stream,
+                                       transA,
+                                       transB,
+                                       m,
+                                       n,
+                                       static_cast<const T*>(alpha),
+                                       static_cast<const T*>(beta),
+                                       device_scalars,
+                                       device_scalars ? hipblas_scalar_stride(handle) : 0,
+                                       A,
+                                       a_type,
+                                       lda,
+                                       B,
+                                       b_type,
+                                       ldb,
+                                       C,
+                                       c_type,
+                                       ldc,
+                                       batch_count,
+                                       flush_denorms(handle));
+    }
+
+    bool host_zero(hipblasDatatype_t execution, const void* scalar)
+    {
+        switch(execution)
+        {
+        case HIPBLAS_R_32F:
+            return *static_cast<const float*>(scalar) == 0;
+        case HIPBLAS_R_64F:
+            return *static_cast<const double*>(scalar) == 0;
+        case HIPBLAS_C_32F:
+            return *static_cast<const hipblasComplex*>(scalar) == hipblasComplex(0);
+        default:
+            return *static_cast<const hipblasDoubleComplex*>(scalar) == hipblasDoubleComplex(0);
+        }
+    }
+
+    // device_scalars is false for transposeEx, whose scalars are always on the host
+    hipblasStatus_t geam_ex(hipblasHandle_t                     handle,
+                            hipblasOperation_t                  transA,
+                            hipblasOperation_t                  transB,
+                            int                                 m,
+                            int                                 n,
+                            const void*                         alpha,
+                            hipblas_batched_operand<const void> A,
+                            hipblasDatatype_t                   a_type,
+                            int                                 lda,
+                            const void*                         beta,
+                            hipblas_batched_operand<const void> B,
+                            hipblasDatatype_t                   b_type,
+                            int                                 ldb,
+                            hipblas_batched_operand<void>       C,
+                            hipblasDatatype_t                   c_type,
+                            int                                 ldc,
+                            int                                 batch_count,
+                            hipblasDatatype_t                   execution,
+                            bool                                device_scalars)
+    {
+        if(handle == nullptr)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if(!valid_operation(transA) || !valid_operation(transB))
+            return HIPBLAS_STATUS_INVALID_ENUM;
+        if(!supported(execution, {a_type, b_type, c_type}))
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+        int a_rows = transA == HIPBLAS_OP_N ? m : n;
+        int b_rows = transB == HIPBLAS_OP_N ? m : n;
+        if(m < 0 || n < 0 || lda < std::max(1, a_rows) || ldb < std::max(1, b_rows)
+           || ldc < std::max(1, m) || batch_count < 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(m == 0 || n == 0 || batch_count == 0)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(alpha == nullptr || beta == nullptr || missing(C))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        // A host zero scalar lets its operand be null
+        if(device_scalars ? missing(A) || missing(B)
+                          : (missing(A) && !host_zero(execution, alpha))
+                                || (missing(B) && !host_zero(execution, beta)))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        hipStream_t     stream;
+        hipblasStatus_t status = hipblasGetStream(handle, &stream);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        auto launch = execution == HIPBLAS_R_32F   ? launch_geam_ex<float>
+                      : execution == HIPBLAS_R_64F ? launch_geam_ex<double>
+                      : execution == HIPBLAS_C_32F ? launch_geam_ex<hipblasComplex>
+                                                   : launch_geam_ex<hipblasDoubleComplex>;
+        return launch_status(launch(handle,
+                                    stream,
+                                    transA,
+                                    transB,
+                                    m,
+                                    n,
+                                    alpha,
+                                    A,
+                                    a_type,
+                                    lda,
+                                    beta,
+                                    B,
+                                    b_type,
+                                    ldb,
+                                    C,
+                                    c_type,
+                                    ldc,
+                                    device_scalars,
+                                    batch_count));
+    }
+
+    bool device_pointer_mode(hipblasHandle_t handle)
+    {
+        return handle
+               && static_cast<hipblas_handle*>(handle)->pointer_mode == HIPBLAS_POINTER_MODE_DEVICE;
+    }
+
+    // B = op(A) as geam_ex with host scalars 1 and 0 of execution type T. op(B) is untransposed
+    // and never read, so its leading dimension only has to pass the checks
+    template <typename T>
+    hipblasStatus_t transpose_ex(hipblasHandle_t                     handle,
+                                 hipblasOperation_t                  trans,
+                                 int                                 m,
+                                 int                                 n,
+                                 hipblas_batched_operand<const void> A,
+                                 hipblasDatatype_t                   a_type,
+                                 int                                 lda,
+                                 hipblas_batched_operand<void>       B,
+                                 hipblasDatatype_t                   b_type,
+                                 int                                 ldb,
+                                 int                                 batch_count,
+                                 hipblasDatatype_t                   execution)
+    {
+        static const T one  = 1;
+        static const T zero = 0;
+        return geam_ex(handle,
+                       trans,
+                       HIPBLAS_OP_N,
+                       m,
+                       n,
+                       &one,
+                       A,
+                       a_type,
+                       lda,
+                       &zero,
+                       single(nullptr),
+                       b_type,
+                       ldb,
+                       B,
+                       b_type,
+                       ldb,
+                       batch_count,
+                       execution,
+                       false);
+    }
+
+    hipblasStatus_t transpose_ex(hipblasHandle_t                     handle,
+                                 hipblasOperation_t                  trans,
+                                 int                                 m,
+                                 int                                 n,
+                                 hipblas_batched_operand<const void> A,
+                                 hipblasDatatype_t                   a_type,
+                                 int                                 lda,
+                                 hipblas_batched_operand<void>       B,
+                                 hipblasDatatype_t                   b_type,
+                                 int                                 ldb,
+                                 int                                 batch_count)
+    {
+        hipblasDatatype_t execution = conversion_type(a_type, b_type);
+        switch(execution)
+        {
+        case HIPBLAS_R_32F:
+            return transpose_ex<float>(
+                handle, trans, m, n, A, a_type, lda, B, b_type, ldb, batch_count, execution);
+        case HIPBLAS_R_64F:
+            return transpose_ex<double>(
+                handle, trans, m, n, A, a_type, lda, B, b_type, ldb, batch_count, execution);
+        case HIPBLAS_C_32F:
+            return transpose_ex<hipblasComplex>(
+                handle, trans, m, n, A, a_type, lda, B, b_type, ldb, batch_count, execution);
+        default:
+            return transpose_ex<hipblasDoubleComplex>(
+                handle, trans, m, n, A, a_type, lda, B, b_type, ldb, batch_count, execution);
+        }
+    }
+
+    // Same types move as raw bytes, 16 at a time where aligned; others convert as copyEx does
+    hipblasStatus_t lacpy_ex(hipblasHandle_t                     handle,
+                             hipblasFillMode_t                   uplo,
+                             int                                 m,
+                             int                                 n,
+                             hipblas_batched_operand<const void> A,
+                             hipblasDatatype_t                   a_type,
+                             int                                 lda,
+                             hipblas_batched_operand<void>       B,
+                             hipblasDatatype_t                   b_type,
+                             int                                 ldb,
+                             int                                 batch_count)
+    {
+        if(handle == nullptr)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if(uplo != HIPBLAS_FILL_MODE_UPPER && uplo != HIPBLAS_FILL_MODE_LOWER
+           && uplo != HIPBLAS_FILL_MODE_FULL)
+            return HIPBLAS_STATUS_INVALID_ENUM;
+        hipblasDatatype_t execution = conversion_type(a_type, b_type);
+        if(!supported(execution, {a_type, b_type}))
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+        if(m < 0 || n < 0 || lda < std::max(1, m) || ldb < std::max(1, m) || batch_count < 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(m == 0 || n == 0 || batch_count == 0)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(missing(A) || missing(B))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        hipStream_t     stream;
+        hipblasStatus_t status = hipblasGetStream(handle, &stream);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        bool flush = flush_denorms(handle);
+        if(a_type == b_type && !flush)
+            return launch_status(hipblas_lacpy_batched(
+                stream, uplo, m, n, hipblas_datatype_size(a_type), A, lda, B, ldb, batch_count));
+
+        auto launch = execution == HIPBLAS_R_32F   ? hipblas_lacpy_ex_batched<float>
+                      : execution == HIPBLAS_R_64F ? hipblas_lacpy_ex_batched<double>
+                      : execution == HIPBLAS_C_32F ? hipblas_lacpy_ex_batched<hipblasComplex>
+                                                   : hipblas_lacpy_ex_batched<hipblasDoubleComplex>;
+        return launch_status(
+            launch(stream, uplo, m, n, A, a_type, lda, B, b_type, ldb, batch_count, flush));
+    }
+
+    // The vbatched level-1 ex routines, all one axpby
+    enum class vbatched_op
+    {
+        axpy,
+        axpby,
+        scal,
+        copy
+    };
+
+    // scal scales y by its alpha, which is axpby's beta without x; axpy's beta is 1, and copy's
+    // alpha and beta are 1 and 0. User scalars follow the pointer mode, as for geamEx
+    template <typename T>
+    hipError_t launch_axpby_vbatched(hipblasHandle_t    handle,
+                                     hipStream_t        stream,
+                                     vbatched_op        op,
+                                     const int*         n,
+                                     const void*        alpha,
+                                     const void* const* x,
+                                     hipblasDatatype_t  x_type,
+                                     const int*         incx,
+                                     const void*        beta,
+                                     void* const*       y,
+                                     hipblasDatatype_t  y_type,
+                                     const int*         incy,
+                                     int                batch_count)
+    {
+        bool     device = device_pointer_mode(handle);
+        const T* a      = static_cast<const T*>(op == vbatched_op::scal ? nullptr : alpha);
+        const T* c      = static_cast<const T*>(op == vbatched_op::scal ? alpha : beta);
+        T        fixed  = op == vbatched_op::axpy ? T(1) : T(0);
+        return hipblas_axpby_vbatched_ex<T>(stream,
+                                            n,
+                                            a && !device ? *a : T(1),
+                                            device ? a : nullptr,
+                                            c && !device ? *c : fixed,
+                                            device ? c : nullptr,
+                                            device ? hipblas_scalar_stride(handle) : 0,
+                                            x,
+                                            x_type,
+                                            incx,
+                                            y,
+                                            y_type,
+                                            incy,
+                                            batch_count,
+                                            flush_denorms(handle));
+    }
+
+    // The sizes stay on the device as for gemv_vbatched, so an entry they make invalid is
+    // skipped there; both backends run the same kernel, since neither takes per-batch sizes
+    hipblasStatus_t axpby_vbatched_ex(hipblasHandle_t    handle,
+                                      vbatched_op        op,
+                                      const int*         n,
+                                      const void*        alpha,
+                                      const void* const* x,
+                                      hipblasDatatype_t  x_type,
+                                      const int*         incx,
+                                      const void*        beta,
+                                      void* const*       y,
+                                      hipblasDatatype_t  y_type,
+                                      const int*         incy,
+                                      int                batch_count,
+                                      hipblasDatatype_t  execution)
+    {
+        if(handle == nullptr)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        bool scal = op == vbatched_op::scal;
+        if(!supported(execution, {scal ? y_type : x_type, y_type}))
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+        if(batch_count < 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(batch_count == 0)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(!n || !y || !incy || (!scal && (!x || !incx)) || (op != vbatched_op::copy && !alpha)
+           || (op == vbatched_op::axpby && !beta))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        hipStream_t     stream;
+        hipblasStatus_t status = hipblasGetStream(handle, &stream);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        auto launch = execution == HIPBLAS_R_32F   ? launch_axpby_vbatched<float>
+                      : execution == HIPBLAS_R_64F ? launch_axpby_vbatched<double>
+                      : execution == HIPBLAS_C_32F ? launch_axpby_vbatched<hipblasComplex>
+                                                   : launch_axpby_vbatched<hipblasDoubleComplex>;
+        return launch_status(launch(handle,
+                                    stream,
+                                    op,
+                                    n,
+                                    alpha,
+                                    x,
+                                    x_type,
+                                    incx,
+                                    beta,
+                                    y,
+                                    y_type,
+                                    incy,
+                                    batch_count));
+    }
+}
+
+// copy_ex
+hipblasStatus_t hipblasCopyEx(hipblasHandle_t   handle,
+                              int               n,
+                              const void*       x,
+                              hipblasDatatype_t x_type,
+                              int               incx,
+                              void*             y,
+                              hipblasDatatype_t y_type,
+                              int               incy)
+{
+    HIPBLAS_LOG_CALL(handle, n, x, x_type, incx, y, y_type, incy);
+    return copy_ex(handle, n, single(x), x_type, incx, strided(y, 0), y_type, incy, 1);
+}
+
+hipblasStatus_t hipblasCopyBatchedEx(hipblasHandle_t   handle,
+                                     int               n,
+                                     const void* const x[],
+                                     hipblasDatatype_t x_type,
+                                     int               incx,
+                                     void* const       y[],
+                                     hipblasDatatype_t y_type,
+                                     int               incy,
+                                     int               batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, n, x, x_type, incx, y, y_type, incy, batch_count);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, x, y);
+    return copy_ex(handle, n, arrays(x), x_type, incx, arrays(y), y_type, incy, batch_count);
+}
+
+hipblasStatus_t hipblasCopyStridedBatchedEx(hipblasHandle_t   handle,
+                                            int               n,
+                                            const void*       x,
+                                            hipblasDatatype_t x_type,
+                                            int               incx,
+                                            long long         stride_x,
+                                            void*             y,
+                                            hipblasDatatype_t y_type,
+                                            int               incy,
+                                            long long         stride_y,
+                                            int               batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, n, x, x_type, incx, stride_x, y, y_type, incy, stride_y, batch_count);
+    return copy_ex(handle,
+                   n,
+                   strided(x, stride_x),
+                   x_type,
+                   incx,
+                   strided(y, stride_y),
+                   y_type,
+                   incy,
+                   batch_count);
+}
+
+// geam_ex
+hipblasStatus_t hipblasGeamEx(hipblasHandle_t    handle,
+                              hipblasOperation_t transA,
+                              hipblasOperation_t transB,
+                              int                m,
+                              int                n,
+                              const void*        alpha,
+                              const void*        A,
+                              hipblasDatatype_t  a_type,
+                              int                lda,
+                              const void*        beta,
+                              const void*        B,
+                              hipblasDatatype_t  b_type,
+                              int                ldb,
+                              void*              C,
+                              hipblasDatatype_t  c_type,
+                              int                ldc,
+                              hipblasDatatype_t  execution_type)
+{
+    HIPBLAS_LOG_CALL(handle,
+                     transA,
+                     transB,
+                     m,
+                     n,
+                     alpha,
+                     A,
+                     a_type,
+                     lda,
+                     beta,
+                     B,
+                     b_type,
+                     ldb,
+                     C,
+                     c_type,
+                     ldc,
+                     execution_type);
+    return geam_ex(handle,
+                   transA,
+                   transB,
+                   m,
+                   n,
+                   alpha,
+                   single(A),
+                   a_type,
+                   lda,
+                   beta,
+                   single(B),
+                   b_type,
+                   ldb,
+                   strided(C, 0),
+                   c_type,
+                   ldc,
+                   1,
+                   execution_type,
+                   device_pointer_mode(handle));
+}
+
+hipblasStatus_t hipblasGeamBatchedEx(hipblasHandle_t    handle,
+                                     hipblasOperation_t transA,
+                                     hipblasOperation_t transB,
+                                     int                m,
+                                     int                n,
+                                     const void*        alpha,
+                                     const void* const  A[],
+                                     hipblasDatatype_t  a_type,
+                                     int                lda,
+                                     const void*        beta,
+                                     const void* const  B[],
+                                     hipblasDatatype_t  b_type,
+                                     int                ldb,
+                                     void* const        C[],
+                                     hipblasDatatype_t  c_type,
+                                     int                ldc,
+                                     int                batch_count,
+                                     hipblasDatatype_t  execution_type)
+{
+    HIPBLAS_LOG_CALL(handle,
+                     transA,
+                     transB,
+                     m,
+                     n,
+                     alpha,
+                     A,
+                     a_type,
+                     lda,
+                     beta,
+                     B,
+                     b_type,
+                     ldb,
+                     C,
+                     c_type,
+                     ldc,
+                     batch_count,
+                     execution_type);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, A, B, C);
+    return geam_ex(handle,
+                   transA,
+                   transB,
+                   m,
+                   n,
+                   alpha,
+                   arrays(A),
+                   a_type,
+                   lda,
+                   beta,
+                   arrays(B),
+                   b_type,
+                   ldb,
+                   arrays(C),
+                   c_type,
+                   ldc,
+                   batch_count,
+                   execution_type,
+                   device_pointer_mode(handle));
+}
+
+hipblasStatus_t hipblasGeamStridedBatchedEx(hipblasHandle_t    handle,
+                                            hipblasOperation_t transA,
+                                            hipblasOperation_t transB,
+                                            int                m,
+                                            int                n,
+                                            const void*        alpha,
+                                            const void*        A,
+                                            hipblasDatatype_t  a_type,
+                                            int                lda,
+                                            long long          strideA,
+                                            const void*        beta,
+                                            const void*        B,
+                                            hipblasDatatype_t  b_type,
+                                            int                ldb,
+                                            long long          strideB,
+                                            void*              C,
+                                            hipblasDatatype_t  c_type,
+                                            int                ldc,
+                                            long long          strideC,
+                                            int                batch_count,
+                                            hipblasDatatype_t  execution_type)
+{
+    HIPBLAS_LOG_CALL(handle,
+                     transA,
+                     transB,
+                     m,
+                     n,
+                     alpha,
+                     A,
+                     a_type,
+                     lda,
+                     strideA,
+                     beta,
+                     B,
+                     b_type,
+                     ldb,
+                     strideB,
+                     C,
+                     c_type,
+                     ldc,
+                     strideC,
+                     batch_count,
+                     execution_type);
+    return geam_ex(handle,
+                   transA,
+                   transB,
+                   m,
+                   n,
+                   alpha,
+                   strided(A, strideA),
+                   a_type,
+                   lda,
+                   beta,
+                   strided(B, strideB),
+                   b_type,
+                   ldb,
+                   strided(C, strideC),
+                   c_type,
+                   ldc,
+                   batch_count,
+                   execution_type,
+                   device_pointer_mode(handle));
+}
+
+// transpose_ex
+hipblasStatus_t hipblasTransposeEx(hipblasHandle_t    handle,
+                                   hipblasOperation_t trans,
+                                   int                m,
+                                   int                n,
+                                   const void*        A,
+                                   hipblasDatatype_t  a_type,
+                                   int                lda,
+                                   void*              B,
+                                   hipblasDatatype_t  b_type,
+                                   int                ldb)
+{
+    HIPBLAS_LOG_CALL(handle, trans, m, n, A, a_type, lda, B, b_type, ldb);
+    return transpose_ex(
+        handle, trans, m, n, single(A), a_type, lda, strided(B, 0), b_type, ldb, 1);
+}
+
+hipblasStatus_t hipblasTransposeBatchedEx(hipblasHandle_t    handle,
+                                          hipblasOperation_t trans,
+                                          int                m,
+                                          int                n,
+                                          const void* const  A[],
+                                          hipblasDatatype_t  a_type,
+                                          int                lda,
+                                          void* const        B[],
+                                          hipblasDatatype_t  b_type,
+                                          int                ldb,
+                                          int                batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, trans, m, n, A, a_type, lda, B, b_type, ldb, batch_count);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, A, B);
+    return transpose_ex(
+        handle, trans, m, n, arrays(A), a_type, lda, arrays(B), b_type, ldb, batch_count);
+}
+
+hipblasStatus_t hipblasTransposeStridedBatchedEx(hipblasHandle_t    handle,
+                                                 hipblasOperation_t trans,
+                                                 int                m,
+                                                 int                n,
+                                                 const void*        A,
+                                                 hipblasDatatype_t  a_type,
+                                                 int                lda,
+                                                 long long          strideA,
+                                                 void*              B,
+                                                 hipblasDatatype_t  b_type,
+                                                 int                ldb,
+                                                 long long          strideB,
+                                                 int                batch_count)
+{
+    HIPBLAS_LOG_CALL(
+        handle, trans, m, n, A, a_type, lda, strideA, B, b_type, ldb, strideB, batch_count);
+    return transpose_ex(handle,
+                        trans,
+                        m,
+                        n,
+                        strided(A, strideA),
+                        a_type,
+                        lda,
+                        strided(B, strideB),
+                        b_type,
+                        ldb,
+                        batch_count);
+}
+
+// lacpy_ex
+hipblasStatus_t hipblasLacpyEx(hipblasHandle_t   handle,
+                               hipblasFillMode_t uplo,
+                               int               m,
+                               int               n,
+                               const void*       A,
+                               hipblasDatatype_t a_type,
+                               int               lda,
+                               void*             B,
+                               hipblasDatatype_t b_type,
+                               int               ldb)
+{
+    HIPBLAS_LOG_CALL(handle, uplo, m, n, A, a_type, lda, B, b_type, ldb);
+    return lacpy_ex(handle, uplo, m, n, single(A), a_type, lda, strided(B, 0), b_type, ldb, 1);
+}
+
+hipblasStatus_t hipblasLacpyBatchedEx(hipblasHandle_t   handle,
+                                      hipblasFillMode_t uplo,
+                                      int               m,
+                                      int               n,
+                                      const void* const A[],
+                                      hipblasDatatype_t a_type,
+                                      int               lda,
+                                      void* const       B[],
+                                      hipblasDatatype_t b_type,
+                                      int               ldb,
+                                      int               batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, uplo, m, n, A, a_type, lda, B, b_type, ldb, batch_count);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, A, B);
+    return lacpy_ex(
+        handle, uplo, m, n, arrays(A), a_type, lda, arrays(B), b_type, ldb, batch_count);
+}
+
+hipblasStatus_t hipblasLacpyStridedBatchedEx(hipblasHandle_t   handle,
+                                             hipblasFillMode_t uplo,
+                                             int               m,
+                                             int               n,
+                                             const void*       A,
+                                             hipblasDatatype_t a_type,
+                                             int               lda,
+                                             long long         strideA,
+                                             void*             B,
+                                             hipblasDatatype_t b_type,
+                                             int               ldb,
+                                             long long         strideB,
+                                             int               batch_count)
+{
+    HIPBLAS_LOG_CALL(
+        handle, uplo, m, n, A, a_type, lda, strideA, B, b_type, ldb, strideB, batch_count);
+    return lacpy_ex(handle,
+                    uplo,
+                    m,
+                    n,
+                    strided(A, strideA),
+                    a_type,
+                    lda,
+                    strided(B, strideB),
+                    b_type,
+                    ldb,
+                    batch_count);
+}
+
+// vbatched level-1 ex
+hipblasStatus_t hipblasAxpyVbatchedEx(hipblasHandle_t   handle,
+                                      const int         n[],
+                                      const void*       alpha,
+                                      const void* const x[],
+                                      hipblasDatatype_t x_type,
+                                      const int         incx[],
+                                      void* const       y[],
+                                      hipblasDatatype_t y_type,
+                                      const int         incy[],
+                                      int               batch_count,
+                                      hipblasDatatype_t execution_type)
+{
+    HIPBLAS_LOG_CALL(
+        handle, n, alpha, x, x_type, incx, y, y_type, incy, batch_count, execution_type);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, x, y);
+    return axpby_vbatched_ex(handle,
+                             vbatched_op::axpy,
+                             n,
+                             alpha,
+                             x,
+                             x_type,
+                             incx,
+                             nullptr,
+                             y,
+                             y_type,
+                             incy,
+                             batch_count,
+                             execution_type);
+}
+
+hipblasStatus_t hipblasAxpbyVbatchedEx(hipblasHandle_t   handle,
+                                       const int         n[],
+                                       const void*       alpha,
+                                       const void* const x[],
+                                       hipblasDatatype_t x_type,
+                                       const int         incx[],
+                                       const void*       beta,
+                                       void* const       y[],
+                                       hipblasDatatype_t y_type,
+                                       const int         incy[],
+                                       int               batch_count,
+                                       hipblasDatatype_t execution_type)
+{
+    HIPBLAS_LOG_CALL(
+        handle, n, alpha, x, x_type, incx, beta, y, y_type, incy, batch_count, execution_type);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, x, y);
+    return axpby_vbatched_ex(handle,
+                             vbatched_op::axpby,
+                             n,
+                             alpha,
+                             x,
+                             x_type,
+                             incx,
+                             beta,
+                             y,
+                             y_type,
+                             incy,
+                             batch_count,
+                             execution_type);
+}
+
+hipblasStatus_t hipblasScalVbatchedEx(hipblasHandle_t   handle,
+                                      const int         n[],
+                                      const void*       alpha,
+                                      void* const       x[],
+                                      hipblasDatatype_t x_type,
+                                      const int         incx[],
+                                      int               batch_count,
+                                      hipblasDatatype_t execution_type)
+{
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, x_type, incx, batch_count, execution_type);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, x);
+    return axpby_vbatched_ex(handle,
+                             vbatched_op::scal,
+                             n,
+                             alpha,
+                             nullptr,
+                             x_type,
+                             nullptr,
+                             nullptr,
+                             x,
+                             x_type,
+                             incx,
+                             batch_count,
+                             execution_type);
+}
+
+hipblasStatus_t hipblasCopyVbatchedEx(hipblasHandle_t   handle,
+                                      const int         n[],
+                                      const void* const x[],
+                                      hipblasDatatype_t x_type,
+                                      const int         incx[],
+                                      void* const       y[],
+                                      hipblasDatatype_t y_type,
+                                      const int         incy[],
+                                      int               batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, n, x, x_type, incx, y, y_type, incy, batch_count);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, x, y);
+    return axpby_vbatched_ex(handle,
+                             vbatched_op::copy,
+                             n,
+                             nullptr,
+                             x,
+                             x_type,
+                             incx,
+                             nullptr,
+                             y,
+                             y_type,
+                             incy,
+                             batch_count,
+                             conversion_type(x_type, y_type));
+}
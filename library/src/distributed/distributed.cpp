@@ -0,0 +1,497 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipblas_distributed.h"
+#include <algorithm>
+#include <hip/hip_runtime_api.h>
+#include <limits>
+
+namespace
+{
+    struct dist_grid
+    {
+        hipblasHandle_t handle;
+        ncclComm_t      row_comm;
+        ncclComm_t      col_comm;
+        int             nprow;
+        int             npcol;
+        int             myrow;
+        int             mycol;
+
+        // Broadcasts run on comm_stream. Panel set i is ready once ready[i] has run there, and
+        // free again once used[i], queued after the gemm reading it, has run on the handle's
+        hipStream_t comm_stream = nullptr;
+        hipEvent_t  start       = nullptr;
+        hipEvent_t  ready[2]    = {};
+        hipEvent_t  used[2]     = {};
+        void*       a_panel[2]  = {};
+        void*       b_panel[2]  = {};
+        size_t      a_capacity  = 0;
+        size_t      b_capacity  = 0;
+    };
+
+    hipblasStatus_t hip_status(hipError_t err)
+    {
+        return err == hipSuccess ? HIPBLAS_STATUS_SUCCESS : HIPBLAS_STATUS_INTERNAL_ERROR;
+    }
+
+    hipblasStatus_t nccl_status(ncclResult_t result)
+    {
+        return result == ncclSuccess ? HIPBLAS_STATUS_SUCCESS : HIPBLAS_STATUS_INTERNAL_ERROR;
+    }
+
+    void release(dist_grid* g)
+    {
+        if(g->comm_stream)
+            (void)hipStreamSynchronize(g->comm_stream);
+        for(int i = 0; i < 2; i++)
+        {
+            if(g->a_panel[i])
+                (void)hipFree(g->a_panel[i]);
+            if(g->b_panel[i])
+                (void)hipFree(g->b_panel[i]);
+            if(g->ready[i])
+                (void)hipEventDestroy(g->ready[i]);
+            if(g->used[i])
+                (void)hipEventDestroy(g->used[i]);
+        }
+        if(g->start)
+            (void)hipEventDestroy(g->start);
+        if(g->comm_stream)
+            (void)hipStreamDestroy(g->comm_stream);
+        delete g;
+    }
+
+    // Grows both panel sets; hipFree waits for the device, so the work of earlier calls still
+    // reading the old panels is safe
+    hipblasStatus_t reserve(dist_grid* g, size_t a_bytes, size_t b_bytes)
+    {
+        for(int i = 0; i < 2; i++)
+        {
+            if(a_bytes > g->a_capacity)
+            {
+                if(g->a_panel[i])
+                    (void)hipFree(g->a_panel[i]);
+                g->a_panel[i] = nullptr;
+                if(hipMalloc(&g->a_panel[i], a_bytes) != hipSuccess)
+                {
+                    g->a_panel[i] = nullptr;
+                    g->a_capacity = 0;
+                    return HIPBLAS_STATUS_ALLOC_FAILED;
+                }
+            }
+            if(b_bytes > g->b_capacity)
+            {
+                if(g->b_panel[i])
+                    (void)hipFree(g->b_panel[i]);
+                g->b_panel[i] = nullptr;
+                if(hipMalloc(&g->b_panel[i], b_bytes) != hipSuccess)
+                {
+                    g->b_panel[i] = nullptr;
+                    g->b_capacity = 0;
+                    return HIPBLAS_STATUS_ALLOC_FAILED;
+                }
+            }
+        }
+        g->a_capacity = std::max(g->a_capacity, a_bytes);
+        g->b_capacity = std::max(g->b_capacity, b_bytes);
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Rows (or columns) of n, in blocks of nb dealt over nprocs, that land on process iproc
+    int64_t numroc(int64_t n, int nb, int iproc, int nprocs)
+    {
+        int64_t blocks = n / nb;
+        int64_t local  = blocks / nprocs * nb;
+        int64_t extra  = blocks % nprocs;
+        if(iproc < extra)
+            local += nb;
+        else if(iproc == extra)
+            local += n % nb;
+        return local;
+    }
+
+    bool valid_desc(const hipblasDistDesc_t* d)
+    {
+        return d && d->m >= 0 && d->n >= 0 && d->mb > 0 && d->nb > 0;
+    }
+
+    bool fits_int(int64_t v)
+    {
+        return v <= std::numeric_limits<int>::max();
+    }
+
+    template <typename T>
+    bool is_zero(const T& a)
+    {
+        return a == T(0);
+    }
+
+    // C = beta C on the local array, for the calls with no SUMMA steps
+    template <typename T, typename Fgeam>
+    hipblasStatus_t scale_local(Fgeam           geam,
+                                hipblasHandle_t handle,
+                                hipStream_t     stream,
+                                int             rows,
+                                int             cols,
+                                const T*        beta,
+                                T*              C,
+                                int             ldc)
+    {
+        if(*beta == T(1))
+            return HIPBLAS_STATUS_SUCCESS;
+        if(is_zero(*beta))
+            return hip_status(
+                hipMemset2DAsync(C, sizeof(T) * ldc, 0, sizeof(T) * rows, cols, stream));
+        T zero = T(0);
+        return geam(
+            handle, HIPBLAS_OP_N, HIPBLAS_OP_N, rows, cols, beta, C, ldc, &zero, C, ldc, C, ldc);
+    }
+
+    template <typename T, typename Fgemm, typename Fgeam>
+    hipblasStatus_t summa(Fgemm                    gemm,
+                          Fgeam                    geam,
+                          hipblasDistGrid_t        grid,
+                          hipblasOperation_t       transa,
+                          hipblasOperation_t       transb,
+                          const T*                 alpha,
+                          const T*                 A,
+                          const hipblasDistDesc_t* descA,
+                          const T*                 B,
+                          const hipblasDistDesc_t* descB,
+                          const T*                 beta,
+                          T*                       C,
+                          const hipblasDistDesc_t* descC)
+    {
+        if(grid == nullptr)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        for(hipblasOperation_t trans : {transa, transb})
+        {
+            if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_T && trans != HIPBLAS_OP_C)
+                return HIPBLAS_STATUS_INVALID_ENUM;
+            if(trans != HIPBLAS_OP_N)
+                return HIPBLAS_STATUS_NOT_SUPPORTED;
+        }
+        if(!valid_desc(descA) || !valid_desc(descB) || !valid_desc(descC) || alpha == nullptr
+           || beta == nullptr)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        dist_grid* g = static_cast<dist_grid*>(grid);
+        int64_t    m = descC->m;
+        int64_t    n = descC->n;
+        int64_t    k = descA->n;
+        int        w = descA->nb;
+        if(descA->m != m || descB->m != k || descB->n != n || descA->mb != descC->mb
+           || descB->nb != descC->nb || descB->mb != w)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        int64_t rows   = numroc(m, descC->mb, g->myrow, g->nprow);
+        int64_t cols   = numroc(n, descC->nb, g->mycol, g->npcol);
+        int64_t a_cols = numroc(k, w, g->mycol, g->npcol);
+        int64_t b_rows = numroc(k, w, g->myrow, g->nprow);
+        if(descA->ld < std::max<int64_t>(1, rows) || descB->ld < std::max<int64_t>(1, b_rows)
+           || descC->ld < std::max<int64_t>(1, rows))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(m == 0 || n == 0)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(!fits_int(rows) || !fits_int(cols) || !fits_int(descC->ld))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if((rows && cols && C == nullptr) || (rows && a_cols && A == nullptr)
+           || (b_rows && cols && B == nullptr))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        hipStream_t          stream;
+        hipblasPointerMode_t mode;
+        hipblasStatus_t      status = hipblasGetStream(g->handle, &stream);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblasGetPointerMode(g->handle, &mode);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblasSetPointerMode(g->handle, HIPBLAS_POINTER_MODE_HOST);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        // Every process runs every step, for the broadcasts, whether or not it holds any of C
+        int64_t steps = k == 0 || is_zero(*alpha) ? 0 : (k - 1) / w + 1;
+        if(steps == 0 && rows && cols)
+            status = scale_local(geam, g->handle, stream, rows, cols, beta, C, descC->ld);
+        if(steps)
+            status = reserve(g, sizeof(T) * rows * w, sizeof(T) * w * cols);
+
+        // The broadcasts read A and B as the work queued on the handle's stream leaves them
+        if(steps && status == HIPBLAS_STATUS_SUCCESS)
+            status = hip_status(hipEventRecord(g->start, stream));
+        if(steps && status == HIPBLAS_STATUS_SUCCESS)
+            status = hip_status(hipStreamWaitEvent(g->comm_stream, g->start, 0));
+
+        // Step p broadcasts panel p into set p % 2 while the gemm of step p - 1 reads the other
+        T one = T(1);
+        for(int64_t p = 0; p < steps && status == HIPBLAS_STATUS_SUCCESS; p++)
+        {
+            int     i        = p % 2;
+            int     depth    = int(std::min<int64_t>(w, k - p * w));
+            int     root_col = p % g->npcol;
+            int     root_row = p % g->nprow;
+            size_t  a_bytes  = sizeof(T) * rows * depth;
+            size_t  b_bytes  = sizeof(T) * depth * cols;
+            int64_t local_c  = p / g->npcol * w;
+            int64_t local_r  = p / g->nprow * w;
+
+            if(p >= 2)
+                status = hip_status(hipStreamWaitEvent(g->comm_stream, g->used[i], 0));
+            if(status == HIPBLAS_STATUS_SUCCESS && g->mycol == root_col && rows)
+                status = hip_status(hipMemcpy2DAsync(g->a_panel[i],
+                                                     sizeof(T) * rows,
+                                                     A + local_c * descA->ld,
+                                                     sizeof(T) * descA->ld,
+                                                     sizeof(T) * rows,
+                                                     depth,
+                                                     hipMemcpyDeviceToDevice,
+                                                     g->comm_stream));
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = nccl_status(ncclBroadcast(g->a_panel[i],
+                                                   g->a_panel[i],
+                                                   a_bytes,
+                                                   ncclChar,
+                                                   root_col,
+                                                   g->row_comm,
+                                                   g->comm_stream));
+            if(status == HIPBLAS_STATUS_SUCCESS && g->myrow == root_row && cols)
+                status = hip_status(hipMemcpy2DAsync(g->b_panel[i],
+                                                     sizeof(T) * depth,
+                                                     B + local_r,
+                                                     sizeof(T) * descB->ld,
+                                                     sizeof(T) * depth,
+                                                     cols,
+                                                     hipMemcpyDeviceToDevice,
+                                                     g->comm_stream));
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = nccl_status(ncclBroadcast(g->b_panel[i],
+                                                   g->b_panel[i],
+                                                   b_bytes,
+                                                   ncclChar,
+                                                   root_row,
+                                                   g->col_comm,
+                                                   g->comm_stream));
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = hip_status(hipEventRecord(g->ready[i], g->comm_stream));
+
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = hip_status(hipStreamWaitEvent(stream, g->ready[i], 0));
+            if(status == HIPBLAS_STATUS_SUCCESS && rows && cols)
+                status = gemm(g->handle,
+                              HIPBLAS_OP_N,
+                              HIPBLAS_OP_N,
+                              rows,
+                              cols,
+                              depth,
+                              alpha,
+                              static_cast<const T*>(g->a_panel[i]),
+                              rows,
+                              static_cast<const T*>(g->b_panel[i]),
+                              depth,
+                              p == 0 ? beta : &one,
+                              C,
+                              descC->ld);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = hip_status(hipEventRecord(g->used[i], stream));
+        }
+
+        hipblasStatus_t restored = hipblasSetPointerMode(g->handle, mode);
+        return status == HIPBLAS_STATUS_SUCCESS ? restored : status;
+    }
+}
+
+hipblasStatus_t hipblasDistGridCreate(hipblasDistGrid_t* grid,
+                                      hipblasHandle_t    handle,
+                                      ncclComm_t         row_comm,
+                                      ncclComm_t         col_comm)
+{
+    if(grid == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    *grid = nullptr;
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(row_comm == nullptr || col_comm == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    dist_grid* g = new dist_grid;
+    g->handle    = handle;
+    g->row_comm  = row_comm;
+    g->col_comm  = col_comm;
+
+    hipblasStatus_t status = nccl_status(ncclCommCount(row_comm, &g->npcol));
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = nccl_status(ncclCommUserRank(row_comm, &g->mycol));
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = nccl_status(ncclCommCount(col_comm, &g->nprow));
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = nccl_status(ncclCommUserRank(col_comm, &g->myrow));
+    if(status == HIPBLAS_STATUS_SUCCESS
+       && hipStreamCreateWithFlags(&g->comm_stream, hipStreamNonBlocking) != hipSuccess)
+    {
+        g->comm_stream = nullptr;
+        status         = HIPBLAS_STATUS_INTERNAL_ERROR;
+    }
+    for(hipEvent_t* e : {&g->start, &g->ready[0], &g->ready[1], &g->used[0], &g->used[1]})
+        if(status == HIPBLAS_STATUS_SUCCESS
+           && hipEventCreateWithFlags(e, hipEventDisableTiming) != hipSuccess)
+        {
+            *e     = nullptr;
+            status = HIPBLAS_STATUS_INTERNAL_ERROR;
+        }
+
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        release(g);
+        return status;
+    }
+    *grid = g;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblasDistGridDestroy(hipblasDistGrid_t grid)
+{
+    if(grid == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    release(static_cast<dist_grid*>(grid));
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t
+    hipblasDistGridGetInfo(hipblasDistGrid_t grid, int* nprow, int* npcol, int* myrow, int* mycol)
+{
+    if(grid == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(nprow == nullptr || npcol == nullptr || myrow == nullptr || mycol == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    const dist_grid* g = static_cast<const dist_grid*>(grid);
+    *nprow             = g->nprow;
+    *npcol             = g->npcol;
+    *myrow             = g->myrow;
+    *mycol             = g->mycol;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblasDistLocalSize(hipblasDistGrid_t        grid,
+                                     const hipblasDistDesc_t* desc,
+                                     int64_t*                 rows,
+                                     int64_t*                 cols)
+{
+    if(grid == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!valid_desc(desc) || rows == nullptr || cols == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    const dist_grid* g = static_cast<const dist_grid*>(grid);
+    *rows              = numroc(desc->m, desc->mb, g->myrow, g->nprow);
+    *cols              = numroc(desc->n, desc->nb, g->mycol, g->npcol);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblasDistSgemm(hipblasDistGrid_t        grid,
+                                 hipblasOperation_t       transa,
+                                 hipblasOperation_t       transb,
+                                 const float*             alpha,
+                                 const float*             A,
+                                 const hipblasDistDesc_t* descA,
+                                 const float*             B,
+                                 const hipblasDistDesc_t* descB,
+                                 const float*             beta,
+                                 float*                   C,
+                                 const hipblasDistDesc_t* descC)
+{
+    return summa(hipblasSgemm,
+                 hipblasSgeam,
+                 grid,
+                 transa,
+                 transb,
+                 alpha,
+                 A,
+                 descA,
+                 B,
+                 descB,
+                 beta,
+                 C,
+                 descC);
+}
+
+hipblasStatus_t hipblasDistDgemm(hipblasDistGrid_t        grid,
+                                 hipblasOperation_t       transa,
+                                 hipblasOperation_t       transb,
+                                 const double*            alpha,
+                                 const double*            A,
+                                 const hipblasDistDesc_t* descA,
+                                 const double*            B,
+                                 const hipblasDistDesc_t* descB,
+                                 const double*            beta,
+                                 double*                  C,
+                                 const hipblasDistDesc_t* descC)
+{
+    return summa(hipblasDgemm,
+                 hipblasDgeam,
+                 grid,
+                 transa,
+                 transb,
+                 alpha,
+                 A,
+                 descA,
+                 B,
+                 descB,
+                 beta,
+                 C,
+                 descC);
+}
+
+hipblasStatus_t hipblasDistCgemm(hipblasDistGrid_t        grid,
+                                 hipblasOperation_t       transa,
+                                 hipblasOperation_t       transb,
+                                 const hipblasComplex*    alpha,
+                                 const hipblasComplex*    A,
+                                 const hipblasDistDesc_t* descA,
+                                 const hipblasComplex*    B,
+                                 const hipblasDistDesc_t* descB,
+                                 const hipblasComplex*    beta,
+                                 hipblasComplex*          C,
+                                 const hipblasDistDesc_t* descC)
+{
+    return summa(hipblasCgemm,
+                 hipblasCgeam,
+                 grid,
+                 transa,
+                 transb,
+                 alpha,
+                 A,
+                 descA,
+                 B,
+                 descB,
+                 beta,
+                 C,
+                 descC);
+}
+
+hipblasStatus_t hipblasDistZgemm(hipblasDistGrid_t           grid,
+                                 hipblasOperation_t          transa,
+                                 hipblasOperation_t          transb,
+                                 const hipblasDoubleComplex* alpha,
+                                 const hipblasDoubleComplex* A,
+                                 const hipblasDistDesc_t*    descA,
+                                 const hipblasDoubleComplex* B,
+                                 const hipblasDistDesc_t*    descB,
+                                 const hipblasDoubleComplex* beta,
+                                 hipblasDoubleComplex*       C,
+                                 const hipblasDistDesc_t*    descC)
+{
+    return summa(hipblasZgemm,
+                 hipblasZgeam,
+                 grid,
+                 transa,
+                 transb,
+                 alpha,
+                 A,
+                 descA,
+                 B,
+                 descB,
+                 beta,
+                 C,
+                 descC);
+}
@@ -0,0 +1,421 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#ifdef HIPBLAS_WITH_DLPACK
+#include "hipblas_dlpack.h"
+#include "hipblas_handle.h"
+#include "hipblas_logging.h"
+#include <algorithm>
+#include <climits>
+
+namespace
+{
+    bool fits_int(int64_t value)
+    {
+        return value >= 0 && value <= INT_MAX;
+    }
+
+    hipblasStatus_t tensor_type(DLDataType dtype, hipblasDatatype_t& type)
+    {
+        if(dtype.lanes != 1)
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+        int code = dtype.code, bits = dtype.bits;
+        if(code == kDLFloat && bits == 16)
+            type = HIPBLAS_R_16F;
+        else if(code == kDLFloat && bits == 32)
+            type = HIPBLAS_R_32F;
+        else if(code == kDLFloat && bits == 64)
+            type = HIPBLAS_R_64F;
+        else if(code == kDLBfloat && bits == 16)
+            type = HIPBLAS_R_16B;
+        else if(code == kDLComplex && bits == 64)
+            type = HIPBLAS_C_32F;
+        else if(code == kDLComplex && bits == 128)
+            type = HIPBLAS_C_64F;
+        else if(code == kDLInt && bits == 8)
+            type = HIPBLAS_R_8I;
+        else if(code == kDLInt && bits == 32)
+            type = HIPBLAS_R_32I;
+        else
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Arithmetic of a routine on inputs of type in producing type out
+    hipblasDatatype_t compute_type(hipblasDatatype_t in, hipblasDatatype_t out)
+    {
+        if(in == HIPBLAS_R_16F || in == HIPBLAS_R_16B)
+            return HIPBLAS_R_32F;
+        if(in == HIPBLAS_R_8I)
+            return HIPBLAS_R_32I;
+        return out;
+    }
+
+    // The tensor of a descriptor, its type and its first element, after checking that it lives
+    // on the handle's device
+    hipblasStatus_t tensor_data(hipblasHandle_t        handle,
+                                const DLManagedTensor* managed,
+                                const DLTensor*&       tensor,
+                                hipblasDatatype_t&     type,
+                                char*&                 data)
+    {
+        if(managed == nullptr)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        tensor = &managed->dl_tensor;
+
+        DLDeviceType kind = tensor->device.device_type;
+        if((kind != kDLROCM && kind != kDLCUDA && kind != kDLCUDAManaged)
+           || (kind != kDLCUDAManaged
+               && tensor->device.device_id != static_cast<hipblas_handle*>(handle)->device))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(tensor->ndim > 0 && tensor->shape == nullptr)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        hipblasStatus_t status = tensor_type(tensor->dtype, type);
+        data                   = static_cast<char*>(tensor->data) + tensor->byte_offset;
+        return status;
+    }
+
+    // Stride of dimension d, a null strides array meaning a compact row-major tensor
+    int64_t tensor_stride(const DLTensor& t, int d)
+    {
+        if(t.strides)
+            return t.strides[d];
+        int64_t stride = 1;
+        for(int i = d + 1; i < t.ndim; i++)
+            stride *= t.shape[i];
+        return stride;
+    }
+
+    hipblasStatus_t matrix_view(hipblasHandle_t        handle,
+                                const DLManagedTensor* managed,
+                                hipblasDLPackMatrix_t& m)
+    {
+        const DLTensor* t;
+        char*           data;
+        hipblasStatus_t status = tensor_data(handle, managed, t, m.type, data);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        if(t->ndim < 1 || t->ndim > 3)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        // Dimensions of 1 element may have any stride
+        int     first = t->ndim == 3 ? 1 : 0;
+        int64_t rows  = t->shape[first];
+        int64_t cols  = t->ndim == 1 ? 1 : t->shape[first + 1];
+        int64_t rs    = tensor_stride(*t, first);
+        int64_t cs    = t->ndim == 1 ? std::max<int64_t>(rows, 1) : tensor_stride(*t, first + 1);
+        int64_t ld;
+        if((rows <= 1 || rs == 1) && (cols <= 1 || cs >= std::max<int64_t>(rows, 1)))
+        {
+            m.op = HIPBLAS_OP_N;
+            ld   = cols <= 1 ? std::max<int64_t>(rows, 1) : cs;
+        }
+        else if((cols <= 1 || cs == 1) && (rows <= 1 || rs >= std::max<int64_t>(cols, 1)))
+        {
+            m.op = HIPBLAS_OP_T;
+            ld   = rows <= 1 ? std::max<int64_t>(cols, 1) : rs;
+        }
+        else
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+        int64_t batch  = t->ndim == 3 ? t->shape[0] : 1;
+        int64_t stride = t->ndim == 3 && batch > 1 ? tensor_stride(*t, 0) : 0;
+        if(!fits_int(rows) || !fits_int(cols) || !fits_int(batch))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(!fits_int(ld) || stride < 0)
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+        m.data        = data;
+        m.rows        = int(rows);
+        m.cols        = int(cols);
+        m.ld          = int(ld);
+        m.stride      = stride;
+        m.batch_count = int(batch);
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    hipblasStatus_t vector_view(hipblasHandle_t        handle,
+                                const DLManagedTensor* managed,
+                                hipblasDLPackVector_t& v)
+    {
+        const DLTensor* t;
+        char*           data;
+        hipblasStatus_t status = tensor_data(handle, managed, t, v.type, data);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        if(t->ndim < 1 || t->ndim > 2)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        int     last   = t->ndim - 1;
+        int64_t n      = t->shape[last];
+        int64_t inc    = tensor_stride(*t, last);
+        int64_t batch  = t->ndim == 2 ? t->shape[0] : 1;
+        int64_t stride = t->ndim == 2 && batch > 1 ? tensor_stride(*t, 0) : 0;
+        if(!fits_int(n) || !fits_int(batch))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(inc < INT_MIN || inc > INT_MAX || stride < 0)
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+        // BLAS walks a negative increment from the lowest address
+        if(inc < 0 && n > 0)
+            data += (n - 1) * inc * int64_t(hipblas_datatype_size(v.type));
+
+        v.data        = data;
+        v.n           = int(n);
+        v.inc         = int(inc);
+        v.stride      = stride;
+        v.batch_count = int(batch);
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    hipblasOperation_t flip(hipblasOperation_t op)
+    {
+        return op == HIPBLAS_OP_N ? HIPBLAS_OP_T : HIPBLAS_OP_N;
+    }
+
+    // An unbatched operand is shared by every problem of a batch; a batched one must match it
+    bool batch_matches(int batch_count, int operand)
+    {
+        return operand == 1 || operand == batch_count;
+    }
+}
+
+hipblasStatus_t hipblasDLPackGetMatrix(hipblasHandle_t        handle,
+                                       const DLManagedTensor* tensor,
+                                       hipblasDLPackMatrix_t* matrix)
+{
+    HIPBLAS_LOG_CALL(handle, tensor, matrix);
+    if(handle == nullptr)
+    {
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    }
+    if(matrix == nullptr)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    return matrix_view(handle, tensor, *matrix);
+}
+
+hipblasStatus_t hipblasDLPackGetVector(hipblasHandle_t        handle,
+                                       const DLManagedTensor* tensor,
+                                       hipblasDLPackVector_t* vector)
+{
+    HIPBLAS_LOG_CALL(handle, tensor, vector);
+    if(handle == nullptr)
+    {
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    }
+    if(vector == nullptr)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    return vector_view(handle, tensor, *vector);
+}
+
+hipblasStatus_t hipblasDLPackGemm(hipblasHandle_t        handle,
+                                  const void*            alpha,
+                                  const DLManagedTensor* A,
+                                  const DLManagedTensor* B,
+                                  const void*            beta,
+                                  DLManagedTensor*       C)
+{
+    HIPBLAS_LOG_CALL(handle, alpha, A, B, beta, C);
+    if(handle == nullptr)
+    {
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    }
+
+    hipblasDLPackMatrix_t a, b, c;
+    hipblasStatus_t       status = matrix_view(handle, A, a);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = matrix_view(handle, B, b);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = matrix_view(handle, C, c);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    int batch_count = std::max({a.batch_count, b.batch_count, c.batch_count});
+    if(a.rows != c.rows || b.cols != c.cols || a.cols != b.rows || a.type != b.type
+       || !batch_matches(batch_count, a.batch_count) || !batch_matches(batch_count, b.batch_count)
+       || c.batch_count != batch_count)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    // A row-major C is the column-major C^T = op(B)^T op(A)^T, each transpose flipping op on the
+    // same memory
+    int m = c.rows, n = c.cols, k = a.cols;
+    if(c.op == HIPBLAS_OP_T)
+    {
+        std::swap(a, b);
+        std::swap(m, n);
+        a.op = flip(a.op);
+        b.op = flip(b.op);
+    }
+
+    hipblasDatatype_t compute = compute_type(a.type, c.type);
+
+    if(batch_count == 1 && a.batch_count == 1 && b.batch_count == 1)
+        return hipblasGemmEx(handle,
+                             a.op,
+                             b.op,
+                             m,
+                             n,
+                             k,
+                             alpha,
+                             a.data,
+                             a.type,
+                             a.ld,
+                             b.data,
+                             b.type,
+                             b.ld,
+                             beta,
+                             c.data,
+                             c.type,
+                             c.ld,
+                             compute,
+                             HIPBLAS_GEMM_DEFAULT);
+
+    return hipblasGemmStridedBatchedEx(handle,
+                                       a.op,
+                                       b.op,
+                                       m,
+                                       n,
+                                       k,
+                                       alpha,
+                                       a.data,
+                                       a.type,
+                                       a.ld,
+                                       a.batch_count == 1 ? 0 : a.stride,
+                                       b.data,
+                                       b.type,
+                                       b.ld,
+                                       b.batch_count == 1 ? 0 : b.stride,
+                                       beta,
+                                       c.data,
+                                       c.type,
+                                       c.ld,
+                                       c.stride,
+                                       batch_count,
+                                       compute,
+                                       HIPBLAS_GEMM_DEFAULT);
+}
+
+hipblasStatus_t hipblasDLPackAxpy(hipblasHandle_t        handle,
+                                  const void*            alpha,
+                                  const DLManagedTensor* x,
+                                  DLManagedTensor*       y)
+{
+    HIPBLAS_LOG_CALL(handle, alpha, x, y);
+    if(handle == nullptr)
+    {
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    }
+
+    hipblasDLPackVector_t xv, yv;
+    hipblasStatus_t       status = vector_view(handle, x, xv);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = vector_view(handle, y, yv);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    if(xv.n != yv.n || xv.batch_count != yv.batch_count)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipblasDatatype_t compute = compute_type(xv.type, xv.type);
+    if(xv.batch_count == 1)
+        return hipblasAxpyEx(handle,
+                             xv.n,
+                             alpha,
+                             compute,
+                             xv.data,
+                             xv.type,
+                             xv.inc,
+                             yv.data,
+                             yv.type,
+                             yv.inc,
+                             compute);
+    return hipblasAxpyStridedBatchedEx(handle,
+                                       xv.n,
+                                       alpha,
+                                       compute,
+                                       xv.data,
+                                       xv.type,
+                                       xv.inc,
+                                       xv.stride,
+                                       yv.data,
+                                       yv.type,
+                                       yv.inc,
+                                       yv.stride,
+                                       xv.batch_count,
+                                       compute);
+}
+
+hipblasStatus_t hipblasDLPackScal(hipblasHandle_t handle, const void* alpha, DLManagedTensor* x)
+{
+    HIPBLAS_LOG_CALL(handle, alpha, x);
+    if(handle == nullptr)
+    {
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    }
+
+    hipblasDLPackVector_t xv;
+    hipblasStatus_t       status = vector_view(handle, x, xv);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    hipblasDatatype_t compute = compute_type(xv.type, xv.type);
+    if(xv.batch_count == 1)
+        return hipblasScalEx(handle, xv.n, alpha, compute, xv.data, xv.type, xv.inc, compute);
+    return hipblasScalStridedBatchedEx(
+        handle, xv.n, alpha, compute, xv.data, xv.type, xv.inc, xv.stride, xv.batch_count, compute);
+}
+
+hipblasStatus_t hipblasDLPackDot(hipblasHandle_t        handle,
+                                 const DLManagedTensor* x,
+                                 const DLManagedTensor* y,
+                                 void*                  result)
+{
+    HIPBLAS_LOG_CALL(handle, x, y, result);
+    if(handle == nullptr)
+    {
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    }
+
+    hipblasDLPackVector_t xv, yv;
+    hipblasStatus_t       status = vector_view(handle, x, xv);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = vector_view(handle, y, yv);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    if(xv.n != yv.n || xv.batch_count != yv.batch_count)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    hipblasDatatype_t compute = compute_type(xv.type, xv.type);
+    if(xv.batch_count == 1)
+        return hipblasDotEx(handle,
+                            xv.n,
+                            xv.data,
+                            xv.type,
+                            xv.inc,
+                            yv.data,
+                            yv.type,
+                            yv.inc,
+                            result,
+                            xv.type,
+                            compute);
+    return hipblasDotStridedBatchedEx(handle,
+                                      xv.n,
+                                      xv.data,
+                                      xv.type,
+                                      xv.inc,
+                                      xv.stride,
+                                      yv.data,
+                                      yv.type,
+                                      yv.inc,
+                                      yv.stride,
+                                      xv.batch_count,
+                                      result,
+                                      xv.type,
+                                      compute);
+}
+#endif
@@ -0,0 +1,843 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "hipblas_handle.h"
+#include "hipblas_kernels.h"
+#include "hipblas_logging.h"
+#include <algorithm>
+#include <hip/hip_runtime_api.h>
+
+namespace
+{
+    // Neither rocBLAS nor cuBLAS converts between the full, packed and band layouts, so both
+    // backends run the same copy kernels on the handle's stream
+    hipblasStatus_t launch_status(hipError_t err)
+    {
+        return err == hipSuccess ? HIPBLAS_STATUS_SUCCESS : HIPBLAS_STATUS_INTERNAL_ERROR;
+    }
+
+    template <typename T>
+    hipblas_batched_operand<T> batch_of(T* ptr, int64_t stride)
+    {
+        return {ptr, stride, nullptr};
+    }
+
+    template <typename T>
+    hipblas_batched_operand<T> batch_of(T* const array[])
+    {
+        return {nullptr, 0, array};
+    }
+
+    template <typename T>
+    bool missing(hipblas_batched_operand<T> op)
+    {
+        return op.ptr == nullptr && op.array == nullptr;
+    }
+
+    template <typename T>
+    hipblasStatus_t trttp_batched(hipblasHandle_t                  handle,
+                                  hipblasFillMode_t                uplo,
+                                  int                              n,
+                                  hipblas_batched_operand<const T> A,
+                                  int                              lda,
+                                  hipblas_batched_operand<T>       AP,
+                                  int                              batch_count)
+    {
+        if((uplo != HIPBLAS_FILL_MODE_UPPER && uplo != HIPBLAS_FILL_MODE_LOWER) || n < 0
+           || lda < std::max(1, n) || batch_count < 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(n == 0 || batch_count == 0)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(missing(A) || missing(AP))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        hipStream_t     stream;
+        hipblasStatus_t status = hipblasGetStream(handle, &stream);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        return launch_status(hipblas_trttp_batched(stream, uplo, n, A, lda, AP, batch_count));
+    }
+
+    template <typename T>
+    hipblasStatus_t tpttr_batched(hipblasHandle_t                  handle,
+                                  hipblasFillMode_t                uplo,
+                                  int                              n,
+                                  hipblas_batched_operand<const T> AP,
+                                  hipblas_batched_operand<T>       A,
+                                  int                              lda,
+                                  int                              batch_count)
+    {
+        if((uplo != HIPBLAS_FILL_MODE_UPPER && uplo != HIPBLAS_FILL_MODE_LOWER) || n < 0
+           || lda < std::max(1, n) || batch_count < 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(n == 0 || batch_count == 0)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(missing(AP) || missing(A))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        hipStream_t     stream;
+        hipblasStatus_t status = hipblasGetStream(handle, &stream);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        return launch_status(hipblas_tpttr_batched(stream, uplo, n, AP, A, lda, batch_count));
+    }
+
+    hipblasStatus_t
+        band_arguments(int m, int n, int kl, int ku, int lda, int ldab, int batch_count)
+    {
+        if(m < 0 || n < 0 || kl < 0 || ku < 0 || lda < std::max(1, m) || ldab < kl + ku + 1
+           || batch_count < 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    template <typename T>
+    hipblasStatus_t ge2gb_batched(hipblasHandle_t                  handle,
+                                  int                              m,
+                                  int                              n,
+                                  int                              kl,
+                                  int                              ku,
+                                  hipblas_batched_operand<const T> A,
+                                  int                              lda,
+                                  hipblas_batched_operand<T>       AB,
+                                  int                              ldab,
+                                  int                              batch_count)
+    {
+        hipblasStatus_t status = band_arguments(m, n, kl, ku, lda, ldab, batch_count);
+        if(status != HIPBLAS_STATUS_SUCCESS || m == 0 || n == 0 || batch_count == 0)
+            return status;
+        if(missing(A) || missing(AB))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        hipStream_t stream;
+        status = hipblasGetStream(handle, &stream);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        return launch_status(
+            hipblas_ge2gb_batched(stream, m, n, kl, ku, A, lda, AB, ldab, batch_count));
+    }
+
+    template <typename T>
+    hipblasStatus_t gb2ge_batched(hipblasHandle_t                  handle,
+                                  int                              m,
+                                  int                              n,
+                                  int                              kl,
+                                  int                              ku,
+                                  hipblas_batched_operand<const T> AB,
+                                  int                              ldab,
+                                  hipblas_batched_operand<T>       A,
+                                  int                              lda,
+                                  int                              batch_count)
+    {
+        hipblasStatus_t status = band_arguments(m, n, kl, ku, lda, ldab, batch_count);
+        if(status != HIPBLAS_STATUS_SUCCESS || m == 0 || n == 0 || batch_count == 0)
+            return status;
+        if(missing(AB) || missing(A))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        hipStream_t stream;
+        status = hipblasGetStream(handle, &stream);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        return launch_status(
+            hipblas_gb2ge_batched(stream, m, n, kl, ku, AB, ldab, A, lda, batch_count));
+    }
+}
+
+hipblasStatus_t hipblasStrttp(hipblasHandle_t         handle,
+                              const hipblasFillMode_t uplo,
+                              const int               n,
+                              const float*            A,
+                              const int               lda,
+                              float*                  AP)
+{
+    HIPBLAS_LOG_CALL(handle, uplo, n, A, lda, AP);
+    return trttp_batched(handle, uplo, n, batch_of(A, 0), lda, batch_of(AP, 0), 1);
+}
+
+hipblasStatus_t hipblasDtrttp(hipblasHandle_t         handle,
+                              const hipblasFillMode_t uplo,
+                              const int               n,
+                              const double*           A,
+                              const int               lda,
+                              double*                 AP)
+{
+    HIPBLAS_LOG_CALL(handle, uplo, n, A, lda, AP);
+    return trttp_batched(handle, uplo, n, batch_of(A, 0), lda, batch_of(AP, 0), 1);
+}
+
+hipblasStatus_t hipblasCtrttp(hipblasHandle_t         handle,
+                              const hipblasFillMode_t uplo,
+                              const int               n,
+                              const hipblasComplex*   A,
+                              const int               lda,
+                              hipblasComplex*         AP)
+{
+    HIPBLAS_LOG_CALL(handle, uplo, n, A, lda, AP);
+    return trttp_batched(handle, uplo, n, batch_of(A, 0), lda, batch_of(AP, 0), 1);
+}
+
+hipblasStatus_t hipblasZtrttp(hipblasHandle_t             handle,
+                              const hipblasFillMode_t     uplo,
+                              const int                   n,
+                              const hipblasDoubleComplex* A,
+                              const int                   lda,
+                              hipblasDoubleComplex*       AP)
+{
+    HIPBLAS_LOG_CALL(handle, uplo, n, A, lda, AP);
+    return trttp_batched(handle, uplo, n, batch_of(A, 0), lda, batch_of(AP, 0), 1);
+}
+
+hipblasStatus_t hipblasStrttpBatched(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     const float* const      A[],
+                                     const int               lda,
+                                     float* const            AP[],
+                                     const int               batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, uplo, n, A, lda, AP, batch_count);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, A, AP);
+    return trttp_batched(handle, uplo, n, batch_of(A), lda, batch_of(AP), batch_count);
+}
+
+hipblasStatus_t hipblasDtrttpBatched(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     const double* const     A[],
+                                     const int               lda,
+                                     double* const           AP[],
+                                     const int               batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, uplo, n, A, lda, AP, batch_count);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, A, AP);
+    return trttp_batched(handle, uplo, n, batch_of(A), lda, batch_of(AP), batch_count);
+}
+
+hipblasStatus_t hipblasCtrttpBatched(hipblasHandle_t             handle,
+                                     const hipblasFillMode_t     uplo,
+                                     const int                   n,
+                                     const hipblasComplex* const A[],
+                                     const int                   lda,
+                                     hipblasComplex* const       AP[],
+                                     const int                   batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, uplo, n, A, lda, AP, batch_count);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, A, AP);
+    return trttp_batched(handle, uplo, n, batch_of(A), lda, batch_of(AP), batch_count);
+}
+
+hipblasStatus_t hipblasZtrttpBatched(hipblasHandle_t                   handle,
+                                     const hipblasFillMode_t           uplo,
+                                     const int                         n,
+                                     const hipblasDoubleComplex* const A[],
+                                     const int                         lda,
+                                     hipblasDoubleComplex* const       AP[],
+                                     const int                         batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, uplo, n, A, lda, AP, batch_count);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, A, AP);
+    return trttp_batched(handle, uplo, n, batch_of(A), lda, batch_of(AP), batch_count);
+}
+
+hipblasStatus_t hipblasStrttpStridedBatched(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            const float*            A,
+                                            const int               lda,
+                                            const int               strideA,
+                                            float*                  AP,
+                                            const int               strideAP,
+                                            const int               batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, uplo, n, A, lda, strideA, AP, strideAP, batch_count);
+    return trttp_batched(
+        handle, uplo, n, batch_of(A, strideA), lda, batch_of(AP, strideAP), batch_count);
+}
+
+hipblasStatus_t hipblasDtrttpStridedBatched(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            const double*           A,
+                                            const int               lda,
+                                            const int               strideA,
+                                            double*                 AP,
+                                            const int               strideAP,
+                                            const int               batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, uplo, n, A, lda, strideA, AP, strideAP, batch_count);
+    return trttp_batched(
+        handle, uplo, n, batch_of(A, strideA), lda, batch_of(AP, strideAP), batch_count);
+}
+
+hipblasStatus_t hipblasCtrttpStridedBatched(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            const hipblasComplex*   A,
+                                            const int               lda,
+                                            const int               strideA,
+                                            hipblasComplex*         AP,
+                                            const int               strideAP,
+                                            const int               batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, uplo, n, A, lda, strideA, AP, strideAP, batch_count);
+    return trttp_batched(
+        handle, uplo, n, batch_of(A, strideA), lda, batch_of(AP, strideAP), batch_count);
+}
+
+hipblasStatus_t hipblasZtrttpStridedBatched(hipblasHandle_t             handle,
+                                            const hipblasFillMode_t     uplo,
+                                            const int                   n,
+                                            const hipblasDoubleComplex* A,
+                                            const int                   lda,
+                                            const int                   strideA,
+                                            hipblasDoubleComplex*       AP,
+                                            const int                   strideAP,
+                                            const int                   batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, uplo, n, A, lda, strideA, AP, strideAP, batch_count);
+    return trttp_batched(
+        handle, uplo, n, batch_of(A, strideA), lda, batch_of(AP, strideAP), batch_count);
+}
+
+hipblasStatus_t hipblasStpttr(hipblasHandle_t         handle,
+                              const hipblasFillMode_t uplo,
+                              const int               n,
+                              const float*            AP,
+                              float*                  A,
+                              const int               lda)
+{
+    HIPBLAS_LOG_CALL(handle, uplo, n, AP, A, lda);
+    return tpttr_batched(handle, uplo, n, batch_of(AP, 0), batch_of(A, 0), lda, 1);
+}
+
+hipblasStatus_t hipblasDtpttr(hipblasHandle_t         handle,
+                              const hipblasFillMode_t uplo,
+                              const int               n,
+                              const double*           AP,
+                              double*                 A,
+                              const int               lda)
+{
+    HIPBLAS_LOG_CALL(handle, uplo, n, AP, A, lda);
+    return tpttr_batched(handle, uplo, n, batch_of(AP, 0), batch_of(A, 0), lda, 1);
+}
+
+hipblasStatus_t hipblasCtpttr(hipblasHandle_t         handle,
+                              const hipblasFillMode_t uplo,
+                              const int               n,
+                              const hipblasComplex*   AP,
+                              hipblasComplex*         A,
+                              const int               lda)
+{
+    HIPBLAS_LOG_CALL(handle, uplo, n, AP, A, lda);
+    return tpttr_batched(handle, uplo, n, batch_of(AP, 0), batch_of(A, 0), lda, 1);
+}
+
+hipblasStatus_t hipblasZtpttr(hipblasHandle_t             handle,
+                              const hipblasFillMode_t     uplo,
+                              const int                   n,
+                              const hipblasDoubleComplex* AP,
+                              hipblasDoubleComplex*       A,
+                              const int                   lda)
+{
+    HIPBLAS_LOG_CALL(handle, uplo, n, AP, A, lda);
+    return tpttr_batched(handle, uplo, n, batch_of(AP, 0), batch_of(A, 0), lda, 1);
+}
+
+hipblasStatus_t hipblasStpttrBatched(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     const float* const      AP[],
+                                     float* const            A[],
+                                     const int               lda,
+                                     const int               batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, uplo, n, AP, A, lda, batch_count);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, AP, A);
+    return tpttr_batched(handle, uplo, n, batch_of(AP), batch_of(A), lda, batch_count);
+}
+
+hipblasStatus_t hipblasDtpttrBatched(hipblasHandle_t         handle,
+                                     const hipblasFillMode_t uplo,
+                                     const int               n,
+                                     const double* const     AP[],
+                                     double* const           A[],
+                                     const int               lda,
+                                     const int               batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, uplo, n, AP, A, lda, batch_count);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, AP, A);
+    return tpttr_batched(handle, uplo, n, batch_of(AP), batch_of(A), lda, batch_count);
+}
+
+hipblasStatus_t hipblasCtpttrBatched(hipblasHandle_t             handle,
+                                     const hipblasFillMode_t     uplo,
+                                     const int                   n,
+                                     const hipblasComplex* const AP[],
+                                     hipblasComplex* const       A[],
+                                     const int                   lda,
+                                     const int                   batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, uplo, n, AP, A, lda, batch_count);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, AP, A);
+    return tpttr_batched(handle, uplo, n, batch_of(AP), batch_of(A), lda, batch_count);
+}
+
+hipblasStatus_t hipblasZtpttrBatched(hipblasHandle_t                   handle,
+                                     const hipblasFillMode_t           uplo,
+                                     const int                         n,
+                                     const hipblasDoubleComplex* const AP[],
+                                     hipblasDoubleComplex* const       A[],
+                                     const int                         lda,
+                                     const int                         batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, uplo, n, AP, A, lda, batch_count);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, AP, A);
+    return tpttr_batched(handle, uplo, n, batch_of(AP), batch_of(A), lda, batch_count);
+}
+
+hipblasStatus_t hipblasStpttrStridedBatched(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            const float*            AP,
+                                            const int               strideAP,
+                                            float*                  A,
+                                            const int               lda,
+                                            const int               strideA,
+                                            const int               batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, uplo, n, AP, strideAP, A, lda, strideA, batch_count);
+    return tpttr_batched(
+        handle, uplo, n, batch_of(AP, strideAP), batch_of(A, strideA), lda, batch_count);
+}
+
+hipblasStatus_t hipblasDtpttrStridedBatched(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            const double*           AP,
+                                            const int               strideAP,
+                                            double*                 A,
+                                            const int               lda,
+                                            const int               strideA,
+                                            const int               batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, uplo, n, AP, strideAP, A, lda, strideA, batch_count);
+    return tpttr_batched(
+        handle, uplo, n, batch_of(AP, strideAP), batch_of(A, strideA), lda, batch_count);
+}
+
+hipblasStatus_t hipblasCtpttrStridedBatched(hipblasHandle_t         handle,
+                                            const hipblasFillMode_t uplo,
+                                            const int               n,
+                                            const hipblasComplex*   AP,
+                                            const int               strideAP,
+                                            hipblasComplex*         A,
+                                            const int               lda,
+                                            const int               strideA,
+                                            const int               batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, uplo, n, AP, strideAP, A, lda, strideA, batch_count);
+    return tpttr_batched(
+        handle, uplo, n, batch_of(AP, strideAP), batch_of(A, strideA), lda, batch_count);
+}
+
+hipblasStatus_t hipblasZtpttrStridedBatched(hipblasHandle_t             handle,
+                                            const hipblasFillMode_t     uplo,
+                                            const int                   n,
+                                            const hipblasDoubleComplex* AP,
+                                            const int                   strideAP,
+                                            hipblasDoubleComplex*       A,
+                                            const int                   lda,
+                                            const int                   strideA,
+                                            const int                   batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, uplo, n, AP, strideAP, A, lda, strideA, batch_count);
+    return tpttr_batched(
+        handle, uplo, n, batch_of(AP, strideAP), batch_of(A, strideA), lda, batch_count);
+}
+
+hipblasStatus_t hipblasSge2gb(hipblasHandle_t handle,
+                              const int       m,
+                              const int       n,
+                              const int       kl,
+                              const int       ku,
+                              const float*    A,
+                              const int       lda,
+                              float*          AB,
+                              const int       ldab)
+{
+    HIPBLAS_LOG_CALL(handle, m, n, kl, ku, A, lda, AB, ldab);
+    return ge2gb_batched(handle, m, n, kl, ku, batch_of(A, 0), lda, batch_of(AB, 0), ldab, 1);
+}
+
+hipblasStatus_t hipblasDge2gb(hipblasHandle_t handle,
+                              const int       m,
+                              const int       n,
+                              const int       kl,
+                              const int       ku,
+                              const double*   A,
+                              const int       lda,
+                              double*         AB,
+                              const int       ldab)
+{
+    HIPBLAS_LOG_CALL(handle, m, n, kl, ku, A, lda, AB, ldab);
+    return ge2gb_batched(handle, m, n, kl, ku, batch_of(A, 0), lda, batch_of(AB, 0), ldab, 1);
+}
+
+hipblasStatus_t hipblasCge2gb(hipblasHandle_t       handle,
+                              const int             m,
+                              const int             n,
+                              const int             kl,
+                              const int             ku,
+                              const hipblasComplex* A,
+                              const int             lda,
+                              hipblasComplex*       AB,
+                              const int             ldab)
+{
+    HIPBLAS_LOG_CALL(handle, m, n, kl, ku, A, lda, AB, ldab);
+    return ge2gb_batched(handle, m, n, kl, ku, batch_of(A, 0), lda, batch_of(AB, 0), ldab, 1);
+}
+
+hipblasStatus_t hipblasZge2gb(hipblasHandle_t             handle,
+                              const int                   m,
+                              const int                   n,
+                              const int                   kl,
+                              const int                   ku,
+                              const hipblasDoubleComplex* A,
+                              const int                   lda,
+                              hipblasDoubleComplex*       AB,
+                              const int                   ldab)
+{
+    HIPBLAS_LOG_CALL(handle, m, n, kl, ku, A, lda, AB, ldab);
+    return ge2gb_batched(handle, m, n, kl, ku, batch_of(A, 0), lda, batch_of(AB, 0), ldab, 1);
+}
+
+hipblasStatus_t hipblasSge2gbBatched(hipblasHandle_t    handle,
+                                     const int          m,
+                                     const int          n,
+                                     const int          kl,
+                                     const int          ku,
+                                     const float* const A[],
+                                     const int          lda,
+                                     float* const       AB[],
+                                     const int          ldab,
+                                     const int          batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, m, n, kl, ku, A, lda, AB, ldab, batch_count);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, A, AB);
+    return ge2gb_batched(handle, m, n, kl, ku, batch_of(A), lda, batch_of(AB), ldab, batch_count);
+}
+
+hipblasStatus_t hipblasDge2gbBatched(hipblasHandle_t     handle,
+                                     const int           m,
+                                     const int           n,
+                                     const int           kl,
+                                     const int           ku,
+                                     const double* const A[],
+                                     const int           lda,
+                                     double* const       AB[],
+                                     const int           ldab,
+                                     const int           batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, m, n, kl, ku, A, lda, AB, ldab, batch_count);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, A, AB);
+    return ge2gb_batched(handle, m, n, kl, ku, batch_of(A), lda, batch_of(AB), ldab, batch_count);
+}
+
+hipblasStatus_t hipblasCge2gbBatched(hipblasHandle_t             handle,
+                                     const int                   m,
+                                     const int                   n,
+                                     const int                   kl,
+                                     const int                   ku,
+                                     const hipblasComplex* const A[],
+                                     const int                   lda,
+                                     hipblasComplex* const       AB[],
+                                     const int                   ldab,
+                                     const int                   batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, m, n, kl, ku, A, lda, AB, ldab, batch_count);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, A, AB);
+    return ge2gb_batched(handle, m, n, kl, ku, batch_of(A), lda, batch_of(AB), ldab, batch_count);
+}
+
+hipblasStatus_t hipblasZge2gbBatched(hipblasHandle_t                   handle,
+                                     const int                         m,
+                                     const int                         n,
+                                     const int                         kl,
+                                     const int                         ku,
+                                     const hipblasDoubleComplex* const A[],
+                                     const int                         lda,
+                                     hipblasDoubleComplex* const       AB[],
+                                     const int                         ldab,
+                                     const int                         batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, m, n, kl, ku, A, lda, AB, ldab, batch_count);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, A, AB);
+    return ge2gb_batched(handle, m, n, kl, ku, batch_of(A), lda, batch_of(AB), ldab, batch_count);
+}
+
+hipblasStatus_t hipblasSge2gbStridedBatched(hipblasHandle_t handle,
+                                            const int       m,
+                                            const int       n,
+                                            const int       kl,
+                                            const int       ku,
+                                            const float*    A,
+                                            const int       lda,
+                                            const int       strideA,
+                                            float*          AB,
+                                            const int       ldab,
+                                            const int       strideAB,
+                                            const int       batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, m, n, kl, ku, A, lda, strideA, AB, ldab, strideAB, batch_count);
+    return ge2gb_batched(
+        handle, m, n, kl, ku, batch_of(A, strideA), lda, batch_of(AB, strideAB), ldab, batch_count);
+}
+
+hipblasStatus_t hipblasDge2gbStridedBatched(hipblasHandle_t handle,
+                                            const int       m,
+                                            const int       n,
+                                            const int       kl,
+                                            const int       ku,
+                                            const double*   A,
+                                            const int       lda,
+                                            const int       strideA,
+                                            double*         AB,
+                                            const int       ldab,
+                                            const int       strideAB,
+                                            const int       batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, m, n, kl, ku, A, lda, strideA, AB, ldab, strideAB, batch_count);
+    return ge2gb_batched(
+        handle, m, n, kl, ku, batch_of(A, strideA), lda, batch_of(AB, strideAB), ldab, batch_count);
+}
+
+hipblasStatus_t hipblasCge2gbStridedBatched(hipblasHandle_t       handle,
+                                            const int             m,
+                                            const int             n,
+                                            const int             kl,
+                                            const int             ku,
+                                            const hipblasComplex* A,
+                                            const int             lda,
+                                            const int             strideA,
+                                            hipblasComplex*       AB,
+                                            const int             ldab,
+                                            const int             strideAB,
+                                            const int             batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, m, n, kl, ku, A, lda, strideA, AB, ldab, strideAB, batch_count);
+    return ge2gb_batched(
+        handle, m, n, kl, ku, batch_of(A, strideA), lda, batch_of(AB, strideAB), ldab, batch_count);
+}
+
+hipblasStatus_t hipblasZge2gbStridedBatched(hipblasHandle_t             handle,
+                                            const int                   m,
+                                            const int                   n,
+                                            const int                   kl,
+                                            const int                   ku,
+                                            const hipblasDoubleComplex* A,
+                                            const int                   lda,
+                                            const int                   strideA,
+                                            hipblasDoubleComplex*       AB,
+                                            const int                   ldab,
+                                            const int                   strideAB,
+                                            const int                   batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, m, n, kl, ku, A, lda, strideA, AB, ldab, strideAB, batch_count);
+    return ge2gb_batched(
+        handle, m, n, kl, ku, batch_of(A, strideA), lda, batch_of(AB, strideAB), ldab, batch_count);
+}
+
+hipblasStatus_t hipblasSgb2ge(hipblasHandle_t handle,
+                              const int       m,
+                              const int       n,
+                              const int       kl,
+                              const int       ku,
+                              const float*    AB,
+                              const int       ldab,
+                              float*          A,
+                              const int       lda)
+{
+    HIPBLAS_LOG_CALL(handle, m, n, kl, ku, AB, ldab, A, lda);
+    return gb2ge_batched(handle, m, n, kl, ku, batch_of(AB, 0), ldab, batch_of(A, 0), lda, 1);
+}
+
+hipblasStatus_t hipblasDgb2ge(hipblasHandle_t handle,
+                              const int       m,
+                              const int       n,
+                              const int       kl,
+                              const int       ku,
+                              const double*   AB,
+                              const int       ldab,
+                              double*         A,
+                              const int       lda)
+{
+    HIPBLAS_LOG_CALL(handle, m, n, kl, ku, AB, ldab, A, lda);
+    return gb2ge_batched(handle, m, n, kl, ku, batch_of(AB, 0), ldab, batch_of(A, 0), lda, 1);
+}
+
+hipblasStatus_t hipblasCgb2ge(hipblasHandle_t       handle,
+                              const int             m,
+                              const int             n,
+                              const int             kl,
+                              const int             ku,
+                              const hipblasComplex* AB,
+                              const int             ldab,
+                              hipblasComplex*       A,
+                              const int             lda)
+{
+    HIPBLAS_LOG_CALL(handle, m, n, kl, ku, AB, ldab, A, lda);
+    return gb2ge_batched(handle, m, n, kl, ku, batch_of(AB, 0), ldab, batch_of(A, 0), lda, 1);
+}
+
+hipblasStatus_t hipblasZgb2ge(hipblasHandle_t             handle,
+                              const int                   m,
+                              const int                   n,
+                              const int                   kl,
+                              const int                   ku,
+                              const hipblasDoubleComplex* AB,
+                              const int                   ldab,
+                              hipblasDoubleComplex*       A,
+                              const int                   lda)
+{
+    HIPBLAS_LOG_CALL(handle, m, n, kl, ku, AB, ldab, A, lda);
+    return gb2ge_batched(handle, m, n, kl, ku, batch_of(AB, 0), ldab, batch_of(A, 0), lda, 1);
+}
+
+hipblasStatus_t hipblasSgb2geBatched(hipblasHandle_t    handle,
+                                     const int          m,
+                                     const int          n,
+                                     const int          kl,
+                                     const int          ku,
+                                     const float* const AB[],
+                                     const int          ldab,
+                                     float* const       A[],
+                                     const int          lda,
+                                     const int          batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, m, n, kl, ku, AB, ldab, A, lda, batch_count);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, AB, A);
+    return gb2ge_batched(handle, m, n, kl, ku, batch_of(AB), ldab, batch_of(A), lda, batch_count);
+}
+
+hipblasStatus_t hipblasDgb2geBatched(hipblasHandle_t     handle,
+                                     const int           m,
+                                     const int           n,
+                                     const int           kl,
+                                     const int           ku,
+                                     const double* const AB[],
+                                     const int           ldab,
+                                     double* const       A[],
+                                     const int           lda,
+                                     const int           batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, m, n, kl, ku, AB, ldab, A, lda, batch_count);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, AB, A);
+    return gb2ge_batched(handle, m, n, kl, ku, batch_of(AB), ldab, batch_of(A), lda, batch_count);
+}
+
+hipblasStatus_t hipblasCgb2geBatched(hipblasHandle_t             handle,
+                                     const int                   m,
+                                     const int                   n,
+                                     const int                   kl,
+                                     const int                   ku,
+                                     const hipblasComplex* const AB[],
+                                     const int                   ldab,
+                                     hipblasComplex* const       A[],
+                                     const int                   lda,
+                                     const int                   batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, m, n, kl, ku, AB, ldab, A, lda, batch_count);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, AB, A);
+    return gb2ge_batched(handle, m, n, kl, ku, batch_of(AB), ldab, batch_of(A), lda, batch_count);
+}
+
+hipblasStatus_t hipblasZgb2geBatched(hipblasHandle_t                   handle,
+                                     const int                         m,
+                                     const int                         n,
+                                     const int                         kl,
+                                     const int                         ku,
+                                     const hipblasDoubleComplex* const AB[],
+                                     const int                         ldab,
+                                     hipblasDoubleComplex* const       A[],
+                                     const int                         lda,
+                                     const int                         batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, m, n, kl, ku, AB, ldab, A, lda, batch_count);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, AB, A);
+    return gb2ge_batched(handle, m, n, kl, ku, batch_of(AB), ldab, batch_of(A), lda, batch_count);
+}
+
+hipblasStatus_t hipblasSgb2geStridedBatched(hipblasHandle_t handle,
+                                            const int       m,
+                                            const int       n,
+                                            const int       kl,
+                                            const int       ku,
+                                            const float*    AB,
+                                            const int       ldab,
+                                            const int       strideAB,
+                                            float*          A,
+                                            const int       lda,
+                                            const int       strideA,
+                                            const int       batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, m, n, kl, ku, AB, ldab, strideAB, A, lda, strideA, batch_count);
+    return gb2ge_batched(
+        handle, m, n, kl, ku, batch_of(AB, strideAB), ldab, batch_of(A, strideA), lda, batch_count);
+}
+
+hipblasStatus_t hipblasDgb2geStridedBatched(hipblasHandle_t handle,
+                                            const int       m,
+                                            const int       n,
+                                            const int       kl,
+                                            const int       ku,
+                                            const double*   AB,
+                                            const int       ldab,
+                                            const int       strideAB,
+                                            double*         A,
+                                            const int       lda,
+                                            const int       strideA,
+                                            const int       batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, m, n, kl, ku, AB, ldab, strideAB, A, lda, strideA, batch_count);
+    return gb2ge_batched(
+        handle, m, n, kl, ku, batch_of(AB, strideAB), ldab, batch_of(A, strideA), lda, batch_count);
+}
+
+hipblasStatus_t hipblasCgb2geStridedBatched(hipblasHandle_t       handle,
+                                            const int             m,
+                                            const int             n,
+                                            const int             kl,
+                                            const int             ku,
+                                            const hipblasComplex* AB,
+                                            const int             ldab,
+                                            const int             strideAB,
+                                            hipblasComplex*       A,
+                                            const int             lda,
+                                            const int             strideA,
+                                            const int             batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, m, n, kl, ku, AB, ldab, strideAB, A, lda, strideA, batch_count);
+    return gb2ge_batched(
+        handle, m, n, kl, ku, batch_of(AB, strideAB), ldab, batch_of(A, strideA), lda, batch_count);
+}
+
+hipblasStatus_t hipblasZgb2geStridedBatched(hipblasHandle_t             handle,
+                                            const int                   m,
+                                            const int                   n,
+                                            const int                   kl,
+                                            const int                   ku,
+                                            const hipblasDoubleComplex* AB,
+                                            const int                   ldab,
+                                            const int                   strideAB,
+                                            hipblasDoubleComplex*       A,
+                                            const int                   lda,
+                                            const int                   strideA,
+                                            const int                   batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, m, n, kl, ku, AB, ldab, strideAB, A, lda, strideA, batch_count);
+    return gb2ge_batched(
+        handle, m, n, kl, ku, batch_of(AB, strideAB), ldab, batch_of(A, strideA), lda, batch_count);
+}
@@ -0,0 +1,714 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "hipblas_gemm_abft.h"
+#include "hipblas_handle.h"
+#include "hipblas_kernels.h"
+#include <algorithm>
+#include <hip/hip_runtime_api.h>
+#include <limits>
+#include <new>
+#include <vector>
+
+namespace
+{
+    constexpr int TILE = HIPBLAS_ABFT_TILE;
+
+    template <typename T>
+    struct routines;
+
+    template <>
+    struct routines<float>
+    {
+        static constexpr hipblasDatatype_t type                 = HIPBLAS_R_32F;
+        static constexpr auto              gemm                 = hipblasSgemm;
+        static constexpr auto              gemm_strided_batched = hipblasSgemmStridedBatched;
+        static constexpr auto              gemm_batched         = hipblasSgemmBatched;
+    };
+
+    template <>
+    struct routines<double>
+    {
+        static constexpr hipblasDatatype_t type                 = HIPBLAS_R_64F;
+        static constexpr auto              gemm                 = hipblasDgemm;
+        static constexpr auto              gemm_strided_batched = hipblasDgemmStridedBatched;
+        static constexpr auto              gemm_batched         = hipblasDgemmBatched;
+    };
+
+    bool valid_operation(hipblasOperation_t op)
+    {
+        return op == HIPBLAS_OP_N || op == HIPBLAS_OP_T || op == HIPBLAS_OP_C;
+    }
+
+    hipblasStatus_t launch_status(hipError_t err)
+    {
+        return err == hipSuccess ? HIPBLAS_STATUS_SUCCESS : HIPBLAS_STATUS_INTERNAL_ERROR;
+    }
+
+    size_t aligned(size_t bytes)
+    {
+        return (bytes + 255) & ~size_t(255);
+    }
+
+    // Element (r, c) of op(X)
+    template <typename T>
+    const T* at(const T* X, int ld, hipblasOperation_t op, int r, int c)
+    {
+        return op == HIPBLAS_OP_N ? X + r + size_t(c) * ld : X + c + size_t(r) * ld;
+    }
+
+    // One gemm to check, with the operands as the kernels take them; the pointer arrays are in
+    // device memory
+    struct problem
+    {
+        hipblasOperation_t                  transa;
+        hipblasOperation_t                  transb;
+        int                                 m;
+        int                                 n;
+        int                                 k;
+        const void*                         alpha;
+        hipblas_batched_operand<const void> A;
+        int                                 lda;
+        hipblas_batched_operand<const void> B;
+        int                                 ldb;
+        const void*                         beta;
+        hipblas_batched_operand<void>       C;
+        int                                 ldc;
+        int                                 batch_count;
+    };
+
+    bool checkable(hipblas_handle* h, const problem& p)
+    {
+        int a_rows = p.transa == HIPBLAS_OP_N ? p.m : p.k;
+        int b_rows = p.transb == HIPBLAS_OP_N ? p.k : p.n;
+        return h && h->abft_mode != HIPBLAS_ABFT_OFF && valid_operation(p.transa)
+               && valid_operation(p.transb) && p.m > 0 && p.n > 0 && p.k > 0 && p.batch_count > 0
+               && p.lda >= std::max(1, a_rows) && p.ldb >= std::max(1, b_rows)
+               && p.ldc >= std::max(1, p.m) && p.alpha && p.beta && (p.A.ptr || p.A.array)
+               && (p.B.ptr || p.B.array) && (p.C.ptr || p.C.array);
+    }
+
+    // The checksums of one batch, at these element offsets of its chunk: the block sums and
+    // block magnitude sums of op(A), the sums over each block's row of the latter, the largest
+    // magnitude of each column of op(B), the expected block sums of the result, the block
+    // magnitude sums of C before the gemm, and the block sums of the result
+    struct layout
+    {
+        int64_t blocks, tiles, sa, sa_abs, row_abs, col_max, expected, c_abs, sums, chunk;
+
+        layout(int m, int n, int k)
+        {
+            blocks   = (m - 1) / TILE + 1;
+            tiles    = blocks * ((n - 1) / TILE + 1);
+            sa       = 0;
+            sa_abs   = sa + blocks * k;
+            row_abs  = sa_abs + blocks * k;
+            col_max  = row_abs + blocks;
+            expected = col_max + n;
+            c_abs    = expected + blocks * n;
+            sums     = c_abs + blocks * n;
+            chunk    = sums + blocks * n;
+        }
+    };
+
+    // Turns checking off for the nested gemms, which take device pointer arrays
+    struct nested_scope
+    {
+        hipblas_handle*           h;
+        bool                      arrays;
+        hipblasAbftMode_t         mode;
+        hipblasPointerArrayMode_t array_mode;
+
+        nested_scope(hipblas_handle* h, bool arrays)
+            : h(h)
+            , arrays(arrays)
+            , mode(h->abft_mode)
+            , array_mode(h->pointer_array_mode)
+        {
+            h->abft_mode = HIPBLAS_ABFT_OFF;
+            if(arrays)
+                h->pointer_array_mode = HIPBLAS_POINTER_ARRAY_DEVICE;
+        }
+
+        ~nested_scope()
+        {
+            if(arrays)
+                h->pointer_array_mode = array_mode;
+            h->abft_mode = mode;
+        }
+    };
+
+    // The block sums of the result, compared with the expected ones; failed counts the flags set
+    template <typename T>
+    hipblasStatus_t verify(hipStream_t         stream,
+                           const problem&      p,
+                           const layout&       l,
+                           bool                device_scalars,
+                           double              tolerance,
+                           T*                  W,
+                           int*                flags,
+                           unsigned long long* failed)
+    {
+        hipblasDatatype_t                   type = routines<T>::type;
+        hipblas_batched_operand<const void> C{p.C.ptr, p.C.stride, p.C.array};
+
+        hipError_t err
+            = hipMemsetAsync(flags, 0, l.tiles * p.batch_count * sizeof(int), stream);
+        if(err == hipSuccess)
+            err = hipblas_abft_block_sums(stream,
+                                          false,
+                                          p.m,
+                                          p.n,
+                                          TILE,
+                                          C,
+                                          p.ldc,
+                                          type,
+                                          W + l.sums,
+                                          nullptr,
+                                          nullptr,
+                                          l.chunk,
+                                          p.batch_count);
+        if(err == hipSuccess)
+            err = hipblas_abft_check(stream,
+                                     l.blocks,
+                                     p.n,
+                                     p.alpha,
+                                     p.beta,
+                                     device_scalars,
+                                     type,
+                                     W + l.sums,
+                                     W + l.expected,
+                                     W + l.c_abs,
+                                     W + l.row_abs,
+                                     W + l.col_max,
+                                     l.chunk,
+                                     tolerance,
+                                     flags,
+                                     l.tiles,
+                                     failed,
+                                     p.batch_count);
+        return launch_status(err);
+    }
+
+    // Restores each flagged tile of C from saved, recomputes it alone and verifies the result
+    // again; remaining is the number of tiles that still fail
+    template <typename T>
+    hipblasStatus_t correct(hipblas_handle*     h,
+                            hipStream_t         stream,
+                            const problem&      p,
+                            const layout&       l,
+                            bool                device_scalars,
+                            double              tolerance,
+                            T*                  W,
+                            const T*            saved,
+                            int*                flags,
+                            std::vector<int>&   host_flags,
+                            unsigned long long& remaining)
+    {
+        for(int64_t t = 0; t < int64_t(host_flags.size()); t++)
+        {
+            if(!host_flags[t])
+                continue;
+
+            int b = int(t / l.tiles);
+            int i = int(t % l.tiles % l.blocks);
+            int j = int(t % l.tiles / l.blocks);
+
+            // Batch b's operands, read back from the device arrays when there are some
+            const void* ptrs[3] = {static_cast<const T*>(p.A.ptr) + b * p.A.stride,
+                                   static_cast<const T*>(p.B.ptr) + b * p.B.stride,
+                                   static_cast<const T*>(p.C.ptr) + b * p.C.stride};
+            if(p.C.array)
+            {
+                const void* const* arrays[3] = {p.A.array, p.B.array, p.C.array};
+                hipError_t         err       = hipSuccess;
+                for(int o = 0; o < 3 && err == hipSuccess; o++)
+                    err = hipMemcpyAsync(
+                        &ptrs[o], arrays[o] + b, sizeof(void*), hipMemcpyDeviceToHost, stream);
+                if(err != hipSuccess || hipStreamSynchronize(stream) != hipSuccess)
+                    return HIPBLAS_STATUS_INTERNAL_ERROR;
+            }
+
+            int      rows = std::min(TILE, p.m - i * TILE);
+            int      cols = std::min(TILE, p.n - j * TILE);
+            const T* a    = at(static_cast<const T*>(ptrs[0]), p.lda, p.transa, i * TILE, 0);
+            const T* bj   = at(static_cast<const T*>(ptrs[1]), p.ldb, p.transb, 0, j * TILE);
+            T*       c    = static_cast<T*>(const_cast<void*>(ptrs[2])) + i * TILE
+                   + size_t(j) * TILE * p.ldc;
+
+            // The tile as it was before the gemm
+            const T* s = saved + b * int64_t(p.m) * p.n + i * TILE + size_t(j) * TILE * p.m;
+            if(hipMemcpy2DAsync(c,
+                                p.ldc * sizeof(T),
+                                s,
+                                p.m * sizeof(T),
+                                rows * sizeof(T),
+                                cols,
+                                hipMemcpyDeviceToDevice,
+                                stream)
+               != hipSuccess)
+                return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+            hipblasStatus_t status = routines<T>::gemm(h,
+                                                       p.transa,
+                                                       p.transb,
+                                                       rows,
+                                                       cols,
+                                                       p.k,
+                                                       static_cast<const T*>(p.alpha),
+                                                       a,
+                                                       p.lda,
+                                                       bj,
+                                                       p.ldb,
+                                                       static_cast<const T*>(p.beta),
+                                                       c,
+                                                       p.ldc);
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+        }
+
+        hipblasStatus_t status
+            = verify(stream, p, l, device_scalars, tolerance, W, flags, nullptr);
+        if(status == HIPBLAS_STATUS_SUCCESS
+           && (hipMemcpyAsync(host_flags.data(),
+                              flags,
+                              host_flags.size() * sizeof(int),
+                              hipMemcpyDeviceToHost,
+                              stream)
+                   != hipSuccess
+               || hipStreamSynchronize(stream) != hipSuccess))
+            status = HIPBLAS_STATUS_INTERNAL_ERROR;
+        remaining = std::count(host_flags.begin(), host_flags.end(), 1);
+        return status;
+    }
+
+    // Runs gemm, the product itself, between the checksums. Returns false, having done nothing,
+    // when the checksums cannot have their buffer
+    template <typename T, typename F>
+    bool checked(hipblas_handle* h, const problem& p, F gemm, hipblasStatus_t& status)
+    {
+        hipStream_t stream;
+        if(hipblasGetStream(h, &stream) != HIPBLAS_STATUS_SUCCESS)
+            return false;
+
+        // The copy of C and the synchronized recomputation are left out under capture
+        bool   may_grow = h->capture_mode != HIPBLAS_CAPTURE_MODE_SAFE;
+        bool   fix      = h->abft_mode == HIPBLAS_ABFT_CORRECT && may_grow;
+        bool   arrays   = p.C.array != nullptr;
+        layout l(p.m, p.n, p.k);
+        size_t sums_bytes  = aligned(l.chunk * p.batch_count * sizeof(T));
+        size_t flags_bytes = aligned(l.tiles * p.batch_count * sizeof(int));
+        size_t array_bytes = arrays ? aligned(2 * size_t(p.batch_count) * sizeof(T*)) : 0;
+        size_t saved_bytes = fix ? size_t(p.m) * p.n * p.batch_count * sizeof(T) : 0;
+
+        bool fresh = h->abft_failed.data() == nullptr;
+        if(h->abft_failed.reserve(sizeof(unsigned long long), may_grow) != HIPBLAS_STATUS_SUCCESS
+           || h->abft_buffer.reserve(sums_bytes + flags_bytes + array_bytes + saved_bytes, may_grow)
+                  != HIPBLAS_STATUS_SUCCESS
+           || (fresh
+               && hipMemsetAsync(h->abft_failed.data(), 0, sizeof(unsigned long long), stream)
+                      != hipSuccess))
+        {
+            h->abft_report.unchecked_calls++;
+            return false;
+        }
+
+        char*               base    = static_cast<char*>(h->abft_buffer.data());
+        char*               rest    = base + sums_bytes + flags_bytes;
+        T*                  W       = reinterpret_cast<T*>(base);
+        int*                flags   = reinterpret_cast<int*>(base + sums_bytes);
+        T**                 sa_ptrs = reinterpret_cast<T**>(rest);
+        T**                 e_ptrs  = sa_ptrs + p.batch_count;
+        T*                  saved   = reinterpret_cast<T*>(rest + array_bytes);
+        unsigned long long* failed  = static_cast<unsigned long long*>(h->abft_failed.data());
+
+        hipblasDatatype_t type           = routines<T>::type;
+        bool              device_scalars = h->pointer_mode == HIPBLAS_POINTER_MODE_DEVICE;
+
+        // The rounding of the gemm, of the checksum gemm and of the block sums stays within
+        // tolerance times the bound, with some margin; u is that of TF32 where fp32 gemms may
+        // round their inputs to it
+        double u = std::numeric_limits<T>::epsilon() / 2;
+        if(type == HIPBLAS_R_32F && (h->math_mode & HIPBLAS_TF32_TENSOR_OP_MATH))
+            u = 1.0 / 2048;
+        double tolerance = 2 * (p.k + 2.0 * TILE) * u;
+
+        // The checksums of op(A), op(B) and C, and a copy of C to restore failed tiles from
+        hipblas_batched_operand<const void> C{p.C.ptr, p.C.stride, p.C.array};
+
+        hipError_t err = hipblas_abft_block_sums(stream,
+                                                 p.transa != HIPBLAS_OP_N,
+                                                 p.m,
+                                                 p.k,
+                                                 TILE,
+                                                 p.A,
+                                                 p.lda,
+                                                 type,
+                                                 W + l.sa,
+                                                 W + l.sa_abs,
+                                                 nullptr,
+                                                 l.chunk,
+                                                 p.batch_count);
+        if(err == hipSuccess)
+            err = hipblas_abft_block_sums(stream,
+                                          true,
+                                          p.k,
+                                          l.blocks,
+                                          p.k,
+                                          {W + l.sa_abs, l.chunk, nullptr},
+                                          l.blocks,
+                                          type,
+                                          nullptr,
+                                          W + l.row_abs,
+                                          nullptr,
+                                          l.chunk,
+                                          p.batch_count);
+        if(err == hipSuccess)
+            err = hipblas_abft_block_sums(stream,
+                                          p.transb != HIPBLAS_OP_N,
+                                          p.k,
+                                          p.n,
+                                          p.k,
+                                          p.B,
+                                          p.ldb,
+                                          type,
+                                          nullptr,
+                                          nullptr,
+                                          W + l.col_max,
+                                          l.chunk,
+                                          p.batch_count);
+        if(err == hipSuccess)
+            err = hipblas_abft_block_sums(stream,
+                                          false,
+                                          p.m,
+                                          p.n,
+                                          TILE,
+                                          C,
+                                          p.ldc,
+                                          type,
+                                          W + l.expected,
+                                          W + l.c_abs,
+                                          nullptr,
+                                          l.chunk,
+                                          p.batch_count);
+        if(err == hipSuccess && fix)
+            err = hipblas_abft_copy(stream,
+                                    p.m,
+                                    p.n,
+                                    C,
+                                    p.ldc,
+                                    {saved, int64_t(p.m) * p.n, nullptr},
+                                    p.m,
+                                    type,
+                                    p.batch_count);
+        if(err == hipSuccess && arrays)
+            err = hipblas_strided_pointer_array(stream, W + l.sa, l.chunk, sa_ptrs, p.batch_count);
+        if(err == hipSuccess && arrays)
+            err = hipblas_strided_pointer_array(
+                stream, W + l.expected, l.chunk, e_ptrs, p.batch_count);
+        status = launch_status(err);
+
+        nested_scope scope(h, arrays);
+
+        // expected = alpha sa op(B) + beta expected, the block sums of the result
+        const T* alpha = static_cast<const T*>(p.alpha);
+        const T* beta  = static_cast<const T*>(p.beta);
+        if(status == HIPBLAS_STATUS_SUCCESS && arrays)
+            status = routines<T>::gemm_batched(h,
+                                               HIPBLAS_OP_N,
+                                               p.transb,
+                                               l.blocks,
+                                               p.n,
+                                               p.k,
+                                               alpha,
+                                               sa_ptrs,
+                                               l.blocks,
+                                               reinterpret_cast<const T* const*>(p.B.array),
+                                               p.ldb,
+                                               beta,
+                                               e_ptrs,
+                                               l.blocks,
+                                               p.batch_count);
+        else if(status == HIPBLAS_STATUS_SUCCESS)
+            status = routines<T>::gemm_strided_batched(h,
+                                                       HIPBLAS_OP_N,
+                                                       p.transb,
+                                                       l.blocks,
+                                                       p.n,
+                                                       p.k,
+                                                       alpha,
+                                                       W + l.sa,
+                                                       l.blocks,
+                                                       l.chunk,
+                                                       static_cast<const T*>(p.B.ptr),
+                                                       p.ldb,
+                                                       p.B.stride,
+                                                       beta,
+                                                       W + l.expected,
+                                                       l.blocks,
+                                                       l.chunk,
+                                                       p.batch_count);
+
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = gemm();
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = verify(stream, p, l, device_scalars, tolerance, W, flags, failed);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return true;
+
+        h->abft_report.calls++;
+        h->abft_report.tiles += l.tiles * p.batch_count;
+        if(!fix)
+            return true;
+
+        std::vector<int> host_flags;
+        try
+        {
+            host_flags.resize(l.tiles * p.batch_count);
+        }
+        catch(const std::bad_alloc&)
+        {
+            status = HIPBLAS_STATUS_ALLOC_FAILED;
+            return true;
+        }
+        if(hipMemcpyAsync(host_flags.data(),
+                          flags,
+                          host_flags.size() * sizeof(int),
+                          hipMemcpyDeviceToHost,
+                          stream)
+               != hipSuccess
+           || hipStreamSynchronize(stream) != hipSuccess)
+        {
+            status = HIPBLAS_STATUS_INTERNAL_ERROR;
+            return true;
+        }
+        unsigned long long flagged   = std::count(host_flags.begin(), host_flags.end(), 1);
+        unsigned long long remaining = 0;
+        if(flagged == 0)
+            return true;
+
+        status = correct(
+            h, stream, p, l, device_scalars, tolerance, W, saved, flags, host_flags, remaining);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+        {
+            h->abft_report.corrected_tiles += flagged - remaining;
+            if(remaining)
+                status = HIPBLAS_STATUS_EXECUTION_FAILED;
+        }
+        return true;
+    }
+
+    template <typename T>
+    bool checked_gemm(hipblasHandle_t    handle,
+                      hipblasOperation_t transa,
+                      hipblasOperation_t transb,
+                      int                m,
+                      int                n,
+                      int                k,
+                      const void*        alpha,
+                      const void*        A,
+                      int                lda,
+                      const void*        B,
+                      int                ldb,
+                      const void*        beta,
+                      void*              C,
+                      int                ldc,
+                      hipblasGemmAlgo_t  algo,
+                      hipblasStatus_t&   status)
+    {
+        hipblas_handle* h = static_cast<hipblas_handle*>(handle);
+        problem         p{transa,
+                          transb,
+                          m,
+                          n,
+                          k,
+                          alpha,
+                          {A, 0, nullptr},
+                          lda,
+                          {B, 0, nullptr},
+                          ldb,
+                          beta,
+                          {C, 0, nullptr},
+                          ldc,
+                          1};
+        if(!checkable(h, p))
+            return false;
+
+        hipblasDatatype_t type = routines<T>::type;
+        return checked<T>(
+            h,
+            p,
+            [&] {
+                return hipblasGemmEx(handle,
+                                     transa,
+                                     transb,
+                                     m,
+                                     n,
+                                     k,
+                                     alpha,
+                                     A,
+                                     type,
+                                     lda,
+                                     B,
+                                     type,
+                                     ldb,
+                                     beta,
+                                     C,
+                                     type,
+                                     ldc,
+                                     type,
+                                     algo);
+            },
+            status);
+    }
+}
+
+bool hipblas_gemm_abft(hipblasHandle_t    handle,
+                       hipblasOperation_t transa,
+                       hipblasOperation_t transb,
+                       int                m,
+                       int                n,
+                       int                k,
+                       const void*        alpha,
+                       const void*        A,
+                       hipblasDatatype_t  a_type,
+                       int                lda,
+                       const void*        B,
+                       hipblasDatatype_t  b_type,
+                       int                ldb,
+                       const void*        beta,
+                       void*              C,
+                       hipblasDatatype_t  c_type,
+                       int                ldc,
+                       hipblasDatatype_t  compute_type,
+                       hipblasGemmAlgo_t  algo,
+                       hipblasStatus_t&   status)
+{
+    if((c_type != HIPBLAS_R_32F && c_type != HIPBLAS_R_64F) || a_type != c_type
+       || b_type != c_type || compute_type != c_type)
+        return false;
+
+    auto run = c_type == HIPBLAS_R_32F ? checked_gemm<float> : checked_gemm<double>;
+    return run(
+        handle, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, algo, status);
+}
+
+template <typename T>
+bool hipblas_gemm_abft_strided_batched(hipblasHandle_t    handle,
+                                       hipblasOperation_t transa,
+                                       hipblasOperation_t transb,
+                                       int                m,
+                                       int                n,
+                                       int                k,
+                                       const T*           alpha,
+                                       const T*           A,
+                                       int                lda,
+                                       long long          bsa,
+                                       const T*           B,
+                                       int                ldb,
+                                       long long          bsb,
+                                       const T*           beta,
+                                       T*                 C,
+                                       int                ldc,
+                                       long long          bsc,
+                                       int                batch_count,
+                                       hipblasStatus_t&   status)
+{
+    hipblas_handle* h = static_cast<hipblas_handle*>(handle);
+    problem         p{transa,
+                      transb,
+                      m,
+                      n,
+                      k,
+                      alpha,
+                      {A, bsa, nullptr},
+                      lda,
+                      {B, bsb, nullptr},
+                      ldb,
+                      beta,
+                      {C, bsc, nullptr},
+                      ldc,
+                      batch_count};
+    if(!checkable(h, p) || hipblas_scalar_stride(handle))
+        return false;
+
+    return checked<T>(
+        h,
+        p,
+        [&] {
+            return routines<T>::gemm_strided_batched(handle,
+                                                     transa,
+                                                     transb,
+                                                     m,
+                                                     n,
+                                                     k,
+                                                     alpha,
+                                                     A,
+                                                     lda,
+                                                     bsa,
+                                                     B,
+                                                     ldb,
+                                                     bsb,
+                                                     beta,
+                                                     C,
+                                                     ldc,
+                                                     bsc,
+                                                     batch_count);
+        },
+        status);
+}
+
+template <typename T>
+bool hipblas_gemm_abft_batched(hipblasHandle_t    handle,
+                               hipblasOperation_t transa,
+                               hipblasOperation_t transb,
+                               int                m,
+                               int                n,
+                               int                k,
+                               const T*           alpha,
+                               const T* const     A[],
+                               int                lda,
+                               const T* const     B[],
+                               int                ldb,
+                               const T*           beta,
+                               T* const           C[],
+                               int                ldc,
+                               int                batch_count,
+                               hipblasStatus_t&   status)
+{
+    hipblas_handle* h = static_cast<hipblas_handle*>(handle);
+    problem         p{transa,
+                      transb,
+                      m,
+                      n,
+                      k,
+                      alpha,
+                      {nullptr, 0, reinterpret_cast<const void* const*>(A)},
+                      lda,
+                      {nullptr, 0, reinterpret_cast<const void* const*>(B)},
+                      ldb,
+                      beta,
+                      {nullptr, 0, reinterpret_cast<void* const*>(C)},
+                      ldc,
+                      batch_count};
+    if(!A || !B || !C || !checkable(h, p) || hipblas_scalar_stride(handle))
+        return false;
+
+    return checked<T>(
+        h,
+        p,
+        [&] {
+            return routines<T>::gemm_batched(
+                handle, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batch_count);
+        },
+        status);
+}
+
+// clang-format off
+template bool hipblas_gemm_abft_strided_batched<float>(hipblasHandle_t, hipblasOperation_t, hipblasOperation_t, int, int, int, const float*, const float*, int, long long, const float*, int, long long, const float*, float*, int, long long, int, hipblasStatus_t&);
+template bool hipblas_gemm_abft_strided_batched<double>(hipblasHandle_t, hipblasOperation_t, hipblasOperation_t, int, int, int, const double*, const double*, int, long long, const double*, int, long long, const double*, double*, int, long long, int, hipblasStatus_t&);
+template bool hipblas_gemm_abft_batched<float>(hipblasHandle_t, hipblasOperation_t, hipblasOperation_t, int, int, int, const float*, const float* const[], int, const float* const[], int, const float*, float* const[], int, int, hipblasStatus_t&);
+template bool hipblas_gemm_abft_batched<double>(hipblasHandle_t, hipblasOperation_t, hipblasOperation_t, int, int, int, const double*, const double* const[], int, const double* const[], int, const double*, double* const[], int, int, hipblasStatus_t&);
+// clang-format on
@@ -0,0 +1,270 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipblas_gemm_autotune.h"
+#include "hipblas_handle.h"
+#include "hipblas_logging.h"
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace
+{
+    // hipblas-tune's candidates: the backend heuristic first, then the rocBLAS solution indices
+    // or the cuBLAS algos
+    constexpr int AUTOTUNE_SOLUTIONS = 64;
+
+    std::vector<hipblas_gemm_tuned> autotune_candidates()
+    {
+        std::vector<hipblas_gemm_tuned> candidates = {{HIPBLAS_GEMM_DEFAULT, 0}};
+#ifdef __HIP_PLATFORM_NVCC__
+        candidates.push_back({HIPBLAS_GEMM_DEFAULT_TENSOR_OP, 0});
+        for(int i = HIPBLAS_GEMM_ALGO0; i <= HIPBLAS_GEMM_ALGO23; i++)
+            candidates.push_back({hipblasGemmAlgo_t(i), 0});
+        for(int i = HIPBLAS_GEMM_ALGO0_TENSOR_OP; i <= HIPBLAS_GEMM_ALGO15_TENSOR_OP; i++)
+            candidates.push_back({hipblasGemmAlgo_t(i), 0});
+#else
+        for(int i = 1; i <= AUTOTUNE_SOLUTIONS; i++)
+            candidates.push_back({HIPBLAS_GEMM_DEFAULT, i});
+#endif
+        return candidates;
+    }
+
+    struct autotune_trial
+    {
+        int        candidate;
+        hipEvent_t start, stop;
+    };
+
+    // Candidates are timed in turn, skipping rejected ones; once trials have begun as many as the
+    // handle asks for and all have been read, the fastest candidate settles the problem
+    struct autotune_entry
+    {
+        hipblasGemmShape_t              shape;
+        std::vector<hipblas_gemm_tuned> candidates;
+        std::vector<float>              best_ms; // per candidate, infinite until timed
+        std::vector<bool>               rejected;
+        std::vector<autotune_trial>     pending; // timed trials not yet read
+        int                             started = 0; // trials begun and not failed
+        int                             cursor  = 0;
+        int                             winner  = 0;
+        bool                            settled = false;
+    };
+
+    using autotune_key = std::array<int, 10>; // the device, then the shape
+
+    hipblasStatus_t save(const std::map<autotune_key, autotune_entry>& entries, const char* path)
+    {
+        std::ofstream file(path);
+        if(!file)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        file << "# transA,transB,m,n,k,a_type,b_type,c_type,compute_type,algo,solution_index\n";
+        for(const auto& entry : entries)
+        {
+            const autotune_entry& e = entry.second;
+            if(e.settled)
+                file << hipblas_gemm_tuning_row(e.shape, e.candidates[e.winner]) << '\n';
+        }
+        return file ? HIPBLAS_STATUS_SUCCESS : HIPBLAS_STATUS_INVALID_VALUE;
+    }
+
+    // Written to HIPBLAS_GEMM_AUTOTUNE_FILE at exit. The events of unread trials are left to the
+    // runtime, which may already be gone
+    struct autotune_map
+    {
+        std::mutex                             mutex;
+        std::map<autotune_key, autotune_entry> entries;
+
+        ~autotune_map()
+        {
+            const char* path = std::getenv("HIPBLAS_GEMM_AUTOTUNE_FILE");
+            if(path && *path)
+                save(entries, path);
+        }
+    };
+
+    autotune_map& autotune_choices()
+    {
+        static autotune_map map;
+        return map;
+    }
+
+    // The fastest candidate timed so far, or the heuristic
+    int fastest(const autotune_entry& e)
+    {
+        int best = 0;
+        for(size_t c = 1; c < e.best_ms.size(); c++)
+            if(!e.rejected[c] && e.best_ms[c] < e.best_ms[best])
+                best = int(c);
+        return best;
+    }
+
+    // Reads the trials that have run; a trial whose events fail is dropped
+    void collect(autotune_entry& e)
+    {
+        for(size_t i = 0; i < e.pending.size();)
+        {
+            autotune_trial& t     = e.pending[i];
+            hipError_t      query = hipEventQuery(t.stop);
+            if(query == hipErrorNotReady)
+            {
+                i++;
+                continue;
+            }
+
+            float ms = 0;
+            if(query == hipSuccess && hipEventElapsedTime(&ms, t.start, t.stop) == hipSuccess)
+                e.best_ms[t.candidate] = std::min(e.best_ms[t.candidate], ms);
+            else
+                e.started--;
+            (void)hipEventDestroy(t.start);
+            (void)hipEventDestroy(t.stop);
+            e.pending[i] = e.pending.back();
+            e.pending.pop_back();
+        }
+    }
+}
+
+/* ============================================================================================ */
+hipblas_gemm_autotune_call::~hipblas_gemm_autotune_call()
+{
+    for(hipEvent_t event : events)
+        if(event)
+            (void)hipEventDestroy(event);
+}
+
+bool hipblas_gemm_autotune_call::begin(hipblasHandle_t           handle,
+                                       hipblasGemmAlgo_t         algo,
+                                       const hipblasGemmShape_t& shape)
+{
+    const hipblas_handle* h = static_cast<const hipblas_handle*>(handle);
+    if(h == nullptr || h->gemm_autotune == 0 || algo != HIPBLAS_GEMM_DEFAULT
+       || h->capture_mode == HIPBLAS_CAPTURE_MODE_SAFE)
+        return false;
+
+    autotune_key key = {h->device,
+                        shape.transA,
+                        shape.transB,
+                        shape.m,
+                        shape.n,
+                        shape.k,
+                        shape.a_type,
+                        shape.b_type,
+                        shape.c_type,
+                        shape.compute_type};
+
+    autotune_map&               map = autotune_choices();
+    std::lock_guard<std::mutex> lock(map.mutex);
+    autotune_entry*             e;
+    try
+    {
+        e = &map.entries[key];
+        if(e->candidates.empty())
+        {
+            e->shape      = shape;
+            e->candidates = autotune_candidates();
+            e->best_ms.assign(e->candidates.size(), std::numeric_limits<float>::infinity());
+            e->rejected.assign(e->candidates.size(), false);
+        }
+        e->pending.reserve(e->pending.size() + 1);
+    }
+    catch(const std::bad_alloc&)
+    {
+        return false;
+    }
+    entry = e;
+
+    if(!e->settled)
+    {
+        collect(*e);
+        if(e->started >= h->gemm_autotune && e->pending.empty())
+        {
+            e->winner  = fastest(*e);
+            e->settled = true;
+        }
+    }
+    if(e->settled || e->started >= h->gemm_autotune)
+    {
+        candidate = e->settled ? e->winner : fastest(*e);
+        chosen    = e->candidates[candidate];
+        return true;
+    }
+
+    // The heuristic is never rejected, so the search ends
+    int n = int(e->candidates.size());
+    int c = e->cursor;
+    while(e->rejected[c])
+        c = (c + 1) % n;
+    e->cursor = (c + 1) % n;
+    candidate = c;
+    chosen    = e->candidates[c];
+
+    if(hipblasGetStream(handle, &stream) != HIPBLAS_STATUS_SUCCESS
+       || hipEventCreate(&events[0]) != hipSuccess || hipEventCreate(&events[1]) != hipSuccess)
+    {
+        // Run untimed; the destructor releases what was created
+        return true;
+    }
+    e->started++;
+    return true;
+}
+
+void hipblas_gemm_autotune_call::start()
+{
+    if(events[1] && hipEventRecord(events[0], stream) != hipSuccess)
+    {
+        std::lock_guard<std::mutex> lock(autotune_choices().mutex);
+        static_cast<autotune_entry*>(entry)->started--;
+        (void)hipEventDestroy(events[0]);
+        (void)hipEventDestroy(events[1]);
+        events[0] = events[1] = nullptr;
+    }
+}
+
+void hipblas_gemm_autotune_call::finish(hipblasStatus_t status)
+{
+    if(!events[1])
+        return;
+
+    bool timed
+        = status == HIPBLAS_STATUS_SUCCESS && hipEventRecord(events[1], stream) == hipSuccess;
+
+    std::lock_guard<std::mutex> lock(autotune_choices().mutex);
+    autotune_entry*             e = static_cast<autotune_entry*>(entry);
+    if(timed)
+    {
+        // begin() reserved the room
+        e->pending.push_back({candidate, events[0], events[1]});
+        events[0] = events[1] = nullptr;
+    }
+    else
+        e->started--;
+}
+
+void hipblas_gemm_autotune_call::reject()
+{
+    std::lock_guard<std::mutex> lock(autotune_choices().mutex);
+    static_cast<autotune_entry*>(entry)->rejected[candidate] = true;
+}
+
+hipblasStatus_t hipblas_gemm_autotune_save(const char* path)
+{
+    autotune_map&               map = autotune_choices();
+    std::lock_guard<std::mutex> lock(map.mutex);
+    return save(map.entries, path);
+}
+
+hipblasStatus_t hipblasSaveGemmAutotune(const char* path)
+{
+    HIPBLAS_LOG_CALL_NO_HANDLE(path);
+    if(path == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    return hipblas_gemm_autotune_save(path);
+}
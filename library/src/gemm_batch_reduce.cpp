@@ -0,0 +1,551 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "hipblas_handle.h"
+#include "hipblas_kernels.h"
+#include "hipblas_logging.h"
+#include <algorithm>
+#include <climits>
+#include <hip/hip_runtime_api.h>
+
+namespace
+{
+    template <typename T>
+    hipblas_batched_operand<const T> strided(const T* p, long long stride)
+    {
+        return {p, stride, nullptr};
+    }
+
+    template <typename T>
+    hipblas_batched_operand<const T> arrays(const T* const* a)
+    {
+        return {nullptr, 0, a};
+    }
+
+    bool valid_operation(hipblasOperation_t op)
+    {
+        return op == HIPBLAS_OP_N || op == HIPBLAS_OP_T || op == HIPBLAS_OP_C;
+    }
+
+    hipblasStatus_t gemm(hipblasHandle_t    handle,
+                         hipblasOperation_t transa,
+                         hipblasOperation_t transb,
+                         int                m,
+                         int                n,
+                         int                k,
+                         const float*       alpha,
+                         const float*       A,
+                         int                lda,
+                         const float*       B,
+                         int                ldb,
+                         const float*       beta,
+                         float*             C,
+                         int                ldc)
+    {
+        return hipblasSgemm(handle, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+    }
+
+    hipblasStatus_t gemm(hipblasHandle_t    handle,
+                         hipblasOperation_t transa,
+                         hipblasOperation_t transb,
+                         int                m,
+                         int                n,
+                         int                k,
+                         const double*      alpha,
+                         const double*      A,
+                         int                lda,
+                         const double*      B,
+                         int                ldb,
+                         const double*      beta,
+                         double*            C,
+                         int                ldc)
+    {
+        return hipblasDgemm(handle, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+    }
+
+    hipblasStatus_t gemm(hipblasHandle_t       handle,
+                         hipblasOperation_t    transa,
+                         hipblasOperation_t    transb,
+                         int                   m,
+                         int                   n,
+                         int                   k,
+                         const hipblasComplex* alpha,
+                         const hipblasComplex* A,
+                         int                   lda,
+                         const hipblasComplex* B,
+                         int                   ldb,
+                         const hipblasComplex* beta,
+                         hipblasComplex*       C,
+                         int                   ldc)
+    {
+        return hipblasCgemm(handle, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+    }
+
+    hipblasStatus_t gemm(hipblasHandle_t             handle,
+                         hipblasOperation_t          transa,
+                         hipblasOperation_t          transb,
+                         int                         m,
+                         int                         n,
+                         int                         k,
+                         const hipblasDoubleComplex* alpha,
+                         const hipblasDoubleComplex* A,
+                         int                         lda,
+                         const hipblasDoubleComplex* B,
+                         int                         ldb,
+                         const hipblasDoubleComplex* beta,
+                         hipblasDoubleComplex*       C,
+                         int                         ldc)
+    {
+        return hipblasZgemm(handle, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+    }
+
+    // Whether the batches of a strided operand, each k deep, lie one after another as a single
+    // operand k * batch_count deep: column blocks when its k side runs along the columns of the
+    // stored matrix, row blocks inside one leading dimension otherwise
+    bool concatenates(bool k_along_columns, int k, int ld, long long stride, int batch_count)
+    {
+        if(batch_count == 1)
+            return true;
+        if(k_along_columns)
+            return stride == int64_t(k) * ld;
+        return stride == k && ld >= int64_t(k) * batch_count;
+    }
+
+    // C = alpha * sum of op(A_b) * op(B_b) + beta * C. Strided batches that concatenate along k
+    // are one gemm k * batch_count deep, so the backend's own kernels do the reduction; the others
+    // go to a kernel that accumulates every batch in registers before writing C
+    template <typename T>
+    hipblasStatus_t gemm_batch_reduce(hipblasHandle_t                  handle,
+                                      hipblasOperation_t               transa,
+                                      hipblasOperation_t               transb,
+                                      int                              m,
+                                      int                              n,
+                                      int                              k,
+                                      const T*                         alpha,
+                                      hipblas_batched_operand<const T> A,
+                                      int                              lda,
+                                      hipblas_batched_operand<const T> B,
+                                      int                              ldb,
+                                      const T*                         beta,
+                                      T*                               C,
+                                      int                              ldc,
+                                      int                              batch_count)
+    {
+        if(handle == nullptr)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if(!valid_operation(transa) || !valid_operation(transb))
+            return HIPBLAS_STATUS_INVALID_ENUM;
+
+        int a_rows = transa == HIPBLAS_OP_N ? m : k;
+        int b_rows = transb == HIPBLAS_OP_N ? k : n;
+        if(m < 0 || n < 0 || k < 0 || batch_count < 0 || lda < std::max(1, a_rows)
+           || ldb < std::max(1, b_rows) || ldc < std::max(1, m))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(m == 0 || n == 0)
+            return HIPBLAS_STATUS_SUCCESS;
+
+        bool products = k > 0 && batch_count > 0;
+        if(!alpha || !beta || !C || (products && ((!A.ptr && !A.array) || (!B.ptr && !B.array))))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        if(products && !A.array && !B.array && int64_t(k) * batch_count <= INT_MAX
+           && concatenates(transa == HIPBLAS_OP_N, k, lda, A.stride, batch_count)
+           && concatenates(transb != HIPBLAS_OP_N, k, ldb, B.stride, batch_count))
+            return gemm(handle,
+                        transa,
+                        transb,
+                        m,
+                        n,
+                        k * batch_count,
+                        alpha,
+                        A.ptr,
+                        lda,
+                        B.ptr,
+                        ldb,
+                        beta,
+                        C,
+                        ldc);
+
+        hipStream_t          stream;
+        hipblasPointerMode_t mode;
+        hipblasStatus_t      status = hipblasGetStream(handle, &stream);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblasGetPointerMode(handle, &mode);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        hipError_t err = hipblas_gemm_batch_reduce(stream,
+                                                   transa,
+                                                   transb,
+                                                   m,
+                                                   n,
+                                                   products ? k : 0,
+                                                   alpha,
+                                                   beta,
+                                                   mode == HIPBLAS_POINTER_MODE_DEVICE,
+                                                   A,
+                                                   lda,
+                                                   B,
+                                                   ldb,
+                                                   C,
+                                                   ldc,
+                                                   products ? batch_count : 0);
+        return err == hipSuccess ? HIPBLAS_STATUS_SUCCESS : HIPBLAS_STATUS_INTERNAL_ERROR;
+    }
+}
+
+// gemm_batch_reduce
+hipblasStatus_t hipblasSgemmBatchReduce(hipblasHandle_t    handle,
+                                        hipblasOperation_t transa,
+                                        hipblasOperation_t transb,
+                                        int                m,
+                                        int                n,
+                                        int                k,
+                                        const float*       alpha,
+                                        const float* const A[],
+                                        int                lda,
+                                        const float* const B[],
+                                        int                ldb,
+                                        const float*       beta,
+                                        float*             C,
+                                        int                ldc,
+                                        int                batch_count)
+{
+    HIPBLAS_LOG_CALL(
+        handle, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batch_count);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, A, B);
+    return gemm_batch_reduce(handle,
+                             transa,
+                             transb,
+                             m,
+                             n,
+                             k,
+                             alpha,
+                             arrays(A),
+                             lda,
+                             arrays(B),
+                             ldb,
+                             beta,
+                             C,
+                             ldc,
+                             batch_count);
+}
+
+hipblasStatus_t hipblasDgemmBatchReduce(hipblasHandle_t     handle,
+                                        hipblasOperation_t  transa,
+                                        hipblasOperation_t  transb,
+                                        int                 m,
+                                        int                 n,
+                                        int                 k,
+                                        const double*       alpha,
+                                        const double* const A[],
+                                        int                 lda,
+                                        const double* const B[],
+                                        int                 ldb,
+                                        const double*       beta,
+                                        double*             C,
+                                        int                 ldc,
+                                        int                 batch_count)
+{
+    HIPBLAS_LOG_CALL(
+        handle, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batch_count);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, A, B);
+    return gemm_batch_reduce(handle,
+                             transa,
+                             transb,
+                             m,
+                             n,
+                             k,
+                             alpha,
+                             arrays(A),
+                             lda,
+                             arrays(B),
+                             ldb,
+                             beta,
+                             C,
+                             ldc,
+                             batch_count);
+}
+
+hipblasStatus_t hipblasCgemmBatchReduce(hipblasHandle_t             handle,
+                                        hipblasOperation_t          transa,
+                                        hipblasOperation_t          transb,
+                                        int                         m,
+                                        int                         n,
+                                        int                         k,
+                                        const hipblasComplex*       alpha,
+                                        const hipblasComplex* const A[],
+                                        int                         lda,
+                                        const hipblasComplex* const B[],
+                                        int                         ldb,
+                                        const hipblasComplex*       beta,
+                                        hipblasComplex*             C,
+                                        int                         ldc,
+                                        int                         batch_count)
+{
+    HIPBLAS_LOG_CALL(
+        handle, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batch_count);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, A, B);
+    return gemm_batch_reduce(handle,
+                             transa,
+                             transb,
+                             m,
+                             n,
+                             k,
+                             alpha,
+                             arrays(A),
+                             lda,
+                             arrays(B),
+                             ldb,
+                             beta,
+                             C,
+                             ldc,
+                             batch_count);
+}
+
+hipblasStatus_t hipblasZgemmBatchReduce(hipblasHandle_t                   handle,
+                                        hipblasOperation_t                transa,
+                                        hipblasOperation_t                transb,
+                                        int                               m,
+                                        int                               n,
+                                        int                               k,
+                                        const hipblasDoubleComplex*       alpha,
+                                        const hipblasDoubleComplex* const A[],
+                                        int                               lda,
+                                        const hipblasDoubleComplex* const B[],
+                                        int                               ldb,
+                                        const hipblasDoubleComplex*       beta,
+                                        hipblasDoubleComplex*             C,
+                                        int                               ldc,
+                                        int                               batch_count)
+{
+    HIPBLAS_LOG_CALL(
+        handle, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc, batch_count);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, A, B);
+    return gemm_batch_reduce(handle,
+                             transa,
+                             transb,
+                             m,
+                             n,
+                             k,
+                             alpha,
+                             arrays(A),
+                             lda,
+                             arrays(B),
+                             ldb,
+                             beta,
+                             C,
+                             ldc,
+                             batch_count);
+}
+
+// gemm_strided_batch_reduce
+hipblasStatus_t hipblasSgemmStridedBatchReduce(hipblasHandle_t    handle,
+                                               hipblasOperation_t transa,
+                                               hipblasOperation_t transb,
+                                               int                m,
+                                               int                n,
+                                               int                k,
+                                               const float*       alpha,
+                                               const float*       A,
+                                               int                lda,
+                                               long long          strideA,
+                                               const float*       B,
+                                               int                ldb,
+                                               long long          strideB,
+                                               const float*       beta,
+                                               float*             C,
+                                               int                ldc,
+                                               int                batch_count)
+{
+    HIPBLAS_LOG_CALL(handle,
+                     transa,
+                     transb,
+                     m,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     strideA,
+                     B,
+                     ldb,
+                     strideB,
+                     beta,
+                     C,
+                     ldc,
+                     batch_count);
+    return gemm_batch_reduce(handle,
+                             transa,
+                             transb,
+                             m,
+                             n,
+                             k,
+                             alpha,
+                             strided(A, strideA),
+                             lda,
+                             strided(B, strideB),
+                             ldb,
+                             beta,
+                             C,
+                             ldc,
+                             batch_count);
+}
+
+hipblasStatus_t hipblasDgemmStridedBatchReduce(hipblasHandle_t    handle,
+                                               hipblasOperation_t transa,
+                                               hipblasOperation_t transb,
+                                               int                m,
+                                               int                n,
+                                               int                k,
+                                               const double*      alpha,
+                                               const double*      A,
+                                               int                lda,
+                                               long long          strideA,
+                                               const double*      B,
+                                               int                ldb,
+                                               long long          strideB,
+                                               const double*      beta,
+                                               double*            C,
+                                               int                ldc,
+                                               int                batch_count)
+{
+    HIPBLAS_LOG_CALL(handle,
+                     transa,
+                     transb,
+                     m,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     strideA,
+                     B,
+                     ldb,
+                     strideB,
+                     beta,
+                     C,
+                     ldc,
+                     batch_count);
+    return gemm_batch_reduce(handle,
+                             transa,
+                             transb,
+                             m,
+                             n,
+                             k,
+                             alpha,
+                             strided(A, strideA),
+                             lda,
+                             strided(B, strideB),
+                             ldb,
+                             beta,
+                             C,
+                             ldc,
+                             batch_count);
+}
+
+hipblasStatus_t hipblasCgemmStridedBatchReduce(hipblasHandle_t       handle,
+                                               hipblasOperation_t    transa,
+                                               hipblasOperation_t    transb,
+                                               int                   m,
+                                               int                   n,
+                                               int                   k,
+                                               const hipblasComplex* alpha,
+                                               const hipblasComplex* A,
+                                               int                   lda,
+                                               long long             strideA,
+                                               const hipblasComplex* B,
+                                               int                   ldb,
+                                               long long             strideB,
+                                               const hipblasComplex* beta,
+                                               hipblasComplex*       C,
+                                               int                   ldc,
+                                               int                   batch_count)
+{
+    HIPBLAS_LOG_CALL(handle,
+                     transa,
+                     transb,
+                     m,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     strideA,
+                     B,
+                     ldb,
+                     strideB,
+                     beta,
+                     C,
+                     ldc,
+                     batch_count);
+    return gemm_batch_reduce(handle,
+                             transa,
+                             transb,
+                             m,
+                             n,
+                             k,
+                             alpha,
+                             strided(A, strideA),
+                             lda,
+                             strided(B, strideB),
+                             ldb,
+                             beta,
+                             C,
+                             ldc,
+                             batch_count);
+}
+
+hipblasStatus_t hipblasZgemmStridedBatchReduce(hipblasHandle_t             handle,
+                                               hipblasOperation_t          transa,
+                                               hipblasOperation_t          transb,
+                                               int                         m,
+                                               int                         n,
+                                               int                         k,
+                                               const hipblasDoubleComplex* alpha,
+                                               const hipblasDoubleComplex* A,
+                                               int                         lda,
+                                               long long                   strideA,
+                                               const hipblasDoubleComplex* B,
+                                               int                         ldb,
+                                               long long                   strideB,
+                                               const hipblasDoubleComplex* beta,
+                                               hipblasDoubleComplex*       C,
+                                               int                         ldc,
+                                               int                         batch_count)
+{
+    HIPBLAS_LOG_CALL(handle,
+                     transa,
+                     transb,
+                     m,
+                     n,
+                     k,
+                     alpha,
+                     A,
+                     lda,
+                     strideA,
+                     B,
+                     ldb,
+                     strideB,
+                     beta,
+                     C,
+                     ldc,
+                     batch_count);
+    return gemm_batch_reduce(handle,
+                             transa,
+                             transb,
+                             m,
+                             n,
+                             k,
+                             alpha,
+                             strided(A, strideA),
+                             lda,
+                             strided(B, strideB),
+                             ldb,
+                             beta,
+                             C,
+                             ldc,
+                             batch_count);
+}
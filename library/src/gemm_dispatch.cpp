@@ -0,0 +1,442 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipblas_gemm_dispatch.h"
+#include "hipblas_handle.h"
+#include "hipblas_logging.h"
+#include <hip/hip_runtime_api.h>
+#include <limits>
+#include <string>
+
+namespace
+{
+    // The level 1 and 2 routines of one precision; for the real types the conjugating forms are
+    // the plain ones
+    template <typename T>
+    struct routines;
+
+    template <>
+    struct routines<float>
+    {
+        static constexpr char precision  = 'S';
+        static constexpr bool is_complex = false;
+
+        static constexpr auto gemv                 = hipblasSgemv;
+        static constexpr auto gemv_batched         = hipblasSgemvBatched;
+        static constexpr auto gemv_strided_batched = hipblasSgemvStridedBatched;
+        static constexpr auto geru                 = hipblasSger;
+        static constexpr auto geru_batched         = hipblasSgerBatched;
+        static constexpr auto geru_strided_batched = hipblasSgerStridedBatched;
+        static constexpr auto gerc                 = hipblasSger;
+        static constexpr auto gerc_batched         = hipblasSgerBatched;
+        static constexpr auto gerc_strided_batched = hipblasSgerStridedBatched;
+        static constexpr auto dotu                 = hipblasSdot;
+        static constexpr auto dotu_strided_batched = hipblasSdotStridedBatched;
+        static constexpr auto dotc                 = hipblasSdot;
+        static constexpr auto dotc_strided_batched = hipblasSdotStridedBatched;
+    };
+
+    template <>
+    struct routines<double>
+    {
+        static constexpr char precision  = 'D';
+        static constexpr bool is_complex = false;
+
+        static constexpr auto gemv                 = hipblasDgemv;
+        static constexpr auto gemv_batched         = hipblasDgemvBatched;
+        static constexpr auto gemv_strided_batched = hipblasDgemvStridedBatched;
+        static constexpr auto geru                 = hipblasDger;
+        static constexpr auto geru_batched         = hipblasDgerBatched;
+        static constexpr auto geru_strided_batched = hipblasDgerStridedBatched;
+        static constexpr auto gerc                 = hipblasDger;
+        static constexpr auto gerc_batched         = hipblasDgerBatched;
+        static constexpr auto gerc_strided_batched = hipblasDgerStridedBatched;
+        static constexpr auto dotu                 = hipblasDdot;
+        static constexpr auto dotu_strided_batched = hipblasDdotStridedBatched;
+        static constexpr auto dotc                 = hipblasDdot;
+        static constexpr auto dotc_strided_batched = hipblasDdotStridedBatched;
+    };
+
+    template <>
+    struct routines<hipblasComplex>
+    {
+        static constexpr char precision  = 'C';
+        static constexpr bool is_complex = true;
+
+        static constexpr auto gemv                 = hipblasCgemv;
+        static constexpr auto gemv_batched         = hipblasCgemvBatched;
+        static constexpr auto gemv_strided_batched = hipblasCgemvStridedBatched;
+        static constexpr auto geru                 = hipblasCgeru;
+        static constexpr auto geru_batched         = hipblasCgeruBatched;
+        static constexpr auto geru_strided_batched = hipblasCgeruStridedBatched;
+        static constexpr auto gerc                 = hipblasCgerc;
+        static constexpr auto gerc_batched         = hipblasCgercBatched;
+        static constexpr auto gerc_strided_batched = hipblasCgercStridedBatched;
+        static constexpr auto dotu                 = hipblasCdotu;
+        static constexpr auto dotu_strided_batched = hipblasCdotuStridedBatched;
+        static constexpr auto dotc                 = hipblasCdotc;
+        static constexpr auto dotc_strided_batched = hipblasCdotcStridedBatched;
+    };
+
+    template <>
+    struct routines<hipblasDoubleComplex>
+    {
+        static constexpr char precision  = 'Z';
+        static constexpr bool is_complex = true;
+
+        static constexpr auto gemv                 = hipblasZgemv;
+        static constexpr auto gemv_batched         = hipblasZgemvBatched;
+        static constexpr auto gemv_strided_batched = hipblasZgemvStridedBatched;
+        static constexpr auto geru                 = hipblasZgeru;
+        static constexpr auto geru_batched         = hipblasZgeruBatched;
+        static constexpr auto geru_strided_batched = hipblasZgeruStridedBatched;
+        static constexpr auto gerc                 = hipblasZgerc;
+        static constexpr auto gerc_batched         = hipblasZgercBatched;
+        static constexpr auto gerc_strided_batched = hipblasZgercStridedBatched;
+        static constexpr auto dotu                 = hipblasZdotu;
+        static constexpr auto dotu_strided_batched = hipblasZdotuStridedBatched;
+        static constexpr auto dotc                 = hipblasZdotc;
+        static constexpr auto dotc_strided_batched = hipblasZdotcStridedBatched;
+    };
+
+    enum class route
+    {
+        none,
+        dot,
+        gemv,
+        ger
+    };
+
+    struct plan
+    {
+        route kind    = route::none;
+        bool  conj    = false; // dotc or gerc
+        bool  swap    = false; // dotc with B as the conjugated operand
+        bool  clear_c = false; // ger preceded by zeroing C, for beta == 0
+        int   incx    = 1; // through A, or through B for gemv
+        int   incy    = 1; // through B
+    };
+
+    bool is_value(float v, double value)
+    {
+        return v == value;
+    }
+
+    bool is_value(double v, double value)
+    {
+        return v == value;
+    }
+
+    template <typename R>
+    bool is_value(const hip_complex_number<R>& v, double value)
+    {
+        return v.x == value && v.y == 0;
+    }
+
+    bool fits_int(long long stride)
+    {
+        return stride >= 0 && stride <= std::numeric_limits<int>::max();
+    }
+
+    // dot_ok and clear_ok say whether the form can write dot results into C and zero C ahead of
+    // a ger
+    template <typename T>
+    plan plan_for(hipblasHandle_t    handle,
+                  hipblasOperation_t transa,
+                  hipblasOperation_t transb,
+                  int                m,
+                  int                n,
+                  int                k,
+                  int                lda,
+                  int                ldb,
+                  int                ldc,
+                  const T*           alpha,
+                  const T*           beta,
+                  bool               dot_ok,
+                  bool               clear_ok)
+    {
+        plan                  p;
+        const hipblas_handle* h = static_cast<const hipblas_handle*>(handle);
+        if(!h || h->shape_dispatch != HIPBLAS_SHAPE_DISPATCH_ON || !alpha || !beta)
+            return p;
+
+        // Argument errors are left to the gemm, which reports them as before
+        if(m < 1 || n < 1 || k < 1 || lda < (transa == HIPBLAS_OP_N ? m : k)
+           || ldb < (transb == HIPBLAS_OP_N ? k : n) || ldc < m)
+            return p;
+
+        bool host   = h->pointer_mode == HIPBLAS_POINTER_MODE_HOST;
+        bool conj_a = routines<T>::is_complex && transa == HIPBLAS_OP_C;
+        bool conj_b = routines<T>::is_complex && transb == HIPBLAS_OP_C;
+
+        if(m == 1 && n == 1 && dot_ok && host && !(conj_a && conj_b) && is_value(*alpha, 1)
+           && is_value(*beta, 0))
+        {
+            // Row 0 of op(A) with column 0 of op(B)
+            p.kind = route::dot;
+            p.conj = conj_a || conj_b;
+            p.swap = conj_b;
+            p.incx = transa == HIPBLAS_OP_N ? lda : 1;
+            p.incy = transb == HIPBLAS_OP_N ? 1 : ldb;
+        }
+        else if(n == 1 && !conj_b)
+        {
+            // op(A) times column 0 of op(B)
+            p.kind = route::gemv;
+            p.incx = transb == HIPBLAS_OP_N ? 1 : ldb;
+        }
+        else if(k == 1 && host && !conj_a
+                && (is_value(*beta, 1) || (clear_ok && is_value(*beta, 0))))
+        {
+            // Column 0 of op(A) times row 0 of op(B)
+            p.kind    = route::ger;
+            p.conj    = conj_b;
+            p.clear_c = !is_value(*beta, 1);
+            p.incx    = transa == HIPBLAS_OP_N ? 1 : lda;
+            p.incy    = transb == HIPBLAS_OP_N ? ldb : 1;
+        }
+        return p;
+    }
+
+    template <typename T>
+    void log_route(const char* caller, const plan& p, const char* suffix)
+    {
+        if(!(hipblas_layer_mode & HIPBLAS_LAYER_TRACE))
+            return;
+
+        const char* base = "gemv";
+        if(p.kind == route::ger)
+            base = !routines<T>::is_complex ? "ger" : p.conj ? "gerc" : "geru";
+        else if(p.kind == route::dot)
+            base = !routines<T>::is_complex ? "dot" : p.conj ? "dotc" : "dotu";
+
+        std::string routine = std::string("hipblas") + routines<T>::precision + base + suffix;
+        hipblas_log_route(caller, routine.c_str());
+    }
+
+    // Zeroes the m x columns matrix at C, for a ger standing in for a gemm with beta == 0
+    template <typename T>
+    hipblasStatus_t clear(hipblasHandle_t handle, T* C, int ldc, int m, size_t columns)
+    {
+        hipStream_t     stream;
+        hipblasStatus_t status = hipblasGetStream(handle, &stream);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        return hipMemset2DAsync(C, sizeof(T) * ldc, 0, sizeof(T) * m, columns, stream) == hipSuccess
+                   ? HIPBLAS_STATUS_SUCCESS
+                   : HIPBLAS_STATUS_INTERNAL_ERROR;
+    }
+
+    // dot writes its result through C, a device pointer, so it runs in device pointer mode; the
+    // pointer mode is mirrored on the handle, so switching is host-side only
+    template <typename F>
+    hipblasStatus_t with_device_result(hipblasHandle_t handle, F dot)
+    {
+        hipblasStatus_t status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        status                = dot();
+        hipblasStatus_t reset = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST);
+        return status != HIPBLAS_STATUS_SUCCESS ? status : reset;
+    }
+}
+
+template <typename T>
+bool hipblas_gemm_by_shape(const char*        caller,
+                           hipblasHandle_t    handle,
+                           hipblasOperation_t transa,
+                           hipblasOperation_t transb,
+                           int                m,
+                           int                n,
+                           int                k,
+                           const T*           alpha,
+                           const T*           A,
+                           int                lda,
+                           const T*           B,
+                           int                ldb,
+                           const T*           beta,
+                           T*                 C,
+                           int                ldc,
+                           hipblasStatus_t&   status)
+{
+    using R = routines<T>;
+    plan p  = plan_for(handle, transa, transb, m, n, k, lda, ldb, ldc, alpha, beta, true, true);
+    if(p.kind == route::none)
+        return false;
+
+    log_route<T>(caller, p, "");
+    bool trans_a = transa != HIPBLAS_OP_N;
+    switch(p.kind)
+    {
+    case route::dot:
+        status = with_device_result(handle, [&] {
+            return p.swap ? R::dotc(handle, k, B, p.incy, A, p.incx, C)
+                          : (p.conj ? R::dotc : R::dotu)(handle, k, A, p.incx, B, p.incy, C);
+        });
+        break;
+    case route::gemv:
+        status = R::gemv(
+            handle, transa, trans_a ? k : m, trans_a ? m : k, alpha, A, lda, B, p.incx, beta, C, 1);
+        break;
+    default:
+        status = p.clear_c ? clear(handle, C, ldc, m, n) : HIPBLAS_STATUS_SUCCESS;
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = (p.conj ? R::gerc : R::geru)(
+                handle, m, n, alpha, A, p.incx, B, p.incy, C, ldc);
+        break;
+    }
+    return true;
+}
+
+template <typename T>
+bool hipblas_gemm_batched_by_shape(const char*        caller,
+                                   hipblasHandle_t    handle,
+                                   hipblasOperation_t transa,
+                                   hipblasOperation_t transb,
+                                   int                m,
+                                   int                n,
+                                   int                k,
+                                   const T*           alpha,
+                                   const T* const     A[],
+                                   int                lda,
+                                   const T* const     B[],
+                                   int                ldb,
+                                   const T*           beta,
+                                   T* const           C[],
+                                   int                ldc,
+                                   int                batch_count,
+                                   hipblasStatus_t&   status)
+{
+    using R = routines<T>;
+    if(batch_count < 1)
+        return false;
+    plan p = plan_for(handle, transa, transb, m, n, k, lda, ldb, ldc, alpha, beta, false, false);
+    if(p.kind == route::none)
+        return false;
+
+    log_route<T>(caller, p, "Batched");
+    bool trans_a = transa != HIPBLAS_OP_N;
+    if(p.kind == route::gemv)
+        status = R::gemv_batched(handle,
+                                 transa,
+                                 trans_a ? k : m,
+                                 trans_a ? m : k,
+                                 alpha,
+                                 A,
+                                 lda,
+                                 B,
+                                 p.incx,
+                                 beta,
+                                 C,
+                                 1,
+                                 batch_count);
+    else
+        status = (p.conj ? R::gerc_batched : R::geru_batched)(
+            handle, m, n, alpha, A, p.incx, B, p.incy, C, ldc, batch_count);
+    return true;
+}
+
+template <typename T>
+bool hipblas_gemm_strided_batched_by_shape(const char*        caller,
+                                           hipblasHandle_t    handle,
+                                           hipblasOperation_t transa,
+                                           hipblasOperation_t transb,
+                                           int                m,
+                                           int                n,
+                                           int                k,
+                                           const T*           alpha,
+                                           const T*           A,
+                                           int                lda,
+                                           long long          bsa,
+                                           const T*           B,
+                                           int                ldb,
+                                           long long          bsb,
+                                           const T*           beta,
+                                           T*                 C,
+                                           int                ldc,
+                                           long long          bsc,
+                                           int                batch_count,
+                                           hipblasStatus_t&   status)
+{
+    using R = routines<T>;
+    if(batch_count < 1 || !fits_int(bsa) || !fits_int(bsb) || !fits_int(bsc))
+        return false;
+
+    // The dot results and a cleared C must each be one contiguous run of the batches
+    bool dot_ok   = bsc == 1;
+    bool clear_ok = bsc == (long long)ldc * n;
+    plan p
+        = plan_for(handle, transa, transb, m, n, k, lda, ldb, ldc, alpha, beta, dot_ok, clear_ok);
+    if(p.kind == route::none)
+        return false;
+
+    log_route<T>(caller, p, "StridedBatched");
+    bool trans_a = transa != HIPBLAS_OP_N;
+    switch(p.kind)
+    {
+    case route::dot:
+        status = with_device_result(handle, [&] {
+            return p.swap ? R::dotc_strided_batched(
+                       handle, k, B, p.incy, int(bsb), A, p.incx, int(bsa), batch_count, C)
+                          : (p.conj ? R::dotc_strided_batched : R::dotu_strided_batched)(
+                              handle, k, A, p.incx, int(bsa), B, p.incy, int(bsb), batch_count, C);
+        });
+        break;
+    case route::gemv:
+        status = R::gemv_strided_batched(handle,
+                                         transa,
+                                         trans_a ? k : m,
+                                         trans_a ? m : k,
+                                         alpha,
+                                         A,
+                                         lda,
+                                         int(bsa),
+                                         B,
+                                         p.incx,
+                                         int(bsb),
+                                         beta,
+                                         C,
+                                         1,
+                                         int(bsc),
+                                         batch_count);
+        break;
+    default:
+        status = p.clear_c ? clear(handle, C, ldc, m, size_t(n) * batch_count)
+                           : HIPBLAS_STATUS_SUCCESS;
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = (p.conj ? R::gerc_strided_batched : R::geru_strided_batched)(handle,
+                                                                                 m,
+                                                                                 n,
+                                                                                 alpha,
+                                                                                 A,
+                                                                                 p.incx,
+                                                                                 int(bsa),
+                                                                                 B,
+                                                                                 p.incy,
+                                                                                 int(bsb),
+                                                                                 C,
+                                                                                 ldc,
+                                                                                 int(bsc),
+                                                                                 batch_count);
+        break;
+    }
+    return true;
+}
+
+// clang-format off
+template bool hipblas_gemm_by_shape<float>(const char*, hipblasHandle_t, hipblasOperation_t, hipblasOperation_t, int, int, int, const float*, const float*, int, const float*, int, const float*, float*, int, hipblasStatus_t&);
+template bool hipblas_gemm_by_shape<double>(const char*, hipblasHandle_t, hipblasOperation_t, hipblasOperation_t, int, int, int, const double*, const double*, int, const double*, int, const double*, double*, int, hipblasStatus_t&);
+template bool hipblas_gemm_by_shape<hipblasComplex>(const char*, hipblasHandle_t, hipblasOperation_t, hipblasOperation_t, int, int, int, const hipblasComplex*, const hipblasComplex*, int, const hipblasComplex*, int, const hipblasComplex*, hipblasComplex*, int, hipblasStatus_t&);
+template bool hipblas_gemm_by_shape<hipblasDoubleComplex>(const char*, hipblasHandle_t, hipblasOperation_t, hipblasOperation_t, int, int, int, const hipblasDoubleComplex*, const hipblasDoubleComplex*, int, const hipblasDoubleComplex*, int, const hipblasDoubleComplex*, hipblasDoubleComplex*, int, hipblasStatus_t&);
+
+template bool hipblas_gemm_batched_by_shape<float>(const char*, hipblasHandle_t, hipblasOperation_t, hipblasOperation_t, int, int, int, const float*, const float* const[], int, const float* const[], int, const float*, float* const[], int, int, hipblasStatus_t&);
+template bool hipblas_gemm_batched_by_shape<double>(const char*, hipblasHandle_t, hipblasOperation_t, hipblasOperation_t, int, int, int, const double*, const double* const[], int, const double* const[], int, const double*, double* const[], int, int, hipblasStatus_t&);
+template bool hipblas_gemm_batched_by_shape<hipblasComplex>(const char*, hipblasHandle_t, hipblasOperation_t, hipblasOperation_t, int, int, int, const hipblasComplex*, const hipblasComplex* const[], int, const hipblasComplex* const[], int, const hipblasComplex*, hipblasComplex* const[], int, int, hipblasStatus_t&);
+template bool hipblas_gemm_batched_by_shape<hipblasDoubleComplex>(const char*, hipblasHandle_t, hipblasOperation_t, hipblasOperation_t, int, int, int, const hipblasDoubleComplex*, const hipblasDoubleComplex* const[], int, const hipblasDoubleComplex* const[], int, const hipblasDoubleComplex*, hipblasDoubleComplex* const[], int, int, hipblasStatus_t&);
+
+template bool hipblas_gemm_strided_batched_by_shape<float>(const char*, hipblasHandle_t, hipblasOperation_t, hipblasOperation_t, int, int, int, const float*, const float*, int, long long, const float*, int, long long, const float*, float*, int, long long, int, hipblasStatus_t&);
+template bool hipblas_gemm_strided_batched_by_shape<double>(const char*, hipblasHandle_t, hipblasOperation_t, hipblasOperation_t, int, int, int, const double*, const double*, int, long long, const double*, int, long long, const double*, double*, int, long long, int, hipblasStatus_t&);
+template bool hipblas_gemm_strided_batched_by_shape<hipblasComplex>(const char*, hipblasHandle_t, hipblasOperation_t, hipblasOperation_t, int, int, int, const hipblasComplex*, const hipblasComplex*, int, long long, const hipblasComplex*, int, long long, const hipblasComplex*, hipblasComplex*, int, long long, int, hipblasStatus_t&);
+template bool hipblas_gemm_strided_batched_by_shape<hipblasDoubleComplex>(const char*, hipblasHandle_t, hipblasOperation_t, hipblasOperation_t, int, int, int, const hipblasDoubleComplex*, const hipblasDoubleComplex*, int, long long, const hipblasDoubleComplex*, int, long long, const hipblasDoubleComplex*, hipblasDoubleComplex*, int, long long, int, hipblasStatus_t&);
+// clang-format on
@@ -0,0 +1,177 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "hipblas_gemm_fast_fp32.h"
+#include "hipblas_handle.h"
+#include "hipblas_kernels.h"
+#include <algorithm>
+#include <climits>
+#include <hip/hip_runtime_api.h>
+
+namespace
+{
+    hipblasStatus_t gemm_bf16x3(hipblasHandle_t    handle,
+                                hipblasOperation_t transa,
+                                hipblasOperation_t transb,
+                                int                m,
+                                int                n,
+                                int                k,
+                                const void*        alpha,
+                                const float*       A,
+                                int                lda,
+                                const float*       B,
+                                int                ldb,
+                                const void*        beta,
+                                void*              C,
+                                int                ldc,
+                                hipblasGemmAlgo_t  algo)
+    {
+        // op(A) becomes [hi lo hi], m x 3 k, and op(B) becomes [hi; hi; lo], 3 k x n
+        hipblasBfloat16 *a3, *b3;
+        hipblasStatus_t  status = hipblas_workspace_carve(
+            handle, a3, size_t(m) * 3 * k, b3, size_t(3) * k * n);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        hipStream_t stream;
+        hipblasGetStream(handle, &stream);
+
+        hipError_t err = hipblas_split_bf16x3(
+            stream, transa != HIPBLAS_OP_N, m, k, A, lda, a3, m, int64_t(m) * k, true);
+        if(err == hipSuccess)
+            err = hipblas_split_bf16x3(
+                stream, transb != HIPBLAS_OP_N, k, n, B, ldb, b3, 3 * int64_t(k), k, false);
+        if(err != hipSuccess)
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+        // The classic path, so the gemm does not carve the workspace holding its own operands
+        hipblas_classic_gemm_guard classic(handle);
+        status = classic.status();
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        return hipblasGemmEx(handle,
+                             HIPBLAS_OP_N,
+                             HIPBLAS_OP_N,
+                             m,
+                             n,
+                             3 * k,
+                             alpha,
+                             a3,
+                             HIPBLAS_R_16B,
+                             m,
+                             b3,
+                             HIPBLAS_R_16B,
+                             3 * k,
+                             beta,
+                             C,
+                             HIPBLAS_R_32F,
+                             ldc,
+                             HIPBLAS_R_32F,
+                             algo);
+    }
+}
+
+bool hipblas_gemm_fast_fp32(hipblasHandle_t    handle,
+                            hipblasOperation_t transa,
+                            hipblasOperation_t transb,
+                            int                m,
+                            int                n,
+                            int                k,
+                            const void*        alpha,
+                            const void*        A,
+                            hipblasDatatype_t  a_type,
+                            int                lda,
+                            const void*        B,
+                            hipblasDatatype_t  b_type,
+                            int                ldb,
+                            const void*        beta,
+                            void*              C,
+                            hipblasDatatype_t  c_type,
+                            int                ldc,
+                            hipblasDatatype_t  compute_type,
+                            hipblasGemmAlgo_t  algo,
+                            hipblasStatus_t&   status)
+{
+    hipblas_handle* h = static_cast<hipblas_handle*>(handle);
+    if(h == nullptr)
+        return false;
+
+    auto plain = [&]() {
+        return hipblasGemmEx(handle,
+                             transa,
+                             transb,
+                             m,
+                             n,
+                             k,
+                             alpha,
+                             A,
+                             a_type,
+                             lda,
+                             B,
+                             b_type,
+                             ldb,
+                             beta,
+                             C,
+                             c_type,
+                             ldc,
+                             HIPBLAS_R_32F,
+                             algo);
+    };
+
+    // The handle's TF32 math for this one call, ahead of any bf16x3 math it has
+    hipblasMath_t math_mode = h->math_mode;
+    if(compute_type == HIPBLAS_COMPUTE_32F_FAST_TF32)
+    {
+        status = hipblasSetMathMode(
+            handle,
+            hipblasMath_t((math_mode | HIPBLAS_TF32_TENSOR_OP_MATH) & ~HIPBLAS_BF16X3_MATH));
+        if(status == HIPBLAS_STATUS_SUCCESS)
+        {
+            status = plain();
+            hipblasSetMathMode(handle, math_mode);
+        }
+        return true;
+    }
+
+    bool requested = compute_type == HIPBLAS_COMPUTE_32F_FAST_BF16X3;
+    if(!requested && (compute_type != HIPBLAS_R_32F || !(math_mode & HIPBLAS_BF16X3_MATH)))
+        return false;
+    if(a_type != HIPBLAS_R_32F || b_type != HIPBLAS_R_32F || c_type != HIPBLAS_R_32F)
+    {
+        if(requested)
+            status = HIPBLAS_STATUS_NOT_SUPPORTED;
+        return requested;
+    }
+
+    int  a_rows = transa == HIPBLAS_OP_N ? m : k;
+    int  b_rows = transb == HIPBLAS_OP_N ? k : n;
+    bool ops    = (transa == HIPBLAS_OP_N || transa == HIPBLAS_OP_T || transa == HIPBLAS_OP_C)
+               && (transb == HIPBLAS_OP_N || transb == HIPBLAS_OP_T || transb == HIPBLAS_OP_C);
+    if(!ops || m <= 0 || n <= 0 || k <= 0 || k > INT_MAX / 3 || lda < std::max(1, a_rows)
+       || ldb < std::max(1, b_rows) || ldc < std::max(1, m))
+    {
+        if(requested)
+            status = plain();
+        return requested;
+    }
+
+    status = gemm_bf16x3(handle,
+                         transa,
+                         transb,
+                         m,
+                         n,
+                         k,
+                         alpha,
+                         static_cast<const float*>(A),
+                         lda,
+                         static_cast<const float*>(B),
+                         ldb,
+                         beta,
+                         C,
+                         ldc,
+                         algo);
+    return true;
+}
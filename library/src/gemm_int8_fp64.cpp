@@ -0,0 +1,217 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "hipblas_gemm_int8_fp64.h"
+#include "hipblas_handle.h"
+#include "hipblas_kernels.h"
+#include <algorithm>
+#include <climits>
+#include <hip/hip_runtime_api.h>
+
+namespace
+{
+    // 2^17 products of two slices, each below 2^14 in magnitude, fit an int32
+    constexpr int INT8_CHUNK_K = 1 << 17;
+
+    hipblasStatus_t gemm_int8(hipblasHandle_t    handle,
+                              hipblasOperation_t transa,
+                              hipblasOperation_t transb,
+                              int                m,
+                              int                n,
+                              int                k,
+                              const double*      alpha,
+                              const double*      A,
+                              int                lda,
+                              const double*      B,
+                              int                ldb,
+                              const double*      beta,
+                              double*            C,
+                              int                ldc,
+                              hipblasGemmAlgo_t  algo)
+    {
+        // Both operands are sliced k-major, op(A) as k x m and op(B) as k x n, for a T N gemm
+        hipblas_handle* h      = static_cast<hipblas_handle*>(handle);
+        int             slices = h->emulation_slices;
+        int             ldk    = (k + 3) & ~3;
+        int             ldp    = (m + 3) & ~3;
+        int64_t         a_size = int64_t(ldk) * m;
+        int64_t         b_size = int64_t(ldk) * n;
+
+        int8_t*  a8;
+        int8_t*  b8;
+        int*     a_exp;
+        int*     b_exp;
+        int32_t* P;
+        double*  acc;
+
+        hipblasStatus_t status = hipblas_workspace_carve(handle,
+                                                         a8,
+                                                         slices * a_size,
+                                                         b8,
+                                                         slices * b_size,
+                                                         a_exp,
+                                                         size_t(m),
+                                                         b_exp,
+                                                         size_t(n),
+                                                         P,
+                                                         size_t(ldp) * n,
+                                                         acc,
+                                                         size_t(m) * n);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        hipStream_t stream;
+        hipblasGetStream(handle, &stream);
+
+        bool       a_n = transa == HIPBLAS_OP_N, b_n = transb == HIPBLAS_OP_N;
+        hipError_t err = hipblas_int8_split(
+            stream, m, k, A, a_n ? 1 : lda, a_n ? lda : 1, slices, a8, ldk, a_size, a_exp);
+        if(err == hipSuccess)
+            err = hipblas_int8_split(
+                stream, n, k, B, b_n ? ldb : 1, b_n ? 1 : ldb, slices, b8, ldk, b_size, b_exp);
+        if(err != hipSuccess)
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+        // The classic path, so the gemms do not carve the workspace holding their operands, and
+        // host scalars for them whatever the caller's alpha and beta are; the finish reads the
+        // caller's scalars itself
+        bool                       device_scalars = h->pointer_mode == HIPBLAS_POINTER_MODE_DEVICE;
+        hipblas_classic_gemm_guard classic(handle, device_scalars);
+        status = classic.status();
+
+        // Slices s and t weigh 2^-7 (s + 1) and 2^-7 (t + 1); the pairs with s + t < slices are
+        // the slices (slices + 1) / 2 products of highest weight
+        const int32_t one = 1, zero = 0;
+        bool          first = true;
+        for(int p0 = 0; p0 < k && status == HIPBLAS_STATUS_SUCCESS; p0 += INT8_CHUNK_K)
+        {
+            int kc = std::min(INT8_CHUNK_K, k - p0);
+            for(int s = 0; s < slices && status == HIPBLAS_STATUS_SUCCESS; s++)
+            {
+                for(int t = 0; s + t < slices; t++)
+                {
+                    status = hipblasGemmEx(handle,
+                                           HIPBLAS_OP_T,
+                                           HIPBLAS_OP_N,
+                                           m,
+                                           n,
+                                           kc,
+                                           &one,
+                                           a8 + s * a_size + p0,
+                                           HIPBLAS_R_8I,
+                                           ldk,
+                                           b8 + t * b_size + p0,
+                                           HIPBLAS_R_8I,
+                                           ldk,
+                                           &zero,
+                                           P,
+                                           HIPBLAS_R_32I,
+                                           ldp,
+                                           HIPBLAS_R_32I,
+                                           algo);
+                    if(status != HIPBLAS_STATUS_SUCCESS)
+                        break;
+                    if(hipblas_int8_accumulate(stream, m, n, P, ldp, -7 * (s + t + 2), first, acc)
+                       != hipSuccess)
+                    {
+                        status = HIPBLAS_STATUS_INTERNAL_ERROR;
+                        break;
+                    }
+                    first = false;
+                }
+            }
+        }
+
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        err = hipblas_int8_finish(
+            stream, m, n, acc, a_exp, b_exp, alpha, beta, device_scalars, C, ldc);
+        return err == hipSuccess ? HIPBLAS_STATUS_SUCCESS : HIPBLAS_STATUS_INTERNAL_ERROR;
+    }
+}
+
+bool hipblas_gemm_int8_fp64(hipblasHandle_t    handle,
+                            hipblasOperation_t transa,
+                            hipblasOperation_t transb,
+                            int                m,
+                            int                n,
+                            int                k,
+                            const void*        alpha,
+                            const void*        A,
+                            hipblasDatatype_t  a_type,
+                            int                lda,
+                            const void*        B,
+                            hipblasDatatype_t  b_type,
+                            int                ldb,
+                            const void*        beta,
+                            void*              C,
+                            hipblasDatatype_t  c_type,
+                            int                ldc,
+                            hipblasDatatype_t  compute_type,
+                            hipblasGemmAlgo_t  algo,
+                            hipblasStatus_t&   status)
+{
+    hipblas_handle* h = static_cast<hipblas_handle*>(handle);
+    if(h == nullptr)
+        return false;
+
+    bool requested = compute_type == HIPBLAS_COMPUTE_64F_EMULATED_INT8;
+    if(!requested && (compute_type != HIPBLAS_R_64F || !(h->math_mode & HIPBLAS_INT8_FP64_MATH)))
+        return false;
+    if(a_type != HIPBLAS_R_64F || b_type != HIPBLAS_R_64F || c_type != HIPBLAS_R_64F)
+    {
+        if(requested)
+            status = HIPBLAS_STATUS_NOT_SUPPORTED;
+        return requested;
+    }
+
+    int  a_rows = transa == HIPBLAS_OP_N ? m : k;
+    int  b_rows = transb == HIPBLAS_OP_N ? k : n;
+    bool ops    = (transa == HIPBLAS_OP_N || transa == HIPBLAS_OP_T || transa == HIPBLAS_OP_C)
+               && (transb == HIPBLAS_OP_N || transb == HIPBLAS_OP_T || transb == HIPBLAS_OP_C);
+    if(!ops || m <= 0 || n <= 0 || k <= 0 || m > INT_MAX - 3 || k > INT_MAX - 3 || !alpha || !beta
+       || lda < std::max(1, a_rows) || ldb < std::max(1, b_rows) || ldc < std::max(1, m))
+    {
+        if(requested)
+            status = hipblasGemmEx(handle,
+                                   transa,
+                                   transb,
+                                   m,
+                                   n,
+                                   k,
+                                   alpha,
+                                   A,
+                                   a_type,
+                                   lda,
+                                   B,
+                                   b_type,
+                                   ldb,
+                                   beta,
+                                   C,
+                                   c_type,
+                                   ldc,
+                                   HIPBLAS_R_64F,
+                                   algo);
+        return requested;
+    }
+
+    status = gemm_int8(handle,
+                       transa,
+                       transb,
+                       m,
+                       n,
+                       k,
+                       static_cast<const double*>(alpha),
+                       static_cast<const double*>(A),
+                       lda,
+                       static_cast<const double*>(B),
+                       ldb,
+                       static_cast<const double*>(beta),
+                       static_cast<double*>(C),
+                       ldc,
+                       algo);
+    return true;
+}
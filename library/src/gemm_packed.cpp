@@ -0,0 +1,162 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "hipblas_handle.h"
+#include "hipblas_logging.h"
+#include <algorithm>
+#include <hip/hip_runtime_api.h>
+#include <new>
+
+namespace
+{
+    // op(B) as hipblasGemmPack left it: k x n, untransposed, at data with leading dimension ld
+    struct hipblas_gemm_packed
+    {
+        int               device;
+        hipblasDatatype_t type;
+        int               k;
+        int               n;
+        int               ld;
+        void*             data;
+    };
+
+    bool valid_operation(hipblasOperation_t op)
+    {
+        return op == HIPBLAS_OP_N || op == HIPBLAS_OP_T || op == HIPBLAS_OP_C;
+    }
+}
+
+hipblasStatus_t hipblasGemmPack(hipblasHandle_t      handle,
+                                hipblasOperation_t   transB,
+                                int                  k,
+                                int                  n,
+                                const void*          B,
+                                hipblasDatatype_t    b_type,
+                                int                  ldb,
+                                hipblasDatatype_t    packed_type,
+                                hipblasGemmPacked_t* packed)
+{
+    HIPBLAS_LOG_CALL(handle, transB, k, n, B, b_type, ldb, packed_type, packed);
+    if(handle == nullptr)
+    {
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    }
+    if(packed == nullptr)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    *packed = nullptr;
+    if(!valid_operation(transB))
+    {
+        return HIPBLAS_STATUS_INVALID_ENUM;
+    }
+    if(k < 0 || n < 0 || ldb < std::max(1, transB == HIPBLAS_OP_N ? k : n)
+       || (B == nullptr && k > 0 && n > 0))
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    size_t elem = hipblas_datatype_size(packed_type);
+    if(elem == 0 || hipblas_datatype_size(b_type) == 0)
+    {
+        return HIPBLAS_STATUS_INVALID_ENUM;
+    }
+
+    hipblas_gemm_packed* p = new(std::nothrow) hipblas_gemm_packed();
+    if(p == nullptr)
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+    p->device = static_cast<hipblas_handle*>(handle)->device;
+    p->type   = packed_type;
+    p->k      = k;
+    p->n      = n;
+
+    hipblasStatus_t status = hipblasMallocMatrix(handle, k, n, int(elem), &p->data, &p->ld);
+    if(status == HIPBLAS_STATUS_SUCCESS && k > 0 && n > 0)
+    {
+        // An untransposed copy in B's own type needs no conversion, so takes any type
+        hipStream_t stream;
+        status = hipblasGetStream(handle, &stream);
+        if(status == HIPBLAS_STATUS_SUCCESS && transB == HIPBLAS_OP_N && packed_type == b_type)
+            status = hipMemcpy2DAsync(p->data,
+                                      p->ld * elem,
+                                      B,
+                                      ldb * elem,
+                                      k * elem,
+                                      n,
+                                      hipMemcpyDeviceToDevice,
+                                      stream)
+                             == hipSuccess
+                         ? HIPBLAS_STATUS_SUCCESS
+                         : HIPBLAS_STATUS_INTERNAL_ERROR;
+        else if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblasTransposeEx(
+                handle, transB, k, n, B, b_type, ldb, p->data, packed_type, p->ld);
+    }
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        (void)hipFree(p->data);
+        delete p;
+        return status;
+    }
+    *packed = p;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblasGemmPackedEx(hipblasHandle_t     handle,
+                                    hipblasOperation_t  transA,
+                                    int                 m,
+                                    const void*         alpha,
+                                    const void*         A,
+                                    hipblasDatatype_t   a_type,
+                                    int                 lda,
+                                    hipblasGemmPacked_t packed,
+                                    const void*         beta,
+                                    void*               C,
+                                    hipblasDatatype_t   c_type,
+                                    int                 ldc,
+                                    hipblasDatatype_t   compute_type,
+                                    hipblasGemmAlgo_t   algo)
+{
+    HIPBLAS_LOG_CALL(
+        handle, transA, m, alpha, A, a_type, lda, packed, beta, C, c_type, ldc, compute_type, algo);
+    if(handle == nullptr)
+    {
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    }
+    const hipblas_gemm_packed* p = static_cast<const hipblas_gemm_packed*>(packed);
+    if(p == nullptr || p->device != static_cast<hipblas_handle*>(handle)->device)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    return hipblasGemmEx(handle,
+                         transA,
+                         HIPBLAS_OP_N,
+                         m,
+                         p->n,
+                         p->k,
+                         alpha,
+                         A,
+                         a_type,
+                         lda,
+                         p->data,
+                         p->type,
+                         p->ld,
+                         beta,
+                         C,
+                         c_type,
+                         ldc,
+                         compute_type,
+                         algo);
+}
+
+hipblasStatus_t hipblasGemmPackDestroy(hipblasGemmPacked_t packed)
+{
+    HIPBLAS_LOG_CALL_NO_HANDLE(packed);
+    hipblas_gemm_packed* p = static_cast<hipblas_gemm_packed*>(packed);
+    if(p == nullptr)
+        return HIPBLAS_STATUS_SUCCESS;
+    hipError_t err = hipFree(p->data);
+    delete p;
+    return err == hipSuccess ? HIPBLAS_STATUS_SUCCESS : HIPBLAS_STATUS_INTERNAL_ERROR;
+}
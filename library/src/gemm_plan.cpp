@@ -0,0 +1,264 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "hipblas_gemm_plan.h"
+#include "hipblas_handle.h"
+#include "hipblas_jit.h"
+#include "hipblas_kernels.h"
+#include "hipblas_logging.h"
+#include <algorithm>
+#include <hip/hip_runtime_api.h>
+#include <new>
+
+namespace
+{
+    hipblasStatus_t launch_status(hipError_t err)
+    {
+        return err == hipSuccess ? HIPBLAS_STATUS_SUCCESS : HIPBLAS_STATUS_INTERNAL_ERROR;
+    }
+
+    bool valid_operation(hipblasOperation_t op)
+    {
+        return op == HIPBLAS_OP_N || op == HIPBLAS_OP_T || op == HIPBLAS_OP_C;
+    }
+
+    bool is_complex(hipblasDatatype_t type)
+    {
+        return type == HIPBLAS_C_16F || type == HIPBLAS_C_32F || type == HIPBLAS_C_64F
+               || type == HIPBLAS_C_16B;
+    }
+
+    // The real types a run-time compiled gemm reads and writes
+    bool is_jit_type(hipblasDatatype_t type)
+    {
+        return type == HIPBLAS_R_16F || type == HIPBLAS_R_16B || type == HIPBLAS_R_32F
+               || type == HIPBLAS_R_64F;
+    }
+
+    // Whether hipblasGemmEx on h would take its plain path for the problem: none of the fast fp32,
+    // int8 fp64, real x complex, Strassen, split-k, checksum or online tuning routes, and not
+    // cuBLASLt. Shape and host dispatch and the tiny kernels take no part in hipblasGemmEx, and
+    // a tuned choice is taken by the plan itself
+    bool takes_plain_path(const hipblas_handle* h, const hipblasGemmShape_t& s)
+    {
+        if(s.compute_type == HIPBLAS_COMPUTE_32F_FAST_TF32
+           || s.compute_type == HIPBLAS_COMPUTE_32F_FAST_BF16X3
+           || s.compute_type == HIPBLAS_COMPUTE_64F_EMULATED_INT8)
+            return false;
+        if(is_complex(s.a_type) != is_complex(s.b_type))
+            return false;
+        hipblas_gemm_routing routing = h->gemm_routing();
+        hipblas_gemm_routing plain   = routing.classic();
+        plain.gemm_tuning            = routing.gemm_tuning;
+        plain.shape_dispatch         = routing.shape_dispatch;
+        plain.host_dispatch_mode     = routing.host_dispatch_mode;
+        plain.gemm_tiny_limit        = routing.gemm_tiny_limit;
+        return routing == plain;
+    }
+
+    bool still_direct(const hipblas_handle* h, const hipblas_gemm_plan& p)
+    {
+        return p.direct && h->gemm_routing() == p.routing;
+    }
+
+    template <typename T>
+    hipError_t epilogue(hipStream_t stream, const hipblas_gemm_plan& p, void* C)
+    {
+        return hipblas_gemm_epilogue(stream,
+                                     p.shape.m,
+                                     p.shape.n,
+                                     (T*)C,
+                                     p.ldc,
+                                     (const T*)p.epilogue.bias,
+                                     p.epilogue.activation,
+                                     p.epilogue.scale,
+                                     (T*)p.epilogue.aux,
+                                     p.epilogue.ldaux);
+    }
+}
+
+hipblasStatus_t hipblasGemmPlanCreate(hipblasHandle_t              handle,
+                                      const hipblasGemmShape_t*    shape,
+                                      int                          lda,
+                                      int                          ldb,
+                                      int                          ldc,
+                                      hipblasGemmAlgo_t            algo,
+                                      const hipblasGemmEpilogue_t* epilogue,
+                                      hipblasGemmPlan_t*           plan)
+{
+    HIPBLAS_LOG_CALL(handle, shape, lda, ldb, ldc, algo, epilogue, plan);
+    hipblas_handle* h = static_cast<hipblas_handle*>(handle);
+    if(h == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(shape == nullptr || plan == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    *plan = nullptr;
+
+    // The checks hipblasGemmExWithEpilogue and the backend make on every call
+    const hipblasGemmShape_t& s = *shape;
+    if(!valid_operation(s.transA) || !valid_operation(s.transB))
+        return HIPBLAS_STATUS_INVALID_ENUM;
+    int a_rows = s.transA == HIPBLAS_OP_N ? s.m : s.k;
+    int b_rows = s.transB == HIPBLAS_OP_N ? s.k : s.n;
+    if(s.m < 0 || s.n < 0 || s.k < 0 || lda < std::max(1, a_rows) || ldb < std::max(1, b_rows)
+       || ldc < std::max(1, s.m))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(epilogue)
+    {
+        if(epilogue->activation != HIPBLAS_ACTIVATION_NONE
+           && epilogue->activation != HIPBLAS_ACTIVATION_RELU
+           && epilogue->activation != HIPBLAS_ACTIVATION_GELU)
+            return HIPBLAS_STATUS_INVALID_ENUM;
+        if(s.c_type != HIPBLAS_R_16F && s.c_type != HIPBLAS_R_32F && s.c_type != HIPBLAS_R_64F)
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+        if(epilogue->aux && epilogue->ldaux < std::max(1, s.m))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+
+    hipblas_gemm_plan* p = new(std::nothrow) hipblas_gemm_plan();
+    if(p == nullptr)
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+    p->handle       = handle;
+    p->shape        = s;
+    p->lda          = lda;
+    p->ldb          = ldb;
+    p->ldc          = ldc;
+    p->algo         = algo;
+    p->has_epilogue = epilogue != nullptr;
+    if(epilogue)
+        p->epilogue = *epilogue;
+
+    const hipblas_gemm_tuned* tuned = hipblas_gemm_tuned_for(handle,
+                                                             algo,
+                                                             s.transA,
+                                                             s.transB,
+                                                             s.m,
+                                                             s.n,
+                                                             s.k,
+                                                             s.a_type,
+                                                             s.b_type,
+                                                             s.c_type,
+                                                             s.compute_type);
+    p->tuned = tuned != nullptr;
+    if(tuned)
+        p->choice = *tuned;
+
+    p->direct  = takes_plain_path(h, s);
+    p->routing = h->gemm_routing();
+
+    *plan = p;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblasGemmPlanCreateJit(hipblasHandle_t           handle,
+                                         const hipblasGemmShape_t* shape,
+                                         int                       lda,
+                                         int                       ldb,
+                                         int                       ldc,
+                                         const char*               epilogue_code,
+                                         hipblasGemmPlan_t*        plan)
+{
+    HIPBLAS_LOG_CALL(handle, shape, lda, ldb, ldc, epilogue_code, plan);
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(shape == nullptr || plan == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    *plan = nullptr;
+
+    const hipblasGemmShape_t& s = *shape;
+    if(!valid_operation(s.transA) || !valid_operation(s.transB))
+        return HIPBLAS_STATUS_INVALID_ENUM;
+    int a_rows = s.transA == HIPBLAS_OP_N ? s.m : s.k;
+    int b_rows = s.transB == HIPBLAS_OP_N ? s.k : s.n;
+    if(s.m < 0 || s.n < 0 || s.k < 0 || lda < std::max(1, a_rows) || ldb < std::max(1, b_rows)
+       || ldc < std::max(1, s.m))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(!is_jit_type(s.a_type) || s.b_type != s.a_type || !is_jit_type(s.c_type)
+       || (s.compute_type != HIPBLAS_R_32F && s.compute_type != HIPBLAS_R_64F))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    const hipblas_jit_kernel* kernel;
+    hipblasStatus_t           status
+        = hipblas_jit_gemm_kernel(handle, s, lda, ldb, ldc, epilogue_code, &kernel);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    hipblas_gemm_plan* p = new(std::nothrow) hipblas_gemm_plan();
+    if(p == nullptr)
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+    p->handle = handle;
+    p->shape  = s;
+    p->lda    = lda;
+    p->ldb    = ldb;
+    p->ldc    = ldc;
+    p->jit    = kernel;
+
+    *plan = p;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblasGemmPlanDestroy(hipblasGemmPlan_t plan)
+{
+    HIPBLAS_LOG_CALL_NO_HANDLE(plan);
+    delete static_cast<hipblas_gemm_plan*>(plan);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblasGemmPlanExecute(hipblasGemmPlan_t plan,
+                                       const void*       A,
+                                       const void*       B,
+                                       void*             C,
+                                       const void*       alpha,
+                                       const void*       beta)
+{
+    const hipblas_gemm_plan* p      = static_cast<const hipblas_gemm_plan*>(plan);
+    hipblasHandle_t          handle = p ? p->handle : nullptr;
+    HIPBLAS_LOG_CALL(handle, plan, A, B, C, alpha, beta);
+    if(p == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    hipblas_handle* h = static_cast<hipblas_handle*>(handle);
+    if(h == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    if(p->jit)
+        return hipblas_jit_gemm_launch(handle, *p->jit, alpha, A, B, beta, C);
+
+    const hipblasGemmShape_t& s = p->shape;
+    if(!still_direct(h, *p))
+        return hipblasGemmExWithEpilogue(handle,
+                                         s.transA,
+                                         s.transB,
+                                         s.m,
+                                         s.n,
+                                         s.k,
+                                         alpha,
+                                         A,
+                                         s.a_type,
+                                         p->lda,
+                                         B,
+                                         s.b_type,
+                                         p->ldb,
+                                         beta,
+                                         C,
+                                         s.c_type,
+                                         p->ldc,
+                                         s.compute_type,
+                                         p->algo,
+                                         p->has_epilogue ? &p->epilogue : nullptr);
+
+    hipblasStatus_t status = hipblas_gemm_plan_launch(handle, *p, alpha, A, B, beta, C);
+    if(status != HIPBLAS_STATUS_SUCCESS || !p->has_epilogue)
+        return status;
+
+    hipStream_t stream;
+    status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    if(s.c_type == HIPBLAS_R_16F)
+        return launch_status(epilogue<hipblasHalf>(stream, *p, C));
+    if(s.c_type == HIPBLAS_R_32F)
+        return launch_status(epilogue<float>(stream, *p, C));
+    return launch_status(epilogue<double>(stream, *p, C));
+}
@@ -0,0 +1,431 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "hipblas_handle.h"
+#include "hipblas_kernels.h"
+#include "hipblas_logging.h"
+#include <algorithm>
+#include <hip/hip_runtime_api.h>
+
+namespace
+{
+    hipblasStatus_t launch_status(hipError_t err)
+    {
+        return err == hipSuccess ? HIPBLAS_STATUS_SUCCESS : HIPBLAS_STATUS_INTERNAL_ERROR;
+    }
+
+    bool valid_operation(hipblasOperation_t op)
+    {
+        return op == HIPBLAS_OP_N || op == HIPBLAS_OP_T || op == HIPBLAS_OP_C;
+    }
+
+    // The planes are real matrices: op(A) of a conjugated A is the transpose with the imaginary
+    // plane's sign flipped, which the products take in their scalars or in the 3M sums
+    template <typename T>
+    struct real_gemm
+    {
+        hipblasHandle_t    handle;
+        hipblasOperation_t opa;
+        hipblasOperation_t opb;
+        int                m;
+        int                n;
+        int                k;
+        int                batch_count;
+
+        // C = alpha a b + beta C for the real matrices a, b and c of each batch, host scalars
+        hipblasStatus_t operator()(T         alpha,
+                                   const T*  a,
+                                   int       lda,
+                                   long long stride_a,
+                                   const T*  b,
+                                   int       ldb,
+                                   long long stride_b,
+                                   T         beta,
+                                   T*        c,
+                                   int       ldc,
+                                   long long stride_c) const
+        {
+            hipblasDatatype_t type = sizeof(T) == sizeof(float) ? HIPBLAS_R_32F : HIPBLAS_R_64F;
+            return hipblasGemmStridedBatchedEx(handle,
+                                               opa,
+                                               opb,
+                                               m,
+                                               n,
+                                               k,
+                                               &alpha,
+                                               a,
+                                               type,
+                                               lda,
+                                               stride_a,
+                                               b,
+                                               type,
+                                               ldb,
+                                               stride_b,
+                                               &beta,
+                                               c,
+                                               type,
+                                               ldc,
+                                               stride_c,
+                                               batch_count,
+                                               type,
+                                               HIPBLAS_GEMM_DEFAULT);
+        }
+    };
+
+    template <typename T>
+    hipblasStatus_t gemm_planar(hipblasHandle_t    handle,
+                                hipblasOperation_t transa,
+                                hipblasOperation_t transb,
+                                int                m,
+                                int                n,
+                                int                k,
+                                const T*           alpha,
+                                const T*           A_re,
+                                const T*           A_im,
+                                int                lda,
+                                long long          stride_A,
+                                const T*           B_re,
+                                const T*           B_im,
+                                int                ldb,
+                                long long          stride_B,
+                                const T*           beta,
+                                T*                 C_re,
+                                T*                 C_im,
+                                int                ldc,
+                                long long          stride_C,
+                                int                batch_count)
+    {
+        hipblas_handle* h      = static_cast<hipblas_handle*>(handle);
+        int             a_rows = transa == HIPBLAS_OP_N ? m : k;
+        int             a_cols = transa == HIPBLAS_OP_N ? k : m;
+        int             b_rows = transb == HIPBLAS_OP_N ? k : n;
+        int             b_cols = transb == HIPBLAS_OP_N ? n : k;
+
+        T sa = transa == HIPBLAS_OP_C ? -1 : 1;
+        T sb = transb == HIPBLAS_OP_C ? -1 : 1;
+
+        real_gemm<T> gemm{handle,
+                          transa == HIPBLAS_OP_N ? HIPBLAS_OP_N : HIPBLAS_OP_T,
+                          transb == HIPBLAS_OP_N ? HIPBLAS_OP_N : HIPBLAS_OP_T,
+                          m,
+                          n,
+                          k,
+                          batch_count};
+
+        // 4M: with real alpha and beta each plane of C is two real products accumulated in place
+        bool device_scalars = h->pointer_mode == HIPBLAS_POINTER_MODE_DEVICE;
+        if(!device_scalars && alpha[1] == 0 && beta[1] == 0)
+        {
+            T a = alpha[0], b = beta[0];
+
+            hipblasStatus_t status = gemm(
+                a, A_re, lda, stride_A, B_re, ldb, stride_B, b, C_re, ldc, stride_C);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = gemm(
+                    -sa * sb * a, A_im, lda, stride_A, B_im, ldb, stride_B, 1, C_re, ldc, stride_C);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = gemm(
+                    sb * a, A_re, lda, stride_A, B_im, ldb, stride_B, b, C_im, ldc, stride_C);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = gemm(
+                    sa * a, A_im, lda, stride_A, B_re, ldb, stride_B, 1, C_im, ldc, stride_C);
+            return status;
+        }
+
+        // 3M: P1 = Ar Br, P2 = Ai Bi and P3 = (Ar + Ai)(Br + Bi), with the signs of the imaginary
+        // planes folded into P2's scalar and the sums, combined with the complex scalars
+        size_t size_a = size_t(a_rows) * a_cols;
+        size_t size_b = size_t(b_rows) * b_cols;
+        size_t size_c = size_t(m) * n;
+
+        hipStream_t     stream;
+        T *             As, *Bs, *P1, *P2, *P3;
+        hipblasStatus_t status = hipblasGetStream(handle, &stream);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblas_workspace_carve(handle,
+                                             As,
+                                             size_a * batch_count,
+                                             Bs,
+                                             size_b * batch_count,
+                                             P1,
+                                             size_c * batch_count,
+                                             P2,
+                                             size_c * batch_count,
+                                             P3,
+                                             size_c * batch_count);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        if(k > 0)
+        {
+            if(hipblas_gemm3m_sum_planar_strided_batched(stream,
+                                                         a_rows,
+                                                         a_cols,
+                                                         A_re,
+                                                         A_im,
+                                                         lda,
+                                                         stride_A,
+                                                         transa == HIPBLAS_OP_C,
+                                                         As,
+                                                         batch_count)
+                   != hipSuccess
+               || hipblas_gemm3m_sum_planar_strided_batched(stream,
+                                                            b_rows,
+                                                            b_cols,
+                                                            B_re,
+                                                            B_im,
+                                                            ldb,
+                                                            stride_B,
+                                                            transb == HIPBLAS_OP_C,
+                                                            Bs,
+                                                            batch_count)
+                      != hipSuccess)
+                return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+            // The products take the classic path, so they leave the workspace alone, and host
+            // scalars whatever the caller's are
+            hipblas_classic_gemm_guard classic(handle, device_scalars);
+            status = classic.status();
+
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = gemm(1, A_re, lda, stride_A, B_re, ldb, stride_B, 0, P1, m, size_c);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = gemm(sa * sb, A_im, lda, stride_A, B_im, ldb, stride_B, 0, P2, m, size_c);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = gemm(1, As, a_rows, size_a, Bs, b_rows, size_b, 0, P3, m, size_c);
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+        }
+
+        return launch_status(hipblas_gemm3m_combine_planar_strided_batched(stream,
+                                                                           m,
+                                                                           n,
+                                                                           k > 0 ? P1 : nullptr,
+                                                                           P2,
+                                                                           P3,
+                                                                           alpha,
+                                                                           beta,
+                                                                           device_scalars,
+                                                                           C_re,
+                                                                           C_im,
+                                                                           ldc,
+                                                                           stride_C,
+                                                                           batch_count));
+    }
+
+    hipblasStatus_t gemm_planar_complex(hipblasHandle_t    handle,
+                                        hipblasOperation_t transa,
+                                        hipblasOperation_t transb,
+                                        int                m,
+                                        int                n,
+                                        int                k,
+                                        const void*        alpha,
+                                        const void*        A_re,
+                                        const void*        A_im,
+                                        int                lda,
+                                        long long          stride_A,
+                                        const void*        B_re,
+                                        const void*        B_im,
+                                        int                ldb,
+                                        long long          stride_B,
+                                        const void*        beta,
+                                        void*              C_re,
+                                        void*              C_im,
+                                        int                ldc,
+                                        long long          stride_C,
+                                        int                batch_count,
+                                        hipblasDatatype_t  type)
+    {
+        int a_rows = transa == HIPBLAS_OP_N ? m : k;
+        int b_rows = transb == HIPBLAS_OP_N ? k : n;
+        if(handle == nullptr)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if(!valid_operation(transa) || !valid_operation(transb))
+            return HIPBLAS_STATUS_INVALID_ENUM;
+        if(type != HIPBLAS_C_32F && type != HIPBLAS_C_64F)
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+        if(m < 0 || n < 0 || k < 0 || batch_count < 0 || lda < std::max(1, a_rows)
+           || ldb < std::max(1, b_rows) || ldc < std::max(1, m))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(m == 0 || n == 0 || batch_count == 0)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(!alpha || !beta || !C_re || !C_im || (k > 0 && (!A_re || !A_im || !B_re || !B_im)))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        if(type == HIPBLAS_C_32F)
+            return gemm_planar(handle,
+                               transa,
+                               transb,
+                               m,
+                               n,
+                               k,
+                               static_cast<const float*>(alpha),
+                               static_cast<const float*>(A_re),
+                               static_cast<const float*>(A_im),
+                               lda,
+                               stride_A,
+                               static_cast<const float*>(B_re),
+                               static_cast<const float*>(B_im),
+                               ldb,
+                               stride_B,
+                               static_cast<const float*>(beta),
+                               static_cast<float*>(C_re),
+                               static_cast<float*>(C_im),
+                               ldc,
+                               stride_C,
+                               batch_count);
+        return gemm_planar(handle,
+                                   transa,
+                                   transb,
+                                   m,
+                                   n,
+                                   k,
+                                   static_cast<const double*>(alpha),
+                                   static_cast<const double*>(A_re),
+                                   static_cast<const double*>(A_im),
+                                   lda,
+                                   stride_A,
+                                   static_cast<const double*>(B_re),
+                                   static_cast<const double*>(B_im),
+                                   ldb,
+                                   stride_B,
+                                   static_cast<const double*>(beta),
+                                   static_cast<double*>(C_re),
+                                   static_cast<double*>(C_im),
+                                   ldc,
+                                   stride_C,
+                                   batch_count);
+    }
+}
+
+hipblasStatus_t hipblasGemmPlanarComplex(hipblasHandle_t    handle,
+                                         hipblasOperation_t transa,
+                                         hipblasOperation_t transb,
+                                         int                m,
+                                         int                n,
+                                         int                k,
+                                         const void*        alpha,
+                                         const void*        A_re,
+                                         const void*        A_im,
+                                         int                lda,
+                                         const void*        B_re,
+                                         const void*        B_im,
+                                         int                ldb,
+                                         const void*        beta,
+                                         void*              C_re,
+                                         void*              C_im,
+                                         int                ldc,
+                                         hipblasDatatype_t  type)
+{
+    HIPBLAS_LOG_CALL(handle,
+                     transa,
+                     transb,
+                     m,
+                     n,
+                     k,
+                     alpha,
+                     A_re,
+                     A_im,
+                     lda,
+                     B_re,
+                     B_im,
+                     ldb,
+                     beta,
+                     C_re,
+                     C_im,
+                     ldc,
+                     type);
+    return gemm_planar_complex(handle,
+                               transa,
+                               transb,
+                               m,
+                               n,
+                               k,
+                               alpha,
+                               A_re,
+                               A_im,
+                               lda,
+                               0,
+                               B_re,
+                               B_im,
+                               ldb,
+                               0,
+                               beta,
+                               C_re,
+                               C_im,
+                               ldc,
+                               0,
+                               1,
+                               type);
+}
+
+hipblasStatus_t hipblasGemmPlanarComplexStridedBatched(hipblasHandle_t    handle,
+                                                       hipblasOperation_t transa,
+                                                       hipblasOperation_t transb,
+                                                       int                m,
+                                                       int                n,
+                                                       int                k,
+                                                       const void*        alpha,
+                                                       const void*        A_re,
+                                                       const void*        A_im,
+                                                       int                lda,
+                                                       long long          stride_A,
+                                                       const void*        B_re,
+                                                       const void*        B_im,
+                                                       int                ldb,
+                                                       long long          stride_B,
+                                                       const void*        beta,
+                                                       void*              C_re,
+                                                       void*              C_im,
+                                                       int                ldc,
+                                                       long long          stride_C,
+                                                       int                batchCount,
+                                                       hipblasDatatype_t  type)
+{
+    HIPBLAS_LOG_CALL(handle,
+                     transa,
+                     transb,
+                     m,
+                     n,
+                     k,
+                     alpha,
+                     A_re,
+                     A_im,
+                     lda,
+                     stride_A,
+                     B_re,
+                     B_im,
+                     ldb,
+                     stride_B,
+                     beta,
+                     C_re,
+                     C_im,
+                     ldc,
+                     stride_C,
+                     batchCount,
+                     type);
+    return gemm_planar_complex(handle,
+                               transa,
+                               transb,
+                               m,
+                               n,
+                               k,
+                               alpha,
+                               A_re,
+                               A_im,
+                               lda,
+                               stride_A,
+                               B_re,
+                               B_im,
+                               ldb,
+                               stride_B,
+                               beta,
+                               C_re,
+                               C_im,
+                               ldc,
+                               stride_C,
+                               batchCount,
+                               type);
+}
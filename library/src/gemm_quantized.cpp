@@ -0,0 +1,184 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "hipblas_handle.h"
+#include "hipblas_kernels.h"
+#include "hipblas_logging.h"
+#include <algorithm>
+#include <hip/hip_runtime_api.h>
+
+namespace
+{
+    bool is_op(hipblasOperation_t op)
+    {
+        return op == HIPBLAS_OP_N || op == HIPBLAS_OP_T || op == HIPBLAS_OP_C;
+    }
+
+    bool is_16_or_32f(hipblasDatatype_t type)
+    {
+        return type == HIPBLAS_R_16F || type == HIPBLAS_R_16B || type == HIPBLAS_R_32F;
+    }
+
+    bool is_4bit(hipblasWeightFormat_t format)
+    {
+        return format == HIPBLAS_WEIGHT_INT4 || format == HIPBLAS_WEIGHT_UINT4;
+    }
+}
+
+hipblasStatus_t hipblasGemmQuantizedEx(hipblasHandle_t                    handle,
+                                       hipblasOperation_t                 trans_a,
+                                       int                                m,
+                                       int                                n,
+                                       int                                k,
+                                       const void*                        alpha,
+                                       const void*                        a,
+                                       hipblasDatatype_t                  a_type,
+                                       int                                lda,
+                                       const void*                        b,
+                                       int                                ldb,
+                                       const hipblasWeightQuantization_t* quant,
+                                       const void*                        beta,
+                                       void*                              c,
+                                       hipblasDatatype_t                  c_type,
+                                       int                                ldc,
+                                       hipblasDatatype_t                  compute_type)
+{
+    return hipblasGemmQuantizedStridedBatchedEx(handle,
+                                                trans_a,
+                                                m,
+                                                n,
+                                                k,
+                                                alpha,
+                                                a,
+                                                a_type,
+                                                lda,
+                                                0,
+                                                b,
+                                                ldb,
+                                                0,
+                                                quant,
+                                                0,
+                                                beta,
+                                                c,
+                                                c_type,
+                                                ldc,
+                                                0,
+                                                1,
+                                                compute_type);
+}
+
+hipblasStatus_t
+    hipblasGemmQuantizedStridedBatchedEx(hipblasHandle_t                    handle,
+                                         hipblasOperation_t                 trans_a,
+                                         int                                m,
+                                         int                                n,
+                                         int                                k,
+                                         const void*                        alpha,
+                                         const void*                        a,
+                                         hipblasDatatype_t                  a_type,
+                                         int                                lda,
+                                         long long                          stride_a,
+                                         const void*                        b,
+                                         int                                ldb,
+                                         long long                          stride_b,
+                                         const hipblasWeightQuantization_t* quant,
+                                         long long                          stride_scales,
+                                         const void*                        beta,
+                                         void*                              c,
+                                         hipblasDatatype_t                  c_type,
+                                         int                                ldc,
+                                         long long                          stride_c,
+                                         int                                batch_count,
+                                         hipblasDatatype_t                  compute_type)
+{
+    HIPBLAS_LOG_CALL(handle,
+                     trans_a,
+                     m,
+                     n,
+                     k,
+                     alpha,
+                     a,
+                     a_type,
+                     lda,
+                     stride_a,
+                     b,
+                     ldb,
+                     stride_b,
+                     quant,
+                     stride_scales,
+                     beta,
+                     c,
+                     c_type,
+                     ldc,
+                     stride_c,
+                     batch_count,
+                     compute_type);
+    if(handle == nullptr)
+    {
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    }
+    if(quant == nullptr)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    if(!is_op(trans_a))
+    {
+        return HIPBLAS_STATUS_INVALID_ENUM;
+    }
+
+    // A 4-bit B needs every column, and every batch's matrix, to start on a byte
+    bool four_bit = is_4bit(quant->format);
+    if(m < 0 || n < 0 || k < 0 || batch_count < 0
+       || lda < std::max(1, trans_a == HIPBLAS_OP_N ? m : k) || ldb < std::max(1, k)
+       || ldc < std::max(1, m) || (four_bit && (ldb % 2 != 0 || stride_b % 2 != 0))
+       || quant->group_size < 1
+       || quant->ld_scales < std::max(1, (k - 1) / quant->group_size + 1))
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    if(!is_16_or_32f(a_type) || (c_type != a_type && c_type != HIPBLAS_R_32F)
+       || (quant->scale_type != HIPBLAS_R_16F && quant->scale_type != HIPBLAS_R_32F)
+       || (!four_bit && quant->format != HIPBLAS_WEIGHT_INT8
+           && quant->format != HIPBLAS_WEIGHT_UINT8)
+       || compute_type != HIPBLAS_R_32F)
+    {
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    }
+    if(m == 0 || n == 0 || batch_count == 0)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!alpha || !beta || !c || (k > 0 && (!a || !b || !quant->scales)))
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+
+    hipStream_t stream;
+    hipblasGetStream(handle, &stream);
+    bool device_scalars
+        = static_cast<hipblas_handle*>(handle)->pointer_mode == HIPBLAS_POINTER_MODE_DEVICE;
+
+    hipError_t err = hipblas_gemm_quantized(stream,
+                                            trans_a,
+                                            m,
+                                            n,
+                                            k,
+                                            static_cast<const float*>(alpha),
+                                            static_cast<const float*>(beta),
+                                            device_scalars,
+                                            a,
+                                            a_type,
+                                            lda,
+                                            stride_a,
+                                            b,
+                                            ldb,
+                                            stride_b,
+                                            *quant,
+                                            stride_scales,
+                                            c,
+                                            c_type,
+                                            ldc,
+                                            stride_c,
+                                            batch_count);
+    return err == hipSuccess ? HIPBLAS_STATUS_SUCCESS : HIPBLAS_STATUS_INTERNAL_ERROR;
+}
@@ -0,0 +1,258 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "hipblas_gemm_real_complex.h"
+#include "hipblas_handle.h"
+#include "hipblas_kernels.h"
+#include <algorithm>
+#include <hip/hip_runtime_api.h>
+#include <limits>
+
+namespace
+{
+    hipblasStatus_t launch_status(hipError_t err)
+    {
+        return err == hipSuccess ? HIPBLAS_STATUS_SUCCESS : HIPBLAS_STATUS_INTERNAL_ERROR;
+    }
+
+    bool valid_operation(hipblasOperation_t op)
+    {
+        return op == HIPBLAS_OP_N || op == HIPBLAS_OP_T || op == HIPBLAS_OP_C;
+    }
+
+    bool is_real(hipblasDatatype_t type)
+    {
+        return type == HIPBLAS_R_32F || type == HIPBLAS_R_64F;
+    }
+
+    // The complex type of a real one's precision
+    hipblasDatatype_t complex_of(hipblasDatatype_t real_type)
+    {
+        return real_type == HIPBLAS_R_32F ? HIPBLAS_C_32F : HIPBLAS_C_64F;
+    }
+
+    template <typename T>
+    hipblas_batched_operand<const T> typed(hipblas_batched_operand<const void> op)
+    {
+        return {static_cast<const T*>(op.ptr),
+                op.stride,
+                reinterpret_cast<const T* const*>(op.array)};
+    }
+
+    template <typename T>
+    hipblas_batched_operand<T> typed(hipblas_batched_operand<void> op)
+    {
+        return {static_cast<T*>(op.ptr), op.stride, reinterpret_cast<T* const*>(op.array)};
+    }
+
+    // Whether the complex alpha and beta, in host memory, have no imaginary parts
+    template <typename R>
+    bool real_scalars(const void* alpha, const void* beta)
+    {
+        return static_cast<const R*>(alpha)[1] == 0 && static_cast<const R*>(beta)[1] == 0;
+    }
+
+    template <typename R>
+    hipblasStatus_t kernel_gemm(hipblasHandle_t                     handle,
+                                hipblasOperation_t                  transa,
+                                hipblasOperation_t                  transb,
+                                int                                 m,
+                                int                                 n,
+                                int                                 k,
+                                const void*                         alpha,
+                                hipblas_batched_operand<const void> A,
+                                bool                                a_real,
+                                int                                 lda,
+                                hipblas_batched_operand<const void> B,
+                                int                                 ldb,
+                                const void*                         beta,
+                                hipblas_batched_operand<void>       C,
+                                int                                 ldc,
+                                int                                 batch_count)
+    {
+        using T = hip_complex_number<R>;
+
+        hipStream_t     stream;
+        hipblasStatus_t status = hipblasGetStream(handle, &stream);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        const T* alpha_t = static_cast<const T*>(alpha);
+        const T* beta_t  = static_cast<const T*>(beta);
+        bool     device_scalars
+            = static_cast<hipblas_handle*>(handle)->pointer_mode == HIPBLAS_POINTER_MODE_DEVICE;
+        int64_t scalar_stride = hipblas_scalar_stride(handle);
+        if(a_real)
+            return launch_status(hipblas_gemm_mixed_batched(stream,
+                                                            transa,
+                                                            transb,
+                                                            m,
+                                                            n,
+                                                            k,
+                                                            alpha_t,
+                                                            beta_t,
+                                                            device_scalars,
+                                                            scalar_stride,
+                                                            typed<R>(A),
+                                                            lda,
+                                                            typed<T>(B),
+                                                            ldb,
+                                                            typed<T>(C),
+                                                            ldc,
+                                                            batch_count));
+        return launch_status(hipblas_gemm_mixed_batched(stream,
+                                                        transa,
+                                                        transb,
+                                                        m,
+                                                        n,
+                                                        k,
+                                                        alpha_t,
+                                                        beta_t,
+                                                        device_scalars,
+                                                        scalar_stride,
+                                                        typed<T>(A),
+                                                        lda,
+                                                        typed<R>(B),
+                                                        ldb,
+                                                        typed<T>(C),
+                                                        ldc,
+                                                        batch_count));
+    }
+}
+
+bool hipblas_gemm_real_complex(hipblasHandle_t                     handle,
+                               hipblasOperation_t                  transa,
+                               hipblasOperation_t                  transb,
+                               int                                 m,
+                               int                                 n,
+                               int                                 k,
+                               const void*                         alpha,
+                               hipblas_batched_operand<const void> A,
+                               hipblasDatatype_t                   a_type,
+                               int                                 lda,
+                               hipblas_batched_operand<const void> B,
+                               hipblasDatatype_t                   b_type,
+                               int                                 ldb,
+                               const void*                         beta,
+                               hipblas_batched_operand<void>       C,
+                               hipblasDatatype_t                   c_type,
+                               int                                 ldc,
+                               int                                 batch_count,
+                               hipblasDatatype_t                   compute_type,
+                               hipblasStatus_t&                    status)
+{
+    bool              a_real    = is_real(a_type);
+    bool              b_real    = is_real(b_type);
+    hipblasDatatype_t real_type = a_real ? a_type : b_type;
+    if(a_real == b_real || c_type != complex_of(real_type) || (a_real ? b_type : a_type) != c_type)
+        return false;
+
+    hipblas_handle* h = static_cast<hipblas_handle*>(handle);
+    int a_rows = transa == HIPBLAS_OP_N ? m : k;
+    int b_rows = transb == HIPBLAS_OP_N ? k : n;
+    if(h == nullptr)
+        status = HIPBLAS_STATUS_NOT_INITIALIZED;
+    else if(compute_type != real_type && compute_type != c_type)
+        status = HIPBLAS_STATUS_NOT_SUPPORTED;
+    else if(!valid_operation(transa) || !valid_operation(transb) || m < 0 || n < 0 || k < 0
+            || batch_count < 0 || lda < std::max(1, a_rows) || ldb < std::max(1, b_rows)
+            || ldc < std::max(1, m))
+        status = HIPBLAS_STATUS_INVALID_VALUE;
+    else if(m == 0 || n == 0 || batch_count == 0)
+        status = HIPBLAS_STATUS_SUCCESS;
+    else if(!alpha || !beta || (!C.ptr && !C.array) || (k > 0 && !A.ptr && !A.array)
+            || (k > 0 && !B.ptr && !B.array))
+        status = HIPBLAS_STATUS_INVALID_VALUE;
+    else
+    {
+        // A complex A holds each column's real and imaginary parts side by side, so C = A B for
+        // a real B is the real gemm of those 2m x k and 2m x n views when the scalars are real
+        bool single = real_type == HIPBLAS_R_32F;
+        bool as_real
+            = !a_real && transa == HIPBLAS_OP_N && h->pointer_mode == HIPBLAS_POINTER_MODE_HOST
+              && std::max(lda, ldc) <= std::numeric_limits<int>::max() / 2
+              && (single ? real_scalars<float>(alpha, beta) : real_scalars<double>(alpha, beta));
+        if(as_real && C.array)
+            status = hipblasGemmBatchedEx(handle,
+                                          transa,
+                                          transb,
+                                          2 * m,
+                                          n,
+                                          k,
+                                          alpha,
+                                          const_cast<const void**>(A.array),
+                                          real_type,
+                                          2 * lda,
+                                          const_cast<const void**>(B.array),
+                                          real_type,
+                                          ldb,
+                                          beta,
+                                          const_cast<void**>(C.array),
+                                          real_type,
+                                          2 * ldc,
+                                          batch_count,
+                                          real_type,
+                                          HIPBLAS_GEMM_DEFAULT);
+        else if(as_real)
+            status = hipblasGemmStridedBatchedEx(handle,
+                                                 transa,
+                                                 transb,
+                                                 2 * m,
+                                                 n,
+                                                 k,
+                                                 alpha,
+                                                 A.ptr,
+                                                 real_type,
+                                                 2 * lda,
+                                                 2 * A.stride,
+                                                 B.ptr,
+                                                 real_type,
+                                                 ldb,
+                                                 B.stride,
+                                                 beta,
+                                                 C.ptr,
+                                                 real_type,
+                                                 2 * ldc,
+                                                 2 * C.stride,
+                                                 batch_count,
+                                                 real_type,
+                                                 HIPBLAS_GEMM_DEFAULT);
+        else if(single)
+            status = kernel_gemm<float>(handle,
+                                        transa,
+                                        transb,
+                                        m,
+                                        n,
+                                        k,
+                                        alpha,
+                                        A,
+                                        a_real,
+                                        lda,
+                                        B,
+                                        ldb,
+                                        beta,
+                                        C,
+                                        ldc,
+                                        batch_count);
+        else
+            status = kernel_gemm<double>(handle,
+                                         transa,
+                                         transb,
+                                         m,
+                                         n,
+                                         k,
+                                         alpha,
+                                         A,
+                                         a_real,
+                                         lda,
+                                         B,
+                                         ldb,
+                                         beta,
+                                         C,
+                                         ldc,
+                                         batch_count);
+    }
+    return true;
+}
@@ -0,0 +1,78 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "hipblas_kernels.h"
+#include "hipblas_logging.h"
+#include <algorithm>
+#include <hip/hip_runtime_api.h>
+
+namespace
+{
+    bool is_op(hipblasOperation_t op)
+    {
+        return op == HIPBLAS_OP_N || op == HIPBLAS_OP_T || op == HIPBLAS_OP_C;
+    }
+}
+
+// Neither backend's int8 gemm can requantize its output, so this is one kernel of the library's
+// own rather than hipblasGemmEx and a second pass over an int32 C
+hipblasStatus_t hipblasGemmExWithRequantization(hipblasHandle_t                handle,
+                                                hipblasOperation_t             trans_a,
+                                                hipblasOperation_t             trans_b,
+                                                int                            m,
+                                                int                            n,
+                                                int                            k,
+                                                const void*                    a,
+                                                int                            lda,
+                                                const void*                    b,
+                                                int                            ldb,
+                                                void*                          c,
+                                                int                            ldc,
+                                                const hipblasRequantization_t* requant)
+{
+    HIPBLAS_LOG_CALL(handle, trans_a, trans_b, m, n, k, a, lda, b, ldb, c, ldc, requant);
+    if(handle == nullptr)
+    {
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    }
+    if(requant == nullptr)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    if(!is_op(trans_a) || !is_op(trans_b)
+       || (requant->mode != HIPBLAS_REQUANT_PER_TENSOR && requant->mode != HIPBLAS_REQUANT_PER_ROW
+           && requant->mode != HIPBLAS_REQUANT_PER_COLUMN))
+    {
+        return HIPBLAS_STATUS_INVALID_ENUM;
+    }
+    if(m < 0 || n < 0 || k < 0 || lda < std::max(1, trans_a == HIPBLAS_OP_N ? m : k)
+       || ldb < std::max(1, trans_b == HIPBLAS_OP_N ? k : n) || ldc < std::max(1, m))
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    if(m == 0 || n == 0)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!c || !requant->scale || (k > 0 && (!a || !b)))
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+
+    hipStream_t stream;
+    hipblasGetStream(handle, &stream);
+    hipError_t err = hipblas_gemm_requant(stream,
+                                          trans_a,
+                                          trans_b,
+                                          m,
+                                          n,
+                                          k,
+                                          static_cast<const int8_t*>(a),
+                                          lda,
+                                          static_cast<const int8_t*>(b),
+                                          ldb,
+                                          static_cast<int8_t*>(c),
+                                          ldc,
+                                          *requant);
+    return err == hipSuccess ? HIPBLAS_STATUS_SUCCESS : HIPBLAS_STATUS_INTERNAL_ERROR;
+}
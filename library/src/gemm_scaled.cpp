@@ -0,0 +1,150 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "hipblas_gemm_scaled.h"
+#include "hipblas_handle.h"
+#include "hipblas_kernels.h"
+#include <algorithm>
+#include <hip/hip_runtime_api.h>
+
+namespace
+{
+    bool is_fp8(hipblasDatatype_t type)
+    {
+        return type == HIPBLAS_R_8F_E4M3 || type == HIPBLAS_R_8F_E5M2;
+    }
+
+    bool is_op(hipblasOperation_t op)
+    {
+        return op == HIPBLAS_OP_N || op == HIPBLAS_OP_T || op == HIPBLAS_OP_C;
+    }
+
+    hipblasStatus_t launch_status(hipError_t err)
+    {
+        return err == hipSuccess ? HIPBLAS_STATUS_SUCCESS : HIPBLAS_STATUS_INTERNAL_ERROR;
+    }
+}
+
+hipblasStatus_t hipblas_gemm_scaled_check(hipblasHandle_t            handle,
+                                          hipblasOperation_t         transa,
+                                          hipblasOperation_t         transb,
+                                          int                        m,
+                                          int                        n,
+                                          int                        k,
+                                          const void*                alpha,
+                                          hipblasDatatype_t          a_type,
+                                          int                        lda,
+                                          hipblasDatatype_t          b_type,
+                                          int                        ldb,
+                                          const void*                beta,
+                                          hipblasDatatype_t          c_type,
+                                          int                        ldc,
+                                          hipblasDatatype_t          d_type,
+                                          int                        ldd,
+                                          hipblasDatatype_t          compute_type,
+                                          const hipblasGemmScales_t* scales)
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(!is_op(transa) || !is_op(transb))
+        return HIPBLAS_STATUS_INVALID_ENUM;
+    if(!is_fp8(a_type) || !is_fp8(b_type) || compute_type != HIPBLAS_R_32F
+       || (c_type != HIPBLAS_R_16F && c_type != HIPBLAS_R_16B && c_type != HIPBLAS_R_32F)
+       || (d_type != c_type && !is_fp8(d_type)))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    if(m < 0 || n < 0 || k < 0 || lda < std::max(1, transa == HIPBLAS_OP_N ? m : k)
+       || ldb < std::max(1, transb == HIPBLAS_OP_N ? k : n) || ldc < std::max(1, m)
+       || ldd < std::max(1, m) || !alpha || !beta || !scales)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblas_gemm_scaled_fp32(hipblasHandle_t            handle,
+                                         hipblasOperation_t         transa,
+                                         hipblasOperation_t         transb,
+                                         int                        m,
+                                         int                        n,
+                                         int                        k,
+                                         const void*                alpha,
+                                         const void*                A,
+                                         hipblasDatatype_t          a_type,
+                                         int                        lda,
+                                         const void*                B,
+                                         hipblasDatatype_t          b_type,
+                                         int                        ldb,
+                                         const void*                beta,
+                                         const void*                C,
+                                         hipblasDatatype_t          c_type,
+                                         int                        ldc,
+                                         void*                      D,
+                                         hipblasDatatype_t          d_type,
+                                         int                        ldd,
+                                         hipblasGemmAlgo_t          algo,
+                                         const hipblasGemmScales_t* scales)
+{
+    hipblas_handle* h      = static_cast<hipblas_handle*>(handle);
+    int             a_rows = transa == HIPBLAS_OP_N ? m : k;
+    int             a_cols = transa == HIPBLAS_OP_N ? k : m;
+    int             b_rows = transb == HIPBLAS_OP_N ? k : n;
+    int             b_cols = transb == HIPBLAS_OP_N ? n : k;
+
+    float *         fa, *fb, *fp;
+    hipblasStatus_t status = hipblas_workspace_carve(handle,
+                                                     fa,
+                                                     size_t(a_rows) * a_cols,
+                                                     fb,
+                                                     size_t(b_rows) * b_cols,
+                                                     fp,
+                                                     size_t(m) * n);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    hipStream_t stream;
+    hipblasGetStream(handle, &stream);
+
+    // Both scales fold into the widened operands, and C is read only when beta can be nonzero
+    hipError_t err
+        = hipblas_scaled_to_float(stream, a_type, a_rows, a_cols, A, lda, scales->scale_a, fa);
+    if(err == hipSuccess)
+        err = hipblas_scaled_to_float(stream, b_type, b_rows, b_cols, B, ldb, scales->scale_b, fb);
+    if(err == hipSuccess)
+    {
+        if(h->pointer_mode == HIPBLAS_POINTER_MODE_HOST && *static_cast<const float*>(beta) == 0)
+            err = hipMemsetAsync(fp, 0, size_t(m) * n * sizeof(float), stream);
+        else
+            err = hipblas_scaled_to_float(stream, c_type, m, n, C, ldc, scales->scale_c, fp);
+    }
+    if(err != hipSuccess)
+        return launch_status(err);
+
+    // The classic path, so the gemm does not carve the workspace holding its own operands
+    hipblas_classic_gemm_guard classic(handle);
+    status = classic.status();
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasGemmEx(handle,
+                               transa,
+                               transb,
+                               m,
+                               n,
+                               k,
+                               alpha,
+                               fa,
+                               HIPBLAS_R_32F,
+                               std::max(1, a_rows),
+                               fb,
+                               HIPBLAS_R_32F,
+                               std::max(1, b_rows),
+                               beta,
+                               fp,
+                               HIPBLAS_R_32F,
+                               std::max(1, m),
+                               HIPBLAS_R_32F,
+                               algo);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    return launch_status(hipblas_scaled_from_float(
+        stream, m, n, fp, D, d_type, ldd, scales->scale_d, scales->amax_d));
+}
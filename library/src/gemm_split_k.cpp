@@ -0,0 +1,229 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "hipblas_gemm_split_k.h"
+#include "hipblas_handle.h"
+#include "hipblas_kernels.h"
+#include <algorithm>
+#include <hip/hip_runtime_api.h>
+
+namespace
+{
+    // The automatic choice assumes output tiles of SPLIT_K_TILE a side and aims for SPLIT_K_WAVES
+    // of them per compute unit, with parts at least SPLIT_K_MIN_DEPTH deep and at most
+    // SPLIT_K_MAX_PARTS of them
+    constexpr int SPLIT_K_TILE      = 128;
+    constexpr int SPLIT_K_WAVES     = 2;
+    constexpr int SPLIT_K_MIN_DEPTH = 256;
+    constexpr int SPLIT_K_MAX_PARTS = 64;
+
+    // Element size of the types split-k takes, 0 for the others
+    size_t split_k_size(hipblasDatatype_t type)
+    {
+        switch(type)
+        {
+        case HIPBLAS_R_32F:
+            return 4;
+        case HIPBLAS_R_64F:
+        case HIPBLAS_C_32F:
+            return 8;
+        case HIPBLAS_C_64F:
+            return 16;
+        default:
+            return 0;
+        }
+    }
+
+    bool valid_operation(hipblasOperation_t op)
+    {
+        return op == HIPBLAS_OP_N || op == HIPBLAS_OP_T || op == HIPBLAS_OP_C;
+    }
+
+    // The handle's part count, at most one column of op(A) each, or for 0 the automatic choice;
+    // a gemm that already fills the device gets one part
+    int split_k_parts(int hint, int m, int n, int k)
+    {
+        if(hint > 0)
+            return std::min(hint, k);
+
+        int device        = 0;
+        int compute_units = 0;
+        if(hipGetDevice(&device) != hipSuccess
+           || hipDeviceGetAttribute(&compute_units, hipDeviceAttributeMultiprocessorCount, device)
+                  != hipSuccess)
+            return 1;
+
+        int64_t tiles = int64_t((m - 1) / SPLIT_K_TILE + 1) * ((n - 1) / SPLIT_K_TILE + 1);
+        int64_t parts = int64_t(compute_units) * SPLIT_K_WAVES / tiles;
+        parts = std::min({parts, int64_t(k / SPLIT_K_MIN_DEPTH), int64_t(SPLIT_K_MAX_PARTS)});
+        return int(std::max<int64_t>(parts, 1));
+    }
+
+    template <typename T>
+    hipError_t reduce(hipStream_t stream,
+                      int         m,
+                      int         n,
+                      int         parts,
+                      const void* W,
+                      int64_t     stride_w,
+                      const void* alpha,
+                      const void* beta,
+                      bool        device_scalars,
+                      void*       C,
+                      int         ldc)
+    {
+        return hipblas_split_k_reduce(stream,
+                                      m,
+                                      n,
+                                      parts,
+                                      static_cast<const T*>(W),
+                                      stride_w,
+                                      static_cast<const T*>(alpha),
+                                      static_cast<const T*>(beta),
+                                      device_scalars,
+                                      static_cast<T*>(C),
+                                      ldc);
+    }
+}
+
+bool hipblas_gemm_split_k(hipblasHandle_t    handle,
+                          hipblasOperation_t transa,
+                          hipblasOperation_t transb,
+                          int                m,
+                          int                n,
+                          int                k,
+                          const void*        alpha,
+                          const void*        A,
+                          hipblasDatatype_t  a_type,
+                          int                lda,
+                          const void*        B,
+                          hipblasDatatype_t  b_type,
+                          int                ldb,
+                          const void*        beta,
+                          void*              C,
+                          hipblasDatatype_t  c_type,
+                          int                ldc,
+                          hipblasDatatype_t  compute_type,
+                          hipblasGemmAlgo_t  algo,
+                          hipblasStatus_t&   status)
+{
+    hipblas_handle* h = static_cast<hipblas_handle*>(handle);
+    if(h == nullptr || h->gemm_split_k == 1)
+        return false;
+
+    size_t elem = split_k_size(c_type);
+    if(elem == 0 || a_type != c_type || b_type != c_type || compute_type != c_type)
+        return false;
+
+    int a_rows = transa == HIPBLAS_OP_N ? m : k;
+    int b_rows = transb == HIPBLAS_OP_N ? k : n;
+    if(!valid_operation(transa) || !valid_operation(transb) || m <= 0 || n <= 0 || k <= 0
+       || lda < std::max(1, a_rows) || ldb < std::max(1, b_rows) || ldc < std::max(1, m) || !alpha
+       || !beta || !A || !B || !C)
+        return false;
+
+    int parts = split_k_parts(h->gemm_split_k, m, n, k);
+    if(parts < 2)
+        return false;
+
+    // Part p covers columns p * kc on of op(A) and the same rows of op(B); the k % parts left
+    // over make one more part, by a gemm of its own
+    int     kc     = k / parts;
+    int     tail   = k - parts * kc;
+    int     total  = parts + (tail > 0);
+    int64_t a_step = transa == HIPBLAS_OP_N ? int64_t(kc) * lda : kc;
+    int64_t b_step = transb == HIPBLAS_OP_N ? kc : int64_t(kc) * ldb;
+    int64_t w_step = int64_t(m) * n;
+
+    hipStream_t stream;
+    int8_t*     W;
+    if(hipblasGetStream(handle, &stream) != HIPBLAS_STATUS_SUCCESS
+       || hipblas_workspace_carve(handle, W, size_t(total) * w_step * elem)
+              != HIPBLAS_STATUS_SUCCESS)
+        return false;
+
+    // The part gemms take the classic path, so they leave the workspace alone, host scalars
+    // whatever the caller's are, and are not split again
+    bool         single    = c_type == HIPBLAS_R_32F || c_type == HIPBLAS_C_32F;
+    const float  one_32[2] = {1, 0}, zero_32[2] = {0, 0};
+    const double one_64[2] = {1, 0}, zero_64[2] = {0, 0};
+    const void*  one       = single ? static_cast<const void*>(one_32) : one_64;
+    const void*  zero      = single ? static_cast<const void*>(zero_32) : zero_64;
+
+    bool        device_scalars = h->pointer_mode == HIPBLAS_POINTER_MODE_DEVICE;
+    const char* a              = static_cast<const char*>(A);
+    const char* b              = static_cast<const char*>(B);
+    {
+        hipblas_classic_gemm_guard classic(handle, device_scalars);
+        status = classic.status();
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblasGemmStridedBatchedEx(handle,
+                                                 transa,
+                                                 transb,
+                                                 m,
+                                                 n,
+                                                 kc,
+                                                 one,
+                                                 a,
+                                                 a_type,
+                                                 lda,
+                                                 a_step,
+                                                 b,
+                                                 b_type,
+                                                 ldb,
+                                                 b_step,
+                                                 zero,
+                                                 W,
+                                                 c_type,
+                                                 m,
+                                                 w_step,
+                                                 parts,
+                                                 compute_type,
+                                                 algo);
+        if(status == HIPBLAS_STATUS_SUCCESS && tail > 0)
+            status = hipblasGemmEx(handle,
+                                   transa,
+                                   transb,
+                                   m,
+                                   n,
+                                   tail,
+                                   one,
+                                   a + parts * a_step * elem,
+                                   a_type,
+                                   lda,
+                                   b + parts * b_step * elem,
+                                   b_type,
+                                   ldb,
+                                   zero,
+                                   W + parts * w_step * elem,
+                                   c_type,
+                                   m,
+                                   compute_type,
+                                   algo);
+    }
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return true;
+
+    hipError_t err;
+    switch(c_type)
+    {
+    case HIPBLAS_R_32F:
+        err = reduce<float>(stream, m, n, total, W, w_step, alpha, beta, device_scalars, C, ldc);
+        break;
+    case HIPBLAS_R_64F:
+        err = reduce<double>(stream, m, n, total, W, w_step, alpha, beta, device_scalars, C, ldc);
+        break;
+    case HIPBLAS_C_32F:
+        err = reduce<hipblasComplex>(
+            stream, m, n, total, W, w_step, alpha, beta, device_scalars, C, ldc);
+        break;
+    default:
+        err = reduce<hipblasDoubleComplex>(
+            stream, m, n, total, W, w_step, alpha, beta, device_scalars, C, ldc);
+        break;
+    }
+    status = err == hipSuccess ? HIPBLAS_STATUS_SUCCESS : HIPBLAS_STATUS_INTERNAL_ERROR;
+    return true;
+}
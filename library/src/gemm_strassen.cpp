@@ -0,0 +1,386 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "hipblas_gemm_strassen.h"
+#include "hipblas_handle.h"
+#include <algorithm>
+#include <cstring>
+#include <hip/hip_runtime_api.h>
+
+namespace
+{
+    // The smallest m, n and k a level of recursion applies to when the handle's cutoff is 0
+    constexpr int STRASSEN_DEFAULT_CUTOFF = 8192;
+
+    template <typename T>
+    struct routines;
+
+    template <>
+    struct routines<float>
+    {
+        static constexpr auto gemm = hipblasSgemm;
+        static constexpr auto geam = hipblasSgeam;
+    };
+
+    template <>
+    struct routines<double>
+    {
+        static constexpr auto gemm = hipblasDgemm;
+        static constexpr auto geam = hipblasDgeam;
+    };
+
+    bool valid_operation(hipblasOperation_t op)
+    {
+        return op == HIPBLAS_OP_N || op == HIPBLAS_OP_T || op == HIPBLAS_OP_C;
+    }
+
+    // Whether an m x k by k x n product takes a level of recursion; the quadrants are then at
+    // least one element a side
+    bool recurses(int levels, int cutoff, int m, int n, int k)
+    {
+        return levels > 0 && std::min({m, n, k}) >= std::max(cutoff, 2);
+    }
+
+    // Elements of workspace the recursion of an m x k by k x n product takes: at each level the
+    // quadrant sums of op(A) and op(B) and two products, and the level below
+    size_t strassen_elements(int levels, int cutoff, int m, int n, int k)
+    {
+        if(!recurses(levels, cutoff, m, n, k))
+            return 0;
+        size_t m2 = m / 2, n2 = n / 2, k2 = k / 2;
+        return m2 * k2 + k2 * n2 + 2 * m2 * n2
+               + strassen_elements(levels - 1, cutoff, m / 2, n / 2, k / 2);
+    }
+
+    // Element (r, c) of op(X)
+    template <typename T>
+    const T* at(const T* X, int ld, hipblasOperation_t op, int r, int c)
+    {
+        return op == HIPBLAS_OP_N ? X + r + size_t(c) * ld : X + c + size_t(r) * ld;
+    }
+
+    template <typename T>
+    struct strassen
+    {
+        hipblasHandle_t handle;
+        int             cutoff;
+
+        // C = alpha op(A) op(B) + beta C through levels of recursion, the temporaries in W
+        hipblasStatus_t multiply(int                levels,
+                                 hipblasOperation_t transa,
+                                 hipblasOperation_t transb,
+                                 int                m,
+                                 int                n,
+                                 int                k,
+                                 T                  alpha,
+                                 const T*           A,
+                                 int                lda,
+                                 const T*           B,
+                                 int                ldb,
+                                 T                  beta,
+                                 T*                 C,
+                                 int                ldc,
+                                 T*                 W) const
+        {
+            if(!recurses(levels, cutoff, m, n, k))
+                return routines<T>::gemm(
+                    handle, transa, transb, m, n, k, &alpha, A, lda, B, ldb, &beta, C, ldc);
+
+            const hipblasOperation_t N  = HIPBLAS_OP_N;
+            int                      m2 = m / 2, n2 = n / 2, k2 = k / 2;
+            T*                       X     = W;
+            T*                       Y     = X + size_t(m2) * k2;
+            T*                       Z     = Y + size_t(k2) * n2;
+            T*                       V     = Z + size_t(m2) * n2;
+            T*                       below = V + size_t(m2) * n2;
+
+            const T* A11 = at(A, lda, transa, 0, 0);
+            const T* A12 = at(A, lda, transa, 0, k2);
+            const T* A21 = at(A, lda, transa, m2, 0);
+            const T* A22 = at(A, lda, transa, m2, k2);
+            const T* B11 = at(B, ldb, transb, 0, 0);
+            const T* B12 = at(B, ldb, transb, 0, n2);
+            const T* B21 = at(B, ldb, transb, k2, 0);
+            const T* B22 = at(B, ldb, transb, k2, n2);
+            T*       C11 = C;
+            T*       C12 = C + size_t(n2) * ldc;
+            T*       C21 = C + m2;
+            T*       C22 = C12 + m2;
+
+            const T one = 1, minus_one = -1, zero = 0;
+
+            // R = scale op(P) op(Q) + keep R for quadrants, and R = op(P) + sign op(Q)
+            auto product = [&](hipblasOperation_t opx,
+                               hipblasOperation_t opy,
+                               const T*           P,
+                               int                ldp,
+                               const T*           Q,
+                               int                ldq,
+                               T                  scale,
+                               T                  keep,
+                               T*                 R,
+                               int                ldr) {
+                return multiply(
+                    levels - 1, opx, opy, m2, n2, k2, scale, P, ldp, Q, ldq, keep, R, ldr, below);
+            };
+            auto sum = [&](hipblasOperation_t opx,
+                           hipblasOperation_t opy,
+                           int                rows,
+                           int                cols,
+                           const T*           P,
+                           int                ldp,
+                           const T&           sign,
+                           const T*           Q,
+                           int                ldq,
+                           T*                 R,
+                           int                ldr) {
+                return routines<T>::geam(
+                    handle, opx, opy, rows, cols, &one, P, ldp, &sign, Q, ldq, R, ldr);
+            };
+
+            // Winograd's schedule, with alpha in the products and beta in the first product or
+            // sum into each quadrant of C:
+            //   S1 = A21 + A22, S2 = S1 - A11, S3 = A11 - A21, S4 = A12 - S2
+            //   T1 = B12 - B11, T2 = B22 - T1, T3 = B22 - B12, T4 = T2 - B21
+            //   P1 = A11 B11, P2 = A12 B21, P3 = S4 B22, P4 = A22 T4, P5 = S1 T1, P6 = S2 T2,
+            //   P7 = S3 T3, U2 = P1 + P6, U3 = U2 + P7
+            //   C11 = P1 + P2, C12 = U2 + P5 + P3, C21 = U3 - P4, C22 = U3 + P5
+            // in X and Y for the S and T, Z for P1, U2 and U3, and V for P5
+            hipblasStatus_t status
+                = product(transa, transb, A11, lda, B11, ldb, alpha, zero, Z, m2);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = product(transa, transb, A12, lda, B21, ldb, alpha, beta, C11, ldc);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = sum(N, N, m2, n2, C11, ldc, one, Z, m2, C11, ldc);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = sum(transa, transa, m2, k2, A21, lda, one, A22, lda, X, m2);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = sum(transb, transb, k2, n2, B12, ldb, minus_one, B11, ldb, Y, k2);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = product(N, N, X, m2, Y, k2, alpha, zero, V, m2);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = sum(N, transa, m2, k2, X, m2, minus_one, A11, lda, X, m2);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = sum(transb, N, k2, n2, B22, ldb, minus_one, Y, k2, Y, k2);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = product(N, N, X, m2, Y, k2, alpha, one, Z, m2);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = sum(transa, N, m2, k2, A12, lda, minus_one, X, m2, X, m2);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = product(N, transb, X, m2, B22, ldb, alpha, beta, C12, ldc);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = sum(N, N, m2, n2, C12, ldc, one, Z, m2, C12, ldc);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = sum(N, N, m2, n2, C12, ldc, one, V, m2, C12, ldc);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = sum(N, transb, k2, n2, Y, k2, minus_one, B21, ldb, Y, k2);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = product(transa, N, A22, lda, Y, k2, -alpha, beta, C21, ldc);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = sum(transa, transa, m2, k2, A11, lda, minus_one, A21, lda, X, m2);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = sum(transb, transb, k2, n2, B22, ldb, minus_one, B12, ldb, Y, k2);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = product(N, N, X, m2, Y, k2, alpha, one, Z, m2);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = sum(N, N, m2, n2, C21, ldc, one, Z, m2, C21, ldc);
+            // For beta = 0 C22 is not read, as by the gemm
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = beta == zero ? sum(N, N, m2, n2, Z, m2, zero, Z, m2, C22, ldc)
+                                      : sum(N, N, m2, n2, Z, m2, beta, C22, ldc, C22, ldc);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = sum(N, N, m2, n2, C22, ldc, one, V, m2, C22, ldc);
+
+            // Odd sizes leave the last column of op(A) and row of op(B) out of the even part, and
+            // the last row and column of C out of it altogether
+            if(status == HIPBLAS_STATUS_SUCCESS && k % 2)
+                status = routines<T>::gemm(handle,
+                                           transa,
+                                           transb,
+                                           2 * m2,
+                                           2 * n2,
+                                           1,
+                                           &alpha,
+                                           at(A, lda, transa, 0, k - 1),
+                                           lda,
+                                           at(B, ldb, transb, k - 1, 0),
+                                           ldb,
+                                           &one,
+                                           C,
+                                           ldc);
+            if(status == HIPBLAS_STATUS_SUCCESS && m % 2)
+                status = routines<T>::gemm(handle,
+                                           transa,
+                                           transb,
+                                           1,
+                                           n,
+                                           k,
+                                           &alpha,
+                                           at(A, lda, transa, m - 1, 0),
+                                           lda,
+                                           B,
+                                           ldb,
+                                           &beta,
+                                           C + (m - 1),
+                                           ldc);
+            if(status == HIPBLAS_STATUS_SUCCESS && n % 2)
+                status = routines<T>::gemm(handle,
+                                           transa,
+                                           transb,
+                                           2 * m2,
+                                           1,
+                                           k,
+                                           &alpha,
+                                           A,
+                                           lda,
+                                           at(B, ldb, transb, 0, n - 1),
+                                           ldb,
+                                           &beta,
+                                           C + size_t(n - 1) * ldc,
+                                           ldc);
+            return status;
+        }
+    };
+
+    // The scalars are passed as double, which holds either type exactly
+    template <typename T>
+    hipblasStatus_t run(hipblas_handle*    h,
+                        hipblasOperation_t transa,
+                        hipblasOperation_t transb,
+                        int                m,
+                        int                n,
+                        int                k,
+                        double             alpha,
+                        const void*        A,
+                        int                lda,
+                        const void*        B,
+                        int                ldb,
+                        double             beta,
+                        void*              C,
+                        int                ldc,
+                        int                levels,
+                        int                cutoff,
+                        void*              W)
+    {
+        strassen<T> s{h, cutoff};
+        return s.multiply(levels,
+                          transa,
+                          transb,
+                          m,
+                          n,
+                          k,
+                          T(alpha),
+                          static_cast<const T*>(A),
+                          lda,
+                          static_cast<const T*>(B),
+                          ldb,
+                          T(beta),
+                          static_cast<T*>(C),
+                          ldc,
+                          static_cast<T*>(W));
+    }
+}
+
+bool hipblas_gemm_strassen(hipblasHandle_t    handle,
+                           hipblasOperation_t transa,
+                           hipblasOperation_t transb,
+                           int                m,
+                           int                n,
+                           int                k,
+                           const void*        alpha,
+                           const void*        A,
+                           hipblasDatatype_t  a_type,
+                           int                lda,
+                           const void*        B,
+                           hipblasDatatype_t  b_type,
+                           int                ldb,
+                           const void*        beta,
+                           void*              C,
+                           hipblasDatatype_t  c_type,
+                           int                ldc,
+                           hipblasDatatype_t  compute_type,
+                           hipblasStatus_t&   status)
+{
+    hipblas_handle* h = static_cast<hipblas_handle*>(handle);
+    if(h == nullptr || h->gemm_strassen_levels == 0)
+        return false;
+
+    bool single = c_type == HIPBLAS_R_32F;
+    if((!single && c_type != HIPBLAS_R_64F) || a_type != c_type || b_type != c_type
+       || compute_type != c_type)
+        return false;
+
+    int levels = h->gemm_strassen_levels;
+    int cutoff = h->gemm_strassen_cutoff ? h->gemm_strassen_cutoff : STRASSEN_DEFAULT_CUTOFF;
+    int a_rows = transa == HIPBLAS_OP_N ? m : k;
+    int b_rows = transb == HIPBLAS_OP_N ? k : n;
+    if(!valid_operation(transa) || !valid_operation(transb) || !recurses(levels, cutoff, m, n, k)
+       || lda < std::max(1, a_rows) || ldb < std::max(1, b_rows) || ldc < std::max(1, m) || !alpha
+       || !beta || !A || !B || !C)
+        return false;
+
+    // The scalars are needed on the host, which device ones cannot be read to under capture
+    bool device_scalars = h->pointer_mode == HIPBLAS_POINTER_MODE_DEVICE;
+    if(device_scalars && h->capture_mode == HIPBLAS_CAPTURE_MODE_SAFE)
+        return false;
+
+    size_t      elem = single ? sizeof(float) : sizeof(double);
+    float       scalars_32[2];
+    double      scalars_64[2];
+    void*       alpha_host = single ? static_cast<void*>(scalars_32) : scalars_64;
+    void*       beta_host  = single ? static_cast<void*>(scalars_32 + 1) : scalars_64 + 1;
+    hipStream_t stream;
+    if(hipblasGetStream(handle, &stream) != HIPBLAS_STATUS_SUCCESS)
+        return false;
+    if(device_scalars)
+    {
+        if(hipMemcpyAsync(alpha_host, alpha, elem, hipMemcpyDeviceToHost, stream) != hipSuccess
+           || hipMemcpyAsync(beta_host, beta, elem, hipMemcpyDeviceToHost, stream) != hipSuccess
+           || hipStreamSynchronize(stream) != hipSuccess)
+            return false;
+    }
+    else
+    {
+        std::memcpy(alpha_host, alpha, elem);
+        std::memcpy(beta_host, beta, elem);
+    }
+    double alpha_value = single ? scalars_32[0] : scalars_64[0];
+    double beta_value  = single ? scalars_32[1] : scalars_64[1];
+
+    // alpha = 0 is the plain path's quick return
+    if(alpha_value == 0)
+        return false;
+
+    int8_t* W;
+    if(hipblas_workspace_carve(handle, W, strassen_elements(levels, cutoff, m, n, k) * elem)
+       != HIPBLAS_STATUS_SUCCESS)
+        return false;
+
+    // The products and sums take the classic path, so they leave the workspace alone, and host
+    // scalars whatever the caller's are
+    hipblas_classic_gemm_guard classic(handle, device_scalars);
+    status = classic.status();
+
+    auto multiply = single ? run<float> : run<double>;
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = multiply(h,
+                          transa,
+                          transb,
+                          m,
+                          n,
+                          k,
+                          alpha_value,
+                          A,
+                          lda,
+                          B,
+                          ldb,
+                          beta_value,
+                          C,
+                          ldc,
+                          levels,
+                          cutoff,
+                          W);
+    return true;
+}
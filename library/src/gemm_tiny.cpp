@@ -0,0 +1,87 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "hipblas_gemm_tiny.h"
+#include "hipblas_handle.h"
+#include "hipblas_kernels.h"
+#include "hipblas_logging.h"
+#include <algorithm>
+
+namespace
+{
+    bool valid_operation(hipblasOperation_t op)
+    {
+        return op == HIPBLAS_OP_N || op == HIPBLAS_OP_T || op == HIPBLAS_OP_C;
+    }
+}
+
+template <typename T>
+bool hipblas_gemm_tiny(const char*        caller,
+                       hipblasHandle_t    handle,
+                       hipblasOperation_t transa,
+                       hipblasOperation_t transb,
+                       int                m,
+                       int                n,
+                       int                k,
+                       const T*           alpha,
+                       const T*           A,
+                       int                lda,
+                       long long          bsa,
+                       const T*           B,
+                       int                ldb,
+                       long long          bsb,
+                       const T*           beta,
+                       T*                 C,
+                       int                ldc,
+                       long long          bsc,
+                       int                batch_count,
+                       hipblasStatus_t&   status)
+{
+    const hipblas_handle* h = static_cast<const hipblas_handle*>(handle);
+    if(h == nullptr || std::max({m, n, k}) > h->gemm_tiny_limit)
+        return false;
+
+    // Argument errors, and k == 0, which only scales C, are left to the backend
+    if(!valid_operation(transa) || !valid_operation(transb) || m <= 0 || n <= 0 || k <= 0
+       || batch_count <= 0 || lda < (transa == HIPBLAS_OP_N ? m : k)
+       || ldb < (transb == HIPBLAS_OP_N ? k : n) || ldc < m || !alpha || !beta || !A || !B || !C)
+        return false;
+
+    hipStream_t stream;
+    if(hipblasGetStream(handle, &stream) != HIPBLAS_STATUS_SUCCESS)
+        return false;
+
+    hipblas_log_route(caller, "hipblas_gemm_tiny_strided_batched");
+    hipError_t err
+        = hipblas_gemm_tiny_strided_batched(stream,
+                                            transa,
+                                            transb,
+                                            m,
+                                            n,
+                                            k,
+                                            alpha,
+                                            beta,
+                                            h->pointer_mode == HIPBLAS_POINTER_MODE_DEVICE,
+                                            hipblas_scalar_stride(handle),
+                                            A,
+                                            lda,
+                                            bsa,
+                                            B,
+                                            ldb,
+                                            bsb,
+                                            C,
+                                            ldc,
+                                            bsc,
+                                            batch_count);
+    status = err == hipSuccess ? HIPBLAS_STATUS_SUCCESS : HIPBLAS_STATUS_INTERNAL_ERROR;
+    return true;
+}
+
+// clang-format off
+template bool hipblas_gemm_tiny<float>(const char*, hipblasHandle_t, hipblasOperation_t, hipblasOperation_t, int, int, int, const float*, const float*, int, long long, const float*, int, long long, const float*, float*, int, long long, int, hipblasStatus_t&);
+template bool hipblas_gemm_tiny<double>(const char*, hipblasHandle_t, hipblasOperation_t, hipblasOperation_t, int, int, int, const double*, const double*, int, long long, const double*, int, long long, const double*, double*, int, long long, int, hipblasStatus_t&);
+template bool hipblas_gemm_tiny<hipblasComplex>(const char*, hipblasHandle_t, hipblasOperation_t, hipblasOperation_t, int, int, int, const hipblasComplex*, const hipblasComplex*, int, long long, const hipblasComplex*, int, long long, const hipblasComplex*, hipblasComplex*, int, long long, int, hipblasStatus_t&);
+template bool hipblas_gemm_tiny<hipblasDoubleComplex>(const char*, hipblasHandle_t, hipblasOperation_t, hipblasOperation_t, int, int, int, const hipblasDoubleComplex*, const hipblasDoubleComplex*, int, long long, const hipblasDoubleComplex*, int, long long, const hipblasDoubleComplex*, hipblasDoubleComplex*, int, long long, int, hipblasStatus_t&);
+// clang-format on
@@ -0,0 +1,237 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipblas_gemm_tuning.h"
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+    struct named_type
+    {
+        const char*       name;
+        hipblasDatatype_t type;
+    };
+
+    constexpr named_type type_names[] = {{"f16_r", HIPBLAS_R_16F},
+                                         {"f32_r", HIPBLAS_R_32F},
+                                         {"f64_r", HIPBLAS_R_64F},
+                                         {"f16_c", HIPBLAS_C_16F},
+                                         {"f32_c", HIPBLAS_C_32F},
+                                         {"f64_c", HIPBLAS_C_64F},
+                                         {"bf16_r", HIPBLAS_R_16B},
+                                         {"bf16_c", HIPBLAS_C_16B},
+                                         {"i8_r", HIPBLAS_R_8I},
+                                         {"u8_r", HIPBLAS_R_8U},
+                                         {"i32_r", HIPBLAS_R_32I},
+                                         {"u32_r", HIPBLAS_R_32U}};
+
+    bool parse_type(const std::string& field, int& type)
+    {
+        for(const named_type& t : type_names)
+            if(field == t.name)
+            {
+                type = t.type;
+                return true;
+            }
+        return false;
+    }
+
+    bool parse_operation(const std::string& field, int& op)
+    {
+        if(field.size() != 1)
+            return false;
+        switch(field[0])
+        {
+        case 'N':
+        case 'n':
+            op = HIPBLAS_OP_N;
+            return true;
+        case 'T':
+        case 't':
+            op = HIPBLAS_OP_T;
+            return true;
+        case 'C':
+        case 'c':
+            op = HIPBLAS_OP_C;
+            return true;
+        }
+        return false;
+    }
+
+    bool parse_int(const std::string& field, int& value)
+    {
+        char* end;
+        long  v = std::strtol(field.c_str(), &end, 10);
+        if(field.empty() || *end || v < INT32_MIN || v > INT32_MAX)
+            return false;
+        value = int(v);
+        return true;
+    }
+
+    // default, default_tensor_op, algo<i> with i <= 23, or algo<i>_tensor_op with i <= 15
+    bool parse_algo(const std::string& field, hipblasGemmAlgo_t& algo)
+    {
+        if(field == "default")
+        {
+            algo = HIPBLAS_GEMM_DEFAULT;
+            return true;
+        }
+        if(field == "default_tensor_op")
+        {
+            algo = HIPBLAS_GEMM_DEFAULT_TENSOR_OP;
+            return true;
+        }
+        if(field.compare(0, 4, "algo") != 0)
+            return false;
+
+        const char* suffix    = "_tensor_op";
+        size_t      digits    = field.size() - 4;
+        bool        tensor_op = false;
+        if(field.size() > 4 + std::strlen(suffix)
+           && field.compare(field.size() - std::strlen(suffix), std::string::npos, suffix) == 0)
+        {
+            digits -= std::strlen(suffix);
+            tensor_op = true;
+        }
+
+        int index;
+        if(!parse_int(field.substr(4, digits), index) || index < 0
+           || index > (tensor_op ? 15 : 23))
+            return false;
+        algo = hipblasGemmAlgo_t((tensor_op ? HIPBLAS_GEMM_ALGO0_TENSOR_OP : HIPBLAS_GEMM_ALGO0)
+                                 + index);
+        return true;
+    }
+
+    std::string trim(const std::string& s)
+    {
+        size_t b = s.find_first_not_of(" \t\r");
+        size_t e = s.find_last_not_of(" \t\r");
+        return b == std::string::npos ? std::string() : s.substr(b, e - b + 1);
+    }
+}
+
+hipblasStatus_t hipblas_gemm_tuning::load(const char*                                 path,
+                                          std::shared_ptr<const hipblas_gemm_tuning>& out)
+{
+    if(path == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    std::ifstream file(path);
+    if(!file)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    std::shared_ptr<hipblas_gemm_tuning> tuning = std::make_shared<hipblas_gemm_tuning>();
+    std::string                          line;
+    while(std::getline(file, line))
+    {
+        line = trim(line.substr(0, line.find('#')));
+        if(line.empty())
+            continue;
+
+        std::vector<std::string> fields;
+        std::stringstream        stream(line);
+        std::string              field;
+        while(std::getline(stream, field, ','))
+            fields.push_back(trim(field));
+        if(fields.size() != 11)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        key                k;
+        hipblas_gemm_tuned tuned;
+        bool ok = parse_operation(fields[0], k[0]) && parse_operation(fields[1], k[1]);
+        for(int i = 2; i < 5; i++)
+            ok = ok && parse_int(fields[i], k[i]) && k[i] >= 0;
+        for(int i = 5; i < 9; i++)
+            ok = ok && parse_type(fields[i], k[i]);
+        ok = ok && parse_algo(fields[9], tuned.algo) && parse_int(fields[10], tuned.solution_index)
+             && tuned.solution_index >= 0;
+        if(!ok)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        tuning->entries[k] = tuned;
+    }
+
+    out = std::move(tuning);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+std::shared_ptr<const hipblas_gemm_tuning> hipblas_gemm_tuning::from_environment()
+{
+    std::shared_ptr<const hipblas_gemm_tuning> tuning;
+    const char*                                path = std::getenv("HIPBLAS_GEMM_TUNING_FILE");
+    if(path && *path && load(path, tuning) != HIPBLAS_STATUS_SUCCESS)
+        tuning = nullptr;
+    return tuning;
+}
+
+const hipblas_gemm_tuned* hipblas_gemm_tuning::find(hipblasOperation_t transa,
+                                                    hipblasOperation_t transb,
+                                                    int                m,
+                                                    int                n,
+                                                    int                k,
+                                                    hipblasDatatype_t  a_type,
+                                                    hipblasDatatype_t  b_type,
+                                                    hipblasDatatype_t  c_type,
+                                                    hipblasDatatype_t  compute_type) const
+{
+    auto it = entries.find({transa, transb, m, n, k, a_type, b_type, c_type, compute_type});
+    return it == entries.end() ? nullptr : &it->second;
+}
+
+std::vector<hipblasGemmShape_t> hipblas_gemm_tuning::shapes() const
+{
+    std::vector<hipblasGemmShape_t> list;
+    for(const auto& entry : entries)
+    {
+        const key& k = entry.first;
+        list.push_back({hipblasOperation_t(k[0]),
+                        hipblasOperation_t(k[1]),
+                        k[2],
+                        k[3],
+                        k[4],
+                        hipblasDatatype_t(k[5]),
+                        hipblasDatatype_t(k[6]),
+                        hipblasDatatype_t(k[7]),
+                        hipblasDatatype_t(k[8])});
+    }
+    return list;
+}
+
+std::string hipblas_gemm_tuning_row(const hipblasGemmShape_t& shape,
+                                    const hipblas_gemm_tuned& tuned)
+{
+    auto operation = [](hipblasOperation_t op) {
+        return op == HIPBLAS_OP_N ? "N" : op == HIPBLAS_OP_T ? "T" : "C";
+    };
+    auto type = [](hipblasDatatype_t t) {
+        for(const named_type& named : type_names)
+            if(named.type == t)
+                return named.name;
+        return "?";
+    };
+
+    std::string algo;
+    if(tuned.algo == HIPBLAS_GEMM_DEFAULT)
+        algo = "default";
+    else if(tuned.algo == HIPBLAS_GEMM_DEFAULT_TENSOR_OP)
+        algo = "default_tensor_op";
+    else if(tuned.algo >= HIPBLAS_GEMM_ALGO0_TENSOR_OP)
+        algo = "algo" + std::to_string(tuned.algo - HIPBLAS_GEMM_ALGO0_TENSOR_OP) + "_tensor_op";
+    else
+        algo = "algo" + std::to_string(tuned.algo - HIPBLAS_GEMM_ALGO0);
+
+    std::ostringstream row;
+    row << operation(shape.transA) << ',' << operation(shape.transB) << ',' << shape.m << ','
+        << shape.n << ',' << shape.k << ',' << type(shape.a_type) << ',' << type(shape.b_type)
+        << ',' << type(shape.c_type) << ',' << type(shape.compute_type) << ',' << algo << ','
+        << tuned.solution_index;
+    return row.str();
+}
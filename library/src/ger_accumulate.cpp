@@ -0,0 +1,216 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "hipblas_handle.h"
+#include "hipblas_kernels.h"
+#include "hipblas_logging.h"
+#include <algorithm>
+#include <hip/hip_runtime_api.h>
+
+namespace
+{
+    template <typename T>
+    struct routines;
+
+    template <>
+    struct routines<float>
+    {
+        static constexpr auto gemm = hipblasSgemm;
+    };
+
+    template <>
+    struct routines<double>
+    {
+        static constexpr auto gemm = hipblasDgemm;
+    };
+
+    template <>
+    struct routines<hipblasComplex>
+    {
+        static constexpr auto gemm = hipblasCgemm;
+    };
+
+    template <>
+    struct routines<hipblasDoubleComplex>
+    {
+        static constexpr auto gemm = hipblasZgemm;
+    };
+
+    // With the x_i as the columns of the m x k X and the y_i those of the n x k Y, the sum of
+    // the updates is X Y^T, or X Y^H for gerc, and A takes it as a gemm with beta = 1. A device
+    // alpha needs a device 1, which the 1 x 1 identity in the workspace provides
+    template <typename T>
+    hipblasStatus_t ger_accumulate(hipblasHandle_t    handle,
+                                   hipblasOperation_t op_y,
+                                   int                m,
+                                   int                n,
+                                   int                k,
+                                   const T*           alpha,
+                                   const T* const     x[],
+                                   int                incx,
+                                   const T* const     y[],
+                                   int                incy,
+                                   T*                 A,
+                                   int                lda)
+    {
+        if(handle == nullptr)
+        {
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        }
+        if(m < 0 || n < 0 || k < 0 || incx == 0 || incy == 0 || lda < std::max(1, m))
+        {
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        }
+        if(m == 0 || n == 0 || k == 0)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(!alpha || !x || !y || !A)
+        {
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        }
+
+        hipblas_handle* h = static_cast<hipblas_handle*>(handle);
+        hipStream_t     stream;
+        hipblasGetStream(handle, &stream);
+        bool device_scalars = h->pointer_mode == HIPBLAS_POINTER_MODE_DEVICE;
+
+        T*              X;
+        T*              Y;
+        T*              one_device;
+        hipblasStatus_t status = hipblas_workspace_carve(handle,
+                                                         X,
+                                                         size_t(m) * k,
+                                                         Y,
+                                                         size_t(n) * k,
+                                                         one_device,
+                                                         size_t(device_scalars));
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        if(hipblas_gather_batched_to_strided(stream, m, x, incx, X, m, k) != hipSuccess
+           || hipblas_gather_batched_to_strided(stream, n, y, incy, Y, n, k) != hipSuccess
+           || (device_scalars
+               && hipblas_set_identity_strided_batched(stream, 1, one_device, 1, 0, 1)
+                      != hipSuccess))
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+        // The classic path, so the gemm does not carve the workspace holding X and Y
+        T                          one = 1;
+        hipblas_classic_gemm_guard classic(handle);
+        status = classic.status();
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        return routines<T>::gemm(handle,
+                                 HIPBLAS_OP_N,
+                                 op_y,
+                                 m,
+                                 n,
+                                 k,
+                                 alpha,
+                                 X,
+                                 m,
+                                 Y,
+                                 n,
+                                 device_scalars ? one_device : &one,
+                                 A,
+                                 lda);
+    }
+}
+
+hipblasStatus_t hipblasSgerAccumulate(hipblasHandle_t    handle,
+                                      int                m,
+                                      int                n,
+                                      int                k,
+                                      const float*       alpha,
+                                      const float* const x[],
+                                      int                incx,
+                                      const float* const y[],
+                                      int                incy,
+                                      float*             A,
+                                      int                lda)
+{
+    HIPBLAS_LOG_CALL(handle, m, n, k, alpha, x, incx, y, incy, A, lda);
+    return ger_accumulate(handle, HIPBLAS_OP_T, m, n, k, alpha, x, incx, y, incy, A, lda);
+}
+
+hipblasStatus_t hipblasDgerAccumulate(hipblasHandle_t     handle,
+                                      int                 m,
+                                      int                 n,
+                                      int                 k,
+                                      const double*       alpha,
+                                      const double* const x[],
+                                      int                 incx,
+                                      const double* const y[],
+                                      int                 incy,
+                                      double*             A,
+                                      int                 lda)
+{
+    HIPBLAS_LOG_CALL(handle, m, n, k, alpha, x, incx, y, incy, A, lda);
+    return ger_accumulate(handle, HIPBLAS_OP_T, m, n, k, alpha, x, incx, y, incy, A, lda);
+}
+
+hipblasStatus_t hipblasCgeruAccumulate(hipblasHandle_t             handle,
+                                       int                         m,
+                                       int                         n,
+                                       int                         k,
+                                       const hipblasComplex*       alpha,
+                                       const hipblasComplex* const x[],
+                                       int                         incx,
+                                       const hipblasComplex* const y[],
+                                       int                         incy,
+                                       hipblasComplex*             A,
+                                       int                         lda)
+{
+    HIPBLAS_LOG_CALL(handle, m, n, k, alpha, x, incx, y, incy, A, lda);
+    return ger_accumulate(handle, HIPBLAS_OP_T, m, n, k, alpha, x, incx, y, incy, A, lda);
+}
+
+hipblasStatus_t hipblasCgercAccumulate(hipblasHandle_t             handle,
+                                       int                         m,
+                                       int                         n,
+                                       int                         k,
+                                       const hipblasComplex*       alpha,
+                                       const hipblasComplex* const x[],
+                                       int                         incx,
+                                       const hipblasComplex* const y[],
+                                       int                         incy,
+                                       hipblasComplex*             A,
+                                       int                         lda)
+{
+    HIPBLAS_LOG_CALL(handle, m, n, k, alpha, x, incx, y, incy, A, lda);
+    return ger_accumulate(handle, HIPBLAS_OP_C, m, n, k, alpha, x, incx, y, incy, A, lda);
+}
+
+hipblasStatus_t hipblasZgeruAccumulate(hipblasHandle_t                   handle,
+                                       int                               m,
+                                       int                               n,
+                                       int                               k,
+                                       const hipblasDoubleComplex*       alpha,
+                                       const hipblasDoubleComplex* const x[],
+                                       int                               incx,
+                                       const hipblasDoubleComplex* const y[],
+                                       int                               incy,
+                                       hipblasDoubleComplex*             A,
+                                       int                               lda)
+{
+    HIPBLAS_LOG_CALL(handle, m, n, k, alpha, x, incx, y, incy, A, lda);
+    return ger_accumulate(handle, HIPBLAS_OP_T, m, n, k, alpha, x, incx, y, incy, A, lda);
+}
+
+hipblasStatus_t hipblasZgercAccumulate(hipblasHandle_t                   handle,
+                                       int                               m,
+                                       int                               n,
+                                       int                               k,
+                                       const hipblasDoubleComplex*       alpha,
+                                       const hipblasDoubleComplex* const x[],
+                                       int                               incx,
+                                       const hipblasDoubleComplex* const y[],
+                                       int                               incy,
+                                       hipblasDoubleComplex*             A,
+                                       int                               lda)
+{
+    HIPBLAS_LOG_CALL(handle, m, n, k, alpha, x, incx, y, incy, A, lda);
+    return ger_accumulate(handle, HIPBLAS_OP_C, m, n, k, alpha, x, incx, y, incy, A, lda);
+}
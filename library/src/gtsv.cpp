@@ -0,0 +1,168 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "hipblas_handle.h"
+#include "hipblas_kernels.h"
+#include "hipblas_logging.h"
+#include <hip/hip_runtime_api.h>
+
+namespace
+{
+    hipblasStatus_t launch_status(hipError_t err)
+    {
+        return err == hipSuccess ? HIPBLAS_STATUS_SUCCESS : HIPBLAS_STATUS_INTERNAL_ERROR;
+    }
+
+    // Neither backend links a sparse library, so both run the same kernel: one thread per system,
+    // on the handle's stream, with the eliminated superdiagonal carved from the handle workspace.
+    // The interleaved layout, element i of batch b at i * batch_count + b, makes every access of
+    // a warp contiguous
+    template <typename T>
+    hipblasStatus_t gtsv_batched(hipblasHandle_t handle,
+                                 int             m,
+                                 const T*        dl,
+                                 const T*        d,
+                                 const T*        du,
+                                 T*              x,
+                                 int64_t         inc,
+                                 int64_t         stride,
+                                 int             batch_count)
+    {
+        if(m < 0 || batch_count < 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(m == 0 || batch_count == 0)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(d == nullptr || x == nullptr || (m > 1 && (dl == nullptr || du == nullptr)))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        hipStream_t     stream;
+        hipblasStatus_t status = hipblasGetStream(handle, &stream);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        T* work;
+        status = hipblas_workspace_carve(handle, work, size_t(m - 1) * batch_count);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        return launch_status(
+            hipblas_gtsv_batched(stream, m, dl, d, du, x, inc, stride, work, batch_count));
+    }
+
+    template <typename T>
+    hipblasStatus_t gtsv_strided_batched(hipblasHandle_t handle,
+                                         int             m,
+                                         const T*        dl,
+                                         const T*        d,
+                                         const T*        du,
+                                         T*              x,
+                                         int             stride,
+                                         int             batch_count)
+    {
+        if(stride < m)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        return gtsv_batched(handle, m, dl, d, du, x, 1, stride, batch_count);
+    }
+}
+
+hipblasStatus_t hipblasSgtsvStridedBatched(hipblasHandle_t handle,
+                                           const int       m,
+                                           const float*    dl,
+                                           const float*    d,
+                                           const float*    du,
+                                           float*          x,
+                                           const int       stride,
+                                           const int       batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, m, dl, d, du, x, stride, batch_count);
+    return gtsv_strided_batched(handle, m, dl, d, du, x, stride, batch_count);
+}
+
+hipblasStatus_t hipblasDgtsvStridedBatched(hipblasHandle_t handle,
+                                           const int       m,
+                                           const double*   dl,
+                                           const double*   d,
+                                           const double*   du,
+                                           double*         x,
+                                           const int       stride,
+                                           const int       batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, m, dl, d, du, x, stride, batch_count);
+    return gtsv_strided_batched(handle, m, dl, d, du, x, stride, batch_count);
+}
+
+hipblasStatus_t hipblasCgtsvStridedBatched(hipblasHandle_t       handle,
+                                           const int             m,
+                                           const hipblasComplex* dl,
+                                           const hipblasComplex* d,
+                                           const hipblasComplex* du,
+                                           hipblasComplex*       x,
+                                           const int             stride,
+                                           const int             batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, m, dl, d, du, x, stride, batch_count);
+    return gtsv_strided_batched(handle, m, dl, d, du, x, stride, batch_count);
+}
+
+hipblasStatus_t hipblasZgtsvStridedBatched(hipblasHandle_t             handle,
+                                           const int                   m,
+                                           const hipblasDoubleComplex* dl,
+                                           const hipblasDoubleComplex* d,
+                                           const hipblasDoubleComplex* du,
+                                           hipblasDoubleComplex*       x,
+                                           const int                   stride,
+                                           const int                   batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, m, dl, d, du, x, stride, batch_count);
+    return gtsv_strided_batched(handle, m, dl, d, du, x, stride, batch_count);
+}
+
+hipblasStatus_t hipblasSgtsvInterleavedBatched(hipblasHandle_t handle,
+                                               const int       m,
+                                               const float*    dl,
+                                               const float*    d,
+                                               const float*    du,
+                                               float*          x,
+                                               const int       batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, m, dl, d, du, x, batch_count);
+    return gtsv_batched(handle, m, dl, d, du, x, batch_count, 1, batch_count);
+}
+
+hipblasStatus_t hipblasDgtsvInterleavedBatched(hipblasHandle_t handle,
+                                               const int       m,
+                                               const double*   dl,
+                                               const double*   d,
+                                               const double*   du,
+                                               double*         x,
+                                               const int       batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, m, dl, d, du, x, batch_count);
+    return gtsv_batched(handle, m, dl, d, du, x, batch_count, 1, batch_count);
+}
+
+hipblasStatus_t hipblasCgtsvInterleavedBatched(hipblasHandle_t       handle,
+                                               const int             m,
+                                               const hipblasComplex* dl,
+                                               const hipblasComplex* d,
+                                               const hipblasComplex* du,
+                                               hipblasComplex*       x,
+                                               const int             batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, m, dl, d, du, x, batch_count);
+    return gtsv_batched(handle, m, dl, d, du, x, batch_count, 1, batch_count);
+}
+
+hipblasStatus_t hipblasZgtsvInterleavedBatched(hipblasHandle_t             handle,
+                                               const int                   m,
+                                               const hipblasDoubleComplex* dl,
+                                               const hipblasDoubleComplex* d,
+                                               const hipblasDoubleComplex* du,
+                                               hipblasDoubleComplex*       x,
+                                               const int                   batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, m, dl, d, du, x, batch_count);
+    return gtsv_batched(handle, m, dl, d, du, x, batch_count, 1, batch_count);
+}
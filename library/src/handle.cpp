@@ -0,0 +1,1570 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipblas_handle.h"
+#include "hipblas_host_dispatch.h"
+#include "hipblas_kernels.h"
+#include "hipblas_logging.h"
+#include <algorithm>
+#include <atomic>
+#include <hip/hip_runtime_api.h>
+
+/* ============================================================================================ */
+hipError_t hipblas_stream_create(hipStream_t* stream, const hipblas_stream_options& options)
+{
+#ifndef __HIP_PLATFORM_NVCC__
+    if(!options.cu_mask.empty())
+        return hipExtStreamCreateWithCUMask(
+            stream, uint32_t(options.cu_mask.size()), options.cu_mask.data());
+#endif
+    if(options.priority == HIPBLAS_STREAM_PRIORITY_DEFAULT)
+        return hipStreamCreateWithFlags(stream, hipStreamNonBlocking);
+
+    // Lower numbers are greater priorities
+    int        least, greatest;
+    hipError_t err = hipDeviceGetStreamPriorityRange(&least, &greatest);
+    if(err != hipSuccess)
+        return err;
+    return hipStreamCreateWithPriority(
+        stream,
+        hipStreamNonBlocking,
+        options.priority == HIPBLAS_STREAM_PRIORITY_HIGH ? greatest : least);
+}
+
+/* ============================================================================================ */
+hipblas_workspace::~hipblas_workspace()
+{
+    release();
+}
+
+void hipblas_workspace::release()
+{
+    // hipFree waits for outstanding work on the device, so in-flight kernels still reading the
+    // old storage are safe; this only happens while growing, never in the steady state
+    if(ptr && !user_owned)
+        (void)hipFree(ptr);
+    ptr        = nullptr;
+    capacity   = 0;
+    user_owned = false;
+}
+
+hipblasStatus_t hipblas_workspace::reserve(size_t bytes, bool may_grow)
+{
+    peak = std::max(peak, bytes);
+    if(bytes <= capacity)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    if(!may_grow || user_owned || (limit && bytes > limit))
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+
+    release();
+    if(hipMalloc(&ptr, bytes) != hipSuccess)
+    {
+        ptr = nullptr;
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+    }
+    capacity = bytes;
+    reallocations++;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblas_workspace::set_user(void* addr, size_t size)
+{
+    if((addr == nullptr) != (size == 0))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    release();
+    if(addr)
+    {
+        ptr        = addr;
+        capacity   = size;
+        user_owned = true;
+    }
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+/* ============================================================================================ */
+hipblas_call_timings::~hipblas_call_timings()
+{
+    for(slot& s : slots)
+    {
+        if(s.start)
+            (void)hipEventDestroy(s.start);
+        if(s.stop)
+            (void)hipEventDestroy(s.stop);
+    }
+}
+
+static bool create_timing_event(hipEvent_t& event)
+{
+    if(event || hipEventCreate(&event) == hipSuccess)
+        return true;
+    event = nullptr;
+    return false;
+}
+
+bool hipblas_call_timings::sample(int every, unsigned long long& sequence)
+{
+    sequence = calls.fetch_add(1, std::memory_order_relaxed);
+    return sequence % (unsigned long long)every == 0;
+}
+
+long long hipblas_call_timings::begin(const hipblasCallTiming_t& record, hipStream_t stream)
+{
+    unsigned long long ticket = head.load(std::memory_order_relaxed);
+    do
+    {
+        if(ticket - tail.load(std::memory_order_acquire) >= SLOTS)
+        {
+            dropped.fetch_add(1, std::memory_order_relaxed);
+            return -1;
+        }
+    } while(!head.compare_exchange_weak(ticket, ticket + 1, std::memory_order_relaxed));
+
+    // The drain empties a slot before moving tail past it, so the claimed slot is this call's alone
+    slot& s  = slots[ticket % SLOTS];
+    s.record = record;
+    if(!create_timing_event(s.start) || !create_timing_event(s.stop)
+       || hipEventRecord(s.start, stream) != hipSuccess)
+    {
+        s.state.store(FAILED, std::memory_order_release);
+        dropped.fetch_add(1, std::memory_order_relaxed);
+        return -1;
+    }
+    return (long long)ticket;
+}
+
+void hipblas_call_timings::finish(long long ticket, hipStream_t stream)
+{
+    slot& s      = slots[(unsigned long long)ticket % SLOTS];
+    bool  queued = hipEventRecord(s.stop, stream) == hipSuccess;
+    if(!queued)
+        dropped.fetch_add(1, std::memory_order_relaxed);
+    s.state.store(queued ? PUBLISHED : FAILED, std::memory_order_release);
+}
+
+int hipblas_call_timings::drain(hipblasCallTiming_t* out, int capacity)
+{
+    std::lock_guard<std::mutex> lock(drain_mutex);
+
+    int                count = 0;
+    unsigned long long t     = tail.load(std::memory_order_relaxed);
+    while(count < capacity && t != head.load(std::memory_order_acquire))
+    {
+        slot& s     = slots[t % SLOTS];
+        int   state = s.state.load(std::memory_order_acquire);
+        if(state == EMPTY)
+            break; // claimed by a call still queueing its work
+
+        if(state == PUBLISHED)
+        {
+            hipError_t done = hipEventQuery(s.stop);
+            if(done == hipErrorNotReady)
+                break;
+
+            float ms = 0;
+            if(done == hipSuccess && hipEventElapsedTime(&ms, s.start, s.stop) == hipSuccess)
+            {
+                out[count]        = s.record;
+                out[count].gpu_ms = ms;
+                count++;
+            }
+            else
+                dropped.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        s.state.store(EMPTY, std::memory_order_relaxed);
+        tail.store(++t, std::memory_order_release);
+    }
+    return count;
+}
+
+/* ============================================================================================ */
+hipblas_pointer_array_ring::~hipblas_pointer_array_ring()
+{
+    for(slot& s : slots)
+    {
+        if(s.pending)
+            (void)hipEventSynchronize(s.done);
+        if(s.done)
+            (void)hipEventDestroy(s.done);
+        if(s.host)
+            (void)hipHostFree(s.host);
+        if(s.device)
+            (void)hipFree(s.device);
+    }
+}
+
+hipblasStatus_t hipblas_pointer_array_ring::acquire(size_t bytes, slot*& out)
+{
+    slot& s = slots[next];
+    if(s.pending && hipEventSynchronize(s.done) != hipSuccess)
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+    s.pending = false;
+
+    if(!s.done && hipEventCreateWithFlags(&s.done, hipEventDisableTiming) != hipSuccess)
+    {
+        s.done = nullptr;
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+    }
+
+    if(bytes > s.capacity)
+    {
+        // Grow to a power of two so a slowly rising batch count reallocates rarely
+        size_t capacity = 4096;
+        while(capacity < bytes)
+            capacity *= 2;
+
+        if(s.host)
+            (void)hipHostFree(s.host);
+        if(s.device)
+            (void)hipFree(s.device);
+        s.host     = nullptr;
+        s.device   = nullptr;
+        s.capacity = 0;
+        if(hipHostMalloc(&s.host, capacity) != hipSuccess
+           || hipMalloc(&s.device, capacity) != hipSuccess)
+            return HIPBLAS_STATUS_ALLOC_FAILED;
+        s.capacity = capacity;
+    }
+
+    next = (next + 1) % SLOTS;
+    out  = &s;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+void hipblas_pointer_array_ring::release(slot* s, hipStream_t stream)
+{
+    // Without the event the slot cannot tell when the call is done, so wait for it here
+    s->pending = hipEventRecord(s->done, stream) == hipSuccess;
+    if(!s->pending)
+        (void)hipStreamSynchronize(stream);
+}
+
+/* ============================================================================================ */
+hipblas_async_results::~hipblas_async_results()
+{
+    clear();
+    if(done)
+        (void)hipEventDestroy(done);
+    if(host)
+        (void)hipHostFree(host);
+}
+
+hipblasStatus_t hipblas_async_results::reserve(void* dest, size_t bytes, void*& slot)
+{
+    if(!host)
+    {
+        if(hipHostMalloc(&host, SLOTS * SLOT_BYTES, hipHostMallocMapped | hipHostMallocPortable)
+           != hipSuccess)
+        {
+            host = nullptr;
+            return HIPBLAS_STATUS_ALLOC_FAILED;
+        }
+        if(hipHostGetDevicePointer(&device, host, 0) != hipSuccess
+           || hipEventCreateWithFlags(&done, hipEventDisableTiming) != hipSuccess)
+        {
+            (void)hipHostFree(host);
+            host = nullptr;
+            done = nullptr;
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+        }
+    }
+
+    if(entries.size() == SLOTS)
+    {
+        hipblasStatus_t status = deliver();
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+    }
+
+    slot = static_cast<char*>(device) + entries.size() * SLOT_BYTES;
+    entries.push_back({dest, bytes});
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblas_async_results::queued(hipStream_t stream)
+{
+    // Chain the event through the new stream so it still covers the earlier results
+    if(entries.size() > 1 && stream != last_stream
+       && hipStreamWaitEvent(stream, done, 0) != hipSuccess)
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+    last_stream = stream;
+    return hipEventRecord(done, stream) == hipSuccess ? HIPBLAS_STATUS_SUCCESS
+                                                      : HIPBLAS_STATUS_INTERNAL_ERROR;
+}
+
+void hipblas_async_results::cancel()
+{
+    entries.pop_back();
+}
+
+hipblasStatus_t hipblas_async_results::deliver()
+{
+    if(entries.empty())
+        return HIPBLAS_STATUS_SUCCESS;
+    if(hipEventSynchronize(done) != hipSuccess)
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+    for(size_t i = 0; i < entries.size(); i++)
+        memcpy(entries[i].dest, static_cast<char*>(host) + i * SLOT_BYTES, entries[i].bytes);
+    entries.clear();
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+void hipblas_async_results::clear()
+{
+    // The device may still be writing the slots
+    if(!entries.empty())
+        (void)hipEventSynchronize(done);
+    entries.clear();
+}
+
+/* ============================================================================================ */
+hipblas_tile_pipeline::~hipblas_tile_pipeline()
+{
+    release_lanes();
+}
+
+void hipblas_tile_pipeline::select(const int* first, int count)
+{
+    release_lanes();
+    devices.assign(first, first + count);
+}
+
+void hipblas_tile_pipeline::release_lanes()
+{
+    int current;
+    if(lanes.empty() || hipGetDevice(&current) != hipSuccess)
+        return;
+
+    release_tiles();
+    for(lane& l : lanes)
+    {
+        (void)hipSetDevice(l.device);
+        if(l.handle)
+            (void)hipblasDestroy(l.handle);
+        if(l.stream)
+            (void)hipStreamDestroy(l.stream);
+        for(tile* t : {&l.a[0], &l.a[1], &l.b[0], &l.b[1], &l.c})
+            if(t->done)
+                (void)hipEventDestroy(t->done);
+    }
+    lanes.clear();
+    (void)hipSetDevice(current);
+}
+
+void hipblas_tile_pipeline::release_tiles()
+{
+    for(lane& l : lanes)
+    {
+        (void)hipSetDevice(l.device);
+        if(l.stream)
+            (void)hipStreamSynchronize(l.stream);
+        for(tile* t : {&l.a[0], &l.a[1], &l.b[0], &l.b[1], &l.c})
+        {
+            if(t->host)
+                (void)hipHostFree(t->host);
+            if(t->device)
+                (void)hipFree(t->device);
+            t->host    = nullptr;
+            t->device  = nullptr;
+            t->pending = false;
+        }
+    }
+    capacity = 0;
+}
+
+void hipblas_tile_pipeline::set_stream_options(const hipblas_stream_options& options)
+{
+    if(options == stream_options)
+        return;
+    release_lanes();
+    stream_options = options;
+}
+
+static hipblasStatus_t create_lane(hipblas_tile_pipeline::lane&  l,
+                                   const hipblas_stream_options& options)
+{
+    if(hipblas_stream_create(&l.stream, options) != hipSuccess)
+    {
+        l.stream = nullptr;
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+    }
+    hipblasStatus_t status = hipblasCreate(&l.handle);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        l.handle = nullptr;
+        return status;
+    }
+    status = hipblasSetStream(l.handle, l.stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    for(hipblas_tile_pipeline::tile* t : {&l.a[0], &l.a[1], &l.b[0], &l.b[1], &l.c})
+        if(hipEventCreateWithFlags(&t->done, hipEventDisableTiming) != hipSuccess)
+        {
+            t->done = nullptr;
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+        }
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblas_tile_pipeline::reserve(int device, size_t bytes)
+{
+    if(!lanes.empty() && bytes <= capacity)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+    if(lanes.empty())
+    {
+        std::vector<int> targets = devices.empty() ? std::vector<int>{device} : devices;
+        for(int d : targets)
+        {
+            if(hipSetDevice(d) != hipSuccess)
+            {
+                status = HIPBLAS_STATUS_INVALID_VALUE;
+                break;
+            }
+            for(int i = 0; i < LANES && status == HIPBLAS_STATUS_SUCCESS; i++)
+            {
+                lanes.emplace_back();
+                lanes.back().device = d;
+                status              = create_lane(lanes.back(), stream_options);
+            }
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                break;
+        }
+    }
+
+    if(status == HIPBLAS_STATUS_SUCCESS && bytes > capacity)
+    {
+        release_tiles();
+        for(lane& l : lanes)
+        {
+            for(tile* t : {&l.a[0], &l.a[1], &l.b[0], &l.b[1], &l.c})
+                if(hipSetDevice(l.device) != hipSuccess
+                   || hipHostMalloc(&t->host, bytes) != hipSuccess
+                   || hipMalloc(&t->device, bytes) != hipSuccess)
+                    status = HIPBLAS_STATUS_ALLOC_FAILED;
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                break;
+        }
+        capacity = status == HIPBLAS_STATUS_SUCCESS ? bytes : 0;
+    }
+
+    (void)hipSetDevice(device);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        release_lanes();
+    return status;
+}
+
+/* ============================================================================================ */
+hipblas_stream_pool::~hipblas_stream_pool()
+{
+    release();
+}
+
+void hipblas_stream_pool::release()
+{
+    // Destroying a stream or event with work still queued lets that work finish first
+    for(lane& l : lanes)
+    {
+        if(l.handle)
+            (void)hipblasDestroy(l.handle);
+        if(l.stream)
+            (void)hipStreamDestroy(l.stream);
+        if(l.done)
+            (void)hipEventDestroy(l.done);
+    }
+    lanes.clear();
+    if(fork)
+        (void)hipEventDestroy(fork);
+    fork = nullptr;
+    next = 0;
+}
+
+hipblasStatus_t
+    hipblas_stream_pool::resize(int device, int count, const hipblas_stream_options& options)
+{
+    if(count == size() && options == stream_options)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    release();
+    stream_options = options;
+    if(count == 0)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    int current;
+    if(hipGetDevice(&current) != hipSuccess || hipSetDevice(device) != hipSuccess)
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+    if(hipEventCreateWithFlags(&fork, hipEventDisableTiming) != hipSuccess)
+    {
+        fork   = nullptr;
+        status = HIPBLAS_STATUS_INTERNAL_ERROR;
+    }
+    for(int i = 0; i < count && status == HIPBLAS_STATUS_SUCCESS; i++)
+    {
+        lanes.emplace_back();
+        lane& l = lanes.back();
+        if(hipblas_stream_create(&l.stream, stream_options) != hipSuccess)
+        {
+            l.stream = nullptr;
+            status   = HIPBLAS_STATUS_INTERNAL_ERROR;
+            break;
+        }
+        if(hipEventCreateWithFlags(&l.done, hipEventDisableTiming) != hipSuccess)
+        {
+            l.done = nullptr;
+            status = HIPBLAS_STATUS_INTERNAL_ERROR;
+            break;
+        }
+        status = hipblasCreate(&l.handle);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            l.handle = nullptr;
+            break;
+        }
+        status = hipblasSetStream(l.handle, l.stream);
+    }
+
+    (void)hipSetDevice(current);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        release();
+    return status;
+}
+
+hipblasStatus_t hipblas_stream_pool::acquire(hipStream_t origin, lane*& out)
+{
+    lane& l = lanes[next];
+    next    = (next + 1) % size();
+    if(hipEventRecord(fork, origin) != hipSuccess
+       || hipStreamWaitEvent(l.stream, fork, 0) != hipSuccess)
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+    l.used = true;
+    out    = &l;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblas_stream_pool::join(hipStream_t origin)
+{
+    for(lane& l : lanes)
+    {
+        if(!l.used)
+            continue;
+        if(hipEventRecord(l.done, l.stream) != hipSuccess
+           || hipStreamWaitEvent(origin, l.done, 0) != hipSuccess)
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+        l.used = false;
+    }
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+/* ============================================================================================ */
+namespace
+{
+    struct thread_copy
+    {
+        unsigned long long serial;
+        hipblasHandle_t    handle;
+    };
+
+    // The copies of per-thread handles this thread has used
+    thread_local std::vector<thread_copy> thread_copies;
+
+    unsigned long long next_serial()
+    {
+        static std::atomic<unsigned long long> serial{0};
+        return ++serial;
+    }
+}
+
+hipblas_thread_handles::hipblas_thread_handles()
+    : serial(next_serial())
+{
+}
+
+hipblas_thread_handles::~hipblas_thread_handles()
+{
+    clear();
+}
+
+void hipblas_thread_handles::snapshot(hipStream_t stream, hipblasAtomicsMode_t atomics_mode)
+{
+    this->stream       = stream;
+    this->atomics_mode = atomics_mode;
+}
+
+hipblasHandle_t hipblas_thread_handles::get(hipblas_handle* parent)
+{
+    for(const thread_copy& c : thread_copies)
+        if(c.serial == serial)
+            return c.handle;
+
+    // The copies are created through the shared API, on the copies themselves, so nothing here
+    // reaches the parent's backend handle, which other threads may be using
+    int                         current;
+    hipblasHandle_t             copy = nullptr;
+    std::lock_guard<std::mutex> lock(mutex);
+    if(hipGetDevice(&current) != hipSuccess || hipSetDevice(parent->device) != hipSuccess)
+        return nullptr;
+    hipblasStatus_t status = hipblasCreate(&copy);
+    (void)hipSetDevice(current);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return nullptr;
+
+    status = static_cast<hipblas_handle*>(copy)->inherit(*parent);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasSetStream(copy, stream);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasSetAtomicsMode(copy, atomics_mode);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        (void)hipblasDestroy(copy);
+        return nullptr;
+    }
+
+    copies.push_back(copy);
+    thread_copies.push_back({serial, copy});
+    return copy;
+}
+
+void hipblas_thread_handles::clear()
+{
+    for(hipblasHandle_t copy : copies)
+        (void)hipblasDestroy(copy);
+    copies.clear();
+    serial = next_serial();
+}
+
+/* ============================================================================================ */
+hipblas_handle::~hipblas_handle()
+{
+    if(workspace_event)
+        (void)hipEventDestroy(workspace_event);
+    if(owned_stream)
+        (void)hipStreamDestroy(owned_stream);
+}
+
+hipblasStatus_t hipblas_handle::inherit(const hipblas_handle& from)
+{
+    capture_mode         = from.capture_mode;
+    scalar_stride        = from.scalar_stride;
+    pointer_array_mode   = from.pointer_array_mode;
+    managed_memory_mode  = from.managed_memory_mode;
+    host_dispatch_mode   = from.host_dispatch_mode;
+    result_mode          = from.result_mode;
+    shape_dispatch       = from.shape_dispatch;
+    math_mode            = from.math_mode;
+    emulation_slices     = from.emulation_slices;
+    gemm_split_k         = from.gemm_split_k;
+    gemm_strassen_levels = from.gemm_strassen_levels;
+    gemm_strassen_cutoff = from.gemm_strassen_cutoff;
+    abft_mode            = from.abft_mode;
+    gemm_tiny_limit      = from.gemm_tiny_limit;
+    xt_block_dim         = from.xt_block_dim;
+    gemm_backend         = from.gemm_backend;
+    gemm_tuning          = from.gemm_tuning;
+    gemm_autotune        = from.gemm_autotune;
+    workspace.limit      = from.workspace.limit;
+    return hipblasSetPointerMode(this, from.pointer_mode);
+}
+
+hipblas_gemm_routing hipblas_handle::gemm_routing() const
+{
+    return {math_mode,
+            gemm_split_k,
+            gemm_strassen_levels,
+            abft_mode,
+            gemm_backend,
+            gemm_tuning,
+            gemm_autotune,
+            shape_dispatch,
+            host_dispatch_mode,
+            gemm_tiny_limit};
+}
+
+hipblasStatus_t hipblas_handle::set_gemm_routing(const hipblas_gemm_routing& routing)
+{
+    gemm_split_k         = routing.gemm_split_k;
+    gemm_strassen_levels = routing.gemm_strassen_levels;
+    abft_mode            = routing.abft_mode;
+    gemm_backend         = routing.gemm_backend;
+    gemm_tuning          = routing.gemm_tuning;
+    gemm_autotune        = routing.gemm_autotune;
+    shape_dispatch       = routing.shape_dispatch;
+    host_dispatch_mode   = routing.host_dispatch_mode;
+    gemm_tiny_limit      = routing.gemm_tiny_limit;
+    if(math_mode == routing.math_mode)
+        return HIPBLAS_STATUS_SUCCESS;
+    return hipblasSetMathMode(this, routing.math_mode);
+}
+
+hipblasStatus_t hipblas_handle::on_stream_change(hipStream_t old_stream, hipStream_t new_stream)
+{
+    if(old_stream == new_stream || workspace.data() == nullptr)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    if(!workspace_event
+       && hipEventCreateWithFlags(&workspace_event, hipEventDisableTiming) != hipSuccess)
+    {
+        workspace_event = nullptr;
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+    }
+
+    if(hipEventRecord(workspace_event, old_stream) != hipSuccess
+       || hipStreamWaitEvent(new_stream, workspace_event, 0) != hipSuccess)
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+/* ============================================================================================ */
+hipblasStatus_t hipblasGetWorkspaceHighWaterMark(hipblasHandle_t handle, size_t* bytes)
+{
+    HIPBLAS_LOG_CALL(handle, bytes);
+    if(handle == nullptr)
+    {
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    }
+    if(bytes == nullptr)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    *bytes = static_cast<hipblas_handle*>(handle)->workspace.high_water();
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblasGetWorkspaceUsage(hipblasHandle_t handle, hipblasWorkspaceUsage_t* usage)
+{
+    HIPBLAS_LOG_CALL(handle, usage);
+    if(handle == nullptr)
+    {
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    }
+    if(usage == nullptr)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    const hipblas_workspace& w = static_cast<hipblas_handle*>(handle)->workspace;
+    usage->size                = w.size();
+    usage->high_water_mark     = w.high_water();
+    usage->growths             = w.growths();
+    usage->limit               = w.limit;
+
+    // The cuBLAS backend does not report its memory
+    if(hipblasGetDeviceMemorySize(handle, &usage->device_memory) != HIPBLAS_STATUS_SUCCESS)
+        usage->device_memory = 0;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblasResetWorkspaceHighWaterMark(hipblasHandle_t handle)
+{
+    HIPBLAS_LOG_CALL(handle);
+    if(handle == nullptr)
+    {
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    }
+    static_cast<hipblas_handle*>(handle)->workspace.reset_high_water();
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblasSetWorkspaceLimit(hipblasHandle_t handle, size_t limit)
+{
+    HIPBLAS_LOG_CALL(handle, limit);
+    if(handle == nullptr)
+    {
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    }
+    static_cast<hipblas_handle*>(handle)->workspace.limit = limit;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblasSetPointerArrayMode(hipblasHandle_t handle, hipblasPointerArrayMode_t mode)
+{
+    HIPBLAS_LOG_CALL(handle, mode);
+    if(handle == nullptr)
+    {
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    }
+    if(mode != HIPBLAS_POINTER_ARRAY_DEVICE && mode != HIPBLAS_POINTER_ARRAY_HOST)
+    {
+        return HIPBLAS_STATUS_INVALID_ENUM;
+    }
+    static_cast<hipblas_handle*>(handle)->pointer_array_mode = mode;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblasGetPointerArrayMode(hipblasHandle_t handle, hipblasPointerArrayMode_t* mode)
+{
+    HIPBLAS_LOG_CALL(handle, mode);
+    if(handle == nullptr)
+    {
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    }
+    if(mode == nullptr)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    *mode = static_cast<hipblas_handle*>(handle)->pointer_array_mode;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblasSetManagedMemoryMode(hipblasHandle_t handle, hipblasManagedMemoryMode_t mode)
+{
+    HIPBLAS_LOG_CALL(handle, mode);
+    if(handle == nullptr)
+    {
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    }
+    if(mode != HIPBLAS_MANAGED_MEMORY_DEFAULT && mode != HIPBLAS_MANAGED_MEMORY_PREFETCH)
+    {
+        return HIPBLAS_STATUS_INVALID_ENUM;
+    }
+    static_cast<hipblas_handle*>(handle)->managed_memory_mode = mode;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblasGetManagedMemoryMode(hipblasHandle_t             handle,
+                                            hipblasManagedMemoryMode_t* mode)
+{
+    HIPBLAS_LOG_CALL(handle, mode);
+    if(handle == nullptr)
+    {
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    }
+    if(mode == nullptr)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    *mode = static_cast<hipblas_handle*>(handle)->managed_memory_mode;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblasSetHostDispatchMode(hipblasHandle_t handle, hipblasHostDispatchMode_t mode)
+{
+    HIPBLAS_LOG_CALL(handle, mode);
+    if(handle == nullptr)
+    {
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    }
+    if(mode != HIPBLAS_HOST_DISPATCH_OFF && mode != HIPBLAS_HOST_DISPATCH_ON)
+    {
+        return HIPBLAS_STATUS_INVALID_ENUM;
+    }
+    if(mode == HIPBLAS_HOST_DISPATCH_ON)
+        hipblas_host_dispatch_calibrate(handle);
+    static_cast<hipblas_handle*>(handle)->host_dispatch_mode = mode;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblasGetHostDispatchMode(hipblasHandle_t handle, hipblasHostDispatchMode_t* mode)
+{
+    HIPBLAS_LOG_CALL(handle, mode);
+    if(handle == nullptr)
+    {
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    }
+    if(mode == nullptr)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    *mode = static_cast<hipblas_handle*>(handle)->host_dispatch_mode;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblasSetIndependentStreams(hipblasHandle_t handle, int count)
+{
+    HIPBLAS_LOG_CALL(handle, count);
+    hipblas_handle* h = static_cast<hipblas_handle*>(handle);
+    if(h == nullptr)
+    {
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    }
+    if(count < 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    if(h->capture_mode == HIPBLAS_CAPTURE_MODE_SAFE && count != h->stream_pool.size())
+    {
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    }
+    return h->stream_pool.resize(h->device, count, h->stream_options);
+}
+
+hipblasStatus_t hipblasGetIndependentStreams(hipblasHandle_t handle, int* count)
+{
+    HIPBLAS_LOG_CALL(handle, count);
+    if(handle == nullptr)
+    {
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    }
+    if(count == nullptr)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    *count = static_cast<hipblas_handle*>(handle)->stream_pool.size();
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblasGetIndependentHandle(hipblasHandle_t handle, hipblasHandle_t* independent)
+{
+    HIPBLAS_LOG_CALL(handle, independent);
+    hipblas_handle* h = static_cast<hipblas_handle*>(handle);
+    if(h == nullptr)
+    {
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    }
+    if(independent == nullptr)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    if(h->stream_pool.size() == 0)
+    {
+        *independent = handle;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    hipStream_t                stream;
+    hipblas_stream_pool::lane* l;
+    hipblasStatus_t            status = hipblasGetStream(handle, &stream);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = h->stream_pool.acquire(stream, l);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = static_cast<hipblas_handle*>(l->handle)->inherit(*h);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        *independent = l->handle;
+    return status;
+}
+
+hipblasStatus_t hipblasSynchronizeHandle(hipblasHandle_t handle)
+{
+    HIPBLAS_LOG_CALL(handle);
+    hipblas_handle* h = static_cast<hipblas_handle*>(handle);
+    if(h == nullptr)
+    {
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    }
+
+    hipStream_t     stream;
+    hipblasStatus_t status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    return h->stream_pool.join(stream);
+}
+
+// Makes the handle's owned stream, and its internal streams, with options; the owned stream
+// becomes the handle's stream, or the null stream when options ask for nothing
+static hipblasStatus_t set_stream_options(hipblas_handle* h, hipblas_stream_options options)
+{
+    int current;
+    if(hipGetDevice(&current) != hipSuccess || hipSetDevice(h->device) != hipSuccess)
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+    hipStream_t stream = nullptr;
+    hipError_t  err    = hipSuccess;
+    if(options != hipblas_stream_options())
+        err = hipblas_stream_create(&stream, options);
+    (void)hipSetDevice(current);
+    if(err != hipSuccess)
+        return options.cu_mask.empty() ? HIPBLAS_STATUS_INTERNAL_ERROR
+                                       : HIPBLAS_STATUS_INVALID_VALUE;
+
+    // hipblasSetStream orders the new stream after the old one, which can then go
+    hipblasStatus_t status = hipblasSetStream(h, stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        if(stream)
+            (void)hipStreamDestroy(stream);
+        return status;
+    }
+    if(h->owned_stream)
+        (void)hipStreamDestroy(h->owned_stream);
+    h->owned_stream   = stream;
+    h->stream_options = std::move(options);
+
+    h->xt_pipeline.set_stream_options(h->stream_options);
+    return h->stream_pool.resize(h->device, h->stream_pool.size(), h->stream_options);
+}
+
+hipblasStatus_t hipblasSetStreamPriority(hipblasHandle_t handle, hipblasStreamPriority_t priority)
+{
+    HIPBLAS_LOG_CALL(handle, priority);
+    hipblas_handle* h = static_cast<hipblas_handle*>(handle);
+    if(h == nullptr)
+    {
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    }
+    if(priority != HIPBLAS_STREAM_PRIORITY_DEFAULT && priority != HIPBLAS_STREAM_PRIORITY_HIGH
+       && priority != HIPBLAS_STREAM_PRIORITY_LOW)
+    {
+        return HIPBLAS_STATUS_INVALID_ENUM;
+    }
+    if(priority == h->stream_options.priority)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+    if(h->capture_mode == HIPBLAS_CAPTURE_MODE_SAFE || !h->stream_options.cu_mask.empty())
+    {
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    }
+
+    hipblas_stream_options options;
+    options.priority = priority;
+    return set_stream_options(h, std::move(options));
+}
+
+hipblasStatus_t hipblasGetStreamPriority(hipblasHandle_t handle, hipblasStreamPriority_t* priority)
+{
+    HIPBLAS_LOG_CALL(handle, priority);
+    if(handle == nullptr)
+    {
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    }
+    if(priority == nullptr)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    *priority = static_cast<hipblas_handle*>(handle)->stream_options.priority;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblasSetCUMask(hipblasHandle_t handle, int count, const uint32_t* mask)
+{
+    HIPBLAS_LOG_CALL(handle, count, mask);
+    hipblas_handle* h = static_cast<hipblas_handle*>(handle);
+    if(h == nullptr)
+    {
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    }
+    if(count < 0 || (count > 0 && mask == nullptr)
+       || (count > 0 && std::all_of(mask, mask + count, [](uint32_t word) { return word == 0; })))
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+
+    hipblas_stream_options options;
+    try
+    {
+        options.cu_mask.assign(mask, mask + count);
+    }
+    catch(const std::bad_alloc&)
+    {
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+    }
+    if(options.cu_mask == h->stream_options.cu_mask)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+#ifdef __HIP_PLATFORM_NVCC__
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+#else
+    if(h->capture_mode == HIPBLAS_CAPTURE_MODE_SAFE
+       || h->stream_options.priority != HIPBLAS_STREAM_PRIORITY_DEFAULT)
+    {
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    }
+    return set_stream_options(h, std::move(options));
+#endif
+}
+
+hipblasStatus_t hipblasGetCUMask(hipblasHandle_t handle, int capacity, uint32_t* mask, int* count)
+{
+    HIPBLAS_LOG_CALL(handle, capacity, mask, count);
+    if(handle == nullptr)
+    {
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    }
+    if(capacity < 0 || (capacity > 0 && mask == nullptr) || count == nullptr)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    const std::vector<uint32_t>& cu_mask
+        = static_cast<hipblas_handle*>(handle)->stream_options.cu_mask;
+    std::copy_n(cu_mask.begin(), std::min(size_t(capacity), cu_mask.size()), mask);
+    *count = int(cu_mask.size());
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblasSetResultMode(hipblasHandle_t handle, hipblasResultMode_t mode)
+{
+    HIPBLAS_LOG_CALL(handle, mode);
+    if(handle == nullptr)
+    {
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    }
+    if(mode != HIPBLAS_RESULT_MODE_BLOCKING && mode != HIPBLAS_RESULT_MODE_ASYNC)
+    {
+        return HIPBLAS_STATUS_INVALID_ENUM;
+    }
+    static_cast<hipblas_handle*>(handle)->result_mode = mode;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblasGetResultMode(hipblasHandle_t handle, hipblasResultMode_t* mode)
+{
+    HIPBLAS_LOG_CALL(handle, mode);
+    if(handle == nullptr)
+    {
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    }
+    if(mode == nullptr)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    *mode = static_cast<hipblas_handle*>(handle)->result_mode;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblasSynchronizeResults(hipblasHandle_t handle)
+{
+    HIPBLAS_LOG_CALL(handle);
+    if(handle == nullptr)
+    {
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    }
+    return static_cast<hipblas_handle*>(handle)->async_results.deliver();
+}
+
+// Both act on the handle itself, never on a thread's copy
+hipblasStatus_t hipblasSetThreadMode(hipblasHandle_t handle, hipblasThreadMode_t mode)
+{
+    HIPBLAS_LOG_CALL_SHARED(handle, mode);
+    hipblas_handle* h = static_cast<hipblas_handle*>(handle);
+    if(h == nullptr)
+    {
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    }
+    if(mode != HIPBLAS_THREAD_MODE_SHARED && mode != HIPBLAS_THREAD_MODE_PER_THREAD)
+    {
+        return HIPBLAS_STATUS_INVALID_ENUM;
+    }
+    if(mode == h->thread_mode)
+    {
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    if(mode == HIPBLAS_THREAD_MODE_PER_THREAD)
+    {
+        hipStream_t          stream;
+        hipblasAtomicsMode_t atomics_mode;
+        hipblasStatus_t      status = hipblasGetStream(handle, &stream);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblasGetAtomicsMode(handle, &atomics_mode);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        h->thread_handles.snapshot(stream, atomics_mode);
+    }
+    h->thread_mode = mode;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblasGetThreadMode(hipblasHandle_t handle, hipblasThreadMode_t* mode)
+{
+    HIPBLAS_LOG_CALL_SHARED(handle, mode);
+    if(handle == nullptr)
+    {
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    }
+    if(mode == nullptr)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    *mode = static_cast<hipblas_handle*>(handle)->thread_mode;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblasSetScalarStride(hipblasHandle_t handle, int64_t stride)
+{
+    HIPBLAS_LOG_CALL(handle, stride);
+    if(handle == nullptr)
+    {
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    }
+    if(stride < 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    static_cast<hipblas_handle*>(handle)->scalar_stride = stride;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblasGetScalarStride(hipblasHandle_t handle, int64_t* stride)
+{
+    HIPBLAS_LOG_CALL(handle, stride);
+    if(handle == nullptr)
+    {
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    }
+    if(stride == nullptr)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    *stride = static_cast<hipblas_handle*>(handle)->scalar_stride;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblasSetShapeDispatchMode(hipblasHandle_t            handle,
+                                            hipblasShapeDispatchMode_t mode)
+{
+    HIPBLAS_LOG_CALL(handle, mode);
+    if(handle == nullptr)
+    {
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    }
+    if(mode != HIPBLAS_SHAPE_DISPATCH_ON && mode != HIPBLAS_SHAPE_DISPATCH_OFF)
+    {
+        return HIPBLAS_STATUS_INVALID_ENUM;
+    }
+    static_cast<hipblas_handle*>(handle)->shape_dispatch = mode;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblasGetShapeDispatchMode(hipblasHandle_t             handle,
+                                            hipblasShapeDispatchMode_t* mode)
+{
+    HIPBLAS_LOG_CALL(handle, mode);
+    if(handle == nullptr)
+    {
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    }
+    if(mode == nullptr)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    *mode = static_cast<hipblas_handle*>(handle)->shape_dispatch;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblasSetEmulationSlices(hipblasHandle_t handle, int slices)
+{
+    HIPBLAS_LOG_CALL(handle, slices);
+    if(handle == nullptr)
+    {
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    }
+    if(slices < 1 || slices > 16)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    static_cast<hipblas_handle*>(handle)->emulation_slices = slices;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblasGetEmulationSlices(hipblasHandle_t handle, int* slices)
+{
+    HIPBLAS_LOG_CALL(handle, slices);
+    if(handle == nullptr)
+    {
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    }
+    if(slices == nullptr)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    *slices = static_cast<hipblas_handle*>(handle)->emulation_slices;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblasSetGemmSplitK(hipblasHandle_t handle, int splits)
+{
+    HIPBLAS_LOG_CALL(handle, splits);
+    if(handle == nullptr)
+    {
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    }
+    if(splits < 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    static_cast<hipblas_handle*>(handle)->gemm_split_k = splits;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblasGetGemmSplitK(hipblasHandle_t handle, int* splits)
+{
+    HIPBLAS_LOG_CALL(handle, splits);
+    if(handle == nullptr)
+    {
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    }
+    if(splits == nullptr)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    *splits = static_cast<hipblas_handle*>(handle)->gemm_split_k;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblasSetGemmStrassen(hipblasHandle_t handle, int levels, int cutoff)
+{
+    HIPBLAS_LOG_CALL(handle, levels, cutoff);
+    if(handle == nullptr)
+    {
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    }
+    if(levels < 0 || levels > 2 || cutoff < 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    hipblas_handle* h       = static_cast<hipblas_handle*>(handle);
+    h->gemm_strassen_levels = levels;
+    h->gemm_strassen_cutoff = cutoff;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblasGetGemmStrassen(hipblasHandle_t handle, int* levels, int* cutoff)
+{
+    HIPBLAS_LOG_CALL(handle, levels, cutoff);
+    if(handle == nullptr)
+    {
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    }
+    if(levels == nullptr || cutoff == nullptr)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    const hipblas_handle* h = static_cast<const hipblas_handle*>(handle);
+    *levels                 = h->gemm_strassen_levels;
+    *cutoff                 = h->gemm_strassen_cutoff;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblasSetAbftMode(hipblasHandle_t handle, hipblasAbftMode_t mode)
+{
+    HIPBLAS_LOG_CALL(handle, mode);
+    if(handle == nullptr)
+    {
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    }
+    if(mode != HIPBLAS_ABFT_OFF && mode != HIPBLAS_ABFT_DETECT && mode != HIPBLAS_ABFT_CORRECT)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    static_cast<hipblas_handle*>(handle)->abft_mode = mode;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblasGetAbftMode(hipblasHandle_t handle, hipblasAbftMode_t* mode)
+{
+    HIPBLAS_LOG_CALL(handle, mode);
+    if(handle == nullptr)
+    {
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    }
+    if(mode == nullptr)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    *mode = static_cast<hipblas_handle*>(handle)->abft_mode;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblasGetAbftReport(hipblasHandle_t handle, hipblasAbftReport_t* report)
+{
+    HIPBLAS_LOG_CALL(handle, report);
+    if(handle == nullptr)
+    {
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    }
+    if(report == nullptr)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    hipblas_handle* h = static_cast<hipblas_handle*>(handle);
+    if(h->capture_mode == HIPBLAS_CAPTURE_MODE_SAFE)
+    {
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    }
+
+    // The failures are counted on the device from the first checked gemm on
+    unsigned long long failed = 0;
+    if(h->abft_failed.data())
+    {
+        hipStream_t     stream;
+        hipblasStatus_t status = hipblasGetStream(handle, &stream);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            return status;
+        }
+        if(hipMemcpyAsync(
+               &failed, h->abft_failed.data(), sizeof(failed), hipMemcpyDeviceToHost, stream)
+               != hipSuccess
+           || hipStreamSynchronize(stream) != hipSuccess)
+        {
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+        }
+    }
+    *report              = h->abft_report;
+    report->failed_tiles = failed;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblasResetAbftReport(hipblasHandle_t handle)
+{
+    HIPBLAS_LOG_CALL(handle);
+    if(handle == nullptr)
+    {
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    }
+    hipblas_handle* h = static_cast<hipblas_handle*>(handle);
+    if(h->abft_failed.data())
+    {
+        hipStream_t     stream;
+        hipblasStatus_t status = hipblasGetStream(handle, &stream);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+        {
+            return status;
+        }
+        if(hipMemsetAsync(h->abft_failed.data(), 0, sizeof(unsigned long long), stream)
+           != hipSuccess)
+        {
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+        }
+    }
+    h->abft_report = {};
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblasSetGemmTinyLimit(hipblasHandle_t handle, int limit)
+{
+    HIPBLAS_LOG_CALL(handle, limit);
+    if(handle == nullptr)
+    {
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    }
+    if(limit < 0 || limit > HIPBLAS_GEMM_TINY_MAX)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    static_cast<hipblas_handle*>(handle)->gemm_tiny_limit = limit;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblasGetGemmTinyLimit(hipblasHandle_t handle, int* limit)
+{
+    HIPBLAS_LOG_CALL(handle, limit);
+    if(handle == nullptr)
+    {
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    }
+    if(limit == nullptr)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    *limit = static_cast<hipblas_handle*>(handle)->gemm_tiny_limit;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblasSetGemmAutotune(hipblasHandle_t handle, int trials)
+{
+    HIPBLAS_LOG_CALL(handle, trials);
+    if(handle == nullptr)
+    {
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    }
+    if(trials < 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    static_cast<hipblas_handle*>(handle)->gemm_autotune = trials;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblasGetGemmAutotune(hipblasHandle_t handle, int* trials)
+{
+    HIPBLAS_LOG_CALL(handle, trials);
+    if(handle == nullptr)
+    {
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    }
+    if(trials == nullptr)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    *trials = static_cast<hipblas_handle*>(handle)->gemm_autotune;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblasXtSetBlockDim(hipblasHandle_t handle, int block_dim)
+{
+    HIPBLAS_LOG_CALL(handle, block_dim);
+    if(handle == nullptr)
+    {
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    }
+    if(block_dim <= 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    static_cast<hipblas_handle*>(handle)->xt_block_dim = block_dim;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblasXtGetBlockDim(hipblasHandle_t handle, int* block_dim)
+{
+    HIPBLAS_LOG_CALL(handle, block_dim);
+    if(handle == nullptr)
+    {
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    }
+    if(block_dim == nullptr)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    *block_dim = static_cast<hipblas_handle*>(handle)->xt_block_dim;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblasXtDeviceSelect(hipblasHandle_t handle, int n_devices, const int devices[])
+{
+    HIPBLAS_LOG_CALL(handle, n_devices, devices);
+    if(handle == nullptr)
+    {
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    }
+    int count;
+    if(hipGetDeviceCount(&count) != hipSuccess)
+    {
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+    }
+    if(n_devices < 0 || (n_devices > 0 && devices == nullptr))
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    for(int i = 0; i < n_devices; i++)
+    {
+        if(devices[i] < 0 || devices[i] >= count
+           || std::find(devices, devices + i, devices[i]) != devices + i)
+        {
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        }
+    }
+    static_cast<hipblas_handle*>(handle)->xt_pipeline.select(devices, n_devices);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+/* ============================================================================================ */
+hipblas_classic_gemm_guard::hipblas_classic_gemm_guard(hipblasHandle_t handle,
+                                                       bool            host_scalars,
+                                                       bool            device_arrays)
+    : h(static_cast<hipblas_handle*>(handle))
+    , saved(h->gemm_routing())
+    , pointer_mode(h->pointer_mode)
+    , array_mode(h->pointer_array_mode)
+{
+    result = h->set_gemm_routing(saved.classic());
+    if(result == HIPBLAS_STATUS_SUCCESS && host_scalars)
+        result = hipblasSetPointerMode(h, HIPBLAS_POINTER_MODE_HOST);
+    if(result == HIPBLAS_STATUS_SUCCESS && device_arrays)
+        h->pointer_array_mode = HIPBLAS_POINTER_ARRAY_DEVICE;
+}
+
+hipblas_classic_gemm_guard::~hipblas_classic_gemm_guard()
+{
+    h->pointer_array_mode = array_mode;
+    if(h->pointer_mode != pointer_mode)
+        (void)hipblasSetPointerMode(h, pointer_mode);
+    (void)h->set_gemm_routing(saved);
+}
@@ -0,0 +1,176 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipblas_handle.h"
+#include "hipblas_logging.h"
+#include <hip/hip_runtime_api.h>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace
+{
+    struct hipblas_handle_pool
+    {
+        std::mutex                   mutex;
+        std::vector<hipblas_handle*> idle;
+
+        // What hipblasCreate gives, captured from the first handle the pool creates
+        bool                                       have_defaults = false;
+        hipblasAtomicsMode_t                       atomics_mode  = HIPBLAS_ATOMICS_NOT_ALLOWED;
+        std::shared_ptr<const hipblas_gemm_tuning> gemm_tuning;
+    };
+
+    hipblasStatus_t reset(hipblas_handle_pool* pool, hipblas_handle* h)
+    {
+        hipblasAtomicsMode_t                       atomics_mode;
+        std::shared_ptr<const hipblas_gemm_tuning> gemm_tuning;
+        {
+            std::lock_guard<std::mutex> lock(pool->mutex);
+            atomics_mode = pool->atomics_mode;
+            gemm_tuning  = pool->gemm_tuning;
+        }
+
+        // Shared and out of capture-safe mode first, so the calls below reach the handle itself
+        // and may destroy its streams; pending results are dropped while those still exist
+        h->thread_mode = HIPBLAS_THREAD_MODE_SHARED;
+        h->thread_handles.clear();
+        h->capture_mode = HIPBLAS_CAPTURE_MODE_DEFAULT;
+        h->result_mode  = HIPBLAS_RESULT_MODE_BLOCKING;
+        h->async_results.clear();
+
+        hipblasStatus_t status = hipblasSetIndependentStreams(h, 0);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblasSetStreamPriority(h, HIPBLAS_STREAM_PRIORITY_DEFAULT);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblasSetCUMask(h, 0, nullptr);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblasSetStream(h, nullptr);
+        if(status == HIPBLAS_STATUS_SUCCESS && h->workspace.is_user())
+            status = hipblasSetWorkspace(h, nullptr, 0);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblasSetPointerMode(h, HIPBLAS_POINTER_MODE_HOST);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblasSetAtomicsMode(h, atomics_mode);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblasSetMathMode(h, HIPBLAS_DEFAULT_MATH);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblasSetGemmBackend(h, HIPBLAS_GEMM_BACKEND_DEFAULT);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblasSetStatsMode(h, HIPBLAS_STATS_MODE_OFF);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblasResetHandleStats(h);
+        h->timings.reset();
+        h->workspace.reset_high_water();
+        h->workspace.limit     = 0;
+        h->timing_mode         = HIPBLAS_TIMING_MODE_OFF;
+        h->timing_sample_every = 1;
+        h->pointer_array_mode  = HIPBLAS_POINTER_ARRAY_DEVICE;
+        h->managed_memory_mode = HIPBLAS_MANAGED_MEMORY_DEFAULT;
+        h->host_dispatch_mode  = HIPBLAS_HOST_DISPATCH_OFF;
+        h->scalar_stride       = 0;
+        h->shape_dispatch      = HIPBLAS_SHAPE_DISPATCH_ON;
+        h->gemm_tuning         = std::move(gemm_tuning);
+        h->gemm_autotune       = 0;
+        return status;
+    }
+}
+
+hipblasStatus_t hipblasHandlePoolCreate(hipblasHandlePool_t* pool)
+{
+    HIPBLAS_LOG_CALL_NO_HANDLE(pool);
+    if(pool == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    *pool = new(std::nothrow) hipblas_handle_pool;
+    return *pool ? HIPBLAS_STATUS_SUCCESS : HIPBLAS_STATUS_ALLOC_FAILED;
+}
+
+hipblasStatus_t hipblasHandlePoolDestroy(hipblasHandlePool_t pool)
+{
+    HIPBLAS_LOG_CALL_NO_HANDLE(pool);
+    hipblas_handle_pool* p = static_cast<hipblas_handle_pool*>(pool);
+    if(p == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+    for(hipblas_handle* h : p->idle)
+    {
+        hipblasStatus_t s = hipblasDestroy(h);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = s;
+    }
+    delete p;
+    return status;
+}
+
+hipblasStatus_t hipblasHandlePoolAcquire(hipblasHandlePool_t pool, hipblasHandle_t* handle)
+{
+    HIPBLAS_LOG_CALL_NO_HANDLE(pool, handle);
+    hipblas_handle_pool* p = static_cast<hipblas_handle_pool*>(pool);
+    if(p == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    int device;
+    if(hipGetDevice(&device) != hipSuccess)
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+    {
+        std::lock_guard<std::mutex> lock(p->mutex);
+        for(size_t i = p->idle.size(); i-- > 0;)
+        {
+            if(p->idle[i]->device == device)
+            {
+                *handle    = p->idle[i];
+                p->idle[i] = p->idle.back();
+                p->idle.pop_back();
+                return HIPBLAS_STATUS_SUCCESS;
+            }
+        }
+    }
+
+    // Creating a backend handle is slow, so it happens outside the lock
+    hipblasStatus_t status = hipblasCreate(handle);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    hipblas_handle*      h = static_cast<hipblas_handle*>(*handle);
+    hipblasAtomicsMode_t atomics_mode;
+    if(hipblasGetAtomicsMode(h, &atomics_mode) == HIPBLAS_STATUS_SUCCESS)
+    {
+        std::lock_guard<std::mutex> lock(p->mutex);
+        if(!p->have_defaults)
+        {
+            p->have_defaults = true;
+            p->atomics_mode  = atomics_mode;
+            p->gemm_tuning   = h->gemm_tuning;
+        }
+    }
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblasHandlePoolRelease(hipblasHandlePool_t pool, hipblasHandle_t handle)
+{
+    HIPBLAS_LOG_CALL_NO_HANDLE(pool, handle);
+    hipblas_handle_pool* p = static_cast<hipblas_handle_pool*>(pool);
+    hipblas_handle*      h = static_cast<hipblas_handle*>(handle);
+    if(p == nullptr || h == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    // A handle that cannot be returned to its initial state is not reused
+    if(reset(p, h) != HIPBLAS_STATUS_SUCCESS)
+        return hipblasDestroy(h);
+
+    std::lock_guard<std::mutex> lock(p->mutex);
+    try
+    {
+        p->idle.push_back(h);
+    }
+    catch(const std::bad_alloc&)
+    {
+        return hipblasDestroy(h);
+    }
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,573 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "hipblas_handle.h"
+#include "hipblas_host_dispatch.h"
+#include "hipblas_logging.h"
+#include <algorithm>
+#include <chrono>
+#include <hip/hip_runtime_api.h>
+#include <map>
+#include <mutex>
+#include <vector>
+
+namespace
+{
+    // Used where the calibration cannot allocate its buffers
+    constexpr double DEFAULT_ROUND_TRIP_S = 20e-6;
+    constexpr double DEFAULT_COPY_S       = 5e-6;
+    constexpr double DEFAULT_BYTES_PER_S  = 10e9;
+    constexpr double DEFAULT_MADDS_PER_S  = 1e9;
+
+    constexpr size_t CALIBRATION_BYTES = 1 << 20;
+    constexpr int    CALIBRATION_GEMM  = 32;
+    constexpr int    CALIBRATION_REPS  = 5;
+
+    struct device_costs
+    {
+        double round_trip_s; // a copy each way, a stand-in for the launch and the wait
+        double copy_s;       // each further copy
+        double bytes_per_s;
+        double madds_per_s; // real multiply-adds on the host
+    };
+
+    template <typename T>
+    T conjugate(T a)
+    {
+        return a;
+    }
+
+    template <typename R>
+    hip_complex_number<R> conjugate(hip_complex_number<R> a)
+    {
+        return {a.x, -a.y};
+    }
+
+    // Real multiply-adds per multiply-add of T
+    template <typename T>
+    constexpr double madd_cost = 1;
+    template <>
+    constexpr double madd_cost<hipblasComplex> = 4;
+    template <>
+    constexpr double madd_cost<hipblasDoubleComplex> = 4;
+
+    bool valid_operation(hipblasOperation_t op)
+    {
+        return op == HIPBLAS_OP_N || op == HIPBLAS_OP_T || op == HIPBLAS_OP_C;
+    }
+
+    // Pinned or mapped host memory, which the device can copy without bouncing
+    bool is_host(const void* p)
+    {
+        hipPointerAttribute_t attr;
+        if(hipPointerGetAttributes(&attr, p) != hipSuccess)
+        {
+            (void)hipGetLastError();
+            return false;
+        }
+        return attr.memoryType == hipMemoryTypeHost;
+    }
+
+    template <typename T>
+    T element(hipblasOperation_t op, const T* X, int ld, int i, int j)
+    {
+        if(op == HIPBLAS_OP_N)
+            return X[i + size_t(j) * ld];
+        T x = X[j + size_t(i) * ld];
+        return op == HIPBLAS_OP_C ? conjugate(x) : x;
+    }
+
+    template <typename T>
+    void host_gemm(hipblasOperation_t transa,
+                   hipblasOperation_t transb,
+                   int                m,
+                   int                n,
+                   int                k,
+                   T                  alpha,
+                   const T*           A,
+                   int                lda,
+                   const T*           B,
+                   int                ldb,
+                   T                  beta,
+                   T*                 C,
+                   int                ldc)
+    {
+        for(int j = 0; j < n; j++)
+            for(int i = 0; i < m; i++)
+            {
+                T sum = 0;
+                if(alpha != T(0))
+                    for(int l = 0; l < k; l++)
+                        sum += element(transa, A, lda, i, l) * element(transb, B, ldb, l, j);
+                T& c = C[i + size_t(j) * ldc];
+                c    = beta == T(0) ? alpha * sum : alpha * sum + beta * c;
+            }
+    }
+
+    template <typename T>
+    void host_axpy(int n, T alpha, const T* x, int incx, T* y, int incy)
+    {
+        if(alpha == T(0))
+            return;
+        for(int i = 0; i < n; i++)
+            y[size_t(i) * incy] += alpha * x[size_t(i) * incx];
+    }
+
+    double seconds_since(std::chrono::steady_clock::time_point start)
+    {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    // The fastest of the repetitions of run, which returns false on failure
+    template <typename F>
+    bool fastest(F run, double& seconds)
+    {
+        seconds = 0;
+        for(int rep = 0; rep < CALIBRATION_REPS; rep++)
+        {
+            auto start = std::chrono::steady_clock::now();
+            if(!run())
+                return false;
+            double t = seconds_since(start);
+            seconds  = rep == 0 ? t : std::min(seconds, t);
+        }
+        return true;
+    }
+
+    // Times copies and a memset, standing in for a launch, on stream, and a host gemm
+    device_costs calibrate(hipStream_t stream)
+    {
+        device_costs costs
+            = {DEFAULT_ROUND_TRIP_S, DEFAULT_COPY_S, DEFAULT_BYTES_PER_S, DEFAULT_MADDS_PER_S};
+
+        int                g = CALIBRATION_GEMM;
+        std::vector<float> a(g * g, 1), c(g * g, 0);
+        auto               gemm = [&] {
+            const float* x = a.data();
+            host_gemm(HIPBLAS_OP_N, HIPBLAS_OP_N, g, g, g, 1.f, x, g, x, g, 1.f, c.data(), g);
+            return true;
+        };
+        double t;
+        if(fastest(gemm, t) && t > 0)
+            costs.madds_per_s = double(g) * g * g / t;
+
+        void* host   = nullptr;
+        void* device = nullptr;
+        if(hipStreamSynchronize(stream) != hipSuccess
+           || hipHostMalloc(&host, CALIBRATION_BYTES) != hipSuccess
+           || hipMalloc(&device, CALIBRATION_BYTES) != hipSuccess)
+        {
+            (void)hipGetLastError();
+            (void)hipHostFree(host);
+            return costs;
+        }
+
+        auto round_trip = [&](int copies_in) {
+            for(int i = 0; i < copies_in; i++)
+                if(hipMemcpyAsync(device, host, 8, hipMemcpyHostToDevice, stream) != hipSuccess)
+                    return false;
+            return hipMemsetAsync(device, 0, 8, stream) == hipSuccess
+                   && hipMemcpyAsync(host, device, 8, hipMemcpyDeviceToHost, stream) == hipSuccess
+                   && hipStreamSynchronize(stream) == hipSuccess;
+        };
+        auto bulk = [&] {
+            return hipMemcpyAsync(device, host, CALIBRATION_BYTES, hipMemcpyHostToDevice, stream)
+                       == hipSuccess
+                   && hipStreamSynchronize(stream) == hipSuccess;
+        };
+
+        double t1, t3, tb;
+        if(fastest([&] { return round_trip(1); }, t1) && fastest([&] { return round_trip(3); }, t3)
+           && fastest(bulk, tb))
+        {
+            costs.round_trip_s = t1;
+            costs.copy_s       = std::max(0.0, (t3 - t1) / 2);
+            if(tb > 0)
+                costs.bytes_per_s = CALIBRATION_BYTES / tb;
+        }
+        else
+            (void)hipGetLastError();
+
+        (void)hipFree(device);
+        (void)hipHostFree(host);
+        return costs;
+    }
+
+    // Calibrated once per device for the process
+    device_costs costs_for(hipblasHandle_t handle)
+    {
+        static std::mutex                  mutex;
+        static std::map<int, device_costs> costs;
+
+        const hipblas_handle*       h = static_cast<const hipblas_handle*>(handle);
+        std::lock_guard<std::mutex> lock(mutex);
+        auto                        it = costs.find(h->device);
+        if(it != costs.end())
+            return it->second;
+
+        hipStream_t stream = nullptr;
+        (void)hipblasGetStream(handle, &stream);
+        device_costs c = calibrate(stream);
+        costs.emplace(h->device, c);
+        return c;
+    }
+
+    // Whether the handle takes host operands, which the caller has checked are on the host
+    bool dispatching(hipblasHandle_t handle)
+    {
+        const hipblas_handle* h = static_cast<const hipblas_handle*>(handle);
+        return h != nullptr && h->host_dispatch_mode == HIPBLAS_HOST_DISPATCH_ON
+               && h->pointer_mode == HIPBLAS_POINTER_MODE_HOST
+               && h->capture_mode != HIPBLAS_CAPTURE_MODE_SAFE;
+    }
+
+    // Whether the device, moving bytes in copies transfers, beats madds multiply-adds on the host
+    bool offload(hipblasHandle_t handle, double madds, double bytes, int copies)
+    {
+        device_costs c = costs_for(handle);
+        return c.round_trip_s + (copies - 2) * c.copy_s + bytes / c.bytes_per_s
+               < madds / c.madds_per_s;
+    }
+
+    // The handle's stream, drained so that earlier work on the operands is done
+    hipblasStatus_t drained_stream(hipblasHandle_t handle, hipStream_t& stream)
+    {
+        hipblasStatus_t status = hipblasGetStream(handle, &stream);
+        if(status == HIPBLAS_STATUS_SUCCESS && hipStreamSynchronize(stream) != hipSuccess)
+            status = HIPBLAS_STATUS_INTERNAL_ERROR;
+        return status;
+    }
+
+    hipblasStatus_t gemm(hipblasHandle_t    handle,
+                         hipblasOperation_t transa,
+                         hipblasOperation_t transb,
+                         int                m,
+                         int                n,
+                         int                k,
+                         const float*       alpha,
+                         const float*       A,
+                         int                lda,
+                         const float*       B,
+                         int                ldb,
+                         const float*       beta,
+                         float*             C,
+                         int                ldc)
+    {
+        return hipblasSgemm(handle, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+    }
+
+    hipblasStatus_t gemm(hipblasHandle_t    handle,
+                         hipblasOperation_t transa,
+                         hipblasOperation_t transb,
+                         int                m,
+                         int                n,
+                         int                k,
+                         const double*      alpha,
+                         const double*      A,
+                         int                lda,
+                         const double*      B,
+                         int                ldb,
+                         const double*      beta,
+                         double*            C,
+                         int                ldc)
+    {
+        return hipblasDgemm(handle, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+    }
+
+    hipblasStatus_t gemm(hipblasHandle_t       handle,
+                         hipblasOperation_t    transa,
+                         hipblasOperation_t    transb,
+                         int                   m,
+                         int                   n,
+                         int                   k,
+                         const hipblasComplex* alpha,
+                         const hipblasComplex* A,
+                         int                   lda,
+                         const hipblasComplex* B,
+                         int                   ldb,
+                         const hipblasComplex* beta,
+                         hipblasComplex*       C,
+                         int                   ldc)
+    {
+        return hipblasCgemm(handle, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+    }
+
+    hipblasStatus_t gemm(hipblasHandle_t             handle,
+                         hipblasOperation_t          transa,
+                         hipblasOperation_t          transb,
+                         int                         m,
+                         int                         n,
+                         int                         k,
+                         const hipblasDoubleComplex* alpha,
+                         const hipblasDoubleComplex* A,
+                         int                         lda,
+                         const hipblasDoubleComplex* B,
+                         int                         ldb,
+                         const hipblasDoubleComplex* beta,
+                         hipblasDoubleComplex*       C,
+                         int                         ldc)
+    {
+        return hipblasZgemm(handle, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+    }
+
+    hipblasStatus_t axpy(hipblasHandle_t handle,
+                         int             n,
+                         const float*    alpha,
+                         const float*    x,
+                         int             incx,
+                         float*          y,
+                         int             incy)
+    {
+        return hipblasSaxpy(handle, n, alpha, x, incx, y, incy);
+    }
+
+    hipblasStatus_t axpy(hipblasHandle_t handle,
+                         int             n,
+                         const double*   alpha,
+                         const double*   x,
+                         int             incx,
+                         double*         y,
+                         int             incy)
+    {
+        return hipblasDaxpy(handle, n, alpha, x, incx, y, incy);
+    }
+
+    hipblasStatus_t axpy(hipblasHandle_t       handle,
+                         int                   n,
+                         const hipblasComplex* alpha,
+                         const hipblasComplex* x,
+                         int                   incx,
+                         hipblasComplex*       y,
+                         int                   incy)
+    {
+        return hipblasCaxpy(handle, n, alpha, x, incx, y, incy);
+    }
+
+    hipblasStatus_t axpy(hipblasHandle_t             handle,
+                         int                         n,
+                         const hipblasDoubleComplex* alpha,
+                         const hipblasDoubleComplex* x,
+                         int                         incx,
+                         hipblasDoubleComplex*       y,
+                         int                         incy)
+    {
+        return hipblasZaxpy(handle, n, alpha, x, incx, y, incy);
+    }
+
+    // Runs call on the staged operands on the classic gemm path, so the routes that use the
+    // workspace themselves cannot overwrite the staged copies
+    template <typename F>
+    hipblasStatus_t staged_call(hipblas_handle* h, F call)
+    {
+        hipblas_classic_gemm_guard classic(h);
+        hipblasStatus_t            status = classic.status();
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = call();
+        return status;
+    }
+
+    hipblasStatus_t copy_status(hipError_t err)
+    {
+        return err == hipSuccess ? HIPBLAS_STATUS_SUCCESS : HIPBLAS_STATUS_INTERNAL_ERROR;
+    }
+}
+
+template <typename T>
+bool hipblas_host_gemm(const char*        caller,
+                       hipblasHandle_t    handle,
+                       hipblasOperation_t transa,
+                       hipblasOperation_t transb,
+                       int                m,
+                       int                n,
+                       int                k,
+                       const T*           alpha,
+                       const T*           A,
+                       int                lda,
+                       const T*           B,
+                       int                ldb,
+                       const T*           beta,
+                       T*                 C,
+                       int                ldc,
+                       hipblasStatus_t&   status)
+{
+    if(!dispatching(handle))
+        return false;
+
+    // Argument errors and empty products are left to the backend
+    int a_rows = transa == HIPBLAS_OP_N ? m : k;
+    int a_cols = transa == HIPBLAS_OP_N ? k : m;
+    int b_rows = transb == HIPBLAS_OP_N ? k : n;
+    int b_cols = transb == HIPBLAS_OP_N ? n : k;
+    if(!valid_operation(transa) || !valid_operation(transb) || m <= 0 || n <= 0 || k < 0
+       || lda < std::max(1, a_rows) || ldb < std::max(1, b_rows) || ldc < m || !alpha || !beta
+       || !A || !B || !C)
+        return false;
+    if(!is_host(A) || !is_host(B) || !is_host(C))
+        return false;
+
+    // With nothing to multiply only C is read, which the host does at once
+    size_t size_a = size_t(a_rows) * a_cols;
+    size_t size_b = size_t(b_rows) * b_cols;
+    size_t size_c = size_t(m) * n;
+    double madds  = madd_cost<T> * (double(size_c) * k + size_c);
+    double bytes  = double(sizeof(T)) * (size_a + size_b + 2 * size_c);
+    bool   device = k > 0 && *alpha != T(0) && offload(handle, madds, bytes, 4);
+
+    hipStream_t stream;
+    status = drained_stream(handle, stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return true;
+
+    if(!device)
+    {
+        hipblas_log_route(caller, "hipblas_host_gemm");
+        host_gemm(transa, transb, m, n, k, *alpha, A, lda, B, ldb, *beta, C, ldc);
+        return true;
+    }
+
+    hipblas_log_route(caller, "hipblas_host_gemm_staged");
+    hipblas_handle* h = static_cast<hipblas_handle*>(handle);
+    T *             dA, *dB, *dC;
+    status = hipblas_workspace_carve(handle, dA, size_a, dB, size_b, dC, size_c);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return true;
+
+    status = copy_status(hipMemcpy2DAsync(dA,
+                                          sizeof(T) * a_rows,
+                                          A,
+                                          sizeof(T) * lda,
+                                          sizeof(T) * a_rows,
+                                          a_cols,
+                                          hipMemcpyHostToDevice,
+                                          stream));
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = copy_status(hipMemcpy2DAsync(dB,
+                                              sizeof(T) * b_rows,
+                                              B,
+                                              sizeof(T) * ldb,
+                                              sizeof(T) * b_rows,
+                                              b_cols,
+                                              hipMemcpyHostToDevice,
+                                              stream));
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = copy_status(hipMemcpy2DAsync(dC,
+                                              sizeof(T) * m,
+                                              C,
+                                              sizeof(T) * ldc,
+                                              sizeof(T) * m,
+                                              n,
+                                              hipMemcpyHostToDevice,
+                                              stream));
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = staged_call(h, [&] {
+            return gemm(
+                handle, transa, transb, m, n, k, alpha, dA, a_rows, dB, b_rows, beta, dC, m);
+        });
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = copy_status(hipMemcpy2DAsync(C,
+                                              sizeof(T) * ldc,
+                                              dC,
+                                              sizeof(T) * m,
+                                              sizeof(T) * m,
+                                              n,
+                                              hipMemcpyDeviceToHost,
+                                              stream));
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = copy_status(hipStreamSynchronize(stream));
+    return true;
+}
+
+template <typename T>
+bool hipblas_host_axpy(const char*      caller,
+                       hipblasHandle_t  handle,
+                       int              n,
+                       const T*         alpha,
+                       const T*         x,
+                       int              incx,
+                       T*               y,
+                       int              incy,
+                       hipblasStatus_t& status)
+{
+    if(!dispatching(handle))
+        return false;
+
+    // Quick returns and reversed or repeated strides are left to the backend
+    if(n <= 0 || incx <= 0 || incy <= 0 || !alpha || !x || !y)
+        return false;
+    if(!is_host(x) || !is_host(y))
+        return false;
+
+    double madds  = madd_cost<T> * n;
+    double bytes  = 3.0 * sizeof(T) * n;
+    bool   device = *alpha != T(0) && offload(handle, madds, bytes, 3);
+
+    hipStream_t stream;
+    status = drained_stream(handle, stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return true;
+
+    if(!device)
+    {
+        hipblas_log_route(caller, "hipblas_host_axpy");
+        host_axpy(n, *alpha, x, incx, y, incy);
+        return true;
+    }
+
+    hipblas_log_route(caller, "hipblas_host_axpy_staged");
+    hipblas_handle* h = static_cast<hipblas_handle*>(handle);
+    T *             dx, *dy;
+    status = hipblas_workspace_carve(handle, dx, size_t(n), dy, size_t(n));
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return true;
+
+    status = copy_status(hipMemcpy2DAsync(dx,
+                                          sizeof(T),
+                                          x,
+                                          sizeof(T) * incx,
+                                          sizeof(T),
+                                          n,
+                                          hipMemcpyHostToDevice,
+                                          stream));
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = copy_status(hipMemcpy2DAsync(dy,
+                                              sizeof(T),
+                                              y,
+                                              sizeof(T) * incy,
+                                              sizeof(T),
+                                              n,
+                                              hipMemcpyHostToDevice,
+                                              stream));
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = staged_call(h, [&] { return axpy(handle, n, alpha, dx, 1, dy, 1); });
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = copy_status(hipMemcpy2DAsync(y,
+                                              sizeof(T) * incy,
+                                              dy,
+                                              sizeof(T),
+                                              sizeof(T),
+                                              n,
+                                              hipMemcpyDeviceToHost,
+                                              stream));
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = copy_status(hipStreamSynchronize(stream));
+    return true;
+}
+
+void hipblas_host_dispatch_calibrate(hipblasHandle_t handle)
+{
+    (void)costs_for(handle);
+}
+
+// clang-format off
+template bool hipblas_host_gemm<float>(const char*, hipblasHandle_t, hipblasOperation_t, hipblasOperation_t, int, int, int, const float*, const float*, int, const float*, int, const float*, float*, int, hipblasStatus_t&);
+template bool hipblas_host_gemm<double>(const char*, hipblasHandle_t, hipblasOperation_t, hipblasOperation_t, int, int, int, const double*, const double*, int, const double*, int, const double*, double*, int, hipblasStatus_t&);
+template bool hipblas_host_gemm<hipblasComplex>(const char*, hipblasHandle_t, hipblasOperation_t, hipblasOperation_t, int, int, int, const hipblasComplex*, const hipblasComplex*, int, const hipblasComplex*, int, const hipblasComplex*, hipblasComplex*, int, hipblasStatus_t&);
+template bool hipblas_host_gemm<hipblasDoubleComplex>(const char*, hipblasHandle_t, hipblasOperation_t, hipblasOperation_t, int, int, int, const hipblasDoubleComplex*, const hipblasDoubleComplex*, int, const hipblasDoubleComplex*, int, const hipblasDoubleComplex*, hipblasDoubleComplex*, int, hipblasStatus_t&);
+
+template bool hipblas_host_axpy<float>(const char*, hipblasHandle_t, int, const float*, const float*, int, float*, int, hipblasStatus_t&);
+template bool hipblas_host_axpy<double>(const char*, hipblasHandle_t, int, const double*, const double*, int, double*, int, hipblasStatus_t&);
+template bool hipblas_host_axpy<hipblasComplex>(const char*, hipblasHandle_t, int, const hipblasComplex*, const hipblasComplex*, int, hipblasComplex*, int, hipblasStatus_t&);
+template bool hipblas_host_axpy<hipblasDoubleComplex>(const char*, hipblasHandle_t, int, const hipblasDoubleComplex*, const hipblasDoubleComplex*, int, hipblasDoubleComplex*, int, hipblasStatus_t&);
+// clang-format on
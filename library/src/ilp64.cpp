@@ -0,0 +1,724 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "hipblas_handle.h"
+#include "hipblas_kernels.h"
+#include "hipblas_logging.h"
+#include <algorithm>
+#include <cmath>
+#include <hip/hip_runtime_api.h>
+#include <limits>
+
+namespace
+{
+    // Neither backend takes 64-bit sizes, so the _64 routines split a vector into chunks of at most
+    // 2^30 elements, fewer for larger increments so that (count - 1) * |inc| stays below 2^30 for
+    // backends that index with int
+    constexpr int64_t CHUNK = int64_t(1) << 30;
+
+    bool fits_int(int64_t v)
+    {
+        return v >= std::numeric_limits<int>::min() && v <= std::numeric_limits<int>::max();
+    }
+
+    // Whether a call goes straight to the 32-bit routine; n <= 0 is a quick return there
+    bool direct(int64_t n, int64_t incx, int64_t incy = 0)
+    {
+        return n <= std::numeric_limits<int>::max() && fits_int(incx) && fits_int(incy);
+    }
+
+    int direct_n(int64_t n)
+    {
+        return int(std::max<int64_t>(n, 0));
+    }
+
+    // An increment beyond int only reaches single-element chunks, where just its sign matters
+    int chunk_inc(int64_t inc)
+    {
+        return fits_int(inc) ? int(inc) : inc < 0 ? -1 : 1;
+    }
+
+    // Calls f(start, count, incx, incy) for each chunk in order, stopping at the first failure
+    template <typename F>
+    hipblasStatus_t for_each_chunk(int64_t n, int64_t incx, int64_t incy, F f)
+    {
+        int64_t inc   = std::max({int64_t(1), std::abs(incx), std::abs(incy)});
+        int64_t chunk = std::max(int64_t(1), CHUNK / inc);
+        for(int64_t start = 0; start < n; start += chunk)
+        {
+            int             count  = int(std::min(chunk, n - start));
+            hipblasStatus_t status = f(start, count, chunk_inc(incx), chunk_inc(incy));
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+        }
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Offset of the chunk [start, start + count) of an n-element vector. With a negative increment
+    // BLAS walks the vector from its end, so later chunks lie nearer the base pointer
+    int64_t chunk_offset(int64_t n, int64_t inc, int64_t start, int64_t count)
+    {
+        return inc >= 0 ? start * inc : (n - start - count) * -inc;
+    }
+
+    // Holds a handle in HIPBLAS_RESULT_MODE_BLOCKING, for calls whose results are read on return
+    class blocking_results
+    {
+    public:
+        explicit blocking_results(hipblasHandle_t handle)
+            : handle(handle)
+        {
+            if(hipblasGetResultMode(handle, &mode) == HIPBLAS_STATUS_SUCCESS
+               && mode != HIPBLAS_RESULT_MODE_BLOCKING)
+                (void)hipblasSetResultMode(handle, HIPBLAS_RESULT_MODE_BLOCKING);
+        }
+
+        ~blocking_results()
+        {
+            if(mode != HIPBLAS_RESULT_MODE_BLOCKING)
+                (void)hipblasSetResultMode(handle, mode);
+        }
+
+    private:
+        hipblasHandle_t     handle;
+        hipblasResultMode_t mode = HIPBLAS_RESULT_MODE_BLOCKING;
+    };
+
+    // Runs the chunks of a reduction with a host result, then stores it where the caller's pointer
+    // mode says. In device pointer mode the handle is switched to host mode for the chunks, which
+    // synchronizes each of them; at these sizes the transfer dominates that cost
+    template <typename R, typename F>
+    hipblasStatus_t host_reduction(hipblasHandle_t handle, R* result, F reduce)
+    {
+        blocking_results     blocking(handle);
+        hipblasPointerMode_t mode;
+        hipblasStatus_t      status = hipblasGetPointerMode(handle, &mode);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        if(result == nullptr)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(mode == HIPBLAS_POINTER_MODE_HOST)
+            return reduce(*result);
+
+        hipStream_t stream;
+        status = hipblasGetStream(handle, &stream);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        R value;
+        status                = reduce(value);
+        hipblasStatus_t reset = hipblasSetPointerMode(handle, mode);
+        status                = status != HIPBLAS_STATUS_SUCCESS ? status : reset;
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        if(hipMemcpyAsync(result, &value, sizeof(R), hipMemcpyHostToDevice, stream) != hipSuccess
+           || hipStreamSynchronize(stream) != hipSuccess)
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    template <typename F, typename Ta, typename T>
+    hipblasStatus_t axpy_64(F               axpy,
+                            hipblasHandle_t handle,
+                            int64_t         n,
+                            const Ta*       alpha,
+                            const T*        x,
+                            int64_t         incx,
+                            T*              y,
+                            int64_t         incy)
+    {
+        if(direct(n, incx, incy))
+            return axpy(handle, direct_n(n), alpha, x, int(incx), y, int(incy));
+        return for_each_chunk(n, incx, incy, [&](int64_t start, int count, int cx, int cy) {
+            return axpy(handle,
+                        count,
+                        alpha,
+                        x + chunk_offset(n, incx, start, count),
+                        cx,
+                        y + chunk_offset(n, incy, start, count),
+                        cy);
+        });
+    }
+
+    template <typename F, typename Tx, typename T>
+    hipblasStatus_t copy_64(
+        F copy, hipblasHandle_t handle, int64_t n, Tx* x, int64_t incx, T* y, int64_t incy)
+    {
+        if(direct(n, incx, incy))
+            return copy(handle, direct_n(n), x, int(incx), y, int(incy));
+        return for_each_chunk(n, incx, incy, [&](int64_t start, int count, int cx, int cy) {
+            return copy(handle,
+                        count,
+                        x + chunk_offset(n, incx, start, count),
+                        cx,
+                        y + chunk_offset(n, incy, start, count),
+                        cy);
+        });
+    }
+
+    // swap has the shape of copy with both vectors written
+    template <typename F, typename T>
+    hipblasStatus_t
+        swap_64(F swap, hipblasHandle_t handle, int64_t n, T* x, int64_t incx, T* y, int64_t incy)
+    {
+        return copy_64(swap, handle, n, x, incx, y, incy);
+    }
+
+    template <typename F, typename Ta, typename T>
+    hipblasStatus_t
+        scal_64(F scal, hipblasHandle_t handle, int64_t n, const Ta* alpha, T* x, int64_t incx)
+    {
+        if(direct(n, incx))
+            return scal(handle, direct_n(n), alpha, x, int(incx));
+        return for_each_chunk(n, incx, 0, [&](int64_t start, int count, int cx, int) {
+            return scal(handle, count, alpha, x + chunk_offset(n, incx, start, count), cx);
+        });
+    }
+
+    template <typename F, typename T>
+    hipblasStatus_t dot_64(F               dot,
+                           hipblasHandle_t handle,
+                           int64_t         n,
+                           const T*        x,
+                           int64_t         incx,
+                           const T*        y,
+                           int64_t         incy,
+                           T*              result)
+    {
+        if(direct(n, incx, incy))
+            return dot(handle, direct_n(n), x, int(incx), y, int(incy), result);
+        return host_reduction(handle, result, [&](T& sum) {
+            sum = T(0);
+            return for_each_chunk(n, incx, incy, [&](int64_t start, int count, int cx, int cy) {
+                T               part;
+                hipblasStatus_t status = dot(handle,
+                                             count,
+                                             x + chunk_offset(n, incx, start, count),
+                                             cx,
+                                             y + chunk_offset(n, incy, start, count),
+                                             cy,
+                                             &part);
+                sum += part;
+                return status;
+            });
+        });
+    }
+
+    template <typename F, typename T, typename R>
+    hipblasStatus_t
+        asum_64(F asum, hipblasHandle_t handle, int64_t n, const T* x, int64_t incx, R* result)
+    {
+        if(direct(n, incx))
+            return asum(handle, direct_n(n), x, int(incx), result);
+        return host_reduction(handle, result, [&](R& sum) {
+            sum = 0;
+            return for_each_chunk(n, incx, 0, [&](int64_t start, int count, int cx, int) {
+                R               part;
+                hipblasStatus_t status
+                    = asum(handle, count, x + chunk_offset(n, incx, start, count), cx, &part);
+                sum += part;
+                return status;
+            });
+        });
+    }
+
+    // The chunk norms combine as the norm of their vector, by hypot to avoid overflow
+    template <typename F, typename T, typename R>
+    hipblasStatus_t
+        nrm2_64(F nrm2, hipblasHandle_t handle, int64_t n, const T* x, int64_t incx, R* result)
+    {
+        if(direct(n, incx))
+            return nrm2(handle, direct_n(n), x, int(incx), result);
+        return host_reduction(handle, result, [&](R& norm) {
+            norm = 0;
+            return for_each_chunk(n, incx, 0, [&](int64_t start, int count, int cx, int) {
+                R               part;
+                hipblasStatus_t status
+                    = nrm2(handle, count, x + chunk_offset(n, incx, start, count), cx, &part);
+                norm = std::hypot(norm, part);
+                return status;
+            });
+        });
+    }
+
+    template <typename T>
+    double magnitude(T a)
+    {
+        return std::abs(a);
+    }
+
+    // |re| + |im|, the magnitude amax and amin compare for complex vectors
+    template <typename R>
+    double magnitude(hip_complex_number<R> a)
+    {
+        return std::abs(a.x) + std::abs(a.y);
+    }
+
+    // In device pointer mode the index never comes to the host, so the call stays asynchronous.
+    // A single chunk's int index fills the low half of the little-endian int64_t result, whose
+    // high half is cleared; the indexes of several chunks go to the workspace and one kernel
+    // picks the best of them
+    template <bool min, typename F, typename T>
+    hipblasStatus_t extreme_index_device(F               iamax,
+                                         hipblasHandle_t handle,
+                                         hipStream_t     stream,
+                                         int64_t         n,
+                                         const T*        x,
+                                         int64_t         incx,
+                                         int64_t*        result)
+    {
+        if(direct(n, incx))
+        {
+            if(hipMemsetAsync(reinterpret_cast<int*>(result) + 1, 0, sizeof(int), stream)
+               != hipSuccess)
+                return HIPBLAS_STATUS_INTERNAL_ERROR;
+            return iamax(handle, direct_n(n), x, int(incx), reinterpret_cast<int*>(result));
+        }
+        if(incx <= 0)
+            return hipMemsetAsync(result, 0, sizeof(int64_t), stream) == hipSuccess
+                       ? HIPBLAS_STATUS_SUCCESS
+                       : HIPBLAS_STATUS_INTERNAL_ERROR;
+
+        // the chunks of for_each_chunk
+        int64_t         chunk  = std::max(int64_t(1), CHUNK / incx);
+        int64_t         chunks = (n + chunk - 1) / chunk;
+        int*            part;
+        hipblasStatus_t status = hipblas_workspace_carve(handle, part, size_t(chunks));
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        int c  = 0;
+        status = for_each_chunk(n, incx, 0, [&](int64_t start, int count, int cx, int) {
+            return iamax(handle, count, x + start * incx, cx, part + c++);
+        });
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        return hipblas_iamax_chunks(stream, min, x, incx, chunk, int(chunks), part, result)
+                       == hipSuccess
+                   ? HIPBLAS_STATUS_SUCCESS
+                   : HIPBLAS_STATUS_INTERNAL_ERROR;
+    }
+
+    // In host pointer mode each chunk's 1-based index is checked against the best so far by
+    // reading its element, so ties keep the earliest chunk, as BLAS keeps the first index
+    template <bool min, typename F, typename T>
+    hipblasStatus_t extreme_index_64(
+        F iamax, hipblasHandle_t handle, int64_t n, const T* x, int64_t incx, int64_t* result)
+    {
+        hipblasPointerMode_t mode;
+        hipStream_t          stream;
+        hipblasStatus_t      status = hipblasGetPointerMode(handle, &mode);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblasGetStream(handle, &stream);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        if(result == nullptr)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(mode == HIPBLAS_POINTER_MODE_DEVICE)
+            return extreme_index_device<min>(iamax, handle, stream, n, x, incx, result);
+
+        blocking_results blocking(handle);
+        if(direct(n, incx))
+        {
+            int r;
+            status  = iamax(handle, direct_n(n), x, int(incx), &r);
+            *result = r;
+            return status;
+        }
+
+        *result = 0;
+        if(incx <= 0)
+            return HIPBLAS_STATUS_SUCCESS;
+
+        double best = 0;
+        return for_each_chunk(n, incx, 0, [&](int64_t start, int count, int cx, int) {
+            int             r;
+            const T*        chunk  = x + start * incx;
+            hipblasStatus_t status = iamax(handle, count, chunk, cx, &r);
+            if(status != HIPBLAS_STATUS_SUCCESS || r <= 0)
+                return status;
+
+            T        v;
+            const T* at = chunk + (r - 1) * incx;
+            if(hipMemcpyAsync(&v, at, sizeof(T), hipMemcpyDeviceToHost, stream) != hipSuccess
+               || hipStreamSynchronize(stream) != hipSuccess)
+                return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+            double m = magnitude(v);
+            if(*result == 0 || (min ? m < best : m > best))
+            {
+                best    = m;
+                *result = start + r;
+            }
+            return HIPBLAS_STATUS_SUCCESS;
+        });
+    }
+
+    template <typename F, typename T>
+    hipblasStatus_t iamax_64(
+        F iamax, hipblasHandle_t handle, int64_t n, const T* x, int64_t incx, int64_t* result)
+    {
+        return extreme_index_64<false>(iamax, handle, n, x, incx, result);
+    }
+
+    template <typename F, typename T>
+    hipblasStatus_t iamin_64(
+        F iamin, hipblasHandle_t handle, int64_t n, const T* x, int64_t incx, int64_t* result)
+    {
+        return extreme_index_64<true>(iamin, handle, n, x, incx, result);
+    }
+}
+
+hipblasStatus_t hipblasIsamax_64(
+    hipblasHandle_t handle, int64_t n, const float* x, int64_t incx, int64_t* result)
+{
+    HIPBLAS_LOG_CALL(handle, n, x, incx, result);
+    return iamax_64(hipblasIsamax, handle, n, x, incx, result);
+}
+
+hipblasStatus_t hipblasIdamax_64(
+    hipblasHandle_t handle, int64_t n, const double* x, int64_t incx, int64_t* result)
+{
+    HIPBLAS_LOG_CALL(handle, n, x, incx, result);
+    return iamax_64(hipblasIdamax, handle, n, x, incx, result);
+}
+
+hipblasStatus_t hipblasIcamax_64(
+    hipblasHandle_t handle, int64_t n, const hipblasComplex* x, int64_t incx, int64_t* result)
+{
+    HIPBLAS_LOG_CALL(handle, n, x, incx, result);
+    return iamax_64(hipblasIcamax, handle, n, x, incx, result);
+}
+
+hipblasStatus_t hipblasIzamax_64(
+    hipblasHandle_t handle, int64_t n, const hipblasDoubleComplex* x, int64_t incx, int64_t* result)
+{
+    HIPBLAS_LOG_CALL(handle, n, x, incx, result);
+    return iamax_64(hipblasIzamax, handle, n, x, incx, result);
+}
+
+hipblasStatus_t hipblasIsamin_64(
+    hipblasHandle_t handle, int64_t n, const float* x, int64_t incx, int64_t* result)
+{
+    HIPBLAS_LOG_CALL(handle, n, x, incx, result);
+    return iamin_64(hipblasIsamin, handle, n, x, incx, result);
+}
+
+hipblasStatus_t hipblasIdamin_64(
+    hipblasHandle_t handle, int64_t n, const double* x, int64_t incx, int64_t* result)
+{
+    HIPBLAS_LOG_CALL(handle, n, x, incx, result);
+    return iamin_64(hipblasIdamin, handle, n, x, incx, result);
+}
+
+hipblasStatus_t hipblasIcamin_64(
+    hipblasHandle_t handle, int64_t n, const hipblasComplex* x, int64_t incx, int64_t* result)
+{
+    HIPBLAS_LOG_CALL(handle, n, x, incx, result);
+    return iamin_64(hipblasIcamin, handle, n, x, incx, result);
+}
+
+hipblasStatus_t hipblasIzamin_64(
+    hipblasHandle_t handle, int64_t n, const hipblasDoubleComplex* x, int64_t incx, int64_t* result)
+{
+    HIPBLAS_LOG_CALL(handle, n, x, incx, result);
+    return iamin_64(hipblasIzamin, handle, n, x, incx, result);
+}
+
+hipblasStatus_t
+    hipblasSasum_64(hipblasHandle_t handle, int64_t n, const float* x, int64_t incx, float* result)
+{
+    HIPBLAS_LOG_CALL(handle, n, x, incx, result);
+    return asum_64(hipblasSasum, handle, n, x, incx, result);
+}
+
+hipblasStatus_t hipblasDasum_64(
+    hipblasHandle_t handle, int64_t n, const double* x, int64_t incx, double* result)
+{
+    HIPBLAS_LOG_CALL(handle, n, x, incx, result);
+    return asum_64(hipblasDasum, handle, n, x, incx, result);
+}
+
+hipblasStatus_t hipblasScasum_64(
+    hipblasHandle_t handle, int64_t n, const hipblasComplex* x, int64_t incx, float* result)
+{
+    HIPBLAS_LOG_CALL(handle, n, x, incx, result);
+    return asum_64(hipblasScasum, handle, n, x, incx, result);
+}
+
+hipblasStatus_t hipblasDzasum_64(
+    hipblasHandle_t handle, int64_t n, const hipblasDoubleComplex* x, int64_t incx, double* result)
+{
+    HIPBLAS_LOG_CALL(handle, n, x, incx, result);
+    return asum_64(hipblasDzasum, handle, n, x, incx, result);
+}
+
+hipblasStatus_t hipblasSaxpy_64(hipblasHandle_t handle,
+                                int64_t         n,
+                                const float*    alpha,
+                                const float*    x,
+                                int64_t         incx,
+                                float*          y,
+                                int64_t         incy)
+{
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, y, incy);
+    return axpy_64(hipblasSaxpy, handle, n, alpha, x, incx, y, incy);
+}
+
+hipblasStatus_t hipblasDaxpy_64(hipblasHandle_t handle,
+                                int64_t         n,
+                                const double*   alpha,
+                                const double*   x,
+                                int64_t         incx,
+                                double*         y,
+                                int64_t         incy)
+{
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, y, incy);
+    return axpy_64(hipblasDaxpy, handle, n, alpha, x, incx, y, incy);
+}
+
+hipblasStatus_t hipblasCaxpy_64(hipblasHandle_t       handle,
+                                int64_t               n,
+                                const hipblasComplex* alpha,
+                                const hipblasComplex* x,
+                                int64_t               incx,
+                                hipblasComplex*       y,
+                                int64_t               incy)
+{
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, y, incy);
+    return axpy_64(hipblasCaxpy, handle, n, alpha, x, incx, y, incy);
+}
+
+hipblasStatus_t hipblasZaxpy_64(hipblasHandle_t             handle,
+                                int64_t                     n,
+                                const hipblasDoubleComplex* alpha,
+                                const hipblasDoubleComplex* x,
+                                int64_t                     incx,
+                                hipblasDoubleComplex*       y,
+                                int64_t                     incy)
+{
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, y, incy);
+    return axpy_64(hipblasZaxpy, handle, n, alpha, x, incx, y, incy);
+}
+
+hipblasStatus_t hipblasScopy_64(
+    hipblasHandle_t handle, int64_t n, const float* x, int64_t incx, float* y, int64_t incy)
+{
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy);
+    return copy_64(hipblasScopy, handle, n, x, incx, y, incy);
+}
+
+hipblasStatus_t hipblasDcopy_64(
+    hipblasHandle_t handle, int64_t n, const double* x, int64_t incx, double* y, int64_t incy)
+{
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy);
+    return copy_64(hipblasDcopy, handle, n, x, incx, y, incy);
+}
+
+hipblasStatus_t hipblasCcopy_64(hipblasHandle_t       handle,
+                                int64_t               n,
+                                const hipblasComplex* x,
+                                int64_t               incx,
+                                hipblasComplex*       y,
+                                int64_t               incy)
+{
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy);
+    return copy_64(hipblasCcopy, handle, n, x, incx, y, incy);
+}
+
+hipblasStatus_t hipblasZcopy_64(hipblasHandle_t             handle,
+                                int64_t                     n,
+                                const hipblasDoubleComplex* x,
+                                int64_t                     incx,
+                                hipblasDoubleComplex*       y,
+                                int64_t                     incy)
+{
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy);
+    return copy_64(hipblasZcopy, handle, n, x, incx, y, incy);
+}
+
+hipblasStatus_t hipblasSdot_64(hipblasHandle_t handle,
+                               int64_t         n,
+                               const float*    x,
+                               int64_t         incx,
+                               const float*    y,
+                               int64_t         incy,
+                               float*          result)
+{
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy, result);
+    return dot_64(hipblasSdot, handle, n, x, incx, y, incy, result);
+}
+
+hipblasStatus_t hipblasDdot_64(hipblasHandle_t handle,
+                               int64_t         n,
+                               const double*   x,
+                               int64_t         incx,
+                               const double*   y,
+                               int64_t         incy,
+                               double*         result)
+{
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy, result);
+    return dot_64(hipblasDdot, handle, n, x, incx, y, incy, result);
+}
+
+hipblasStatus_t hipblasCdotc_64(hipblasHandle_t       handle,
+                                int64_t               n,
+                                const hipblasComplex* x,
+                                int64_t               incx,
+                                const hipblasComplex* y,
+                                int64_t               incy,
+                                hipblasComplex*       result)
+{
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy, result);
+    return dot_64(hipblasCdotc, handle, n, x, incx, y, incy, result);
+}
+
+hipblasStatus_t hipblasCdotu_64(hipblasHandle_t       handle,
+                                int64_t               n,
+                                const hipblasComplex* x,
+                                int64_t               incx,
+                                const hipblasComplex* y,
+                                int64_t               incy,
+                                hipblasComplex*       result)
+{
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy, result);
+    return dot_64(hipblasCdotu, handle, n, x, incx, y, incy, result);
+}
+
+hipblasStatus_t hipblasZdotc_64(hipblasHandle_t             handle,
+                                int64_t                     n,
+                                const hipblasDoubleComplex* x,
+                                int64_t                     incx,
+                                const hipblasDoubleComplex* y,
+                                int64_t                     incy,
+                                hipblasDoubleComplex*       result)
+{
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy, result);
+    return dot_64(hipblasZdotc, handle, n, x, incx, y, incy, result);
+}
+
+hipblasStatus_t hipblasZdotu_64(hipblasHandle_t             handle,
+                                int64_t                     n,
+                                const hipblasDoubleComplex* x,
+                                int64_t                     incx,
+                                const hipblasDoubleComplex* y,
+                                int64_t                     incy,
+                                hipblasDoubleComplex*       result)
+{
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy, result);
+    return dot_64(hipblasZdotu, handle, n, x, incx, y, incy, result);
+}
+
+hipblasStatus_t
+    hipblasSnrm2_64(hipblasHandle_t handle, int64_t n, const float* x, int64_t incx, float* result)
+{
+    HIPBLAS_LOG_CALL(handle, n, x, incx, result);
+    return nrm2_64(hipblasSnrm2, handle, n, x, incx, result);
+}
+
+hipblasStatus_t hipblasDnrm2_64(
+    hipblasHandle_t handle, int64_t n, const double* x, int64_t incx, double* result)
+{
+    HIPBLAS_LOG_CALL(handle, n, x, incx, result);
+    return nrm2_64(hipblasDnrm2, handle, n, x, incx, result);
+}
+
+hipblasStatus_t hipblasScnrm2_64(
+    hipblasHandle_t handle, int64_t n, const hipblasComplex* x, int64_t incx, float* result)
+{
+    HIPBLAS_LOG_CALL(handle, n, x, incx, result);
+    return nrm2_64(hipblasScnrm2, handle, n, x, incx, result);
+}
+
+hipblasStatus_t hipblasDznrm2_64(
+    hipblasHandle_t handle, int64_t n, const hipblasDoubleComplex* x, int64_t incx, double* result)
+{
+    HIPBLAS_LOG_CALL(handle, n, x, incx, result);
+    return nrm2_64(hipblasDznrm2, handle, n, x, incx, result);
+}
+
+hipblasStatus_t
+    hipblasSscal_64(hipblasHandle_t handle, int64_t n, const float* alpha, float* x, int64_t incx)
+{
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx);
+    return scal_64(hipblasSscal, handle, n, alpha, x, incx);
+}
+
+hipblasStatus_t
+    hipblasDscal_64(hipblasHandle_t handle, int64_t n, const double* alpha, double* x, int64_t incx)
+{
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx);
+    return scal_64(hipblasDscal, handle, n, alpha, x, incx);
+}
+
+hipblasStatus_t hipblasCscal_64(
+    hipblasHandle_t handle, int64_t n, const hipblasComplex* alpha, hipblasComplex* x, int64_t incx)
+{
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx);
+    return scal_64(hipblasCscal, handle, n, alpha, x, incx);
+}
+
+hipblasStatus_t hipblasCsscal_64(
+    hipblasHandle_t handle, int64_t n, const float* alpha, hipblasComplex* x, int64_t incx)
+{
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx);
+    return scal_64(hipblasCsscal, handle, n, alpha, x, incx);
+}
+
+hipblasStatus_t hipblasZscal_64(hipblasHandle_t             handle,
+                                int64_t                     n,
+                                const hipblasDoubleComplex* alpha,
+                                hipblasDoubleComplex*       x,
+                                int64_t                     incx)
+{
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx);
+    return scal_64(hipblasZscal, handle, n, alpha, x, incx);
+}
+
+hipblasStatus_t hipblasZdscal_64(
+    hipblasHandle_t handle, int64_t n, const double* alpha, hipblasDoubleComplex* x, int64_t incx)
+{
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx);
+    return scal_64(hipblasZdscal, handle, n, alpha, x, incx);
+}
+
+hipblasStatus_t hipblasSswap_64(
+    hipblasHandle_t handle, int64_t n, float* x, int64_t incx, float* y, int64_t incy)
+{
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy);
+    return swap_64(hipblasSswap, handle, n, x, incx, y, incy);
+}
+
+hipblasStatus_t hipblasDswap_64(
+    hipblasHandle_t handle, int64_t n, double* x, int64_t incx, double* y, int64_t incy)
+{
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy);
+    return swap_64(hipblasDswap, handle, n, x, incx, y, incy);
+}
+
+hipblasStatus_t hipblasCswap_64(hipblasHandle_t handle,
+                                int64_t         n,
+                                hipblasComplex* x,
+                                int64_t         incx,
+                                hipblasComplex* y,
+                                int64_t         incy)
+{
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy);
+    return swap_64(hipblasCswap, handle, n, x, incx, y, incy);
+}
+
+hipblasStatus_t hipblasZswap_64(hipblasHandle_t       handle,
+                                int64_t               n,
+                                hipblasDoubleComplex* x,
+                                int64_t               incx,
+                                hipblasDoubleComplex* y,
+                                int64_t               incy)
+{
+    HIPBLAS_LOG_CALL(handle, n, x, incx, y, incy);
+    return swap_64(hipblasZswap, handle, n, x, incx, y, incy);
+}
+
@@ -0,0 +1,82 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+//! Checksum-checked gemms, on a handle whose hipblasSetAbftMode mode is not HIPBLAS_ABFT_OFF: the
+//! block sums of op(A) and C are taken before the gemm runs, the expected block sums of the
+//! result follow from them through a small gemm, and the block sums of the result are compared
+//! with them after, each failure marking a tile of C; in HIPBLAS_ABFT_CORRECT the marked tiles
+//! are restored, recomputed and checked again. The hooks go last in the backends' gemm wrappers,
+//! so only gemms that reach the backend are checked, and the nested gemms run with checking off.
+//! The checksums take the handle's abft_buffer rather than its workspace. Each returns false,
+//! having done nothing, when the call is not a checked one: checking is off, the types are not all
+//! R_32F or all R_64F, the call is one the plain path should take for its quick returns and error
+//! codes, there is a per-batch scalar stride, or the checksums cannot have their buffer; otherwise
+//! it runs the gemm and sets status.
+#ifndef HIPBLAS_GEMM_ABFT_H
+#define HIPBLAS_GEMM_ABFT_H
+#pragma once
+#include "hipblas.h"
+
+bool hipblas_gemm_abft(hipblasHandle_t    handle,
+                       hipblasOperation_t transa,
+                       hipblasOperation_t transb,
+                       int                m,
+                       int                n,
+                       int                k,
+                       const void*        alpha,
+                       const void*        A,
+                       hipblasDatatype_t  a_type,
+                       int                lda,
+                       const void*        B,
+                       hipblasDatatype_t  b_type,
+                       int                ldb,
+                       const void*        beta,
+                       void*              C,
+                       hipblasDatatype_t  c_type,
+                       int                ldc,
+                       hipblasDatatype_t  compute_type,
+                       hipblasGemmAlgo_t  algo,
+                       hipblasStatus_t&   status);
+
+template <typename T>
+bool hipblas_gemm_abft_strided_batched(hipblasHandle_t    handle,
+                                       hipblasOperation_t transa,
+                                       hipblasOperation_t transb,
+                                       int                m,
+                                       int                n,
+                                       int                k,
+                                       const T*           alpha,
+                                       const T*           A,
+                                       int                lda,
+                                       long long          bsa,
+                                       const T*           B,
+                                       int                ldb,
+                                       long long          bsb,
+                                       const T*           beta,
+                                       T*                 C,
+                                       int                ldc,
+                                       long long          bsc,
+                                       int                batch_count,
+                                       hipblasStatus_t&   status);
+
+// The pointer arrays are in device memory, as HIPBLAS_STAGE_POINTER_ARRAYS leaves them
+template <typename T>
+bool hipblas_gemm_abft_batched(hipblasHandle_t    handle,
+                               hipblasOperation_t transa,
+                               hipblasOperation_t transb,
+                               int                m,
+                               int                n,
+                               int                k,
+                               const T*           alpha,
+                               const T* const     A[],
+                               int                lda,
+                               const T* const     B[],
+                               int                ldb,
+                               const T*           beta,
+                               T* const           C[],
+                               int                ldc,
+                               int                batch_count,
+                               hipblasStatus_t&   status);
+
+#endif
@@ -0,0 +1,85 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+//! Online tuning of hipblasGemmEx, see hipblasSetGemmAutotune. The choices live in one map for
+//! the process, keyed by device and problem, so every autotuning handle adds trials to the same
+//! entry and uses its winner. A trial brackets the call with two events on the handle's stream;
+//! their times are collected without waiting, by later calls of the same problem.
+#ifndef HIPBLAS_GEMM_AUTOTUNE_H
+#define HIPBLAS_GEMM_AUTOTUNE_H
+#pragma once
+#include "hipblas.h"
+#include "hipblas_gemm_tuning.h"
+#include <hip/hip_runtime_api.h>
+
+/* ============================================================================================ */
+/*! \brief One autotuned gemm call: begin() says whether the call is autotuned, choice() is the
+ *  candidate to run. A timed candidate is bracketed by start() and finish(); one the backend
+ *  rejects is reported through reject() once the heuristic has run the call in its place. */
+class hipblas_gemm_autotune_call
+{
+public:
+    hipblas_gemm_autotune_call() = default;
+    ~hipblas_gemm_autotune_call();
+
+    hipblas_gemm_autotune_call(const hipblas_gemm_autotune_call&) = delete;
+    hipblas_gemm_autotune_call& operator=(const hipblas_gemm_autotune_call&) = delete;
+
+    // False, doing nothing, unless the handle autotunes and algo is HIPBLAS_GEMM_DEFAULT
+    bool begin(hipblasHandle_t handle, hipblasGemmAlgo_t algo, const hipblasGemmShape_t& shape);
+
+    const hipblas_gemm_tuned& choice() const
+    {
+        return chosen;
+    }
+
+    // Whether the choice is the backend heuristic, which nothing can replace
+    bool heuristic() const
+    {
+        return candidate == 0;
+    }
+
+    void start();
+    void finish(hipblasStatus_t status);
+    void reject();
+
+private:
+    void*              entry     = nullptr;
+    int                candidate = 0;
+    hipStream_t        stream    = nullptr;
+    hipEvent_t         events[2] = {nullptr, nullptr}; // set while the call is a timed trial
+    hipblas_gemm_tuned chosen;
+};
+
+/*! \brief Runs gemm(algo, solution_index) as the handle's autotuning chooses, setting status,
+ *  or returns false when the call is not autotuned. A candidate the backend rejects is dropped
+ *  for the problem and the call runs the heuristic instead. */
+template <typename F>
+bool hipblas_gemm_autotuned(hipblasHandle_t           handle,
+                            hipblasGemmAlgo_t         algo,
+                            const hipblasGemmShape_t& shape,
+                            F&&                       gemm,
+                            hipblasStatus_t&          status)
+{
+    hipblas_gemm_autotune_call call;
+    if(!call.begin(handle, algo, shape))
+        return false;
+
+    call.start();
+    status = gemm(call.choice().algo, call.choice().solution_index);
+    call.finish(status);
+    if(status == HIPBLAS_STATUS_SUCCESS || call.heuristic())
+        return true;
+
+    // A call the heuristic rejects too is itself at fault, and the candidate is kept
+    status = gemm(algo, 0);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        call.reject();
+    return true;
+}
+
+// Writes the settled choices to path, in the format of the tuning file
+hipblasStatus_t hipblas_gemm_autotune_save(const char* path);
+
+#endif
@@ -0,0 +1,79 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+//! Degenerate gemms rerouted to the level 1 and 2 routine their shape reduces to, unless the
+//! handle's shape dispatch mode is off:
+//!   n == 1:      gemv
+//!   k == 1:      ger, when beta is 0 or 1 in host pointer mode; beta == 0 clears C first, which
+//!                the batched form cannot do and the strided form only for contiguous batches
+//!   m == n == 1: dot, when alpha is 1 and beta is 0 in host pointer mode; the strided form needs
+//!                the results side by side, and the batched form has no dot route
+//! The reroutes run through the exported functions, so they honour the handle's other modes.
+//! Each function returns false, having done nothing, when the call has no route; otherwise it
+//! runs the routine, sets status and records the route in the trace.
+#ifndef HIPBLAS_GEMM_DISPATCH_H
+#define HIPBLAS_GEMM_DISPATCH_H
+#pragma once
+#include "hipblas.h"
+
+template <typename T>
+bool hipblas_gemm_by_shape(const char*        caller,
+                           hipblasHandle_t    handle,
+                           hipblasOperation_t transa,
+                           hipblasOperation_t transb,
+                           int                m,
+                           int                n,
+                           int                k,
+                           const T*           alpha,
+                           const T*           A,
+                           int                lda,
+                           const T*           B,
+                           int                ldb,
+                           const T*           beta,
+                           T*                 C,
+                           int                ldc,
+                           hipblasStatus_t&   status);
+
+template <typename T>
+bool hipblas_gemm_batched_by_shape(const char*        caller,
+                                   hipblasHandle_t    handle,
+                                   hipblasOperation_t transa,
+                                   hipblasOperation_t transb,
+                                   int                m,
+                                   int                n,
+                                   int                k,
+                                   const T*           alpha,
+                                   const T* const     A[],
+                                   int                lda,
+                                   const T* const     B[],
+                                   int                ldb,
+                                   const T*           beta,
+                                   T* const           C[],
+                                   int                ldc,
+                                   int                batch_count,
+                                   hipblasStatus_t&   status);
+
+template <typename T>
+bool hipblas_gemm_strided_batched_by_shape(const char*        caller,
+                                           hipblasHandle_t    handle,
+                                           hipblasOperation_t transa,
+                                           hipblasOperation_t transb,
+                                           int                m,
+                                           int                n,
+                                           int                k,
+                                           const T*           alpha,
+                                           const T*           A,
+                                           int                lda,
+                                           long long          bsa,
+                                           const T*           B,
+                                           int                ldb,
+                                           long long          bsb,
+                                           const T*           beta,
+                                           T*                 C,
+                                           int                ldc,
+                                           long long          bsc,
+                                           int                batch_count,
+                                           hipblasStatus_t&   status);
+
+#endif
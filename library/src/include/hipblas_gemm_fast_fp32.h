@@ -0,0 +1,38 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+//! The fast fp32 gemms: HIPBLAS_COMPUTE_32F_FAST_TF32 runs the gemm in fp32 under TF32 math, and
+//! HIPBLAS_COMPUTE_32F_FAST_BF16X3, or an R_32F gemm on a handle with HIPBLAS_BF16X3_MATH, splits
+//! op(A) and op(B) into bf16 high and low parts laid side by side along k, so that one bf16 gemm
+//! of depth 3 k sums hi * hi + lo * hi + hi * lo in fp32. The split operands are carved from the
+//! handle workspace. Returns false, having done nothing, when the call is not a fast fp32 gemm or
+//! is one the plain fp32 path should take for its quick returns and error codes; otherwise it
+//! runs the gemm and sets status.
+#ifndef HIPBLAS_GEMM_FAST_FP32_H
+#define HIPBLAS_GEMM_FAST_FP32_H
+#pragma once
+#include "hipblas.h"
+
+bool hipblas_gemm_fast_fp32(hipblasHandle_t    handle,
+                            hipblasOperation_t transa,
+                            hipblasOperation_t transb,
+                            int                m,
+                            int                n,
+                            int                k,
+                            const void*        alpha,
+                            const void*        A,
+                            hipblasDatatype_t  a_type,
+                            int                lda,
+                            const void*        B,
+                            hipblasDatatype_t  b_type,
+                            int                ldb,
+                            const void*        beta,
+                            void*              C,
+                            hipblasDatatype_t  c_type,
+                            int                ldc,
+                            hipblasDatatype_t  compute_type,
+                            hipblasGemmAlgo_t  algo,
+                            hipblasStatus_t&   status);
+
+#endif
@@ -0,0 +1,39 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+//! The int8 fp64 gemms: HIPBLAS_COMPUTE_64F_EMULATED_INT8, or an R_64F gemm on a handle with
+//! HIPBLAS_INT8_FP64_MATH, scales each row of op(A) and column of op(B) by a power of two and
+//! cuts it into hipblasSetEmulationSlices int8 slices of 7 bits. The slice products of highest
+//! weight run as int8 gemms with int32 results, exact for depths up to 2^17 and so taken over k
+//! in chunks of that size, and are summed in fp64 before the scales are put back. The slices
+//! and partial results are carved from the handle workspace. Returns false, having done nothing,
+//! when the call is not an int8 fp64 gemm or is one the plain fp64 path should take for its quick
+//! returns and error codes; otherwise it runs the gemm and sets status.
+#ifndef HIPBLAS_GEMM_INT8_FP64_H
+#define HIPBLAS_GEMM_INT8_FP64_H
+#pragma once
+#include "hipblas.h"
+
+bool hipblas_gemm_int8_fp64(hipblasHandle_t    handle,
+                            hipblasOperation_t transa,
+                            hipblasOperation_t transb,
+                            int                m,
+                            int                n,
+                            int                k,
+                            const void*        alpha,
+                            const void*        A,
+                            hipblasDatatype_t  a_type,
+                            int                lda,
+                            const void*        B,
+                            hipblasDatatype_t  b_type,
+                            int                ldb,
+                            const void*        beta,
+                            void*              C,
+                            hipblasDatatype_t  c_type,
+                            int                ldc,
+                            hipblasDatatype_t  compute_type,
+                            hipblasGemmAlgo_t  algo,
+                            hipblasStatus_t&   status);
+
+#endif
@@ -0,0 +1,52 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+//! Gemm plans: a hipblasGemmPlan_t points to a hipblas_gemm_plan, which holds one hipblasGemmEx
+//! problem validated and resolved by hipblasGemmPlanCreate. A plan whose problem takes the plain
+//! path of hipblasGemmEx is direct, and hipblasGemmPlanExecute launches it through the backend
+//! with the tuned algo and solution found at creation; any other plan runs through
+//! hipblasGemmExWithEpilogue on each execute. A plan of hipblasGemmPlanCreateJit launches its
+//! run-time compiled kernel alone.
+#ifndef HIPBLAS_GEMM_PLAN_H
+#define HIPBLAS_GEMM_PLAN_H
+#pragma once
+#include "hipblas.h"
+#include "hipblas_gemm_tuning.h"
+#include "hipblas_handle.h"
+#include "hipblas_jit.h"
+
+struct hipblas_gemm_plan
+{
+    hipblasHandle_t    handle;
+    hipblasGemmShape_t shape;
+    int                lda, ldb, ldc;
+
+    // The caller's algo, and the tuned choice tried before it when tuned is set
+    hipblasGemmAlgo_t  algo;
+    bool               tuned;
+    hipblas_gemm_tuned choice;
+
+    bool                  has_epilogue;
+    hipblasGemmEpilogue_t epilogue;
+
+    // The handle's gemm routing direct was decided on; a handle that has since changed any of it
+    // runs the plan through hipblasGemmExWithEpilogue
+    bool                 direct;
+    hipblas_gemm_routing routing;
+
+    // Set by hipblasGemmPlanCreateJit; the kernel belongs to the JIT cache
+    const hipblas_jit_kernel* jit;
+};
+
+// Defined by each backend: the plan's gemm as one backend call, the tuned choice first when the
+// plan has one, without the epilogue
+hipblasStatus_t hipblas_gemm_plan_launch(hipblasHandle_t          handle,
+                                         const hipblas_gemm_plan& plan,
+                                         const void*              alpha,
+                                         const void*              A,
+                                         const void*              B,
+                                         const void*              beta,
+                                         void*                    C);
+
+#endif
@@ -0,0 +1,41 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+//! Real x complex gemmex: exactly one of A and B is R_32F or R_64F, the other and C are the
+//! complex type of the same precision, and the compute type is either type of that precision.
+//! alpha and beta are of C's type. Neither backend library has this combination, so the real
+//! operand is never widened to complex: a complex op(A) = A times a real B, with real alpha and
+//! beta in host pointer mode, runs as one real gemmex on A and C viewed as real matrices of twice
+//! the rows; every other call runs a tiled kernel that reads the real operand at its own size.
+//! A, B and C are strided, or pointer arrays already in device memory; their strides count
+//! elements. Returns false, having done nothing, when the types are not such a combination;
+//! otherwise it checks the arguments, runs the gemm and sets status.
+#ifndef HIPBLAS_GEMM_REAL_COMPLEX_H
+#define HIPBLAS_GEMM_REAL_COMPLEX_H
+#pragma once
+#include "hipblas.h"
+#include "hipblas_kernels.h"
+
+bool hipblas_gemm_real_complex(hipblasHandle_t                     handle,
+                               hipblasOperation_t                  transa,
+                               hipblasOperation_t                  transb,
+                               int                                 m,
+                               int                                 n,
+                               int                                 k,
+                               const void*                         alpha,
+                               hipblas_batched_operand<const void> A,
+                               hipblasDatatype_t                   a_type,
+                               int                                 lda,
+                               hipblas_batched_operand<const void> B,
+                               hipblasDatatype_t                   b_type,
+                               int                                 ldb,
+                               const void*                         beta,
+                               hipblas_batched_operand<void>       C,
+                               hipblasDatatype_t                   c_type,
+                               int                                 ldc,
+                               int                                 batch_count,
+                               hipblasDatatype_t                   compute_type,
+                               hipblasStatus_t&                    status);
+
+#endif
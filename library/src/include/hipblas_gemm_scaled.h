@@ -0,0 +1,56 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+//! The parts of hipblasGemmExWithScales both backends share: the argument checks and the fp32
+//! path, which widens the scaled operands into the handle workspace, runs an fp32 gemmex there and
+//! narrows the result into D, taking amax on the way
+#ifndef HIPBLAS_GEMM_SCALED_H
+#define HIPBLAS_GEMM_SCALED_H
+#pragma once
+#include "hipblas.h"
+
+// HIPBLAS_STATUS_SUCCESS when the fp8 gemm is valid and runnable
+hipblasStatus_t hipblas_gemm_scaled_check(hipblasHandle_t            handle,
+                                          hipblasOperation_t         transa,
+                                          hipblasOperation_t         transb,
+                                          int                        m,
+                                          int                        n,
+                                          int                        k,
+                                          const void*                alpha,
+                                          hipblasDatatype_t          a_type,
+                                          int                        lda,
+                                          hipblasDatatype_t          b_type,
+                                          int                        ldb,
+                                          const void*                beta,
+                                          hipblasDatatype_t          c_type,
+                                          int                        ldc,
+                                          hipblasDatatype_t          d_type,
+                                          int                        ldd,
+                                          hipblasDatatype_t          compute_type,
+                                          const hipblasGemmScales_t* scales);
+
+hipblasStatus_t hipblas_gemm_scaled_fp32(hipblasHandle_t            handle,
+                                         hipblasOperation_t         transa,
+                                         hipblasOperation_t         transb,
+                                         int                        m,
+                                         int                        n,
+                                         int                        k,
+                                         const void*                alpha,
+                                         const void*                A,
+                                         hipblasDatatype_t          a_type,
+                                         int                        lda,
+                                         const void*                B,
+                                         hipblasDatatype_t          b_type,
+                                         int                        ldb,
+                                         const void*                beta,
+                                         const void*                C,
+                                         hipblasDatatype_t          c_type,
+                                         int                        ldc,
+                                         void*                      D,
+                                         hipblasDatatype_t          d_type,
+                                         int                        ldd,
+                                         hipblasGemmAlgo_t          algo,
+                                         const hipblasGemmScales_t* scales);
+
+#endif
@@ -0,0 +1,38 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+//! Split-k gemms, on a handle whose hipblasSetGemmSplitK hint is not 1: k is cut into parts and
+//! op(A) op(B) of each part runs as one batch of a strided batched gemm into the handle workspace,
+//! from where a reduction kernel writes C = alpha * (sum of the parts) + beta * C. A, B, C and the
+//! compute type must all be R_32F, R_64F, C_32F or C_64F. Returns false, having done nothing, when
+//! the call is not split: the hint gives it one part, its types do not qualify, it is one the plain
+//! path should take for its quick returns and error codes, or the workspace cannot hold the
+//! parts; otherwise it runs the gemm and sets status.
+#ifndef HIPBLAS_GEMM_SPLIT_K_H
+#define HIPBLAS_GEMM_SPLIT_K_H
+#pragma once
+#include "hipblas.h"
+
+bool hipblas_gemm_split_k(hipblasHandle_t    handle,
+                          hipblasOperation_t transa,
+                          hipblasOperation_t transb,
+                          int                m,
+                          int                n,
+                          int                k,
+                          const void*        alpha,
+                          const void*        A,
+                          hipblasDatatype_t  a_type,
+                          int                lda,
+                          const void*        B,
+                          hipblasDatatype_t  b_type,
+                          int                ldb,
+                          const void*        beta,
+                          void*              C,
+                          hipblasDatatype_t  c_type,
+                          int                ldc,
+                          hipblasDatatype_t  compute_type,
+                          hipblasGemmAlgo_t  algo,
+                          hipblasStatus_t&   status);
+
+#endif
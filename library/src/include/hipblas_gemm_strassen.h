@@ -0,0 +1,39 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+//! Strassen-Winograd gemms, on a handle whose hipblasSetGemmStrassen levels are not 0: while m, n
+//! and k are all at least the cutoff, the even part of the product is cut into quadrants whose
+//! seven products run one level further down, or as plain gemms at the last level, and are
+//! combined by geam into C; the odd row, column and rank-1 term left over run as plain gemms.
+//! The quadrant sums and products take the handle workspace. A, B, C and the compute type must
+//! all be R_32F or R_64F. Returns false, having done nothing, when the call is not a Strassen
+//! gemm: it is below the cutoff, its types do not qualify, it is one the plain path should take
+//! for its quick returns and error codes, or the workspace cannot hold the temporaries; otherwise
+//! it runs the gemm and sets status.
+#ifndef HIPBLAS_GEMM_STRASSEN_H
+#define HIPBLAS_GEMM_STRASSEN_H
+#pragma once
+#include "hipblas.h"
+
+bool hipblas_gemm_strassen(hipblasHandle_t    handle,
+                           hipblasOperation_t transa,
+                           hipblasOperation_t transb,
+                           int                m,
+                           int                n,
+                           int                k,
+                           const void*        alpha,
+                           const void*        A,
+                           hipblasDatatype_t  a_type,
+                           int                lda,
+                           const void*        B,
+                           hipblasDatatype_t  b_type,
+                           int                ldb,
+                           const void*        beta,
+                           void*              C,
+                           hipblasDatatype_t  c_type,
+                           int                ldc,
+                           hipblasDatatype_t  compute_type,
+                           hipblasStatus_t&   status);
+
+#endif
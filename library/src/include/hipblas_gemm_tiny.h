@@ -0,0 +1,38 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+//! Tiny strided batched gemms, with m, n and k all at most the handle's hipblasSetGemmTinyLimit,
+//! run on hipBLAS's own kernels rather than the backend's, whose general tiles leave most of each
+//! one idle. Host and device scalars and the handle's scalar stride are honoured. Returns false,
+//! having done nothing, when the call is too large or one the backend should take for its quick
+//! returns and error codes; otherwise it runs the gemm, sets status and records the route in the
+//! trace.
+#ifndef HIPBLAS_GEMM_TINY_H
+#define HIPBLAS_GEMM_TINY_H
+#pragma once
+#include "hipblas.h"
+
+template <typename T>
+bool hipblas_gemm_tiny(const char*        caller,
+                       hipblasHandle_t    handle,
+                       hipblasOperation_t transa,
+                       hipblasOperation_t transb,
+                       int                m,
+                       int                n,
+                       int                k,
+                       const T*           alpha,
+                       const T*           A,
+                       int                lda,
+                       long long          bsa,
+                       const T*           B,
+                       int                ldb,
+                       long long          bsb,
+                       const T*           beta,
+                       T*                 C,
+                       int                ldc,
+                       long long          bsc,
+                       int                batch_count,
+                       hipblasStatus_t&   status);
+
+#endif
@@ -0,0 +1,68 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+//! Per-shape gemm_ex choices measured by hipblas-tune. A handle loads them at hipblasCreate
+//! from the file named by HIPBLAS_GEMM_TUNING_FILE, or later through hipblasSetGemmTuningFile.
+#ifndef HIPBLAS_GEMM_TUNING_H
+#define HIPBLAS_GEMM_TUNING_H
+#pragma once
+#include "hipblas.h"
+#include <array>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+struct hipblas_gemm_tuned
+{
+    hipblasGemmAlgo_t algo           = HIPBLAS_GEMM_DEFAULT;
+    int32_t           solution_index = 0;
+};
+
+/* ============================================================================================ */
+/*! \brief Tuning table, immutable once loaded so handles can share it.
+ *
+ *  One problem per line, '#' starts a comment:
+ *
+ *      transA,transB,m,n,k,a_type,b_type,c_type,compute_type,algo,solution_index
+ *      N,T,4096,4096,1024,f16_r,f16_r,f16_r,f32_r,default,1873
+ *
+ *  Types are f16_r, f32_r, f64_r, f16_c, f32_c, f64_c, bf16_r, bf16_c, i8_r, u8_r, i32_r or
+ *  u32_r; algo is default, default_tensor_op, algo<i> or algo<i>_tensor_op. A later line for
+ *  the same problem replaces an earlier one. */
+class hipblas_gemm_tuning
+{
+public:
+    // Fails with HIPBLAS_STATUS_INVALID_VALUE when the file cannot be read or a line is malformed
+    static hipblasStatus_t load(const char* path, std::shared_ptr<const hipblas_gemm_tuning>& out);
+
+    // The table named by HIPBLAS_GEMM_TUNING_FILE; null when it is unset or fails to load
+    static std::shared_ptr<const hipblas_gemm_tuning> from_environment();
+
+    // Every problem in the table, for hipblasWarmup
+    std::vector<hipblasGemmShape_t> shapes() const;
+
+    const hipblas_gemm_tuned* find(hipblasOperation_t transa,
+                                   hipblasOperation_t transb,
+                                   int                m,
+                                   int                n,
+                                   int                k,
+                                   hipblasDatatype_t  a_type,
+                                   hipblasDatatype_t  b_type,
+                                   hipblasDatatype_t  c_type,
+                                   hipblasDatatype_t  compute_type) const;
+
+private:
+    using key = std::array<int, 9>;
+    std::map<key, hipblas_gemm_tuned> entries;
+};
+
+// One line of the tuning file, without its newline
+std::string hipblas_gemm_tuning_row(const hipblasGemmShape_t& shape,
+                                    const hipblas_gemm_tuned& tuned);
+
+// hipblasCreate's preload: warms the handle's tuned shapes when HIPBLAS_WARMUP is non-zero
+void hipblas_warmup_from_environment(hipblasHandle_t handle);
+
+#endif
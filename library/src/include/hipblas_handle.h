@@ -0,0 +1,917 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+//! hipBLAS-side handle state shared by the hcc_detail and nvcc_detail backends.
+//! A hipblasHandle_t points to a hipblas_handle, which owns the backend handle
+//! (rocblas_handle or cublasHandle_t) plus any state hipBLAS itself needs.
+#ifndef HIPBLAS_HANDLE_H
+#define HIPBLAS_HANDLE_H
+#pragma once
+#include "hipblas.h"
+#include "hipblas_gemm_tuning.h"
+#include <atomic>
+#include <cstring>
+#include <initializer_list>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <stddef.h>
+#include <vector>
+
+struct hipblas_handle;
+
+// How the streams hipBLAS creates for a handle are made: of a priority, or restricted to the CUs
+// set in cu_mask, one bit per CU, when it is not empty
+struct hipblas_stream_options
+{
+    hipblasStreamPriority_t priority = HIPBLAS_STREAM_PRIORITY_DEFAULT;
+    std::vector<uint32_t>   cu_mask;
+
+    bool operator==(const hipblas_stream_options& other) const
+    {
+        return priority == other.priority && cu_mask == other.cu_mask;
+    }
+
+    bool operator!=(const hipblas_stream_options& other) const
+    {
+        return !(*this == other);
+    }
+};
+
+// A non-blocking stream for hipBLAS's own work, at the device's greatest or least priority for
+// HIPBLAS_STREAM_PRIORITY_HIGH or _LOW; with a CU mask, one of hipExtStreamCreateWithCUMask
+// restricted to its CUs instead. On the current device
+hipError_t hipblas_stream_create(hipStream_t* stream, const hipblas_stream_options& options);
+
+/* ============================================================================================ */
+/*! \brief Device workspace arena for temporaries allocated by the hipBLAS wrappers.
+ *
+ *  Library-owned storage grows lazily on first use of a larger size and is then reused, so
+ *  wrapper calls are allocation-free in the steady state. Storage supplied by the user through
+ *  hipblasSetWorkspace is never reallocated; requests larger than it fail with
+ *  HIPBLAS_STATUS_ALLOC_FAILED, as do those that would grow library-owned storage past the limit.
+ *  The largest request and the reallocations are counted for hipblasGetWorkspaceUsage. */
+class hipblas_workspace
+{
+public:
+    hipblas_workspace() = default;
+    ~hipblas_workspace();
+
+    hipblas_workspace(const hipblas_workspace&) = delete;
+    hipblas_workspace& operator=(const hipblas_workspace&) = delete;
+
+    // Make at least bytes of device memory available at data(), failing if that needs growth and
+    // may_grow is false
+    hipblasStatus_t reserve(size_t bytes, bool may_grow = true);
+
+    // Use caller-owned memory; addr == nullptr && size == 0 returns to library-owned storage
+    hipblasStatus_t set_user(void* addr, size_t size);
+
+    void* data() const
+    {
+        return ptr;
+    }
+
+    size_t size() const
+    {
+        return capacity;
+    }
+
+    bool is_user() const
+    {
+        return user_owned;
+    }
+
+    // Largest request since creation or the last reset, whether or not it was met
+    size_t high_water() const
+    {
+        return peak;
+    }
+
+    unsigned long long growths() const
+    {
+        return reallocations;
+    }
+
+    void reset_high_water()
+    {
+        peak          = 0;
+        reallocations = 0;
+    }
+
+    // Library-owned storage does not grow past limit bytes; 0 for no limit
+    size_t limit = 0;
+
+private:
+    void               release();
+    void*              ptr           = nullptr;
+    size_t             capacity      = 0;
+    bool               user_owned    = false;
+    size_t             peak          = 0;
+    unsigned long long reallocations = 0;
+};
+
+/* ============================================================================================ */
+/*! \brief Counters behind hipblasGetHandleStats, updated by the logging guard */
+struct hipblas_handle_stats
+{
+    struct counters
+    {
+        std::atomic<unsigned long long> calls{0};
+        std::atomic<unsigned long long> bytes{0};
+        std::atomic<unsigned long long> flops{0};
+        std::atomic<unsigned long long> host_ns{0};
+    };
+
+    counters family[HIPBLAS_FAMILY_COUNT];
+};
+
+/* ============================================================================================ */
+/*! \brief Records behind hipblasDrainTimings, filled by the logging guard.
+ *
+ *  A call claims the slot at head with a compare-and-swap, records the slot's start event on its
+ *  stream and, once its work is queued, the stop event, then publishes the slot. The drain walks
+ *  from tail while slots are published and their stop events complete, so recording never takes
+ *  a lock or waits; a call that finds SLOTS records not yet drained is dropped. */
+class hipblas_call_timings
+{
+public:
+    static constexpr int SLOTS = 1024;
+
+    hipblas_call_timings() = default;
+    ~hipblas_call_timings();
+
+    hipblas_call_timings(const hipblas_call_timings&) = delete;
+    hipblas_call_timings& operator=(const hipblas_call_timings&) = delete;
+
+    // Numbers the call and returns whether it is the first of every every calls
+    bool sample(int every, unsigned long long& sequence);
+
+    // Claims a slot for record and records its start on stream; -1 when the call is dropped
+    long long begin(const hipblasCallTiming_t& record, hipStream_t stream);
+
+    // Records the stop of the slot begin returned and publishes it
+    void finish(long long ticket, hipStream_t stream);
+
+    // Copies out up to capacity completed records, oldest first, and returns how many
+    int drain(hipblasCallTiming_t* out, int capacity);
+
+    // Calls dropped since the last call to take_dropped
+    unsigned long long take_dropped()
+    {
+        return dropped.exchange(0, std::memory_order_relaxed);
+    }
+
+private:
+    enum : int
+    {
+        EMPTY,
+        PUBLISHED,
+        FAILED // the events could not be created or recorded
+    };
+
+    struct slot
+    {
+        hipEvent_t          start = nullptr;
+        hipEvent_t          stop  = nullptr;
+        hipblasCallTiming_t record{};
+        std::atomic<int>    state{EMPTY};
+    };
+
+    slot                            slots[SLOTS];
+    std::atomic<unsigned long long> head{0};
+    std::atomic<unsigned long long> tail{0};
+    std::atomic<unsigned long long> calls{0};
+    std::atomic<unsigned long long> dropped{0};
+    std::mutex                      drain_mutex; // drains only; recording never takes it
+};
+
+/* ============================================================================================ */
+/*! \brief Staging for the pointer arrays of batched calls made in HIPBLAS_POINTER_ARRAY_HOST mode.
+ *
+ *  Each slot pairs pinned host memory with a device buffer of the same size. A call copies its
+ *  arrays into the next slot's host memory, queues the upload on its stream and, once its own work
+ *  is queued, records the slot's event; the slot is next used SLOTS calls later, after that event,
+ *  so in the steady state staging neither allocates nor waits. */
+class hipblas_pointer_array_ring
+{
+public:
+    static constexpr int SLOTS = 8;
+
+    struct slot
+    {
+        void*      host     = nullptr;
+        void*      device   = nullptr;
+        size_t     capacity = 0;
+        hipEvent_t done     = nullptr;
+        bool       pending  = false;
+    };
+
+    hipblas_pointer_array_ring() = default;
+    ~hipblas_pointer_array_ring();
+
+    hipblas_pointer_array_ring(const hipblas_pointer_array_ring&) = delete;
+    hipblas_pointer_array_ring& operator=(const hipblas_pointer_array_ring&) = delete;
+
+    // The next slot, free and holding at least bytes
+    hipblasStatus_t acquire(size_t bytes, slot*& out);
+
+    // Marks the slot in use until the work queued so far on stream has run
+    void release(slot* s, hipStream_t stream);
+
+private:
+    slot slots[SLOTS];
+    int  next = 0;
+};
+
+/* ============================================================================================ */
+/*! \brief Devices, streams and tile buffers behind the hipblasXt functions, created on first use.
+ *
+ *  Every selected device has LANES lanes. A lane is a stream with its own backend handle, so lanes
+ *  never order each other through a shared handle. It holds two sets of operand tiles, used in
+ *  turn by the k steps of its output tile, and one output tile; every tile is a pinned host buffer
+ *  paired with a device buffer of the same size. While one lane's uploads run, the host packs the
+ *  next tile of another lane, so copies and gemms of the lanes overlap. */
+class hipblas_tile_pipeline
+{
+public:
+    static constexpr int LANES = 3;
+
+    struct tile
+    {
+        void*      host    = nullptr;
+        void*      device  = nullptr;
+        hipEvent_t done    = nullptr;
+        bool       pending = false;
+    };
+
+    struct lane
+    {
+        int             device = 0;
+        hipblasHandle_t handle = nullptr;
+        hipStream_t     stream = nullptr;
+        tile            a[2], b[2];
+        tile            c;
+        int             next = 0;
+    };
+
+    hipblas_tile_pipeline() = default;
+    ~hipblas_tile_pipeline();
+
+    hipblas_tile_pipeline(const hipblas_tile_pipeline&) = delete;
+    hipblas_tile_pipeline& operator=(const hipblas_tile_pipeline&) = delete;
+
+    // Devices for the next calls, none for the handle's own; drops the current lanes
+    void select(const int* devices, int count);
+
+    // Priority or CU mask of the lane streams; drops the current lanes when it changes
+    void set_stream_options(const hipblas_stream_options& options);
+
+    // Creates the lanes, on device when none were selected, and makes every tile hold at least
+    // bytes; call with no work in flight. Leaves the current device unchanged
+    hipblasStatus_t reserve(int device, size_t bytes);
+
+    // LANES lanes per device, device by device
+    std::vector<lane> lanes;
+
+private:
+    void                   release_lanes();
+    void                   release_tiles();
+    std::vector<int>       devices;
+    size_t                 capacity = 0;
+    hipblas_stream_options stream_options;
+};
+
+/* ============================================================================================ */
+/*! \brief Lanes behind hipblasGetIndependentHandle, each a stream with its own backend handle.
+ *
+ *  Handing out a lane records an event on the origin stream and makes the lane's stream wait on
+ *  it, so the lane's work comes after everything queued on the origin before; a join records an
+ *  event on every lane handed out since the last one and makes the origin wait on them. Neither
+ *  blocks the host, and both may be recorded by stream capture. */
+class hipblas_stream_pool
+{
+public:
+    struct lane
+    {
+        hipblasHandle_t handle = nullptr;
+        hipStream_t     stream = nullptr;
+        hipEvent_t      done   = nullptr;
+        bool            used   = false;
+    };
+
+    hipblas_stream_pool() = default;
+    ~hipblas_stream_pool();
+
+    hipblas_stream_pool(const hipblas_stream_pool&) = delete;
+    hipblas_stream_pool& operator=(const hipblas_stream_pool&) = delete;
+
+    // count lanes made with the given stream options on device, none to release them; leaves the
+    // current device unchanged
+    hipblasStatus_t resize(int device, int count, const hipblas_stream_options& options);
+
+    int size() const
+    {
+        return int(lanes.size());
+    }
+
+    // The next lane in turn, ordered after the work queued so far on origin
+    hipblasStatus_t acquire(hipStream_t origin, lane*& out);
+
+    // Orders origin after the work queued on every lane acquired since the last join
+    hipblasStatus_t join(hipStream_t origin);
+
+private:
+    void                   release();
+    std::vector<lane>      lanes;
+    hipEvent_t             fork = nullptr;
+    int                    next = 0;
+    hipblas_stream_options stream_options;
+};
+
+/* ============================================================================================ */
+/*! \brief The per-thread copies of a handle in HIPBLAS_THREAD_MODE_PER_THREAD.
+ *
+ *  Every thread keeps a thread-local list of the copies it uses, keyed by serial, so finding its
+ *  copy takes no lock; only creating one does. clear() gives the handle a new serial, so entries
+ *  left in the lists of other threads never match again. */
+class hipblas_thread_handles
+{
+public:
+    hipblas_thread_handles();
+    ~hipblas_thread_handles();
+
+    hipblas_thread_handles(const hipblas_thread_handles&) = delete;
+    hipblas_thread_handles& operator=(const hipblas_thread_handles&) = delete;
+
+    // Backend state of the handle the copies start with, read while it was still shared
+    void snapshot(hipStream_t stream, hipblasAtomicsMode_t atomics_mode);
+
+    // The calling thread's copy of parent, created on first use; nullptr when that fails
+    hipblasHandle_t get(hipblas_handle* parent);
+
+    // Destroys every copy; call while no thread uses the handle
+    void clear();
+
+private:
+    std::mutex                   mutex;
+    std::vector<hipblasHandle_t> copies;
+    unsigned long long           serial;
+    hipStream_t                  stream       = nullptr;
+    hipblasAtomicsMode_t         atomics_mode = HIPBLAS_ATOMICS_NOT_ALLOWED;
+};
+
+/* ============================================================================================ */
+/*! \brief Host results of the reductions made in HIPBLAS_RESULT_MODE_ASYNC.
+ *
+ *  The backend writes each result to a slot of a pinned, device-mapped buffer rather than to the
+ *  caller's variable, so the call need not wait for it. One event, recorded after every such
+ *  call, covers them all: a call on another stream first makes that stream wait for it. deliver()
+ *  waits for the event and copies each slot to its variable. */
+class hipblas_async_results
+{
+public:
+    static constexpr int    SLOTS      = 256;
+    static constexpr size_t SLOT_BYTES = 16; // a double complex, the largest result
+
+    hipblas_async_results() = default;
+    ~hipblas_async_results();
+
+    hipblas_async_results(const hipblas_async_results&) = delete;
+    hipblas_async_results& operator=(const hipblas_async_results&) = delete;
+
+    // The device address of a slot whose bytes go to dest when delivered; delivers the pending
+    // results first when every slot is taken
+    hipblasStatus_t reserve(void* dest, size_t bytes, void*& slot);
+
+    // The call writing the last reserved slot is queued on stream, or failed and is dropped
+    hipblasStatus_t queued(hipStream_t stream);
+    void            cancel();
+
+    // Waits for the pending results and stores them; clear() drops them instead
+    hipblasStatus_t deliver();
+    void            clear();
+
+private:
+    struct entry
+    {
+        void*  dest;
+        size_t bytes;
+    };
+
+    void*              host        = nullptr;
+    void*              device      = nullptr;
+    hipEvent_t         done        = nullptr;
+    hipStream_t        last_stream = nullptr;
+    std::vector<entry> entries;
+};
+
+/* ============================================================================================ */
+/*! \brief The handle settings that pick the route a gemm takes, read and written as one by
+ *  hipblas_classic_gemm_guard and compared as one by the gemm plans */
+struct hipblas_gemm_routing
+{
+    hipblasMath_t                              math_mode;
+    int                                        gemm_split_k;
+    int                                        gemm_strassen_levels;
+    hipblasAbftMode_t                          abft_mode;
+    hipblasGemmBackend_t                       gemm_backend;
+    std::shared_ptr<const hipblas_gemm_tuning> gemm_tuning;
+    int                                        gemm_autotune;
+    hipblasShapeDispatchMode_t                 shape_dispatch;
+    hipblasHostDispatchMode_t                  host_dispatch_mode;
+    int                                        gemm_tiny_limit;
+
+    // The same settings with every route off: the classic backend without split-k, Strassen,
+    // checksums, tuning, shape or host dispatch, the tiny kernels or the bf16x3 and int8 fp64
+    // math; the other math mode bits are kept
+    hipblas_gemm_routing classic() const
+    {
+        const int            routes = HIPBLAS_BF16X3_MATH | HIPBLAS_INT8_FP64_MATH;
+        hipblas_gemm_routing r      = *this;
+        r.math_mode                 = hipblasMath_t(math_mode & ~routes);
+        r.gemm_split_k              = 1;
+        r.gemm_strassen_levels      = 0;
+        r.abft_mode                 = HIPBLAS_ABFT_OFF;
+        r.gemm_backend              = HIPBLAS_GEMM_BACKEND_DEFAULT;
+        r.gemm_tuning               = nullptr;
+        r.gemm_autotune             = 0;
+        r.shape_dispatch            = HIPBLAS_SHAPE_DISPATCH_OFF;
+        r.host_dispatch_mode        = HIPBLAS_HOST_DISPATCH_OFF;
+        r.gemm_tiny_limit           = 0;
+        return r;
+    }
+
+    bool operator==(const hipblas_gemm_routing& o) const
+    {
+        return math_mode == o.math_mode && gemm_split_k == o.gemm_split_k
+               && gemm_strassen_levels == o.gemm_strassen_levels && abft_mode == o.abft_mode
+               && gemm_backend == o.gemm_backend && gemm_tuning == o.gemm_tuning
+               && gemm_autotune == o.gemm_autotune && shape_dispatch == o.shape_dispatch
+               && host_dispatch_mode == o.host_dispatch_mode
+               && gemm_tiny_limit == o.gemm_tiny_limit;
+    }
+};
+
+/* ============================================================================================ */
+/*! \brief Object behind every hipblasHandle_t */
+struct hipblas_handle
+{
+    void*             backend = nullptr; // rocblas_handle or cublasHandle_t
+    int               device  = 0;
+    hipblas_workspace workspace;
+
+    // Mirrors the backend pointer mode, so reads and redundant writes never reach the backend;
+    // both rocBLAS and cuBLAS create handles in host mode
+    hipblasPointerMode_t pointer_mode = HIPBLAS_POINTER_MODE_HOST;
+
+    // The stream hipblasSetStreamPriority or hipblasSetCUMask created, owned by the handle, and
+    // the priority or CU mask it was made with, which the handle's internal streams share
+    hipblas_stream_options stream_options;
+    hipStream_t            owned_stream = nullptr;
+
+    // In safe mode the workspace is frozen, so wrappers stay legal inside stream capture
+    hipblasCaptureMode_t capture_mode = HIPBLAS_CAPTURE_MODE_DEFAULT;
+
+    // Set between hipblasBeginCapture and its End or Update, with the mode to return to after it
+    bool                 capturing       = false;
+    hipblasCaptureMode_t capture_restore = HIPBLAS_CAPTURE_MODE_DEFAULT;
+
+    // Distance between the scalars of consecutive batches in device pointer mode, 0 for shared
+    // scalars; read through hipblas_scalar_stride
+    int64_t scalar_stride = 0;
+
+    // Where the pointer arrays of batched calls live, and the ring that uploads host ones
+    hipblasPointerArrayMode_t  pointer_array_mode = HIPBLAS_POINTER_ARRAY_DEVICE;
+    hipblas_pointer_array_ring pointer_arrays;
+
+    // Whether calls prefetch their managed operands; applied by the logging guard
+    hipblasManagedMemoryMode_t managed_memory_mode = HIPBLAS_MANAGED_MEMORY_DEFAULT;
+
+    // Whether gemm and axpy on host operands may run on the host; see hipblas_host_dispatch.h
+    hipblasHostDispatchMode_t host_dispatch_mode = HIPBLAS_HOST_DISPATCH_OFF;
+
+    // Whether host-pointer reductions leave their results to hipblasSynchronizeResults, and the
+    // results still to be stored
+    hipblasResultMode_t   result_mode = HIPBLAS_RESULT_MODE_BLOCKING;
+    hipblas_async_results async_results;
+
+    // Pinned staging of hipblasSet/GetMatrixBatched, apart so large transfers leave the pointer
+    // array slots small
+    hipblas_pointer_array_ring transfer_staging;
+
+    // Whether degenerate gemms run as gemv, ger or dot; see hipblas_gemm_dispatch.h
+    hipblasShapeDispatchMode_t shape_dispatch = HIPBLAS_SHAPE_DISPATCH_ON;
+
+    // Reduced-precision paths the caller allows; applied by the backends' gemm wrappers
+    hipblasMath_t math_mode = HIPBLAS_DEFAULT_MATH;
+
+    // Slices per operand of the int8 fp64 gemms; see hipblasSetEmulationSlices
+    int emulation_slices = 7;
+
+    // Parts the k range of a gemm is split into; see hipblasSetGemmSplitK
+    int gemm_split_k = 1;
+
+    // Levels of Strassen-Winograd recursion of large gemms, and the smallest m, n and k a level
+    // applies to, 0 for the default; see hipblasSetGemmStrassen
+    int gemm_strassen_levels = 0;
+    int gemm_strassen_cutoff = 0;
+
+    // Whether gemms are checked against checksums, the buffer the checksums take, apart from the
+    // workspace so gemms on workspace operands are checked too, the device count of failed
+    // tiles, and the counts kept on the host; see hipblasSetAbftMode
+    hipblasAbftMode_t   abft_mode = HIPBLAS_ABFT_OFF;
+    hipblas_workspace   abft_buffer;
+    hipblas_workspace   abft_failed;
+    hipblasAbftReport_t abft_report = {};
+
+    // Largest m, n and k that strided batched gemms take the tiny kernels for; see
+    // hipblasSetGemmTinyLimit
+    int gemm_tiny_limit = 16;
+
+    // Tile size of the hipblasXt functions, and the lanes that stream their tiles
+    int                   xt_block_dim = 2048;
+    hipblas_tile_pipeline xt_pipeline;
+
+    // Streams that independent calls are spread over, joined by hipblasSynchronizeHandle
+    hipblas_stream_pool stream_pool;
+
+    // In per-thread mode HIPBLAS_LOG_CALL swaps the handle for the calling thread's copy
+    hipblasThreadMode_t    thread_mode = HIPBLAS_THREAD_MODE_SHARED;
+    hipblas_thread_handles thread_handles;
+
+    // Gemm library the caller prefers, and the backend's state for it (the nvcc backend keeps its
+    // cuBLASLt handle and heuristic cache here and releases it in hipblasDestroy)
+    hipblasGemmBackend_t gemm_backend = HIPBLAS_GEMM_BACKEND_DEFAULT;
+    void*                gemm_state   = nullptr;
+
+    // The nvcc backend's cuSOLVERDn handle, created by the first single-matrix factorization and
+    // destroyed in hipblasDestroy
+    void* solver_state = nullptr;
+
+    // Tuned gemm_ex choices, shared with every handle that loaded the same table
+    std::shared_ptr<const hipblas_gemm_tuning> gemm_tuning;
+
+    // Timed trials per problem of online gemm_ex tuning, 0 for none; see hipblasSetGemmAutotune
+    int gemm_autotune = 0;
+
+    // Allocated when counting is first turned on and kept, so readers on other threads never see
+    // it change; calls in flight hold a reference past hipblasDestroy
+    hipblasStatsMode_t                    stats_mode = HIPBLAS_STATS_MODE_OFF;
+    std::shared_ptr<hipblas_handle_stats> stats;
+
+    // As for stats; the ring is dropped only when a pooled handle is reset
+    hipblasTimingMode_t                   timing_mode         = HIPBLAS_TIMING_MODE_OFF;
+    int                                   timing_sample_every = 1;
+    std::shared_ptr<hipblas_call_timings> timings;
+
+    // Takes on the hipBLAS-side modes and the pointer mode of from, so calls behave as they would
+    // on from; reads no backend state of from
+    hipblasStatus_t inherit(const hipblas_handle& from);
+
+    // The gemm routing settings, and setting them back, the math mode through hipblasSetMathMode
+    hipblas_gemm_routing gemm_routing() const;
+    hipblasStatus_t      set_gemm_routing(const hipblas_gemm_routing& routing);
+
+    // Work queued on the previous stream may still read the workspace; order the new stream
+    // after it so the next call can safely reuse the storage
+    hipblasStatus_t on_stream_change(hipStream_t old_stream, hipStream_t new_stream);
+
+    ~hipblas_handle();
+
+private:
+    hipEvent_t workspace_event = nullptr;
+};
+
+/* ============================================================================================ */
+/*! \brief Bytes per element of a hipblasDatatype_t, or 0 for values outside the enum */
+inline size_t hipblas_datatype_size(hipblasDatatype_t type)
+{
+    switch(type)
+    {
+    case HIPBLAS_R_8I:
+    case HIPBLAS_R_8U:
+    case HIPBLAS_R_8F_E4M3:
+    case HIPBLAS_R_8F_E5M2:
+        return 1;
+    case HIPBLAS_R_16F:
+    case HIPBLAS_R_16B:
+    case HIPBLAS_C_8I:
+    case HIPBLAS_C_8U:
+        return 2;
+    case HIPBLAS_R_32F:
+    case HIPBLAS_R_32I:
+    case HIPBLAS_R_32U:
+    case HIPBLAS_C_16F:
+    case HIPBLAS_C_16B:
+        return 4;
+    case HIPBLAS_R_64F:
+    case HIPBLAS_C_32F:
+    case HIPBLAS_C_32I:
+    case HIPBLAS_C_32U:
+        return 8;
+    case HIPBLAS_C_64F:
+        return 16;
+    }
+    return 0;
+}
+
+/* ============================================================================================ */
+/*! \brief The per-batch scalar stride the batched gemm, gemv and axpy functions honour: the
+ *  handle's stride in device pointer mode, otherwise 0 */
+inline int64_t hipblas_scalar_stride(hipblasHandle_t handle)
+{
+    const hipblas_handle* h = static_cast<const hipblas_handle*>(handle);
+    return h && h->pointer_mode == HIPBLAS_POINTER_MODE_DEVICE ? h->scalar_stride : 0;
+}
+
+/* ============================================================================================ */
+/*! \brief Runs reduce(result), the backend call of a reduction with a host result in host
+ *  pointer mode. In HIPBLAS_RESULT_MODE_ASYNC it is run on a slot of the handle's async results
+ *  in device pointer mode instead, so it returns before the result is ready. */
+template <typename T, typename F>
+hipblasStatus_t hipblas_reduce_result(hipblasHandle_t handle, T* result, F reduce)
+{
+    hipblas_handle* h = static_cast<hipblas_handle*>(handle);
+    if(!h || !result || h->result_mode != HIPBLAS_RESULT_MODE_ASYNC
+       || h->pointer_mode != HIPBLAS_POINTER_MODE_HOST
+       || h->capture_mode == HIPBLAS_CAPTURE_MODE_SAFE)
+        return reduce(result);
+
+    hipStream_t     stream;
+    void*           slot;
+    hipblasStatus_t status = hipblasGetStream(handle, &stream);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = h->async_results.reserve(result, sizeof(T), slot);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_DEVICE);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+    {
+        status                = reduce(static_cast<T*>(slot));
+        hipblasStatus_t reset = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST);
+        status                = status != HIPBLAS_STATUS_SUCCESS ? status : reset;
+    }
+    if(status != HIPBLAS_STATUS_SUCCESS)
+    {
+        h->async_results.cancel();
+        return status;
+    }
+    return h->async_results.queued(stream);
+}
+
+/* ============================================================================================ */
+/*! \brief Whether the batches of a strided operand, used as op(X) with cols columns, are the
+ *  column blocks of one operand with cols * batch_count columns: side by side for X itself, or
+ *  stacked row blocks when X is transposed. A strided batched call broadcasting a stride-0
+ *  operand over such batches is one unbatched call. */
+inline bool hipblas_batches_side_by_side(
+    bool transposed, int cols, int64_t ld, int64_t stride, int batch_count)
+{
+    int64_t total = int64_t(cols) * batch_count;
+    if(batch_count < 2 || total > std::numeric_limits<int>::max())
+        return false;
+    return transposed ? stride == cols && ld >= total : stride == ld * cols;
+}
+
+// C_b = op(A) op(B_b) for a shared A is one gemm with n * batch_count columns
+inline bool hipblas_gemm_shares_a(hipblasOperation_t transb,
+                                  int                n,
+                                  int64_t            bsa,
+                                  int64_t            ldb,
+                                  int64_t            bsb,
+                                  int64_t            ldc,
+                                  int64_t            bsc,
+                                  int                batch_count)
+{
+    return bsa == 0
+           && hipblas_batches_side_by_side(transb != HIPBLAS_OP_N, n, ldb, bsb, batch_count)
+           && hipblas_batches_side_by_side(false, n, ldc, bsc, batch_count);
+}
+
+// C_b = op(A_b) op(B) for a shared B is one gemm with m * batch_count rows
+inline bool hipblas_gemm_shares_b(hipblasOperation_t transa,
+                                  int                m,
+                                  int64_t            lda,
+                                  int64_t            bsa,
+                                  int64_t            bsb,
+                                  int64_t            ldc,
+                                  int64_t            bsc,
+                                  int                batch_count)
+{
+    return bsb == 0
+           && hipblas_batches_side_by_side(transa == HIPBLAS_OP_N, m, lda, bsa, batch_count)
+           && hipblas_batches_side_by_side(true, m, ldc, bsc, batch_count);
+}
+
+// A trsm with a shared triangular A is one trsm with n * batch_count columns on the left side
+// and m * batch_count rows on the right
+inline bool hipblas_trsm_shares_a(hipblasSideMode_t side,
+                                  int               m,
+                                  int               n,
+                                  int64_t           strideA,
+                                  int64_t           ldb,
+                                  int64_t           strideB,
+                                  int               batch_count)
+{
+    return strideA == 0
+           && (side == HIPBLAS_SIDE_LEFT
+                   ? hipblas_batches_side_by_side(false, n, ldb, strideB, batch_count)
+                   : hipblas_batches_side_by_side(true, m, ldb, strideB, batch_count));
+}
+
+/* ============================================================================================ */
+/*! \brief The tuned choice for a gemm_ex problem, or null. Only a call that leaves algo at
+ *  HIPBLAS_GEMM_DEFAULT is tuned; an explicit algo always wins. */
+inline const hipblas_gemm_tuned* hipblas_gemm_tuned_for(hipblasHandle_t    handle,
+                                                        hipblasGemmAlgo_t  algo,
+                                                        hipblasOperation_t transa,
+                                                        hipblasOperation_t transb,
+                                                        int                m,
+                                                        int                n,
+                                                        int                k,
+                                                        hipblasDatatype_t  a_type,
+                                                        hipblasDatatype_t  b_type,
+                                                        hipblasDatatype_t  c_type,
+                                                        hipblasDatatype_t  compute_type)
+{
+    const hipblas_handle* h = static_cast<const hipblas_handle*>(handle);
+    if(h == nullptr || !h->gemm_tuning || algo != HIPBLAS_GEMM_DEFAULT)
+        return nullptr;
+    return h->gemm_tuning->find(transa, transb, m, n, k, a_type, b_type, c_type, compute_type);
+}
+
+/* ============================================================================================ */
+namespace hipblas_workspace_detail
+{
+    constexpr size_t ALIGN = 256;
+
+    inline size_t align_up(size_t bytes)
+    {
+        return (bytes + ALIGN - 1) / ALIGN * ALIGN;
+    }
+
+    inline size_t carve_bytes()
+    {
+        return 0;
+    }
+
+    template <typename T, typename... Rest>
+    size_t carve_bytes(T*& ptr, size_t count, Rest&&... rest)
+    {
+        return align_up(count * sizeof(T)) + carve_bytes(rest...);
+    }
+
+    inline void carve_assign(char*) {}
+
+    template <typename T, typename... Rest>
+    void carve_assign(char* base, T*& ptr, size_t count, Rest&&... rest)
+    {
+        ptr = count ? reinterpret_cast<T*>(base) : nullptr;
+        carve_assign(base + align_up(count * sizeof(T)), rest...);
+    }
+}
+
+/*! \brief Carve typed, aligned sub-buffers out of a single workspace reservation:
+ *
+ *      float* tau;
+ *      int*   piv;
+ *      status = hipblas_workspace_carve(handle, tau, n_tau, piv, n_piv);
+ *
+ *  The buffers stay valid until the next wrapper call on the same handle. In capture-safe mode
+ *  the workspace never grows, and a request larger than it fails with HIPBLAS_STATUS_ALLOC_FAILED. */
+template <typename... Args>
+hipblasStatus_t hipblas_workspace_carve(hipblasHandle_t handle, Args&&... args)
+{
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    hipblas_handle* h     = static_cast<hipblas_handle*>(handle);
+    size_t          bytes = hipblas_workspace_detail::carve_bytes(args...);
+
+    hipblasStatus_t status
+        = h->workspace.reserve(bytes, h->capture_mode != HIPBLAS_CAPTURE_MODE_SAFE);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        hipblas_workspace_detail::carve_assign(static_cast<char*>(h->workspace.data()), args...);
+    return status;
+}
+
+/* ============================================================================================ */
+/*! \brief Runs the gemms a gemm route is built from on the classic path, so they neither route
+ *  again nor carve the workspace out from under the caller:
+ *
+ *      hipblas_classic_gemm_guard classic(handle, device_scalars);
+ *      status = classic.status();
+ *      if(status == HIPBLAS_STATUS_SUCCESS)
+ *          status = hipblasGemmEx(handle, ...);
+ *
+ *  Every routing setting is turned off for the guard's lifetime; with host_scalars the handle
+ *  also takes host scalars, and with device_arrays device pointer arrays. The destructor puts all
+ *  of it back. */
+class hipblas_classic_gemm_guard
+{
+public:
+    hipblas_classic_gemm_guard(hipblasHandle_t handle,
+                               bool            host_scalars  = false,
+                               bool            device_arrays = false);
+
+    hipblas_classic_gemm_guard(const hipblas_classic_gemm_guard&) = delete;
+    hipblas_classic_gemm_guard& operator=(const hipblas_classic_gemm_guard&) = delete;
+
+    ~hipblas_classic_gemm_guard();
+
+    // Whether the handle took the classic settings; when not, it is as it was
+    hipblasStatus_t status() const
+    {
+        return result;
+    }
+
+private:
+    hipblas_handle*           h;
+    hipblas_gemm_routing      saved;
+    hipblasPointerMode_t      pointer_mode;
+    hipblasPointerArrayMode_t array_mode;
+    hipblasStatus_t           result = HIPBLAS_STATUS_SUCCESS;
+};
+
+/* ============================================================================================ */
+/*! \brief Uploads the host pointer arrays of one batched call, replacing each with its device copy.
+ *  Inactive, at the cost of a branch, unless the handle is in HIPBLAS_POINTER_ARRAY_HOST mode;
+ *  the destructor releases the slot once the call has queued its work. Null arrays are left for
+ *  the backend to reject. */
+class hipblas_pointer_array_upload
+{
+public:
+    hipblas_pointer_array_upload(hipblasHandle_t handle, int batch_count)
+        : h(static_cast<hipblas_handle*>(handle))
+        , batch_count(batch_count)
+    {
+    }
+
+    hipblas_pointer_array_upload(const hipblas_pointer_array_upload&) = delete;
+    hipblas_pointer_array_upload& operator=(const hipblas_pointer_array_upload&) = delete;
+
+    ~hipblas_pointer_array_upload()
+    {
+        if(s)
+            h->pointer_arrays.release(s, stream);
+    }
+
+    bool active() const
+    {
+        return h && batch_count > 0 && h->pointer_array_mode == HIPBLAS_POINTER_ARRAY_HOST;
+    }
+
+    template <typename... Ts>
+    hipblasStatus_t stage(Ts*&... arrays)
+    {
+        if(h->capture_mode == HIPBLAS_CAPTURE_MODE_SAFE)
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+        size_t          bytes  = sizeof...(Ts) * batch_count * sizeof(void*);
+        hipblasStatus_t status = hipblasGetStream(h, &stream);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = h->pointer_arrays.acquire(bytes, s);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        int index = 0;
+        (void)std::initializer_list<int>{(assign(arrays, index++), 0)...};
+
+        if(hipMemcpyAsync(s->device, s->host, bytes, hipMemcpyHostToDevice, stream) != hipSuccess)
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+private:
+    template <typename T>
+    void assign(T*& array, int index)
+    {
+        if(array == nullptr)
+            return;
+        const void** host   = static_cast<const void**>(s->host) + size_t(index) * batch_count;
+        void**       device = static_cast<void**>(s->device) + size_t(index) * batch_count;
+        std::memcpy(host, array, batch_count * sizeof(void*));
+        array = static_cast<T*>(static_cast<void*>(device));
+    }
+
+    hipblas_handle*                   h;
+    int                               batch_count;
+    hipStream_t                       stream = nullptr;
+    hipblas_pointer_array_ring::slot* s      = nullptr;
+};
+
+// Follows HIPBLAS_LOG_CALL in every *Batched function; the arguments are the pointer arrays
+#define HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, ...)                       \
+    hipblas_pointer_array_upload hipblas_upload_(handle, batch_count);               \
+    if(hipblas_upload_.active())                                                     \
+    {                                                                                \
+        hipblasStatus_t hipblas_upload_status_ = hipblas_upload_.stage(__VA_ARGS__); \
+        if(hipblas_upload_status_ != HIPBLAS_STATUS_SUCCESS)                         \
+            return hipblas_upload_status_;                                           \
+    }                                                                                \
+    (void)0
+
+#endif
@@ -0,0 +1,51 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+//! Gemm and axpy on host operands, under HIPBLAS_HOST_DISPATCH_ON: when every matrix or vector
+//! argument is pinned or mapped host memory and the scalars are on the host, the call runs
+//! wherever a cost model of the device says it finishes first. The model is calibrated once per
+//! device, by timing small copies to and from it and a small gemm on the host; the host runs the
+//! reference loops after the handle's stream has drained, and the device gets compact copies of
+//! the operands in the workspace and returns the result before the call does. Either way the
+//! call is complete on return. Each function returns false, having done nothing, when the call
+//! is not such a call or is one the backend should take for its quick returns and error codes;
+//! otherwise it runs it, sets status and records the route in the trace.
+#ifndef HIPBLAS_HOST_DISPATCH_H
+#define HIPBLAS_HOST_DISPATCH_H
+#pragma once
+#include "hipblas.h"
+
+template <typename T>
+bool hipblas_host_gemm(const char*        caller,
+                       hipblasHandle_t    handle,
+                       hipblasOperation_t transa,
+                       hipblasOperation_t transb,
+                       int                m,
+                       int                n,
+                       int                k,
+                       const T*           alpha,
+                       const T*           A,
+                       int                lda,
+                       const T*           B,
+                       int                ldb,
+                       const T*           beta,
+                       T*                 C,
+                       int                ldc,
+                       hipblasStatus_t&   status);
+
+template <typename T>
+bool hipblas_host_axpy(const char*      caller,
+                       hipblasHandle_t  handle,
+                       int              n,
+                       const T*         alpha,
+                       const T*         x,
+                       int              incx,
+                       T*               y,
+                       int              incy,
+                       hipblasStatus_t& status);
+
+// Calibrates the handle's device, if not yet done, so the first call does not pay for it
+void hipblas_host_dispatch_calibrate(hipblasHandle_t handle);
+
+#endif
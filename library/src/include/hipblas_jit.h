@@ -0,0 +1,38 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+//! The run-time compiled gemms behind hipblasGemmPlanCreateJit. The source of a kernel is
+//! generated from the problem, with its shape, transposes and leading dimensions as constants and
+//! a tiling picked for its aspect ratio, and compiled with hipRTC, or NVRTC through it on CUDA.
+//! Kernels are cached by device and source for the process, and their code objects on disk by
+//! architecture and source, so each is compiled once per machine. Built without HIPBLAS_WITH_RTC,
+//! hipblas_jit_gemm_kernel returns HIPBLAS_STATUS_NOT_SUPPORTED.
+#ifndef HIPBLAS_JIT_H
+#define HIPBLAS_JIT_H
+#pragma once
+#include "hipblas.h"
+
+struct hipblas_jit_kernel;
+
+// The kernel for the problem on the handle's device, which lives as long as the process; the
+// problem and the epilogue's types are checked by the caller
+hipblasStatus_t hipblas_jit_gemm_kernel(hipblasHandle_t            handle,
+                                        const hipblasGemmShape_t&  shape,
+                                        int                        lda,
+                                        int                        ldb,
+                                        int                        ldc,
+                                        const char*                epilogue_code,
+                                        const hipblas_jit_kernel** kernel);
+
+// C = epilogue(alpha op(A) op(B) + beta C) on the handle's stream, the scalars read in its pointer
+// mode
+hipblasStatus_t hipblas_jit_gemm_launch(hipblasHandle_t           handle,
+                                        const hipblas_jit_kernel& kernel,
+                                        const void*               alpha,
+                                        const void*               A,
+                                        const void*               B,
+                                        const void*               beta,
+                                        void*                     C);
+
+#endif
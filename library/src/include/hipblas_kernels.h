@@ -0,0 +1,1476 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+//! Launchers for the small number of device kernels hipBLAS implements itself.
+//! They are compiled by hipcc into the hipblas_kernels library and shared by the
+//! hcc_detail and nvcc_detail backends. Every launcher is stream-ordered: it
+//! enqueues work on the given stream and never synchronizes with the host.
+#ifndef HIPBLAS_KERNELS_H
+#define HIPBLAS_KERNELS_H
+#pragma once
+#include "hipblas.h"
+#include <hip/hip_runtime_api.h>
+#include <stdint.h>
+
+// scatter_strided_to_batched: dst[b][i] = src[b * stride + i] for i < n, b < batch_count
+template <typename T>
+hipError_t hipblas_scatter_strided_to_batched(
+    hipStream_t stream, int n, const T* src, int64_t stride, T* const dst[], int batch_count);
+
+// gather_batched_to_strided: dst[b * stride + i] = src[b][i * inc] for i < n, b < batch_count; a
+// negative inc walks src[b] back from element (n - 1) * -inc, as BLAS stores such a vector
+template <typename T>
+hipError_t hipblas_gather_batched_to_strided(hipStream_t    stream,
+                                             int            n,
+                                             const T* const src[],
+                                             int64_t        inc,
+                                             T*             dst,
+                                             int64_t        stride,
+                                             int            batch_count);
+
+// strided_pointer_array: array[b] = base + b * stride for b < batch_count, where array is in
+// device memory
+template <typename T>
+hipError_t hipblas_strided_pointer_array(
+    hipStream_t stream, T* base, int64_t stride, T** array, int batch_count);
+
+// copy_matrix_batched: dst[b][i + j * ldd] = src[b][i + j * lds] for i < m, j < n, b < batch_count
+template <typename T>
+hipError_t hipblas_copy_matrix_batched(hipStream_t    stream,
+                                       int            m,
+                                       int            n,
+                                       const T* const src[],
+                                       int64_t        lds,
+                                       T* const       dst[],
+                                       int64_t        ldd,
+                                       int            batch_count);
+
+// set_identity_strided_batched: the n x n matrix at A + b * stride is I for b < batch_count
+template <typename T>
+hipError_t hipblas_set_identity_strided_batched(
+    hipStream_t stream, int n, T* A, int64_t lda, int64_t stride, int batch_count);
+
+// set_identity_batched: the n x n matrix at A[b] is I for b < batch_count
+template <typename T>
+hipError_t hipblas_set_identity_batched(
+    hipStream_t stream, int n, T* const A[], int64_t lda, int batch_count);
+
+// gemm3m_split_strided_batched: for the m x n complex matrix at A + b * stride_a, stored as
+// interleaved real pairs, write its real part, imaginary part and their sum as contiguous m x n
+// real matrices at re, im and sum + b * m * n. conj negates the imaginary part
+template <typename T>
+hipError_t hipblas_gemm3m_split_strided_batched(hipStream_t stream,
+                                                int         m,
+                                                int         n,
+                                                const T*    A,
+                                                int64_t     lda,
+                                                int64_t     stride_a,
+                                                bool        conj,
+                                                T*          re,
+                                                T*          im,
+                                                T*          sum,
+                                                int         batch_count);
+
+// gemm3m_combine_strided_batched: C = alpha * ((P1 - P2) + i (P3 - P1 - P2)) + beta * C for the
+// contiguous m x n real products P1, P2 and P3, with P1 == nullptr meaning a zero product. alpha
+// and beta each point to a (real, imaginary) pair, in device memory when device_scalars is set
+template <typename T>
+hipError_t hipblas_gemm3m_combine_strided_batched(hipStream_t stream,
+                                                  int         m,
+                                                  int         n,
+                                                  const T*    P1,
+                                                  const T*    P2,
+                                                  const T*    P3,
+                                                  const T*    alpha,
+                                                  const T*    beta,
+                                                  bool        device_scalars,
+                                                  T*          C,
+                                                  int64_t     ldc,
+                                                  int64_t     stride_c,
+                                                  int         batch_count);
+
+// gemm3m_sum_planar_strided_batched: the split's sum alone, for the m x n complex matrix held as
+// the separate real and imaginary planes A_re and A_im + b * stride_a
+template <typename T>
+hipError_t hipblas_gemm3m_sum_planar_strided_batched(hipStream_t stream,
+                                                     int         m,
+                                                     int         n,
+                                                     const T*    A_re,
+                                                     const T*    A_im,
+                                                     int64_t     lda,
+                                                     int64_t     stride_a,
+                                                     bool        conj,
+                                                     T*          sum,
+                                                     int         batch_count);
+
+// gemm3m_combine_planar_strided_batched: gemm3m_combine_strided_batched for a C held as separate
+// real and imaginary planes
+template <typename T>
+hipError_t hipblas_gemm3m_combine_planar_strided_batched(hipStream_t stream,
+                                                         int         m,
+                                                         int         n,
+                                                         const T*    P1,
+                                                         const T*    P2,
+                                                         const T*    P3,
+                                                         const T*    alpha,
+                                                         const T*    beta,
+                                                         bool        device_scalars,
+                                                         T*          C_re,
+                                                         T*          C_im,
+                                                         int64_t     ldc,
+                                                         int64_t     stride_c,
+                                                         int         batch_count);
+
+// gemm_epilogue: with P = C + bias for the m x n matrix C and the m-vector bias (nullptr for none),
+// aux = P when aux is set and C = scale * activation(P)
+template <typename T>
+hipError_t hipblas_gemm_epilogue(hipStream_t         stream,
+                                 int                 m,
+                                 int                 n,
+                                 T*                  C,
+                                 int64_t             ldc,
+                                 const T*            bias,
+                                 hipblasActivation_t activation,
+                                 double              scale,
+                                 T*                  aux,
+                                 int64_t             ldaux);
+
+// scaled_to_float: Y[i + j * rows] = scale * X[i + j * ldx] for the rows x cols matrix X of type,
+// which is R_8F_E4M3, R_8F_E5M2, R_16F, R_16B or R_32F; scale is a device float, nullptr for 1
+hipError_t hipblas_scaled_to_float(hipStream_t       stream,
+                                   hipblasDatatype_t type,
+                                   int               rows,
+                                   int               cols,
+                                   const void*       X,
+                                   int64_t           ldx,
+                                   const float*      scale,
+                                   float*            Y);
+
+// scaled_from_float: D[i + j * ldd] = scale * P[i + j * m] for the contiguous m x n matrix P,
+// rounded to nearest even in type and saturating for the fp8 types. amax, when set, is a device
+// float set to the largest |P|; the types and scale are those of hipblas_scaled_to_float
+hipError_t hipblas_scaled_from_float(hipStream_t       stream,
+                                     int               m,
+                                     int               n,
+                                     const float*      P,
+                                     void*             D,
+                                     hipblasDatatype_t type,
+                                     int64_t           ldd,
+                                     const float*      scale,
+                                     float*            amax);
+
+// split_bf16x3: for x = op(X)(i, j) of the rows x cols matrix op(X), with op a transpose when
+// trans is set, hi = bf16(x) and lo = bf16(x - hi) are written to Y[e], Y[e + block] and
+// Y[e + 2 * block] for e = i + j * ldy; as hi, lo, hi when lo_second is set, else as hi, hi, lo
+hipError_t hipblas_split_bf16x3(hipStream_t      stream,
+                                bool             trans,
+                                int              rows,
+                                int              cols,
+                                const float*     X,
+                                int64_t          ldx,
+                                hipblasBfloat16* Y,
+                                int64_t          ldy,
+                                int64_t          block,
+                                bool             lo_second);
+
+// int8_split: for each of the count vectors x, element p at X[v * stride_v + p * stride_p] for
+// p < k, exponents[v] = e with max |x| < 2^e, and slice s of x(p) * 2^-e is written to
+// Y[p + v * ldy + s * slice_stride], the slices weighing 2^-7, 2^-14 and so on
+hipError_t hipblas_int8_split(hipStream_t   stream,
+                              int           count,
+                              int           k,
+                              const double* X,
+                              int64_t       stride_v,
+                              int64_t       stride_p,
+                              int           slices,
+                              int8_t*       Y,
+                              int64_t       ldy,
+                              int64_t       slice_stride,
+                              int*          exponents);
+
+// int8_accumulate: acc = 2^shift * P, or acc += 2^shift * P unless first, for the m x n int32
+// matrix P and the contiguous fp64 matrix acc
+hipError_t hipblas_int8_accumulate(hipStream_t    stream,
+                                   int            m,
+                                   int            n,
+                                   const int32_t* P,
+                                   int64_t        ldp,
+                                   int            shift,
+                                   bool           first,
+                                   double*        acc);
+
+// int8_finish: C(i, j) = alpha * 2^(exponents_a[i] + exponents_b[j]) * acc(i, j) + beta * C(i, j),
+// C unread when beta is 0; alpha and beta are in device memory when device_scalars is set
+hipError_t hipblas_int8_finish(hipStream_t   stream,
+                               int           m,
+                               int           n,
+                               const double* acc,
+                               const int*    exponents_a,
+                               const int*    exponents_b,
+                               const double* alpha,
+                               const double* beta,
+                               bool          device_scalars,
+                               double*       C,
+                               int64_t       ldc);
+
+// split_k_reduce: C(i, j) = alpha * sum of W(i, j) over the parts + beta * C(i, j), for the m x n
+// parts of a split-k gemm contiguous at W + p * stride_w; C unread when beta is 0. alpha and beta
+// are in device memory when device_scalars is set
+template <typename T>
+hipError_t hipblas_split_k_reduce(hipStream_t stream,
+                                  int         m,
+                                  int         n,
+                                  int         parts,
+                                  const T*    W,
+                                  int64_t     stride_w,
+                                  const T*    alpha,
+                                  const T*    beta,
+                                  bool        device_scalars,
+                                  T*          C,
+                                  int64_t     ldc);
+
+// Matrix operands of the batched level-2 kernels, which back the cuBLAS backend's batched and
+// strided batched level-2 routines. Band and packed matrices keep their BLAS storage: a band holds
+// kl sub- and ku super-diagonals with A(i, j) at A[ku + i - j + j * lda], so a symmetric, Hermitian
+// or triangular band has kl = 0 when it stores the upper triangle and ku = 0 for the lower
+enum hipblas_matrix_shape
+{
+    HIPBLAS_MATRIX_GENERAL,
+    HIPBLAS_MATRIX_SYMMETRIC,
+    HIPBLAS_MATRIX_HERMITIAN,
+    HIPBLAS_MATRIX_TRIANGULAR
+};
+
+enum hipblas_matrix_storage
+{
+    HIPBLAS_STORAGE_FULL,
+    HIPBLAS_STORAGE_BAND,
+    HIPBLAS_STORAGE_PACKED
+};
+
+struct hipblas_matrix_desc
+{
+    hipblas_matrix_shape   shape;
+    hipblas_matrix_storage storage;
+    hipblasOperation_t     trans;
+    hipblasFillMode_t      uplo;
+    hipblasDiagType_t      diag;
+    int                    m; // rows and columns of A itself, before trans
+    int                    n;
+    int                    kl;
+    int                    ku;
+    int64_t                lda;
+};
+
+// One batched operand: batch b is at ptr + b * stride, or at array[b] when array is set
+template <typename T>
+struct hipblas_batched_operand
+{
+    T*        ptr;
+    int64_t   stride;
+    T* const* array;
+};
+
+// trttp_batched: copy the uplo triangle of each batch's n x n matrix A to packed storage AP, the
+// triangle's columns stored one after another as tpmv and spmv read them
+template <typename T>
+hipError_t hipblas_trttp_batched(hipStream_t                      stream,
+                                 hipblasFillMode_t                uplo,
+                                 int                              n,
+                                 hipblas_batched_operand<const T> A,
+                                 int64_t                          lda,
+                                 hipblas_batched_operand<T>       AP,
+                                 int                              batch_count);
+
+// tpttr_batched: the inverse of trttp_batched; the other triangle of A is left as it was
+template <typename T>
+hipError_t hipblas_tpttr_batched(hipStream_t                      stream,
+                                 hipblasFillMode_t                uplo,
+                                 int                              n,
+                                 hipblas_batched_operand<const T> AP,
+                                 hipblas_batched_operand<T>       A,
+                                 int64_t                          lda,
+                                 int                              batch_count);
+
+// ge2gb_batched: AB(ku + i - j, j) = A(i, j) inside the kl, ku band of each batch's m x n matrix,
+// as gbmv reads it; the corners of AB that fall outside A are left as they were
+template <typename T>
+hipError_t hipblas_ge2gb_batched(hipStream_t                      stream,
+                                 int                              m,
+                                 int                              n,
+                                 int                              kl,
+                                 int                              ku,
+                                 hipblas_batched_operand<const T> A,
+                                 int64_t                          lda,
+                                 hipblas_batched_operand<T>       AB,
+                                 int64_t                          ldab,
+                                 int                              batch_count);
+
+// gb2ge_batched: the inverse of ge2gb_batched, with A zero outside the band
+template <typename T>
+hipError_t hipblas_gb2ge_batched(hipStream_t                      stream,
+                                 int                              m,
+                                 int                              n,
+                                 int                              kl,
+                                 int                              ku,
+                                 hipblas_batched_operand<const T> AB,
+                                 int64_t                          ldab,
+                                 hipblas_batched_operand<T>       A,
+                                 int64_t                          lda,
+                                 int                              batch_count);
+
+// matvec_batched: y = alpha * op(A) * x + beta * y for each batch, where y is never read when beta
+// is zero. alpha and beta are in device memory when device_scalars is set, with batch b's at
+// alpha + b * scalar_stride and beta + b * scalar_stride
+template <typename T>
+hipError_t hipblas_matvec_batched(hipStream_t                      stream,
+                                  const hipblas_matrix_desc&       desc,
+                                  const T*                         alpha,
+                                  const T*                         beta,
+                                  bool                             device_scalars,
+                                  int64_t                          scalar_stride,
+                                  hipblas_batched_operand<const T> A,
+                                  hipblas_batched_operand<const T> x,
+                                  int64_t                          incx,
+                                  hipblas_batched_operand<T>       y,
+                                  int64_t                          incy,
+                                  int                              batch_count);
+
+// triangular_batched: x = op(A) * x, or x = inv(op(A)) * x when solve is set, for the
+// triangular n x n matrix A of each batch. One block sweeps the rows of one batch in order
+template <typename T>
+hipError_t hipblas_triangular_batched(hipStream_t                      stream,
+                                      const hipblas_matrix_desc&       desc,
+                                      bool                             solve,
+                                      hipblas_batched_operand<const T> A,
+                                      hipblas_batched_operand<T>       x,
+                                      int64_t                          incx,
+                                      int                              batch_count);
+
+// rank_update_batched: for each batch, with y.ptr and y.array null meaning x alone,
+//   general:   A += alpha * x * y^T, or x * y^H when conj_y is set
+//   symmetric: A += alpha * x * x^T, or alpha * (x * y^T + y * x^T)
+//   Hermitian: A += alpha * x * x^H, or alpha * x * y^H + conj(alpha) * y * x^H
+// updating only the uplo triangle of a symmetric or Hermitian A, full or packed. alpha points to a
+// real scalar when real_alpha is set, and is in device memory when device_scalars is set
+template <typename T>
+hipError_t hipblas_rank_update_batched(hipStream_t                      stream,
+                                       const hipblas_matrix_desc&       desc,
+                                       const void*                      alpha,
+                                       bool                             real_alpha,
+                                       bool                             device_scalars,
+                                       hipblas_batched_operand<const T> x,
+                                       int64_t                          incx,
+                                       hipblas_batched_operand<const T> y,
+                                       int64_t                          incy,
+                                       bool                             conj_y,
+                                       hipblas_batched_operand<T>       A,
+                                       int                              batch_count);
+
+// gemm_batched: C = alpha * op(A) * op(B) + beta * C for each batch, where C is never read when
+// beta is zero. alpha and beta are in device memory when device_scalars is set, with batch b's at
+// alpha + b * scalar_stride and beta + b * scalar_stride. A plain tiled kernel, used only where the
+// backend library has no per-batch scalars
+template <typename T>
+hipError_t hipblas_gemm_batched(hipStream_t                      stream,
+                                hipblasOperation_t               transa,
+                                hipblasOperation_t               transb,
+                                int                              m,
+                                int                              n,
+                                int                              k,
+                                const T*                         alpha,
+                                const T*                         beta,
+                                bool                             device_scalars,
+                                int64_t                          scalar_stride,
+                                hipblas_batched_operand<const T> A,
+                                int64_t                          lda,
+                                hipblas_batched_operand<const T> B,
+                                int64_t                          ldb,
+                                hipblas_batched_operand<T>       C,
+                                int64_t                          ldc,
+                                int                              batch_count);
+
+// gemm_mixed_batched: gemm_batched with a real A or B, TA or TB being the real type of the complex
+// T, read and multiplied at its own size
+template <typename TA, typename TB, typename T>
+hipError_t hipblas_gemm_mixed_batched(hipStream_t                       stream,
+                                      hipblasOperation_t                transa,
+                                      hipblasOperation_t                transb,
+                                      int                               m,
+                                      int                               n,
+                                      int                               k,
+                                      const T*                          alpha,
+                                      const T*                          beta,
+                                      bool                              device_scalars,
+                                      int64_t                           scalar_stride,
+                                      hipblas_batched_operand<const TA> A,
+                                      int64_t                           lda,
+                                      hipblas_batched_operand<const TB> B,
+                                      int64_t                           ldb,
+                                      hipblas_batched_operand<T>        C,
+                                      int64_t                           ldc,
+                                      int                               batch_count);
+
+// gemm_batch_reduce: C = alpha * (sum over the batches of op(A_b) * op(B_b)) + beta * C for one C,
+// written once; C is never read when beta is zero, and beta * C is all that is left when k or
+// batch_count is zero. alpha and beta are in device memory when device_scalars is set
+template <typename T>
+hipError_t hipblas_gemm_batch_reduce(hipStream_t                      stream,
+                                     hipblasOperation_t               transa,
+                                     hipblasOperation_t               transb,
+                                     int                              m,
+                                     int                              n,
+                                     int                              k,
+                                     const T*                         alpha,
+                                     const T*                         beta,
+                                     bool                             device_scalars,
+                                     hipblas_batched_operand<const T> A,
+                                     int64_t                          lda,
+                                     hipblas_batched_operand<const T> B,
+                                     int64_t                          ldb,
+                                     T*                               C,
+                                     int64_t                          ldc,
+                                     int                              batch_count);
+
+// trmm_batched: B = alpha * op(A) * B, or alpha * B * op(A) on the right side, in place for each
+// batch's m x n B and triangular A. alpha is in device memory when device_scalars is set, with
+// batch b's at alpha + b * scalar_stride. Backs the cuBLAS backend's batched trmm
+template <typename T>
+hipError_t hipblas_trmm_batched(hipStream_t                      stream,
+                                hipblasSideMode_t                side,
+                                hipblasFillMode_t                uplo,
+                                hipblasOperation_t               trans,
+                                hipblasDiagType_t                diag,
+                                int                              m,
+                                int                              n,
+                                const T*                         alpha,
+                                bool                             device_scalars,
+                                int64_t                          scalar_stride,
+                                hipblas_batched_operand<const T> A,
+                                int64_t                          lda,
+                                hipblas_batched_operand<T>       B,
+                                int64_t                          ldb,
+                                int                              batch_count);
+
+// Largest m, n and k of gemm_tiny_strided_batched
+constexpr int HIPBLAS_GEMM_TINY_MAX = 16;
+
+// gemm_tiny_strided_batched: gemm_batched for strided batches with m, n and k all at most
+// HIPBLAS_GEMM_TINY_MAX, by kernels specialized on the operations, T and a size bucket of 2, 4, 8
+// or 16 that the tiles are padded to. Up to 4 each thread computes one matrix; above that a group
+// of threads shares one, with op(A) in shared memory and a column of op(B) and C per thread
+template <typename T>
+hipError_t hipblas_gemm_tiny_strided_batched(hipStream_t        stream,
+                                             hipblasOperation_t transa,
+                                             hipblasOperation_t transb,
+                                             int                m,
+                                             int                n,
+                                             int                k,
+                                             const T*           alpha,
+                                             const T*           beta,
+                                             bool               device_scalars,
+                                             int64_t            scalar_stride,
+                                             const T*           A,
+                                             int64_t            lda,
+                                             int64_t            stride_a,
+                                             const T*           B,
+                                             int64_t            ldb,
+                                             int64_t            stride_b,
+                                             T*                 C,
+                                             int64_t            ldc,
+                                             int64_t            stride_c,
+                                             int                batch_count);
+
+// gemm_quantized: C = alpha * op(A) * B + beta * C for each batch, with B dequantized as quant
+// describes while its tiles are loaded and the products summed in float; C unread when beta is 0.
+// alpha and beta are floats, in device memory when device_scalars is set. Batch b's scales and
+// zeros are stride_scales elements on from the previous batch's. The types are the ones
+// hipblasGemmQuantizedEx takes, checked by the caller
+hipError_t hipblas_gemm_quantized(hipStream_t                        stream,
+                                  hipblasOperation_t                 transa,
+                                  int                                m,
+                                  int                                n,
+                                  int                                k,
+                                  const float*                       alpha,
+                                  const float*                       beta,
+                                  bool                               device_scalars,
+                                  const void*                        A,
+                                  hipblasDatatype_t                  a_type,
+                                  int64_t                            lda,
+                                  int64_t                            stride_a,
+                                  const void*                        B,
+                                  int64_t                            ldb,
+                                  int64_t                            stride_b,
+                                  const hipblasWeightQuantization_t& quant,
+                                  int64_t                            stride_scales,
+                                  void*                              C,
+                                  hipblasDatatype_t                  c_type,
+                                  int64_t                            ldc,
+                                  int64_t                            stride_c,
+                                  int                                batch_count);
+
+// gemm_requant: C = op(A) * op(B) in int8, the int32 sum requantized as requant describes before
+// the one store; requant's scale is set and its mode valid, as the caller checks
+hipError_t hipblas_gemm_requant(hipStream_t                    stream,
+                                hipblasOperation_t             transa,
+                                hipblasOperation_t             transb,
+                                int                            m,
+                                int                            n,
+                                int                            k,
+                                const int8_t*                  A,
+                                int64_t                        lda,
+                                const int8_t*                  B,
+                                int64_t                        ldb,
+                                int8_t*                        C,
+                                int64_t                        ldc,
+                                const hipblasRequantization_t& requant);
+
+// sparse24_compress: the 2:4 selection of hipblasSparsePrune24 on op(A), m x k with k a multiple
+// of 4, writing the pruned matrix to P when it is set and the compressed one when compressed is
+// set. type is R_16F, R_16B or R_32F
+hipError_t hipblas_sparse24_compress(hipStream_t                    stream,
+                                     hipblasOperation_t             trans,
+                                     int                            m,
+                                     int                            k,
+                                     const void*                    A,
+                                     hipblasDatatype_t              type,
+                                     int64_t                        lda,
+                                     void*                          P,
+                                     int64_t                        ldp,
+                                     const hipblasSparse24Matrix_t* compressed);
+
+// sparse24_gemm: C = alpha * A * op(B) + beta * C for the compressed 2:4 sparse A, summed in
+// float; C unread when beta is 0. A and B are of a_type, C of c_type, as hipblasSparseGemm24Ex
+// takes them. alpha and beta are floats, in device memory when device_scalars is set
+hipError_t hipblas_sparse24_gemm(hipStream_t                    stream,
+                                 hipblasOperation_t             transb,
+                                 int                            m,
+                                 int                            n,
+                                 int                            k,
+                                 const float*                   alpha,
+                                 const float*                   beta,
+                                 bool                           device_scalars,
+                                 const hipblasSparse24Matrix_t& A,
+                                 hipblasDatatype_t              a_type,
+                                 const void*                    B,
+                                 int64_t                        ldb,
+                                 void*                          C,
+                                 hipblasDatatype_t              c_type,
+                                 int64_t                        ldc);
+
+// One job of hipblas_job_list, as hipblasJob_t describes it with the scalars in T. Its tiles are
+// first_tile to the next job's first_tile
+template <typename T>
+struct hipblas_job_desc
+{
+    hipblasJobType_t   type;
+    hipblasOperation_t transa;
+    hipblasOperation_t transb;
+    int                m;
+    int                n;
+    int                k;
+    T                  alpha;
+    T                  beta;
+    const T*           A;
+    int64_t            lda;
+    const T*           B;
+    int64_t            ldb;
+    T*                 C;
+    int64_t            ldc;
+    int64_t            first_tile;
+};
+
+// Elements of y an axpy or gemv tile covers, and rows and columns of a gemm tile
+constexpr int HIPBLAS_JOB_AXPY_TILE = 1024;
+constexpr int HIPBLAS_JOB_GEMV_TILE = 16;
+constexpr int HIPBLAS_JOB_GEMM_TILE = 16;
+
+// job_list: run the job_count jobs of the device array jobs, tiles in all, with one launch. The
+// blocks of a persistent grid take tiles in turn and find each one's job by binary search
+template <typename T>
+hipError_t hipblas_job_list(hipStream_t                stream,
+                            const hipblas_job_desc<T>* jobs,
+                            int                        job_count,
+                            int64_t                    tiles);
+
+// Level-1 kernels behind the cuBLAS backend's batched and strided batched level-1 routines. A
+// negative increment walks a vector from its far end, as in BLAS; scal, nrm2, asum and iamax do
+// nothing for a non-positive one. Scalars are in device memory when device_scalars is set. axpy
+// and dot also take hipblasHalf, and dot hipblasBfloat16, accumulating in float
+
+// axpy_batched: y = alpha * x + y for each batch, with batch b's alpha at alpha + b * scalar_stride
+// when device_scalars is set
+template <typename T>
+hipError_t hipblas_axpy_batched(hipStream_t                      stream,
+                                int                              n,
+                                const T*                         alpha,
+                                bool                             device_scalars,
+                                int64_t                          scalar_stride,
+                                hipblas_batched_operand<const T> x,
+                                int64_t                          incx,
+                                hipblas_batched_operand<T>       y,
+                                int64_t                          incy,
+                                int                              batch_count);
+
+// scal_batched: x = alpha * x for each batch, where alpha points to a real scalar when real_alpha
+// is set
+template <typename T>
+hipError_t hipblas_scal_batched(hipStream_t                stream,
+                                int                        n,
+                                const void*                alpha,
+                                bool                       real_alpha,
+                                bool                       device_scalars,
+                                hipblas_batched_operand<T> x,
+                                int64_t                    incx,
+                                int                        batch_count);
+
+// copy_batched: y = x for each batch
+template <typename T>
+hipError_t hipblas_copy_batched(hipStream_t                      stream,
+                                int                              n,
+                                hipblas_batched_operand<const T> x,
+                                int64_t                          incx,
+                                hipblas_batched_operand<T>       y,
+                                int64_t                          incy,
+                                int                              batch_count);
+
+// conj_copy_batched: y = conj(x) for each batch, a plain copy for real types; y may be x
+template <typename T>
+hipError_t hipblas_conj_copy_batched(hipStream_t                      stream,
+                                     int                              n,
+                                     hipblas_batched_operand<const T> x,
+                                     int64_t                          incx,
+                                     hipblas_batched_operand<T>       y,
+                                     int64_t                          incy,
+                                     int                              batch_count);
+
+// swap_batched: exchange x and y for each batch
+template <typename T>
+hipError_t hipblas_swap_batched(hipStream_t                stream,
+                                int                        n,
+                                hipblas_batched_operand<T> x,
+                                int64_t                    incx,
+                                hipblas_batched_operand<T> y,
+                                int64_t                    incy,
+                                int                        batch_count);
+
+// rot_batched: (x, y) = (c * x + s * y, c * y - conj(s) * x) for each batch. c points to a real
+// scalar, and s does too when real_s is set
+template <typename T>
+hipError_t hipblas_rot_batched(hipStream_t                stream,
+                               int                        n,
+                               hipblas_batched_operand<T> x,
+                               int64_t                    incx,
+                               hipblas_batched_operand<T> y,
+                               int64_t                    incy,
+                               const void*                c,
+                               const void*                s,
+                               bool                       real_s,
+                               bool                       device_scalars,
+                               int                        batch_count);
+
+// lasr_batched: apply each batch's sequence of real plane rotations c, s to the rows of its m x n
+// A for side left, or to its columns for side right, as hipblasXlasr describes. One thread sweeps
+// each column or row, the rotations staged through shared memory
+template <typename T, typename R>
+hipError_t hipblas_lasr_batched(hipStream_t                      stream,
+                                hipblasSideMode_t                side,
+                                hipblasPivot_t                   pivot,
+                                hipblasDirect_t                  direct,
+                                int                              m,
+                                int                              n,
+                                hipblas_batched_operand<const R> c,
+                                hipblas_batched_operand<const R> s,
+                                hipblas_batched_operand<T>       A,
+                                int64_t                          lda,
+                                int                              batch_count);
+
+// rotm_batched: apply the modified Givens rotation in each batch's 5-element device param to x, y
+template <typename T>
+hipError_t hipblas_rotm_batched(hipStream_t                      stream,
+                                int                              n,
+                                hipblas_batched_operand<T>       x,
+                                int64_t                          incx,
+                                hipblas_batched_operand<T>       y,
+                                int64_t                          incy,
+                                hipblas_batched_operand<const T> param,
+                                int                              batch_count);
+
+// dot_batched: result[b] = x^T * y, or x^H * y when conj is set, for the device array result.
+// One block reduces each batch
+template <typename T>
+hipError_t hipblas_dot_batched(hipStream_t                      stream,
+                               int                              n,
+                               hipblas_batched_operand<const T> x,
+                               int64_t                          incx,
+                               hipblas_batched_operand<const T> y,
+                               int64_t                          incy,
+                               bool                             conj,
+                               T*                               result,
+                               int                              batch_count);
+
+// norm_batched: result[b] = ||x||_2 when nrm2 is set, otherwise the sum of |re(x_i)| + |im(x_i)|,
+// for the device array result of real type Tr
+template <typename T, typename Tr>
+hipError_t hipblas_norm_batched(hipStream_t                      stream,
+                                bool                             nrm2,
+                                int                              n,
+                                hipblas_batched_operand<const T> x,
+                                int64_t                          incx,
+                                Tr*                              result,
+                                int                              batch_count);
+
+// iamax_batched: result[b] = the 1-based index of the first element of x with the largest, or
+// when min is set the smallest, |re(x_i)| + |im(x_i)|; 0 for an empty x
+template <typename T>
+hipError_t hipblas_iamax_batched(hipStream_t                      stream,
+                                 bool                             min,
+                                 int                              n,
+                                 hipblas_batched_operand<const T> x,
+                                 int64_t                          incx,
+                                 int*                             result,
+                                 int                              batch_count);
+
+// iamax_chunks: result = the 1-based index in x of the element of largest, or when min is set
+// smallest, |re(x_i)| + |im(x_i)| among those part names, where part[c] is a 1-based index into
+// the c-th run of chunk elements of x, or 0 for none. Ties keep the earlier run; result is a
+// device int64_t
+template <typename T>
+hipError_t hipblas_iamax_chunks(hipStream_t stream,
+                                bool        min,
+                                const T*    x,
+                                int64_t     incx,
+                                int64_t     chunk,
+                                int         chunks,
+                                const int*  part,
+                                int64_t*    result);
+
+// rotg_batched: the Givens rotation of each batch's device scalars a and b, as in BLAS rotg;
+// c is real
+template <typename T, typename Tc>
+hipError_t hipblas_rotg_batched(hipStream_t                 stream,
+                                hipblas_batched_operand<T>  a,
+                                hipblas_batched_operand<T>  b,
+                                hipblas_batched_operand<Tc> c,
+                                hipblas_batched_operand<T>  s,
+                                int                         batch_count);
+
+// rotmg_batched: the modified Givens rotation of each batch's device scalars, as in BLAS rotmg
+template <typename T>
+hipError_t hipblas_rotmg_batched(hipStream_t                      stream,
+                                 hipblas_batched_operand<T>       d1,
+                                 hipblas_batched_operand<T>       d2,
+                                 hipblas_batched_operand<T>       x1,
+                                 hipblas_batched_operand<const T> y1,
+                                 hipblas_batched_operand<T>       param,
+                                 int                              batch_count);
+
+// Fused level-1 kernels behind the axpby, waxpby, mdot and axpyDot extensions, for float, double,
+// hipblasComplex and hipblasDoubleComplex. Batch b's alpha and beta are at b * scalar_stride when
+// device_scalars is set
+
+// axpby_batched: w = alpha * x + beta * y for each batch, and y is not read when beta is 0. w may
+// be y with the same increment
+template <typename T>
+hipError_t hipblas_axpby_batched(hipStream_t                      stream,
+                                 int                              n,
+                                 const T*                         alpha,
+                                 const T*                         beta,
+                                 bool                             device_scalars,
+                                 int64_t                          scalar_stride,
+                                 hipblas_batched_operand<const T> x,
+                                 int64_t                          incx,
+                                 hipblas_batched_operand<const T> y,
+                                 int64_t                          incy,
+                                 hipblas_batched_operand<T>       w,
+                                 int64_t                          incw,
+                                 int                              batch_count);
+
+// Blocks per batch the fused dots split a length n vector over; their work arrays hold that many
+// partial sums for each result
+int hipblas_fused_dot_blocks(int n);
+
+// mdot_batched: result[b * k + j] = x^T y_j, or x^H y_j when conj is set, for the k vectors y_j
+// at Y + j * ldy of each batch. Each block reads its part of x once for up to 8 of the vectors.
+// work holds hipblas_fused_dot_blocks(n) * k * batch_count elements
+template <typename T>
+hipError_t hipblas_mdot_batched(hipStream_t                      stream,
+                                int                              n,
+                                int                              k,
+                                hipblas_batched_operand<const T> x,
+                                int64_t                          incx,
+                                hipblas_batched_operand<const T> Y,
+                                int64_t                          ldy,
+                                int64_t                          incy,
+                                bool                             conj,
+                                T*                               result,
+                                T*                               work,
+                                int                              batch_count);
+
+// axpy_dot_batched: y = alpha * x + y, then result[b] = z^T y, or z^H y when conj is set, in the
+// same pass. z may be y with the same increment. work holds hipblas_fused_dot_blocks(n) *
+// batch_count elements
+template <typename T>
+hipError_t hipblas_axpy_dot_batched(hipStream_t                      stream,
+                                    int                              n,
+                                    const T*                         alpha,
+                                    bool                             device_scalars,
+                                    int64_t                          scalar_stride,
+                                    hipblas_batched_operand<const T> x,
+                                    int64_t                          incx,
+                                    hipblas_batched_operand<T>       y,
+                                    int64_t                          incy,
+                                    hipblas_batched_operand<const T> z,
+                                    int64_t                          incz,
+                                    bool                             conj,
+                                    T*                               result,
+                                    T*                               work,
+                                    int                              batch_count);
+
+// Largest n hipblas_gesv_batched takes
+constexpr int HIPBLAS_GESV_SMALL_N = 32;
+
+// gesv_batched: for each batch, LU-factor the n x n matrix A with partial pivoting in shared memory
+// and solve A X = B for the nrhs columns of B, overwriting A with the factors and B with X. The
+// 1-based pivots go to ipiv + b * strideP when ipiv is set. info[b] is 0, or i when U(i, i) is the
+// first exactly zero pivot, in which case B is left as it was
+template <typename T>
+hipError_t hipblas_gesv_batched(hipStream_t                stream,
+                                int                        n,
+                                int                        nrhs,
+                                hipblas_batched_operand<T> A,
+                                int64_t                    lda,
+                                int*                       ipiv,
+                                int64_t                    strideP,
+                                hipblas_batched_operand<T> B,
+                                int64_t                    ldb,
+                                int*                       info,
+                                int                        batch_count);
+
+// Largest n hipblas_syevj_batched takes
+constexpr int HIPBLAS_SYEVJ_SMALL_N = 32;
+
+// syevj_batched: for each batch, the eigenvalues of the n x n Hermitian matrix stored in the uplo
+// triangle of A, in ascending order at W + b * strideW, by parallel cyclic Jacobi sweeps in shared
+// memory. Sweeps stop once the off-diagonal Frobenius norm is at most abstol (or machine epsilon
+// when abstol <= 0) times that of A, or after max_sweeps; residual[b] is the final off-diagonal
+// norm, n_sweeps[b] the sweeps run and info[b] 1 when they did not converge. With vectors set the
+// matching eigenvectors overwrite A, otherwise A is left as it was
+template <typename T, typename R>
+hipError_t hipblas_syevj_batched(hipStream_t                stream,
+                                 bool                       vectors,
+                                 hipblasFillMode_t          uplo,
+                                 int                        n,
+                                 hipblas_batched_operand<T> A,
+                                 int64_t                    lda,
+                                 R                          abstol,
+                                 R*                         residual,
+                                 int                        max_sweeps,
+                                 int*                       n_sweeps,
+                                 R*                         W,
+                                 int64_t                    strideW,
+                                 int*                       info,
+                                 int                        batch_count);
+
+// gtsv_batched: for each batch, solve the m x m tridiagonal system with subdiagonal dl,
+// diagonal d and superdiagonal du by the Thomas algorithm, without pivoting, overwriting the
+// right-hand side x with the solution. Element i of batch b is at b * stride + i * inc in every
+// array, and dl(0) and du(m - 1) are not read. work holds (m - 1) * batch_count elements
+template <typename T>
+hipError_t hipblas_gtsv_batched(hipStream_t stream,
+                                int         m,
+                                const T*    dl,
+                                const T*    d,
+                                const T*    du,
+                                T*          x,
+                                int64_t     inc,
+                                int64_t     stride,
+                                T*          work,
+                                int         batch_count);
+
+// The states of iterative refinement, one per batch: 0 while refining, 1 once converged, and on
+// failure the negative ITER code of LAPACK's dsgesv for the reason
+constexpr int HIPBLAS_REFINE_OVERFLOW      = -2; // a value too large for the lower precision
+constexpr int HIPBLAS_REFINE_FACTOR_FAILED = -3; // a zero pivot in the lower-precision factors
+
+// convert_matrix_batched: dst = src, or dst += src when accumulate is set, for the m x n matrices
+// of each batch, converting Ts to Td. When state is given, only batches with state[b] == 0 are
+// converted, and a value out of Td's range sets state[b] to HIPBLAS_REFINE_OVERFLOW
+template <typename Ts, typename Td>
+hipError_t hipblas_convert_matrix_batched(hipStream_t                       stream,
+                                          int                               m,
+                                          int                               n,
+                                          hipblas_batched_operand<const Ts> src,
+                                          int64_t                           lds,
+                                          hipblas_batched_operand<Td>       dst,
+                                          int64_t                           ldd,
+                                          bool                              accumulate,
+                                          int*                              state,
+                                          int                               batch_count);
+
+// refine_threshold_batched: cte[b] = ||A||_inf * scale for each batch's n x n matrix
+template <typename T>
+hipError_t hipblas_refine_threshold_batched(hipStream_t                      stream,
+                                            int                              n,
+                                            hipblas_batched_operand<const T> A,
+                                            int64_t                          lda,
+                                            double                           scale,
+                                            double*                          cte,
+                                            int                              batch_count);
+
+// refine_check_batched: for each batch with state[b] == 0, sets state[b] to
+// HIPBLAS_REFINE_FACTOR_FAILED when factor_info is given and factor_info[b] > 0, or to 1 with
+// iter[b] = iteration when every column of the n x nrhs residual R has max |R(i, j)| <=
+// max |X(i, j)| * cte[b]. Then adds the batches still refining to counts[0] and the failed ones
+// to counts[1]
+template <typename T>
+hipError_t hipblas_refine_check_batched(hipStream_t                      stream,
+                                        int                              n,
+                                        int                              nrhs,
+                                        hipblas_batched_operand<const T> X,
+                                        int64_t                          ldx,
+                                        hipblas_batched_operand<const T> R,
+                                        int64_t                          ldr,
+                                        const double*                    cte,
+                                        const int*                       factor_info,
+                                        int                              iteration,
+                                        int*                             state,
+                                        int*                             iter,
+                                        int*                             counts,
+                                        int                              batch_count);
+
+// refine_fallback_batched: iter[b] = state[b] for failed batches, unconverged for batches still
+// refining and -1 for converged ones, once the whole batch falls back to the higher precision
+hipError_t hipblas_refine_fallback_batched(
+    hipStream_t stream, int unconverged, const int* state, int* iter, int batch_count);
+
+// syrk_block_copy: dst(i, j) = src(i, j) over the uplo triangle, or all of it for
+// HIPBLAS_FILL_MODE_FULL, of each batch's n x n block of elem_size-byte elements, the blocks
+// starting src_offset and dst_offset elements into their batches. zero_diagonal_imag clears the
+// imaginary parts of the diagonal, as herk leaves them
+hipError_t hipblas_syrk_block_copy(hipStream_t                         stream,
+                                   hipblasFillMode_t                   uplo,
+                                   int                                 n,
+                                   size_t                              elem_size,
+                                   hipblas_batched_operand<const void> src,
+                                   int64_t                             src_offset,
+                                   int64_t                             lds,
+                                   hipblas_batched_operand<void>       dst,
+                                   int64_t                             dst_offset,
+                                   int64_t                             ldd,
+                                   bool                                zero_diagonal_imag,
+                                   int                                 batch_count);
+
+// offset_pointer_array: array[b] = src[b] + offset bytes for b < batch_count, with both arrays in
+// device memory
+hipError_t hipblas_offset_pointer_array(hipStream_t        stream,
+                                        const void* const* src,
+                                        int64_t            offset,
+                                        const void**       array,
+                                        int                batch_count);
+
+// trsm_mixed_diagonal: B = alpha op(A)^-1 B when solve is set, and alpha op(A) B otherwise, or B
+// op(A)^-1 and B op(A) on the right side, for the nb x nb triangular block of A starting a_offset
+// elements into each batch and the nb rows, or columns, of B starting b_offset elements in, nrhs
+// of them, in place. A and B are HIPBLAS_R_16F, HIPBLAS_R_16B or HIPBLAS_R_32F, the arithmetic is
+// fp32, and nb is at most HIPBLAS_TRSM_MIXED_DIAGONAL
+#define HIPBLAS_TRSM_MIXED_DIAGONAL 32
+
+hipError_t hipblas_trsm_mixed_diagonal(hipStream_t                         stream,
+                                       bool                                solve,
+                                       hipblasSideMode_t                   side,
+                                       hipblasFillMode_t                   uplo,
+                                       hipblasOperation_t                  trans,
+                                       hipblasDiagType_t                   diag,
+                                       int                                 nb,
+                                       int                                 nrhs,
+                                       float                               alpha,
+                                       hipblas_batched_operand<const void> A,
+                                       int64_t                             a_offset,
+                                       int64_t                             lda,
+                                       hipblas_batched_operand<void>       B,
+                                       int64_t                             b_offset,
+                                       int64_t                             ldb,
+                                       hipblasDatatype_t                   type,
+                                       int                                 batch_count);
+
+// Rows of C each ABFT checksum sums over, and the columns of a tile a failed checksum marks
+constexpr int HIPBLAS_ABFT_TILE = 256;
+
+// abft_block_sums: for each batch, with the rows of the rows x cols matrix op(X), op a transpose
+// when trans is set, cut into blocks of block rows, the sum, the sum of magnitudes and the largest
+// magnitude of block i of column c, stored at b * stride + i + c * blocks of sums, abs_sums and
+// abs_maxes, any of which may be null. X and the results are of type, HIPBLAS_R_32F or
+// HIPBLAS_R_64F, summed in fp64; a NaN counts as the largest magnitude
+hipError_t hipblas_abft_block_sums(hipStream_t                         stream,
+                                   bool                                trans,
+                                   int                                 rows,
+                                   int                                 cols,
+                                   int                                 block,
+                                   hipblas_batched_operand<const void> X,
+                                   int64_t                             ldx,
+                                   hipblasDatatype_t                   type,
+                                   void*                               sums,
+                                   void*                               abs_sums,
+                                   void*                               abs_maxes,
+                                   int64_t                             stride,
+                                   int                                 batch_count);
+
+// abft_check: for each batch and each element (i, j) of the blocks x n checksums sums and
+// expected, with
+//   bound = |alpha| row_abs[i] col_max[j] + |beta| c_abs(i, j), the beta term dropped for beta 0,
+// sets flags[i + (j / HIPBLAS_ABFT_TILE) * blocks] to 1 where the bound is finite and
+// |sums(i, j) - expected(i, j)| exceeds tolerance * bound, and adds the flags it sets to *failed
+// unless failed is null. Each batch's checksums, row_abs and col_max are at b * stride, and its
+// flags at b * stride_flags; alpha and beta are in device memory when device_scalars is set
+hipError_t hipblas_abft_check(hipStream_t         stream,
+                              int                 blocks,
+                              int                 n,
+                              const void*         alpha,
+                              const void*         beta,
+                              bool                device_scalars,
+                              hipblasDatatype_t   type,
+                              const void*         sums,
+                              const void*         expected,
+                              const void*         c_abs,
+                              const void*         row_abs,
+                              const void*         col_max,
+                              int64_t             stride,
+                              double              tolerance,
+                              int*                flags,
+                              int64_t             stride_flags,
+                              unsigned long long* failed,
+                              int                 batch_count);
+
+// abft_copy: dst(i, j) = src(i, j) for each batch's m x n matrices of type, HIPBLAS_R_32F or
+// HIPBLAS_R_64F
+hipError_t hipblas_abft_copy(hipStream_t                         stream,
+                             int                                 m,
+                             int                                 n,
+                             hipblas_batched_operand<const void> src,
+                             int64_t                             lds,
+                             hipblas_batched_operand<void>       dst,
+                             int64_t                             ldd,
+                             hipblasDatatype_t                   type,
+                             int                                 batch_count);
+
+// The compact layout of the Compact functions: element (i, j) of batch b at
+// (i + j * ld) * batch_count + b, so the matrices of consecutive batches interleave element by
+// element and one thread per matrix reads and writes contiguously
+
+// compact_pack: copy the m x n matrices of each batch from src, strided with batch b at b * stride,
+// to the compact dst, or from the compact src to the strided dst when unpack is set
+template <typename T>
+hipError_t hipblas_compact_pack(hipStream_t stream,
+                                bool        unpack,
+                                int         m,
+                                int         n,
+                                const T*    src,
+                                int64_t     lds,
+                                T*          dst,
+                                int64_t     ldd,
+                                int64_t     stride,
+                                int         batch_count);
+
+// gemm_compact: C = alpha * op(A) * op(B) + beta * C for each batch of compact A, B and C, where C
+// is never read when beta is zero. alpha and beta are in device memory when device_scalars is set
+template <typename T>
+hipError_t hipblas_gemm_compact(hipStream_t        stream,
+                                hipblasOperation_t transa,
+                                hipblasOperation_t transb,
+                                int                m,
+                                int                n,
+                                int                k,
+                                const T*           alpha,
+                                const T*           beta,
+                                bool               device_scalars,
+                                const T*           A,
+                                int64_t            lda,
+                                const T*           B,
+                                int64_t            ldb,
+                                T*                 C,
+                                int64_t            ldc,
+                                int                batch_count);
+
+// trsm_compact: B = alpha * inv(op(A)) * B, or alpha * B * inv(op(A)) on the right side, for each
+// batch of compact triangular A and m x n B. alpha is in device memory when device_scalars is set
+template <typename T>
+hipError_t hipblas_trsm_compact(hipStream_t        stream,
+                                hipblasSideMode_t  side,
+                                hipblasFillMode_t  uplo,
+                                hipblasOperation_t trans,
+                                hipblasDiagType_t  diag,
+                                int                m,
+                                int                n,
+                                const T*           alpha,
+                                bool               device_scalars,
+                                const T*           A,
+                                int64_t            lda,
+                                T*                 B,
+                                int64_t            ldb,
+                                int                batch_count);
+
+// getrf_compact: A = P * L * U with partial pivoting for each batch of compact n x n A, as getrf.
+// ipiv is compact with ld 1, pivot j of batch b at j * batch_count + b, and info holds one value
+// per batch
+template <typename T>
+hipError_t hipblas_getrf_compact(
+    hipStream_t stream, int n, T* A, int64_t lda, int* ipiv, int* info, int batch_count);
+
+// getrs_compact: B = inv(op(A)) * B for each batch of compact B and the factors and pivots of
+// getrf_compact
+template <typename T>
+hipError_t hipblas_getrs_compact(hipStream_t        stream,
+                                 hipblasOperation_t trans,
+                                 int                n,
+                                 int                nrhs,
+                                 const T*           A,
+                                 int64_t            lda,
+                                 const int*         ipiv,
+                                 T*                 B,
+                                 int64_t            ldb,
+                                 int                batch_count);
+
+// gemv_vbatched: y[b] = alpha * op(A[b]) * x[b] + beta * y[b] for each batch, of m[b] x n[b] A[b]
+// and increments incx[b] and incy[b], where y is never read when beta is zero. The size arrays and
+// pointer arrays are in device memory, and so is the batch_count + 1 entry workspace first_tile;
+// entries with nothing to do or sizes BLAS would reject are skipped. A one-block scan counts the
+// row tiles of the batch into first_tile, and a persistent grid takes them in turn as job_list
+// does. alpha and beta are in device memory when device_scalars is set, with batch b's at
+// alpha + b * scalar_stride and beta + b * scalar_stride
+template <typename T>
+hipError_t hipblas_gemv_vbatched(hipStream_t        stream,
+                                 hipblasOperation_t trans,
+                                 const int*         m,
+                                 const int*         n,
+                                 const T*           alpha,
+                                 const T*           beta,
+                                 bool               device_scalars,
+                                 int64_t            scalar_stride,
+                                 const T* const*    A,
+                                 const int*         lda,
+                                 const T* const*    x,
+                                 const int*         incx,
+                                 T* const*          y,
+                                 const int*         incy,
+                                 int                batch_count,
+                                 int64_t*           first_tile);
+
+// trsv_vbatched: x[b] = inv(op(A[b])) * x[b] for the triangular n[b] x n[b] A[b] of each batch,
+// with the arrays in device memory as in gemv_vbatched. The blocks of a persistent grid take the
+// next batch from the device counter next_entry, zeroed first, whenever they finish one
+template <typename T>
+hipError_t hipblas_trsv_vbatched(hipStream_t        stream,
+                                 hipblasFillMode_t  uplo,
+                                 hipblasOperation_t trans,
+                                 hipblasDiagType_t  diag,
+                                 const int*         n,
+                                 const T* const*    A,
+                                 const int*         lda,
+                                 T* const*          x,
+                                 const int*         incx,
+                                 int                batch_count,
+                                 int*               next_entry);
+
+// getrf_vbatched: LAPACK's getf2 for the n[b] x n[b] A[b] of each batch, with 1-based pivots in
+// the device pointer array ipiv and info[b] the first zero pivot, as in getrfBatched. order and
+// next_entry are device workspace of batch_count and 1 entries: a one-block counting sort lists
+// the batch largest first, and the blocks of a persistent grid take whole entries from that list
+// as they come free, so no block is left with a long entry once the others are done
+template <typename T>
+hipError_t hipblas_getrf_vbatched(hipStream_t stream,
+                                  const int*  n,
+                                  T* const*   A,
+                                  const int*  lda,
+                                  int* const* ipiv,
+                                  int*        info,
+                                  int         batch_count,
+                                  int*        order,
+                                  int*        next_entry);
+
+// getrs_vbatched: op(A[b]) X = B[b] for the nrhs[b] columns of each batch from getrf_vbatched's
+// factors, scheduled as getrf_vbatched is
+template <typename T>
+hipError_t hipblas_getrs_vbatched(hipStream_t        stream,
+                                  hipblasOperation_t trans,
+                                  const int*         n,
+                                  const int*         nrhs,
+                                  const T* const*    A,
+                                  const int*         lda,
+                                  const int* const*  ipiv,
+                                  T* const*          B,
+                                  const int*         ldb,
+                                  int                batch_count,
+                                  int*               order,
+                                  int*               next_entry);
+
+// trsm_vbatched: B[b] = alpha * inv(op(A[b])) * B[b], or alpha * B[b] * inv(op(A[b])) on the
+// right, for each m[b] x n[b] B[b], with alpha as in gemv_vbatched and scheduled as
+// getrf_vbatched is
+template <typename T>
+hipError_t hipblas_trsm_vbatched(hipStream_t        stream,
+                                 hipblasSideMode_t  side,
+                                 hipblasFillMode_t  uplo,
+                                 hipblasOperation_t trans,
+                                 hipblasDiagType_t  diag,
+                                 const int*         m,
+                                 const int*         n,
+                                 const T*           alpha,
+                                 bool               device_scalars,
+                                 int64_t            scalar_stride,
+                                 const T* const*    A,
+                                 const int*         lda,
+                                 T* const*          B,
+                                 const int*         ldb,
+                                 int                batch_count,
+                                 int*               order,
+                                 int*               next_entry);
+
+// Elements of the Tr workspace part that hipblas_nrm2_vbatched needs for batch_count entries
+int64_t hipblas_nrm2_vbatched_work_size(int batch_count);
+
+// nrm2_vbatched: norms[b] = ||x[b]||_2 for the n[b] elements of each batch at increment incx[b],
+// and *result the 2-norm of the whole batch together, with everything in device memory; norms
+// may be null, and an entry with n[b] <= 0 or incx[b] <= 0 has norm 0 as in BLAS. A one-block
+// scan splits the batch into chunks of one entry each, at most the work size of them, listing
+// them in the batch_count + 2 entry workspace first_chunk; a persistent grid leaves each chunk's
+// norm in part, and the last of its blocks to finish, counted in the device int done, combines
+// them. Two launches, however many entries and however uneven their lengths
+template <typename T, typename Tr>
+hipError_t hipblas_nrm2_vbatched(hipStream_t     stream,
+                                 const int*      n,
+                                 const T* const* x,
+                                 const int*      incx,
+                                 int             batch_count,
+                                 Tr*             norms,
+                                 Tr*             result,
+                                 int64_t*        first_chunk,
+                                 Tr*             part,
+                                 int*            done);
+
+// amax_quantize_batched: for each batch's m x n matrix A of type R_16F, R_16B or R_32F, amax[b],
+// or amax[b * m + i] per row, is set to the largest |A(i, j)|, NaNs skipped, and when Q is set
+// Q(i, j) = scale * A(i, j) in q_type, R_8F_E4M3, R_8F_E5M2 or R_8I, rounded to nearest even and
+// saturating. scale is indexed as amax, nullptr meaning 1; both are device floats
+hipError_t hipblas_amax_quantize_batched(hipStream_t                         stream,
+                                         bool                                per_row,
+                                         int                                 m,
+                                         int                                 n,
+                                         hipblas_batched_operand<const void> A,
+                                         hipblasDatatype_t                   a_type,
+                                         int64_t                             lda,
+                                         const float*                        scale,
+                                         hipblas_batched_operand<void>       Q,
+                                         hipblasDatatype_t                   q_type,
+                                         int64_t                             ldq,
+                                         float*                              amax,
+                                         int                                 batch_count);
+
+// Real elements hipblas_lange_batched needs in work for each batch: m for the inf norm, else n
+int64_t hipblas_lange_work_size(hipblasNormType_t norm, int m, int n);
+
+// lange_batched: result[b] = the norm of each batch's m x n matrix A, as LAPACK's lange, with the
+// modulus of complex elements. A reduction over each column, or a thread per row for the inf
+// norm, fills work before one block per batch reduces it; an empty matrix has norm 0
+template <typename T, typename R>
+hipError_t hipblas_lange_batched(hipStream_t                      stream,
+                                 hipblasNormType_t                norm,
+                                 int                              m,
+                                 int                              n,
+                                 hipblas_batched_operand<const T> A,
+                                 int64_t                          lda,
+                                 R*                               result,
+                                 R*                               work,
+                                 int                              batch_count);
+
+// copy_ex_batched: y = x for each batch's length n vectors, each of its own type, converted
+// through the execution type T. Element i is at i * inc from the start, or from the far end for a
+// negative inc, and strides count elements of the vector's type. Types are R_16F, R_16B, R_32F and
+// R_64F for a real T, and C_32F and C_64F for a complex T. With flush_denorms, for
+// HIPBLAS_FLUSH_DENORM_MATH, values subnormal in the type read or written are taken as zero
+template <typename T>
+hipError_t hipblas_copy_ex_batched(hipStream_t                         stream,
+                                   int                                 n,
+                                   hipblas_batched_operand<const void> x,
+                                   hipblasDatatype_t                   x_type,
+                                   int64_t                             incx,
+                                   hipblas_batched_operand<void>       y,
+                                   hipblasDatatype_t                   y_type,
+                                   int64_t                             incy,
+                                   int                                 batch_count,
+                                   bool                                flush_denorms);
+
+// geam_ex_batched: C = alpha op(A) + beta op(B) for each batch's m x n matrix C, with the types of
+// hipblas_copy_ex_batched and the same conversions and flushing. A is not read when alpha is 0,
+// nor B when beta is 0. The scalars are device arrays with scalar_stride when device_scalars is set
+template <typename T>
+hipError_t hipblas_geam_ex_batched(hipStream_t                         stream,
+                                   hipblasOperation_t                  transA,
+                                   hipblasOperation_t                  transB,
+                                   int                                 m,
+                                   int                                 n,
+                                   const T*                            alpha,
+                                   const T*                            beta,
+                                   bool                                device_scalars,
+                                   int64_t                             scalar_stride,
+                                   hipblas_batched_operand<const void> A,
+                                   hipblasDatatype_t                   a_type,
+                                   int64_t                             lda,
+                                   hipblas_batched_operand<const void> B,
+                                   hipblasDatatype_t                   b_type,
+                                   int64_t                             ldb,
+                                   hipblas_batched_operand<void>       C,
+                                   hipblasDatatype_t                   c_type,
+                                   int64_t                             ldc,
+                                   int                                 batch_count,
+                                   bool                                flush_denorms);
+
+// lacpy_ex_batched: B(i, j) = A(i, j) over the uplo triangle, or all of it for
+// HIPBLAS_FILL_MODE_FULL, of each batch's m x n matrix, with the types of hipblas_copy_ex_batched
+// and the same conversions and flushing
+template <typename T>
+hipError_t hipblas_lacpy_ex_batched(hipStream_t                         stream,
+                                    hipblasFillMode_t                   uplo,
+                                    int                                 m,
+                                    int                                 n,
+                                    hipblas_batched_operand<const void> A,
+                                    hipblasDatatype_t                   a_type,
+                                    int64_t                             lda,
+                                    hipblas_batched_operand<void>       B,
+                                    hipblasDatatype_t                   b_type,
+                                    int64_t                             ldb,
+                                    int                                 batch_count,
+                                    bool                                flush_denorms);
+
+// axpby_vbatched_ex: y[b] = alpha * x[b] + beta * y[b] for the n[b] elements of each batch, the
+// vectors of the types of hipblas_copy_ex_batched, flushed as there, and computed in T, and the
+// size and pointer arrays in device memory. Without x when it is null, y is only scaled; y is not
+// read when beta is 0, and an alpha of 1 takes x unscaled. alpha_dev and beta_dev, when not null,
+// replace alpha and beta with batch b's at b * scalar_stride. One launch over the whole batch: the
+// entries are laid end to end and dealt out element by element, so uneven lengths do not
+// unbalance the grid
+template <typename T>
+hipError_t hipblas_axpby_vbatched_ex(hipStream_t        stream,
+                                     const int*         n,
+                                     T                  alpha,
+                                     const T*           alpha_dev,
+                                     T                  beta,
+                                     const T*           beta_dev,
+                                     int64_t            scalar_stride,
+                                     const void* const* x,
+                                     hipblasDatatype_t  x_type,
+                                     const int*         incx,
+                                     void* const*       y,
+                                     hipblasDatatype_t  y_type,
+                                     const int*         incy,
+                                     int                batch_count,
+                                     bool               flush_denorms);
+
+// lacpy_batched: B(i, j) = A(i, j) over the uplo triangle, or all of it for
+// HIPBLAS_FILL_MODE_FULL, of each batch's m x n matrix of elem_size-byte elements, in one launch.
+// Columns move 16 bytes per thread for batches whose pointers and leading dimensions keep that
+// alignment, element by element otherwise
+hipError_t hipblas_lacpy_batched(hipStream_t                         stream,
+                                 hipblasFillMode_t                   uplo,
+                                 int                                 m,
+                                 int                                 n,
+                                 size_t                              elem_size,
+                                 hipblas_batched_operand<const void> A,
+                                 int64_t                             lda,
+                                 hipblas_batched_operand<void>       B,
+                                 int64_t                             ldb,
+                                 int                                 batch_count);
+
+// symmetrize_batched: A(j, i) = A(i, j) for each batch's n x n matrix, from its uplo triangle to
+// the other, conjugated when conjugate is set, which also clears the imaginary parts of the
+// diagonal as hermitize requires
+template <typename T>
+hipError_t hipblas_symmetrize_batched(hipStream_t                stream,
+                                      hipblasFillMode_t          uplo,
+                                      int                        n,
+                                      hipblas_batched_operand<T> A,
+                                      int64_t                    lda,
+                                      bool                       conjugate,
+                                      int                        batch_count);
+
+// transpose_batched: A = A^T in place for each batch's n x n matrix, or A = A^H when conjugate is
+// set, through shared memory with no workspace
+template <typename T>
+hipError_t hipblas_transpose_batched(hipStream_t                stream,
+                                     int                        n,
+                                     hipblas_batched_operand<T> A,
+                                     int64_t                    lda,
+                                     bool                       conjugate,
+                                     int                        batch_count);
+
+// info_reduce: result[0] = the number of nonzero info[b] for b < batch_count, and result[1] = the
+// first such b, or -1 when there is none. One block; result is any memory the device can write
+hipError_t hipblas_info_reduce(hipStream_t stream, int batch_count, const int* info, int* result);
+
+// Largest min(m, n) hipblas_gesvdj_batched takes
+constexpr int HIPBLAS_GESVDJ_SMALL_N = 64;
+
+// gesvdj_batched: for each batch, the singular values of the m x n matrix A in descending order at
+// S + b * strideS, by one-sided Jacobi sweeps that overwrite A. Sweeps stop once the off-diagonal
+// Frobenius norm of A^H A is at most abstol (or machine epsilon when abstol <= 0) times the squared
+// norm of A, or after max_sweeps, with residual, n_sweeps and info as in syevj_batched. With left
+// set the first min(m, n) left singular vectors are the columns of U, and with right set the
+// matching rows of V hold V^H; vectors of zero singular values are left zero
+template <typename T, typename R>
+hipError_t hipblas_gesvdj_batched(hipStream_t                stream,
+                                  bool                       left,
+                                  bool                       right,
+                                  int                        m,
+                                  int                        n,
+                                  hipblas_batched_operand<T> A,
+                                  int64_t                    lda,
+                                  R                          abstol,
+                                  R*                         residual,
+                                  int                        max_sweeps,
+                                  int*                       n_sweeps,
+                                  R*                         S,
+                                  int64_t                    strideS,
+                                  T*                         U,
+                                  int64_t                    ldu,
+                                  int64_t                    strideU,
+                                  T*                         V,
+                                  int64_t                    ldv,
+                                  int64_t                    strideV,
+                                  int*                       info,
+                                  int                        batch_count);
+
+// Largest n hipblas_sytrf_batched factors in shared memory; larger matrices are factored in place
+constexpr int HIPBLAS_SYTRF_SMALL_N = 32;
+
+// sytrf_batched: for each batch, the Bunch-Kaufman factorization A = U D U^T or L D L^T of the
+// n x n symmetric matrix in the uplo triangle of A, as LAPACK's sytf2 computes it, over that
+// triangle. The pivots go to ipiv + b * strideP in LAPACK's form, 1-based and negative for 2 x 2
+// blocks, and info[b] is 0 or the first zero pivot, after which the factorization carries on
+template <typename T>
+hipError_t hipblas_sytrf_batched(hipStream_t                stream,
+                                 hipblasFillMode_t          uplo,
+                                 int                        n,
+                                 hipblas_batched_operand<T> A,
+                                 int64_t                    lda,
+                                 int*                       ipiv,
+                                 int64_t                    strideP,
+                                 int*                       info,
+                                 int                        batch_count);
+
+// sytrs_batched: for each batch, solve A X = B for the nrhs columns of B from the factors and
+// pivots of sytrf_batched, overwriting B with X, one block per system in global memory
+template <typename T>
+hipError_t hipblas_sytrs_batched(hipStream_t                stream,
+                                 hipblasFillMode_t          uplo,
+                                 int                        n,
+                                 int                        nrhs,
+                                 hipblas_batched_operand<T> A,
+                                 int64_t                    lda,
+                                 const int*                 ipiv,
+                                 int64_t                    strideP,
+                                 hipblas_batched_operand<T> B,
+                                 int64_t                    ldb,
+                                 int                        batch_count);
+
+#endif
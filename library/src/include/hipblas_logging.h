@@ -0,0 +1,254 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+//! Call logging for every exported hipBLAS function, selected by the HIPBLAS_LAYER bits:
+//!   1 trace:   one line per call with the function and its arguments
+//!   2 bench:   a hipblas-bench command line for calls hipblas-bench can replay
+//!   4 profile: call counts and cumulative times per function and argument shape, written at exit
+//!   8 ranges:  a roctx (NVTX on CUDA) range around each call named after the function and shape;
+//!              only in builds configured with BUILD_WITH_ROCTX
+//!  16 record:  a binary trace of every call, its buffer sizes and cross-stream dependencies for
+//!              hipblas-replay, written to HIPBLAS_LOG_RECORD_PATH; HIPBLAS_LOG_RECORD_DATA=1
+//!              adds the device memory each call reads
+//!  32 advisor: a warning, with the faster API, for call patterns known to be slow: misaligned
+//!              operands, power-of-two leading dimensions, batched calls of one batch, stride 0
+//!              broadcasts, blocking host-mode reductions and repeated unplanned GemmEx problems;
+//!              rate-limited, with a count per pattern and function at exit
+//! Lines go to stderr, or to the files named by HIPBLAS_LOG_TRACE_PATH, HIPBLAS_LOG_BENCH_PATH,
+//! HIPBLAS_LOG_PROFILE_PATH and HIPBLAS_LOG_ADVISOR_PATH. Profiling synchronizes the handle's
+//! stream around each call, except in HIPBLAS_CAPTURE_MODE_SAFE where it records host time only.
+//! Calls a hipBLAS function makes to other hipBLAS functions are not logged separately. The same
+//! guard feeds the per-handle counters of hipblasGetHandleStats and records of
+//! hipblasDrainTimings, and issues the prefetches of HIPBLAS_MANAGED_MEMORY_PREFETCH.
+#ifndef HIPBLAS_LOGGING_H
+#define HIPBLAS_LOGGING_H
+#pragma once
+#include "hipblas.h"
+#include "hipblas_handle.h"
+#include <chrono>
+#include <memory>
+#include <string>
+#include <type_traits>
+
+enum hipblas_layer_bits
+{
+    HIPBLAS_LAYER_TRACE   = 1,
+    HIPBLAS_LAYER_BENCH   = 2,
+    HIPBLAS_LAYER_PROFILE = 4,
+    HIPBLAS_LAYER_RANGES  = 8,
+    HIPBLAS_LAYER_RECORD  = 16,
+    HIPBLAS_LAYER_ADVISOR = 32
+};
+
+// HIPBLAS_LAYER, read once when the library loads
+extern const int hipblas_layer_mode;
+
+// One argument, kept unformatted so counting calls never builds strings
+struct hipblas_log_arg
+{
+    enum kind_t
+    {
+        INTEGER,
+        REAL,
+        POINTER,
+        NAME // an enum value with a short name, such as N for HIPBLAS_OP_N
+    } kind;
+
+    long long i; // also the value of a NAME
+
+    union
+    {
+        double      d;
+        const void* p;
+        const char* s;
+    };
+};
+
+hipblas_log_arg hipblas_log_format(hipblasOperation_t value);
+hipblas_log_arg hipblas_log_format(hipblasFillMode_t value);
+hipblas_log_arg hipblas_log_format(hipblasDiagType_t value);
+hipblas_log_arg hipblas_log_format(hipblasSideMode_t value);
+hipblas_log_arg hipblas_log_format(hipblasDatatype_t value);
+
+template <typename T, typename std::enable_if<std::is_integral<T>{}, int>::type = 0>
+hipblas_log_arg hipblas_log_format(T value)
+{
+    hipblas_log_arg arg;
+    arg.kind = hipblas_log_arg::INTEGER;
+    arg.i    = (long long)value;
+    return arg;
+}
+
+template <typename T, typename std::enable_if<std::is_floating_point<T>{}, int>::type = 0>
+hipblas_log_arg hipblas_log_format(T value)
+{
+    hipblas_log_arg arg;
+    arg.kind = hipblas_log_arg::REAL;
+    arg.d    = value;
+    return arg;
+}
+
+template <typename T, typename std::enable_if<std::is_enum<T>{}, int>::type = 0>
+hipblas_log_arg hipblas_log_format(T value)
+{
+    return hipblas_log_format(typename std::underlying_type<T>::type(value));
+}
+
+inline hipblas_log_arg hipblas_log_format(const void* value)
+{
+    hipblas_log_arg arg;
+    arg.kind = hipblas_log_arg::POINTER;
+    arg.p    = value;
+    return arg;
+}
+
+/* ============================================================================================ */
+/*! \brief What one exported function is, worked out from its name and parameter names the
+ *  first time it is logged: its family, precision and the arguments the estimates need. */
+struct hipblas_log_site
+{
+    hipblas_log_site(const char* function, const char* parameters);
+
+    const char*            function;
+    hipblasRoutineFamily_t family       = HIPBLAS_FAMILY_AUXILIARY;
+    int                    model        = 0; // how bytes and flops are estimated; 0 for none
+    size_t                 element_size = 0;
+    bool                   complex      = false;
+    char                   precision    = 0; // s, d, c, z or h; 0 for the untyped functions
+    std::string            base; // the name without hipblas, precision and batch suffix
+
+    // Argument positions, -1 when the function has no such parameter
+    int m = -1, n = -1, k = -1, batch_count = -1, trans = -1, data_type = -1, result = -1;
+
+    // Bit i set when argument i is alpha, beta or result, which are not prefetched
+    unsigned long long scalars = 0;
+
+    // Bit i set when argument i is a leading dimension, a batch stride, or a matrix or vector
+    unsigned long long leading_dims = 0, strides = 0, operands = 0;
+
+    // Batched functions taking arrays of pointers, and strided batched ones
+    bool pointer_arrays = false, strided = false;
+};
+
+/* ============================================================================================ */
+/*! \brief Logs one call. Constructed at the top of each exported function by HIPBLAS_LOG_CALL;
+ *  when HIPBLAS_LAYER is unset and the handle does not count calls it is never started and
+ *  costs a branch. */
+class hipblas_log_call
+{
+public:
+    explicit hipblas_log_call(hipblasHandle_t handle)
+        : handle(handle)
+    {
+    }
+
+    hipblas_log_call(const hipblas_log_call&) = delete;
+    hipblas_log_call& operator=(const hipblas_log_call&) = delete;
+
+    ~hipblas_log_call()
+    {
+        if(active)
+            stop();
+    }
+
+    bool enabled() const
+    {
+        const hipblas_handle* h = static_cast<const hipblas_handle*>(handle);
+        return hipblas_layer_mode
+               || (h
+                   && (h->stats_mode == HIPBLAS_STATS_MODE_ON
+                       || h->timing_mode == HIPBLAS_TIMING_MODE_ON
+                       || h->managed_memory_mode == HIPBLAS_MANAGED_MEMORY_PREFETCH));
+    }
+
+    template <typename... Ts>
+    void start(const hipblas_log_site& site, const Ts&... values)
+    {
+        const hipblas_log_arg args[] = {hipblas_log_format(values)...};
+        begin(site, args, int(sizeof...(Ts)));
+    }
+
+private:
+    void begin(const hipblas_log_site& site, const hipblas_log_arg* args, int count);
+    void stop();
+
+    hipblasHandle_t                       handle;
+    bool                                  active = false;
+    bool                                  synced = false;
+    hipStream_t                           stream = nullptr;
+    hipblasRoutineFamily_t                family = HIPBLAS_FAMILY_AUXILIARY;
+    std::shared_ptr<hipblas_handle_stats> stats;
+    std::shared_ptr<hipblas_call_timings> timings;
+    long long                             timing_ticket = -1;
+    unsigned long long                    bytes         = 0;
+    unsigned long long                    flops = 0;
+    std::string                           shape;
+    std::chrono::steady_clock::time_point t0;
+};
+
+// Advises and prefetches to the current device, on the handle's stream, the managed memory behind
+// the pointer arguments of a call that are not scalars
+void hipblas_prefetch_managed(hipblasHandle_t         handle,
+                              const hipblas_log_site& site,
+                              const hipblas_log_arg*  args,
+                              int                     count);
+
+// Appends the call to the HIPBLAS_LOG_RECORD_PATH trace; see call_record.cpp for its format
+void hipblas_record_call(hipblasHandle_t         handle,
+                         const hipblas_log_site& site,
+                         const hipblas_log_arg*  args,
+                         int                     count);
+
+// Counts the call's slow patterns and warns of them; see advisor.cpp
+void hipblas_advise_call(hipblasHandle_t         handle,
+                         const hipblas_log_site& site,
+                         const hipblas_log_arg*  args,
+                         int                     count);
+
+// Records in the trace that function runs as routine instead, as when a degenerate gemm is
+// rerouted; a no-op unless the trace layer is enabled
+void hipblas_log_route(const char* function, const char* routine);
+
+template <typename... Ts>
+inline hipblasHandle_t hipblas_log_handle(hipblasHandle_t handle, const Ts&...)
+{
+    return handle;
+}
+
+// In HIPBLAS_THREAD_MODE_PER_THREAD replaces the handle argument with the calling thread's copy,
+// or nullptr when it cannot be made, so the call reports HIPBLAS_STATUS_NOT_INITIALIZED
+template <typename... Ts>
+inline void hipblas_log_rebind(hipblasHandle_t& handle, const Ts&...)
+{
+    hipblas_handle* h = static_cast<hipblas_handle*>(handle);
+    if(h && h->thread_mode == HIPBLAS_THREAD_MODE_PER_THREAD)
+        handle = h->thread_handles.get(h);
+}
+
+// First statement of every exported function; the arguments are all of its parameters, starting
+// with the handle, or with whatever comes first for functions that take no handle
+#define HIPBLAS_LOG_CALL(...)            \
+    hipblas_log_rebind(__VA_ARGS__);     \
+    HIPBLAS_LOG_CALL_SHARED(__VA_ARGS__)
+
+// For the functions that act on a per-thread handle itself rather than the thread's copy
+#define HIPBLAS_LOG_CALL_SHARED(...)                                             \
+    hipblas_log_call hipblas_log_call_(hipblas_log_handle(__VA_ARGS__));         \
+    if(hipblas_log_call_.enabled())                                              \
+    {                                                                            \
+        static const hipblas_log_site hipblas_log_site_(__func__, #__VA_ARGS__); \
+        hipblas_log_call_.start(hipblas_log_site_, __VA_ARGS__);                 \
+    }                                                                            \
+    (void)0
+
+#define HIPBLAS_LOG_CALL_NO_HANDLE(...)                                          \
+    hipblas_log_call hipblas_log_call_(nullptr);                                 \
+    if(hipblas_log_call_.enabled())                                              \
+    {                                                                            \
+        static const hipblas_log_site hipblas_log_site_(__func__, #__VA_ARGS__); \
+        hipblas_log_call_.start(hipblas_log_site_, __VA_ARGS__);                 \
+    }                                                                            \
+    (void)0
+
+#endif
@@ -0,0 +1,175 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+//! rocSOLVER resolved on first use. With BUILD_SOLVER_LAZY the library is built against the
+//! rocSOLVER headers but not linked to it, so processes that never call a solver function do not
+//! load librocsolver or its code objects. Each rocsolver_* name used by the rocBLAS backend is
+//! redefined to an entry that looks the function up once per call site, in the library named by
+//! HIPBLAS_ROCSOLVER_PATH or else librocsolver.so.0, and that returns
+//! rocblas_status_not_implemented, so HIPBLAS_STATUS_NOT_SUPPORTED, when it cannot be found.
+#ifndef HIPBLAS_SOLVER_H
+#define HIPBLAS_SOLVER_H
+#pragma once
+#include "rocblas.h"
+#include "rocsolver.h"
+
+#ifdef __HIP_PLATFORM_SOLVER_LAZY__
+
+//! The address of a rocSOLVER function, or nullptr when the library or the function is missing;
+//! the library is opened by the first call, from any thread
+void* hipblas_solver_symbol(const char* name);
+
+template <typename F>
+struct hipblas_solver_entry;
+
+template <typename... A>
+struct hipblas_solver_entry<rocblas_status (*)(A...)>
+{
+    void* symbol;
+
+    rocblas_status operator()(A... args) const
+    {
+        if(!symbol)
+            return rocblas_status_not_implemented;
+        return reinterpret_cast<rocblas_status (*)(A...)>(symbol)(args...);
+    }
+};
+
+// A macro is not expanded again inside its own expansion, so below fn names the rocsolver.h
+// declaration
+#define HIPBLAS_SOLVER(fn)                                \
+    hipblas_solver_entry<decltype(&fn)>{[] {              \
+        static void* symbol = hipblas_solver_symbol(#fn); \
+        return symbol;                                    \
+    }()}
+
+// Every rocSOLVER function the rocBLAS backend calls
+#define rocsolver_cgels_batched HIPBLAS_SOLVER(rocsolver_cgels_batched)
+#define rocsolver_cgels_strided_batched HIPBLAS_SOLVER(rocsolver_cgels_strided_batched)
+#define rocsolver_cgeqrf HIPBLAS_SOLVER(rocsolver_cgeqrf)
+#define rocsolver_cgeqrf_batched HIPBLAS_SOLVER(rocsolver_cgeqrf_batched)
+#define rocsolver_cgeqrf_strided_batched HIPBLAS_SOLVER(rocsolver_cgeqrf_strided_batched)
+#define rocsolver_cgesvdj_batched HIPBLAS_SOLVER(rocsolver_cgesvdj_batched)
+#define rocsolver_cgesvdj_strided_batched HIPBLAS_SOLVER(rocsolver_cgesvdj_strided_batched)
+#define rocsolver_cgetrf HIPBLAS_SOLVER(rocsolver_cgetrf)
+#define rocsolver_cgetrf_batched HIPBLAS_SOLVER(rocsolver_cgetrf_batched)
+#define rocsolver_cgetrf_npvt_batched HIPBLAS_SOLVER(rocsolver_cgetrf_npvt_batched)
+#define rocsolver_cgetrf_npvt_strided_batched HIPBLAS_SOLVER(rocsolver_cgetrf_npvt_strided_batched)
+#define rocsolver_cgetrf_strided_batched HIPBLAS_SOLVER(rocsolver_cgetrf_strided_batched)
+#define rocsolver_cgetri_batched HIPBLAS_SOLVER(rocsolver_cgetri_batched)
+#define rocsolver_cgetri_outofplace_batched HIPBLAS_SOLVER(rocsolver_cgetri_outofplace_batched)
+#define rocsolver_cgetri_outofplace_strided_batched \
+    HIPBLAS_SOLVER(rocsolver_cgetri_outofplace_strided_batched)
+#define rocsolver_cgetrs HIPBLAS_SOLVER(rocsolver_cgetrs)
+#define rocsolver_cgetrs_batched HIPBLAS_SOLVER(rocsolver_cgetrs_batched)
+#define rocsolver_cgetrs_strided_batched HIPBLAS_SOLVER(rocsolver_cgetrs_strided_batched)
+#define rocsolver_cheevj_batched HIPBLAS_SOLVER(rocsolver_cheevj_batched)
+#define rocsolver_cheevj_strided_batched HIPBLAS_SOLVER(rocsolver_cheevj_strided_batched)
+#define rocsolver_cpotrf HIPBLAS_SOLVER(rocsolver_cpotrf)
+#define rocsolver_cpotrf_batched HIPBLAS_SOLVER(rocsolver_cpotrf_batched)
+#define rocsolver_cpotrf_strided_batched HIPBLAS_SOLVER(rocsolver_cpotrf_strided_batched)
+#define rocsolver_cpotrs HIPBLAS_SOLVER(rocsolver_cpotrs)
+#define rocsolver_cpotrs_batched HIPBLAS_SOLVER(rocsolver_cpotrs_batched)
+#define rocsolver_cpotrs_strided_batched HIPBLAS_SOLVER(rocsolver_cpotrs_strided_batched)
+#define rocsolver_csytrf_batched HIPBLAS_SOLVER(rocsolver_csytrf_batched)
+#define rocsolver_csytrf_strided_batched HIPBLAS_SOLVER(rocsolver_csytrf_strided_batched)
+#define rocsolver_cungqr HIPBLAS_SOLVER(rocsolver_cungqr)
+#define rocsolver_cunmqr HIPBLAS_SOLVER(rocsolver_cunmqr)
+#define rocsolver_dgels_batched HIPBLAS_SOLVER(rocsolver_dgels_batched)
+#define rocsolver_dgels_strided_batched HIPBLAS_SOLVER(rocsolver_dgels_strided_batched)
+#define rocsolver_dgeqrf HIPBLAS_SOLVER(rocsolver_dgeqrf)
+#define rocsolver_dgeqrf_batched HIPBLAS_SOLVER(rocsolver_dgeqrf_batched)
+#define rocsolver_dgeqrf_strided_batched HIPBLAS_SOLVER(rocsolver_dgeqrf_strided_batched)
+#define rocsolver_dgesvdj_batched HIPBLAS_SOLVER(rocsolver_dgesvdj_batched)
+#define rocsolver_dgesvdj_strided_batched HIPBLAS_SOLVER(rocsolver_dgesvdj_strided_batched)
+#define rocsolver_dgetrf HIPBLAS_SOLVER(rocsolver_dgetrf)
+#define rocsolver_dgetrf_batched HIPBLAS_SOLVER(rocsolver_dgetrf_batched)
+#define rocsolver_dgetrf_npvt_batched HIPBLAS_SOLVER(rocsolver_dgetrf_npvt_batched)
+#define rocsolver_dgetrf_npvt_strided_batched HIPBLAS_SOLVER(rocsolver_dgetrf_npvt_strided_batched)
+#define rocsolver_dgetrf_strided_batched HIPBLAS_SOLVER(rocsolver_dgetrf_strided_batched)
+#define rocsolver_dgetri_batched HIPBLAS_SOLVER(rocsolver_dgetri_batched)
+#define rocsolver_dgetri_outofplace_batched HIPBLAS_SOLVER(rocsolver_dgetri_outofplace_batched)
+#define rocsolver_dgetri_outofplace_strided_batched \
+    HIPBLAS_SOLVER(rocsolver_dgetri_outofplace_strided_batched)
+#define rocsolver_dgetrs HIPBLAS_SOLVER(rocsolver_dgetrs)
+#define rocsolver_dgetrs_batched HIPBLAS_SOLVER(rocsolver_dgetrs_batched)
+#define rocsolver_dgetrs_strided_batched HIPBLAS_SOLVER(rocsolver_dgetrs_strided_batched)
+#define rocsolver_dorgqr HIPBLAS_SOLVER(rocsolver_dorgqr)
+#define rocsolver_dormqr HIPBLAS_SOLVER(rocsolver_dormqr)
+#define rocsolver_dpotrf HIPBLAS_SOLVER(rocsolver_dpotrf)
+#define rocsolver_dpotrf_batched HIPBLAS_SOLVER(rocsolver_dpotrf_batched)
+#define rocsolver_dpotrf_strided_batched HIPBLAS_SOLVER(rocsolver_dpotrf_strided_batched)
+#define rocsolver_dpotrs HIPBLAS_SOLVER(rocsolver_dpotrs)
+#define rocsolver_dpotrs_batched HIPBLAS_SOLVER(rocsolver_dpotrs_batched)
+#define rocsolver_dpotrs_strided_batched HIPBLAS_SOLVER(rocsolver_dpotrs_strided_batched)
+#define rocsolver_dsyevj_batched HIPBLAS_SOLVER(rocsolver_dsyevj_batched)
+#define rocsolver_dsyevj_strided_batched HIPBLAS_SOLVER(rocsolver_dsyevj_strided_batched)
+#define rocsolver_dsytrf_batched HIPBLAS_SOLVER(rocsolver_dsytrf_batched)
+#define rocsolver_dsytrf_strided_batched HIPBLAS_SOLVER(rocsolver_dsytrf_strided_batched)
+#define rocsolver_sgels_batched HIPBLAS_SOLVER(rocsolver_sgels_batched)
+#define rocsolver_sgels_strided_batched HIPBLAS_SOLVER(rocsolver_sgels_strided_batched)
+#define rocsolver_sgeqrf HIPBLAS_SOLVER(rocsolver_sgeqrf)
+#define rocsolver_sgeqrf_batched HIPBLAS_SOLVER(rocsolver_sgeqrf_batched)
+#define rocsolver_sgeqrf_strided_batched HIPBLAS_SOLVER(rocsolver_sgeqrf_strided_batched)
+#define rocsolver_sgesvdj_batched HIPBLAS_SOLVER(rocsolver_sgesvdj_batched)
+#define rocsolver_sgesvdj_strided_batched HIPBLAS_SOLVER(rocsolver_sgesvdj_strided_batched)
+#define rocsolver_sgetrf HIPBLAS_SOLVER(rocsolver_sgetrf)
+#define rocsolver_sgetrf_batched HIPBLAS_SOLVER(rocsolver_sgetrf_batched)
+#define rocsolver_sgetrf_npvt_batched HIPBLAS_SOLVER(rocsolver_sgetrf_npvt_batched)
+#define rocsolver_sgetrf_npvt_strided_batched HIPBLAS_SOLVER(rocsolver_sgetrf_npvt_strided_batched)
+#define rocsolver_sgetrf_strided_batched HIPBLAS_SOLVER(rocsolver_sgetrf_strided_batched)
+#define rocsolver_sgetri_batched HIPBLAS_SOLVER(rocsolver_sgetri_batched)
+#define rocsolver_sgetri_outofplace_batched HIPBLAS_SOLVER(rocsolver_sgetri_outofplace_batched)
+#define rocsolver_sgetri_outofplace_strided_batched \
+    HIPBLAS_SOLVER(rocsolver_sgetri_outofplace_strided_batched)
+#define rocsolver_sgetrs HIPBLAS_SOLVER(rocsolver_sgetrs)
+#define rocsolver_sgetrs_batched HIPBLAS_SOLVER(rocsolver_sgetrs_batched)
+#define rocsolver_sgetrs_strided_batched HIPBLAS_SOLVER(rocsolver_sgetrs_strided_batched)
+#define rocsolver_sorgqr HIPBLAS_SOLVER(rocsolver_sorgqr)
+#define rocsolver_sormqr HIPBLAS_SOLVER(rocsolver_sormqr)
+#define rocsolver_spotrf HIPBLAS_SOLVER(rocsolver_spotrf)
+#define rocsolver_spotrf_batched HIPBLAS_SOLVER(rocsolver_spotrf_batched)
+#define rocsolver_spotrf_strided_batched HIPBLAS_SOLVER(rocsolver_spotrf_strided_batched)
+#define rocsolver_spotrs HIPBLAS_SOLVER(rocsolver_spotrs)
+#define rocsolver_spotrs_batched HIPBLAS_SOLVER(rocsolver_spotrs_batched)
+#define rocsolver_spotrs_strided_batched HIPBLAS_SOLVER(rocsolver_spotrs_strided_batched)
+#define rocsolver_ssyevj_batched HIPBLAS_SOLVER(rocsolver_ssyevj_batched)
+#define rocsolver_ssyevj_strided_batched HIPBLAS_SOLVER(rocsolver_ssyevj_strided_batched)
+#define rocsolver_ssytrf_batched HIPBLAS_SOLVER(rocsolver_ssytrf_batched)
+#define rocsolver_ssytrf_strided_batched HIPBLAS_SOLVER(rocsolver_ssytrf_strided_batched)
+#define rocsolver_zgels_batched HIPBLAS_SOLVER(rocsolver_zgels_batched)
+#define rocsolver_zgels_strided_batched HIPBLAS_SOLVER(rocsolver_zgels_strided_batched)
+#define rocsolver_zgeqrf HIPBLAS_SOLVER(rocsolver_zgeqrf)
+#define rocsolver_zgeqrf_batched HIPBLAS_SOLVER(rocsolver_zgeqrf_batched)
+#define rocsolver_zgeqrf_strided_batched HIPBLAS_SOLVER(rocsolver_zgeqrf_strided_batched)
+#define rocsolver_zgesvdj_batched HIPBLAS_SOLVER(rocsolver_zgesvdj_batched)
+#define rocsolver_zgesvdj_strided_batched HIPBLAS_SOLVER(rocsolver_zgesvdj_strided_batched)
+#define rocsolver_zgetrf HIPBLAS_SOLVER(rocsolver_zgetrf)
+#define rocsolver_zgetrf_batched HIPBLAS_SOLVER(rocsolver_zgetrf_batched)
+#define rocsolver_zgetrf_npvt_batched HIPBLAS_SOLVER(rocsolver_zgetrf_npvt_batched)
+#define rocsolver_zgetrf_npvt_strided_batched HIPBLAS_SOLVER(rocsolver_zgetrf_npvt_strided_batched)
+#define rocsolver_zgetrf_strided_batched HIPBLAS_SOLVER(rocsolver_zgetrf_strided_batched)
+#define rocsolver_zgetri_batched HIPBLAS_SOLVER(rocsolver_zgetri_batched)
+#define rocsolver_zgetri_outofplace_batched HIPBLAS_SOLVER(rocsolver_zgetri_outofplace_batched)
+#define rocsolver_zgetri_outofplace_strided_batched \
+    HIPBLAS_SOLVER(rocsolver_zgetri_outofplace_strided_batched)
+#define rocsolver_zgetrs HIPBLAS_SOLVER(rocsolver_zgetrs)
+#define rocsolver_zgetrs_batched HIPBLAS_SOLVER(rocsolver_zgetrs_batched)
+#define rocsolver_zgetrs_strided_batched HIPBLAS_SOLVER(rocsolver_zgetrs_strided_batched)
+#define rocsolver_zheevj_batched HIPBLAS_SOLVER(rocsolver_zheevj_batched)
+#define rocsolver_zheevj_strided_batched HIPBLAS_SOLVER(rocsolver_zheevj_strided_batched)
+#define rocsolver_zpotrf HIPBLAS_SOLVER(rocsolver_zpotrf)
+#define rocsolver_zpotrf_batched HIPBLAS_SOLVER(rocsolver_zpotrf_batched)
+#define rocsolver_zpotrf_strided_batched HIPBLAS_SOLVER(rocsolver_zpotrf_strided_batched)
+#define rocsolver_zpotrs HIPBLAS_SOLVER(rocsolver_zpotrs)
+#define rocsolver_zpotrs_batched HIPBLAS_SOLVER(rocsolver_zpotrs_batched)
+#define rocsolver_zpotrs_strided_batched HIPBLAS_SOLVER(rocsolver_zpotrs_strided_batched)
+#define rocsolver_zsytrf_batched HIPBLAS_SOLVER(rocsolver_zsytrf_batched)
+#define rocsolver_zsytrf_strided_batched HIPBLAS_SOLVER(rocsolver_zsytrf_strided_batched)
+#define rocsolver_zungqr HIPBLAS_SOLVER(rocsolver_zungqr)
+#define rocsolver_zunmqr HIPBLAS_SOLVER(rocsolver_zunmqr)
+
+#endif // __HIP_PLATFORM_SOLVER_LAZY__
+
+#endif // HIPBLAS_SOLVER_H
@@ -0,0 +1,61 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+//! The hipBLAS side of hipblasSet/GetVector, hipblasSet/GetMatrix and their Async forms.
+//! Synchronous copies from or to pageable host memory go through the process-wide pinned staging
+//! pool sized by hipblasSetStagingPoolSize: they are split into pieces that alternate between the
+//! two halves of the current device's pool, which live on the device's NUMA node, so packing one
+//! piece on the host overlaps the DMA of the other. Pieces whose device side is strided cross the
+//! link contiguously and are spread or gathered by a device-side 2D copy. Other strided vectors
+//! and padded matrices go as one pitched copy rather than the backend's many small ones. Each
+//! function returns false, having done nothing, when the backend should take the call: invalid
+//! or empty arguments, or a contiguous copy outside the pool; otherwise it runs the copy and
+//! sets status.
+#ifndef HIPBLAS_STAGING_H
+#define HIPBLAS_STAGING_H
+#pragma once
+#include "hipblas.h"
+#include <hip/hip_runtime_api.h>
+
+bool hipblas_set_get_vector(int              n,
+                            int              elemSize,
+                            const void*      x,
+                            int              incx,
+                            void*            y,
+                            int              incy,
+                            hipMemcpyKind    kind,
+                            hipblasStatus_t& status);
+
+bool hipblas_set_get_vector_async(int              n,
+                                  int              elemSize,
+                                  const void*      x,
+                                  int              incx,
+                                  void*            y,
+                                  int              incy,
+                                  hipMemcpyKind    kind,
+                                  hipStream_t      stream,
+                                  hipblasStatus_t& status);
+
+bool hipblas_set_get_matrix(int              rows,
+                            int              cols,
+                            int              elemSize,
+                            const void*      A,
+                            int              lda,
+                            void*            B,
+                            int              ldb,
+                            hipMemcpyKind    kind,
+                            hipblasStatus_t& status);
+
+bool hipblas_set_get_matrix_async(int              rows,
+                                  int              cols,
+                                  int              elemSize,
+                                  const void*      A,
+                                  int              lda,
+                                  void*            B,
+                                  int              ldb,
+                                  hipMemcpyKind    kind,
+                                  hipStream_t      stream,
+                                  hipblasStatus_t& status);
+
+#endif
@@ -0,0 +1,59 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+//! The mixed-precision rank-k updates behind hipblasSyrkEx and hipblasHerkEx: the uplo triangle of
+//! C = alpha op(A) op(A)^T, or op(A)^H with herk set, + beta C as batched gemmex calls, so every
+//! type combination gemmex takes runs on its matrix-core kernels. The triangle is halved down to
+//! diagonal blocks of order 128: each off-diagonal half is one gemm on C, and each diagonal block
+//! is computed in the handle workspace and only its uplo triangle copied back. A and C are
+//! strided, or pointer arrays already in device memory; their strides count elements. herk takes
+//! real alpha and beta of the compute precision and clears the imaginary parts of C's diagonal.
+//! hipblas_syrkx_ex takes a second operand B, for C = alpha op(A) op(B)^T, or ^H, + beta C as
+//! syrkx and herkx, and with two set adds alpha op(B) op(A)^T, or conj(alpha) op(B) op(A)^H, as
+//! syr2k and her2k; its herk alpha is complex. Both read device scalars to the host when herk or
+//! two is set, so their compute type is then 32F or 64F, real or complex.
+#ifndef HIPBLAS_SYRK_EX_H
+#define HIPBLAS_SYRK_EX_H
+#pragma once
+#include "hipblas.h"
+#include "hipblas_kernels.h"
+
+hipblasStatus_t hipblas_syrk_ex(hipblasHandle_t                     handle,
+                                bool                                herk,
+                                hipblasFillMode_t                   uplo,
+                                hipblasOperation_t                  trans,
+                                int                                 n,
+                                int                                 k,
+                                const void*                         alpha,
+                                hipblas_batched_operand<const void> A,
+                                hipblasDatatype_t                   a_type,
+                                int                                 lda,
+                                const void*                         beta,
+                                hipblas_batched_operand<void>       C,
+                                hipblasDatatype_t                   c_type,
+                                int                                 ldc,
+                                int                                 batch_count,
+                                hipblasDatatype_t                   compute_type);
+
+hipblasStatus_t hipblas_syrkx_ex(hipblasHandle_t                     handle,
+                                 bool                                herk,
+                                 bool                                two,
+                                 hipblasFillMode_t                   uplo,
+                                 hipblasOperation_t                  trans,
+                                 int                                 n,
+                                 int                                 k,
+                                 const void*                         alpha,
+                                 hipblas_batched_operand<const void> A,
+                                 hipblasDatatype_t                   a_type,
+                                 int                                 lda,
+                                 hipblas_batched_operand<const void> B,
+                                 int                                 ldb,
+                                 const void*                         beta,
+                                 hipblas_batched_operand<void>       C,
+                                 hipblasDatatype_t                   c_type,
+                                 int                                 ldc,
+                                 int                                 batch_count,
+                                 hipblasDatatype_t                   compute_type);
+
+#endif
@@ -0,0 +1,37 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+//! The mixed-precision triangular solves and products behind hipblasTrsmMixedEx and
+//! hipblasTrmmMixedEx: B = alpha op(A)^-1 B, or alpha op(A) B when solve is clear, or the right
+//! side's B op(A)^-1 and B op(A), in place, for fp16, bf16 or fp32 A and B with fp32 arithmetic.
+//! The triangle is halved down to diagonal blocks of order HIPBLAS_TRSM_MIXED_DIAGONAL, each
+//! solved or multiplied by one kernel, and each off-diagonal half applied as one gemmex call with
+//! fp32 compute, so the half data is never widened in memory. A and B are strided, or pointer
+//! arrays already in device memory; their strides count elements. Device scalars are read back
+//! to the host, so they are not available in HIPBLAS_CAPTURE_MODE_SAFE.
+#ifndef HIPBLAS_TRSM_MIXED_EX_H
+#define HIPBLAS_TRSM_MIXED_EX_H
+#pragma once
+#include "hipblas.h"
+#include "hipblas_kernels.h"
+
+hipblasStatus_t hipblas_trsm_mixed_ex(hipblasHandle_t                     handle,
+                                      bool                                solve,
+                                      hipblasSideMode_t                   side,
+                                      hipblasFillMode_t                   uplo,
+                                      hipblasOperation_t                  trans,
+                                      hipblasDiagType_t                   diag,
+                                      int                                 m,
+                                      int                                 n,
+                                      const void*                         alpha,
+                                      hipblas_batched_operand<const void> A,
+                                      hipblasDatatype_t                   a_type,
+                                      int                                 lda,
+                                      hipblas_batched_operand<void>       B,
+                                      hipblasDatatype_t                   b_type,
+                                      int                                 ldb,
+                                      int                                 batch_count,
+                                      hipblasDatatype_t                   compute_type);
+
+#endif
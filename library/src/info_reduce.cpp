@@ -0,0 +1,27 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "hipblas_kernels.h"
+#include "hipblas_logging.h"
+#include <hip/hip_runtime_api.h>
+
+hipblasStatus_t
+    hipblasInfoReduce(hipblasHandle_t handle, int batch_count, const int* info, int* result)
+{
+    HIPBLAS_LOG_CALL(handle, batch_count, info, result);
+    if(handle == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(batch_count < 0 || result == nullptr || (batch_count > 0 && info == nullptr))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    // An empty batch is still written, so result never holds a previous call's answer
+    hipStream_t     stream;
+    hipblasStatus_t status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    if(hipblas_info_reduce(stream, batch_count, info, result) != hipSuccess)
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+    return HIPBLAS_STATUS_SUCCESS;
+}
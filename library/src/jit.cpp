@@ -0,0 +1,577 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipblas_jit.h"
+#include "hipblas.h"
+
+#ifdef HIPBLAS_WITH_RTC
+#include "hipblas_handle.h"
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <hip/hip_runtime_api.h>
+#include <hip/hiprtc.h>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <sstream>
+#include <string>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+
+struct hipblas_jit_kernel
+{
+    hipModule_t   module;
+    hipFunction_t function;
+    unsigned      grid_x;
+    unsigned      grid_y;
+    bool          double_compute;
+};
+
+namespace
+{
+    constexpr int JIT_THREADS = 256;
+    constexpr int JIT_TILE_K  = 16;
+
+    constexpr const char* JIT_FUNCTION = "hipblas_jit_gemm";
+
+    // Starts every cache file, ahead of the source it was compiled from, so a file of a hash
+    // collision or an older format is recompiled rather than loaded
+    constexpr const char* JIT_FILE_MAGIC = "hipblas-jit-1\n";
+
+    // A tile of C per block of JIT_THREADS threads, a 16 x 16 grid of them each computing
+    // tile_m / 16 x tile_n / 16 elements. Thin problems take a thin tile, so no block computes
+    // mostly rows or columns past the edge of C
+    struct jit_tiling
+    {
+        int tile_m;
+        int tile_n;
+    };
+
+    jit_tiling pick_tiling(int m, int n)
+    {
+        if(n <= 16 && m > n)
+            return {128, 16};
+        if(m <= 16 && n > m)
+            return {16, 128};
+        if(int64_t(m) * n <= 256 * 256)
+            return {32, 32};
+        return {64, 64};
+    }
+
+    const char* storage_type(hipblasDatatype_t type)
+    {
+        switch(type)
+        {
+        case HIPBLAS_R_16F:
+        case HIPBLAS_R_16B:
+            return "unsigned short";
+        case HIPBLAS_R_32F:
+            return "float";
+        default:
+            return "double";
+        }
+    }
+
+    const char* load_function(hipblasDatatype_t type)
+    {
+        switch(type)
+        {
+        case HIPBLAS_R_16F:
+            return "load_half";
+        case HIPBLAS_R_16B:
+            return "load_bfloat16";
+        default:
+            return "S";
+        }
+    }
+
+    const char* store_function(hipblasDatatype_t type)
+    {
+        switch(type)
+        {
+        case HIPBLAS_R_16F:
+            return "store_half";
+        case HIPBLAS_R_16B:
+            return "store_bfloat16";
+        case HIPBLAS_R_32F:
+            return "float";
+        default:
+            return "double";
+        }
+    }
+
+    // The conversions of the 16-bit types by their bits, so the source includes no headers;
+    // stores round to nearest even
+    const char* const JIT_CONVERSIONS = R"(
+__device__ inline float load_half(unsigned short h)
+{
+    unsigned s = unsigned(h & 0x8000) << 16;
+    unsigned e = (h >> 10) & 0x1f;
+    unsigned m = h & 0x3ff;
+    if(e == 0)
+    {
+        float f = float(m) * 5.9604644775390625e-8f;
+        return s ? -f : f;
+    }
+    if(e == 31)
+        return __uint_as_float(s | 0x7f800000 | (m << 13));
+    return __uint_as_float(s | ((e + 112) << 23) | (m << 13));
+}
+
+__device__ inline unsigned short store_half(float f)
+{
+    unsigned x = __float_as_uint(f);
+    unsigned s = (x >> 16) & 0x8000;
+    unsigned a = x & 0x7fffffff;
+    if(a > 0x7f800000)
+        return s | 0x7e00;
+    if(a >= 0x477ff000)
+        return s | 0x7c00;
+    if(a < 0x38800000)
+        return s | __float2uint_rn(__uint_as_float(a) * 16777216.0f);
+    return s | ((a - 0x38000000 + 0xfff + ((a >> 13) & 1)) >> 13);
+}
+
+__device__ inline float load_bfloat16(unsigned short h)
+{
+    return __uint_as_float(unsigned(h) << 16);
+}
+
+__device__ inline unsigned short store_bfloat16(float f)
+{
+    unsigned u = __float_as_uint(f);
+    if((u & 0x7fffffff) > 0x7f800000)
+        return (u >> 16) | 0x40;
+    return (u + 0x7fff + ((u >> 16) & 1)) >> 16;
+}
+)";
+
+    // op(A) and op(B) pass through shared memory a JIT_TILE_K slice at a time, each read along
+    // its contiguous dimension; the bounds are constants, so whole tiles drop their checks
+    const char* const JIT_GEMM = R"(
+extern "C" __global__ void __launch_bounds__(THREADS)
+    hipblas_jit_gemm(const TA* A, const TB* B, TC* C, S alpha, S beta, const S* alpha_dev,
+                     const S* beta_dev)
+{
+    constexpr int RM = TILE_M / 16;
+    constexpr int RN = TILE_N / 16;
+    __shared__ S As[TILE_K][TILE_M + 1];
+    __shared__ S Bs[TILE_K][TILE_N + 1];
+
+    int tx = threadIdx.x % 16;
+    int ty = threadIdx.x / 16;
+    int i0 = blockIdx.x * TILE_M;
+    int j0 = blockIdx.y * TILE_N;
+
+    S acc[RM][RN];
+#pragma unroll
+    for(int r = 0; r < RM; r++)
+#pragma unroll
+        for(int c = 0; c < RN; c++)
+            acc[r][c] = 0;
+
+    for(int k0 = 0; k0 < K; k0 += TILE_K)
+    {
+        for(int e = threadIdx.x; e < TILE_K * TILE_M; e += THREADS)
+        {
+            int ii = TRANS_A ? e / TILE_K : e % TILE_M;
+            int kk = TRANS_A ? e % TILE_K : e / TILE_M;
+            int i  = i0 + ii;
+            int k  = k0 + kk;
+            As[kk][ii] = i < M && k < K
+                             ? LOAD_A(A[TRANS_A ? k + (unsigned long long)i * LDA
+                                                : i + (unsigned long long)k * LDA])
+                             : S(0);
+        }
+        for(int e = threadIdx.x; e < TILE_K * TILE_N; e += THREADS)
+        {
+            int jj = TRANS_B ? e % TILE_N : e / TILE_K;
+            int kk = TRANS_B ? e / TILE_N : e % TILE_K;
+            int j  = j0 + jj;
+            int k  = k0 + kk;
+            Bs[kk][jj] = j < N && k < K
+                             ? LOAD_B(B[TRANS_B ? j + (unsigned long long)k * LDB
+                                                : k + (unsigned long long)j * LDB])
+                             : S(0);
+        }
+        __syncthreads();
+
+#pragma unroll
+        for(int kk = 0; kk < TILE_K; kk++)
+        {
+            S a[RM];
+            S b[RN];
+#pragma unroll
+            for(int r = 0; r < RM; r++)
+                a[r] = As[kk][tx + 16 * r];
+#pragma unroll
+            for(int c = 0; c < RN; c++)
+                b[c] = Bs[kk][ty + 16 * c];
+#pragma unroll
+            for(int r = 0; r < RM; r++)
+#pragma unroll
+                for(int c = 0; c < RN; c++)
+                    acc[r][c] += a[r] * b[c];
+        }
+        __syncthreads();
+    }
+
+    S al = alpha_dev ? *alpha_dev : alpha;
+    S be = beta_dev ? *beta_dev : beta;
+#pragma unroll
+    for(int r = 0; r < RM; r++)
+#pragma unroll
+        for(int c = 0; c < RN; c++)
+        {
+            int i = i0 + tx + 16 * r;
+            int j = j0 + ty + 16 * c;
+            if(i >= M || j >= N)
+                continue;
+            TC& y = C[i + (unsigned long long)j * LDC];
+            S   v = al * acc[r][c];
+            if(be != S(0))
+                v += be * LOAD_C(y);
+            hipblas_epilogue(v, i, j);
+            y = STORE_C(v);
+        }
+}
+)";
+
+    std::string gemm_source(const hipblasGemmShape_t& s,
+                            int                       lda,
+                            int                       ldb,
+                            int                       ldc,
+                            const char*               epilogue_code,
+                            const jit_tiling&         tiling)
+    {
+        const char*        compute = s.compute_type == HIPBLAS_R_64F ? "double" : "float";
+        std::ostringstream src;
+        src << "typedef " << compute << " S;\n"
+            << "typedef " << storage_type(s.a_type) << " TA;\n"
+            << "typedef " << storage_type(s.b_type) << " TB;\n"
+            << "typedef " << storage_type(s.c_type) << " TC;\n"
+            << "#define LOAD_A " << load_function(s.a_type) << "\n"
+            << "#define LOAD_B " << load_function(s.b_type) << "\n"
+            << "#define LOAD_C " << load_function(s.c_type) << "\n"
+            << "#define STORE_C " << store_function(s.c_type) << "\n"
+            << "constexpr int M = " << s.m << ", N = " << s.n << ", K = " << s.k << ";\n"
+            << "constexpr int LDA = " << lda << ", LDB = " << ldb << ", LDC = " << ldc << ";\n"
+            << "constexpr bool TRANS_A = " << (s.transA != HIPBLAS_OP_N) << ";\n"
+            << "constexpr bool TRANS_B = " << (s.transB != HIPBLAS_OP_N) << ";\n"
+            << "constexpr int TILE_M = " << tiling.tile_m << ", TILE_N = " << tiling.tile_n
+            << ", TILE_K = " << JIT_TILE_K << ";\n"
+            << "#define THREADS " << JIT_THREADS << "\n"
+            << JIT_CONVERSIONS
+            << "\n__device__ inline void hipblas_epilogue(S& v, int i, int j)\n{\n"
+            << "    (void)v;\n    (void)i;\n    (void)j;\n"
+            << "#line 1 \"epilogue\"\n"
+            << (epilogue_code ? epilogue_code : "") << "\n}\n"
+            << JIT_GEMM;
+        return src.str();
+    }
+
+    // The architecture code objects are compiled for, and the option that names it
+    bool device_arch(int device, std::string& arch, std::string& option)
+    {
+        hipDeviceProp_t props;
+        if(hipGetDeviceProperties(&props, device) != hipSuccess)
+            return false;
+#ifdef __HIP_PLATFORM_NVCC__
+        arch   = "compute_" + std::to_string(props.major * 10 + props.minor);
+        option = "--gpu-architecture=" + arch;
+#else
+        arch   = props.gcnArchName;
+        option = "--gpu-architecture=" + arch;
+#endif
+        return true;
+    }
+
+    // FNV-1a, naming the cache files; their contents are checked against the source on load
+    uint64_t source_hash(const std::string& s)
+    {
+        uint64_t h = 14695981039346656037ull;
+        for(unsigned char c : s)
+            h = (h ^ c) * 1099511628211ull;
+        return h;
+    }
+
+    std::string cache_directory()
+    {
+        const char* path = std::getenv("HIPBLAS_JIT_CACHE_PATH");
+        if(path)
+            return path;
+        const char* xdg = std::getenv("XDG_CACHE_HOME");
+        if(xdg && *xdg)
+            return std::string(xdg) + "/hipblas/jit";
+        const char* home = std::getenv("HOME");
+        if(home && *home)
+            return std::string(home) + "/.cache/hipblas/jit";
+        return "";
+    }
+
+    // mkdir -p; false when the directory is not there afterwards
+    bool make_directories(const std::string& dir)
+    {
+        for(size_t pos = 1; pos <= dir.size(); pos++)
+            if(pos == dir.size() || dir[pos] == '/')
+            {
+                std::string prefix = dir.substr(0, pos);
+                if(mkdir(prefix.c_str(), 0755) != 0 && errno != EEXIST)
+                    return false;
+            }
+        struct stat st;
+        return stat(dir.c_str(), &st) == 0 && S_ISDIR(st.st_mode);
+    }
+
+    std::string cache_file(const std::string& dir, const std::string& arch, uint64_t hash)
+    {
+        // gfx90a:sramecc+:xnack- and the like keep their features in the name
+        std::string name = arch;
+        for(char& c : name)
+            if(c == ':' || c == '/')
+                c = '_';
+        char hex[17];
+        std::snprintf(hex, sizeof(hex), "%016llx", (unsigned long long)hash);
+        return dir + "/" + name + "-" + hex + ".co";
+    }
+
+    bool read_cached(const std::string& file, const std::string& source, std::vector<char>& code)
+    {
+        std::ifstream in(file, std::ios::binary);
+        if(!in)
+            return false;
+        std::string contents((std::istreambuf_iterator<char>(in)),
+                             std::istreambuf_iterator<char>());
+        std::string header = std::string(JIT_FILE_MAGIC) + source;
+        if(contents.size() <= header.size() + 1 || contents.compare(0, header.size(), header) != 0
+           || contents[header.size()] != '\0')
+            return false;
+        code.assign(contents.begin() + header.size() + 1, contents.end());
+        return true;
+    }
+
+    // Written to a file of this process's own and renamed into place, so a concurrent reader
+    // sees a whole file or none; a cache that cannot be written is skipped
+    void write_cached(const std::string&       file,
+                      const std::string&       source,
+                      const std::vector<char>& code)
+    {
+        std::string temp = file + "." + std::to_string(getpid()) + ".tmp";
+        {
+            std::ofstream out(temp, std::ios::binary);
+            if(!out)
+                return;
+            out << JIT_FILE_MAGIC << source << '\0';
+            out.write(code.data(), code.size());
+            if(!out)
+            {
+                out.close();
+                std::remove(temp.c_str());
+                return;
+            }
+        }
+        if(std::rename(temp.c_str(), file.c_str()) != 0)
+            std::remove(temp.c_str());
+    }
+
+    hipblasStatus_t
+        compile(const std::string& source, const std::string& option, std::vector<char>& code)
+    {
+        hiprtcProgram program;
+        if(hiprtcCreateProgram(
+               &program, source.c_str(), "hipblas_jit_gemm.cpp", 0, nullptr, nullptr)
+           != HIPRTC_SUCCESS)
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+        const char*  options[] = {option.c_str(), "-O3"};
+        hiprtcResult result    = hiprtcCompileProgram(program, 2, options);
+        if(result != HIPRTC_SUCCESS)
+        {
+            size_t log_size = 0;
+            if(hiprtcGetProgramLogSize(program, &log_size) == HIPRTC_SUCCESS && log_size > 1)
+            {
+                std::string log(log_size, '\0');
+                if(hiprtcGetProgramLog(program, &log[0]) == HIPRTC_SUCCESS)
+                    std::cerr << "hipblas jit: the gemm epilogue did not compile:\n"
+                              << log.c_str() << std::endl;
+            }
+            hiprtcDestroyProgram(&program);
+            return result == HIPRTC_ERROR_COMPILATION ? HIPBLAS_STATUS_INVALID_VALUE
+                                                      : HIPBLAS_STATUS_INTERNAL_ERROR;
+        }
+
+        size_t code_size = 0;
+        if(hiprtcGetCodeSize(program, &code_size) == HIPRTC_SUCCESS)
+        {
+            code.resize(code_size);
+            if(hiprtcGetCode(program, code.data()) != HIPRTC_SUCCESS)
+                code.clear();
+        }
+        hiprtcDestroyProgram(&program);
+        return code.empty() ? HIPBLAS_STATUS_INTERNAL_ERROR : HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // Loads code on device, leaving the current device unchanged
+    hipblasStatus_t load(int device, const std::vector<char>& code, hipblas_jit_kernel& kernel)
+    {
+        int current;
+        if(hipGetDevice(&current) != hipSuccess || hipSetDevice(device) != hipSuccess)
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+        hipblasStatus_t status = HIPBLAS_STATUS_INTERNAL_ERROR;
+        if(hipModuleLoadData(&kernel.module, code.data()) == hipSuccess)
+        {
+            if(hipModuleGetFunction(&kernel.function, kernel.module, JIT_FUNCTION) == hipSuccess)
+                status = HIPBLAS_STATUS_SUCCESS;
+            else
+                hipModuleUnload(kernel.module);
+        }
+        hipSetDevice(current);
+        return status;
+    }
+}
+
+hipblasStatus_t hipblas_jit_gemm_kernel(hipblasHandle_t            handle,
+                                        const hipblasGemmShape_t&  shape,
+                                        int                        lda,
+                                        int                        ldb,
+                                        int                        ldc,
+                                        const char*                epilogue_code,
+                                        const hipblas_jit_kernel** kernel)
+{
+    hipblas_handle* h = static_cast<hipblas_handle*>(handle);
+
+    jit_tiling tiling = pick_tiling(shape.m, shape.n);
+    int64_t    grid_x = (int64_t(shape.m) + tiling.tile_m - 1) / tiling.tile_m;
+    int64_t    grid_y = (int64_t(shape.n) + tiling.tile_n - 1) / tiling.tile_n;
+    if(grid_y > 65535)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    std::string source = gemm_source(shape, lda, ldb, ldc, epilogue_code, tiling);
+    std::string arch, option;
+    if(!device_arch(h->device, arch, option))
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+    // Loaded modules are never unloaded, since any number of plans may share one
+    static std::mutex                                                  mutex;
+    static std::map<std::string, std::unique_ptr<hipblas_jit_kernel>> kernels;
+    std::lock_guard<std::mutex>                                        lock(mutex);
+
+    std::string key = std::to_string(h->device) + '\n' + source;
+    auto        it  = kernels.find(key);
+    if(it != kernels.end())
+    {
+        *kernel = it->second.get();
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    std::string       dir  = cache_directory();
+    std::string       file = dir.empty() ? "" : cache_file(dir, arch, source_hash(source));
+    std::vector<char> code;
+    bool              cached = !file.empty() && read_cached(file, source, code);
+    if(!cached)
+    {
+        hipblasStatus_t status = compile(source, option, code);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        if(!file.empty() && make_directories(dir))
+            write_cached(file, source, code);
+    }
+
+    std::unique_ptr<hipblas_jit_kernel> k(new(std::nothrow) hipblas_jit_kernel());
+    if(!k)
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+    k->grid_x         = unsigned(grid_x);
+    k->grid_y         = unsigned(grid_y);
+    k->double_compute = shape.compute_type == HIPBLAS_R_64F;
+    hipblasStatus_t status = load(h->device, code, *k);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    *kernel = k.get();
+    kernels.emplace(key, std::move(k));
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblas_jit_gemm_launch(hipblasHandle_t           handle,
+                                        const hipblas_jit_kernel& kernel,
+                                        const void*               alpha,
+                                        const void*               A,
+                                        const void*               B,
+                                        const void*               beta,
+                                        void*                     C)
+{
+    if(kernel.grid_x == 0 || kernel.grid_y == 0)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    hipStream_t          stream;
+    hipblasPointerMode_t mode;
+    hipblasStatus_t      status = hipblasGetStream(handle, &stream);
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = hipblasGetPointerMode(handle, &mode);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // The scalars go by value in host pointer mode and through the device pointers otherwise. A
+    // float is copied to the first bytes of a double, where the kernel reads its argument
+    bool        device_scalars = mode == HIPBLAS_POINTER_MODE_DEVICE;
+    size_t      size           = kernel.double_compute ? sizeof(double) : sizeof(float);
+    double      alpha_value = 0, beta_value = 0;
+    const void* alpha_dev = device_scalars ? alpha : nullptr;
+    const void* beta_dev  = device_scalars ? beta : nullptr;
+    if(!device_scalars)
+    {
+        std::memcpy(&alpha_value, alpha, size);
+        std::memcpy(&beta_value, beta, size);
+    }
+
+    void* args[] = {&A, &B, &C, &alpha_value, &beta_value, &alpha_dev, &beta_dev};
+    return hipModuleLaunchKernel(kernel.function,
+                                 kernel.grid_x,
+                                 kernel.grid_y,
+                                 1,
+                                 JIT_THREADS,
+                                 1,
+                                 1,
+                                 0,
+                                 stream,
+                                 args,
+                                 nullptr)
+                   == hipSuccess
+               ? HIPBLAS_STATUS_SUCCESS
+               : HIPBLAS_STATUS_INTERNAL_ERROR;
+}
+
+#else
+
+hipblasStatus_t hipblas_jit_gemm_kernel(hipblasHandle_t,
+                                        const hipblasGemmShape_t&,
+                                        int,
+                                        int,
+                                        int,
+                                        const char*,
+                                        const hipblas_jit_kernel**)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+hipblasStatus_t hipblas_jit_gemm_launch(hipblasHandle_t,
+                                        const hipblas_jit_kernel&,
+                                        const void*,
+                                        const void*,
+                                        const void*,
+                                        const void*,
+                                        void*)
+{
+    return HIPBLAS_STATUS_NOT_SUPPORTED;
+}
+
+#endif
@@ -0,0 +1,149 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "hipblas_handle.h"
+#include "hipblas_kernels.h"
+#include "hipblas_logging.h"
+#include <algorithm>
+#include <hip/hip_runtime_api.h>
+
+namespace
+{
+    bool valid_operation(hipblasOperation_t op)
+    {
+        return op == HIPBLAS_OP_N || op == HIPBLAS_OP_T || op == HIPBLAS_OP_C;
+    }
+
+    int64_t tiles_of(int64_t n, int64_t tile)
+    {
+        return n > 0 ? (n - 1) / tile + 1 : 0;
+    }
+
+    // Checks the job as the matching BLAS call would, and counts its tiles; a job with nothing to
+    // do, like a gemv with m == 0, has none and its pointers are never read
+    hipblasStatus_t job_tiles(const hipblasJob_t& job, int64_t& tiles)
+    {
+        tiles = 0;
+        switch(job.type)
+        {
+        case HIPBLAS_JOB_AXPY:
+            if(job.n < 0 || job.ldb == 0 || job.ldc == 0)
+                return HIPBLAS_STATUS_INVALID_VALUE;
+            tiles = tiles_of(job.n, HIPBLAS_JOB_AXPY_TILE);
+            break;
+        case HIPBLAS_JOB_GEMV:
+            if(!valid_operation(job.transa))
+                return HIPBLAS_STATUS_INVALID_ENUM;
+            if(job.m < 0 || job.n < 0 || job.lda < std::max(1, job.m) || job.ldb == 0
+               || job.ldc == 0)
+                return HIPBLAS_STATUS_INVALID_VALUE;
+            if(job.m > 0 && job.n > 0)
+                tiles = tiles_of(job.transa == HIPBLAS_OP_N ? job.m : job.n, HIPBLAS_JOB_GEMV_TILE);
+            break;
+        case HIPBLAS_JOB_GEMM:
+            if(!valid_operation(job.transa) || !valid_operation(job.transb))
+                return HIPBLAS_STATUS_INVALID_ENUM;
+            if(job.m < 0 || job.n < 0 || job.k < 0
+               || job.lda < std::max(1, job.transa == HIPBLAS_OP_N ? job.m : job.k)
+               || job.ldb < std::max(1, job.transb == HIPBLAS_OP_N ? job.k : job.n)
+               || job.ldc < std::max(1, job.m))
+                return HIPBLAS_STATUS_INVALID_VALUE;
+            tiles = tiles_of(job.m, HIPBLAS_JOB_GEMM_TILE) * tiles_of(job.n, HIPBLAS_JOB_GEMM_TILE);
+            break;
+        default:
+            return HIPBLAS_STATUS_INVALID_ENUM;
+        }
+
+        if(tiles > 0
+           && ((job.type != HIPBLAS_JOB_AXPY && job.A == nullptr) || job.B == nullptr
+               || job.C == nullptr))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // The descriptors are written straight into a pinned slot of the pointer array ring and
+    // uploaded on the handle's stream, so one copy and one launch cover the whole list
+    template <typename T>
+    hipblasStatus_t job_list(hipblasHandle_t handle, const hipblasJob_t* jobs, int job_count)
+    {
+        hipblas_handle* h = static_cast<hipblas_handle*>(handle);
+        if(h == nullptr)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if(job_count < 0 || (job_count > 0 && jobs == nullptr))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(job_count == 0)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(h->capture_mode == HIPBLAS_CAPTURE_MODE_SAFE)
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+        int64_t tiles = 0;
+        for(int i = 0; i < job_count; i++)
+        {
+            int64_t         job_tiles_i;
+            hipblasStatus_t status = job_tiles(jobs[i], job_tiles_i);
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+            tiles += job_tiles_i;
+        }
+        if(tiles == 0)
+            return HIPBLAS_STATUS_SUCCESS;
+
+        hipStream_t                       stream;
+        hipblas_pointer_array_ring::slot* s;
+        size_t                            bytes  = job_count * sizeof(hipblas_job_desc<T>);
+        hipblasStatus_t                   status = hipblasGetStream(handle, &stream);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = h->pointer_arrays.acquire(bytes, s);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        hipblas_job_desc<T>* desc       = static_cast<hipblas_job_desc<T>*>(s->host);
+        int64_t              first_tile = 0;
+        for(int i = 0; i < job_count; i++)
+        {
+            const hipblasJob_t& job = jobs[i];
+            int64_t             job_tiles_i;
+            (void)job_tiles(job, job_tiles_i);
+            desc[i] = {job.type,
+                       job.transa,
+                       job.transb,
+                       job.m,
+                       job.n,
+                       job.k,
+                       T(job.alpha),
+                       T(job.beta),
+                       static_cast<const T*>(job.A),
+                       job.lda,
+                       static_cast<const T*>(job.B),
+                       job.ldb,
+                       static_cast<T*>(job.C),
+                       job.ldc,
+                       first_tile};
+            first_tile += job_tiles_i;
+        }
+
+        if(hipMemcpyAsync(s->device, s->host, bytes, hipMemcpyHostToDevice, stream) != hipSuccess
+           || hipblas_job_list(stream,
+                               static_cast<const hipblas_job_desc<T>*>(s->device),
+                               job_count,
+                               tiles)
+                  != hipSuccess)
+            status = HIPBLAS_STATUS_INTERNAL_ERROR;
+        h->pointer_arrays.release(s, stream);
+        return status;
+    }
+}
+
+hipblasStatus_t hipblasSJobList(hipblasHandle_t handle, const hipblasJob_t* jobs, int job_count)
+{
+    HIPBLAS_LOG_CALL(handle, jobs, job_count);
+    return job_list<float>(handle, jobs, job_count);
+}
+
+hipblasStatus_t hipblasDJobList(hipblasHandle_t handle, const hipblasJob_t* jobs, int job_count)
+{
+    HIPBLAS_LOG_CALL(handle, jobs, job_count);
+    return job_list<double>(handle, jobs, job_count);
+}
@@ -0,0 +1,202 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "hipblas_kernels.h"
+#include <algorithm>
+#include <hip/hip_runtime.h>
+
+namespace
+{
+    constexpr int COPY_DIM_X = 256;
+
+    // Matrix copies are tiled so a warp reads one contiguous column segment
+    constexpr int MATRIX_DIM_X = 32;
+    constexpr int MATRIX_DIM_Y = 8;
+
+    // The grid dimension spanning the batch is capped by the hardware limit, so each block loops
+    // over the batch
+    constexpr int MAX_GRID_BATCH = 65535;
+
+    template <typename T>
+    __global__ void scatter_strided_to_batched_kernel(
+        int n, const T* src, int64_t stride, T* const* dst, int batch_count)
+    {
+        int i = blockIdx.x * blockDim.x + threadIdx.x;
+        if(i >= n)
+            return;
+
+        for(int b = blockIdx.y; b < batch_count; b += gridDim.y)
+            dst[b][i] = src[b * stride + i];
+    }
+
+    template <typename T>
+    __global__ void gather_batched_to_strided_kernel(
+        int n, const T* const src[], int64_t inc, T* dst, int64_t stride, int batch_count)
+    {
+        int i = blockIdx.x * blockDim.x + threadIdx.x;
+        if(i >= n)
+            return;
+
+        int64_t offset = inc > 0 ? i * inc : (n - 1 - i) * -inc;
+        for(int b = blockIdx.y; b < batch_count; b += gridDim.y)
+            dst[b * stride + i] = src[b][offset];
+    }
+
+    template <typename T>
+    __global__ void
+        strided_pointer_array_kernel(T* base, int64_t stride, T** array, int batch_count)
+    {
+        int b = blockIdx.x * blockDim.x + threadIdx.x;
+        if(b < batch_count)
+            array[b] = base + b * stride;
+    }
+
+    template <typename T>
+    __global__ void copy_matrix_batched_kernel(int            m,
+                                               int            n,
+                                               const T* const src[],
+                                               int64_t        lds,
+                                               T* const       dst[],
+                                               int64_t        ldd,
+                                               int            batch_count)
+    {
+        int i = blockIdx.x * blockDim.x + threadIdx.x;
+        int j = blockIdx.y * blockDim.y + threadIdx.y;
+        if(i >= m || j >= n)
+            return;
+
+        for(int b = blockIdx.z; b < batch_count; b += gridDim.z)
+            dst[b][i + j * ldd] = src[b][i + j * lds];
+    }
+}
+
+template <typename T>
+hipError_t hipblas_scatter_strided_to_batched(
+    hipStream_t stream, int n, const T* src, int64_t stride, T* const dst[], int batch_count)
+{
+    if(n <= 0 || batch_count <= 0)
+        return hipSuccess;
+
+    dim3 grid((n - 1) / COPY_DIM_X + 1, std::min(batch_count, MAX_GRID_BATCH));
+    dim3 threads(COPY_DIM_X);
+
+    hipLaunchKernelGGL(scatter_strided_to_batched_kernel<T>,
+                       grid,
+                       threads,
+                       0,
+                       stream,
+                       n,
+                       src,
+                       stride,
+                       dst,
+                       batch_count);
+    return hipGetLastError();
+}
+
+template <typename T>
+hipError_t hipblas_gather_batched_to_strided(hipStream_t    stream,
+                                             int            n,
+                                             const T* const src[],
+                                             int64_t        inc,
+                                             T*             dst,
+                                             int64_t        stride,
+                                             int            batch_count)
+{
+    if(n <= 0 || batch_count <= 0)
+        return hipSuccess;
+
+    dim3 grid((n - 1) / COPY_DIM_X + 1, std::min(batch_count, MAX_GRID_BATCH));
+    dim3 threads(COPY_DIM_X);
+
+    hipLaunchKernelGGL(gather_batched_to_strided_kernel<T>,
+                       grid,
+                       threads,
+                       0,
+                       stream,
+                       n,
+                       src,
+                       inc,
+                       dst,
+                       stride,
+                       batch_count);
+    return hipGetLastError();
+}
+
+template <typename T>
+hipError_t hipblas_strided_pointer_array(
+    hipStream_t stream, T* base, int64_t stride, T** array, int batch_count)
+{
+    if(batch_count <= 0)
+        return hipSuccess;
+
+    dim3 grid((batch_count - 1) / COPY_DIM_X + 1);
+    dim3 threads(COPY_DIM_X);
+
+    hipLaunchKernelGGL(strided_pointer_array_kernel<T>,
+                       grid,
+                       threads,
+                       0,
+                       stream,
+                       base,
+                       stride,
+                       array,
+                       batch_count);
+    return hipGetLastError();
+}
+
+template <typename T>
+hipError_t hipblas_copy_matrix_batched(hipStream_t    stream,
+                                       int            m,
+                                       int            n,
+                                       const T* const src[],
+                                       int64_t        lds,
+                                       T* const       dst[],
+                                       int64_t        ldd,
+                                       int            batch_count)
+{
+    if(m <= 0 || n <= 0 || batch_count <= 0)
+        return hipSuccess;
+
+    dim3 grid((m - 1) / MATRIX_DIM_X + 1,
+              (n - 1) / MATRIX_DIM_Y + 1,
+              std::min(batch_count, MAX_GRID_BATCH));
+    dim3 threads(MATRIX_DIM_X, MATRIX_DIM_Y);
+
+    hipLaunchKernelGGL(copy_matrix_batched_kernel<T>,
+                       grid,
+                       threads,
+                       0,
+                       stream,
+                       m,
+                       n,
+                       src,
+                       lds,
+                       dst,
+                       ldd,
+                       batch_count);
+    return hipGetLastError();
+}
+
+// clang-format off
+template hipError_t hipblas_scatter_strided_to_batched<float>(hipStream_t, int, const float*, int64_t, float* const[], int);
+template hipError_t hipblas_scatter_strided_to_batched<double>(hipStream_t, int, const double*, int64_t, double* const[], int);
+template hipError_t hipblas_scatter_strided_to_batched<hipblasComplex>(hipStream_t, int, const hipblasComplex*, int64_t, hipblasComplex* const[], int);
+template hipError_t hipblas_scatter_strided_to_batched<hipblasDoubleComplex>(hipStream_t, int, const hipblasDoubleComplex*, int64_t, hipblasDoubleComplex* const[], int);
+template hipError_t hipblas_gather_batched_to_strided<float>(hipStream_t, int, const float* const[], int64_t, float*, int64_t, int);
+template hipError_t hipblas_gather_batched_to_strided<double>(hipStream_t, int, const double* const[], int64_t, double*, int64_t, int);
+template hipError_t hipblas_gather_batched_to_strided<hipblasComplex>(hipStream_t, int, const hipblasComplex* const[], int64_t, hipblasComplex*, int64_t, int);
+template hipError_t hipblas_gather_batched_to_strided<hipblasDoubleComplex>(hipStream_t, int, const hipblasDoubleComplex* const[], int64_t, hipblasDoubleComplex*, int64_t, int);
+template hipError_t hipblas_strided_pointer_array<float>(hipStream_t, float*, int64_t, float**, int);
+template hipError_t hipblas_strided_pointer_array<double>(hipStream_t, double*, int64_t, double**, int);
+template hipError_t hipblas_strided_pointer_array<hipblasComplex>(hipStream_t, hipblasComplex*, int64_t, hipblasComplex**, int);
+template hipError_t hipblas_strided_pointer_array<hipblasDoubleComplex>(hipStream_t, hipblasDoubleComplex*, int64_t, hipblasDoubleComplex**, int);
+template hipError_t hipblas_strided_pointer_array<int8_t>(hipStream_t, int8_t*, int64_t, int8_t**, int);
+template hipError_t hipblas_copy_matrix_batched<float>(hipStream_t, int, int, const float* const[], int64_t, float* const[], int64_t, int);
+template hipError_t hipblas_copy_matrix_batched<double>(hipStream_t, int, int, const double* const[], int64_t, double* const[], int64_t, int);
+template hipError_t hipblas_copy_matrix_batched<hipblasComplex>(hipStream_t, int, int, const hipblasComplex* const[], int64_t, hipblasComplex* const[], int64_t, int);
+template hipError_t hipblas_copy_matrix_batched<hipblasDoubleComplex>(hipStream_t, int, int, const hipblasDoubleComplex* const[], int64_t, hipblasDoubleComplex* const[], int64_t, int);
+template hipError_t hipblas_copy_matrix_batched<hipblasHalf>(hipStream_t, int, int, const hipblasHalf* const[], int64_t, hipblasHalf* const[], int64_t, int);
+template hipError_t hipblas_copy_matrix_batched<int8_t>(hipStream_t, int, int, const int8_t* const[], int64_t, int8_t* const[], int64_t, int);
+// clang-format on
@@ -0,0 +1,544 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "hipblas_kernels.h"
+#include <algorithm>
+#include <cstring>
+#include <hip/hip_runtime.h>
+
+namespace
+{
+    // One thread per matrix, so consecutive threads touch consecutive addresses at every step
+    constexpr int COMPACT_DIM_X = 256;
+
+    constexpr int MAX_GRID_Y = 65535;
+
+    template <typename E>
+    struct arith
+    {
+        using real = E;
+        __device__ static E    zero() { return 0; }
+        __device__ static E    add(E a, E b) { return a + b; }
+        __device__ static E    sub(E a, E b) { return a - b; }
+        __device__ static E    mul(E a, E b) { return a * b; }
+        __device__ static E    div(E a, E b) { return a / b; }
+        __device__ static E    conj(E a) { return a; }
+        __device__ static real abs1(E a) { return a < 0 ? -a : a; }
+        __device__ static bool is_zero(E a) { return a == 0; }
+    };
+
+    template <typename R>
+    struct arith<hip_complex_number<R>>
+    {
+        using E    = hip_complex_number<R>;
+        using real = R;
+        __device__ static E    zero() { return {0, 0}; }
+        __device__ static E    add(E a, E b) { return {a.x + b.x, a.y + b.y}; }
+        __device__ static E    sub(E a, E b) { return {a.x - b.x, a.y - b.y}; }
+        __device__ static E    mul(E a, E b) { return {a.x * b.x - a.y * b.y, a.x * b.y + a.y * b.x}; }
+        __device__ static E    div(E a, E b)
+        {
+            R d = b.x * b.x + b.y * b.y;
+            return {(a.x * b.x + a.y * b.y) / d, (a.y * b.x - a.x * b.y) / d};
+        }
+        __device__ static E conj(E a) { return {a.x, -a.y}; }
+        // |re| + |im|, the magnitude LAPACK pivots on for complex matrices
+        __device__ static real abs1(E a) { return (a.x < 0 ? -a.x : a.x) + (a.y < 0 ? -a.y : a.y); }
+        __device__ static bool is_zero(E a) { return a.x == 0 && a.y == 0; }
+    };
+
+    // One thread's matrix of a compact array: ptr is offset to its batch, and consecutive
+    // elements of the matrix are batch_count apart
+    template <typename E>
+    struct compact_matrix
+    {
+        E*      ptr;
+        int64_t ld;
+        int64_t batch_count;
+
+        __device__ E& operator()(int i, int j) const
+        {
+            return ptr[(i + j * ld) * batch_count];
+        }
+    };
+
+    template <typename E>
+    __device__ compact_matrix<E> compact_at(E* base, int64_t ld, int b, int batch_count)
+    {
+        return {base + b, ld, batch_count};
+    }
+
+    // Element (i, j) of op(A)
+    template <typename E>
+    __device__ E op_element(hipblasOperation_t trans, compact_matrix<const E> A, int i, int j)
+    {
+        if(trans == HIPBLAS_OP_N)
+            return A(i, j);
+        E a = A(j, i);
+        return trans == HIPBLAS_OP_C ? arith<E>::conj(a) : a;
+    }
+
+    // B = inv(op(A)) * B on the left, or B * inv(op(A)) on the right, for one thread's m x n B and
+    // triangular A. lower is the triangle of op(A), not of A
+    template <typename E>
+    __device__ void solve_triangular(bool                    left,
+                                     bool                    lower,
+                                     hipblasOperation_t      trans,
+                                     bool                    unit,
+                                     int                     m,
+                                     int                     n,
+                                     compact_matrix<const E> A,
+                                     compact_matrix<E>       B)
+    {
+        if(left)
+        {
+            for(int j = 0; j < n; j++)
+                for(int s = 0; s < m; s++)
+                {
+                    int i = lower ? s : m - 1 - s;
+                    E   x = B(i, j);
+                    for(int l = lower ? 0 : i + 1; l < (lower ? i : m); l++)
+                        x = arith<E>::sub(x, arith<E>::mul(op_element(trans, A, i, l), B(l, j)));
+                    B(i, j) = unit ? x : arith<E>::div(x, op_element(trans, A, i, i));
+                }
+        }
+        else
+        {
+            for(int i = 0; i < m; i++)
+                for(int s = 0; s < n; s++)
+                {
+                    int j = lower ? n - 1 - s : s;
+                    E   x = B(i, j);
+                    for(int l = lower ? j + 1 : 0; l < (lower ? n : j); l++)
+                        x = arith<E>::sub(x, arith<E>::mul(B(i, l), op_element(trans, A, l, j)));
+                    B(i, j) = unit ? x : arith<E>::div(x, op_element(trans, A, j, j));
+                }
+        }
+    }
+
+    // Rows j and ipiv(j) - 1 of B swapped for each j, in increasing order unless reverse is set
+    template <typename E>
+    __device__ void swap_rows(
+        int n, int nrhs, compact_matrix<const int> ipiv, bool reverse, compact_matrix<E> B)
+    {
+        for(int s = 0; s < n; s++)
+        {
+            int j = reverse ? n - 1 - s : s;
+            int p = ipiv(j, 0) - 1;
+            if(p != j)
+                for(int c = 0; c < nrhs; c++)
+                {
+                    E t     = B(j, c);
+                    B(j, c) = B(p, c);
+                    B(p, c) = t;
+                }
+        }
+    }
+
+    // Block y of the grid steps through the columns, and the threads of a block through the
+    // batches, so the compact side of every copy coalesces
+    template <typename E>
+    __global__ void compact_copy_kernel(bool     to_compact,
+                                        int      m,
+                                        int      n,
+                                        const E* src,
+                                        int64_t  lds,
+                                        E*       dst,
+                                        int64_t  ldd,
+                                        int64_t  stride,
+                                        int      batch_count)
+    {
+        int b = blockIdx.x * blockDim.x + threadIdx.x;
+        if(b >= batch_count)
+            return;
+
+        for(int j = blockIdx.y; j < n; j += gridDim.y)
+            for(int i = 0; i < m; i++)
+            {
+                if(to_compact)
+                    dst[(i + j * ldd) * batch_count + b] = src[b * stride + i + j * lds];
+                else
+                    dst[b * stride + i + j * ldd] = src[(i + j * lds) * batch_count + b];
+            }
+    }
+
+    // The scalars are read through alpha_dev and beta_dev in device pointer mode
+    template <typename E>
+    __global__ void gemm_compact_kernel(hipblasOperation_t transa,
+                                        hipblasOperation_t transb,
+                                        int                m,
+                                        int                n,
+                                        int                k,
+                                        E                  alpha,
+                                        E                  beta,
+                                        const E*           alpha_dev,
+                                        const E*           beta_dev,
+                                        const E*           A,
+                                        int64_t            lda,
+                                        const E*           B,
+                                        int64_t            ldb,
+                                        E*                 C,
+                                        int64_t            ldc,
+                                        int                batch_count)
+    {
+        int b = blockIdx.x * blockDim.x + threadIdx.x;
+        if(b >= batch_count)
+            return;
+
+        E alpha_b = alpha_dev ? *alpha_dev : alpha;
+        E beta_b  = beta_dev ? *beta_dev : beta;
+
+        compact_matrix<const E> a  = compact_at(A, lda, b, batch_count);
+        compact_matrix<const E> bb = compact_at(B, ldb, b, batch_count);
+        compact_matrix<E>       c  = compact_at(C, ldc, b, batch_count);
+        for(int j = 0; j < n; j++)
+            for(int i = 0; i < m; i++)
+            {
+                E sum = arith<E>::zero();
+                if(!arith<E>::is_zero(alpha_b))
+                    for(int l = 0; l < k; l++)
+                        sum = arith<E>::add(sum,
+                                            arith<E>::mul(op_element(transa, a, i, l),
+                                                          op_element(transb, bb, l, j)));
+                E r = arith<E>::mul(alpha_b, sum);
+                if(!arith<E>::is_zero(beta_b))
+                    r = arith<E>::add(r, arith<E>::mul(beta_b, c(i, j)));
+                c(i, j) = r;
+            }
+    }
+
+    template <typename E>
+    __global__ void trsm_compact_kernel(bool               left,
+                                        bool               lower,
+                                        hipblasOperation_t trans,
+                                        bool               unit,
+                                        int                m,
+                                        int                n,
+                                        E                  alpha,
+                                        const E*           alpha_dev,
+                                        const E*           A,
+                                        int64_t            lda,
+                                        E*                 B,
+                                        int64_t            ldb,
+                                        int                batch_count)
+    {
+        int b = blockIdx.x * blockDim.x + threadIdx.x;
+        if(b >= batch_count)
+            return;
+
+        E                 alpha_b = alpha_dev ? *alpha_dev : alpha;
+        compact_matrix<E> bb      = compact_at(B, ldb, b, batch_count);
+        for(int j = 0; j < n; j++)
+            for(int i = 0; i < m; i++)
+                bb(i, j) = arith<E>::is_zero(alpha_b) ? arith<E>::zero()
+                                                      : arith<E>::mul(alpha_b, bb(i, j));
+        if(!arith<E>::is_zero(alpha_b))
+            solve_triangular(
+                left, lower, trans, unit, m, n, compact_at(A, lda, b, batch_count), bb);
+    }
+
+    // LU with partial pivoting, as getrf: a zero pivot sets info to its 1-based column if it is
+    // the first, and that column is left uneliminated
+    template <typename E>
+    __global__ void
+        getrf_compact_kernel(int n, E* A, int64_t lda, int* ipiv, int* info, int batch_count)
+    {
+        using real = typename arith<E>::real;
+
+        int b = blockIdx.x * blockDim.x + threadIdx.x;
+        if(b >= batch_count)
+            return;
+
+        compact_matrix<E>   a        = compact_at(A, lda, b, batch_count);
+        compact_matrix<int> p        = compact_at(ipiv, 1, b, batch_count);
+        int                 singular = 0;
+        for(int j = 0; j < n; j++)
+        {
+            int  r    = j;
+            real best = arith<E>::abs1(a(j, j));
+            for(int i = j + 1; i < n; i++)
+            {
+                real v = arith<E>::abs1(a(i, j));
+                if(v > best)
+                {
+                    best = v;
+                    r    = i;
+                }
+            }
+            p(j, 0) = r + 1;
+
+            if(arith<E>::is_zero(a(r, j)))
+            {
+                if(!singular)
+                    singular = j + 1;
+                continue;
+            }
+
+            if(r != j)
+                for(int c = 0; c < n; c++)
+                {
+                    E t     = a(j, c);
+                    a(j, c) = a(r, c);
+                    a(r, c) = t;
+                }
+
+            E pivot = a(j, j);
+            for(int i = j + 1; i < n; i++)
+                a(i, j) = arith<E>::div(a(i, j), pivot);
+            for(int c = j + 1; c < n; c++)
+            {
+                E u = a(j, c);
+                for(int i = j + 1; i < n; i++)
+                    a(i, c) = arith<E>::sub(a(i, c), arith<E>::mul(a(i, j), u));
+            }
+        }
+        info[b] = singular;
+    }
+
+    // op(A) X = B with A = P L U from getrf: the row swaps, then L and U, for trans N, and the
+    // transposed factors in the opposite order for trans T and C
+    template <typename E>
+    __global__ void getrs_compact_kernel(hipblasOperation_t trans,
+                                         int                n,
+                                         int                nrhs,
+                                         const E*           A,
+                                         int64_t            lda,
+                                         const int*         ipiv,
+                                         E*                 B,
+                                         int64_t            ldb,
+                                         int                batch_count)
+    {
+        int b = blockIdx.x * blockDim.x + threadIdx.x;
+        if(b >= batch_count)
+            return;
+
+        compact_matrix<const E>   a  = compact_at(A, lda, b, batch_count);
+        compact_matrix<const int> p  = compact_at(ipiv, 1, b, batch_count);
+        compact_matrix<E>         bb = compact_at(B, ldb, b, batch_count);
+        if(trans == HIPBLAS_OP_N)
+        {
+            swap_rows(n, nrhs, p, false, bb);
+            solve_triangular(true, true, trans, true, n, nrhs, a, bb);
+            solve_triangular(true, false, trans, false, n, nrhs, a, bb);
+        }
+        else
+        {
+            solve_triangular(true, true, trans, false, n, nrhs, a, bb);
+            solve_triangular(true, false, trans, true, n, nrhs, a, bb);
+            swap_rows(n, nrhs, p, true, bb);
+        }
+    }
+
+    template <typename E, typename T>
+    E host_scalar(const T* value, bool device_scalars)
+    {
+        E v = {};
+        if(!device_scalars)
+            std::memcpy(&v, value, sizeof(E));
+        return v;
+    }
+
+    dim3 compact_grid(int batch_count, int y = 1)
+    {
+        return dim3((batch_count - 1) / COMPACT_DIM_X + 1, y);
+    }
+}
+
+template <typename T>
+hipError_t hipblas_compact_pack(hipStream_t stream,
+                                bool        unpack,
+                                int         m,
+                                int         n,
+                                const T*    src,
+                                int64_t     lds,
+                                T*          dst,
+                                int64_t     ldd,
+                                int64_t     stride,
+                                int         batch_count)
+{
+    if(m <= 0 || n <= 0 || batch_count <= 0)
+        return hipSuccess;
+
+    hipLaunchKernelGGL(compact_copy_kernel<T>,
+                       compact_grid(batch_count, std::min(n, MAX_GRID_Y)),
+                       dim3(COMPACT_DIM_X),
+                       0,
+                       stream,
+                       !unpack,
+                       m,
+                       n,
+                       src,
+                       lds,
+                       dst,
+                       ldd,
+                       stride,
+                       batch_count);
+    return hipGetLastError();
+}
+
+template <typename T>
+hipError_t hipblas_gemm_compact(hipStream_t        stream,
+                                hipblasOperation_t transa,
+                                hipblasOperation_t transb,
+                                int                m,
+                                int                n,
+                                int                k,
+                                const T*           alpha,
+                                const T*           beta,
+                                bool               device_scalars,
+                                const T*           A,
+                                int64_t            lda,
+                                const T*           B,
+                                int64_t            ldb,
+                                T*                 C,
+                                int64_t            ldc,
+                                int                batch_count)
+{
+    if(m <= 0 || n <= 0 || batch_count <= 0)
+        return hipSuccess;
+
+    hipLaunchKernelGGL(gemm_compact_kernel<T>,
+                       compact_grid(batch_count),
+                       dim3(COMPACT_DIM_X),
+                       0,
+                       stream,
+                       transa,
+                       transb,
+                       m,
+                       n,
+                       k,
+                       host_scalar<T>(alpha, device_scalars),
+                       host_scalar<T>(beta, device_scalars),
+                       device_scalars ? alpha : nullptr,
+                       device_scalars ? beta : nullptr,
+                       A,
+                       lda,
+                       B,
+                       ldb,
+                       C,
+                       ldc,
+                       batch_count);
+    return hipGetLastError();
+}
+
+template <typename T>
+hipError_t hipblas_trsm_compact(hipStream_t        stream,
+                                hipblasSideMode_t  side,
+                                hipblasFillMode_t  uplo,
+                                hipblasOperation_t trans,
+                                hipblasDiagType_t  diag,
+                                int                m,
+                                int                n,
+                                const T*           alpha,
+                                bool               device_scalars,
+                                const T*           A,
+                                int64_t            lda,
+                                T*                 B,
+                                int64_t            ldb,
+                                int                batch_count)
+{
+    if(m <= 0 || n <= 0 || batch_count <= 0)
+        return hipSuccess;
+
+    hipLaunchKernelGGL(trsm_compact_kernel<T>,
+                       compact_grid(batch_count),
+                       dim3(COMPACT_DIM_X),
+                       0,
+                       stream,
+                       side == HIPBLAS_SIDE_LEFT,
+                       (uplo == HIPBLAS_FILL_MODE_LOWER) == (trans == HIPBLAS_OP_N),
+                       trans,
+                       diag == HIPBLAS_DIAG_UNIT,
+                       m,
+                       n,
+                       host_scalar<T>(alpha, device_scalars),
+                       device_scalars ? alpha : nullptr,
+                       A,
+                       lda,
+                       B,
+                       ldb,
+                       batch_count);
+    return hipGetLastError();
+}
+
+template <typename T>
+hipError_t hipblas_getrf_compact(
+    hipStream_t stream, int n, T* A, int64_t lda, int* ipiv, int* info, int batch_count)
+{
+    if(batch_count <= 0)
+        return hipSuccess;
+
+    hipLaunchKernelGGL(getrf_compact_kernel<T>,
+                       compact_grid(batch_count),
+                       dim3(COMPACT_DIM_X),
+                       0,
+                       stream,
+                       n,
+                       A,
+                       lda,
+                       ipiv,
+                       info,
+                       batch_count);
+    return hipGetLastError();
+}
+
+template <typename T>
+hipError_t hipblas_getrs_compact(hipStream_t        stream,
+                                 hipblasOperation_t trans,
+                                 int                n,
+                                 int                nrhs,
+                                 const T*           A,
+                                 int64_t            lda,
+                                 const int*         ipiv,
+                                 T*                 B,
+                                 int64_t            ldb,
+                                 int                batch_count)
+{
+    if(n <= 0 || nrhs <= 0 || batch_count <= 0)
+        return hipSuccess;
+
+    hipLaunchKernelGGL(getrs_compact_kernel<T>,
+                       compact_grid(batch_count),
+                       dim3(COMPACT_DIM_X),
+                       0,
+                       stream,
+                       trans,
+                       n,
+                       nrhs,
+                       A,
+                       lda,
+                       ipiv,
+                       B,
+                       ldb,
+                       batch_count);
+    return hipGetLastError();
+}
+
+// clang-format off
+template hipError_t hipblas_compact_pack<float>(hipStream_t, bool, int, int, const float*, int64_t, float*, int64_t, int64_t, int);
+template hipError_t hipblas_compact_pack<double>(hipStream_t, bool, int, int, const double*, int64_t, double*, int64_t, int64_t, int);
+template hipError_t hipblas_compact_pack<hipblasComplex>(hipStream_t, bool, int, int, const hipblasComplex*, int64_t, hipblasComplex*, int64_t, int64_t, int);
+template hipError_t hipblas_compact_pack<hipblasDoubleComplex>(hipStream_t, bool, int, int, const hipblasDoubleComplex*, int64_t, hipblasDoubleComplex*, int64_t, int64_t, int);
+
+template hipError_t hipblas_gemm_compact<float>(hipStream_t, hipblasOperation_t, hipblasOperation_t, int, int, int, const float*, const float*, bool, const float*, int64_t, const float*, int64_t, float*, int64_t, int);
+template hipError_t hipblas_gemm_compact<double>(hipStream_t, hipblasOperation_t, hipblasOperation_t, int, int, int, const double*, const double*, bool, const double*, int64_t, const double*, int64_t, double*, int64_t, int);
+template hipError_t hipblas_gemm_compact<hipblasComplex>(hipStream_t, hipblasOperation_t, hipblasOperation_t, int, int, int, const hipblasComplex*, const hipblasComplex*, bool, const hipblasComplex*, int64_t, const hipblasComplex*, int64_t, hipblasComplex*, int64_t, int);
+template hipError_t hipblas_gemm_compact<hipblasDoubleComplex>(hipStream_t, hipblasOperation_t, hipblasOperation_t, int, int, int, const hipblasDoubleComplex*, const hipblasDoubleComplex*, bool, const hipblasDoubleComplex*, int64_t, const hipblasDoubleComplex*, int64_t, hipblasDoubleComplex*, int64_t, int);
+
+template hipError_t hipblas_trsm_compact<float>(hipStream_t, hipblasSideMode_t, hipblasFillMode_t, hipblasOperation_t, hipblasDiagType_t, int, int, const float*, bool, const float*, int64_t, float*, int64_t, int);
+template hipError_t hipblas_trsm_compact<double>(hipStream_t, hipblasSideMode_t, hipblasFillMode_t, hipblasOperation_t, hipblasDiagType_t, int, int, const double*, bool, const double*, int64_t, double*, int64_t, int);
+template hipError_t hipblas_trsm_compact<hipblasComplex>(hipStream_t, hipblasSideMode_t, hipblasFillMode_t, hipblasOperation_t, hipblasDiagType_t, int, int, const hipblasComplex*, bool, const hipblasComplex*, int64_t, hipblasComplex*, int64_t, int);
+template hipError_t hipblas_trsm_compact<hipblasDoubleComplex>(hipStream_t, hipblasSideMode_t, hipblasFillMode_t, hipblasOperation_t, hipblasDiagType_t, int, int, const hipblasDoubleComplex*, bool, const hipblasDoubleComplex*, int64_t, hipblasDoubleComplex*, int64_t, int);
+
+template hipError_t hipblas_getrf_compact<float>(hipStream_t, int, float*, int64_t, int*, int*, int);
+template hipError_t hipblas_getrf_compact<double>(hipStream_t, int, double*, int64_t, int*, int*, int);
+template hipError_t hipblas_getrf_compact<hipblasComplex>(hipStream_t, int, hipblasComplex*, int64_t, int*, int*, int);
+template hipError_t hipblas_getrf_compact<hipblasDoubleComplex>(hipStream_t, int, hipblasDoubleComplex*, int64_t, int*, int*, int);
+
+template hipError_t hipblas_getrs_compact<float>(hipStream_t, hipblasOperation_t, int, int, const float*, int64_t, const int*, float*, int64_t, int);
+template hipError_t hipblas_getrs_compact<double>(hipStream_t, hipblasOperation_t, int, int, const double*, int64_t, const int*, double*, int64_t, int);
+template hipError_t hipblas_getrs_compact<hipblasComplex>(hipStream_t, hipblasOperation_t, int, int, const hipblasComplex*, int64_t, const int*, hipblasComplex*, int64_t, int);
+template hipError_t hipblas_getrs_compact<hipblasDoubleComplex>(hipStream_t, hipblasOperation_t, int, int, const hipblasDoubleComplex*, int64_t, const int*, hipblasDoubleComplex*, int64_t, int);
+// clang-format on
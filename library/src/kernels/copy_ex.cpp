@@ -0,0 +1,571 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "hipblas_kernels.h"
+#include <algorithm>
+#include <cfloat>
+#include <hip/hip_fp16.h>
+#include <hip/hip_runtime.h>
+
+namespace
+{
+    constexpr int COPY_DIM_X = 256;
+
+    // Tiles of op(A) and op(B) pass through shared memory, so transposed operands are read and C
+    // written along columns
+    constexpr int TILE_DIM   = 32;
+    constexpr int TILE_DIM_Y = 8;
+
+    constexpr int MAX_GRID_X     = 1024;
+    constexpr int MAX_GRID_Y     = 65535;
+    constexpr int MAX_GRID_BATCH = 65535;
+
+    // Round to nearest even, keeping NaNs quiet
+    __device__ hipblasBfloat16 float_to_bfloat16(float x)
+    {
+        uint32_t u = __float_as_uint(x);
+        if((u & 0x7fffffff) > 0x7f800000)
+            return {uint16_t((u >> 16) | 0x40)};
+        u += 0x7fff + ((u >> 16) & 1);
+        return {uint16_t(u >> 16)};
+    }
+
+    // v, or a zero of its sign when it is below the smallest normal number of type, 2^-14 for
+    // R_16F. An R narrower than type has no numbers that small to flush
+    template <typename R>
+    __device__ R flush_subnormal(R v, hipblasDatatype_t type)
+    {
+        double smallest = FLT_MIN;
+        if(type == HIPBLAS_R_16F)
+            smallest = 6.103515625e-05;
+        else if(type == HIPBLAS_R_64F || type == HIPBLAS_C_64F)
+            smallest = DBL_MIN;
+        return (v < 0 ? -v : v) < R(smallest) ? v * R(0) : v;
+    }
+
+    // Element i of p, of the given type, read as and written from the execution type E. The types
+    // are checked on the host, so the switches only see those of E's kind. With FLUSH, for
+    // HIPBLAS_FLUSH_DENORM_MATH, values subnormal in the type they are read from or written to
+    // are taken as zero
+    template <typename E, bool FLUSH = false>
+    struct element
+    {
+        __device__ static E load(const void* p, hipblasDatatype_t type, int64_t i)
+        {
+            E v;
+            switch(type)
+            {
+            case HIPBLAS_R_16F:
+                v = __half2float(__ushort_as_half(static_cast<const hipblasHalf*>(p)[i]));
+                break;
+            case HIPBLAS_R_16B:
+                v = __uint_as_float(uint32_t(static_cast<const hipblasBfloat16*>(p)[i].data) << 16);
+                break;
+            case HIPBLAS_R_32F:
+                v = static_cast<const float*>(p)[i];
+                break;
+            default:
+                v = static_cast<const double*>(p)[i];
+            }
+            return FLUSH ? flush_subnormal(v, type) : v;
+        }
+
+        __device__ static void store(void* p, hipblasDatatype_t type, int64_t i, E v)
+        {
+            if(FLUSH)
+                v = flush_subnormal(v, type);
+            switch(type)
+            {
+            case HIPBLAS_R_16F:
+                static_cast<hipblasHalf*>(p)[i] = __half_as_ushort(__float2half(float(v)));
+                break;
+            case HIPBLAS_R_16B:
+                static_cast<hipblasBfloat16*>(p)[i] = float_to_bfloat16(float(v));
+                break;
+            case HIPBLAS_R_32F:
+                static_cast<float*>(p)[i] = float(v);
+                break;
+            default:
+                static_cast<double*>(p)[i] = v;
+            }
+        }
+
+        __device__ static E conj(E a)
+        {
+            return a;
+        }
+    };
+
+    template <typename R, bool FLUSH>
+    struct element<hip_complex_number<R>, FLUSH>
+    {
+        using E = hip_complex_number<R>;
+
+        __device__ static E flush(E v, hipblasDatatype_t type)
+        {
+            return FLUSH ? E{flush_subnormal(v.x, type), flush_subnormal(v.y, type)} : v;
+        }
+
+        __device__ static E load(const void* p, hipblasDatatype_t type, int64_t i)
+        {
+            if(type == HIPBLAS_C_32F)
+            {
+                hipblasComplex a = static_cast<const hipblasComplex*>(p)[i];
+                return flush({a.x, a.y}, type);
+            }
+            hipblasDoubleComplex a = static_cast<const hipblasDoubleComplex*>(p)[i];
+            return flush({R(a.x), R(a.y)}, type);
+        }
+
+        __device__ static void store(void* p, hipblasDatatype_t type, int64_t i, E v)
+        {
+            v = flush(v, type);
+            if(type == HIPBLAS_C_32F)
+                static_cast<hipblasComplex*>(p)[i] = {float(v.x), float(v.y)};
+            else
+                static_cast<hipblasDoubleComplex*>(p)[i] = {double(v.x), double(v.y)};
+        }
+
+        __device__ static E conj(E a)
+        {
+            return {a.x, -a.y};
+        }
+    };
+
+    // Strides count elements of the operand's own type, so a batch is found by its pointer and
+    // an element offset
+    template <typename V>
+    __device__ V* batch_base(hipblas_batched_operand<V> op, int b)
+    {
+        return op.array ? op.array[b] : op.ptr;
+    }
+
+    template <typename V>
+    __device__ int64_t batch_offset(hipblas_batched_operand<V> op, int b)
+    {
+        return op.array ? 0 : b * op.stride;
+    }
+
+    template <typename E, bool FLUSH>
+    __global__ void copy_ex_kernel(int                                 n,
+                                   hipblas_batched_operand<const void> x,
+                                   hipblasDatatype_t                   x_type,
+                                   int64_t                             incx,
+                                   hipblas_batched_operand<void>       y,
+                                   hipblasDatatype_t                   y_type,
+                                   int64_t                             incy,
+                                   int                                 batch_count)
+    {
+        int64_t shift_x = incx < 0 ? (1 - int64_t(n)) * incx : 0;
+        int64_t shift_y = incy < 0 ? (1 - int64_t(n)) * incy : 0;
+
+        for(int b = blockIdx.y; b < batch_count; b += gridDim.y)
+        {
+            const void* xb = batch_base(x, b);
+            void*       yb = batch_base(y, b);
+            int64_t     x0 = batch_offset(x, b) + shift_x;
+            int64_t     y0 = batch_offset(y, b) + shift_y;
+            for(int i = blockIdx.x * blockDim.x + threadIdx.x; i < n; i += gridDim.x * blockDim.x)
+            {
+                E v = element<E, FLUSH>::load(xb, x_type, x0 + i * incx);
+                element<E, FLUSH>::store(yb, y_type, y0 + i * incy, v);
+            }
+        }
+    }
+
+    // tile[jl][il] = op(X)(i0 + il, j0 + jl) of the m x n op(X), read along X's columns
+    template <bool FLUSH, typename E>
+    __device__ void load_tile(E (*tile)[TILE_DIM + 1],
+                              hipblasOperation_t trans,
+                              int                m,
+                              int                n,
+                              const void*        X,
+                              hipblasDatatype_t  type,
+                              int64_t            offset,
+                              int64_t            ld,
+                              int                i0,
+                              int                j0)
+    {
+        int t = threadIdx.x;
+        for(int k = threadIdx.y; k < TILE_DIM; k += blockDim.y)
+        {
+            if(trans == HIPBLAS_OP_N)
+            {
+                if(i0 + t < m && j0 + k < n)
+                    tile[k][t]
+                        = element<E, FLUSH>::load(X, type, offset + (i0 + t) + (j0 + k) * ld);
+            }
+            else if(j0 + t < n && i0 + k < m)
+            {
+                E v        = element<E, FLUSH>::load(X, type, offset + (j0 + t) + (i0 + k) * ld);
+                tile[t][k] = trans == HIPBLAS_OP_C ? element<E>::conj(v) : v;
+            }
+        }
+    }
+
+    // One block per TILE_DIM x TILE_DIM tile of C, which is written once both tiles are read, so
+    // an untransposed A or B may be C itself
+    template <typename E, bool FLUSH>
+    __global__ void geam_ex_kernel(hipblasOperation_t                  transA,
+                                   hipblasOperation_t                  transB,
+                                   int                                 m,
+                                   int                                 n,
+                                   E                                   alpha,
+                                   const E*                            alpha_dev,
+                                   E                                   beta,
+                                   const E*                            beta_dev,
+                                   int64_t                             scalar_stride,
+                                   hipblas_batched_operand<const void> A,
+                                   hipblasDatatype_t                   a_type,
+                                   int64_t                             lda,
+                                   hipblas_batched_operand<const void> B,
+                                   hipblasDatatype_t                   b_type,
+                                   int64_t                             ldb,
+                                   hipblas_batched_operand<void>       C,
+                                   hipblasDatatype_t                   c_type,
+                                   int64_t                             ldc,
+                                   int                                 batch_count)
+    {
+        __shared__ E tile_a[TILE_DIM][TILE_DIM + 1];
+        __shared__ E tile_b[TILE_DIM][TILE_DIM + 1];
+
+        int tiles_m = (m - 1) / TILE_DIM + 1;
+        int tiles   = tiles_m * ((n - 1) / TILE_DIM + 1);
+
+        for(int b = blockIdx.y; b < batch_count; b += gridDim.y)
+        {
+            E a = alpha_dev ? alpha_dev[b * scalar_stride] : alpha;
+            E c = beta_dev ? beta_dev[b * scalar_stride] : beta;
+
+            for(int tile = blockIdx.x; tile < tiles; tile += gridDim.x)
+            {
+                int i0 = tile % tiles_m * TILE_DIM;
+                int j0 = tile / tiles_m * TILE_DIM;
+                if(a != E(0))
+                    load_tile<FLUSH>(tile_a,
+                              transA,
+                              m,
+                              n,
+                              batch_base(A, b),
+                              a_type,
+                              batch_offset(A, b),
+                              lda,
+                              i0,
+                              j0);
+                if(c != E(0))
+                    load_tile<FLUSH>(tile_b,
+                              transB,
+                              m,
+                              n,
+                              batch_base(B, b),
+                              b_type,
+                              batch_offset(B, b),
+                              ldb,
+                              i0,
+                              j0);
+                __syncthreads();
+
+                void*   cb = batch_base(C, b);
+                int64_t c0 = batch_offset(C, b);
+                int     i  = i0 + threadIdx.x;
+                for(int k = threadIdx.y; k < TILE_DIM; k += blockDim.y)
+                    if(i < m && j0 + k < n)
+                    {
+                        E v = 0;
+                        if(a != E(0))
+                            v = a * tile_a[k][threadIdx.x];
+                        if(c != E(0))
+                            v = v + c * tile_b[k][threadIdx.x];
+                        element<E, FLUSH>::store(cb, c_type, c0 + i + (j0 + k) * ldc, v);
+                    }
+                __syncthreads();
+            }
+        }
+    }
+
+    // A thread per element of the uplo triangle, or all of the matrix, read along columns
+    template <typename E, bool FLUSH>
+    __global__ void lacpy_ex_kernel(bool                                lower,
+                                    bool                                upper,
+                                    int                                 m,
+                                    int                                 n,
+                                    hipblas_batched_operand<const void> A,
+                                    hipblasDatatype_t                   a_type,
+                                    int64_t                             lda,
+                                    hipblas_batched_operand<void>       B,
+                                    hipblasDatatype_t                   b_type,
+                                    int64_t                             ldb,
+                                    int                                 batch_count)
+    {
+        int i = blockIdx.x * blockDim.x + threadIdx.x;
+        if(i >= m)
+            return;
+
+        for(int b = blockIdx.z; b < batch_count; b += gridDim.z)
+        {
+            const void* ab = batch_base(A, b);
+            void*       bb = batch_base(B, b);
+            int64_t     a0 = batch_offset(A, b);
+            int64_t     b0 = batch_offset(B, b);
+            for(int j = blockIdx.y * blockDim.y + threadIdx.y; j < n; j += gridDim.y * blockDim.y)
+                if((lower || i <= j) && (upper || i >= j))
+                {
+                    E v = element<E, FLUSH>::load(ab, a_type, a0 + i + j * lda);
+                    element<E, FLUSH>::store(bb, b_type, b0 + i + j * ldb, v);
+                }
+        }
+    }
+
+    // y[b] = alpha * x[b] + beta * y[b] for every entry of the batch, without x when it is null
+    // and without reading y when beta is 0; an alpha of 1 takes x as it is. The entries are laid
+    // end to end and each thread of the grid takes every threads-th element of the whole, so all
+    // threads get the same share however uneven the lengths are. Each thread walks the size
+    // arrays, start following where the current entry begins modulo threads, and skips an entry
+    // with n[b] <= 0 or a zero increment
+    template <typename E, bool FLUSH>
+    __global__ void axpby_vbatched_ex_kernel(const int*         n,
+                                             E                  alpha,
+                                             const E*           alpha_dev,
+                                             E                  beta,
+                                             const E*           beta_dev,
+                                             int64_t            scalar_stride,
+                                             const void* const* x,
+                                             hipblasDatatype_t  x_type,
+                                             const int*         incx,
+                                             void* const*       y,
+                                             hipblasDatatype_t  y_type,
+                                             const int*         incy,
+                                             int                batch_count)
+    {
+        int64_t threads = int64_t(gridDim.x) * blockDim.x;
+        int64_t tid     = int64_t(blockIdx.x) * blockDim.x + threadIdx.x;
+        int64_t start   = 0;
+        for(int b = 0; b < batch_count; b++)
+        {
+            int     len = n[b];
+            int64_t ix  = x ? incx[b] : 1;
+            int64_t iy  = incy[b];
+            if(len <= 0 || ix == 0 || iy == 0)
+                continue;
+
+            int64_t first = tid >= start ? tid - start : tid - start + threads;
+            if(first < len)
+            {
+                E           a  = alpha_dev ? alpha_dev[b * scalar_stride] : alpha;
+                E           c  = beta_dev ? beta_dev[b * scalar_stride] : beta;
+                const void* xb = x ? x[b] : nullptr;
+                void*       yb = y[b];
+                int64_t     x0 = ix < 0 ? (1 - int64_t(len)) * ix : 0;
+                int64_t     y0 = iy < 0 ? (1 - int64_t(len)) * iy : 0;
+                for(int64_t i = first; i < len; i += threads)
+                {
+                    E v = 0;
+                    if(xb)
+                    {
+                        E xi = element<E, FLUSH>::load(xb, x_type, x0 + i * ix);
+                        v    = a == E(1) ? xi : a * xi;
+                    }
+                    if(c != E(0))
+                        v = v + c * element<E, FLUSH>::load(yb, y_type, y0 + i * iy);
+                    element<E, FLUSH>::store(yb, y_type, y0 + i * iy, v);
+                }
+            }
+            start = (start + len) % threads;
+        }
+    }
+}
+
+template <typename T>
+hipError_t hipblas_copy_ex_batched(hipStream_t                         stream,
+                                   int                                 n,
+                                   hipblas_batched_operand<const void> x,
+                                   hipblasDatatype_t                   x_type,
+                                   int64_t                             incx,
+                                   hipblas_batched_operand<void>       y,
+                                   hipblasDatatype_t                   y_type,
+                                   int64_t                             incy,
+                                   int                                 batch_count,
+                                   bool                                flush_denorms)
+{
+    if(n <= 0 || batch_count <= 0)
+        return hipSuccess;
+
+    dim3 grid(std::min((n - 1) / COPY_DIM_X + 1, MAX_GRID_X),
+              std::min(batch_count, MAX_GRID_BATCH));
+    auto kernel = flush_denorms ? copy_ex_kernel<T, true> : copy_ex_kernel<T, false>;
+    hipLaunchKernelGGL(kernel,
+                       grid,
+                       dim3(COPY_DIM_X),
+                       0,
+                       stream,
+                       n,
+                       x,
+                       x_type,
+                       incx,
+                       y,
+                       y_type,
+                       incy,
+                       batch_count);
+    return hipGetLastError();
+}
+
+template <typename T>
+hipError_t hipblas_geam_ex_batched(hipStream_t                         stream,
+                                   hipblasOperation_t                  transA,
+                                   hipblasOperation_t                  transB,
+                                   int                                 m,
+                                   int                                 n,
+                                   const T*                            alpha,
+                                   const T*                            beta,
+                                   bool                                device_scalars,
+                                   int64_t                             scalar_stride,
+                                   hipblas_batched_operand<const void> A,
+                                   hipblasDatatype_t                   a_type,
+                                   int64_t                             lda,
+                                   hipblas_batched_operand<const void> B,
+                                   hipblasDatatype_t                   b_type,
+                                   int64_t                             ldb,
+                                   hipblas_batched_operand<void>       C,
+                                   hipblasDatatype_t                   c_type,
+                                   int64_t                             ldc,
+                                   int                                 batch_count,
+                                   bool                                flush_denorms)
+{
+    if(m <= 0 || n <= 0 || batch_count <= 0)
+        return hipSuccess;
+
+    int64_t tiles = int64_t((m - 1) / TILE_DIM + 1) * ((n - 1) / TILE_DIM + 1);
+    dim3    grid(int(std::min<int64_t>(tiles, MAX_GRID_X)),
+              std::min(batch_count, MAX_GRID_BATCH));
+    auto    kernel = flush_denorms ? geam_ex_kernel<T, true> : geam_ex_kernel<T, false>;
+    hipLaunchKernelGGL(kernel,
+                       grid,
+                       dim3(TILE_DIM, TILE_DIM_Y),
+                       0,
+                       stream,
+                       transA,
+                       transB,
+                       m,
+                       n,
+                       device_scalars ? T(0) : *alpha,
+                       device_scalars ? alpha : nullptr,
+                       device_scalars ? T(0) : *beta,
+                       device_scalars ? beta : nullptr,
+                       scalar_stride,
+                       A,
+                       a_type,
+                       lda,
+                       B,
+                       b_type,
+                       ldb,
+                       C,
+                       c_type,
+                       ldc,
+                       batch_count);
+    return hipGetLastError();
+}
+
+template <typename T>
+hipError_t hipblas_lacpy_ex_batched(hipStream_t                         stream,
+                                    hipblasFillMode_t                   uplo,
+                                    int                                 m,
+                                    int                                 n,
+                                    hipblas_batched_operand<const void> A,
+                                    hipblasDatatype_t                   a_type,
+                                    int64_t                             lda,
+                                    hipblas_batched_operand<void>       B,
+                                    hipblasDatatype_t                   b_type,
+                                    int64_t                             ldb,
+                                    int                                 batch_count,
+                                    bool                                flush_denorms)
+{
+    if(m <= 0 || n <= 0 || batch_count <= 0)
+        return hipSuccess;
+
+    dim3 grid((m - 1) / TILE_DIM + 1,
+              std::min((n - 1) / TILE_DIM_Y + 1, MAX_GRID_Y),
+              std::min(batch_count, MAX_GRID_BATCH));
+    auto kernel = flush_denorms ? lacpy_ex_kernel<T, true> : lacpy_ex_kernel<T, false>;
+    hipLaunchKernelGGL(kernel,
+                       grid,
+                       dim3(TILE_DIM, TILE_DIM_Y),
+                       0,
+                       stream,
+                       uplo != HIPBLAS_FILL_MODE_UPPER,
+                       uplo != HIPBLAS_FILL_MODE_LOWER,
+                       m,
+                       n,
+                       A,
+                       a_type,
+                       lda,
+                       B,
+                       b_type,
+                       ldb,
+                       batch_count);
+    return hipGetLastError();
+}
+
+template <typename T>
+hipError_t hipblas_axpby_vbatched_ex(hipStream_t        stream,
+                                     const int*         n,
+                                     T                  alpha,
+                                     const T*           alpha_dev,
+                                     T                  beta,
+                                     const T*           beta_dev,
+                                     int64_t            scalar_stride,
+                                     const void* const* x,
+                                     hipblasDatatype_t  x_type,
+                                     const int*         incx,
+                                     void* const*       y,
+                                     hipblasDatatype_t  y_type,
+                                     const int*         incy,
+                                     int                batch_count,
+                                     bool               flush_denorms)
+{
+    if(batch_count <= 0)
+        return hipSuccess;
+
+    // The lengths are only known on the device, so the grid is as wide as the copies' widest
+    auto kernel
+        = flush_denorms ? axpby_vbatched_ex_kernel<T, true> : axpby_vbatched_ex_kernel<T, false>;
+    hipLaunchKernelGGL(kernel,
+                       dim3(MAX_GRID_X),
+                       dim3(COPY_DIM_X),
+                       0,
+                       stream,
+                       n,
+                       alpha,
+                       alpha_dev,
+                       beta,
+                       beta_dev,
+                       scalar_stride,
+                       x,
+                       x_type,
+                       incx,
+                       y,
+                       y_type,
+                       incy,
+                       batch_count);
+    return hipGetLastError();
+}
+
+// clang-format off
+template hipError_t hipblas_copy_ex_batched<float>(hipStream_t, int, hipblas_batched_operand<const void>, hipblasDatatype_t, int64_t, hipblas_batched_operand<void>, hipblasDatatype_t, int64_t, int, bool);
+template hipError_t hipblas_copy_ex_batched<double>(hipStream_t, int, hipblas_batched_operand<const void>, hipblasDatatype_t, int64_t, hipblas_batched_operand<void>, hipblasDatatype_t, int64_t, int, bool);
+template hipError_t hipblas_copy_ex_batched<hipblasComplex>(hipStream_t, int, hipblas_batched_operand<const void>, hipblasDatatype_t, int64_t, hipblas_batched_operand<void>, hipblasDatatype_t, int64_t, int, bool);
+template hipError_t hipblas_copy_ex_batched<hipblasDoubleComplex>(hipStream_t, int, hipblas_batched_operand<const void>, hipblasDatatype_t, int64_t, hipblas_batched_operand<void>, hipblasDatatype_t, int64_t, int, bool);
+template hipError_t hipblas_geam_ex_batched<float>(hipStream_t, hipblasOperation_t, hipblasOperation_t, int, int, const float*, const float*, bool, int64_t, hipblas_batched_operand<const void>, hipblasDatatype_t, int64_t, hipblas_batched_operand<const void>, hipblasDatatype_t, int64_t, hipblas_batched_operand<void>, hipblasDatatype_t, int64_t, int, bool);
+template hipError_t hipblas_geam_ex_batched<double>(hipStream_t, hipblasOperation_t, hipblasOperation_t, int, int, const double*, const double*, bool, int64_t, hipblas_batched_operand<const void>, hipblasDatatype_t, int64_t, hipblas_batched_operand<const void>, hipblasDatatype_t, int64_t, hipblas_batched_operand<void>, hipblasDatatype_t, int64_t, int, bool);
+template hipError_t hipblas_geam_ex_batched<hipblasComplex>(hipStream_t, hipblasOperation_t, hipblasOperation_t, int, int, const hipblasComplex*, const hipblasComplex*, bool, int64_t, hipblas_batched_operand<const void>, hipblasDatatype_t, int64_t, hipblas_batched_operand<const void>, hipblasDatatype_t, int64_t, hipblas_batched_operand<void>, hipblasDatatype_t, int64_t, int, bool);
+template hipError_t hipblas_geam_ex_batched<hipblasDoubleComplex>(hipStream_t, hipblasOperation_t, hipblasOperation_t, int, int, const hipblasDoubleComplex*, const hipblasDoubleComplex*, bool, int64_t, hipblas_batched_operand<const void>, hipblasDatatype_t, int64_t, hipblas_batched_operand<const void>, hipblasDatatype_t, int64_t, hipblas_batched_operand<void>, hipblasDatatype_t, int64_t, int, bool);
+template hipError_t hipblas_lacpy_ex_batched<float>(hipStream_t, hipblasFillMode_t, int, int, hipblas_batched_operand<const void>, hipblasDatatype_t, int64_t, hipblas_batched_operand<void>, hipblasDatatype_t, int64_t, int, bool);
+template hipError_t hipblas_lacpy_ex_batched<double>(hipStream_t, hipblasFillMode_t, int, int, hipblas_batched_operand<const void>, hipblasDatatype_t, int64_t, hipblas_batched_operand<void>, hipblasDatatype_t, int64_t, int, bool);
+template hipError_t hipblas_lacpy_ex_batched<hipblasComplex>(hipStream_t, hipblasFillMode_t, int, int, hipblas_batched_operand<const void>, hipblasDatatype_t, int64_t, hipblas_batched_operand<void>, hipblasDatatype_t, int64_t, int, bool);
+template hipError_t hipblas_lacpy_ex_batched<hipblasDoubleComplex>(hipStream_t, hipblasFillMode_t, int, int, hipblas_batched_operand<const void>, hipblasDatatype_t, int64_t, hipblas_batched_operand<void>, hipblasDatatype_t, int64_t, int, bool);
+template hipError_t hipblas_axpby_vbatched_ex<float>(hipStream_t, const int*, float, const float*, float, const float*, int64_t, const void* const*, hipblasDatatype_t, const int*, void* const*, hipblasDatatype_t, const int*, int, bool);
+template hipError_t hipblas_axpby_vbatched_ex<double>(hipStream_t, const int*, double, const double*, double, const double*, int64_t, const void* const*, hipblasDatatype_t, const int*, void* const*, hipblasDatatype_t, const int*, int, bool);
+template hipError_t hipblas_axpby_vbatched_ex<hipblasComplex>(hipStream_t, const int*, hipblasComplex, const hipblasComplex*, hipblasComplex, const hipblasComplex*, int64_t, const void* const*, hipblasDatatype_t, const int*, void* const*, hipblasDatatype_t, const int*, int, bool);
+template hipError_t hipblas_axpby_vbatched_ex<hipblasDoubleComplex>(hipStream_t, const int*, hipblasDoubleComplex, const hipblasDoubleComplex*, hipblasDoubleComplex, const hipblasDoubleComplex*, int64_t, const void* const*, hipblasDatatype_t, const int*, void* const*, hipblasDatatype_t, const int*, int, bool);
+// clang-format on
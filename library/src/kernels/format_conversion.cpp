@@ -0,0 +1,242 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "hipblas_kernels.h"
+#include <algorithm>
+#include <hip/hip_runtime.h>
+
+namespace
+{
+    // Tiled so a warp reads and writes one contiguous column segment of each layout
+    constexpr int MATRIX_DIM_X = 32;
+    constexpr int MATRIX_DIM_Y = 8;
+
+    constexpr int MAX_GRID_BATCH = 65535;
+
+    template <typename T>
+    __device__ T* batch_at(hipblas_batched_operand<T> op, int b)
+    {
+        return op.array ? op.array[b] : op.ptr + b * op.stride;
+    }
+
+    // Column j of the packed triangle starts at j * (j + 1) / 2 when upper, and at
+    // j * (2 * n - j + 1) / 2 when lower, whose columns start on the diagonal
+    __device__ int64_t packed_index(bool upper, int n, int i, int j)
+    {
+        return upper ? i + int64_t(j) * (j + 1) / 2 : i - j + int64_t(j) * (2 * n - j + 1) / 2;
+    }
+
+    template <typename T>
+    __global__ void packed_convert_kernel(bool                             unpack,
+                                          bool                             upper,
+                                          int                              n,
+                                          hipblas_batched_operand<const T> src,
+                                          hipblas_batched_operand<T>       dst,
+                                          int64_t                          lda,
+                                          int                              batch_count)
+    {
+        int i = blockIdx.x * blockDim.x + threadIdx.x;
+        int j = blockIdx.y * blockDim.y + threadIdx.y;
+        if(i >= n || j >= n || (upper ? i > j : i < j))
+            return;
+
+        int64_t full   = i + j * lda;
+        int64_t packed = packed_index(upper, n, i, j);
+        int64_t from   = unpack ? packed : full;
+        int64_t to     = unpack ? full : packed;
+        for(int b = blockIdx.z; b < batch_count; b += gridDim.z)
+            batch_at(dst, b)[to] = batch_at(src, b)[from];
+    }
+
+    // Row r of band column j holds A(r - ku + j, j); rows that fall outside A are left as they were
+    template <typename T>
+    __global__ void full_to_band_kernel(int                              m,
+                                        int                              n,
+                                        int                              kl,
+                                        int                              ku,
+                                        hipblas_batched_operand<const T> A,
+                                        int64_t                          lda,
+                                        hipblas_batched_operand<T>       AB,
+                                        int64_t                          ldab,
+                                        int                              batch_count)
+    {
+        int r = blockIdx.x * blockDim.x + threadIdx.x;
+        int j = blockIdx.y * blockDim.y + threadIdx.y;
+        int i = r - ku + j;
+        if(r > kl + ku || j >= n || i < 0 || i >= m)
+            return;
+
+        for(int b = blockIdx.z; b < batch_count; b += gridDim.z)
+            batch_at(AB, b)[r + j * ldab] = batch_at(A, b)[i + j * lda];
+    }
+
+    // hipblasComplex has no device constructors, so zero is built on the host
+    template <typename T>
+    __global__ void band_to_full_kernel(int                              m,
+                                        int                              n,
+                                        int                              kl,
+                                        int                              ku,
+                                        hipblas_batched_operand<const T> AB,
+                                        int64_t                          ldab,
+                                        hipblas_batched_operand<T>       A,
+                                        int64_t                          lda,
+                                        int                              batch_count,
+                                        T                                zero)
+    {
+        int i = blockIdx.x * blockDim.x + threadIdx.x;
+        int j = blockIdx.y * blockDim.y + threadIdx.y;
+        if(i >= m || j >= n)
+            return;
+
+        bool in_band = i - j <= kl && j - i <= ku;
+        for(int b = blockIdx.z; b < batch_count; b += gridDim.z)
+            batch_at(A, b)[i + j * lda] = in_band ? batch_at(AB, b)[ku + i - j + j * ldab] : zero;
+    }
+
+    dim3 matrix_grid(int m, int n, int batch_count)
+    {
+        return dim3((m - 1) / MATRIX_DIM_X + 1,
+                    (n - 1) / MATRIX_DIM_Y + 1,
+                    std::min(batch_count, MAX_GRID_BATCH));
+    }
+}
+
+template <typename T>
+hipError_t hipblas_trttp_batched(hipStream_t                      stream,
+                                 hipblasFillMode_t                uplo,
+                                 int                              n,
+                                 hipblas_batched_operand<const T> A,
+                                 int64_t                          lda,
+                                 hipblas_batched_operand<T>       AP,
+                                 int                              batch_count)
+{
+    if(n <= 0 || batch_count <= 0)
+        return hipSuccess;
+
+    hipLaunchKernelGGL(packed_convert_kernel<T>,
+                       matrix_grid(n, n, batch_count),
+                       dim3(MATRIX_DIM_X, MATRIX_DIM_Y),
+                       0,
+                       stream,
+                       false,
+                       uplo == HIPBLAS_FILL_MODE_UPPER,
+                       n,
+                       A,
+                       AP,
+                       lda,
+                       batch_count);
+    return hipGetLastError();
+}
+
+template <typename T>
+hipError_t hipblas_tpttr_batched(hipStream_t                      stream,
+                                 hipblasFillMode_t                uplo,
+                                 int                              n,
+                                 hipblas_batched_operand<const T> AP,
+                                 hipblas_batched_operand<T>       A,
+                                 int64_t                          lda,
+                                 int                              batch_count)
+{
+    if(n <= 0 || batch_count <= 0)
+        return hipSuccess;
+
+    hipLaunchKernelGGL(packed_convert_kernel<T>,
+                       matrix_grid(n, n, batch_count),
+                       dim3(MATRIX_DIM_X, MATRIX_DIM_Y),
+                       0,
+                       stream,
+                       true,
+                       uplo == HIPBLAS_FILL_MODE_UPPER,
+                       n,
+                       AP,
+                       A,
+                       lda,
+                       batch_count);
+    return hipGetLastError();
+}
+
+template <typename T>
+hipError_t hipblas_ge2gb_batched(hipStream_t                      stream,
+                                 int                              m,
+                                 int                              n,
+                                 int                              kl,
+                                 int                              ku,
+                                 hipblas_batched_operand<const T> A,
+                                 int64_t                          lda,
+                                 hipblas_batched_operand<T>       AB,
+                                 int64_t                          ldab,
+                                 int                              batch_count)
+{
+    if(m <= 0 || n <= 0 || batch_count <= 0)
+        return hipSuccess;
+
+    hipLaunchKernelGGL(full_to_band_kernel<T>,
+                       matrix_grid(kl + ku + 1, n, batch_count),
+                       dim3(MATRIX_DIM_X, MATRIX_DIM_Y),
+                       0,
+                       stream,
+                       m,
+                       n,
+                       kl,
+                       ku,
+                       A,
+                       lda,
+                       AB,
+                       ldab,
+                       batch_count);
+    return hipGetLastError();
+}
+
+template <typename T>
+hipError_t hipblas_gb2ge_batched(hipStream_t                      stream,
+                                 int                              m,
+                                 int                              n,
+                                 int                              kl,
+                                 int                              ku,
+                                 hipblas_batched_operand<const T> AB,
+                                 int64_t                          ldab,
+                                 hipblas_batched_operand<T>       A,
+                                 int64_t                          lda,
+                                 int                              batch_count)
+{
+    if(m <= 0 || n <= 0 || batch_count <= 0)
+        return hipSuccess;
+
+    hipLaunchKernelGGL(band_to_full_kernel<T>,
+                       matrix_grid(m, n, batch_count),
+                       dim3(MATRIX_DIM_X, MATRIX_DIM_Y),
+                       0,
+                       stream,
+                       m,
+                       n,
+                       kl,
+                       ku,
+                       AB,
+                       ldab,
+                       A,
+                       lda,
+                       batch_count,
+                       T(0));
+    return hipGetLastError();
+}
+
+// clang-format off
+template hipError_t hipblas_trttp_batched<float>(hipStream_t, hipblasFillMode_t, int, hipblas_batched_operand<const float>, int64_t, hipblas_batched_operand<float>, int);
+template hipError_t hipblas_trttp_batched<double>(hipStream_t, hipblasFillMode_t, int, hipblas_batched_operand<const double>, int64_t, hipblas_batched_operand<double>, int);
+template hipError_t hipblas_trttp_batched<hipblasComplex>(hipStream_t, hipblasFillMode_t, int, hipblas_batched_operand<const hipblasComplex>, int64_t, hipblas_batched_operand<hipblasComplex>, int);
+template hipError_t hipblas_trttp_batched<hipblasDoubleComplex>(hipStream_t, hipblasFillMode_t, int, hipblas_batched_operand<const hipblasDoubleComplex>, int64_t, hipblas_batched_operand<hipblasDoubleComplex>, int);
+template hipError_t hipblas_tpttr_batched<float>(hipStream_t, hipblasFillMode_t, int, hipblas_batched_operand<const float>, hipblas_batched_operand<float>, int64_t, int);
+template hipError_t hipblas_tpttr_batched<double>(hipStream_t, hipblasFillMode_t, int, hipblas_batched_operand<const double>, hipblas_batched_operand<double>, int64_t, int);
+template hipError_t hipblas_tpttr_batched<hipblasComplex>(hipStream_t, hipblasFillMode_t, int, hipblas_batched_operand<const hipblasComplex>, hipblas_batched_operand<hipblasComplex>, int64_t, int);
+template hipError_t hipblas_tpttr_batched<hipblasDoubleComplex>(hipStream_t, hipblasFillMode_t, int, hipblas_batched_operand<const hipblasDoubleComplex>, hipblas_batched_operand<hipblasDoubleComplex>, int64_t, int);
+template hipError_t hipblas_ge2gb_batched<float>(hipStream_t, int, int, int, int, hipblas_batched_operand<const float>, int64_t, hipblas_batched_operand<float>, int64_t, int);
+template hipError_t hipblas_ge2gb_batched<double>(hipStream_t, int, int, int, int, hipblas_batched_operand<const double>, int64_t, hipblas_batched_operand<double>, int64_t, int);
+template hipError_t hipblas_ge2gb_batched<hipblasComplex>(hipStream_t, int, int, int, int, hipblas_batched_operand<const hipblasComplex>, int64_t, hipblas_batched_operand<hipblasComplex>, int64_t, int);
+template hipError_t hipblas_ge2gb_batched<hipblasDoubleComplex>(hipStream_t, int, int, int, int, hipblas_batched_operand<const hipblasDoubleComplex>, int64_t, hipblas_batched_operand<hipblasDoubleComplex>, int64_t, int);
+template hipError_t hipblas_gb2ge_batched<float>(hipStream_t, int, int, int, int, hipblas_batched_operand<const float>, int64_t, hipblas_batched_operand<float>, int64_t, int);
+template hipError_t hipblas_gb2ge_batched<double>(hipStream_t, int, int, int, int, hipblas_batched_operand<const double>, int64_t, hipblas_batched_operand<double>, int64_t, int);
+template hipError_t hipblas_gb2ge_batched<hipblasComplex>(hipStream_t, int, int, int, int, hipblas_batched_operand<const hipblasComplex>, int64_t, hipblas_batched_operand<hipblasComplex>, int64_t, int);
+template hipError_t hipblas_gb2ge_batched<hipblasDoubleComplex>(hipStream_t, int, int, int, int, hipblas_batched_operand<const hipblasDoubleComplex>, int64_t, hipblas_batched_operand<hipblasDoubleComplex>, int64_t, int);
+// clang-format on
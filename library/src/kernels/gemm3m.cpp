@@ -0,0 +1,314 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "hipblas_kernels.h"
+#include <algorithm>
+#include <hip/hip_runtime.h>
+
+namespace
+{
+    constexpr int MATRIX_DIM_X = 32;
+    constexpr int MATRIX_DIM_Y = 8;
+
+    constexpr int MAX_GRID_BATCH = 65535;
+
+    // Complex operands are addressed through their real and imaginary parts, element (i, j) of A
+    // being at A_re and A_im + inc * (i + j * lda): inc is 2 for interleaved real pairs, where
+    // A_im is A_re + 1, and 1 for separate planes. re and im are nullptr when only sum is wanted
+    template <typename T>
+    __global__ void gemm3m_split_kernel(int      m,
+                                        int      n,
+                                        const T* A_re,
+                                        const T* A_im,
+                                        int64_t  inc,
+                                        int64_t  lda,
+                                        int64_t  stride_a,
+                                        bool     conj,
+                                        T*       re,
+                                        T*       im,
+                                        T*       sum,
+                                        int      batch_count)
+    {
+        int i = blockIdx.x * blockDim.x + threadIdx.x;
+        int j = blockIdx.y * blockDim.y + threadIdx.y;
+        if(i >= m || j >= n)
+            return;
+
+        for(int b = blockIdx.z; b < batch_count; b += gridDim.z)
+        {
+            int64_t offset = inc * (b * stride_a + i + j * lda);
+            T       ar     = A_re[offset];
+            T       ai     = conj ? -A_im[offset] : A_im[offset];
+            int64_t idx    = b * int64_t(m) * n + i + j * int64_t(m);
+            if(re)
+            {
+                re[idx] = ar;
+                im[idx] = ai;
+            }
+            sum[idx] = ar + ai;
+        }
+    }
+
+    // The scalars are read through alpha_dev and beta_dev in device pointer mode. Without products
+    // (k == 0) C is only scaled, and C is never read when beta is zero. C is addressed as A is in
+    // the split
+    template <typename T>
+    __global__ void gemm3m_combine_kernel(int      m,
+                                          int      n,
+                                          const T* P1,
+                                          const T* P2,
+                                          const T* P3,
+                                          T        alpha_r,
+                                          T        alpha_i,
+                                          T        beta_r,
+                                          T        beta_i,
+                                          const T* alpha_dev,
+                                          const T* beta_dev,
+                                          T*       C_re,
+                                          T*       C_im,
+                                          int64_t  inc,
+                                          int64_t  ldc,
+                                          int64_t  stride_c,
+                                          int      batch_count)
+    {
+        int i = blockIdx.x * blockDim.x + threadIdx.x;
+        int j = blockIdx.y * blockDim.y + threadIdx.y;
+        if(i >= m || j >= n)
+            return;
+
+        if(alpha_dev)
+        {
+            alpha_r = alpha_dev[0];
+            alpha_i = alpha_dev[1];
+        }
+        if(beta_dev)
+        {
+            beta_r = beta_dev[0];
+            beta_i = beta_dev[1];
+        }
+
+        for(int b = blockIdx.z; b < batch_count; b += gridDim.z)
+        {
+            T pr = 0, pi = 0;
+            if(P1)
+            {
+                int64_t idx = b * int64_t(m) * n + i + j * int64_t(m);
+                pr          = P1[idx] - P2[idx];
+                pi          = P3[idx] - P1[idx] - P2[idx];
+            }
+
+            int64_t offset = inc * (b * stride_c + i + j * ldc);
+            T       cr     = alpha_r * pr - alpha_i * pi;
+            T       ci     = alpha_r * pi + alpha_i * pr;
+            if(beta_r != 0 || beta_i != 0)
+            {
+                T c0 = C_re[offset], c1 = C_im[offset];
+                cr += beta_r * c0 - beta_i * c1;
+                ci += beta_r * c1 + beta_i * c0;
+            }
+            C_re[offset] = cr;
+            C_im[offset] = ci;
+        }
+    }
+
+    dim3 matrix_grid(int m, int n, int batch_count)
+    {
+        return dim3((m - 1) / MATRIX_DIM_X + 1,
+                    (n - 1) / MATRIX_DIM_Y + 1,
+                    std::min(batch_count, MAX_GRID_BATCH));
+    }
+
+    template <typename T>
+    hipError_t gemm3m_combine(hipStream_t stream,
+                                     int         m,
+                                     int         n,
+                                     const T*    P1,
+                                     const T*    P2,
+                                     const T*    P3,
+                                     const T*    alpha,
+                                     const T*    beta,
+                                     bool        device_scalars,
+                                     T*          C_re,
+                                     T*          C_im,
+                                     int64_t     inc,
+                                     int64_t     ldc,
+                                     int64_t     stride_c,
+                                     int         batch_count)
+    {
+        if(m <= 0 || n <= 0 || batch_count <= 0)
+            return hipSuccess;
+
+        hipLaunchKernelGGL(gemm3m_combine_kernel<T>,
+                           matrix_grid(m, n, batch_count),
+                           dim3(MATRIX_DIM_X, MATRIX_DIM_Y),
+                           0,
+                           stream,
+                           m,
+                           n,
+                           P1,
+                           P2,
+                           P3,
+                           device_scalars ? T(0) : alpha[0],
+                           device_scalars ? T(0) : alpha[1],
+                           device_scalars ? T(0) : beta[0],
+                           device_scalars ? T(0) : beta[1],
+                           device_scalars ? alpha : nullptr,
+                           device_scalars ? beta : nullptr,
+                           C_re,
+                           C_im,
+                           inc,
+                           ldc,
+                           stride_c,
+                           batch_count);
+        return hipGetLastError();
+    }
+}
+
+template <typename T>
+hipError_t hipblas_gemm3m_split_strided_batched(hipStream_t stream,
+                                                int         m,
+                                                int         n,
+                                                const T*    A,
+                                                int64_t     lda,
+                                                int64_t     stride_a,
+                                                bool        conj,
+                                                T*          re,
+                                                T*          im,
+                                                T*          sum,
+                                                int         batch_count)
+{
+    if(m <= 0 || n <= 0 || batch_count <= 0)
+        return hipSuccess;
+
+    hipLaunchKernelGGL(gemm3m_split_kernel<T>,
+                       matrix_grid(m, n, batch_count),
+                       dim3(MATRIX_DIM_X, MATRIX_DIM_Y),
+                       0,
+                       stream,
+                       m,
+                       n,
+                       A,
+                       A + 1,
+                       2,
+                       lda,
+                       stride_a,
+                       conj,
+                       re,
+                       im,
+                       sum,
+                       batch_count);
+    return hipGetLastError();
+}
+
+template <typename T>
+hipError_t hipblas_gemm3m_sum_planar_strided_batched(hipStream_t stream,
+                                                     int         m,
+                                                     int         n,
+                                                     const T*    A_re,
+                                                     const T*    A_im,
+                                                     int64_t     lda,
+                                                     int64_t     stride_a,
+                                                     bool        conj,
+                                                     T*          sum,
+                                                     int         batch_count)
+{
+    if(m <= 0 || n <= 0 || batch_count <= 0)
+        return hipSuccess;
+
+    hipLaunchKernelGGL(gemm3m_split_kernel<T>,
+                       matrix_grid(m, n, batch_count),
+                       dim3(MATRIX_DIM_X, MATRIX_DIM_Y),
+                       0,
+                       stream,
+                       m,
+                       n,
+                       A_re,
+                       A_im,
+                       1,
+                       lda,
+                       stride_a,
+                       conj,
+                       nullptr,
+                       nullptr,
+                       sum,
+                       batch_count);
+    return hipGetLastError();
+}
+
+template <typename T>
+hipError_t hipblas_gemm3m_combine_strided_batched(hipStream_t stream,
+                                                  int         m,
+                                                  int         n,
+                                                  const T*    P1,
+                                                  const T*    P2,
+                                                  const T*    P3,
+                                                  const T*    alpha,
+                                                  const T*    beta,
+                                                  bool        device_scalars,
+                                                  T*          C,
+                                                  int64_t     ldc,
+                                                  int64_t     stride_c,
+                                                  int         batch_count)
+{
+    return gemm3m_combine(stream,
+                          m,
+                          n,
+                          P1,
+                          P2,
+                          P3,
+                          alpha,
+                          beta,
+                          device_scalars,
+                          C,
+                          C + 1,
+                          2,
+                          ldc,
+                          stride_c,
+                          batch_count);
+}
+
+template <typename T>
+hipError_t hipblas_gemm3m_combine_planar_strided_batched(hipStream_t stream,
+                                                         int         m,
+                                                         int         n,
+                                                         const T*    P1,
+                                                         const T*    P2,
+                                                         const T*    P3,
+                                                         const T*    alpha,
+                                                         const T*    beta,
+                                                         bool        device_scalars,
+                                                         T*          C_re,
+                                                         T*          C_im,
+                                                         int64_t     ldc,
+                                                         int64_t     stride_c,
+                                                         int         batch_count)
+{
+    return gemm3m_combine(stream,
+                          m,
+                          n,
+                          P1,
+                          P2,
+                          P3,
+                          alpha,
+                          beta,
+                          device_scalars,
+                          C_re,
+                          C_im,
+                          1,
+                          ldc,
+                          stride_c,
+                          batch_count);
+}
+
+// clang-format off
+template hipError_t hipblas_gemm3m_split_strided_batched<float>(hipStream_t, int, int, const float*, int64_t, int64_t, bool, float*, float*, float*, int);
+template hipError_t hipblas_gemm3m_split_strided_batched<double>(hipStream_t, int, int, const double*, int64_t, int64_t, bool, double*, double*, double*, int);
+template hipError_t hipblas_gemm3m_combine_strided_batched<float>(hipStream_t, int, int, const float*, const float*, const float*, const float*, const float*, bool, float*, int64_t, int64_t, int);
+template hipError_t hipblas_gemm3m_combine_strided_batched<double>(hipStream_t, int, int, const double*, const double*, const double*, const double*, const double*, bool, double*, int64_t, int64_t, int);
+template hipError_t hipblas_gemm3m_sum_planar_strided_batched<float>(hipStream_t, int, int, const float*, const float*, int64_t, int64_t, bool, float*, int);
+template hipError_t hipblas_gemm3m_sum_planar_strided_batched<double>(hipStream_t, int, int, const double*, const double*, int64_t, int64_t, bool, double*, int);
+template hipError_t hipblas_gemm3m_combine_planar_strided_batched<float>(hipStream_t, int, int, const float*, const float*, const float*, const float*, const float*, bool, float*, float*, int64_t, int64_t, int);
+template hipError_t hipblas_gemm3m_combine_planar_strided_batched<double>(hipStream_t, int, int, const double*, const double*, const double*, const double*, const double*, bool, double*, double*, int64_t, int64_t, int);
+// clang-format on
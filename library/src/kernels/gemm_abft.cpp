@@ -0,0 +1,491 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "hipblas_kernels.h"
+#include <algorithm>
+#include <cstring>
+#include <hip/hip_runtime.h>
+
+namespace
+{
+    // Lanes summing the rows of a block of columns, and the columns a block of threads takes
+    constexpr int SUM_DIM_X = 64;
+    constexpr int SUM_DIM_Y = 4;
+
+    constexpr int MATRIX_DIM_X = 32;
+    constexpr int MATRIX_DIM_Y = 8;
+
+    constexpr int MAX_GRID_Y     = 65535;
+    constexpr int MAX_GRID_BATCH = 65535;
+
+    template <typename T>
+    __device__ T* batch_at(hipblas_batched_operand<T> op, int b)
+    {
+        return op.array ? op.array[b] : op.ptr + b * op.stride;
+    }
+
+    // The larger magnitude, a NaN being larger than anything
+    __device__ double larger(double a, double b)
+    {
+        return b > a || isnan(b) ? b : a;
+    }
+
+    template <typename T>
+    __device__ void store_sums(int64_t at,
+                               double  sum,
+                               double  abs_sum,
+                               double  abs_max,
+                               T*      sums,
+                               T*      abs_sums,
+                               T*      abs_maxes)
+    {
+        if(sums)
+            sums[at] = T(sum);
+        if(abs_sums)
+            abs_sums[at] = T(abs_sum);
+        if(abs_maxes)
+            abs_maxes[at] = T(abs_max);
+    }
+
+    // op(X) = X: the lanes of a block of threads take the rows of a block of each of its columns
+    // in turn, so reads are contiguous, and are then reduced in shared memory
+    template <typename T>
+    __global__ void block_sums_columns_kernel(int                              rows,
+                                              int                              cols,
+                                              int                              block,
+                                              hipblas_batched_operand<const T> X,
+                                              int64_t                          ldx,
+                                              T*                               sums,
+                                              T*                               abs_sums,
+                                              T*                               abs_maxes,
+                                              int64_t                          stride,
+                                              int                              batch_count)
+    {
+        __shared__ double part[3][SUM_DIM_Y][SUM_DIM_X];
+
+        int tx     = threadIdx.x;
+        int ty     = threadIdx.y;
+        int c      = blockIdx.x * SUM_DIM_Y + ty;
+        int blocks = (rows - 1) / block + 1;
+
+        for(int b = blockIdx.z; b < batch_count; b += gridDim.z)
+            for(int i = blockIdx.y; i < blocks; i += gridDim.y)
+            {
+                double sum = 0, abs_sum = 0, abs_max = 0;
+                if(c < cols)
+                {
+                    const T* x    = batch_at(X, b) + c * ldx;
+                    int      last = min(rows, (i + 1) * block);
+                    for(int r = i * block + tx; r < last; r += SUM_DIM_X)
+                    {
+                        double v = x[r];
+                        sum += v;
+                        abs_sum += fabs(v);
+                        abs_max = larger(abs_max, fabs(v));
+                    }
+                }
+                part[0][ty][tx] = sum;
+                part[1][ty][tx] = abs_sum;
+                part[2][ty][tx] = abs_max;
+                __syncthreads();
+                for(int half = SUM_DIM_X / 2; half > 0; half /= 2)
+                {
+                    if(tx < half)
+                    {
+                        part[0][ty][tx] += part[0][ty][tx + half];
+                        part[1][ty][tx] += part[1][ty][tx + half];
+                        part[2][ty][tx] = larger(part[2][ty][tx], part[2][ty][tx + half]);
+                    }
+                    __syncthreads();
+                }
+                if(tx == 0 && c < cols)
+                    store_sums(b * stride + i + int64_t(c) * blocks,
+                               part[0][ty][0],
+                               part[1][ty][0],
+                               part[2][ty][0],
+                               sums,
+                               abs_sums,
+                               abs_maxes);
+                __syncthreads();
+            }
+    }
+
+    // op(X) = X^T: the columns of op(X) are contiguous in X, so each thread sums one of them
+    template <typename T>
+    __global__ void block_sums_rows_kernel(int                              rows,
+                                           int                              cols,
+                                           int                              block,
+                                           hipblas_batched_operand<const T> X,
+                                           int64_t                          ldx,
+                                           T*                               sums,
+                                           T*                               abs_sums,
+                                           T*                               abs_maxes,
+                                           int64_t                          stride,
+                                           int                              batch_count)
+    {
+        int c      = blockIdx.x * blockDim.x + threadIdx.x;
+        int blocks = (rows - 1) / block + 1;
+        if(c >= cols)
+            return;
+
+        for(int b = blockIdx.z; b < batch_count; b += gridDim.z)
+            for(int i = blockIdx.y; i < blocks; i += gridDim.y)
+            {
+                const T* x       = batch_at(X, b) + c;
+                int      last    = min(rows, (i + 1) * block);
+                double   sum     = 0;
+                double   abs_sum = 0;
+                double   abs_max = 0;
+                for(int r = i * block; r < last; r++)
+                {
+                    double v = x[r * ldx];
+                    sum += v;
+                    abs_sum += fabs(v);
+                    abs_max = larger(abs_max, fabs(v));
+                }
+                store_sums(b * stride + i + int64_t(c) * blocks,
+                           sum,
+                           abs_sum,
+                           abs_max,
+                           sums,
+                           abs_sums,
+                           abs_maxes);
+            }
+    }
+
+    template <typename T>
+    __global__ void abft_check_kernel(int                 blocks,
+                                      int                 n,
+                                      double              alpha_host,
+                                      double              beta_host,
+                                      const T*            alpha_device,
+                                      const T*            beta_device,
+                                      const T*            sums,
+                                      const T*            expected,
+                                      const T*            c_abs,
+                                      const T*            row_abs,
+                                      const T*            col_max,
+                                      int64_t             stride,
+                                      double              tolerance,
+                                      int*                flags,
+                                      int64_t             stride_flags,
+                                      unsigned long long* failed,
+                                      int                 batch_count)
+    {
+        int i = blockIdx.x * blockDim.x + threadIdx.x;
+        int j = blockIdx.y * blockDim.y + threadIdx.y;
+        if(i >= blocks || j >= n)
+            return;
+
+        double alpha = fabs(alpha_device ? double(*alpha_device) : alpha_host);
+        double beta  = fabs(beta_device ? double(*beta_device) : beta_host);
+        for(int b = blockIdx.z; b < batch_count; b += gridDim.z)
+        {
+            int64_t at    = b * stride + i + int64_t(j) * blocks;
+            double  bound = alpha * double(row_abs[b * stride + i]);
+            bound *= double(col_max[b * stride + j]);
+            if(beta != 0)
+                bound += beta * double(c_abs[at]);
+
+            // A NaN difference fails, and a bound that is not finite checks nothing
+            double diff = fabs(double(sums[at]) - double(expected[at]));
+            if(!isfinite(bound) || diff <= tolerance * bound)
+                continue;
+
+            int* flag = flags + b * stride_flags + i + int64_t(j / HIPBLAS_ABFT_TILE) * blocks;
+            if(atomicExch(flag, 1) == 0 && failed)
+                atomicAdd(failed, 1ull);
+        }
+    }
+
+    template <typename T>
+    __global__ void abft_copy_kernel(int                              m,
+                                     int                              n,
+                                     hipblas_batched_operand<const T> src,
+                                     int64_t                          lds,
+                                     hipblas_batched_operand<T>       dst,
+                                     int64_t                          ldd,
+                                     int                              batch_count)
+    {
+        int i = blockIdx.x * blockDim.x + threadIdx.x;
+        int j = blockIdx.y * blockDim.y + threadIdx.y;
+        if(i >= m || j >= n)
+            return;
+
+        for(int b = blockIdx.z; b < batch_count; b += gridDim.z)
+            batch_at(dst, b)[i + j * ldd] = batch_at(src, b)[i + j * lds];
+    }
+
+    template <typename T>
+    hipError_t block_sums(hipStream_t                         stream,
+                          bool                                trans,
+                          int                                 rows,
+                          int                                 cols,
+                          int                                 block,
+                          hipblas_batched_operand<const void> X,
+                          int64_t                             ldx,
+                          void*                               sums,
+                          void*                               abs_sums,
+                          void*                               abs_maxes,
+                          int64_t                             stride,
+                          int                                 batch_count)
+    {
+        hipblas_batched_operand<const T> x{static_cast<const T*>(X.ptr),
+                                           X.stride,
+                                           reinterpret_cast<const T* const*>(X.array)};
+
+        int  blocks = (rows - 1) / block + 1;
+        dim3 grid(1, std::min(blocks, MAX_GRID_Y), std::min(batch_count, MAX_GRID_BATCH));
+        if(trans)
+        {
+            grid.x = (cols - 1) / (SUM_DIM_X * SUM_DIM_Y) + 1;
+            hipLaunchKernelGGL(block_sums_rows_kernel<T>,
+                               grid,
+                               dim3(SUM_DIM_X * SUM_DIM_Y),
+                               0,
+                               stream,
+                               rows,
+                               cols,
+                               block,
+                               x,
+                               ldx,
+                               static_cast<T*>(sums),
+                               static_cast<T*>(abs_sums),
+                               static_cast<T*>(abs_maxes),
+                               stride,
+                               batch_count);
+        }
+        else
+        {
+            grid.x = (cols - 1) / SUM_DIM_Y + 1;
+            hipLaunchKernelGGL(block_sums_columns_kernel<T>,
+                               grid,
+                               dim3(SUM_DIM_X, SUM_DIM_Y),
+                               0,
+                               stream,
+                               rows,
+                               cols,
+                               block,
+                               x,
+                               ldx,
+                               static_cast<T*>(sums),
+                               static_cast<T*>(abs_sums),
+                               static_cast<T*>(abs_maxes),
+                               stride,
+                               batch_count);
+        }
+        return hipGetLastError();
+    }
+
+    template <typename T>
+    double host_scalar(const void* value, bool device_scalars)
+    {
+        T v = 0;
+        if(!device_scalars)
+            std::memcpy(&v, value, sizeof(T));
+        return v;
+    }
+
+    template <typename T>
+    hipError_t check(hipStream_t         stream,
+                     int                 blocks,
+                     int                 n,
+                     const void*         alpha,
+                     const void*         beta,
+                     bool                device_scalars,
+                     const void*         sums,
+                     const void*         expected,
+                     const void*         c_abs,
+                     const void*         row_abs,
+                     const void*         col_max,
+                     int64_t             stride,
+                     double              tolerance,
+                     int*                flags,
+                     int64_t             stride_flags,
+                     unsigned long long* failed,
+                     int                 batch_count)
+    {
+        hipLaunchKernelGGL(abft_check_kernel<T>,
+                           dim3((blocks - 1) / MATRIX_DIM_X + 1,
+                                (n - 1) / MATRIX_DIM_Y + 1,
+                                std::min(batch_count, MAX_GRID_BATCH)),
+                           dim3(MATRIX_DIM_X, MATRIX_DIM_Y),
+                           0,
+                           stream,
+                           blocks,
+                           n,
+                           host_scalar<T>(alpha, device_scalars),
+                           host_scalar<T>(beta, device_scalars),
+                           device_scalars ? static_cast<const T*>(alpha) : nullptr,
+                           device_scalars ? static_cast<const T*>(beta) : nullptr,
+                           static_cast<const T*>(sums),
+                           static_cast<const T*>(expected),
+                           static_cast<const T*>(c_abs),
+                           static_cast<const T*>(row_abs),
+                           static_cast<const T*>(col_max),
+                           stride,
+                           tolerance,
+                           flags,
+                           stride_flags,
+                           failed,
+                           batch_count);
+        return hipGetLastError();
+    }
+
+    template <typename T>
+    hipError_t copy(hipStream_t                         stream,
+                    int                                 m,
+                    int                                 n,
+                    hipblas_batched_operand<const void> src,
+                    int64_t                             lds,
+                    hipblas_batched_operand<void>       dst,
+                    int64_t                             ldd,
+                    int                                 batch_count)
+    {
+        hipblas_batched_operand<const T> s{static_cast<const T*>(src.ptr),
+                                           src.stride,
+                                           reinterpret_cast<const T* const*>(src.array)};
+        hipblas_batched_operand<T>       d{
+            static_cast<T*>(dst.ptr), dst.stride, reinterpret_cast<T* const*>(dst.array)};
+
+        hipLaunchKernelGGL(abft_copy_kernel<T>,
+                           dim3((m - 1) / MATRIX_DIM_X + 1,
+                                (n - 1) / MATRIX_DIM_Y + 1,
+                                std::min(batch_count, MAX_GRID_BATCH)),
+                           dim3(MATRIX_DIM_X, MATRIX_DIM_Y),
+                           0,
+                           stream,
+                           m,
+                           n,
+                           s,
+                           lds,
+                           d,
+                           ldd,
+                           batch_count);
+        return hipGetLastError();
+    }
+}
+
+hipError_t hipblas_abft_block_sums(hipStream_t                         stream,
+                                   bool                                trans,
+                                   int                                 rows,
+                                   int                                 cols,
+                                   int                                 block,
+                                   hipblas_batched_operand<const void> X,
+                                   int64_t                             ldx,
+                                   hipblasDatatype_t                   type,
+                                   void*                               sums,
+                                   void*                               abs_sums,
+                                   void*                               abs_maxes,
+                                   int64_t                             stride,
+                                   int                                 batch_count)
+{
+    if(rows <= 0 || cols <= 0 || batch_count <= 0)
+        return hipSuccess;
+    if(block <= 0)
+        return hipErrorInvalidValue;
+
+    switch(type)
+    {
+    case HIPBLAS_R_32F:
+        return block_sums<float>(stream,
+                                 trans,
+                                 rows,
+                                 cols,
+                                 block,
+                                 X,
+                                 ldx,
+                                 sums,
+                                 abs_sums,
+                                 abs_maxes,
+                                 stride,
+                                 batch_count);
+    case HIPBLAS_R_64F:
+        return block_sums<double>(stream,
+                                  trans,
+                                  rows,
+                                  cols,
+                                  block,
+                                  X,
+                                  ldx,
+                                  sums,
+                                  abs_sums,
+                                  abs_maxes,
+                                  stride,
+                                  batch_count);
+    default:
+        return hipErrorInvalidValue;
+    }
+}
+
+hipError_t hipblas_abft_check(hipStream_t         stream,
+                              int                 blocks,
+                              int                 n,
+                              const void*         alpha,
+                              const void*         beta,
+                              bool                device_scalars,
+                              hipblasDatatype_t   type,
+                              const void*         sums,
+                              const void*         expected,
+                              const void*         c_abs,
+                              const void*         row_abs,
+                              const void*         col_max,
+                              int64_t             stride,
+                              double              tolerance,
+                              int*                flags,
+                              int64_t             stride_flags,
+                              unsigned long long* failed,
+                              int                 batch_count)
+{
+    if(blocks <= 0 || n <= 0 || batch_count <= 0)
+        return hipSuccess;
+
+    auto launch = type == HIPBLAS_R_32F   ? check<float>
+                  : type == HIPBLAS_R_64F ? check<double>
+                                          : nullptr;
+    if(!launch)
+        return hipErrorInvalidValue;
+    return launch(stream,
+                  blocks,
+                  n,
+                  alpha,
+                  beta,
+                  device_scalars,
+                  sums,
+                  expected,
+                  c_abs,
+                  row_abs,
+                  col_max,
+                  stride,
+                  tolerance,
+                  flags,
+                  stride_flags,
+                  failed,
+                  batch_count);
+}
+
+hipError_t hipblas_abft_copy(hipStream_t                         stream,
+                             int                                 m,
+                             int                                 n,
+                             hipblas_batched_operand<const void> src,
+                             int64_t                             lds,
+                             hipblas_batched_operand<void>       dst,
+                             int64_t                             ldd,
+                             hipblasDatatype_t                   type,
+                             int                                 batch_count)
+{
+    if(m <= 0 || n <= 0 || batch_count <= 0)
+        return hipSuccess;
+
+    switch(type)
+    {
+    case HIPBLAS_R_32F:
+        return copy<float>(stream, m, n, src, lds, dst, ldd, batch_count);
+    case HIPBLAS_R_64F:
+        return copy<double>(stream, m, n, src, lds, dst, ldd, batch_count);
+    default:
+        return hipErrorInvalidValue;
+    }
+}
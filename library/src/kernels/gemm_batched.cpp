@@ -0,0 +1,343 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "hipblas_kernels.h"
+#include <algorithm>
+#include <cstring>
+#include <hip/hip_runtime.h>
+
+namespace
+{
+    // Each block computes one GEMM_TILE x GEMM_TILE tile of C, stepping through k a tile at a time
+    constexpr int GEMM_TILE = 16;
+
+    constexpr int MAX_GRID_BATCH = 65535;
+
+    template <typename E>
+    struct arith
+    {
+        __device__ static E    zero() { return 0; }
+        __device__ static E    add(E a, E b) { return a + b; }
+        __device__ static E    mul(E a, E b) { return a * b; }
+        __device__ static E    conj(E a) { return a; }
+        __device__ static bool is_zero(E a) { return a == 0; }
+    };
+
+    template <typename R>
+    struct arith<hip_complex_number<R>>
+    {
+        using E = hip_complex_number<R>;
+        __device__ static E    zero() { return {0, 0}; }
+        __device__ static E    add(E a, E b) { return {a.x + b.x, a.y + b.y}; }
+        __device__ static E    mul(E a, E b) { return {a.x * b.x - a.y * b.y, a.x * b.y + a.y * b.x}; }
+        __device__ static E    mul(R a, E b) { return {a * b.x, a * b.y}; }
+        __device__ static E    mul(E a, R b) { return {a.x * b, a.y * b}; }
+        __device__ static E    conj(E a) { return {a.x, -a.y}; }
+        __device__ static bool is_zero(E a) { return a.x == 0 && a.y == 0; }
+    };
+
+    template <typename E>
+    __device__ E* batch_at(hipblas_batched_operand<E> op, int b)
+    {
+        return op.array ? op.array[b] : op.ptr + b * op.stride;
+    }
+
+    // Element (i, j) of op(A)
+    template <typename E>
+    __device__ E op_element(hipblasOperation_t trans, const E* A, int64_t lda, int i, int j)
+    {
+        if(trans == HIPBLAS_OP_N)
+            return A[i + j * lda];
+        E a = A[j + i * lda];
+        return trans == HIPBLAS_OP_C ? arith<E>::conj(a) : a;
+    }
+
+    // The scalars are read through alpha_dev and beta_dev in device pointer mode, batch b's at
+    // alpha_dev[b * scalar_stride] and beta_dev[b * scalar_stride]. They are the same for every
+    // thread of a block, so skipping the product for a zero alpha leaves the barriers uniform.
+    // A real A or B, TA or TB being E's real type, is tiled and multiplied at its own size
+    template <typename TA, typename TB, typename E>
+    __global__ void gemm_kernel(hipblasOperation_t                transa,
+                                hipblasOperation_t                transb,
+                                int                               m,
+                                int                               n,
+                                int                               k,
+                                E                                 alpha,
+                                E                                 beta,
+                                const E*                          alpha_dev,
+                                const E*                          beta_dev,
+                                int64_t                           scalar_stride,
+                                hipblas_batched_operand<const TA> A,
+                                int64_t                           lda,
+                                hipblas_batched_operand<const TB> B,
+                                int64_t                           ldb,
+                                hipblas_batched_operand<E>        C,
+                                int64_t                           ldc,
+                                int                               batch_count)
+    {
+        __shared__ TA a_tile[GEMM_TILE][GEMM_TILE + 1];
+        __shared__ TB b_tile[GEMM_TILE][GEMM_TILE + 1];
+
+        int tx = threadIdx.x;
+        int ty = threadIdx.y;
+        int i  = blockIdx.x * GEMM_TILE + tx;
+        int j  = blockIdx.y * GEMM_TILE + ty;
+
+        for(int b = blockIdx.z; b < batch_count; b += gridDim.z)
+        {
+            E alpha_b = alpha_dev ? alpha_dev[b * scalar_stride] : alpha;
+            E beta_b  = beta_dev ? beta_dev[b * scalar_stride] : beta;
+
+            const TA* a   = batch_at(A, b);
+            const TB* bb  = batch_at(B, b);
+            E         sum = arith<E>::zero();
+            if(!arith<E>::is_zero(alpha_b))
+                for(int l0 = 0; l0 < k; l0 += GEMM_TILE)
+                {
+                    a_tile[ty][tx] = i < m && l0 + ty < k ? op_element(transa, a, lda, i, l0 + ty)
+                                                          : arith<TA>::zero();
+                    b_tile[ty][tx] = l0 + tx < k && j < n ? op_element(transb, bb, ldb, l0 + tx, j)
+                                                          : arith<TB>::zero();
+                    __syncthreads();
+
+                    for(int l = 0; l < GEMM_TILE; l++)
+                        sum = arith<E>::add(sum, arith<E>::mul(a_tile[l][tx], b_tile[ty][l]));
+                    __syncthreads();
+                }
+
+            if(i < m && j < n)
+            {
+                E* c = batch_at(C, b) + i + j * ldc;
+                E  r = arith<E>::mul(alpha_b, sum);
+                if(!arith<E>::is_zero(beta_b))
+                    r = arith<E>::add(r, arith<E>::mul(beta_b, *c));
+                *c = r;
+            }
+        }
+    }
+
+    // C = alpha * (sum over the batches of op(A_b) * op(B_b)) + beta * C for the one C. Each
+    // thread keeps its element's sum in a register across the batches, so C is read and written
+    // once; the scalars are read through alpha_dev and beta_dev in device pointer mode
+    template <typename E>
+    __global__ void gemm_batch_reduce_kernel(hipblasOperation_t               transa,
+                                             hipblasOperation_t               transb,
+                                             int                              m,
+                                             int                              n,
+                                             int                              k,
+                                             E                                alpha,
+                                             E                                beta,
+                                             const E*                         alpha_dev,
+                                             const E*                         beta_dev,
+                                             hipblas_batched_operand<const E> A,
+                                             int64_t                          lda,
+                                             hipblas_batched_operand<const E> B,
+                                             int64_t                          ldb,
+                                             E*                               C,
+                                             int64_t                          ldc,
+                                             int                              batch_count)
+    {
+        __shared__ E a_tile[GEMM_TILE][GEMM_TILE + 1];
+        __shared__ E b_tile[GEMM_TILE][GEMM_TILE + 1];
+
+        int tx = threadIdx.x;
+        int ty = threadIdx.y;
+        int i  = blockIdx.x * GEMM_TILE + tx;
+        int j  = blockIdx.y * GEMM_TILE + ty;
+
+        E alpha_v = alpha_dev ? *alpha_dev : alpha;
+        E beta_v  = beta_dev ? *beta_dev : beta;
+        E sum     = arith<E>::zero();
+        if(!arith<E>::is_zero(alpha_v))
+            for(int b = 0; b < batch_count; b++)
+            {
+                const E* a  = batch_at(A, b);
+                const E* bb = batch_at(B, b);
+                for(int l0 = 0; l0 < k; l0 += GEMM_TILE)
+                {
+                    a_tile[ty][tx] = i < m && l0 + ty < k ? op_element(transa, a, lda, i, l0 + ty)
+                                                          : arith<E>::zero();
+                    b_tile[ty][tx] = l0 + tx < k && j < n ? op_element(transb, bb, ldb, l0 + tx, j)
+                                                          : arith<E>::zero();
+                    __syncthreads();
+
+                    for(int l = 0; l < GEMM_TILE; l++)
+                        sum = arith<E>::add(sum, arith<E>::mul(a_tile[l][tx], b_tile[ty][l]));
+                    __syncthreads();
+                }
+            }
+
+        if(i < m && j < n)
+        {
+            E* c = C + i + j * ldc;
+            E  r = arith<E>::mul(alpha_v, sum);
+            if(!arith<E>::is_zero(beta_v))
+                r = arith<E>::add(r, arith<E>::mul(beta_v, *c));
+            *c = r;
+        }
+    }
+
+    template <typename E, typename T>
+    E host_scalar(const T* value, bool device_scalars)
+    {
+        E v = {};
+        if(!device_scalars)
+            std::memcpy(&v, value, sizeof(E));
+        return v;
+    }
+}
+
+template <typename TA, typename TB, typename T>
+hipError_t hipblas_gemm_mixed_batched(hipStream_t                       stream,
+                                      hipblasOperation_t                transa,
+                                      hipblasOperation_t                transb,
+                                      int                               m,
+                                      int                               n,
+                                      int                               k,
+                                      const T*                          alpha,
+                                      const T*                          beta,
+                                      bool                              device_scalars,
+                                      int64_t                           scalar_stride,
+                                      hipblas_batched_operand<const TA> A,
+                                      int64_t                           lda,
+                                      hipblas_batched_operand<const TB> B,
+                                      int64_t                           ldb,
+                                      hipblas_batched_operand<T>        C,
+                                      int64_t                           ldc,
+                                      int                               batch_count)
+{
+    if(m <= 0 || n <= 0 || batch_count <= 0)
+        return hipSuccess;
+
+    dim3 grid((m - 1) / GEMM_TILE + 1,
+              (n - 1) / GEMM_TILE + 1,
+              std::min(batch_count, MAX_GRID_BATCH));
+    dim3 threads(GEMM_TILE, GEMM_TILE);
+
+    hipLaunchKernelGGL((gemm_kernel<TA, TB, T>),
+                       grid,
+                       threads,
+                       0,
+                       stream,
+                       transa,
+                       transb,
+                       m,
+                       n,
+                       k,
+                       host_scalar<T>(alpha, device_scalars),
+                       host_scalar<T>(beta, device_scalars),
+                       device_scalars ? alpha : nullptr,
+                       device_scalars ? beta : nullptr,
+                       scalar_stride,
+                       A,
+                       lda,
+                       B,
+                       ldb,
+                       C,
+                       ldc,
+                       batch_count);
+    return hipGetLastError();
+}
+
+template <typename T>
+hipError_t hipblas_gemm_batched(hipStream_t                      stream,
+                                hipblasOperation_t               transa,
+                                hipblasOperation_t               transb,
+                                int                              m,
+                                int                              n,
+                                int                              k,
+                                const T*                         alpha,
+                                const T*                         beta,
+                                bool                             device_scalars,
+                                int64_t                          scalar_stride,
+                                hipblas_batched_operand<const T> A,
+                                int64_t                          lda,
+                                hipblas_batched_operand<const T> B,
+                                int64_t                          ldb,
+                                hipblas_batched_operand<T>       C,
+                                int64_t                          ldc,
+                                int                              batch_count)
+{
+    return hipblas_gemm_mixed_batched<T, T, T>(stream,
+                                               transa,
+                                               transb,
+                                               m,
+                                               n,
+                                               k,
+                                               alpha,
+                                               beta,
+                                               device_scalars,
+                                               scalar_stride,
+                                               A,
+                                               lda,
+                                               B,
+                                               ldb,
+                                               C,
+                                               ldc,
+                                               batch_count);
+}
+
+template <typename T>
+hipError_t hipblas_gemm_batch_reduce(hipStream_t                      stream,
+                                     hipblasOperation_t               transa,
+                                     hipblasOperation_t               transb,
+                                     int                              m,
+                                     int                              n,
+                                     int                              k,
+                                     const T*                         alpha,
+                                     const T*                         beta,
+                                     bool                             device_scalars,
+                                     hipblas_batched_operand<const T> A,
+                                     int64_t                          lda,
+                                     hipblas_batched_operand<const T> B,
+                                     int64_t                          ldb,
+                                     T*                               C,
+                                     int64_t                          ldc,
+                                     int                              batch_count)
+{
+    if(m <= 0 || n <= 0)
+        return hipSuccess;
+
+    dim3 grid((m - 1) / GEMM_TILE + 1, (n - 1) / GEMM_TILE + 1);
+    dim3 threads(GEMM_TILE, GEMM_TILE);
+
+    hipLaunchKernelGGL(gemm_batch_reduce_kernel<T>,
+                       grid,
+                       threads,
+                       0,
+                       stream,
+                       transa,
+                       transb,
+                       m,
+                       n,
+                       k,
+                       host_scalar<T>(alpha, device_scalars),
+                       host_scalar<T>(beta, device_scalars),
+                       device_scalars ? alpha : nullptr,
+                       device_scalars ? beta : nullptr,
+                       A,
+                       lda,
+                       B,
+                       ldb,
+                       C,
+                       ldc,
+                       batch_count);
+    return hipGetLastError();
+}
+
+// clang-format off
+template hipError_t hipblas_gemm_batched<float>(hipStream_t, hipblasOperation_t, hipblasOperation_t, int, int, int, const float*, const float*, bool, int64_t, hipblas_batched_operand<const float>, int64_t, hipblas_batched_operand<const float>, int64_t, hipblas_batched_operand<float>, int64_t, int);
+template hipError_t hipblas_gemm_batched<double>(hipStream_t, hipblasOperation_t, hipblasOperation_t, int, int, int, const double*, const double*, bool, int64_t, hipblas_batched_operand<const double>, int64_t, hipblas_batched_operand<const double>, int64_t, hipblas_batched_operand<double>, int64_t, int);
+template hipError_t hipblas_gemm_batched<hipblasComplex>(hipStream_t, hipblasOperation_t, hipblasOperation_t, int, int, int, const hipblasComplex*, const hipblasComplex*, bool, int64_t, hipblas_batched_operand<const hipblasComplex>, int64_t, hipblas_batched_operand<const hipblasComplex>, int64_t, hipblas_batched_operand<hipblasComplex>, int64_t, int);
+template hipError_t hipblas_gemm_batched<hipblasDoubleComplex>(hipStream_t, hipblasOperation_t, hipblasOperation_t, int, int, int, const hipblasDoubleComplex*, const hipblasDoubleComplex*, bool, int64_t, hipblas_batched_operand<const hipblasDoubleComplex>, int64_t, hipblas_batched_operand<const hipblasDoubleComplex>, int64_t, hipblas_batched_operand<hipblasDoubleComplex>, int64_t, int);
+template hipError_t hipblas_gemm_mixed_batched<float, hipblasComplex, hipblasComplex>(hipStream_t, hipblasOperation_t, hipblasOperation_t, int, int, int, const hipblasComplex*, const hipblasComplex*, bool, int64_t, hipblas_batched_operand<const float>, int64_t, hipblas_batched_operand<const hipblasComplex>, int64_t, hipblas_batched_operand<hipblasComplex>, int64_t, int);
+template hipError_t hipblas_gemm_mixed_batched<hipblasComplex, float, hipblasComplex>(hipStream_t, hipblasOperation_t, hipblasOperation_t, int, int, int, const hipblasComplex*, const hipblasComplex*, bool, int64_t, hipblas_batched_operand<const hipblasComplex>, int64_t, hipblas_batched_operand<const float>, int64_t, hipblas_batched_operand<hipblasComplex>, int64_t, int);
+template hipError_t hipblas_gemm_mixed_batched<double, hipblasDoubleComplex, hipblasDoubleComplex>(hipStream_t, hipblasOperation_t, hipblasOperation_t, int, int, int, const hipblasDoubleComplex*, const hipblasDoubleComplex*, bool, int64_t, hipblas_batched_operand<const double>, int64_t, hipblas_batched_operand<const hipblasDoubleComplex>, int64_t, hipblas_batched_operand<hipblasDoubleComplex>, int64_t, int);
+template hipError_t hipblas_gemm_mixed_batched<hipblasDoubleComplex, double, hipblasDoubleComplex>(hipStream_t, hipblasOperation_t, hipblasOperation_t, int, int, int, const hipblasDoubleComplex*, const hipblasDoubleComplex*, bool, int64_t, hipblas_batched_operand<const hipblasDoubleComplex>, int64_t, hipblas_batched_operand<const double>, int64_t, hipblas_batched_operand<hipblasDoubleComplex>, int64_t, int);
+template hipError_t hipblas_gemm_batch_reduce<float>(hipStream_t, hipblasOperation_t, hipblasOperation_t, int, int, int, const float*, const float*, bool, hipblas_batched_operand<const float>, int64_t, hipblas_batched_operand<const float>, int64_t, float*, int64_t, int);
+template hipError_t hipblas_gemm_batch_reduce<double>(hipStream_t, hipblasOperation_t, hipblasOperation_t, int, int, int, const double*, const double*, bool, hipblas_batched_operand<const double>, int64_t, hipblas_batched_operand<const double>, int64_t, double*, int64_t, int);
+template hipError_t hipblas_gemm_batch_reduce<hipblasComplex>(hipStream_t, hipblasOperation_t, hipblasOperation_t, int, int, int, const hipblasComplex*, const hipblasComplex*, bool, hipblas_batched_operand<const hipblasComplex>, int64_t, hipblas_batched_operand<const hipblasComplex>, int64_t, hipblasComplex*, int64_t, int);
+template hipError_t hipblas_gemm_batch_reduce<hipblasDoubleComplex>(hipStream_t, hipblasOperation_t, hipblasOperation_t, int, int, int, const hipblasDoubleComplex*, const hipblasDoubleComplex*, bool, hipblas_batched_operand<const hipblasDoubleComplex>, int64_t, hipblas_batched_operand<const hipblasDoubleComplex>, int64_t, hipblasDoubleComplex*, int64_t, int);
+// clang-format on
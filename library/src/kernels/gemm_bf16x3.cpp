@@ -0,0 +1,84 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "hipblas_kernels.h"
+#include <hip/hip_runtime.h>
+
+namespace
+{
+    constexpr int MATRIX_DIM_X = 32;
+    constexpr int MATRIX_DIM_Y = 8;
+
+    // Round to nearest even, keeping NaNs quiet
+    __device__ hipblasBfloat16 to_bf16(float x)
+    {
+        uint32_t u = __float_as_uint(x);
+        if((u & 0x7fffffff) > 0x7f800000)
+            return {uint16_t((u >> 16) | 0x40)};
+        u += 0x7fff + ((u >> 16) & 1);
+        return {uint16_t(u >> 16)};
+    }
+
+    __device__ float from_bf16(hipblasBfloat16 x)
+    {
+        return __uint_as_float(uint32_t(x.data) << 16);
+    }
+
+    __global__ void split_bf16x3_kernel(bool             trans,
+                                        int              rows,
+                                        int              cols,
+                                        const float*     X,
+                                        int64_t          ldx,
+                                        hipblasBfloat16* Y,
+                                        int64_t          ldy,
+                                        int64_t          block,
+                                        bool             lo_second)
+    {
+        int i = blockIdx.x * blockDim.x + threadIdx.x;
+        int j = blockIdx.y * blockDim.y + threadIdx.y;
+        if(i >= rows || j >= cols)
+            return;
+
+        float           x  = trans ? X[j + i * ldx] : X[i + j * ldx];
+        hipblasBfloat16 hi = to_bf16(x);
+        hipblasBfloat16 lo = to_bf16(x - from_bf16(hi));
+
+        int64_t e        = i + j * ldy;
+        Y[e]             = hi;
+        Y[e + block]     = lo_second ? lo : hi;
+        Y[e + 2 * block] = lo_second ? hi : lo;
+    }
+}
+
+hipError_t hipblas_split_bf16x3(hipStream_t      stream,
+                                bool             trans,
+                                int              rows,
+                                int              cols,
+                                const float*     X,
+                                int64_t          ldx,
+                                hipblasBfloat16* Y,
+                                int64_t          ldy,
+                                int64_t          block,
+                                bool             lo_second)
+{
+    if(rows <= 0 || cols <= 0)
+        return hipSuccess;
+
+    hipLaunchKernelGGL(split_bf16x3_kernel,
+                       dim3((rows - 1) / MATRIX_DIM_X + 1, (cols - 1) / MATRIX_DIM_Y + 1),
+                       dim3(MATRIX_DIM_X, MATRIX_DIM_Y),
+                       0,
+                       stream,
+                       trans,
+                       rows,
+                       cols,
+                       X,
+                       ldx,
+                       Y,
+                       ldy,
+                       block,
+                       lo_second);
+    return hipGetLastError();
+}
@@ -0,0 +1,132 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "hipblas_kernels.h"
+#include <algorithm>
+#include <hip/hip_fp16.h>
+#include <hip/hip_runtime.h>
+
+namespace
+{
+    constexpr int MATRIX_DIM_X = 32;
+    constexpr int MATRIX_DIM_Y = 8;
+
+    // The epilogue computes in float for half and float results and in double for double results
+    template <typename T>
+    struct epilogue_compute
+    {
+        using type = T;
+    };
+
+    template <>
+    struct epilogue_compute<hipblasHalf>
+    {
+        using type = float;
+    };
+
+    template <typename T>
+    __device__ T epilogue_load(T x)
+    {
+        return x;
+    }
+
+    __device__ float epilogue_load(hipblasHalf x)
+    {
+        return __half2float(__ushort_as_half(x));
+    }
+
+    template <typename T, typename Tc>
+    __device__ T epilogue_store(Tc x)
+    {
+        return T(x);
+    }
+
+    template <>
+    __device__ hipblasHalf epilogue_store<hipblasHalf, float>(float x)
+    {
+        return __half_as_ushort(__float2half(x));
+    }
+
+    // GELU uses the tanh approximation, 0.5 x (1 + tanh(sqrt(2 / pi) (x + 0.044715 x^3)))
+    template <typename Tc>
+    __device__ Tc epilogue_activate(hipblasActivation_t activation, Tc x)
+    {
+        switch(activation)
+        {
+        case HIPBLAS_ACTIVATION_RELU:
+            return x > Tc(0) ? x : Tc(0);
+        case HIPBLAS_ACTIVATION_GELU:
+            return Tc(0.5) * x
+                   * (Tc(1) + tanh(Tc(0.7978845608028654) * (x + Tc(0.044715) * x * x * x)));
+        default:
+            return x;
+        }
+    }
+
+    // One pass over C: the bias is added, the pre-activation value saved to aux for the backward
+    // pass, and the scaled activation written back in place
+    template <typename T, typename Tc>
+    __global__ void gemm_epilogue_kernel(int                 m,
+                                         int                 n,
+                                         T*                  C,
+                                         int64_t             ldc,
+                                         const T*            bias,
+                                         hipblasActivation_t activation,
+                                         Tc                  scale,
+                                         T*                  aux,
+                                         int64_t             ldaux)
+    {
+        int i = blockIdx.x * blockDim.x + threadIdx.x;
+        int j = blockIdx.y * blockDim.y + threadIdx.y;
+        if(i >= m || j >= n)
+            return;
+
+        Tc v = epilogue_load(C[i + j * ldc]);
+        if(bias)
+            v += epilogue_load(bias[i]);
+        if(aux)
+            aux[i + j * ldaux] = epilogue_store<T>(v);
+        C[i + j * ldc] = epilogue_store<T>(scale * epilogue_activate(activation, v));
+    }
+}
+
+template <typename T>
+hipError_t hipblas_gemm_epilogue(hipStream_t         stream,
+                                 int                 m,
+                                 int                 n,
+                                 T*                  C,
+                                 int64_t             ldc,
+                                 const T*            bias,
+                                 hipblasActivation_t activation,
+                                 double              scale,
+                                 T*                  aux,
+                                 int64_t             ldaux)
+{
+    if(m <= 0 || n <= 0)
+        return hipSuccess;
+
+    using Tc = typename epilogue_compute<T>::type;
+    hipLaunchKernelGGL((gemm_epilogue_kernel<T, Tc>),
+                       dim3((m - 1) / MATRIX_DIM_X + 1, (n - 1) / MATRIX_DIM_Y + 1),
+                       dim3(MATRIX_DIM_X, MATRIX_DIM_Y),
+                       0,
+                       stream,
+                       m,
+                       n,
+                       C,
+                       ldc,
+                       bias,
+                       activation,
+                       Tc(scale),
+                       aux,
+                       ldaux);
+    return hipGetLastError();
+}
+
+// clang-format off
+template hipError_t hipblas_gemm_epilogue<hipblasHalf>(hipStream_t, int, int, hipblasHalf*, int64_t, const hipblasHalf*, hipblasActivation_t, double, hipblasHalf*, int64_t);
+template hipError_t hipblas_gemm_epilogue<float>(hipStream_t, int, int, float*, int64_t, const float*, hipblasActivation_t, double, float*, int64_t);
+template hipError_t hipblas_gemm_epilogue<double>(hipStream_t, int, int, double*, int64_t, const double*, hipblasActivation_t, double, double*, int64_t);
+// clang-format on
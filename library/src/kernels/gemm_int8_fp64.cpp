@@ -0,0 +1,202 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "hipblas_kernels.h"
+#include <algorithm>
+#include <hip/hip_runtime.h>
+
+namespace
+{
+    constexpr int MATRIX_DIM_X = 32;
+    constexpr int MATRIX_DIM_Y = 8;
+
+    constexpr int SPLIT_DIM_X  = 256;
+    constexpr int MAX_GRID_VEC = 65535;
+
+    // One block per vector: its largest magnitude sets the exponent, then every element is cut
+    // into slices. Scaling by a power of two, taking 7 bits at a time and subtracting them off are
+    // all exact in fp64, so the slices hold the leading 7 * slices bits of x * 2^-exponent
+    __global__ void int8_split_kernel(int           count,
+                                      int           k,
+                                      const double* X,
+                                      int64_t       stride_v,
+                                      int64_t       stride_p,
+                                      int           slices,
+                                      int8_t*       Y,
+                                      int64_t       ldy,
+                                      int64_t       slice_stride,
+                                      int*          exponents)
+    {
+        __shared__ double s_max[SPLIT_DIM_X];
+
+        int t = threadIdx.x;
+        for(int v = blockIdx.x; v < count; v += gridDim.x)
+        {
+            const double* x   = X + v * stride_v;
+            double        big = 0;
+            for(int p = t; p < k; p += SPLIT_DIM_X)
+                big = fmax(big, fabs(x[p * stride_p]));
+            s_max[t] = big;
+            __syncthreads();
+            for(int half = SPLIT_DIM_X / 2; half > 0; half /= 2)
+            {
+                if(t < half)
+                    s_max[t] = fmax(s_max[t], s_max[t + half]);
+                __syncthreads();
+            }
+
+            // |x| * 2^-e < 1 from frexp's mantissa in [0.5, 1)
+            int e = 0;
+            frexp(s_max[0], &e);
+            __syncthreads();
+            if(t == 0)
+                exponents[v] = e;
+
+            int8_t* y = Y + v * ldy;
+            for(int p = t; p < k; p += SPLIT_DIM_X)
+            {
+                double r = ldexp(x[p * stride_p], -e);
+                for(int s = 0; s < slices; s++)
+                {
+                    r *= 128;
+                    double q                = trunc(r);
+                    y[p + s * slice_stride] = int8_t(q);
+                    r -= q;
+                }
+            }
+        }
+    }
+
+    __global__ void int8_accumulate_kernel(
+        int m, int n, const int32_t* P, int64_t ldp, int shift, bool first, double* acc)
+    {
+        int i = blockIdx.x * blockDim.x + threadIdx.x;
+        int j = blockIdx.y * blockDim.y + threadIdx.y;
+        if(i >= m || j >= n)
+            return;
+
+        size_t e = i + size_t(j) * m;
+        double v = ldexp(double(P[i + j * ldp]), shift);
+        acc[e]   = first ? v : acc[e] + v;
+    }
+
+    __global__ void int8_finish_kernel(int           m,
+                                       int           n,
+                                       const double* acc,
+                                       const int*    exponents_a,
+                                       const int*    exponents_b,
+                                       double        alpha_host,
+                                       double        beta_host,
+                                       const double* alpha_device,
+                                       const double* beta_device,
+                                       double*       C,
+                                       int64_t       ldc)
+    {
+        int i = blockIdx.x * blockDim.x + threadIdx.x;
+        int j = blockIdx.y * blockDim.y + threadIdx.y;
+        if(i >= m || j >= n)
+            return;
+
+        double alpha = alpha_device ? *alpha_device : alpha_host;
+        double beta  = beta_device ? *beta_device : beta_host;
+        double v     = alpha * ldexp(acc[i + size_t(j) * m], exponents_a[i] + exponents_b[j]);
+
+        C[i + j * ldc] = beta == 0 ? v : v + beta * C[i + j * ldc];
+    }
+}
+
+hipError_t hipblas_int8_split(hipStream_t   stream,
+                              int           count,
+                              int           k,
+                              const double* X,
+                              int64_t       stride_v,
+                              int64_t       stride_p,
+                              int           slices,
+                              int8_t*       Y,
+                              int64_t       ldy,
+                              int64_t       slice_stride,
+                              int*          exponents)
+{
+    if(count <= 0 || k <= 0)
+        return hipSuccess;
+
+    hipLaunchKernelGGL(int8_split_kernel,
+                       dim3(std::min(count, MAX_GRID_VEC)),
+                       dim3(SPLIT_DIM_X),
+                       0,
+                       stream,
+                       count,
+                       k,
+                       X,
+                       stride_v,
+                       stride_p,
+                       slices,
+                       Y,
+                       ldy,
+                       slice_stride,
+                       exponents);
+    return hipGetLastError();
+}
+
+hipError_t hipblas_int8_accumulate(hipStream_t    stream,
+                                   int            m,
+                                   int            n,
+                                   const int32_t* P,
+                                   int64_t        ldp,
+                                   int            shift,
+                                   bool           first,
+                                   double*        acc)
+{
+    if(m <= 0 || n <= 0)
+        return hipSuccess;
+
+    hipLaunchKernelGGL(int8_accumulate_kernel,
+                       dim3((m - 1) / MATRIX_DIM_X + 1, (n - 1) / MATRIX_DIM_Y + 1),
+                       dim3(MATRIX_DIM_X, MATRIX_DIM_Y),
+                       0,
+                       stream,
+                       m,
+                       n,
+                       P,
+                       ldp,
+                       shift,
+                       first,
+                       acc);
+    return hipGetLastError();
+}
+
+hipError_t hipblas_int8_finish(hipStream_t   stream,
+                               int           m,
+                               int           n,
+                               const double* acc,
+                               const int*    exponents_a,
+                               const int*    exponents_b,
+                               const double* alpha,
+                               const double* beta,
+                               bool          device_scalars,
+                               double*       C,
+                               int64_t       ldc)
+{
+    if(m <= 0 || n <= 0)
+        return hipSuccess;
+
+    hipLaunchKernelGGL(int8_finish_kernel,
+                       dim3((m - 1) / MATRIX_DIM_X + 1, (n - 1) / MATRIX_DIM_Y + 1),
+                       dim3(MATRIX_DIM_X, MATRIX_DIM_Y),
+                       0,
+                       stream,
+                       m,
+                       n,
+                       acc,
+                       exponents_a,
+                       exponents_b,
+                       device_scalars ? 0.0 : *alpha,
+                       device_scalars ? 0.0 : *beta,
+                       device_scalars ? alpha : nullptr,
+                       device_scalars ? beta : nullptr,
+                       C,
+                       ldc);
+    return hipGetLastError();
+}
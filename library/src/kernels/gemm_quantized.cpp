@@ -0,0 +1,278 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "hipblas_kernels.h"
+#include <algorithm>
+#include <hip/hip_fp16.h>
+#include <hip/hip_runtime.h>
+
+namespace
+{
+    // Each block computes one QUANT_TILE x QUANT_TILE tile of C, stepping through k QUANT_DEPTH
+    // at a time so that a column's weights are read in runs of QUANT_DEPTH values
+    constexpr int QUANT_TILE  = 16;
+    constexpr int QUANT_DEPTH = 64;
+    constexpr int QUANT_STEPS = QUANT_DEPTH / QUANT_TILE;
+
+    constexpr int MAX_GRID_BATCH = 65535;
+
+    struct quant_args
+    {
+        int               m;
+        int               n;
+        int               k;
+        float             alpha;
+        float             beta;
+        const float*      alpha_dev;
+        const float*      beta_dev;
+        const void*       A;
+        int64_t           lda;
+        int64_t           stride_a;
+        const void*       B;
+        int64_t           ldb;
+        int64_t           stride_b;
+        int               group_size;
+        const void*       scales;
+        const void*       zeros;
+        int64_t           ld_scales;
+        int64_t           stride_scales;
+        void*             C;
+        hipblasDatatype_t c_type;
+        int64_t           ldc;
+        int64_t           stride_c;
+        int               batch_count;
+    };
+
+    __device__ float to_float(hipblasHalf x)
+    {
+        return __half2float(__ushort_as_half(x));
+    }
+
+    __device__ float to_float(hipblasBfloat16 x)
+    {
+        return __uint_as_float(uint32_t(x.data) << 16);
+    }
+
+    __device__ float to_float(float x)
+    {
+        return x;
+    }
+
+    // Round to nearest even, keeping NaNs quiet
+    __device__ hipblasBfloat16 float_to_bfloat16(float x)
+    {
+        uint32_t u = __float_as_uint(x);
+        if((u & 0x7fffffff) > 0x7f800000)
+            return {uint16_t((u >> 16) | 0x40)};
+        u += 0x7fff + ((u >> 16) & 1);
+        return {uint16_t(u >> 16)};
+    }
+
+    // Element i of C, of c_type: R_16F, R_16B or R_32F
+    __device__ float load_c(const void* C, hipblasDatatype_t type, int64_t i)
+    {
+        if(type == HIPBLAS_R_16F)
+            return to_float(static_cast<const hipblasHalf*>(C)[i]);
+        if(type == HIPBLAS_R_16B)
+            return to_float(static_cast<const hipblasBfloat16*>(C)[i]);
+        return static_cast<const float*>(C)[i];
+    }
+
+    __device__ void store_c(void* C, hipblasDatatype_t type, int64_t i, float v)
+    {
+        if(type == HIPBLAS_R_16F)
+            static_cast<hipblasHalf*>(C)[i] = __half_as_ushort(__float2half(v));
+        else if(type == HIPBLAS_R_16B)
+            static_cast<hipblasBfloat16*>(C)[i] = float_to_bfloat16(v);
+        else
+            static_cast<float*>(C)[i] = v;
+    }
+
+    // Value i of the quantized B, counted in values; a 4-bit value shares its byte with value
+    // i ^ 1
+    template <hipblasWeightFormat_t F>
+    __device__ float weight(const void* B, int64_t i)
+    {
+        if(F == HIPBLAS_WEIGHT_INT8)
+            return static_cast<const int8_t*>(B)[i];
+        if(F == HIPBLAS_WEIGHT_UINT8)
+            return static_cast<const uint8_t*>(B)[i];
+        uint8_t byte = static_cast<const uint8_t*>(B)[i >> 1];
+        int     q    = i & 1 ? byte >> 4 : byte & 0xf;
+        return F == HIPBLAS_WEIGHT_INT4 && q >= 8 ? q - 16 : q;
+    }
+
+    // The scalars are the same for every thread of a block, so skipping the product for a zero
+    // alpha leaves the barriers uniform
+    template <hipblasWeightFormat_t F, typename TA, typename TS>
+    __global__ __launch_bounds__(QUANT_TILE* QUANT_TILE) void gemm_quantized_kernel(
+        hipblasOperation_t transa, quant_args p)
+    {
+        __shared__ float a_tile[QUANT_DEPTH][QUANT_TILE + 1];
+        __shared__ float b_tile[QUANT_TILE][QUANT_DEPTH + 1];
+
+        int tx = threadIdx.x;
+        int ty = threadIdx.y;
+        int i  = blockIdx.x * QUANT_TILE + tx;
+        int j  = blockIdx.y * QUANT_TILE + ty;
+
+        float alpha = p.alpha_dev ? *p.alpha_dev : p.alpha;
+        float beta  = p.beta_dev ? *p.beta_dev : p.beta;
+
+        for(int b = blockIdx.z; b < p.batch_count; b += gridDim.z)
+        {
+            const TA* a      = static_cast<const TA*>(p.A) + b * p.stride_a;
+            int64_t   w      = b * p.stride_b + int64_t(j) * p.ldb;
+            int64_t   s      = b * p.stride_scales + int64_t(j) * p.ld_scales;
+            const TS* scales = static_cast<const TS*>(p.scales);
+            const TS* zeros  = static_cast<const TS*>(p.zeros);
+
+            float sum = 0;
+            if(alpha != 0)
+                for(int l0 = 0; l0 < p.k; l0 += QUANT_DEPTH)
+                {
+                    for(int r = 0; r < QUANT_STEPS; r++)
+                    {
+                        int la = l0 + ty + r * QUANT_TILE;
+                        int lb = l0 + tx + r * QUANT_TILE;
+
+                        float av = 0;
+                        if(i < p.m && la < p.k)
+                            av = to_float(transa == HIPBLAS_OP_N ? a[i + la * p.lda]
+                                                                 : a[la + i * p.lda]);
+                        a_tile[ty + r * QUANT_TILE][tx] = av;
+
+                        float bv = 0;
+                        if(j < p.n && lb < p.k)
+                        {
+                            int64_t g = s + lb / p.group_size;
+                            float   z = zeros ? to_float(zeros[g]) : 0;
+                            bv        = to_float(scales[g]) * (weight<F>(p.B, w + lb) - z);
+                        }
+                        b_tile[ty][tx + r * QUANT_TILE] = bv;
+                    }
+                    __syncthreads();
+
+                    for(int l = 0; l < QUANT_DEPTH; l++)
+                        sum += a_tile[l][tx] * b_tile[ty][l];
+                    __syncthreads();
+                }
+
+            if(i < p.m && j < p.n)
+            {
+                int64_t c = b * p.stride_c + i + j * p.ldc;
+                float   v = alpha * sum;
+                if(beta != 0)
+                    v += beta * load_c(p.C, p.c_type, c);
+                store_c(p.C, p.c_type, c, v);
+            }
+        }
+    }
+
+    template <hipblasWeightFormat_t F, typename TA, typename TS>
+    hipError_t launch(hipStream_t stream, hipblasOperation_t transa, const quant_args& p)
+    {
+        hipLaunchKernelGGL((gemm_quantized_kernel<F, TA, TS>),
+                           dim3((p.m - 1) / QUANT_TILE + 1,
+                                (p.n - 1) / QUANT_TILE + 1,
+                                std::min(p.batch_count, MAX_GRID_BATCH)),
+                           dim3(QUANT_TILE, QUANT_TILE),
+                           0,
+                           stream,
+                           transa,
+                           p);
+        return hipGetLastError();
+    }
+
+    template <hipblasWeightFormat_t F, typename TA>
+    hipError_t launch_scales(hipStream_t                        stream,
+                             hipblasOperation_t                 transa,
+                             const hipblasWeightQuantization_t& quant,
+                             const quant_args&                  p)
+    {
+        return quant.scale_type == HIPBLAS_R_16F ? launch<F, TA, hipblasHalf>(stream, transa, p)
+                                                 : launch<F, TA, float>(stream, transa, p);
+    }
+
+    template <hipblasWeightFormat_t F>
+    hipError_t launch_a(hipStream_t                        stream,
+                        hipblasOperation_t                 transa,
+                        hipblasDatatype_t                  a_type,
+                        const hipblasWeightQuantization_t& quant,
+                        const quant_args&                  p)
+    {
+        switch(a_type)
+        {
+        case HIPBLAS_R_16F:
+            return launch_scales<F, hipblasHalf>(stream, transa, quant, p);
+        case HIPBLAS_R_16B:
+            return launch_scales<F, hipblasBfloat16>(stream, transa, quant, p);
+        default:
+            return launch_scales<F, float>(stream, transa, quant, p);
+        }
+    }
+}
+
+hipError_t hipblas_gemm_quantized(hipStream_t                        stream,
+                                  hipblasOperation_t                 transa,
+                                  int                                m,
+                                  int                                n,
+                                  int                                k,
+                                  const float*                       alpha,
+                                  const float*                       beta,
+                                  bool                               device_scalars,
+                                  const void*                        A,
+                                  hipblasDatatype_t                  a_type,
+                                  int64_t                            lda,
+                                  int64_t                            stride_a,
+                                  const void*                        B,
+                                  int64_t                            ldb,
+                                  int64_t                            stride_b,
+                                  const hipblasWeightQuantization_t& quant,
+                                  int64_t                            stride_scales,
+                                  void*                              C,
+                                  hipblasDatatype_t                  c_type,
+                                  int64_t                            ldc,
+                                  int64_t                            stride_c,
+                                  int                                batch_count)
+{
+    if(m <= 0 || n <= 0 || batch_count <= 0)
+        return hipSuccess;
+
+    quant_args p = {m,
+                    n,
+                    k,
+                    device_scalars ? 0.0f : *alpha,
+                    device_scalars ? 0.0f : *beta,
+                    device_scalars ? alpha : nullptr,
+                    device_scalars ? beta : nullptr,
+                    A,
+                    lda,
+                    stride_a,
+                    B,
+                    ldb,
+                    stride_b,
+                    quant.group_size,
+                    quant.scales,
+                    quant.zeros,
+                    quant.ld_scales,
+                    stride_scales,
+                    C,
+                    c_type,
+                    ldc,
+                    stride_c,
+                    batch_count};
+    switch(quant.format)
+    {
+    case HIPBLAS_WEIGHT_INT8:
+        return launch_a<HIPBLAS_WEIGHT_INT8>(stream, transa, a_type, quant, p);
+    case HIPBLAS_WEIGHT_UINT8:
+        return launch_a<HIPBLAS_WEIGHT_UINT8>(stream, transa, a_type, quant, p);
+    case HIPBLAS_WEIGHT_INT4:
+        return launch_a<HIPBLAS_WEIGHT_INT4>(stream, transa, a_type, quant, p);
+    default:
+        return launch_a<HIPBLAS_WEIGHT_UINT4>(stream, transa, a_type, quant, p);
+    }
+}
@@ -0,0 +1,122 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "hipblas_kernels.h"
+#include <hip/hip_runtime.h>
+
+namespace
+{
+    // Each block computes one REQUANT_TILE x REQUANT_TILE tile of C, stepping through k
+    // REQUANT_DEPTH at a time
+    constexpr int REQUANT_TILE  = 16;
+    constexpr int REQUANT_DEPTH = 64;
+
+    struct requant_args
+    {
+        int                  m;
+        int                  n;
+        int                  k;
+        const int8_t*        A;
+        int64_t              lda;
+        const int8_t*        B;
+        int64_t              ldb;
+        int8_t*              C;
+        int64_t              ldc;
+        hipblasRequantMode_t mode;
+        const float*         scale;
+        const int32_t*       bias;
+        int32_t              zero_point;
+    };
+
+    // The operands are staged as int32 so that the inner loop is plain integer multiply-adds
+    __global__ __launch_bounds__(REQUANT_TILE* REQUANT_TILE) void gemm_requant_kernel(
+        hipblasOperation_t transa, hipblasOperation_t transb, requant_args p)
+    {
+        __shared__ int32_t a_tile[REQUANT_DEPTH][REQUANT_TILE + 1];
+        __shared__ int32_t b_tile[REQUANT_TILE][REQUANT_DEPTH + 1];
+
+        int tx = threadIdx.x;
+        int ty = threadIdx.y;
+        int i  = blockIdx.x * REQUANT_TILE + tx;
+        int j  = blockIdx.y * REQUANT_TILE + ty;
+
+        int32_t sum = 0;
+        for(int l0 = 0; l0 < p.k; l0 += REQUANT_DEPTH)
+        {
+            for(int r = 0; r < REQUANT_DEPTH; r += REQUANT_TILE)
+            {
+                int64_t la = l0 + r + ty;
+                int64_t lb = l0 + r + tx;
+
+                int32_t a = 0;
+                if(i < p.m && la < p.k)
+                    a = transa == HIPBLAS_OP_N ? p.A[i + la * p.lda] : p.A[la + i * p.lda];
+                a_tile[r + ty][tx] = a;
+
+                int32_t b = 0;
+                if(j < p.n && lb < p.k)
+                    b = transb == HIPBLAS_OP_N ? p.B[lb + j * p.ldb] : p.B[j + lb * p.ldb];
+                b_tile[ty][r + tx] = b;
+            }
+            __syncthreads();
+
+            for(int l = 0; l < REQUANT_DEPTH; l++)
+                sum += a_tile[l][tx] * b_tile[ty][l];
+            __syncthreads();
+        }
+
+        if(i < p.m && j < p.n)
+        {
+            int c = p.mode == HIPBLAS_REQUANT_PER_ROW ? i
+                    : p.mode == HIPBLAS_REQUANT_PER_COLUMN ? j
+                                                           : 0;
+            if(p.bias)
+                sum += p.bias[c];
+            float v = rintf(p.scale[c] * float(sum)) + float(p.zero_point);
+            p.C[i + j * p.ldc] = int8_t(fminf(fmaxf(v, -128.0f), 127.0f));
+        }
+    }
+}
+
+hipError_t hipblas_gemm_requant(hipStream_t                    stream,
+                                hipblasOperation_t             transa,
+                                hipblasOperation_t             transb,
+                                int                            m,
+                                int                            n,
+                                int                            k,
+                                const int8_t*                  A,
+                                int64_t                        lda,
+                                const int8_t*                  B,
+                                int64_t                        ldb,
+                                int8_t*                        C,
+                                int64_t                        ldc,
+                                const hipblasRequantization_t& requant)
+{
+    if(m <= 0 || n <= 0)
+        return hipSuccess;
+
+    requant_args p = {m,
+                      n,
+                      k,
+                      A,
+                      lda,
+                      B,
+                      ldb,
+                      C,
+                      ldc,
+                      requant.mode,
+                      requant.scale,
+                      requant.bias,
+                      requant.zero_point};
+    hipLaunchKernelGGL(gemm_requant_kernel,
+                       dim3((m - 1) / REQUANT_TILE + 1, (n - 1) / REQUANT_TILE + 1),
+                       dim3(REQUANT_TILE, REQUANT_TILE),
+                       0,
+                       stream,
+                       transa,
+                       transb,
+                       p);
+    return hipGetLastError();
+}
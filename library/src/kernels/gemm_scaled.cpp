@@ -0,0 +1,461 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "hipblas_kernels.h"
+#include <algorithm>
+#include <hip/hip_fp16.h>
+#include <hip/hip_runtime.h>
+
+namespace
+{
+    constexpr int MATRIX_DIM_X = 32;
+    constexpr int MATRIX_DIM_Y = 8;
+
+    // Column blocks of one amax_quantize matrix; each thread walks every such stride of columns
+    constexpr int AMAX_COLUMN_BLOCKS = 64;
+
+    constexpr int MAX_GRID_BATCH = 65535;
+
+    // The OCP fp8 formats: E4M3 has no infinities and a single NaN below its sign, E5M2 keeps the
+    // IEEE layout. A magnitude code above MAX_CODE is INF_CODE or a NaN
+    template <int MBITS, int BIAS, uint32_t MAX_CODE, uint32_t INF_CODE>
+    struct fp8
+    {
+        uint8_t data;
+
+        __device__ static float decode(uint32_t bits)
+        {
+            uint32_t mag = bits & 0x7f;
+            uint32_t man = mag & ((1u << MBITS) - 1);
+            int      exp = int(mag >> MBITS);
+            float    v;
+            if(mag > MAX_CODE)
+                v = mag == INF_CODE ? __uint_as_float(0x7f800000) : __uint_as_float(0x7fc00000);
+            else if(exp == 0)
+                v = ldexpf(float(man), 1 - BIAS - MBITS);
+            else
+                v = ldexpf(float(man + (1u << MBITS)), exp - BIAS - MBITS);
+            return bits & 0x80 ? -v : v;
+        }
+
+        // Round to nearest even and saturate. Subnormals share the quantum of the smallest
+        // normal, so both come out of one code formula, a carry into the exponent included
+        __device__ static uint8_t encode(float x)
+        {
+            uint32_t sign = (__float_as_uint(x) >> 24) & 0x80;
+            if(isnan(x))
+                return sign | 0x7f;
+            float a = fabsf(x);
+            if(a >= decode(MAX_CODE))
+                return sign | MAX_CODE;
+
+            int e;
+            frexpf(a, &e);
+            e       = max(e - 1, 1 - BIAS);
+            float q = rintf(ldexpf(a, MBITS - e));
+            return sign | min((uint32_t(e + BIAS - 1) << MBITS) + uint32_t(q), MAX_CODE);
+        }
+    };
+
+    using f8_e4m3 = fp8<3, 7, 0x7e, 0x100>;
+    using f8_e5m2 = fp8<2, 15, 0x7b, 0x7c>;
+
+    template <typename T>
+    __device__ float load(T x)
+    {
+        return T::decode(x.data);
+    }
+
+    __device__ float load(float x)
+    {
+        return x;
+    }
+
+    __device__ float load(hipblasHalf x)
+    {
+        return __half2float(__ushort_as_half(x));
+    }
+
+    __device__ float load(hipblasBfloat16 x)
+    {
+        return __uint_as_float(uint32_t(x.data) << 16);
+    }
+
+    template <typename T>
+    __device__ T store(float x)
+    {
+        return {T::encode(x)};
+    }
+
+    template <>
+    __device__ float store<float>(float x)
+    {
+        return x;
+    }
+
+    template <>
+    __device__ hipblasHalf store<hipblasHalf>(float x)
+    {
+        return __half_as_ushort(__float2half(x));
+    }
+
+    // Round to nearest even, keeping NaNs quiet
+    template <>
+    __device__ hipblasBfloat16 store<hipblasBfloat16>(float x)
+    {
+        uint32_t u = __float_as_uint(x);
+        if((u & 0x7fffffff) > 0x7f800000)
+            return {uint16_t((u >> 16) | 0x40)};
+        u += 0x7fff + ((u >> 16) & 1);
+        return {uint16_t(u >> 16)};
+    }
+
+    // Symmetric, so -127 saturates like 127; NaN stores 0
+    template <>
+    __device__ int8_t store<int8_t>(float x)
+    {
+        return isnan(x) ? 0 : int8_t(fminf(fmaxf(rintf(x), -127.0f), 127.0f));
+    }
+
+    template <typename T>
+    __device__ T* batch_at(hipblas_batched_operand<T> op, int b)
+    {
+        return op.array ? op.array[b] : op.ptr + b * op.stride;
+    }
+
+    template <typename T>
+    hipblas_batched_operand<T> typed(hipblas_batched_operand<const void> op)
+    {
+        return {static_cast<T*>(op.ptr), op.stride, reinterpret_cast<T* const*>(op.array)};
+    }
+
+    template <typename T>
+    hipblas_batched_operand<T> typed(hipblas_batched_operand<void> op)
+    {
+        return {static_cast<T*>(op.ptr), op.stride, reinterpret_cast<T* const*>(op.array)};
+    }
+
+    template <typename T>
+    __global__ void scaled_to_float_kernel(
+        int rows, int cols, const T* X, int64_t ldx, const float* scale, float* Y)
+    {
+        int i = blockIdx.x * blockDim.x + threadIdx.x;
+        int j = blockIdx.y * blockDim.y + threadIdx.y;
+        if(i >= rows || j >= cols)
+            return;
+        Y[i + size_t(j) * rows] = (scale ? *scale : 1.0f) * load(X[i + j * ldx]);
+    }
+
+    // The magnitudes are non-negative, so their floats order like their bit patterns and the
+    // block maxima fold in with an integer atomic
+    template <typename T>
+    __global__ void scaled_from_float_kernel(
+        int m, int n, const float* P, T* D, int64_t ldd, const float* scale, float* amax)
+    {
+        __shared__ float s_max[MATRIX_DIM_X * MATRIX_DIM_Y];
+
+        int   i = blockIdx.x * blockDim.x + threadIdx.x;
+        int   j = blockIdx.y * blockDim.y + threadIdx.y;
+        float v = 0;
+        if(i < m && j < n)
+        {
+            v              = P[i + size_t(j) * m];
+            D[i + j * ldd] = store<T>((scale ? *scale : 1.0f) * v);
+        }
+        if(!amax)
+            return;
+
+        int t    = threadIdx.x + threadIdx.y * blockDim.x;
+        s_max[t] = fabsf(v);
+        __syncthreads();
+        for(int half = MATRIX_DIM_X * MATRIX_DIM_Y / 2; half > 0; half /= 2)
+        {
+            if(t < half)
+                s_max[t] = fmaxf(s_max[t], s_max[t + half]);
+            __syncthreads();
+        }
+        if(t == 0)
+            atomicMax(reinterpret_cast<unsigned int*>(amax), __float_as_uint(s_max[0]));
+    }
+
+    // Each thread keeps the largest magnitude of its row over its columns, so one pass over A
+    // both quantizes and measures it; the block folds its rows, or all of it, into amax as above
+    template <typename T, typename U>
+    __global__ void amax_quantize_kernel(bool                             per_row,
+                                         int                              m,
+                                         int                              n,
+                                         hipblas_batched_operand<const T> A,
+                                         int64_t                          lda,
+                                         const float*                     scale,
+                                         hipblas_batched_operand<U>       Q,
+                                         int64_t                          ldq,
+                                         float*                           amax,
+                                         int                              batch_count)
+    {
+        __shared__ float s_max[MATRIX_DIM_X * MATRIX_DIM_Y];
+
+        int  i     = blockIdx.x * blockDim.x + threadIdx.x;
+        int  t     = threadIdx.x + threadIdx.y * blockDim.x;
+        bool quant = Q.ptr || Q.array;
+        for(int b = blockIdx.z; b < batch_count; b += gridDim.z)
+        {
+            float v = 0;
+            if(i < m)
+            {
+                const T* a = batch_at(A, b);
+                U*       q = quant ? batch_at(Q, b) : nullptr;
+                float    s = scale ? scale[per_row ? b * int64_t(m) + i : b] : 1.0f;
+                for(int j = blockIdx.y * blockDim.y + threadIdx.y; j < n;
+                    j += gridDim.y * blockDim.y)
+                {
+                    float x = load(a[i + j * lda]);
+                    v       = fmaxf(v, fabsf(x));
+                    if(q)
+                        q[i + j * ldq] = store<U>(s * x);
+                }
+            }
+            if(!amax)
+                continue;
+
+            s_max[t] = v;
+            __syncthreads();
+            int last = per_row ? MATRIX_DIM_Y / 2 : MATRIX_DIM_X * MATRIX_DIM_Y / 2;
+            int unit = per_row ? MATRIX_DIM_X : 1;
+            for(int half = last; half > 0; half /= 2)
+            {
+                if(t < half * unit)
+                    s_max[t] = fmaxf(s_max[t], s_max[t + half * unit]);
+                __syncthreads();
+            }
+            if(per_row && threadIdx.y == 0 && i < m)
+                atomicMax(reinterpret_cast<unsigned int*>(amax + b * int64_t(m) + i),
+                          __float_as_uint(s_max[t]));
+            else if(!per_row && t == 0)
+                atomicMax(reinterpret_cast<unsigned int*>(amax + b), __float_as_uint(s_max[0]));
+            __syncthreads();
+        }
+    }
+
+    template <typename T>
+    hipError_t to_float(hipStream_t  stream,
+                        int          rows,
+                        int          cols,
+                        const void*  X,
+                        int64_t      ldx,
+                        const float* scale,
+                        float*       Y)
+    {
+        hipLaunchKernelGGL((scaled_to_float_kernel<T>),
+                           dim3((rows - 1) / MATRIX_DIM_X + 1, (cols - 1) / MATRIX_DIM_Y + 1),
+                           dim3(MATRIX_DIM_X, MATRIX_DIM_Y),
+                           0,
+                           stream,
+                           rows,
+                           cols,
+                           static_cast<const T*>(X),
+                           ldx,
+                           scale,
+                           Y);
+        return hipGetLastError();
+    }
+
+    template <typename T>
+    hipError_t from_float(hipStream_t  stream,
+                          int          m,
+                          int          n,
+                          const float* P,
+                          void*        D,
+                          int64_t      ldd,
+                          const float* scale,
+                          float*       amax)
+    {
+        hipLaunchKernelGGL((scaled_from_float_kernel<T>),
+                           dim3((m - 1) / MATRIX_DIM_X + 1, (n - 1) / MATRIX_DIM_Y + 1),
+                           dim3(MATRIX_DIM_X, MATRIX_DIM_Y),
+                           0,
+                           stream,
+                           m,
+                           n,
+                           P,
+                           static_cast<T*>(D),
+                           ldd,
+                           scale,
+                           amax);
+        return hipGetLastError();
+    }
+
+    template <typename T, typename U>
+    hipError_t amax_quantize(hipStream_t                         stream,
+                             bool                                per_row,
+                             int                                 m,
+                             int                                 n,
+                             hipblas_batched_operand<const void> A,
+                             int64_t                             lda,
+                             const float*                        scale,
+                             hipblas_batched_operand<void>       Q,
+                             int64_t                             ldq,
+                             float*                              amax,
+                             int                                 batch_count)
+    {
+        int column_blocks = std::min((n - 1) / MATRIX_DIM_Y + 1, AMAX_COLUMN_BLOCKS);
+        hipLaunchKernelGGL((amax_quantize_kernel<T, U>),
+                           dim3((m - 1) / MATRIX_DIM_X + 1,
+                                column_blocks,
+                                std::min(batch_count, MAX_GRID_BATCH)),
+                           dim3(MATRIX_DIM_X, MATRIX_DIM_Y),
+                           0,
+                           stream,
+                           per_row,
+                           m,
+                           n,
+                           typed<const T>(A),
+                           lda,
+                           scale,
+                           typed<U>(Q),
+                           ldq,
+                           amax,
+                           batch_count);
+        return hipGetLastError();
+    }
+
+    template <typename T>
+    hipError_t amax_quantize_from(hipStream_t                         stream,
+                                  bool                                per_row,
+                                  int                                 m,
+                                  int                                 n,
+                                  hipblas_batched_operand<const void> A,
+                                  int64_t                             lda,
+                                  const float*                        scale,
+                                  hipblas_batched_operand<void>       Q,
+                                  hipblasDatatype_t                   q_type,
+                                  int64_t                             ldq,
+                                  float*                              amax,
+                                  int                                 batch_count)
+    {
+        switch(q_type)
+        {
+        case HIPBLAS_R_8F_E4M3:
+            return amax_quantize<T, f8_e4m3>(
+                stream, per_row, m, n, A, lda, scale, Q, ldq, amax, batch_count);
+        case HIPBLAS_R_8F_E5M2:
+            return amax_quantize<T, f8_e5m2>(
+                stream, per_row, m, n, A, lda, scale, Q, ldq, amax, batch_count);
+        case HIPBLAS_R_8I:
+            return amax_quantize<T, int8_t>(
+                stream, per_row, m, n, A, lda, scale, Q, ldq, amax, batch_count);
+        default:
+            return hipErrorInvalidValue;
+        }
+    }
+}
+
+hipError_t hipblas_scaled_to_float(hipStream_t       stream,
+                                   hipblasDatatype_t type,
+                                   int               rows,
+                                   int               cols,
+                                   const void*       X,
+                                   int64_t           ldx,
+                                   const float*      scale,
+                                   float*            Y)
+{
+    if(rows <= 0 || cols <= 0)
+        return hipSuccess;
+
+    switch(type)
+    {
+    case HIPBLAS_R_8F_E4M3:
+        return to_float<f8_e4m3>(stream, rows, cols, X, ldx, scale, Y);
+    case HIPBLAS_R_8F_E5M2:
+        return to_float<f8_e5m2>(stream, rows, cols, X, ldx, scale, Y);
+    case HIPBLAS_R_16F:
+        return to_float<hipblasHalf>(stream, rows, cols, X, ldx, scale, Y);
+    case HIPBLAS_R_16B:
+        return to_float<hipblasBfloat16>(stream, rows, cols, X, ldx, scale, Y);
+    case HIPBLAS_R_32F:
+        return to_float<float>(stream, rows, cols, X, ldx, scale, Y);
+    default:
+        return hipErrorInvalidValue;
+    }
+}
+
+hipError_t hipblas_scaled_from_float(hipStream_t       stream,
+                                     int               m,
+                                     int               n,
+                                     const float*      P,
+                                     void*             D,
+                                     hipblasDatatype_t type,
+                                     int64_t           ldd,
+                                     const float*      scale,
+                                     float*            amax)
+{
+    if(amax)
+    {
+        hipError_t err = hipMemsetAsync(amax, 0, sizeof(float), stream);
+        if(err != hipSuccess)
+            return err;
+    }
+    if(m <= 0 || n <= 0)
+        return hipSuccess;
+
+    switch(type)
+    {
+    case HIPBLAS_R_8F_E4M3:
+        return from_float<f8_e4m3>(stream, m, n, P, D, ldd, scale, amax);
+    case HIPBLAS_R_8F_E5M2:
+        return from_float<f8_e5m2>(stream, m, n, P, D, ldd, scale, amax);
+    case HIPBLAS_R_16F:
+        return from_float<hipblasHalf>(stream, m, n, P, D, ldd, scale, amax);
+    case HIPBLAS_R_16B:
+        return from_float<hipblasBfloat16>(stream, m, n, P, D, ldd, scale, amax);
+    case HIPBLAS_R_32F:
+        return from_float<float>(stream, m, n, P, D, ldd, scale, amax);
+    default:
+        return hipErrorInvalidValue;
+    }
+}
+
+hipError_t hipblas_amax_quantize_batched(hipStream_t                         stream,
+                                         bool                                per_row,
+                                         int                                 m,
+                                         int                                 n,
+                                         hipblas_batched_operand<const void> A,
+                                         hipblasDatatype_t                   a_type,
+                                         int64_t                             lda,
+                                         const float*                        scale,
+                                         hipblas_batched_operand<void>       Q,
+                                         hipblasDatatype_t                   q_type,
+                                         int64_t                             ldq,
+                                         float*                              amax,
+                                         int                                 batch_count)
+{
+    if(amax)
+    {
+        size_t     count = size_t(batch_count) * (per_row ? m : 1);
+        hipError_t err   = hipMemsetAsync(amax, 0, sizeof(float) * count, stream);
+        if(err != hipSuccess)
+            return err;
+    }
+    if(m <= 0 || n <= 0 || batch_count <= 0)
+        return hipSuccess;
+
+    // Without Q nothing is stored, so any output type will do
+    if(!Q.ptr && !Q.array)
+        q_type = HIPBLAS_R_8I;
+
+    switch(a_type)
+    {
+    case HIPBLAS_R_16F:
+        return amax_quantize_from<hipblasHalf>(
+            stream, per_row, m, n, A, lda, scale, Q, q_type, ldq, amax, batch_count);
+    case HIPBLAS_R_16B:
+        return amax_quantize_from<hipblasBfloat16>(
+            stream, per_row, m, n, A, lda, scale, Q, q_type, ldq, amax, batch_count);
+    case HIPBLAS_R_32F:
+        return amax_quantize_from<float>(
+            stream, per_row, m, n, A, lda, scale, Q, q_type, ldq, amax, batch_count);
+    default:
+        return hipErrorInvalidValue;
+    }
+}
@@ -0,0 +1,116 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "hipblas_kernels.h"
+#include <cstring>
+#include <hip/hip_runtime.h>
+
+namespace
+{
+    constexpr int MATRIX_DIM_X = 32;
+    constexpr int MATRIX_DIM_Y = 8;
+
+    template <typename E>
+    struct arith
+    {
+        __device__ static E    zero() { return 0; }
+        __device__ static E    add(E a, E b) { return a + b; }
+        __device__ static E    mul(E a, E b) { return a * b; }
+        __device__ static bool is_zero(E a) { return a == 0; }
+    };
+
+    template <typename R>
+    struct arith<hip_complex_number<R>>
+    {
+        using E = hip_complex_number<R>;
+        __device__ static E zero() { return {0, 0}; }
+        __device__ static E add(E a, E b) { return {a.x + b.x, a.y + b.y}; }
+        __device__ static E mul(E a, E b) { return {a.x * b.x - a.y * b.y, a.x * b.y + a.y * b.x}; }
+        __device__ static bool is_zero(E a) { return a.x == 0 && a.y == 0; }
+    };
+
+    // The parts are summed in order, so the result does not depend on the launch
+    template <typename E>
+    __global__ void split_k_reduce_kernel(int      m,
+                                          int      n,
+                                          int      parts,
+                                          const E* W,
+                                          int64_t  stride_w,
+                                          E        alpha_host,
+                                          E        beta_host,
+                                          const E* alpha_device,
+                                          const E* beta_device,
+                                          E*       C,
+                                          int64_t  ldc)
+    {
+        int i = blockIdx.x * blockDim.x + threadIdx.x;
+        int j = blockIdx.y * blockDim.y + threadIdx.y;
+        if(i >= m || j >= n)
+            return;
+
+        E alpha = alpha_device ? *alpha_device : alpha_host;
+        E beta  = beta_device ? *beta_device : beta_host;
+
+        const E* w   = W + i + size_t(j) * m;
+        E        sum = arith<E>::zero();
+        for(int p = 0; p < parts; p++)
+            sum = arith<E>::add(sum, w[p * stride_w]);
+
+        E* c = C + i + j * ldc;
+        E  v = arith<E>::mul(alpha, sum);
+        *c   = arith<E>::is_zero(beta) ? v : arith<E>::add(v, arith<E>::mul(beta, *c));
+    }
+
+    template <typename E, typename T>
+    E host_scalar(const T* value, bool device_scalars)
+    {
+        E v = {};
+        if(!device_scalars)
+            std::memcpy(&v, value, sizeof(E));
+        return v;
+    }
+}
+
+template <typename T>
+hipError_t hipblas_split_k_reduce(hipStream_t stream,
+                                  int         m,
+                                  int         n,
+                                  int         parts,
+                                  const T*    W,
+                                  int64_t     stride_w,
+                                  const T*    alpha,
+                                  const T*    beta,
+                                  bool        device_scalars,
+                                  T*          C,
+                                  int64_t     ldc)
+{
+    if(m <= 0 || n <= 0)
+        return hipSuccess;
+
+    hipLaunchKernelGGL(split_k_reduce_kernel<T>,
+                       dim3((m - 1) / MATRIX_DIM_X + 1, (n - 1) / MATRIX_DIM_Y + 1),
+                       dim3(MATRIX_DIM_X, MATRIX_DIM_Y),
+                       0,
+                       stream,
+                       m,
+                       n,
+                       parts,
+                       W,
+                       stride_w,
+                       host_scalar<T>(alpha, device_scalars),
+                       host_scalar<T>(beta, device_scalars),
+                       device_scalars ? alpha : nullptr,
+                       device_scalars ? beta : nullptr,
+                       C,
+                       ldc);
+    return hipGetLastError();
+}
+
+// clang-format off
+template hipError_t hipblas_split_k_reduce<float>(hipStream_t, int, int, int, const float*, int64_t, const float*, const float*, bool, float*, int64_t);
+template hipError_t hipblas_split_k_reduce<double>(hipStream_t, int, int, int, const double*, int64_t, const double*, const double*, bool, double*, int64_t);
+template hipError_t hipblas_split_k_reduce<hipblasComplex>(hipStream_t, int, int, int, const hipblasComplex*, int64_t, const hipblasComplex*, const hipblasComplex*, bool, hipblasComplex*, int64_t);
+template hipError_t hipblas_split_k_reduce<hipblasDoubleComplex>(hipStream_t, int, int, int, const hipblasDoubleComplex*, int64_t, const hipblasDoubleComplex*, const hipblasDoubleComplex*, bool, hipblasDoubleComplex*, int64_t);
+// clang-format on
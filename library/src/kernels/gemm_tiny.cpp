@@ -0,0 +1,306 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "hipblas_kernels.h"
+#include <algorithm>
+#include <cstring>
+#include <hip/hip_runtime.h>
+
+namespace
+{
+    // Up to TINY_THREAD_MAX a side each thread computes a whole matrix; above it a group of S
+    // threads shares one, each holding a column of C and of op(B) in registers
+    constexpr int TINY_BLOCK      = 128;
+    constexpr int TINY_THREAD_MAX = 4;
+    constexpr int MAX_GRID        = 65535;
+
+    template <typename E>
+    struct arith
+    {
+        __device__ static E    zero() { return 0; }
+        __device__ static E    add(E a, E b) { return a + b; }
+        __device__ static E    mul(E a, E b) { return a * b; }
+        __device__ static E    conj(E a) { return a; }
+        __device__ static bool is_zero(E a) { return a == 0; }
+    };
+
+    template <typename R>
+    struct arith<hip_complex_number<R>>
+    {
+        using E = hip_complex_number<R>;
+        __device__ static E    zero() { return {0, 0}; }
+        __device__ static E    add(E a, E b) { return {a.x + b.x, a.y + b.y}; }
+        __device__ static E    mul(E a, E b) { return {a.x * b.x - a.y * b.y, a.x * b.y + a.y * b.x}; }
+        __device__ static E    conj(E a) { return {a.x, -a.y}; }
+        __device__ static bool is_zero(E a) { return a.x == 0 && a.y == 0; }
+    };
+
+    template <typename E>
+    struct tiny_args
+    {
+        int      m;
+        int      n;
+        int      k;
+        E        alpha;
+        E        beta;
+        const E* alpha_dev;
+        const E* beta_dev;
+        int64_t  scalar_stride;
+        const E* A;
+        int64_t  lda;
+        int64_t  stride_a;
+        const E* B;
+        int64_t  ldb;
+        int64_t  stride_b;
+        E*       C;
+        int64_t  ldc;
+        int64_t  stride_c;
+        int      batch_count;
+    };
+
+    // Element (i, j) of op(M), the operation fixed at compile time
+    template <hipblasOperation_t OP, typename E>
+    __device__ E op_element(const E* M, int64_t ld, int i, int j)
+    {
+        if(OP == HIPBLAS_OP_N)
+            return M[i + j * ld];
+        E v = M[j + i * ld];
+        return OP == HIPBLAS_OP_C ? arith<E>::conj(v) : v;
+    }
+
+    // C = alpha * AB + beta * C, C unread when beta is zero
+    template <typename E>
+    __device__ void store(E* c, E alpha, E sum, E beta)
+    {
+        E r = arith<E>::mul(alpha, sum);
+        *c  = arith<E>::is_zero(beta) ? r : arith<E>::add(r, arith<E>::mul(beta, *c));
+    }
+
+    // One matrix per thread, op(A) and op(B) padded to S x S with zeros so the loops unroll fully
+    template <int S, hipblasOperation_t OPA, hipblasOperation_t OPB, typename E>
+    __global__ __launch_bounds__(TINY_BLOCK) void gemm_tiny_thread_kernel(tiny_args<E> p)
+    {
+        for(int64_t b = blockIdx.x * int64_t(TINY_BLOCK) + threadIdx.x; b < p.batch_count;
+            b += int64_t(gridDim.x) * TINY_BLOCK)
+        {
+            E    alpha = p.alpha_dev ? p.alpha_dev[b * p.scalar_stride] : p.alpha;
+            E    beta  = p.beta_dev ? p.beta_dev[b * p.scalar_stride] : p.beta;
+            bool load  = !arith<E>::is_zero(alpha);
+
+            const E* a = p.A + b * p.stride_a;
+            const E* w = p.B + b * p.stride_b;
+            E        a_reg[S][S];
+            E        b_reg[S][S];
+#pragma unroll
+            for(int l = 0; l < S; l++)
+#pragma unroll
+                for(int i = 0; i < S; i++)
+                {
+                    a_reg[i][l] = load && i < p.m && l < p.k ? op_element<OPA>(a, p.lda, i, l)
+                                                             : arith<E>::zero();
+                    b_reg[l][i] = load && l < p.k && i < p.n ? op_element<OPB>(w, p.ldb, l, i)
+                                                             : arith<E>::zero();
+                }
+
+            E* c = p.C + b * p.stride_c;
+#pragma unroll
+            for(int j = 0; j < S; j++)
+#pragma unroll
+                for(int i = 0; i < S; i++)
+                    if(i < p.m && j < p.n)
+                    {
+                        E sum = arith<E>::zero();
+#pragma unroll
+                        for(int l = 0; l < S; l++)
+                            sum = arith<E>::add(sum, arith<E>::mul(a_reg[i][l], b_reg[l][j]));
+                        store(c + i + j * p.ldc, alpha, sum, beta);
+                    }
+        }
+    }
+
+    // One matrix per group of S threads: thread t loads column t of op(A) into the group's tile
+    // and keeps column t of op(B) and of C in registers. Groups past the last batch still reach
+    // both barriers
+    template <int S, hipblasOperation_t OPA, hipblasOperation_t OPB, typename E>
+    __global__ __launch_bounds__(TINY_BLOCK) void gemm_tiny_group_kernel(tiny_args<E> p)
+    {
+        constexpr int GROUPS = TINY_BLOCK / S;
+        __shared__ E  a_tile[GROUPS][S][S + 1];
+
+        int     g      = threadIdx.x / S;
+        int     t      = threadIdx.x % S;
+        int64_t rounds = (int64_t(p.batch_count) + GROUPS - 1) / GROUPS;
+
+        for(int64_t r = blockIdx.x; r < rounds; r += gridDim.x)
+        {
+            int64_t b      = r * GROUPS + g;
+            bool    active = b < p.batch_count;
+            E       alpha  = arith<E>::zero();
+            E       beta   = arith<E>::zero();
+            if(active)
+            {
+                alpha = p.alpha_dev ? p.alpha_dev[b * p.scalar_stride] : p.alpha;
+                beta  = p.beta_dev ? p.beta_dev[b * p.scalar_stride] : p.beta;
+            }
+            bool load = active && !arith<E>::is_zero(alpha);
+
+            const E* a = load ? p.A + b * p.stride_a : nullptr;
+            const E* w = load ? p.B + b * p.stride_b : nullptr;
+            E        b_reg[S];
+#pragma unroll
+            for(int l = 0; l < S; l++)
+            {
+                a_tile[g][l][t] = load && l < p.m && t < p.k ? op_element<OPA>(a, p.lda, l, t)
+                                                             : arith<E>::zero();
+                b_reg[l]        = load && l < p.k && t < p.n ? op_element<OPB>(w, p.ldb, l, t)
+                                                             : arith<E>::zero();
+            }
+            __syncthreads();
+
+            if(active && t < p.n)
+            {
+                E* c = p.C + b * p.stride_c + t * p.ldc;
+#pragma unroll
+                for(int i = 0; i < S; i++)
+                    if(i < p.m)
+                    {
+                        E sum = arith<E>::zero();
+#pragma unroll
+                        for(int l = 0; l < S; l++)
+                            sum = arith<E>::add(sum, arith<E>::mul(a_tile[g][i][l], b_reg[l]));
+                        store(c + i, alpha, sum, beta);
+                    }
+            }
+            __syncthreads();
+        }
+    }
+
+    template <int S, hipblasOperation_t OPA, hipblasOperation_t OPB, typename E>
+    hipError_t launch_thread(hipStream_t stream, const tiny_args<E>& p)
+    {
+        int blocks = std::min((p.batch_count - 1) / TINY_BLOCK + 1, MAX_GRID);
+        hipLaunchKernelGGL((gemm_tiny_thread_kernel<S, OPA, OPB, E>),
+                           dim3(blocks),
+                           dim3(TINY_BLOCK),
+                           0,
+                           stream,
+                           p);
+        return hipGetLastError();
+    }
+
+    template <int S, hipblasOperation_t OPA, hipblasOperation_t OPB, typename E>
+    hipError_t launch_group(hipStream_t stream, const tiny_args<E>& p)
+    {
+        constexpr int GROUPS = TINY_BLOCK / S;
+        int           blocks = std::min((p.batch_count - 1) / GROUPS + 1, MAX_GRID);
+        hipLaunchKernelGGL((gemm_tiny_group_kernel<S, OPA, OPB, E>),
+                           dim3(blocks),
+                           dim3(TINY_BLOCK),
+                           0,
+                           stream,
+                           p);
+        return hipGetLastError();
+    }
+
+    // The smallest size bucket that holds every dimension
+    template <hipblasOperation_t OPA, hipblasOperation_t OPB, typename E>
+    hipError_t launch_size(hipStream_t stream, const tiny_args<E>& p)
+    {
+        int size = std::max({p.m, p.n, p.k});
+        if(size <= 2)
+            return launch_thread<2, OPA, OPB>(stream, p);
+        if(size <= TINY_THREAD_MAX)
+            return launch_thread<TINY_THREAD_MAX, OPA, OPB>(stream, p);
+        if(size <= 8)
+            return launch_group<8, OPA, OPB>(stream, p);
+        return launch_group<HIPBLAS_GEMM_TINY_MAX, OPA, OPB>(stream, p);
+    }
+
+    template <hipblasOperation_t OPA, typename E>
+    hipError_t launch_op_b(hipStream_t stream, hipblasOperation_t transb, const tiny_args<E>& p)
+    {
+        switch(transb)
+        {
+        case HIPBLAS_OP_N:
+            return launch_size<OPA, HIPBLAS_OP_N>(stream, p);
+        case HIPBLAS_OP_T:
+            return launch_size<OPA, HIPBLAS_OP_T>(stream, p);
+        default:
+            return launch_size<OPA, HIPBLAS_OP_C>(stream, p);
+        }
+    }
+
+    template <typename E, typename T>
+    E host_scalar(const T* value, bool device_scalars)
+    {
+        E v = {};
+        if(!device_scalars)
+            std::memcpy(&v, value, sizeof(E));
+        return v;
+    }
+}
+
+template <typename T>
+hipError_t hipblas_gemm_tiny_strided_batched(hipStream_t        stream,
+                                             hipblasOperation_t transa,
+                                             hipblasOperation_t transb,
+                                             int                m,
+                                             int                n,
+                                             int                k,
+                                             const T*           alpha,
+                                             const T*           beta,
+                                             bool               device_scalars,
+                                             int64_t            scalar_stride,
+                                             const T*           A,
+                                             int64_t            lda,
+                                             int64_t            stride_a,
+                                             const T*           B,
+                                             int64_t            ldb,
+                                             int64_t            stride_b,
+                                             T*                 C,
+                                             int64_t            ldc,
+                                             int64_t            stride_c,
+                                             int                batch_count)
+{
+    if(m <= 0 || n <= 0 || batch_count <= 0)
+        return hipSuccess;
+    if(std::max({m, n, k}) > HIPBLAS_GEMM_TINY_MAX)
+        return hipErrorInvalidValue;
+
+    tiny_args<T> p = {m,
+                      n,
+                      k,
+                      host_scalar<T>(alpha, device_scalars),
+                      host_scalar<T>(beta, device_scalars),
+                      device_scalars ? alpha : nullptr,
+                      device_scalars ? beta : nullptr,
+                      scalar_stride,
+                      A,
+                      lda,
+                      stride_a,
+                      B,
+                      ldb,
+                      stride_b,
+                      C,
+                      ldc,
+                      stride_c,
+                      batch_count};
+    switch(transa)
+    {
+    case HIPBLAS_OP_N:
+        return launch_op_b<HIPBLAS_OP_N>(stream, transb, p);
+    case HIPBLAS_OP_T:
+        return launch_op_b<HIPBLAS_OP_T>(stream, transb, p);
+    default:
+        return launch_op_b<HIPBLAS_OP_C>(stream, transb, p);
+    }
+}
+
+// clang-format off
+template hipError_t hipblas_gemm_tiny_strided_batched<float>(hipStream_t, hipblasOperation_t, hipblasOperation_t, int, int, int, const float*, const float*, bool, int64_t, const float*, int64_t, int64_t, const float*, int64_t, int64_t, float*, int64_t, int64_t, int);
+template hipError_t hipblas_gemm_tiny_strided_batched<double>(hipStream_t, hipblasOperation_t, hipblasOperation_t, int, int, int, const double*, const double*, bool, int64_t, const double*, int64_t, int64_t, const double*, int64_t, int64_t, double*, int64_t, int64_t, int);
+template hipError_t hipblas_gemm_tiny_strided_batched<hipblasComplex>(hipStream_t, hipblasOperation_t, hipblasOperation_t, int, int, int, const hipblasComplex*, const hipblasComplex*, bool, int64_t, const hipblasComplex*, int64_t, int64_t, const hipblasComplex*, int64_t, int64_t, hipblasComplex*, int64_t, int64_t, int);
+template hipError_t hipblas_gemm_tiny_strided_batched<hipblasDoubleComplex>(hipStream_t, hipblasOperation_t, hipblasOperation_t, int, int, int, const hipblasDoubleComplex*, const hipblasDoubleComplex*, bool, int64_t, const hipblasDoubleComplex*, int64_t, int64_t, const hipblasDoubleComplex*, int64_t, int64_t, hipblasDoubleComplex*, int64_t, int64_t, int);
+// clang-format on
@@ -0,0 +1,212 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "hipblas_kernels.h"
+#include <algorithm>
+#include <hip/hip_runtime.h>
+
+namespace
+{
+    // One block of GESV_N threads per system: thread t owns row t while factoring, column t of
+    // the swaps, and right-hand sides t, t + GESV_N, ... while solving
+    constexpr int GESV_N = HIPBLAS_GESV_SMALL_N;
+
+    constexpr int MAX_GRID_BATCH = 65535;
+
+    template <typename E>
+    struct arith
+    {
+        using real = E;
+        __device__ static E    sub(E a, E b) { return a - b; }
+        __device__ static E    mul(E a, E b) { return a * b; }
+        __device__ static E    div(E a, E b) { return a / b; }
+        __device__ static real abs1(E a) { return a < 0 ? -a : a; }
+        __device__ static bool is_zero(E a) { return a == 0; }
+    };
+
+    template <typename R>
+    struct arith<hip_complex_number<R>>
+    {
+        using E    = hip_complex_number<R>;
+        using real = R;
+        __device__ static E    sub(E a, E b) { return {a.x - b.x, a.y - b.y}; }
+        __device__ static E    mul(E a, E b) { return {a.x * b.x - a.y * b.y, a.x * b.y + a.y * b.x}; }
+        __device__ static E    div(E a, E b)
+        {
+            R d = b.x * b.x + b.y * b.y;
+            return {(a.x * b.x + a.y * b.y) / d, (a.y * b.x - a.x * b.y) / d};
+        }
+        // |re| + |im|, the magnitude LAPACK pivots on for complex matrices
+        __device__ static real abs1(E a) { return (a.x < 0 ? -a.x : a.x) + (a.y < 0 ? -a.y : a.y); }
+        __device__ static bool is_zero(E a) { return a.x == 0 && a.y == 0; }
+    };
+
+    template <typename E>
+    __device__ E* batch_at(hipblas_batched_operand<E> op, int b)
+    {
+        return op.array ? op.array[b] : op.ptr + b * op.stride;
+    }
+
+    // Every thread of a block runs the same loops for the same n, so the barriers stay uniform
+    template <typename E>
+    __global__ void gesv_kernel(int                        n,
+                                int                        nrhs,
+                                hipblas_batched_operand<E> A,
+                                int64_t                    lda,
+                                int*                       ipiv,
+                                int64_t                    strideP,
+                                hipblas_batched_operand<E> B,
+                                int64_t                    ldb,
+                                int*                       info,
+                                int                        batch_count)
+    {
+        using real = typename arith<E>::real;
+
+        __shared__ E   lu[GESV_N][GESV_N + 1];
+        __shared__ int piv[GESV_N];
+        __shared__ int singular;
+
+        int t = threadIdx.x;
+        for(int b = blockIdx.z; b < batch_count; b += gridDim.z)
+        {
+            E* a = batch_at(A, b);
+            if(t < n)
+                for(int j = 0; j < n; j++)
+                    lu[t][j] = a[t + j * lda];
+            if(t == 0)
+                singular = 0;
+            __syncthreads();
+
+            for(int j = 0; j < n; j++)
+            {
+                // At most GESV_N candidates, so one thread scans them
+                if(t == 0)
+                {
+                    int  p    = j;
+                    real best = arith<E>::abs1(lu[j][j]);
+                    for(int r = j + 1; r < n; r++)
+                    {
+                        real v = arith<E>::abs1(lu[r][j]);
+                        if(v > best)
+                        {
+                            best = v;
+                            p    = r;
+                        }
+                    }
+                    piv[j] = p;
+                    if(best == 0 && singular == 0)
+                        singular = j + 1;
+                }
+                __syncthreads();
+
+                int p = piv[j];
+                if(p != j && t < n)
+                {
+                    E swap   = lu[j][t];
+                    lu[j][t] = lu[p][t];
+                    lu[p][t] = swap;
+                }
+                __syncthreads();
+
+                // A zero pivot leaves its column as it is, as LAPACK's getrf does
+                if(t > j && t < n && !arith<E>::is_zero(lu[j][j]))
+                {
+                    E l      = arith<E>::div(lu[t][j], lu[j][j]);
+                    lu[t][j] = l;
+                    for(int c = j + 1; c < n; c++)
+                        lu[t][c] = arith<E>::sub(lu[t][c], arith<E>::mul(l, lu[j][c]));
+                }
+                __syncthreads();
+            }
+
+            if(t < n)
+            {
+                for(int j = 0; j < n; j++)
+                    a[t + j * lda] = lu[t][j];
+                if(ipiv)
+                    ipiv[b * strideP + t] = piv[t] + 1;
+            }
+            if(t == 0)
+                info[b] = singular;
+
+            if(singular == 0)
+                for(int c = t; c < nrhs; c += GESV_N)
+                {
+                    E* x = batch_at(B, b) + c * ldb;
+                    E  v[GESV_N];
+                    for(int i = 0; i < n; i++)
+                        v[i] = x[i];
+
+                    for(int i = 0; i < n; i++)
+                    {
+                        E swap    = v[i];
+                        v[i]      = v[piv[i]];
+                        v[piv[i]] = swap;
+                    }
+                    for(int i = 1; i < n; i++)
+                        for(int r = 0; r < i; r++)
+                            v[i] = arith<E>::sub(v[i], arith<E>::mul(lu[i][r], v[r]));
+                    for(int i = n - 1; i >= 0; i--)
+                    {
+                        for(int r = i + 1; r < n; r++)
+                            v[i] = arith<E>::sub(v[i], arith<E>::mul(lu[i][r], v[r]));
+                        v[i] = arith<E>::div(v[i], lu[i][i]);
+                    }
+
+                    for(int i = 0; i < n; i++)
+                        x[i] = v[i];
+                }
+
+            // The next batch reuses lu, piv and singular
+            __syncthreads();
+        }
+    }
+}
+
+template <typename T>
+hipError_t hipblas_gesv_batched(hipStream_t                stream,
+                                int                        n,
+                                int                        nrhs,
+                                hipblas_batched_operand<T> A,
+                                int64_t                    lda,
+                                int*                       ipiv,
+                                int64_t                    strideP,
+                                hipblas_batched_operand<T> B,
+                                int64_t                    ldb,
+                                int*                       info,
+                                int                        batch_count)
+{
+    if(n > GESV_N)
+        return hipErrorInvalidValue;
+    if(batch_count <= 0)
+        return hipSuccess;
+
+    dim3 grid(1, 1, std::min(batch_count, MAX_GRID_BATCH));
+    dim3 threads(GESV_N);
+
+    hipLaunchKernelGGL(gesv_kernel<T>,
+                       grid,
+                       threads,
+                       0,
+                       stream,
+                       n,
+                       nrhs,
+                       A,
+                       lda,
+                       ipiv,
+                       strideP,
+                       B,
+                       ldb,
+                       info,
+                       batch_count);
+    return hipGetLastError();
+}
+
+// clang-format off
+template hipError_t hipblas_gesv_batched<float>(hipStream_t, int, int, hipblas_batched_operand<float>, int64_t, int*, int64_t, hipblas_batched_operand<float>, int64_t, int*, int);
+template hipError_t hipblas_gesv_batched<double>(hipStream_t, int, int, hipblas_batched_operand<double>, int64_t, int*, int64_t, hipblas_batched_operand<double>, int64_t, int*, int);
+template hipError_t hipblas_gesv_batched<hipblasComplex>(hipStream_t, int, int, hipblas_batched_operand<hipblasComplex>, int64_t, int*, int64_t, hipblas_batched_operand<hipblasComplex>, int64_t, int*, int);
+template hipError_t hipblas_gesv_batched<hipblasDoubleComplex>(hipStream_t, int, int, hipblas_batched_operand<hipblasDoubleComplex>, int64_t, int*, int64_t, hipblas_batched_operand<hipblasDoubleComplex>, int64_t, int*, int);
+// clang-format on
@@ -0,0 +1,436 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "hipblas_kernels.h"
+#include <algorithm>
+#include <hip/hip_runtime.h>
+#include <limits>
+
+namespace
+{
+    // One block of GESVDJ_DIM threads per matrix, split into one group of lanes per rotation of a
+    // round. The matrix is rotated in place in global memory, which stays in cache for the sizes
+    // taken here, so no size of the long side is too large
+    constexpr int GESVDJ_DIM = 256;
+    constexpr int GESVDJ_N   = HIPBLAS_GESVDJ_SMALL_N;
+
+    constexpr int MAX_GRID_BATCH = 65535;
+
+    template <typename E>
+    struct arith
+    {
+        using real = E;
+        __device__ static E    make(real re) { return re; }
+        __device__ static E    conj(E a) { return a; }
+        __device__ static E    mul(E a, E b) { return a * b; }
+        __device__ static E    axpby(real a, E x, real b, E y) { return a * x + b * y; }
+        __device__ static real abs(E a) { return a < 0 ? -a : a; }
+        __device__ static real abs2(E a) { return a * a; }
+        __device__ static E    scale(E a, real s) { return a * s; }
+    };
+
+    template <typename R>
+    struct arith<hip_complex_number<R>>
+    {
+        using E    = hip_complex_number<R>;
+        using real = R;
+        __device__ static E    make(real re) { return {re, 0}; }
+        __device__ static E    conj(E a) { return {a.x, -a.y}; }
+        __device__ static E    mul(E a, E b)
+        {
+            return {a.x * b.x - a.y * b.y, a.x * b.y + a.y * b.x};
+        }
+        __device__ static E    axpby(real a, E x, real b, E y)
+        {
+            return {a * x.x + b * y.x, a * x.y + b * y.y};
+        }
+        // Scaled by the larger part, so squaring neither overflows nor underflows
+        __device__ static real abs(E a)
+        {
+            R x = a.x < 0 ? -a.x : a.x;
+            R y = a.y < 0 ? -a.y : a.y;
+            R m = x > y ? x : y;
+            if(m == 0)
+                return 0;
+            x /= m, y /= m;
+            return m * sqrt(x * x + y * y);
+        }
+        __device__ static real abs2(E a) { return a.x * a.x + a.y * a.y; }
+        __device__ static E    scale(E a, real s) { return {a.x * s, a.y * s}; }
+    };
+
+    template <typename E>
+    __device__ E* batch_at(hipblas_batched_operand<E> op, int b)
+    {
+        return op.array ? op.array[b] : op.ptr + b * op.stride;
+    }
+
+    // The columns or the rows of a matrix as vectors: element i of vector k is at
+    // ptr[i * inc + k * ld]
+    template <typename E>
+    struct vectors
+    {
+        E*      ptr;
+        int64_t inc;
+        int64_t ld;
+
+        __device__ E& operator()(int i, int k) const { return ptr[i * inc + k * ld]; }
+    };
+
+    // The sums of aa, bb and ab over each group of g lanes, left in the slots of the group's first
+    // lane. Every thread takes part, so the barriers stay uniform
+    template <typename E, typename R>
+    __device__ void group_sum(R* ra, R* rb, E* rg, R aa, R bb, E ab, int g)
+    {
+        int t = threadIdx.x;
+        ra[t] = aa;
+        rb[t] = bb;
+        rg[t] = ab;
+        __syncthreads();
+        for(int s = g / 2; s > 0; s /= 2)
+        {
+            if(t % g < s)
+            {
+                ra[t] += ra[t + s];
+                rb[t] += rb[t + s];
+                rg[t] = arith<E>::axpby(1, rg[t], 1, rg[t + s]);
+            }
+            __syncthreads();
+        }
+    }
+
+    // One-sided (Hestenes) Jacobi: the rotations that orthogonalise the longer vectors of A, its
+    // columns when m >= n and otherwise the conjugates of its rows, are applied to A and, for the
+    // singular vectors on the other side, accumulated in U or V. Each sweep is the round-robin
+    // pairing of the vectors as in syevj, and at the end the vector norms are the singular values
+    // and the normalised vectors the singular vectors on their side. Rows are stored conjugated,
+    // which the same rotations keep, so only the accumulation, stored the other way, conjugates
+    // their phase
+    template <typename E>
+    __global__ void gesvdj_kernel(bool                       columns,
+                                  bool                       left,
+                                  bool                       right,
+                                  int                        m,
+                                  int                        n,
+                                  hipblas_batched_operand<E> A,
+                                  int64_t                    lda,
+                                  typename arith<E>::real    abstol,
+                                  typename arith<E>::real*   residual,
+                                  int                        max_sweeps,
+                                  int*                       n_sweeps,
+                                  typename arith<E>::real*   S,
+                                  int64_t                    strideS,
+                                  E*                         U,
+                                  int64_t                    ldu,
+                                  int64_t                    strideU,
+                                  E*                         V,
+                                  int64_t                    ldv,
+                                  int64_t                    strideV,
+                                  int*                       info,
+                                  int                        batch_count)
+    {
+        using R = typename arith<E>::real;
+
+        __shared__ R    ra[GESVDJ_DIM], rb[GESVDJ_DIM];
+        __shared__ E    rg[GESVDJ_DIM];
+        __shared__ R    cs[GESVDJ_N / 2], sn[GESVDJ_N / 2], off2[GESVDJ_N / 2];
+        __shared__ E    ph[GESVDJ_N / 2];
+        __shared__ R    sigma[GESVDJ_N];
+        __shared__ int  rank[GESVDJ_N];
+        __shared__ bool lead[GESVDJ_N];
+        __shared__ R    off_sum;
+
+        const R eps   = std::numeric_limits<R>::epsilon();
+        int     t     = threadIdx.x;
+        int     len   = columns ? m : n;
+        int     count = columns ? n : m;
+        int     mc    = count + (count & 1);
+        int     pairs = mc / 2;
+
+        // The widest group, up to a wavefront, that gives every rotation its own
+        int g = 32;
+        while(g * pairs > GESVDJ_DIM)
+            g /= 2;
+        int  pi     = t / g;
+        int  lane   = t % g;
+        bool active = pi < pairs;
+
+        // The other side's singular vectors come from the rotations, this side's from A
+        bool accumulate = columns ? right : left;
+        bool normalise  = columns ? left : right;
+
+        for(int b = blockIdx.z; b < batch_count; b += gridDim.z)
+        {
+            E*         ub = U + b * strideU;
+            E*         vb = V + b * strideV;
+            vectors<E> w{batch_at(A, b), columns ? 1 : lda, columns ? lda : 1};
+            vectors<E> acc{columns ? vb : ub, columns ? ldv : 1, columns ? 1 : ldu};
+            vectors<E> out{columns ? ub : vb, columns ? 1 : ldv, columns ? ldu : 1};
+
+            if(accumulate)
+                for(int e = t; e < count * count; e += GESVDJ_DIM)
+                    acc(e % count, e / count) = arith<E>::make(e % count == e / count ? 1 : 0);
+
+            // The squared Frobenius norm of A, which the rotations keep
+            R fro = 0;
+            for(int e = t; e < len * count; e += GESVDJ_DIM)
+                fro += arith<E>::abs2(w(e % len, e / len));
+            group_sum(ra, rb, rg, fro, R(0), arith<E>::make(0), GESVDJ_DIM);
+            R tol = (abstol > 0 ? abstol : eps) * ra[0];
+            __syncthreads();
+
+            // The off-diagonal norm of A^H A over each sweep, from the products its rotations zero
+            R   off    = 0;
+            int sweeps = 0;
+            while(count > 1 && sweeps < max_sweeps)
+            {
+                if(t < pairs)
+                    off2[t] = 0;
+
+                for(int r = 0; r < mc - 1; r++)
+                {
+                    int p = 0, q = 0;
+                    if(active)
+                    {
+                        p = pi == 0 ? mc - 1 : (r + pi) % (mc - 1);
+                        q = pi == 0 ? r : (r - pi + mc - 1) % (mc - 1);
+                        if(p > q)
+                        {
+                            int s = p;
+                            p     = q;
+                            q     = s;
+                        }
+                    }
+                    bool live = active && q < count;
+
+                    R aa = 0, bb = 0;
+                    E ab = arith<E>::make(0);
+                    if(live)
+                        for(int i = lane; i < len; i += g)
+                        {
+                            E x = w(i, p);
+                            E y = w(i, q);
+                            aa += arith<E>::abs2(x);
+                            bb += arith<E>::abs2(y);
+                            ab = arith<E>::axpby(1, ab, 1, arith<E>::mul(arith<E>::conj(x), y));
+                        }
+                    group_sum(ra, rb, rg, aa, bb, ab, g);
+
+                    if(live && lane == 0)
+                    {
+                        // The rotation that zeroes w_p^H w_q, with it turned real by the phase e
+                        E gpq = rg[t];
+                        R gn  = arith<E>::abs(gpq);
+                        R c = 1, s = 0;
+                        E e = arith<E>::make(1);
+                        if(gn != 0)
+                        {
+                            R zeta = (rb[t] - ra[t]) / (2 * gn);
+                            R az   = zeta < 0 ? -zeta : zeta;
+                            R root = az > 1 / eps ? az : sqrt(1 + zeta * zeta);
+                            R tn   = (zeta < 0 ? -1 : 1) / (az + root);
+                            c      = 1 / sqrt(1 + tn * tn);
+                            s      = tn * c;
+                            e      = arith<E>::scale(gpq, 1 / gn);
+                        }
+                        cs[pi] = c;
+                        sn[pi] = s;
+                        ph[pi] = e;
+                        off2[pi] += gn * gn;
+                    }
+                    __syncthreads();
+
+                    // w_p = c w_p - s conj(e) w_q and w_q = s e w_p + c w_q
+                    if(live && sn[pi] != 0)
+                    {
+                        R c  = cs[pi];
+                        R s  = sn[pi];
+                        E e  = ph[pi];
+                        E ec = arith<E>::conj(e);
+                        for(int i = lane; i < len; i += g)
+                        {
+                            E x     = w(i, p);
+                            E y     = w(i, q);
+                            w(i, p) = arith<E>::axpby(c, x, -s, arith<E>::mul(ec, y));
+                            w(i, q) = arith<E>::axpby(s, arith<E>::mul(e, x), c, y);
+                        }
+                        if(accumulate)
+                            for(int i = lane; i < count; i += g)
+                            {
+                                E x       = acc(i, p);
+                                E y       = acc(i, q);
+                                acc(i, p) = arith<E>::axpby(c, x, -s, arith<E>::mul(e, y));
+                                acc(i, q) = arith<E>::axpby(s, arith<E>::mul(ec, x), c, y);
+                            }
+                    }
+                    __syncthreads();
+                }
+
+                if(t == 0)
+                {
+                    R so = 0;
+                    for(int i = 0; i < pairs; i++)
+                        so += off2[i];
+                    off_sum = so;
+                }
+                __syncthreads();
+                off = sqrt(2 * off_sum);
+                sweeps++;
+                if(off <= tol)
+                    break;
+            }
+
+            // The singular values, group pi measuring vectors pi and pi + pairs
+            {
+                int p  = pi;
+                int q  = pi + pairs;
+                R   aa = 0, bb = 0;
+                if(active)
+                    for(int i = lane; i < len; i += g)
+                    {
+                        if(p < count)
+                            aa += arith<E>::abs2(w(i, p));
+                        if(q < count)
+                            bb += arith<E>::abs2(w(i, q));
+                    }
+                group_sum(ra, rb, rg, aa, bb, arith<E>::make(0), g);
+                if(active && lane == 0)
+                {
+                    if(p < count)
+                        sigma[p] = sqrt(ra[t]);
+                    if(q < count)
+                        sigma[q] = sqrt(rb[t]);
+                }
+                __syncthreads();
+            }
+
+            if(t == 0)
+            {
+                residual[b] = off;
+                n_sweeps[b] = sweeps;
+                info[b]     = off <= tol ? 0 : 1;
+            }
+
+            // Singular values in descending order, each vector going to the place of its rank
+            if(t < count)
+            {
+                R   d = sigma[t];
+                int k = 0;
+                for(int j = 0; j < count; j++)
+                    k += sigma[j] > d || (sigma[j] == d && j < t);
+                rank[t]            = k;
+                S[b * strideS + k] = d;
+            }
+            __syncthreads();
+
+            // A cycle of the permutation is moved from its smallest member
+            if(t < count)
+            {
+                bool smallest = true;
+                for(int j = rank[t]; j != t; j = rank[j])
+                    smallest = smallest && j > t;
+                lead[t] = smallest;
+            }
+            __syncthreads();
+
+            // Vectors of zero singular values are left zero
+            if(normalise)
+                for(int e = t; e < len * count; e += GESVDJ_DIM)
+                {
+                    int i = e % len;
+                    int k = e / len;
+                    R   s = sigma[k];
+                    out(i, rank[k]) = s > 0 ? arith<E>::scale(w(i, k), 1 / s) : arith<E>::make(0);
+                }
+
+            // The accumulated vectors permuted in place, one element index per thread
+            if(accumulate)
+                for(int i = t; i < count; i += GESVDJ_DIM)
+                    for(int k = 0; k < count; k++)
+                    {
+                        if(!lead[k])
+                            continue;
+                        E x = acc(i, k);
+                        for(int j = rank[k]; j != k; j = rank[j])
+                        {
+                            E y       = acc(i, j);
+                            acc(i, j) = x;
+                            x         = y;
+                        }
+                        acc(i, k) = x;
+                    }
+
+            // The next batch reuses the shared arrays
+            __syncthreads();
+        }
+    }
+}
+
+template <typename T, typename R>
+hipError_t hipblas_gesvdj_batched(hipStream_t                stream,
+                                  bool                       left,
+                                  bool                       right,
+                                  int                        m,
+                                  int                        n,
+                                  hipblas_batched_operand<T> A,
+                                  int64_t                    lda,
+                                  R                          abstol,
+                                  R*                         residual,
+                                  int                        max_sweeps,
+                                  int*                       n_sweeps,
+                                  R*                         S,
+                                  int64_t                    strideS,
+                                  T*                         U,
+                                  int64_t                    ldu,
+                                  int64_t                    strideU,
+                                  T*                         V,
+                                  int64_t                    ldv,
+                                  int64_t                    strideV,
+                                  int*                       info,
+                                  int                        batch_count)
+{
+    if(std::min(m, n) > GESVDJ_N)
+        return hipErrorInvalidValue;
+    if(batch_count <= 0)
+        return hipSuccess;
+
+    dim3 grid(1, 1, std::min(batch_count, MAX_GRID_BATCH));
+    dim3 threads(GESVDJ_DIM);
+
+    hipLaunchKernelGGL(gesvdj_kernel<T>,
+                       grid,
+                       threads,
+                       0,
+                       stream,
+                       m >= n,
+                       left,
+                       right,
+                       m,
+                       n,
+                       A,
+                       lda,
+                       abstol,
+                       residual,
+                       max_sweeps,
+                       n_sweeps,
+                       S,
+                       strideS,
+                       U,
+                       ldu,
+                       strideU,
+                       V,
+                       ldv,
+                       strideV,
+                       info,
+                       batch_count);
+    return hipGetLastError();
+}
+
+// clang-format off
+template hipError_t hipblas_gesvdj_batched<float, float>(hipStream_t, bool, bool, int, int, hipblas_batched_operand<float>, int64_t, float, float*, int, int*, float*, int64_t, float*, int64_t, int64_t, float*, int64_t, int64_t, int*, int);
+template hipError_t hipblas_gesvdj_batched<double, double>(hipStream_t, bool, bool, int, int, hipblas_batched_operand<double>, int64_t, double, double*, int, int*, double*, int64_t, double*, int64_t, int64_t, double*, int64_t, int64_t, int*, int);
+template hipError_t hipblas_gesvdj_batched<hipblasComplex, float>(hipStream_t, bool, bool, int, int, hipblas_batched_operand<hipblasComplex>, int64_t, float, float*, int, int*, float*, int64_t, hipblasComplex*, int64_t, int64_t, hipblasComplex*, int64_t, int64_t, int*, int);
+template hipError_t hipblas_gesvdj_batched<hipblasDoubleComplex, double>(hipStream_t, bool, bool, int, int, hipblas_batched_operand<hipblasDoubleComplex>, int64_t, double, double*, int, int*, double*, int64_t, hipblasDoubleComplex*, int64_t, int64_t, hipblasDoubleComplex*, int64_t, int64_t, int*, int);
+// clang-format on
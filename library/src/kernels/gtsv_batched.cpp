@@ -0,0 +1,118 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "hipblas_kernels.h"
+#include <hip/hip_runtime.h>
+
+namespace
+{
+    constexpr int GTSV_DIM_X = 256;
+
+    template <typename E>
+    struct arith
+    {
+        __device__ static E sub(E a, E b) { return a - b; }
+        __device__ static E mul(E a, E b) { return a * b; }
+        __device__ static E div(E a, E b) { return a / b; }
+    };
+
+    template <typename R>
+    struct arith<hip_complex_number<R>>
+    {
+        using E = hip_complex_number<R>;
+        __device__ static E sub(E a, E b) { return {a.x - b.x, a.y - b.y}; }
+        __device__ static E mul(E a, E b) { return {a.x * b.x - a.y * b.y, a.x * b.y + a.y * b.x}; }
+        __device__ static E div(E a, E b)
+        {
+            R d = b.x * b.x + b.y * b.y;
+            return {(a.x * b.x + a.y * b.y) / d, (a.y * b.x - a.x * b.y) / d};
+        }
+    };
+
+    // One thread per system runs the Thomas algorithm. The eliminated superdiagonal goes to work
+    // with the systems interleaved, so those accesses coalesce whatever the layout of the system
+    template <typename E>
+    __global__ void gtsv_kernel(int      m,
+                                const E* dl,
+                                const E* d,
+                                const E* du,
+                                E*       x,
+                                int64_t  inc,
+                                int64_t  stride,
+                                E*       work,
+                                int      batch_count)
+    {
+        int b = blockIdx.x * blockDim.x + threadIdx.x;
+        if(b >= batch_count)
+            return;
+
+        int64_t base = b * stride;
+        E       c{};
+        E       y{};
+        for(int i = 0; i < m; i++)
+        {
+            int64_t k = base + i * inc;
+            // dl(0) and du(m - 1) lie outside the matrix and are never read
+            E l     = i > 0 ? dl[k] : E{};
+            E pivot = arith<E>::sub(d[k], arith<E>::mul(l, c));
+            y       = arith<E>::div(arith<E>::sub(x[k], arith<E>::mul(l, y)), pivot);
+            x[k]    = y;
+            if(i < m - 1)
+            {
+                c                                  = arith<E>::div(du[k], pivot);
+                work[int64_t(i) * batch_count + b] = c;
+            }
+        }
+
+        for(int i = m - 2; i >= 0; i--)
+        {
+            int64_t k = base + i * inc;
+            y         = arith<E>::sub(x[k], arith<E>::mul(work[int64_t(i) * batch_count + b], y));
+            x[k]      = y;
+        }
+    }
+}
+
+template <typename T>
+hipError_t hipblas_gtsv_batched(hipStream_t stream,
+                                int         m,
+                                const T*    dl,
+                                const T*    d,
+                                const T*    du,
+                                T*          x,
+                                int64_t     inc,
+                                int64_t     stride,
+                                T*          work,
+                                int         batch_count)
+{
+    if(m <= 0 || batch_count <= 0)
+        return hipSuccess;
+
+    dim3 grid((batch_count - 1) / GTSV_DIM_X + 1);
+    dim3 threads(GTSV_DIM_X);
+
+    hipLaunchKernelGGL(gtsv_kernel<T>,
+                       grid,
+                       threads,
+                       0,
+                       stream,
+                       m,
+                       dl,
+                       d,
+                       du,
+                       x,
+                       inc,
+                       stride,
+                       work,
+                       batch_count);
+    return hipGetLastError();
+}
+
+// clang-format off
+template hipError_t hipblas_gtsv_batched<float>(hipStream_t, int, const float*, const float*, const float*, float*, int64_t, int64_t, float*, int);
+template hipError_t hipblas_gtsv_batched<double>(hipStream_t, int, const double*, const double*, const double*, double*, int64_t, int64_t, double*, int);
+template hipError_t hipblas_gtsv_batched<hipblasComplex>(hipStream_t, int, const hipblasComplex*, const hipblasComplex*, const hipblasComplex*, hipblasComplex*, int64_t, int64_t, hipblasComplex*, int);
+template hipError_t hipblas_gtsv_batched<hipblasDoubleComplex>(hipStream_t, int, const hipblasDoubleComplex*, const hipblasDoubleComplex*, const hipblasDoubleComplex*, hipblasDoubleComplex*, int64_t, int64_t, hipblasDoubleComplex*, int);
+// clang-format on
@@ -0,0 +1,58 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "hipblas_kernels.h"
+#include <climits>
+#include <hip/hip_runtime.h>
+
+namespace
+{
+    // One block, which reads the info array with every thread; a power of two for the shared
+    // memory tree
+    constexpr int INFO_DIM_X = 1024;
+
+    __global__ void info_reduce_kernel(int batch_count, const int* info, int* result)
+    {
+        __shared__ int s_count[INFO_DIM_X];
+        __shared__ int s_first[INFO_DIM_X];
+
+        int tid   = threadIdx.x;
+        int count = 0;
+        int first = INT_MAX;
+        for(int b = tid; b < batch_count; b += blockDim.x)
+            if(info[b] != 0)
+            {
+                count++;
+                first = b < first ? b : first;
+            }
+        s_count[tid] = count;
+        s_first[tid] = first;
+        __syncthreads();
+
+        for(int half = blockDim.x / 2; half > 0; half /= 2)
+        {
+            if(tid < half)
+            {
+                int other = s_first[tid + half];
+                s_count[tid] += s_count[tid + half];
+                s_first[tid] = other < s_first[tid] ? other : s_first[tid];
+            }
+            __syncthreads();
+        }
+
+        if(tid == 0)
+        {
+            result[0] = s_count[0];
+            result[1] = s_count[0] ? s_first[0] : -1;
+        }
+    }
+}
+
+hipError_t hipblas_info_reduce(hipStream_t stream, int batch_count, const int* info, int* result)
+{
+    hipLaunchKernelGGL(
+        info_reduce_kernel, dim3(1), dim3(INFO_DIM_X), 0, stream, batch_count, info, result);
+    return hipGetLastError();
+}
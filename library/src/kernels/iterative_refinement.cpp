@@ -0,0 +1,400 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "hipblas_kernels.h"
+#include <algorithm>
+#include <hip/hip_runtime.h>
+#include <limits>
+
+namespace
+{
+    constexpr int REDUCE_DIM_X = 256;
+
+    constexpr int MAX_GRID_BATCH = 65535;
+
+    // Element-wise kernels stride over the matrix with at most this many blocks per batch
+    constexpr int MAX_GRID_ELEMENTS = 1024;
+
+    template <typename E>
+    struct arith
+    {
+        using real = E;
+        __device__ static E    add(E a, E b) { return a + b; }
+        __device__ static real abs(E a) { return a < 0 ? -a : a; }
+        __device__ static real abs1(E a) { return abs(a); }
+        __device__ static real max_part(E a) { return abs(a); }
+    };
+
+    template <typename R>
+    struct arith<hip_complex_number<R>>
+    {
+        using E    = hip_complex_number<R>;
+        using real = R;
+        __device__ static E add(E a, E b) { return {a.x + b.x, a.y + b.y}; }
+        // Scaled by the larger part, so squaring neither overflows nor underflows
+        __device__ static real abs(E a)
+        {
+            R x = a.x < 0 ? -a.x : a.x;
+            R y = a.y < 0 ? -a.y : a.y;
+            R m = x > y ? x : y;
+            if(m == 0)
+                return 0;
+            x /= m, y /= m;
+            return m * sqrt(x * x + y * y);
+        }
+        // |re| + |im|, the magnitude LAPACK's refinement tests compare
+        __device__ static real abs1(E a) { return (a.x < 0 ? -a.x : a.x) + (a.y < 0 ? -a.y : a.y); }
+        __device__ static real max_part(E a)
+        {
+            R x = a.x < 0 ? -a.x : a.x;
+            R y = a.y < 0 ? -a.y : a.y;
+            return x > y ? x : y;
+        }
+    };
+
+    template <typename Ed>
+    struct converter
+    {
+        template <typename Es>
+        __device__ static Ed from(Es v)
+        {
+            return Ed(v);
+        }
+    };
+
+    template <typename R>
+    struct converter<hip_complex_number<R>>
+    {
+        template <typename S>
+        __device__ static hip_complex_number<R> from(hip_complex_number<S> v)
+        {
+            return {R(v.x), R(v.y)};
+        }
+    };
+
+    template <typename E>
+    __device__ E* batch_at(hipblas_batched_operand<E> op, int b)
+    {
+        return op.array ? op.array[b] : op.ptr + b * op.stride;
+    }
+
+    template <typename R>
+    __device__ R block_max(R* partial, R v)
+    {
+        int tid      = threadIdx.x;
+        partial[tid] = v;
+        __syncthreads();
+        for(int half = blockDim.x / 2; half > 0; half /= 2)
+        {
+            if(tid < half && partial[tid + half] > partial[tid])
+                partial[tid] = partial[tid + half];
+            __syncthreads();
+        }
+        R r = partial[0];
+        __syncthreads();
+        return r;
+    }
+
+    // Batches with a nonzero state are skipped when there is a state; a value outside
+    // [-limit, limit] marks its batch HIPBLAS_REFINE_OVERFLOW, as LAPACK's dlag2s does
+    template <typename Es, typename Ed>
+    __global__ void convert_kernel(int                               m,
+                                   int                               n,
+                                   hipblas_batched_operand<const Es> src,
+                                   int64_t                           lds,
+                                   hipblas_batched_operand<Ed>       dst,
+                                   int64_t                           ldd,
+                                   bool                              accumulate,
+                                   double                            limit,
+                                   int*                              state,
+                                   int                               batch_count)
+    {
+        int64_t size = int64_t(m) * n;
+        for(int b = blockIdx.z; b < batch_count; b += gridDim.z)
+        {
+            if(state && state[b] != 0)
+                continue;
+
+            const Es* s = batch_at(src, b);
+            Ed*       d = batch_at(dst, b);
+            for(int64_t idx = int64_t(blockIdx.x) * blockDim.x + threadIdx.x; idx < size;
+                idx += int64_t(gridDim.x) * blockDim.x)
+            {
+                int64_t i = idx % m;
+                int64_t j = idx / m;
+                Es      v = s[i + j * lds];
+                if(state && arith<Es>::max_part(v) > limit)
+                    state[b] = HIPBLAS_REFINE_OVERFLOW;
+
+                Ed  c  = converter<Ed>::from(v);
+                Ed& to = d[i + j * ldd];
+                to     = accumulate ? arith<Ed>::add(to, c) : c;
+            }
+        }
+    }
+
+    // One block per batch: cte[b] = ||A||_inf * scale
+    template <typename E>
+    __global__ void threshold_kernel(int                              n,
+                                     hipblas_batched_operand<const E> A,
+                                     int64_t                          lda,
+                                     double                           scale,
+                                     double*                          cte,
+                                     int                              batch_count)
+    {
+        using real = typename arith<E>::real;
+        __shared__ real partial[REDUCE_DIM_X];
+
+        for(int b = blockIdx.z; b < batch_count; b += gridDim.z)
+        {
+            const E* a    = batch_at(A, b);
+            real     norm = 0;
+            for(int i = threadIdx.x; i < n; i += blockDim.x)
+            {
+                real row = 0;
+                for(int j = 0; j < n; j++)
+                    row += arith<E>::abs(a[i + j * lda]);
+                norm = row > norm ? row : norm;
+            }
+            norm = block_max(partial, norm);
+
+            if(threadIdx.x == 0)
+                cte[b] = norm * scale;
+        }
+    }
+
+    // One block per batch. Every thread reads state[b] before the barrier that precedes thread 0
+    // writing it, so the branches on it stay uniform
+    template <typename E>
+    __global__ void check_kernel(int                              n,
+                                 int                              nrhs,
+                                 hipblas_batched_operand<const E> X,
+                                 int64_t                          ldx,
+                                 hipblas_batched_operand<const E> R,
+                                 int64_t                          ldr,
+                                 const double*                    cte,
+                                 const int*                       factor_info,
+                                 int                              iteration,
+                                 int*                             state,
+                                 int*                             iter,
+                                 int*                             counts,
+                                 int                              batch_count)
+    {
+        using real = typename arith<E>::real;
+        __shared__ real partial[REDUCE_DIM_X];
+
+        for(int b = blockIdx.z; b < batch_count; b += gridDim.z)
+        {
+            int s = state[b];
+            if(s == 0 && factor_info && factor_info[b] > 0)
+                s = HIPBLAS_REFINE_FACTOR_FAILED;
+
+            bool converged = true;
+            if(s == 0)
+            {
+                const E* x = batch_at(X, b);
+                const E* r = batch_at(R, b);
+                for(int j = 0; j < nrhs && converged; j++)
+                {
+                    real xnrm = 0, rnrm = 0;
+                    for(int i = threadIdx.x; i < n; i += blockDim.x)
+                    {
+                        real xv = arith<E>::abs1(x[i + j * ldx]);
+                        real rv = arith<E>::abs1(r[i + j * ldr]);
+                        xnrm    = xv > xnrm ? xv : xnrm;
+                        rnrm    = rv > rnrm ? rv : rnrm;
+                    }
+                    xnrm      = block_max(partial, xnrm);
+                    rnrm      = block_max(partial, rnrm);
+                    converged = rnrm <= xnrm * cte[b];
+                }
+            }
+
+            __syncthreads();
+            if(threadIdx.x == 0)
+            {
+                if(s == 0 && converged)
+                {
+                    s       = 1;
+                    iter[b] = iteration;
+                }
+                state[b] = s;
+                if(s == 0)
+                    atomicAdd(&counts[0], 1);
+                else if(s < 0)
+                    atomicAdd(&counts[1], 1);
+            }
+        }
+    }
+
+    __global__ void fallback_kernel(int unconverged, const int* state, int* iter, int batch_count)
+    {
+        int b = blockIdx.x * blockDim.x + threadIdx.x;
+        if(b < batch_count)
+            iter[b] = state[b] < 0 ? state[b] : state[b] == 0 ? unconverged : -1;
+    }
+
+    template <typename T>
+    struct real_of
+    {
+        using type = T;
+    };
+
+    template <>
+    struct real_of<hipblasComplex>
+    {
+        using type = float;
+    };
+
+    template <>
+    struct real_of<hipblasDoubleComplex>
+    {
+        using type = double;
+    };
+}
+
+template <typename Ts, typename Td>
+hipError_t hipblas_convert_matrix_batched(hipStream_t                       stream,
+                                          int                               m,
+                                          int                               n,
+                                          hipblas_batched_operand<const Ts> src,
+                                          int64_t                           lds,
+                                          hipblas_batched_operand<Td>       dst,
+                                          int64_t                           ldd,
+                                          bool                              accumulate,
+                                          int*                              state,
+                                          int                               batch_count)
+{
+    using Rs = typename real_of<Ts>::type;
+    using Rd = typename real_of<Td>::type;
+    if(m <= 0 || n <= 0 || batch_count <= 0)
+        return hipSuccess;
+
+    // Only a narrowing conversion can overflow
+    double limit = sizeof(Rd) < sizeof(Rs) ? double(std::numeric_limits<Rd>::max())
+                                           : std::numeric_limits<double>::infinity();
+
+    int64_t blocks = (int64_t(m) * n - 1) / REDUCE_DIM_X + 1;
+    dim3    grid(int(std::min<int64_t>(blocks, MAX_GRID_ELEMENTS)),
+              1,
+              std::min(batch_count, MAX_GRID_BATCH));
+    dim3    threads(REDUCE_DIM_X);
+
+    hipLaunchKernelGGL((convert_kernel<Ts, Td>),
+                       grid,
+                       threads,
+                       0,
+                       stream,
+                       m,
+                       n,
+                       src,
+                       lds,
+                       dst,
+                       ldd,
+                       accumulate,
+                       limit,
+                       state,
+                       batch_count);
+    return hipGetLastError();
+}
+
+template <typename T>
+hipError_t hipblas_refine_threshold_batched(hipStream_t                      stream,
+                                            int                              n,
+                                            hipblas_batched_operand<const T> A,
+                                            int64_t                          lda,
+                                            double                           scale,
+                                            double*                          cte,
+                                            int                              batch_count)
+{
+    if(batch_count <= 0)
+        return hipSuccess;
+
+    dim3 grid(1, 1, std::min(batch_count, MAX_GRID_BATCH));
+    dim3 threads(REDUCE_DIM_X);
+
+    hipLaunchKernelGGL(threshold_kernel<T>,
+                       grid,
+                       threads,
+                       0,
+                       stream,
+                       n,
+                       A,
+                       lda,
+                       scale,
+                       cte,
+                       batch_count);
+    return hipGetLastError();
+}
+
+template <typename T>
+hipError_t hipblas_refine_check_batched(hipStream_t                      stream,
+                                        int                              n,
+                                        int                              nrhs,
+                                        hipblas_batched_operand<const T> X,
+                                        int64_t                          ldx,
+                                        hipblas_batched_operand<const T> R,
+                                        int64_t                          ldr,
+                                        const double*                    cte,
+                                        const int*                       factor_info,
+                                        int                              iteration,
+                                        int*                             state,
+                                        int*                             iter,
+                                        int*                             counts,
+                                        int                              batch_count)
+{
+    if(batch_count <= 0)
+        return hipSuccess;
+
+    dim3 grid(1, 1, std::min(batch_count, MAX_GRID_BATCH));
+    dim3 threads(REDUCE_DIM_X);
+
+    hipLaunchKernelGGL(check_kernel<T>,
+                       grid,
+                       threads,
+                       0,
+                       stream,
+                       n,
+                       nrhs,
+                       X,
+                       ldx,
+                       R,
+                       ldr,
+                       cte,
+                       factor_info,
+                       iteration,
+                       state,
+                       iter,
+                       counts,
+                       batch_count);
+    return hipGetLastError();
+}
+
+hipError_t hipblas_refine_fallback_batched(
+    hipStream_t stream, int unconverged, const int* state, int* iter, int batch_count)
+{
+    if(batch_count <= 0)
+        return hipSuccess;
+
+    dim3 grid((batch_count - 1) / REDUCE_DIM_X + 1);
+    dim3 threads(REDUCE_DIM_X);
+
+    hipLaunchKernelGGL(
+        fallback_kernel, grid, threads, 0, stream, unconverged, state, iter, batch_count);
+    return hipGetLastError();
+}
+
+// clang-format off
+template hipError_t hipblas_convert_matrix_batched<double, double>(hipStream_t, int, int, hipblas_batched_operand<const double>, int64_t, hipblas_batched_operand<double>, int64_t, bool, int*, int);
+template hipError_t hipblas_convert_matrix_batched<double, float>(hipStream_t, int, int, hipblas_batched_operand<const double>, int64_t, hipblas_batched_operand<float>, int64_t, bool, int*, int);
+template hipError_t hipblas_convert_matrix_batched<float, double>(hipStream_t, int, int, hipblas_batched_operand<const float>, int64_t, hipblas_batched_operand<double>, int64_t, bool, int*, int);
+template hipError_t hipblas_convert_matrix_batched<hipblasDoubleComplex, hipblasDoubleComplex>(hipStream_t, int, int, hipblas_batched_operand<const hipblasDoubleComplex>, int64_t, hipblas_batched_operand<hipblasDoubleComplex>, int64_t, bool, int*, int);
+template hipError_t hipblas_convert_matrix_batched<hipblasDoubleComplex, hipblasComplex>(hipStream_t, int, int, hipblas_batched_operand<const hipblasDoubleComplex>, int64_t, hipblas_batched_operand<hipblasComplex>, int64_t, bool, int*, int);
+template hipError_t hipblas_convert_matrix_batched<hipblasComplex, hipblasDoubleComplex>(hipStream_t, int, int, hipblas_batched_operand<const hipblasComplex>, int64_t, hipblas_batched_operand<hipblasDoubleComplex>, int64_t, bool, int*, int);
+template hipError_t hipblas_refine_threshold_batched<double>(hipStream_t, int, hipblas_batched_operand<const double>, int64_t, double, double*, int);
+template hipError_t hipblas_refine_threshold_batched<hipblasDoubleComplex>(hipStream_t, int, hipblas_batched_operand<const hipblasDoubleComplex>, int64_t, double, double*, int);
+template hipError_t hipblas_refine_check_batched<double>(hipStream_t, int, int, hipblas_batched_operand<const double>, int64_t, hipblas_batched_operand<const double>, int64_t, const double*, const int*, int, int*, int*, int*, int);
+template hipError_t hipblas_refine_check_batched<hipblasDoubleComplex>(hipStream_t, int, int, hipblas_batched_operand<const hipblasDoubleComplex>, int64_t, hipblas_batched_operand<const hipblasDoubleComplex>, int64_t, const double*, const int*, int, int*, int*, int*, int);
+// clang-format on
@@ -0,0 +1,172 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "hipblas_kernels.h"
+#include <algorithm>
+#include <hip/hip_runtime.h>
+
+namespace
+{
+    // Threads of a block, laid out TILE x TILE for gemm and gemv tiles and flat for axpy ones
+    constexpr int TILE    = HIPBLAS_JOB_GEMM_TILE;
+    constexpr int THREADS = TILE * TILE;
+
+    constexpr int MAX_GRID_TILES = 65535;
+
+    static_assert(HIPBLAS_JOB_GEMV_TILE == TILE, "a gemv tile takes one row per thread column");
+
+    // Element i of a vector of n elements, from its far end for a negative increment
+    template <typename T>
+    __device__ T* vector_at(T* x, int64_t inc, int n, int64_t i)
+    {
+        return x + (inc < 0 ? (1 - int64_t(n)) * inc : 0) + i * inc;
+    }
+
+    // Element (i, j) of op(A); the list types are real, so HIPBLAS_OP_C is a plain transpose
+    template <typename T>
+    __device__ T op_element(hipblasOperation_t trans, const T* A, int64_t lda, int64_t i, int64_t j)
+    {
+        return trans == HIPBLAS_OP_N ? A[i + j * lda] : A[j + i * lda];
+    }
+
+    template <typename T>
+    __device__ void axpy_tile(const hipblas_job_desc<T>& job, int64_t tile, int t)
+    {
+        if(job.alpha == 0)
+            return;
+        int64_t end = (tile + 1) * HIPBLAS_JOB_AXPY_TILE;
+        end         = end < job.n ? end : job.n;
+        for(int64_t i = tile * HIPBLAS_JOB_AXPY_TILE + t; i < end; i += THREADS)
+            *vector_at(job.C, job.ldc, job.n, i)
+                += job.alpha * *vector_at(job.B, job.ldb, job.n, i);
+    }
+
+    // Thread (tx, ty) sums every TILE-th column of row tx of the tile, and the ty == 0 threads
+    // add up the partial sums
+    template <typename T>
+    __device__ void gemv_tile(const hipblas_job_desc<T>& job, int64_t tile, int tx, int ty, T* sums)
+    {
+        bool    trans = job.transa != HIPBLAS_OP_N;
+        int     rows  = trans ? job.n : job.m;
+        int     cols  = trans ? job.m : job.n;
+        int64_t r     = tile * TILE + tx;
+
+        T sum = 0;
+        if(job.alpha != 0 && r < rows)
+            for(int64_t l = ty; l < cols; l += TILE)
+                sum += op_element(job.transa, job.A, job.lda, r, l)
+                       * *vector_at(job.B, job.ldb, cols, l);
+        sums[ty * (TILE + 1) + tx] = sum;
+        __syncthreads();
+
+        if(ty == 0 && r < rows)
+        {
+            for(int l = 1; l < TILE; l++)
+                sum += sums[l * (TILE + 1) + tx];
+            T* y = vector_at(job.C, job.ldc, rows, r);
+            *y   = job.alpha * sum + (job.beta == 0 ? T(0) : job.beta * *y);
+        }
+    }
+
+    // As the gemm_batched kernel, for the tile'th TILE x TILE tile of C in column-major order
+    template <typename T>
+    __device__ void gemm_tile(const hipblas_job_desc<T>& job,
+                              int64_t                    tile,
+                              int                        tx,
+                              int                        ty,
+                              T (*a_tile)[TILE + 1],
+                              T (*b_tile)[TILE + 1])
+    {
+        int64_t tiles_m = (job.m - 1) / TILE + 1;
+        int64_t i       = (tile % tiles_m) * TILE + tx;
+        int64_t j       = (tile / tiles_m) * TILE + ty;
+
+        T sum = 0;
+        if(job.alpha != 0)
+            for(int l0 = 0; l0 < job.k; l0 += TILE)
+            {
+                a_tile[ty][tx] = i < job.m && l0 + ty < job.k
+                                     ? op_element(job.transa, job.A, job.lda, i, l0 + ty)
+                                     : T(0);
+                b_tile[ty][tx] = l0 + tx < job.k && j < job.n
+                                     ? op_element(job.transb, job.B, job.ldb, l0 + tx, j)
+                                     : T(0);
+                __syncthreads();
+
+                for(int l = 0; l < TILE; l++)
+                    sum += a_tile[l][tx] * b_tile[ty][l];
+                __syncthreads();
+            }
+
+        if(i < job.m && j < job.n)
+        {
+            T* c = job.C + i + j * job.ldc;
+            *c   = job.alpha * sum + (job.beta == 0 ? T(0) : job.beta * *c);
+        }
+    }
+
+    // Every thread of a block works on the same job, so the barriers inside a tile are uniform;
+    // the one after it keeps the shared tiles until all threads are done with them
+    template <typename T>
+    __global__ void job_list_kernel(const hipblas_job_desc<T>* jobs, int job_count, int64_t tiles)
+    {
+        __shared__ T a_tile[TILE][TILE + 1];
+        __shared__ T b_tile[TILE][TILE + 1];
+
+        int tx = threadIdx.x;
+        int ty = threadIdx.y;
+
+        for(int64_t tile = blockIdx.x; tile < tiles; tile += gridDim.x)
+        {
+            // The last job starting at or before tile; jobs without tiles start where the next
+            // one does, so they are never the last
+            int lo = 0, hi = job_count - 1;
+            while(lo < hi)
+            {
+                int mid = (lo + hi + 1) / 2;
+                if(jobs[mid].first_tile <= tile)
+                    lo = mid;
+                else
+                    hi = mid - 1;
+            }
+            const hipblas_job_desc<T>& job   = jobs[lo];
+            int64_t                    local = tile - job.first_tile;
+
+            switch(job.type)
+            {
+            case HIPBLAS_JOB_AXPY:
+                axpy_tile(job, local, ty * TILE + tx);
+                break;
+            case HIPBLAS_JOB_GEMV:
+                gemv_tile(job, local, tx, ty, &a_tile[0][0]);
+                break;
+            case HIPBLAS_JOB_GEMM:
+                gemm_tile(job, local, tx, ty, a_tile, b_tile);
+                break;
+            }
+            __syncthreads();
+        }
+    }
+}
+
+template <typename T>
+hipError_t hipblas_job_list(hipStream_t                stream,
+                            const hipblas_job_desc<T>* jobs,
+                            int                        job_count,
+                            int64_t                    tiles)
+{
+    if(job_count <= 0 || tiles <= 0)
+        return hipSuccess;
+
+    dim3 grid(int(std::min<int64_t>(tiles, MAX_GRID_TILES)));
+    dim3 threads(TILE, TILE);
+    hipLaunchKernelGGL(job_list_kernel<T>, grid, threads, 0, stream, jobs, job_count, tiles);
+    return hipGetLastError();
+}
+
+// clang-format off
+template hipError_t hipblas_job_list<float>(hipStream_t, const hipblas_job_desc<float>*, int, int64_t);
+template hipError_t hipblas_job_list<double>(hipStream_t, const hipblas_job_desc<double>*, int, int64_t);
+// clang-format on
@@ -0,0 +1,322 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "hipblas_kernels.h"
+#include <algorithm>
+#include <hip/hip_runtime.h>
+
+namespace
+{
+    constexpr int LACPY_DIM_X = 64;
+    constexpr int LACPY_DIM_Y = 4;
+
+    constexpr int TILE_DIM   = 32;
+    constexpr int TILE_DIM_Y = 8;
+
+    constexpr int MAX_GRID_Y     = 65535;
+    constexpr int MAX_GRID_BATCH = 65535;
+
+    // The matrices are copied as raw elements of their size, and runs of them as 16-byte vectors
+    struct alignas(16) bytes16
+    {
+        uint64_t lo;
+        uint64_t hi;
+    };
+
+    // Each thread moves W consecutive rows of a column, W elements making 16 bytes, so a warp
+    // reads and writes whole cache lines. A batch whose pointers or leading dimensions are not
+    // 16-byte aligned moves element by element through the same threads
+    template <typename T>
+    __global__ void lacpy_kernel(bool                             lower,
+                                 bool                             upper,
+                                 int                              m,
+                                 int                              n,
+                                 hipblas_batched_operand<const T> A,
+                                 int64_t                          lda,
+                                 hipblas_batched_operand<T>       B,
+                                 int64_t                          ldb,
+                                 int                              batch_count)
+    {
+        constexpr int W = sizeof(bytes16) / sizeof(T);
+
+        int64_t i0 = (int64_t(blockIdx.x) * blockDim.x + threadIdx.x) * W;
+        if(i0 >= m)
+            return;
+
+        for(int b = blockIdx.z; b < batch_count; b += gridDim.z)
+        {
+            const T* a = A.array ? A.array[b] : A.ptr + b * A.stride;
+            T*       d = B.array ? B.array[b] : B.ptr + b * B.stride;
+            bool     vector
+                = ((uintptr_t(a) | uintptr_t(d)) % sizeof(bytes16)) == 0 && lda % W == 0
+                  && ldb % W == 0;
+
+            for(int j = blockIdx.y * blockDim.y + threadIdx.y; j < n; j += gridDim.y * blockDim.y)
+            {
+                // rows of column j inside the triangle
+                int64_t first = upper ? 0 : j;
+                int64_t last  = lower || j >= m ? m : j + 1;
+                if(i0 + W <= first || i0 >= last)
+                    continue;
+
+                const T* s = a + i0 + j * lda;
+                T*       t = d + i0 + j * ldb;
+                if(vector && i0 >= first && i0 + W <= last)
+                {
+                    *reinterpret_cast<bytes16*>(t) = *reinterpret_cast<const bytes16*>(s);
+                    continue;
+                }
+                for(int k = 0; k < W; k++)
+                    if(i0 + k >= first && i0 + k < last)
+                        t[k] = s[k];
+            }
+        }
+    }
+
+    // The mirrored element, conjugated for hermitize; a hermitian diagonal is real
+    template <typename T>
+    __device__ T mirror(T a, bool, bool)
+    {
+        return a;
+    }
+
+    template <typename R>
+    __device__ hip_complex_number<R> mirror(hip_complex_number<R> a, bool conjugate, bool diagonal)
+    {
+        if(!conjugate)
+            return a;
+        return {a.x, diagonal ? R(0) : -a.y};
+    }
+
+    // One block per TILE_DIM x TILE_DIM tile on or below the diagonal of the tile grid. The
+    // source tile of the uplo triangle is read along its columns into shared memory and written
+    // transposed along the columns of the other triangle, so both passes are coalesced. Diagonal
+    // tiles read everything before writing only the elements outside the triangle
+    template <typename T>
+    __global__ void symmetrize_kernel(bool                       lower,
+                                      int                        n,
+                                      hipblas_batched_operand<T> A,
+                                      int64_t                    lda,
+                                      bool                       conjugate,
+                                      int                        batch_count)
+    {
+        if(blockIdx.x < blockIdx.y)
+            return;
+
+        __shared__ T tile[TILE_DIM][TILE_DIM + 1];
+
+        // rows and columns of the source tile
+        int i0 = (lower ? blockIdx.x : blockIdx.y) * TILE_DIM;
+        int j0 = (lower ? blockIdx.y : blockIdx.x) * TILE_DIM;
+        int t  = threadIdx.x;
+
+        for(int b = blockIdx.z; b < batch_count; b += gridDim.z)
+        {
+            T* a = A.array ? A.array[b] : A.ptr + b * A.stride;
+            for(int k = threadIdx.y; k < TILE_DIM; k += blockDim.y)
+                if(i0 + t < n && j0 + k < n)
+                    tile[k][t] = a[(i0 + t) + int64_t(j0 + k) * lda];
+            __syncthreads();
+
+            // A(p, q) = A(q, p) for p = j0 + t and q = i0 + k outside the source triangle
+            for(int k = threadIdx.y; k < TILE_DIM; k += blockDim.y)
+            {
+                int p = j0 + t, q = i0 + k;
+                if(p < n && q < n && (lower ? p <= q : p >= q) && (p != q || conjugate))
+                    a[p + int64_t(q) * lda] = mirror(tile[t][k], conjugate, p == q);
+            }
+            __syncthreads();
+        }
+    }
+
+    template <typename T>
+    __device__ T conjugate_if(T a, bool)
+    {
+        return a;
+    }
+
+    template <typename R>
+    __device__ hip_complex_number<R> conjugate_if(hip_complex_number<R> a, bool conjugate)
+    {
+        return conjugate ? hip_complex_number<R>{a.x, -a.y} : a;
+    }
+
+    // One block per pair of tiles mirrored across the diagonal, blockIdx.x >= blockIdx.y: both
+    // are read along their columns into shared memory before each is written transposed over the
+    // other, so no element is overwritten before it is read. A diagonal tile is its own pair
+    template <typename T>
+    __global__ void transpose_kernel(int                        n,
+                                     hipblas_batched_operand<T> A,
+                                     int64_t                    lda,
+                                     bool                       conjugate,
+                                     int                        batch_count)
+    {
+        if(blockIdx.x < blockIdx.y)
+            return;
+
+        __shared__ T lower[TILE_DIM][TILE_DIM + 1];
+        __shared__ T upper[TILE_DIM][TILE_DIM + 1];
+
+        // the lower tile is at rows r0 and columns c0, the upper one at rows c0 and columns r0
+        int  r0       = blockIdx.x * TILE_DIM;
+        int  c0       = blockIdx.y * TILE_DIM;
+        bool diagonal = blockIdx.x == blockIdx.y;
+        int  t        = threadIdx.x;
+
+        for(int b = blockIdx.z; b < batch_count; b += gridDim.z)
+        {
+            T* a = A.array ? A.array[b] : A.ptr + b * A.stride;
+            for(int k = threadIdx.y; k < TILE_DIM; k += blockDim.y)
+            {
+                if(r0 + t < n && c0 + k < n)
+                    lower[k][t] = a[(r0 + t) + int64_t(c0 + k) * lda];
+                if(!diagonal && c0 + t < n && r0 + k < n)
+                    upper[k][t] = a[(c0 + t) + int64_t(r0 + k) * lda];
+            }
+            __syncthreads();
+
+            // A(c0 + t, r0 + k) = A(r0 + k, c0 + t) and the other way round
+            for(int k = threadIdx.y; k < TILE_DIM; k += blockDim.y)
+            {
+                if(c0 + t < n && r0 + k < n)
+                    a[(c0 + t) + int64_t(r0 + k) * lda] = conjugate_if(lower[t][k], conjugate);
+                if(!diagonal && r0 + t < n && c0 + k < n)
+                    a[(r0 + t) + int64_t(c0 + k) * lda] = conjugate_if(upper[t][k], conjugate);
+            }
+            __syncthreads();
+        }
+    }
+
+    template <typename T>
+    hipError_t lacpy(hipStream_t                         stream,
+                     hipblasFillMode_t                   uplo,
+                     int                                 m,
+                     int                                 n,
+                     hipblas_batched_operand<const void> A,
+                     int64_t                             lda,
+                     hipblas_batched_operand<void>       B,
+                     int64_t                             ldb,
+                     int                                 batch_count)
+    {
+        constexpr int64_t W = sizeof(bytes16) / sizeof(T);
+
+        hipblas_batched_operand<const T> a{
+            static_cast<const T*>(A.ptr), A.stride, reinterpret_cast<const T* const*>(A.array)};
+        hipblas_batched_operand<T> b{
+            static_cast<T*>(B.ptr), B.stride, reinterpret_cast<T* const*>(B.array)};
+
+        int64_t rows = (m - 1) / W + 1;
+        hipLaunchKernelGGL(lacpy_kernel<T>,
+                           dim3((rows - 1) / LACPY_DIM_X + 1,
+                                std::min((n - 1) / LACPY_DIM_Y + 1, MAX_GRID_Y),
+                                std::min(batch_count, MAX_GRID_BATCH)),
+                           dim3(LACPY_DIM_X, LACPY_DIM_Y),
+                           0,
+                           stream,
+                           uplo != HIPBLAS_FILL_MODE_UPPER,
+                           uplo != HIPBLAS_FILL_MODE_LOWER,
+                           m,
+                           n,
+                           a,
+                           lda,
+                           b,
+                           ldb,
+                           batch_count);
+        return hipGetLastError();
+    }
+}
+
+hipError_t hipblas_lacpy_batched(hipStream_t                         stream,
+                                 hipblasFillMode_t                   uplo,
+                                 int                                 m,
+                                 int                                 n,
+                                 size_t                              elem_size,
+                                 hipblas_batched_operand<const void> A,
+                                 int64_t                             lda,
+                                 hipblas_batched_operand<void>       B,
+                                 int64_t                             ldb,
+                                 int                                 batch_count)
+{
+    if(m <= 0 || n <= 0 || batch_count <= 0)
+        return hipSuccess;
+
+    switch(elem_size)
+    {
+    case 2:
+        return lacpy<uint16_t>(stream, uplo, m, n, A, lda, B, ldb, batch_count);
+    case 4:
+        return lacpy<uint32_t>(stream, uplo, m, n, A, lda, B, ldb, batch_count);
+    case 8:
+        return lacpy<uint64_t>(stream, uplo, m, n, A, lda, B, ldb, batch_count);
+    case 16:
+        return lacpy<bytes16>(stream, uplo, m, n, A, lda, B, ldb, batch_count);
+    default:
+        return hipErrorInvalidValue;
+    }
+}
+
+template <typename T>
+hipError_t hipblas_symmetrize_batched(hipStream_t                stream,
+                                      hipblasFillMode_t          uplo,
+                                      int                        n,
+                                      hipblas_batched_operand<T> A,
+                                      int64_t                    lda,
+                                      bool                       conjugate,
+                                      int                        batch_count)
+{
+    if(n <= 0 || batch_count <= 0)
+        return hipSuccess;
+
+    int tiles = (n - 1) / TILE_DIM + 1;
+    hipLaunchKernelGGL(symmetrize_kernel<T>,
+                       dim3(tiles, tiles, std::min(batch_count, MAX_GRID_BATCH)),
+                       dim3(TILE_DIM, TILE_DIM_Y),
+                       0,
+                       stream,
+                       uplo == HIPBLAS_FILL_MODE_LOWER,
+                       n,
+                       A,
+                       lda,
+                       conjugate,
+                       batch_count);
+    return hipGetLastError();
+}
+
+
+template <typename T>
+hipError_t hipblas_transpose_batched(hipStream_t                stream,
+                                     int                        n,
+                                     hipblas_batched_operand<T> A,
+                                     int64_t                    lda,
+                                     bool                       conjugate,
+                                     int                        batch_count)
+{
+    if(n <= 0 || batch_count <= 0)
+        return hipSuccess;
+
+    int tiles = (n - 1) / TILE_DIM + 1;
+    hipLaunchKernelGGL(transpose_kernel<T>,
+                       dim3(tiles, tiles, std::min(batch_count, MAX_GRID_BATCH)),
+                       dim3(TILE_DIM, TILE_DIM_Y),
+                       0,
+                       stream,
+                       n,
+                       A,
+                       lda,
+                       conjugate,
+                       batch_count);
+    return hipGetLastError();
+}
+
+// clang-format off
+template hipError_t hipblas_symmetrize_batched<float>(hipStream_t, hipblasFillMode_t, int, hipblas_batched_operand<float>, int64_t, bool, int);
+template hipError_t hipblas_symmetrize_batched<double>(hipStream_t, hipblasFillMode_t, int, hipblas_batched_operand<double>, int64_t, bool, int);
+template hipError_t hipblas_symmetrize_batched<hipblasComplex>(hipStream_t, hipblasFillMode_t, int, hipblas_batched_operand<hipblasComplex>, int64_t, bool, int);
+template hipError_t hipblas_symmetrize_batched<hipblasDoubleComplex>(hipStream_t, hipblasFillMode_t, int, hipblas_batched_operand<hipblasDoubleComplex>, int64_t, bool, int);
+template hipError_t hipblas_transpose_batched<float>(hipStream_t, int, hipblas_batched_operand<float>, int64_t, bool, int);
+template hipError_t hipblas_transpose_batched<double>(hipStream_t, int, hipblas_batched_operand<double>, int64_t, bool, int);
+template hipError_t hipblas_transpose_batched<hipblasComplex>(hipStream_t, int, hipblas_batched_operand<hipblasComplex>, int64_t, bool, int);
+template hipError_t hipblas_transpose_batched<hipblasDoubleComplex>(hipStream_t, int, hipblas_batched_operand<hipblasDoubleComplex>, int64_t, bool, int);
+// clang-format on
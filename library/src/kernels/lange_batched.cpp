@@ -0,0 +1,264 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "hipblas_kernels.h"
+#include <algorithm>
+#include <hip/hip_runtime.h>
+
+namespace
+{
+    // Block size of the reductions; a power of two for the shared memory tree
+    constexpr int REDUCE_DIM_X = 256;
+
+    constexpr int ROW_DIM_X = 256;
+
+    constexpr int MAX_GRID_BATCH = 65535;
+
+    template <typename E>
+    struct arith
+    {
+        using real = E;
+        __device__ static real abs(E a) { return a < 0 ? -a : a; }
+        __device__ static real max_part(E a) { return abs(a); }
+
+        // |a / scale|^2
+        __device__ static real scaled_square(E a, real scale)
+        {
+            real r = a / scale;
+            return r * r;
+        }
+    };
+
+    template <typename R>
+    struct arith<hip_complex_number<R>>
+    {
+        using E    = hip_complex_number<R>;
+        using real = R;
+
+        __device__ static real max_part(E a)
+        {
+            R x = a.x < 0 ? -a.x : a.x;
+            R y = a.y < 0 ? -a.y : a.y;
+            return x > y ? x : y;
+        }
+
+        __device__ static real scaled_square(E a, real scale)
+        {
+            real x = a.x / scale, y = a.y / scale;
+            return x * x + y * y;
+        }
+
+        // The modulus LAPACK's lange takes, scaled by the larger part so squaring neither
+        // overflows nor underflows
+        __device__ static real abs(E a)
+        {
+            R m = max_part(a);
+            return m == 0 ? 0 : m * sqrt(scaled_square(a, m));
+        }
+    };
+
+    template <typename E>
+    __device__ E* batch_at(hipblas_batched_operand<E> op, int b)
+    {
+        return op.array ? op.array[b] : op.ptr + b * op.stride;
+    }
+
+    // The sum, or the largest value when max is set, of v over the block, in every thread.
+    // partial must hold blockDim.x values
+    template <typename R>
+    __device__ R block_reduce(R* partial, R v, bool max)
+    {
+        int tid      = threadIdx.x;
+        partial[tid] = v;
+        __syncthreads();
+        for(int half = blockDim.x / 2; half > 0; half /= 2)
+        {
+            if(tid < half)
+            {
+                R u          = partial[tid + half];
+                partial[tid] = max ? (u > partial[tid] ? u : partial[tid]) : partial[tid] + u;
+            }
+            __syncthreads();
+        }
+        R r = partial[0];
+        __syncthreads();
+        return r;
+    }
+
+    // The largest of v_t over the block, then scale * sqrt(sum |v_t / scale|^2)
+    template <typename E, typename F>
+    __device__ typename arith<E>::real block_nrm2(typename arith<E>::real* partial, int count, F v)
+    {
+        using real = typename arith<E>::real;
+
+        real scale = 0;
+        for(int t = threadIdx.x; t < count; t += blockDim.x)
+        {
+            real m = arith<E>::max_part(v(t));
+            scale  = m > scale ? m : scale;
+        }
+        scale = block_reduce(partial, scale, true);
+        if(scale == 0)
+            return 0;
+
+        real ss = 0;
+        for(int t = threadIdx.x; t < count; t += blockDim.x)
+            ss += arith<E>::scaled_square(v(t), scale);
+        return scale * sqrt(block_reduce(partial, ss, false));
+    }
+
+    // One block per column of each batch: work[b * n + j] = the largest |a_ij|, the sum of |a_ij|
+    // or the 2-norm of column j, for the max, one and Frobenius norms
+    template <typename E>
+    __global__ void lange_columns_kernel(hipblasNormType_t                norm,
+                                         int                              m,
+                                         int                              n,
+                                         hipblas_batched_operand<const E> A,
+                                         int64_t                          lda,
+                                         typename arith<E>::real*         work,
+                                         int                              batch_count)
+    {
+        using real = typename arith<E>::real;
+        __shared__ real partial[REDUCE_DIM_X];
+
+        for(int b = blockIdx.y; b < batch_count; b += gridDim.y)
+            for(int j = blockIdx.x; j < n; j += gridDim.x)
+            {
+                const E* a = batch_at(A, b) + j * lda;
+                real     r = 0;
+                if(norm == HIPBLAS_NORM_FROBENIUS)
+                    r = block_nrm2<E>(partial, m, [&](int i) { return a[i]; });
+                else
+                {
+                    bool max = norm == HIPBLAS_NORM_MAX;
+                    for(int i = threadIdx.x; i < m; i += blockDim.x)
+                    {
+                        real v = arith<E>::abs(a[i]);
+                        r      = max ? (v > r ? v : r) : r + v;
+                    }
+                    r = block_reduce(partial, r, max);
+                }
+                if(threadIdx.x == 0)
+                    work[int64_t(b) * n + j] = r;
+            }
+    }
+
+    // One thread per row of each batch: work[b * m + i] = the sum of |a_ij|, for the inf norm
+    template <typename E>
+    __global__ void lange_rows_kernel(int                              m,
+                                      int                              n,
+                                      hipblas_batched_operand<const E> A,
+                                      int64_t                          lda,
+                                      typename arith<E>::real*         work,
+                                      int                              batch_count)
+    {
+        using real = typename arith<E>::real;
+
+        int i = blockIdx.x * blockDim.x + threadIdx.x;
+        if(i >= m)
+            return;
+
+        for(int b = blockIdx.y; b < batch_count; b += gridDim.y)
+        {
+            const E* a = batch_at(A, b) + i;
+            real     r = 0;
+            for(int j = 0; j < n; j++)
+                r += arith<E>::abs(a[j * lda]);
+            work[int64_t(b) * m + i] = r;
+        }
+    }
+
+    // One block per batch: result[b] = the largest of its count values in work, or their 2-norm
+    // for the Frobenius norm
+    template <typename R>
+    __global__ void lange_finish_kernel(
+        hipblasNormType_t norm, int count, const R* work, R* result, int batch_count)
+    {
+        __shared__ R partial[REDUCE_DIM_X];
+
+        for(int b = blockIdx.x; b < batch_count; b += gridDim.x)
+        {
+            const R* w = work + int64_t(b) * count;
+            R        r = 0;
+            if(norm == HIPBLAS_NORM_FROBENIUS)
+                r = block_nrm2<R>(partial, count, [&](int t) { return w[t]; });
+            else
+            {
+                for(int t = threadIdx.x; t < count; t += blockDim.x)
+                    r = w[t] > r ? w[t] : r;
+                r = block_reduce(partial, r, true);
+            }
+            if(threadIdx.x == 0)
+                result[b] = r;
+        }
+    }
+}
+
+int64_t hipblas_lange_work_size(hipblasNormType_t norm, int m, int n)
+{
+    return norm == HIPBLAS_NORM_INF ? m : n;
+}
+
+template <typename T, typename R>
+hipError_t hipblas_lange_batched(hipStream_t                      stream,
+                                 hipblasNormType_t                norm,
+                                 int                              m,
+                                 int                              n,
+                                 hipblas_batched_operand<const T> A,
+                                 int64_t                          lda,
+                                 R*                               result,
+                                 R*                               work,
+                                 int                              batch_count)
+{
+    if(batch_count <= 0)
+        return hipSuccess;
+
+    dim3 batches(std::min(batch_count, MAX_GRID_BATCH));
+    int  count = m > 0 && n > 0 ? int(hipblas_lange_work_size(norm, m, n)) : 0;
+    if(count > 0 && norm == HIPBLAS_NORM_INF)
+        hipLaunchKernelGGL(lange_rows_kernel<T>,
+                           dim3((m - 1) / ROW_DIM_X + 1, batches.x),
+                           dim3(ROW_DIM_X),
+                           0,
+                           stream,
+                           m,
+                           n,
+                           A,
+                           lda,
+                           work,
+                           batch_count);
+    else if(count > 0)
+        hipLaunchKernelGGL(lange_columns_kernel<T>,
+                           dim3(n, batches.x),
+                           dim3(REDUCE_DIM_X),
+                           0,
+                           stream,
+                           norm,
+                           m,
+                           n,
+                           A,
+                           lda,
+                           work,
+                           batch_count);
+
+    hipLaunchKernelGGL(lange_finish_kernel<R>,
+                       batches,
+                       dim3(REDUCE_DIM_X),
+                       0,
+                       stream,
+                       norm,
+                       count,
+                       work,
+                       result,
+                       batch_count);
+    return hipGetLastError();
+}
+
+// clang-format off
+template hipError_t hipblas_lange_batched<float, float>(hipStream_t, hipblasNormType_t, int, int, hipblas_batched_operand<const float>, int64_t, float*, float*, int);
+template hipError_t hipblas_lange_batched<double, double>(hipStream_t, hipblasNormType_t, int, int, hipblas_batched_operand<const double>, int64_t, double*, double*, int);
+template hipError_t hipblas_lange_batched<hipblasComplex, float>(hipStream_t, hipblasNormType_t, int, int, hipblas_batched_operand<const hipblasComplex>, int64_t, float*, float*, int);
+template hipError_t hipblas_lange_batched<hipblasDoubleComplex, double>(hipStream_t, hipblasNormType_t, int, int, hipblas_batched_operand<const hipblasDoubleComplex>, int64_t, double*, double*, int);
+// clang-format on
@@ -0,0 +1,166 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "hipblas_kernels.h"
+#include <algorithm>
+#include <hip/hip_runtime.h>
+
+namespace
+{
+    // Threads per block, each sweeping one row or column, and the rotations staged in shared
+    // memory at a time
+    constexpr int LASR_DIM = 256;
+
+    constexpr int MAX_GRID_BATCH = 65535;
+
+    template <typename T>
+    __device__ T* batch_at(hipblas_batched_operand<T> a, int b)
+    {
+        return a.array ? a.array[b] : a.ptr + b * a.stride;
+    }
+
+    template <typename R>
+    __device__ R scale(R a, R x)
+    {
+        return a * x;
+    }
+
+    template <typename R>
+    __device__ hip_complex_number<R> scale(R a, hip_complex_number<R> x)
+    {
+        return {a * x.x, a * x.y};
+    }
+
+    // Rotation r acts on positions (first, second) of the line: (r, r + 1) for a variable pivot,
+    // (0, r + 1) for top and (r, z - 1) for bottom, taking (a, b) to (c a + s b, c b - s a). One
+    // side of each rotation stays in carry from one rotation to the next, at carry_pos, so every
+    // element of the line is read once and written once. A variable pivot moves carry along
+    // with the rotations, while top and bottom keep it on their fixed row or column
+    template <typename E, typename R>
+    __global__ __launch_bounds__(LASR_DIM) void
+        lasr_kernel(hipblasSideMode_t                side,
+                    hipblasPivot_t                   pivot,
+                    hipblasDirect_t                  direct,
+                    int                              z,
+                    int                              lines,
+                    hipblas_batched_operand<const R> c,
+                    hipblas_batched_operand<const R> s,
+                    hipblas_batched_operand<E>       A,
+                    int64_t                          lda,
+                    int                              batch_count)
+    {
+        __shared__ R c_tile[LASR_DIM];
+        __shared__ R s_tile[LASR_DIM];
+
+        int     t      = threadIdx.x;
+        int     line   = blockIdx.x * LASR_DIM + t;
+        bool    active = line < lines;
+        bool    left   = side == HIPBLAS_SIDE_LEFT;
+        bool    fwd    = direct == HIPBLAS_FORWARD_DIRECTION;
+        int64_t step   = left ? 1 : lda;
+
+        // Which side of the rotation carry holds, and where it starts; the other side is the
+        // position the rotation streams in
+        bool carry_first = pivot == HIPBLAS_PIVOT_TOP || (pivot == HIPBLAS_PIVOT_VARIABLE && fwd);
+        int  start       = carry_first ? 0 : z - 1;
+
+        for(int b = blockIdx.y; b < batch_count; b += gridDim.y)
+        {
+            const R* cb = batch_at(c, b);
+            const R* sb = batch_at(s, b);
+            E*       x  = batch_at(A, b) + (left ? line * lda : line);
+
+            int carry_pos = start;
+            E   carry     = active ? x[carry_pos * step] : E{};
+
+            for(int q0 = 0; q0 < z - 1; q0 += LASR_DIM)
+            {
+                int q = q0 + t;
+                if(q < z - 1)
+                {
+                    int r     = fwd ? q : z - 2 - q;
+                    c_tile[t] = cb[r];
+                    s_tile[t] = sb[r];
+                }
+                __syncthreads();
+
+                int chunk = z - 1 - q0 < LASR_DIM ? z - 1 - q0 : LASR_DIM;
+                for(int j = 0; active && j < chunk; j++)
+                {
+                    int r  = fwd ? q0 + j : z - 2 - q0 - j;
+                    int p  = carry_first ? r + 1 : r;
+                    E   v  = x[p * step];
+                    E   a  = carry_first ? carry : v;
+                    E   bv = carry_first ? v : carry;
+                    R   cr = c_tile[j];
+                    R   sr = s_tile[j];
+                    E   a2 = scale(cr, a) + scale(sr, bv);
+                    E   b2 = scale(cr, bv) - scale(sr, a);
+
+                    E kept  = carry_first ? a2 : b2;
+                    E moved = carry_first ? b2 : a2;
+                    if(pivot == HIPBLAS_PIVOT_VARIABLE)
+                    {
+                        x[carry_pos * step] = kept;
+                        carry               = moved;
+                        carry_pos           = p;
+                    }
+                    else
+                    {
+                        x[p * step] = moved;
+                        carry       = kept;
+                    }
+                }
+                __syncthreads();
+            }
+
+            if(active)
+                x[carry_pos * step] = carry;
+        }
+    }
+}
+
+template <typename T, typename R>
+hipError_t hipblas_lasr_batched(hipStream_t                      stream,
+                                hipblasSideMode_t                side,
+                                hipblasPivot_t                   pivot,
+                                hipblasDirect_t                  direct,
+                                int                              m,
+                                int                              n,
+                                hipblas_batched_operand<const R> c,
+                                hipblas_batched_operand<const R> s,
+                                hipblas_batched_operand<T>       A,
+                                int64_t                          lda,
+                                int                              batch_count)
+{
+    int z     = side == HIPBLAS_SIDE_LEFT ? m : n;
+    int lines = side == HIPBLAS_SIDE_LEFT ? n : m;
+    if(z < 2 || lines <= 0 || batch_count <= 0)
+        return hipSuccess;
+
+    hipLaunchKernelGGL((lasr_kernel<T, R>),
+                       dim3((lines - 1) / LASR_DIM + 1, std::min(batch_count, MAX_GRID_BATCH)),
+                       dim3(LASR_DIM),
+                       0,
+                       stream,
+                       side,
+                       pivot,
+                       direct,
+                       z,
+                       lines,
+                       c,
+                       s,
+                       A,
+                       lda,
+                       batch_count);
+    return hipGetLastError();
+}
+
+// clang-format off
+template hipError_t hipblas_lasr_batched<float, float>(hipStream_t, hipblasSideMode_t, hipblasPivot_t, hipblasDirect_t, int, int, hipblas_batched_operand<const float>, hipblas_batched_operand<const float>, hipblas_batched_operand<float>, int64_t, int);
+template hipError_t hipblas_lasr_batched<double, double>(hipStream_t, hipblasSideMode_t, hipblasPivot_t, hipblasDirect_t, int, int, hipblas_batched_operand<const double>, hipblas_batched_operand<const double>, hipblas_batched_operand<double>, int64_t, int);
+template hipError_t hipblas_lasr_batched<hipblasComplex, float>(hipStream_t, hipblasSideMode_t, hipblasPivot_t, hipblasDirect_t, int, int, hipblas_batched_operand<const float>, hipblas_batched_operand<const float>, hipblas_batched_operand<hipblasComplex>, int64_t, int);
+template hipError_t hipblas_lasr_batched<hipblasDoubleComplex, double>(hipStream_t, hipblasSideMode_t, hipblasPivot_t, hipblasDirect_t, int, int, hipblas_batched_operand<const double>, hipblas_batched_operand<const double>, hipblas_batched_operand<hipblasDoubleComplex>, int64_t, int);
+// clang-format on
@@ -0,0 +1,1468 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "hipblas_kernels.h"
+#include <algorithm>
+#include <cstring>
+#include <hip/hip_fp16.h>
+#include <hip/hip_runtime.h>
+
+namespace
+{
+    constexpr int VECTOR_DIM_X = 256;
+
+    // Block size of the reductions; a power of two for the shared memory tree
+    constexpr int REDUCE_DIM_X = 256;
+
+    constexpr int MAX_GRID_BATCH = 65535;
+
+    template <typename R>
+    __device__ R abs_of(R a)
+    {
+        return a < 0 ? -a : a;
+    }
+
+    template <typename E>
+    struct arith
+    {
+        using real = E;
+        __device__ static E    from_real(real r) { return r; }
+        __device__ static E    add(E a, E b) { return a + b; }
+        __device__ static E    sub(E a, E b) { return a - b; }
+        __device__ static E    mul(E a, E b) { return a * b; }
+        __device__ static E    conj(E a) { return a; }
+        __device__ static bool is_zero(E a) { return a == 0; }
+
+        // |a|, and the larger magnitude of its parts
+        __device__ static real abs1(E a) { return abs_of(a); }
+        __device__ static real max_part(E a) { return abs_of(a); }
+
+        // |a / scale|^2
+        __device__ static real scaled_square(E a, real scale)
+        {
+            real r = a / scale;
+            return r * r;
+        }
+    };
+
+    template <typename R>
+    struct arith<hip_complex_number<R>>
+    {
+        using E    = hip_complex_number<R>;
+        using real = R;
+        __device__ static E    from_real(real r) { return {r, 0}; }
+        __device__ static E    add(E a, E b) { return {a.x + b.x, a.y + b.y}; }
+        __device__ static E    sub(E a, E b) { return {a.x - b.x, a.y - b.y}; }
+        __device__ static E    conj(E a) { return {a.x, -a.y}; }
+        __device__ static bool is_zero(E a) { return a.x == 0 && a.y == 0; }
+
+        __device__ static E mul(E a, E b)
+        {
+            return {a.x * b.x - a.y * b.y, a.x * b.y + a.y * b.x};
+        }
+
+        // |re(a)| + |im(a)|, the magnitude BLAS sums and compares for complex vectors
+        __device__ static real abs1(E a) { return abs_of(a.x) + abs_of(a.y); }
+
+        __device__ static real max_part(E a)
+        {
+            real x = abs_of(a.x), y = abs_of(a.y);
+            return x > y ? x : y;
+        }
+
+        __device__ static real scaled_square(E a, real scale)
+        {
+            real x = a.x / scale, y = a.y / scale;
+            return x * x + y * y;
+        }
+    };
+
+    // axpy and dot compute in float for half and bfloat16 vectors
+    template <typename E>
+    struct compute_type
+    {
+        using type = E;
+    };
+
+    template <>
+    struct compute_type<hipblasHalf>
+    {
+        using type = float;
+    };
+
+    template <>
+    struct compute_type<hipblasBfloat16>
+    {
+        using type = float;
+    };
+
+    template <typename E>
+    __device__ E load(E x)
+    {
+        return x;
+    }
+
+    __device__ float load(hipblasHalf x)
+    {
+        return __half2float(__ushort_as_half(x));
+    }
+
+    __device__ float load(hipblasBfloat16 x)
+    {
+        return __uint_as_float(uint32_t(x.data) << 16);
+    }
+
+    template <typename E, typename C>
+    __device__ E store(C x)
+    {
+        return x;
+    }
+
+    template <>
+    __device__ hipblasHalf store<hipblasHalf, float>(float x)
+    {
+        return __half_as_ushort(__float2half(x));
+    }
+
+    // Round to nearest even, keeping NaNs quiet
+    template <>
+    __device__ hipblasBfloat16 store<hipblasBfloat16, float>(float x)
+    {
+        uint32_t u = __float_as_uint(x);
+        if((u & 0x7fffffff) > 0x7f800000)
+            return {uint16_t((u >> 16) | 0x40)};
+        u += 0x7fff + ((u >> 16) & 1);
+        return {uint16_t(u >> 16)};
+    }
+
+    template <typename E>
+    __device__ E* batch_at(hipblas_batched_operand<E> op, int b)
+    {
+        return op.array ? op.array[b] : op.ptr + b * op.stride;
+    }
+
+    // Element i of a length n vector; a negative increment walks it from the far end, as in BLAS
+    __device__ int64_t vector_offset(int i, int n, int64_t inc)
+    {
+        return inc >= 0 ? i * inc : (i - int64_t(n - 1)) * inc;
+    }
+
+    // A scalar passed by value, or read through dev in device pointer mode; a real scalar widens
+    // to E when real is set
+    template <typename E>
+    __device__ E scalar_value(E value, const void* dev, bool real)
+    {
+        if(!dev)
+            return value;
+        return real ? arith<E>::from_real(*static_cast<const typename arith<E>::real*>(dev))
+                    : *static_cast<const E*>(dev);
+    }
+
+    // The sum of v over the block, in every thread. partial must hold blockDim.x values
+    template <typename E>
+    __device__ E block_sum(E* partial, E v)
+    {
+        int tid      = threadIdx.x;
+        partial[tid] = v;
+        __syncthreads();
+        for(int half = blockDim.x / 2; half > 0; half /= 2)
+        {
+            if(tid < half)
+                partial[tid] = arith<E>::add(partial[tid], partial[tid + half]);
+            __syncthreads();
+        }
+        E r = partial[0];
+        __syncthreads();
+        return r;
+    }
+
+    template <typename R>
+    __device__ R block_max(R* partial, R v)
+    {
+        int tid      = threadIdx.x;
+        partial[tid] = v;
+        __syncthreads();
+        for(int half = blockDim.x / 2; half > 0; half /= 2)
+        {
+            if(tid < half && partial[tid + half] > partial[tid])
+                partial[tid] = partial[tid + half];
+            __syncthreads();
+        }
+        R r = partial[0];
+        __syncthreads();
+        return r;
+    }
+
+    // y = alpha * x + y
+    template <typename E>
+    __global__ void axpy_kernel(int                              n,
+                                E                                alpha,
+                                const E*                         alpha_dev,
+                                int64_t                          scalar_stride,
+                                hipblas_batched_operand<const E> x,
+                                int64_t                          incx,
+                                hipblas_batched_operand<E>       y,
+                                int64_t                          incy,
+                                int                              batch_count)
+    {
+        using C = typename compute_type<E>::type;
+
+        int i = blockIdx.x * blockDim.x + threadIdx.x;
+        if(i >= n)
+            return;
+
+        for(int b = blockIdx.y; b < batch_count; b += gridDim.y)
+        {
+            C a = load(alpha_dev ? alpha_dev[b * scalar_stride] : alpha);
+            if(arith<C>::is_zero(a))
+                continue;
+
+            C  xi = load(batch_at(x, b)[vector_offset(i, n, incx)]);
+            E* yi = batch_at(y, b) + vector_offset(i, n, incy);
+            *yi   = store<E>(arith<C>::add(load(*yi), arith<C>::mul(a, xi)));
+        }
+    }
+
+    // x = alpha * x, for a positive increment
+    template <typename E>
+    __global__ void scal_kernel(int                        n,
+                                E                          alpha,
+                                const void*                alpha_dev,
+                                bool                       real_alpha,
+                                hipblas_batched_operand<E> x,
+                                int64_t                    incx,
+                                int                        batch_count)
+    {
+        int i = blockIdx.x * blockDim.x + threadIdx.x;
+        if(i >= n)
+            return;
+        alpha = scalar_value(alpha, alpha_dev, real_alpha);
+
+        for(int b = blockIdx.y; b < batch_count; b += gridDim.y)
+        {
+            E* xi = batch_at(x, b) + i * incx;
+            *xi   = arith<E>::mul(alpha, *xi);
+        }
+    }
+
+    // y = x, or conj(x) when conj is set, or x and y exchanged when swap is set
+    template <typename E>
+    __global__ void copy_kernel(int                        n,
+                                bool                       swap,
+                                bool                       conj,
+                                hipblas_batched_operand<E> x,
+                                int64_t                    incx,
+                                hipblas_batched_operand<E> y,
+                                int64_t                    incy,
+                                int                        batch_count)
+    {
+        int i = blockIdx.x * blockDim.x + threadIdx.x;
+        if(i >= n)
+            return;
+
+        for(int b = blockIdx.y; b < batch_count; b += gridDim.y)
+        {
+            E* xi = batch_at(x, b) + vector_offset(i, n, incx);
+            E* yi = batch_at(y, b) + vector_offset(i, n, incy);
+            E  v  = *xi;
+            if(swap)
+                *xi = *yi;
+            *yi = conj ? arith<E>::conj(v) : v;
+        }
+    }
+
+    // (x, y) = (c * x + s * y, c * y - conj(s) * x) with a real c
+    template <typename E>
+    __global__ void rot_kernel(int                        n,
+                               E                          c,
+                               E                          s,
+                               const void*                c_dev,
+                               const void*                s_dev,
+                               bool                       real_s,
+                               hipblas_batched_operand<E> x,
+                               int64_t                    incx,
+                               hipblas_batched_operand<E> y,
+                               int64_t                    incy,
+                               int                        batch_count)
+    {
+        int i = blockIdx.x * blockDim.x + threadIdx.x;
+        if(i >= n)
+            return;
+        c = scalar_value(c, c_dev, true);
+        s = scalar_value(s, s_dev, real_s);
+
+        for(int b = blockIdx.y; b < batch_count; b += gridDim.y)
+        {
+            E* xi = batch_at(x, b) + vector_offset(i, n, incx);
+            E* yi = batch_at(y, b) + vector_offset(i, n, incy);
+            E  xv = *xi, yv = *yi;
+            *xi   = arith<E>::add(arith<E>::mul(c, xv), arith<E>::mul(s, yv));
+            *yi   = arith<E>::sub(arith<E>::mul(c, yv), arith<E>::mul(arith<E>::conj(s), xv));
+        }
+    }
+
+    // (x, y) = H (x, y) for the modified Givens rotation H of each batch's param
+    template <typename R>
+    __global__ void rotm_kernel(int                              n,
+                                hipblas_batched_operand<R>       x,
+                                int64_t                          incx,
+                                hipblas_batched_operand<R>       y,
+                                int64_t                          incy,
+                                hipblas_batched_operand<const R> param,
+                                int                              batch_count)
+    {
+        int i = blockIdx.x * blockDim.x + threadIdx.x;
+        if(i >= n)
+            return;
+
+        for(int b = blockIdx.y; b < batch_count; b += gridDim.y)
+        {
+            const R* p    = batch_at(param, b);
+            R        flag = p[0];
+            if(flag == -2)
+                continue;
+
+            R h11 = flag == 0 ? 1 : p[1];
+            R h21 = flag == 1 ? -1 : p[2];
+            R h12 = flag == 1 ? 1 : p[3];
+            R h22 = flag == 0 ? 1 : p[4];
+
+            R* xi = batch_at(x, b) + vector_offset(i, n, incx);
+            R* yi = batch_at(y, b) + vector_offset(i, n, incy);
+            R  xv = *xi, yv = *yi;
+            *xi   = h11 * xv + h12 * yv;
+            *yi   = h21 * xv + h22 * yv;
+        }
+    }
+
+    // One block per batch: result[b] = x^T y, or x^H y when conj is set
+    template <typename E>
+    __global__ void dot_kernel(int                              n,
+                               hipblas_batched_operand<const E> x,
+                               int64_t                          incx,
+                               hipblas_batched_operand<const E> y,
+                               int64_t                          incy,
+                               bool                             conj,
+                               E*                               result,
+                               int                              batch_count)
+    {
+        using C = typename compute_type<E>::type;
+        __shared__ C partial[REDUCE_DIM_X];
+
+        for(int b = blockIdx.x; b < batch_count; b += gridDim.x)
+        {
+            const E* xb  = batch_at(x, b);
+            const E* yb  = batch_at(y, b);
+            C        sum = arith<C>::from_real(0);
+            for(int i = threadIdx.x; i < n; i += blockDim.x)
+            {
+                C xi = load(xb[vector_offset(i, n, incx)]);
+                if(conj)
+                    xi = arith<C>::conj(xi);
+                sum = arith<C>::add(sum, arith<C>::mul(xi, load(yb[vector_offset(i, n, incy)])));
+            }
+
+            sum = block_sum(partial, sum);
+            if(threadIdx.x == 0)
+                result[b] = store<E>(sum);
+        }
+    }
+
+    // One block per batch: result[b] = sum |x_i|, or ||x||_2 when nrm2 is set. The 2-norm scales
+    // by the largest part first, so squaring neither overflows nor underflows
+    template <typename E>
+    __global__ void norm_kernel(bool                             nrm2,
+                                int                              n,
+                                hipblas_batched_operand<const E> x,
+                                int64_t                          incx,
+                                typename arith<E>::real*         result,
+                                int                              batch_count)
+    {
+        using real = typename arith<E>::real;
+        __shared__ real partial[REDUCE_DIM_X];
+
+        for(int b = blockIdx.x; b < batch_count; b += gridDim.x)
+        {
+            const E* xb = batch_at(x, b);
+            real     r  = 0;
+            if(!nrm2)
+            {
+                for(int i = threadIdx.x; i < n; i += blockDim.x)
+                    r += arith<E>::abs1(xb[i * incx]);
+                r = block_sum(partial, r);
+            }
+            else
+            {
+                real scale = 0;
+                for(int i = threadIdx.x; i < n; i += blockDim.x)
+                {
+                    real m = arith<E>::max_part(xb[i * incx]);
+                    scale  = m > scale ? m : scale;
+                }
+                scale = block_max(partial, scale);
+
+                if(scale > 0)
+                {
+                    for(int i = threadIdx.x; i < n; i += blockDim.x)
+                        r += arith<E>::scaled_square(xb[i * incx], scale);
+                    r = scale * sqrt(block_sum(partial, r));
+                }
+            }
+
+            if(threadIdx.x == 0)
+                result[b] = r;
+        }
+    }
+
+    // One block per batch: result[b] is the 1-based index of the first element of largest, or
+    // smallest when min is set, magnitude
+    template <typename E>
+    __global__ void iamax_kernel(bool                             min,
+                                 int                              n,
+                                 hipblas_batched_operand<const E> x,
+                                 int64_t                          incx,
+                                 int*                             result,
+                                 int                              batch_count)
+    {
+        using real = typename arith<E>::real;
+        __shared__ real value[REDUCE_DIM_X];
+        __shared__ int  index[REDUCE_DIM_X];
+
+        int tid = threadIdx.x;
+        for(int b = blockIdx.x; b < batch_count; b += gridDim.x)
+        {
+            const E* xb   = batch_at(x, b);
+            real     best = 0;
+            int      at   = 0;
+            for(int i = tid; i < n; i += blockDim.x)
+            {
+                real v = arith<E>::abs1(xb[i * incx]);
+                if(at == 0 || (min ? v < best : v > best))
+                {
+                    best = v;
+                    at   = i + 1;
+                }
+            }
+            value[tid] = best;
+            index[tid] = at;
+            __syncthreads();
+
+            // Ties go to the lower index; a thread that saw no element holds index 0
+            for(int half = blockDim.x / 2; half > 0; half /= 2)
+            {
+                if(tid < half && index[tid + half])
+                {
+                    real v = value[tid + half];
+                    int  j = index[tid + half];
+                    if(index[tid] == 0 || (min ? v < value[tid] : v > value[tid])
+                       || (v == value[tid] && j < index[tid]))
+                    {
+                        value[tid] = v;
+                        index[tid] = j;
+                    }
+                }
+                __syncthreads();
+            }
+
+            if(tid == 0)
+                result[b] = index[0];
+            __syncthreads();
+        }
+    }
+
+    // One thread over the chunks, of which there are few as each spans up to 2^30 elements
+    template <typename E>
+    __global__ void iamax_chunks_kernel(bool       min,
+                                        const E*   x,
+                                        int64_t    incx,
+                                        int64_t    chunk,
+                                        int        chunks,
+                                        const int* part,
+                                        int64_t*   result)
+    {
+        using real = typename arith<E>::real;
+
+        real    best  = 0;
+        int64_t index = 0;
+        for(int c = 0; c < chunks; c++)
+        {
+            if(part[c] <= 0)
+                continue;
+            int64_t i = c * chunk + part[c] - 1;
+            real    v = arith<E>::abs1(x[i * incx]);
+            if(index == 0 || (min ? v < best : v > best))
+            {
+                best  = v;
+                index = i + 1;
+            }
+        }
+        *result = index;
+    }
+
+    // One thread per batch: the Givens rotation [c s; -conj(s) c] that zeroes b, with a
+    // overwritten by r and, for real a, b by the reconstruction value z
+    template <typename R>
+    __device__ void rotg(R& a, R& b, R& c, R& s)
+    {
+        R abs_a = abs_of(a), abs_b = abs_of(b);
+        R roe   = abs_a > abs_b ? a : b;
+        R scale = abs_a + abs_b;
+        if(scale == 0)
+        {
+            c = 1;
+            s = a = b = 0;
+            return;
+        }
+
+        R r = scale * sqrt((a / scale) * (a / scale) + (b / scale) * (b / scale));
+        r   = roe < 0 ? -r : r;
+        c   = a / r;
+        s   = b / r;
+        R z = 1;
+        if(abs_a > abs_b)
+            z = s;
+        else if(c != 0)
+            z = 1 / c;
+        a = r;
+        b = z;
+    }
+
+    template <typename R>
+    __device__ R hypot_of(R x, R y)
+    {
+        x = abs_of(x), y = abs_of(y);
+        R m = x > y ? x : y;
+        if(m == 0)
+            return 0;
+        x /= m, y /= m;
+        return m * sqrt(x * x + y * y);
+    }
+
+    template <typename R>
+    __device__ void rotg(hip_complex_number<R>& a,
+                         hip_complex_number<R>& b,
+                         R&                     c,
+                         hip_complex_number<R>& s)
+    {
+        using E = hip_complex_number<R>;
+
+        R abs_a = hypot_of(a.x, a.y);
+        if(abs_a == 0)
+        {
+            c = 0;
+            s = {1, 0};
+            a = b;
+            return;
+        }
+
+        R norm  = hypot_of(abs_a, hypot_of(b.x, b.y));
+        E alpha = {a.x / abs_a, a.y / abs_a};
+        E t     = arith<E>::mul(alpha, arith<E>::conj(b));
+        c       = abs_a / norm;
+        s       = {t.x / norm, t.y / norm};
+        a       = {alpha.x * norm, alpha.y * norm};
+    }
+
+    template <typename E>
+    __global__ void rotg_kernel(hipblas_batched_operand<E>                        a,
+                                hipblas_batched_operand<E>                        b,
+                                hipblas_batched_operand<typename arith<E>::real> c,
+                                hipblas_batched_operand<E>                        s,
+                                int                                               batch_count)
+    {
+        int i = blockIdx.x * blockDim.x + threadIdx.x;
+        if(i < batch_count)
+            rotg(*batch_at(a, i), *batch_at(b, i), *batch_at(c, i), *batch_at(s, i));
+    }
+
+    // One thread per batch: the reference BLAS rotmg, which builds the modified Givens rotation
+    // zeroing the second component of (sqrt(d1) x1, sqrt(d2) y1) and rescales d1, d2 and x1
+    template <typename R>
+    __global__ void rotmg_kernel(hipblas_batched_operand<R>       d1,
+                                 hipblas_batched_operand<R>       d2,
+                                 hipblas_batched_operand<R>       x1,
+                                 hipblas_batched_operand<const R> y1,
+                                 hipblas_batched_operand<R>       param,
+                                 int                              batch_count)
+    {
+        int i = blockIdx.x * blockDim.x + threadIdx.x;
+        if(i >= batch_count)
+            return;
+
+        const R gam = 4096, gamsq = gam * gam, rgamsq = 1 / gamsq;
+
+        R& sd1 = *batch_at(d1, i);
+        R& sd2 = *batch_at(d2, i);
+        R& sx1 = *batch_at(x1, i);
+        R  sy1 = *batch_at(y1, i);
+        R* p   = batch_at(param, i);
+
+        R flag = -1, h11 = 0, h12 = 0, h21 = 0, h22 = 0;
+        if(sd1 < 0)
+            sd1 = sd2 = sx1 = 0;
+        else
+        {
+            R p2 = sd2 * sy1;
+            if(p2 == 0)
+            {
+                p[0] = -2;
+                return;
+            }
+
+            R p1 = sd1 * sx1;
+            R q2 = p2 * sy1;
+            R q1 = p1 * sx1;
+            if(abs_of(q1) > abs_of(q2))
+            {
+                h21  = -sy1 / sx1;
+                h12  = p2 / p1;
+                R su = 1 - h12 * h21;
+                if(su > 0)
+                {
+                    flag = 0;
+                    sd1 /= su;
+                    sd2 /= su;
+                    sx1 *= su;
+                }
+                else
+                {
+                    h12 = h21 = 0;
+                    sd1 = sd2 = sx1 = 0;
+                }
+            }
+            else if(q2 < 0)
+                sd1 = sd2 = sx1 = 0;
+            else
+            {
+                flag   = 1;
+                h11    = p1 / p2;
+                h22    = sx1 / sy1;
+                R su   = 1 + h11 * h22;
+                R temp = sd2 / su;
+                sd2    = sd1 / su;
+                sd1    = temp;
+                sx1    = sy1 * su;
+            }
+
+            // Rescale d1 and d2 into [1 / gam^2, gam^2], first filling in the implied entries of H
+            while(sd1 != 0 && (sd1 <= rgamsq || sd1 >= gamsq))
+            {
+                if(flag == 0)
+                    h11 = h22 = 1;
+                else if(flag > 0)
+                {
+                    h21 = -1;
+                    h12 = 1;
+                }
+                flag = -1;
+                if(sd1 <= rgamsq)
+                {
+                    sd1 *= gamsq;
+                    sx1 /= gam;
+                    h11 /= gam;
+                    h12 /= gam;
+                }
+                else
+                {
+                    sd1 /= gamsq;
+                    sx1 *= gam;
+                    h11 *= gam;
+                    h12 *= gam;
+                }
+            }
+
+            while(sd2 != 0 && (abs_of(sd2) <= rgamsq || abs_of(sd2) >= gamsq))
+            {
+                if(flag == 0)
+                    h11 = h22 = 1;
+                else if(flag > 0)
+                {
+                    h21 = -1;
+                    h12 = 1;
+                }
+                flag = -1;
+                if(abs_of(sd2) <= rgamsq)
+                {
+                    sd2 *= gamsq;
+                    h21 /= gam;
+                    h22 /= gam;
+                }
+                else
+                {
+                    sd2 /= gamsq;
+                    h21 *= gam;
+                    h22 *= gam;
+                }
+            }
+        }
+
+        if(flag < 0)
+        {
+            p[1] = h11;
+            p[2] = h21;
+            p[3] = h12;
+            p[4] = h22;
+        }
+        else if(flag == 0)
+        {
+            p[2] = h21;
+            p[3] = h12;
+        }
+        else
+        {
+            p[1] = h11;
+            p[4] = h22;
+        }
+        p[0] = flag;
+    }
+
+    // w = alpha * x + beta * y
+    template <typename E>
+    __global__ void axpby_kernel(int                              n,
+                                 E                                alpha,
+                                 E                                beta,
+                                 const E*                         alpha_dev,
+                                 const E*                         beta_dev,
+                                 int64_t                          scalar_stride,
+                                 hipblas_batched_operand<const E> x,
+                                 int64_t                          incx,
+                                 hipblas_batched_operand<const E> y,
+                                 int64_t                          incy,
+                                 hipblas_batched_operand<E>       w,
+                                 int64_t                          incw,
+                                 int                              batch_count)
+    {
+        int i = blockIdx.x * blockDim.x + threadIdx.x;
+        if(i >= n)
+            return;
+
+        for(int b = blockIdx.y; b < batch_count; b += gridDim.y)
+        {
+            E a = alpha_dev ? alpha_dev[b * scalar_stride] : alpha;
+            E c = beta_dev ? beta_dev[b * scalar_stride] : beta;
+            E r = arith<E>::mul(a, batch_at(x, b)[vector_offset(i, n, incx)]);
+            if(!arith<E>::is_zero(c))
+                r = arith<E>::add(r, arith<E>::mul(c, batch_at(y, b)[vector_offset(i, n, incy)]));
+            batch_at(w, b)[vector_offset(i, n, incw)] = r;
+        }
+    }
+
+    // Vectors of Y one mdot block takes, each with a running sum in every thread
+    constexpr int MDOT_COLUMNS = 8;
+
+    // Most blocks a fused dot splits one vector over
+    constexpr int FUSED_DOT_MAX_BLOCKS = 64;
+
+    // Block blockIdx.x of each batch's blocks sums its part of x^T y_j, or x^H y_j when conj is
+    // set, into work[(b * k + j) * gridDim.x + blockIdx.x], for MDOT_COLUMNS vectors at a time
+    template <typename E>
+    __global__ void mdot_kernel(int                              n,
+                                int                              k,
+                                hipblas_batched_operand<const E> x,
+                                int64_t                          incx,
+                                hipblas_batched_operand<const E> Y,
+                                int64_t                          ldy,
+                                int64_t                          incy,
+                                bool                             conj,
+                                E*                               work,
+                                int                              batch_count)
+    {
+        __shared__ E partial[REDUCE_DIM_X];
+
+        int blocks = gridDim.x;
+        int first  = blockIdx.x * blockDim.x + threadIdx.x;
+        int step   = blocks * blockDim.x;
+        for(int b = blockIdx.z; b < batch_count; b += gridDim.z)
+        {
+            const E* xb = batch_at(x, b);
+            for(int j0 = blockIdx.y * MDOT_COLUMNS; j0 < k; j0 += gridDim.y * MDOT_COLUMNS)
+            {
+                const E* Yb      = batch_at(Y, b) + j0 * ldy;
+                int      columns = k - j0 < MDOT_COLUMNS ? k - j0 : MDOT_COLUMNS;
+
+                E sum[MDOT_COLUMNS];
+                for(int c = 0; c < MDOT_COLUMNS; c++)
+                    sum[c] = arith<E>::from_real(0);
+                for(int i = first; i < n; i += step)
+                {
+                    E xi = xb[vector_offset(i, n, incx)];
+                    if(conj)
+                        xi = arith<E>::conj(xi);
+                    int64_t yi = vector_offset(i, n, incy);
+#pragma unroll
+                    for(int c = 0; c < MDOT_COLUMNS; c++)
+                        if(c < columns)
+                            sum[c] = arith<E>::add(sum[c], arith<E>::mul(xi, Yb[c * ldy + yi]));
+                }
+
+                for(int c = 0; c < columns; c++)
+                {
+                    E s = block_sum(partial, sum[c]);
+                    if(threadIdx.x == 0)
+                        work[(int64_t(b) * k + j0 + c) * blocks + blockIdx.x] = s;
+                }
+            }
+        }
+    }
+
+    // y = alpha * x + y over block blockIdx.x's part of each batch, summing z^T y, or z^H y when
+    // conj is set, into work[b * gridDim.x + blockIdx.x]. Each thread reads z after writing the
+    // same elements of y, so z may be y
+    template <typename E>
+    __global__ void axpy_dot_kernel(int                              n,
+                                    E                                alpha,
+                                    const E*                         alpha_dev,
+                                    int64_t                          scalar_stride,
+                                    hipblas_batched_operand<const E> x,
+                                    int64_t                          incx,
+                                    hipblas_batched_operand<E>       y,
+                                    int64_t                          incy,
+                                    hipblas_batched_operand<const E> z,
+                                    int64_t                          incz,
+                                    bool                             conj,
+                                    E*                               work,
+                                    int                              batch_count)
+    {
+        __shared__ E partial[REDUCE_DIM_X];
+
+        int blocks = gridDim.x;
+        int first  = blockIdx.x * blockDim.x + threadIdx.x;
+        int step   = blocks * blockDim.x;
+        for(int b = blockIdx.y; b < batch_count; b += gridDim.y)
+        {
+            E        a   = alpha_dev ? alpha_dev[b * scalar_stride] : alpha;
+            const E* xb  = batch_at(x, b);
+            E*       yb  = batch_at(y, b);
+            const E* zb  = batch_at(z, b);
+            E        sum = arith<E>::from_real(0);
+            for(int i = first; i < n; i += step)
+            {
+                E* yi = yb + vector_offset(i, n, incy);
+                E  v  = arith<E>::add(*yi, arith<E>::mul(a, xb[vector_offset(i, n, incx)]));
+                *yi   = v;
+                E zi  = zb[vector_offset(i, n, incz)];
+                if(conj)
+                    zi = arith<E>::conj(zi);
+                sum = arith<E>::add(sum, arith<E>::mul(zi, v));
+            }
+
+            sum = block_sum(partial, sum);
+            if(threadIdx.x == 0)
+                work[int64_t(b) * blocks + blockIdx.x] = sum;
+        }
+    }
+
+    // result[r] = the sum of work[r * blocks] to work[r * blocks + blocks - 1], in a fixed order
+    template <typename E>
+    __global__ void sum_blocks_kernel(int blocks, const E* work, E* result, int64_t count)
+    {
+        int64_t r = int64_t(blockIdx.x) * blockDim.x + threadIdx.x;
+        if(r >= count)
+            return;
+
+        E sum = arith<E>::from_real(0);
+        for(int i = 0; i < blocks; i++)
+            sum = arith<E>::add(sum, work[r * blocks + i]);
+        result[r] = sum;
+    }
+
+    // A host scalar widened to E, or zero in device pointer mode; real reads a real scalar
+    template <typename E>
+    E host_scalar(const void* value, bool real, bool device_scalars)
+    {
+        E v = {};
+        if(!device_scalars)
+            std::memcpy(&v, value, real ? sizeof(typename arith<E>::real) : sizeof(E));
+        return v;
+    }
+
+    dim3 vector_grid(int n, int batch_count)
+    {
+        return dim3((n - 1) / VECTOR_DIM_X + 1, std::min(batch_count, MAX_GRID_BATCH));
+    }
+
+    dim3 batch_grid(int batch_count)
+    {
+        return dim3((batch_count - 1) / VECTOR_DIM_X + 1);
+    }
+}
+
+template <typename T>
+hipError_t hipblas_axpy_batched(hipStream_t                      stream,
+                                int                              n,
+                                const T*                         alpha,
+                                bool                             device_scalars,
+                                int64_t                          scalar_stride,
+                                hipblas_batched_operand<const T> x,
+                                int64_t                          incx,
+                                hipblas_batched_operand<T>       y,
+                                int64_t                          incy,
+                                int                              batch_count)
+{
+    if(n <= 0 || batch_count <= 0)
+        return hipSuccess;
+
+    hipLaunchKernelGGL(axpy_kernel<T>,
+                       vector_grid(n, batch_count),
+                       dim3(VECTOR_DIM_X),
+                       0,
+                       stream,
+                       n,
+                       host_scalar<T>(alpha, false, device_scalars),
+                       device_scalars ? alpha : nullptr,
+                       scalar_stride,
+                       x,
+                       incx,
+                       y,
+                       incy,
+                       batch_count);
+    return hipGetLastError();
+}
+
+template <typename T>
+hipError_t hipblas_scal_batched(hipStream_t                stream,
+                                int                        n,
+                                const void*                alpha,
+                                bool                       real_alpha,
+                                bool                       device_scalars,
+                                hipblas_batched_operand<T> x,
+                                int64_t                    incx,
+                                int                        batch_count)
+{
+    if(n <= 0 || incx <= 0 || batch_count <= 0)
+        return hipSuccess;
+
+    hipLaunchKernelGGL(scal_kernel<T>,
+                       vector_grid(n, batch_count),
+                       dim3(VECTOR_DIM_X),
+                       0,
+                       stream,
+                       n,
+                       host_scalar<T>(alpha, real_alpha, device_scalars),
+                       device_scalars ? alpha : nullptr,
+                       real_alpha,
+                       x,
+                       incx,
+                       batch_count);
+    return hipGetLastError();
+}
+
+template <typename T>
+hipError_t hipblas_copy_batched(hipStream_t                      stream,
+                                int                              n,
+                                hipblas_batched_operand<const T> x,
+                                int64_t                          incx,
+                                hipblas_batched_operand<T>       y,
+                                int64_t                          incy,
+                                int                              batch_count)
+{
+    if(n <= 0 || batch_count <= 0)
+        return hipSuccess;
+
+    // The kernel only writes x when swapping
+    hipblas_batched_operand<T> src
+        = {const_cast<T*>(x.ptr), x.stride, const_cast<T* const*>(x.array)};
+    hipLaunchKernelGGL(copy_kernel<T>,
+                       vector_grid(n, batch_count),
+                       dim3(VECTOR_DIM_X),
+                       0,
+                       stream,
+                       n,
+                       false,
+                       false,
+                       src,
+                       incx,
+                       y,
+                       incy,
+                       batch_count);
+    return hipGetLastError();
+}
+
+template <typename T>
+hipError_t hipblas_conj_copy_batched(hipStream_t                      stream,
+                                     int                              n,
+                                     hipblas_batched_operand<const T> x,
+                                     int64_t                          incx,
+                                     hipblas_batched_operand<T>       y,
+                                     int64_t                          incy,
+                                     int                              batch_count)
+{
+    if(n <= 0 || batch_count <= 0)
+        return hipSuccess;
+
+    hipblas_batched_operand<T> src
+        = {const_cast<T*>(x.ptr), x.stride, const_cast<T* const*>(x.array)};
+    hipLaunchKernelGGL(copy_kernel<T>,
+                       vector_grid(n, batch_count),
+                       dim3(VECTOR_DIM_X),
+                       0,
+                       stream,
+                       n,
+                       false,
+                       true,
+                       src,
+                       incx,
+                       y,
+                       incy,
+                       batch_count);
+    return hipGetLastError();
+}
+
+template <typename T>
+hipError_t hipblas_swap_batched(hipStream_t                stream,
+                                int                        n,
+                                hipblas_batched_operand<T> x,
+                                int64_t                    incx,
+                                hipblas_batched_operand<T> y,
+                                int64_t                    incy,
+                                int                        batch_count)
+{
+    if(n <= 0 || batch_count <= 0)
+        return hipSuccess;
+
+    hipLaunchKernelGGL(copy_kernel<T>,
+                       vector_grid(n, batch_count),
+                       dim3(VECTOR_DIM_X),
+                       0,
+                       stream,
+                       n,
+                       true,
+                       false,
+                       x,
+                       incx,
+                       y,
+                       incy,
+                       batch_count);
+    return hipGetLastError();
+}
+
+template <typename T>
+hipError_t hipblas_rot_batched(hipStream_t                stream,
+                               int                        n,
+                               hipblas_batched_operand<T> x,
+                               int64_t                    incx,
+                               hipblas_batched_operand<T> y,
+                               int64_t                    incy,
+                               const void*                c,
+                               const void*                s,
+                               bool                       real_s,
+                               bool                       device_scalars,
+                               int                        batch_count)
+{
+    if(n <= 0 || batch_count <= 0)
+        return hipSuccess;
+
+    hipLaunchKernelGGL(rot_kernel<T>,
+                       vector_grid(n, batch_count),
+                       dim3(VECTOR_DIM_X),
+                       0,
+                       stream,
+                       n,
+                       host_scalar<T>(c, true, device_scalars),
+                       host_scalar<T>(s, real_s, device_scalars),
+                       device_scalars ? c : nullptr,
+                       device_scalars ? s : nullptr,
+                       real_s,
+                       x,
+                       incx,
+                       y,
+                       incy,
+                       batch_count);
+    return hipGetLastError();
+}
+
+template <typename T>
+hipError_t hipblas_rotm_batched(hipStream_t                      stream,
+                                int                              n,
+                                hipblas_batched_operand<T>       x,
+                                int64_t                          incx,
+                                hipblas_batched_operand<T>       y,
+                                int64_t                          incy,
+                                hipblas_batched_operand<const T> param,
+                                int                              batch_count)
+{
+    if(n <= 0 || batch_count <= 0)
+        return hipSuccess;
+
+    hipLaunchKernelGGL(rotm_kernel<T>,
+                       vector_grid(n, batch_count),
+                       dim3(VECTOR_DIM_X),
+                       0,
+                       stream,
+                       n,
+                       x,
+                       incx,
+                       y,
+                       incy,
+                       param,
+                       batch_count);
+    return hipGetLastError();
+}
+
+template <typename T>
+hipError_t hipblas_dot_batched(hipStream_t                      stream,
+                               int                              n,
+                               hipblas_batched_operand<const T> x,
+                               int64_t                          incx,
+                               hipblas_batched_operand<const T> y,
+                               int64_t                          incy,
+                               bool                             conj,
+                               T*                               result,
+                               int                              batch_count)
+{
+    if(batch_count <= 0)
+        return hipSuccess;
+
+    hipLaunchKernelGGL(dot_kernel<T>,
+                       dim3(std::min(batch_count, MAX_GRID_BATCH)),
+                       dim3(REDUCE_DIM_X),
+                       0,
+                       stream,
+                       n < 0 ? 0 : n,
+                       x,
+                       incx,
+                       y,
+                       incy,
+                       conj,
+                       result,
+                       batch_count);
+    return hipGetLastError();
+}
+
+template <typename T, typename Tr>
+hipError_t hipblas_norm_batched(hipStream_t                      stream,
+                                bool                             nrm2,
+                                int                              n,
+                                hipblas_batched_operand<const T> x,
+                                int64_t                          incx,
+                                Tr*                              result,
+                                int                              batch_count)
+{
+    if(batch_count <= 0)
+        return hipSuccess;
+
+    hipLaunchKernelGGL(norm_kernel<T>,
+                       dim3(std::min(batch_count, MAX_GRID_BATCH)),
+                       dim3(REDUCE_DIM_X),
+                       0,
+                       stream,
+                       nrm2,
+                       n < 0 || incx <= 0 ? 0 : n,
+                       x,
+                       incx,
+                       result,
+                       batch_count);
+    return hipGetLastError();
+}
+
+template <typename T>
+hipError_t hipblas_iamax_batched(hipStream_t                      stream,
+                                 bool                             min,
+                                 int                              n,
+                                 hipblas_batched_operand<const T> x,
+                                 int64_t                          incx,
+                                 int*                             result,
+                                 int                              batch_count)
+{
+    if(batch_count <= 0)
+        return hipSuccess;
+
+    hipLaunchKernelGGL(iamax_kernel<T>,
+                       dim3(std::min(batch_count, MAX_GRID_BATCH)),
+                       dim3(REDUCE_DIM_X),
+                       0,
+                       stream,
+                       min,
+                       n < 0 || incx <= 0 ? 0 : n,
+                       x,
+                       incx,
+                       result,
+                       batch_count);
+    return hipGetLastError();
+}
+
+template <typename T>
+hipError_t hipblas_iamax_chunks(hipStream_t stream,
+                                bool        min,
+                                const T*    x,
+                                int64_t     incx,
+                                int64_t     chunk,
+                                int         chunks,
+                                const int*  part,
+                                int64_t*    result)
+{
+    hipLaunchKernelGGL(iamax_chunks_kernel<T>,
+                       dim3(1),
+                       dim3(1),
+                       0,
+                       stream,
+                       min,
+                       x,
+                       incx,
+                       chunk,
+                       chunks,
+                       part,
+                       result);
+    return hipGetLastError();
+}
+
+template <typename T, typename Tc>
+hipError_t hipblas_rotg_batched(hipStream_t                 stream,
+                                hipblas_batched_operand<T>  a,
+                                hipblas_batched_operand<T>  b,
+                                hipblas_batched_operand<Tc> c,
+                                hipblas_batched_operand<T>  s,
+                                int                         batch_count)
+{
+    if(batch_count <= 0)
+        return hipSuccess;
+
+    hipLaunchKernelGGL(rotg_kernel<T>,
+                       batch_grid(batch_count),
+                       dim3(VECTOR_DIM_X),
+                       0,
+                       stream,
+                       a,
+                       b,
+                       c,
+                       s,
+                       batch_count);
+    return hipGetLastError();
+}
+
+template <typename T>
+hipError_t hipblas_rotmg_batched(hipStream_t                      stream,
+                                 hipblas_batched_operand<T>       d1,
+                                 hipblas_batched_operand<T>       d2,
+                                 hipblas_batched_operand<T>       x1,
+                                 hipblas_batched_operand<const T> y1,
+                                 hipblas_batched_operand<T>       param,
+                                 int                              batch_count)
+{
+    if(batch_count <= 0)
+        return hipSuccess;
+
+    hipLaunchKernelGGL(rotmg_kernel<T>,
+                       batch_grid(batch_count),
+                       dim3(VECTOR_DIM_X),
+                       0,
+                       stream,
+                       d1,
+                       d2,
+                       x1,
+                       y1,
+                       param,
+                       batch_count);
+    return hipGetLastError();
+}
+
+template <typename T>
+hipError_t hipblas_axpby_batched(hipStream_t                      stream,
+                                 int                              n,
+                                 const T*                         alpha,
+                                 const T*                         beta,
+                                 bool                             device_scalars,
+                                 int64_t                          scalar_stride,
+                                 hipblas_batched_operand<const T> x,
+                                 int64_t                          incx,
+                                 hipblas_batched_operand<const T> y,
+                                 int64_t                          incy,
+                                 hipblas_batched_operand<T>       w,
+                                 int64_t                          incw,
+                                 int                              batch_count)
+{
+    if(n <= 0 || batch_count <= 0)
+        return hipSuccess;
+
+    hipLaunchKernelGGL(axpby_kernel<T>,
+                       vector_grid(n, batch_count),
+                       dim3(VECTOR_DIM_X),
+                       0,
+                       stream,
+                       n,
+                       host_scalar<T>(alpha, false, device_scalars),
+                       host_scalar<T>(beta, false, device_scalars),
+                       device_scalars ? alpha : nullptr,
+                       device_scalars ? beta : nullptr,
+                       scalar_stride,
+                       x,
+                       incx,
+                       y,
+                       incy,
+                       w,
+                       incw,
+                       batch_count);
+    return hipGetLastError();
+}
+
+int hipblas_fused_dot_blocks(int n)
+{
+    return n <= 0 ? 1 : std::min((n - 1) / REDUCE_DIM_X + 1, FUSED_DOT_MAX_BLOCKS);
+}
+
+template <typename T>
+hipError_t hipblas_mdot_batched(hipStream_t                      stream,
+                                int                              n,
+                                int                              k,
+                                hipblas_batched_operand<const T> x,
+                                int64_t                          incx,
+                                hipblas_batched_operand<const T> Y,
+                                int64_t                          ldy,
+                                int64_t                          incy,
+                                bool                             conj,
+                                T*                               result,
+                                T*                               work,
+                                int                              batch_count)
+{
+    if(k <= 0 || batch_count <= 0)
+        return hipSuccess;
+
+    int     blocks = hipblas_fused_dot_blocks(n);
+    int64_t count  = int64_t(k) * batch_count;
+    hipLaunchKernelGGL(mdot_kernel<T>,
+                       dim3(blocks,
+                            std::min((k - 1) / MDOT_COLUMNS + 1, MAX_GRID_BATCH),
+                            std::min(batch_count, MAX_GRID_BATCH)),
+                       dim3(REDUCE_DIM_X),
+                       0,
+                       stream,
+                       n < 0 ? 0 : n,
+                       k,
+                       x,
+                       incx,
+                       Y,
+                       ldy,
+                       incy,
+                       conj,
+                       work,
+                       batch_count);
+    hipLaunchKernelGGL(sum_blocks_kernel<T>,
+                       dim3((count - 1) / VECTOR_DIM_X + 1),
+                       dim3(VECTOR_DIM_X),
+                       0,
+                       stream,
+                       blocks,
+                       work,
+                       result,
+                       count);
+    return hipGetLastError();
+}
+
+template <typename T>
+hipError_t hipblas_axpy_dot_batched(hipStream_t                      stream,
+                                    int                              n,
+                                    const T*                         alpha,
+                                    bool                             device_scalars,
+                                    int64_t                          scalar_stride,
+                                    hipblas_batched_operand<const T> x,
+                                    int64_t                          incx,
+                                    hipblas_batched_operand<T>       y,
+                                    int64_t                          incy,
+                                    hipblas_batched_operand<const T> z,
+                                    int64_t                          incz,
+                                    bool                             conj,
+                                    T*                               result,
+                                    T*                               work,
+                                    int                              batch_count)
+{
+    if(batch_count <= 0)
+        return hipSuccess;
+
+    int blocks = hipblas_fused_dot_blocks(n);
+    hipLaunchKernelGGL(axpy_dot_kernel<T>,
+                       dim3(blocks, std::min(batch_count, MAX_GRID_BATCH)),
+                       dim3(REDUCE_DIM_X),
+                       0,
+                       stream,
+                       n < 0 ? 0 : n,
+                       host_scalar<T>(alpha, false, device_scalars),
+                       device_scalars ? alpha : nullptr,
+                       scalar_stride,
+                       x,
+                       incx,
+                       y,
+                       incy,
+                       z,
+                       incz,
+                       conj,
+                       work,
+                       batch_count);
+    hipLaunchKernelGGL(sum_blocks_kernel<T>,
+                       dim3((batch_count - 1) / VECTOR_DIM_X + 1),
+                       dim3(VECTOR_DIM_X),
+                       0,
+                       stream,
+                       blocks,
+                       work,
+                       result,
+                       int64_t(batch_count));
+    return hipGetLastError();
+}
+
+// clang-format off
+template hipError_t hipblas_axpy_batched<hipblasHalf>(hipStream_t, int, const hipblasHalf*, bool, int64_t, hipblas_batched_operand<const hipblasHalf>, int64_t, hipblas_batched_operand<hipblasHalf>, int64_t, int);
+template hipError_t hipblas_axpy_batched<float>(hipStream_t, int, const float*, bool, int64_t, hipblas_batched_operand<const float>, int64_t, hipblas_batched_operand<float>, int64_t, int);
+template hipError_t hipblas_axpy_batched<double>(hipStream_t, int, const double*, bool, int64_t, hipblas_batched_operand<const double>, int64_t, hipblas_batched_operand<double>, int64_t, int);
+template hipError_t hipblas_axpy_batched<hipblasComplex>(hipStream_t, int, const hipblasComplex*, bool, int64_t, hipblas_batched_operand<const hipblasComplex>, int64_t, hipblas_batched_operand<hipblasComplex>, int64_t, int);
+template hipError_t hipblas_axpy_batched<hipblasDoubleComplex>(hipStream_t, int, const hipblasDoubleComplex*, bool, int64_t, hipblas_batched_operand<const hipblasDoubleComplex>, int64_t, hipblas_batched_operand<hipblasDoubleComplex>, int64_t, int);
+template hipError_t hipblas_scal_batched<float>(hipStream_t, int, const void*, bool, bool, hipblas_batched_operand<float>, int64_t, int);
+template hipError_t hipblas_scal_batched<double>(hipStream_t, int, const void*, bool, bool, hipblas_batched_operand<double>, int64_t, int);
+template hipError_t hipblas_scal_batched<hipblasComplex>(hipStream_t, int, const void*, bool, bool, hipblas_batched_operand<hipblasComplex>, int64_t, int);
+template hipError_t hipblas_scal_batched<hipblasDoubleComplex>(hipStream_t, int, const void*, bool, bool, hipblas_batched_operand<hipblasDoubleComplex>, int64_t, int);
+template hipError_t hipblas_copy_batched<float>(hipStream_t, int, hipblas_batched_operand<const float>, int64_t, hipblas_batched_operand<float>, int64_t, int);
+template hipError_t hipblas_copy_batched<double>(hipStream_t, int, hipblas_batched_operand<const double>, int64_t, hipblas_batched_operand<double>, int64_t, int);
+template hipError_t hipblas_copy_batched<hipblasComplex>(hipStream_t, int, hipblas_batched_operand<const hipblasComplex>, int64_t, hipblas_batched_operand<hipblasComplex>, int64_t, int);
+template hipError_t hipblas_copy_batched<hipblasDoubleComplex>(hipStream_t, int, hipblas_batched_operand<const hipblasDoubleComplex>, int64_t, hipblas_batched_operand<hipblasDoubleComplex>, int64_t, int);
+template hipError_t hipblas_conj_copy_batched<float>(hipStream_t, int, hipblas_batched_operand<const float>, int64_t, hipblas_batched_operand<float>, int64_t, int);
+template hipError_t hipblas_conj_copy_batched<double>(hipStream_t, int, hipblas_batched_operand<const double>, int64_t, hipblas_batched_operand<double>, int64_t, int);
+template hipError_t hipblas_conj_copy_batched<hipblasComplex>(hipStream_t, int, hipblas_batched_operand<const hipblasComplex>, int64_t, hipblas_batched_operand<hipblasComplex>, int64_t, int);
+template hipError_t hipblas_conj_copy_batched<hipblasDoubleComplex>(hipStream_t, int, hipblas_batched_operand<const hipblasDoubleComplex>, int64_t, hipblas_batched_operand<hipblasDoubleComplex>, int64_t, int);
+template hipError_t hipblas_swap_batched<float>(hipStream_t, int, hipblas_batched_operand<float>, int64_t, hipblas_batched_operand<float>, int64_t, int);
+template hipError_t hipblas_swap_batched<double>(hipStream_t, int, hipblas_batched_operand<double>, int64_t, hipblas_batched_operand<double>, int64_t, int);
+template hipError_t hipblas_swap_batched<hipblasComplex>(hipStream_t, int, hipblas_batched_operand<hipblasComplex>, int64_t, hipblas_batched_operand<hipblasComplex>, int64_t, int);
+template hipError_t hipblas_swap_batched<hipblasDoubleComplex>(hipStream_t, int, hipblas_batched_operand<hipblasDoubleComplex>, int64_t, hipblas_batched_operand<hipblasDoubleComplex>, int64_t, int);
+template hipError_t hipblas_rot_batched<float>(hipStream_t, int, hipblas_batched_operand<float>, int64_t, hipblas_batched_operand<float>, int64_t, const void*, const void*, bool, bool, int);
+template hipError_t hipblas_rot_batched<double>(hipStream_t, int, hipblas_batched_operand<double>, int64_t, hipblas_batched_operand<double>, int64_t, const void*, const void*, bool, bool, int);
+template hipError_t hipblas_rot_batched<hipblasComplex>(hipStream_t, int, hipblas_batched_operand<hipblasComplex>, int64_t, hipblas_batched_operand<hipblasComplex>, int64_t, const void*, const void*, bool, bool, int);
+template hipError_t hipblas_rot_batched<hipblasDoubleComplex>(hipStream_t, int, hipblas_batched_operand<hipblasDoubleComplex>, int64_t, hipblas_batched_operand<hipblasDoubleComplex>, int64_t, const void*, const void*, bool, bool, int);
+template hipError_t hipblas_rotm_batched<float>(hipStream_t, int, hipblas_batched_operand<float>, int64_t, hipblas_batched_operand<float>, int64_t, hipblas_batched_operand<const float>, int);
+template hipError_t hipblas_rotm_batched<double>(hipStream_t, int, hipblas_batched_operand<double>, int64_t, hipblas_batched_operand<double>, int64_t, hipblas_batched_operand<const double>, int);
+template hipError_t hipblas_dot_batched<hipblasHalf>(hipStream_t, int, hipblas_batched_operand<const hipblasHalf>, int64_t, hipblas_batched_operand<const hipblasHalf>, int64_t, bool, hipblasHalf*, int);
+template hipError_t hipblas_dot_batched<hipblasBfloat16>(hipStream_t, int, hipblas_batched_operand<const hipblasBfloat16>, int64_t, hipblas_batched_operand<const hipblasBfloat16>, int64_t, bool, hipblasBfloat16*, int);
+template hipError_t hipblas_dot_batched<float>(hipStream_t, int, hipblas_batched_operand<const float>, int64_t, hipblas_batched_operand<const float>, int64_t, bool, float*, int);
+template hipError_t hipblas_dot_batched<double>(hipStream_t, int, hipblas_batched_operand<const double>, int64_t, hipblas_batched_operand<const double>, int64_t, bool, double*, int);
+template hipError_t hipblas_dot_batched<hipblasComplex>(hipStream_t, int, hipblas_batched_operand<const hipblasComplex>, int64_t, hipblas_batched_operand<const hipblasComplex>, int64_t, bool, hipblasComplex*, int);
+template hipError_t hipblas_dot_batched<hipblasDoubleComplex>(hipStream_t, int, hipblas_batched_operand<const hipblasDoubleComplex>, int64_t, hipblas_batched_operand<const hipblasDoubleComplex>, int64_t, bool, hipblasDoubleComplex*, int);
+template hipError_t hipblas_norm_batched<float, float>(hipStream_t, bool, int, hipblas_batched_operand<const float>, int64_t, float*, int);
+template hipError_t hipblas_norm_batched<double, double>(hipStream_t, bool, int, hipblas_batched_operand<const double>, int64_t, double*, int);
+template hipError_t hipblas_norm_batched<hipblasComplex, float>(hipStream_t, bool, int, hipblas_batched_operand<const hipblasComplex>, int64_t, float*, int);
+template hipError_t hipblas_norm_batched<hipblasDoubleComplex, double>(hipStream_t, bool, int, hipblas_batched_operand<const hipblasDoubleComplex>, int64_t, double*, int);
+template hipError_t hipblas_iamax_batched<float>(hipStream_t, bool, int, hipblas_batched_operand<const float>, int64_t, int*, int);
+template hipError_t hipblas_iamax_batched<double>(hipStream_t, bool, int, hipblas_batched_operand<const double>, int64_t, int*, int);
+template hipError_t hipblas_iamax_batched<hipblasComplex>(hipStream_t, bool, int, hipblas_batched_operand<const hipblasComplex>, int64_t, int*, int);
+template hipError_t hipblas_iamax_batched<hipblasDoubleComplex>(hipStream_t, bool, int, hipblas_batched_operand<const hipblasDoubleComplex>, int64_t, int*, int);
+template hipError_t hipblas_iamax_chunks<float>(hipStream_t, bool, const float*, int64_t, int64_t, int, const int*, int64_t*);
+template hipError_t hipblas_iamax_chunks<double>(hipStream_t, bool, const double*, int64_t, int64_t, int, const int*, int64_t*);
+template hipError_t hipblas_iamax_chunks<hipblasComplex>(hipStream_t, bool, const hipblasComplex*, int64_t, int64_t, int, const int*, int64_t*);
+template hipError_t hipblas_iamax_chunks<hipblasDoubleComplex>(hipStream_t, bool, const hipblasDoubleComplex*, int64_t, int64_t, int, const int*, int64_t*);
+template hipError_t hipblas_rotg_batched<float, float>(hipStream_t, hipblas_batched_operand<float>, hipblas_batched_operand<float>, hipblas_batched_operand<float>, hipblas_batched_operand<float>, int);
+template hipError_t hipblas_rotg_batched<double, double>(hipStream_t, hipblas_batched_operand<double>, hipblas_batched_operand<double>, hipblas_batched_operand<double>, hipblas_batched_operand<double>, int);
+template hipError_t hipblas_rotg_batched<hipblasComplex, float>(hipStream_t, hipblas_batched_operand<hipblasComplex>, hipblas_batched_operand<hipblasComplex>, hipblas_batched_operand<float>, hipblas_batched_operand<hipblasComplex>, int);
+template hipError_t hipblas_rotg_batched<hipblasDoubleComplex, double>(hipStream_t, hipblas_batched_operand<hipblasDoubleComplex>, hipblas_batched_operand<hipblasDoubleComplex>, hipblas_batched_operand<double>, hipblas_batched_operand<hipblasDoubleComplex>, int);
+template hipError_t hipblas_rotmg_batched<float>(hipStream_t, hipblas_batched_operand<float>, hipblas_batched_operand<float>, hipblas_batched_operand<float>, hipblas_batched_operand<const float>, hipblas_batched_operand<float>, int);
+template hipError_t hipblas_rotmg_batched<double>(hipStream_t, hipblas_batched_operand<double>, hipblas_batched_operand<double>, hipblas_batched_operand<double>, hipblas_batched_operand<const double>, hipblas_batched_operand<double>, int);
+template hipError_t hipblas_axpby_batched<float>(hipStream_t, int, const float*, const float*, bool, int64_t, hipblas_batched_operand<const float>, int64_t, hipblas_batched_operand<const float>, int64_t, hipblas_batched_operand<float>, int64_t, int);
+template hipError_t hipblas_axpby_batched<double>(hipStream_t, int, const double*, const double*, bool, int64_t, hipblas_batched_operand<const double>, int64_t, hipblas_batched_operand<const double>, int64_t, hipblas_batched_operand<double>, int64_t, int);
+template hipError_t hipblas_axpby_batched<hipblasComplex>(hipStream_t, int, const hipblasComplex*, const hipblasComplex*, bool, int64_t, hipblas_batched_operand<const hipblasComplex>, int64_t, hipblas_batched_operand<const hipblasComplex>, int64_t, hipblas_batched_operand<hipblasComplex>, int64_t, int);
+template hipError_t hipblas_axpby_batched<hipblasDoubleComplex>(hipStream_t, int, const hipblasDoubleComplex*, const hipblasDoubleComplex*, bool, int64_t, hipblas_batched_operand<const hipblasDoubleComplex>, int64_t, hipblas_batched_operand<const hipblasDoubleComplex>, int64_t, hipblas_batched_operand<hipblasDoubleComplex>, int64_t, int);
+template hipError_t hipblas_mdot_batched<float>(hipStream_t, int, int, hipblas_batched_operand<const float>, int64_t, hipblas_batched_operand<const float>, int64_t, int64_t, bool, float*, float*, int);
+template hipError_t hipblas_mdot_batched<double>(hipStream_t, int, int, hipblas_batched_operand<const double>, int64_t, hipblas_batched_operand<const double>, int64_t, int64_t, bool, double*, double*, int);
+template hipError_t hipblas_mdot_batched<hipblasComplex>(hipStream_t, int, int, hipblas_batched_operand<const hipblasComplex>, int64_t, hipblas_batched_operand<const hipblasComplex>, int64_t, int64_t, bool, hipblasComplex*, hipblasComplex*, int);
+template hipError_t hipblas_mdot_batched<hipblasDoubleComplex>(hipStream_t, int, int, hipblas_batched_operand<const hipblasDoubleComplex>, int64_t, hipblas_batched_operand<const hipblasDoubleComplex>, int64_t, int64_t, bool, hipblasDoubleComplex*, hipblasDoubleComplex*, int);
+template hipError_t hipblas_axpy_dot_batched<float>(hipStream_t, int, const float*, bool, int64_t, hipblas_batched_operand<const float>, int64_t, hipblas_batched_operand<float>, int64_t, hipblas_batched_operand<const float>, int64_t, bool, float*, float*, int);
+template hipError_t hipblas_axpy_dot_batched<double>(hipStream_t, int, const double*, bool, int64_t, hipblas_batched_operand<const double>, int64_t, hipblas_batched_operand<double>, int64_t, hipblas_batched_operand<const double>, int64_t, bool, double*, double*, int);
+template hipError_t hipblas_axpy_dot_batched<hipblasComplex>(hipStream_t, int, const hipblasComplex*, bool, int64_t, hipblas_batched_operand<const hipblasComplex>, int64_t, hipblas_batched_operand<hipblasComplex>, int64_t, hipblas_batched_operand<const hipblasComplex>, int64_t, bool, hipblasComplex*, hipblasComplex*, int);
+template hipError_t hipblas_axpy_dot_batched<hipblasDoubleComplex>(hipStream_t, int, const hipblasDoubleComplex*, bool, int64_t, hipblas_batched_operand<const hipblasDoubleComplex>, int64_t, hipblas_batched_operand<hipblasDoubleComplex>, int64_t, hipblas_batched_operand<const hipblasDoubleComplex>, int64_t, bool, hipblasDoubleComplex*, hipblasDoubleComplex*, int);
+// clang-format on
@@ -0,0 +1,468 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "hipblas_kernels.h"
+#include <algorithm>
+#include <cstring>
+#include <hip/hip_runtime.h>
+
+namespace
+{
+    constexpr int VECTOR_DIM_X = 256;
+
+    constexpr int MATRIX_DIM_X = 32;
+    constexpr int MATRIX_DIM_Y = 8;
+
+    // Block size of the triangular sweep; a power of two for the shared memory reduction
+    constexpr int SWEEP_DIM_X = 256;
+
+    constexpr int MAX_GRID_BATCH = 65535;
+
+    template <typename E>
+    struct arith
+    {
+        using real = E;
+        __device__ static E    from_real(real r) { return r; }
+        __device__ static E    add(E a, E b) { return a + b; }
+        __device__ static E    sub(E a, E b) { return a - b; }
+        __device__ static E    mul(E a, E b) { return a * b; }
+        __device__ static E    div(E a, E b) { return a / b; }
+        __device__ static E    conj(E a) { return a; }
+        __device__ static E    real_part(E a) { return a; }
+        __device__ static bool is_zero(E a) { return a == 0; }
+    };
+
+    template <typename R>
+    struct arith<hip_complex_number<R>>
+    {
+        using E    = hip_complex_number<R>;
+        using real = R;
+        __device__ static E from_real(real r) { return {r, 0}; }
+        __device__ static E add(E a, E b) { return {a.x + b.x, a.y + b.y}; }
+        __device__ static E sub(E a, E b) { return {a.x - b.x, a.y - b.y}; }
+        __device__ static E mul(E a, E b) { return {a.x * b.x - a.y * b.y, a.x * b.y + a.y * b.x}; }
+
+        // Smith's algorithm, scaling by the larger part of b to avoid overflow
+        __device__ static E div(E a, E b)
+        {
+            if((b.x < 0 ? -b.x : b.x) >= (b.y < 0 ? -b.y : b.y))
+            {
+                R r = b.y / b.x, d = b.x + b.y * r;
+                return {(a.x + a.y * r) / d, (a.y - a.x * r) / d};
+            }
+            R r = b.x / b.y, d = b.x * r + b.y;
+            return {(a.x * r + a.y) / d, (a.y * r - a.x) / d};
+        }
+
+        __device__ static E    conj(E a) { return {a.x, -a.y}; }
+        __device__ static E    real_part(E a) { return {a.x, 0}; }
+        __device__ static bool is_zero(E a) { return a.x == 0 && a.y == 0; }
+    };
+
+    template <typename E>
+    __device__ E* batch_at(hipblas_batched_operand<E> op, int b)
+    {
+        return op.array ? op.array[b] : op.ptr + b * op.stride;
+    }
+
+    // Element i of a length n vector; a negative increment walks it from the far end, as in BLAS
+    __device__ int64_t vector_offset(int i, int n, int64_t inc)
+    {
+        return inc >= 0 ? i * inc : (i - int64_t(n - 1)) * inc;
+    }
+
+    // Offset of A(i, j) in the packed triangle of an n x n matrix
+    __device__ int64_t packed_offset(const hipblas_matrix_desc& desc, int i, int j)
+    {
+        return desc.uplo == HIPBLAS_FILL_MODE_UPPER ? i + int64_t(j) * (j + 1) / 2
+                                                    : i + int64_t(2 * desc.n - j - 1) * j / 2;
+    }
+
+    // A(i, j) for (i, j) inside the stored triangle or band
+    template <typename E>
+    __device__ E stored_element(const hipblas_matrix_desc& desc, const E* A, int i, int j)
+    {
+        switch(desc.storage)
+        {
+        case HIPBLAS_STORAGE_BAND:
+            if(i - j > desc.kl || j - i > desc.ku)
+                return arith<E>::from_real(0);
+            return A[desc.ku + i - j + j * desc.lda];
+        case HIPBLAS_STORAGE_PACKED:
+            return A[packed_offset(desc, i, j)];
+        default:
+            return A[i + j * desc.lda];
+        }
+    }
+
+    // A(i, j) of the whole matrix, filling in the unstored triangle of a symmetric, Hermitian or
+    // triangular A; the diagonal of a Hermitian A is real
+    template <typename E>
+    __device__ E matrix_element(const hipblas_matrix_desc& desc, const E* A, int i, int j)
+    {
+        if(desc.shape == HIPBLAS_MATRIX_GENERAL)
+            return stored_element(desc, A, i, j);
+
+        bool in_triangle = desc.uplo == HIPBLAS_FILL_MODE_UPPER ? i <= j : i >= j;
+        if(desc.shape == HIPBLAS_MATRIX_TRIANGULAR)
+        {
+            if(!in_triangle)
+                return arith<E>::from_real(0);
+            if(i == j && desc.diag == HIPBLAS_DIAG_UNIT)
+                return arith<E>::from_real(1);
+            return stored_element(desc, A, i, j);
+        }
+
+        E v = in_triangle ? stored_element(desc, A, i, j) : stored_element(desc, A, j, i);
+        if(desc.shape == HIPBLAS_MATRIX_HERMITIAN)
+            v = i == j ? arith<E>::real_part(v) : in_triangle ? v : arith<E>::conj(v);
+        return v;
+    }
+
+    // op(A)(i, j)
+    template <typename E>
+    __device__ E op_element(const hipblas_matrix_desc& desc, const E* A, int i, int j)
+    {
+        if(desc.trans == HIPBLAS_OP_N)
+            return matrix_element(desc, A, i, j);
+        E v = matrix_element(desc, A, j, i);
+        return desc.trans == HIPBLAS_OP_C ? arith<E>::conj(v) : v;
+    }
+
+    // Columns [lo, hi) of row i of op(A) that can be non-zero
+    __device__ void op_row_range(const hipblas_matrix_desc& desc, int i, int cols, int& lo, int& hi)
+    {
+        lo = 0;
+        hi = cols;
+        if(desc.storage != HIPBLAS_STORAGE_BAND)
+            return;
+
+        // A symmetric or Hermitian band reaches as far below the diagonal as above it
+        int kl = desc.kl, ku = desc.ku;
+        if(desc.shape == HIPBLAS_MATRIX_SYMMETRIC || desc.shape == HIPBLAS_MATRIX_HERMITIAN)
+            kl = ku = kl > ku ? kl : ku;
+        if(desc.trans != HIPBLAS_OP_N)
+        {
+            int t = kl;
+            kl    = ku;
+            ku    = t;
+        }
+        lo = i - kl > lo ? i - kl : lo;
+        hi = i + ku + 1 < hi ? i + ku + 1 : hi;
+    }
+
+    // One thread per row of op(A); in device pointer mode batch b reads its scalars at
+    // alpha_dev[b * scalar_stride] and beta_dev[b * scalar_stride]
+    template <typename E>
+    __global__ void matvec_kernel(hipblas_matrix_desc              desc,
+                                  E                                alpha,
+                                  E                                beta,
+                                  const E*                         alpha_dev,
+                                  const E*                         beta_dev,
+                                  int64_t                          scalar_stride,
+                                  hipblas_batched_operand<const E> A,
+                                  hipblas_batched_operand<const E> x,
+                                  int64_t                          incx,
+                                  hipblas_batched_operand<E>       y,
+                                  int64_t                          incy,
+                                  int                              batch_count)
+    {
+        int rows = desc.trans == HIPBLAS_OP_N ? desc.m : desc.n;
+        int cols = desc.trans == HIPBLAS_OP_N ? desc.n : desc.m;
+        int i    = blockIdx.x * blockDim.x + threadIdx.x;
+        if(i >= rows)
+            return;
+
+        int lo, hi;
+        op_row_range(desc, i, cols, lo, hi);
+
+        for(int b = blockIdx.y; b < batch_count; b += gridDim.y)
+        {
+            if(alpha_dev)
+                alpha = alpha_dev[b * scalar_stride];
+            if(beta_dev)
+                beta = beta_dev[b * scalar_stride];
+
+            const E* a   = batch_at(A, b);
+            const E* xb  = batch_at(x, b);
+            E*       yi  = batch_at(y, b) + vector_offset(i, rows, incy);
+            E        sum = arith<E>::from_real(0);
+            if(!arith<E>::is_zero(alpha))
+                for(int j = lo; j < hi; j++)
+                    sum = arith<E>::add(sum,
+                                        arith<E>::mul(op_element(desc, a, i, j),
+                                                      xb[vector_offset(j, cols, incx)]));
+
+            E r = arith<E>::mul(alpha, sum);
+            if(!arith<E>::is_zero(beta))
+                r = arith<E>::add(r, arith<E>::mul(beta, *yi));
+            *yi = r;
+        }
+    }
+
+    // One block per batch walks the rows so that each x[i] is overwritten only once no later row
+    // reads it: a multiply walks away from the diagonal's zero side, a solve walks towards it
+    template <typename E>
+    __global__ void triangular_kernel(hipblas_matrix_desc              desc,
+                                      bool                             solve,
+                                      hipblas_batched_operand<const E> A,
+                                      hipblas_batched_operand<E>       x,
+                                      int64_t                          incx,
+                                      int                              batch_count)
+    {
+        __shared__ E partial[SWEEP_DIM_X];
+
+        int  n        = desc.n;
+        int  tid      = threadIdx.x;
+        bool upper_op = (desc.uplo == HIPBLAS_FILL_MODE_UPPER) == (desc.trans == HIPBLAS_OP_N);
+        bool forward  = solve != upper_op;
+
+        for(int b = blockIdx.x; b < batch_count; b += gridDim.x)
+        {
+            const E* a  = batch_at(A, b);
+            E*       xb = batch_at(x, b);
+
+            for(int s = 0; s < n; s++)
+            {
+                int i = forward ? s : n - 1 - s;
+
+                // The off-diagonal part of row i of op(A)
+                int lo, hi;
+                op_row_range(desc, i, n, lo, hi);
+                if(upper_op)
+                    lo = i + 1 > lo ? i + 1 : lo;
+                else
+                    hi = i < hi ? i : hi;
+
+                E sum = arith<E>::from_real(0);
+                for(int j = lo + tid; j < hi; j += blockDim.x)
+                    sum = arith<E>::add(
+                        sum,
+                        arith<E>::mul(op_element(desc, a, i, j), xb[vector_offset(j, n, incx)]));
+                partial[tid] = sum;
+                __syncthreads();
+
+                for(int half = blockDim.x / 2; half > 0; half /= 2)
+                {
+                    if(tid < half)
+                        partial[tid] = arith<E>::add(partial[tid], partial[tid + half]);
+                    __syncthreads();
+                }
+
+                if(tid == 0)
+                {
+                    E* xi = xb + vector_offset(i, n, incx);
+                    E  d  = op_element(desc, a, i, i);
+                    *xi   = solve ? arith<E>::div(arith<E>::sub(*xi, partial[0]), d)
+                                  : arith<E>::add(arith<E>::mul(d, *xi), partial[0]);
+                }
+                __syncthreads();
+            }
+        }
+    }
+
+    // One thread per element of A, skipping the unstored triangle of a symmetric or Hermitian A
+    template <typename E>
+    __global__ void rank_update_kernel(hipblas_matrix_desc              desc,
+                                       E                                alpha,
+                                       const void*                      alpha_dev,
+                                       bool                             real_alpha,
+                                       hipblas_batched_operand<const E> x,
+                                       int64_t                          incx,
+                                       hipblas_batched_operand<const E> y,
+                                       int64_t                          incy,
+                                       bool                             conj_y,
+                                       hipblas_batched_operand<E>       A,
+                                       int                              batch_count)
+    {
+        using real = typename arith<E>::real;
+
+        int i = blockIdx.x * blockDim.x + threadIdx.x;
+        int j = blockIdx.y * blockDim.y + threadIdx.y;
+        if(i >= desc.m || j >= desc.n)
+            return;
+
+        bool general = desc.shape == HIPBLAS_MATRIX_GENERAL;
+        bool herm    = desc.shape == HIPBLAS_MATRIX_HERMITIAN;
+        if(!general && !(desc.uplo == HIPBLAS_FILL_MODE_UPPER ? i <= j : i >= j))
+            return;
+
+        if(alpha_dev)
+            alpha = real_alpha ? arith<E>::from_real(*static_cast<const real*>(alpha_dev))
+                               : *static_cast<const E*>(alpha_dev);
+
+        bool two = y.ptr || y.array;
+        for(int b = blockIdx.z; b < batch_count; b += gridDim.z)
+        {
+            const E* xb = batch_at(x, b);
+            const E* yb = two ? batch_at(y, b) : nullptr;
+            E        xi = xb[vector_offset(i, desc.m, incx)];
+            E        v;
+            if(general)
+            {
+                E yj = yb[vector_offset(j, desc.n, incy)];
+                v    = arith<E>::mul(alpha, arith<E>::mul(xi, conj_y ? arith<E>::conj(yj) : yj));
+            }
+            else
+            {
+                // x[j] and y[j] enter conjugated for a Hermitian A
+                E xj = xb[vector_offset(j, desc.n, incx)];
+                if(herm)
+                    xj = arith<E>::conj(xj);
+                if(!two)
+                    v = arith<E>::mul(alpha, arith<E>::mul(xi, xj));
+                else
+                {
+                    E yi = yb[vector_offset(i, desc.n, incy)];
+                    E yj = yb[vector_offset(j, desc.n, incy)];
+                    if(herm)
+                        yj = arith<E>::conj(yj);
+                    E alpha2 = herm ? arith<E>::conj(alpha) : alpha;
+                    v        = arith<E>::add(arith<E>::mul(alpha, arith<E>::mul(xi, yj)),
+                                      arith<E>::mul(alpha2, arith<E>::mul(yi, xj)));
+                }
+            }
+
+            E* a = batch_at(A, b);
+            E* p = desc.storage == HIPBLAS_STORAGE_PACKED ? a + packed_offset(desc, i, j)
+                                                          : a + i + j * desc.lda;
+            E r = arith<E>::add(*p, v);
+            *p  = herm && i == j ? arith<E>::real_part(r) : r;
+        }
+    }
+
+    template <typename E, typename T>
+    E host_scalar(const T* value, bool device_scalars)
+    {
+        E v = {};
+        if(!device_scalars)
+            std::memcpy(&v, value, sizeof(E));
+        return v;
+    }
+}
+
+template <typename T>
+hipError_t hipblas_matvec_batched(hipStream_t                      stream,
+                                  const hipblas_matrix_desc&       desc,
+                                  const T*                         alpha,
+                                  const T*                         beta,
+                                  bool                             device_scalars,
+                                  int64_t                          scalar_stride,
+                                  hipblas_batched_operand<const T> A,
+                                  hipblas_batched_operand<const T> x,
+                                  int64_t                          incx,
+                                  hipblas_batched_operand<T>       y,
+                                  int64_t                          incy,
+                                  int                              batch_count)
+{
+    int rows = desc.trans == HIPBLAS_OP_N ? desc.m : desc.n;
+    if(rows <= 0 || batch_count <= 0)
+        return hipSuccess;
+
+    hipLaunchKernelGGL(matvec_kernel<T>,
+                       dim3((rows - 1) / VECTOR_DIM_X + 1, std::min(batch_count, MAX_GRID_BATCH)),
+                       dim3(VECTOR_DIM_X),
+                       0,
+                       stream,
+                       desc,
+                       host_scalar<T>(alpha, device_scalars),
+                       host_scalar<T>(beta, device_scalars),
+                       device_scalars ? alpha : nullptr,
+                       device_scalars ? beta : nullptr,
+                       scalar_stride,
+                       A,
+                       x,
+                       incx,
+                       y,
+                       incy,
+                       batch_count);
+    return hipGetLastError();
+}
+
+template <typename T>
+hipError_t hipblas_triangular_batched(hipStream_t                      stream,
+                                      const hipblas_matrix_desc&       desc,
+                                      bool                             solve,
+                                      hipblas_batched_operand<const T> A,
+                                      hipblas_batched_operand<T>       x,
+                                      int64_t                          incx,
+                                      int                              batch_count)
+{
+    if(desc.n <= 0 || batch_count <= 0)
+        return hipSuccess;
+
+    hipLaunchKernelGGL(triangular_kernel<T>,
+                       dim3(std::min(batch_count, MAX_GRID_BATCH)),
+                       dim3(SWEEP_DIM_X),
+                       0,
+                       stream,
+                       desc,
+                       solve,
+                       A,
+                       x,
+                       incx,
+                       batch_count);
+    return hipGetLastError();
+}
+
+template <typename T>
+hipError_t hipblas_rank_update_batched(hipStream_t                      stream,
+                                       const hipblas_matrix_desc&       desc,
+                                       const void*                      alpha,
+                                       bool                             real_alpha,
+                                       bool                             device_scalars,
+                                       hipblas_batched_operand<const T> x,
+                                       int64_t                          incx,
+                                       hipblas_batched_operand<const T> y,
+                                       int64_t                          incy,
+                                       bool                             conj_y,
+                                       hipblas_batched_operand<T>       A,
+                                       int                              batch_count)
+{
+    using real = typename arith<T>::real;
+    if(desc.m <= 0 || desc.n <= 0 || batch_count <= 0)
+        return hipSuccess;
+
+    T alpha_host = {};
+    if(!device_scalars && real_alpha)
+        std::memcpy(&alpha_host, alpha, sizeof(real));
+    else if(!device_scalars)
+        std::memcpy(&alpha_host, alpha, sizeof(T));
+
+    hipLaunchKernelGGL(rank_update_kernel<T>,
+                       dim3((desc.m - 1) / MATRIX_DIM_X + 1,
+                            (desc.n - 1) / MATRIX_DIM_Y + 1,
+                            std::min(batch_count, MAX_GRID_BATCH)),
+                       dim3(MATRIX_DIM_X, MATRIX_DIM_Y),
+                       0,
+                       stream,
+                       desc,
+                       alpha_host,
+                       device_scalars ? alpha : nullptr,
+                       real_alpha,
+                       x,
+                       incx,
+                       y,
+                       incy,
+                       conj_y,
+                       A,
+                       batch_count);
+    return hipGetLastError();
+}
+
+// clang-format off
+template hipError_t hipblas_matvec_batched<float>(hipStream_t, const hipblas_matrix_desc&, const float*, const float*, bool, int64_t, hipblas_batched_operand<const float>, hipblas_batched_operand<const float>, int64_t, hipblas_batched_operand<float>, int64_t, int);
+template hipError_t hipblas_matvec_batched<double>(hipStream_t, const hipblas_matrix_desc&, const double*, const double*, bool, int64_t, hipblas_batched_operand<const double>, hipblas_batched_operand<const double>, int64_t, hipblas_batched_operand<double>, int64_t, int);
+template hipError_t hipblas_matvec_batched<hipblasComplex>(hipStream_t, const hipblas_matrix_desc&, const hipblasComplex*, const hipblasComplex*, bool, int64_t, hipblas_batched_operand<const hipblasComplex>, hipblas_batched_operand<const hipblasComplex>, int64_t, hipblas_batched_operand<hipblasComplex>, int64_t, int);
+template hipError_t hipblas_matvec_batched<hipblasDoubleComplex>(hipStream_t, const hipblas_matrix_desc&, const hipblasDoubleComplex*, const hipblasDoubleComplex*, bool, int64_t, hipblas_batched_operand<const hipblasDoubleComplex>, hipblas_batched_operand<const hipblasDoubleComplex>, int64_t, hipblas_batched_operand<hipblasDoubleComplex>, int64_t, int);
+template hipError_t hipblas_triangular_batched<float>(hipStream_t, const hipblas_matrix_desc&, bool, hipblas_batched_operand<const float>, hipblas_batched_operand<float>, int64_t, int);
+template hipError_t hipblas_triangular_batched<double>(hipStream_t, const hipblas_matrix_desc&, bool, hipblas_batched_operand<const double>, hipblas_batched_operand<double>, int64_t, int);
+template hipError_t hipblas_triangular_batched<hipblasComplex>(hipStream_t, const hipblas_matrix_desc&, bool, hipblas_batched_operand<const hipblasComplex>, hipblas_batched_operand<hipblasComplex>, int64_t, int);
+template hipError_t hipblas_triangular_batched<hipblasDoubleComplex>(hipStream_t, const hipblas_matrix_desc&, bool, hipblas_batched_operand<const hipblasDoubleComplex>, hipblas_batched_operand<hipblasDoubleComplex>, int64_t, int);
+template hipError_t hipblas_rank_update_batched<float>(hipStream_t, const hipblas_matrix_desc&, const void*, bool, bool, hipblas_batched_operand<const float>, int64_t, hipblas_batched_operand<const float>, int64_t, bool, hipblas_batched_operand<float>, int);
+template hipError_t hipblas_rank_update_batched<double>(hipStream_t, const hipblas_matrix_desc&, const void*, bool, bool, hipblas_batched_operand<const double>, int64_t, hipblas_batched_operand<const double>, int64_t, bool, hipblas_batched_operand<double>, int);
+template hipError_t hipblas_rank_update_batched<hipblasComplex>(hipStream_t, const hipblas_matrix_desc&, const void*, bool, bool, hipblas_batched_operand<const hipblasComplex>, int64_t, hipblas_batched_operand<const hipblasComplex>, int64_t, bool, hipblas_batched_operand<hipblasComplex>, int);
+template hipError_t hipblas_rank_update_batched<hipblasDoubleComplex>(hipStream_t, const hipblas_matrix_desc&, const void*, bool, bool, hipblas_batched_operand<const hipblasDoubleComplex>, int64_t, hipblas_batched_operand<const hipblasDoubleComplex>, int64_t, bool, hipblas_batched_operand<hipblasDoubleComplex>, int);
+// clang-format on
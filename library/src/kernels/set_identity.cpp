@@ -0,0 +1,104 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "hipblas_kernels.h"
+#include <algorithm>
+#include <hip/hip_runtime.h>
+
+namespace
+{
+    constexpr int MATRIX_DIM_X = 32;
+    constexpr int MATRIX_DIM_Y = 8;
+
+    constexpr int MAX_GRID_BATCH = 65535;
+
+    // hipblasComplex has no device constructors, so zero and one are built on the host
+    template <typename T>
+    __global__ void set_identity_strided_batched_kernel(
+        int n, T* A, int64_t lda, int64_t stride, int batch_count, T zero, T one)
+    {
+        int i = blockIdx.x * blockDim.x + threadIdx.x;
+        int j = blockIdx.y * blockDim.y + threadIdx.y;
+        if(i >= n || j >= n)
+            return;
+
+        for(int b = blockIdx.z; b < batch_count; b += gridDim.z)
+            A[b * stride + i + j * lda] = i == j ? one : zero;
+    }
+
+    template <typename T>
+    __global__ void set_identity_batched_kernel(
+        int n, T* const A[], int64_t lda, int batch_count, T zero, T one)
+    {
+        int i = blockIdx.x * blockDim.x + threadIdx.x;
+        int j = blockIdx.y * blockDim.y + threadIdx.y;
+        if(i >= n || j >= n)
+            return;
+
+        for(int b = blockIdx.z; b < batch_count; b += gridDim.z)
+            A[b][i + j * lda] = i == j ? one : zero;
+    }
+
+    dim3 identity_grid(int n, int batch_count)
+    {
+        return dim3((n - 1) / MATRIX_DIM_X + 1,
+                    (n - 1) / MATRIX_DIM_Y + 1,
+                    std::min(batch_count, MAX_GRID_BATCH));
+    }
+}
+
+template <typename T>
+hipError_t hipblas_set_identity_strided_batched(
+    hipStream_t stream, int n, T* A, int64_t lda, int64_t stride, int batch_count)
+{
+    if(n <= 0 || batch_count <= 0)
+        return hipSuccess;
+
+    hipLaunchKernelGGL(set_identity_strided_batched_kernel<T>,
+                       identity_grid(n, batch_count),
+                       dim3(MATRIX_DIM_X, MATRIX_DIM_Y),
+                       0,
+                       stream,
+                       n,
+                       A,
+                       lda,
+                       stride,
+                       batch_count,
+                       T(0),
+                       T(1));
+    return hipGetLastError();
+}
+
+template <typename T>
+hipError_t hipblas_set_identity_batched(
+    hipStream_t stream, int n, T* const A[], int64_t lda, int batch_count)
+{
+    if(n <= 0 || batch_count <= 0)
+        return hipSuccess;
+
+    hipLaunchKernelGGL(set_identity_batched_kernel<T>,
+                       identity_grid(n, batch_count),
+                       dim3(MATRIX_DIM_X, MATRIX_DIM_Y),
+                       0,
+                       stream,
+                       n,
+                       A,
+                       lda,
+                       batch_count,
+                       T(0),
+                       T(1));
+    return hipGetLastError();
+}
+
+// clang-format off
+template hipError_t hipblas_set_identity_strided_batched<float>(hipStream_t, int, float*, int64_t, int64_t, int);
+template hipError_t hipblas_set_identity_strided_batched<double>(hipStream_t, int, double*, int64_t, int64_t, int);
+template hipError_t hipblas_set_identity_strided_batched<hipblasComplex>(hipStream_t, int, hipblasComplex*, int64_t, int64_t, int);
+template hipError_t hipblas_set_identity_strided_batched<hipblasDoubleComplex>(hipStream_t, int, hipblasDoubleComplex*, int64_t, int64_t, int);
+template hipError_t hipblas_set_identity_batched<float>(hipStream_t, int, float* const[], int64_t, int);
+template hipError_t hipblas_set_identity_batched<double>(hipStream_t, int, double* const[], int64_t, int);
+template hipError_t hipblas_set_identity_batched<hipblasComplex>(hipStream_t, int, hipblasComplex* const[], int64_t, int);
+template hipError_t hipblas_set_identity_batched<hipblasDoubleComplex>(hipStream_t, int, hipblasDoubleComplex* const[], int64_t, int);
+// clang-format on
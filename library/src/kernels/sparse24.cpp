@@ -0,0 +1,318 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "hipblas_kernels.h"
+#include <algorithm>
+#include <hip/hip_fp16.h>
+#include <hip/hip_runtime.h>
+
+namespace
+{
+    constexpr int SPARSE_BLOCK = 256;
+    constexpr int MAX_GRID     = 65535;
+
+    // Each gemm block computes one SPARSE_TILE x SPARSE_TILE tile of C, stepping through k
+    // SPARSE_DEPTH at a time, of which A holds SPARSE_DEPTH / 2 values per row
+    constexpr int SPARSE_TILE   = 16;
+    constexpr int SPARSE_DEPTH  = 64;
+    constexpr int SPARSE_GROUPS = SPARSE_DEPTH / 4;
+
+    __device__ float to_float(hipblasHalf x)
+    {
+        return __half2float(__ushort_as_half(x));
+    }
+
+    __device__ float to_float(hipblasBfloat16 x)
+    {
+        return __uint_as_float(uint32_t(x.data) << 16);
+    }
+
+    __device__ float to_float(float x)
+    {
+        return x;
+    }
+
+    // Round to nearest even, keeping NaNs quiet
+    __device__ hipblasBfloat16 float_to_bfloat16(float x)
+    {
+        uint32_t u = __float_as_uint(x);
+        if((u & 0x7fffffff) > 0x7f800000)
+            return {uint16_t((u >> 16) | 0x40)};
+        u += 0x7fff + ((u >> 16) & 1);
+        return {uint16_t(u >> 16)};
+    }
+
+    __device__ float load(const void* X, hipblasDatatype_t type, int64_t i)
+    {
+        if(type == HIPBLAS_R_16F)
+            return to_float(static_cast<const hipblasHalf*>(X)[i]);
+        if(type == HIPBLAS_R_16B)
+            return to_float(static_cast<const hipblasBfloat16*>(X)[i]);
+        return static_cast<const float*>(X)[i];
+    }
+
+    __device__ void store(void* X, hipblasDatatype_t type, int64_t i, float v)
+    {
+        if(type == HIPBLAS_R_16F)
+            static_cast<hipblasHalf*>(X)[i] = __half_as_ushort(__float2half(v));
+        else if(type == HIPBLAS_R_16B)
+            static_cast<hipblasBfloat16*>(X)[i] = float_to_bfloat16(v);
+        else
+            static_cast<float*>(X)[i] = v;
+    }
+
+    // One thread per group of four along a row of op(A); the stored values are copied, not
+    // converted, so a group already 2:4 sparse survives bit for bit
+    template <typename T>
+    __global__ __launch_bounds__(SPARSE_BLOCK) void sparse24_compress_kernel(int64_t  groups,
+                                                                             int      m,
+                                                                             bool     trans,
+                                                                             const T* A,
+                                                                             int64_t  lda,
+                                                                             T*       P,
+                                                                             int64_t  ldp,
+                                                                             T*       values,
+                                                                             int64_t  ldv,
+                                                                             uint8_t* meta,
+                                                                             int64_t  ldm)
+    {
+        for(int64_t t = blockIdx.x * int64_t(blockDim.x) + threadIdx.x; t < groups;
+            t += int64_t(gridDim.x) * blockDim.x)
+        {
+            int64_t i = t % m;
+            int64_t g = t / m;
+
+            T     x[4];
+            float mag[4];
+            for(int r = 0; r < 4; r++)
+            {
+                int64_t l = 4 * g + r;
+                x[r]      = trans ? A[l + i * lda] : A[i + l * lda];
+                mag[r]    = fabsf(to_float(x[r]));
+            }
+
+            // The two largest magnitudes, the lower position first among equals
+            int first = 0;
+            for(int r = 1; r < 4; r++)
+                if(mag[r] > mag[first])
+                    first = r;
+            int second = first == 0 ? 1 : 0;
+            for(int r = second + 1; r < 4; r++)
+                if(r != first && mag[r] > mag[second])
+                    second = r;
+            int lo = std::min(first, second);
+            int hi = std::max(first, second);
+
+            if(P)
+                for(int r = 0; r < 4; r++)
+                    P[i + (4 * g + r) * ldp] = r == lo || r == hi ? x[r] : T{};
+            if(values)
+            {
+                values[i + 2 * g * ldv]       = x[lo];
+                values[i + (2 * g + 1) * ldv] = x[hi];
+                meta[i + g * ldm]             = uint8_t(lo | hi << 2);
+            }
+        }
+    }
+
+    struct sparse_args
+    {
+        int               m;
+        int               n;
+        int               k;
+        float             alpha;
+        float             beta;
+        const float*      alpha_dev;
+        const float*      beta_dev;
+        const void*       values;
+        int64_t           ldv;
+        const uint8_t*    meta;
+        int64_t           ldm;
+        const void*       B;
+        int64_t           ldb;
+        void*             C;
+        hipblasDatatype_t c_type;
+        int64_t           ldc;
+    };
+
+    // Thread (tx, ty) sums C(i, j) over the two kept values of each group, indexing the dense B
+    // tile by the metadata. The scalars are the same for every thread, so the barriers under the
+    // zero alpha test stay uniform
+    template <typename T>
+    __global__ __launch_bounds__(SPARSE_TILE* SPARSE_TILE) void sparse24_gemm_kernel(
+        hipblasOperation_t transb, sparse_args p)
+    {
+        __shared__ float   a_tile[SPARSE_TILE][SPARSE_DEPTH / 2 + 1];
+        __shared__ uint8_t m_tile[SPARSE_TILE][SPARSE_GROUPS + 1];
+        __shared__ float   b_tile[SPARSE_TILE][SPARSE_DEPTH + 1];
+
+        int tx = threadIdx.x;
+        int ty = threadIdx.y;
+        int i  = blockIdx.x * SPARSE_TILE + tx;
+        int j  = blockIdx.y * SPARSE_TILE + ty;
+
+        const T* values = static_cast<const T*>(p.values);
+        const T* B      = static_cast<const T*>(p.B);
+
+        float alpha = p.alpha_dev ? *p.alpha_dev : p.alpha;
+        float beta  = p.beta_dev ? *p.beta_dev : p.beta;
+
+        float sum = 0;
+        if(alpha != 0)
+            for(int l0 = 0; l0 < p.k; l0 += SPARSE_DEPTH)
+            {
+                int g0 = l0 / 4;
+                for(int r = 0; r < SPARSE_DEPTH / 2; r += SPARSE_TILE)
+                {
+                    int64_t v = l0 / 2 + r + ty;
+                    a_tile[tx][r + ty]
+                        = i < p.m && v < p.k / 2 ? to_float(values[i + v * p.ldv]) : 0.0f;
+                }
+                m_tile[tx][ty] = i < p.m && g0 + ty < p.k / 4 ? p.meta[i + (g0 + ty) * p.ldm] : 0;
+
+                for(int r = 0; r < SPARSE_DEPTH; r += SPARSE_TILE)
+                {
+                    int64_t l = l0 + r + tx;
+                    float   b = 0;
+                    if(j < p.n && l < p.k)
+                        b = to_float(transb == HIPBLAS_OP_N ? B[l + j * p.ldb] : B[j + l * p.ldb]);
+                    b_tile[ty][r + tx] = b;
+                }
+                __syncthreads();
+
+                for(int g = 0; g < SPARSE_GROUPS; g++)
+                {
+                    int idx = m_tile[tx][g];
+                    sum += a_tile[tx][2 * g] * b_tile[ty][4 * g + (idx & 3)]
+                           + a_tile[tx][2 * g + 1] * b_tile[ty][4 * g + (idx >> 2)];
+                }
+                __syncthreads();
+            }
+
+        if(i < p.m && j < p.n)
+        {
+            int64_t c = i + j * p.ldc;
+            float   v = alpha * sum;
+            if(beta != 0)
+                v += beta * load(p.C, p.c_type, c);
+            store(p.C, p.c_type, c, v);
+        }
+    }
+
+    template <typename T>
+    hipError_t launch_compress(hipStream_t                    stream,
+                               hipblasOperation_t             trans,
+                               int                            m,
+                               int                            k,
+                               const void*                    A,
+                               int64_t                        lda,
+                               void*                          P,
+                               int64_t                        ldp,
+                               const hipblasSparse24Matrix_t* compressed)
+    {
+        int64_t groups = int64_t(m) * (k / 4);
+        int     blocks = int(std::min<int64_t>((groups - 1) / SPARSE_BLOCK + 1, MAX_GRID));
+        hipLaunchKernelGGL(sparse24_compress_kernel<T>,
+                           dim3(blocks),
+                           dim3(SPARSE_BLOCK),
+                           0,
+                           stream,
+                           groups,
+                           m,
+                           trans != HIPBLAS_OP_N,
+                           static_cast<const T*>(A),
+                           lda,
+                           static_cast<T*>(P),
+                           ldp,
+                           compressed ? static_cast<T*>(compressed->values) : nullptr,
+                           compressed ? compressed->ld_values : 0,
+                           compressed ? compressed->metadata : nullptr,
+                           compressed ? compressed->ld_metadata : 0);
+        return hipGetLastError();
+    }
+
+    template <typename T>
+    hipError_t launch_gemm(hipStream_t stream, hipblasOperation_t transb, const sparse_args& p)
+    {
+        hipLaunchKernelGGL(sparse24_gemm_kernel<T>,
+                           dim3((p.m - 1) / SPARSE_TILE + 1, (p.n - 1) / SPARSE_TILE + 1),
+                           dim3(SPARSE_TILE, SPARSE_TILE),
+                           0,
+                           stream,
+                           transb,
+                           p);
+        return hipGetLastError();
+    }
+}
+
+hipError_t hipblas_sparse24_compress(hipStream_t                    stream,
+                                     hipblasOperation_t             trans,
+                                     int                            m,
+                                     int                            k,
+                                     const void*                    A,
+                                     hipblasDatatype_t              type,
+                                     int64_t                        lda,
+                                     void*                          P,
+                                     int64_t                        ldp,
+                                     const hipblasSparse24Matrix_t* compressed)
+{
+    if(m <= 0 || k <= 0)
+        return hipSuccess;
+    switch(type)
+    {
+    case HIPBLAS_R_16F:
+        return launch_compress<hipblasHalf>(stream, trans, m, k, A, lda, P, ldp, compressed);
+    case HIPBLAS_R_16B:
+        return launch_compress<hipblasBfloat16>(stream, trans, m, k, A, lda, P, ldp, compressed);
+    default:
+        return launch_compress<float>(stream, trans, m, k, A, lda, P, ldp, compressed);
+    }
+}
+
+hipError_t hipblas_sparse24_gemm(hipStream_t                    stream,
+                                 hipblasOperation_t             transb,
+                                 int                            m,
+                                 int                            n,
+                                 int                            k,
+                                 const float*                   alpha,
+                                 const float*                   beta,
+                                 bool                           device_scalars,
+                                 const hipblasSparse24Matrix_t& A,
+                                 hipblasDatatype_t              a_type,
+                                 const void*                    B,
+                                 int64_t                        ldb,
+                                 void*                          C,
+                                 hipblasDatatype_t              c_type,
+                                 int64_t                        ldc)
+{
+    if(m <= 0 || n <= 0)
+        return hipSuccess;
+
+    sparse_args p = {m,
+                     n,
+                     k,
+                     device_scalars ? 0.0f : *alpha,
+                     device_scalars ? 0.0f : *beta,
+                     device_scalars ? alpha : nullptr,
+                     device_scalars ? beta : nullptr,
+                     A.values,
+                     A.ld_values,
+                     A.metadata,
+                     A.ld_metadata,
+                     B,
+                     ldb,
+                     C,
+                     c_type,
+                     ldc};
+    switch(a_type)
+    {
+    case HIPBLAS_R_16F:
+        return launch_gemm<hipblasHalf>(stream, transb, p);
+    case HIPBLAS_R_16B:
+        return launch_gemm<hipblasBfloat16>(stream, transb, p);
+    default:
+        return launch_gemm<float>(stream, transb, p);
+    }
+}
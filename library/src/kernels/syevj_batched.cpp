@@ -0,0 +1,324 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "hipblas_kernels.h"
+#include <algorithm>
+#include <hip/hip_runtime.h>
+#include <limits>
+
+namespace
+{
+    // One block of SYEVJ_N threads per matrix: thread t owns column t of A while rotating rows,
+    // row t of A and V while rotating columns, and pair t of each round's rotations
+    constexpr int SYEVJ_N = HIPBLAS_SYEVJ_SMALL_N;
+
+    constexpr int MAX_GRID_BATCH = 65535;
+
+    template <typename E>
+    struct arith
+    {
+        using real = E;
+        __device__ static E    make(real re) { return re; }
+        __device__ static real re(E a) { return a; }
+        __device__ static E    conj(E a) { return a; }
+        __device__ static E    mul(E a, E b) { return a * b; }
+        __device__ static E    axpby(real a, E x, real b, E y) { return a * x + b * y; }
+        __device__ static real abs(E a) { return a < 0 ? -a : a; }
+        __device__ static real abs2(E a) { return a * a; }
+        __device__ static E    scale(E a, real s) { return a * s; }
+    };
+
+    template <typename R>
+    struct arith<hip_complex_number<R>>
+    {
+        using E    = hip_complex_number<R>;
+        using real = R;
+        __device__ static E    make(real re) { return {re, 0}; }
+        __device__ static real re(E a) { return a.x; }
+        __device__ static E    conj(E a) { return {a.x, -a.y}; }
+        __device__ static E    mul(E a, E b)
+        {
+            return {a.x * b.x - a.y * b.y, a.x * b.y + a.y * b.x};
+        }
+        __device__ static E    axpby(real a, E x, real b, E y)
+        {
+            return {a * x.x + b * y.x, a * x.y + b * y.y};
+        }
+        // Scaled by the larger part, so squaring neither overflows nor underflows
+        __device__ static real abs(E a)
+        {
+            R x = a.x < 0 ? -a.x : a.x;
+            R y = a.y < 0 ? -a.y : a.y;
+            R m = x > y ? x : y;
+            if(m == 0)
+                return 0;
+            x /= m, y /= m;
+            return m * sqrt(x * x + y * y);
+        }
+        __device__ static real abs2(E a) { return a.x * a.x + a.y * a.y; }
+        __device__ static E    scale(E a, real s) { return {a.x * s, a.y * s}; }
+    };
+
+    template <typename E>
+    __device__ E* batch_at(hipblas_batched_operand<E> op, int b)
+    {
+        return op.array ? op.array[b] : op.ptr + b * op.stride;
+    }
+
+    // Sum of |a(i, j)|^2 over the whole matrix and over its off-diagonal part, each thread adding
+    // its column
+    template <typename E, typename R>
+    __device__ void
+        frobenius(const E (&a)[SYEVJ_N][SYEVJ_N + 1], int n, R* partial, R& total, R& off)
+    {
+        int t = threadIdx.x;
+        R   d = 0, o = 0;
+        if(t < n)
+        {
+            for(int i = 0; i < n; i++)
+                if(i == t)
+                    d += arith<E>::abs2(a[i][t]);
+                else
+                    o += arith<E>::abs2(a[i][t]);
+        }
+        partial[t]           = o;
+        partial[SYEVJ_N + t] = d;
+        __syncthreads();
+        if(t == 0)
+        {
+            R so = 0, sd = 0;
+            for(int i = 0; i < SYEVJ_N; i++)
+            {
+                so += partial[i];
+                sd += partial[SYEVJ_N + i];
+            }
+            partial[2 * SYEVJ_N]     = so;
+            partial[2 * SYEVJ_N + 1] = so + sd;
+        }
+        __syncthreads();
+        off   = partial[2 * SYEVJ_N];
+        total = partial[2 * SYEVJ_N + 1];
+        // partial is rewritten by the next call
+        __syncthreads();
+    }
+
+    // Parallel cyclic Jacobi: each sweep is m - 1 rounds of the round-robin pairing of the m
+    // (n rounded up to even) indices, and the n / 2 rotations of a round touch disjoint rows and
+    // columns, so they are applied together. Index n is a dummy when n is odd. Every thread of a
+    // block runs the same loops for the same n and off-norm, so the barriers stay uniform
+    template <typename E>
+    __global__ void syevj_kernel(bool                       vectors,
+                                 bool                       upper,
+                                 int                        n,
+                                 hipblas_batched_operand<E> A,
+                                 int64_t                    lda,
+                                 typename arith<E>::real    abstol,
+                                 typename arith<E>::real*   residual,
+                                 int                        max_sweeps,
+                                 int*                       n_sweeps,
+                                 typename arith<E>::real*   W,
+                                 int64_t                    strideW,
+                                 int*                       info,
+                                 int                        batch_count)
+    {
+        using R = typename arith<E>::real;
+
+        __shared__ E   a[SYEVJ_N][SYEVJ_N + 1];
+        __shared__ E   v[SYEVJ_N][SYEVJ_N + 1];
+        __shared__ R   cs[SYEVJ_N / 2], sn[SYEVJ_N / 2];
+        __shared__ E   ph[SYEVJ_N / 2];
+        __shared__ int pp[SYEVJ_N / 2], qq[SYEVJ_N / 2];
+        __shared__ R   partial[2 * SYEVJ_N + 2];
+
+        const R eps   = std::numeric_limits<R>::epsilon();
+        int     t     = threadIdx.x;
+        int     m     = n + (n & 1);
+        int     pairs = m / 2;
+        for(int b = blockIdx.z; b < batch_count; b += gridDim.z)
+        {
+            // The full Hermitian matrix from the stored triangle
+            E* ab = batch_at(A, b);
+            if(t < n)
+                for(int i = 0; i < n; i++)
+                {
+                    bool stored = upper ? i <= t : i >= t;
+                    E    x      = stored ? ab[i + t * lda] : arith<E>::conj(ab[t + i * lda]);
+                    a[i][t]     = i == t ? arith<E>::make(arith<E>::re(x)) : x;
+                    v[i][t]     = arith<E>::make(i == t ? 1 : 0);
+                }
+            __syncthreads();
+
+            R total, off;
+            frobenius(a, n, partial, total, off);
+            R tol = (abstol > 0 ? abstol : eps) * sqrt(total);
+
+            int sweeps = 0;
+            while(sqrt(off) > tol && sweeps < max_sweeps)
+            {
+                for(int r = 0; r < m - 1; r++)
+                {
+                    if(t < pairs)
+                    {
+                        int p = t == 0 ? m - 1 : (r + t) % (m - 1);
+                        int q = t == 0 ? r : (r - t + m - 1) % (m - 1);
+                        if(p > q)
+                        {
+                            int s = p;
+                            p     = q;
+                            q     = s;
+                        }
+                        pp[t] = q < n ? p : -1;
+                        qq[t] = q;
+                        if(q < n)
+                        {
+                            // The real rotation of the 2 x 2 block with a(p, q) turned to
+                            // |a(p, q)| by the phase e, as in LAPACK's dlaev2
+                            E apq = a[p][q];
+                            R g   = arith<E>::abs(apq);
+                            R c = 1, s = 0;
+                            E e = arith<E>::make(1);
+                            if(g != 0)
+                            {
+                                R app   = arith<E>::re(a[p][p]);
+                                R aqq   = arith<E>::re(a[q][q]);
+                                R theta = (aqq - app) / (2 * g);
+                                R at    = theta < 0 ? -theta : theta;
+                                R root  = at > 1 / eps ? at : sqrt(1 + theta * theta);
+                                R tn    = (theta < 0 ? -1 : 1) / (at + root);
+                                c       = 1 / sqrt(1 + tn * tn);
+                                s       = tn * c;
+                                e       = arith<E>::scale(apq, 1 / g);
+                            }
+                            cs[t] = c;
+                            sn[t] = s;
+                            ph[t] = e;
+                        }
+                    }
+                    __syncthreads();
+
+                    // A = U' A, with U(p, p) = U(q, q) = c, U(p, q) = s e, U(q, p) = -s conj(e)
+                    if(t < n)
+                        for(int i = 0; i < pairs; i++)
+                        {
+                            int p = pp[i], q = qq[i];
+                            if(p < 0)
+                                continue;
+                            E x     = a[p][t];
+                            E y     = a[q][t];
+                            a[p][t] = arith<E>::axpby(cs[i], x, -sn[i], arith<E>::mul(ph[i], y));
+                            a[q][t] = arith<E>::axpby(
+                                sn[i], arith<E>::mul(arith<E>::conj(ph[i]), x), cs[i], y);
+                        }
+                    __syncthreads();
+
+                    // A = A U and V = V U; a(p, q) is zero by construction
+                    if(t < n)
+                        for(int i = 0; i < pairs; i++)
+                        {
+                            int p = pp[i], q = qq[i];
+                            if(p < 0)
+                                continue;
+                            E e  = ph[i];
+                            E ec = arith<E>::conj(e);
+                            E x  = a[t][p];
+                            E y  = a[t][q];
+                            a[t][p] = arith<E>::axpby(cs[i], x, -sn[i], arith<E>::mul(ec, y));
+                            a[t][q] = arith<E>::axpby(sn[i], arith<E>::mul(e, x), cs[i], y);
+                            if(t == p)
+                                a[p][q] = arith<E>::make(0);
+                            if(t == q)
+                                a[q][p] = arith<E>::make(0);
+
+                            x       = v[t][p];
+                            y       = v[t][q];
+                            v[t][p] = arith<E>::axpby(cs[i], x, -sn[i], arith<E>::mul(ec, y));
+                            v[t][q] = arith<E>::axpby(sn[i], arith<E>::mul(e, x), cs[i], y);
+                        }
+                    __syncthreads();
+                }
+                sweeps++;
+                frobenius(a, n, partial, total, off);
+            }
+
+            if(t == 0)
+            {
+                residual[b] = sqrt(off);
+                n_sweeps[b] = sweeps;
+                info[b]     = sqrt(off) <= tol ? 0 : 1;
+            }
+
+            // Eigenvalues in ascending order, each thread placing its own by its rank
+            if(t < n)
+            {
+                R   d    = arith<E>::re(a[t][t]);
+                int rank = 0;
+                for(int j = 0; j < n; j++)
+                {
+                    R dj = arith<E>::re(a[j][j]);
+                    rank += dj < d || (dj == d && j < t);
+                }
+                W[b * strideW + rank] = d;
+                if(vectors)
+                    for(int i = 0; i < n; i++)
+                        ab[i + rank * lda] = v[i][t];
+            }
+
+            // The next batch reuses the shared arrays
+            __syncthreads();
+        }
+    }
+}
+
+template <typename T, typename R>
+hipError_t hipblas_syevj_batched(hipStream_t                stream,
+                                 bool                       vectors,
+                                 hipblasFillMode_t          uplo,
+                                 int                        n,
+                                 hipblas_batched_operand<T> A,
+                                 int64_t                    lda,
+                                 R                          abstol,
+                                 R*                         residual,
+                                 int                        max_sweeps,
+                                 int*                       n_sweeps,
+                                 R*                         W,
+                                 int64_t                    strideW,
+                                 int*                       info,
+                                 int                        batch_count)
+{
+    if(n > SYEVJ_N)
+        return hipErrorInvalidValue;
+    if(batch_count <= 0)
+        return hipSuccess;
+
+    dim3 grid(1, 1, std::min(batch_count, MAX_GRID_BATCH));
+    dim3 threads(SYEVJ_N);
+
+    hipLaunchKernelGGL(syevj_kernel<T>,
+                       grid,
+                       threads,
+                       0,
+                       stream,
+                       vectors,
+                       uplo == HIPBLAS_FILL_MODE_UPPER,
+                       n,
+                       A,
+                       lda,
+                       abstol,
+                       residual,
+                       max_sweeps,
+                       n_sweeps,
+                       W,
+                       strideW,
+                       info,
+                       batch_count);
+    return hipGetLastError();
+}
+
+// clang-format off
+template hipError_t hipblas_syevj_batched<float, float>(hipStream_t, bool, hipblasFillMode_t, int, hipblas_batched_operand<float>, int64_t, float, float*, int, int*, float*, int64_t, int*, int);
+template hipError_t hipblas_syevj_batched<double, double>(hipStream_t, bool, hipblasFillMode_t, int, hipblas_batched_operand<double>, int64_t, double, double*, int, int*, double*, int64_t, int*, int);
+template hipError_t hipblas_syevj_batched<hipblasComplex, float>(hipStream_t, bool, hipblasFillMode_t, int, hipblas_batched_operand<hipblasComplex>, int64_t, float, float*, int, int*, float*, int64_t, int*, int);
+template hipError_t hipblas_syevj_batched<hipblasDoubleComplex, double>(hipStream_t, bool, hipblasFillMode_t, int, hipblas_batched_operand<hipblasDoubleComplex>, int64_t, double, double*, int, int*, double*, int64_t, int*, int);
+// clang-format on
@@ -0,0 +1,213 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "hipblas_kernels.h"
+#include <algorithm>
+#include <hip/hip_runtime.h>
+
+namespace
+{
+    constexpr int COPY_DIM_X = 256;
+
+    constexpr int MATRIX_DIM_X = 32;
+    constexpr int MATRIX_DIM_Y = 8;
+
+    constexpr int MAX_GRID_BATCH = 65535;
+
+    // The blocks are copied as raw elements of their size; a complex element keeps its imaginary
+    // part in its upper half
+    struct bytes16
+    {
+        uint64_t lo;
+        uint64_t hi;
+    };
+
+    // No two-byte type is a complex syrk or herk result
+    __device__ void clear_imag(uint16_t&) {}
+
+    __device__ void clear_imag(uint32_t& x)
+    {
+        x &= 0xffffu;
+    }
+
+    __device__ void clear_imag(uint64_t& x)
+    {
+        x &= 0xffffffffu;
+    }
+
+    __device__ void clear_imag(bytes16& x)
+    {
+        x.hi = 0;
+    }
+
+    template <typename T>
+    __global__ void syrk_block_copy_kernel(bool                             lower,
+                                           bool                             upper,
+                                           int                              n,
+                                           hipblas_batched_operand<const T> src,
+                                           int64_t                          src_offset,
+                                           int64_t                          lds,
+                                           hipblas_batched_operand<T>       dst,
+                                           int64_t                          dst_offset,
+                                           int64_t                          ldd,
+                                           bool                             zero_diagonal_imag,
+                                           int                              batch_count)
+    {
+        int i = blockIdx.x * blockDim.x + threadIdx.x;
+        int j = blockIdx.y * blockDim.y + threadIdx.y;
+        if(i >= n || j >= n || (!lower && i > j) || (!upper && i < j))
+            return;
+
+        for(int b = blockIdx.z; b < batch_count; b += gridDim.z)
+        {
+            const T* s = src.array ? src.array[b] : src.ptr + b * src.stride;
+            T*       d = dst.array ? dst.array[b] : dst.ptr + b * dst.stride;
+            T        x = s[src_offset + i + j * lds];
+            if(zero_diagonal_imag && i == j)
+                clear_imag(x);
+            d[dst_offset + i + j * ldd] = x;
+        }
+    }
+
+    __global__ void offset_pointer_array_kernel(
+        const char* const* src, int64_t offset, const char** array, int batch_count)
+    {
+        int b = blockIdx.x * blockDim.x + threadIdx.x;
+        if(b < batch_count)
+            array[b] = src[b] + offset;
+    }
+
+    template <typename T>
+    hipError_t block_copy(hipStream_t                         stream,
+                          hipblasFillMode_t                   uplo,
+                          int                                 n,
+                          hipblas_batched_operand<const void> src,
+                          int64_t                             src_offset,
+                          int64_t                             lds,
+                          hipblas_batched_operand<void>       dst,
+                          int64_t                             dst_offset,
+                          int64_t                             ldd,
+                          bool                                zero_diagonal_imag,
+                          int                                 batch_count)
+    {
+        hipblas_batched_operand<const T> s{static_cast<const T*>(src.ptr),
+                                           src.stride,
+                                           reinterpret_cast<const T* const*>(src.array)};
+        hipblas_batched_operand<T>       d{
+            static_cast<T*>(dst.ptr), dst.stride, reinterpret_cast<T* const*>(dst.array)};
+
+        hipLaunchKernelGGL(syrk_block_copy_kernel<T>,
+                           dim3((n - 1) / MATRIX_DIM_X + 1,
+                                (n - 1) / MATRIX_DIM_Y + 1,
+                                std::min(batch_count, MAX_GRID_BATCH)),
+                           dim3(MATRIX_DIM_X, MATRIX_DIM_Y),
+                           0,
+                           stream,
+                           uplo != HIPBLAS_FILL_MODE_UPPER,
+                           uplo != HIPBLAS_FILL_MODE_LOWER,
+                           n,
+                           s,
+                           src_offset,
+                           lds,
+                           d,
+                           dst_offset,
+                           ldd,
+                           zero_diagonal_imag,
+                           batch_count);
+        return hipGetLastError();
+    }
+}
+
+hipError_t hipblas_syrk_block_copy(hipStream_t                         stream,
+                                   hipblasFillMode_t                   uplo,
+                                   int                                 n,
+                                   size_t                              elem_size,
+                                   hipblas_batched_operand<const void> src,
+                                   int64_t                             src_offset,
+                                   int64_t                             lds,
+                                   hipblas_batched_operand<void>       dst,
+                                   int64_t                             dst_offset,
+                                   int64_t                             ldd,
+                                   bool                                zero_diagonal_imag,
+                                   int                                 batch_count)
+{
+    if(n <= 0 || batch_count <= 0)
+        return hipSuccess;
+
+    switch(elem_size)
+    {
+    case 2:
+        return block_copy<uint16_t>(stream,
+                                    uplo,
+                                    n,
+                                    src,
+                                    src_offset,
+                                    lds,
+                                    dst,
+                                    dst_offset,
+                                    ldd,
+                                    zero_diagonal_imag,
+                                    batch_count);
+    case 4:
+        return block_copy<uint32_t>(stream,
+                                    uplo,
+                                    n,
+                                    src,
+                                    src_offset,
+                                    lds,
+                                    dst,
+                                    dst_offset,
+                                    ldd,
+                                    zero_diagonal_imag,
+                                    batch_count);
+    case 8:
+        return block_copy<uint64_t>(stream,
+                                    uplo,
+                                    n,
+                                    src,
+                                    src_offset,
+                                    lds,
+                                    dst,
+                                    dst_offset,
+                                    ldd,
+                                    zero_diagonal_imag,
+                                    batch_count);
+    case 16:
+        return block_copy<bytes16>(stream,
+                                   uplo,
+                                   n,
+                                   src,
+                                   src_offset,
+                                   lds,
+                                   dst,
+                                   dst_offset,
+                                   ldd,
+                                   zero_diagonal_imag,
+                                   batch_count);
+    default:
+        return hipErrorInvalidValue;
+    }
+}
+
+hipError_t hipblas_offset_pointer_array(hipStream_t        stream,
+                                        const void* const* src,
+                                        int64_t            offset,
+                                        const void**       array,
+                                        int                batch_count)
+{
+    if(batch_count <= 0)
+        return hipSuccess;
+
+    hipLaunchKernelGGL(offset_pointer_array_kernel,
+                       dim3((batch_count - 1) / COPY_DIM_X + 1),
+                       dim3(COPY_DIM_X),
+                       0,
+                       stream,
+                       reinterpret_cast<const char* const*>(src),
+                       offset,
+                       reinterpret_cast<const char**>(array),
+                       batch_count);
+    return hipGetLastError();
+}
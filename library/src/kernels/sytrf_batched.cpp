@@ -0,0 +1,486 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "hipblas_kernels.h"
+#include <algorithm>
+#include <hip/hip_runtime.h>
+
+namespace
+{
+    // One block per matrix. While factoring, one thread picks each pivot and makes its swaps, and
+    // thread t updates columns t, t + blockDim.x, ... Matrices up to SYTRF_N are factored in shared
+    // memory by SYTRF_N threads, larger ones in place by SYTRF_DIM, which also solve
+    constexpr int SYTRF_N   = HIPBLAS_SYTRF_SMALL_N;
+    constexpr int SYTRF_DIM = 256;
+
+    constexpr int MAX_GRID_BATCH = 65535;
+
+    template <typename E>
+    struct arith
+    {
+        using real = E;
+        __device__ static E    one() { return 1; }
+        __device__ static E    add(E a, E b) { return a + b; }
+        __device__ static E    sub(E a, E b) { return a - b; }
+        __device__ static E    mul(E a, E b) { return a * b; }
+        __device__ static E    div(E a, E b) { return a / b; }
+        __device__ static real abs1(E a) { return a < 0 ? -a : a; }
+    };
+
+    template <typename R>
+    struct arith<hip_complex_number<R>>
+    {
+        using E    = hip_complex_number<R>;
+        using real = R;
+        __device__ static E    one() { return {1, 0}; }
+        __device__ static E    add(E a, E b) { return {a.x + b.x, a.y + b.y}; }
+        __device__ static E    sub(E a, E b) { return {a.x - b.x, a.y - b.y}; }
+        __device__ static E    mul(E a, E b)
+        {
+            return {a.x * b.x - a.y * b.y, a.x * b.y + a.y * b.x};
+        }
+        __device__ static E    div(E a, E b)
+        {
+            R d = b.x * b.x + b.y * b.y;
+            return {(a.x * b.x + a.y * b.y) / d, (a.y * b.x - a.x * b.y) / d};
+        }
+        // |re| + |im|, the magnitude LAPACK pivots on for complex matrices
+        __device__ static real abs1(E a)
+        {
+            return (a.x < 0 ? -a.x : a.x) + (a.y < 0 ? -a.y : a.y);
+        }
+    };
+
+    template <typename E>
+    __device__ E* batch_at(hipblas_batched_operand<E> op, int b)
+    {
+        return op.array ? op.array[b] : op.ptr + b * op.stride;
+    }
+
+    template <typename E>
+    __device__ void swap(E& x, E& y)
+    {
+        E s = x;
+        x   = y;
+        y   = s;
+    }
+
+    // The lower triangle of A is the upper triangle of A with its rows and columns reversed, and
+    // LAPACK's lower sytrf and sytrs are its upper ones on that, so both run the upper algorithm
+    // on indices mapped by r. With cols unset only the rows of a right-hand side are reversed
+    template <typename E>
+    struct mirrored
+    {
+        E*      a;
+        int64_t ld;
+        int     n;
+        bool    upper;
+        bool    cols;
+
+        __device__ int r(int i) const { return upper ? i : n - 1 - i; }
+        __device__ E&  operator()(int i, int j) const { return a[r(i) + (cols ? r(j) : j) * ld]; }
+    };
+
+    // LAPACK's sytf2: A = U D U^T by Bunch-Kaufman pivoting, k running down from n - 1, with D
+    // made of 1 x 1 and 2 x 2 blocks. The growth bound alpha = (1 + sqrt(17)) / 8 decides between
+    // them. Every thread runs the same loop over the same pivots, so the barriers stay uniform
+    template <typename E>
+    __global__ void sytrf_kernel(bool                       upper,
+                                 int                        n,
+                                 hipblas_batched_operand<E> A,
+                                 int64_t                    lda,
+                                 int*                       ipiv,
+                                 int64_t                    strideP,
+                                 int*                       info,
+                                 int                        batch_count)
+    {
+        using real = typename arith<E>::real;
+
+        __shared__ E    s[SYTRF_N * (SYTRF_N + 1)];
+        __shared__ int  step_size, singular;
+        __shared__ bool step_zero;
+
+        const real alpha = (1 + sqrt(real(17))) / 8;
+        const E    one   = arith<E>::one();
+
+        int  t         = threadIdx.x;
+        int  nt        = blockDim.x;
+        bool in_shared = n <= SYTRF_N;
+        for(int b = blockIdx.z; b < batch_count; b += gridDim.z)
+        {
+            E*      ab = batch_at(A, b);
+            E*      a  = ab;
+            int64_t ld = lda;
+            if(in_shared)
+            {
+                for(int e = t; e < n * n; e += nt)
+                    s[e % n + (e / n) * (SYTRF_N + 1)] = ab[e % n + (e / n) * lda];
+                a  = s;
+                ld = SYTRF_N + 1;
+            }
+            if(t == 0)
+                singular = 0;
+            __syncthreads();
+
+            mirrored<E> m{a, ld, n, upper, true};
+            int*        pv = ipiv + b * strideP;
+            for(int k = n - 1; k >= 0;)
+            {
+                if(t == 0)
+                {
+                    // Taking the last of equal candidates in the mirrored order takes the first in
+                    // LAPACK's, as its idamax does
+                    real absakk = arith<E>::abs1(m(k, k));
+                    real colmax = 0;
+                    int  imax   = 0;
+                    for(int i = 0; i < k; i++)
+                    {
+                        real v = arith<E>::abs1(m(i, k));
+                        if(v > colmax || (!upper && v == colmax))
+                        {
+                            colmax = v;
+                            imax   = i;
+                        }
+                    }
+
+                    int  kp    = k;
+                    int  kstep = 1;
+                    bool zero  = absakk != absakk || (absakk == 0 && colmax == 0);
+                    if(zero)
+                    {
+                        if(singular == 0)
+                            singular = m.r(k) + 1;
+                    }
+                    else if(absakk < alpha * colmax)
+                    {
+                        real rowmax = 0;
+                        for(int j = imax + 1; j <= k; j++)
+                            rowmax = std::max(rowmax, arith<E>::abs1(m(imax, j)));
+                        for(int i = 0; i < imax; i++)
+                            rowmax = std::max(rowmax, arith<E>::abs1(m(i, imax)));
+
+                        if(absakk >= alpha * colmax * (colmax / rowmax))
+                            kp = k;
+                        else if(arith<E>::abs1(m(imax, imax)) >= alpha * rowmax)
+                            kp = imax;
+                        else
+                        {
+                            kp    = imax;
+                            kstep = 2;
+                        }
+                    }
+
+                    // Rows and columns kk and kp of the leading k + 1 swapped
+                    int kk = k - kstep + 1;
+                    if(kp != kk)
+                    {
+                        for(int i = 0; i < kp; i++)
+                            swap(m(i, kk), m(i, kp));
+                        for(int j = kp + 1; j < kk; j++)
+                            swap(m(j, kk), m(kp, j));
+                        swap(m(kk, kk), m(kp, kp));
+                        if(kstep == 2)
+                            swap(m(k - 1, k), m(kp, k));
+                    }
+
+                    if(kstep == 1)
+                        pv[m.r(k)] = m.r(kp) + 1;
+                    else
+                        pv[m.r(k)] = pv[m.r(k - 1)] = -(m.r(kp) + 1);
+
+                    step_size = kstep;
+                    step_zero = zero;
+                }
+                __syncthreads();
+
+                int kstep = step_size;
+                if(kstep == 1 && !step_zero)
+                {
+                    // A(0:k-1, 0:k-1) -= x x^T / D(k) with x = A(0:k-1, k), then x /= D(k)
+                    E r1 = arith<E>::div(one, m(k, k));
+                    for(int j = t; j < k; j += nt)
+                    {
+                        E xj = arith<E>::mul(r1, m(j, k));
+                        for(int i = 0; i <= j; i++)
+                            m(i, j) = arith<E>::sub(m(i, j), arith<E>::mul(m(i, k), xj));
+                    }
+                    __syncthreads();
+                    for(int j = t; j < k; j += nt)
+                        m(j, k) = arith<E>::mul(m(j, k), r1);
+                }
+                else if(kstep == 2 && k > 1)
+                {
+                    // A(0:k-2, 0:k-2) -= W D^-1 W^T with W = A(0:k-2, k-1:k), then W = W D^-1.
+                    // The columns of W are only written after every update has read them, so
+                    // each thread works its multipliers out again
+                    E d12 = m(k - 1, k);
+                    E d22 = arith<E>::div(m(k - 1, k - 1), d12);
+                    E d11 = arith<E>::div(m(k, k), d12);
+                    E tt  = arith<E>::div(one, arith<E>::sub(arith<E>::mul(d11, d22), one));
+                    d12   = arith<E>::div(tt, d12);
+                    auto multipliers = [&](int j, E& wkm1, E& wk) {
+                        wkm1 = arith<E>::mul(
+                            d12, arith<E>::sub(arith<E>::mul(d11, m(j, k - 1)), m(j, k)));
+                        wk = arith<E>::mul(
+                            d12, arith<E>::sub(arith<E>::mul(d22, m(j, k)), m(j, k - 1)));
+                    };
+                    for(int j = t; j < k - 1; j += nt)
+                    {
+                        E wkm1, wk;
+                        multipliers(j, wkm1, wk);
+                        for(int i = 0; i <= j; i++)
+                            m(i, j) = arith<E>::sub(
+                                m(i, j),
+                                arith<E>::add(arith<E>::mul(m(i, k), wk),
+                                              arith<E>::mul(m(i, k - 1), wkm1)));
+                    }
+                    __syncthreads();
+                    for(int j = t; j < k - 1; j += nt)
+                    {
+                        E wkm1, wk;
+                        multipliers(j, wkm1, wk);
+                        m(j, k)     = wk;
+                        m(j, k - 1) = wkm1;
+                    }
+                }
+                __syncthreads();
+                k -= kstep;
+            }
+
+            // Only the factored triangle goes back
+            if(in_shared)
+                for(int e = t; e < n * n; e += nt)
+                {
+                    int i = e % n;
+                    int j = e / n;
+                    if(upper ? i <= j : i >= j)
+                        ab[i + j * lda] = s[i + j * (SYTRF_N + 1)];
+                }
+            if(t == 0)
+                info[b] = singular;
+
+            // The next batch reuses s and the step
+            __syncthreads();
+        }
+    }
+
+    // LAPACK's sytrs: U D X = B from k = n - 1 down, then U^T X = B from k = 0 up, with each
+    // pivot's swap. The rank-one updates spread over the rows and right-hand sides the block, and
+    // the dot products of the transposed solve reduce over the block
+    template <typename E>
+    __global__ void sytrs_kernel(bool                       upper,
+                                 int                        n,
+                                 int                        nrhs,
+                                 hipblas_batched_operand<E> A,
+                                 int64_t                    lda,
+                                 const int*                 ipiv,
+                                 int64_t                    strideP,
+                                 hipblas_batched_operand<E> B,
+                                 int64_t                    ldb,
+                                 int                        batch_count)
+    {
+        __shared__ E partial[2][SYTRF_DIM];
+
+        const E one  = arith<E>::one();
+        const E zero = arith<E>::sub(one, one);
+
+        int t = threadIdx.x;
+        for(int b = blockIdx.z; b < batch_count; b += gridDim.z)
+        {
+            mirrored<E> a{batch_at(A, b), lda, n, upper, true};
+            mirrored<E> x{batch_at(B, b), ldb, n, upper, false};
+            const int*  pv = ipiv + b * strideP;
+
+            auto swap_rows = [&](int p, int q) {
+                if(p != q)
+                    for(int j = t; j < nrhs; j += SYTRF_DIM)
+                        swap(x(p, j), x(q, j));
+                __syncthreads();
+            };
+
+            // x(0:hi-1, :) -= a(0:hi-1, c) x(c, :), and likewise for d when it is set
+            auto update = [&](int hi, int c, int d) {
+                for(int e = t; e < hi * nrhs; e += SYTRF_DIM)
+                {
+                    int i = e % hi;
+                    int j = e / hi;
+                    E   v = arith<E>::sub(x(i, j), arith<E>::mul(a(i, c), x(c, j)));
+                    if(d >= 0)
+                        v = arith<E>::sub(v, arith<E>::mul(a(i, d), x(d, j)));
+                    x(i, j) = v;
+                }
+                __syncthreads();
+            };
+
+            // x(c, :) -= a(0:hi-1, c)^T x(0:hi-1, :), and likewise for d when it is set
+            auto dot = [&](int hi, int c, int d) {
+                for(int j = 0; j < nrhs; j++)
+                {
+                    E sc = zero, sd = zero;
+                    for(int i = t; i < hi; i += SYTRF_DIM)
+                    {
+                        sc = arith<E>::add(sc, arith<E>::mul(a(i, c), x(i, j)));
+                        if(d >= 0)
+                            sd = arith<E>::add(sd, arith<E>::mul(a(i, d), x(i, j)));
+                    }
+                    partial[0][t] = sc;
+                    partial[1][t] = sd;
+                    __syncthreads();
+                    for(int s = SYTRF_DIM / 2; s > 0; s /= 2)
+                    {
+                        if(t < s)
+                        {
+                            partial[0][t] = arith<E>::add(partial[0][t], partial[0][t + s]);
+                            partial[1][t] = arith<E>::add(partial[1][t], partial[1][t + s]);
+                        }
+                        __syncthreads();
+                    }
+                    if(t == 0)
+                    {
+                        x(c, j) = arith<E>::sub(x(c, j), partial[0][0]);
+                        if(d >= 0)
+                            x(d, j) = arith<E>::sub(x(d, j), partial[1][0]);
+                    }
+                    __syncthreads();
+                }
+            };
+
+            for(int k = n - 1; k >= 0;)
+            {
+                int v = pv[a.r(k)];
+                if(v > 0)
+                {
+                    swap_rows(k, a.r(v - 1));
+                    update(k, k, -1);
+                    for(int j = t; j < nrhs; j += SYTRF_DIM)
+                        x(k, j) = arith<E>::div(x(k, j), a(k, k));
+                    __syncthreads();
+                    k -= 1;
+                }
+                else
+                {
+                    swap_rows(k - 1, a.r(-v - 1));
+                    update(k - 1, k, k - 1);
+
+                    // The 2 x 2 block of D, scaled by its off-diagonal entry
+                    E akm1k = a(k - 1, k);
+                    E akm1  = arith<E>::div(a(k - 1, k - 1), akm1k);
+                    E ak    = arith<E>::div(a(k, k), akm1k);
+                    E denom = arith<E>::sub(arith<E>::mul(akm1, ak), one);
+                    for(int j = t; j < nrhs; j += SYTRF_DIM)
+                    {
+                        E bkm1      = arith<E>::div(x(k - 1, j), akm1k);
+                        E bk        = arith<E>::div(x(k, j), akm1k);
+                        E xkm1      = arith<E>::sub(arith<E>::mul(ak, bkm1), bk);
+                        E xk        = arith<E>::sub(arith<E>::mul(akm1, bk), bkm1);
+                        x(k - 1, j) = arith<E>::div(xkm1, denom);
+                        x(k, j)     = arith<E>::div(xk, denom);
+                    }
+                    __syncthreads();
+                    k -= 2;
+                }
+            }
+
+            for(int k = 0; k < n;)
+            {
+                int v = pv[a.r(k)];
+                if(v > 0)
+                {
+                    dot(k, k, -1);
+                    swap_rows(k, a.r(v - 1));
+                    k += 1;
+                }
+                else
+                {
+                    dot(k, k, k + 1);
+                    swap_rows(k, a.r(-v - 1));
+                    k += 2;
+                }
+            }
+        }
+    }
+}
+
+template <typename T>
+hipError_t hipblas_sytrf_batched(hipStream_t                stream,
+                                 hipblasFillMode_t          uplo,
+                                 int                        n,
+                                 hipblas_batched_operand<T> A,
+                                 int64_t                    lda,
+                                 int*                       ipiv,
+                                 int64_t                    strideP,
+                                 int*                       info,
+                                 int                        batch_count)
+{
+    if(batch_count <= 0)
+        return hipSuccess;
+
+    dim3 grid(1, 1, std::min(batch_count, MAX_GRID_BATCH));
+    dim3 threads(n <= SYTRF_N ? SYTRF_N : SYTRF_DIM);
+
+    hipLaunchKernelGGL(sytrf_kernel<T>,
+                       grid,
+                       threads,
+                       0,
+                       stream,
+                       uplo == HIPBLAS_FILL_MODE_UPPER,
+                       n,
+                       A,
+                       lda,
+                       ipiv,
+                       strideP,
+                       info,
+                       batch_count);
+    return hipGetLastError();
+}
+
+template <typename T>
+hipError_t hipblas_sytrs_batched(hipStream_t                stream,
+                                 hipblasFillMode_t          uplo,
+                                 int                        n,
+                                 int                        nrhs,
+                                 hipblas_batched_operand<T> A,
+                                 int64_t                    lda,
+                                 const int*                 ipiv,
+                                 int64_t                    strideP,
+                                 hipblas_batched_operand<T> B,
+                                 int64_t                    ldb,
+                                 int                        batch_count)
+{
+    if(batch_count <= 0 || n == 0 || nrhs == 0)
+        return hipSuccess;
+
+    dim3 grid(1, 1, std::min(batch_count, MAX_GRID_BATCH));
+    dim3 threads(SYTRF_DIM);
+
+    hipLaunchKernelGGL(sytrs_kernel<T>,
+                       grid,
+                       threads,
+                       0,
+                       stream,
+                       uplo == HIPBLAS_FILL_MODE_UPPER,
+                       n,
+                       nrhs,
+                       A,
+                       lda,
+                       ipiv,
+                       strideP,
+                       B,
+                       ldb,
+                       batch_count);
+    return hipGetLastError();
+}
+
+// clang-format off
+template hipError_t hipblas_sytrf_batched<float>(hipStream_t, hipblasFillMode_t, int, hipblas_batched_operand<float>, int64_t, int*, int64_t, int*, int);
+template hipError_t hipblas_sytrf_batched<double>(hipStream_t, hipblasFillMode_t, int, hipblas_batched_operand<double>, int64_t, int*, int64_t, int*, int);
+template hipError_t hipblas_sytrf_batched<hipblasComplex>(hipStream_t, hipblasFillMode_t, int, hipblas_batched_operand<hipblasComplex>, int64_t, int*, int64_t, int*, int);
+template hipError_t hipblas_sytrf_batched<hipblasDoubleComplex>(hipStream_t, hipblasFillMode_t, int, hipblas_batched_operand<hipblasDoubleComplex>, int64_t, int*, int64_t, int*, int);
+
+template hipError_t hipblas_sytrs_batched<float>(hipStream_t, hipblasFillMode_t, int, int, hipblas_batched_operand<float>, int64_t, const int*, int64_t, hipblas_batched_operand<float>, int64_t, int);
+template hipError_t hipblas_sytrs_batched<double>(hipStream_t, hipblasFillMode_t, int, int, hipblas_batched_operand<double>, int64_t, const int*, int64_t, hipblas_batched_operand<double>, int64_t, int);
+template hipError_t hipblas_sytrs_batched<hipblasComplex>(hipStream_t, hipblasFillMode_t, int, int, hipblas_batched_operand<hipblasComplex>, int64_t, const int*, int64_t, hipblas_batched_operand<hipblasComplex>, int64_t, int);
+template hipError_t hipblas_sytrs_batched<hipblasDoubleComplex>(hipStream_t, hipblasFillMode_t, int, int, hipblas_batched_operand<hipblasDoubleComplex>, int64_t, const int*, int64_t, hipblas_batched_operand<hipblasDoubleComplex>, int64_t, int);
+// clang-format on
@@ -0,0 +1,200 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "hipblas_kernels.h"
+#include <algorithm>
+#include <cstring>
+#include <hip/hip_runtime.h>
+
+namespace
+{
+    // Each block owns TRMM_TILE columns of B, or rows on the right side, and computes them a
+    // TRMM_TILE x TRMM_TILE tile at a time
+    constexpr int TRMM_TILE = 16;
+
+    constexpr int MAX_GRID_BATCH = 65535;
+
+    template <typename E>
+    struct arith
+    {
+        __device__ static E    zero() { return 0; }
+        __device__ static E    one() { return 1; }
+        __device__ static E    add(E a, E b) { return a + b; }
+        __device__ static E    mul(E a, E b) { return a * b; }
+        __device__ static E    conj(E a) { return a; }
+        __device__ static bool is_zero(E a) { return a == 0; }
+    };
+
+    template <typename R>
+    struct arith<hip_complex_number<R>>
+    {
+        using E = hip_complex_number<R>;
+        __device__ static E    zero() { return {0, 0}; }
+        __device__ static E    one() { return {1, 0}; }
+        __device__ static E    add(E a, E b) { return {a.x + b.x, a.y + b.y}; }
+        __device__ static E    mul(E a, E b) { return {a.x * b.x - a.y * b.y, a.x * b.y + a.y * b.x}; }
+        __device__ static E    conj(E a) { return {a.x, -a.y}; }
+        __device__ static bool is_zero(E a) { return a.x == 0 && a.y == 0; }
+    };
+
+    template <typename E>
+    __device__ E* batch_at(hipblas_batched_operand<E> op, int b)
+    {
+        return op.array ? op.array[b] : op.ptr + b * op.stride;
+    }
+
+    // op(A)(i, j) of the triangular A, zero outside its uplo triangle
+    template <typename E>
+    __device__ E triangle_element(hipblasFillMode_t  uplo,
+                                  hipblasOperation_t trans,
+                                  hipblasDiagType_t  diag,
+                                  const E*           A,
+                                  int64_t            lda,
+                                  int                i,
+                                  int                j)
+    {
+        int r = trans == HIPBLAS_OP_N ? i : j;
+        int c = trans == HIPBLAS_OP_N ? j : i;
+        if(uplo == HIPBLAS_FILL_MODE_UPPER ? r > c : r < c)
+            return arith<E>::zero();
+        if(r == c && diag == HIPBLAS_DIAG_UNIT)
+            return arith<E>::one();
+        E a = A[r + c * lda];
+        return trans == HIPBLAS_OP_C ? arith<E>::conj(a) : a;
+    }
+
+    // B = alpha * op(A) * B in place, the right side's B * op(A) taken as its transpose
+    // op(A)^T * B^T. A block sweeps the row tiles of its columns so that each tile is written only
+    // once no later tile reads it: away from the zero triangle of op(A), in which a row's update
+    // reads only rows below it for an upper op(A) and above it for a lower one. alpha is read
+    // through alpha_dev in device pointer mode, batch b's at alpha_dev[b * scalar_stride]
+    template <typename E>
+    __global__ void trmm_kernel(bool                             left,
+                                hipblasFillMode_t                uplo,
+                                hipblasOperation_t               trans,
+                                hipblasDiagType_t                diag,
+                                int                              m,
+                                int                              n,
+                                E                                alpha,
+                                const E*                         alpha_dev,
+                                int64_t                          scalar_stride,
+                                hipblas_batched_operand<const E> A,
+                                int64_t                          lda,
+                                hipblas_batched_operand<E>       B,
+                                int64_t                          ldb,
+                                int                              batch_count)
+    {
+        __shared__ E a_tile[TRMM_TILE][TRMM_TILE + 1];
+        __shared__ E b_tile[TRMM_TILE][TRMM_TILE + 1];
+
+        int     rows     = left ? m : n;
+        int     cols     = left ? n : m;
+        int64_t row_inc  = left ? 1 : ldb;
+        int64_t col_inc  = left ? ldb : 1;
+        bool    upper_op = (uplo == HIPBLAS_FILL_MODE_UPPER) == (trans == HIPBLAS_OP_N);
+        bool    upper    = left == upper_op;
+        int     tiles    = (rows - 1) / TRMM_TILE + 1;
+
+        int tx = threadIdx.x;
+        int ty = threadIdx.y;
+        int j  = blockIdx.x * TRMM_TILE + ty;
+
+        for(int b = blockIdx.y; b < batch_count; b += gridDim.y)
+        {
+            E        alpha_b = alpha_dev ? alpha_dev[b * scalar_stride] : alpha;
+            const E* a       = batch_at(A, b);
+            E*       bb      = batch_at(B, b);
+
+            for(int s = 0; s < tiles; s++)
+            {
+                int t  = upper ? s : tiles - 1 - s;
+                int i  = t * TRMM_TILE + tx;
+                int lo = upper ? t * TRMM_TILE : 0;
+                int hi = upper || (t + 1) * TRMM_TILE > rows ? rows : (t + 1) * TRMM_TILE;
+
+                // Every read of the tile's rows is done before the barrier ending the last step
+                E sum = arith<E>::zero();
+                if(!arith<E>::is_zero(alpha_b))
+                    for(int l0 = lo; l0 < hi; l0 += TRMM_TILE)
+                    {
+                        int l          = l0 + ty;
+                        a_tile[ty][tx] = arith<E>::zero();
+                        if(i < rows && l < hi)
+                            a_tile[ty][tx]
+                                = left ? triangle_element(uplo, trans, diag, a, lda, i, l)
+                                       : triangle_element(uplo, trans, diag, a, lda, l, i);
+                        b_tile[ty][tx] = l0 + tx < hi && j < cols
+                                             ? bb[(l0 + tx) * row_inc + j * col_inc]
+                                             : arith<E>::zero();
+                        __syncthreads();
+
+                        for(int q = 0; q < TRMM_TILE; q++)
+                            sum = arith<E>::add(sum, arith<E>::mul(a_tile[q][tx], b_tile[ty][q]));
+                        __syncthreads();
+                    }
+
+                if(i < rows && j < cols)
+                    bb[i * row_inc + j * col_inc] = arith<E>::mul(alpha_b, sum);
+            }
+        }
+    }
+}
+
+template <typename T>
+hipError_t hipblas_trmm_batched(hipStream_t                      stream,
+                                hipblasSideMode_t                side,
+                                hipblasFillMode_t                uplo,
+                                hipblasOperation_t               trans,
+                                hipblasDiagType_t                diag,
+                                int                              m,
+                                int                              n,
+                                const T*                         alpha,
+                                bool                             device_scalars,
+                                int64_t                          scalar_stride,
+                                hipblas_batched_operand<const T> A,
+                                int64_t                          lda,
+                                hipblas_batched_operand<T>       B,
+                                int64_t                          ldb,
+                                int                              batch_count)
+{
+    if(m <= 0 || n <= 0 || batch_count <= 0)
+        return hipSuccess;
+
+    bool left = side == HIPBLAS_SIDE_LEFT;
+    T    host_alpha{};
+    if(!device_scalars)
+        std::memcpy(&host_alpha, alpha, sizeof(T));
+
+    dim3 grid(((left ? n : m) - 1) / TRMM_TILE + 1, std::min(batch_count, MAX_GRID_BATCH));
+    dim3 threads(TRMM_TILE, TRMM_TILE);
+
+    hipLaunchKernelGGL(trmm_kernel<T>,
+                       grid,
+                       threads,
+                       0,
+                       stream,
+                       left,
+                       uplo,
+                       trans,
+                       diag,
+                       m,
+                       n,
+                       host_alpha,
+                       device_scalars ? alpha : nullptr,
+                       scalar_stride,
+                       A,
+                       lda,
+                       B,
+                       ldb,
+                       batch_count);
+    return hipGetLastError();
+}
+
+// clang-format off
+template hipError_t hipblas_trmm_batched<float>(hipStream_t, hipblasSideMode_t, hipblasFillMode_t, hipblasOperation_t, hipblasDiagType_t, int, int, const float*, bool, int64_t, hipblas_batched_operand<const float>, int64_t, hipblas_batched_operand<float>, int64_t, int);
+template hipError_t hipblas_trmm_batched<double>(hipStream_t, hipblasSideMode_t, hipblasFillMode_t, hipblasOperation_t, hipblasDiagType_t, int, int, const double*, bool, int64_t, hipblas_batched_operand<const double>, int64_t, hipblas_batched_operand<double>, int64_t, int);
+template hipError_t hipblas_trmm_batched<hipblasComplex>(hipStream_t, hipblasSideMode_t, hipblasFillMode_t, hipblasOperation_t, hipblasDiagType_t, int, int, const hipblasComplex*, bool, int64_t, hipblas_batched_operand<const hipblasComplex>, int64_t, hipblas_batched_operand<hipblasComplex>, int64_t, int);
+template hipError_t hipblas_trmm_batched<hipblasDoubleComplex>(hipStream_t, hipblasSideMode_t, hipblasFillMode_t, hipblasOperation_t, hipblasDiagType_t, int, int, const hipblasDoubleComplex*, bool, int64_t, hipblas_batched_operand<const hipblasDoubleComplex>, int64_t, hipblas_batched_operand<hipblasDoubleComplex>, int64_t, int);
+// clang-format on
@@ -0,0 +1,323 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "hipblas_kernels.h"
+#include <algorithm>
+#include <hip/hip_fp16.h>
+#include <hip/hip_runtime.h>
+
+namespace
+{
+    // Each thread owns one right-hand side, held in registers
+    constexpr int RHS_DIM_X = 64;
+
+    constexpr int MAX_GRID_BATCH = 65535;
+
+    // Round to nearest even, keeping NaNs quiet
+    __device__ hipblasBfloat16 float_to_bfloat16(float x)
+    {
+        uint32_t u = __float_as_uint(x);
+        if((u & 0x7fffffff) > 0x7f800000)
+            return {uint16_t((u >> 16) | 0x40)};
+        u += 0x7fff + ((u >> 16) & 1);
+        return {uint16_t(u >> 16)};
+    }
+
+    __device__ float load(float x)
+    {
+        return x;
+    }
+
+    __device__ float load(hipblasHalf x)
+    {
+        return __half2float(__ushort_as_half(x));
+    }
+
+    __device__ float load(hipblasBfloat16 x)
+    {
+        return __uint_as_float(uint32_t(x.data) << 16);
+    }
+
+    __device__ void store(float& y, float x)
+    {
+        y = x;
+    }
+
+    __device__ void store(hipblasHalf& y, float x)
+    {
+        y = __half_as_ushort(__float2half(x));
+    }
+
+    __device__ void store(hipblasBfloat16& y, float x)
+    {
+        y = float_to_bfloat16(x);
+    }
+
+    template <typename T>
+    __device__ T* batch_at(hipblas_batched_operand<T> op, int b)
+    {
+        return op.array ? op.array[b] : op.ptr + b * op.stride;
+    }
+
+    // Right-hand side r is column r of B on the left side and row r on the right, and its element
+    // i is M(i, :) x, M = op(A) on the left and op(A)^T on the right; lower is set when M is lower
+    // triangular. The nb x nb block of M is staged in shared memory as fp32, and each thread
+    // solves, or multiplies, its right-hand side in registers: x = alpha M^-1 x or alpha M x
+    template <typename T>
+    __global__ void trsm_mixed_diagonal_kernel(bool                             solve,
+                                               bool                             left,
+                                               bool                             lower,
+                                               hipblasFillMode_t                uplo,
+                                               hipblasOperation_t               trans,
+                                               hipblasDiagType_t                diag,
+                                               int                              nb,
+                                               int                              nrhs,
+                                               float                            alpha,
+                                               hipblas_batched_operand<const T> A,
+                                               int64_t                          a_offset,
+                                               int64_t                          lda,
+                                               hipblas_batched_operand<T>       B,
+                                               int64_t                          b_offset,
+                                               int64_t                          ldb,
+                                               int                              batch_count)
+    {
+        constexpr int NB = HIPBLAS_TRSM_MIXED_DIAGONAL;
+        __shared__ float M[NB][NB + 1];
+
+        int     r      = blockIdx.x * blockDim.x + threadIdx.x;
+        int64_t b_next = left ? 1 : ldb;
+        int64_t b_rhs  = left ? ldb : 1;
+
+        for(int b = blockIdx.z; b < batch_count; b += gridDim.z)
+        {
+            const T* a = batch_at(A, b) + a_offset;
+            __syncthreads();
+            for(int e = threadIdx.x; e < NB * NB; e += blockDim.x)
+            {
+                int i   = e % NB;
+                int l   = e / NB;
+                int oi  = left ? i : l;
+                int ol  = left ? l : i;
+                int row = trans == HIPBLAS_OP_N ? oi : ol;
+                int col = trans == HIPBLAS_OP_N ? ol : oi;
+
+                // Zero past the block, so the unrolled loops can run over all of M
+                bool  inside = i < nb && l < nb;
+                float value  = 0;
+                if(inside && row == col)
+                    value = diag == HIPBLAS_DIAG_UNIT ? 1.0f : load(a[row + col * lda]);
+                else if(inside && (uplo == HIPBLAS_FILL_MODE_UPPER ? row < col : row > col))
+                    value = load(a[row + col * lda]);
+                M[i][l] = value;
+            }
+            __syncthreads();
+            if(r >= nrhs)
+                continue;
+
+            T*    x = batch_at(B, b) + b_offset + r * b_rhs;
+            float v[NB];
+#pragma unroll
+            for(int i = 0; i < NB; i++)
+                v[i] = i < nb ? alpha * load(x[i * b_next]) : 0.0f;
+
+            // A solve takes the rows in the order M's triangle fills in; a product in place
+            // takes them against it, so each row still reads the unchanged ones it needs
+            if(solve && lower)
+            {
+#pragma unroll
+                for(int i = 0; i < NB; i++)
+                    if(i < nb)
+                    {
+                        float s = v[i];
+#pragma unroll
+                        for(int l = 0; l < i; l++)
+                            s -= M[i][l] * v[l];
+                        v[i] = s / M[i][i];
+                    }
+            }
+            else if(solve)
+            {
+#pragma unroll
+                for(int i = NB - 1; i >= 0; i--)
+                    if(i < nb)
+                    {
+                        float s = v[i];
+#pragma unroll
+                        for(int l = i + 1; l < NB; l++)
+                            s -= M[i][l] * v[l];
+                        v[i] = s / M[i][i];
+                    }
+            }
+            else if(lower)
+            {
+#pragma unroll
+                for(int i = NB - 1; i >= 0; i--)
+                {
+                    float s = 0;
+#pragma unroll
+                    for(int l = 0; l <= i; l++)
+                        s += M[i][l] * v[l];
+                    v[i] = s;
+                }
+            }
+            else
+            {
+#pragma unroll
+                for(int i = 0; i < NB; i++)
+                {
+                    float s = 0;
+#pragma unroll
+                    for(int l = i; l < NB; l++)
+                        s += M[i][l] * v[l];
+                    v[i] = s;
+                }
+            }
+
+#pragma unroll
+            for(int i = 0; i < NB; i++)
+                if(i < nb)
+                    store(x[i * b_next], v[i]);
+        }
+    }
+
+    template <typename T>
+    hipError_t diagonal(hipStream_t                         stream,
+                        bool                                solve,
+                        bool                                left,
+                        bool                                lower,
+                        hipblasFillMode_t                   uplo,
+                        hipblasOperation_t                  trans,
+                        hipblasDiagType_t                   diag,
+                        int                                 nb,
+                        int                                 nrhs,
+                        float                               alpha,
+                        hipblas_batched_operand<const void> A,
+                        int64_t                             a_offset,
+                        int64_t                             lda,
+                        hipblas_batched_operand<void>       B,
+                        int64_t                             b_offset,
+                        int64_t                             ldb,
+                        int                                 batch_count)
+    {
+        hipblas_batched_operand<const T> a{static_cast<const T*>(A.ptr),
+                                           A.stride,
+                                           reinterpret_cast<const T* const*>(A.array)};
+        hipblas_batched_operand<T>       b{
+            static_cast<T*>(B.ptr), B.stride, reinterpret_cast<T* const*>(B.array)};
+
+        hipLaunchKernelGGL(trsm_mixed_diagonal_kernel<T>,
+                           dim3((nrhs - 1) / RHS_DIM_X + 1,
+                                1,
+                                std::min(batch_count, MAX_GRID_BATCH)),
+                           dim3(RHS_DIM_X),
+                           0,
+                           stream,
+                           solve,
+                           left,
+                           lower,
+                           uplo,
+                           trans,
+                           diag,
+                           nb,
+                           nrhs,
+                           alpha,
+                           a,
+                           a_offset,
+                           lda,
+                           b,
+                           b_offset,
+                           ldb,
+                           batch_count);
+        return hipGetLastError();
+    }
+}
+
+hipError_t hipblas_trsm_mixed_diagonal(hipStream_t                         stream,
+                                       bool                                solve,
+                                       hipblasSideMode_t                   side,
+                                       hipblasFillMode_t                   uplo,
+                                       hipblasOperation_t                  trans,
+                                       hipblasDiagType_t                   diag,
+                                       int                                 nb,
+                                       int                                 nrhs,
+                                       float                               alpha,
+                                       hipblas_batched_operand<const void> A,
+                                       int64_t                             a_offset,
+                                       int64_t                             lda,
+                                       hipblas_batched_operand<void>       B,
+                                       int64_t                             b_offset,
+                                       int64_t                             ldb,
+                                       hipblasDatatype_t                   type,
+                                       int                                 batch_count)
+{
+    if(nb <= 0 || nrhs <= 0 || batch_count <= 0)
+        return hipSuccess;
+    if(nb > HIPBLAS_TRSM_MIXED_DIAGONAL)
+        return hipErrorInvalidValue;
+
+    // M is op(A) on the left and op(A)^T on the right
+    bool left     = side == HIPBLAS_SIDE_LEFT;
+    bool upper_op = (uplo == HIPBLAS_FILL_MODE_UPPER) == (trans == HIPBLAS_OP_N);
+    bool lower    = left ? !upper_op : upper_op;
+    switch(type)
+    {
+    case HIPBLAS_R_16F:
+        return diagonal<hipblasHalf>(stream,
+                                     solve,
+                                     left,
+                                     lower,
+                                     uplo,
+                                     trans,
+                                     diag,
+                                     nb,
+                                     nrhs,
+                                     alpha,
+                                     A,
+                                     a_offset,
+                                     lda,
+                                     B,
+                                     b_offset,
+                                     ldb,
+                                     batch_count);
+    case HIPBLAS_R_16B:
+        return diagonal<hipblasBfloat16>(stream,
+                                         solve,
+                                         left,
+                                         lower,
+                                         uplo,
+                                         trans,
+                                         diag,
+                                         nb,
+                                         nrhs,
+                                         alpha,
+                                         A,
+                                         a_offset,
+                                         lda,
+                                         B,
+                                         b_offset,
+                                         ldb,
+                                         batch_count);
+    case HIPBLAS_R_32F:
+        return diagonal<float>(stream,
+                               solve,
+                               left,
+                               lower,
+                               uplo,
+                               trans,
+                               diag,
+                               nb,
+                               nrhs,
+                               alpha,
+                               A,
+                               a_offset,
+                               lda,
+                               B,
+                               b_offset,
+                               ldb,
+                               batch_count);
+    default:
+        return hipErrorInvalidValue;
+    }
+}
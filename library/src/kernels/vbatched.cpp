@@ -0,0 +1,1237 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "hipblas_kernels.h"
+#include <algorithm>
+#include <cstring>
+#include <hip/hip_runtime.h>
+
+namespace
+{
+    // A gemv tile is TILE rows of op(A) with TILE threads on each
+    constexpr int TILE = 16;
+
+    // One block scans the tiles of the whole batch, SCAN_DIM_X entries at a time
+    constexpr int SCAN_DIM_X = 1024;
+
+    // Block size of the triangular sweep; a power of two for the shared memory reduction
+    constexpr int SWEEP_DIM_X = 256;
+
+    // Resident blocks per compute unit of the persistent grids
+    constexpr int BLOCKS_PER_CU = 8;
+
+    // Cost classes of the largest-first order; the bit lengths of n, n and cols add to 93 at most
+    constexpr int COST_CLASSES = 96;
+
+    // Block size of the nrm2 chunk reductions, a power of two, and the fewest elements a chunk
+    // takes; chunks grow past that so the whole batch never makes more than NRM2_CHUNKS, plus one
+    // partial chunk per entry
+    constexpr int     NRM2_DIM_X     = 256;
+    constexpr int64_t NRM2_CHUNK_MIN = NRM2_DIM_X * 16;
+    constexpr int64_t NRM2_CHUNKS    = 4096;
+
+    template <typename E>
+    struct arith
+    {
+        using real = E;
+
+        __device__ static E    zero() { return 0; }
+        __device__ static E    add(E a, E b) { return a + b; }
+        __device__ static E    sub(E a, E b) { return a - b; }
+        __device__ static E    mul(E a, E b) { return a * b; }
+        __device__ static E    div(E a, E b) { return a / b; }
+        __device__ static E    conj(E a) { return a; }
+        __device__ static bool is_zero(E a) { return a == 0; }
+        __device__ static E    abs1(E a) { return a < 0 ? -a : a; }
+        __device__ static E    max_part(E a) { return abs1(a); }
+
+        // |a / scale|^2
+        __device__ static E scaled_square(E a, E scale)
+        {
+            E r = a / scale;
+            return r * r;
+        }
+    };
+
+    template <typename R>
+    struct arith<hip_complex_number<R>>
+    {
+        using E    = hip_complex_number<R>;
+        using real = R;
+
+        __device__ static E zero() { return {0, 0}; }
+        __device__ static E add(E a, E b) { return {a.x + b.x, a.y + b.y}; }
+        __device__ static E sub(E a, E b) { return {a.x - b.x, a.y - b.y}; }
+        __device__ static E mul(E a, E b) { return {a.x * b.x - a.y * b.y, a.x * b.y + a.y * b.x}; }
+
+        // Smith's algorithm, scaling by the larger part of b to avoid overflow
+        __device__ static E div(E a, E b)
+        {
+            if((b.x < 0 ? -b.x : b.x) >= (b.y < 0 ? -b.y : b.y))
+            {
+                R r = b.y / b.x, d = b.x + b.y * r;
+                return {(a.x + a.y * r) / d, (a.y - a.x * r) / d};
+            }
+            R r = b.x / b.y, d = b.x * r + b.y;
+            return {(a.x * r + a.y) / d, (a.y * r - a.x) / d};
+        }
+
+        __device__ static E    conj(E a) { return {a.x, -a.y}; }
+        __device__ static bool is_zero(E a) { return a.x == 0 && a.y == 0; }
+
+        // |re| + |im|, as LAPACK's pivot search uses
+        __device__ static R abs1(E a) { return (a.x < 0 ? -a.x : a.x) + (a.y < 0 ? -a.y : a.y); }
+
+        __device__ static R max_part(E a)
+        {
+            R x = a.x < 0 ? -a.x : a.x, y = a.y < 0 ? -a.y : a.y;
+            return x > y ? x : y;
+        }
+
+        __device__ static R scaled_square(E a, R scale)
+        {
+            R x = a.x / scale, y = a.y / scale;
+            return x * x + y * y;
+        }
+    };
+
+    // Element i of a length n vector; a negative increment walks it from the far end, as in BLAS
+    __device__ int64_t vector_offset(int64_t i, int n, int64_t inc)
+    {
+        return inc >= 0 ? i * inc : (i - int64_t(n - 1)) * inc;
+    }
+
+    // A(i, j) of op(A)
+    template <typename E>
+    __device__ E op_element(hipblasOperation_t trans, const E* A, int64_t lda, int64_t i, int64_t j)
+    {
+        if(trans == HIPBLAS_OP_N)
+            return A[i + j * lda];
+        E a = A[j + i * lda];
+        return trans == HIPBLAS_OP_C ? arith<E>::conj(a) : a;
+    }
+
+    // Row tiles of one gemv entry; an entry with nothing to do or sizes BLAS would reject has none
+    __device__ int64_t
+        gemv_tiles(hipblasOperation_t trans, int m, int n, int lda, int incx, int incy)
+    {
+        if(m <= 0 || n <= 0 || lda < m || incx == 0 || incy == 0)
+            return 0;
+        return ((trans == HIPBLAS_OP_N ? m : n) - 1) / TILE + 1;
+    }
+
+    // first_tile[b] is the first tile of entry b and first_tile[batch_count] the total, by a
+    // Hillis-Steele scan of each SCAN_DIM_X entries carried over to the next
+    __global__ void gemv_tiles_kernel(hipblasOperation_t trans,
+                                      const int*         m,
+                                      const int*         n,
+                                      const int*         lda,
+                                      const int*         incx,
+                                      const int*         incy,
+                                      int                batch_count,
+                                      int64_t*           first_tile)
+    {
+        __shared__ int64_t sums[SCAN_DIM_X];
+
+        int     tid   = threadIdx.x;
+        int64_t carry = 0;
+        for(int base = 0; base < batch_count; base += SCAN_DIM_X)
+        {
+            int     b     = base + tid;
+            int64_t tiles = b < batch_count
+                                ? gemv_tiles(trans, m[b], n[b], lda[b], incx[b], incy[b])
+                                : 0;
+            sums[tid] = tiles;
+            __syncthreads();
+
+            for(int offset = 1; offset < SCAN_DIM_X; offset *= 2)
+            {
+                int64_t v = tid >= offset ? sums[tid - offset] : 0;
+                __syncthreads();
+                sums[tid] += v;
+                __syncthreads();
+            }
+
+            if(b < batch_count)
+                first_tile[b] = carry + sums[tid] - tiles;
+            carry += sums[SCAN_DIM_X - 1];
+            __syncthreads();
+        }
+        if(tid == 0)
+            first_tile[batch_count] = carry;
+    }
+
+    // The TILE rows of op(A) * x from row tile * TILE on. Each row is summed by TILE threads
+    // taking every TILE-th column, and the first of them adds up the partial sums; tx runs along
+    // the rows of op(A) = A and down the columns of A otherwise, so neighbouring threads read
+    // neighbouring elements
+    template <typename E>
+    __device__ void gemv_tile(hipblasOperation_t trans,
+                              int                rows,
+                              int                cols,
+                              E                  alpha,
+                              E                  beta,
+                              const E*           A,
+                              int64_t            lda,
+                              const E*           x,
+                              int64_t            incx,
+                              E*                 y,
+                              int64_t            incy,
+                              int64_t            tile,
+                              int                tx,
+                              int                ty,
+                              E (*sums)[TILE + 1])
+    {
+        int     row  = trans == HIPBLAS_OP_N ? tx : ty;
+        int     lane = trans == HIPBLAS_OP_N ? ty : tx;
+        int64_t r    = tile * TILE + row;
+
+        E sum = arith<E>::zero();
+        if(!arith<E>::is_zero(alpha) && r < rows)
+            for(int64_t l = lane; l < cols; l += TILE)
+                sum = arith<E>::add(sum,
+                                    arith<E>::mul(op_element(trans, A, lda, r, l),
+                                                  x[vector_offset(l, cols, incx)]));
+        sums[row][lane] = sum;
+        __syncthreads();
+
+        if(lane == 0 && r < rows)
+        {
+            for(int l = 1; l < TILE; l++)
+                sum = arith<E>::add(sum, sums[row][l]);
+            E* yr = y + vector_offset(r, rows, incy);
+            E  v  = arith<E>::mul(alpha, sum);
+            if(!arith<E>::is_zero(beta))
+                v = arith<E>::add(v, arith<E>::mul(beta, *yr));
+            *yr = v;
+        }
+    }
+
+    // The blocks of a persistent grid take tiles in turn and find each one's entry by binary
+    // search, as job_list does; in device pointer mode entry b reads its scalars at
+    // alpha_dev[b * scalar_stride] and beta_dev[b * scalar_stride]
+    template <typename E>
+    __global__ void gemv_vbatched_kernel(hipblasOperation_t trans,
+                                         const int*         m,
+                                         const int*         n,
+                                         E                  alpha,
+                                         E                  beta,
+                                         const E*           alpha_dev,
+                                         const E*           beta_dev,
+                                         int64_t            scalar_stride,
+                                         const E* const*    A,
+                                         const int*         lda,
+                                         const E* const*    x,
+                                         const int*         incx,
+                                         E* const*          y,
+                                         const int*         incy,
+                                         int                batch_count,
+                                         const int64_t*     first_tile)
+    {
+        __shared__ E sums[TILE][TILE + 1];
+
+        int     tx    = threadIdx.x;
+        int     ty    = threadIdx.y;
+        int64_t tiles = first_tile[batch_count];
+
+        for(int64_t tile = blockIdx.x; tile < tiles; tile += gridDim.x)
+        {
+            // The last entry starting at or before tile; entries without tiles start where the
+            // next one does, so they are never the last
+            int lo = 0, hi = batch_count - 1;
+            while(lo < hi)
+            {
+                int mid = (lo + hi + 1) / 2;
+                if(first_tile[mid] <= tile)
+                    lo = mid;
+                else
+                    hi = mid - 1;
+            }
+
+            int b = lo;
+            if(alpha_dev)
+                alpha = alpha_dev[b * scalar_stride];
+            if(beta_dev)
+                beta = beta_dev[b * scalar_stride];
+
+            bool no_trans = trans == HIPBLAS_OP_N;
+            gemv_tile(trans,
+                      no_trans ? m[b] : n[b],
+                      no_trans ? n[b] : m[b],
+                      alpha,
+                      beta,
+                      A[b],
+                      lda[b],
+                      x[b],
+                      incx[b],
+                      y[b],
+                      incy[b],
+                      tile - first_tile[b],
+                      tx,
+                      ty,
+                      sums);
+            __syncthreads();
+        }
+    }
+
+    // As triangular_batched's solve, with each block taking the next entry from next_entry when it
+    // is done with one, so the blocks stay busy however unevenly the sizes are spread
+    template <typename E>
+    __global__ void trsv_vbatched_kernel(hipblasFillMode_t  uplo,
+                                         hipblasOperation_t trans,
+                                         hipblasDiagType_t  diag,
+                                         const int*         n,
+                                         const E* const*    A,
+                                         const int*         lda,
+                                         E* const*          x,
+                                         const int*         incx,
+                                         int                batch_count,
+                                         int*               next_entry)
+    {
+        __shared__ E   partial[SWEEP_DIM_X];
+        __shared__ int entry;
+
+        int  tid      = threadIdx.x;
+        bool lower_op = (uplo == HIPBLAS_FILL_MODE_LOWER) == (trans == HIPBLAS_OP_N);
+
+        while(true)
+        {
+            if(tid == 0)
+                entry = atomicAdd(next_entry, 1);
+            __syncthreads();
+            int b = entry;
+            if(b >= batch_count)
+                return;
+
+            int     nb  = n[b];
+            int64_t ldb = lda[b];
+            int64_t inc = incx[b];
+            if(nb > 0 && ldb >= nb && inc != 0)
+            {
+                const E* a  = A[b];
+                E*       xb = x[b];
+
+                for(int s = 0; s < nb; s++)
+                {
+                    int i  = lower_op ? s : nb - 1 - s;
+                    int lo = lower_op ? 0 : i + 1;
+                    int hi = lower_op ? i : nb;
+
+                    E sum = arith<E>::zero();
+                    for(int j = lo + tid; j < hi; j += blockDim.x)
+                        sum = arith<E>::add(sum,
+                                            arith<E>::mul(op_element(trans, a, ldb, i, j),
+                                                          xb[vector_offset(j, nb, inc)]));
+                    partial[tid] = sum;
+                    __syncthreads();
+
+                    for(int half = blockDim.x / 2; half > 0; half /= 2)
+                    {
+                        if(tid < half)
+                            partial[tid] = arith<E>::add(partial[tid], partial[tid + half]);
+                        __syncthreads();
+                    }
+
+                    if(tid == 0)
+                    {
+                        E* xi = xb + vector_offset(i, nb, inc);
+                        E  v  = arith<E>::sub(*xi, partial[0]);
+                        *xi   = diag == HIPBLAS_DIAG_UNIT
+                                    ? v
+                                    : arith<E>::div(v, op_element(trans, a, ldb, i, i));
+                    }
+                    __syncthreads();
+                }
+            }
+            // Every thread has read entry before the next one is taken
+            __syncthreads();
+        }
+    }
+
+    __device__ int bit_length(int v)
+    {
+        int bits = 0;
+        for(; v > 0; v >>= 1)
+            bits++;
+        return bits;
+    }
+
+    // Roughly log2 of the n^2 * cols work of a triangle of order n against cols columns, from
+    // the bit lengths so that no size overflows it; zero for sizes with no work
+    __device__ int cost_class(int n, int cols)
+    {
+        if(n <= 0 || cols <= 0)
+            return 0;
+        return 2 * bit_length(n) + bit_length(cols);
+    }
+
+    // order[] lists the batch by cost class, largest first, so that the persistent grid starts
+    // the long entries and the short ones fill in behind them; cols may be null for n^3 work. The
+    // counting sort is one block's, and it zeroes next_entry for the grid that follows
+    __global__ void largest_first_kernel(
+        const int* n, const int* cols, int batch_count, int* order, int* next_entry)
+    {
+        __shared__ int first[COST_CLASSES];
+
+        int tid = threadIdx.x;
+        for(int c = tid; c < COST_CLASSES; c += blockDim.x)
+            first[c] = 0;
+        __syncthreads();
+
+        for(int b = tid; b < batch_count; b += blockDim.x)
+            atomicAdd(&first[cost_class(n[b], cols ? cols[b] : n[b])], 1);
+        __syncthreads();
+
+        if(tid == 0)
+        {
+            int start = 0;
+            for(int c = COST_CLASSES - 1; c >= 0; c--)
+            {
+                int count = first[c];
+                first[c]  = start;
+                start += count;
+            }
+            *next_entry = 0;
+        }
+        __syncthreads();
+
+        for(int b = tid; b < batch_count; b += blockDim.x)
+            order[atomicAdd(&first[cost_class(n[b], cols ? cols[b] : n[b])], 1)] = b;
+    }
+
+    // Runs solve(b) for the entries of order[] that this block takes from next_entry, one at a
+    // time, until the batch is done
+    template <typename F>
+    __device__ void take_entries(const int* order, int batch_count, int* next_entry, F solve)
+    {
+        __shared__ int entry;
+
+        while(true)
+        {
+            if(threadIdx.x == 0)
+                entry = atomicAdd(next_entry, 1);
+            __syncthreads();
+            int k = entry;
+            if(k >= batch_count)
+                return;
+
+            solve(order[k]);
+            // Every thread has read entry before the next one is taken
+            __syncthreads();
+        }
+    }
+
+    // LAPACK's getf2 on the n x n A, one column at a time: the pivot is the first element of
+    // largest abs1 on or below the diagonal, its row is swapped into place across the whole
+    // matrix, and the column below it is scaled before the rank-1 update of the trailing block.
+    // A zero pivot is recorded in info, once, and skips the scaling as LAPACK does
+    template <typename E>
+    __device__ void getf2(int n, E* A, int64_t lda, int* ipiv, int* info)
+    {
+        using R = typename arith<E>::real;
+
+        __shared__ R   best[SWEEP_DIM_X];
+        __shared__ int best_row[SWEEP_DIM_X];
+
+        int tid = threadIdx.x;
+        if(tid == 0)
+            *info = 0;
+
+        for(int j = 0; j < n; j++)
+        {
+            R   v = -1;
+            int r = j;
+            for(int i = j + tid; i < n; i += blockDim.x)
+            {
+                R a = arith<E>::abs1(A[i + j * lda]);
+                if(a > v)
+                {
+                    v = a;
+                    r = i;
+                }
+            }
+            best[tid]     = v;
+            best_row[tid] = r;
+            __syncthreads();
+
+            for(int half = blockDim.x / 2; half > 0; half /= 2)
+            {
+                if(tid < half
+                   && (best[tid + half] > best[tid]
+                       || (best[tid + half] == best[tid] && best_row[tid + half] < best_row[tid])))
+                {
+                    best[tid]     = best[tid + half];
+                    best_row[tid] = best_row[tid + half];
+                }
+                __syncthreads();
+            }
+
+            int  p    = best_row[0];
+            bool zero = best[0] == 0;
+            if(tid == 0)
+            {
+                ipiv[j] = p + 1;
+                if(zero && *info == 0)
+                    *info = j + 1;
+            }
+            if(p != j)
+                for(int c = tid; c < n; c += blockDim.x)
+                {
+                    E t            = A[j + c * lda];
+                    A[j + c * lda] = A[p + c * lda];
+                    A[p + c * lda] = t;
+                }
+            __syncthreads();
+
+            if(!zero)
+            {
+                E pivot = A[j + j * lda];
+                for(int i = j + 1 + tid; i < n; i += blockDim.x)
+                    A[i + j * lda] = arith<E>::div(A[i + j * lda], pivot);
+            }
+            __syncthreads();
+
+            int64_t rows = n - 1 - j;
+            for(int64_t e = tid; e < rows * rows; e += blockDim.x)
+            {
+                int64_t i = j + 1 + e % rows;
+                int64_t c = j + 1 + e / rows;
+                A[i + c * lda]
+                    = arith<E>::sub(A[i + c * lda], arith<E>::mul(A[i + j * lda], A[j + c * lda]));
+            }
+            __syncthreads();
+        }
+    }
+
+    // The row swaps of ipiv applied to the n x nrhs B, in order or, undoing them, in reverse
+    template <typename E>
+    __device__ void
+        apply_pivots(int n, int nrhs, const int* ipiv, E* B, int64_t ldb, bool reverse)
+    {
+        for(int s = 0; s < n; s++)
+        {
+            int i = reverse ? n - 1 - s : s;
+            int p = ipiv[i] - 1;
+            if(p != i)
+                for(int c = threadIdx.x; c < nrhs; c += blockDim.x)
+                {
+                    E t            = B[i + c * ldb];
+                    B[i + c * ldb] = B[p + c * ldb];
+                    B[p + c * ldb] = t;
+                }
+            __syncthreads();
+        }
+    }
+
+    // Solves T X = B in place for the order n triangle T(i, j) = op(A)(i, j), or op(A)(j, i)
+    // when transposed, lower or upper as lower_op says, with X(i, c) at
+    // B[i * row_stride + c * col_stride]. Each step finishes one row of X and takes it out of the
+    // rows still to solve, in parallel over their elements
+    template <typename E>
+    __device__ void triangular_solve(bool               lower_op,
+                                     hipblasOperation_t trans,
+                                     bool               transposed,
+                                     bool               unit,
+                                     int                n,
+                                     const E*           A,
+                                     int64_t            lda,
+                                     int                nrhs,
+                                     E*                 B,
+                                     int64_t            row_stride,
+                                     int64_t            col_stride)
+    {
+        auto t = [&](int64_t i, int64_t j) {
+            return transposed ? op_element(trans, A, lda, j, i) : op_element(trans, A, lda, i, j);
+        };
+
+        int tid = threadIdx.x;
+        for(int s = 0; s < n; s++)
+        {
+            int i = lower_op ? s : n - 1 - s;
+            if(!unit)
+            {
+                E d = t(i, i);
+                for(int c = tid; c < nrhs; c += blockDim.x)
+                {
+                    E* x = B + i * row_stride + c * col_stride;
+                    *x   = arith<E>::div(*x, d);
+                }
+                __syncthreads();
+            }
+
+            int64_t rows  = lower_op ? n - 1 - i : i;
+            int64_t first = lower_op ? i + 1 : 0;
+            for(int64_t e = tid; e < rows * nrhs; e += blockDim.x)
+            {
+                int64_t k = first + e % rows;
+                int64_t c = e / rows;
+                E*      x = B + k * row_stride + c * col_stride;
+                *x = arith<E>::sub(*x, arith<E>::mul(t(k, i), B[i * row_stride + c * col_stride]));
+            }
+            __syncthreads();
+        }
+    }
+
+    // Each block factors whole entries from the largest-first order; an entry with n < 0 or
+    // lda < max(1, n) is skipped, with info 0
+    template <typename E>
+    __global__ void getrf_vbatched_kernel(const int*  n,
+                                          E* const*   A,
+                                          const int*  lda,
+                                          int* const* ipiv,
+                                          int*        info,
+                                          int         batch_count,
+                                          const int*  order,
+                                          int*        next_entry)
+    {
+        take_entries(order, batch_count, next_entry, [&](int b) {
+            int nb = n[b];
+            if(nb >= 0 && lda[b] >= (nb > 1 ? nb : 1))
+                getf2(nb, A[b], lda[b], ipiv[b], info + b);
+            else if(threadIdx.x == 0)
+                info[b] = 0;
+        });
+    }
+
+    // op(A) X = B from getf2's factors A = P L U: for op(A) = A the pivots go first and L
+    // then U are solved, and for op(A) = A^T or A^H op(U) then op(L) are solved and the pivots
+    // undone last
+    template <typename E>
+    __global__ void getrs_vbatched_kernel(hipblasOperation_t trans,
+                                          const int*         n,
+                                          const int*         nrhs,
+                                          const E* const*    A,
+                                          const int*         lda,
+                                          const int* const*  ipiv,
+                                          E* const*          B,
+                                          const int*         ldb,
+                                          int                batch_count,
+                                          const int*         order,
+                                          int*               next_entry)
+    {
+        take_entries(order, batch_count, next_entry, [&](int b) {
+            int nb = n[b], cols = nrhs[b];
+            if(nb <= 0 || cols <= 0 || lda[b] < nb || ldb[b] < nb)
+                return;
+
+            E*      Bb       = B[b];
+            int64_t ld       = ldb[b];
+            bool    no_trans = trans == HIPBLAS_OP_N;
+            if(no_trans)
+                apply_pivots(nb, cols, ipiv[b], Bb, ld, false);
+            // L, or op(U), is the lower of the two triangles either way
+            triangular_solve(true, trans, false, no_trans, nb, A[b], lda[b], cols, Bb, 1, ld);
+            triangular_solve(false, trans, false, !no_trans, nb, A[b], lda[b], cols, Bb, 1, ld);
+            if(!no_trans)
+                apply_pivots(nb, cols, ipiv[b], Bb, ld, true);
+        });
+    }
+
+    // B = alpha * inv(op(A)) * B or alpha * B * inv(op(A)) for the m x n B of each entry. The
+    // right side solves op(A)^T X^T = alpha B^T, the rows of B being the columns of B^T; B is
+    // only written when alpha is zero
+    template <typename E>
+    __global__ void trsm_vbatched_kernel(hipblasSideMode_t  side,
+                                         hipblasFillMode_t  uplo,
+                                         hipblasOperation_t trans,
+                                         hipblasDiagType_t  diag,
+                                         const int*         m,
+                                         const int*         n,
+                                         E                  alpha,
+                                         const E*           alpha_dev,
+                                         int64_t            scalar_stride,
+                                         const E* const*    A,
+                                         const int*         lda,
+                                         E* const*          B,
+                                         const int*         ldb,
+                                         int                batch_count,
+                                         const int*         order,
+                                         int*               next_entry)
+    {
+        bool left     = side == HIPBLAS_SIDE_LEFT;
+        bool lower_op = (uplo == HIPBLAS_FILL_MODE_LOWER) == (trans == HIPBLAS_OP_N);
+
+        take_entries(order, batch_count, next_entry, [&](int b) {
+            int rows = m[b], cols = n[b], k = left ? rows : cols;
+            if(rows <= 0 || cols <= 0 || lda[b] < k || ldb[b] < rows)
+                return;
+
+            E       scale = alpha_dev ? alpha_dev[b * scalar_stride] : alpha;
+            E*      Bb    = B[b];
+            int64_t ld    = ldb[b];
+            for(int64_t e = threadIdx.x; e < int64_t(rows) * cols; e += blockDim.x)
+            {
+                E* x = Bb + e % rows + e / rows * ld;
+                *x   = arith<E>::is_zero(scale) ? arith<E>::zero() : arith<E>::mul(scale, *x);
+            }
+            __syncthreads();
+            if(arith<E>::is_zero(scale))
+                return;
+
+            bool unit = diag == HIPBLAS_DIAG_UNIT;
+            if(left)
+                triangular_solve(lower_op, trans, false, unit, k, A[b], lda[b], cols, Bb, 1, ld);
+            else
+                triangular_solve(!lower_op, trans, true, unit, k, A[b], lda[b], rows, Bb, ld, 1);
+        });
+    }
+
+    template <typename R>
+    __device__ R block_sum(R* partial, R v)
+    {
+        int tid      = threadIdx.x;
+        partial[tid] = v;
+        __syncthreads();
+        for(int half = blockDim.x / 2; half > 0; half /= 2)
+        {
+            if(tid < half)
+                partial[tid] += partial[tid + half];
+            __syncthreads();
+        }
+        R r = partial[0];
+        __syncthreads();
+        return r;
+    }
+
+    template <typename R>
+    __device__ R block_max(R* partial, R v)
+    {
+        int tid      = threadIdx.x;
+        partial[tid] = v;
+        __syncthreads();
+        for(int half = blockDim.x / 2; half > 0; half /= 2)
+        {
+            if(tid < half && partial[tid + half] > partial[tid])
+                partial[tid] = partial[tid + half];
+            __syncthreads();
+        }
+        R r = partial[0];
+        __syncthreads();
+        return r;
+    }
+
+    // Elements of an nrm2 entry; as in BLAS, one with n <= 0 or incx <= 0 has none
+    __device__ int64_t nrm2_length(int n, int incx)
+    {
+        return n > 0 && incx > 0 ? n : 0;
+    }
+
+    // first_chunk[b] is the first chunk of entry b, first_chunk[batch_count] the total and
+    // first_chunk[batch_count + 1] the chunk size, the smallest that splits the whole batch into
+    // NRM2_CHUNKS; the scan is gemv_tiles_kernel's. done is zeroed for the grid that follows
+    __global__ void nrm2_chunks_kernel(
+        const int* n, const int* incx, int batch_count, int64_t* first_chunk, int* done)
+    {
+        __shared__ int64_t sums[SCAN_DIM_X];
+
+        int     tid      = threadIdx.x;
+        int64_t elements = 0;
+        for(int b = tid; b < batch_count; b += SCAN_DIM_X)
+            elements += nrm2_length(n[b], incx[b]);
+        sums[tid] = elements;
+        __syncthreads();
+        for(int half = SCAN_DIM_X / 2; half > 0; half /= 2)
+        {
+            if(tid < half)
+                sums[tid] += sums[tid + half];
+            __syncthreads();
+        }
+        int64_t chunk = (sums[0] + NRM2_CHUNKS - 1) / NRM2_CHUNKS;
+        chunk         = chunk > NRM2_CHUNK_MIN ? chunk : NRM2_CHUNK_MIN;
+        __syncthreads();
+
+        int64_t carry = 0;
+        for(int base = 0; base < batch_count; base += SCAN_DIM_X)
+        {
+            int     b      = base + tid;
+            int64_t chunks = b < batch_count ? (nrm2_length(n[b], incx[b]) + chunk - 1) / chunk : 0;
+            sums[tid]      = chunks;
+            __syncthreads();
+
+            for(int offset = 1; offset < SCAN_DIM_X; offset *= 2)
+            {
+                int64_t v = tid >= offset ? sums[tid - offset] : 0;
+                __syncthreads();
+                sums[tid] += v;
+                __syncthreads();
+            }
+
+            if(b < batch_count)
+                first_chunk[b] = carry + sums[tid] - chunks;
+            carry += sums[SCAN_DIM_X - 1];
+            __syncthreads();
+        }
+        if(tid == 0)
+        {
+            first_chunk[batch_count]     = carry;
+            first_chunk[batch_count + 1] = chunk;
+            *done                        = 0;
+        }
+    }
+
+    // The 2-norm of the count norms at v, scaled by the largest as each chunk's is
+    template <typename R>
+    __device__ R combine_norms(const R* v, int64_t count)
+    {
+        R scale = 0;
+        for(int64_t i = 0; i < count; i++)
+            scale = v[i] > scale ? v[i] : scale;
+        if(scale == 0)
+            return 0;
+
+        R sum = 0;
+        for(int64_t i = 0; i < count; i++)
+        {
+            R r = v[i] / scale;
+            sum += r * r;
+        }
+        return scale * sqrt(sum);
+    }
+
+    // The blocks of a persistent grid take chunks in turn and find each one's entry by binary
+    // search, as gemv_vbatched_kernel does, leaving the chunk's 2-norm in part; it is scaled by
+    // the chunk's largest part first, so squaring neither overflows nor underflows. The last
+    // block to finish combines the parts, a thread per entry for norms and the whole block over
+    // every part for result
+    template <typename E>
+    __global__ void nrm2_vbatched_kernel(const int*               n,
+                                         const E* const*          x,
+                                         const int*               incx,
+                                         int                      batch_count,
+                                         typename arith<E>::real* norms,
+                                         typename arith<E>::real* result,
+                                         const int64_t*           first_chunk,
+                                         typename arith<E>::real* part,
+                                         int*                     done)
+    {
+        using R = typename arith<E>::real;
+        __shared__ R    partial[NRM2_DIM_X];
+        __shared__ bool last;
+
+        int     tid    = threadIdx.x;
+        int64_t chunks = first_chunk[batch_count];
+        int64_t chunk  = first_chunk[batch_count + 1];
+        for(int64_t c = blockIdx.x; c < chunks; c += gridDim.x)
+        {
+            // The last entry starting at or before c; entries without chunks start where the next
+            // one does, so they are never the last
+            int lo = 0, hi = batch_count - 1;
+            while(lo < hi)
+            {
+                int mid = (lo + hi + 1) / 2;
+                if(first_chunk[mid] <= c)
+                    lo = mid;
+                else
+                    hi = mid - 1;
+            }
+
+            int      b     = lo;
+            int64_t  begin = (c - first_chunk[b]) * chunk;
+            int64_t  end   = begin + chunk < n[b] ? begin + chunk : n[b];
+            const E* xb    = x[b];
+            int64_t  inc   = incx[b];
+
+            R scale = 0;
+            for(int64_t i = begin + tid; i < end; i += blockDim.x)
+            {
+                R m   = arith<E>::max_part(xb[i * inc]);
+                scale = m > scale ? m : scale;
+            }
+            scale = block_max(partial, scale);
+
+            R r = 0;
+            if(scale > 0)
+            {
+                for(int64_t i = begin + tid; i < end; i += blockDim.x)
+                    r += arith<E>::scaled_square(xb[i * inc], scale);
+                r = scale * sqrt(block_sum(partial, r));
+            }
+            if(tid == 0)
+                part[c] = r;
+        }
+
+        // Every part this block wrote is visible before it counts itself done
+        __threadfence();
+        __syncthreads();
+        if(tid == 0)
+            last = atomicAdd(done, 1) == int(gridDim.x) - 1;
+        __syncthreads();
+        if(!last)
+            return;
+
+        if(norms)
+            for(int b = tid; b < batch_count; b += blockDim.x)
+                norms[b]
+                    = combine_norms(part + first_chunk[b], first_chunk[b + 1] - first_chunk[b]);
+
+        R scale = 0;
+        for(int64_t c = tid; c < chunks; c += blockDim.x)
+            scale = part[c] > scale ? part[c] : scale;
+        scale = block_max(partial, scale);
+
+        R sum = 0;
+        if(scale > 0)
+            for(int64_t c = tid; c < chunks; c += blockDim.x)
+            {
+                R r = part[c] / scale;
+                sum += r * r;
+            }
+        sum = block_sum(partial, sum);
+        if(tid == 0)
+            *result = scale > 0 ? scale * sqrt(sum) : 0;
+    }
+
+    // A host scalar as the kernel's type; device scalars are read by the kernel instead
+    template <typename E, typename T>
+    E host_scalar(const T* value, bool device_scalars)
+    {
+        E v = {};
+        if(!device_scalars)
+            std::memcpy(&v, value, sizeof(E));
+        return v;
+    }
+
+    // Enough resident blocks to fill the device, but no more than there is work for
+    int persistent_grid(int64_t work)
+    {
+        int device        = 0;
+        int compute_units = 0;
+        if(hipGetDevice(&device) != hipSuccess
+           || hipDeviceGetAttribute(&compute_units, hipDeviceAttributeMultiprocessorCount, device)
+                  != hipSuccess)
+            compute_units = 1;
+        return int(std::min<int64_t>(work, int64_t(std::max(compute_units, 1)) * BLOCKS_PER_CU));
+    }
+
+    // Orders the batch largest first and zeroes next_entry, ahead of a persistent grid
+    hipError_t largest_first(hipStream_t stream,
+                             const int*  n,
+                             const int*  cols,
+                             int         batch_count,
+                             int*        order,
+                             int*        next_entry)
+    {
+        hipLaunchKernelGGL(largest_first_kernel,
+                           dim3(1),
+                           dim3(SCAN_DIM_X),
+                           0,
+                           stream,
+                           n,
+                           cols,
+                           batch_count,
+                           order,
+                           next_entry);
+        return hipGetLastError();
+    }
+}
+
+template <typename T>
+hipError_t hipblas_gemv_vbatched(hipStream_t        stream,
+                                 hipblasOperation_t trans,
+                                 const int*         m,
+                                 const int*         n,
+                                 const T*           alpha,
+                                 const T*           beta,
+                                 bool               device_scalars,
+                                 int64_t            scalar_stride,
+                                 const T* const*    A,
+                                 const int*         lda,
+                                 const T* const*    x,
+                                 const int*         incx,
+                                 T* const*          y,
+                                 const int*         incy,
+                                 int                batch_count,
+                                 int64_t*           first_tile)
+{
+    if(batch_count <= 0)
+        return hipSuccess;
+
+    hipLaunchKernelGGL(gemv_tiles_kernel,
+                       dim3(1),
+                       dim3(SCAN_DIM_X),
+                       0,
+                       stream,
+                       trans,
+                       m,
+                       n,
+                       lda,
+                       incx,
+                       incy,
+                       batch_count,
+                       first_tile);
+    hipError_t err = hipGetLastError();
+    if(err != hipSuccess)
+        return err;
+
+    // The tile count is only known on the device, so the grid is sized for the device alone;
+    // blocks past the last tile return at once
+    hipLaunchKernelGGL(gemv_vbatched_kernel<T>,
+                       dim3(persistent_grid(int64_t(batch_count) * BLOCKS_PER_CU)),
+                       dim3(TILE, TILE),
+                       0,
+                       stream,
+                       trans,
+                       m,
+                       n,
+                       host_scalar<T>(alpha, device_scalars),
+                       host_scalar<T>(beta, device_scalars),
+                       device_scalars ? alpha : nullptr,
+                       device_scalars ? beta : nullptr,
+                       scalar_stride,
+                       A,
+                       lda,
+                       x,
+                       incx,
+                       y,
+                       incy,
+                       batch_count,
+                       first_tile);
+    return hipGetLastError();
+}
+
+template <typename T>
+hipError_t hipblas_trsv_vbatched(hipStream_t        stream,
+                                 hipblasFillMode_t  uplo,
+                                 hipblasOperation_t trans,
+                                 hipblasDiagType_t  diag,
+                                 const int*         n,
+                                 const T* const*    A,
+                                 const int*         lda,
+                                 T* const*          x,
+                                 const int*         incx,
+                                 int                batch_count,
+                                 int*               next_entry)
+{
+    if(batch_count <= 0)
+        return hipSuccess;
+
+    hipError_t err = hipMemsetAsync(next_entry, 0, sizeof(int), stream);
+    if(err != hipSuccess)
+        return err;
+
+    hipLaunchKernelGGL(trsv_vbatched_kernel<T>,
+                       dim3(persistent_grid(batch_count)),
+                       dim3(SWEEP_DIM_X),
+                       0,
+                       stream,
+                       uplo,
+                       trans,
+                       diag,
+                       n,
+                       A,
+                       lda,
+                       x,
+                       incx,
+                       batch_count,
+                       next_entry);
+    return hipGetLastError();
+}
+
+template <typename T>
+hipError_t hipblas_getrf_vbatched(hipStream_t stream,
+                                  const int*  n,
+                                  T* const*   A,
+                                  const int*  lda,
+                                  int* const* ipiv,
+                                  int*        info,
+                                  int         batch_count,
+                                  int*        order,
+                                  int*        next_entry)
+{
+    if(batch_count <= 0)
+        return hipSuccess;
+
+    hipError_t err = largest_first(stream, n, nullptr, batch_count, order, next_entry);
+    if(err != hipSuccess)
+        return err;
+
+    hipLaunchKernelGGL(getrf_vbatched_kernel<T>,
+                       dim3(persistent_grid(batch_count)),
+                       dim3(SWEEP_DIM_X),
+                       0,
+                       stream,
+                       n,
+                       A,
+                       lda,
+                       ipiv,
+                       info,
+                       batch_count,
+                       order,
+                       next_entry);
+    return hipGetLastError();
+}
+
+template <typename T>
+hipError_t hipblas_getrs_vbatched(hipStream_t        stream,
+                                  hipblasOperation_t trans,
+                                  const int*         n,
+                                  const int*         nrhs,
+                                  const T* const*    A,
+                                  const int*         lda,
+                                  const int* const*  ipiv,
+                                  T* const*          B,
+                                  const int*         ldb,
+                                  int                batch_count,
+                                  int*               order,
+                                  int*               next_entry)
+{
+    if(batch_count <= 0)
+        return hipSuccess;
+
+    hipError_t err = largest_first(stream, n, nrhs, batch_count, order, next_entry);
+    if(err != hipSuccess)
+        return err;
+
+    hipLaunchKernelGGL(getrs_vbatched_kernel<T>,
+                       dim3(persistent_grid(batch_count)),
+                       dim3(SWEEP_DIM_X),
+                       0,
+                       stream,
+                       trans,
+                       n,
+                       nrhs,
+                       A,
+                       lda,
+                       ipiv,
+                       B,
+                       ldb,
+                       batch_count,
+                       order,
+                       next_entry);
+    return hipGetLastError();
+}
+
+template <typename T>
+hipError_t hipblas_trsm_vbatched(hipStream_t        stream,
+                                 hipblasSideMode_t  side,
+                                 hipblasFillMode_t  uplo,
+                                 hipblasOperation_t trans,
+                                 hipblasDiagType_t  diag,
+                                 const int*         m,
+                                 const int*         n,
+                                 const T*           alpha,
+                                 bool               device_scalars,
+                                 int64_t            scalar_stride,
+                                 const T* const*    A,
+                                 const int*         lda,
+                                 T* const*          B,
+                                 const int*         ldb,
+                                 int                batch_count,
+                                 int*               order,
+                                 int*               next_entry)
+{
+    if(batch_count <= 0)
+        return hipSuccess;
+
+    // The triangle's order is the sizes' first cost factor, the other side of B the second
+    bool       left = side == HIPBLAS_SIDE_LEFT;
+    hipError_t err
+        = largest_first(stream, left ? m : n, left ? n : m, batch_count, order, next_entry);
+    if(err != hipSuccess)
+        return err;
+
+    hipLaunchKernelGGL(trsm_vbatched_kernel<T>,
+                       dim3(persistent_grid(batch_count)),
+                       dim3(SWEEP_DIM_X),
+                       0,
+                       stream,
+                       side,
+                       uplo,
+                       trans,
+                       diag,
+                       m,
+                       n,
+                       host_scalar<T>(alpha, device_scalars),
+                       device_scalars ? alpha : nullptr,
+                       scalar_stride,
+                       A,
+                       lda,
+                       B,
+                       ldb,
+                       batch_count,
+                       order,
+                       next_entry);
+    return hipGetLastError();
+}
+
+int64_t hipblas_nrm2_vbatched_work_size(int batch_count)
+{
+    return NRM2_CHUNKS + batch_count;
+}
+
+template <typename T, typename Tr>
+hipError_t hipblas_nrm2_vbatched(hipStream_t     stream,
+                                 const int*      n,
+                                 const T* const* x,
+                                 const int*      incx,
+                                 int             batch_count,
+                                 Tr*             norms,
+                                 Tr*             result,
+                                 int64_t*        first_chunk,
+                                 Tr*             part,
+                                 int*            done)
+{
+    if(batch_count <= 0)
+        return hipSuccess;
+
+    hipLaunchKernelGGL(nrm2_chunks_kernel,
+                       dim3(1),
+                       dim3(SCAN_DIM_X),
+                       0,
+                       stream,
+                       n,
+                       incx,
+                       batch_count,
+                       first_chunk,
+                       done);
+    hipError_t err = hipGetLastError();
+    if(err != hipSuccess)
+        return err;
+
+    // Sized for the device as gemv_vbatched's grid is; blocks past the last chunk only count
+    // themselves done
+    hipLaunchKernelGGL(nrm2_vbatched_kernel<T>,
+                       dim3(persistent_grid(hipblas_nrm2_vbatched_work_size(batch_count))),
+                       dim3(NRM2_DIM_X),
+                       0,
+                       stream,
+                       n,
+                       x,
+                       incx,
+                       batch_count,
+                       norms,
+                       result,
+                       first_chunk,
+                       part,
+                       done);
+    return hipGetLastError();
+}
+
+// clang-format off
+template hipError_t hipblas_gemv_vbatched<float>(hipStream_t, hipblasOperation_t, const int*, const int*, const float*, const float*, bool, int64_t, const float* const*, const int*, const float* const*, const int*, float* const*, const int*, int, int64_t*);
+template hipError_t hipblas_gemv_vbatched<double>(hipStream_t, hipblasOperation_t, const int*, const int*, const double*, const double*, bool, int64_t, const double* const*, const int*, const double* const*, const int*, double* const*, const int*, int, int64_t*);
+template hipError_t hipblas_gemv_vbatched<hipblasComplex>(hipStream_t, hipblasOperation_t, const int*, const int*, const hipblasComplex*, const hipblasComplex*, bool, int64_t, const hipblasComplex* const*, const int*, const hipblasComplex* const*, const int*, hipblasComplex* const*, const int*, int, int64_t*);
+template hipError_t hipblas_gemv_vbatched<hipblasDoubleComplex>(hipStream_t, hipblasOperation_t, const int*, const int*, const hipblasDoubleComplex*, const hipblasDoubleComplex*, bool, int64_t, const hipblasDoubleComplex* const*, const int*, const hipblasDoubleComplex* const*, const int*, hipblasDoubleComplex* const*, const int*, int, int64_t*);
+template hipError_t hipblas_trsv_vbatched<float>(hipStream_t, hipblasFillMode_t, hipblasOperation_t, hipblasDiagType_t, const int*, const float* const*, const int*, float* const*, const int*, int, int*);
+template hipError_t hipblas_trsv_vbatched<double>(hipStream_t, hipblasFillMode_t, hipblasOperation_t, hipblasDiagType_t, const int*, const double* const*, const int*, double* const*, const int*, int, int*);
+template hipError_t hipblas_trsv_vbatched<hipblasComplex>(hipStream_t, hipblasFillMode_t, hipblasOperation_t, hipblasDiagType_t, const int*, const hipblasComplex* const*, const int*, hipblasComplex* const*, const int*, int, int*);
+template hipError_t hipblas_trsv_vbatched<hipblasDoubleComplex>(hipStream_t, hipblasFillMode_t, hipblasOperation_t, hipblasDiagType_t, const int*, const hipblasDoubleComplex* const*, const int*, hipblasDoubleComplex* const*, const int*, int, int*);
+template hipError_t hipblas_getrf_vbatched<float>(hipStream_t, const int*, float* const*, const int*, int* const*, int*, int, int*, int*);
+template hipError_t hipblas_getrf_vbatched<double>(hipStream_t, const int*, double* const*, const int*, int* const*, int*, int, int*, int*);
+template hipError_t hipblas_getrf_vbatched<hipblasComplex>(hipStream_t, const int*, hipblasComplex* const*, const int*, int* const*, int*, int, int*, int*);
+template hipError_t hipblas_getrf_vbatched<hipblasDoubleComplex>(hipStream_t, const int*, hipblasDoubleComplex* const*, const int*, int* const*, int*, int, int*, int*);
+template hipError_t hipblas_getrs_vbatched<float>(hipStream_t, hipblasOperation_t, const int*, const int*, const float* const*, const int*, const int* const*, float* const*, const int*, int, int*, int*);
+template hipError_t hipblas_getrs_vbatched<double>(hipStream_t, hipblasOperation_t, const int*, const int*, const double* const*, const int*, const int* const*, double* const*, const int*, int, int*, int*);
+template hipError_t hipblas_getrs_vbatched<hipblasComplex>(hipStream_t, hipblasOperation_t, const int*, const int*, const hipblasComplex* const*, const int*, const int* const*, hipblasComplex* const*, const int*, int, int*, int*);
+template hipError_t hipblas_getrs_vbatched<hipblasDoubleComplex>(hipStream_t, hipblasOperation_t, const int*, const int*, const hipblasDoubleComplex* const*, const int*, const int* const*, hipblasDoubleComplex* const*, const int*, int, int*, int*);
+template hipError_t hipblas_trsm_vbatched<float>(hipStream_t, hipblasSideMode_t, hipblasFillMode_t, hipblasOperation_t, hipblasDiagType_t, const int*, const int*, const float*, bool, int64_t, const float* const*, const int*, float* const*, const int*, int, int*, int*);
+template hipError_t hipblas_trsm_vbatched<double>(hipStream_t, hipblasSideMode_t, hipblasFillMode_t, hipblasOperation_t, hipblasDiagType_t, const int*, const int*, const double*, bool, int64_t, const double* const*, const int*, double* const*, const int*, int, int*, int*);
+template hipError_t hipblas_trsm_vbatched<hipblasComplex>(hipStream_t, hipblasSideMode_t, hipblasFillMode_t, hipblasOperation_t, hipblasDiagType_t, const int*, const int*, const hipblasComplex*, bool, int64_t, const hipblasComplex* const*, const int*, hipblasComplex* const*, const int*, int, int*, int*);
+template hipError_t hipblas_trsm_vbatched<hipblasDoubleComplex>(hipStream_t, hipblasSideMode_t, hipblasFillMode_t, hipblasOperation_t, hipblasDiagType_t, const int*, const int*, const hipblasDoubleComplex*, bool, int64_t, const hipblasDoubleComplex* const*, const int*, hipblasDoubleComplex* const*, const int*, int, int*, int*);
+template hipError_t hipblas_nrm2_vbatched<float, float>(hipStream_t, const int*, const float* const*, const int*, int, float*, float*, int64_t*, float*, int*);
+template hipError_t hipblas_nrm2_vbatched<double, double>(hipStream_t, const int*, const double* const*, const int*, int, double*, double*, int64_t*, double*, int*);
+template hipError_t hipblas_nrm2_vbatched<hipblasComplex, float>(hipStream_t, const int*, const hipblasComplex* const*, const int*, int, float*, float*, int64_t*, float*, int*);
+template hipError_t hipblas_nrm2_vbatched<hipblasDoubleComplex, double>(hipStream_t, const int*, const hipblasDoubleComplex* const*, const int*, int, double*, double*, int64_t*, double*, int*);
+// clang-format on
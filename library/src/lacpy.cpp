@@ -0,0 +1,697 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "hipblas_handle.h"
+#include "hipblas_kernels.h"
+#include "hipblas_logging.h"
+#include <algorithm>
+#include <hip/hip_runtime_api.h>
+
+namespace
+{
+    bool valid_fill(hipblasFillMode_t uplo)
+    {
+        return uplo == HIPBLAS_FILL_MODE_UPPER || uplo == HIPBLAS_FILL_MODE_LOWER
+               || uplo == HIPBLAS_FILL_MODE_FULL;
+    }
+
+    template <typename T>
+    hipblas_batched_operand<T> single(T* p)
+    {
+        return {p, 0, nullptr};
+    }
+
+    template <typename T>
+    hipblas_batched_operand<T> strided(T* p, long long stride)
+    {
+        return {p, stride, nullptr};
+    }
+
+    template <typename T>
+    hipblas_batched_operand<T> arrays(T* const* a)
+    {
+        return {nullptr, 0, a};
+    }
+
+    // Neither rocBLAS nor cuBLAS has lacpy, so both backends copy the elements as raw bytes with
+    // the same kernel on the handle's stream
+    template <typename T>
+    hipblasStatus_t lacpy(hipblasHandle_t                  handle,
+                          hipblasFillMode_t                uplo,
+                          int                              m,
+                          int                              n,
+                          hipblas_batched_operand<const T> A,
+                          int                              lda,
+                          hipblas_batched_operand<T>       B,
+                          int                              ldb,
+                          int                              batch_count)
+    {
+        if(handle == nullptr)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if(!valid_fill(uplo))
+            return HIPBLAS_STATUS_INVALID_ENUM;
+        if(m < 0 || n < 0 || lda < std::max(1, m) || ldb < std::max(1, m) || batch_count < 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(m == 0 || n == 0 || batch_count == 0)
+            return HIPBLAS_STATUS_SUCCESS;
+        if((!A.ptr && !A.array) || (!B.ptr && !B.array))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        hipStream_t     stream;
+        hipblasStatus_t status = hipblasGetStream(handle, &stream);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        hipblas_batched_operand<const void> a{
+            A.ptr, A.stride, reinterpret_cast<const void* const*>(A.array)};
+        hipblas_batched_operand<void> b{B.ptr, B.stride, reinterpret_cast<void* const*>(B.array)};
+        return hipblas_lacpy_batched(stream, uplo, m, n, sizeof(T), a, lda, b, ldb, batch_count)
+                       == hipSuccess
+                   ? HIPBLAS_STATUS_SUCCESS
+                   : HIPBLAS_STATUS_INTERNAL_ERROR;
+    }
+
+    // The wrappers give conjugate only for complex types
+    template <typename T>
+    hipblasStatus_t symmetrize(hipblasHandle_t            handle,
+                               hipblasFillMode_t          uplo,
+                               int                        n,
+                               hipblas_batched_operand<T> A,
+                               int                        lda,
+                               bool                       conjugate,
+                               int                        batch_count)
+    {
+        if(handle == nullptr)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if(uplo != HIPBLAS_FILL_MODE_UPPER && uplo != HIPBLAS_FILL_MODE_LOWER)
+            return HIPBLAS_STATUS_INVALID_ENUM;
+        if(n < 0 || lda < std::max(1, n) || batch_count < 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(n == 0 || batch_count == 0)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(!A.ptr && !A.array)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        hipStream_t     stream;
+        hipblasStatus_t status = hipblasGetStream(handle, &stream);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        return hipblas_symmetrize_batched(stream, uplo, n, A, lda, conjugate, batch_count)
+                       == hipSuccess
+                   ? HIPBLAS_STATUS_SUCCESS
+                   : HIPBLAS_STATUS_INTERNAL_ERROR;
+    }
+
+    template <typename T>
+    hipblasStatus_t transpose(hipblasHandle_t            handle,
+                              hipblasOperation_t         trans,
+                              int                        n,
+                              hipblas_batched_operand<T> A,
+                              int                        lda,
+                              int                        batch_count)
+    {
+        if(handle == nullptr)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_T && trans != HIPBLAS_OP_C)
+            return HIPBLAS_STATUS_INVALID_ENUM;
+        if(n < 0 || lda < std::max(1, n) || batch_count < 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(trans == HIPBLAS_OP_N || n == 0 || batch_count == 0)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(!A.ptr && !A.array)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        hipStream_t     stream;
+        hipblasStatus_t status = hipblasGetStream(handle, &stream);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        bool conjugate = trans == HIPBLAS_OP_C;
+        return hipblas_transpose_batched(stream, n, A, lda, conjugate, batch_count) == hipSuccess
+                   ? HIPBLAS_STATUS_SUCCESS
+                   : HIPBLAS_STATUS_INTERNAL_ERROR;
+    }
+}
+
+// lacpy
+hipblasStatus_t hipblasSlacpy(hipblasHandle_t   handle,
+                              hipblasFillMode_t uplo,
+                              int               m,
+                              int               n,
+                              const float*      A,
+                              int               lda,
+                              float*            B,
+                              int               ldb)
+{
+    HIPBLAS_LOG_CALL(handle, uplo, m, n, A, lda, B, ldb);
+    return lacpy(handle, uplo, m, n, single(A), lda, single(B), ldb, 1);
+}
+
+hipblasStatus_t hipblasDlacpy(hipblasHandle_t   handle,
+                              hipblasFillMode_t uplo,
+                              int               m,
+                              int               n,
+                              const double*     A,
+                              int               lda,
+                              double*           B,
+                              int               ldb)
+{
+    HIPBLAS_LOG_CALL(handle, uplo, m, n, A, lda, B, ldb);
+    return lacpy(handle, uplo, m, n, single(A), lda, single(B), ldb, 1);
+}
+
+hipblasStatus_t hipblasClacpy(hipblasHandle_t       handle,
+                              hipblasFillMode_t     uplo,
+                              int                   m,
+                              int                   n,
+                              const hipblasComplex* A,
+                              int                   lda,
+                              hipblasComplex*       B,
+                              int                   ldb)
+{
+    HIPBLAS_LOG_CALL(handle, uplo, m, n, A, lda, B, ldb);
+    return lacpy(handle, uplo, m, n, single(A), lda, single(B), ldb, 1);
+}
+
+hipblasStatus_t hipblasZlacpy(hipblasHandle_t             handle,
+                              hipblasFillMode_t           uplo,
+                              int                         m,
+                              int                         n,
+                              const hipblasDoubleComplex* A,
+                              int                         lda,
+                              hipblasDoubleComplex*       B,
+                              int                         ldb)
+{
+    HIPBLAS_LOG_CALL(handle, uplo, m, n, A, lda, B, ldb);
+    return lacpy(handle, uplo, m, n, single(A), lda, single(B), ldb, 1);
+}
+
+// lacpy_batched
+hipblasStatus_t hipblasSlacpyBatched(hipblasHandle_t    handle,
+                                     hipblasFillMode_t  uplo,
+                                     int                m,
+                                     int                n,
+                                     const float* const A[],
+                                     int                lda,
+                                     float* const       B[],
+                                     int                ldb,
+                                     int                batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, uplo, m, n, A, lda, B, ldb, batch_count);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, A, B);
+    return lacpy(handle, uplo, m, n, arrays(A), lda, arrays(B), ldb, batch_count);
+}
+
+hipblasStatus_t hipblasDlacpyBatched(hipblasHandle_t     handle,
+                                     hipblasFillMode_t   uplo,
+                                     int                 m,
+                                     int                 n,
+                                     const double* const A[],
+                                     int                 lda,
+                                     double* const       B[],
+                                     int                 ldb,
+                                     int                 batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, uplo, m, n, A, lda, B, ldb, batch_count);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, A, B);
+    return lacpy(handle, uplo, m, n, arrays(A), lda, arrays(B), ldb, batch_count);
+}
+
+hipblasStatus_t hipblasClacpyBatched(hipblasHandle_t             handle,
+                                     hipblasFillMode_t           uplo,
+                                     int                         m,
+                                     int                         n,
+                                     const hipblasComplex* const A[],
+                                     int                         lda,
+                                     hipblasComplex* const       B[],
+                                     int                         ldb,
+                                     int                         batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, uplo, m, n, A, lda, B, ldb, batch_count);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, A, B);
+    return lacpy(handle, uplo, m, n, arrays(A), lda, arrays(B), ldb, batch_count);
+}
+
+hipblasStatus_t hipblasZlacpyBatched(hipblasHandle_t                   handle,
+                                     hipblasFillMode_t                 uplo,
+                                     int                               m,
+                                     int                               n,
+                                     const hipblasDoubleComplex* const A[],
+                                     int                               lda,
+                                     hipblasDoubleComplex* const       B[],
+                                     int                               ldb,
+                                     int                               batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, uplo, m, n, A, lda, B, ldb, batch_count);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, A, B);
+    return lacpy(handle, uplo, m, n, arrays(A), lda, arrays(B), ldb, batch_count);
+}
+
+// lacpy_strided_batched
+hipblasStatus_t hipblasSlacpyStridedBatched(hipblasHandle_t   handle,
+                                            hipblasFillMode_t uplo,
+                                            int               m,
+                                            int               n,
+                                            const float*      A,
+                                            int               lda,
+                                            long long         strideA,
+                                            float*            B,
+                                            int               ldb,
+                                            long long         strideB,
+                                            int               batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, uplo, m, n, A, lda, strideA, B, ldb, strideB, batch_count);
+    return lacpy(handle,
+                 uplo,
+                 m,
+                 n,
+                 strided(A, strideA),
+                 lda,
+                 strided(B, strideB),
+                 ldb,
+                 batch_count);
+}
+
+hipblasStatus_t hipblasDlacpyStridedBatched(hipblasHandle_t   handle,
+                                            hipblasFillMode_t uplo,
+                                            int               m,
+                                            int               n,
+                                            const double*     A,
+                                            int               lda,
+                                            long long         strideA,
+                                            double*           B,
+                                            int               ldb,
+                                            long long         strideB,
+                                            int               batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, uplo, m, n, A, lda, strideA, B, ldb, strideB, batch_count);
+    return lacpy(handle,
+                 uplo,
+                 m,
+                 n,
+                 strided(A, strideA),
+                 lda,
+                 strided(B, strideB),
+                 ldb,
+                 batch_count);
+}
+
+hipblasStatus_t hipblasClacpyStridedBatched(hipblasHandle_t       handle,
+                                            hipblasFillMode_t     uplo,
+                                            int                   m,
+                                            int                   n,
+                                            const hipblasComplex* A,
+                                            int                   lda,
+                                            long long             strideA,
+                                            hipblasComplex*       B,
+                                            int                   ldb,
+                                            long long             strideB,
+                                            int                   batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, uplo, m, n, A, lda, strideA, B, ldb, strideB, batch_count);
+    return lacpy(handle,
+                 uplo,
+                 m,
+                 n,
+                 strided(A, strideA),
+                 lda,
+                 strided(B, strideB),
+                 ldb,
+                 batch_count);
+}
+
+hipblasStatus_t hipblasZlacpyStridedBatched(hipblasHandle_t             handle,
+                                            hipblasFillMode_t           uplo,
+                                            int                         m,
+                                            int                         n,
+                                            const hipblasDoubleComplex* A,
+                                            int                         lda,
+                                            long long                   strideA,
+                                            hipblasDoubleComplex*       B,
+                                            int                         ldb,
+                                            long long                   strideB,
+                                            int                         batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, uplo, m, n, A, lda, strideA, B, ldb, strideB, batch_count);
+    return lacpy(handle,
+                 uplo,
+                 m,
+                 n,
+                 strided(A, strideA),
+                 lda,
+                 strided(B, strideB),
+                 ldb,
+                 batch_count);
+}
+
+// symmetrize
+hipblasStatus_t hipblasSsymmetrize(hipblasHandle_t   handle,
+                                   hipblasFillMode_t uplo,
+                                   int               n,
+                                   float*            A,
+                                   int               lda)
+{
+    HIPBLAS_LOG_CALL(handle, uplo, n, A, lda);
+    return symmetrize(handle, uplo, n, single(A), lda, false, 1);
+}
+
+hipblasStatus_t hipblasDsymmetrize(hipblasHandle_t   handle,
+                                   hipblasFillMode_t uplo,
+                                   int               n,
+                                   double*           A,
+                                   int               lda)
+{
+    HIPBLAS_LOG_CALL(handle, uplo, n, A, lda);
+    return symmetrize(handle, uplo, n, single(A), lda, false, 1);
+}
+
+hipblasStatus_t hipblasCsymmetrize(hipblasHandle_t   handle,
+                                   hipblasFillMode_t uplo,
+                                   int               n,
+                                   hipblasComplex*   A,
+                                   int               lda)
+{
+    HIPBLAS_LOG_CALL(handle, uplo, n, A, lda);
+    return symmetrize(handle, uplo, n, single(A), lda, false, 1);
+}
+
+hipblasStatus_t hipblasZsymmetrize(hipblasHandle_t       handle,
+                                   hipblasFillMode_t     uplo,
+                                   int                   n,
+                                   hipblasDoubleComplex* A,
+                                   int                   lda)
+{
+    HIPBLAS_LOG_CALL(handle, uplo, n, A, lda);
+    return symmetrize(handle, uplo, n, single(A), lda, false, 1);
+}
+
+// symmetrize_batched
+hipblasStatus_t hipblasSsymmetrizeBatched(hipblasHandle_t   handle,
+                                          hipblasFillMode_t uplo,
+                                          int               n,
+                                          float* const      A[],
+                                          int               lda,
+                                          int               batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, uplo, n, A, lda, batch_count);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, A);
+    return symmetrize(handle, uplo, n, arrays(A), lda, false, batch_count);
+}
+
+hipblasStatus_t hipblasDsymmetrizeBatched(hipblasHandle_t   handle,
+                                          hipblasFillMode_t uplo,
+                                          int               n,
+                                          double* const     A[],
+                                          int               lda,
+                                          int               batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, uplo, n, A, lda, batch_count);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, A);
+    return symmetrize(handle, uplo, n, arrays(A), lda, false, batch_count);
+}
+
+hipblasStatus_t hipblasCsymmetrizeBatched(hipblasHandle_t       handle,
+                                          hipblasFillMode_t     uplo,
+                                          int                   n,
+                                          hipblasComplex* const A[],
+                                          int                   lda,
+                                          int                   batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, uplo, n, A, lda, batch_count);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, A);
+    return symmetrize(handle, uplo, n, arrays(A), lda, false, batch_count);
+}
+
+hipblasStatus_t hipblasZsymmetrizeBatched(hipblasHandle_t             handle,
+                                          hipblasFillMode_t           uplo,
+                                          int                         n,
+                                          hipblasDoubleComplex* const A[],
+                                          int                         lda,
+                                          int                         batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, uplo, n, A, lda, batch_count);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, A);
+    return symmetrize(handle, uplo, n, arrays(A), lda, false, batch_count);
+}
+
+// symmetrize_strided_batched
+hipblasStatus_t hipblasSsymmetrizeStridedBatched(hipblasHandle_t   handle,
+                                                 hipblasFillMode_t uplo,
+                                                 int               n,
+                                                 float*            A,
+                                                 int               lda,
+                                                 long long         strideA,
+                                                 int               batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, uplo, n, A, lda, strideA, batch_count);
+    return symmetrize(handle, uplo, n, strided(A, strideA), lda, false, batch_count);
+}
+
+hipblasStatus_t hipblasDsymmetrizeStridedBatched(hipblasHandle_t   handle,
+                                                 hipblasFillMode_t uplo,
+                                                 int               n,
+                                                 double*           A,
+                                                 int               lda,
+                                                 long long         strideA,
+                                                 int               batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, uplo, n, A, lda, strideA, batch_count);
+    return symmetrize(handle, uplo, n, strided(A, strideA), lda, false, batch_count);
+}
+
+hipblasStatus_t hipblasCsymmetrizeStridedBatched(hipblasHandle_t   handle,
+                                                 hipblasFillMode_t uplo,
+                                                 int               n,
+                                                 hipblasComplex*   A,
+                                                 int               lda,
+                                                 long long         strideA,
+                                                 int               batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, uplo, n, A, lda, strideA, batch_count);
+    return symmetrize(handle, uplo, n, strided(A, strideA), lda, false, batch_count);
+}
+
+hipblasStatus_t hipblasZsymmetrizeStridedBatched(hipblasHandle_t       handle,
+                                                 hipblasFillMode_t     uplo,
+                                                 int                   n,
+                                                 hipblasDoubleComplex* A,
+                                                 int                   lda,
+                                                 long long             strideA,
+                                                 int                   batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, uplo, n, A, lda, strideA, batch_count);
+    return symmetrize(handle, uplo, n, strided(A, strideA), lda, false, batch_count);
+}
+
+// hermitize
+hipblasStatus_t hipblasChermitize(hipblasHandle_t   handle,
+                                  hipblasFillMode_t uplo,
+                                  int               n,
+                                  hipblasComplex*   A,
+                                  int               lda)
+{
+    HIPBLAS_LOG_CALL(handle, uplo, n, A, lda);
+    return symmetrize(handle, uplo, n, single(A), lda, true, 1);
+}
+
+hipblasStatus_t hipblasZhermitize(hipblasHandle_t       handle,
+                                  hipblasFillMode_t     uplo,
+                                  int                   n,
+                                  hipblasDoubleComplex* A,
+                                  int                   lda)
+{
+    HIPBLAS_LOG_CALL(handle, uplo, n, A, lda);
+    return symmetrize(handle, uplo, n, single(A), lda, true, 1);
+}
+
+// hermitize_batched
+hipblasStatus_t hipblasChermitizeBatched(hipblasHandle_t       handle,
+                                         hipblasFillMode_t     uplo,
+                                         int                   n,
+                                         hipblasComplex* const A[],
+                                         int                   lda,
+                                         int                   batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, uplo, n, A, lda, batch_count);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, A);
+    return symmetrize(handle, uplo, n, arrays(A), lda, true, batch_count);
+}
+
+hipblasStatus_t hipblasZhermitizeBatched(hipblasHandle_t             handle,
+                                         hipblasFillMode_t           uplo,
+                                         int                         n,
+                                         hipblasDoubleComplex* const A[],
+                                         int                         lda,
+                                         int                         batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, uplo, n, A, lda, batch_count);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, A);
+    return symmetrize(handle, uplo, n, arrays(A), lda, true, batch_count);
+}
+
+// hermitize_strided_batched
+hipblasStatus_t hipblasChermitizeStridedBatched(hipblasHandle_t   handle,
+                                                hipblasFillMode_t uplo,
+                                                int               n,
+                                                hipblasComplex*   A,
+                                                int               lda,
+                                                long long         strideA,
+                                                int               batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, uplo, n, A, lda, strideA, batch_count);
+    return symmetrize(handle, uplo, n, strided(A, strideA), lda, true, batch_count);
+}
+
+hipblasStatus_t hipblasZhermitizeStridedBatched(hipblasHandle_t       handle,
+                                                hipblasFillMode_t     uplo,
+                                                int                   n,
+                                                hipblasDoubleComplex* A,
+                                                int                   lda,
+                                                long long             strideA,
+                                                int                   batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, uplo, n, A, lda, strideA, batch_count);
+    return symmetrize(handle, uplo, n, strided(A, strideA), lda, true, batch_count);
+}
+
+// transpose
+hipblasStatus_t hipblasStranspose(hipblasHandle_t    handle,
+                                  hipblasOperation_t trans,
+                                  int                n,
+                                  float*             A,
+                                  int                lda)
+{
+    HIPBLAS_LOG_CALL(handle, trans, n, A, lda);
+    return transpose(handle, trans, n, single(A), lda, 1);
+}
+
+hipblasStatus_t hipblasDtranspose(hipblasHandle_t    handle,
+                                  hipblasOperation_t trans,
+                                  int                n,
+                                  double*            A,
+                                  int                lda)
+{
+    HIPBLAS_LOG_CALL(handle, trans, n, A, lda);
+    return transpose(handle, trans, n, single(A), lda, 1);
+}
+
+hipblasStatus_t hipblasCtranspose(hipblasHandle_t    handle,
+                                  hipblasOperation_t trans,
+                                  int                n,
+                                  hipblasComplex*    A,
+                                  int                lda)
+{
+    HIPBLAS_LOG_CALL(handle, trans, n, A, lda);
+    return transpose(handle, trans, n, single(A), lda, 1);
+}
+
+hipblasStatus_t hipblasZtranspose(hipblasHandle_t       handle,
+                                  hipblasOperation_t    trans,
+                                  int                   n,
+                                  hipblasDoubleComplex* A,
+                                  int                   lda)
+{
+    HIPBLAS_LOG_CALL(handle, trans, n, A, lda);
+    return transpose(handle, trans, n, single(A), lda, 1);
+}
+
+// transpose_batched
+hipblasStatus_t hipblasStransposeBatched(hipblasHandle_t    handle,
+                                         hipblasOperation_t trans,
+                                         int                n,
+                                         float* const       A[],
+                                         int                lda,
+                                         int                batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, trans, n, A, lda, batch_count);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, A);
+    return transpose(handle, trans, n, arrays(A), lda, batch_count);
+}
+
+hipblasStatus_t hipblasDtransposeBatched(hipblasHandle_t    handle,
+                                         hipblasOperation_t trans,
+                                         int                n,
+                                         double* const      A[],
+                                         int                lda,
+                                         int                batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, trans, n, A, lda, batch_count);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, A);
+    return transpose(handle, trans, n, arrays(A), lda, batch_count);
+}
+
+hipblasStatus_t hipblasCtransposeBatched(hipblasHandle_t       handle,
+                                         hipblasOperation_t    trans,
+                                         int                   n,
+                                         hipblasComplex* const A[],
+                                         int                   lda,
+                                         int                   batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, trans, n, A, lda, batch_count);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, A);
+    return transpose(handle, trans, n, arrays(A), lda, batch_count);
+}
+
+hipblasStatus_t hipblasZtransposeBatched(hipblasHandle_t             handle,
+                                         hipblasOperation_t          trans,
+                                         int                         n,
+                                         hipblasDoubleComplex* const A[],
+                                         int                         lda,
+                                         int                         batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, trans, n, A, lda, batch_count);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, A);
+    return transpose(handle, trans, n, arrays(A), lda, batch_count);
+}
+
+// transpose_strided_batched
+hipblasStatus_t hipblasStransposeStridedBatched(hipblasHandle_t    handle,
+                                                hipblasOperation_t trans,
+                                                int                n,
+                                                float*             A,
+                                                int                lda,
+                                                long long          strideA,
+                                                int                batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, trans, n, A, lda, strideA, batch_count);
+    return transpose(handle, trans, n, strided(A, strideA), lda, batch_count);
+}
+
+hipblasStatus_t hipblasDtransposeStridedBatched(hipblasHandle_t    handle,
+                                                hipblasOperation_t trans,
+                                                int                n,
+                                                double*            A,
+                                                int                lda,
+                                                long long          strideA,
+                                                int                batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, trans, n, A, lda, strideA, batch_count);
+    return transpose(handle, trans, n, strided(A, strideA), lda, batch_count);
+}
+
+hipblasStatus_t hipblasCtransposeStridedBatched(hipblasHandle_t    handle,
+                                                hipblasOperation_t trans,
+                                                int                n,
+                                                hipblasComplex*    A,
+                                                int                lda,
+                                                long long          strideA,
+                                                int                batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, trans, n, A, lda, strideA, batch_count);
+    return transpose(handle, trans, n, strided(A, strideA), lda, batch_count);
+}
+
+hipblasStatus_t hipblasZtransposeStridedBatched(hipblasHandle_t       handle,
+                                                hipblasOperation_t    trans,
+                                                int                   n,
+                                                hipblasDoubleComplex* A,
+                                                int                   lda,
+                                                long long             strideA,
+                                                int                   batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, trans, n, A, lda, strideA, batch_count);
+    return transpose(handle, trans, n, strided(A, strideA), lda, batch_count);
+}
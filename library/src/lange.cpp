@@ -0,0 +1,252 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "hipblas_handle.h"
+#include "hipblas_kernels.h"
+#include "hipblas_logging.h"
+#include <algorithm>
+#include <hip/hip_runtime_api.h>
+
+namespace
+{
+    bool valid_norm(hipblasNormType_t norm)
+    {
+        return norm == HIPBLAS_NORM_MAX || norm == HIPBLAS_NORM_ONE || norm == HIPBLAS_NORM_INF
+               || norm == HIPBLAS_NORM_FROBENIUS;
+    }
+
+    template <typename T>
+    hipblas_batched_operand<T> single(T* p)
+    {
+        return {p, 0, nullptr};
+    }
+
+    template <typename T>
+    hipblas_batched_operand<T> strided(T* p, long long stride)
+    {
+        return {p, stride, nullptr};
+    }
+
+    template <typename T>
+    hipblas_batched_operand<T> arrays(T* const* a)
+    {
+        return {nullptr, 0, a};
+    }
+
+    // The norms go to result in device pointer mode; in host pointer mode result is a host array,
+    // filled from the workspace once the stream has finished
+    template <typename T, typename R>
+    hipblasStatus_t lange(hipblasHandle_t                  handle,
+                          hipblasNormType_t                norm,
+                          int                              m,
+                          int                              n,
+                          hipblas_batched_operand<const T> A,
+                          int                              lda,
+                          int                              batch_count,
+                          R*                               result)
+    {
+        if(handle == nullptr)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if(!valid_norm(norm))
+            return HIPBLAS_STATUS_INVALID_ENUM;
+        if(m < 0 || n < 0 || lda < std::max(1, m) || batch_count < 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(batch_count == 0)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(result == nullptr)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        hipStream_t     stream;
+        hipblasStatus_t status = hipblasGetStream(handle, &stream);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        bool device
+            = static_cast<hipblas_handle*>(handle)->pointer_mode == HIPBLAS_POINTER_MODE_DEVICE;
+        size_t work_size = size_t(hipblas_lange_work_size(norm, m, n)) * batch_count;
+        R*     work;
+        R*     out = result;
+        if(device)
+            status = hipblas_workspace_carve(handle, work, work_size);
+        else
+            status = hipblas_workspace_carve(handle, work, work_size, out, size_t(batch_count));
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        if(hipblas_lange_batched(stream, norm, m, n, A, lda, out, work, batch_count) != hipSuccess)
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+        if(device)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(hipMemcpyAsync(result, out, batch_count * sizeof(R), hipMemcpyDeviceToHost, stream)
+               != hipSuccess
+           || hipStreamSynchronize(stream) != hipSuccess)
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+}
+
+// lange
+hipblasStatus_t hipblasSlange(hipblasHandle_t   handle,
+                              hipblasNormType_t norm,
+                              int               m,
+                              int               n,
+                              const float*      A,
+                              int               lda,
+                              float*            result)
+{
+    HIPBLAS_LOG_CALL(handle, norm, m, n, A, lda, result);
+    return lange(handle, norm, m, n, single(A), lda, 1, result);
+}
+
+hipblasStatus_t hipblasDlange(hipblasHandle_t   handle,
+                              hipblasNormType_t norm,
+                              int               m,
+                              int               n,
+                              const double*     A,
+                              int               lda,
+                              double*           result)
+{
+    HIPBLAS_LOG_CALL(handle, norm, m, n, A, lda, result);
+    return lange(handle, norm, m, n, single(A), lda, 1, result);
+}
+
+hipblasStatus_t hipblasClange(hipblasHandle_t       handle,
+                              hipblasNormType_t     norm,
+                              int                   m,
+                              int                   n,
+                              const hipblasComplex* A,
+                              int                   lda,
+                              float*                result)
+{
+    HIPBLAS_LOG_CALL(handle, norm, m, n, A, lda, result);
+    return lange(handle, norm, m, n, single(A), lda, 1, result);
+}
+
+hipblasStatus_t hipblasZlange(hipblasHandle_t             handle,
+                              hipblasNormType_t           norm,
+                              int                         m,
+                              int                         n,
+                              const hipblasDoubleComplex* A,
+                              int                         lda,
+                              double*                     result)
+{
+    HIPBLAS_LOG_CALL(handle, norm, m, n, A, lda, result);
+    return lange(handle, norm, m, n, single(A), lda, 1, result);
+}
+
+// lange_batched
+hipblasStatus_t hipblasSlangeBatched(hipblasHandle_t    handle,
+                                     hipblasNormType_t  norm,
+                                     int                m,
+                                     int                n,
+                                     const float* const A[],
+                                     int                lda,
+                                     int                batch_count,
+                                     float*             result)
+{
+    HIPBLAS_LOG_CALL(handle, norm, m, n, A, lda, batch_count, result);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, A);
+    return lange(handle, norm, m, n, arrays(A), lda, batch_count, result);
+}
+
+hipblasStatus_t hipblasDlangeBatched(hipblasHandle_t     handle,
+                                     hipblasNormType_t   norm,
+                                     int                 m,
+                                     int                 n,
+                                     const double* const A[],
+                                     int                 lda,
+                                     int                 batch_count,
+                                     double*             result)
+{
+    HIPBLAS_LOG_CALL(handle, norm, m, n, A, lda, batch_count, result);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, A);
+    return lange(handle, norm, m, n, arrays(A), lda, batch_count, result);
+}
+
+hipblasStatus_t hipblasClangeBatched(hipblasHandle_t             handle,
+                                     hipblasNormType_t           norm,
+                                     int                         m,
+                                     int                         n,
+                                     const hipblasComplex* const A[],
+                                     int                         lda,
+                                     int                         batch_count,
+                                     float*                      result)
+{
+    HIPBLAS_LOG_CALL(handle, norm, m, n, A, lda, batch_count, result);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, A);
+    return lange(handle, norm, m, n, arrays(A), lda, batch_count, result);
+}
+
+hipblasStatus_t hipblasZlangeBatched(hipblasHandle_t                   handle,
+                                     hipblasNormType_t                 norm,
+                                     int                               m,
+                                     int                               n,
+                                     const hipblasDoubleComplex* const A[],
+                                     int                               lda,
+                                     int                               batch_count,
+                                     double*                           result)
+{
+    HIPBLAS_LOG_CALL(handle, norm, m, n, A, lda, batch_count, result);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, A);
+    return lange(handle, norm, m, n, arrays(A), lda, batch_count, result);
+}
+
+// lange_strided_batched
+hipblasStatus_t hipblasSlangeStridedBatched(hipblasHandle_t   handle,
+                                            hipblasNormType_t norm,
+                                            int               m,
+                                            int               n,
+                                            const float*      A,
+                                            int               lda,
+                                            long long         strideA,
+                                            int               batch_count,
+                                            float*            result)
+{
+    HIPBLAS_LOG_CALL(handle, norm, m, n, A, lda, strideA, batch_count, result);
+    return lange(handle, norm, m, n, strided(A, strideA), lda, batch_count, result);
+}
+
+hipblasStatus_t hipblasDlangeStridedBatched(hipblasHandle_t   handle,
+                                            hipblasNormType_t norm,
+                                            int               m,
+                                            int               n,
+                                            const double*     A,
+                                            int               lda,
+                                            long long         strideA,
+                                            int               batch_count,
+                                            double*           result)
+{
+    HIPBLAS_LOG_CALL(handle, norm, m, n, A, lda, strideA, batch_count, result);
+    return lange(handle, norm, m, n, strided(A, strideA), lda, batch_count, result);
+}
+
+hipblasStatus_t hipblasClangeStridedBatched(hipblasHandle_t       handle,
+                                            hipblasNormType_t     norm,
+                                            int                   m,
+                                            int                   n,
+                                            const hipblasComplex* A,
+                                            int                   lda,
+                                            long long             strideA,
+                                            int                   batch_count,
+                                            float*                result)
+{
+    HIPBLAS_LOG_CALL(handle, norm, m, n, A, lda, strideA, batch_count, result);
+    return lange(handle, norm, m, n, strided(A, strideA), lda, batch_count, result);
+}
+
+hipblasStatus_t hipblasZlangeStridedBatched(hipblasHandle_t             handle,
+                                            hipblasNormType_t           norm,
+                                            int                         m,
+                                            int                         n,
+                                            const hipblasDoubleComplex* A,
+                                            int                         lda,
+                                            long long                   strideA,
+                                            int                         batch_count,
+                                            double*                     result)
+{
+    HIPBLAS_LOG_CALL(handle, norm, m, n, A, lda, strideA, batch_count, result);
+    return lange(handle, norm, m, n, strided(A, strideA), lda, batch_count, result);
+}
+
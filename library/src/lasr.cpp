@@ -0,0 +1,324 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "hipblas_handle.h"
+#include "hipblas_kernels.h"
+#include "hipblas_logging.h"
+#include <algorithm>
+#include <hip/hip_runtime_api.h>
+
+namespace
+{
+    template <typename T>
+    hipblas_batched_operand<T> single(T* p)
+    {
+        return {p, 0, nullptr};
+    }
+
+    template <typename T>
+    hipblas_batched_operand<T> strided(T* p, long long stride)
+    {
+        return {p, stride, nullptr};
+    }
+
+    template <typename T>
+    hipblas_batched_operand<T> arrays(T* const* a)
+    {
+        return {nullptr, 0, a};
+    }
+
+    // The whole sequence is one launch whatever its length, so a GMRES sweep or a QR iteration
+    // costs a single call rather than one rot per rotation
+    template <typename T, typename R>
+    hipblasStatus_t lasr(hipblasHandle_t                  handle,
+                         hipblasSideMode_t                side,
+                         hipblasPivot_t                   pivot,
+                         hipblasDirect_t                  direct,
+                         int                              m,
+                         int                              n,
+                         hipblas_batched_operand<const R> c,
+                         hipblas_batched_operand<const R> s,
+                         hipblas_batched_operand<T>       A,
+                         int                              lda,
+                         int                              batch_count)
+    {
+        if(handle == nullptr)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if((side != HIPBLAS_SIDE_LEFT && side != HIPBLAS_SIDE_RIGHT)
+           || (pivot != HIPBLAS_PIVOT_VARIABLE && pivot != HIPBLAS_PIVOT_TOP
+               && pivot != HIPBLAS_PIVOT_BOTTOM)
+           || (direct != HIPBLAS_FORWARD_DIRECTION && direct != HIPBLAS_BACKWARD_DIRECTION))
+            return HIPBLAS_STATUS_INVALID_ENUM;
+        if(m < 0 || n < 0 || lda < std::max(1, m) || batch_count < 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        // With fewer than two rows or columns to rotate there are no rotations to read
+        int z = side == HIPBLAS_SIDE_LEFT ? m : n;
+        if(z < 2 || (side == HIPBLAS_SIDE_LEFT ? n : m) == 0 || batch_count == 0)
+            return HIPBLAS_STATUS_SUCCESS;
+        if((!c.ptr && !c.array) || (!s.ptr && !s.array) || (!A.ptr && !A.array))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        hipStream_t     stream;
+        hipblasStatus_t status = hipblasGetStream(handle, &stream);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        hipError_t err
+            = hipblas_lasr_batched(stream, side, pivot, direct, m, n, c, s, A, lda, batch_count);
+        return err == hipSuccess ? HIPBLAS_STATUS_SUCCESS : HIPBLAS_STATUS_INTERNAL_ERROR;
+    }
+}
+
+// lasr
+hipblasStatus_t hipblasSlasr(hipblasHandle_t   handle,
+                             hipblasSideMode_t side,
+                             hipblasPivot_t    pivot,
+                             hipblasDirect_t   direct,
+                             int               m,
+                             int               n,
+                             const float*      c,
+                             const float*      s,
+                             float*            A,
+                             int               lda)
+{
+    HIPBLAS_LOG_CALL(handle, side, pivot, direct, m, n, c, s, A, lda);
+    return lasr(handle, side, pivot, direct, m, n, single(c), single(s), single(A), lda, 1);
+}
+
+hipblasStatus_t hipblasDlasr(hipblasHandle_t   handle,
+                             hipblasSideMode_t side,
+                             hipblasPivot_t    pivot,
+                             hipblasDirect_t   direct,
+                             int               m,
+                             int               n,
+                             const double*     c,
+                             const double*     s,
+                             double*           A,
+                             int               lda)
+{
+    HIPBLAS_LOG_CALL(handle, side, pivot, direct, m, n, c, s, A, lda);
+    return lasr(handle, side, pivot, direct, m, n, single(c), single(s), single(A), lda, 1);
+}
+
+hipblasStatus_t hipblasClasr(hipblasHandle_t   handle,
+                             hipblasSideMode_t side,
+                             hipblasPivot_t    pivot,
+                             hipblasDirect_t   direct,
+                             int               m,
+                             int               n,
+                             const float*      c,
+                             const float*      s,
+                             hipblasComplex*   A,
+                             int               lda)
+{
+    HIPBLAS_LOG_CALL(handle, side, pivot, direct, m, n, c, s, A, lda);
+    return lasr(handle, side, pivot, direct, m, n, single(c), single(s), single(A), lda, 1);
+}
+
+hipblasStatus_t hipblasZlasr(hipblasHandle_t       handle,
+                             hipblasSideMode_t     side,
+                             hipblasPivot_t        pivot,
+                             hipblasDirect_t       direct,
+                             int                   m,
+                             int                   n,
+                             const double*         c,
+                             const double*         s,
+                             hipblasDoubleComplex* A,
+                             int                   lda)
+{
+    HIPBLAS_LOG_CALL(handle, side, pivot, direct, m, n, c, s, A, lda);
+    return lasr(handle, side, pivot, direct, m, n, single(c), single(s), single(A), lda, 1);
+}
+
+// lasr_batched
+hipblasStatus_t hipblasSlasrBatched(hipblasHandle_t    handle,
+                                    hipblasSideMode_t  side,
+                                    hipblasPivot_t     pivot,
+                                    hipblasDirect_t    direct,
+                                    int                m,
+                                    int                n,
+                                    const float* const c[],
+                                    const float* const s[],
+                                    float* const       A[],
+                                    int                lda,
+                                    int                batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, side, pivot, direct, m, n, c, s, A, lda, batch_count);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, c, s, A);
+    return lasr(
+        handle, side, pivot, direct, m, n, arrays(c), arrays(s), arrays(A), lda, batch_count);
+}
+
+hipblasStatus_t hipblasDlasrBatched(hipblasHandle_t     handle,
+                                    hipblasSideMode_t   side,
+                                    hipblasPivot_t      pivot,
+                                    hipblasDirect_t     direct,
+                                    int                 m,
+                                    int                 n,
+                                    const double* const c[],
+                                    const double* const s[],
+                                    double* const       A[],
+                                    int                 lda,
+                                    int                 batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, side, pivot, direct, m, n, c, s, A, lda, batch_count);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, c, s, A);
+    return lasr(
+        handle, side, pivot, direct, m, n, arrays(c), arrays(s), arrays(A), lda, batch_count);
+}
+
+hipblasStatus_t hipblasClasrBatched(hipblasHandle_t       handle,
+                                    hipblasSideMode_t     side,
+                                    hipblasPivot_t        pivot,
+                                    hipblasDirect_t       direct,
+                                    int                   m,
+                                    int                   n,
+                                    const float* const    c[],
+                                    const float* const    s[],
+                                    hipblasComplex* const A[],
+                                    int                   lda,
+                                    int                   batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, side, pivot, direct, m, n, c, s, A, lda, batch_count);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, c, s, A);
+    return lasr(
+        handle, side, pivot, direct, m, n, arrays(c), arrays(s), arrays(A), lda, batch_count);
+}
+
+hipblasStatus_t hipblasZlasrBatched(hipblasHandle_t             handle,
+                                    hipblasSideMode_t           side,
+                                    hipblasPivot_t              pivot,
+                                    hipblasDirect_t             direct,
+                                    int                         m,
+                                    int                         n,
+                                    const double* const         c[],
+                                    const double* const         s[],
+                                    hipblasDoubleComplex* const A[],
+                                    int                         lda,
+                                    int                         batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, side, pivot, direct, m, n, c, s, A, lda, batch_count);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, c, s, A);
+    return lasr(
+        handle, side, pivot, direct, m, n, arrays(c), arrays(s), arrays(A), lda, batch_count);
+}
+
+// lasr_strided_batched
+hipblasStatus_t hipblasSlasrStridedBatched(hipblasHandle_t   handle,
+                                           hipblasSideMode_t side,
+                                           hipblasPivot_t    pivot,
+                                           hipblasDirect_t   direct,
+                                           int               m,
+                                           int               n,
+                                           const float*      c,
+                                           const float*      s,
+                                           long long         stridecs,
+                                           float*            A,
+                                           int               lda,
+                                           long long         strideA,
+                                           int               batch_count)
+{
+    HIPBLAS_LOG_CALL(
+        handle, side, pivot, direct, m, n, c, s, stridecs, A, lda, strideA, batch_count);
+    return lasr(handle,
+                side,
+                pivot,
+                direct,
+                m,
+                n,
+                strided(c, stridecs),
+                strided(s, stridecs),
+                strided(A, strideA),
+                lda,
+                batch_count);
+}
+
+hipblasStatus_t hipblasDlasrStridedBatched(hipblasHandle_t   handle,
+                                           hipblasSideMode_t side,
+                                           hipblasPivot_t    pivot,
+                                           hipblasDirect_t   direct,
+                                           int               m,
+                                           int               n,
+                                           const double*     c,
+                                           const double*     s,
+                                           long long         stridecs,
+                                           double*           A,
+                                           int               lda,
+                                           long long         strideA,
+                                           int               batch_count)
+{
+    HIPBLAS_LOG_CALL(
+        handle, side, pivot, direct, m, n, c, s, stridecs, A, lda, strideA, batch_count);
+    return lasr(handle,
+                side,
+                pivot,
+                direct,
+                m,
+                n,
+                strided(c, stridecs),
+                strided(s, stridecs),
+                strided(A, strideA),
+                lda,
+                batch_count);
+}
+
+hipblasStatus_t hipblasClasrStridedBatched(hipblasHandle_t   handle,
+                                           hipblasSideMode_t side,
+                                           hipblasPivot_t    pivot,
+                                           hipblasDirect_t   direct,
+                                           int               m,
+                                           int               n,
+                                           const float*      c,
+                                           const float*      s,
+                                           long long         stridecs,
+                                           hipblasComplex*   A,
+                                           int               lda,
+                                           long long         strideA,
+                                           int               batch_count)
+{
+    HIPBLAS_LOG_CALL(
+        handle, side, pivot, direct, m, n, c, s, stridecs, A, lda, strideA, batch_count);
+    return lasr(handle,
+                side,
+                pivot,
+                direct,
+                m,
+                n,
+                strided(c, stridecs),
+                strided(s, stridecs),
+                strided(A, strideA),
+                lda,
+                batch_count);
+}
+
+hipblasStatus_t hipblasZlasrStridedBatched(hipblasHandle_t       handle,
+                                           hipblasSideMode_t     side,
+                                           hipblasPivot_t        pivot,
+                                           hipblasDirect_t       direct,
+                                           int                   m,
+                                           int                   n,
+                                           const double*         c,
+                                           const double*         s,
+                                           long long             stridecs,
+                                           hipblasDoubleComplex* A,
+                                           int                   lda,
+                                           long long             strideA,
+                                           int                   batch_count)
+{
+    HIPBLAS_LOG_CALL(
+        handle, side, pivot, direct, m, n, c, s, stridecs, A, lda, strideA, batch_count);
+    return lasr(handle,
+                side,
+                pivot,
+                direct,
+                m,
+                n,
+                strided(c, stridecs),
+                strided(s, stridecs),
+                strided(A, strideA),
+                lda,
+                batch_count);
+}
@@ -0,0 +1,145 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "hipblas_handle.h"
+#include "hipblas_logging.h"
+#include <climits>
+#include <cstring>
+#include <hip/hip_runtime_api.h>
+#include <mutex>
+#include <vector>
+
+namespace
+{
+    // Columns start on a multiple of align bytes and are never a multiple of interleave bytes
+    // apart, the span after which addresses come back to the same memory channel
+    struct ld_layout
+    {
+        int align;
+        int interleave;
+    };
+
+    // By gcnArchName prefix; CUDA devices and architectures not listed take the last entry
+    struct ld_arch
+    {
+        const char* prefix;
+        ld_layout   layout;
+    };
+
+    const ld_arch LD_ARCHS[] = {
+        {"gfx803", {128, 2048}}, // 8 channels of 256 bytes
+        {"gfx900", {128, 4096}}, // 16 channels
+        {"gfx906", {128, 4096}},
+        {"gfx908", {128, 8192}}, // 32 channels
+        {"gfx90a", {128, 8192}},
+        {"gfx10", {128, 4096}},
+        {"", {128, 4096}},
+    };
+
+    ld_layout arch_layout(const char* arch)
+    {
+        for(const ld_arch& a : LD_ARCHS)
+            if(!std::strncmp(arch, a.prefix, std::strlen(a.prefix)))
+                return a.layout;
+        return LD_ARCHS[sizeof(LD_ARCHS) / sizeof(LD_ARCHS[0]) - 1].layout;
+    }
+
+    // hipGetDeviceProperties is too slow to call per query, so each device is looked up once
+    bool device_layout(int device, ld_layout& layout)
+    {
+        static std::mutex             mutex;
+        static std::vector<ld_layout> layouts;
+        static std::vector<bool>      known;
+
+        std::lock_guard<std::mutex> lock(mutex);
+        if(device < 0)
+            return false;
+        if(size_t(device) >= known.size())
+        {
+            layouts.resize(device + 1);
+            known.resize(device + 1, false);
+        }
+        if(!known[device])
+        {
+            hipDeviceProp_t props;
+            if(hipGetDeviceProperties(&props, device) != hipSuccess)
+                return false;
+            layouts[device] = arch_layout(props.gcnArchName);
+            known[device]   = true;
+        }
+        layout = layouts[device];
+        return true;
+    }
+
+    // rows rounded up to whole align-byte steps, one more step when that lands on the interleave;
+    // columns narrower than a step are not padded
+    int padded_ld(int rows, int elem_size, const ld_layout& layout)
+    {
+        if(rows <= 1)
+            return 1;
+        int64_t bytes = int64_t(rows) * elem_size;
+        if(bytes < layout.align || layout.align % elem_size)
+            return rows;
+
+        int64_t step = layout.align / elem_size;
+        int64_t ld   = (rows + step - 1) / step * step;
+        if(ld * elem_size % layout.interleave == 0)
+            ld += step;
+        return ld > INT_MAX ? rows : int(ld);
+    }
+}
+
+hipblasStatus_t
+    hipblasGetOptimalLeadingDimension(hipblasHandle_t handle, int rows, int elemSize, int* ld)
+{
+    HIPBLAS_LOG_CALL(handle, rows, elemSize, ld);
+    if(handle == nullptr)
+    {
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    }
+    if(ld == nullptr || rows < 0 || elemSize <= 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+
+    ld_layout layout;
+    if(!device_layout(static_cast<hipblas_handle*>(handle)->device, layout))
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+    *ld = padded_ld(rows, elemSize, layout);
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblasMallocMatrix(
+    hipblasHandle_t handle, int rows, int cols, int elemSize, void** ptr, int* ld)
+{
+    HIPBLAS_LOG_CALL(handle, rows, cols, elemSize, ptr, ld);
+    if(handle == nullptr)
+    {
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    }
+    if(ptr == nullptr || ld == nullptr || cols < 0)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    *ptr = nullptr;
+
+    hipblasStatus_t status = hipblasGetOptimalLeadingDimension(handle, rows, elemSize, ld);
+    if(status != HIPBLAS_STATUS_SUCCESS || rows == 0 || cols == 0)
+        return status;
+
+    // The memory belongs to the handle's device, whichever device is current
+    int current;
+    if(hipGetDevice(&current) != hipSuccess
+       || hipSetDevice(static_cast<hipblas_handle*>(handle)->device) != hipSuccess)
+        return HIPBLAS_STATUS_INTERNAL_ERROR;
+    hipError_t err = hipMalloc(ptr, size_t(*ld) * cols * elemSize);
+    (void)hipSetDevice(current);
+    if(err != hipSuccess)
+    {
+        *ptr = nullptr;
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+    }
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,1693 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "hipblas_handle.h"
+#include "hipblas_kernels.h"
+#include "hipblas_logging.h"
+#include <hip/hip_runtime_api.h>
+
+// The fused level-1 routines run on the library's own kernels on both backends, so each call is
+// one pass over its vectors; mdot and axpyDot add a short second launch summing the partial dots
+namespace
+{
+    hipblasStatus_t launch_status(hipError_t err)
+    {
+        return err == hipSuccess ? HIPBLAS_STATUS_SUCCESS : HIPBLAS_STATUS_INTERNAL_ERROR;
+    }
+
+    bool device_pointer_mode(hipblasHandle_t handle)
+    {
+        return static_cast<hipblas_handle*>(handle)->pointer_mode == HIPBLAS_POINTER_MODE_DEVICE;
+    }
+
+    template <typename T>
+    hipblas_batched_operand<T> single(T* p)
+    {
+        return {p, 0, nullptr};
+    }
+
+    template <typename T>
+    hipblas_batched_operand<T> strided(T* p, int stride)
+    {
+        return {p, stride, nullptr};
+    }
+
+    template <typename T>
+    hipblas_batched_operand<T> arrays(T* const* a)
+    {
+        return {nullptr, 0, a};
+    }
+
+    template <typename T>
+    hipblasStatus_t waxpby(hipblasHandle_t                  handle,
+                           int                              n,
+                           const T*                         alpha,
+                           hipblas_batched_operand<const T> x,
+                           int                              incx,
+                           const T*                         beta,
+                           hipblas_batched_operand<const T> y,
+                           int                              incy,
+                           hipblas_batched_operand<T>       w,
+                           int                              incw,
+                           int                              batch_count)
+    {
+        if(handle == nullptr)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if(batch_count < 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(n <= 0 || batch_count == 0)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(alpha == nullptr || beta == nullptr)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        hipStream_t     stream;
+        hipblasStatus_t status = hipblasGetStream(handle, &stream);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        return launch_status(hipblas_axpby_batched(stream,
+                                                   n,
+                                                   alpha,
+                                                   beta,
+                                                   device_pointer_mode(handle),
+                                                   hipblas_scalar_stride(handle),
+                                                   x,
+                                                   incx,
+                                                   y,
+                                                   incy,
+                                                   w,
+                                                   incw,
+                                                   batch_count));
+    }
+
+    // w = alpha * x + beta * y with w = y
+    template <typename T>
+    hipblasStatus_t axpby(hipblasHandle_t                  handle,
+                          int                              n,
+                          const T*                         alpha,
+                          hipblas_batched_operand<const T> x,
+                          int                              incx,
+                          const T*                         beta,
+                          hipblas_batched_operand<T>       y,
+                          int                              incy,
+                          int                              batch_count)
+    {
+        hipblas_batched_operand<const T> in = {y.ptr, y.stride, y.array};
+        return waxpby(handle, n, alpha, x, incx, beta, in, incy, y, incy, batch_count);
+    }
+
+    // Runs launch(stream, results, work) with count results in device memory and the partial sums
+    // in the workspace; in host pointer mode result is a host array, filled from the workspace
+    // once the stream has finished
+    template <typename T, typename F>
+    hipblasStatus_t
+        fused_dot(hipblasHandle_t handle, T* result, int64_t count, int64_t partials, F launch)
+    {
+        if(count == 0)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(result == nullptr)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        hipStream_t     stream;
+        hipblasStatus_t status = hipblasGetStream(handle, &stream);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        bool device = device_pointer_mode(handle);
+        T*   work;
+        T*   out = result;
+        if(device)
+            status = hipblas_workspace_carve(handle, work, size_t(partials));
+        else
+            status = hipblas_workspace_carve(handle, work, size_t(partials), out, size_t(count));
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        if(launch(stream, out, work) != hipSuccess)
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+        if(device)
+            return HIPBLAS_STATUS_SUCCESS;
+
+        if(hipMemcpyAsync(result, out, count * sizeof(T), hipMemcpyDeviceToHost, stream)
+               != hipSuccess
+           || hipStreamSynchronize(stream) != hipSuccess)
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    template <typename T>
+    hipblasStatus_t mdot(hipblasHandle_t                  handle,
+                         int                              n,
+                         int                              k,
+                         hipblas_batched_operand<const T> x,
+                         int                              incx,
+                         hipblas_batched_operand<const T> Y,
+                         int                              ldy,
+                         int                              incy,
+                         bool                             conj,
+                         int                              batch_count,
+                         T*                               result)
+    {
+        if(handle == nullptr)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if(k < 0 || batch_count < 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        int64_t count = int64_t(k) * batch_count;
+        return fused_dot(
+            handle,
+            result,
+            count,
+            hipblas_fused_dot_blocks(n) * count,
+            [&](hipStream_t stream, T* out, T* work) {
+                return hipblas_mdot_batched(
+                    stream, n, k, x, incx, Y, ldy, incy, conj, out, work, batch_count);
+            });
+    }
+
+    template <typename T>
+    hipblasStatus_t axpy_dot(hipblasHandle_t                  handle,
+                             int                              n,
+                             const T*                         alpha,
+                             hipblas_batched_operand<const T> x,
+                             int                              incx,
+                             hipblas_batched_operand<T>       y,
+                             int                              incy,
+                             hipblas_batched_operand<const T> z,
+                             int                              incz,
+                             bool                             conj,
+                             int                              batch_count,
+                             T*                               result)
+    {
+        if(handle == nullptr)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if(batch_count < 0 || alpha == nullptr)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        bool    device = device_pointer_mode(handle);
+        int64_t stride = hipblas_scalar_stride(handle);
+        return fused_dot(
+            handle,
+            result,
+            batch_count,
+            int64_t(hipblas_fused_dot_blocks(n)) * batch_count,
+            [&](hipStream_t stream, T* out, T* work) {
+                return hipblas_axpy_dot_batched(stream,
+                                                n,
+                                                alpha,
+                                                device,
+                                                stride,
+                                                x,
+                                                incx,
+                                                y,
+                                                incy,
+                                                z,
+                                                incz,
+                                                conj,
+                                                out,
+                                                work,
+                                                batch_count);
+            });
+    }
+}
+
+// axpby
+hipblasStatus_t hipblasSaxpby(hipblasHandle_t handle,
+                              int             n,
+                              const float*    alpha,
+                              const float*    x,
+                              int             incx,
+                              const float*    beta,
+                              float*          y,
+                              int             incy)
+{
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, beta, y, incy);
+    return axpby(handle, n, alpha, single(x), incx, beta, single(y), incy, 1);
+}
+
+hipblasStatus_t hipblasDaxpby(hipblasHandle_t handle,
+                              int             n,
+                              const double*   alpha,
+                              const double*   x,
+                              int             incx,
+                              const double*   beta,
+                              double*         y,
+                              int             incy)
+{
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, beta, y, incy);
+    return axpby(handle, n, alpha, single(x), incx, beta, single(y), incy, 1);
+}
+
+hipblasStatus_t hipblasCaxpby(hipblasHandle_t       handle,
+                              int                   n,
+                              const hipblasComplex* alpha,
+                              const hipblasComplex* x,
+                              int                   incx,
+                              const hipblasComplex* beta,
+                              hipblasComplex*       y,
+                              int                   incy)
+{
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, beta, y, incy);
+    return axpby(handle, n, alpha, single(x), incx, beta, single(y), incy, 1);
+}
+
+hipblasStatus_t hipblasZaxpby(hipblasHandle_t             handle,
+                              int                         n,
+                              const hipblasDoubleComplex* alpha,
+                              const hipblasDoubleComplex* x,
+                              int                         incx,
+                              const hipblasDoubleComplex* beta,
+                              hipblasDoubleComplex*       y,
+                              int                         incy)
+{
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, beta, y, incy);
+    return axpby(handle, n, alpha, single(x), incx, beta, single(y), incy, 1);
+}
+
+// axpby_batched
+hipblasStatus_t hipblasSaxpbyBatched(hipblasHandle_t    handle,
+                                     int                n,
+                                     const float*       alpha,
+                                     const float* const x[],
+                                     int                incx,
+                                     const float*       beta,
+                                     float* const       y[],
+                                     int                incy,
+                                     int                batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, beta, y, incy, batch_count);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, x, y);
+    return axpby(handle, n, alpha, arrays(x), incx, beta, arrays(y), incy, batch_count);
+}
+
+hipblasStatus_t hipblasDaxpbyBatched(hipblasHandle_t     handle,
+                                     int                 n,
+                                     const double*       alpha,
+                                     const double* const x[],
+                                     int                 incx,
+                                     const double*       beta,
+                                     double* const       y[],
+                                     int                 incy,
+                                     int                 batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, beta, y, incy, batch_count);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, x, y);
+    return axpby(handle, n, alpha, arrays(x), incx, beta, arrays(y), incy, batch_count);
+}
+
+hipblasStatus_t hipblasCaxpbyBatched(hipblasHandle_t             handle,
+                                     int                         n,
+                                     const hipblasComplex*       alpha,
+                                     const hipblasComplex* const x[],
+                                     int                         incx,
+                                     const hipblasComplex*       beta,
+                                     hipblasComplex* const       y[],
+                                     int                         incy,
+                                     int                         batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, beta, y, incy, batch_count);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, x, y);
+    return axpby(handle, n, alpha, arrays(x), incx, beta, arrays(y), incy, batch_count);
+}
+
+hipblasStatus_t hipblasZaxpbyBatched(hipblasHandle_t                   handle,
+                                     int                               n,
+                                     const hipblasDoubleComplex*       alpha,
+                                     const hipblasDoubleComplex* const x[],
+                                     int                               incx,
+                                     const hipblasDoubleComplex*       beta,
+                                     hipblasDoubleComplex* const       y[],
+                                     int                               incy,
+                                     int                               batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, beta, y, incy, batch_count);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, x, y);
+    return axpby(handle, n, alpha, arrays(x), incx, beta, arrays(y), incy, batch_count);
+}
+
+// axpby_strided_batched
+hipblasStatus_t hipblasSaxpbyStridedBatched(hipblasHandle_t handle,
+                                            int             n,
+                                            const float*    alpha,
+                                            const float*    x,
+                                            int             incx,
+                                            int             stridex,
+                                            const float*    beta,
+                                            float*          y,
+                                            int             incy,
+                                            int             stridey,
+                                            int             batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, stridex, beta, y, incy, stridey, batch_count);
+    return axpby(handle,
+                 n,
+                 alpha,
+                 strided(x, stridex),
+                 incx,
+                 beta,
+                 strided(y, stridey),
+                 incy,
+                 batch_count);
+}
+
+hipblasStatus_t hipblasDaxpbyStridedBatched(hipblasHandle_t handle,
+                                            int             n,
+                                            const double*   alpha,
+                                            const double*   x,
+                                            int             incx,
+                                            int             stridex,
+                                            const double*   beta,
+                                            double*         y,
+                                            int             incy,
+                                            int             stridey,
+                                            int             batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, stridex, beta, y, incy, stridey, batch_count);
+    return axpby(handle,
+                 n,
+                 alpha,
+                 strided(x, stridex),
+                 incx,
+                 beta,
+                 strided(y, stridey),
+                 incy,
+                 batch_count);
+}
+
+hipblasStatus_t hipblasCaxpbyStridedBatched(hipblasHandle_t       handle,
+                                            int                   n,
+                                            const hipblasComplex* alpha,
+                                            const hipblasComplex* x,
+                                            int                   incx,
+                                            int                   stridex,
+                                            const hipblasComplex* beta,
+                                            hipblasComplex*       y,
+                                            int                   incy,
+                                            int                   stridey,
+                                            int                   batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, stridex, beta, y, incy, stridey, batch_count);
+    return axpby(handle,
+                 n,
+                 alpha,
+                 strided(x, stridex),
+                 incx,
+                 beta,
+                 strided(y, stridey),
+                 incy,
+                 batch_count);
+}
+
+hipblasStatus_t hipblasZaxpbyStridedBatched(hipblasHandle_t             handle,
+                                            int                         n,
+                                            const hipblasDoubleComplex* alpha,
+                                            const hipblasDoubleComplex* x,
+                                            int                         incx,
+                                            int                         stridex,
+                                            const hipblasDoubleComplex* beta,
+                                            hipblasDoubleComplex*       y,
+                                            int                         incy,
+                                            int                         stridey,
+                                            int                         batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, stridex, beta, y, incy, stridey, batch_count);
+    return axpby(handle,
+                 n,
+                 alpha,
+                 strided(x, stridex),
+                 incx,
+                 beta,
+                 strided(y, stridey),
+                 incy,
+                 batch_count);
+}
+
+// waxpby
+hipblasStatus_t hipblasSwaxpby(hipblasHandle_t handle,
+                               int             n,
+                               const float*    alpha,
+                               const float*    x,
+                               int             incx,
+                               const float*    beta,
+                               const float*    y,
+                               int             incy,
+                               float*          w,
+                               int             incw)
+{
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, beta, y, incy, w, incw);
+    return waxpby(handle, n, alpha, single(x), incx, beta, single(y), incy, single(w), incw, 1);
+}
+
+hipblasStatus_t hipblasDwaxpby(hipblasHandle_t handle,
+                               int             n,
+                               const double*   alpha,
+                               const double*   x,
+                               int             incx,
+                               const double*   beta,
+                               const double*   y,
+                               int             incy,
+                               double*         w,
+                               int             incw)
+{
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, beta, y, incy, w, incw);
+    return waxpby(handle, n, alpha, single(x), incx, beta, single(y), incy, single(w), incw, 1);
+}
+
+hipblasStatus_t hipblasCwaxpby(hipblasHandle_t       handle,
+                               int                   n,
+                               const hipblasComplex* alpha,
+                               const hipblasComplex* x,
+                               int                   incx,
+                               const hipblasComplex* beta,
+                               const hipblasComplex* y,
+                               int                   incy,
+                               hipblasComplex*       w,
+                               int                   incw)
+{
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, beta, y, incy, w, incw);
+    return waxpby(handle, n, alpha, single(x), incx, beta, single(y), incy, single(w), incw, 1);
+}
+
+hipblasStatus_t hipblasZwaxpby(hipblasHandle_t             handle,
+                               int                         n,
+                               const hipblasDoubleComplex* alpha,
+                               const hipblasDoubleComplex* x,
+                               int                         incx,
+                               const hipblasDoubleComplex* beta,
+                               const hipblasDoubleComplex* y,
+                               int                         incy,
+                               hipblasDoubleComplex*       w,
+                               int                         incw)
+{
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, beta, y, incy, w, incw);
+    return waxpby(handle, n, alpha, single(x), incx, beta, single(y), incy, single(w), incw, 1);
+}
+
+// waxpby_batched
+hipblasStatus_t hipblasSwaxpbyBatched(hipblasHandle_t    handle,
+                                      int                n,
+                                      const float*       alpha,
+                                      const float* const x[],
+                                      int                incx,
+                                      const float*       beta,
+                                      const float* const y[],
+                                      int                incy,
+                                      float* const       w[],
+                                      int                incw,
+                                      int                batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, beta, y, incy, w, incw, batch_count);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, x, y, w);
+    return waxpby(handle,
+                  n,
+                  alpha,
+                  arrays(x),
+                  incx,
+                  beta,
+                  arrays(y),
+                  incy,
+                  arrays(w),
+                  incw,
+                  batch_count);
+}
+
+hipblasStatus_t hipblasDwaxpbyBatched(hipblasHandle_t     handle,
+                                      int                 n,
+                                      const double*       alpha,
+                                      const double* const x[],
+                                      int                 incx,
+                                      const double*       beta,
+                                      const double* const y[],
+                                      int                 incy,
+                                      double* const       w[],
+                                      int                 incw,
+                                      int                 batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, beta, y, incy, w, incw, batch_count);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, x, y, w);
+    return waxpby(handle,
+                  n,
+                  alpha,
+                  arrays(x),
+                  incx,
+                  beta,
+                  arrays(y),
+                  incy,
+                  arrays(w),
+                  incw,
+                  batch_count);
+}
+
+hipblasStatus_t hipblasCwaxpbyBatched(hipblasHandle_t             handle,
+                                      int                         n,
+                                      const hipblasComplex*       alpha,
+                                      const hipblasComplex* const x[],
+                                      int                         incx,
+                                      const hipblasComplex*       beta,
+                                      const hipblasComplex* const y[],
+                                      int                         incy,
+                                      hipblasComplex* const       w[],
+                                      int                         incw,
+                                      int                         batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, beta, y, incy, w, incw, batch_count);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, x, y, w);
+    return waxpby(handle,
+                  n,
+                  alpha,
+                  arrays(x),
+                  incx,
+                  beta,
+                  arrays(y),
+                  incy,
+                  arrays(w),
+                  incw,
+                  batch_count);
+}
+
+hipblasStatus_t hipblasZwaxpbyBatched(hipblasHandle_t                   handle,
+                                      int                               n,
+                                      const hipblasDoubleComplex*       alpha,
+                                      const hipblasDoubleComplex* const x[],
+                                      int                               incx,
+                                      const hipblasDoubleComplex*       beta,
+                                      const hipblasDoubleComplex* const y[],
+                                      int                               incy,
+                                      hipblasDoubleComplex* const       w[],
+                                      int                               incw,
+                                      int                               batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, beta, y, incy, w, incw, batch_count);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, x, y, w);
+    return waxpby(handle,
+                  n,
+                  alpha,
+                  arrays(x),
+                  incx,
+                  beta,
+                  arrays(y),
+                  incy,
+                  arrays(w),
+                  incw,
+                  batch_count);
+}
+
+// waxpby_strided_batched
+hipblasStatus_t hipblasSwaxpbyStridedBatched(hipblasHandle_t handle,
+                                             int             n,
+                                             const float*    alpha,
+                                             const float*    x,
+                                             int             incx,
+                                             int             stridex,
+                                             const float*    beta,
+                                             const float*    y,
+                                             int             incy,
+                                             int             stridey,
+                                             float*          w,
+                                             int             incw,
+                                             int             stridew,
+                                             int             batch_count)
+{
+    HIPBLAS_LOG_CALL(handle,
+                     n,
+                     alpha,
+                     x,
+                     incx,
+                     stridex,
+                     beta,
+                     y,
+                     incy,
+                     stridey,
+                     w,
+                     incw,
+                     stridew,
+                     batch_count);
+    return waxpby(handle,
+                  n,
+                  alpha,
+                  strided(x, stridex),
+                  incx,
+                  beta,
+                  strided(y, stridey),
+                  incy,
+                  strided(w, stridew),
+                  incw,
+                  batch_count);
+}
+
+hipblasStatus_t hipblasDwaxpbyStridedBatched(hipblasHandle_t handle,
+                                             int             n,
+                                             const double*   alpha,
+                                             const double*   x,
+                                             int             incx,
+                                             int             stridex,
+                                             const double*   beta,
+                                             const double*   y,
+                                             int             incy,
+                                             int             stridey,
+                                             double*         w,
+                                             int             incw,
+                                             int             stridew,
+                                             int             batch_count)
+{
+    HIPBLAS_LOG_CALL(handle,
+                     n,
+                     alpha,
+                     x,
+                     incx,
+                     stridex,
+                     beta,
+                     y,
+                     incy,
+                     stridey,
+                     w,
+                     incw,
+                     stridew,
+                     batch_count);
+    return waxpby(handle,
+                  n,
+                  alpha,
+                  strided(x, stridex),
+                  incx,
+                  beta,
+                  strided(y, stridey),
+                  incy,
+                  strided(w, stridew),
+                  incw,
+                  batch_count);
+}
+
+hipblasStatus_t hipblasCwaxpbyStridedBatched(hipblasHandle_t       handle,
+                                             int                   n,
+                                             const hipblasComplex* alpha,
+                                             const hipblasComplex* x,
+                                             int                   incx,
+                                             int                   stridex,
+                                             const hipblasComplex* beta,
+                                             const hipblasComplex* y,
+                                             int                   incy,
+                                             int                   stridey,
+                                             hipblasComplex*       w,
+                                             int                   incw,
+                                             int                   stridew,
+                                             int                   batch_count)
+{
+    HIPBLAS_LOG_CALL(handle,
+                     n,
+                     alpha,
+                     x,
+                     incx,
+                     stridex,
+                     beta,
+                     y,
+                     incy,
+                     stridey,
+                     w,
+                     incw,
+                     stridew,
+                     batch_count);
+    return waxpby(handle,
+                  n,
+                  alpha,
+                  strided(x, stridex),
+                  incx,
+                  beta,
+                  strided(y, stridey),
+                  incy,
+                  strided(w, stridew),
+                  incw,
+                  batch_count);
+}
+
+hipblasStatus_t hipblasZwaxpbyStridedBatched(hipblasHandle_t             handle,
+                                             int                         n,
+                                             const hipblasDoubleComplex* alpha,
+                                             const hipblasDoubleComplex* x,
+                                             int                         incx,
+                                             int                         stridex,
+                                             const hipblasDoubleComplex* beta,
+                                             const hipblasDoubleComplex* y,
+                                             int                         incy,
+                                             int                         stridey,
+                                             hipblasDoubleComplex*       w,
+                                             int                         incw,
+                                             int                         stridew,
+                                             int                         batch_count)
+{
+    HIPBLAS_LOG_CALL(handle,
+                     n,
+                     alpha,
+                     x,
+                     incx,
+                     stridex,
+                     beta,
+                     y,
+                     incy,
+                     stridey,
+                     w,
+                     incw,
+                     stridew,
+                     batch_count);
+    return waxpby(handle,
+                  n,
+                  alpha,
+                  strided(x, stridex),
+                  incx,
+                  beta,
+                  strided(y, stridey),
+                  incy,
+                  strided(w, stridew),
+                  incw,
+                  batch_count);
+}
+
+// mdot
+hipblasStatus_t hipblasSmdot(hipblasHandle_t handle,
+                             int             n,
+                             int             k,
+                             const float*    x,
+                             int             incx,
+                             const float*    Y,
+                             int             ldy,
+                             int             incy,
+                             float*          result)
+{
+    HIPBLAS_LOG_CALL(handle, n, k, x, incx, Y, ldy, incy, result);
+    return mdot(handle, n, k, single(x), incx, single(Y), ldy, incy, false, 1, result);
+}
+
+hipblasStatus_t hipblasDmdot(hipblasHandle_t handle,
+                             int             n,
+                             int             k,
+                             const double*   x,
+                             int             incx,
+                             const double*   Y,
+                             int             ldy,
+                             int             incy,
+                             double*         result)
+{
+    HIPBLAS_LOG_CALL(handle, n, k, x, incx, Y, ldy, incy, result);
+    return mdot(handle, n, k, single(x), incx, single(Y), ldy, incy, false, 1, result);
+}
+
+hipblasStatus_t hipblasCmdotu(hipblasHandle_t       handle,
+                              int                   n,
+                              int                   k,
+                              const hipblasComplex* x,
+                              int                   incx,
+                              const hipblasComplex* Y,
+                              int                   ldy,
+                              int                   incy,
+                              hipblasComplex*       result)
+{
+    HIPBLAS_LOG_CALL(handle, n, k, x, incx, Y, ldy, incy, result);
+    return mdot(handle, n, k, single(x), incx, single(Y), ldy, incy, false, 1, result);
+}
+
+hipblasStatus_t hipblasCmdotc(hipblasHandle_t       handle,
+                              int                   n,
+                              int                   k,
+                              const hipblasComplex* x,
+                              int                   incx,
+                              const hipblasComplex* Y,
+                              int                   ldy,
+                              int                   incy,
+                              hipblasComplex*       result)
+{
+    HIPBLAS_LOG_CALL(handle, n, k, x, incx, Y, ldy, incy, result);
+    return mdot(handle, n, k, single(x), incx, single(Y), ldy, incy, true, 1, result);
+}
+
+hipblasStatus_t hipblasZmdotu(hipblasHandle_t             handle,
+                              int                         n,
+                              int                         k,
+                              const hipblasDoubleComplex* x,
+                              int                         incx,
+                              const hipblasDoubleComplex* Y,
+                              int                         ldy,
+                              int                         incy,
+                              hipblasDoubleComplex*       result)
+{
+    HIPBLAS_LOG_CALL(handle, n, k, x, incx, Y, ldy, incy, result);
+    return mdot(handle, n, k, single(x), incx, single(Y), ldy, incy, false, 1, result);
+}
+
+hipblasStatus_t hipblasZmdotc(hipblasHandle_t             handle,
+                              int                         n,
+                              int                         k,
+                              const hipblasDoubleComplex* x,
+                              int                         incx,
+                              const hipblasDoubleComplex* Y,
+                              int                         ldy,
+                              int                         incy,
+                              hipblasDoubleComplex*       result)
+{
+    HIPBLAS_LOG_CALL(handle, n, k, x, incx, Y, ldy, incy, result);
+    return mdot(handle, n, k, single(x), incx, single(Y), ldy, incy, true, 1, result);
+}
+
+// mdot_batched
+hipblasStatus_t hipblasSmdotBatched(hipblasHandle_t    handle,
+                                    int                n,
+                                    int                k,
+                                    const float* const x[],
+                                    int                incx,
+                                    const float* const Y[],
+                                    int                ldy,
+                                    int                incy,
+                                    int                batch_count,
+                                    float*             result)
+{
+    HIPBLAS_LOG_CALL(handle, n, k, x, incx, Y, ldy, incy, batch_count, result);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, x, Y);
+    return mdot(handle, n, k, arrays(x), incx, arrays(Y), ldy, incy, false, batch_count, result);
+}
+
+hipblasStatus_t hipblasDmdotBatched(hipblasHandle_t     handle,
+                                    int                 n,
+                                    int                 k,
+                                    const double* const x[],
+                                    int                 incx,
+                                    const double* const Y[],
+                                    int                 ldy,
+                                    int                 incy,
+                                    int                 batch_count,
+                                    double*             result)
+{
+    HIPBLAS_LOG_CALL(handle, n, k, x, incx, Y, ldy, incy, batch_count, result);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, x, Y);
+    return mdot(handle, n, k, arrays(x), incx, arrays(Y), ldy, incy, false, batch_count, result);
+}
+
+hipblasStatus_t hipblasCmdotuBatched(hipblasHandle_t             handle,
+                                     int                         n,
+                                     int                         k,
+                                     const hipblasComplex* const x[],
+                                     int                         incx,
+                                     const hipblasComplex* const Y[],
+                                     int                         ldy,
+                                     int                         incy,
+                                     int                         batch_count,
+                                     hipblasComplex*             result)
+{
+    HIPBLAS_LOG_CALL(handle, n, k, x, incx, Y, ldy, incy, batch_count, result);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, x, Y);
+    return mdot(handle, n, k, arrays(x), incx, arrays(Y), ldy, incy, false, batch_count, result);
+}
+
+hipblasStatus_t hipblasCmdotcBatched(hipblasHandle_t             handle,
+                                     int                         n,
+                                     int                         k,
+                                     const hipblasComplex* const x[],
+                                     int                         incx,
+                                     const hipblasComplex* const Y[],
+                                     int                         ldy,
+                                     int                         incy,
+                                     int                         batch_count,
+                                     hipblasComplex*             result)
+{
+    HIPBLAS_LOG_CALL(handle, n, k, x, incx, Y, ldy, incy, batch_count, result);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, x, Y);
+    return mdot(handle, n, k, arrays(x), incx, arrays(Y), ldy, incy, true, batch_count, result);
+}
+
+hipblasStatus_t hipblasZmdotuBatched(hipblasHandle_t                   handle,
+                                     int                               n,
+                                     int                               k,
+                                     const hipblasDoubleComplex* const x[],
+                                     int                               incx,
+                                     const hipblasDoubleComplex* const Y[],
+                                     int                               ldy,
+                                     int                               incy,
+                                     int                               batch_count,
+                                     hipblasDoubleComplex*             result)
+{
+    HIPBLAS_LOG_CALL(handle, n, k, x, incx, Y, ldy, incy, batch_count, result);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, x, Y);
+    return mdot(handle, n, k, arrays(x), incx, arrays(Y), ldy, incy, false, batch_count, result);
+}
+
+hipblasStatus_t hipblasZmdotcBatched(hipblasHandle_t                   handle,
+                                     int                               n,
+                                     int                               k,
+                                     const hipblasDoubleComplex* const x[],
+                                     int                               incx,
+                                     const hipblasDoubleComplex* const Y[],
+                                     int                               ldy,
+                                     int                               incy,
+                                     int                               batch_count,
+                                     hipblasDoubleComplex*             result)
+{
+    HIPBLAS_LOG_CALL(handle, n, k, x, incx, Y, ldy, incy, batch_count, result);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, x, Y);
+    return mdot(handle, n, k, arrays(x), incx, arrays(Y), ldy, incy, true, batch_count, result);
+}
+
+// mdot_strided_batched
+hipblasStatus_t hipblasSmdotStridedBatched(hipblasHandle_t handle,
+                                           int             n,
+                                           int             k,
+                                           const float*    x,
+                                           int             incx,
+                                           int             stridex,
+                                           const float*    Y,
+                                           int             ldy,
+                                           int             incy,
+                                           int             strideY,
+                                           int             batch_count,
+                                           float*          result)
+{
+    HIPBLAS_LOG_CALL(handle, n, k, x, incx, stridex, Y, ldy, incy, strideY, batch_count, result);
+    return mdot(handle,
+                n,
+                k,
+                strided(x, stridex),
+                incx,
+                strided(Y, strideY),
+                ldy,
+                incy,
+                false,
+                batch_count,
+                result);
+}
+
+hipblasStatus_t hipblasDmdotStridedBatched(hipblasHandle_t handle,
+                                           int             n,
+                                           int             k,
+                                           const double*   x,
+                                           int             incx,
+                                           int             stridex,
+                                           const double*   Y,
+                                           int             ldy,
+                                           int             incy,
+                                           int             strideY,
+                                           int             batch_count,
+                                           double*         result)
+{
+    HIPBLAS_LOG_CALL(handle, n, k, x, incx, stridex, Y, ldy, incy, strideY, batch_count, result);
+    return mdot(handle,
+                n,
+                k,
+                strided(x, stridex),
+                incx,
+                strided(Y, strideY),
+                ldy,
+                incy,
+                false,
+                batch_count,
+                result);
+}
+
+hipblasStatus_t hipblasCmdotuStridedBatched(hipblasHandle_t       handle,
+                                            int                   n,
+                                            int                   k,
+                                            const hipblasComplex* x,
+                                            int                   incx,
+                                            int                   stridex,
+                                            const hipblasComplex* Y,
+                                            int                   ldy,
+                                            int                   incy,
+                                            int                   strideY,
+                                            int                   batch_count,
+                                            hipblasComplex*       result)
+{
+    HIPBLAS_LOG_CALL(handle, n, k, x, incx, stridex, Y, ldy, incy, strideY, batch_count, result);
+    return mdot(handle,
+                n,
+                k,
+                strided(x, stridex),
+                incx,
+                strided(Y, strideY),
+                ldy,
+                incy,
+                false,
+                batch_count,
+                result);
+}
+
+hipblasStatus_t hipblasCmdotcStridedBatched(hipblasHandle_t       handle,
+                                            int                   n,
+                                            int                   k,
+                                            const hipblasComplex* x,
+                                            int                   incx,
+                                            int                   stridex,
+                                            const hipblasComplex* Y,
+                                            int                   ldy,
+                                            int                   incy,
+                                            int                   strideY,
+                                            int                   batch_count,
+                                            hipblasComplex*       result)
+{
+    HIPBLAS_LOG_CALL(handle, n, k, x, incx, stridex, Y, ldy, incy, strideY, batch_count, result);
+    return mdot(handle,
+                n,
+                k,
+                strided(x, stridex),
+                incx,
+                strided(Y, strideY),
+                ldy,
+                incy,
+                true,
+                batch_count,
+                result);
+}
+
+hipblasStatus_t hipblasZmdotuStridedBatched(hipblasHandle_t             handle,
+                                            int                         n,
+                                            int                         k,
+                                            const hipblasDoubleComplex* x,
+                                            int                         incx,
+                                            int                         stridex,
+                                            const hipblasDoubleComplex* Y,
+                                            int                         ldy,
+                                            int                         incy,
+                                            int                         strideY,
+                                            int                         batch_count,
+                                            hipblasDoubleComplex*       result)
+{
+    HIPBLAS_LOG_CALL(handle, n, k, x, incx, stridex, Y, ldy, incy, strideY, batch_count, result);
+    return mdot(handle,
+                n,
+                k,
+                strided(x, stridex),
+                incx,
+                strided(Y, strideY),
+                ldy,
+                incy,
+                false,
+                batch_count,
+                result);
+}
+
+hipblasStatus_t hipblasZmdotcStridedBatched(hipblasHandle_t             handle,
+                                            int                         n,
+                                            int                         k,
+                                            const hipblasDoubleComplex* x,
+                                            int                         incx,
+                                            int                         stridex,
+                                            const hipblasDoubleComplex* Y,
+                                            int                         ldy,
+                                            int                         incy,
+                                            int                         strideY,
+                                            int                         batch_count,
+                                            hipblasDoubleComplex*       result)
+{
+    HIPBLAS_LOG_CALL(handle, n, k, x, incx, stridex, Y, ldy, incy, strideY, batch_count, result);
+    return mdot(handle,
+                n,
+                k,
+                strided(x, stridex),
+                incx,
+                strided(Y, strideY),
+                ldy,
+                incy,
+                true,
+                batch_count,
+                result);
+}
+
+// axpyDot
+hipblasStatus_t hipblasSaxpyDot(hipblasHandle_t handle,
+                                int             n,
+                                const float*    alpha,
+                                const float*    x,
+                                int             incx,
+                                float*          y,
+                                int             incy,
+                                const float*    z,
+                                int             incz,
+                                float*          result)
+{
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, y, incy, z, incz, result);
+    return axpy_dot(handle,
+                    n,
+                    alpha,
+                    single(x),
+                    incx,
+                    single(y),
+                    incy,
+                    single(z),
+                    incz,
+                    false,
+                    1,
+                    result);
+}
+
+hipblasStatus_t hipblasDaxpyDot(hipblasHandle_t handle,
+                                int             n,
+                                const double*   alpha,
+                                const double*   x,
+                                int             incx,
+                                double*         y,
+                                int             incy,
+                                const double*   z,
+                                int             incz,
+                                double*         result)
+{
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, y, incy, z, incz, result);
+    return axpy_dot(handle,
+                    n,
+                    alpha,
+                    single(x),
+                    incx,
+                    single(y),
+                    incy,
+                    single(z),
+                    incz,
+                    false,
+                    1,
+                    result);
+}
+
+hipblasStatus_t hipblasCaxpyDotu(hipblasHandle_t       handle,
+                                 int                   n,
+                                 const hipblasComplex* alpha,
+                                 const hipblasComplex* x,
+                                 int                   incx,
+                                 hipblasComplex*       y,
+                                 int                   incy,
+                                 const hipblasComplex* z,
+                                 int                   incz,
+                                 hipblasComplex*       result)
+{
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, y, incy, z, incz, result);
+    return axpy_dot(handle,
+                    n,
+                    alpha,
+                    single(x),
+                    incx,
+                    single(y),
+                    incy,
+                    single(z),
+                    incz,
+                    false,
+                    1,
+                    result);
+}
+
+hipblasStatus_t hipblasCaxpyDotc(hipblasHandle_t       handle,
+                                 int                   n,
+                                 const hipblasComplex* alpha,
+                                 const hipblasComplex* x,
+                                 int                   incx,
+                                 hipblasComplex*       y,
+                                 int                   incy,
+                                 const hipblasComplex* z,
+                                 int                   incz,
+                                 hipblasComplex*       result)
+{
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, y, incy, z, incz, result);
+    return axpy_dot(handle,
+                    n,
+                    alpha,
+                    single(x),
+                    incx,
+                    single(y),
+                    incy,
+                    single(z),
+                    incz,
+                    true,
+                    1,
+                    result);
+}
+
+hipblasStatus_t hipblasZaxpyDotu(hipblasHandle_t             handle,
+                                 int                         n,
+                                 const hipblasDoubleComplex* alpha,
+                                 const hipblasDoubleComplex* x,
+                                 int                         incx,
+                                 hipblasDoubleComplex*       y,
+                                 int                         incy,
+                                 const hipblasDoubleComplex* z,
+                                 int                         incz,
+                                 hipblasDoubleComplex*       result)
+{
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, y, incy, z, incz, result);
+    return axpy_dot(handle,
+                    n,
+                    alpha,
+                    single(x),
+                    incx,
+                    single(y),
+                    incy,
+                    single(z),
+                    incz,
+                    false,
+                    1,
+                    result);
+}
+
+hipblasStatus_t hipblasZaxpyDotc(hipblasHandle_t             handle,
+                                 int                         n,
+                                 const hipblasDoubleComplex* alpha,
+                                 const hipblasDoubleComplex* x,
+                                 int                         incx,
+                                 hipblasDoubleComplex*       y,
+                                 int                         incy,
+                                 const hipblasDoubleComplex* z,
+                                 int                         incz,
+                                 hipblasDoubleComplex*       result)
+{
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, y, incy, z, incz, result);
+    return axpy_dot(handle,
+                    n,
+                    alpha,
+                    single(x),
+                    incx,
+                    single(y),
+                    incy,
+                    single(z),
+                    incz,
+                    true,
+                    1,
+                    result);
+}
+
+// axpyDot_batched
+hipblasStatus_t hipblasSaxpyDotBatched(hipblasHandle_t    handle,
+                                       int                n,
+                                       const float*       alpha,
+                                       const float* const x[],
+                                       int                incx,
+                                       float* const       y[],
+                                       int                incy,
+                                       const float* const z[],
+                                       int                incz,
+                                       int                batch_count,
+                                       float*             result)
+{
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, y, incy, z, incz, batch_count, result);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, x, y, z);
+    return axpy_dot(handle,
+                    n,
+                    alpha,
+                    arrays(x),
+                    incx,
+                    arrays(y),
+                    incy,
+                    arrays(z),
+                    incz,
+                    false,
+                    batch_count,
+                    result);
+}
+
+hipblasStatus_t hipblasDaxpyDotBatched(hipblasHandle_t     handle,
+                                       int                 n,
+                                       const double*       alpha,
+                                       const double* const x[],
+                                       int                 incx,
+                                       double* const       y[],
+                                       int                 incy,
+                                       const double* const z[],
+                                       int                 incz,
+                                       int                 batch_count,
+                                       double*             result)
+{
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, y, incy, z, incz, batch_count, result);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, x, y, z);
+    return axpy_dot(handle,
+                    n,
+                    alpha,
+                    arrays(x),
+                    incx,
+                    arrays(y),
+                    incy,
+                    arrays(z),
+                    incz,
+                    false,
+                    batch_count,
+                    result);
+}
+
+hipblasStatus_t hipblasCaxpyDotuBatched(hipblasHandle_t             handle,
+                                        int                         n,
+                                        const hipblasComplex*       alpha,
+                                        const hipblasComplex* const x[],
+                                        int                         incx,
+                                        hipblasComplex* const       y[],
+                                        int                         incy,
+                                        const hipblasComplex* const z[],
+                                        int                         incz,
+                                        int                         batch_count,
+                                        hipblasComplex*             result)
+{
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, y, incy, z, incz, batch_count, result);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, x, y, z);
+    return axpy_dot(handle,
+                    n,
+                    alpha,
+                    arrays(x),
+                    incx,
+                    arrays(y),
+                    incy,
+                    arrays(z),
+                    incz,
+                    false,
+                    batch_count,
+                    result);
+}
+
+hipblasStatus_t hipblasCaxpyDotcBatched(hipblasHandle_t             handle,
+                                        int                         n,
+                                        const hipblasComplex*       alpha,
+                                        const hipblasComplex* const x[],
+                                        int                         incx,
+                                        hipblasComplex* const       y[],
+                                        int                         incy,
+                                        const hipblasComplex* const z[],
+                                        int                         incz,
+                                        int                         batch_count,
+                                        hipblasComplex*             result)
+{
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, y, incy, z, incz, batch_count, result);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, x, y, z);
+    return axpy_dot(handle,
+                    n,
+                    alpha,
+                    arrays(x),
+                    incx,
+                    arrays(y),
+                    incy,
+                    arrays(z),
+                    incz,
+                    true,
+                    batch_count,
+                    result);
+}
+
+hipblasStatus_t hipblasZaxpyDotuBatched(hipblasHandle_t                   handle,
+                                        int                               n,
+                                        const hipblasDoubleComplex*       alpha,
+                                        const hipblasDoubleComplex* const x[],
+                                        int                               incx,
+                                        hipblasDoubleComplex* const       y[],
+                                        int                               incy,
+                                        const hipblasDoubleComplex* const z[],
+                                        int                               incz,
+                                        int                               batch_count,
+                                        hipblasDoubleComplex*             result)
+{
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, y, incy, z, incz, batch_count, result);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, x, y, z);
+    return axpy_dot(handle,
+                    n,
+                    alpha,
+                    arrays(x),
+                    incx,
+                    arrays(y),
+                    incy,
+                    arrays(z),
+                    incz,
+                    false,
+                    batch_count,
+                    result);
+}
+
+hipblasStatus_t hipblasZaxpyDotcBatched(hipblasHandle_t                   handle,
+                                        int                               n,
+                                        const hipblasDoubleComplex*       alpha,
+                                        const hipblasDoubleComplex* const x[],
+                                        int                               incx,
+                                        hipblasDoubleComplex* const       y[],
+                                        int                               incy,
+                                        const hipblasDoubleComplex* const z[],
+                                        int                               incz,
+                                        int                               batch_count,
+                                        hipblasDoubleComplex*             result)
+{
+    HIPBLAS_LOG_CALL(handle, n, alpha, x, incx, y, incy, z, incz, batch_count, result);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, x, y, z);
+    return axpy_dot(handle,
+                    n,
+                    alpha,
+                    arrays(x),
+                    incx,
+                    arrays(y),
+                    incy,
+                    arrays(z),
+                    incz,
+                    true,
+                    batch_count,
+                    result);
+}
+
+// axpyDot_strided_batched
+hipblasStatus_t hipblasSaxpyDotStridedBatched(hipblasHandle_t handle,
+                                              int             n,
+                                              const float*    alpha,
+                                              const float*    x,
+                                              int             incx,
+                                              int             stridex,
+                                              float*          y,
+                                              int             incy,
+                                              int             stridey,
+                                              const float*    z,
+                                              int             incz,
+                                              int             stridez,
+                                              int             batch_count,
+                                              float*          result)
+{
+    HIPBLAS_LOG_CALL(handle,
+                     n,
+                     alpha,
+                     x,
+                     incx,
+                     stridex,
+                     y,
+                     incy,
+                     stridey,
+                     z,
+                     incz,
+                     stridez,
+                     batch_count,
+                     result);
+    return axpy_dot(handle,
+                    n,
+                    alpha,
+                    strided(x, stridex),
+                    incx,
+                    strided(y, stridey),
+                    incy,
+                    strided(z, stridez),
+                    incz,
+                    false,
+                    batch_count,
+                    result);
+}
+
+hipblasStatus_t hipblasDaxpyDotStridedBatched(hipblasHandle_t handle,
+                                              int             n,
+                                              const double*   alpha,
+                                              const double*   x,
+                                              int             incx,
+                                              int             stridex,
+                                              double*         y,
+                                              int             incy,
+                                              int             stridey,
+                                              const double*   z,
+                                              int             incz,
+                                              int             stridez,
+                                              int             batch_count,
+                                              double*         result)
+{
+    HIPBLAS_LOG_CALL(handle,
+                     n,
+                     alpha,
+                     x,
+                     incx,
+                     stridex,
+                     y,
+                     incy,
+                     stridey,
+                     z,
+                     incz,
+                     stridez,
+                     batch_count,
+                     result);
+    return axpy_dot(handle,
+                    n,
+                    alpha,
+                    strided(x, stridex),
+                    incx,
+                    strided(y, stridey),
+                    incy,
+                    strided(z, stridez),
+                    incz,
+                    false,
+                    batch_count,
+                    result);
+}
+
+hipblasStatus_t hipblasCaxpyDotuStridedBatched(hipblasHandle_t       handle,
+                                               int                   n,
+                                               const hipblasComplex* alpha,
+                                               const hipblasComplex* x,
+                                               int                   incx,
+                                               int                   stridex,
+                                               hipblasComplex*       y,
+                                               int                   incy,
+                                               int                   stridey,
+                                               const hipblasComplex* z,
+                                               int                   incz,
+                                               int                   stridez,
+                                               int                   batch_count,
+                                               hipblasComplex*       result)
+{
+    HIPBLAS_LOG_CALL(handle,
+                     n,
+                     alpha,
+                     x,
+                     incx,
+                     stridex,
+                     y,
+                     incy,
+                     stridey,
+                     z,
+                     incz,
+                     stridez,
+                     batch_count,
+                     result);
+    return axpy_dot(handle,
+                    n,
+                    alpha,
+                    strided(x, stridex),
+                    incx,
+                    strided(y, stridey),
+                    incy,
+                    strided(z, stridez),
+                    incz,
+                    false,
+                    batch_count,
+                    result);
+}
+
+hipblasStatus_t hipblasCaxpyDotcStridedBatched(hipblasHandle_t       handle,
+                                               int                   n,
+                                               const hipblasComplex* alpha,
+                                               const hipblasComplex* x,
+                                               int                   incx,
+                                               int                   stridex,
+                                               hipblasComplex*       y,
+                                               int                   incy,
+                                               int                   stridey,
+                                               const hipblasComplex* z,
+                                               int                   incz,
+                                               int                   stridez,
+                                               int                   batch_count,
+                                               hipblasComplex*       result)
+{
+    HIPBLAS_LOG_CALL(handle,
+                     n,
+                     alpha,
+                     x,
+                     incx,
+                     stridex,
+                     y,
+                     incy,
+                     stridey,
+                     z,
+                     incz,
+                     stridez,
+                     batch_count,
+                     result);
+    return axpy_dot(handle,
+                    n,
+                    alpha,
+                    strided(x, stridex),
+                    incx,
+                    strided(y, stridey),
+                    incy,
+                    strided(z, stridez),
+                    incz,
+                    true,
+                    batch_count,
+                    result);
+}
+
+hipblasStatus_t hipblasZaxpyDotuStridedBatched(hipblasHandle_t             handle,
+                                               int                         n,
+                                               const hipblasDoubleComplex* alpha,
+                                               const hipblasDoubleComplex* x,
+                                               int                         incx,
+                                               int                         stridex,
+                                               hipblasDoubleComplex*       y,
+                                               int                         incy,
+                                               int                         stridey,
+                                               const hipblasDoubleComplex* z,
+                                               int                         incz,
+                                               int                         stridez,
+                                               int                         batch_count,
+                                               hipblasDoubleComplex*       result)
+{
+    HIPBLAS_LOG_CALL(handle,
+                     n,
+                     alpha,
+                     x,
+                     incx,
+                     stridex,
+                     y,
+                     incy,
+                     stridey,
+                     z,
+                     incz,
+                     stridez,
+                     batch_count,
+                     result);
+    return axpy_dot(handle,
+                    n,
+                    alpha,
+                    strided(x, stridex),
+                    incx,
+                    strided(y, stridey),
+                    incy,
+                    strided(z, stridez),
+                    incz,
+                    false,
+                    batch_count,
+                    result);
+}
+
+hipblasStatus_t hipblasZaxpyDotcStridedBatched(hipblasHandle_t             handle,
+                                               int                         n,
+                                               const hipblasDoubleComplex* alpha,
+                                               const hipblasDoubleComplex* x,
+                                               int                         incx,
+                                               int                         stridex,
+                                               hipblasDoubleComplex*       y,
+                                               int                         incy,
+                                               int                         stridey,
+                                               const hipblasDoubleComplex* z,
+                                               int                         incz,
+                                               int                         stridez,
+                                               int                         batch_count,
+                                               hipblasDoubleComplex*       result)
+{
+    HIPBLAS_LOG_CALL(handle,
+                     n,
+                     alpha,
+                     x,
+                     incx,
+                     stridex,
+                     y,
+                     incy,
+                     stridey,
+                     z,
+                     incz,
+                     stridez,
+                     batch_count,
+                     result);
+    return axpy_dot(handle,
+                    n,
+                    alpha,
+                    strided(x, stridex),
+                    incx,
+                    strided(y, stridey),
+                    incy,
+                    strided(z, stridez),
+                    incz,
+                    true,
+                    batch_count,
+                    result);
+}
+
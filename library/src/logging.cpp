@@ -0,0 +1,1020 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipblas_logging.h"
+#include "hipblas_handle.h"
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <sstream>
+
+#ifdef HIPBLAS_WITH_ROCTX
+#ifdef __HIP_PLATFORM_NVCC__
+#include <nvToolsExt.h>
+#define hipblas_range_push nvtxRangePushA
+#define hipblas_range_pop nvtxRangePop
+#else
+#include <roctx.h>
+#define hipblas_range_push roctxRangePushA
+#define hipblas_range_pop roctxRangePop
+#endif
+#endif
+
+namespace
+{
+    int read_layer_mode()
+    {
+        const char* env = std::getenv("HIPBLAS_LAYER");
+        int supported = HIPBLAS_LAYER_TRACE | HIPBLAS_LAYER_BENCH | HIPBLAS_LAYER_PROFILE
+                        | HIPBLAS_LAYER_RECORD | HIPBLAS_LAYER_ADVISOR;
+#ifdef HIPBLAS_WITH_ROCTX
+        supported |= HIPBLAS_LAYER_RANGES;
+#endif
+        return env ? std::atoi(env) & supported : 0;
+    }
+
+    // One output: the file named by the environment variable, otherwise stderr
+    class log_sink
+    {
+    public:
+        explicit log_sink(const char* path_env)
+        {
+            const char* path = std::getenv(path_env);
+            if(path && *path)
+            {
+                file.reset(new std::ofstream(path));
+                if(!*file)
+                    file.reset();
+            }
+        }
+
+        void write(const std::string& line)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            std::ostream&               os = file ? *file : std::cerr;
+            os << line << '\n';
+            os.flush();
+        }
+
+    private:
+        std::mutex                     mutex;
+        std::unique_ptr<std::ofstream> file;
+    };
+
+    log_sink trace_sink("HIPBLAS_LOG_TRACE_PATH");
+    log_sink bench_sink("HIPBLAS_LOG_BENCH_PATH");
+    log_sink profile_sink("HIPBLAS_LOG_PROFILE_PATH");
+
+    // Written out when the library unloads
+    class profile_table
+    {
+    public:
+        void add(const std::string& shape, double seconds)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            entry&                      e = entries[shape];
+            e.calls++;
+            e.seconds += seconds;
+        }
+
+        ~profile_table()
+        {
+            if(entries.empty())
+                return;
+            profile_sink.write("hipblas profile");
+            for(const auto& it : entries)
+            {
+                size_t             comma = it.first.find(',');
+                std::ostringstream line;
+                line << std::fixed << std::setprecision(3)
+                     << "- { function: " << it.first.substr(0, comma) << ", args: \""
+                     << (comma == std::string::npos ? "" : it.first.substr(comma + 1))
+                     << "\", calls: " << it.second.calls
+                     << ", total_us: " << it.second.seconds * 1e6
+                     << ", mean_us: " << it.second.seconds * 1e6 / it.second.calls << " }";
+                profile_sink.write(line.str());
+            }
+        }
+
+    private:
+        struct entry
+        {
+            size_t calls   = 0;
+            double seconds = 0;
+        };
+
+        std::mutex                   mutex;
+        std::map<std::string, entry> entries;
+    };
+
+    profile_table profile;
+
+    // Only the outermost exported function of a call chain is logged
+    thread_local int call_depth = 0;
+
+    std::string arg_text(const hipblas_log_arg& arg)
+    {
+        std::ostringstream text;
+        switch(arg.kind)
+        {
+        case hipblas_log_arg::INTEGER:
+            text << arg.i;
+            break;
+        case hipblas_log_arg::REAL:
+            text << arg.d;
+            break;
+        case hipblas_log_arg::POINTER:
+            text << arg.p;
+            break;
+        case hipblas_log_arg::NAME:
+            text << arg.s;
+            break;
+        }
+        return text.str();
+    }
+
+    // The scalar behind a pointer argument in hipblas-bench's format, when it is readable
+    bool host_scalar(hipblasHandle_t        handle,
+                     const hipblas_log_arg& arg,
+                     char                   precision,
+                     std::string&           real,
+                     std::string&           imag)
+    {
+        const hipblas_handle* h = static_cast<const hipblas_handle*>(handle);
+        if(h == nullptr || arg.kind != hipblas_log_arg::POINTER || arg.p == nullptr
+           || h->pointer_mode != HIPBLAS_POINTER_MODE_HOST)
+            return false;
+
+        double re = 0, im = 0;
+        switch(precision)
+        {
+        case 'h':
+        {
+            // fp16 bits to float; subnormals and infinities are rare enough for a bench line
+            uint16_t bits = *static_cast<const uint16_t*>(arg.p);
+            int      exp  = (bits >> 10) & 0x1f;
+            double   mant = (bits & 0x3ff) / 1024.0;
+            re = exp == 0 ? std::ldexp(mant, -14) : std::ldexp(1 + mant, exp - 15);
+            if(bits & 0x8000)
+                re = -re;
+            break;
+        }
+        case 's':
+            re = *static_cast<const float*>(arg.p);
+            break;
+        case 'd':
+            re = *static_cast<const double*>(arg.p);
+            break;
+        case 'c':
+            re = static_cast<const hipblasComplex*>(arg.p)->x;
+            im = static_cast<const hipblasComplex*>(arg.p)->y;
+            break;
+        case 'z':
+            re = static_cast<const hipblasDoubleComplex*>(arg.p)->x;
+            im = static_cast<const hipblasDoubleComplex*>(arg.p)->y;
+            break;
+        default:
+            return false;
+        }
+        std::ostringstream r, i;
+        r << re;
+        i << im;
+        real = r.str();
+        imag = i.str();
+        return true;
+    }
+
+    /* ======================================================================================== */
+    /*  hipblas-bench replay: argument positions of the functions it can run */
+
+    struct bench_option
+    {
+        const char* name;
+        int         index;
+        bool        scalar; // a pointer to alpha or beta
+    };
+
+    struct bench_function
+    {
+        const char*  name; // without hipblas and the precision letter
+        const char*  bench; // hipblas-bench -f
+        const char*  precisions;
+        bench_option options[12];
+    };
+
+    constexpr bench_function bench_functions[] = {
+        {"axpy", "axpy", "hsdcz", {{"-n", 1}, {"--alpha", 2, true}, {"--incx", 4}, {"--incy", 6}}},
+        {"dot", "dot", "hsd", {{"-n", 1}, {"--incx", 3}, {"--incy", 5}}},
+        {"dotu", "dot", "cz", {{"-n", 1}, {"--incx", 3}, {"--incy", 5}}},
+        {"scal", "scal", "sdcz", {{"-n", 1}, {"--alpha", 2, true}, {"--incx", 4}}},
+        {"gemv",
+         "gemv",
+         "sdcz",
+         {{"--transposeA", 1},
+          {"-m", 2},
+          {"-n", 3},
+          {"--alpha", 4, true},
+          {"--lda", 6},
+          {"--incx", 8},
+          {"--beta", 9, true},
+          {"--incy", 11}}},
+        {"gemm",
+         "gemm",
+         "sdcz",
+         {{"--transposeA", 1},
+          {"--transposeB", 2},
+          {"-m", 3},
+          {"-n", 4},
+          {"-k", 5},
+          {"--alpha", 6, true},
+          {"--lda", 8},
+          {"--ldb", 10},
+          {"--beta", 11, true},
+          {"--ldc", 13}}},
+        {"gemmBatched",
+         "gemm_batched",
+         "sdcz",
+         {{"--transposeA", 1},
+          {"--transposeB", 2},
+          {"-m", 3},
+          {"-n", 4},
+          {"-k", 5},
+          {"--alpha", 6, true},
+          {"--lda", 8},
+          {"--ldb", 10},
+          {"--beta", 11, true},
+          {"--ldc", 13},
+          {"--batch_count", 14}}},
+        // hipblas-bench picks its own strides
+        {"gemmStridedBatched",
+         "gemm_strided_batched",
+         "sdcz",
+         {{"--transposeA", 1},
+          {"--transposeB", 2},
+          {"-m", 3},
+          {"-n", 4},
+          {"-k", 5},
+          {"--alpha", 6, true},
+          {"--lda", 8},
+          {"--ldb", 11},
+          {"--beta", 13, true},
+          {"--ldc", 15},
+          {"--batch_count", 17}}}};
+
+    void log_bench(hipblasHandle_t        handle,
+                   const char*            function,
+                   const hipblas_log_arg* args,
+                   int                    count)
+    {
+        if(std::strncmp(function, "hipblas", 7) != 0 || !function[7])
+            return;
+        char precision = char(std::tolower(function[7]));
+        if(!std::isupper(function[7]))
+            return;
+
+        for(const bench_function& f : bench_functions)
+        {
+            if(std::strcmp(function + 8, f.name) != 0 || !std::strchr(f.precisions, precision))
+                continue;
+
+            std::ostringstream line;
+            line << "./hipblas-bench -f " << f.bench << " -r " << precision;
+            for(const bench_option& o : f.options)
+            {
+                if(o.name == nullptr || o.index >= count)
+                    continue;
+                if(!o.scalar)
+                {
+                    line << ' ' << o.name << ' ' << arg_text(args[o.index]);
+                    continue;
+                }
+
+                // device-mode scalars are not read back, so hipblas-bench uses its defaults
+                std::string real, imag;
+                if(host_scalar(handle, args[o.index], precision, real, imag))
+                {
+                    line << ' ' << o.name << ' ' << real;
+                    if(precision == 'c' || precision == 'z')
+                        line << ' ' << o.name << "i " << imag;
+                }
+            }
+            bench_sink.write(line.str());
+            return;
+        }
+    }
+}
+
+const int hipblas_layer_mode = read_layer_mode();
+
+/* ============================================================================================ */
+
+namespace
+{
+    hipblas_log_arg name_arg(long long value, const char* name)
+    {
+        hipblas_log_arg arg;
+        arg.kind = hipblas_log_arg::NAME;
+        arg.i    = value;
+        arg.s    = name;
+        return arg;
+    }
+}
+
+hipblas_log_arg hipblas_log_format(hipblasOperation_t value)
+{
+    return name_arg(value, value == HIPBLAS_OP_N ? "N" : value == HIPBLAS_OP_T ? "T" : "C");
+}
+
+hipblas_log_arg hipblas_log_format(hipblasFillMode_t value)
+{
+    return name_arg(value,
+                    value == HIPBLAS_FILL_MODE_UPPER   ? "U"
+                    : value == HIPBLAS_FILL_MODE_LOWER ? "L"
+                                                       : "F");
+}
+
+hipblas_log_arg hipblas_log_format(hipblasDiagType_t value)
+{
+    return name_arg(value, value == HIPBLAS_DIAG_UNIT ? "U" : "N");
+}
+
+hipblas_log_arg hipblas_log_format(hipblasSideMode_t value)
+{
+    return name_arg(value,
+                    value == HIPBLAS_SIDE_LEFT ? "L" : value == HIPBLAS_SIDE_RIGHT ? "R" : "B");
+}
+
+hipblas_log_arg hipblas_log_format(hipblasDatatype_t value)
+{
+    switch(value)
+    {
+    case HIPBLAS_R_16F:
+        return name_arg(value, "f16_r");
+    case HIPBLAS_R_32F:
+        return name_arg(value, "f32_r");
+    case HIPBLAS_R_64F:
+        return name_arg(value, "f64_r");
+    case HIPBLAS_C_16F:
+        return name_arg(value, "f16_c");
+    case HIPBLAS_C_32F:
+        return name_arg(value, "f32_c");
+    case HIPBLAS_C_64F:
+        return name_arg(value, "f64_c");
+    case HIPBLAS_R_8I:
+        return name_arg(value, "i8_r");
+    case HIPBLAS_R_8U:
+        return name_arg(value, "u8_r");
+    case HIPBLAS_R_32I:
+        return name_arg(value, "i32_r");
+    case HIPBLAS_R_32U:
+        return name_arg(value, "u32_r");
+    case HIPBLAS_C_8I:
+        return name_arg(value, "i8_c");
+    case HIPBLAS_C_8U:
+        return name_arg(value, "u8_c");
+    case HIPBLAS_C_32I:
+        return name_arg(value, "i32_c");
+    case HIPBLAS_C_32U:
+        return name_arg(value, "u32_c");
+    case HIPBLAS_R_16B:
+        return name_arg(value, "bf16_r");
+    case HIPBLAS_C_16B:
+        return name_arg(value, "bf16_c");
+    case HIPBLAS_R_8F_E4M3:
+        return name_arg(value, "f8_e4m3_r");
+    case HIPBLAS_R_8F_E5M2:
+        return name_arg(value, "f8_e5m2_r");
+    case HIPBLAS_COMPUTE_32F_FAST_TF32:
+        return name_arg(value, "f32_fast_tf32");
+    case HIPBLAS_COMPUTE_32F_FAST_BF16X3:
+        return name_arg(value, "f32_fast_bf16x3");
+    case HIPBLAS_COMPUTE_64F_EMULATED_INT8:
+        return name_arg(value, "f64_emulated_i8");
+    }
+    return hipblas_log_format(int(value));
+}
+
+/* ============================================================================================ */
+/*  Routine families and byte and flop estimates */
+
+namespace
+{
+    enum estimate_model
+    {
+        MODEL_NONE,
+        MODEL_GEMM,
+        MODEL_GEMV,
+        MODEL_AXPY,
+        MODEL_DOT,
+        MODEL_SCAL,
+        MODEL_COPY,
+        MODEL_SWAP,
+        MODEL_NRM2,
+        MODEL_ASUM,
+        MODEL_IAMAX
+    };
+
+    struct routine
+    {
+        const char*            base; // lower case, without precision and batch suffix
+        hipblasRoutineFamily_t family;
+        estimate_model         model;
+    };
+
+    constexpr routine routines[] = {
+        {"amax", HIPBLAS_FAMILY_LEVEL1, MODEL_IAMAX},
+        {"amin", HIPBLAS_FAMILY_LEVEL1, MODEL_IAMAX},
+        {"asum", HIPBLAS_FAMILY_LEVEL1, MODEL_ASUM},
+        {"axpy", HIPBLAS_FAMILY_LEVEL1, MODEL_AXPY},
+        {"copy", HIPBLAS_FAMILY_LEVEL1, MODEL_COPY},
+        {"dot", HIPBLAS_FAMILY_LEVEL1, MODEL_DOT},
+        {"dotc", HIPBLAS_FAMILY_LEVEL1, MODEL_DOT},
+        {"dotu", HIPBLAS_FAMILY_LEVEL1, MODEL_DOT},
+        {"nrm2", HIPBLAS_FAMILY_LEVEL1, MODEL_NRM2},
+        {"rot", HIPBLAS_FAMILY_LEVEL1, MODEL_NONE},
+        {"rotg", HIPBLAS_FAMILY_LEVEL1, MODEL_NONE},
+        {"rotm", HIPBLAS_FAMILY_LEVEL1, MODEL_NONE},
+        {"rotmg", HIPBLAS_FAMILY_LEVEL1, MODEL_NONE},
+        {"scal", HIPBLAS_FAMILY_LEVEL1, MODEL_SCAL},
+        {"swap", HIPBLAS_FAMILY_LEVEL1, MODEL_SWAP},
+        {"gbmv", HIPBLAS_FAMILY_LEVEL2, MODEL_NONE},
+        {"gemv", HIPBLAS_FAMILY_LEVEL2, MODEL_GEMV},
+        {"ger", HIPBLAS_FAMILY_LEVEL2, MODEL_NONE},
+        {"gerc", HIPBLAS_FAMILY_LEVEL2, MODEL_NONE},
+        {"geru", HIPBLAS_FAMILY_LEVEL2, MODEL_NONE},
+        {"hbmv", HIPBLAS_FAMILY_LEVEL2, MODEL_NONE},
+        {"hemv", HIPBLAS_FAMILY_LEVEL2, MODEL_NONE},
+        {"her", HIPBLAS_FAMILY_LEVEL2, MODEL_NONE},
+        {"her2", HIPBLAS_FAMILY_LEVEL2, MODEL_NONE},
+        {"hpmv", HIPBLAS_FAMILY_LEVEL2, MODEL_NONE},
+        {"hpr", HIPBLAS_FAMILY_LEVEL2, MODEL_NONE},
+        {"hpr2", HIPBLAS_FAMILY_LEVEL2, MODEL_NONE},
+        {"sbmv", HIPBLAS_FAMILY_LEVEL2, MODEL_NONE},
+        {"spmv", HIPBLAS_FAMILY_LEVEL2, MODEL_NONE},
+        {"spr", HIPBLAS_FAMILY_LEVEL2, MODEL_NONE},
+        {"spr2", HIPBLAS_FAMILY_LEVEL2, MODEL_NONE},
+        {"symv", HIPBLAS_FAMILY_LEVEL2, MODEL_NONE},
+        {"syr", HIPBLAS_FAMILY_LEVEL2, MODEL_NONE},
+        {"syr2", HIPBLAS_FAMILY_LEVEL2, MODEL_NONE},
+        {"tbmv", HIPBLAS_FAMILY_LEVEL2, MODEL_NONE},
+        {"tbsv", HIPBLAS_FAMILY_LEVEL2, MODEL_NONE},
+        {"tpmv", HIPBLAS_FAMILY_LEVEL2, MODEL_NONE},
+        {"tpsv", HIPBLAS_FAMILY_LEVEL2, MODEL_NONE},
+        {"trmv", HIPBLAS_FAMILY_LEVEL2, MODEL_NONE},
+        {"trsv", HIPBLAS_FAMILY_LEVEL2, MODEL_NONE},
+        {"gemm", HIPBLAS_FAMILY_LEVEL3, MODEL_GEMM},
+        {"gemm3m", HIPBLAS_FAMILY_LEVEL3, MODEL_GEMM},
+        {"hemm", HIPBLAS_FAMILY_LEVEL3, MODEL_NONE},
+        {"her2k", HIPBLAS_FAMILY_LEVEL3, MODEL_NONE},
+        {"herk", HIPBLAS_FAMILY_LEVEL3, MODEL_NONE},
+        {"herkx", HIPBLAS_FAMILY_LEVEL3, MODEL_NONE},
+        {"symm", HIPBLAS_FAMILY_LEVEL3, MODEL_NONE},
+        {"syr2k", HIPBLAS_FAMILY_LEVEL3, MODEL_NONE},
+        {"syrk", HIPBLAS_FAMILY_LEVEL3, MODEL_NONE},
+        {"syrkx", HIPBLAS_FAMILY_LEVEL3, MODEL_NONE},
+        {"trmm", HIPBLAS_FAMILY_LEVEL3, MODEL_NONE},
+        {"trsm", HIPBLAS_FAMILY_LEVEL3, MODEL_NONE},
+        {"trtri", HIPBLAS_FAMILY_LEVEL3, MODEL_NONE},
+        {"dgmm", HIPBLAS_FAMILY_EXTENSION, MODEL_NONE},
+        {"geam", HIPBLAS_FAMILY_EXTENSION, MODEL_NONE},
+        {"gels", HIPBLAS_FAMILY_SOLVER, MODEL_NONE},
+        {"geqrf", HIPBLAS_FAMILY_SOLVER, MODEL_NONE},
+        {"getrf", HIPBLAS_FAMILY_SOLVER, MODEL_NONE},
+        {"getrfnpvt", HIPBLAS_FAMILY_SOLVER, MODEL_NONE},
+        {"getri", HIPBLAS_FAMILY_SOLVER, MODEL_NONE},
+        {"getrs", HIPBLAS_FAMILY_SOLVER, MODEL_NONE},
+        {"getrsnpvt", HIPBLAS_FAMILY_SOLVER, MODEL_NONE},
+        {"matinv", HIPBLAS_FAMILY_SOLVER, MODEL_NONE},
+        {"potrf", HIPBLAS_FAMILY_SOLVER, MODEL_NONE},
+        {"potrs", HIPBLAS_FAMILY_SOLVER, MODEL_NONE}};
+
+    const routine* find_routine(const std::string& base)
+    {
+        for(const routine& r : routines)
+            if(base == r.base)
+                return &r;
+        return nullptr;
+    }
+
+    std::string lower(std::string s, bool drop_underscores = false)
+    {
+        std::string out;
+        for(char c : s)
+            if(!drop_underscores || c != '_')
+                out += char(std::tolower((unsigned char)c));
+        return out;
+    }
+
+    std::string strip_batch_suffix(std::string name)
+    {
+        for(const char* suffix : {"StridedBatched", "GroupedBatched", "Batched"})
+        {
+            size_t len = std::strlen(suffix);
+            if(name.size() > len && name.compare(name.size() - len, len, suffix) == 0)
+                return name.substr(0, name.size() - len);
+        }
+        return name;
+    }
+
+    long long integer_at(const hipblas_log_arg* args, int count, int index, long long fallback)
+    {
+        if(index < 0 || index >= count || args[index].kind != hipblas_log_arg::INTEGER)
+            return fallback;
+        return args[index].i < 0 ? 0 : args[index].i;
+    }
+
+    // Elements moved and flops of one problem of the batch, both for real arithmetic
+    void estimate(const hipblas_log_site& site,
+                  const hipblas_log_arg*  args,
+                  int                     count,
+                  double&                 elements,
+                  double&                 flops)
+    {
+        double m = double(integer_at(args, count, site.m, 0));
+        double n = double(integer_at(args, count, site.n, 0));
+        double k = double(integer_at(args, count, site.k, 0));
+
+        elements = flops = 0;
+        switch(site.model)
+        {
+        case MODEL_GEMM:
+            elements = m * k + k * n + 2 * m * n;
+            flops    = 2 * m * n * k;
+            break;
+        case MODEL_GEMV:
+        {
+            bool   transposed = site.trans >= 0 && site.trans < count
+                              && args[site.trans].kind == hipblas_log_arg::NAME
+                              && args[site.trans].s[0] != 'N';
+            double x          = transposed ? m : n;
+            double y          = transposed ? n : m;
+            elements          = m * n + x + 2 * y;
+            flops             = 2 * m * n;
+            break;
+        }
+        case MODEL_AXPY:
+            elements = 3 * n;
+            flops    = 2 * n;
+            break;
+        case MODEL_DOT:
+            elements = 2 * n;
+            flops    = 2 * n;
+            break;
+        case MODEL_SCAL:
+            elements = 2 * n;
+            flops    = n;
+            break;
+        case MODEL_COPY:
+            elements = 2 * n;
+            break;
+        case MODEL_SWAP:
+            elements = 4 * n;
+            break;
+        case MODEL_NRM2:
+            elements = n;
+            flops    = 2 * n;
+            break;
+        case MODEL_ASUM:
+            elements = n;
+            flops    = n;
+            break;
+        case MODEL_IAMAX:
+            elements = n;
+            break;
+        }
+    }
+}
+
+hipblas_log_site::hipblas_log_site(const char* function, const char* parameters)
+    : function(function)
+{
+    std::string name = std::strncmp(function, "hipblas", 7) == 0 ? function + 7 : function;
+
+    // The precision prefix, longest first, counts only when a known routine follows it
+    struct prefix
+    {
+        const char* text;
+        char        precision;
+    };
+    static const prefix prefixes[] = {{"Cs", 'c'},
+                                      {"Zd", 'z'},
+                                      {"Sc", 'c'},
+                                      {"Dz", 'z'},
+                                      {"Is", 's'},
+                                      {"Id", 'd'},
+                                      {"Ic", 'c'},
+                                      {"Iz", 'z'},
+                                      {"Bf", 'b'},
+                                      {"S", 's'},
+                                      {"D", 'd'},
+                                      {"C", 'c'},
+                                      {"Z", 'z'},
+                                      {"H", 'h'}};
+
+    const routine* r = nullptr;
+    for(const prefix& p : prefixes)
+    {
+        if(name.compare(0, std::strlen(p.text), p.text) != 0)
+            continue;
+        std::string candidate = strip_batch_suffix(name.substr(std::strlen(p.text)));
+        r                     = find_routine(candidate);
+        if(r)
+        {
+            precision = p.precision;
+            base      = candidate;
+            break;
+        }
+    }
+
+    if(r)
+    {
+        family = r->family;
+        model  = r->model;
+        switch(precision)
+        {
+        case 'h':
+        case 'b':
+            element_size = 2;
+            break;
+        case 's':
+            element_size = 4;
+            break;
+        case 'd':
+        case 'c':
+            element_size = 8;
+            break;
+        case 'z':
+            element_size = 16;
+            break;
+        }
+        complex = precision == 'c' || precision == 'z';
+    }
+    else if(name.find("Ex") != std::string::npos)
+    {
+        // GemmEx, GemmStridedBatchedEx, AxpyEx and friends: the types are arguments
+        family        = HIPBLAS_FAMILY_EXTENSION;
+        base          = lower(strip_batch_suffix(name.substr(0, name.find("Ex"))));
+        const routine* typed = find_routine(base);
+        model         = typed ? typed->model : MODEL_NONE;
+    }
+
+    std::string       list = parameters;
+    std::stringstream stream(list);
+    std::string       parameter;
+    for(int i = 0; std::getline(stream, parameter, ','); i++)
+    {
+        std::string p = lower(parameter, true);
+        p.erase(0, p.find_first_not_of(' '));
+        p.erase(p.find_last_not_of(' ') + 1);
+
+        if(p == "m")
+            m = i;
+        else if(p == "n")
+            n = i;
+        else if(p == "k")
+            k = i;
+        else if(p == "batchcount")
+            batch_count = i;
+        else if((p == "alpha" || p == "beta" || p == "result") && i < 64)
+        {
+            scalars |= 1ull << i;
+            if(p == "result")
+                result = i;
+        }
+        else if(trans < 0 && (p == "trans" || p == "transa"))
+            trans = i;
+        else if(data_type < 0 && p.size() > 4 && p.compare(p.size() - 4, 4, "type") == 0
+                && p != "computetype" && p != "executiontype" && p != "alphatype")
+            data_type = i;
+        else if(i >= 64)
+            continue;
+        else if(p.size() <= 4 && p.compare(0, 2, "ld") == 0)
+            leading_dims |= 1ull << i;
+        else if(p.compare(0, 6, "stride") == 0 || (p.size() == 3 && p.compare(0, 2, "bs") == 0))
+            strides |= 1ull << i;
+        else if(p == "a" || p == "b" || p == "c" || p == "x" || p == "y" || p == "ap")
+            operands |= 1ull << i;
+    }
+
+    strided        = std::strstr(function, "StridedBatched") != nullptr;
+    pointer_arrays = !strided && std::strstr(function, "Batched") != nullptr;
+}
+
+/* ============================================================================================ */
+
+void hipblas_log_call::begin(const hipblas_log_site& site, const hipblas_log_arg* args, int count)
+{
+    active = true;
+    if(call_depth++ > 0)
+        return;
+
+    if(hipblas_layer_mode & HIPBLAS_LAYER_TRACE)
+    {
+        std::string line = site.function;
+        for(int i = 0; i < count; i++)
+            line += ',' + arg_text(args[i]);
+        trace_sink.write(line);
+    }
+
+    if(hipblas_layer_mode & HIPBLAS_LAYER_BENCH)
+        log_bench(handle, site.function, args, count);
+
+    if(hipblas_layer_mode & HIPBLAS_LAYER_RECORD)
+        hipblas_record_call(handle, site, args, count);
+
+    if(hipblas_layer_mode & HIPBLAS_LAYER_ADVISOR)
+        hipblas_advise_call(handle, site, args, count);
+
+    if(hipblas_layer_mode & (HIPBLAS_LAYER_PROFILE | HIPBLAS_LAYER_RANGES))
+    {
+        shape = site.function;
+        for(int i = 0; i < count; i++)
+            if(args[i].kind != hipblas_log_arg::POINTER)
+                shape += ',' + arg_text(args[i]);
+    }
+
+#ifdef HIPBLAS_WITH_ROCTX
+    if(hipblas_layer_mode & HIPBLAS_LAYER_RANGES)
+        hipblas_range_push(shape.c_str());
+#endif
+
+    const hipblas_handle* h = static_cast<const hipblas_handle*>(handle);
+    if(h && h->managed_memory_mode == HIPBLAS_MANAGED_MEMORY_PREFETCH)
+        hipblas_prefetch_managed(handle, site, args, count);
+
+    if(h && h->stats_mode == HIPBLAS_STATS_MODE_ON)
+    {
+        stats  = h->stats;
+        family = site.family;
+
+        size_t element_size = site.element_size;
+        bool   complex      = site.complex;
+        if(site.data_type >= 0 && site.data_type < count
+           && args[site.data_type].kind != hipblas_log_arg::POINTER)
+        {
+            hipblasDatatype_t type = hipblasDatatype_t(args[site.data_type].i);
+            element_size           = hipblas_datatype_size(type);
+            complex = type == HIPBLAS_C_16F || type == HIPBLAS_C_32F || type == HIPBLAS_C_64F
+                      || type == HIPBLAS_C_16B || type == HIPBLAS_C_8I || type == HIPBLAS_C_8U
+                      || type == HIPBLAS_C_32I || type == HIPBLAS_C_32U;
+        }
+
+        double elements, real_flops;
+        estimate(site, args, count, elements, real_flops);
+        double batch = double(integer_at(args, count, site.batch_count, 1));
+        bytes        = (unsigned long long)(elements * element_size * batch);
+        flops        = (unsigned long long)(real_flops * (complex ? 4 : 1) * batch);
+    }
+
+    if(hipblas_layer_mode & HIPBLAS_LAYER_PROFILE)
+    {
+        // Time the call's device work too, unless synchronizing would break a stream capture
+        if(h && h->capture_mode == HIPBLAS_CAPTURE_MODE_DEFAULT
+           && hipblasGetStream(handle, &stream) == HIPBLAS_STATUS_SUCCESS)
+            synced = hipStreamSynchronize(stream) == hipSuccess;
+    }
+
+    // Events recorded into a capture could not be queried, so capture-safe calls are not timed
+    unsigned long long sequence;
+    if(h && h->timing_mode == HIPBLAS_TIMING_MODE_ON && h->timings
+       && h->capture_mode == HIPBLAS_CAPTURE_MODE_DEFAULT
+       && h->timings->sample(h->timing_sample_every, sequence)
+       && hipblasGetStream(handle, &stream) == HIPBLAS_STATUS_SUCCESS)
+    {
+        hipblasCallTiming_t record;
+        record.function    = site.function;
+        record.family      = site.family;
+        record.m           = integer_at(args, count, site.m, 0);
+        record.n           = integer_at(args, count, site.n, 0);
+        record.k           = integer_at(args, count, site.k, 0);
+        record.batch_count = integer_at(args, count, site.batch_count, 1);
+        record.sequence    = sequence;
+        record.gpu_ms      = 0;
+
+        timing_ticket = h->timings->begin(record, stream);
+        if(timing_ticket >= 0)
+            timings = h->timings;
+    }
+    t0 = std::chrono::steady_clock::now();
+}
+
+void hipblas_log_call::stop()
+{
+    if(--call_depth > 0)
+        return;
+
+    // The handle may be gone by now (hipblasDestroy), so only what begin() kept is used
+    if(timings)
+        timings->finish(timing_ticket, stream);
+
+    if(stats)
+    {
+        auto host_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                           std::chrono::steady_clock::now() - t0)
+                           .count();
+        hipblas_handle_stats::counters& c = stats->family[family];
+        c.calls.fetch_add(1, std::memory_order_relaxed);
+        c.bytes.fetch_add(bytes, std::memory_order_relaxed);
+        c.flops.fetch_add(flops, std::memory_order_relaxed);
+        c.host_ns.fetch_add((unsigned long long)host_ns, std::memory_order_relaxed);
+    }
+
+#ifdef HIPBLAS_WITH_ROCTX
+    if(hipblas_layer_mode & HIPBLAS_LAYER_RANGES)
+        hipblas_range_pop();
+#endif
+
+    if(!(hipblas_layer_mode & HIPBLAS_LAYER_PROFILE))
+        return;
+
+    if(synced)
+        (void)hipStreamSynchronize(stream);
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - t0;
+    profile.add(shape, elapsed.count());
+}
+
+void hipblas_log_route(const char* function, const char* routine)
+{
+    if(hipblas_layer_mode & HIPBLAS_LAYER_TRACE)
+        trace_sink.write(std::string(function) + " -> " + routine);
+}
+
+/* ============================================================================================ */
+/*  Per-handle counters */
+
+hipblasStatus_t hipblasSetStatsMode(hipblasHandle_t handle, hipblasStatsMode_t mode)
+{
+    HIPBLAS_LOG_CALL(handle, mode);
+    hipblas_handle* h = static_cast<hipblas_handle*>(handle);
+    if(h == nullptr)
+    {
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    }
+    if(mode != HIPBLAS_STATS_MODE_OFF && mode != HIPBLAS_STATS_MODE_ON)
+    {
+        return HIPBLAS_STATUS_INVALID_ENUM;
+    }
+    if(mode == HIPBLAS_STATS_MODE_ON && !h->stats)
+    {
+        try
+        {
+            h->stats = std::make_shared<hipblas_handle_stats>();
+        }
+        catch(const std::bad_alloc&)
+        {
+            return HIPBLAS_STATUS_ALLOC_FAILED;
+        }
+    }
+    h->stats_mode = mode;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblasGetStatsMode(hipblasHandle_t handle, hipblasStatsMode_t* mode)
+{
+    HIPBLAS_LOG_CALL(handle, mode);
+    if(handle == nullptr)
+    {
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    }
+    if(mode == nullptr)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    *mode = static_cast<hipblas_handle*>(handle)->stats_mode;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblasGetHandleStats(hipblasHandle_t handle, hipblasHandleStats_t* stats)
+{
+    HIPBLAS_LOG_CALL(handle, stats);
+    const hipblas_handle* h = static_cast<const hipblas_handle*>(handle);
+    if(h == nullptr)
+    {
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    }
+    if(stats == nullptr)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    for(int f = 0; f < HIPBLAS_FAMILY_COUNT; f++)
+    {
+        hipblasRoutineStats_t& out = stats->family[f];
+        if(!h->stats)
+        {
+            out = {0, 0, 0, 0};
+            continue;
+        }
+        const hipblas_handle_stats::counters& c = h->stats->family[f];
+        out.calls   = c.calls.load(std::memory_order_relaxed);
+        out.bytes   = c.bytes.load(std::memory_order_relaxed);
+        out.flops   = c.flops.load(std::memory_order_relaxed);
+        out.host_ns = c.host_ns.load(std::memory_order_relaxed);
+    }
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblasResetHandleStats(hipblasHandle_t handle)
+{
+    HIPBLAS_LOG_CALL(handle);
+    const hipblas_handle* h = static_cast<const hipblas_handle*>(handle);
+    if(h == nullptr)
+    {
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    }
+    if(h->stats)
+    {
+        for(hipblas_handle_stats::counters& c : h->stats->family)
+        {
+            c.calls.store(0, std::memory_order_relaxed);
+            c.bytes.store(0, std::memory_order_relaxed);
+            c.flops.store(0, std::memory_order_relaxed);
+            c.host_ns.store(0, std::memory_order_relaxed);
+        }
+    }
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+/* ============================================================================================ */
+/*  Call timings */
+
+hipblasStatus_t
+    hipblasSetTimingMode(hipblasHandle_t handle, hipblasTimingMode_t mode, int sample_every)
+{
+    HIPBLAS_LOG_CALL(handle, mode, sample_every);
+    hipblas_handle* h = static_cast<hipblas_handle*>(handle);
+    if(h == nullptr)
+    {
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    }
+    if(mode != HIPBLAS_TIMING_MODE_OFF && mode != HIPBLAS_TIMING_MODE_ON)
+    {
+        return HIPBLAS_STATUS_INVALID_ENUM;
+    }
+    if(sample_every < 1)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    if(mode == HIPBLAS_TIMING_MODE_ON && !h->timings)
+    {
+        try
+        {
+            h->timings = std::make_shared<hipblas_call_timings>();
+        }
+        catch(const std::bad_alloc&)
+        {
+            return HIPBLAS_STATUS_ALLOC_FAILED;
+        }
+    }
+    h->timing_sample_every = sample_every;
+    h->timing_mode         = mode;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t
+    hipblasGetTimingMode(hipblasHandle_t handle, hipblasTimingMode_t* mode, int* sample_every)
+{
+    HIPBLAS_LOG_CALL(handle, mode, sample_every);
+    const hipblas_handle* h = static_cast<const hipblas_handle*>(handle);
+    if(h == nullptr)
+    {
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    }
+    if(mode == nullptr || sample_every == nullptr)
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    *mode         = h->timing_mode;
+    *sample_every = h->timing_sample_every;
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblasDrainTimings(hipblasHandle_t      handle,
+                                    hipblasCallTiming_t* records,
+                                    int                  capacity,
+                                    int*                 count,
+                                    unsigned long long*  dropped)
+{
+    HIPBLAS_LOG_CALL(handle, records, capacity, count, dropped);
+    const hipblas_handle* h = static_cast<const hipblas_handle*>(handle);
+    if(h == nullptr)
+    {
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    }
+    if(count == nullptr || capacity < 0 || (records == nullptr && capacity > 0))
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    *count = h->timings ? h->timings->drain(records, capacity) : 0;
+    if(dropped)
+        *dropped = h->timings ? h->timings->take_dropped() : 0;
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,46 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipblas_handle.h"
+#include "hipblas_logging.h"
+#include <hip/hip_runtime_api.h>
+
+void hipblas_prefetch_managed(hipblasHandle_t         handle,
+                              const hipblas_log_site& site,
+                              const hipblas_log_arg*  args,
+                              int                     count)
+{
+    // A prefetch would be recorded into the graph, or fail the capture
+    const hipblas_handle* h = static_cast<const hipblas_handle*>(handle);
+    hipStream_t           stream;
+    int                   device;
+    if(h->capture_mode == HIPBLAS_CAPTURE_MODE_SAFE
+       || hipblasGetStream(handle, &stream) != HIPBLAS_STATUS_SUCCESS
+       || hipGetDevice(&device) != hipSuccess)
+        return;
+
+    for(int i = 0; i < count; i++)
+    {
+        if(args[i].kind != hipblas_log_arg::POINTER || !args[i].p
+           || (i < 64 && (site.scalars >> i & 1)))
+            continue;
+
+        // Host stack and heap pointers are unknown to the runtime, which is not an error here
+        void*                 ptr = const_cast<void*>(args[i].p);
+        void*                 base;
+        size_t                size;
+        hipPointerAttribute_t attr;
+        if(hipPointerGetAttributes(&attr, ptr) != hipSuccess || !attr.isManaged
+           || hipMemGetAddressRange(&base, &size, ptr) != hipSuccess)
+        {
+            (void)hipGetLastError();
+            continue;
+        }
+
+        // The call reads nothing below its pointer, but may read to the end of the allocation
+        size_t bytes = size - (static_cast<char*>(ptr) - static_cast<char*>(base));
+        (void)hipMemAdvise(ptr, bytes, hipMemAdviseSetAccessedBy, device);
+        (void)hipMemPrefetchAsync(ptr, bytes, device, stream);
+    }
+}
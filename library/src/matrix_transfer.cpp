@@ -0,0 +1,456 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "hipblas_handle.h"
+#include "hipblas_kernels.h"
+#include "hipblas_logging.h"
+#include <algorithm>
+#include <cstring>
+#include <hip/hip_runtime_api.h>
+#include <stdint.h>
+
+namespace
+{
+    using slot = hipblas_pointer_array_ring::slot;
+
+    // A batch goes out in chunks of at most this many bytes of matrices, each packed while the
+    // chunk before it is on the wire. Larger matrices are copied one by one
+    constexpr size_t CHUNK_BYTES = size_t(16) << 20;
+
+    // The pointer arrays follow the packed matrices at this alignment
+    constexpr size_t ARRAY_ALIGN = 256;
+
+    hipblasStatus_t copy_status(hipError_t err)
+    {
+        return err == hipSuccess ? HIPBLAS_STATUS_SUCCESS : HIPBLAS_STATUS_INTERNAL_ERROR;
+    }
+
+    // One chunk in a staging slot: count packed matrices of matrix bytes each, then the source
+    // and the destination arrays of the device copy
+    struct chunk
+    {
+        int    first;
+        int    count;
+        size_t matrix;
+
+        size_t arrays() const
+        {
+            return (count * matrix + ARRAY_ALIGN - 1) / ARRAY_ALIGN * ARRAY_ALIGN;
+        }
+
+        size_t bytes() const
+        {
+            return arrays() + 2 * count * sizeof(void*);
+        }
+
+        const void** src(void* base) const
+        {
+            return reinterpret_cast<const void**>(static_cast<char*>(base) + arrays());
+        }
+
+        void** dst(void* base) const
+        {
+            return reinterpret_cast<void**>(static_cast<char*>(base) + arrays()) + count;
+        }
+
+        char* packed(void* base, int b) const
+        {
+            return static_cast<char*>(base) + b * matrix;
+        }
+    };
+
+    // The widest unit, at most 8 bytes, dividing elem_size and every address in bits
+    size_t copy_unit(uintptr_t bits)
+    {
+        bits |= 8;
+        return bits & (~bits + 1);
+    }
+
+    // The device copy between the staged matrices and the caller's, in units of unit bytes
+    hipError_t copy_units(hipStream_t        stream,
+                          size_t             unit,
+                          int                rows,
+                          int                cols,
+                          const void* const* src,
+                          int64_t            lds,
+                          void* const*       dst,
+                          int64_t            ldd,
+                          int                count)
+    {
+        int m = int(rows / unit);
+        lds /= unit;
+        ldd /= unit;
+        switch(unit)
+        {
+        case 8:
+            return hipblas_copy_matrix_batched(stream,
+                                               m,
+                                               cols,
+                                               reinterpret_cast<const double* const*>(src),
+                                               lds,
+                                               reinterpret_cast<double* const*>(dst),
+                                               ldd,
+                                               count);
+        case 4:
+            return hipblas_copy_matrix_batched(stream,
+                                               m,
+                                               cols,
+                                               reinterpret_cast<const float* const*>(src),
+                                               lds,
+                                               reinterpret_cast<float* const*>(dst),
+                                               ldd,
+                                               count);
+        case 2:
+            return hipblas_copy_matrix_batched(stream,
+                                               m,
+                                               cols,
+                                               reinterpret_cast<const hipblasHalf* const*>(src),
+                                               lds,
+                                               reinterpret_cast<hipblasHalf* const*>(dst),
+                                               ldd,
+                                               count);
+        default:
+            return hipblas_copy_matrix_batched(stream,
+                                               m,
+                                               cols,
+                                               reinterpret_cast<const int8_t* const*>(src),
+                                               lds,
+                                               reinterpret_cast<int8_t* const*>(dst),
+                                               ldd,
+                                               count);
+        }
+    }
+
+    // Copies cols columns of width bytes between host buffers, in one piece when both are
+    // contiguous
+    void copy_host(size_t width, int cols, const char* src, size_t lds, char* dst, size_t ldd)
+    {
+        if(lds == width && ldd == width)
+            std::memcpy(dst, src, width * cols);
+        else
+            for(int j = 0; j < cols; j++)
+                std::memcpy(dst + j * ldd, src + j * lds, width);
+    }
+
+    hipblasStatus_t check_transfer(hipblasHandle_t handle,
+                                   int             rows,
+                                   int             cols,
+                                   int             elem_size,
+                                   bool            A,
+                                   int             lda,
+                                   bool            B,
+                                   int             ldb,
+                                   int             batch_count)
+    {
+        if(handle == nullptr)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if(rows < 0 || cols < 0 || elem_size <= 0 || lda < std::max(1, rows)
+           || ldb < std::max(1, rows) || batch_count < 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(rows && cols && batch_count && (!A || !B))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(static_cast<hipblas_handle*>(handle)->capture_mode == HIPBLAS_CAPTURE_MODE_SAFE)
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // host(b) and device(b) give matrix b on each side. The matrices of a chunk are packed into
+    // a pinned slot with the arrays of the device copy, uploaded in one transfer and scattered
+    // by one kernel; the call returns once every chunk is queued
+    template <typename Host, typename Device>
+    hipblasStatus_t set_batched(hipblasHandle_t handle,
+                                int             rows,
+                                int             cols,
+                                int             elem_size,
+                                Host            host,
+                                int             lda,
+                                Device          device,
+                                int             ldb,
+                                int             batch_count)
+    {
+        hipStream_t     stream;
+        hipblasStatus_t status = hipblasGetStream(handle, &stream);
+        size_t          matrix = size_t(rows) * cols * elem_size;
+        size_t          width  = size_t(rows) * elem_size;
+        if(status != HIPBLAS_STATUS_SUCCESS || matrix == 0 || batch_count == 0)
+            return status;
+
+        if(matrix > CHUNK_BYTES)
+        {
+            for(int b = 0; b < batch_count && status == HIPBLAS_STATUS_SUCCESS; b++)
+                status = copy_status(hipMemcpy2DAsync(device(b),
+                                                      size_t(ldb) * elem_size,
+                                                      host(b),
+                                                      size_t(lda) * elem_size,
+                                                      width,
+                                                      cols,
+                                                      hipMemcpyHostToDevice,
+                                                      stream));
+            return status;
+        }
+
+        hipblas_pointer_array_ring& ring = static_cast<hipblas_handle*>(handle)->transfer_staging;
+        int per_chunk = int(std::min<size_t>(batch_count, CHUNK_BYTES / matrix));
+        for(int first = 0; first < batch_count && status == HIPBLAS_STATUS_SUCCESS;
+            first += per_chunk)
+        {
+            chunk c{first, std::min(per_chunk, batch_count - first), matrix};
+            slot* s;
+            status = ring.acquire(c.bytes(), s);
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                break;
+
+            uintptr_t bits = elem_size;
+            for(int b = 0; b < c.count; b++)
+            {
+                void* dst = device(first + b);
+                copy_host(width,
+                          cols,
+                          static_cast<const char*>(host(first + b)),
+                          size_t(lda) * elem_size,
+                          c.packed(s->host, b),
+                          width);
+                c.src(s->host)[b] = c.packed(s->device, b);
+                c.dst(s->host)[b] = dst;
+                bits |= reinterpret_cast<uintptr_t>(dst);
+            }
+
+            size_t unit = copy_unit(bits);
+            status      = copy_status(
+                hipMemcpyAsync(s->device, s->host, c.bytes(), hipMemcpyHostToDevice, stream));
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = copy_status(copy_units(stream,
+                                                unit,
+                                                int(width),
+                                                cols,
+                                                c.src(s->device),
+                                                int64_t(width),
+                                                c.dst(s->device),
+                                                int64_t(ldb) * elem_size,
+                                                c.count));
+            ring.release(s, stream);
+        }
+        return status;
+    }
+
+    // Gathers each chunk into a slot on the device and downloads it in one transfer; the host
+    // unpacks a chunk while the next one is copied, and the call returns once B holds them all
+    template <typename Device, typename Host>
+    hipblasStatus_t get_batched(hipblasHandle_t handle,
+                                int             rows,
+                                int             cols,
+                                int             elem_size,
+                                Device          device,
+                                int             lda,
+                                Host            host,
+                                int             ldb,
+                                int             batch_count)
+    {
+        hipStream_t     stream;
+        hipblasStatus_t status = hipblasGetStream(handle, &stream);
+        size_t          matrix = size_t(rows) * cols * elem_size;
+        size_t          width  = size_t(rows) * elem_size;
+        if(status != HIPBLAS_STATUS_SUCCESS || matrix == 0 || batch_count == 0)
+            return status;
+
+        if(matrix > CHUNK_BYTES)
+        {
+            for(int b = 0; b < batch_count && status == HIPBLAS_STATUS_SUCCESS; b++)
+                status = copy_status(hipMemcpy2DAsync(host(b),
+                                                      size_t(ldb) * elem_size,
+                                                      device(b),
+                                                      size_t(lda) * elem_size,
+                                                      width,
+                                                      cols,
+                                                      hipMemcpyDeviceToHost,
+                                                      stream));
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = copy_status(hipStreamSynchronize(stream));
+            return status;
+        }
+
+        // Copies a downloaded chunk out of its slot into B
+        auto unpack = [&](const chunk& c, slot* s) {
+            if(hipEventSynchronize(s->done) != hipSuccess)
+                return HIPBLAS_STATUS_INTERNAL_ERROR;
+            for(int b = 0; b < c.count; b++)
+                copy_host(width,
+                          cols,
+                          c.packed(s->host, b),
+                          width,
+                          static_cast<char*>(host(c.first + b)),
+                          size_t(ldb) * elem_size);
+            return HIPBLAS_STATUS_SUCCESS;
+        };
+
+        hipblas_pointer_array_ring& ring = static_cast<hipblas_handle*>(handle)->transfer_staging;
+        int   per_chunk = int(std::min<size_t>(batch_count, CHUNK_BYTES / matrix));
+        chunk queued{0, 0, matrix};
+        slot* queued_slot = nullptr;
+        for(int first = 0; first < batch_count && status == HIPBLAS_STATUS_SUCCESS;
+            first += per_chunk)
+        {
+            chunk c{first, std::min(per_chunk, batch_count - first), matrix};
+            slot* s;
+            status = ring.acquire(c.bytes(), s);
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                break;
+
+            uintptr_t bits = elem_size;
+            for(int b = 0; b < c.count; b++)
+            {
+                const void* src   = device(first + b);
+                c.src(s->host)[b] = src;
+                c.dst(s->host)[b] = c.packed(s->device, b);
+                bits |= reinterpret_cast<uintptr_t>(src);
+            }
+
+            size_t unit = copy_unit(bits);
+            status      = copy_status(hipMemcpyAsync(c.src(s->device),
+                                                c.src(s->host),
+                                                2 * c.count * sizeof(void*),
+                                                hipMemcpyHostToDevice,
+                                                stream));
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = copy_status(copy_units(stream,
+                                                unit,
+                                                int(width),
+                                                cols,
+                                                c.src(s->device),
+                                                int64_t(lda) * elem_size,
+                                                c.dst(s->device),
+                                                int64_t(width),
+                                                c.count));
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = copy_status(hipMemcpyAsync(
+                    s->host, s->device, c.count * matrix, hipMemcpyDeviceToHost, stream));
+            ring.release(s, stream);
+
+            if(status == HIPBLAS_STATUS_SUCCESS && queued_slot)
+                status = unpack(queued, queued_slot);
+            queued      = c;
+            queued_slot = s;
+        }
+        if(status == HIPBLAS_STATUS_SUCCESS && queued_slot)
+            status = unpack(queued, queued_slot);
+        return status;
+    }
+}
+
+hipblasStatus_t hipblasSetMatrixBatched(hipblasHandle_t   handle,
+                                        int               rows,
+                                        int               cols,
+                                        int               elemSize,
+                                        const void* const A[],
+                                        int               lda,
+                                        void* const       B[],
+                                        int               ldb,
+                                        int               batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, rows, cols, elemSize, A, lda, B, ldb, batch_count);
+    hipblasStatus_t status
+        = check_transfer(handle, rows, cols, elemSize, A, lda, B, ldb, batch_count);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    return set_batched(
+        handle,
+        rows,
+        cols,
+        elemSize,
+        [&](int b) { return A[b]; },
+        lda,
+        [&](int b) { return B[b]; },
+        ldb,
+        batch_count);
+}
+
+hipblasStatus_t hipblasGetMatrixBatched(hipblasHandle_t   handle,
+                                        int               rows,
+                                        int               cols,
+                                        int               elemSize,
+                                        const void* const A[],
+                                        int               lda,
+                                        void* const       B[],
+                                        int               ldb,
+                                        int               batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, rows, cols, elemSize, A, lda, B, ldb, batch_count);
+    hipblasStatus_t status
+        = check_transfer(handle, rows, cols, elemSize, A, lda, B, ldb, batch_count);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    return get_batched(
+        handle,
+        rows,
+        cols,
+        elemSize,
+        [&](int b) { return A[b]; },
+        lda,
+        [&](int b) { return B[b]; },
+        ldb,
+        batch_count);
+}
+
+hipblasStatus_t hipblasSetMatrixStridedBatched(hipblasHandle_t handle,
+                                               int             rows,
+                                               int             cols,
+                                               int             elemSize,
+                                               const void*     A,
+                                               int             lda,
+                                               long long       strideA,
+                                               void*           B,
+                                               int             ldb,
+                                               long long       strideB,
+                                               int             batch_count)
+{
+    HIPBLAS_LOG_CALL(
+        handle, rows, cols, elemSize, A, lda, strideA, B, ldb, strideB, batch_count);
+    hipblasStatus_t status
+        = check_transfer(handle, rows, cols, elemSize, A, lda, B, ldb, batch_count);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    return set_batched(
+        handle,
+        rows,
+        cols,
+        elemSize,
+        [&](int b) { return static_cast<const char*>(A) + b * strideA * elemSize; },
+        lda,
+        [&](int b) { return static_cast<void*>(static_cast<char*>(B) + b * strideB * elemSize); },
+        ldb,
+        batch_count);
+}
+
+hipblasStatus_t hipblasGetMatrixStridedBatched(hipblasHandle_t handle,
+                                               int             rows,
+                                               int             cols,
+                                               int             elemSize,
+                                               const void*     A,
+                                               int             lda,
+                                               long long       strideA,
+                                               void*           B,
+                                               int             ldb,
+                                               long long       strideB,
+                                               int             batch_count)
+{
+    HIPBLAS_LOG_CALL(
+        handle, rows, cols, elemSize, A, lda, strideA, B, ldb, strideB, batch_count);
+    hipblasStatus_t status
+        = check_transfer(handle, rows, cols, elemSize, A, lda, B, ldb, batch_count);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    return get_batched(
+        handle,
+        rows,
+        cols,
+        elemSize,
+        [&](int b) {
+            return static_cast<const void*>(static_cast<const char*>(A) + b * strideA * elemSize);
+        },
+        lda,
+        [&](int b) { return static_cast<void*>(static_cast<char*>(B) + b * strideB * elemSize); },
+        ldb,
+        batch_count);
+}
@@ -0,0 +1,594 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "hipblas_handle.h"
+#include "hipblas_kernels.h"
+#include "hipblas_logging.h"
+#include <algorithm>
+#include <cmath>
+#include <hip/hip_runtime_api.h>
+#include <limits>
+
+#ifdef __HIP_PLATFORM_SOLVER__
+namespace
+{
+    // LAPACK's ITERMAX for dsgesv and zcgesv
+    constexpr int MAX_REFINEMENT_STEPS = 30;
+
+    // The lower precision each solver factors in, and the batched getrf and getrs of both; the
+    // non-batched forms run as a batch of one, as cuBLAS has only the batched factorization
+    template <typename T>
+    struct routines;
+
+    template <>
+    struct routines<double>
+    {
+        using low = float;
+
+        static constexpr auto getrf     = hipblasDgetrfBatched;
+        static constexpr auto getrs     = hipblasDgetrsBatched;
+        static constexpr auto getrf_low = hipblasSgetrfBatched;
+        static constexpr auto getrs_low = hipblasSgetrsBatched;
+    };
+
+    template <>
+    struct routines<hipblasDoubleComplex>
+    {
+        using low = hipblasComplex;
+
+        static constexpr auto getrf     = hipblasZgetrfBatched;
+        static constexpr auto getrs     = hipblasZgetrsBatched;
+        static constexpr auto getrf_low = hipblasCgetrfBatched;
+        static constexpr auto getrs_low = hipblasCgetrsBatched;
+    };
+
+    template <typename T>
+    hipblas_batched_operand<const T> as_const(hipblas_batched_operand<T> op)
+    {
+        return {op.ptr, op.stride, op.array};
+    }
+
+    hipblasStatus_t launch_status(hipError_t err)
+    {
+        return err == hipSuccess ? HIPBLAS_STATUS_SUCCESS : HIPBLAS_STATUS_INTERNAL_ERROR;
+    }
+
+    // The getrf and getrs calls take the device pointer arrays built here, so they run with the
+    // handle in device pointer array mode whatever mode the caller's arrays came in
+    template <typename F>
+    hipblasStatus_t with_device_arrays(hipblasHandle_t handle, F solve)
+    {
+        hipblasPointerArrayMode_t mode;
+        hipblasStatus_t           status = hipblasGetPointerArrayMode(handle, &mode);
+        if(status == HIPBLAS_STATUS_SUCCESS && mode != HIPBLAS_POINTER_ARRAY_DEVICE)
+            status = hipblasSetPointerArrayMode(handle, HIPBLAS_POINTER_ARRAY_DEVICE);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        status = solve();
+        if(mode != HIPBLAS_POINTER_ARRAY_DEVICE)
+        {
+            hipblasStatus_t reset = hipblasSetPointerArrayMode(handle, mode);
+            status                = status != HIPBLAS_STATUS_SUCCESS ? status : reset;
+        }
+        return status;
+    }
+
+    template <typename T>
+    hipblasStatus_t
+        pointer_array(hipStream_t stream, hipblas_batched_operand<T> op, T** array, int batch_count)
+    {
+        return array ? launch_status(
+                   hipblas_strided_pointer_array(stream, op.ptr, op.stride, array, batch_count))
+                     : HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // The refinement of LAPACK's dsgesv on every batch at once: factor A in the lower precision,
+    // then correct X with lower-precision solves of the higher-precision residual B - A X until
+    // each batch converges. A batch that overflows, hits a zero pivot or fails to converge sends
+    // the whole call to a higher-precision getrf and getrs. All scratch space, including the
+    // pointer arrays the getrf and getrs calls need, is one workspace carve; none of those calls
+    // carve the workspace themselves
+    template <typename T>
+    hipblasStatus_t refine_gesv(hipblasHandle_t                  handle,
+                                int                              n,
+                                int                              nrhs,
+                                hipblas_batched_operand<T>       A,
+                                int                              lda,
+                                int*                             ipiv,
+                                int                              strideP,
+                                hipblas_batched_operand<const T> B,
+                                int                              ldb,
+                                hipblas_batched_operand<T>       X,
+                                int                              ldx,
+                                int*                             iter,
+                                int*                             info,
+                                int                              batch_count)
+    {
+        using R  = routines<T>;
+        using Tl = typename R::low;
+
+        if(handle == nullptr)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if(n < 0 || nrhs < 0 || lda < std::max(1, n) || ldb < std::max(1, n)
+           || ldx < std::max(1, n) || batch_count < 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(batch_count == 0)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(ipiv == nullptr || strideP < n || iter == nullptr || info == nullptr
+           || (A.ptr == nullptr && A.array == nullptr) || (B.ptr == nullptr && B.array == nullptr)
+           || (X.ptr == nullptr && X.array == nullptr))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(static_cast<hipblas_handle*>(handle)->capture_mode == HIPBLAS_CAPTURE_MODE_SAFE)
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+        hipStream_t     stream;
+        hipblasStatus_t status = hipblasGetStream(handle, &stream);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        size_t batches = batch_count;
+        if(hipMemsetAsync(iter, 0, batches * sizeof(int), stream) != hipSuccess
+           || hipMemsetAsync(info, 0, batches * sizeof(int), stream) != hipSuccess)
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+        if(n == 0)
+            return HIPBLAS_STATUS_SUCCESS;
+
+        // The lower-precision factors and right-hand sides are stored with leading dimension n
+        bool    strided = A.array == nullptr;
+        Tl*     low_a;
+        Tl*     low_x;
+        T*      residual;
+        Tl**    low_a_arrays;
+        Tl**    low_x_arrays;
+        T**     a_arrays;
+        T**     x_arrays;
+        double* cte;
+        int*    low_info;
+        int*    state;
+        int*    counts;
+        status = hipblas_workspace_carve(handle,
+                                         low_a,
+                                         batches * n * n,
+                                         low_x,
+                                         batches * n * nrhs,
+                                         residual,
+                                         batches * n * nrhs,
+                                         low_a_arrays,
+                                         batches,
+                                         low_x_arrays,
+                                         batches,
+                                         a_arrays,
+                                         strided ? batches : 0,
+                                         x_arrays,
+                                         strided ? batches : 0,
+                                         cte,
+                                         batches,
+                                         low_info,
+                                         batches,
+                                         state,
+                                         batches,
+                                         counts,
+                                         size_t(2));
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        hipblas_batched_operand<Tl> low_a_op{low_a, int64_t(n) * n, nullptr};
+        hipblas_batched_operand<Tl> low_x_op{low_x, int64_t(n) * nrhs, nullptr};
+        hipblas_batched_operand<T>  residual_op{residual, int64_t(n) * nrhs, nullptr};
+        if(strided)
+        {
+            status = pointer_array(stream, A, a_arrays, batch_count);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = pointer_array(stream, X, x_arrays, batch_count);
+        }
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = pointer_array(stream, low_a_op, low_a_arrays, batch_count);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = pointer_array(stream, low_x_op, low_x_arrays, batch_count);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        T* const* a_array = strided ? a_arrays : A.array;
+        T* const* x_array = strided ? x_arrays : X.array;
+
+        // eps is LAPACK's dlamch('E'), the unit roundoff of double precision
+        double scale = std::numeric_limits<double>::epsilon() / 2 * std::sqrt(double(n));
+        if(hipMemsetAsync(state, 0, batches * sizeof(int), stream) != hipSuccess)
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+        status = launch_status(
+            hipblas_refine_threshold_batched(stream, n, as_const(A), lda, scale, cte, batch_count));
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = launch_status(hipblas_convert_matrix_batched(
+                stream, n, n, as_const(A), lda, low_a_op, n, false, state, batch_count));
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = launch_status(hipblas_convert_matrix_batched(
+                stream, n, nrhs, B, ldb, low_x_op, n, false, state, batch_count));
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        return with_device_arrays(handle, [&] {
+            // getrs reports only argument errors, through a host info
+            int             solve_info;
+            T               minus_one = -1;
+            T               one       = 1;
+            hipblasStatus_t status    = R::getrf_low(
+                handle, n, low_a_arrays, n, ipiv, strideP, low_info, batch_count);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = R::getrs_low(handle,
+                                      HIPBLAS_OP_N,
+                                      n,
+                                      nrhs,
+                                      low_a_arrays,
+                                      n,
+                                      ipiv,
+                                      strideP,
+                                      low_x_arrays,
+                                      n,
+                                      &solve_info,
+                                      batch_count);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = launch_status(hipblas_convert_matrix_batched(
+                    stream, n, nrhs, as_const(low_x_op), n, X, ldx, false, state, batch_count));
+
+            int unconverged = -1;
+            for(int step = 0; status == HIPBLAS_STATUS_SUCCESS; step++)
+            {
+                // residual = B - A X, then the batches it leaves unconverged take one more step
+                int counts_host[2] = {};
+                status             = launch_status(hipblas_convert_matrix_batched(
+                    stream, n, nrhs, B, ldb, residual_op, n, false, state, batch_count));
+                if(status == HIPBLAS_STATUS_SUCCESS)
+                    status = launch_status(hipblas_gemm_batched(stream,
+                                                                HIPBLAS_OP_N,
+                                                                HIPBLAS_OP_N,
+                                                                n,
+                                                                nrhs,
+                                                                n,
+                                                                &minus_one,
+                                                                &one,
+                                                                false,
+                                                                0,
+                                                                as_const(A),
+                                                                lda,
+                                                                as_const(X),
+                                                                ldx,
+                                                                residual_op,
+                                                                n,
+                                                                batch_count));
+                if(status == HIPBLAS_STATUS_SUCCESS
+                   && (hipMemsetAsync(counts, 0, sizeof(counts_host), stream) != hipSuccess
+                       || hipblas_refine_check_batched(stream,
+                                                       n,
+                                                       nrhs,
+                                                       as_const(X),
+                                                       ldx,
+                                                       as_const(residual_op),
+                                                       n,
+                                                       cte,
+                                                       step == 0 ? low_info : nullptr,
+                                                       step,
+                                                       state,
+                                                       iter,
+                                                       counts,
+                                                       batch_count)
+                              != hipSuccess
+                       || hipMemcpyAsync(counts_host,
+                                         counts,
+                                         sizeof(counts_host),
+                                         hipMemcpyDeviceToHost,
+                                         stream)
+                              != hipSuccess
+                       || hipStreamSynchronize(stream) != hipSuccess))
+                    status = HIPBLAS_STATUS_INTERNAL_ERROR;
+                if(status != HIPBLAS_STATUS_SUCCESS)
+                    return status;
+
+                if(counts_host[1] > 0)
+                    break;
+                if(counts_host[0] == 0)
+                    return HIPBLAS_STATUS_SUCCESS;
+                if(step == MAX_REFINEMENT_STEPS)
+                {
+                    unconverged = -(MAX_REFINEMENT_STEPS + 1);
+                    break;
+                }
+
+                status = launch_status(hipblas_convert_matrix_batched(stream,
+                                                                      n,
+                                                                      nrhs,
+                                                                      as_const(residual_op),
+                                                                      n,
+                                                                      low_x_op,
+                                                                      n,
+                                                                      false,
+                                                                      state,
+                                                                      batch_count));
+                if(status == HIPBLAS_STATUS_SUCCESS)
+                    status = R::getrs_low(handle,
+                                          HIPBLAS_OP_N,
+                                          n,
+                                          nrhs,
+                                          low_a_arrays,
+                                          n,
+                                          ipiv,
+                                          strideP,
+                                          low_x_arrays,
+                                          n,
+                                          &solve_info,
+                                          batch_count);
+                if(status == HIPBLAS_STATUS_SUCCESS)
+                    status = launch_status(hipblas_convert_matrix_batched(
+                        stream, n, nrhs, as_const(low_x_op), n, X, ldx, true, state, batch_count));
+            }
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+
+            // The whole batch again in the higher precision, from X = B
+            status = launch_status(
+                hipblas_refine_fallback_batched(stream, unconverged, state, iter, batch_count));
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = launch_status(hipblas_convert_matrix_batched(
+                    stream, n, nrhs, B, ldb, X, ldx, false, nullptr, batch_count));
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = R::getrf(handle, n, a_array, lda, ipiv, strideP, info, batch_count);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = R::getrs(handle,
+                                  HIPBLAS_OP_N,
+                                  n,
+                                  nrhs,
+                                  a_array,
+                                  lda,
+                                  ipiv,
+                                  strideP,
+                                  x_array,
+                                  ldx,
+                                  &solve_info,
+                                  batch_count);
+            return status;
+        });
+    }
+
+    template <typename T>
+    hipblas_batched_operand<T> batch_of(T* ptr, int64_t stride)
+    {
+        return {ptr, stride, nullptr};
+    }
+
+    template <typename T>
+    hipblas_batched_operand<T> batch_of(T* const array[])
+    {
+        return {nullptr, 0, array};
+    }
+}
+
+hipblasStatus_t hipblasDSgesv(hipblasHandle_t handle,
+                              const int       n,
+                              const int       nrhs,
+                              double*         A,
+                              const int       lda,
+                              int*            ipiv,
+                              const double*   B,
+                              const int       ldb,
+                              double*         X,
+                              const int       ldx,
+                              int*            iter,
+                              int*            info)
+{
+    HIPBLAS_LOG_CALL(handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, iter, info);
+    return refine_gesv(handle,
+                       n,
+                       nrhs,
+                       batch_of(A, 0),
+                       lda,
+                       ipiv,
+                       n,
+                       batch_of(B, 0),
+                       ldb,
+                       batch_of(X, 0),
+                       ldx,
+                       iter,
+                       info,
+                       1);
+}
+
+hipblasStatus_t hipblasZCgesv(hipblasHandle_t             handle,
+                              const int                   n,
+                              const int                   nrhs,
+                              hipblasDoubleComplex*       A,
+                              const int                   lda,
+                              int*                        ipiv,
+                              const hipblasDoubleComplex* B,
+                              const int                   ldb,
+                              hipblasDoubleComplex*       X,
+                              const int                   ldx,
+                              int*                        iter,
+                              int*                        info)
+{
+    HIPBLAS_LOG_CALL(handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, iter, info);
+    return refine_gesv(handle,
+                       n,
+                       nrhs,
+                       batch_of(A, 0),
+                       lda,
+                       ipiv,
+                       n,
+                       batch_of(B, 0),
+                       ldb,
+                       batch_of(X, 0),
+                       ldx,
+                       iter,
+                       info,
+                       1);
+}
+
+hipblasStatus_t hipblasDSgesvBatched(hipblasHandle_t     handle,
+                                     const int           n,
+                                     const int           nrhs,
+                                     double* const       A[],
+                                     const int           lda,
+                                     int*                ipiv,
+                                     const int           strideP,
+                                     const double* const B[],
+                                     const int           ldb,
+                                     double* const       X[],
+                                     const int           ldx,
+                                     int*                iter,
+                                     int*                info,
+                                     const int           batch_count)
+{
+    HIPBLAS_LOG_CALL(
+        handle, n, nrhs, A, lda, ipiv, strideP, B, ldb, X, ldx, iter, info, batch_count);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, A, B, X);
+    return refine_gesv(handle,
+                       n,
+                       nrhs,
+                       batch_of(A),
+                       lda,
+                       ipiv,
+                       strideP,
+                       batch_of(B),
+                       ldb,
+                       batch_of(X),
+                       ldx,
+                       iter,
+                       info,
+                       batch_count);
+}
+
+hipblasStatus_t hipblasZCgesvBatched(hipblasHandle_t                   handle,
+                                     const int                         n,
+                                     const int                         nrhs,
+                                     hipblasDoubleComplex* const       A[],
+                                     const int                         lda,
+                                     int*                              ipiv,
+                                     const int                         strideP,
+                                     const hipblasDoubleComplex* const B[],
+                                     const int                         ldb,
+                                     hipblasDoubleComplex* const       X[],
+                                     const int                         ldx,
+                                     int*                              iter,
+                                     int*                              info,
+                                     const int                         batch_count)
+{
+    HIPBLAS_LOG_CALL(
+        handle, n, nrhs, A, lda, ipiv, strideP, B, ldb, X, ldx, iter, info, batch_count);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, A, B, X);
+    return refine_gesv(handle,
+                       n,
+                       nrhs,
+                       batch_of(A),
+                       lda,
+                       ipiv,
+                       strideP,
+                       batch_of(B),
+                       ldb,
+                       batch_of(X),
+                       ldx,
+                       iter,
+                       info,
+                       batch_count);
+}
+
+hipblasStatus_t hipblasDSgesvStridedBatched(hipblasHandle_t handle,
+                                            const int       n,
+                                            const int       nrhs,
+                                            double*         A,
+                                            const int       lda,
+                                            const int       strideA,
+                                            int*            ipiv,
+                                            const int       strideP,
+                                            const double*   B,
+                                            const int       ldb,
+                                            const int       strideB,
+                                            double*         X,
+                                            const int       ldx,
+                                            const int       strideX,
+                                            int*            iter,
+                                            int*            info,
+                                            const int       batch_count)
+{
+    HIPBLAS_LOG_CALL(handle,
+                     n,
+                     nrhs,
+                     A,
+                     lda,
+                     strideA,
+                     ipiv,
+                     strideP,
+                     B,
+                     ldb,
+                     strideB,
+                     X,
+                     ldx,
+                     strideX,
+                     iter,
+                     info,
+                     batch_count);
+    return refine_gesv(handle,
+                       n,
+                       nrhs,
+                       batch_of(A, strideA),
+                       lda,
+                       ipiv,
+                       strideP,
+                       batch_of(B, strideB),
+                       ldb,
+                       batch_of(X, strideX),
+                       ldx,
+                       iter,
+                       info,
+                       batch_count);
+}
+
+hipblasStatus_t hipblasZCgesvStridedBatched(hipblasHandle_t             handle,
+                                            const int                   n,
+                                            const int                   nrhs,
+                                            hipblasDoubleComplex*       A,
+                                            const int                   lda,
+                                            const int                   strideA,
+                                            int*                        ipiv,
+                                            const int                   strideP,
+                                            const hipblasDoubleComplex* B,
+                                            const int                   ldb,
+                                            const int                   strideB,
+                                            hipblasDoubleComplex*       X,
+                                            const int                   ldx,
+                                            const int                   strideX,
+                                            int*                        iter,
+                                            int*                        info,
+                                            const int                   batch_count)
+{
+    HIPBLAS_LOG_CALL(handle,
+                     n,
+                     nrhs,
+                     A,
+                     lda,
+                     strideA,
+                     ipiv,
+                     strideP,
+                     B,
+                     ldb,
+                     strideB,
+                     X,
+                     ldx,
+                     strideX,
+                     iter,
+                     info,
+                     batch_count);
+    return refine_gesv(handle,
+                       n,
+                       nrhs,
+                       batch_of(A, strideA),
+                       lda,
+                       ipiv,
+                       strideP,
+                       batch_of(B, strideB),
+                       ldb,
+                       batch_of(X, strideX),
+                       ldx,
+                       iter,
+                       info,
+                       batch_count);
+}
+#endif
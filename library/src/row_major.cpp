@@ -0,0 +1,1030 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "hipblas_handle.h"
+#include "hipblas_kernels.h"
+#include "hipblas_logging.h"
+#include <algorithm>
+#include <hip/hip_runtime_api.h>
+
+// A row-major matrix is the column-major transpose of itself in the same memory, so each row-major
+// call is the column-major call on the transposes: operands swap places, transposes and fill modes
+// flip, and for the complex types a conjugate without transpose is taken by conjugating the
+// vectors instead. Only getrf and geqrf, whose factors have no such form, transpose the matrix
+namespace
+{
+    template <typename T>
+    struct routines;
+
+    template <>
+    struct routines<float>
+    {
+        static constexpr bool is_complex = false;
+
+        static constexpr auto gemm  = hipblasSgemm;
+        static constexpr auto gemv  = hipblasSgemv;
+        static constexpr auto geru  = hipblasSger;
+        static constexpr auto gerc  = hipblasSger;
+        static constexpr auto syr   = hipblasSsyr;
+        static constexpr auto trsv  = hipblasStrsv;
+        static constexpr auto trsm  = hipblasStrsm;
+        static constexpr auto geam  = hipblasSgeam;
+        static constexpr auto getrf = hipblasSgetrf;
+        static constexpr auto geqrf = hipblasSgeqrf;
+    };
+
+    template <>
+    struct routines<double>
+    {
+        static constexpr bool is_complex = false;
+
+        static constexpr auto gemm  = hipblasDgemm;
+        static constexpr auto gemv  = hipblasDgemv;
+        static constexpr auto geru  = hipblasDger;
+        static constexpr auto gerc  = hipblasDger;
+        static constexpr auto syr   = hipblasDsyr;
+        static constexpr auto trsv  = hipblasDtrsv;
+        static constexpr auto trsm  = hipblasDtrsm;
+        static constexpr auto geam  = hipblasDgeam;
+        static constexpr auto getrf = hipblasDgetrf;
+        static constexpr auto geqrf = hipblasDgeqrf;
+    };
+
+    template <>
+    struct routines<hipblasComplex>
+    {
+        static constexpr bool is_complex = true;
+
+        static constexpr auto gemm  = hipblasCgemm;
+        static constexpr auto gemv  = hipblasCgemv;
+        static constexpr auto geru  = hipblasCgeru;
+        static constexpr auto gerc  = hipblasCgerc;
+        static constexpr auto syr   = hipblasCsyr;
+        static constexpr auto trsv  = hipblasCtrsv;
+        static constexpr auto trsm  = hipblasCtrsm;
+        static constexpr auto geam  = hipblasCgeam;
+        static constexpr auto getrf = hipblasCgetrf;
+        static constexpr auto geqrf = hipblasCgeqrf;
+    };
+
+    template <>
+    struct routines<hipblasDoubleComplex>
+    {
+        static constexpr bool is_complex = true;
+
+        static constexpr auto gemm  = hipblasZgemm;
+        static constexpr auto gemv  = hipblasZgemv;
+        static constexpr auto geru  = hipblasZgeru;
+        static constexpr auto gerc  = hipblasZgerc;
+        static constexpr auto syr   = hipblasZsyr;
+        static constexpr auto trsv  = hipblasZtrsv;
+        static constexpr auto trsm  = hipblasZtrsm;
+        static constexpr auto geam  = hipblasZgeam;
+        static constexpr auto getrf = hipblasZgetrf;
+        static constexpr auto geqrf = hipblasZgeqrf;
+    };
+
+    hipblasStatus_t launch_status(hipError_t err)
+    {
+        return err == hipSuccess ? HIPBLAS_STATUS_SUCCESS : HIPBLAS_STATUS_INTERNAL_ERROR;
+    }
+
+    // NOT_INITIALIZED or INVALID_ENUM for a call the order cannot be applied to, else SUCCESS
+    hipblasStatus_t check_order(hipblasHandle_t handle, hipblasOrder_t order)
+    {
+        if(handle == nullptr)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if(order != HIPBLAS_ORDER_COLUMN_MAJOR && order != HIPBLAS_ORDER_ROW_MAJOR)
+            return HIPBLAS_STATUS_INVALID_ENUM;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    template <typename T>
+    T conj(T a)
+    {
+        return a;
+    }
+
+    template <typename T>
+    hip_complex_number<T> conj(hip_complex_number<T> a)
+    {
+        return {a.x, -a.y};
+    }
+
+    // Out-of-range values pass through for the column-major call to reject
+    hipblasFillMode_t flip(hipblasFillMode_t uplo)
+    {
+        return uplo == HIPBLAS_FILL_MODE_UPPER   ? HIPBLAS_FILL_MODE_LOWER
+               : uplo == HIPBLAS_FILL_MODE_LOWER ? HIPBLAS_FILL_MODE_UPPER
+                                                 : uplo;
+    }
+
+    hipblasSideMode_t flip(hipblasSideMode_t side)
+    {
+        return side == HIPBLAS_SIDE_LEFT    ? HIPBLAS_SIDE_RIGHT
+               : side == HIPBLAS_SIDE_RIGHT ? HIPBLAS_SIDE_LEFT
+                                            : side;
+    }
+
+    // op(A) of a row-major A as an operation on its column-major transpose, for the operations
+    // that have one; a complex HIPBLAS_OP_C has none
+    hipblasOperation_t transposed(hipblasOperation_t trans)
+    {
+        return trans == HIPBLAS_OP_N   ? HIPBLAS_OP_T
+               : trans == HIPBLAS_OP_T ? HIPBLAS_OP_N
+               : trans == HIPBLAS_OP_C ? HIPBLAS_OP_N
+                                       : trans;
+    }
+
+    // Runs its body in host pointer mode, restoring the caller's mode after
+    template <typename F>
+    hipblasStatus_t with_host_scalars(hipblasHandle_t handle, F body)
+    {
+        hipblasPointerMode_t mode;
+        hipblasStatus_t      status = hipblasGetPointerMode(handle, &mode);
+        if(status == HIPBLAS_STATUS_SUCCESS && mode != HIPBLAS_POINTER_MODE_HOST)
+            status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = body();
+        if(mode != HIPBLAS_POINTER_MODE_HOST)
+            hipblasSetPointerMode(handle, mode);
+        return status;
+    }
+
+    // y = conj(x) for n elements, in place when y is x
+    template <typename T>
+    hipblasStatus_t conj_copy(hipblasHandle_t handle, int n, const T* x, int incx, T* y, int incy)
+    {
+        hipStream_t     stream;
+        hipblasStatus_t status = hipblasGetStream(handle, &stream);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        hipblas_batched_operand<const T> xb = {x, 0, nullptr};
+        hipblas_batched_operand<T>       yb = {y, 0, nullptr};
+        return launch_status(hipblas_conj_copy_batched(stream, n, xb, incx, yb, incy, 1));
+    }
+
+    // dst = src^T for the rows x cols dst and cols x rows src
+    template <typename T>
+    hipblasStatus_t transpose(
+        hipblasHandle_t handle, int rows, int cols, const T* src, int lds, T* dst, int ldd)
+    {
+        const T one = 1, zero = 0;
+        return with_host_scalars(handle, [&] {
+            return routines<T>::geam(handle,
+                                     HIPBLAS_OP_T,
+                                     HIPBLAS_OP_N,
+                                     rows,
+                                     cols,
+                                     &one,
+                                     src,
+                                     lds,
+                                     &zero,
+                                     dst,
+                                     ldd,
+                                     dst,
+                                     ldd);
+        });
+    }
+
+    template <typename T>
+    hipblasStatus_t gemm(hipblasHandle_t    handle,
+                         hipblasOrder_t     order,
+                         hipblasOperation_t transa,
+                         hipblasOperation_t transb,
+                         int                m,
+                         int                n,
+                         int                k,
+                         const T*           alpha,
+                         const T*           A,
+                         int                lda,
+                         const T*           B,
+                         int                ldb,
+                         const T*           beta,
+                         T*                 C,
+                         int                ldc)
+    {
+        hipblasStatus_t status = check_order(handle, order);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        if(order == HIPBLAS_ORDER_COLUMN_MAJOR)
+            return routines<T>::gemm(
+                handle, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+
+        // C^T = op(B)^T op(A)^T
+        return routines<T>::gemm(
+            handle, transb, transa, n, m, k, alpha, B, ldb, A, lda, beta, C, ldc);
+    }
+
+    template <typename T>
+    hipblasStatus_t gemv(hipblasHandle_t    handle,
+                         hipblasOrder_t     order,
+                         hipblasOperation_t trans,
+                         int                m,
+                         int                n,
+                         const T*           alpha,
+                         const T*           A,
+                         int                lda,
+                         const T*           x,
+                         int                incx,
+                         const T*           beta,
+                         T*                 y,
+                         int                incy)
+    {
+        hipblasStatus_t status = check_order(handle, order);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        if(order == HIPBLAS_ORDER_COLUMN_MAJOR)
+            return routines<T>::gemv(handle, trans, m, n, alpha, A, lda, x, incx, beta, y, incy);
+        if(trans != HIPBLAS_OP_C || !routines<T>::is_complex)
+            return routines<T>::gemv(
+                handle, transposed(trans), n, m, alpha, A, lda, x, incx, beta, y, incy);
+
+        // A^H = conj(A^T), so with A^T the column-major matrix, conj(y) = conj(alpha) A^T conj(x)
+        // + conj(beta) conj(y)
+        if(m < 0 || n < 0 || lda < std::max(1, n) || incx == 0 || incy == 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(m == 0 || n == 0)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(!alpha || !beta || !A || !x || !y)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        T *                  xc, *scalars;
+        hipblasPointerMode_t mode;
+        status = hipblasGetPointerMode(handle, &mode);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblas_workspace_carve(handle, xc, size_t(m), scalars, size_t(2));
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        T        host_scalars[2];
+        const T* alpha_c = host_scalars;
+        const T* beta_c  = host_scalars + 1;
+        if(mode == HIPBLAS_POINTER_MODE_DEVICE)
+        {
+            alpha_c = scalars;
+            beta_c  = scalars + 1;
+            status  = conj_copy(handle, 1, alpha, 1, scalars, 1);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = conj_copy(handle, 1, beta, 1, scalars + 1, 1);
+        }
+        else
+        {
+            host_scalars[0] = conj(*alpha);
+            host_scalars[1] = conj(*beta);
+        }
+
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = conj_copy(handle, m, x, incx, xc, 1);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = conj_copy(handle, n, y, incy, y, incy);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = routines<T>::gemv(
+                handle, HIPBLAS_OP_N, n, m, alpha_c, A, lda, xc, 1, beta_c, y, incy);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = conj_copy(handle, n, y, incy, y, incy);
+        return status;
+    }
+
+    // A += alpha x y^T, or alpha x y^H with conj set
+    template <typename T>
+    hipblasStatus_t ger(hipblasHandle_t handle,
+                        hipblasOrder_t  order,
+                        bool            conj,
+                        int             m,
+                        int             n,
+                        const T*        alpha,
+                        const T*        x,
+                        int             incx,
+                        const T*        y,
+                        int             incy,
+                        T*              A,
+                        int             lda)
+    {
+        hipblasStatus_t status = check_order(handle, order);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        conj = conj && routines<T>::is_complex;
+        if(order == HIPBLAS_ORDER_COLUMN_MAJOR && conj)
+            return routines<T>::gerc(handle, m, n, alpha, x, incx, y, incy, A, lda);
+        if(order == HIPBLAS_ORDER_COLUMN_MAJOR)
+            return routines<T>::geru(handle, m, n, alpha, x, incx, y, incy, A, lda);
+
+        // A^T += alpha y x^T, or alpha conj(y) x^T
+        if(!conj)
+            return routines<T>::geru(handle, n, m, alpha, y, incy, x, incx, A, lda);
+
+        if(m < 0 || n < 0 || lda < std::max(1, n) || incx == 0 || incy == 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(m == 0 || n == 0)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(!alpha || !A || !x || !y)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        T* yc;
+        status = hipblas_workspace_carve(handle, yc, size_t(n));
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = conj_copy(handle, n, y, incy, yc, 1);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = routines<T>::geru(handle, n, m, alpha, yc, 1, x, incx, A, lda);
+        return status;
+    }
+
+    template <typename T>
+    hipblasStatus_t syr(hipblasHandle_t   handle,
+                        hipblasOrder_t    order,
+                        hipblasFillMode_t uplo,
+                        int               n,
+                        const T*          alpha,
+                        const T*          x,
+                        int               incx,
+                        T*                A,
+                        int               lda)
+    {
+        hipblasStatus_t status = check_order(handle, order);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        // A is symmetric, so only its stored triangle changes sides
+        return routines<T>::syr(handle,
+                                order == HIPBLAS_ORDER_ROW_MAJOR ? flip(uplo) : uplo,
+                                n,
+                                alpha,
+                                x,
+                                incx,
+                                A,
+                                lda);
+    }
+
+    template <typename T>
+    hipblasStatus_t trsv(hipblasHandle_t    handle,
+                         hipblasOrder_t     order,
+                         hipblasFillMode_t  uplo,
+                         hipblasOperation_t transA,
+                         hipblasDiagType_t  diag,
+                         int                m,
+                         const T*           A,
+                         int                lda,
+                         T*                 x,
+                         int                incx)
+    {
+        hipblasStatus_t status = check_order(handle, order);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        if(order == HIPBLAS_ORDER_COLUMN_MAJOR)
+            return routines<T>::trsv(handle, uplo, transA, diag, m, A, lda, x, incx);
+        if(transA != HIPBLAS_OP_C || !routines<T>::is_complex)
+            return routines<T>::trsv(
+                handle, flip(uplo), transposed(transA), diag, m, A, lda, x, incx);
+
+        // conj(A^T) x = b is A^T conj(x) = conj(b)
+        if((uplo != HIPBLAS_FILL_MODE_UPPER && uplo != HIPBLAS_FILL_MODE_LOWER)
+           || (diag != HIPBLAS_DIAG_NON_UNIT && diag != HIPBLAS_DIAG_UNIT))
+            return HIPBLAS_STATUS_INVALID_ENUM;
+        if(m < 0 || lda < std::max(1, m) || incx == 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(m == 0)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(!A || !x)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        status = conj_copy(handle, m, x, incx, x, incx);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = routines<T>::trsv(handle, flip(uplo), HIPBLAS_OP_N, diag, m, A, lda, x, incx);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = conj_copy(handle, m, x, incx, x, incx);
+        return status;
+    }
+
+    template <typename T>
+    hipblasStatus_t trsm(hipblasHandle_t    handle,
+                         hipblasOrder_t     order,
+                         hipblasSideMode_t  side,
+                         hipblasFillMode_t  uplo,
+                         hipblasOperation_t transA,
+                         hipblasDiagType_t  diag,
+                         int                m,
+                         int                n,
+                         const T*           alpha,
+                         T*                 A,
+                         int                lda,
+                         T*                 B,
+                         int                ldb)
+    {
+        hipblasStatus_t status = check_order(handle, order);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        if(order == HIPBLAS_ORDER_COLUMN_MAJOR)
+            return routines<T>::trsm(
+                handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
+
+        // op(A) X = alpha B is X^T op(A)^T = alpha B^T, and op(A)^T is the same operation on A^T
+        return routines<T>::trsm(
+            handle, flip(side), flip(uplo), transA, diag, n, m, alpha, A, lda, B, ldb);
+    }
+
+    template <typename T>
+    hipblasStatus_t getrf(
+        hipblasHandle_t handle, hipblasOrder_t order, int n, T* A, int lda, int* ipiv, int* info)
+    {
+        hipblasStatus_t status = check_order(handle, order);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        if(order == HIPBLAS_ORDER_COLUMN_MAJOR || n <= 0)
+            return routines<T>::getrf(handle, n, A, lda, ipiv, info);
+        if(lda < n || !A || !ipiv || !info)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        // The row pivots of A are not a factorization of A^T, so A is factored as a column-major
+        // copy
+        T* W;
+        status = hipblas_workspace_carve(handle, W, size_t(n) * n);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = transpose(handle, n, n, A, lda, W, n);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = routines<T>::getrf(handle, n, W, n, ipiv, info);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = transpose(handle, n, n, W, n, A, lda);
+        return status;
+    }
+
+    template <typename T>
+    hipblasStatus_t geqrf(hipblasHandle_t handle,
+                          hipblasOrder_t  order,
+                          int             m,
+                          int             n,
+                          T*              A,
+                          int             lda,
+                          T*              tau,
+                          int*            info)
+    {
+        hipblasStatus_t status = check_order(handle, order);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        if(order == HIPBLAS_ORDER_COLUMN_MAJOR)
+            return routines<T>::geqrf(handle, m, n, A, lda, tau, info);
+
+        if(info == nullptr)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        *info = m < 0                   ? -1
+                : n < 0                 ? -2
+                : A == nullptr          ? -3
+                : lda < std::max(1, n)  ? -4
+                : tau == nullptr        ? -5
+                                        : 0;
+        if(*info != 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(m == 0 || n == 0)
+            return HIPBLAS_STATUS_SUCCESS;
+
+        // The Householder vectors of A are not those of A^T, so A is factored as a column-major
+        // copy
+        T* W;
+        status = hipblas_workspace_carve(handle, W, size_t(m) * n);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = transpose(handle, m, n, A, lda, W, m);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = routines<T>::geqrf(handle, m, n, W, m, tau, info);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = transpose(handle, n, m, W, m, A, lda);
+        return status;
+    }
+}
+
+hipblasStatus_t hipblasSgemmWithOrder(hipblasHandle_t    handle,
+                                      hipblasOrder_t     order,
+                                      hipblasOperation_t transa,
+                                      hipblasOperation_t transb,
+                                      int                m,
+                                      int                n,
+                                      int                k,
+                                      const float*       alpha,
+                                      const float*       A,
+                                      int                lda,
+                                      const float*       B,
+                                      int                ldb,
+                                      const float*       beta,
+                                      float*             C,
+                                      int                ldc)
+{
+    HIPBLAS_LOG_CALL(handle, order, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+    return gemm(handle, order, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+hipblasStatus_t hipblasDgemmWithOrder(hipblasHandle_t    handle,
+                                      hipblasOrder_t     order,
+                                      hipblasOperation_t transa,
+                                      hipblasOperation_t transb,
+                                      int                m,
+                                      int                n,
+                                      int                k,
+                                      const double*      alpha,
+                                      const double*      A,
+                                      int                lda,
+                                      const double*      B,
+                                      int                ldb,
+                                      const double*      beta,
+                                      double*            C,
+                                      int                ldc)
+{
+    HIPBLAS_LOG_CALL(handle, order, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+    return gemm(handle, order, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+hipblasStatus_t hipblasCgemmWithOrder(hipblasHandle_t       handle,
+                                      hipblasOrder_t        order,
+                                      hipblasOperation_t    transa,
+                                      hipblasOperation_t    transb,
+                                      int                   m,
+                                      int                   n,
+                                      int                   k,
+                                      const hipblasComplex* alpha,
+                                      const hipblasComplex* A,
+                                      int                   lda,
+                                      const hipblasComplex* B,
+                                      int                   ldb,
+                                      const hipblasComplex* beta,
+                                      hipblasComplex*       C,
+                                      int                   ldc)
+{
+    HIPBLAS_LOG_CALL(handle, order, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+    return gemm(handle, order, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+hipblasStatus_t hipblasZgemmWithOrder(hipblasHandle_t             handle,
+                                      hipblasOrder_t              order,
+                                      hipblasOperation_t          transa,
+                                      hipblasOperation_t          transb,
+                                      int                         m,
+                                      int                         n,
+                                      int                         k,
+                                      const hipblasDoubleComplex* alpha,
+                                      const hipblasDoubleComplex* A,
+                                      int                         lda,
+                                      const hipblasDoubleComplex* B,
+                                      int                         ldb,
+                                      const hipblasDoubleComplex* beta,
+                                      hipblasDoubleComplex*       C,
+                                      int                         ldc)
+{
+    HIPBLAS_LOG_CALL(handle, order, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+    return gemm(handle, order, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+hipblasStatus_t hipblasSgemvWithOrder(hipblasHandle_t    handle,
+                                      hipblasOrder_t     order,
+                                      hipblasOperation_t trans,
+                                      int                m,
+                                      int                n,
+                                      const float*       alpha,
+                                      const float*       A,
+                                      int                lda,
+                                      const float*       x,
+                                      int                incx,
+                                      const float*       beta,
+                                      float*             y,
+                                      int                incy)
+{
+    HIPBLAS_LOG_CALL(handle, order, trans, m, n, alpha, A, lda, x, incx, beta, y, incy);
+    return gemv(handle, order, trans, m, n, alpha, A, lda, x, incx, beta, y, incy);
+}
+
+hipblasStatus_t hipblasDgemvWithOrder(hipblasHandle_t    handle,
+                                      hipblasOrder_t     order,
+                                      hipblasOperation_t trans,
+                                      int                m,
+                                      int                n,
+                                      const double*      alpha,
+                                      const double*      A,
+                                      int                lda,
+                                      const double*      x,
+                                      int                incx,
+                                      const double*      beta,
+                                      double*            y,
+                                      int                incy)
+{
+    HIPBLAS_LOG_CALL(handle, order, trans, m, n, alpha, A, lda, x, incx, beta, y, incy);
+    return gemv(handle, order, trans, m, n, alpha, A, lda, x, incx, beta, y, incy);
+}
+
+hipblasStatus_t hipblasCgemvWithOrder(hipblasHandle_t       handle,
+                                      hipblasOrder_t        order,
+                                      hipblasOperation_t    trans,
+                                      int                   m,
+                                      int                   n,
+                                      const hipblasComplex* alpha,
+                                      const hipblasComplex* A,
+                                      int                   lda,
+                                      const hipblasComplex* x,
+                                      int                   incx,
+                                      const hipblasComplex* beta,
+                                      hipblasComplex*       y,
+                                      int                   incy)
+{
+    HIPBLAS_LOG_CALL(handle, order, trans, m, n, alpha, A, lda, x, incx, beta, y, incy);
+    return gemv(handle, order, trans, m, n, alpha, A, lda, x, incx, beta, y, incy);
+}
+
+hipblasStatus_t hipblasZgemvWithOrder(hipblasHandle_t             handle,
+                                      hipblasOrder_t              order,
+                                      hipblasOperation_t          trans,
+                                      int                         m,
+                                      int                         n,
+                                      const hipblasDoubleComplex* alpha,
+                                      const hipblasDoubleComplex* A,
+                                      int                         lda,
+                                      const hipblasDoubleComplex* x,
+                                      int                         incx,
+                                      const hipblasDoubleComplex* beta,
+                                      hipblasDoubleComplex*       y,
+                                      int                         incy)
+{
+    HIPBLAS_LOG_CALL(handle, order, trans, m, n, alpha, A, lda, x, incx, beta, y, incy);
+    return gemv(handle, order, trans, m, n, alpha, A, lda, x, incx, beta, y, incy);
+}
+
+hipblasStatus_t hipblasSgerWithOrder(hipblasHandle_t handle,
+                                     hipblasOrder_t  order,
+                                     int             m,
+                                     int             n,
+                                     const float*    alpha,
+                                     const float*    x,
+                                     int             incx,
+                                     const float*    y,
+                                     int             incy,
+                                     float*          A,
+                                     int             lda)
+{
+    HIPBLAS_LOG_CALL(handle, order, m, n, alpha, x, incx, y, incy, A, lda);
+    return ger(handle, order, false, m, n, alpha, x, incx, y, incy, A, lda);
+}
+
+hipblasStatus_t hipblasDgerWithOrder(hipblasHandle_t handle,
+                                     hipblasOrder_t  order,
+                                     int             m,
+                                     int             n,
+                                     const double*   alpha,
+                                     const double*   x,
+                                     int             incx,
+                                     const double*   y,
+                                     int             incy,
+                                     double*         A,
+                                     int             lda)
+{
+    HIPBLAS_LOG_CALL(handle, order, m, n, alpha, x, incx, y, incy, A, lda);
+    return ger(handle, order, false, m, n, alpha, x, incx, y, incy, A, lda);
+}
+
+hipblasStatus_t hipblasCgeruWithOrder(hipblasHandle_t       handle,
+                                      hipblasOrder_t        order,
+                                      int                   m,
+                                      int                   n,
+                                      const hipblasComplex* alpha,
+                                      const hipblasComplex* x,
+                                      int                   incx,
+                                      const hipblasComplex* y,
+                                      int                   incy,
+                                      hipblasComplex*       A,
+                                      int                   lda)
+{
+    HIPBLAS_LOG_CALL(handle, order, m, n, alpha, x, incx, y, incy, A, lda);
+    return ger(handle, order, false, m, n, alpha, x, incx, y, incy, A, lda);
+}
+
+hipblasStatus_t hipblasCgercWithOrder(hipblasHandle_t       handle,
+                                      hipblasOrder_t        order,
+                                      int                   m,
+                                      int                   n,
+                                      const hipblasComplex* alpha,
+                                      const hipblasComplex* x,
+                                      int                   incx,
+                                      const hipblasComplex* y,
+                                      int                   incy,
+                                      hipblasComplex*       A,
+                                      int                   lda)
+{
+    HIPBLAS_LOG_CALL(handle, order, m, n, alpha, x, incx, y, incy, A, lda);
+    return ger(handle, order, true, m, n, alpha, x, incx, y, incy, A, lda);
+}
+
+hipblasStatus_t hipblasZgeruWithOrder(hipblasHandle_t             handle,
+                                      hipblasOrder_t              order,
+                                      int                         m,
+                                      int                         n,
+                                      const hipblasDoubleComplex* alpha,
+                                      const hipblasDoubleComplex* x,
+                                      int                         incx,
+                                      const hipblasDoubleComplex* y,
+                                      int                         incy,
+                                      hipblasDoubleComplex*       A,
+                                      int                         lda)
+{
+    HIPBLAS_LOG_CALL(handle, order, m, n, alpha, x, incx, y, incy, A, lda);
+    return ger(handle, order, false, m, n, alpha, x, incx, y, incy, A, lda);
+}
+
+hipblasStatus_t hipblasZgercWithOrder(hipblasHandle_t             handle,
+                                      hipblasOrder_t              order,
+                                      int                         m,
+                                      int                         n,
+                                      const hipblasDoubleComplex* alpha,
+                                      const hipblasDoubleComplex* x,
+                                      int                         incx,
+                                      const hipblasDoubleComplex* y,
+                                      int                         incy,
+                                      hipblasDoubleComplex*       A,
+                                      int                         lda)
+{
+    HIPBLAS_LOG_CALL(handle, order, m, n, alpha, x, incx, y, incy, A, lda);
+    return ger(handle, order, true, m, n, alpha, x, incx, y, incy, A, lda);
+}
+
+hipblasStatus_t hipblasSsyrWithOrder(hipblasHandle_t   handle,
+                                     hipblasOrder_t    order,
+                                     hipblasFillMode_t uplo,
+                                     int               n,
+                                     const float*      alpha,
+                                     const float*      x,
+                                     int               incx,
+                                     float*            A,
+                                     int               lda)
+{
+    HIPBLAS_LOG_CALL(handle, order, uplo, n, alpha, x, incx, A, lda);
+    return syr(handle, order, uplo, n, alpha, x, incx, A, lda);
+}
+
+hipblasStatus_t hipblasDsyrWithOrder(hipblasHandle_t   handle,
+                                     hipblasOrder_t    order,
+                                     hipblasFillMode_t uplo,
+                                     int               n,
+                                     const double*     alpha,
+                                     const double*     x,
+                                     int               incx,
+                                     double*           A,
+                                     int               lda)
+{
+    HIPBLAS_LOG_CALL(handle, order, uplo, n, alpha, x, incx, A, lda);
+    return syr(handle, order, uplo, n, alpha, x, incx, A, lda);
+}
+
+hipblasStatus_t hipblasCsyrWithOrder(hipblasHandle_t       handle,
+                                     hipblasOrder_t        order,
+                                     hipblasFillMode_t     uplo,
+                                     int                   n,
+                                     const hipblasComplex* alpha,
+                                     const hipblasComplex* x,
+                                     int                   incx,
+                                     hipblasComplex*       A,
+                                     int                   lda)
+{
+    HIPBLAS_LOG_CALL(handle, order, uplo, n, alpha, x, incx, A, lda);
+    return syr(handle, order, uplo, n, alpha, x, incx, A, lda);
+}
+
+hipblasStatus_t hipblasZsyrWithOrder(hipblasHandle_t             handle,
+                                     hipblasOrder_t              order,
+                                     hipblasFillMode_t           uplo,
+                                     int                         n,
+                                     const hipblasDoubleComplex* alpha,
+                                     const hipblasDoubleComplex* x,
+                                     int                         incx,
+                                     hipblasDoubleComplex*       A,
+                                     int                         lda)
+{
+    HIPBLAS_LOG_CALL(handle, order, uplo, n, alpha, x, incx, A, lda);
+    return syr(handle, order, uplo, n, alpha, x, incx, A, lda);
+}
+
+hipblasStatus_t hipblasStrsvWithOrder(hipblasHandle_t    handle,
+                                      hipblasOrder_t     order,
+                                      hipblasFillMode_t  uplo,
+                                      hipblasOperation_t transA,
+                                      hipblasDiagType_t  diag,
+                                      int                m,
+                                      const float*       A,
+                                      int                lda,
+                                      float*             x,
+                                      int                incx)
+{
+    HIPBLAS_LOG_CALL(handle, order, uplo, transA, diag, m, A, lda, x, incx);
+    return trsv(handle, order, uplo, transA, diag, m, A, lda, x, incx);
+}
+
+hipblasStatus_t hipblasDtrsvWithOrder(hipblasHandle_t    handle,
+                                      hipblasOrder_t     order,
+                                      hipblasFillMode_t  uplo,
+                                      hipblasOperation_t transA,
+                                      hipblasDiagType_t  diag,
+                                      int                m,
+                                      const double*      A,
+                                      int                lda,
+                                      double*            x,
+                                      int                incx)
+{
+    HIPBLAS_LOG_CALL(handle, order, uplo, transA, diag, m, A, lda, x, incx);
+    return trsv(handle, order, uplo, transA, diag, m, A, lda, x, incx);
+}
+
+hipblasStatus_t hipblasCtrsvWithOrder(hipblasHandle_t       handle,
+                                      hipblasOrder_t        order,
+                                      hipblasFillMode_t     uplo,
+                                      hipblasOperation_t    transA,
+                                      hipblasDiagType_t     diag,
+                                      int                   m,
+                                      const hipblasComplex* A,
+                                      int                   lda,
+                                      hipblasComplex*       x,
+                                      int                   incx)
+{
+    HIPBLAS_LOG_CALL(handle, order, uplo, transA, diag, m, A, lda, x, incx);
+    return trsv(handle, order, uplo, transA, diag, m, A, lda, x, incx);
+}
+
+hipblasStatus_t hipblasZtrsvWithOrder(hipblasHandle_t             handle,
+                                      hipblasOrder_t              order,
+                                      hipblasFillMode_t           uplo,
+                                      hipblasOperation_t          transA,
+                                      hipblasDiagType_t           diag,
+                                      int                         m,
+                                      const hipblasDoubleComplex* A,
+                                      int                         lda,
+                                      hipblasDoubleComplex*       x,
+                                      int                         incx)
+{
+    HIPBLAS_LOG_CALL(handle, order, uplo, transA, diag, m, A, lda, x, incx);
+    return trsv(handle, order, uplo, transA, diag, m, A, lda, x, incx);
+}
+
+hipblasStatus_t hipblasStrsmWithOrder(hipblasHandle_t    handle,
+                                      hipblasOrder_t     order,
+                                      hipblasSideMode_t  side,
+                                      hipblasFillMode_t  uplo,
+                                      hipblasOperation_t transA,
+                                      hipblasDiagType_t  diag,
+                                      int                m,
+                                      int                n,
+                                      const float*       alpha,
+                                      float*             A,
+                                      int                lda,
+                                      float*             B,
+                                      int                ldb)
+{
+    HIPBLAS_LOG_CALL(handle, order, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
+    return trsm(handle, order, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
+}
+
+hipblasStatus_t hipblasDtrsmWithOrder(hipblasHandle_t    handle,
+                                      hipblasOrder_t     order,
+                                      hipblasSideMode_t  side,
+                                      hipblasFillMode_t  uplo,
+                                      hipblasOperation_t transA,
+                                      hipblasDiagType_t  diag,
+                                      int                m,
+                                      int                n,
+                                      const double*      alpha,
+                                      double*            A,
+                                      int                lda,
+                                      double*            B,
+                                      int                ldb)
+{
+    HIPBLAS_LOG_CALL(handle, order, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
+    return trsm(handle, order, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
+}
+
+hipblasStatus_t hipblasCtrsmWithOrder(hipblasHandle_t       handle,
+                                      hipblasOrder_t        order,
+                                      hipblasSideMode_t     side,
+                                      hipblasFillMode_t     uplo,
+                                      hipblasOperation_t    transA,
+                                      hipblasDiagType_t     diag,
+                                      int                   m,
+                                      int                   n,
+                                      const hipblasComplex* alpha,
+                                      hipblasComplex*       A,
+                                      int                   lda,
+                                      hipblasComplex*       B,
+                                      int                   ldb)
+{
+    HIPBLAS_LOG_CALL(handle, order, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
+    return trsm(handle, order, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
+}
+
+hipblasStatus_t hipblasZtrsmWithOrder(hipblasHandle_t             handle,
+                                      hipblasOrder_t              order,
+                                      hipblasSideMode_t           side,
+                                      hipblasFillMode_t           uplo,
+                                      hipblasOperation_t          transA,
+                                      hipblasDiagType_t           diag,
+                                      int                         m,
+                                      int                         n,
+                                      const hipblasDoubleComplex* alpha,
+                                      hipblasDoubleComplex*       A,
+                                      int                         lda,
+                                      hipblasDoubleComplex*       B,
+                                      int                         ldb)
+{
+    HIPBLAS_LOG_CALL(handle, order, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
+    return trsm(handle, order, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
+}
+
+hipblasStatus_t hipblasSgetrfWithOrder(hipblasHandle_t handle,
+                                       hipblasOrder_t  order,
+                                       int             n,
+                                       float*          A,
+                                       int             lda,
+                                       int*            ipiv,
+                                       int*            info)
+{
+    HIPBLAS_LOG_CALL(handle, order, n, A, lda, ipiv, info);
+    return getrf(handle, order, n, A, lda, ipiv, info);
+}
+
+hipblasStatus_t hipblasDgetrfWithOrder(hipblasHandle_t handle,
+                                       hipblasOrder_t  order,
+                                       int             n,
+                                       double*         A,
+                                       int             lda,
+                                       int*            ipiv,
+                                       int*            info)
+{
+    HIPBLAS_LOG_CALL(handle, order, n, A, lda, ipiv, info);
+    return getrf(handle, order, n, A, lda, ipiv, info);
+}
+
+hipblasStatus_t hipblasCgetrfWithOrder(hipblasHandle_t handle,
+                                       hipblasOrder_t  order,
+                                       int             n,
+                                       hipblasComplex* A,
+                                       int             lda,
+                                       int*            ipiv,
+                                       int*            info)
+{
+    HIPBLAS_LOG_CALL(handle, order, n, A, lda, ipiv, info);
+    return getrf(handle, order, n, A, lda, ipiv, info);
+}
+
+hipblasStatus_t hipblasZgetrfWithOrder(hipblasHandle_t       handle,
+                                       hipblasOrder_t        order,
+                                       int                   n,
+                                       hipblasDoubleComplex* A,
+                                       int                   lda,
+                                       int*                  ipiv,
+                                       int*                  info)
+{
+    HIPBLAS_LOG_CALL(handle, order, n, A, lda, ipiv, info);
+    return getrf(handle, order, n, A, lda, ipiv, info);
+}
+
+hipblasStatus_t hipblasSgeqrfWithOrder(hipblasHandle_t handle,
+                                       hipblasOrder_t  order,
+                                       int             m,
+                                       int             n,
+                                       float*          A,
+                                       int             lda,
+                                       float*          tau,
+                                       int*            info)
+{
+    HIPBLAS_LOG_CALL(handle, order, m, n, A, lda, tau, info);
+    return geqrf(handle, order, m, n, A, lda, tau, info);
+}
+
+hipblasStatus_t hipblasDgeqrfWithOrder(hipblasHandle_t handle,
+                                       hipblasOrder_t  order,
+                                       int             m,
+                                       int             n,
+                                       double*         A,
+                                       int             lda,
+                                       double*         tau,
+                                       int*            info)
+{
+    HIPBLAS_LOG_CALL(handle, order, m, n, A, lda, tau, info);
+    return geqrf(handle, order, m, n, A, lda, tau, info);
+}
+
+hipblasStatus_t hipblasCgeqrfWithOrder(hipblasHandle_t handle,
+                                       hipblasOrder_t  order,
+                                       int             m,
+                                       int             n,
+                                       hipblasComplex* A,
+                                       int             lda,
+                                       hipblasComplex* tau,
+                                       int*            info)
+{
+    HIPBLAS_LOG_CALL(handle, order, m, n, A, lda, tau, info);
+    return geqrf(handle, order, m, n, A, lda, tau, info);
+}
+
+hipblasStatus_t hipblasZgeqrfWithOrder(hipblasHandle_t       handle,
+                                       hipblasOrder_t        order,
+                                       int                   m,
+                                       int                   n,
+                                       hipblasDoubleComplex* A,
+                                       int                   lda,
+                                       hipblasDoubleComplex* tau,
+                                       int*                  info)
+{
+    HIPBLAS_LOG_CALL(handle, order, m, n, A, lda, tau, info);
+    return geqrf(handle, order, m, n, A, lda, tau, info);
+}
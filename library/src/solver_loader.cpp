@@ -0,0 +1,30 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#ifdef __HIP_PLATFORM_SOLVER_LAZY__
+#include "hipblas_solver.h"
+#include <cstdlib>
+#include <dlfcn.h>
+
+namespace
+{
+    // RTLD_LOCAL keeps rocSOLVER's symbols out of the global scope; its rocBLAS dependency is
+    // already loaded and is shared
+    void* open_rocsolver()
+    {
+        const char* path = std::getenv("HIPBLAS_ROCSOLVER_PATH");
+        if(path && *path)
+            return dlopen(path, RTLD_NOW | RTLD_LOCAL);
+
+        void* library = dlopen("librocsolver.so.0", RTLD_NOW | RTLD_LOCAL);
+        return library ? library : dlopen("librocsolver.so", RTLD_NOW | RTLD_LOCAL);
+    }
+}
+
+void* hipblas_solver_symbol(const char* name)
+{
+    static void* library = open_rocsolver();
+    return library ? dlsym(library, name) : nullptr;
+}
+#endif
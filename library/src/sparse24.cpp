@@ -0,0 +1,168 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "hipblas_handle.h"
+#include "hipblas_kernels.h"
+#include "hipblas_logging.h"
+#include <algorithm>
+#include <hip/hip_runtime_api.h>
+
+namespace
+{
+    bool is_op(hipblasOperation_t op)
+    {
+        return op == HIPBLAS_OP_N || op == HIPBLAS_OP_T || op == HIPBLAS_OP_C;
+    }
+
+    bool is_16_or_32f(hipblasDatatype_t type)
+    {
+        return type == HIPBLAS_R_16F || type == HIPBLAS_R_16B || type == HIPBLAS_R_32F;
+    }
+
+    hipblasStatus_t launch_status(hipError_t err)
+    {
+        return err == hipSuccess ? HIPBLAS_STATUS_SUCCESS : HIPBLAS_STATUS_INTERNAL_ERROR;
+    }
+
+    // The checks prune24 and compress24 share, on op(A) of m x k
+    hipblasStatus_t check_select(hipblasHandle_t    handle,
+                                 hipblasOperation_t trans_a,
+                                 int                m,
+                                 int                k,
+                                 const void*        a,
+                                 hipblasDatatype_t  type,
+                                 int                lda)
+    {
+        if(handle == nullptr)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if(!is_op(trans_a))
+            return HIPBLAS_STATUS_INVALID_ENUM;
+        if(m < 0 || k < 0 || k % 4 != 0 || lda < std::max(1, trans_a == HIPBLAS_OP_N ? m : k)
+           || (a == nullptr && m > 0 && k > 0))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(!is_16_or_32f(type))
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    bool valid_compressed(const hipblasSparse24Matrix_t* c, int m, int k)
+    {
+        return c && c->ld_values >= std::max(1, m) && c->ld_metadata >= std::max(1, m)
+               && ((c->values && c->metadata) || m == 0 || k == 0);
+    }
+}
+
+hipblasStatus_t hipblasSparsePrune24(hipblasHandle_t    handle,
+                                     hipblasOperation_t trans_a,
+                                     int                m,
+                                     int                k,
+                                     const void*        a,
+                                     hipblasDatatype_t  type,
+                                     int                lda,
+                                     void*              p,
+                                     int                ldp)
+{
+    HIPBLAS_LOG_CALL(handle, trans_a, m, k, a, type, lda, p, ldp);
+    hipblasStatus_t status = check_select(handle, trans_a, m, k, a, type, lda);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    if(ldp < std::max(1, m) || (p == nullptr && m > 0 && k > 0))
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+
+    hipStream_t stream;
+    hipblasGetStream(handle, &stream);
+    return launch_status(
+        hipblas_sparse24_compress(stream, trans_a, m, k, a, type, lda, p, ldp, nullptr));
+}
+
+hipblasStatus_t hipblasSparseCompress24(hipblasHandle_t                handle,
+                                        hipblasOperation_t             trans_a,
+                                        int                            m,
+                                        int                            k,
+                                        const void*                    a,
+                                        hipblasDatatype_t              type,
+                                        int                            lda,
+                                        const hipblasSparse24Matrix_t* compressed)
+{
+    HIPBLAS_LOG_CALL(handle, trans_a, m, k, a, type, lda, compressed);
+    hipblasStatus_t status = check_select(handle, trans_a, m, k, a, type, lda);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+    if(!valid_compressed(compressed, m, k))
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+
+    hipStream_t stream;
+    hipblasGetStream(handle, &stream);
+    return launch_status(
+        hipblas_sparse24_compress(stream, trans_a, m, k, a, type, lda, nullptr, 0, compressed));
+}
+
+hipblasStatus_t hipblasSparseGemm24Ex(hipblasHandle_t                handle,
+                                      hipblasOperation_t             trans_b,
+                                      int                            m,
+                                      int                            n,
+                                      int                            k,
+                                      const void*                    alpha,
+                                      const hipblasSparse24Matrix_t* a,
+                                      hipblasDatatype_t              a_type,
+                                      const void*                    b,
+                                      int                            ldb,
+                                      const void*                    beta,
+                                      void*                          c,
+                                      hipblasDatatype_t              c_type,
+                                      int                            ldc,
+                                      hipblasDatatype_t              compute_type)
+{
+    HIPBLAS_LOG_CALL(
+        handle, trans_b, m, n, k, alpha, a, a_type, b, ldb, beta, c, c_type, ldc, compute_type);
+    if(handle == nullptr)
+    {
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    }
+    if(!is_op(trans_b))
+    {
+        return HIPBLAS_STATUS_INVALID_ENUM;
+    }
+    if(m < 0 || n < 0 || k < 0 || k % 4 != 0 || !valid_compressed(a, m, k)
+       || ldb < std::max(1, trans_b == HIPBLAS_OP_N ? k : n) || ldc < std::max(1, m))
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+    if(!is_16_or_32f(a_type) || (c_type != a_type && c_type != HIPBLAS_R_32F)
+       || compute_type != HIPBLAS_R_32F)
+    {
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+    }
+    if(m == 0 || n == 0)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!alpha || !beta || !c || (k > 0 && !b))
+    {
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    }
+
+    hipStream_t stream;
+    hipblasGetStream(handle, &stream);
+    bool device_scalars
+        = static_cast<hipblas_handle*>(handle)->pointer_mode == HIPBLAS_POINTER_MODE_DEVICE;
+    return launch_status(hipblas_sparse24_gemm(stream,
+                                               trans_b,
+                                               m,
+                                               n,
+                                               k,
+                                               static_cast<const float*>(alpha),
+                                               static_cast<const float*>(beta),
+                                               device_scalars,
+                                               *a,
+                                               a_type,
+                                               b,
+                                               ldb,
+                                               c,
+                                               c_type,
+                                               ldc));
+}
@@ -0,0 +1,531 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipblas_staging.h"
+#include "hipblas_logging.h"
+#include <algorithm>
+#include <array>
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <vector>
+
+namespace
+{
+    constexpr size_t DEFAULT_POOL_BYTES = size_t(8) << 20;
+
+    // From <numaif.h>, which would make libnuma a build dependency for one system call
+    constexpr int MPOL_PREFERRED = 1;
+
+    // The NUMA node of device's PCI slot, or -1 if the host has no such notion
+    int device_numa_node(int device)
+    {
+        char bus_id[32];
+        if(hipDeviceGetPCIBusId(bus_id, sizeof(bus_id), device) != hipSuccess)
+            return -1;
+        for(char* c = bus_id; *c; c++)
+            *c = std::tolower(static_cast<unsigned char>(*c));
+
+        std::ifstream sysfs(std::string("/sys/bus/pci/devices/") + bus_id + "/numa_node");
+        int           node = -1;
+        if(!(sysfs >> node))
+            return -1;
+        return node;
+    }
+
+    // Pinned memory whose pages live on node: mapped, preferred to the node, touched so they
+    // are placed, then registered with the runtime. Falls back to hipHostMalloc, which places
+    // the pages wherever the allocating thread runs, when the node is unknown or binding fails
+    struct pinned_block
+    {
+        void*  ptr    = nullptr;
+        bool   mapped = false;
+        size_t bytes  = 0;
+
+        bool allocate(size_t size, int node)
+        {
+            bytes = size;
+            if(node >= 0 && node < int(8 * sizeof(unsigned long)))
+            {
+                unsigned long mask  = 1ul << node;
+                int           flags = MAP_PRIVATE | MAP_ANONYMOUS;
+                void*         p     = mmap(nullptr, size, PROT_READ | PROT_WRITE, flags, -1, 0);
+                if(p != MAP_FAILED)
+                {
+                    if(syscall(SYS_mbind, p, size, MPOL_PREFERRED, &mask, 8 * sizeof(mask), 0) == 0)
+                    {
+                        std::memset(p, 0, size);
+                        if(hipHostRegister(p, size, hipHostRegisterPortable) == hipSuccess)
+                        {
+                            ptr    = p;
+                            mapped = true;
+                            return true;
+                        }
+                        (void)hipGetLastError();
+                    }
+                    munmap(p, size);
+                }
+            }
+            if(hipHostMalloc(&ptr, size, hipHostMallocPortable) != hipSuccess)
+            {
+                ptr = nullptr;
+                return false;
+            }
+            return true;
+        }
+
+        void release()
+        {
+            if(mapped)
+            {
+                (void)hipHostUnregister(ptr);
+                munmap(ptr, bytes);
+            }
+            else if(ptr)
+                (void)hipHostFree(ptr);
+            *this = pinned_block();
+        }
+    };
+
+    // Two pinned halves of the pool per device, on the device's NUMA node, each with the event
+    // of the last DMA queued from or into it and, once a strided copy needs it, a device buffer
+    // of the same size. One transfer holds the pool at a time; they run on the null stream of
+    // the current device, like the calls they stand in for
+    class staging_pool
+    {
+    public:
+        struct buffer
+        {
+            pinned_block block;
+            void*        device  = nullptr;
+            hipEvent_t   done    = nullptr;
+            bool         pending = false;
+        };
+
+        std::mutex mutex;
+
+        staging_pool()
+        {
+            const char* env = std::getenv("HIPBLAS_STAGING_POOL_SIZE");
+            if(env)
+                bytes = std::strtoull(env, nullptr, 10);
+        }
+
+        size_t size() const
+        {
+            return bytes;
+        }
+
+        // The two halves of the current device, allocated on its first use; false if the pool is
+        // disabled or cannot be had
+        bool buffers(buffer*& out, size_t& capacity)
+        {
+            int device;
+            capacity = bytes / 2;
+            if(capacity == 0 || hipGetDevice(&device) != hipSuccess || device < 0)
+                return false;
+            if(size_t(device) >= devices.size())
+                devices.resize(device + 1);
+
+            buffer* halves = devices[device].data();
+            bool    ready  = halves[0].block.ptr && halves[1].block.ptr;
+            int     node   = ready ? -1 : device_numa_node(device);
+            for(int h = 0; h < 2; h++)
+            {
+                buffer& b = halves[h];
+                if(!b.block.ptr && !b.block.allocate(capacity, node))
+                    return false;
+                if(!b.done && hipEventCreateWithFlags(&b.done, hipEventDisableTiming) != hipSuccess)
+                {
+                    b.done = nullptr;
+                    return false;
+                }
+            }
+            out = halves;
+            return true;
+        }
+
+        // Frees the halves once idle and sets the size of the next ones
+        hipblasStatus_t resize(size_t new_bytes)
+        {
+            hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+            for(auto& halves : devices)
+                for(buffer& b : halves)
+                {
+                    if(b.pending && hipEventSynchronize(b.done) != hipSuccess)
+                        status = HIPBLAS_STATUS_INTERNAL_ERROR;
+                    b.block.release();
+                    if(b.device)
+                        (void)hipFree(b.device);
+                    if(b.done)
+                        (void)hipEventDestroy(b.done);
+                    b = buffer();
+                }
+            bytes = new_bytes;
+            return status;
+        }
+
+    private:
+        size_t                             bytes = DEFAULT_POOL_BYTES;
+        std::vector<std::array<buffer, 2>> devices;
+    };
+
+    // Never destroyed: the runtime may already be gone when static objects are
+    staging_pool& pool()
+    {
+        static staging_pool* p = new staging_pool;
+        return *p;
+    }
+
+    // Memory the runtime knows is not pageable host memory, which it copies without bouncing
+    bool is_pinned(const void* p)
+    {
+        hipPointerAttribute_t attr;
+        if(hipPointerGetAttributes(&attr, p) != hipSuccess)
+        {
+            (void)hipGetLastError();
+            return false;
+        }
+        return attr.memoryType == hipMemoryTypeHost || attr.memoryType == hipMemoryTypeDevice
+               || attr.memoryType == hipMemoryTypeUnified;
+    }
+
+    // Copies columns of width bytes between host buffers, in one piece when both are contiguous
+    void copy_host(size_t width, size_t cols, const char* src, size_t lds, char* dst, size_t ldd)
+    {
+        if(lds == width && ldd == width)
+            std::memcpy(dst, src, width * cols);
+        else
+            for(size_t j = 0; j < cols; j++)
+                std::memcpy(dst + j * ldd, src + j * lds, width);
+    }
+
+    // The part of the copy one half of the pool holds: whole columns when a column fits, else
+    // a segment of one column
+    struct piece
+    {
+        size_t col;
+        size_t cols;
+        size_t offset;
+        size_t bytes;
+    };
+
+    // count columns of width bytes, at spitch apart in src and dpitch apart in dst, one of them
+    // pageable host memory and the other device memory
+    hipblasStatus_t staged_copy(void*         dst,
+                                size_t        dpitch,
+                                const void*   src,
+                                size_t        spitch,
+                                size_t        width,
+                                size_t        count,
+                                hipMemcpyKind kind,
+                                bool&         staged)
+    {
+        staging_pool&               p = pool();
+        std::lock_guard<std::mutex> lock(p.mutex);
+
+        staging_pool::buffer* halves;
+        size_t                capacity;
+        staged = p.buffers(halves, capacity);
+        if(!staged)
+            return HIPBLAS_STATUS_SUCCESS;
+
+        bool   split          = width > capacity;
+        size_t column_pieces  = split ? (width + capacity - 1) / capacity : 1;
+        size_t cols_per_piece = split ? 1 : capacity / width;
+        size_t n_pieces
+            = split ? count * column_pieces : (count + cols_per_piece - 1) / cols_per_piece;
+
+        auto at = [&](size_t i) {
+            if(split)
+            {
+                size_t offset = i % column_pieces * capacity;
+                return piece{i / column_pieces, 1, offset, std::min(capacity, width - offset)};
+            }
+            size_t col = i * cols_per_piece;
+            return piece{col, std::min(cols_per_piece, count - col), 0, width};
+        };
+
+        // Narrow columns spread over the device side make a DMA of many small rows, so those
+        // pieces cross the link contiguously and a device-side 2D copy spreads or gathers them
+        size_t device_pitch = kind == hipMemcpyHostToDevice ? dpitch : spitch;
+        bool   scatter      = !split && count > 1 && device_pitch != width;
+        for(int h = 0; h < 2 && scatter; h++)
+            if(!halves[h].device && hipMalloc(&halves[h].device, capacity) != hipSuccess)
+            {
+                (void)hipGetLastError();
+                halves[h].device = nullptr;
+                scatter          = false;
+            }
+
+        const char* s = static_cast<const char*>(src);
+        char*       d = static_cast<char*>(dst);
+
+        // Queues the DMA of piece i through its half, waiting for the half's last one first
+        auto transfer = [&](size_t i) {
+            piece                 c = at(i);
+            staging_pool::buffer& b = halves[i % 2];
+            if(b.pending && hipEventSynchronize(b.done) != hipSuccess)
+                return HIPBLAS_STATUS_INTERNAL_ERROR;
+            b.pending = false;
+
+            char*       h     = static_cast<char*>(b.block.ptr);
+            const char* from  = s + c.col * spitch + c.offset;
+            char*       to    = d + c.col * dpitch + c.offset;
+            size_t      total = c.bytes * c.cols;
+            hipError_t  err;
+            if(kind == hipMemcpyHostToDevice)
+            {
+                copy_host(c.bytes, c.cols, from, spitch, h, c.bytes);
+                if(scatter)
+                {
+                    err = hipMemcpyAsync(b.device, h, total, kind, 0);
+                    if(err == hipSuccess)
+                        err = hipMemcpy2DAsync(to,
+                                               dpitch,
+                                               b.device,
+                                               c.bytes,
+                                               c.bytes,
+                                               c.cols,
+                                               hipMemcpyDeviceToDevice,
+                                               0);
+                }
+                else
+                    err = hipMemcpy2DAsync(to, dpitch, h, c.bytes, c.bytes, c.cols, kind, 0);
+            }
+            else if(scatter)
+            {
+                err = hipMemcpy2DAsync(
+                    b.device, c.bytes, from, spitch, c.bytes, c.cols, hipMemcpyDeviceToDevice, 0);
+                if(err == hipSuccess)
+                    err = hipMemcpyAsync(h, b.device, total, kind, 0);
+            }
+            else
+                err = hipMemcpy2DAsync(h, c.bytes, from, spitch, c.bytes, c.cols, kind, 0);
+            if(err != hipSuccess || hipEventRecord(b.done, 0) != hipSuccess)
+                return HIPBLAS_STATUS_MAPPING_ERROR;
+            b.pending = true;
+            return HIPBLAS_STATUS_SUCCESS;
+        };
+
+        // Waits for the download of piece i and copies it out of its half
+        auto unpack = [&](size_t i) {
+            piece                 c = at(i);
+            staging_pool::buffer& b = halves[i % 2];
+            if(hipEventSynchronize(b.done) != hipSuccess)
+                return HIPBLAS_STATUS_INTERNAL_ERROR;
+            b.pending = false;
+            copy_host(c.bytes,
+                      c.cols,
+                      static_cast<const char*>(b.block.ptr),
+                      c.bytes,
+                      d + c.col * dpitch + c.offset,
+                      dpitch);
+            return HIPBLAS_STATUS_SUCCESS;
+        };
+
+        hipblasStatus_t status = HIPBLAS_STATUS_SUCCESS;
+        for(size_t i = 0; i < n_pieces && status == HIPBLAS_STATUS_SUCCESS; i++)
+        {
+            status = transfer(i);
+            if(status == HIPBLAS_STATUS_SUCCESS && kind == hipMemcpyDeviceToHost && i > 0)
+                status = unpack(i - 1);
+        }
+        if(status == HIPBLAS_STATUS_SUCCESS && kind == hipMemcpyDeviceToHost)
+            status = unpack(n_pieces - 1);
+
+        // The calls are synchronous, and the pool free for the next one
+        for(int h = 0; h < 2; h++)
+        {
+            if(halves[h].pending && hipEventSynchronize(halves[h].done) != hipSuccess
+               && status == HIPBLAS_STATUS_SUCCESS)
+                status = HIPBLAS_STATUS_INTERNAL_ERROR;
+            halves[h].pending = false;
+        }
+        return status;
+    }
+
+    // Copies the backend would make as many small DMAs, or bounce through the runtime's own
+    // staging: synchronous ones from or to pageable host memory go through the pool, anything
+    // else strided as one pitched copy. False for contiguous copies the pool does not take
+    bool pitched_copy(void*            dst,
+                      size_t           dpitch,
+                      const void*      src,
+                      size_t           spitch,
+                      size_t           width,
+                      size_t           count,
+                      hipMemcpyKind    kind,
+                      hipStream_t      stream,
+                      bool             async,
+                      hipblasStatus_t& status)
+    {
+        if(!async && !is_pinned(kind == hipMemcpyHostToDevice ? src : dst))
+        {
+            bool staged;
+            status = staged_copy(dst, dpitch, src, spitch, width, count, kind, staged);
+            if(staged)
+                return true;
+        }
+        if(count == 1 || (dpitch == width && spitch == width))
+            return false;
+
+        hipError_t err
+            = async ? hipMemcpy2DAsync(dst, dpitch, src, spitch, width, count, kind, stream)
+                    : hipMemcpy2D(dst, dpitch, src, spitch, width, count, kind);
+        status = err == hipSuccess ? HIPBLAS_STATUS_SUCCESS : HIPBLAS_STATUS_MAPPING_ERROR;
+        return true;
+    }
+
+    bool vector_copy(int              n,
+                     int              elemSize,
+                     const void*      x,
+                     int              incx,
+                     void*            y,
+                     int              incy,
+                     hipMemcpyKind    kind,
+                     hipStream_t      stream,
+                     bool             async,
+                     hipblasStatus_t& status)
+    {
+        if(n <= 0 || elemSize <= 0 || incx <= 0 || incy <= 0 || !x || !y)
+            return false;
+        return pitched_copy(y,
+                            size_t(incy) * elemSize,
+                            x,
+                            size_t(incx) * elemSize,
+                            elemSize,
+                            n,
+                            kind,
+                            stream,
+                            async,
+                            status);
+    }
+
+    bool matrix_copy(int              rows,
+                     int              cols,
+                     int              elemSize,
+                     const void*      A,
+                     int              lda,
+                     void*            B,
+                     int              ldb,
+                     hipMemcpyKind    kind,
+                     hipStream_t      stream,
+                     bool             async,
+                     hipblasStatus_t& status)
+    {
+        if(rows <= 0 || cols <= 0 || elemSize <= 0 || lda < rows || ldb < rows || !A || !B)
+            return false;
+        return pitched_copy(B,
+                            size_t(ldb) * elemSize,
+                            A,
+                            size_t(lda) * elemSize,
+                            size_t(rows) * elemSize,
+                            cols,
+                            kind,
+                            stream,
+                            async,
+                            status);
+    }
+}
+
+bool hipblas_set_get_vector(int              n,
+                            int              elemSize,
+                            const void*      x,
+                            int              incx,
+                            void*            y,
+                            int              incy,
+                            hipMemcpyKind    kind,
+                            hipblasStatus_t& status)
+{
+    return vector_copy(n, elemSize, x, incx, y, incy, kind, nullptr, false, status);
+}
+
+bool hipblas_set_get_vector_async(int              n,
+                                  int              elemSize,
+                                  const void*      x,
+                                  int              incx,
+                                  void*            y,
+                                  int              incy,
+                                  hipMemcpyKind    kind,
+                                  hipStream_t      stream,
+                                  hipblasStatus_t& status)
+{
+    return vector_copy(n, elemSize, x, incx, y, incy, kind, stream, true, status);
+}
+
+bool hipblas_set_get_matrix(int              rows,
+                            int              cols,
+                            int              elemSize,
+                            const void*      A,
+                            int              lda,
+                            void*            B,
+                            int              ldb,
+                            hipMemcpyKind    kind,
+                            hipblasStatus_t& status)
+{
+    return matrix_copy(rows, cols, elemSize, A, lda, B, ldb, kind, nullptr, false, status);
+}
+
+bool hipblas_set_get_matrix_async(int              rows,
+                                  int              cols,
+                                  int              elemSize,
+                                  const void*      A,
+                                  int              lda,
+                                  void*            B,
+                                  int              ldb,
+                                  hipMemcpyKind    kind,
+                                  hipStream_t      stream,
+                                  hipblasStatus_t& status)
+{
+    return matrix_copy(rows, cols, elemSize, A, lda, B, ldb, kind, stream, true, status);
+}
+
+hipblasStatus_t hipblasSetStagingPoolSize(size_t bytes)
+{
+    HIPBLAS_LOG_CALL_NO_HANDLE(bytes);
+    staging_pool&               p = pool();
+    std::lock_guard<std::mutex> lock(p.mutex);
+    return p.resize(bytes);
+}
+
+hipblasStatus_t hipblasGetStagingPoolSize(size_t* bytes)
+{
+    HIPBLAS_LOG_CALL_NO_HANDLE(bytes);
+    if(bytes == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    staging_pool&               p = pool();
+    std::lock_guard<std::mutex> lock(p.mutex);
+    *bytes = p.size();
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblasHostAlloc(void** ptr, size_t bytes)
+{
+    HIPBLAS_LOG_CALL_NO_HANDLE(ptr, bytes);
+    if(ptr == nullptr)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    *ptr = nullptr;
+    if(bytes == 0)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(hipHostMalloc(ptr, bytes, hipHostMallocPortable) != hipSuccess)
+    {
+        *ptr = nullptr;
+        return HIPBLAS_STATUS_ALLOC_FAILED;
+    }
+    return HIPBLAS_STATUS_SUCCESS;
+}
+
+hipblasStatus_t hipblasHostFree(void* ptr)
+{
+    HIPBLAS_LOG_CALL_NO_HANDLE(ptr);
+    if(ptr && hipHostFree(ptr) != hipSuccess)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    return HIPBLAS_STATUS_SUCCESS;
+}
@@ -0,0 +1,518 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "hipblas_handle.h"
+#include "hipblas_kernels.h"
+#include "hipblas_syrk_ex.h"
+#include <algorithm>
+#include <cstring>
+#include <hip/hip_runtime_api.h>
+
+namespace
+{
+    // Order of the diagonal blocks computed in the workspace
+    constexpr int SYRK_DIAGONAL_BLOCK = 128;
+
+    bool is_complex(hipblasDatatype_t type)
+    {
+        switch(type)
+        {
+        case HIPBLAS_C_8I:
+        case HIPBLAS_C_8U:
+        case HIPBLAS_C_16F:
+        case HIPBLAS_C_16B:
+        case HIPBLAS_C_32F:
+        case HIPBLAS_C_32I:
+        case HIPBLAS_C_32U:
+        case HIPBLAS_C_64F:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    hipblasStatus_t launch_status(hipError_t err)
+    {
+        return err == hipSuccess ? HIPBLAS_STATUS_SUCCESS : HIPBLAS_STATUS_INTERNAL_ERROR;
+    }
+
+    // alpha, beta, the second product's alpha and its beta of 1 as host scalars of parts reals
+    // each. alpha and beta are read as real when real_alpha and real_beta are set, and the second
+    // alpha is conj(alpha) when conj_second is
+    template <typename Tr>
+    hipblasStatus_t host_scalars(hipStream_t stream,
+                                 bool        device_scalars,
+                                 const void* alpha,
+                                 bool        real_alpha,
+                                 const void* beta,
+                                 bool        real_beta,
+                                 bool        conj_second,
+                                 int         parts,
+                                 Tr*         scalars)
+    {
+        Tr     in[4]      = {0, 0, 0, 0};
+        size_t alpha_size = sizeof(Tr) * (real_alpha ? 1 : parts);
+        size_t beta_size  = sizeof(Tr) * (real_beta ? 1 : parts);
+        if(device_scalars)
+        {
+            if(hipMemcpyAsync(&in[0], alpha, alpha_size, hipMemcpyDeviceToHost, stream)
+                   != hipSuccess
+               || hipMemcpyAsync(&in[2], beta, beta_size, hipMemcpyDeviceToHost, stream)
+                      != hipSuccess
+               || hipStreamSynchronize(stream) != hipSuccess)
+                return HIPBLAS_STATUS_INTERNAL_ERROR;
+        }
+        else
+        {
+            std::memcpy(&in[0], alpha, alpha_size);
+            std::memcpy(&in[2], beta, beta_size);
+        }
+
+        Tr values[4][2] = {{in[0], in[1]},
+                           {in[2], in[3]},
+                           {in[0], conj_second ? -in[1] : in[1]},
+                           {1, 0}};
+        for(int v = 0; v < 4; v++)
+            for(int r = 0; r < parts; r++)
+                scalars[v * parts + r] = values[v][r];
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // One gemm operand: the rows of op(X) are row bytes apart
+    struct rank_k_operand
+    {
+        hipblas_batched_operand<const void> X;
+        int                                 ld;
+        int64_t                             row;
+    };
+
+    // One rank-k update: the gemm operands, the scalars of the second product syr2k adds, and in
+    // the pointer-array form the device arrays of the rows, columns and result each gemm's offset
+    // operands are built in
+    struct rank_k
+    {
+        hipblasHandle_t    handle;
+        hipStream_t        stream;
+        hipblasFillMode_t  uplo;
+        bool               herk;
+        hipblasOperation_t transa;
+        hipblasOperation_t transb;
+        int                k;
+        const void*        alpha;
+        const void*        beta;
+        rank_k_operand     A;
+        rank_k_operand     B;
+        const void*        alpha2; // nullptr unless the update is a rank-2k one
+        const void*        beta2;
+        hipblasDatatype_t  a_type;
+        hipblasDatatype_t  c_type;
+        size_t             c_size;
+        int                batch_count;
+        hipblasDatatype_t  compute_type;
+        const void**       arrays;
+    };
+
+    // The m x nc block of D starting offset elements into each batch = alpha op(X)(i0:i0 + m, :)
+    // op(Y)(j0:j0 + nc, :)^T, or ^H, + beta times itself
+    hipblasStatus_t gemm(const rank_k&                 p,
+                         const rank_k_operand&         X,
+                         const rank_k_operand&         Y,
+                         const void*                   alpha,
+                         const void*                   beta,
+                         int                           i0,
+                         int                           m,
+                         int                           j0,
+                         int                           nc,
+                         hipblas_batched_operand<void> D,
+                         int64_t                       offset,
+                         int                           ldd)
+    {
+        if(!X.X.array)
+        {
+            const char* x = static_cast<const char*>(X.X.ptr);
+            const char* y = static_cast<const char*>(Y.X.ptr);
+            return hipblasGemmStridedBatchedEx(p.handle,
+                                               p.transa,
+                                               p.transb,
+                                               m,
+                                               nc,
+                                               p.k,
+                                               alpha,
+                                               x + i0 * X.row,
+                                               p.a_type,
+                                               X.ld,
+                                               X.X.stride,
+                                               y + j0 * Y.row,
+                                               p.a_type,
+                                               Y.ld,
+                                               Y.X.stride,
+                                               beta,
+                                               static_cast<char*>(D.ptr) + offset * p.c_size,
+                                               p.c_type,
+                                               ldd,
+                                               D.stride,
+                                               p.batch_count,
+                                               p.compute_type,
+                                               HIPBLAS_GEMM_DEFAULT);
+        }
+
+        const void** rows    = p.arrays;
+        const void** columns = p.arrays + p.batch_count;
+        const void** result  = p.arrays + 2 * p.batch_count;
+
+        hipError_t err
+            = hipblas_offset_pointer_array(p.stream, X.X.array, i0 * X.row, rows, p.batch_count);
+        if(err == hipSuccess)
+            err = hipblas_offset_pointer_array(
+                p.stream, Y.X.array, j0 * Y.row, columns, p.batch_count);
+        if(err == hipSuccess)
+            err = hipblas_offset_pointer_array(
+                p.stream, D.array, offset * p.c_size, result, p.batch_count);
+        if(err != hipSuccess)
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+        return hipblasGemmBatchedEx(p.handle,
+                                    p.transa,
+                                    p.transb,
+                                    m,
+                                    nc,
+                                    p.k,
+                                    alpha,
+                                    rows,
+                                    p.a_type,
+                                    X.ld,
+                                    columns,
+                                    p.a_type,
+                                    Y.ld,
+                                    beta,
+                                    (void**)result,
+                                    p.c_type,
+                                    ldd,
+                                    p.batch_count,
+                                    p.compute_type,
+                                    HIPBLAS_GEMM_DEFAULT);
+    }
+
+    // The block of the update at rows i0:i0 + m and columns j0:j0 + nc, in D
+    hipblasStatus_t block(const rank_k&                 p,
+                          int                           i0,
+                          int                           m,
+                          int                           j0,
+                          int                           nc,
+                          hipblas_batched_operand<void> D,
+                          int64_t                       offset,
+                          int                           ldd)
+    {
+        hipblasStatus_t status = gemm(p, p.A, p.B, p.alpha, p.beta, i0, m, j0, nc, D, offset, ldd);
+        if(status == HIPBLAS_STATUS_SUCCESS && p.alpha2)
+            status = gemm(p, p.B, p.A, p.alpha2, p.beta2, i0, m, j0, nc, D, offset, ldd);
+        return status;
+    }
+
+    // The diagonal block of order nn at (i0, i0): C's block is copied to W, updated there in full
+    // and only its uplo triangle copied back
+    hipblasStatus_t diagonal(const rank_k&                 p,
+                             int                           i0,
+                             int                           nn,
+                             hipblas_batched_operand<void> C,
+                             int                           ldc,
+                             hipblas_batched_operand<void> W,
+                             int                           ldw)
+    {
+        int64_t    offset = i0 + int64_t(i0) * ldc;
+        hipError_t err    = hipblas_syrk_block_copy(p.stream,
+                                                 HIPBLAS_FILL_MODE_FULL,
+                                                 nn,
+                                                 p.c_size,
+                                                 {C.ptr, C.stride, C.array},
+                                                 offset,
+                                                 ldc,
+                                                 {W.ptr, W.stride, nullptr},
+                                                 0,
+                                                 ldw,
+                                                 false,
+                                                 p.batch_count);
+        if(err != hipSuccess)
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+        hipblasStatus_t status = block(p, i0, nn, i0, nn, W, 0, ldw);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        return launch_status(hipblas_syrk_block_copy(p.stream,
+                                                     p.uplo,
+                                                     nn,
+                                                     p.c_size,
+                                                     {W.ptr, W.stride, nullptr},
+                                                     0,
+                                                     ldw,
+                                                     C,
+                                                     offset,
+                                                     ldc,
+                                                     p.herk,
+                                                     p.batch_count));
+    }
+
+    // The uplo triangle of C's diagonal block of order nn at (i0, i0), halved so the first half
+    // is a whole number of diagonal blocks and the two halves meet in one gemm
+    hipblasStatus_t update(const rank_k&                 p,
+                           int                           i0,
+                           int                           nn,
+                           hipblas_batched_operand<void> C,
+                           int                           ldc,
+                           hipblas_batched_operand<void> W,
+                           int                           ldw)
+    {
+        if(nn <= SYRK_DIAGONAL_BLOCK)
+            return diagonal(p, i0, nn, C, ldc, W, ldw);
+
+        int n1 = (nn / 2 + SYRK_DIAGONAL_BLOCK - 1) / SYRK_DIAGONAL_BLOCK * SYRK_DIAGONAL_BLOCK;
+        int n2 = nn - n1;
+
+        hipblasStatus_t status = update(p, i0, n1, C, ldc, W, ldw);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = p.uplo == HIPBLAS_FILL_MODE_LOWER
+                         ? block(p, i0 + n1, n2, i0, n1, C, i0 + n1 + int64_t(i0) * ldc, ldc)
+                         : block(p, i0, n1, i0 + n1, n2, C, i0 + int64_t(i0 + n1) * ldc, ldc);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = update(p, i0 + n1, n2, C, ldc, W, ldw);
+        return status;
+    }
+
+    // syrk and herk have B = A and no second product; alpha is real for herk alone
+    hipblasStatus_t rank_k_update(hipblasHandle_t                     handle,
+                                  bool                                herk,
+                                  bool                                two,
+                                  bool                                real_alpha,
+                                  hipblasFillMode_t                   uplo,
+                                  hipblasOperation_t                  trans,
+                                  int                                 n,
+                                  int                                 k,
+                                  const void*                         alpha,
+                                  hipblas_batched_operand<const void> A,
+                                  hipblasDatatype_t                   a_type,
+                                  int                                 lda,
+                                  hipblas_batched_operand<const void> B,
+                                  int                                 ldb,
+                                  const void*                         beta,
+                                  hipblas_batched_operand<void>       C,
+                                  hipblasDatatype_t                   c_type,
+                                  int                                 ldc,
+                                  int                                 batch_count,
+                                  hipblasDatatype_t                   compute_type)
+    {
+        hipblas_handle* h = static_cast<hipblas_handle*>(handle);
+        if(h == nullptr)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+        // Real syrk takes op C as op T, as BLAS does
+        bool complex_a = is_complex(a_type);
+        bool op_valid  = herk ? trans == HIPBLAS_OP_N || trans == HIPBLAS_OP_C
+                             : trans == HIPBLAS_OP_N || trans == HIPBLAS_OP_T
+                                  || (trans == HIPBLAS_OP_C && !complex_a);
+        int a_rows = trans == HIPBLAS_OP_N ? n : k;
+        if((uplo != HIPBLAS_FILL_MODE_UPPER && uplo != HIPBLAS_FILL_MODE_LOWER) || !op_valid
+           || n < 0 || k < 0 || lda < std::max(1, a_rows) || ldb < std::max(1, a_rows)
+           || ldc < std::max(1, n) || batch_count < 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(n == 0 || batch_count == 0)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(!alpha || !beta || (!A.ptr && !A.array) || (!B.ptr && !B.array)
+           || (!C.ptr && !C.array))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        // The emulated compute types carve the workspace the diagonal blocks are in. herk's real
+        // scalars, and the second product's, are converted to host scalars of the compute type
+        size_t a_size         = hipblas_datatype_size(a_type);
+        size_t c_size         = hipblas_datatype_size(c_type);
+        bool   herk_types     = complex_a && is_complex(c_type)
+                             && (compute_type == HIPBLAS_C_32F || compute_type == HIPBLAS_C_64F);
+        bool   emulated       = compute_type == HIPBLAS_COMPUTE_32F_FAST_BF16X3
+                             || compute_type == HIPBLAS_COMPUTE_64F_EMULATED_INT8;
+        bool   convert        = herk || two;
+        bool   single         = compute_type == HIPBLAS_R_32F || compute_type == HIPBLAS_C_32F;
+        bool   device_scalars = h->pointer_mode == HIPBLAS_POINTER_MODE_DEVICE;
+        if(a_size == 0 || c_size < 2 || emulated || (herk && !herk_types)
+           || (convert && !single && compute_type != HIPBLAS_R_64F && compute_type != HIPBLAS_C_64F)
+           || (convert && device_scalars
+               && (hipblas_scalar_stride(handle) != 0
+                   || h->capture_mode == HIPBLAS_CAPTURE_MODE_SAFE)))
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+        hipStream_t     stream;
+        hipblasStatus_t status = hipblasGetStream(handle, &stream);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        float       scalars_32[8];
+        double      scalars_64[8];
+        const void* alpha2 = nullptr;
+        const void* beta2  = nullptr;
+        if(convert)
+        {
+            int parts = is_complex(compute_type) ? 2 : 1;
+            if(single)
+                status = host_scalars(
+                    stream, device_scalars, alpha, real_alpha, beta, herk, herk, parts, scalars_32);
+            else
+                status = host_scalars(
+                    stream, device_scalars, alpha, real_alpha, beta, herk, herk, parts, scalars_64);
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+
+            const char* scalars = single ? reinterpret_cast<const char*>(scalars_32)
+                                         : reinterpret_cast<const char*>(scalars_64);
+            size_t      size    = (single ? sizeof(float) : sizeof(double)) * parts;
+            alpha               = scalars;
+            beta                = scalars + size;
+            if(two)
+            {
+                alpha2 = scalars + 2 * size;
+                beta2  = scalars + 3 * size;
+            }
+        }
+
+        int          ldw     = std::min(n, SYRK_DIAGONAL_BLOCK);
+        bool         arrays  = A.array != nullptr;
+        size_t       batches = batch_count;
+        int8_t*      w;
+        const void** gemm_arrays;
+        int8_t**     w_array;
+        status = hipblas_workspace_carve(handle,
+                                         w,
+                                         batches * ldw * ldw * c_size,
+                                         gemm_arrays,
+                                         arrays ? 3 * batches : 0,
+                                         w_array,
+                                         arrays ? batches : 0);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        if(arrays)
+        {
+            status = launch_status(hipblas_strided_pointer_array(
+                stream, w, int64_t(ldw) * ldw * c_size, w_array, batch_count));
+            if(status != HIPBLAS_STATUS_SUCCESS)
+                return status;
+        }
+
+        // N gives op(A) op(B)^T, or ^H, as gemm(N, T) and the others as gemm(T, N)
+        hipblasOperation_t op_t  = herk ? HIPBLAS_OP_C : HIPBLAS_OP_T;
+        hipblasOperation_t opa   = trans == HIPBLAS_OP_N ? HIPBLAS_OP_N : op_t;
+        hipblasOperation_t opb   = trans == HIPBLAS_OP_N ? op_t : HIPBLAS_OP_N;
+        int64_t            a_row = int64_t(trans == HIPBLAS_OP_N ? 1 : lda) * int64_t(a_size);
+        int64_t            b_row = int64_t(trans == HIPBLAS_OP_N ? 1 : ldb) * int64_t(a_size);
+
+        rank_k p{handle,
+                 stream,
+                 uplo,
+                 herk,
+                 opa,
+                 opb,
+                 k,
+                 alpha,
+                 beta,
+                 {A, lda, a_row},
+                 {B, ldb, b_row},
+                 alpha2,
+                 beta2,
+                 a_type,
+                 c_type,
+                 c_size,
+                 batch_count,
+                 compute_type,
+                 gemm_arrays};
+        hipblas_batched_operand<void> W{
+            w, int64_t(ldw) * ldw, arrays ? reinterpret_cast<void* const*>(w_array) : nullptr};
+
+        // The gemms take the classic path, so they leave the workspace alone, host scalars
+        // when they were converted, and device pointer arrays for the offset ones built here
+        hipblas_classic_gemm_guard classic(handle, convert && device_scalars, arrays);
+        status = classic.status();
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = update(p, 0, n, C, ldc, W, ldw);
+        return status;
+    }
+}
+
+hipblasStatus_t hipblas_syrk_ex(hipblasHandle_t                     handle,
+                                bool                                herk,
+                                hipblasFillMode_t                   uplo,
+                                hipblasOperation_t                  trans,
+                                int                                 n,
+                                int                                 k,
+                                const void*                         alpha,
+                                hipblas_batched_operand<const void> A,
+                                hipblasDatatype_t                   a_type,
+                                int                                 lda,
+                                const void*                         beta,
+                                hipblas_batched_operand<void>       C,
+                                hipblasDatatype_t                   c_type,
+                                int                                 ldc,
+                                int                                 batch_count,
+                                hipblasDatatype_t                   compute_type)
+{
+    return rank_k_update(handle,
+                         herk,
+                         false,
+                         herk,
+                         uplo,
+                         trans,
+                         n,
+                         k,
+                         alpha,
+                         A,
+                         a_type,
+                         lda,
+                         A,
+                         lda,
+                         beta,
+                         C,
+                         c_type,
+                         ldc,
+                         batch_count,
+                         compute_type);
+}
+
+hipblasStatus_t hipblas_syrkx_ex(hipblasHandle_t                     handle,
+                                 bool                                herk,
+                                 bool                                two,
+                                 hipblasFillMode_t                   uplo,
+                                 hipblasOperation_t                  trans,
+                                 int                                 n,
+                                 int                                 k,
+                                 const void*                         alpha,
+                                 hipblas_batched_operand<const void> A,
+                                 hipblasDatatype_t                   a_type,
+                                 int                                 lda,
+                                 hipblas_batched_operand<const void> B,
+                                 int                                 ldb,
+                                 const void*                         beta,
+                                 hipblas_batched_operand<void>       C,
+                                 hipblasDatatype_t                   c_type,
+                                 int                                 ldc,
+                                 int                                 batch_count,
+                                 hipblasDatatype_t                   compute_type)
+{
+    return rank_k_update(handle,
+                         herk,
+                         two,
+                         false,
+                         uplo,
+                         trans,
+                         n,
+                         k,
+                         alpha,
+                         A,
+                         a_type,
+                         lda,
+                         B,
+                         ldb,
+                         beta,
+                         C,
+                         c_type,
+                         ldc,
+                         batch_count,
+                         compute_type);
+}
@@ -0,0 +1,285 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "hipblas_handle.h"
+#include "hipblas_kernels.h"
+#include "hipblas_trsm_mixed_ex.h"
+#include <algorithm>
+#include <hip/hip_runtime_api.h>
+
+namespace
+{
+    constexpr int DIAGONAL_BLOCK = HIPBLAS_TRSM_MIXED_DIAGONAL;
+
+    hipblasStatus_t launch_status(hipError_t err)
+    {
+        return err == hipSuccess ? HIPBLAS_STATUS_SUCCESS : HIPBLAS_STATUS_INTERNAL_ERROR;
+    }
+
+    // One triangular solve or product. M is op(A) on the left side and op(A)^T on the right, so
+    // right-hand side r of B, its column or row, becomes alpha M^-1 r or alpha M r; lower is set
+    // when M is lower triangular. In the pointer-array form arrays holds the device arrays each
+    // gemm's offset operands are built in
+    struct triangular
+    {
+        hipblasHandle_t                     handle;
+        hipStream_t                         stream;
+        bool                                solve;
+        hipblasSideMode_t                   side;
+        bool                                lower;
+        hipblasFillMode_t                   uplo;
+        hipblasOperation_t                  trans;
+        hipblasDiagType_t                   diag;
+        int                                 nrhs;
+        hipblas_batched_operand<const void> A;
+        int                                 lda;
+        hipblas_batched_operand<void>       B;
+        int                                 ldb;
+        hipblasDatatype_t                   type;
+        size_t                              size;
+        int                                 batch_count;
+        const void**                        arrays;
+    };
+
+    bool left(const triangular& p)
+    {
+        return p.side == HIPBLAS_SIDE_LEFT;
+    }
+
+    // Elements into a batch of op(A)(i, j), and of row i of B on the left or column i on the right
+    int64_t a_offset(const triangular& p, int i, int j)
+    {
+        return p.trans == HIPBLAS_OP_N ? i + int64_t(j) * p.lda : j + int64_t(i) * p.lda;
+    }
+
+    int64_t b_offset(const triangular& p, int i)
+    {
+        return left(p) ? i : int64_t(i) * p.ldb;
+    }
+
+    // rows s0:s0 + ns of M B = alpha M(s0:s0 + ns, f0:f0 + nf) B(f0:f0 + nf) + beta times
+    // themselves, the rows of B being its columns on the right side
+    hipblasStatus_t
+        gemm(const triangular& p, int s0, int ns, int f0, int nf, float alpha, float beta)
+    {
+        hipblasOperation_t op = p.trans == HIPBLAS_OP_N ? HIPBLAS_OP_N : HIPBLAS_OP_T;
+
+        // On the right the gemm is B(:, s) = B(:, f) op(A)(f, s)
+        bool    l        = left(p);
+        int64_t x_offset = l ? a_offset(p, s0, f0) : b_offset(p, f0);
+        int64_t y_offset = l ? b_offset(p, f0) : a_offset(p, f0, s0);
+        int64_t c_offset = b_offset(p, s0);
+        int     ldx      = l ? p.lda : p.ldb;
+        int     ldy      = l ? p.ldb : p.lda;
+
+        hipblas_batched_operand<const void> B{p.B.ptr,
+                                              p.B.stride,
+                                              reinterpret_cast<const void* const*>(p.B.array)};
+        hipblas_batched_operand<const void> X = l ? p.A : B;
+        hipblas_batched_operand<const void> Y = l ? B : p.A;
+
+        if(!p.B.array)
+            return hipblasGemmStridedBatchedEx(p.handle,
+                                               l ? op : HIPBLAS_OP_N,
+                                               l ? HIPBLAS_OP_N : op,
+                                               l ? ns : p.nrhs,
+                                               l ? p.nrhs : ns,
+                                               nf,
+                                               &alpha,
+                                               static_cast<const char*>(X.ptr) + x_offset * p.size,
+                                               p.type,
+                                               ldx,
+                                               X.stride,
+                                               static_cast<const char*>(Y.ptr) + y_offset * p.size,
+                                               p.type,
+                                               ldy,
+                                               Y.stride,
+                                               &beta,
+                                               static_cast<char*>(p.B.ptr) + c_offset * p.size,
+                                               p.type,
+                                               p.ldb,
+                                               p.B.stride,
+                                               p.batch_count,
+                                               HIPBLAS_R_32F,
+                                               HIPBLAS_GEMM_DEFAULT);
+
+        const void** xs     = p.arrays;
+        const void** ys     = p.arrays + p.batch_count;
+        const void** result = p.arrays + 2 * p.batch_count;
+
+        hipError_t err = hipblas_offset_pointer_array(
+            p.stream, X.array, x_offset * p.size, xs, p.batch_count);
+        if(err == hipSuccess)
+            err = hipblas_offset_pointer_array(
+                p.stream, Y.array, y_offset * p.size, ys, p.batch_count);
+        if(err == hipSuccess)
+            err = hipblas_offset_pointer_array(
+                p.stream, B.array, c_offset * p.size, result, p.batch_count);
+        if(err != hipSuccess)
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+        return hipblasGemmBatchedEx(p.handle,
+                                    l ? op : HIPBLAS_OP_N,
+                                    l ? HIPBLAS_OP_N : op,
+                                    l ? ns : p.nrhs,
+                                    l ? p.nrhs : ns,
+                                    nf,
+                                    &alpha,
+                                    xs,
+                                    p.type,
+                                    ldx,
+                                    ys,
+                                    p.type,
+                                    ldy,
+                                    &beta,
+                                    (void**)result,
+                                    p.type,
+                                    p.ldb,
+                                    p.batch_count,
+                                    HIPBLAS_R_32F,
+                                    HIPBLAS_GEMM_DEFAULT);
+    }
+
+    // Rows d0:d0 + nn of B against M's diagonal block there, halved so the first half is a whole
+    // number of diagonal blocks and the two halves meet in one gemm. A solve takes the half M's
+    // triangle starts in first and subtracts it from the other; a product takes the other half
+    // first, so the half it adds is still unchanged
+    hipblasStatus_t sweep(const triangular& p, int d0, int nn, float alpha)
+    {
+        if(nn <= DIAGONAL_BLOCK)
+            return launch_status(hipblas_trsm_mixed_diagonal(p.stream,
+                                                             p.solve,
+                                                             p.side,
+                                                             p.uplo,
+                                                             p.trans,
+                                                             p.diag,
+                                                             nn,
+                                                             p.nrhs,
+                                                             alpha,
+                                                             p.A,
+                                                             a_offset(p, d0, d0),
+                                                             p.lda,
+                                                             p.B,
+                                                             b_offset(p, d0),
+                                                             p.ldb,
+                                                             p.type,
+                                                             p.batch_count));
+
+        int n1 = (nn / 2 + DIAGONAL_BLOCK - 1) / DIAGONAL_BLOCK * DIAGONAL_BLOCK;
+        int n2 = nn - n1;
+
+        bool first_half = p.solve == p.lower;
+        int  f0         = first_half ? d0 : d0 + n1;
+        int  nf         = first_half ? n1 : n2;
+        int  s0         = first_half ? d0 + n1 : d0;
+        int  ns         = first_half ? n2 : n1;
+
+        hipblasStatus_t status = sweep(p, f0, nf, alpha);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        if(p.solve)
+        {
+            status = gemm(p, s0, ns, f0, nf, -1, alpha);
+            return status == HIPBLAS_STATUS_SUCCESS ? sweep(p, s0, ns, 1) : status;
+        }
+        status = gemm(p, f0, nf, s0, ns, alpha, 1);
+        return status == HIPBLAS_STATUS_SUCCESS ? sweep(p, s0, ns, alpha) : status;
+    }
+}
+
+hipblasStatus_t hipblas_trsm_mixed_ex(hipblasHandle_t                     handle,
+                                      bool                                solve,
+                                      hipblasSideMode_t                   side,
+                                      hipblasFillMode_t                   uplo,
+                                      hipblasOperation_t                  trans,
+                                      hipblasDiagType_t                   diag,
+                                      int                                 m,
+                                      int                                 n,
+                                      const void*                         alpha,
+                                      hipblas_batched_operand<const void> A,
+                                      hipblasDatatype_t                   a_type,
+                                      int                                 lda,
+                                      hipblas_batched_operand<void>       B,
+                                      hipblasDatatype_t                   b_type,
+                                      int                                 ldb,
+                                      int                                 batch_count,
+                                      hipblasDatatype_t                   compute_type)
+{
+    hipblas_handle* h = static_cast<hipblas_handle*>(handle);
+    if(h == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+
+    int k = side == HIPBLAS_SIDE_LEFT ? m : n;
+    if((side != HIPBLAS_SIDE_LEFT && side != HIPBLAS_SIDE_RIGHT)
+       || (uplo != HIPBLAS_FILL_MODE_UPPER && uplo != HIPBLAS_FILL_MODE_LOWER)
+       || (trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_T && trans != HIPBLAS_OP_C)
+       || (diag != HIPBLAS_DIAG_NON_UNIT && diag != HIPBLAS_DIAG_UNIT))
+        return HIPBLAS_STATUS_INVALID_ENUM;
+    if(m < 0 || n < 0 || lda < std::max(1, k) || ldb < std::max(1, m) || batch_count < 0)
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(m == 0 || n == 0 || batch_count == 0)
+        return HIPBLAS_STATUS_SUCCESS;
+    if(!alpha || (!A.ptr && !A.array) || (!B.ptr && !B.array))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+
+    // The data are real fp16, bf16 or fp32, both of one type, and the arithmetic fp32
+    bool device_scalars = h->pointer_mode == HIPBLAS_POINTER_MODE_DEVICE;
+    if((a_type != HIPBLAS_R_16F && a_type != HIPBLAS_R_16B && a_type != HIPBLAS_R_32F)
+       || b_type != a_type || compute_type != HIPBLAS_R_32F
+       || (device_scalars
+           && (hipblas_scalar_stride(handle) != 0
+               || h->capture_mode == HIPBLAS_CAPTURE_MODE_SAFE)))
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    hipStream_t     stream;
+    hipblasStatus_t status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    float alpha_host;
+    if(device_scalars)
+    {
+        if(hipMemcpyAsync(&alpha_host, alpha, sizeof(float), hipMemcpyDeviceToHost, stream)
+               != hipSuccess
+           || hipStreamSynchronize(stream) != hipSuccess)
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+    }
+    else
+        alpha_host = *static_cast<const float*>(alpha);
+
+    bool         arrays  = B.array != nullptr;
+    size_t       batches = batch_count;
+    const void** gemm_arrays;
+    status = hipblas_workspace_carve(handle, gemm_arrays, arrays ? 3 * batches : 0);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    bool       upper_op = (uplo == HIPBLAS_FILL_MODE_UPPER) == (trans == HIPBLAS_OP_N);
+    triangular p{handle,
+                 stream,
+                 solve,
+                 side,
+                 side == HIPBLAS_SIDE_LEFT ? !upper_op : upper_op,
+                 uplo,
+                 trans,
+                 diag,
+                 side == HIPBLAS_SIDE_LEFT ? n : m,
+                 A,
+                 lda,
+                 B,
+                 ldb,
+                 a_type,
+                 hipblas_datatype_size(a_type),
+                 batch_count,
+                 gemm_arrays};
+
+    // The gemms take the classic path, so they leave the workspace alone, host scalars, and
+    // device pointer arrays for the offset ones built here
+    hipblas_classic_gemm_guard classic(handle, device_scalars, arrays);
+    status = classic.status();
+    if(status == HIPBLAS_STATUS_SUCCESS)
+        status = sweep(p, 0, side == HIPBLAS_SIDE_LEFT ? m : n, alpha_host);
+    return status;
+}
@@ -0,0 +1,287 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "hipblas_handle.h"
+#include "hipblas_kernels.h"
+#include "hipblas_logging.h"
+#include <algorithm>
+#include <hip/hip_runtime_api.h>
+
+#ifdef __HIP_PLATFORM_SOLVER__
+namespace
+{
+    // HIPBLAS_TSQR_AUTO takes CholeskyQR2 from this m / n up, where the panel's sequential
+    // Householder steps dominate geqrf
+    constexpr int TSQR_ASPECT = 16;
+
+    // The Gram matrix op(A)^H A comes from syrk, or herk for complex types, with real scalars
+    template <typename T>
+    struct routines;
+
+    template <>
+    struct routines<float>
+    {
+        using real = float;
+
+        static constexpr hipblasOperation_t adjoint = HIPBLAS_OP_T;
+
+        static constexpr auto gram  = hipblasSsyrk;
+        static constexpr auto potrf = hipblasSpotrf;
+        static constexpr auto trsm  = hipblasStrsm;
+        static constexpr auto trmm  = hipblasStrmm;
+        static constexpr auto geqrf = hipblasSgeqrf;
+        static constexpr auto orgqr = hipblasSorgqr;
+    };
+
+    template <>
+    struct routines<double>
+    {
+        using real = double;
+
+        static constexpr hipblasOperation_t adjoint = HIPBLAS_OP_T;
+
+        static constexpr auto gram  = hipblasDsyrk;
+        static constexpr auto potrf = hipblasDpotrf;
+        static constexpr auto trsm  = hipblasDtrsm;
+        static constexpr auto trmm  = hipblasDtrmm;
+        static constexpr auto geqrf = hipblasDgeqrf;
+        static constexpr auto orgqr = hipblasDorgqr;
+    };
+
+    template <>
+    struct routines<hipblasComplex>
+    {
+        using real = float;
+
+        static constexpr hipblasOperation_t adjoint = HIPBLAS_OP_C;
+
+        static constexpr auto gram  = hipblasCherk;
+        static constexpr auto potrf = hipblasCpotrf;
+        static constexpr auto trsm  = hipblasCtrsm;
+        static constexpr auto trmm  = hipblasCtrmm;
+        static constexpr auto geqrf = hipblasCgeqrf;
+        static constexpr auto orgqr = hipblasCungqr;
+    };
+
+    template <>
+    struct routines<hipblasDoubleComplex>
+    {
+        using real = double;
+
+        static constexpr hipblasOperation_t adjoint = HIPBLAS_OP_C;
+
+        static constexpr auto gram  = hipblasZherk;
+        static constexpr auto potrf = hipblasZpotrf;
+        static constexpr auto trsm  = hipblasZtrsm;
+        static constexpr auto trmm  = hipblasZtrmm;
+        static constexpr auto geqrf = hipblasZgeqrf;
+        static constexpr auto orgqr = hipblasZungqr;
+    };
+
+    // One CholeskyQR pass: G = A^H A = U^H U, A = A U^-1 and R = U R. A Gram matrix potrf cannot
+    // factor clears factored and leaves A and R as they were
+    template <typename T>
+    hipblasStatus_t cholesky_pass(hipblasHandle_t handle,
+                                  hipStream_t     stream,
+                                  int             m,
+                                  int             n,
+                                  T*              A,
+                                  int             lda,
+                                  T*              R,
+                                  int             ldr,
+                                  T*              G,
+                                  int*            info,
+                                  bool&           factored)
+    {
+        using F = routines<T>;
+
+        typename F::real one_r = 1, zero_r = 0;
+        T                one   = 1;
+        int              info_host;
+
+        hipblasStatus_t status = F::gram(
+            handle, HIPBLAS_FILL_MODE_UPPER, F::adjoint, n, m, &one_r, A, lda, &zero_r, G, n);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = F::potrf(handle, HIPBLAS_FILL_MODE_UPPER, n, G, n, info);
+        if(status == HIPBLAS_STATUS_SUCCESS
+           && (hipMemcpyAsync(&info_host, info, sizeof(int), hipMemcpyDeviceToHost, stream)
+                   != hipSuccess
+               || hipStreamSynchronize(stream) != hipSuccess))
+            status = HIPBLAS_STATUS_INTERNAL_ERROR;
+        factored = status == HIPBLAS_STATUS_SUCCESS && info_host == 0;
+        if(!factored)
+            return status;
+
+        status = F::trsm(handle,
+                         HIPBLAS_SIDE_RIGHT,
+                         HIPBLAS_FILL_MODE_UPPER,
+                         HIPBLAS_OP_N,
+                         HIPBLAS_DIAG_NON_UNIT,
+                         m,
+                         n,
+                         &one,
+                         G,
+                         n,
+                         A,
+                         lda);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = F::trmm(handle,
+                             HIPBLAS_SIDE_LEFT,
+                             HIPBLAS_FILL_MODE_UPPER,
+                             HIPBLAS_OP_N,
+                             HIPBLAS_DIAG_NON_UNIT,
+                             n,
+                             n,
+                             &one,
+                             G,
+                             n,
+                             R,
+                             ldr);
+        return status;
+    }
+
+    // geqrf on what remains of A, its R folded into R before orgqr overwrites it with Q
+    template <typename T>
+    hipblasStatus_t
+        householder(hipblasHandle_t handle, int m, int n, T* A, int lda, T* R, int ldr, T* tau)
+    {
+        using F = routines<T>;
+
+        T               one = 1;
+        int             info;
+        hipblasStatus_t status = F::geqrf(handle, m, n, A, lda, tau, &info);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = F::trmm(handle,
+                             HIPBLAS_SIDE_LEFT,
+                             HIPBLAS_FILL_MODE_UPPER,
+                             HIPBLAS_OP_N,
+                             HIPBLAS_DIAG_NON_UNIT,
+                             n,
+                             n,
+                             &one,
+                             A,
+                             lda,
+                             R,
+                             ldr);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = F::orgqr(handle, m, n, n, A, lda, tau, &info);
+        return status;
+    }
+
+    // R starts as I and every factorization step multiplies its triangle in from the left, so
+    // R's lower triangle stays zero without a kernel of its own. The steps run on the classic
+    // gemm path, so none of them carves the workspace holding G, tau and info, and with host
+    // scalars whatever the caller's pointer mode is
+    template <typename T>
+    hipblasStatus_t tsqr(hipblasHandle_t   handle,
+                         hipblasTsqrAlgo_t algo,
+                         int               m,
+                         int               n,
+                         T*                A,
+                         int               lda,
+                         T*                R,
+                         int               ldr)
+    {
+        if(handle == nullptr)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if(algo != HIPBLAS_TSQR_AUTO && algo != HIPBLAS_TSQR_CHOLESKY_QR2
+           && algo != HIPBLAS_TSQR_HOUSEHOLDER)
+            return HIPBLAS_STATUS_INVALID_ENUM;
+        if(n < 0 || m < n || lda < std::max(1, m) || ldr < std::max(1, n))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(n == 0)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(A == nullptr || R == nullptr)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        hipblas_handle* h = static_cast<hipblas_handle*>(handle);
+        bool cholesky     = algo == HIPBLAS_TSQR_CHOLESKY_QR2
+                        || (algo == HIPBLAS_TSQR_AUTO && int64_t(m) >= int64_t(TSQR_ASPECT) * n);
+
+        // Testing potrf's info is a host synchronization, which capture cannot record
+        if(cholesky && h->capture_mode == HIPBLAS_CAPTURE_MODE_SAFE)
+            return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+        hipStream_t     stream;
+        hipblasStatus_t status = hipblasGetStream(handle, &stream);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        T*   G;
+        T*   tau;
+        int* info;
+        status = hipblas_workspace_carve(
+            handle, G, cholesky ? size_t(n) * n : 0, tau, size_t(n), info, size_t(1));
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+        if(hipblas_set_identity_strided_batched(stream, n, R, ldr, 0, 1) != hipSuccess)
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+
+        hipblas_classic_gemm_guard classic(handle, h->pointer_mode == HIPBLAS_POINTER_MODE_DEVICE);
+        status = classic.status();
+
+        // A second pass restores the orthogonality the first loses to the squared condition
+        // number of the Gram matrix
+        bool factored = cholesky;
+        for(int pass = 0; pass < 2 && factored && status == HIPBLAS_STATUS_SUCCESS; pass++)
+            status = cholesky_pass(handle, stream, m, n, A, lda, R, ldr, G, info, factored);
+        if(status == HIPBLAS_STATUS_SUCCESS && !factored)
+            status = householder(handle, m, n, A, lda, R, ldr, tau);
+        return status;
+    }
+}
+
+hipblasStatus_t hipblasStsqr(hipblasHandle_t   handle,
+                             hipblasTsqrAlgo_t algo,
+                             int               m,
+                             int               n,
+                             float*            A,
+                             int               lda,
+                             float*            R,
+                             int               ldr)
+{
+    HIPBLAS_LOG_CALL(handle, algo, m, n, A, lda, R, ldr);
+    return tsqr(handle, algo, m, n, A, lda, R, ldr);
+}
+
+hipblasStatus_t hipblasDtsqr(hipblasHandle_t   handle,
+                             hipblasTsqrAlgo_t algo,
+                             int               m,
+                             int               n,
+                             double*           A,
+                             int               lda,
+                             double*           R,
+                             int               ldr)
+{
+    HIPBLAS_LOG_CALL(handle, algo, m, n, A, lda, R, ldr);
+    return tsqr(handle, algo, m, n, A, lda, R, ldr);
+}
+
+hipblasStatus_t hipblasCtsqr(hipblasHandle_t   handle,
+                             hipblasTsqrAlgo_t algo,
+                             int               m,
+                             int               n,
+                             hipblasComplex*   A,
+                             int               lda,
+                             hipblasComplex*   R,
+                             int               ldr)
+{
+    HIPBLAS_LOG_CALL(handle, algo, m, n, A, lda, R, ldr);
+    return tsqr(handle, algo, m, n, A, lda, R, ldr);
+}
+
+hipblasStatus_t hipblasZtsqr(hipblasHandle_t       handle,
+                             hipblasTsqrAlgo_t     algo,
+                             int                   m,
+                             int                   n,
+                             hipblasDoubleComplex* A,
+                             int                   lda,
+                             hipblasDoubleComplex* R,
+                             int                   ldr)
+{
+    HIPBLAS_LOG_CALL(handle, algo, m, n, A, lda, R, ldr);
+    return tsqr(handle, algo, m, n, A, lda, R, ldr);
+}
+#endif
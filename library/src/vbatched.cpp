@@ -0,0 +1,743 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "hipblas_handle.h"
+#include "hipblas_kernels.h"
+#include "hipblas_logging.h"
+#include <hip/hip_runtime_api.h>
+
+namespace
+{
+    hipblasStatus_t launch_status(hipError_t err)
+    {
+        return err == hipSuccess ? HIPBLAS_STATUS_SUCCESS : HIPBLAS_STATUS_INTERNAL_ERROR;
+    }
+
+    bool valid_operation(hipblasOperation_t trans)
+    {
+        return trans == HIPBLAS_OP_N || trans == HIPBLAS_OP_T || trans == HIPBLAS_OP_C;
+    }
+
+    // Neither backend library takes per-batch sizes, so both run the same kernels on the handle's
+    // stream. The sizes stay on the device and are only checked there, an entry they make invalid
+    // being skipped, so the host never waits on them
+    template <typename T>
+    hipblasStatus_t gemv_vbatched(hipblasHandle_t    handle,
+                                  hipblasOperation_t trans,
+                                  const int*         m,
+                                  const int*         n,
+                                  const T*           alpha,
+                                  const T* const*    A,
+                                  const int*         lda,
+                                  const T* const*    x,
+                                  const int*         incx,
+                                  const T*           beta,
+                                  T* const*          y,
+                                  const int*         incy,
+                                  int                batch_count)
+    {
+        hipblas_handle* h = static_cast<hipblas_handle*>(handle);
+        if(h == nullptr)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if(!valid_operation(trans))
+            return HIPBLAS_STATUS_INVALID_ENUM;
+        if(batch_count < 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(batch_count == 0)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(!m || !n || !lda || !incx || !incy || !alpha || !beta || !A || !x || !y)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        hipStream_t     stream;
+        int64_t*        first_tile;
+        hipblasStatus_t status = hipblasGetStream(handle, &stream);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblas_workspace_carve(handle, first_tile, size_t(batch_count) + 1);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        return launch_status(hipblas_gemv_vbatched(stream,
+                                                   trans,
+                                                   m,
+                                                   n,
+                                                   alpha,
+                                                   beta,
+                                                   h->pointer_mode == HIPBLAS_POINTER_MODE_DEVICE,
+                                                   hipblas_scalar_stride(handle),
+                                                   A,
+                                                   lda,
+                                                   x,
+                                                   incx,
+                                                   y,
+                                                   incy,
+                                                   batch_count,
+                                                   first_tile));
+    }
+
+    template <typename T>
+    hipblasStatus_t trsv_vbatched(hipblasHandle_t    handle,
+                                  hipblasFillMode_t  uplo,
+                                  hipblasOperation_t transA,
+                                  hipblasDiagType_t  diag,
+                                  const int*         n,
+                                  const T* const*    A,
+                                  const int*         lda,
+                                  T* const*          x,
+                                  const int*         incx,
+                                  int                batch_count)
+    {
+        if(handle == nullptr)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if((uplo != HIPBLAS_FILL_MODE_UPPER && uplo != HIPBLAS_FILL_MODE_LOWER)
+           || !valid_operation(transA)
+           || (diag != HIPBLAS_DIAG_NON_UNIT && diag != HIPBLAS_DIAG_UNIT))
+            return HIPBLAS_STATUS_INVALID_ENUM;
+        if(batch_count < 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(batch_count == 0)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(!n || !lda || !incx || !A || !x)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        hipStream_t     stream;
+        int*            next_entry;
+        hipblasStatus_t status = hipblasGetStream(handle, &stream);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblas_workspace_carve(handle, next_entry, 1);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        return launch_status(hipblas_trsv_vbatched(
+            stream, uplo, transA, diag, n, A, lda, x, incx, batch_count, next_entry));
+    }
+
+    // A batch's largest-first order and the counter its blocks take entries from
+    hipblasStatus_t
+        schedule_workspace(hipblasHandle_t handle, int batch_count, int*& order, int*& next_entry)
+    {
+        return hipblas_workspace_carve(handle, order, size_t(batch_count), next_entry, 1);
+    }
+
+    template <typename T>
+    hipblasStatus_t getrf_vbatched(hipblasHandle_t handle,
+                                   const int*      n,
+                                   T* const*       A,
+                                   const int*      lda,
+                                   int* const*     ipiv,
+                                   int*            info,
+                                   int             batch_count)
+    {
+        if(handle == nullptr)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if(batch_count < 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(batch_count == 0)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(!n || !lda || !A || !ipiv || !info)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        hipStream_t     stream;
+        int*            order;
+        int*            next_entry;
+        hipblasStatus_t status = hipblasGetStream(handle, &stream);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = schedule_workspace(handle, batch_count, order, next_entry);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        return launch_status(hipblas_getrf_vbatched(
+            stream, n, A, lda, ipiv, info, batch_count, order, next_entry));
+    }
+
+    // info numbers the arguments from trans as getrs does; the sizes are on the device, so only
+    // what the host can see is checked
+    template <typename T>
+    hipblasStatus_t getrs_vbatched(hipblasHandle_t    handle,
+                                   hipblasOperation_t trans,
+                                   const int*         n,
+                                   const int*         nrhs,
+                                   const T* const*    A,
+                                   const int*         lda,
+                                   const int* const*  ipiv,
+                                   T* const*          B,
+                                   const int*         ldb,
+                                   int*               info,
+                                   int                batch_count)
+    {
+        if(handle == nullptr)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if(info == nullptr)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        else if(!valid_operation(trans))
+            *info = -1;
+        else if(!n)
+            *info = -2;
+        else if(!nrhs)
+            *info = -3;
+        else if(!A)
+            *info = -4;
+        else if(!lda)
+            *info = -5;
+        else if(!ipiv)
+            *info = -6;
+        else if(!B)
+            *info = -7;
+        else if(!ldb)
+            *info = -8;
+        else if(batch_count < 0)
+            *info = -10;
+        else
+            *info = 0;
+        if(*info != 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(batch_count == 0)
+            return HIPBLAS_STATUS_SUCCESS;
+
+        hipStream_t     stream;
+        int*            order;
+        int*            next_entry;
+        hipblasStatus_t status = hipblasGetStream(handle, &stream);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = schedule_workspace(handle, batch_count, order, next_entry);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        return launch_status(hipblas_getrs_vbatched(
+            stream, trans, n, nrhs, A, lda, ipiv, B, ldb, batch_count, order, next_entry));
+    }
+
+    template <typename T>
+    hipblasStatus_t trsm_vbatched(hipblasHandle_t    handle,
+                                  hipblasSideMode_t  side,
+                                  hipblasFillMode_t  uplo,
+                                  hipblasOperation_t transA,
+                                  hipblasDiagType_t  diag,
+                                  const int*         m,
+                                  const int*         n,
+                                  const T*           alpha,
+                                  const T* const*    A,
+                                  const int*         lda,
+                                  T* const*          B,
+                                  const int*         ldb,
+                                  int                batch_count)
+    {
+        hipblas_handle* h = static_cast<hipblas_handle*>(handle);
+        if(h == nullptr)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if((side != HIPBLAS_SIDE_LEFT && side != HIPBLAS_SIDE_RIGHT)
+           || (uplo != HIPBLAS_FILL_MODE_UPPER && uplo != HIPBLAS_FILL_MODE_LOWER)
+           || !valid_operation(transA)
+           || (diag != HIPBLAS_DIAG_NON_UNIT && diag != HIPBLAS_DIAG_UNIT))
+            return HIPBLAS_STATUS_INVALID_ENUM;
+        if(batch_count < 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(batch_count == 0)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(!m || !n || !lda || !ldb || !alpha || !A || !B)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        hipStream_t     stream;
+        int*            order;
+        int*            next_entry;
+        hipblasStatus_t status = hipblasGetStream(handle, &stream);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = schedule_workspace(handle, batch_count, order, next_entry);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        return launch_status(hipblas_trsm_vbatched(stream,
+                                                   side,
+                                                   uplo,
+                                                   transA,
+                                                   diag,
+                                                   m,
+                                                   n,
+                                                   alpha,
+                                                   h->pointer_mode == HIPBLAS_POINTER_MODE_DEVICE,
+                                                   hipblas_scalar_stride(handle),
+                                                   A,
+                                                   lda,
+                                                   B,
+                                                   ldb,
+                                                   batch_count,
+                                                   order,
+                                                   next_entry));
+    }
+
+    // The pointer arrays, the sizes and the norms stay on the device, as for gemv_vbatched
+    template <typename T, typename Tr>
+    hipblasStatus_t nrm2_vbatched(hipblasHandle_t handle,
+                                  const int*      n,
+                                  const T* const* x,
+                                  const int*      incx,
+                                  int             batch_count,
+                                  Tr*             norms,
+                                  Tr*             result)
+    {
+        if(handle == nullptr)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if(batch_count < 0)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(batch_count == 0)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(!n || !x || !incx || !result)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        hipStream_t     stream;
+        int64_t*        first_chunk;
+        Tr*             part;
+        int*            done;
+        hipblasStatus_t status = hipblasGetStream(handle, &stream);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = hipblas_workspace_carve(handle,
+                                             first_chunk,
+                                             size_t(batch_count) + 2,
+                                             part,
+                                             size_t(hipblas_nrm2_vbatched_work_size(batch_count)),
+                                             done,
+                                             1);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        return launch_status(hipblas_nrm2_vbatched(
+            stream, n, x, incx, batch_count, norms, result, first_chunk, part, done));
+    }
+}
+
+hipblasStatus_t hipblasSgemvVbatched(hipblasHandle_t    handle,
+                                     hipblasOperation_t trans,
+                                     const int          m[],
+                                     const int          n[],
+                                     const float*       alpha,
+                                     const float* const A[],
+                                     const int          lda[],
+                                     const float* const x[],
+                                     const int          incx[],
+                                     const float*       beta,
+                                     float* const       y[],
+                                     const int          incy[],
+                                     int                batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, trans, m, n, alpha, A, lda, x, incx, beta, y, incy, batch_count);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, A, x, y);
+    return gemv_vbatched(handle, trans, m, n, alpha, A, lda, x, incx, beta, y, incy, batch_count);
+}
+
+hipblasStatus_t hipblasDgemvVbatched(hipblasHandle_t     handle,
+                                     hipblasOperation_t  trans,
+                                     const int           m[],
+                                     const int           n[],
+                                     const double*       alpha,
+                                     const double* const A[],
+                                     const int           lda[],
+                                     const double* const x[],
+                                     const int           incx[],
+                                     const double*       beta,
+                                     double* const       y[],
+                                     const int           incy[],
+                                     int                 batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, trans, m, n, alpha, A, lda, x, incx, beta, y, incy, batch_count);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, A, x, y);
+    return gemv_vbatched(handle, trans, m, n, alpha, A, lda, x, incx, beta, y, incy, batch_count);
+}
+
+hipblasStatus_t hipblasCgemvVbatched(hipblasHandle_t             handle,
+                                     hipblasOperation_t          trans,
+                                     const int                   m[],
+                                     const int                   n[],
+                                     const hipblasComplex*       alpha,
+                                     const hipblasComplex* const A[],
+                                     const int                   lda[],
+                                     const hipblasComplex* const x[],
+                                     const int                   incx[],
+                                     const hipblasComplex*       beta,
+                                     hipblasComplex* const       y[],
+                                     const int                   incy[],
+                                     int                         batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, trans, m, n, alpha, A, lda, x, incx, beta, y, incy, batch_count);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, A, x, y);
+    return gemv_vbatched(handle, trans, m, n, alpha, A, lda, x, incx, beta, y, incy, batch_count);
+}
+
+hipblasStatus_t hipblasZgemvVbatched(hipblasHandle_t                   handle,
+                                     hipblasOperation_t                trans,
+                                     const int                         m[],
+                                     const int                         n[],
+                                     const hipblasDoubleComplex*       alpha,
+                                     const hipblasDoubleComplex* const A[],
+                                     const int                         lda[],
+                                     const hipblasDoubleComplex* const x[],
+                                     const int                         incx[],
+                                     const hipblasDoubleComplex*       beta,
+                                     hipblasDoubleComplex* const       y[],
+                                     const int                         incy[],
+                                     int                               batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, trans, m, n, alpha, A, lda, x, incx, beta, y, incy, batch_count);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, A, x, y);
+    return gemv_vbatched(handle, trans, m, n, alpha, A, lda, x, incx, beta, y, incy, batch_count);
+}
+
+hipblasStatus_t hipblasStrsvVbatched(hipblasHandle_t    handle,
+                                     hipblasFillMode_t  uplo,
+                                     hipblasOperation_t transA,
+                                     hipblasDiagType_t  diag,
+                                     const int          n[],
+                                     const float* const A[],
+                                     const int          lda[],
+                                     float* const       x[],
+                                     const int          incx[],
+                                     int                batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, n, A, lda, x, incx, batch_count);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, A, x);
+    return trsv_vbatched(handle, uplo, transA, diag, n, A, lda, x, incx, batch_count);
+}
+
+hipblasStatus_t hipblasDtrsvVbatched(hipblasHandle_t     handle,
+                                     hipblasFillMode_t   uplo,
+                                     hipblasOperation_t  transA,
+                                     hipblasDiagType_t   diag,
+                                     const int           n[],
+                                     const double* const A[],
+                                     const int           lda[],
+                                     double* const       x[],
+                                     const int           incx[],
+                                     int                 batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, n, A, lda, x, incx, batch_count);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, A, x);
+    return trsv_vbatched(handle, uplo, transA, diag, n, A, lda, x, incx, batch_count);
+}
+
+hipblasStatus_t hipblasCtrsvVbatched(hipblasHandle_t             handle,
+                                     hipblasFillMode_t           uplo,
+                                     hipblasOperation_t          transA,
+                                     hipblasDiagType_t           diag,
+                                     const int                   n[],
+                                     const hipblasComplex* const A[],
+                                     const int                   lda[],
+                                     hipblasComplex* const       x[],
+                                     const int                   incx[],
+                                     int                         batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, n, A, lda, x, incx, batch_count);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, A, x);
+    return trsv_vbatched(handle, uplo, transA, diag, n, A, lda, x, incx, batch_count);
+}
+
+hipblasStatus_t hipblasZtrsvVbatched(hipblasHandle_t                   handle,
+                                     hipblasFillMode_t                 uplo,
+                                     hipblasOperation_t                transA,
+                                     hipblasDiagType_t                 diag,
+                                     const int                         n[],
+                                     const hipblasDoubleComplex* const A[],
+                                     const int                         lda[],
+                                     hipblasDoubleComplex* const       x[],
+                                     const int                         incx[],
+                                     int                               batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, uplo, transA, diag, n, A, lda, x, incx, batch_count);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, A, x);
+    return trsv_vbatched(handle, uplo, transA, diag, n, A, lda, x, incx, batch_count);
+}
+
+hipblasStatus_t hipblasSgetrfVbatched(hipblasHandle_t handle,
+                                      const int       n[],
+                                      float* const    A[],
+                                      const int       lda[],
+                                      int* const      ipiv[],
+                                      int             info[],
+                                      int             batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, n, A, lda, ipiv, info, batch_count);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, A, ipiv);
+    return getrf_vbatched(handle, n, A, lda, ipiv, info, batch_count);
+}
+
+hipblasStatus_t hipblasDgetrfVbatched(hipblasHandle_t handle,
+                                      const int       n[],
+                                      double* const   A[],
+                                      const int       lda[],
+                                      int* const      ipiv[],
+                                      int             info[],
+                                      int             batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, n, A, lda, ipiv, info, batch_count);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, A, ipiv);
+    return getrf_vbatched(handle, n, A, lda, ipiv, info, batch_count);
+}
+
+hipblasStatus_t hipblasCgetrfVbatched(hipblasHandle_t       handle,
+                                      const int             n[],
+                                      hipblasComplex* const A[],
+                                      const int             lda[],
+                                      int* const            ipiv[],
+                                      int                   info[],
+                                      int                   batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, n, A, lda, ipiv, info, batch_count);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, A, ipiv);
+    return getrf_vbatched(handle, n, A, lda, ipiv, info, batch_count);
+}
+
+hipblasStatus_t hipblasZgetrfVbatched(hipblasHandle_t             handle,
+                                      const int                   n[],
+                                      hipblasDoubleComplex* const A[],
+                                      const int                   lda[],
+                                      int* const                  ipiv[],
+                                      int                         info[],
+                                      int                         batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, n, A, lda, ipiv, info, batch_count);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, A, ipiv);
+    return getrf_vbatched(handle, n, A, lda, ipiv, info, batch_count);
+}
+
+hipblasStatus_t hipblasSgetrsVbatched(hipblasHandle_t    handle,
+                                      hipblasOperation_t trans,
+                                      const int          n[],
+                                      const int          nrhs[],
+                                      const float* const A[],
+                                      const int          lda[],
+                                      const int* const   ipiv[],
+                                      float* const       B[],
+                                      const int          ldb[],
+                                      int*               info,
+                                      int                batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, info, batch_count);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, A, ipiv, B);
+    return getrs_vbatched(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, info, batch_count);
+}
+
+hipblasStatus_t hipblasDgetrsVbatched(hipblasHandle_t     handle,
+                                      hipblasOperation_t  trans,
+                                      const int           n[],
+                                      const int           nrhs[],
+                                      const double* const A[],
+                                      const int           lda[],
+                                      const int* const    ipiv[],
+                                      double* const       B[],
+                                      const int           ldb[],
+                                      int*                info,
+                                      int                 batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, info, batch_count);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, A, ipiv, B);
+    return getrs_vbatched(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, info, batch_count);
+}
+
+hipblasStatus_t hipblasCgetrsVbatched(hipblasHandle_t             handle,
+                                      hipblasOperation_t          trans,
+                                      const int                   n[],
+                                      const int                   nrhs[],
+                                      const hipblasComplex* const A[],
+                                      const int                   lda[],
+                                      const int* const            ipiv[],
+                                      hipblasComplex* const       B[],
+                                      const int                   ldb[],
+                                      int*                        info,
+                                      int                         batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, info, batch_count);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, A, ipiv, B);
+    return getrs_vbatched(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, info, batch_count);
+}
+
+hipblasStatus_t hipblasZgetrsVbatched(hipblasHandle_t                   handle,
+                                      hipblasOperation_t                trans,
+                                      const int                         n[],
+                                      const int                         nrhs[],
+                                      const hipblasDoubleComplex* const A[],
+                                      const int                         lda[],
+                                      const int* const                  ipiv[],
+                                      hipblasDoubleComplex* const       B[],
+                                      const int                         ldb[],
+                                      int*                              info,
+                                      int                               batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, info, batch_count);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, A, ipiv, B);
+    return getrs_vbatched(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, info, batch_count);
+}
+
+hipblasStatus_t hipblasStrsmVbatched(hipblasHandle_t    handle,
+                                     hipblasSideMode_t  side,
+                                     hipblasFillMode_t  uplo,
+                                     hipblasOperation_t transA,
+                                     hipblasDiagType_t  diag,
+                                     const int          m[],
+                                     const int          n[],
+                                     const float*       alpha,
+                                     const float* const A[],
+                                     const int          lda[],
+                                     float* const       B[],
+                                     const int          ldb[],
+                                     int                batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb, batch_count);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, A, B);
+    return trsm_vbatched(handle,
+                         side,
+                         uplo,
+                         transA,
+                         diag,
+                         m,
+                         n,
+                         alpha,
+                         A,
+                         lda,
+                         B,
+                         ldb,
+                         batch_count);
+}
+
+hipblasStatus_t hipblasDtrsmVbatched(hipblasHandle_t     handle,
+                                     hipblasSideMode_t   side,
+                                     hipblasFillMode_t   uplo,
+                                     hipblasOperation_t  transA,
+                                     hipblasDiagType_t   diag,
+                                     const int           m[],
+                                     const int           n[],
+                                     const double*       alpha,
+                                     const double* const A[],
+                                     const int           lda[],
+                                     double* const       B[],
+                                     const int           ldb[],
+                                     int                 batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb, batch_count);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, A, B);
+    return trsm_vbatched(handle,
+                         side,
+                         uplo,
+                         transA,
+                         diag,
+                         m,
+                         n,
+                         alpha,
+                         A,
+                         lda,
+                         B,
+                         ldb,
+                         batch_count);
+}
+
+hipblasStatus_t hipblasCtrsmVbatched(hipblasHandle_t             handle,
+                                     hipblasSideMode_t           side,
+                                     hipblasFillMode_t           uplo,
+                                     hipblasOperation_t          transA,
+                                     hipblasDiagType_t           diag,
+                                     const int                   m[],
+                                     const int                   n[],
+                                     const hipblasComplex*       alpha,
+                                     const hipblasComplex* const A[],
+                                     const int                   lda[],
+                                     hipblasComplex* const       B[],
+                                     const int                   ldb[],
+                                     int                         batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb, batch_count);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, A, B);
+    return trsm_vbatched(handle,
+                         side,
+                         uplo,
+                         transA,
+                         diag,
+                         m,
+                         n,
+                         alpha,
+                         A,
+                         lda,
+                         B,
+                         ldb,
+                         batch_count);
+}
+
+hipblasStatus_t hipblasZtrsmVbatched(hipblasHandle_t                   handle,
+                                     hipblasSideMode_t                 side,
+                                     hipblasFillMode_t                 uplo,
+                                     hipblasOperation_t                transA,
+                                     hipblasDiagType_t                 diag,
+                                     const int                         m[],
+                                     const int                         n[],
+                                     const hipblasDoubleComplex*       alpha,
+                                     const hipblasDoubleComplex* const A[],
+                                     const int                         lda[],
+                                     hipblasDoubleComplex* const       B[],
+                                     const int                         ldb[],
+                                     int                               batch_count)
+{
+    HIPBLAS_LOG_CALL(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb, batch_count);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, A, B);
+    return trsm_vbatched(handle,
+                         side,
+                         uplo,
+                         transA,
+                         diag,
+                         m,
+                         n,
+                         alpha,
+                         A,
+                         lda,
+                         B,
+                         ldb,
+                         batch_count);
+}
+
+hipblasStatus_t hipblasSnrm2Vbatched(hipblasHandle_t    handle,
+                                     const int          n[],
+                                     const float* const x[],
+                                     const int          incx[],
+                                     int                batch_count,
+                                     float*             norms,
+                                     float*             result)
+{
+    HIPBLAS_LOG_CALL(handle, n, x, incx, batch_count, norms, result);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, x);
+    return nrm2_vbatched(handle, n, x, incx, batch_count, norms, result);
+}
+
+hipblasStatus_t hipblasDnrm2Vbatched(hipblasHandle_t     handle,
+                                     const int           n[],
+                                     const double* const x[],
+                                     const int           incx[],
+                                     int                 batch_count,
+                                     double*             norms,
+                                     double*             result)
+{
+    HIPBLAS_LOG_CALL(handle, n, x, incx, batch_count, norms, result);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, x);
+    return nrm2_vbatched(handle, n, x, incx, batch_count, norms, result);
+}
+
+hipblasStatus_t hipblasScnrm2Vbatched(hipblasHandle_t             handle,
+                                      const int                   n[],
+                                      const hipblasComplex* const x[],
+                                      const int                   incx[],
+                                      int                         batch_count,
+                                      float*                      norms,
+                                      float*                      result)
+{
+    HIPBLAS_LOG_CALL(handle, n, x, incx, batch_count, norms, result);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, x);
+    return nrm2_vbatched(handle, n, x, incx, batch_count, norms, result);
+}
+
+hipblasStatus_t hipblasDznrm2Vbatched(hipblasHandle_t                   handle,
+                                      const int                         n[],
+                                      const hipblasDoubleComplex* const x[],
+                                      const int                         incx[],
+                                      int                               batch_count,
+                                      double*                           norms,
+                                      double*                           result)
+{
+    HIPBLAS_LOG_CALL(handle, n, x, incx, batch_count, norms, result);
+    HIPBLAS_STAGE_POINTER_ARRAYS(handle, batch_count, x);
+    return nrm2_vbatched(handle, n, x, incx, batch_count, norms, result);
+}
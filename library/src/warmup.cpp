@@ -0,0 +1,188 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipblas_handle.h"
+#include "hipblas_logging.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <hip/hip_runtime_api.h>
+#include <new>
+#include <vector>
+
+namespace
+{
+    // Host scalar holding one in the compute type; real part only for complex types
+    void set_one(hipblasDatatype_t type, unsigned char (&value)[16])
+    {
+        std::memset(value, 0, sizeof(value));
+        switch(type)
+        {
+        case HIPBLAS_R_16F:
+        case HIPBLAS_C_16F:
+        {
+            uint16_t one = 0x3C00;
+            std::memcpy(value, &one, sizeof(one));
+            break;
+        }
+        case HIPBLAS_R_16B:
+        case HIPBLAS_C_16B:
+        {
+            uint16_t one = 0x3F80;
+            std::memcpy(value, &one, sizeof(one));
+            break;
+        }
+        case HIPBLAS_R_32F:
+        case HIPBLAS_C_32F:
+        {
+            float one = 1;
+            std::memcpy(value, &one, sizeof(one));
+            break;
+        }
+        case HIPBLAS_R_64F:
+        case HIPBLAS_C_64F:
+        {
+            double one = 1;
+            std::memcpy(value, &one, sizeof(one));
+            break;
+        }
+        case HIPBLAS_R_32I:
+        case HIPBLAS_R_32U:
+        {
+            int32_t one = 1;
+            std::memcpy(value, &one, sizeof(one));
+            break;
+        }
+        default:
+            value[0] = 1;
+            break;
+        }
+    }
+
+    struct operand_bytes
+    {
+        size_t a, b, c;
+    };
+
+    bool shape_bytes(const hipblasGemmShape_t& s, operand_bytes& bytes)
+    {
+        if(s.m < 0 || s.n < 0 || s.k < 0 || hipblas_datatype_size(s.a_type) == 0
+           || hipblas_datatype_size(s.b_type) == 0 || hipblas_datatype_size(s.c_type) == 0
+           || hipblas_datatype_size(s.compute_type) == 0)
+            return false;
+        bytes.a = size_t(s.m) * s.k * hipblas_datatype_size(s.a_type);
+        bytes.b = size_t(s.k) * s.n * hipblas_datatype_size(s.b_type);
+        bytes.c = size_t(s.m) * s.n * hipblas_datatype_size(s.c_type);
+        return true;
+    }
+}
+
+hipblasStatus_t
+    hipblasWarmup(hipblasHandle_t handle, const hipblasGemmShape_t* shapes, int count)
+{
+    HIPBLAS_LOG_CALL(handle, shapes, count);
+    hipblas_handle* h = static_cast<hipblas_handle*>(handle);
+    if(h == nullptr)
+        return HIPBLAS_STATUS_NOT_INITIALIZED;
+    if(count < 0 || (count > 0 && shapes == nullptr))
+        return HIPBLAS_STATUS_INVALID_VALUE;
+    if(h->capture_mode == HIPBLAS_CAPTURE_MODE_SAFE)
+        return HIPBLAS_STATUS_NOT_SUPPORTED;
+
+    operand_bytes largest = {0, 0, 0};
+    for(int i = 0; i < count; i++)
+    {
+        operand_bytes bytes;
+        if(!shape_bytes(shapes[i], bytes))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        largest.a = std::max(largest.a, bytes.a);
+        largest.b = std::max(largest.b, bytes.b);
+        largest.c = std::max(largest.c, bytes.c);
+    }
+    if(count == 0)
+        return HIPBLAS_STATUS_SUCCESS;
+
+    hipStream_t stream;
+    hipblasStatus_t status = hipblasGetStream(handle, &stream);
+    if(status != HIPBLAS_STATUS_SUCCESS)
+        return status;
+
+    // Zeroed operands: the results are thrown away, but must not trap on NaN inputs
+    void* dA = nullptr;
+    void* dB = nullptr;
+    void* dC = nullptr;
+    if(hipMalloc(&dA, std::max<size_t>(largest.a, 1)) != hipSuccess
+       || hipMalloc(&dB, std::max<size_t>(largest.b, 1)) != hipSuccess
+       || hipMalloc(&dC, std::max<size_t>(largest.c, 1)) != hipSuccess)
+        status = HIPBLAS_STATUS_ALLOC_FAILED;
+    else if(hipMemsetAsync(dA, 0, largest.a, stream) != hipSuccess
+            || hipMemsetAsync(dB, 0, largest.b, stream) != hipSuccess)
+        status = HIPBLAS_STATUS_INTERNAL_ERROR;
+
+    hipblasPointerMode_t mode = h->pointer_mode;
+    if(status == HIPBLAS_STATUS_SUCCESS && mode != HIPBLAS_POINTER_MODE_HOST)
+        status = hipblasSetPointerMode(handle, HIPBLAS_POINTER_MODE_HOST);
+
+    // alpha = 1 and beta = 0, since alpha = 0 lets the backend return before any kernel loads
+    for(int i = 0; i < count && status == HIPBLAS_STATUS_SUCCESS; i++)
+    {
+        const hipblasGemmShape_t& s = shapes[i];
+        unsigned char             alpha[16], beta[16] = {};
+        set_one(s.compute_type, alpha);
+
+        int lda = std::max(1, s.transA == HIPBLAS_OP_N ? s.m : s.k);
+        int ldb = std::max(1, s.transB == HIPBLAS_OP_N ? s.k : s.n);
+        int ldc = std::max(1, s.m);
+        status  = hipblasGemmEx(handle,
+                               s.transA,
+                               s.transB,
+                               s.m,
+                               s.n,
+                               s.k,
+                               alpha,
+                               dA,
+                               s.a_type,
+                               lda,
+                               dB,
+                               s.b_type,
+                               ldb,
+                               beta,
+                               dC,
+                               s.c_type,
+                               ldc,
+                               s.compute_type,
+                               HIPBLAS_GEMM_DEFAULT);
+    }
+
+    if(mode != h->pointer_mode)
+        (void)hipblasSetPointerMode(handle, mode);
+    if(hipStreamSynchronize(stream) != hipSuccess && status == HIPBLAS_STATUS_SUCCESS)
+        status = HIPBLAS_STATUS_INTERNAL_ERROR;
+    (void)hipFree(dA);
+    (void)hipFree(dB);
+    (void)hipFree(dC);
+    return status;
+}
+
+void hipblas_warmup_from_environment(hipblasHandle_t handle)
+{
+    const hipblas_handle* h   = static_cast<const hipblas_handle*>(handle);
+    const char*           env = std::getenv("HIPBLAS_WARMUP");
+    if(!h->gemm_tuning || env == nullptr || std::atoi(env) == 0)
+        return;
+
+    // Best effort: a shape the backend rejects, or no memory for the list, must not fail
+    // hipblasCreate
+    std::vector<hipblasGemmShape_t> shapes;
+    try
+    {
+        shapes = h->gemm_tuning->shapes();
+    }
+    catch(const std::bad_alloc&)
+    {
+        return;
+    }
+    (void)hipblasWarmup(handle, shapes.data(), int(shapes.size()));
+}
@@ -0,0 +1,873 @@
+/* ************************************************************************
+ * Copyright 2020 Advanced Micro Devices, Inc.
+ * ************************************************************************ */
+
+#include "hipblas.h"
+#include "hipblas_handle.h"
+#include "hipblas_logging.h"
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <hip/hip_runtime_api.h>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace
+{
+    using lane = hipblas_tile_pipeline::lane;
+    using tile = hipblas_tile_pipeline::tile;
+
+    constexpr int LANES = hipblas_tile_pipeline::LANES;
+
+    // A rows x cols block of a host matrix
+    template <typename T>
+    struct host_block
+    {
+        T*      ptr;
+        int64_t ld;
+        int     rows;
+        int     cols;
+    };
+
+    // One tile of C, updated by steps device calls; a syrk tile on the diagonal is always loaded,
+    // so that writing it back keeps the triangle syrk leaves alone
+    struct c_tile
+    {
+        int64_t row;
+        int64_t col;
+        int     rows;
+        int     cols;
+        bool    diagonal;
+        int     steps;
+    };
+
+    // Tiles that must run in order, each reading the ones before it once they are back in C
+    using chain = std::vector<c_tile>;
+
+    hipblasStatus_t copy_status(hipError_t err)
+    {
+        return err == hipSuccess ? HIPBLAS_STATUS_SUCCESS : HIPBLAS_STATUS_INTERNAL_ERROR;
+    }
+
+    template <typename T>
+    bool is_zero(const T& a)
+    {
+        return a == T(0);
+    }
+
+    // Waits until the work that last used the tile has run
+    hipblasStatus_t acquire(tile& t)
+    {
+        if(t.pending && hipEventSynchronize(t.done) != hipSuccess)
+            return HIPBLAS_STATUS_INTERNAL_ERROR;
+        t.pending = false;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    hipblasStatus_t release(tile& t, hipStream_t stream)
+    {
+        t.pending = true;
+        return copy_status(hipEventRecord(t.done, stream));
+    }
+
+    // Packs a block into the tile's pinned buffer, column by column, and queues its upload
+    template <typename T>
+    hipblasStatus_t upload(tile& t, host_block<const T> src, hipStream_t stream)
+    {
+        T* dst = static_cast<T*>(t.host);
+        for(int j = 0; j < src.cols; j++)
+            std::memcpy(dst + size_t(j) * src.rows, src.ptr + j * src.ld, sizeof(T) * src.rows);
+        return copy_status(hipMemcpyAsync(t.device,
+                                          t.host,
+                                          sizeof(T) * src.rows * src.cols,
+                                          hipMemcpyHostToDevice,
+                                          stream));
+    }
+
+    // Copies the lane's last downloaded tile, if any, back into C
+    template <typename T>
+    hipblasStatus_t retire(lane& l, const c_tile*& done, T* C, int64_t ldc)
+    {
+        if(done == nullptr)
+            return HIPBLAS_STATUS_SUCCESS;
+
+        hipblasStatus_t status = acquire(l.c);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+        {
+            const T* src = static_cast<const T*>(l.c.host);
+            T*       dst = C + done->row + done->col * ldc;
+            for(int j = 0; j < done->cols; j++)
+                std::memcpy(dst + j * ldc, src + size_t(j) * done->rows, sizeof(T) * done->rows);
+        }
+        done = nullptr;
+        return status;
+    }
+
+    // Queues tile c on lane l: its block of C is uploaded if it is read, each step packs and
+    // uploads its operands into the lane's next operand set and queues the device call, and the
+    // result is downloaded
+    template <typename T, typename Operands, typename Step>
+    hipblasStatus_t run_tile(lane&         l,
+                             const c_tile& c,
+                             bool          load_c,
+                             T*            C,
+                             int64_t       ldc,
+                             Operands&     operands,
+                             Step&         step)
+    {
+        hipblasStatus_t     status = HIPBLAS_STATUS_SUCCESS;
+        host_block<const T> c_block{C + c.row + c.col * ldc, ldc, c.rows, c.cols};
+        if(load_c || c.diagonal)
+            status = upload(l.c, c_block, l.stream);
+
+        for(int s = 0; s < c.steps && status == HIPBLAS_STATUS_SUCCESS; s++)
+        {
+            tile& a = l.a[l.next];
+            tile& b = l.b[l.next];
+            l.next ^= 1;
+
+            host_block<const T> a_block, b_block;
+            operands(c, s, a_block, b_block);
+
+            status = acquire(a);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = acquire(b);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = upload(a, a_block, l.stream);
+            if(status == HIPBLAS_STATUS_SUCCESS && b_block.ptr)
+                status = upload(b, b_block, l.stream);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = step(l.handle,
+                              c,
+                              s,
+                              static_cast<const T*>(a.device),
+                              a_block.rows,
+                              static_cast<const T*>(b.device),
+                              b_block.rows,
+                              static_cast<T*>(l.c.device));
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = release(a, l.stream);
+            if(status == HIPBLAS_STATUS_SUCCESS)
+                status = release(b, l.stream);
+        }
+
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = copy_status(hipMemcpyAsync(l.c.host,
+                                                l.c.device,
+                                                sizeof(T) * c.rows * c.cols,
+                                                hipMemcpyDeviceToHost,
+                                                l.stream));
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = release(l.c, l.stream);
+        return status;
+    }
+
+    // The work shared by the devices of one call
+    struct chain_queue
+    {
+        const std::vector<chain>& chains;
+        std::atomic<size_t>       next{0};
+        std::atomic<bool>         failed{false};
+    };
+
+    // Feeds one device's lanes, lanes[0] to lanes[LANES - 1], from the queue. A lane takes the
+    // next chain once it has finished its own, so faster devices take more chains. The lanes are
+    // visited in turn and the host copies a result into C only when its lane comes round again,
+    // so packing the next tiles overlaps the transfers and device calls still queued
+    template <typename T, typename Operands, typename Step>
+    hipblasStatus_t run_device(lane*        lanes,
+                               chain_queue& queue,
+                               bool         load_c,
+                               T*           C,
+                               int64_t      ldc,
+                               Operands&    operands,
+                               Step&        step)
+    {
+        struct cursor
+        {
+            const chain*  work    = nullptr;
+            size_t        next    = 0;
+            const c_tile* pending = nullptr;
+        } cursors[LANES];
+
+        hipblasStatus_t status = copy_status(hipSetDevice(lanes[0].device));
+        for(bool queued = true; queued && status == HIPBLAS_STATUS_SUCCESS && !queue.failed;)
+        {
+            queued = false;
+            for(int index = 0; index < LANES && status == HIPBLAS_STATUS_SUCCESS; index++)
+            {
+                lane&   l   = lanes[index];
+                cursor& cur = cursors[index];
+
+                status = retire(l, cur.pending, C, ldc);
+                if(status != HIPBLAS_STATUS_SUCCESS)
+                    break;
+                if(cur.work == nullptr || cur.next == cur.work->size())
+                {
+                    size_t taken = queue.next++;
+                    cur.work     = taken < queue.chains.size() ? &queue.chains[taken] : nullptr;
+                    cur.next     = 0;
+                    if(cur.work == nullptr)
+                        continue;
+                }
+
+                const c_tile& c = (*cur.work)[cur.next++];
+                status          = run_tile(l, c, load_c, C, ldc, operands, step);
+                if(status == HIPBLAS_STATUS_SUCCESS)
+                    cur.pending = &c;
+                queued = true;
+            }
+        }
+
+        // After a failure the lanes are only drained, so C is left partly updated
+        if(status != HIPBLAS_STATUS_SUCCESS || queue.failed)
+        {
+            queue.failed = true;
+            for(int index = 0; index < LANES; index++)
+                (void)hipStreamSynchronize(lanes[index].stream);
+        }
+        return status;
+    }
+
+    // Runs the chains on the lanes of every selected device, each device fed by its own thread.
+    //
+    // operands(c, s, a, b) names the host blocks step s of tile c reads, b.ptr == nullptr for
+    // none; step(handle, c, s, dA, ldA, dB, ldB, dC) queues the device work on the lane's handle.
+    template <typename T, typename Operands, typename Step>
+    hipblasStatus_t run_tiles(hipblasHandle_t           handle,
+                              const std::vector<chain>& chains,
+                              bool                      load_c,
+                              T*                        C,
+                              int64_t                   ldc,
+                              Operands                  operands,
+                              Step                      step)
+    {
+        hipblas_handle*        h        = static_cast<hipblas_handle*>(handle);
+        hipblas_tile_pipeline& pipeline = h->xt_pipeline;
+
+        // The host matrices may be the destination of copies the caller queued before this call
+        int             device;
+        hipStream_t     stream;
+        hipblasStatus_t status = hipblasGetStream(handle, &stream);
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = copy_status(hipStreamSynchronize(stream));
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = copy_status(hipGetDevice(&device));
+        if(status == HIPBLAS_STATUS_SUCCESS)
+            status = pipeline.reserve(device, sizeof(T) * h->xt_block_dim * h->xt_block_dim);
+        if(status != HIPBLAS_STATUS_SUCCESS)
+            return status;
+
+        for(lane& l : pipeline.lanes)
+            static_cast<hipblas_handle*>(l.handle)->math_mode = h->math_mode;
+
+        chain_queue                  queue{chains};
+        size_t                       devices = pipeline.lanes.size() / LANES;
+        std::vector<hipblasStatus_t> results(devices, HIPBLAS_STATUS_SUCCESS);
+        std::vector<std::thread>     workers;
+        for(size_t d = 1; d < devices; d++)
+            workers.emplace_back([&, d] {
+                results[d] = run_device(
+                    &pipeline.lanes[d * LANES], queue, load_c, C, ldc, operands, step);
+            });
+        results[0] = run_device(&pipeline.lanes[0], queue, load_c, C, ldc, operands, step);
+        for(std::thread& worker : workers)
+            worker.join();
+
+        (void)hipSetDevice(device);
+        for(hipblasStatus_t result : results)
+            if(result != HIPBLAS_STATUS_SUCCESS)
+                return result;
+        return HIPBLAS_STATUS_SUCCESS;
+    }
+
+    // C = beta C over rows rows(j).first to rows(j).second of each column, for the calls that
+    // never reach the device
+    template <typename T, typename Rows>
+    void scale_host(T* C, int64_t ldc, int64_t n, const T& beta, Rows rows)
+    {
+        if(beta == T(1))
+            return;
+        for(int64_t j = 0; j < n; j++)
+            for(int64_t i = rows(j).first; i < rows(j).second; i++)
+                C[i + j * ldc] = is_zero(beta) ? T(0) : beta * C[i + j * ldc];
+    }
+
+    bool valid_operation(hipblasOperation_t trans)
+    {
+        return trans == HIPBLAS_OP_N || trans == HIPBLAS_OP_T || trans == HIPBLAS_OP_C;
+    }
+
+    template <typename T, typename F>
+    hipblasStatus_t gemm_xt(F                  gemm,
+                            hipblasHandle_t    handle,
+                            hipblasOperation_t transa,
+                            hipblasOperation_t transb,
+                            int64_t            m,
+                            int64_t            n,
+                            int64_t            k,
+                            const T*           alpha,
+                            const T*           A,
+                            int64_t            lda,
+                            const T*           B,
+                            int64_t            ldb,
+                            const T*           beta,
+                            T*                 C,
+                            int64_t            ldc)
+    {
+        if(handle == nullptr)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if(!valid_operation(transa) || !valid_operation(transb))
+            return HIPBLAS_STATUS_INVALID_ENUM;
+
+        bool ta = transa != HIPBLAS_OP_N;
+        bool tb = transb != HIPBLAS_OP_N;
+        if(m < 0 || n < 0 || k < 0 || lda < std::max<int64_t>(1, ta ? k : m)
+           || ldb < std::max<int64_t>(1, tb ? n : k) || ldc < std::max<int64_t>(1, m))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(m == 0 || n == 0)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(alpha == nullptr || beta == nullptr || C == nullptr)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        if(k == 0 || is_zero(*alpha))
+        {
+            scale_host(C, ldc, n, *beta, [&](int64_t) { return std::make_pair(int64_t(0), m); });
+            return HIPBLAS_STATUS_SUCCESS;
+        }
+        if(A == nullptr || B == nullptr)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        int64_t            block = static_cast<hipblas_handle*>(handle)->xt_block_dim;
+        int                steps = int((k - 1) / block + 1);
+        std::vector<chain> tiles;
+        for(int64_t j = 0; j < n; j += block)
+            for(int64_t i = 0; i < m; i += block)
+            {
+                int rows = std::min(block, m - i);
+                tiles.push_back({{i, j, rows, int(std::min(block, n - j)), false, steps}});
+            }
+
+        auto depth = [&](int s) { return int(std::min(block, k - s * block)); };
+
+        return run_tiles(
+            handle,
+            tiles,
+            !is_zero(*beta),
+            C,
+            ldc,
+            [&](const c_tile& c, int s, host_block<const T>& a, host_block<const T>& b) {
+                int64_t l = s * block;
+                a = ta ? host_block<const T>{A + l + c.row * lda, lda, depth(s), c.rows}
+                       : host_block<const T>{A + c.row + l * lda, lda, c.rows, depth(s)};
+                b = tb ? host_block<const T>{B + c.col + l * ldb, ldb, c.cols, depth(s)}
+                       : host_block<const T>{B + l + c.col * ldb, ldb, depth(s), c.cols};
+            },
+            [&](hipblasHandle_t lane_handle,
+                const c_tile&   c,
+                int             s,
+                const T*        dA,
+                int             ldA,
+                const T*        dB,
+                int             ldB,
+                T*              dC) {
+                T beta_s = s == 0 ? *beta : T(1);
+                return gemm(lane_handle,
+                            transa,
+                            transb,
+                            c.rows,
+                            c.cols,
+                            depth(s),
+                            alpha,
+                            dA,
+                            ldA,
+                            dB,
+                            ldB,
+                            &beta_s,
+                            dC,
+                            c.rows);
+            });
+    }
+
+    // Diagonal tiles of C run as syrk on a block of op(A); the others, wholly inside the uplo
+    // triangle, as gemm of two such blocks
+    template <typename T, typename Fsyrk, typename Fgemm>
+    hipblasStatus_t syrk_xt(Fsyrk              syrk,
+                            Fgemm              gemm,
+                            hipblasHandle_t    handle,
+                            hipblasFillMode_t  uplo,
+                            hipblasOperation_t trans,
+                            int64_t            n,
+                            int64_t            k,
+                            const T*           alpha,
+                            const T*           A,
+                            int64_t            lda,
+                            const T*           beta,
+                            T*                 C,
+                            int64_t            ldc)
+    {
+        if(handle == nullptr)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if(uplo != HIPBLAS_FILL_MODE_UPPER && uplo != HIPBLAS_FILL_MODE_LOWER)
+            return HIPBLAS_STATUS_INVALID_ENUM;
+
+        // Only real syrk accepts a conjugate transpose, as a plain one
+        if(trans == HIPBLAS_OP_C && std::is_floating_point<T>{})
+            trans = HIPBLAS_OP_T;
+        if(trans != HIPBLAS_OP_N && trans != HIPBLAS_OP_T)
+            return HIPBLAS_STATUS_INVALID_ENUM;
+
+        bool tr    = trans == HIPBLAS_OP_T;
+        bool upper = uplo == HIPBLAS_FILL_MODE_UPPER;
+        if(n < 0 || k < 0 || lda < std::max<int64_t>(1, tr ? k : n)
+           || ldc < std::max<int64_t>(1, n))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(n == 0)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(alpha == nullptr || beta == nullptr || C == nullptr)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        if(k == 0 || is_zero(*alpha))
+        {
+            scale_host(C, ldc, n, *beta, [&](int64_t j) {
+                return upper ? std::make_pair(int64_t(0), j + 1) : std::make_pair(j, n);
+            });
+            return HIPBLAS_STATUS_SUCCESS;
+        }
+        if(A == nullptr)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        int64_t            block = static_cast<hipblas_handle*>(handle)->xt_block_dim;
+        int                steps = int((k - 1) / block + 1);
+        std::vector<chain> tiles;
+        for(int64_t j = 0; j < n; j += block)
+            for(int64_t i = upper ? 0 : j; i < (upper ? j + 1 : n); i += block)
+            {
+                int rows = std::min(block, n - i);
+                tiles.push_back({{i, j, rows, int(std::min(block, n - j)), i == j, steps}});
+            }
+
+        auto depth = [&](int s) { return int(std::min(block, k - s * block)); };
+
+        // The block of op(A) holding rows of C from row on
+        auto rows_of = [&](int64_t row, int rows, int s) {
+            int64_t l = s * block;
+            return tr ? host_block<const T>{A + l + row * lda, lda, depth(s), rows}
+                      : host_block<const T>{A + row + l * lda, lda, rows, depth(s)};
+        };
+
+        return run_tiles(
+            handle,
+            tiles,
+            !is_zero(*beta),
+            C,
+            ldc,
+            [&](const c_tile& c, int s, host_block<const T>& a, host_block<const T>& b) {
+                a = rows_of(c.row, c.rows, s);
+                b = c.diagonal ? host_block<const T>{nullptr, 0, 0, 0} : rows_of(c.col, c.cols, s);
+            },
+            [&](hipblasHandle_t lane_handle,
+                const c_tile&   c,
+                int             s,
+                const T*        dA,
+                int             ldA,
+                const T*        dB,
+                int             ldB,
+                T*              dC) {
+                T beta_s = s == 0 ? *beta : T(1);
+                if(c.diagonal)
+                    return syrk(lane_handle,
+                                uplo,
+                                trans,
+                                c.rows,
+                                depth(s),
+                                alpha,
+                                dA,
+                                ldA,
+                                &beta_s,
+                                dC,
+                                c.rows);
+                return gemm(lane_handle,
+                            tr ? HIPBLAS_OP_T : HIPBLAS_OP_N,
+                            tr ? HIPBLAS_OP_N : HIPBLAS_OP_T,
+                            c.rows,
+                            c.cols,
+                            depth(s),
+                            alpha,
+                            dA,
+                            ldA,
+                            dB,
+                            ldB,
+                            &beta_s,
+                            dC,
+                            c.rows);
+            });
+    }
+
+    // Splits the order of op(A) into blocks, taken in the order trsm solves them, and B into
+    // panels across them. Every tile of a panel first takes off the blocks of X already solved,
+    // with gemms reading them back from B, then runs trsm on its diagonal block of A; the tiles
+    // of a panel form a chain, and the panels are independent
+    template <typename T, typename Ftrsm, typename Fgemm>
+    hipblasStatus_t trsm_xt(Ftrsm              trsm,
+                            Fgemm              gemm,
+                            hipblasHandle_t    handle,
+                            hipblasSideMode_t  side,
+                            hipblasFillMode_t  uplo,
+                            hipblasOperation_t trans,
+                            hipblasDiagType_t  diag,
+                            int64_t            m,
+                            int64_t            n,
+                            const T*           alpha,
+                            const T*           A,
+                            int64_t            lda,
+                            T*                 B,
+                            int64_t            ldb)
+    {
+        if(handle == nullptr)
+            return HIPBLAS_STATUS_NOT_INITIALIZED;
+        if((side != HIPBLAS_SIDE_LEFT && side != HIPBLAS_SIDE_RIGHT)
+           || (uplo != HIPBLAS_FILL_MODE_UPPER && uplo != HIPBLAS_FILL_MODE_LOWER)
+           || !valid_operation(trans)
+           || (diag != HIPBLAS_DIAG_NON_UNIT && diag != HIPBLAS_DIAG_UNIT))
+            return HIPBLAS_STATUS_INVALID_ENUM;
+
+        bool    left  = side == HIPBLAS_SIDE_LEFT;
+        bool    tr    = trans != HIPBLAS_OP_N;
+        int64_t order = left ? m : n;
+        if(m < 0 || n < 0 || lda < std::max<int64_t>(1, order) || ldb < std::max<int64_t>(1, m))
+            return HIPBLAS_STATUS_INVALID_VALUE;
+        if(m == 0 || n == 0)
+            return HIPBLAS_STATUS_SUCCESS;
+        if(alpha == nullptr || B == nullptr)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        if(is_zero(*alpha))
+        {
+            scale_host(B, ldb, n, T(0), [&](int64_t) { return std::make_pair(int64_t(0), m); });
+            return HIPBLAS_STATUS_SUCCESS;
+        }
+        if(A == nullptr)
+            return HIPBLAS_STATUS_INVALID_VALUE;
+
+        // op(A) lower solves first to last on the left and last to first on the right
+        bool    lower   = (uplo == HIPBLAS_FILL_MODE_LOWER) != tr;
+        bool    forward = lower == left;
+        int64_t block   = static_cast<hipblas_handle*>(handle)->xt_block_dim;
+        int64_t blocks  = (order - 1) / block + 1;
+
+        // The start and size of the block solved at step s
+        auto solved = [&](int s) { return (forward ? s : blocks - 1 - s) * block; };
+        auto size   = [&](int64_t start) { return int(std::min(block, order - start)); };
+
+        int64_t            across = left ? n : m;
+        std::vector<chain> panels;
+        for(int64_t p = 0; p < across; p += block)
+        {
+            int   width = int(std::min(block, across - p));
+            chain panel;
+            for(int s = 0; s < blocks; s++)
+            {
+                int64_t d = solved(s);
+                panel.push_back(left ? c_tile{d, p, size(d), width, false, s + 1}
+                                     : c_tile{p, d, width, size(d), false, s + 1});
+            }
+            panels.push_back(panel);
+        }
+
+        return run_tiles(
+            handle,
+            panels,
+            true,
+            B,
+            ldb,
+            [&](const c_tile& c, int s, host_block<const T>& a, host_block<const T>& b) {
+                int64_t d = left ? c.row : c.col;
+                if(s == c.steps - 1)
+                {
+                    a = host_block<const T>{A + d + d * lda, lda, size(d), size(d)};
+                    b = host_block<const T>{nullptr, 0, 0, 0};
+                    return;
+                }
+
+                // op(A) between block l of X and block d of B, and the solved block l of X
+                int64_t             l = solved(s);
+                host_block<const T> op
+                    = tr == left ? host_block<const T>{A + l + d * lda, lda, size(l), size(d)}
+                                 : host_block<const T>{A + d + l * lda, lda, size(d), size(l)};
+                if(left)
+                {
+                    a = op;
+                    b = host_block<const T>{B + l + c.col * ldb, ldb, size(l), c.cols};
+                }
+                else
+                {
+                    a = host_block<const T>{B + c.row + l * ldb, ldb, c.rows, size(l)};
+                    b = op;
+                }
+            },
+            [&](hipblasHandle_t lane_handle,
+                const c_tile&   c,
+                int             s,
+                const T*        dA,
+                int             ldA,
+                const T*        dB,
+                int             ldB,
+                T*              dC) {
+                if(s == c.steps - 1)
+                {
+                    T alpha_s = c.steps == 1 ? *alpha : T(1);
+                    return trsm(lane_handle,
+                                side,
+                                uplo,
+                                trans,
+                                diag,
+                                c.rows,
+                                c.cols,
+                                &alpha_s,
+                                const_cast<T*>(dA),
+                                ldA,
+                                dC,
+                                c.rows);
+                }
+
+                T minus  = T(-1);
+                T beta_s = s == 0 ? *alpha : T(1);
+                return gemm(lane_handle,
+                            left ? trans : HIPBLAS_OP_N,
+                            left ? HIPBLAS_OP_N : trans,
+                            c.rows,
+                            c.cols,
+                            size(solved(s)),
+                            &minus,
+                            dA,
+                            ldA,
+                            dB,
+                            ldB,
+                            &beta_s,
+                            dC,
+                            c.rows);
+            });
+    }
+}
+
+hipblasStatus_t hipblasXtSgemm(hipblasHandle_t    handle,
+                               hipblasOperation_t transa,
+                               hipblasOperation_t transb,
+                               int64_t            m,
+                               int64_t            n,
+                               int64_t            k,
+                               const float*       alpha,
+                               const float*       A,
+                               int64_t            lda,
+                               const float*       B,
+                               int64_t            ldb,
+                               const float*       beta,
+                               float*             C,
+                               int64_t            ldc)
+{
+    HIPBLAS_LOG_CALL(handle, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+    return gemm_xt(
+        hipblasSgemm, handle, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+hipblasStatus_t hipblasXtDgemm(hipblasHandle_t    handle,
+                               hipblasOperation_t transa,
+                               hipblasOperation_t transb,
+                               int64_t            m,
+                               int64_t            n,
+                               int64_t            k,
+                               const double*      alpha,
+                               const double*      A,
+                               int64_t            lda,
+                               const double*      B,
+                               int64_t            ldb,
+                               const double*      beta,
+                               double*            C,
+                               int64_t            ldc)
+{
+    HIPBLAS_LOG_CALL(handle, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+    return gemm_xt(
+        hipblasDgemm, handle, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+hipblasStatus_t hipblasXtCgemm(hipblasHandle_t       handle,
+                               hipblasOperation_t    transa,
+                               hipblasOperation_t    transb,
+                               int64_t               m,
+                               int64_t               n,
+                               int64_t               k,
+                               const hipblasComplex* alpha,
+                               const hipblasComplex* A,
+                               int64_t               lda,
+                               const hipblasComplex* B,
+                               int64_t               ldb,
+                               const hipblasComplex* beta,
+                               hipblasComplex*       C,
+                               int64_t               ldc)
+{
+    HIPBLAS_LOG_CALL(handle, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+    return gemm_xt(
+        hipblasCgemm, handle, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+hipblasStatus_t hipblasXtZgemm(hipblasHandle_t             handle,
+                               hipblasOperation_t          transa,
+                               hipblasOperation_t          transb,
+                               int64_t                     m,
+                               int64_t                     n,
+                               int64_t                     k,
+                               const hipblasDoubleComplex* alpha,
+                               const hipblasDoubleComplex* A,
+                               int64_t                     lda,
+                               const hipblasDoubleComplex* B,
+                               int64_t                     ldb,
+                               const hipblasDoubleComplex* beta,
+                               hipblasDoubleComplex*       C,
+                               int64_t                     ldc)
+{
+    HIPBLAS_LOG_CALL(handle, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+    return gemm_xt(
+        hipblasZgemm, handle, transa, transb, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+hipblasStatus_t hipblasXtSsyrk(hipblasHandle_t    handle,
+                               hipblasFillMode_t  uplo,
+                               hipblasOperation_t transA,
+                               int64_t            n,
+                               int64_t            k,
+                               const float*       alpha,
+                               const float*       A,
+                               int64_t            lda,
+                               const float*       beta,
+                               float*             C,
+                               int64_t            ldc)
+{
+    HIPBLAS_LOG_CALL(handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc);
+    return syrk_xt(
+        hipblasSsyrk, hipblasSgemm, handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc);
+}
+
+hipblasStatus_t hipblasXtDsyrk(hipblasHandle_t    handle,
+                               hipblasFillMode_t  uplo,
+                               hipblasOperation_t transA,
+                               int64_t            n,
+                               int64_t            k,
+                               const double*      alpha,
+                               const double*      A,
+                               int64_t            lda,
+                               const double*      beta,
+                               double*            C,
+                               int64_t            ldc)
+{
+    HIPBLAS_LOG_CALL(handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc);
+    return syrk_xt(
+        hipblasDsyrk, hipblasDgemm, handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc);
+}
+
+hipblasStatus_t hipblasXtCsyrk(hipblasHandle_t       handle,
+                               hipblasFillMode_t     uplo,
+                               hipblasOperation_t    transA,
+                               int64_t               n,
+                               int64_t               k,
+                               const hipblasComplex* alpha,
+                               const hipblasComplex* A,
+                               int64_t               lda,
+                               const hipblasComplex* beta,
+                               hipblasComplex*       C,
+                               int64_t               ldc)
+{
+    HIPBLAS_LOG_CALL(handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc);
+    return syrk_xt(
+        hipblasCsyrk, hipblasCgemm, handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc);
+}
+
+hipblasStatus_t hipblasXtZsyrk(hipblasHandle_t             handle,
+                               hipblasFillMode_t           uplo,
+                               hipblasOperation_t          transA,
+                               int64_t                     n,
+                               int64_t                     k,
+                               const hipblasDoubleComplex* alpha,
+                               const hipblasDoubleComplex* A,
+                               int64_t                     lda,
+                               const hipblasDoubleComplex* beta,
+                               hipblasDoubleComplex*       C,
+                               int64_t                     ldc)
+{
+    HIPBLAS_LOG_CALL(handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc);
+    return syrk_xt(
+        hipblasZsyrk, hipblasZgemm, handle, uplo, transA, n, k, alpha, A, lda, beta, C, ldc);
+}
+
+hipblasStatus_t hipblasXtStrsm(hipblasHandle_t    handle,
+                               hipblasSideMode_t  side,
+                               hipblasFillMode_t  uplo,
+                               hipblasOperation_t transA,
+                               hipblasDiagType_t  diag,
+                               int64_t            m,
+                               int64_t            n,
+                               const float*       alpha,
+                               const float*       A,
+                               int64_t            lda,
+                               float*             B,
+                               int64_t            ldb)
+{
+    HIPBLAS_LOG_CALL(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
+    return trsm_xt(
+        hipblasStrsm, hipblasSgemm, handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
+}
+
+hipblasStatus_t hipblasXtDtrsm(hipblasHandle_t    handle,
+                               hipblasSideMode_t  side,
+                               hipblasFillMode_t  uplo,
+                               hipblasOperation_t transA,
+                               hipblasDiagType_t  diag,
+                               int64_t            m,
+                               int64_t            n,
+                               const double*      alpha,
+                               const double*      A,
+                               int64_t            lda,
+                               double*            B,
+                               int64_t            ldb)
+{
+    HIPBLAS_LOG_CALL(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
+    return trsm_xt(
+        hipblasDtrsm, hipblasDgemm, handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
+}
+
+hipblasStatus_t hipblasXtCtrsm(hipblasHandle_t       handle,
+                               hipblasSideMode_t     side,
+                               hipblasFillMode_t     uplo,
+                               hipblasOperation_t    transA,
+                               hipblasDiagType_t     diag,
+                               int64_t               m,
+                               int64_t               n,
+                               const hipblasComplex* alpha,
+                               const hipblasComplex* A,
+                               int64_t               lda,
+                               hipblasComplex*       B,
+                               int64_t               ldb)
+{
+    HIPBLAS_LOG_CALL(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
+    return trsm_xt(
+        hipblasCtrsm, hipblasCgemm, handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
+}
+
+hipblasStatus_t hipblasXtZtrsm(hipblasHandle_t             handle,
+                               hipblasSideMode_t           side,
+                               hipblasFillMode_t           uplo,
+                               hipblasOperation_t          transA,
+                               hipblasDiagType_t           diag,
+                               int64_t                     m,
+                               int64_t                     n,
+                               const hipblasDoubleComplex* alpha,
+                               const hipblasDoubleComplex* A,
+                               int64_t                     lda,
+                               hipblasDoubleComplex*       B,
+                               int64_t                     ldb)
+{
+    HIPBLAS_LOG_CALL(handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
+    return trsm_xt(
+        hipblasZtrsm, hipblasZgemm, handle, side, uplo, transA, diag, m, n, alpha, A, lda, B, ldb);
+}